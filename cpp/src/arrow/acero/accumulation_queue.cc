@@ -22,6 +22,7 @@
 #include <queue>
 #include <vector>
 
+#include "arrow/acero/memory_budget.h"
 #include "arrow/compute/exec.h"
 #include "arrow/util/logging.h"
 
@@ -29,37 +30,73 @@ namespace arrow {
 namespace acero {
 namespace util {
 using arrow::compute::ExecBatch;
+AccumulationQueue::~AccumulationQueue() { ReleaseReservation(); }
+
 AccumulationQueue::AccumulationQueue(AccumulationQueue&& that) {
   this->batches_ = std::move(that.batches_);
   this->row_count_ = that.row_count_;
+  this->memory_budget_ = that.memory_budget_;
+  this->bytes_reserved_ = that.bytes_reserved_;
+  that.bytes_reserved_ = 0;
   that.Clear();
 }
 
 AccumulationQueue& AccumulationQueue::operator=(AccumulationQueue&& that) {
+  ReleaseReservation();
   this->batches_ = std::move(that.batches_);
   this->row_count_ = that.row_count_;
+  this->memory_budget_ = that.memory_budget_;
+  this->bytes_reserved_ = that.bytes_reserved_;
+  that.bytes_reserved_ = 0;
   that.Clear();
   return *this;
 }
 
+void AccumulationQueue::set_memory_budget(MemoryBudget* budget) {
+  DCHECK(empty());
+  memory_budget_ = budget;
+}
+
 void AccumulationQueue::Concatenate(AccumulationQueue&& that) {
   this->batches_.reserve(this->batches_.size() + that.batches_.size());
   std::move(that.batches_.begin(), that.batches_.end(),
             std::back_inserter(this->batches_));
   this->row_count_ += that.row_count_;
+  if (this->memory_budget_ == that.memory_budget_) {
+    this->bytes_reserved_ += that.bytes_reserved_;
+    that.bytes_reserved_ = 0;
+  } else if (this->memory_budget_ == NULLPTR) {
+    // Adopt the budget, which is then the only one reserved from
+    this->memory_budget_ = that.memory_budget_;
+    this->bytes_reserved_ = that.bytes_reserved_;
+    that.bytes_reserved_ = 0;
+  }
   that.Clear();
 }
 
 void AccumulationQueue::InsertBatch(ExecBatch batch) {
   row_count_ += batch.length;
+  if (memory_budget_ != NULLPTR) {
+    int64_t batch_bytes = batch.TotalBufferSize();
+    memory_budget_->Reserve(batch_bytes);
+    bytes_reserved_ += batch_bytes;
+  }
   batches_.emplace_back(std::move(batch));
 }
 
 void AccumulationQueue::Clear() {
+  ReleaseReservation();
   row_count_ = 0;
   batches_.clear();
 }
 
+void AccumulationQueue::ReleaseReservation() {
+  if (bytes_reserved_ > 0) {
+    memory_budget_->Release(bytes_reserved_);
+    bytes_reserved_ = 0;
+  }
+}
+
 ExecBatch& AccumulationQueue::operator[](size_t i) { return batches_[i]; }
 
 namespace {
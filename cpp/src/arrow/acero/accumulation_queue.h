@@ -27,16 +27,24 @@
 
 namespace arrow {
 namespace acero {
+
+class MemoryBudget;
+
 namespace util {
 
 using arrow::compute::ExecBatch;
 
 /// \brief A container that accumulates batches until they are ready to
 ///        be processed.
+///
+/// If given a memory budget, the queue reserves the size of the batches it holds
+/// from it.  The reservation moves along with the batches when the queue is moved
+/// or concatenated into another queue, and is released when the queue is cleared
+/// or destroyed.
 class AccumulationQueue {
  public:
   AccumulationQueue() : row_count_(0) {}
-  ~AccumulationQueue() = default;
+  ~AccumulationQueue();
 
   // We should never be copying ExecBatch around
   AccumulationQueue(const AccumulationQueue&) = delete;
@@ -45,6 +53,11 @@ class AccumulationQueue {
   AccumulationQueue(AccumulationQueue&& that);
   AccumulationQueue& operator=(AccumulationQueue&& that);
 
+  /// \brief Reserve the size of the batches from `budget`, which may be null
+  ///
+  /// Must be called while the queue is empty.
+  void set_memory_budget(MemoryBudget* budget);
+
   void Concatenate(AccumulationQueue&& that);
   void InsertBatch(ExecBatch batch);
   int64_t row_count() { return row_count_; }
@@ -54,8 +67,12 @@ class AccumulationQueue {
   ExecBatch& operator[](size_t i);
 
  private:
+  void ReleaseReservation();
+
   int64_t row_count_;
   std::vector<ExecBatch> batches_;
+  MemoryBudget* memory_budget_ = NULLPTR;
+  int64_t bytes_reserved_ = 0;
 };
 
 /// A queue that sequences incoming batches
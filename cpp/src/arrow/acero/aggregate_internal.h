@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <forward_list>
 #include <mutex>
 #include <sstream>
@@ -30,9 +31,11 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
+#include "arrow/compute/kernels/aggregate_fused_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/compute/row/grouper.h"
 #include "arrow/datum.h"
@@ -158,6 +161,16 @@ Result<std::vector<Datum>> ExtractValues(const ExecBatch& input_batch,
 
 void PlaceFields(ExecBatch& batch, size_t base, std::vector<Datum>& values);
 
+/// Scalar aggregates of one column which are computed in a single pass over it
+struct FusedAggregates {
+  /// Indices of the aggregates; their own kernel states are left unused
+  std::vector<int> aggregate_ids;
+  /// Index of the target field shared by the aggregates
+  int target_field_id;
+  /// One aggregator per thread
+  std::vector<std::unique_ptr<compute::internal::FusedScalarAggregator>> states;
+};
+
 class ScalarAggregateNode : public ExecNode, public TracedNode {
  public:
   ScalarAggregateNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
@@ -168,7 +181,8 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
                       std::vector<Aggregate> aggs,
                       std::vector<const ScalarAggregateKernel*> kernels,
                       std::vector<std::vector<TypeHolder>> kernel_intypes,
-                      std::vector<std::vector<std::unique_ptr<KernelState>>> states)
+                      std::vector<std::vector<std::unique_ptr<KernelState>>> states,
+                      std::vector<FusedAggregates> fused = {})
       : ExecNode(plan, std::move(inputs), {"target"},
                  /*output_schema=*/std::move(output_schema)),
         TracedNode(this),
@@ -178,7 +192,15 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
         aggs_(std::move(aggs)),
         kernels_(std::move(kernels)),
         kernel_intypes_(std::move(kernel_intypes)),
-        states_(std::move(states)) {}
+        states_(std::move(states)),
+        fused_(std::move(fused)),
+        is_fused_(kernels_.size(), false) {
+    for (const auto& fused_aggregates : fused_) {
+      for (int id : fused_aggregates.aggregate_ids) {
+        is_fused_[id] = true;
+      }
+    }
+  }
 
   static Result<AggregateNodeArgs<ScalarAggregateKernel>> MakeAggregateNodeArgs(
       const std::shared_ptr<Schema>& input_schema, const std::vector<FieldRef>& keys,
@@ -235,6 +257,11 @@ class ScalarAggregateNode : public ExecNode, public TracedNode {
   std::vector<std::vector<TypeHolder>> kernel_intypes_;
   std::vector<std::vector<std::unique_ptr<KernelState>>> states_;
 
+  // Groups of same-column aggregates computed by a FusedScalarAggregator instead of
+  // their own kernels
+  std::vector<FusedAggregates> fused_;
+  std::vector<bool> is_fused_;
+
   AtomicCounter input_counter_;
   /// \brief Total number of output batches produced
   int total_output_batches_ = 0;
@@ -248,7 +275,8 @@ class GroupByNode : public ExecNode, public TracedNode {
               std::vector<std::vector<TypeHolder>> agg_src_types,
               std::vector<std::vector<int>> agg_src_fieldsets,
               std::vector<Aggregate> aggs,
-              std::vector<const HashAggregateKernel*> agg_kernels)
+              std::vector<const HashAggregateKernel*> agg_kernels,
+              int64_t spill_threshold_bytes = -1, int num_spill_partitions = 1)
       : ExecNode(input->plan(), {input}, {"groupby"}, std::move(output_schema)),
         TracedNode(this),
         segmenter_(std::move(segmenter)),
@@ -257,7 +285,10 @@ class GroupByNode : public ExecNode, public TracedNode {
         agg_src_types_(std::move(agg_src_types)),
         agg_src_fieldsets_(std::move(agg_src_fieldsets)),
         aggs_(std::move(aggs)),
-        agg_kernels_(std::move(agg_kernels)) {}
+        agg_kernels_(std::move(agg_kernels)) {
+    spill_.threshold_bytes = spill_threshold_bytes;
+    spill_.num_partitions = num_spill_partitions;
+  }
 
   Status Init() override;
 
@@ -290,6 +321,12 @@ class GroupByNode : public ExecNode, public TracedNode {
   Status StartProducing() override {
     NoteStartProducing(ToStringExtra(0));
     local_states_.resize(plan_->query_context()->max_concurrency());
+    if (partitioned()) {
+      spill_.partition_states.resize(local_states_.size());
+      for (auto& states : spill_.partition_states) {
+        states.resize(spill_.num_partitions);
+      }
+    }
     return Status::OK();
   }
 
@@ -321,6 +358,33 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   Status InitLocalStateIfNeeded(ThreadLocalState* state);
 
+  Status ConsumeIntoState(ThreadLocalState* state, const ExecSpan& batch);
+
+  Status MergeStates(ThreadLocalState* state0, ThreadLocalState* state);
+
+  Result<ExecBatch> FinalizeState(ThreadLocalState* state);
+
+  bool spilling_enabled() const { return spill_.threshold_bytes >= 0; }
+
+  bool partitioned() const { return spilling_enabled() || spill_.num_partitions > 1; }
+
+  // Partitioned variants of Consume and OutputResult, see the comment on spill_
+  Status ConsumePartitioned(const ExecBatch& batch);
+
+  Status StartSpilling();
+
+  Status SpillBatch(size_t thread_index, const ExecBatch& batch);
+
+  Status MaybeOutputPartitions(bool input_finished);
+
+  Status OutputPartitions();
+
+  // Releases what was reserved from the memory budget for the batches consumed in
+  // memory, once the partitions are output
+  void ReleaseMemoryReservation();
+
+  Status OutputPartition(int prtn);
+
   int output_batch_size() const {
     int result =
         static_cast<int>(plan_->query_context()->exec_context()->exec_chunksize());
@@ -331,6 +395,7 @@ class GroupByNode : public ExecNode, public TracedNode {
   }
 
   int output_task_group_id_;
+  int merge_task_group_id_;
   /// \brief A segmenter for the segment-keys
   std::unique_ptr<RowSegmenter> segmenter_;
   /// \brief Holds values of the current batch that were selected for the segment-keys
@@ -351,6 +416,31 @@ class GroupByNode : public ExecNode, public TracedNode {
 
   std::vector<ThreadLocalState> local_states_;
   ExecBatch out_data_;
+
+  // When spilling or partitioned merging is enabled every input batch is split on the
+  // hash of the keys and each partition is aggregated into its own set of thread local
+  // states.  When spilling, once the input aggregated in memory exceeds the threshold,
+  // the remaining input rows are appended to one file per partition instead.  When all
+  // input has been consumed and all writes have completed, the partitions are
+  // finished: the thread local states of the partition are merged, any spilled rows
+  // are read back and consumed into the merged state, and the result is output.  The
+  // partitions are finished one at a time from an IO task if anything was spilled,
+  // and in parallel CPU tasks otherwise.
+  struct {
+    int64_t threshold_bytes = -1;
+    int num_partitions = 1;
+    std::atomic<int64_t> bytes_in_memory{0};
+    std::atomic<bool> active{false};
+    std::atomic<int> pending_writes{0};
+    std::mutex mutex;
+    bool input_finished = false;
+    bool output_started = false;
+    std::atomic<int> num_output_batches{0};
+    // [thread_index][partition]
+    std::vector<std::vector<ThreadLocalState>> partition_states;
+    std::unique_ptr<SpillDirectory> directory;
+    std::vector<std::unique_ptr<SpillFile>> files;
+  } spill_;
 };
 
 }  // namespace aggregate
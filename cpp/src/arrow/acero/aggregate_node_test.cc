@@ -27,6 +27,7 @@
 #include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/string.h"
 
@@ -210,5 +211,145 @@ TEST(GroupByNode, NoSkipNulls) {
   AssertExecBatchesEqualIgnoringOrder(out_schema, {expected_batch}, out_batches.batches);
 }
 
+TEST(GroupByNode, Spilling) {
+  constexpr int kNumBatches = 24;
+  constexpr int kBatchSize = 512;
+
+  random::RandomArrayGenerator rng(42);
+  BatchesWithSchema input;
+  input.schema = schema({field("key1", int32()), field("key2", utf8()),
+                         field("value", int32())});
+  for (int i = 0; i < kNumBatches; ++i) {
+    input.batches.push_back(ExecBatch({rng.Int32(kBatchSize, 0, 300, 0.05),
+                                       rng.String(kBatchSize, 0, 1, 0.1),
+                                       rng.Int32(kBatchSize, -1000, 1000, 0.1)},
+                                      kBatchSize));
+  }
+
+  std::vector<Aggregate> aggregates = {
+      {"hash_sum", nullptr, FieldRef("value"), "sum"},
+      {"hash_count", nullptr, FieldRef("value"), "count"},
+      {"hash_mean", nullptr, FieldRef("value"), "mean"},
+      {"hash_max", nullptr, FieldRef("value"), "max"},
+      {"hash_count_distinct", nullptr, FieldRef("value"), "count_distinct"},
+  };
+
+  auto run_group_by = [&](bool parallel, int64_t spill_threshold_bytes)
+      -> Result<std::shared_ptr<Table>> {
+    AggregateNodeOptions options(aggregates, {"key1", "key2"});
+    options.spill_threshold_bytes = spill_threshold_bytes;
+    options.num_spill_partitions = 5;
+    Declaration plan = Declaration::Sequence(
+        {{"source",
+          SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+         {"aggregate", std::move(options)}});
+    return DeclarationToTable(std::move(plan), parallel);
+  };
+
+  for (bool parallel : {false, true}) {
+    ARROW_SCOPED_TRACE("parallel = ", parallel);
+    ASSERT_OK_AND_ASSIGN(auto expected, run_group_by(parallel, -1));
+    ASSERT_GT(expected->num_rows(), 300);
+    // Partitioned, but entirely in memory
+    ASSERT_OK_AND_ASSIGN(auto in_memory, run_group_by(parallel, int64_t(1) << 30));
+    AssertTablesEqualIgnoringOrder(expected, in_memory);
+    // Spills part of the input
+    ASSERT_OK_AND_ASSIGN(auto partly_spilled, run_group_by(parallel, 32 * 1024));
+    AssertTablesEqualIgnoringOrder(expected, partly_spilled);
+    // Spills all of the input
+    ASSERT_OK_AND_ASSIGN(auto spilled, run_group_by(parallel, 0));
+    AssertTablesEqualIgnoringOrder(expected, spilled);
+  }
+}
+
+TEST(GroupByNode, PartitionedMerge) {
+  constexpr int kNumBatches = 24;
+  constexpr int kBatchSize = 512;
+
+  random::RandomArrayGenerator rng(42);
+  BatchesWithSchema input;
+  input.schema = schema({field("key", int32()), field("value", int32())});
+  for (int i = 0; i < kNumBatches; ++i) {
+    input.batches.push_back(ExecBatch({rng.Int32(kBatchSize, 0, 5000, 0.05),
+                                       rng.Int32(kBatchSize, -1000, 1000, 0.1)},
+                                      kBatchSize));
+  }
+
+  std::vector<Aggregate> aggregates = {
+      {"hash_sum", nullptr, FieldRef("value"), "sum"},
+      {"hash_min_max", nullptr, FieldRef("value"), "min_max"},
+      {"hash_count_distinct", nullptr, FieldRef("value"), "count_distinct"},
+  };
+
+  auto run_group_by = [&](bool parallel,
+                          int num_merge_partitions) -> Result<std::shared_ptr<Table>> {
+    AggregateNodeOptions options(aggregates, {"key"});
+    options.num_merge_partitions = num_merge_partitions;
+    Declaration plan = Declaration::Sequence(
+        {{"source",
+          SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+         {"aggregate", std::move(options)}});
+    return DeclarationToTable(std::move(plan), parallel);
+  };
+
+  for (bool parallel : {false, true}) {
+    ARROW_SCOPED_TRACE("parallel = ", parallel);
+    ASSERT_OK_AND_ASSIGN(auto expected, run_group_by(parallel, 1));
+    ASSERT_GT(expected->num_rows(), 3000);
+    for (int num_merge_partitions : {2, 16}) {
+      ARROW_SCOPED_TRACE("num_merge_partitions = ", num_merge_partitions);
+      ASSERT_OK_AND_ASSIGN(auto actual, run_group_by(parallel, num_merge_partitions));
+      AssertTablesEqualIgnoringOrder(expected, actual);
+    }
+  }
+
+  auto in_schema = schema({field("key", int32()), field("segment_key", int32()),
+                           field("value", int32())});
+  auto make_plan = [&](AggregateNodeOptions options, int num_merge_partitions) {
+    options.num_merge_partitions = num_merge_partitions;
+    return Declaration::Sequence(
+        {{"exec_batch_source",
+          ExecBatchSourceNodeOptions(in_schema, std::vector<ExecBatch>{})},
+         {"aggregate", std::move(options)}});
+  };
+  AggregateNodeOptions segmented({{"hash_sum", nullptr, FieldRef("value"), "sum"}},
+                                 {"key"}, {"segment_key"});
+  ASSERT_RAISES(NotImplemented, DeclarationToTable(make_plan(segmented, 4),
+                                                   /*use_threads=*/false));
+  ASSERT_OK(DeclarationToTable(make_plan(segmented, 1), /*use_threads=*/false));
+  AggregateNodeOptions no_partitions({{"hash_sum", nullptr, FieldRef("value"), "sum"}},
+                                     {"key"});
+  ASSERT_RAISES(Invalid, DeclarationToTable(make_plan(no_partitions, 0),
+                                            /*use_threads=*/false));
+}
+
+TEST(GroupByNode, SpillingUnsupported) {
+  auto in_schema = schema({field("key", int32()), field("segment_key", int32()),
+                           field("value", int32())});
+  auto make_plan = [&](AggregateNodeOptions options) {
+    options.spill_threshold_bytes = 0;
+    return Declaration::Sequence(
+        {{"exec_batch_source",
+          ExecBatchSourceNodeOptions(in_schema, std::vector<ExecBatch>{})},
+         {"aggregate", std::move(options)}});
+  };
+
+  AggregateNodeOptions segmented({{"hash_sum", nullptr, FieldRef("value"), "sum"}},
+                                 {"key"}, {"segment_key"});
+  ASSERT_RAISES(NotImplemented, DeclarationToTable(make_plan(segmented),
+                                                   /*use_threads=*/false));
+
+  AggregateNodeOptions ordered({{"hash_first", nullptr, FieldRef("value"), "first"}},
+                               {"key"});
+  ASSERT_RAISES(NotImplemented, DeclarationToTable(make_plan(ordered),
+                                                   /*use_threads=*/false));
+
+  AggregateNodeOptions no_partitions({{"hash_sum", nullptr, FieldRef("value"), "sum"}},
+                                     {"key"});
+  no_partitions.num_spill_partitions = 0;
+  ASSERT_RAISES(Invalid, DeclarationToTable(make_plan(no_partitions),
+                                            /*use_threads=*/false));
+}
+
 }  // namespace acero
 }  // namespace arrow
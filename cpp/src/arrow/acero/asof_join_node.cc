@@ -21,6 +21,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -38,10 +39,12 @@
 #endif
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/schema_util.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_primitive.h"
 #ifndef NDEBUG
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/function_internal.h"
 #endif
 #include "arrow/acero/time_series_util.h"
@@ -456,19 +459,49 @@ class KeyHasher {
   arrow::util::TempVectorStack stack_;
 };
 
+// Shared by the controllers of the partitions of an input, which is paused for as long
+// as any of its partitions has too many queued batches
+struct PartitionedBackpressure {
+  std::mutex mutex;
+  int num_paused = 0;
+};
+
 class BackpressureController : public BackpressureControl {
  public:
   BackpressureController(ExecNode* node, ExecNode* output,
-                         std::atomic<int32_t>& backpressure_counter)
-      : node_(node), output_(output), backpressure_counter_(backpressure_counter) {}
+                         std::atomic<int32_t>& backpressure_counter,
+                         std::shared_ptr<PartitionedBackpressure> partitioned)
+      : node_(node),
+        output_(output),
+        backpressure_counter_(backpressure_counter),
+        partitioned_(std::move(partitioned)) {}
+
+  void Pause() override {
+    if (partitioned_) {
+      std::lock_guard<std::mutex> lock(partitioned_->mutex);
+      if (paused_) return;
+      paused_ = true;
+      if (partitioned_->num_paused++ > 0) return;
+    }
+    node_->PauseProducing(output_, ++backpressure_counter_);
+  }
 
-  void Pause() override { node_->PauseProducing(output_, ++backpressure_counter_); }
-  void Resume() override { node_->ResumeProducing(output_, ++backpressure_counter_); }
+  void Resume() override {
+    if (partitioned_) {
+      std::lock_guard<std::mutex> lock(partitioned_->mutex);
+      if (!paused_) return;
+      paused_ = false;
+      if (--partitioned_->num_paused > 0) return;
+    }
+    node_->ResumeProducing(output_, ++backpressure_counter_);
+  }
 
  private:
   ExecNode* node_;
   ExecNode* output_;
   std::atomic<int32_t>& backpressure_counter_;
+  std::shared_ptr<PartitionedBackpressure> partitioned_;
+  bool paused_ = false;
 };
 
 class InputState {
@@ -504,12 +537,14 @@ class InputState {
       size_t index, TolType tolerance, bool must_hash, bool may_rehash,
       KeyHasher* key_hasher, ExecNode* asof_input, AsofJoinNode* asof_node,
       std::atomic<int32_t>& backpressure_counter,
+      std::shared_ptr<PartitionedBackpressure> partitioned_backpressure,
       const std::shared_ptr<arrow::Schema>& schema, const col_index_t time_col_index,
       const std::vector<col_index_t>& key_col_index) {
     constexpr size_t low_threshold = 4, high_threshold = 8;
     std::unique_ptr<BackpressureControl> backpressure_control =
         std::make_unique<BackpressureController>(
-            /*node=*/asof_input, /*output=*/asof_node, backpressure_counter);
+            /*node=*/asof_input, /*output=*/asof_node, backpressure_counter,
+            std::move(partitioned_backpressure));
     ARROW_ASSIGN_OR_RAISE(
         auto handler, BackpressureHandler::Make(asof_input, low_threshold, high_threshold,
                                                 std::move(backpressure_control)));
@@ -559,6 +594,10 @@ class InputState {
     return memo_.no_future_ ? GetLatestTime() : static_cast<OnType>(memo_.current_time_);
   }
 
+  // true when the memo may not have future entries (the case of a non-positive
+  // tolerance), in which case the latest row is only current once it passed the LHS time
+  bool NoFuture() const { return memo_.no_future_; }
+
   int total_batches() const { return total_batches_; }
 
   // Gets latest batch (precondition: must not be empty)
@@ -917,45 +956,59 @@ class CompositeTableBuilder {
 // values are processed. Thus, AsofJoinNode is currently limited to about 100k by-keys for
 // guaranteeing this probability is below 1 in a billion. The fix is 128-bit hashing.
 // See ARROW-17653
-class AsofJoinNode : public ExecNode {
+class AsofJoinNode : public ExecNode, public TracedNode {
+  // The input states of one partition of the inputs, one per input
+  using PartitionState = std::vector<std::unique_ptr<InputState>>;
+
+  struct Partition {
+    // InputStates
+    // Each input state corresponds to an input table
+    PartitionState state;
+    // Output batches not yet emitted, when there are several partitions
+    std::deque<std::shared_ptr<RecordBatch>> output;
+  };
+
   // Advances the RHS as far as possible to be up to date for the current LHS timestamp
-  Result<bool> UpdateRhs() {
-    auto& lhs = *state_.at(0);
+  static Result<bool> UpdateRhs(PartitionState& state) {
+    auto& lhs = *state.at(0);
     auto lhs_latest_time = lhs.GetLatestTime();
     bool any_updated = false;
-    for (size_t i = 1; i < state_.size(); ++i) {
-      ARROW_ASSIGN_OR_RAISE(bool advanced, state_[i]->AdvanceAndMemoize(lhs_latest_time));
+    for (size_t i = 1; i < state.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(bool advanced, state[i]->AdvanceAndMemoize(lhs_latest_time));
       any_updated |= advanced;
     }
     return any_updated;
   }
 
   // Returns false if RHS not up to date for LHS
-  bool IsUpToDateWithLhsRow() const {
-    auto& lhs = *state_[0];
+  static bool IsUpToDateWithLhsRow(const PartitionState& state) {
+    auto& lhs = *state[0];
     if (lhs.Empty()) return false;  // can't proceed if nothing on the LHS
     OnType lhs_ts = lhs.GetLatestTime();
-    for (size_t i = 1; i < state_.size(); ++i) {
-      auto& rhs = *state_[i];
+    for (size_t i = 1; i < state.size(); ++i) {
+      auto& rhs = *state[i];
       if (!rhs.Finished()) {
         // If RHS is finished, then we know it's up to date
         if (rhs.CurrentEmpty())
           return false;  // RHS isn't finished, but is empty --> not up to date
-        if (lhs_ts > rhs.GetCurrentTime())
+        OnType rhs_ts = rhs.GetCurrentTime();
+        if (lhs_ts > rhs_ts)
           return false;  // RHS isn't up to date (and not finished)
+        if (lhs_ts == rhs_ts && rhs.NoFuture())
+          return false;  // RHS row at LHS time pushed after the RHS was last advanced
       }
     }
     return true;
   }
 
-  Result<std::shared_ptr<RecordBatch>> ProcessInner() {
-    DCHECK(!state_.empty());
-    auto& lhs = *state_.at(0);
+  Result<std::shared_ptr<RecordBatch>> ProcessInner(PartitionState& state) {
+    DCHECK(!state.empty());
+    auto& lhs = *state.at(0);
 
     // Construct new target table if needed
-    CompositeTableBuilder<MAX_JOIN_TABLES> dst(state_, output_schema_,
+    CompositeTableBuilder<MAX_JOIN_TABLES> dst(state, output_schema_,
                                                plan()->query_context()->memory_pool(),
-                                               DEBUG_ADD(state_.size(), this));
+                                               DEBUG_ADD(state.size(), this));
 
     // Generate rows into the dst table until we either run out of data or hit the row
     // limit, or run out of input
@@ -964,15 +1017,15 @@ class AsofJoinNode : public ExecNode {
       if (lhs.Finished() || lhs.Empty()) break;
 
       // Advance each of the RHS as far as possible to be up to date for the LHS timestamp
-      ARROW_ASSIGN_OR_RAISE(bool any_rhs_advanced, UpdateRhs());
+      ARROW_ASSIGN_OR_RAISE(bool any_rhs_advanced, UpdateRhs(state));
 
       // If we have received enough inputs to produce the next output batch
       // (decided by IsUpToDateWithLhsRow), we will perform the join and
       // materialize the output batch. The join is done by advancing through
       // the LHS and adding joined row to rows_ (done by Emplace). Finally,
       // input batches that are no longer needed are removed to free up memory.
-      if (IsUpToDateWithLhsRow()) {
-        dst.Emplace(state_, tolerance_);
+      if (IsUpToDateWithLhsRow(state)) {
+        dst.Emplace(state, tolerance_);
         ARROW_ASSIGN_OR_RAISE(bool advanced, lhs.Advance());
         if (!advanced) break;  // if we can't advance LHS, we're done for this batch
       } else {
@@ -982,10 +1035,10 @@ class AsofJoinNode : public ExecNode {
 
     // Prune memo entries that have expired (to bound memory consumption)
     if (!lhs.Empty()) {
-      for (size_t i = 1; i < state_.size(); ++i) {
+      for (size_t i = 1; i < state.size(); ++i) {
         OnType ts = tolerance_.Expiry(lhs.GetLatestTime());
         if (ts != TolType::kMinValue) {
-          state_[i]->RemoveMemoEntriesWithLesserTime(ts);
+          state[i]->RemoveMemoEntriesWithLesserTime(ts);
         }
       }
     }
@@ -1017,45 +1070,172 @@ class AsofJoinNode : public ExecNode {
           if (st.ok()) {
             st = output_->InputFinished(this, batches_produced_);
           }
-          for (const auto& s : state_) {
-            st &= s->ForceShutdown();
+          for (const auto& partition : partitions_) {
+            for (const auto& s : partition.state) {
+              st &= s->ForceShutdown();
+            }
           }
         }));
   }
 
+  bool LhsFinished() const {
+    for (const auto& partition : partitions_) {
+      if (!partition.state.at(0)->Finished()) return false;
+    }
+    return true;
+  }
+
   bool CheckEnded() {
-    if (state_.at(0)->Finished()) {
-      EndFromProcessThread();
+    if (LhsFinished()) {
+      // The output of all partitions is complete, whatever remains of it can be emitted
+      EndFromProcessThread(EmitPartitionOutput(TolType::kMaxValue));
       return false;
     }
     return true;
   }
 
+  Status EmitBatch(const std::shared_ptr<RecordBatch>& out_rb) {
+    ExecBatch out_b(*out_rb);
+    out_b.index = batches_produced_++;
+    DEBUG_SYNC(this, "produce batch ", out_b.index, ":", DEBUG_MANIP(std::endl),
+               out_rb->ToString(), DEBUG_MANIP(std::endl));
+    return output_->InputReceived(this, std::move(out_b));
+  }
+
+  // Matches the rows of a partition as far as possible, queueing the output
+  Status ProcessPartition(Partition* partition) {
+    for (;;) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> out_rb,
+                            ProcessInner(partition->state));
+      if (!out_rb) return Status::OK();
+      partition->output.push_back(std::move(out_rb));
+    }
+  }
+
+  // The time up to which the output of a partition is complete: its future output rows
+  // have no lesser on-key value
+  OnType PartitionOutputHorizon(const Partition& partition) const {
+    const InputState& lhs = *partition.state[0];
+    if (lhs.Finished()) return TolType::kMaxValue;
+    if (!lhs.Empty()) return lhs.GetLatestTime();
+    // Any LHS row yet to come to this partition belongs to a batch starting no earlier
+    return lhs_time_bound_.load();
+  }
+
+  // Matches the partitions in parallel on the executor, then emits their output up to
+  // the time before which all partitions are complete
+  Status ProcessPartitions() {
+    auto* executor = plan_->query_context()->executor();
+    std::vector<Future<>> futures;
+    for (size_t i = 1; i < partitions_.size(); ++i) {
+      Partition* partition = &partitions_[i];
+      futures.push_back(DeferNotOk(
+          executor->Submit([this, partition] { return ProcessPartition(partition); })));
+    }
+    Status st = ProcessPartition(&partitions_[0]);
+    for (auto& future : futures) {
+      st &= future.status();
+    }
+    RETURN_NOT_OK(st);
+
+    OnType horizon = TolType::kMaxValue;
+    for (const auto& partition : partitions_) {
+      horizon = std::min(horizon, PartitionOutputHorizon(partition));
+    }
+    return EmitPartitionOutput(horizon);
+  }
+
+  // Emits the queued output rows of all partitions with an on-key value up to the given
+  // horizon, merged in on-key order
+  Status EmitPartitionOutput(OnType horizon) {
+    const col_index_t time_col = indices_of_on_key_[0];
+    const Type::type time_type = output_schema_->field(time_col)->type()->id();
+    std::vector<std::shared_ptr<RecordBatch>> ready;
+    for (auto& partition : partitions_) {
+      auto& output = partition.output;
+      while (!output.empty()) {
+        const std::shared_ptr<RecordBatch>& rb = output.front();
+        // Output rows are in on-key order within a partition
+        row_index_t lo = 0, hi = rb->num_rows();
+        while (lo < hi) {
+          row_index_t mid = lo + (hi - lo) / 2;
+          if (GetTime(rb.get(), time_type, time_col, mid) <= horizon) {
+            lo = mid + 1;
+          } else {
+            hi = mid;
+          }
+        }
+        if (lo == static_cast<row_index_t>(rb->num_rows())) {
+          ready.push_back(rb);
+          output.pop_front();
+          continue;
+        }
+        if (lo > 0) {
+          ready.push_back(rb->Slice(0, lo));
+          output.front() = rb->Slice(lo);
+        }
+        break;
+      }
+    }
+    if (ready.empty()) return Status::OK();
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<RecordBatch> merged,
+        ConcatenateRecordBatches(ready, plan_->query_context()->memory_pool()));
+    if (ready.size() > 1) {
+      // A stable sort keeps the on-key order of each partition
+      ExecContext* ctx = plan_->query_context()->exec_context();
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<Array> indices,
+          compute::SortIndices(*merged->column(time_col), compute::SortOrder::Ascending,
+                               ctx));
+      ARROW_ASSIGN_OR_RAISE(Datum sorted, compute::Take(merged, indices,
+                                                        compute::TakeOptions(), ctx));
+      merged = sorted.record_batch();
+    }
+    return EmitBatch(merged);
+  }
+
+  // Records the total batch counts of the inputs finished since the last call
+  void ApplyFinishedInputs() {
+    std::lock_guard<std::mutex> guard(finished_inputs_mutex_);
+    for (const auto& [k, total_batches] : finished_inputs_) {
+      for (auto& partition : partitions_) {
+        partition.state.at(k)->set_total_batches(total_batches);
+      }
+    }
+    finished_inputs_.clear();
+  }
+
   bool Process() {
     std::lock_guard<std::mutex> guard(gate_);
+    ApplyFinishedInputs();
     if (!CheckEnded()) {
       return false;
     }
 
-    // Process batches while we have data
-    for (;;) {
-      Result<std::shared_ptr<RecordBatch>> result = ProcessInner();
-
-      if (result.ok()) {
-        auto out_rb = *result;
-        if (!out_rb) break;
-        ExecBatch out_b(*out_rb);
-        out_b.index = batches_produced_++;
-        DEBUG_SYNC(this, "produce batch ", out_b.index, ":", DEBUG_MANIP(std::endl),
-                   out_rb->ToString(), DEBUG_MANIP(std::endl));
-        Status st = output_->InputReceived(this, std::move(out_b));
-        if (!st.ok()) {
-          EndFromProcessThread(std::move(st));
-        }
-      } else {
-        EndFromProcessThread(result.status());
+    if (partitions_.size() > 1) {
+      Status st = ProcessPartitions();
+      if (!st.ok()) {
+        EndFromProcessThread(std::move(st));
         return false;
       }
+    } else {
+      // Process batches while we have data
+      for (;;) {
+        Result<std::shared_ptr<RecordBatch>> result = ProcessInner(partitions_[0].state);
+
+        if (result.ok()) {
+          auto out_rb = *result;
+          if (!out_rb) break;
+          Status st = EmitBatch(out_rb);
+          if (!st.ok()) {
+            EndFromProcessThread(std::move(st));
+          }
+        } else {
+          EndFromProcessThread(result.status());
+          return false;
+        }
+      }
     }
 
     // Report to the output the total batch count, if we've already finished everything
@@ -1096,21 +1276,33 @@ class AsofJoinNode : public ExecNode {
 
   Status Init() override {
     auto inputs = this->inputs();
-    for (size_t i = 0; i < inputs.size(); i++) {
-      RETURN_NOT_OK(key_hashers_[i]->Init(plan()->query_context()->exec_context(),
-                                          inputs[i]->output_schema()));
-      ARROW_ASSIGN_OR_RAISE(
-          auto input_state,
-          InputState::Make(i, tolerance_, must_hash_, may_rehash_, key_hashers_[i].get(),
-                           inputs[i], this, backpressure_counter_,
-                           inputs[i]->output_schema(), indices_of_on_key_[i],
-                           indices_of_by_key_[i]));
-      state_.push_back(std::move(input_state));
+    size_t num_partitions = key_hashers_.size() / inputs.size();
+    std::vector<std::shared_ptr<PartitionedBackpressure>> partitioned_backpressure(
+        inputs.size());
+    if (num_partitions > 1) {
+      for (auto& backpressure : partitioned_backpressure) {
+        backpressure = std::make_shared<PartitionedBackpressure>();
+      }
     }
+    partitions_ = std::vector<Partition>(num_partitions);
+    for (size_t p = 0; p < num_partitions; p++) {
+      for (size_t i = 0; i < inputs.size(); i++) {
+        KeyHasher* key_hasher = key_hashers_[p * inputs.size() + i].get();
+        RETURN_NOT_OK(key_hasher->Init(plan()->query_context()->exec_context(),
+                                       inputs[i]->output_schema()));
+        ARROW_ASSIGN_OR_RAISE(
+            auto input_state,
+            InputState::Make(i, tolerance_, must_hash_, may_rehash_, key_hasher,
+                             inputs[i], this, backpressure_counter_,
+                             partitioned_backpressure[i], inputs[i]->output_schema(),
+                             indices_of_on_key_[i], indices_of_by_key_[i]));
+        partitions_[p].state.push_back(std::move(input_state));
+      }
 
-    col_index_t dst_offset = 0;
-    for (auto& state : state_)
-      dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
+      col_index_t dst_offset = 0;
+      for (auto& state : partitions_[p].state)
+        dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
+    }
 
     return Status::OK();
   }
@@ -1355,10 +1547,20 @@ class AsofJoinNode : public ExecNode {
     ARROW_ASSIGN_OR_RAISE(
         std::shared_ptr<Schema> output_schema,
         MakeOutputSchema(input_schema, indices_of_on_key, indices_of_by_key));
+    if (join_options.num_partitions < 1) {
+      return Status::Invalid("AsofJoin requires at least one partition, got ",
+                             join_options.num_partitions);
+    }
+    if (join_options.num_partitions > 1 && n_by == 0) {
+      return Status::Invalid("AsofJoin can only partition its inputs on a by-key");
+    }
 
+    // One key hasher per input of each partition
     std::vector<std::unique_ptr<KeyHasher>> key_hashers;
-    for (size_t i = 0; i < n_input; i++) {
-      key_hashers.push_back(std::make_unique<KeyHasher>(i, indices_of_by_key[i]));
+    for (int p = 0; p < join_options.num_partitions; p++) {
+      for (size_t i = 0; i < n_input; i++) {
+        key_hashers.push_back(std::make_unique<KeyHasher>(i, indices_of_by_key[i]));
+      }
     }
     bool must_hash =
         n_by > 1 ||
@@ -1376,6 +1578,7 @@ class AsofJoinNode : public ExecNode {
   const Ordering& ordering() const override { return ordering_; }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    NoteInputReceived(input, batch);
     // InputReceived may be called after execution was finished. Pushing it to the
     // InputState is unnecessary since we're done (and anyway may cause the
     // BackPressureController to pause the input, causing a deadlock), so drop it.
@@ -1389,22 +1592,63 @@ class AsofJoinNode : public ExecNode {
     ARROW_DCHECK(std_has(inputs_, input));
     size_t k = std_find(inputs_, input) - inputs_.begin();
 
+    if (partitions_.size() > 1) {
+      ARROW_RETURN_NOT_OK(PushPartitioned(k, batch));
+      process_.Push(true);
+      return Status::OK();
+    }
+
     // Put into the queue
     auto rb = *batch.ToRecordBatch(input->output_schema());
     DEBUG_SYNC(this, "received batch from input ", k, ":", DEBUG_MANIP(std::endl),
                rb->ToString(), DEBUG_MANIP(std::endl));
 
-    ARROW_RETURN_NOT_OK(state_.at(k)->Push(rb));
+    ARROW_RETURN_NOT_OK(partitions_[0].state.at(k)->Push(rb));
     process_.Push(true);
     return Status::OK();
   }
 
+  // Splits a batch of input k on the hash of the by-key, so that each partition receives
+  // one (possibly empty) batch for every input batch
+  Status PushPartitioned(size_t k, const ExecBatch& batch) {
+    const auto& schema = inputs_[k]->output_schema();
+    QueryContext* ctx = plan_->query_context();
+    ARROW_ASSIGN_OR_RAISE(
+        std::vector<ExecBatch> parts,
+        PartitionBatchByHash(batch, indices_of_by_key_[k],
+                             static_cast<int>(partitions_.size()), ctx,
+                             ctx->GetThreadIndex()));
+    if (k == 0 && batch.length > 0) {
+      // Rows in this batch and later ones have no lesser on-key value
+      ARROW_ASSIGN_OR_RAISE(auto rb, batch.ToRecordBatch(schema));
+      OnType time = GetTime(rb.get(), schema->field(indices_of_on_key_[0])->type()->id(),
+                            indices_of_on_key_[0], 0);
+      OnType bound = lhs_time_bound_.load();
+      while (bound < time && !lhs_time_bound_.compare_exchange_weak(bound, time)) {
+      }
+    }
+    for (size_t p = 0; p < partitions_.size(); p++) {
+      std::shared_ptr<RecordBatch> rb;
+      if (parts[p].length == 0) {
+        ARROW_ASSIGN_OR_RAISE(rb, RecordBatch::MakeEmpty(schema, ctx->memory_pool()));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(rb, parts[p].ToRecordBatch(schema));
+      }
+      DEBUG_SYNC(this, "received batch from input ", k, " for partition ", p, ":",
+                 DEBUG_MANIP(std::endl), rb->ToString(), DEBUG_MANIP(std::endl));
+      ARROW_RETURN_NOT_OK(partitions_[p].state.at(k)->Push(rb));
+    }
+    return Status::OK();
+  }
+
   Status InputFinished(ExecNode* input, int total_batches) override {
     {
-      std::lock_guard<std::mutex> guard(gate_);
+      // Not under gate_, which the process thread holds while waiting for the partitions
+      // to be matched on the executor
+      std::lock_guard<std::mutex> guard(finished_inputs_mutex_);
       ARROW_DCHECK(std_has(inputs_, input));
       size_t k = std_find(inputs_, input) - inputs_.begin();
-      state_.at(k)->set_total_batches(total_batches);
+      finished_inputs_.emplace_back(k, total_batches);
     }
     // Trigger a process call
     // The reason for this is that there are cases at the end of a table where we don't
@@ -1452,10 +1696,15 @@ class AsofJoinNode : public ExecNode {
   std::vector<std::unique_ptr<KeyHasher>> key_hashers_;
   bool must_hash_;
   bool may_rehash_;
-  // InputStates
-  // Each input state corresponds to an input table
-  std::vector<std::unique_ptr<InputState>> state_;
+  // The inputs are split into independently matched partitions on the hash of the
+  // by-key.  There is a single partition unless the options ask for more.
+  std::vector<Partition> partitions_;
+  // The on-key value of the first row of the latest LHS batch received
+  std::atomic<OnType> lhs_time_bound_{TolType::kMinValue};
   std::mutex gate_;
+  // The inputs finished since the last call to Process, with their total batch counts
+  std::mutex finished_inputs_mutex_;
+  std::vector<std::pair<size_t, int>> finished_inputs_;
   TolType tolerance_;
 #ifndef NDEBUG
   std::ostream* debug_os_;
@@ -1485,6 +1734,7 @@ AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
                            bool must_hash, bool may_rehash)
     : ExecNode(plan, inputs, input_labels,
                /*output_schema=*/std::move(output_schema)),
+      TracedNode(this),
       ordering_({SortKey(indices_of_on_key[0])}),
       indices_of_on_key_(std::move(indices_of_on_key)),
       indices_of_by_key_(std::move(indices_of_by_key)),
@@ -1648,6 +1648,119 @@ TEST(AsofJoinTest, OutputSchemaResolution) {
 
 namespace {
 
+// Random input with non-decreasing times and `num_keys` distinct by-key values
+std::shared_ptr<Table> MakePartitioningTestTable(uint32_t seed, const std::string& value,
+                                                 int num_rows, int num_keys,
+                                                 bool string_keys) {
+  std::mt19937 gen(seed);
+  Int64Builder time_builder, value_builder;
+  Int32Builder int_key_builder;
+  StringBuilder string_key_builder;
+  int64_t time = 0;
+  for (int i = 0; i < num_rows; ++i) {
+    time += gen() % 3;
+    int key = static_cast<int>(gen() % num_keys);
+    ARROW_EXPECT_OK(time_builder.Append(time));
+    if (string_keys) {
+      ARROW_EXPECT_OK(string_key_builder.Append("key" + std::to_string(key)));
+    } else {
+      ARROW_EXPECT_OK(int_key_builder.Append(key));
+    }
+    ARROW_EXPECT_OK(value_builder.Append(i));
+  }
+  std::shared_ptr<Array> keys = string_keys ? string_key_builder.Finish().ValueOrDie()
+                                            : int_key_builder.Finish().ValueOrDie();
+  return Table::Make(schema({field("time", int64()), field("key", keys->type()),
+                             field(value, int64())}),
+                     {time_builder.Finish().ValueOrDie(), keys,
+                      value_builder.Finish().ValueOrDie()});
+}
+
+}  // namespace
+
+TEST(AsofJoinTest, PartitionedByKey) {
+  constexpr int kNumRows = 2000;
+  constexpr int kNumKeys = 300;
+  for (bool string_keys : {false, true}) {
+    auto l_table =
+        MakePartitioningTestTable(1, "l_value", kNumRows, kNumKeys, string_keys);
+    auto r0_table =
+        MakePartitioningTestTable(2, "r0_value", kNumRows, kNumKeys, string_keys);
+    auto r1_table =
+        MakePartitioningTestTable(3, "r1_value", kNumRows, kNumKeys, string_keys);
+    for (int64_t tolerance : {-5, 0, 7}) {
+      auto run = [&](int num_partitions, int64_t max_batch_size, bool use_threads) {
+        AsofJoinNodeOptions options = GetRepeatedOptions(3, "time", {"key"}, tolerance);
+        options.num_partitions = num_partitions;
+        Declaration asofjoin{
+            "asofjoin",
+            {Declaration{"table_source", TableSourceNodeOptions(l_table, max_batch_size)},
+             Declaration{"table_source",
+                         TableSourceNodeOptions(r0_table, max_batch_size)},
+             Declaration{"table_source",
+                         TableSourceNodeOptions(r1_table, max_batch_size)}},
+            std::move(options)};
+        QueryOptions query_options;
+        query_options.use_threads = use_threads;
+        return DeclarationToTable(std::move(asofjoin), query_options);
+      };
+      ASSERT_OK_AND_ASSIGN(auto expected, run(1, kNumRows, false));
+      ASSERT_EQ(kNumRows, expected->num_rows());
+
+      // Rows of equal time but different keys may be output in a different order
+      auto sort = [](const std::shared_ptr<Table>& table) {
+        auto indices =
+            compute::SortIndices(Datum(table),
+                                 compute::SortOptions({compute::SortKey("time"),
+                                                       compute::SortKey("l_value")}))
+                .ValueOrDie();
+        return compute::Take(table, indices).ValueOrDie().table();
+      };
+      for (int num_partitions : {4, 16}) {
+        for (int64_t max_batch_size : {64, 1000}) {
+          for (bool use_threads : {false, true}) {
+            ARROW_SCOPED_TRACE("string_keys=", string_keys, " tolerance=", tolerance,
+                               " num_partitions=", num_partitions,
+                               " max_batch_size=", max_batch_size,
+                               " use_threads=", use_threads);
+            ASSERT_OK_AND_ASSIGN(auto actual,
+                                 run(num_partitions, max_batch_size, use_threads));
+            ASSERT_OK_AND_ASSIGN(auto combined, actual->CombineChunks());
+            auto time_values = internal::checked_pointer_cast<Int64Array>(
+                combined->GetColumnByName("time")->chunk(0));
+            for (int64_t i = 1; i < time_values->length(); ++i) {
+              ASSERT_LE(time_values->Value(i - 1), time_values->Value(i));
+            }
+            AssertTablesEqual(*sort(expected), *sort(actual),
+                              /*same_chunk_layout=*/false);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(AsofJoinTest, PartitionedInvalid) {
+  auto l_table = MakePartitioningTestTable(1, "l_value", 10, 3, false);
+  auto r_table = MakePartitioningTestTable(2, "r0_value", 10, 3, false);
+  auto check_invalid = [&](AsofJoinNodeOptions options, const std::string& message) {
+    Declaration asofjoin{"asofjoin",
+                         {Declaration{"table_source", TableSourceNodeOptions(l_table)},
+                          Declaration{"table_source", TableSourceNodeOptions(r_table)}},
+                         std::move(options)};
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr(message),
+                                    DeclarationToStatus(std::move(asofjoin)));
+  };
+  AsofJoinNodeOptions no_partitions = GetRepeatedOptions(2, "time", {"key"}, 0);
+  no_partitions.num_partitions = 0;
+  check_invalid(no_partitions, "requires at least one partition, got 0");
+  AsofJoinNodeOptions no_by_key = GetRepeatedOptions(2, "time", {}, 0);
+  no_by_key.num_partitions = 4;
+  check_invalid(no_by_key, "can only partition its inputs on a by-key");
+}
+
+namespace {
+
 Result<AsyncGenerator<std::optional<ExecBatch>>> MakeIntegerBatchGenForTest(
     const std::vector<std::function<int64_t(int)>>& gens,
     const std::shared_ptr<Schema>& schema, int num_batches, int batch_size) {
@@ -182,10 +182,21 @@ void BlockedBloomFilter::Find(int64_t hardware_flags, int64_t num_rows,
                               bool enable_prefetch) const {
   int64_t num_processed = 0;
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (!(enable_prefetch && UsePrefetch()) &&
+      (hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+          arrow::internal::CpuInfo::AVX512) {
+    // Processes multiples of 16 rows, the AVX2 path below may pick up 8 more.
+    //
+    num_processed = Find_avx512(num_rows, hashes, result_bit_vector);
+  }
+#endif
+
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (!(enable_prefetch && UsePrefetch()) &&
       (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
-    num_processed = Find_avx2(num_rows, hashes, result_bit_vector);
+    num_processed += Find_avx2(num_rows - num_processed, hashes + num_processed,
+                               result_bit_vector + num_processed / 8);
     // Make sure that the results in bit vector for the remaining rows start at
     // a byte boundary.
     //
@@ -203,10 +214,21 @@ void BlockedBloomFilter::Find(int64_t hardware_flags, int64_t num_rows,
                               bool enable_prefetch) const {
   int64_t num_processed = 0;
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (!(enable_prefetch && UsePrefetch()) &&
+      (hardware_flags & arrow::internal::CpuInfo::AVX512) ==
+          arrow::internal::CpuInfo::AVX512) {
+    // Processes multiples of 16 rows, the AVX2 path below may pick up 8 more.
+    //
+    num_processed = Find_avx512(num_rows, hashes, result_bit_vector);
+  }
+#endif
+
 #if defined(ARROW_HAVE_RUNTIME_AVX2)
   if (!(enable_prefetch && UsePrefetch()) &&
       (hardware_flags & arrow::internal::CpuInfo::AVX2)) {
-    num_processed = Find_avx2(num_rows, hashes, result_bit_vector);
+    num_processed += Find_avx2(num_rows - num_processed, hashes + num_processed,
+                               result_bit_vector + num_processed / 8);
     num_processed -= (num_processed % 8);
   }
 #endif
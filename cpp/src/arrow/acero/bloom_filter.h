@@ -17,7 +17,7 @@
 
 #pragma once
 
-#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#if defined(ARROW_HAVE_RUNTIME_AVX2) || defined(ARROW_HAVE_RUNTIME_AVX512)
 #include <immintrin.h>
 #endif
 
@@ -220,6 +220,18 @@ class ARROW_ACERO_EXPORT BlockedBloomFilter {
                        uint8_t* result_bit_vector) const;
 #endif
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  inline __m512i mask_avx512(__m512i hash) const;
+  inline __m512i block_id_avx512(__m512i hash) const;
+  int64_t Find_avx512(int64_t num_rows, const uint32_t* hashes,
+                      uint8_t* result_bit_vector) const;
+  int64_t Find_avx512(int64_t num_rows, const uint64_t* hashes,
+                      uint8_t* result_bit_vector) const;
+  template <typename T>
+  int64_t FindImp_avx512(int64_t num_rows, const T* hashes,
+                         uint8_t* result_bit_vector) const;
+#endif
+
   bool UsePrefetch() const {
     return num_blocks_ * sizeof(uint64_t) > kPrefetchLimitBytes;
   }
@@ -0,0 +1,295 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace acero {
+namespace {
+
+// Concatenate the rows of `batches`.  Columns holding the same scalar in every batch
+// stay scalars, the others are materialized.
+Result<ExecBatch> ConcatenateBatches(const std::vector<ExecBatch>& batches,
+                                     MemoryPool* pool) {
+  int64_t length = 0;
+  for (const ExecBatch& batch : batches) {
+    length += batch.length;
+  }
+  ExecBatch out(std::vector<Datum>(batches[0].values.size()), length);
+  for (size_t i = 0; i < out.values.size(); ++i) {
+    const Datum& first = batches[0].values[i];
+    const bool same_scalar =
+        first.is_scalar() &&
+        std::all_of(batches.begin(), batches.end(), [&](const ExecBatch& batch) {
+          const Datum& value = batch.values[i];
+          return value.is_scalar() && value.scalar()->Equals(*first.scalar());
+        });
+    if (same_scalar) {
+      out.values[i] = first;
+      continue;
+    }
+    ArrayVector arrays;
+    arrays.reserve(batches.size());
+    for (const ExecBatch& batch : batches) {
+      const Datum& value = batch.values[i];
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(auto array,
+                              MakeArrayFromScalar(*value.scalar(), batch.length, pool));
+        arrays.push_back(std::move(array));
+      } else {
+        arrays.push_back(value.make_array());
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(out.values[i], Concatenate(arrays, pool));
+  }
+  // A guarantee only holds for the result if it holds for every batch
+  const Expression& guarantee = batches[0].guarantee;
+  if (std::all_of(batches.begin(), batches.end(), [&](const ExecBatch& batch) {
+        return batch.guarantee.Equals(guarantee);
+      })) {
+    out.guarantee = guarantee;
+  }
+  return out;
+}
+
+class CoalesceNode : public ExecNode,
+                     public TracedNode,
+                     util::SequencingQueue::Processor {
+ public:
+  CoalesceNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+               std::shared_ptr<Schema> output_schema, int64_t target_rows,
+               int max_buffered_batches)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        target_rows_(target_rows),
+        max_buffered_batches_(max_buffered_batches) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "CoalesceNode"));
+
+    const auto& coalesce_options = checked_cast<const CoalesceNodeOptions&>(options);
+    if (coalesce_options.target_rows <= 0) {
+      return Status::Invalid("`target_rows` must be positive");
+    }
+    if (coalesce_options.max_buffered_batches <= 0) {
+      return Status::Invalid("`max_buffered_batches` must be positive");
+    }
+
+    std::shared_ptr<Schema> output_schema = inputs[0]->output_schema();
+    return plan->EmplaceNode<CoalesceNode>(plan, std::move(inputs),
+                                           std::move(output_schema),
+                                           coalesce_options.target_rows,
+                                           coalesce_options.max_buffered_batches);
+  }
+
+  const char* kind_name() const override { return "CoalesceNode"; }
+
+  const Ordering& ordering() const override { return inputs_[0]->ordering(); }
+
+  Status Init() override {
+    // Ordered batches are merged in order, others as they arrive
+    if (!inputs_[0]->ordering().is_unordered()) {
+      sequencing_queue_ = util::SequencingQueue::Make(this);
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (in_batch_counter_.SetTotal(total_batches)) {
+      return Finish();
+    }
+    return Status::OK();
+  }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(input, batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    if (sequencing_queue_) {
+      return sequencing_queue_->InsertBatch(std::move(batch));
+    }
+    std::vector<ExecBatch> to_send;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ARROW_ASSIGN_OR_RAISE(to_send, Accumulate(std::move(batch)));
+    }
+    RETURN_NOT_OK(Send(std::move(to_send)));
+    if (in_batch_counter_.Increment()) {
+      return Finish();
+    }
+    return Status::OK();
+  }
+
+  Result<std::optional<util::SequencingQueue::Task>> Process(ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> to_send, Accumulate(std::move(batch)));
+    std::optional<util::SequencingQueue::Task> task_or_none;
+    if (!to_send.empty()) {
+      task_or_none = [this, to_send = std::move(to_send)]() mutable {
+        return Send(std::move(to_send));
+      };
+    }
+    if (in_batch_counter_.Increment()) {
+      RETURN_NOT_OK(Finish());
+    }
+    return task_or_none;
+  }
+
+  void Schedule(util::SequencingQueue::Task task) override {
+    plan_->query_context()->ScheduleTask(std::move(task), "CoalesceNode::Send");
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "target_rows=" << target_rows_
+       << " max_buffered_batches=" << max_buffered_batches_;
+    return ss.str();
+  }
+
+ private:
+  // Returns the batches to send downstream, with their output index set.  Calls are
+  // serialized, in input order if it is meaningful.
+  Result<std::vector<ExecBatch>> Accumulate(ExecBatch batch) {
+    std::vector<ExecBatch> to_send;
+    if (batch.length == 0) {
+      return to_send;
+    }
+    if (batch.length >= target_rows_ / 2) {
+      if (sequencing_queue_) {
+        // Buffered rows come first
+        ARROW_ASSIGN_OR_RAISE(std::optional<ExecBatch> flushed, Flush());
+        if (flushed) to_send.push_back(*std::move(flushed));
+      }
+      batch.index = out_batch_count_++;
+      to_send.push_back(std::move(batch));
+      return to_send;
+    }
+    buffered_rows_ += batch.length;
+    buffered_.push_back(std::move(batch));
+    if (buffered_rows_ >= target_rows_ ||
+        static_cast<int>(buffered_.size()) >= max_buffered_batches_) {
+      ARROW_ASSIGN_OR_RAISE(std::optional<ExecBatch> flushed, Flush());
+      to_send.push_back(*std::move(flushed));
+    }
+    return to_send;
+  }
+
+  Result<std::optional<ExecBatch>> Flush() {
+    if (buffered_.empty()) {
+      return std::nullopt;
+    }
+    ExecBatch out;
+    if (buffered_.size() == 1) {
+      out = std::move(buffered_[0]);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          out, ConcatenateBatches(buffered_, plan_->query_context()->memory_pool()));
+    }
+    buffered_.clear();
+    buffered_rows_ = 0;
+    out.index = out_batch_count_++;
+    return out;
+  }
+
+  Status Send(std::vector<ExecBatch> batches) {
+    for (ExecBatch& batch : batches) {
+      RETURN_NOT_OK(output_->InputReceived(this, std::move(batch)));
+    }
+    return Status::OK();
+  }
+
+  // Called once all input batches were accumulated
+  Status Finish() {
+    std::optional<ExecBatch> flushed;
+    int total_batches;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ARROW_ASSIGN_OR_RAISE(flushed, Flush());
+      total_batches = out_batch_count_;
+    }
+    if (flushed) {
+      RETURN_NOT_OK(output_->InputReceived(this, *std::move(flushed)));
+    }
+    return output_->InputFinished(this, total_batches);
+  }
+
+  const int64_t target_rows_;
+  const int max_buffered_batches_;
+  std::unique_ptr<util::SequencingQueue> sequencing_queue_;
+  AtomicCounter in_batch_counter_;
+
+  // Guards the following members when the input is unordered, the sequencing queue
+  // serializing accesses otherwise
+  std::mutex mutex_;
+  std::vector<ExecBatch> buffered_;
+  int64_t buffered_rows_ = 0;
+  int out_batch_count_ = 0;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterCoalesceNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(CoalesceNodeOptions::kName),
+                                 CoalesceNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
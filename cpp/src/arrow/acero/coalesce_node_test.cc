@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace acero {
+
+static constexpr int kNumRows = 1000;
+
+// A table with an "id" column numbering the rows and a "value" column with nulls
+std::shared_ptr<Table> TestTable() {
+  Int32Builder id_builder, value_builder;
+  for (int i = 0; i < kNumRows; ++i) {
+    ARROW_EXPECT_OK(id_builder.Append(i));
+    if (i % 7 == 0) {
+      ARROW_EXPECT_OK(value_builder.AppendNull());
+    } else {
+      ARROW_EXPECT_OK(value_builder.Append(i * 3));
+    }
+  }
+  return Table::Make(schema({field("id", int32()), field("value", int32())}),
+                     {id_builder.Finish().ValueOrDie(),
+                      value_builder.Finish().ValueOrDie()});
+}
+
+Declaration CoalescePlan(const std::shared_ptr<Table>& input, int64_t input_batch_size,
+                         CoalesceNodeOptions options) {
+  return Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input, input_batch_size)},
+       {"coalesce", std::move(options)}});
+}
+
+std::vector<int64_t> BatchLengths(Declaration plan, bool use_threads) {
+  auto batches = DeclarationToExecBatches(std::move(plan), use_threads).ValueOrDie();
+  std::vector<int64_t> lengths;
+  for (const ExecBatch& batch : batches.batches) {
+    lengths.push_back(batch.length);
+  }
+  return lengths;
+}
+
+TEST(CoalesceNode, Rows) {
+  auto input = TestTable();
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    Declaration plan = Declaration::Sequence(
+        {CoalescePlan(input, 10, CoalesceNodeOptions(64)),
+         {"order_by", OrderByNodeOptions(Ordering({compute::SortKey("id")}))}});
+    ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(std::move(plan), use_threads));
+    AssertTablesEqual(*input, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(CoalesceNode, KeepsOrder) {
+  auto input = TestTable();
+  Declaration plan = CoalescePlan(input, 10, CoalesceNodeOptions(64));
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       DeclarationToTable(std::move(plan), /*use_threads=*/false));
+  AssertTablesEqual(*input, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(CoalesceNode, BatchLengths) {
+  auto input = TestTable();
+  // Small batches are merged until reaching the target
+  std::vector<int64_t> expected(14, 70);
+  expected.push_back(20);
+  ASSERT_EQ(expected, BatchLengths(CoalescePlan(input, 10, CoalesceNodeOptions(64)),
+                                   /*use_threads=*/false));
+
+  // Until too many are buffered
+  expected.assign(33, 30);
+  expected.push_back(10);
+  ASSERT_EQ(expected,
+            BatchLengths(CoalescePlan(input, 10, CoalesceNodeOptions(64, 3)),
+                         /*use_threads=*/false));
+
+  // Large batches are left alone
+  expected.assign(10, 100);
+  ASSERT_EQ(expected, BatchLengths(CoalescePlan(input, 100, CoalesceNodeOptions(64)),
+                                   /*use_threads=*/false));
+
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    auto lengths = BatchLengths(CoalescePlan(input, 10, CoalesceNodeOptions(64)),
+                                use_threads);
+    int64_t total = 0;
+    for (int64_t length : lengths) {
+      total += length;
+    }
+    ASSERT_EQ(total, kNumRows);
+    // At most one batch, the last one, is shorter than the target
+    ASSERT_LE(std::count_if(lengths.begin(), lengths.end(),
+                            [](int64_t length) { return length < 64; }),
+              1);
+  }
+}
+
+TEST(CoalesceNode, InvalidOptions) {
+  auto input = TestTable();
+  ASSERT_RAISES(Invalid,
+                DeclarationToTable(CoalescePlan(input, 10, CoalesceNodeOptions(0))));
+  ASSERT_RAISES(Invalid,
+                DeclarationToTable(CoalescePlan(input, 10, CoalesceNodeOptions(64, 0))));
+}
+
+}  // namespace acero
+}  // namespace arrow
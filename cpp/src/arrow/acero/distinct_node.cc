@@ -0,0 +1,518 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/memory_budget.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/spilling_util.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::ExecSpan;
+using compute::FilterOptions;
+using compute::Grouper;
+
+namespace acero {
+namespace {
+
+// The keys seen by one hash partition of a distinct node
+struct DistinctPartition {
+  std::mutex mutex;
+  std::unique_ptr<Grouper> grouper;
+  // An estimate of the memory used by the keys in `grouper`
+  int64_t key_bytes = 0;
+  // Once the partition is spilled, the keys it had seen and its further input rows
+  // are written to these files
+  std::unique_ptr<SpillFile> keys_file;
+  std::unique_ptr<SpillFile> rows_file;
+};
+
+class DistinctNode : public ExecNode,
+                     public TracedNode,
+                     util::SequencingQueue::Processor {
+ public:
+  DistinctNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+               std::shared_ptr<Schema> output_schema, DistinctNodeOptions options,
+               std::vector<int> key_ids, std::shared_ptr<Schema> key_schema)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        options_(std::move(options)),
+        key_ids_(std::move(key_ids)),
+        key_schema_(std::move(key_schema)),
+        partitions_(partitioned() ? options_.num_spill_partitions : 1) {
+    // An ordered input is deduplicated in order so that the first row with each key,
+    // in the order of the input, is the one that is output
+    if (!partitioned() && !inputs_[0]->ordering().is_unordered()) {
+      sequencing_queue_ = util::SequencingQueue::Make(this);
+    }
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "DistinctNode"));
+
+    const auto& distinct_options = checked_cast<const DistinctNodeOptions&>(options);
+    const auto& input_schema = inputs[0]->output_schema();
+
+    std::vector<int> key_ids;
+    if (distinct_options.keys.empty()) {
+      for (int i = 0; i < input_schema->num_fields(); ++i) {
+        key_ids.push_back(i);
+      }
+    }
+    for (const FieldRef& key : distinct_options.keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*input_schema));
+      if (match.indices().size() > 1) {
+        return Status::NotImplemented("Nested references as distinct keys");
+      }
+      key_ids.push_back(match[0]);
+    }
+    if (key_ids.empty()) {
+      return Status::Invalid("A distinct node requires at least one key");
+    }
+
+    bool spilling = distinct_options.spill_threshold_bytes >= 0;
+    if (distinct_options.approximate && !spilling) {
+      return Status::Invalid(
+          "An approximate distinct node requires spill_threshold_bytes to be set");
+    }
+    if (spilling && distinct_options.num_spill_partitions < 1) {
+      return Status::Invalid("num_spill_partitions must be positive, got ",
+                             distinct_options.num_spill_partitions);
+    }
+
+    FieldVector key_fields;
+    std::vector<TypeHolder> key_types;
+    for (int key_id : key_ids) {
+      const auto& key_field = input_schema->field(key_id);
+      if (spilling && !distinct_options.approximate &&
+          key_field->type()->id() == Type::DICTIONARY) {
+        return Status::NotImplemented("Spilling distinct node with dictionary key '",
+                                      key_field->name(), "'");
+      }
+      key_fields.push_back(key_field);
+      key_types.emplace_back(key_field->type().get());
+    }
+    // Checks that the key types are supported
+    RETURN_NOT_OK(Grouper::Make(key_types, plan->query_context()->exec_context()));
+
+    return plan->EmplaceNode<DistinctNode>(plan, std::move(inputs), input_schema,
+                                           distinct_options, std::move(key_ids),
+                                           schema(std::move(key_fields)));
+  }
+
+  const char* kind_name() const override { return "DistinctNode"; }
+
+  const Ordering& ordering() const override {
+    return sequencing_queue_ ? inputs_[0]->ordering() : ExecNode::ordering();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(input, batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    if (sequencing_queue_) {
+      return sequencing_queue_->InsertBatch(std::move(batch));
+    }
+    if (partitioned()) {
+      QueryContext* ctx = plan_->query_context();
+      ARROW_ASSIGN_OR_RAISE(
+          std::vector<ExecBatch> partitions,
+          PartitionBatchByHash(batch, key_ids_, options_.num_spill_partitions, ctx,
+                               ctx->GetThreadIndex()));
+      for (size_t prtn = 0; prtn < partitions.size(); ++prtn) {
+        RETURN_NOT_OK(Consume(&partitions_[prtn], partitions[prtn]));
+      }
+    } else {
+      RETURN_NOT_OK(Consume(&partitions_[0], batch));
+    }
+
+    if (input_counter_.Increment()) {
+      return MaybeFinish(/*input_finished=*/true);
+    }
+    return Status::OK();
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (sequencing_queue_) {
+      // Every input batch is output, possibly empty, to keep the batch indices
+      if (input_counter_.SetTotal(total_batches)) {
+        ReleaseKeyBytes(bytes_in_memory_.load());
+      }
+      return output_->InputFinished(this, total_batches);
+    }
+    if (input_counter_.SetTotal(total_batches)) {
+      return MaybeFinish(/*input_finished=*/true);
+    }
+    return Status::OK();
+  }
+
+  Result<std::optional<util::SequencingQueue::Task>> Process(ExecBatch batch) override {
+    std::shared_ptr<Array> mask;
+    ARROW_ASSIGN_OR_RAISE(int64_t num_new, ConsumeInto(&partitions_[0], batch, &mask));
+    RETURN_NOT_OK(MaybeReduceMemory(&partitions_[0]));
+    return [this, batch = std::move(batch), mask = std::move(mask), num_new]() -> Status {
+      ExecBatch out = batch.Slice(0, 0);
+      if (num_new > 0) {
+        ARROW_ASSIGN_OR_RAISE(out, ApplyMask(batch, mask, num_new));
+      }
+      out.index = batch.index;
+      RETURN_NOT_OK(EmitBatch(std::move(out)));
+      if (input_counter_.Increment()) {
+        ReleaseKeyBytes(bytes_in_memory_.load());
+      }
+      return Status::OK();
+    };
+  }
+
+  void Schedule(util::SequencingQueue::Task task) override {
+    plan_->query_context()->ScheduleTask(std::move(task), "DistinctNode::EmitBatch");
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "keys=[";
+    for (size_t i = 0; i < key_ids_.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << '"' << key_schema_->field(static_cast<int>(i))->name() << '"';
+    }
+    ss << ']';
+    if (options_.approximate) ss << ", approximate";
+    return ss.str();
+  }
+
+ private:
+  bool spilling_enabled() const { return options_.spill_threshold_bytes >= 0; }
+
+  // Spilling works on hash partitions of the keys, forgetting them works on all keys
+  bool partitioned() const { return spilling_enabled() && !options_.approximate; }
+
+  // Finds the rows of `batch` whose keys `grouper` hasn't seen before.  Returns a
+  // mask selecting them, or null if they are all new, and adds them to `grouper`.
+  Result<std::shared_ptr<Array>> ConsumeKeys(Grouper* grouper, const ExecBatch& batch,
+                                             int64_t* num_new) {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch keys, batch.SelectValues(key_ids_));
+    uint32_t first_new_id = grouper->num_groups();
+    ARROW_ASSIGN_OR_RAISE(Datum ids, grouper->Consume(ExecSpan(keys)));
+    *num_new = grouper->num_groups() - first_new_id;
+    if (*num_new == batch.length) return nullptr;
+
+    // A row is the first one with its key if its id is new and wasn't seen before in
+    // this batch
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> bitmap,
+        AllocateEmptyBitmap(batch.length, plan_->query_context()->memory_pool()));
+    std::vector<bool> seen(static_cast<size_t>(*num_new), false);
+    const uint32_t* id_values = ids.array()->GetValues<uint32_t>(1);
+    for (int64_t i = 0; i < batch.length; ++i) {
+      if (id_values[i] >= first_new_id && !seen[id_values[i] - first_new_id]) {
+        seen[id_values[i] - first_new_id] = true;
+        bit_util::SetBit(bitmap->mutable_data(), i);
+      }
+    }
+    return std::make_shared<BooleanArray>(batch.length, std::move(bitmap));
+  }
+
+  Result<ExecBatch> ApplyMask(const ExecBatch& batch, const std::shared_ptr<Array>& mask,
+                              int64_t num_selected) {
+    if (mask == nullptr) return batch;
+    ExecContext* exec_context = plan_->query_context()->exec_context();
+    std::vector<Datum> values(batch.values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (batch.values[i].is_scalar()) {
+        values[i] = batch.values[i];
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(values[i], compute::Filter(batch.values[i], mask,
+                                                       FilterOptions::Defaults(),
+                                                       exec_context));
+    }
+    return ExecBatch(std::move(values), num_selected);
+  }
+
+  Status EmitBatch(ExecBatch batch) {
+    num_output_batches_.fetch_add(1);
+    return output_->InputReceived(this, std::move(batch));
+  }
+
+  // Adds the keys of `batch` to `partition` and returns the number of rows with new
+  // keys, which `mask` is set to select.  The rows of a spilled partition are spilled
+  // instead.
+  Result<int64_t> ConsumeInto(DistinctPartition* partition, const ExecBatch& batch,
+                              std::shared_ptr<Array>* mask) {
+    if (batch.length == 0) return 0;
+    std::lock_guard<std::mutex> guard(partition->mutex);
+    if (partition->rows_file) {
+      RETURN_NOT_OK(WriteSpill(partition->rows_file.get(), batch));
+      return 0;
+    }
+    if (!partition->grouper) {
+      ARROW_ASSIGN_OR_RAISE(
+          partition->grouper,
+          Grouper::Make(key_types(), plan_->query_context()->exec_context()));
+    }
+    int64_t num_new;
+    ARROW_ASSIGN_OR_RAISE(*mask, ConsumeKeys(partition->grouper.get(), batch, &num_new));
+    if (spilling_enabled() && num_new > 0) {
+      int64_t key_bytes = 0;
+      for (int key_id : key_ids_) {
+        if (!batch.values[key_id].is_array()) continue;
+        ARROW_ASSIGN_OR_RAISE(
+            int64_t column_bytes,
+            ::arrow::util::ReferencedBufferSize(*batch.values[key_id].array()));
+        key_bytes += column_bytes;
+      }
+      int64_t new_key_bytes = key_bytes * num_new / batch.length;
+      partition->key_bytes += new_key_bytes;
+      bytes_in_memory_.fetch_add(new_key_bytes);
+      if (MemoryBudget* memory_budget = plan_->query_context()->memory_budget()) {
+        memory_budget->Reserve(new_key_bytes);
+      }
+    }
+    return num_new;
+  }
+
+  // Forgets or spills keys once they use too much memory
+  Status MaybeReduceMemory(DistinctPartition* partition) {
+    if (!spilling_enabled()) return Status::OK();
+    if (bytes_in_memory_.load() <= options_.spill_threshold_bytes &&
+        !plan_->query_context()->memory_budget_exceeded()) {
+      return Status::OK();
+    }
+    return options_.approximate ? ForgetKeys(partition) : SpillLargestPartition();
+  }
+
+  Status Consume(DistinctPartition* partition, const ExecBatch& batch) {
+    std::shared_ptr<Array> mask;
+    ARROW_ASSIGN_OR_RAISE(int64_t num_new, ConsumeInto(partition, batch, &mask));
+    if (num_new > 0) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch out, ApplyMask(batch, mask, num_new));
+      RETURN_NOT_OK(EmitBatch(std::move(out)));
+    }
+    return MaybeReduceMemory(partition);
+  }
+
+  std::vector<TypeHolder> key_types() const {
+    std::vector<TypeHolder> types;
+    for (const auto& key_field : key_schema_->fields()) {
+      types.emplace_back(key_field->type().get());
+    }
+    return types;
+  }
+
+  void ReleaseKeyBytes(int64_t bytes) {
+    bytes_in_memory_.fetch_sub(bytes);
+    if (MemoryBudget* memory_budget = plan_->query_context()->memory_budget()) {
+      memory_budget->Release(bytes);
+    }
+  }
+
+  Status ForgetKeys(DistinctPartition* partition) {
+    int64_t freed;
+    {
+      std::lock_guard<std::mutex> guard(partition->mutex);
+      partition->grouper.reset();
+      freed = partition->key_bytes;
+      partition->key_bytes = 0;
+    }
+    ReleaseKeyBytes(freed);
+    return Status::OK();
+  }
+
+  Status SpillLargestPartition() {
+    // Only one partition is spilled at a time, which frees enough memory for the
+    // others to keep up with the spilling threads
+    std::unique_lock<std::mutex> spill_guard(spill_mutex_, std::try_to_lock);
+    if (!spill_guard.owns_lock()) return Status::OK();
+
+    DistinctPartition* largest = nullptr;
+    int64_t largest_bytes = 0;
+    for (DistinctPartition& partition : partitions_) {
+      std::lock_guard<std::mutex> guard(partition.mutex);
+      if (!partition.rows_file && partition.key_bytes > largest_bytes) {
+        largest = &partition;
+        largest_bytes = partition.key_bytes;
+      }
+    }
+    if (largest == nullptr) return Status::OK();
+
+    QueryContext* ctx = plan_->query_context();
+    if (!spill_directory_) {
+      spill_directory_ = std::make_unique<SpillDirectory>("arrow-acero-distinct-spill-");
+    }
+    ExecBatch seen_keys;
+    int64_t freed;
+    {
+      std::lock_guard<std::mutex> guard(largest->mutex);
+      ARROW_ASSIGN_OR_RAISE(largest->keys_file,
+                            spill_directory_->MakeFile(key_schema_, ctx->memory_pool()));
+      ARROW_ASSIGN_OR_RAISE(largest->rows_file, spill_directory_->MakeFile(
+                                                    output_schema_, ctx->memory_pool()));
+      ARROW_ASSIGN_OR_RAISE(seen_keys, largest->grouper->GetUniques());
+      largest->grouper.reset();
+      freed = largest->key_bytes;
+      largest->key_bytes = 0;
+      spilled_.store(true);
+    }
+    ReleaseKeyBytes(freed);
+    return WriteSpill(largest->keys_file.get(), std::move(seen_keys));
+  }
+
+  Status WriteSpill(SpillFile* file, ExecBatch batch) {
+    QueryContext* ctx = plan_->query_context();
+    auto io_mark = std::make_shared<QueryContext::TempFileIOMark>(
+        ctx, static_cast<size_t>(batch.TotalBufferSize()));
+    pending_writes_.fetch_add(1);
+    ctx->ScheduleIOTask(
+        [this, file, io_mark, batch = std::move(batch)]() -> Status {
+          RETURN_NOT_OK(file->Write(batch));
+          pending_writes_.fetch_sub(1);
+          return MaybeFinish(/*input_finished=*/false);
+        },
+        "DistinctNode::WriteSpill");
+    return Status::OK();
+  }
+
+  Status MaybeFinish(bool input_finished) {
+    {
+      std::lock_guard<std::mutex> guard(finish_mutex_);
+      input_finished_ |= input_finished;
+      if (!input_finished_ || finish_started_ || pending_writes_.load() > 0) {
+        return Status::OK();
+      }
+      finish_started_ = true;
+    }
+    if (!spilled_.load()) {
+      ReleaseKeyBytes(bytes_in_memory_.load());
+      return output_->InputFinished(this, num_output_batches_.load());
+    }
+    for (DistinctPartition& partition : partitions_) {
+      if (!partition.rows_file) continue;
+      RETURN_NOT_OK(partition.keys_file->FinishWriting());
+      RETURN_NOT_OK(partition.rows_file->FinishWriting());
+    }
+    // Reading the spilled rows back is blocking so it is done from an IO task
+    plan_->query_context()->ScheduleIOTask([this]() { return OutputSpilledPartitions(); },
+                                           "DistinctNode::OutputSpilledPartitions");
+    return Status::OK();
+  }
+
+  // Deduplicates the spilled rows of each partition against the keys the partition
+  // had already output before spilling
+  Status OutputSpilledPartitions() {
+    ReleaseKeyBytes(bytes_in_memory_.load());
+    for (DistinctPartition& partition : partitions_) {
+      if (!partition.rows_file) continue;
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<Grouper> grouper,
+          Grouper::Make(key_types(), plan_->query_context()->exec_context()));
+      for (int i = 0; i < partition.keys_file->num_batches(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(ExecBatch keys, partition.keys_file->ReadBatch(i));
+        RETURN_NOT_OK(grouper->Consume(ExecSpan(keys)).status());
+      }
+      for (int i = 0; i < partition.rows_file->num_batches(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(ExecBatch batch, partition.rows_file->ReadBatch(i));
+        int64_t num_new;
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> mask,
+                              ConsumeKeys(grouper.get(), batch, &num_new));
+        if (num_new == 0) continue;
+        ARROW_ASSIGN_OR_RAISE(ExecBatch out, ApplyMask(batch, mask, num_new));
+        RETURN_NOT_OK(EmitBatch(std::move(out)));
+      }
+      partition.keys_file.reset();
+      partition.rows_file.reset();
+    }
+    return output_->InputFinished(this, num_output_batches_.load());
+  }
+
+  const DistinctNodeOptions options_;
+  const std::vector<int> key_ids_;
+  const std::shared_ptr<Schema> key_schema_;
+  std::vector<DistinctPartition> partitions_;
+
+  AtomicCounter input_counter_;
+  std::atomic<int> num_output_batches_{0};
+  // The estimated memory used by the keys of all partitions
+  std::atomic<int64_t> bytes_in_memory_{0};
+
+  std::mutex spill_mutex_;
+  std::unique_ptr<SpillDirectory> spill_directory_;
+  std::atomic<bool> spilled_{false};
+  std::atomic<int> pending_writes_{0};
+
+  std::mutex finish_mutex_;
+  bool input_finished_ = false;
+  bool finish_started_ = false;
+
+  std::unique_ptr<util::SequencingQueue> sequencing_queue_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterDistinctNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(
+      registry->AddFactory(std::string(DistinctNodeOptions::kName), DistinctNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace acero {
+
+static constexpr int kRowsPerBatch = 64;
+static constexpr int kNumBatches = 16;
+static constexpr int kNumDistinct = 100;
+
+// A table whose rows repeat every kNumDistinct rows, with an "id" column which is
+// unique for every row
+std::shared_ptr<Table> TestTable() {
+  Int32Builder key_builder, value_builder, id_builder;
+  for (int i = 0; i < kRowsPerBatch * kNumBatches; ++i) {
+    int key = (i * 37) % kNumDistinct;
+    ARROW_EXPECT_OK(key_builder.Append(key));
+    if (key % 10 == 0) {
+      ARROW_EXPECT_OK(value_builder.AppendNull());
+    } else {
+      ARROW_EXPECT_OK(value_builder.Append(key * 2));
+    }
+    ARROW_EXPECT_OK(id_builder.Append(i));
+  }
+  auto table = Table::Make(
+      schema({field("key", int32()), field("value", int32()), field("id", int32())}),
+      {key_builder.Finish().ValueOrDie(), value_builder.Finish().ValueOrDie(),
+       id_builder.Finish().ValueOrDie()});
+  TableBatchReader reader(*table);
+  reader.set_chunksize(kRowsPerBatch);
+  return Table::FromRecordBatchReader(&reader).ValueOrDie();
+}
+
+// The distinct rows of the "key" and "value" columns of TestTable, applying each of
+// `stages` in turn
+std::shared_ptr<Table> DistinctRows(std::vector<DistinctNodeOptions> stages,
+                                    bool use_threads) {
+  std::vector<Declaration> plan = {
+      {"table_source", TableSourceNodeOptions(TestTable())},
+      {"project", ProjectNodeOptions(
+                      {compute::field_ref("key"), compute::field_ref("value")},
+                      {"key", "value"})}};
+  for (DistinctNodeOptions& options : stages) {
+    plan.push_back({"distinct", std::move(options)});
+  }
+  plan.push_back({"order_by", OrderByNodeOptions(Ordering({compute::SortKey("key")}))});
+  Declaration declaration = Declaration::Sequence(std::move(plan));
+  auto table = DeclarationToTable(std::move(declaration), use_threads).ValueOrDie();
+  return table->CombineChunks().ValueOrDie();
+}
+
+std::shared_ptr<Table> ExpectedDistinctRows() {
+  Int32Builder key_builder, value_builder;
+  for (int key = 0; key < kNumDistinct; ++key) {
+    ARROW_EXPECT_OK(key_builder.Append(key));
+    if (key % 10 == 0) {
+      ARROW_EXPECT_OK(value_builder.AppendNull());
+    } else {
+      ARROW_EXPECT_OK(value_builder.Append(key * 2));
+    }
+  }
+  return Table::Make(schema({field("key", int32()), field("value", int32())}),
+                     {key_builder.Finish().ValueOrDie(),
+                      value_builder.Finish().ValueOrDie()});
+}
+
+TEST(DistinctNode, AllColumns) {
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    AssertTablesEqual(*ExpectedDistinctRows(),
+                      *DistinctRows({DistinctNodeOptions()}, use_threads));
+  }
+}
+
+TEST(DistinctNode, KeepsFirstRow) {
+  // With a serial plan the first row received with each key is kept
+  std::shared_ptr<Table> input = TestTable();
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input)},
+       {"distinct", DistinctNodeOptions({"key"})},
+       {"order_by", OrderByNodeOptions(Ordering({compute::SortKey("id")}))}});
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(std::move(plan), /*use_threads=*/false));
+  AssertTablesEqual(*input->Slice(0, kNumDistinct), *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(DistinctNode, Spill) {
+  for (int64_t threshold : {int64_t(0), int64_t(256)}) {
+    SCOPED_TRACE("spill_threshold_bytes=" + std::to_string(threshold));
+    for (bool use_threads : {false, true}) {
+      SCOPED_TRACE(use_threads ? "parallel" : "serial");
+      DistinctNodeOptions options;
+      options.spill_threshold_bytes = threshold;
+      options.num_spill_partitions = 4;
+      AssertTablesEqual(*ExpectedDistinctRows(),
+                        *DistinctRows({std::move(options)}, use_threads));
+    }
+  }
+}
+
+TEST(DistinctNode, Approximate) {
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    DistinctNodeOptions options;
+    options.spill_threshold_bytes = 768;
+    options.approximate = true;
+    // Forgetting the keys every few batches lets some duplicates through
+    std::shared_ptr<Table> actual = DistinctRows({options}, use_threads);
+    ASSERT_GT(actual->num_rows(), kNumDistinct);
+    ASSERT_LT(actual->num_rows(), kRowsPerBatch * kNumBatches);
+    // but no distinct row is lost
+    AssertTablesEqual(*ExpectedDistinctRows(),
+                      *DistinctRows({options, DistinctNodeOptions()}, use_threads));
+  }
+}
+
+TEST(DistinctNode, Fetch) {
+  Declaration plan =
+      Declaration::Sequence({{"table_source", TableSourceNodeOptions(TestTable())},
+                             {"distinct", DistinctNodeOptions({"key"})},
+                             {"fetch", FetchNodeOptions(0, 10)}});
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(std::move(plan), /*use_threads=*/false));
+  ASSERT_EQ(10, actual->num_rows());
+}
+
+TEST(DistinctNode, Invalid) {
+  Declaration source{"table_source", TableSourceNodeOptions(TestTable())};
+  DistinctNodeOptions approximate;
+  approximate.approximate = true;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("requires spill_threshold_bytes"),
+      DeclarationToStatus(Declaration::Sequence({source, {"distinct", approximate}})));
+  DistinctNodeOptions missing_key({"missing"});
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("No match for FieldRef"),
+      DeclarationToStatus(Declaration::Sequence({source, {"distinct", missing_key}})));
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,429 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/acero/exchange_node.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/spilling_util.h"
+#include "arrow/acero/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace acero {
+namespace {
+
+class LocalExchangeImpl;
+
+class LocalExchangeSender : public ExchangeSender {
+ public:
+  LocalExchangeSender(LocalExchangeImpl* exchange, bool announced)
+      : exchange_(exchange), announced_(announced) {}
+
+  int num_partitions() const override;
+  Status Init(const std::shared_ptr<Schema>& schema,
+              BackpressureControl* backpressure_control) override;
+  Status Send(int partition, const ExecBatch& batch) override;
+  Future<> Finish() override;
+  void Abort(const Status& status) override;
+
+ private:
+  friend class LocalExchangeImpl;
+
+  LocalExchangeImpl* exchange_;
+  // False for the senders beyond the announced number of senders
+  const bool announced_;
+  // Only accessed with the exchange's mutex held, reset once the sender is done so that
+  // its plan is never paused or resumed after it ended
+  BackpressureControl* backpressure_control_ = nullptr;
+  bool done_ = false;
+};
+
+class LocalExchangeReceiver : public ExchangeReceiver {
+ public:
+  LocalExchangeReceiver(LocalExchangeImpl* exchange, int partition)
+      : exchange_(exchange), partition_(partition) {}
+
+  const std::shared_ptr<Schema>& schema() const override;
+  Future<std::optional<ExecBatch>> Receive() override;
+
+ private:
+  LocalExchangeImpl* exchange_;
+  int partition_;
+};
+
+class LocalExchangeImpl : public LocalExchange,
+                          public std::enable_shared_from_this<LocalExchangeImpl> {
+ public:
+  LocalExchangeImpl(std::shared_ptr<Schema> schema, int num_partitions, int num_senders,
+                    int max_queued_batches)
+      : schema_(std::move(schema)),
+        max_queued_batches_(max_queued_batches),
+        partitions_(num_partitions) {
+    for (int i = 0; i < num_senders; ++i) {
+      senders_.push_back(std::make_unique<LocalExchangeSender>(this, /*announced=*/true));
+    }
+    for (int i = 0; i < num_partitions; ++i) {
+      receivers_.push_back(std::make_unique<LocalExchangeReceiver>(this, i));
+    }
+  }
+
+  // The senders and receivers share ownership of the exchange
+  std::shared_ptr<ExchangeSender> sender() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (next_sender_ == senders_.size()) {
+      // The exchange fails once a sender beyond the announced ones is initialized
+      unannounced_senders_.push_back(
+          std::make_unique<LocalExchangeSender>(this, /*announced=*/false));
+      return std::shared_ptr<ExchangeSender>(shared_from_this(),
+                                             unannounced_senders_.back().get());
+    }
+    return std::shared_ptr<ExchangeSender>(shared_from_this(),
+                                           senders_[next_sender_++].get());
+  }
+
+  std::shared_ptr<ExchangeReceiver> receiver(int partition) override {
+    DCHECK_GE(partition, 0);
+    DCHECK_LT(partition, static_cast<int>(receivers_.size()));
+    return std::shared_ptr<ExchangeReceiver>(shared_from_this(),
+                                             receivers_[partition].get());
+  }
+
+  int num_partitions() const { return static_cast<int>(partitions_.size()); }
+
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+  Status Init(LocalExchangeSender* sender, const std::shared_ptr<Schema>& schema,
+              BackpressureControl* backpressure_control) {
+    if (!schema->Equals(*schema_)) {
+      return Status::Invalid("An exchange of batches with schema ", schema_->ToString(),
+                             " cannot send batches with schema ", schema->ToString());
+    }
+    if (!sender->announced_) {
+      return Status::Invalid("The exchange was made for only ", senders_.size(),
+                             " senders");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    sender->backpressure_control_ = backpressure_control;
+    if (paused_) backpressure_control->Pause();
+    return status_;
+  }
+
+  Status Send(int partition, const ExecBatch& batch) {
+    if (partition < 0 || partition >= num_partitions()) {
+      return Status::Invalid("Cannot send to partition ", partition,
+                             " of an exchange with ", num_partitions(), " partitions");
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(status_);
+    Partition& state = partitions_[partition];
+    if (state.waiting.is_valid()) {
+      Future<std::optional<ExecBatch>> waiting = std::move(state.waiting);
+      state.waiting = {};
+      lock.unlock();
+      waiting.MarkFinished(batch);
+      return Status::OK();
+    }
+    state.batches.push_back(batch);
+    if (!paused_ && static_cast<int>(state.batches.size()) > max_queued_batches_) {
+      paused_ = true;
+      ForEachActiveSender([](BackpressureControl* control) { control->Pause(); });
+    }
+    return Status::OK();
+  }
+
+  void Finish(LocalExchangeSender* sender) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (sender->done_ || !sender->announced_) return;
+    sender->done_ = true;
+    sender->backpressure_control_ = nullptr;
+    if (++num_senders_finished_ < senders_.size()) return;
+    std::vector<Future<std::optional<ExecBatch>>> waiting = TakeWaiting();
+    lock.unlock();
+    for (auto& future : waiting) {
+      future.MarkFinished(std::optional<ExecBatch>());
+    }
+  }
+
+  void Abort(LocalExchangeSender* sender, const Status& status) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    sender->done_ = true;
+    sender->backpressure_control_ = nullptr;
+    if (!status_.ok()) return;
+    status_ = status;
+    // Paused senders have to resume to notice the failure
+    if (paused_) {
+      paused_ = false;
+      ForEachActiveSender([](BackpressureControl* control) { control->Resume(); });
+    }
+    std::vector<Future<std::optional<ExecBatch>>> waiting = TakeWaiting();
+    lock.unlock();
+    for (auto& future : waiting) {
+      future.MarkFinished(status);
+    }
+  }
+
+  Future<std::optional<ExecBatch>> Receive(int partition) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!status_.ok()) return status_;
+    Partition& state = partitions_[partition];
+    if (!state.batches.empty()) {
+      ExecBatch batch = std::move(state.batches.front());
+      state.batches.pop_front();
+      MaybeResume();
+      return std::optional<ExecBatch>(std::move(batch));
+    }
+    if (num_senders_finished_ == senders_.size()) {
+      return std::optional<ExecBatch>();
+    }
+    if (state.waiting.is_valid()) {
+      return Status::Invalid("Partition ", partition,
+                             " of an exchange was received from concurrently");
+    }
+    state.waiting = Future<std::optional<ExecBatch>>::Make();
+    return state.waiting;
+  }
+
+ private:
+  struct Partition {
+    std::deque<ExecBatch> batches;
+    // Set while the receiver waits for a batch
+    Future<std::optional<ExecBatch>> waiting;
+  };
+
+  template <typename Fn>
+  void ForEachActiveSender(Fn&& fn) {
+    for (const auto& sender : senders_) {
+      if (sender->backpressure_control_ != nullptr) {
+        fn(sender->backpressure_control_);
+      }
+    }
+  }
+
+  // Resume the senders once every partition has drained to half of its queue limit
+  void MaybeResume() {
+    if (!paused_) return;
+    for (const Partition& state : partitions_) {
+      if (static_cast<int>(state.batches.size()) > max_queued_batches_ / 2) return;
+    }
+    paused_ = false;
+    ForEachActiveSender([](BackpressureControl* control) { control->Resume(); });
+  }
+
+  std::vector<Future<std::optional<ExecBatch>>> TakeWaiting() {
+    std::vector<Future<std::optional<ExecBatch>>> waiting;
+    for (Partition& state : partitions_) {
+      if (state.waiting.is_valid()) {
+        waiting.push_back(std::move(state.waiting));
+        state.waiting = {};
+      }
+    }
+    return waiting;
+  }
+
+  const std::shared_ptr<Schema> schema_;
+  const int max_queued_batches_;
+
+  std::mutex mutex_;
+  std::vector<Partition> partitions_;
+  std::vector<std::unique_ptr<LocalExchangeSender>> senders_;
+  std::vector<std::unique_ptr<LocalExchangeSender>> unannounced_senders_;
+  std::vector<std::unique_ptr<LocalExchangeReceiver>> receivers_;
+  size_t next_sender_ = 0;
+  size_t num_senders_finished_ = 0;
+  bool paused_ = false;
+  Status status_;
+};
+
+int LocalExchangeSender::num_partitions() const { return exchange_->num_partitions(); }
+
+Status LocalExchangeSender::Init(const std::shared_ptr<Schema>& schema,
+                                 BackpressureControl* backpressure_control) {
+  return exchange_->Init(this, schema, backpressure_control);
+}
+
+Status LocalExchangeSender::Send(int partition, const ExecBatch& batch) {
+  return exchange_->Send(partition, batch);
+}
+
+Future<> LocalExchangeSender::Finish() {
+  exchange_->Finish(this);
+  return Future<>::MakeFinished();
+}
+
+void LocalExchangeSender::Abort(const Status& status) { exchange_->Abort(this, status); }
+
+const std::shared_ptr<Schema>& LocalExchangeReceiver::schema() const {
+  return exchange_->schema();
+}
+
+Future<std::optional<ExecBatch>> LocalExchangeReceiver::Receive() {
+  return exchange_->Receive(partition_);
+}
+
+// Sends the input of an exchange_sink node, built on the consuming sink node
+class ExchangeSinkConsumer : public SinkNodeConsumer {
+ public:
+  ExchangeSinkConsumer(std::shared_ptr<ExchangeSender> sender,
+                       ExchangeSinkNodeOptions::Distribution distribution,
+                       std::vector<int> key_ids)
+      : sender_(std::move(sender)),
+        distribution_(distribution),
+        key_ids_(std::move(key_ids)),
+        num_partitions_(sender_->num_partitions()) {}
+
+  Status Init(const std::shared_ptr<Schema>& schema,
+              BackpressureControl* backpressure_control, ExecPlan* plan) override {
+    ctx_ = plan->query_context();
+    // Finish is not called if the plan fails or is stopped early, the receivers must
+    // not wait for batches which will never be sent
+    plan->finished().AddCallback(
+        [sender = sender_, finished = finished_](const Status& status) {
+          if (finished->load()) return;
+          sender->Abort(status.ok() ? Status::Cancelled("The exchange_sink node's plan "
+                                                        "was stopped before it finished")
+                                    : status);
+        });
+    return sender_->Init(schema, backpressure_control);
+  }
+
+  Status Consume(ExecBatch batch) override {
+    if (distribution_ == ExchangeSinkNodeOptions::BROADCAST) {
+      for (int partition = 0; partition < num_partitions_; ++partition) {
+        RETURN_NOT_OK(sender_->Send(partition, batch));
+      }
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> partitions,
+                          PartitionBatchByHash(batch, key_ids_, num_partitions_, ctx_,
+                                               ctx_->GetThreadIndex()));
+    for (int partition = 0; partition < num_partitions_; ++partition) {
+      if (partitions[partition].length == 0) continue;
+      RETURN_NOT_OK(sender_->Send(partition, partitions[partition]));
+    }
+    return Status::OK();
+  }
+
+  Future<> Finish() override {
+    finished_->store(true);
+    return sender_->Finish();
+  }
+
+ private:
+  std::shared_ptr<ExchangeSender> sender_;
+  ExchangeSinkNodeOptions::Distribution distribution_;
+  std::vector<int> key_ids_;
+  int num_partitions_;
+  QueryContext* ctx_ = nullptr;
+  std::shared_ptr<std::atomic<bool>> finished_ = std::make_shared<std::atomic<bool>>();
+};
+
+Result<ExecNode*> MakeExchangeSinkNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                       const ExecNodeOptions& options) {
+  RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "ExchangeSinkNode"));
+  const auto& sink_options = checked_cast<const ExchangeSinkNodeOptions&>(options);
+  if (!sink_options.sender) {
+    return Status::Invalid("An ExchangeSender is required");
+  }
+  if (sink_options.sender->num_partitions() < 1) {
+    return Status::Invalid("An exchange must have at least one partition");
+  }
+  std::vector<int> key_ids;
+  if (sink_options.distribution == ExchangeSinkNodeOptions::HASH) {
+    if (sink_options.keys.empty()) {
+      return Status::Invalid("Hash partitioning an exchange requires at least one key");
+    }
+    const Schema& input_schema = *inputs[0]->output_schema();
+    for (const FieldRef& key : sink_options.keys) {
+      ARROW_ASSIGN_OR_RAISE(FieldPath path, key.FindOne(input_schema));
+      if (path.indices().size() != 1) {
+        return Status::NotImplemented("Partitioning an exchange by the nested key ",
+                                      key.ToString());
+      }
+      if (input_schema.field(path[0])->type()->id() == Type::DICTIONARY) {
+        return Status::NotImplemented("Partitioning an exchange by the dictionary key ",
+                                      key.ToString());
+      }
+      key_ids.push_back(path[0]);
+    }
+  }
+  auto consumer = std::make_shared<ExchangeSinkConsumer>(
+      sink_options.sender, sink_options.distribution, std::move(key_ids));
+  return MakeExecNode("consuming_sink", plan, std::move(inputs),
+                      ConsumingSinkNodeOptions{std::move(consumer)});
+}
+
+Result<ExecNode*> MakeExchangeSourceNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                         const ExecNodeOptions& options) {
+  RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 0, "ExchangeSourceNode"));
+  const auto& source_options = checked_cast<const ExchangeSourceNodeOptions&>(options);
+  if (!source_options.receiver) {
+    return Status::Invalid("An ExchangeReceiver is required");
+  }
+  std::shared_ptr<ExchangeReceiver> receiver = source_options.receiver;
+  return MakeExecNode("source", plan, std::move(inputs),
+                      SourceNodeOptions(receiver->schema(),
+                                        [receiver] { return receiver->Receive(); }));
+}
+
+}  // namespace
+
+Result<std::shared_ptr<LocalExchange>> LocalExchange::Make(std::shared_ptr<Schema> schema,
+                                                           int num_partitions,
+                                                           int num_senders,
+                                                           int max_queued_batches) {
+  if (num_partitions < 1) {
+    return Status::Invalid("An exchange must have at least one partition");
+  }
+  if (num_senders < 1) {
+    return Status::Invalid("An exchange must have at least one sender");
+  }
+  if (max_queued_batches < 1) {
+    return Status::Invalid("max_queued_batches must be positive");
+  }
+  return std::make_shared<LocalExchangeImpl>(std::move(schema), num_partitions,
+                                             num_senders, max_queued_batches);
+}
+
+namespace internal {
+
+void RegisterExchangeNodes(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(ExchangeSinkNodeOptions::kName),
+                                 MakeExchangeSinkNode));
+  DCHECK_OK(registry->AddFactory(std::string(ExchangeSourceNodeOptions::kName),
+                                 MakeExchangeSourceNode));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <memory>
+
+#include "arrow/acero/options.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \brief An exchange between plans running in the same process
+///
+/// The exchange_sink nodes of up to `num_senders` plans share sender() and each
+/// partition is read by the exchange_source node of another plan through
+/// receiver(partition).  Batches are queued in memory until they are received, and
+/// the senders are paused while any partition has more than `max_queued_batches`
+/// batches queued, so the sending and receiving plans have to run concurrently.
+class ARROW_ACERO_EXPORT LocalExchange {
+ public:
+  virtual ~LocalExchange() = default;
+
+  static Result<std::shared_ptr<LocalExchange>> Make(std::shared_ptr<Schema> schema,
+                                                     int num_partitions,
+                                                     int num_senders = 1,
+                                                     int max_queued_batches = 32);
+
+  /// \brief The sender shared by the exchange_sink nodes
+  virtual std::shared_ptr<ExchangeSender> sender() = 0;
+
+  /// \brief The receiver of one partition
+  virtual std::shared_ptr<ExchangeReceiver> receiver(int partition) = 0;
+};
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include <set>
+
+#include "arrow/acero/exchange_node.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/table.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace acero {
+
+static constexpr int kRowsPerBatch = 50;
+static constexpr int kNumBatches = 20;
+
+std::shared_ptr<Table> TestTable(int seed = 0) {
+  Int32Builder key_builder, value_builder;
+  for (int i = 0; i < kRowsPerBatch * kNumBatches; ++i) {
+    ARROW_EXPECT_OK(key_builder.Append((i * 7 + seed) % 31));
+    ARROW_EXPECT_OK(value_builder.Append(i + seed));
+  }
+  auto table = Table::Make(schema({field("key", int32()), field("value", int32())}),
+                           {key_builder.Finish().ValueOrDie(),
+                            value_builder.Finish().ValueOrDie()});
+  TableBatchReader reader(*table);
+  reader.set_chunksize(kRowsPerBatch);
+  return Table::FromRecordBatchReader(&reader).ValueOrDie();
+}
+
+std::shared_ptr<Table> SortedByValue(const std::shared_ptr<Table>& table) {
+  auto indices =
+      compute::SortIndices(table, compute::SortOptions({compute::SortKey("value")}))
+          .ValueOrDie();
+  auto sorted = compute::Take(table, indices).ValueOrDie().table();
+  return sorted->CombineChunks().ValueOrDie();
+}
+
+// Run one sending plan per table into the exchange while reading all partitions
+std::vector<std::shared_ptr<Table>> RunExchange(
+    const std::vector<std::shared_ptr<Table>>& inputs, LocalExchange* exchange,
+    int num_partitions, const std::vector<FieldRef>& keys, bool use_threads) {
+  std::vector<Future<std::shared_ptr<Table>>> received;
+  for (int partition = 0; partition < num_partitions; ++partition) {
+    received.push_back(DeclarationToTableAsync(
+        {"exchange_source", ExchangeSourceNodeOptions(exchange->receiver(partition))},
+        use_threads));
+  }
+  std::vector<Future<>> sent;
+  for (const auto& input : inputs) {
+    ExchangeSinkNodeOptions sink_options =
+        keys.empty() ? ExchangeSinkNodeOptions::Broadcast(exchange->sender())
+                     : ExchangeSinkNodeOptions(exchange->sender(), keys);
+    sent.push_back(DeclarationToStatusAsync(
+        Declaration::Sequence({{"table_source", TableSourceNodeOptions(input)},
+                               {"exchange_sink", std::move(sink_options)}}),
+        use_threads));
+  }
+  for (auto& future : sent) {
+    ARROW_EXPECT_OK(future.status());
+  }
+  std::vector<std::shared_ptr<Table>> outputs;
+  for (auto& future : received) {
+    outputs.push_back(future.result().ValueOrDie());
+  }
+  return outputs;
+}
+
+TEST(ExchangeNode, HashPartition) {
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    std::vector<std::shared_ptr<Table>> inputs = {TestTable(0), TestTable(1000)};
+    ASSERT_OK_AND_ASSIGN(auto exchange,
+                         LocalExchange::Make(inputs[0]->schema(), /*num_partitions=*/3,
+                                             /*num_senders=*/2));
+    std::vector<std::shared_ptr<Table>> outputs =
+        RunExchange(inputs, exchange.get(), 3, {"key"}, use_threads);
+
+    // All rows with the same key end up in the same partition
+    std::set<int32_t> seen_keys;
+    for (const auto& output : outputs) {
+      ASSERT_GT(output->num_rows(), 0);
+      std::set<int32_t> keys;
+      for (const auto& chunk : output->GetColumnByName("key")->chunks()) {
+        const auto& key_array = checked_cast<const Int32Array&>(*chunk);
+        for (int64_t i = 0; i < key_array.length(); ++i) {
+          keys.insert(key_array.Value(i));
+        }
+      }
+      for (int32_t key : keys) {
+        ASSERT_TRUE(seen_keys.insert(key).second) << "key " << key;
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto expected, ConcatenateTables(inputs));
+    ASSERT_OK_AND_ASSIGN(auto actual, ConcatenateTables(outputs));
+    AssertTablesEqual(*SortedByValue(expected), *SortedByValue(actual));
+  }
+}
+
+TEST(ExchangeNode, Broadcast) {
+  std::shared_ptr<Table> input = TestTable();
+  ASSERT_OK_AND_ASSIGN(auto exchange,
+                       LocalExchange::Make(input->schema(), /*num_partitions=*/2));
+  for (const auto& output :
+       RunExchange({input}, exchange.get(), 2, /*keys=*/{}, /*use_threads=*/true)) {
+    AssertTablesEqual(*SortedByValue(input), *SortedByValue(output));
+  }
+}
+
+TEST(ExchangeNode, Backpressure) {
+  // The sender is paused while the receivers fall behind
+  std::shared_ptr<Table> input = TestTable();
+  ASSERT_OK_AND_ASSIGN(auto exchange,
+                       LocalExchange::Make(input->schema(), /*num_partitions=*/2,
+                                           /*num_senders=*/1, /*max_queued_batches=*/1));
+  std::vector<std::shared_ptr<Table>> outputs =
+      RunExchange({input}, exchange.get(), 2, {"key"}, /*use_threads=*/true);
+  ASSERT_EQ(input->num_rows(), outputs[0]->num_rows() + outputs[1]->num_rows());
+}
+
+TEST(ExchangeNode, SenderFails) {
+  // The receivers fail if the sending plan fails
+  std::shared_ptr<Table> input = TestTable();
+  ASSERT_OK_AND_ASSIGN(auto exchange,
+                       LocalExchange::Make(schema({field("other", utf8())}), 1));
+  Future<std::shared_ptr<Table>> received = DeclarationToTableAsync(
+      {"exchange_source", ExchangeSourceNodeOptions(exchange->receiver(0))});
+  ASSERT_RAISES(Invalid, DeclarationToStatus(Declaration::Sequence(
+                             {{"table_source", TableSourceNodeOptions(input)},
+                              {"exchange_sink",
+                               ExchangeSinkNodeOptions(exchange->sender(), {"key"})}})));
+  ASSERT_RAISES(Invalid, received.result());
+}
+
+TEST(ExchangeNode, Invalid) {
+  Declaration source{"table_source", TableSourceNodeOptions(TestTable())};
+  ASSERT_OK_AND_ASSIGN(auto exchange, LocalExchange::Make(TestTable()->schema(), 2));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("requires at least one key"),
+      DeclarationToStatus(Declaration::Sequence(
+          {source, {"exchange_sink", ExchangeSinkNodeOptions(exchange->sender(), {})}})));
+  ExchangeSinkNodeOptions missing_key(exchange->sender(), {"missing"});
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("No match for FieldRef"),
+      DeclarationToStatus(
+          Declaration::Sequence({source, {"exchange_sink", missing_key}})));
+  ASSERT_RAISES(Invalid, LocalExchange::Make(TestTable()->schema(), 0));
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -18,6 +18,8 @@
 #include "arrow/acero/exec_plan.h"
 
 #include <atomic>
+#include <chrono>
+#include <iomanip>
 #include <optional>
 #include <sstream>
 #include <unordered_map>
@@ -35,6 +37,7 @@
 #include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
@@ -318,17 +321,44 @@ struct ExecPlanImpl : public ExecPlan {
     return std::make_pair(result.sorted, result.indents);
   }
 
-  std::string ToString() const {
+  std::string ToString(bool with_stats = false) const {
     std::stringstream ss;
-    ss << "ExecPlan with " << nodes_.size() << " nodes:" << std::endl;
+    ss << "ExecPlan with " << nodes_.size() << " nodes";
+    if (with_stats) {
+      ss << " (peak memory: " << query_context_.memory_pool()->max_memory() << " bytes)";
+    }
+    ss << ":" << std::endl;
     auto sorted = OrderedNodes();
     for (size_t i = sorted.first.size(); i > 0; --i) {
+      const ExecNode* node = sorted.first[i - 1];
       for (int j = 0; j < sorted.second[i - 1]; ++j) ss << "  ";
-      ss << sorted.first[i - 1]->ToString(sorted.second[i - 1]) << std::endl;
+      ss << node->ToString(sorted.second[i - 1]);
+      if (with_stats) {
+        ss << " " << NodeStats(node).ToString();
+      }
+      ss << std::endl;
     }
     return ss.str();
   }
 
+  static ExecNodeStats NodeStats(const ExecNode* node) {
+    ExecNodeStats stats;
+    stats.label = node->label();
+    stats.kind_name = node->kind_name();
+    node->metrics().FillStats(&stats);
+    return stats;
+  }
+
+  ExecPlanStats GetStats() const {
+    ExecPlanStats stats;
+    stats.nodes.reserve(nodes_.size());
+    for (const auto& node : nodes_) {
+      stats.nodes.push_back(NodeStats(node.get()));
+    }
+    stats.peak_memory_bytes = query_context_.memory_pool()->max_memory();
+    return stats;
+  }
+
   Status error_st_;
   Future<> finished_ = Future<>::Make();
   bool started_ = false;
@@ -450,6 +480,89 @@ std::shared_ptr<const KeyValueMetadata> ExecPlan::metadata() const {
 
 std::string ExecPlan::ToString() const { return ToDerived(this)->ToString(); }
 
+ExecPlanStats ExecPlan::GetStats() const { return ToDerived(this)->GetStats(); }
+
+std::string ExecPlan::ToStringWithStats() const {
+  return ToDerived(this)->ToString(/*with_stats=*/true);
+}
+
+namespace {
+
+int64_t SteadyClockNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// The bytes referenced by the batch, which for a slice is less than the total size of
+// its buffers
+int64_t ReferencedBatchSize(const ExecBatch& batch) {
+  int64_t sum = 0;
+  for (const auto& value : batch.values) {
+    if (!value.is_array()) continue;
+    auto maybe_size = ::arrow::util::ReferencedBufferSize(*value.array());
+    sum += maybe_size.ok() ? *maybe_size : value.TotalBufferSize();
+  }
+  return sum;
+}
+
+}  // namespace
+
+std::string ExecNodeStats::ToString() const {
+  std::stringstream ss;
+  ss << "[in: " << input_batches << " batches, " << input_rows << " rows, "
+     << input_bytes << " bytes; out: " << output_batches << " batches, " << output_rows
+     << " rows, " << output_bytes << " bytes; " << std::fixed << std::setprecision(3)
+     << "processing: " << processing_time_nanos / 1e6
+     << "ms; paused: " << paused_time_nanos / 1e6 << "ms]";
+  return ss.str();
+}
+
+void ExecNodeMetrics::RecordInput(const ExecBatch& batch) {
+  input_batches_.fetch_add(1, std::memory_order_relaxed);
+  input_rows_.fetch_add(batch.length, std::memory_order_relaxed);
+  input_bytes_.fetch_add(ReferencedBatchSize(batch), std::memory_order_relaxed);
+}
+
+void ExecNodeMetrics::RecordOutput(const ExecBatch& batch) {
+  output_batches_.fetch_add(1, std::memory_order_relaxed);
+  output_rows_.fetch_add(batch.length, std::memory_order_relaxed);
+  output_bytes_.fetch_add(ReferencedBatchSize(batch), std::memory_order_relaxed);
+}
+
+void ExecNodeMetrics::AddProcessingTime(int64_t nanos) {
+  processing_time_nanos_.fetch_add(nanos, std::memory_order_relaxed);
+}
+
+void ExecNodeMetrics::NotePaused() {
+  int64_t not_paused = -1;
+  paused_since_nanos_.compare_exchange_strong(not_paused, SteadyClockNanos());
+}
+
+void ExecNodeMetrics::NoteResumed() {
+  int64_t paused_since = paused_since_nanos_.exchange(-1);
+  if (paused_since >= 0) {
+    paused_time_nanos_.fetch_add(SteadyClockNanos() - paused_since,
+                                 std::memory_order_relaxed);
+  }
+}
+
+void ExecNodeMetrics::FillStats(ExecNodeStats* stats) const {
+  stats->input_batches = input_batches_.load(std::memory_order_relaxed);
+  stats->input_rows = input_rows_.load(std::memory_order_relaxed);
+  stats->input_bytes = input_bytes_.load(std::memory_order_relaxed);
+  stats->output_batches = output_batches_.load(std::memory_order_relaxed);
+  stats->output_rows = output_rows_.load(std::memory_order_relaxed);
+  stats->output_bytes = output_bytes_.load(std::memory_order_relaxed);
+  stats->processing_time_nanos = processing_time_nanos_.load(std::memory_order_relaxed);
+  stats->paused_time_nanos = paused_time_nanos_.load(std::memory_order_relaxed);
+  // Include the pause in progress, if any
+  int64_t paused_since = paused_since_nanos_.load();
+  if (paused_since >= 0) {
+    stats->paused_time_nanos += SteadyClockNanos() - paused_since;
+  }
+}
+
 ExecNode::ExecNode(ExecPlan* plan, NodeVector inputs,
                    std::vector<std::string> input_labels,
                    std::shared_ptr<Schema> output_schema)
@@ -473,6 +586,15 @@ const Ordering& ExecNode::ordering() const {
 
 Status ExecNode::Init() { return Status::OK(); }
 
+bool ExecNode::AddRuntimeFilter(std::shared_ptr<RuntimeFilter> filter,
+                                std::vector<int> key_ids) {
+  return false;
+}
+
+bool ExecNode::SetRowLimit(int64_t num_rows) { return false; }
+
+bool ExecNode::SetFieldsRead(const std::vector<int>& field_ids) { return false; }
+
 Status ExecNode::Validate() const {
   if (inputs_.size() != input_labels_.size()) {
     return Status::Invalid("Invalid number of inputs for '", label(), "' (expected ",
@@ -1104,10 +1226,14 @@ Result<std::unique_ptr<RecordBatchReader>> DeclarationToReader(
 namespace internal {
 
 void RegisterSourceNode(ExecFactoryRegistry*);
+void RegisterCoalesceNode(ExecFactoryRegistry*);
+void RegisterDistinctNode(ExecFactoryRegistry*);
+void RegisterExchangeNodes(ExecFactoryRegistry*);
 void RegisterFetchNode(ExecFactoryRegistry*);
 void RegisterFilterNode(ExecFactoryRegistry*);
 void RegisterOrderByNode(ExecFactoryRegistry*);
 void RegisterPivotLongerNode(ExecFactoryRegistry*);
+void RegisterPivotWiderNode(ExecFactoryRegistry*);
 void RegisterProjectNode(ExecFactoryRegistry*);
 void RegisterUnionNode(ExecFactoryRegistry*);
 void RegisterAggregateNode(ExecFactoryRegistry*);
@@ -1115,6 +1241,8 @@ void RegisterSinkNode(ExecFactoryRegistry*);
 void RegisterHashJoinNode(ExecFactoryRegistry*);
 void RegisterAsofJoinNode(ExecFactoryRegistry*);
 void RegisterSortedMergeNode(ExecFactoryRegistry*);
+void RegisterWindowNode(ExecFactoryRegistry*);
+void RegisterSortMergeJoinNode(ExecFactoryRegistry*);
 
 }  // namespace internal
 
@@ -1123,10 +1251,14 @@ ExecFactoryRegistry* default_exec_factory_registry() {
    public:
     DefaultRegistry() {
       internal::RegisterSourceNode(this);
+      internal::RegisterCoalesceNode(this);
+      internal::RegisterDistinctNode(this);
+      internal::RegisterExchangeNodes(this);
       internal::RegisterFetchNode(this);
       internal::RegisterFilterNode(this);
       internal::RegisterOrderByNode(this);
       internal::RegisterPivotLongerNode(this);
+      internal::RegisterPivotWiderNode(this);
       internal::RegisterProjectNode(this);
       internal::RegisterUnionNode(this);
       internal::RegisterAggregateNode(this);
@@ -1134,6 +1266,8 @@ ExecFactoryRegistry* default_exec_factory_registry() {
       internal::RegisterHashJoinNode(this);
       internal::RegisterAsofJoinNode(this);
       internal::RegisterSortedMergeNode(this);
+      internal::RegisterWindowNode(this);
+      internal::RegisterSortMergeJoinNode(this);
     }
 
     Result<Factory> GetFactory(const std::string& factory_name) override {
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
@@ -51,6 +52,71 @@ namespace acero {
 /// \addtogroup acero-internals
 /// @{
 
+/// \brief Runtime statistics of a single ExecNode
+struct ARROW_ACERO_EXPORT ExecNodeStats {
+  std::string label;
+  std::string kind_name;
+
+  // Bytes are those referenced by the batches' arrays, so a slice only counts the
+  // part of the buffers it covers
+  int64_t input_batches = 0;
+  int64_t input_rows = 0;
+  int64_t input_bytes = 0;
+  int64_t output_batches = 0;
+  int64_t output_rows = 0;
+  int64_t output_bytes = 0;
+
+  /// Time spent in InputReceived, excluding the time spent in nested calls to the
+  /// InputReceived of downstream nodes
+  int64_t processing_time_nanos = 0;
+  /// Time spent paused by backpressure from the node's output
+  int64_t paused_time_nanos = 0;
+
+  std::string ToString() const;
+};
+
+/// \brief Runtime statistics of an ExecPlan
+struct ARROW_ACERO_EXPORT ExecPlanStats {
+  /// The statistics of each node, in the order of ExecPlan::nodes()
+  std::vector<ExecNodeStats> nodes;
+  /// The peak allocation of the plan's memory pool
+  ///
+  /// Memory is not tracked per node because buffers are freely shared among nodes.
+  int64_t peak_memory_bytes = 0;
+};
+
+/// \brief Counters updated by an ExecNode as batches flow through it
+///
+/// The counters are relaxed atomics so they are cheap enough to always be on.  Nodes
+/// normally don't update them directly but through TracedNode::TraceInputReceived,
+/// which records a batch both as output of its producer and as input of its consumer.
+class ARROW_ACERO_EXPORT ExecNodeMetrics {
+ public:
+  void RecordInput(const ExecBatch& batch);
+  void RecordOutput(const ExecBatch& batch);
+  void AddProcessingTime(int64_t nanos);
+
+  /// \brief Record the start of a pause, ignored if the node is already paused
+  void NotePaused();
+  /// \brief Record the end of a pause, ignored if the node is not paused
+  void NoteResumed();
+
+  /// \brief Copy the counters into `stats`
+  void FillStats(ExecNodeStats* stats) const;
+
+ private:
+  std::atomic<int64_t> input_batches_{0};
+  std::atomic<int64_t> input_rows_{0};
+  std::atomic<int64_t> input_bytes_{0};
+  std::atomic<int64_t> output_batches_{0};
+  std::atomic<int64_t> output_rows_{0};
+  std::atomic<int64_t> output_bytes_{0};
+  std::atomic<int64_t> processing_time_nanos_{0};
+  std::atomic<int64_t> paused_time_nanos_{0};
+  // Steady clock time at which the current pause started, or -1 if not paused
+  std::atomic<int64_t> paused_since_nanos_{-1};
+};
+
 class ARROW_ACERO_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan> {
  public:
   // This allows operators to rely on signed 16-bit indices
@@ -116,6 +182,17 @@ class ARROW_ACERO_EXPORT ExecPlan : public std::enable_shared_from_this<ExecPlan
   std::shared_ptr<const KeyValueMetadata> metadata() const;
 
   std::string ToString() const;
+
+  /// \brief Return the runtime statistics collected so far
+  ///
+  /// This may be called at any time after StartProducing, the statistics are final
+  /// once `finished` has completed.
+  ExecPlanStats GetStats() const;
+
+  /// \brief Return the plan as ToString() does, with each node's statistics appended
+  ///
+  /// This is the equivalent of EXPLAIN ANALYZE.
+  std::string ToStringWithStats() const;
 };
 
 // Acero can be extended by providing custom implementations of ExecNode.  The methods
@@ -241,6 +318,51 @@ class ARROW_ACERO_EXPORT ExecNode {
   /// being well defined.
   virtual Status Init();
 
+  /// \brief Offer a runtime filter to be applied to this node's output
+  ///
+  /// \param filter The filter, which rejects rows whose keys certainly don't match
+  /// \param key_ids The indices, in this node's output schema, of the filter's keys
+  ///
+  /// A node may forward the filter to one of its inputs, apply it to its own output,
+  /// or decline it.  Since batches may be produced before the filter is ready, applying
+  /// it is only ever an optimization.  This is called from another node's Init() and
+  /// so before any node starts producing.
+  ///
+  /// By default the filter is declined.
+  ///
+  /// \return true if the filter will be applied by this node or one of its inputs
+  virtual bool AddRuntimeFilter(std::shared_ptr<RuntimeFilter> filter,
+                                std::vector<int> key_ids);
+
+  /// \brief Offer a limit on the number of rows of this node's output that are needed
+  ///
+  /// \param num_rows The number of leading rows, in the order of this node's output,
+  /// after which no more rows will be used downstream
+  ///
+  /// A node may forward the limit to one of its inputs, stop producing once it has
+  /// output that many rows, or decline it.  Excess rows are still discarded downstream
+  /// and so honouring the limit is only ever an optimization.  This is called from
+  /// another node's Init() and so before any node starts producing.
+  ///
+  /// By default the limit is declined.
+  ///
+  /// \return true if this node or one of its inputs will honour the limit
+  virtual bool SetRowLimit(int64_t num_rows);
+
+  /// \brief Offer the set of this node's output fields that are read downstream
+  ///
+  /// \param field_ids The indices, in this node's output schema, of the only fields
+  /// that will be read downstream
+  ///
+  /// A node may then skip materializing the other fields, outputting a null scalar in
+  /// their place, or decline the hint.  The output schema is unchanged.  This is called
+  /// from another node's Init() and so before any node starts producing.
+  ///
+  /// By default the hint is declined.
+  ///
+  /// \return true if this node will skip materializing the fields that are not read
+  virtual bool SetFieldsRead(const std::vector<int>& field_ids);
+
   /// Lifecycle API:
   /// - start / stop to initiate and terminate production
   /// - pause / resume to apply backpressure
@@ -329,6 +451,10 @@ class ARROW_ACERO_EXPORT ExecNode {
 
   std::string ToString(int indent = 0) const;
 
+  /// \brief The runtime counters of this node
+  ExecNodeMetrics* metrics() { return &metrics_; }
+  const ExecNodeMetrics& metrics() const { return metrics_; }
+
  protected:
   ExecNode(ExecPlan* plan, NodeVector inputs, std::vector<std::string> input_labels,
            std::shared_ptr<Schema> output_schema);
@@ -347,6 +473,8 @@ class ARROW_ACERO_EXPORT ExecNode {
 
   std::shared_ptr<Schema> output_schema_;
   ExecNode* output_ = NULLPTR;
+
+  ExecNodeMetrics metrics_;
 };
 
 /// \brief An extensible registry for factories of ExecNodes
@@ -602,6 +730,17 @@ struct ARROW_ACERO_EXPORT QueryOptions {
   /// If this field is not set then it will be treated as kWarn unless overridden
   /// by the ACERO_ALIGNMENT_HANDLING environment variable
   std::optional<UnalignedBufferHandling> unaligned_buffer_handling;
+
+  /// \brief a budget for the memory buffered by the nodes of the plan
+  ///
+  /// The same budget may be shared by several plans.  If this is null then the memory
+  /// buffered by nodes is not capped.  \see MemoryBudget
+  std::shared_ptr<MemoryBudget> memory_budget;
+
+  /// \brief a compiler for the expressions of filter and project nodes
+  ///
+  /// If this is null then expressions are interpreted.  \see ExpressionCompiler
+  std::shared_ptr<ExpressionCompiler> expression_compiler;
 };
 
 /// \brief Calculate the output schema of a declaration
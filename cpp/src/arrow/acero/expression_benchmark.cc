@@ -79,6 +79,19 @@ static void SimplifyFilterWithGuarantee(benchmark::State& state, Expression filt
   }
 }
 
+// The same, through a SimplifyWithGuaranteeCache as when scanning many fragments
+// sharing partition expressions.
+static void SimplifyFilterWithGuaranteeCached(benchmark::State& state, Expression filter,
+                                              Expression guarantee) {
+  auto dataset_schema = schema({field("a", int64()), field("b", int64())});
+  ASSIGN_OR_ABORT(filter, filter.Bind(*dataset_schema));
+
+  compute::SimplifyWithGuaranteeCache cache;
+  for (auto _ : state) {
+    ABORT_NOT_OK(cache.Simplify(filter, guarantee));
+  }
+}
+
 static void ExecuteScalarExpressionOverhead(benchmark::State& state, Expression expr) {
   const auto rows_per_batch = static_cast<int32_t>(state.range(0));
   const auto num_batches = 1000000 / rows_per_batch;
@@ -181,6 +194,12 @@ BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee,
                   guarantee_dictionary);
 BENCHMARK_CAPTURE(SimplifyFilterWithGuarantee, positive_filter_cast_guarantee_dictionary,
                   filter_cast_positive, guarantee_dictionary);
+// Memoized
+BENCHMARK_CAPTURE(SimplifyFilterWithGuaranteeCached,
+                  positive_filter_cast_guarantee_simple, filter_cast_positive, guarantee);
+BENCHMARK_CAPTURE(SimplifyFilterWithGuaranteeCached,
+                  positive_filter_cast_guarantee_dictionary, filter_cast_positive,
+                  guarantee_dictionary);
 
 BENCHMARK_CAPTURE(BindAndEvaluate, simple_array, field_ref("int_arr"));
 BENCHMARK_CAPTURE(BindAndEvaluate, simple_scalar, field_ref("int_scalar"));
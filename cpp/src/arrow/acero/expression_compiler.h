@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \brief Bound scalar expressions compiled to be evaluated together
+///
+/// Execute may be called concurrently from several threads.
+class ARROW_ACERO_EXPORT CompiledExpressions {
+ public:
+  virtual ~CompiledExpressions() = default;
+
+  /// \brief Evaluate the expressions against a batch of the schema they were
+  /// compiled for, returning one value per expression
+  virtual Result<std::vector<Datum>> Execute(const compute::ExecBatch& batch,
+                                             compute::ExecContext* exec_context) = 0;
+};
+
+/// \brief A bound boolean expression compiled to select the rows of a filter
+///
+/// Select may be called concurrently from several threads.
+class ARROW_ACERO_EXPORT CompiledFilter {
+ public:
+  virtual ~CompiledFilter() = default;
+
+  /// \brief Evaluate the predicate against a batch of the schema it was compiled
+  /// for, returning the ascending indices of the rows where it is true
+  ///
+  /// The indices are an array of an unsigned integer type.  Rows where the
+  /// predicate is null are not selected.
+  virtual Result<std::shared_ptr<Array>> Select(const compute::ExecBatch& batch,
+                                                compute::ExecContext* exec_context) = 0;
+};
+
+/// \brief Compiles the expressions of filter and project nodes
+///
+/// When set as QueryOptions::expression_compiler, filter and project nodes hand their
+/// bound expressions to the compiler once, when the plan is initialized, and evaluate
+/// the compiled form instead of interpreting the expressions batch by batch.  Parts
+/// of the expressions that a compiler does not support are expected to still be
+/// interpreted, e.g. with compute::ExecuteScalarExpressions.  Since the expressions
+/// are compiled once, they are not simplified against the guarantee of each batch.
+///
+/// A compiler may also be set on the options of a single node, e.g.
+/// ProjectNodeOptions::expression_compiler, which takes precedence over the query.
+class ARROW_ACERO_EXPORT ExpressionCompiler {
+ public:
+  virtual ~ExpressionCompiler() = default;
+
+  /// \brief Compile bound scalar expressions whose input is of `schema`
+  ///
+  /// Return null if none of the expressions would benefit from being compiled, in
+  /// which case the node interprets them as usual.
+  virtual Result<std::unique_ptr<CompiledExpressions>> Compile(
+      const std::vector<compute::Expression>& exprs,
+      const std::shared_ptr<Schema>& schema) = 0;
+
+  /// \brief Compile the bound predicate of a filter whose input is of `schema`
+  ///
+  /// A compiled filter selects the rows directly, which saves computing a boolean
+  /// mask first.  Return null if the predicate can't be compiled entirely, in which
+  /// case the node falls back to Compile.  The default never compiles filters.
+  virtual Result<std::unique_ptr<CompiledFilter>> CompileFilter(
+      const compute::Expression& predicate, const std::shared_ptr<Schema>& schema) {
+    return nullptr;
+  }
+};
+
+}  // namespace acero
+}  // namespace arrow
@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <limits>
 #include <sstream>
 
 #include "arrow/acero/accumulation_queue.h"
@@ -135,6 +136,14 @@ class FetchNode : public ExecNode, public TracedNode, util::SequencingQueue::Pro
     return Status::OK();
   }
 
+  Status Init() override {
+    // No row past the last one sent is ever needed from the input
+    if (count_ <= std::numeric_limits<int64_t>::max() - offset_) {
+      inputs_[0]->SetRowLimit(offset_ + count_);
+    }
+    return Status::OK();
+  }
+
   Status StartProducing() override {
     NoteStartProducing(ToStringExtra());
     return Status::OK();
@@ -151,7 +160,7 @@ class FetchNode : public ExecNode, public TracedNode, util::SequencingQueue::Pro
   Status StopProducingImpl() override { return Status::OK(); }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
     DCHECK_EQ(input, inputs_[0]);
 
     return sequencing_queue_->InsertBatch(std::move(batch));
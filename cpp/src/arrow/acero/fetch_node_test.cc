@@ -22,10 +22,12 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/test_nodes.h"
+#include "arrow/compute/expression.h"
 #include "arrow/table.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
+#include "arrow/util/iterator.h"
 
 namespace arrow {
 namespace acero {
@@ -80,6 +82,38 @@ TEST(FetchNode, Basic) {
   CheckFetch({0, 0});
 }
 
+TEST(FetchNode, StopsReadingSource) {
+  // A source only reads as many batches as the fetch (through a projection) needs
+  std::shared_ptr<Table> input = TestTable();
+  TableBatchReader reader(*input);
+  reader.set_chunksize(kRowsPerBatch);
+  ASSERT_OK_AND_ASSIGN(RecordBatchVector batches, reader.ToRecordBatches());
+  for (bool use_threads : {false, true}) {
+    int num_reads = 0;
+    auto it_maker = [&]() {
+      return MakeFunctionIterator(
+          [&, index = size_t(0)]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+            if (index == batches.size()) {
+              return IterationTraits<std::shared_ptr<RecordBatch>>::End();
+            }
+            ++num_reads;
+            return batches[index++];
+          });
+    };
+    Declaration plan = Declaration::Sequence(
+        {{"record_batch_source", RecordBatchSourceNodeOptions(input->schema(), it_maker)},
+         {"project", ProjectNodeOptions({compute::field_ref(0)},
+                                        {input->schema()->field(0)->name()})},
+         {"fetch", FetchNodeOptions(20, 20)}});
+    QueryOptions query_options;
+    query_options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(std::move(plan), query_options));
+    AssertTablesEqual(*input->Slice(20, 20), *actual, /*same_chunk_layout=*/false);
+    ASSERT_EQ(3, num_reads);
+  }
+}
+
 TEST(FetchNode, Invalid) {
   CheckFetchInvalid({-1, 10}, "`offset` must be non-negative");
   CheckFetchInvalid({10, -1}, "`count` must be non-negative");
@@ -16,14 +16,18 @@
 // under the License.
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
+#include "arrow/array/array_primitive.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
@@ -41,9 +45,11 @@ namespace {
 class FilterNode : public MapNode {
  public:
   FilterNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-             std::shared_ptr<Schema> output_schema, Expression filter)
+             std::shared_ptr<Schema> output_schema, Expression filter,
+             std::shared_ptr<ExpressionCompiler> compiler)
       : MapNode(plan, std::move(inputs), std::move(output_schema)),
-        filter_(std::move(filter)) {}
+        filter_(std::move(filter)),
+        compiler_(std::move(compiler)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -64,25 +70,61 @@ class FilterNode : public MapNode {
                                filter_expression.ToString(), " evaluates to ",
                                filter_expression.type()->ToString());
     }
+    auto compiler = filter_options.expression_compiler
+                        ? filter_options.expression_compiler
+                        : plan->query_context()->options().expression_compiler;
     return plan->EmplaceNode<FilterNode>(plan, std::move(inputs), std::move(schema),
-                                         std::move(filter_expression));
+                                         std::move(filter_expression),
+                                         std::move(compiler));
   }
 
   const char* kind_name() const override { return "FilterNode"; }
 
+  bool AddRuntimeFilter(std::shared_ptr<RuntimeFilter> filter,
+                        std::vector<int> key_ids) override {
+    // The output schema is the input schema, so the filter is best applied upstream
+    if (inputs_[0]->AddRuntimeFilter(filter, key_ids)) {
+      return true;
+    }
+    runtime_filters_.Add(std::move(filter), std::move(key_ids));
+    return true;
+  }
+
+  Status Init() override {
+    if (compiler_) {
+      const auto& schema = inputs_[0]->output_schema();
+      ARROW_ASSIGN_OR_RAISE(compiled_selection_,
+                            compiler_->CompileFilter(filter_, schema));
+      if (!compiled_selection_) {
+        ARROW_ASSIGN_OR_RAISE(compiled_filter_, compiler_->Compile({filter_}, schema));
+      }
+    }
+    return MapNode::Init();
+  }
+
+  bool SetFieldsRead(const std::vector<int>& field_ids) override {
+    // Fields that are not read are output as null scalars instead of being filtered
+    unread_values_.resize(output_schema_->num_fields());
+    for (int i = 0; i < output_schema_->num_fields(); ++i) {
+      unread_values_[i] = MakeNullScalar(output_schema_->field(i)->type());
+    }
+    for (int field_id : field_ids) {
+      unread_values_[field_id] = Datum();
+    }
+    return true;
+  }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
-    ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
-                          SimplifyWithGuarantee(filter_, batch.guarantee));
+    if (!runtime_filters_.empty()) {
+      QueryContext* ctx = plan()->query_context();
+      RETURN_NOT_OK(runtime_filters_.Apply(ctx, ctx->GetThreadIndex(), &batch));
+    }
 
-    arrow::util::tracing::Span span;
-    START_COMPUTE_SPAN(span, "Filter",
-                       {{"filter.expression", ToStringExtra()},
-                        {"filter.expression.simplified", simplified_filter.ToString()},
-                        {"filter.length", batch.length}});
+    if (compiled_selection_) {
+      return SelectBatch(std::move(batch));
+    }
 
-    ARROW_ASSIGN_OR_RAISE(
-        Datum mask, ExecuteScalarExpression(simplified_filter, batch,
-                                            plan()->query_context()->exec_context()));
+    ARROW_ASSIGN_OR_RAISE(Datum mask, ComputeMask(batch));
 
     if (mask.is_scalar()) {
       const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
@@ -97,11 +139,22 @@ class FilterNode : public MapNode {
                         [](const Datum& value) { return value.is_scalar(); }));
 
     auto values = batch.values;
-    for (auto& value : values) {
-      if (value.is_scalar()) continue;
-      ARROW_ASSIGN_OR_RAISE(value, Filter(value, mask, FilterOptions::Defaults()));
+    int64_t length = -1;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (!unread_values_.empty() && unread_values_[i].is_value()) {
+        values[i] = unread_values_[i];
+        continue;
+      }
+      if (values[i].is_scalar()) continue;
+      ARROW_ASSIGN_OR_RAISE(values[i],
+                            Filter(values[i], mask, FilterOptions::Defaults()));
+      length = values[i].length();
+    }
+    if (length < 0) {
+      // No array is read downstream so only the number of selected rows is needed
+      length = BooleanArray(mask.array()).true_count();
     }
-    return ExecBatch::Make(std::move(values));
+    return ExecBatch(std::move(values), length);
   }
 
  protected:
@@ -110,7 +163,70 @@ class FilterNode : public MapNode {
   }
 
  private:
+  // Take the rows selected by the compiled filter, instead of computing a mask
+  Result<ExecBatch> SelectBatch(ExecBatch batch) {
+    compute::ExecContext* exec_context = plan()->query_context()->exec_context();
+    std::shared_ptr<Array> indices;
+    {
+      arrow::util::tracing::Span span;
+      START_COMPUTE_SPAN(span, "Filter",
+                         {{"filter.expression", ToStringExtra()},
+                          {"filter.compiled", true},
+                          {"filter.length", batch.length}});
+      ARROW_ASSIGN_OR_RAISE(indices, compiled_selection_->Select(batch, exec_context));
+    }
+    if (indices->length() == batch.length) {
+      return batch;
+    }
+
+    auto values = batch.values;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (!unread_values_.empty() && unread_values_[i].is_value()) {
+        values[i] = unread_values_[i];
+        continue;
+      }
+      if (values[i].is_scalar()) continue;
+      ARROW_ASSIGN_OR_RAISE(values[i], Take(values[i], indices,
+                                            compute::TakeOptions::Defaults(),
+                                            exec_context));
+    }
+    return ExecBatch(std::move(values), indices->length());
+  }
+
+  Result<Datum> ComputeMask(const ExecBatch& batch) {
+    compute::ExecContext* exec_context = plan()->query_context()->exec_context();
+    if (compiled_filter_) {
+      arrow::util::tracing::Span span;
+      START_COMPUTE_SPAN(span, "Filter",
+                         {{"filter.expression", ToStringExtra()},
+                          {"filter.compiled", true},
+                          {"filter.length", batch.length}});
+      ARROW_ASSIGN_OR_RAISE(std::vector<Datum> values,
+                            compiled_filter_->Execute(batch, exec_context));
+      return std::move(values[0]);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
+                          SimplifyWithGuarantee(filter_, batch.guarantee));
+
+    arrow::util::tracing::Span span;
+    START_COMPUTE_SPAN(span, "Filter",
+                       {{"filter.expression", ToStringExtra()},
+                        {"filter.expression.simplified", simplified_filter.ToString()},
+                        {"filter.length", batch.length}});
+
+    return ExecuteScalarExpression(simplified_filter, batch, exec_context);
+  }
+
   Expression filter_;
+  std::shared_ptr<ExpressionCompiler> compiler_;
+  // At most one of these is set, the compiled selection being preferred
+  std::unique_ptr<CompiledFilter> compiled_selection_;
+  std::unique_ptr<CompiledExpressions> compiled_filter_;
+  RuntimeFilterSet runtime_filters_;
+  // Null scalars output in place of the fields that are not read downstream, and
+  // null datums for those that are read, see SetFieldsRead.  Empty if all are read.
+  std::vector<Datum> unread_values_;
 };
 }  // namespace
 
@@ -26,6 +26,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
@@ -63,6 +64,16 @@ Status GroupByNode::Init() {
   output_task_group_id_ = plan_->query_context()->RegisterTaskGroup(
       [this](size_t, int64_t task_id) { return OutputNthBatch(task_id); },
       [](size_t) { return Status::OK(); });
+  if (partitioned()) {
+    merge_task_group_id_ = plan_->query_context()->RegisterTaskGroup(
+        [this](size_t, int64_t task_id) {
+          return OutputPartition(static_cast<int>(task_id));
+        },
+        [this](size_t) {
+          ReleaseMemoryReservation();
+          return output_->InputFinished(this, spill_.num_output_batches.load());
+        });
+  }
   return Status::OK();
 }
 
@@ -194,11 +205,43 @@ Result<ExecNode*> GroupByNode::Make(ExecPlan* plan, std::vector<ExecNode*> input
       auto args, MakeAggregateNodeArgs(input_schema, keys, segment_keys, aggs, exec_ctx,
                                        is_cpu_parallel));
 
+  const bool spilling = aggregate_options.spill_threshold_bytes >= 0;
+  if (spilling && aggregate_options.num_spill_partitions < 1) {
+    return Status::Invalid("num_spill_partitions must be at least 1, got ",
+                           aggregate_options.num_spill_partitions);
+  }
+  if (aggregate_options.num_merge_partitions < 1) {
+    return Status::Invalid("num_merge_partitions must be at least 1, got ",
+                           aggregate_options.num_merge_partitions);
+  }
+  const int num_partitions = spilling ? aggregate_options.num_spill_partitions
+                                      : aggregate_options.num_merge_partitions;
+  if (spilling || num_partitions > 1) {
+    const char* feature = spilling ? "Spilling" : "Partitioned merging";
+    if (!segment_keys.empty()) {
+      return Status::NotImplemented(feature,
+                                    " is not supported for segmented aggregation");
+    }
+    for (auto kernel : args.kernels) {
+      if (kernel->ordered) {
+        return Status::NotImplemented(
+            feature, " is not supported for ordered aggregate functions");
+      }
+    }
+    for (int key_field_id : args.grouping_key_field_ids) {
+      if (input_schema->field(key_field_id)->type()->id() == Type::DICTIONARY) {
+        return Status::NotImplemented(
+            feature, " is not supported for aggregations on dictionary keys");
+      }
+    }
+  }
+
   return input->plan()->EmplaceNode<GroupByNode>(
       input, std::move(args.output_schema), std::move(args.grouping_key_field_ids),
       std::move(args.segment_key_field_ids), std::move(args.segmenter),
       std::move(args.kernel_intypes), std::move(args.target_fieldsets),
-      std::move(args.aggregates), std::move(args.kernels));
+      std::move(args.aggregates), std::move(args.kernels),
+      aggregate_options.spill_threshold_bytes, num_partitions);
 }
 
 Status GroupByNode::ResetKernelStates() {
@@ -216,7 +259,10 @@ Status GroupByNode::Consume(ExecSpan batch) {
 
   auto state = &local_states_[thread_index];
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
+  return ConsumeIntoState(state, batch);
+}
 
+Status GroupByNode::ConsumeIntoState(ThreadLocalState* state, const ExecSpan& batch) {
   // Create a batch with key columns
   std::vector<ExecValue> keys(key_field_ids_.size());
   for (size_t i = 0; i < key_field_ids_.size(); ++i) {
@@ -262,32 +308,36 @@ Status GroupByNode::Merge() {
     if (!state->grouper) {
       continue;
     }
+    RETURN_NOT_OK(MergeStates(state0, state));
+  }
+  return Status::OK();
+}
 
-    ARROW_ASSIGN_OR_RAISE(ExecBatch other_keys, state->grouper->GetUniques());
-    ARROW_ASSIGN_OR_RAISE(Datum transposition,
-                          state0->grouper->Consume(ExecSpan(other_keys)));
-    state->grouper.reset();
-
-    for (size_t span_i = 0; span_i < agg_kernels_.size(); ++span_i) {
-      arrow::util::tracing::Span span_item;
-      START_COMPUTE_SPAN(
-          span_item, aggs_[span_i].function,
-          {{"function.name", aggs_[span_i].function},
-           {"function.options",
-            aggs_[span_i].options ? aggs_[span_i].options->ToString() : "<NULLPTR>"},
-           {"function.kind", std::string(kind_name()) + "::Merge"}});
-
-      auto ctx = plan_->query_context()->exec_context();
-      KernelContext batch_ctx{ctx};
-      DCHECK(state0->agg_states[span_i]);
-      batch_ctx.SetState(state0->agg_states[span_i].get());
-
-      RETURN_NOT_OK(
-          agg_kernels_[span_i]->resize(&batch_ctx, state0->grouper->num_groups()));
-      RETURN_NOT_OK(agg_kernels_[span_i]->merge(
-          &batch_ctx, std::move(*state->agg_states[span_i]), *transposition.array()));
-      state->agg_states[span_i].reset();
-    }
+Status GroupByNode::MergeStates(ThreadLocalState* state0, ThreadLocalState* state) {
+  ARROW_ASSIGN_OR_RAISE(ExecBatch other_keys, state->grouper->GetUniques());
+  ARROW_ASSIGN_OR_RAISE(Datum transposition,
+                        state0->grouper->Consume(ExecSpan(other_keys)));
+  state->grouper.reset();
+
+  for (size_t span_i = 0; span_i < agg_kernels_.size(); ++span_i) {
+    arrow::util::tracing::Span span_item;
+    START_COMPUTE_SPAN(
+        span_item, aggs_[span_i].function,
+        {{"function.name", aggs_[span_i].function},
+         {"function.options",
+          aggs_[span_i].options ? aggs_[span_i].options->ToString() : "<NULLPTR>"},
+         {"function.kind", std::string(kind_name()) + "::Merge"}});
+
+    auto ctx = plan_->query_context()->exec_context();
+    KernelContext batch_ctx{ctx};
+    DCHECK(state0->agg_states[span_i]);
+    batch_ctx.SetState(state0->agg_states[span_i].get());
+
+    RETURN_NOT_OK(
+        agg_kernels_[span_i]->resize(&batch_ctx, state0->grouper->num_groups()));
+    RETURN_NOT_OK(agg_kernels_[span_i]->merge(
+        &batch_ctx, std::move(*state->agg_states[span_i]), *transposition.array()));
+    state->agg_states[span_i].reset();
   }
   return Status::OK();
 }
@@ -297,7 +347,10 @@ Result<ExecBatch> GroupByNode::Finalize() {
   START_COMPUTE_SPAN(span, "Finalize",
                      {{"group_by", ToStringExtra(0)}, {"node.label", label()}});
 
-  ThreadLocalState* state = &local_states_[0];
+  return FinalizeState(&local_states_[0]);
+}
+
+Result<ExecBatch> GroupByNode::FinalizeState(ThreadLocalState* state) {
   // If we never got any batches, then state won't have been initialized
   RETURN_NOT_OK(InitLocalStateIfNeeded(state));
 
@@ -363,11 +416,173 @@ Status GroupByNode::OutputResult(bool is_last) {
   return Status::OK();
 }
 
+Status GroupByNode::ConsumePartitioned(const ExecBatch& batch) {
+  QueryContext* ctx = plan_->query_context();
+  size_t thread_index = ctx->GetThreadIndex();
+  if (thread_index >= spill_.partition_states.size()) {
+    return Status::IndexError("thread index ", thread_index, " is out of range [0, ",
+                              spill_.partition_states.size(), ")");
+  }
+
+  if (spilling_enabled() && !spill_.active.load()) {
+    int64_t batch_bytes = batch.TotalBufferSize();
+    if (MemoryBudget* memory_budget = ctx->memory_budget()) {
+      memory_budget->Reserve(batch_bytes);
+    }
+    if (spill_.bytes_in_memory.fetch_add(batch_bytes) + batch_bytes >
+            spill_.threshold_bytes ||
+        ctx->memory_budget_exceeded()) {
+      RETURN_NOT_OK(StartSpilling());
+    }
+  }
+  if (spill_.active.load()) {
+    return SpillBatch(thread_index, batch);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> partitions,
+                        PartitionBatchByHash(batch, key_field_ids_, spill_.num_partitions,
+                                             ctx, thread_index));
+  for (int prtn = 0; prtn < spill_.num_partitions; ++prtn) {
+    if (partitions[prtn].length == 0) continue;
+    ThreadLocalState* state = &spill_.partition_states[thread_index][prtn];
+    RETURN_NOT_OK(InitLocalStateIfNeeded(state));
+    RETURN_NOT_OK(ConsumeIntoState(state, ExecSpan(partitions[prtn])));
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::StartSpilling() {
+  std::lock_guard<std::mutex> guard(spill_.mutex);
+  if (spill_.active.load()) {
+    return Status::OK();
+  }
+  spill_.directory = std::make_unique<SpillDirectory>("arrow-acero-groupby-spill-");
+  for (int prtn = 0; prtn < spill_.num_partitions; ++prtn) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto file, spill_.directory->MakeFile(inputs_[0]->output_schema(),
+                                              plan_->query_context()->memory_pool()));
+    spill_.files.push_back(std::move(file));
+  }
+  spill_.active.store(true);
+  return Status::OK();
+}
+
+Status GroupByNode::SpillBatch(size_t thread_index, const ExecBatch& batch) {
+  QueryContext* ctx = plan_->query_context();
+  ARROW_ASSIGN_OR_RAISE(std::vector<ExecBatch> partitions,
+                        PartitionBatchByHash(batch, key_field_ids_, spill_.num_partitions,
+                                             ctx, thread_index));
+  for (int prtn = 0; prtn < spill_.num_partitions; ++prtn) {
+    if (partitions[prtn].length == 0) continue;
+    auto io_mark = std::make_shared<QueryContext::TempFileIOMark>(
+        ctx, static_cast<size_t>(partitions[prtn].TotalBufferSize()));
+    SpillFile* file = spill_.files[prtn].get();
+    spill_.pending_writes.fetch_add(1);
+    ctx->ScheduleIOTask(
+        [this, file, io_mark, prtn_batch = std::move(partitions[prtn])]() -> Status {
+          RETURN_NOT_OK(file->Write(prtn_batch));
+          spill_.pending_writes.fetch_sub(1);
+          return MaybeOutputPartitions(/*input_finished=*/false);
+        },
+        "GroupByNode::SpillBatch");
+  }
+  return Status::OK();
+}
+
+Status GroupByNode::MaybeOutputPartitions(bool input_finished) {
+  {
+    std::lock_guard<std::mutex> guard(spill_.mutex);
+    spill_.input_finished |= input_finished;
+    if (!spill_.input_finished || spill_.output_started ||
+        spill_.pending_writes.load() > 0) {
+      return Status::OK();
+    }
+    spill_.output_started = true;
+  }
+  if (!spill_.active.load()) {
+    return OutputPartitions();
+  }
+  for (auto& file : spill_.files) {
+    RETURN_NOT_OK(file->FinishWriting());
+  }
+  // Reading the spilled rows back is blocking so the partitions are finished from an
+  // IO task
+  plan_->query_context()->ScheduleIOTask([this]() { return OutputPartitions(); },
+                                         "GroupByNode::OutputPartitions");
+  return Status::OK();
+}
+
+Status GroupByNode::OutputPartitions() {
+  if (!spill_.active.load()) {
+    // Nothing was spilled so the partitions can be merged and output in parallel
+    return plan_->query_context()->StartTaskGroup(merge_task_group_id_,
+                                                  spill_.num_partitions);
+  }
+  for (int prtn = 0; prtn < spill_.num_partitions; ++prtn) {
+    RETURN_NOT_OK(OutputPartition(prtn));
+  }
+  ReleaseMemoryReservation();
+  return output_->InputFinished(this, spill_.num_output_batches.load());
+}
+
+void GroupByNode::ReleaseMemoryReservation() {
+  MemoryBudget* memory_budget = plan_->query_context()->memory_budget();
+  if (memory_budget != nullptr && spilling_enabled()) {
+    memory_budget->Release(spill_.bytes_in_memory.exchange(0));
+  }
+}
+
+Status GroupByNode::OutputPartition(int prtn) {
+  ThreadLocalState* state0 = nullptr;
+  for (auto& states : spill_.partition_states) {
+    ThreadLocalState* state = &states[prtn];
+    if (!state->grouper) {
+      continue;
+    }
+    if (state0 == nullptr) {
+      state0 = state;
+    } else {
+      RETURN_NOT_OK(MergeStates(state0, state));
+    }
+  }
+  if (state0 == nullptr) {
+    state0 = &spill_.partition_states[0][prtn];
+    RETURN_NOT_OK(InitLocalStateIfNeeded(state0));
+  }
+
+  if (!spill_.files.empty()) {
+    SpillFile* file = spill_.files[prtn].get();
+    for (int i = 0; i < file->num_batches(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch batch, file->ReadBatch(i));
+      RETURN_NOT_OK(ConsumeIntoState(state0, ExecSpan(batch)));
+    }
+    spill_.files[prtn].reset();
+  }
+
+  ARROW_ASSIGN_OR_RAISE(ExecBatch out_data, FinalizeState(state0));
+  int64_t batch_size = output_batch_size();
+  int64_t num_output_batches = bit_util::CeilDiv(out_data.length, batch_size);
+  spill_.num_output_batches.fetch_add(static_cast<int>(num_output_batches));
+  for (int64_t i = 0; i < num_output_batches; ++i) {
+    RETURN_NOT_OK(
+        output_->InputReceived(this, out_data.Slice(batch_size * i, batch_size)));
+  }
+  return Status::OK();
+}
+
 Status GroupByNode::InputReceived(ExecNode* input, ExecBatch batch) {
-  auto scope = TraceInputReceived(batch);
+  auto scope = TraceInputReceived(input, batch);
 
   DCHECK_EQ(input, inputs_[0]);
 
+  if (partitioned()) {
+    RETURN_NOT_OK(ConsumePartitioned(batch));
+    if (input_counter_.Increment()) {
+      return MaybeOutputPartitions(/*input_finished=*/true);
+    }
+    return Status::OK();
+  }
+
   auto handler = [this](const ExecBatch& full_batch, const Segment& segment) {
     if (!segment.extends && segment.offset == 0) RETURN_NOT_OK(OutputResult(false));
     auto exec_batch = full_batch.Slice(segment.offset, segment.length);
@@ -392,6 +607,9 @@ Status GroupByNode::InputFinished(ExecNode* input, int total_batches) {
   DCHECK_EQ(input, inputs_[0]);
 
   if (input_counter_.SetTotal(total_batches)) {
+    if (partitioned()) {
+      return MaybeOutputPartitions(/*input_finished=*/true);
+    }
     RETURN_NOT_OK(OutputResult(/*is_last=*/true));
   }
   return Status::OK();
@@ -70,18 +70,21 @@ using internal::checked_cast;
 using internal::checked_pointer_cast;
 using internal::ToChars;
 
+using compute::ApproximateCountDistinctOptions;
 using compute::CallFunction;
 using compute::CountOptions;
 using compute::default_exec_context;
 using compute::ExecSpan;
 using compute::FunctionOptions;
 using compute::Grouper;
+using compute::PivotWiderOptions;
 using compute::RowSegmenter;
 using compute::ScalarAggregateOptions;
 using compute::Segment;
 using compute::SortIndices;
 using compute::SortKey;
 using compute::SortOrder;
+using compute::QuantileOptions;
 using compute::Take;
 using compute::TDigestOptions;
 using compute::VarianceOptions;
@@ -726,6 +729,24 @@ TEST(RowSegmenter, MultipleSegments) {
                 {9, 0, true, true}});
 }
 
+TEST(RowSegmenter, NullableAndVarLengthKeys) {
+  std::vector<TypeHolder> types = {utf8(), int32()};
+  auto batch1 = ExecBatchFromJSON(types, R"([["a", 1], ["a", 1], ["a", null], ["a", null],
+                                             ["b", null], [null, null], [null, null]])");
+  auto batch2 = ExecBatchFromJSON(types, R"([[null, null], ["c", 2]])");
+  for (auto make_segmenter : {MakeRowSegmenter, MakeGenericSegmenter}) {
+    ASSERT_OK_AND_ASSIGN(auto segmenter, make_segmenter(types));
+    TestSegments(segmenter, ExecSpan(batch1),
+                 {{0, 2, false, true},
+                  {2, 2, false, false},
+                  {4, 1, false, false},
+                  {5, 2, true, false},
+                  {7, 0, true, true}});
+    TestSegments(segmenter, ExecSpan(batch2),
+                 {{0, 1, false, true}, {1, 1, true, false}, {2, 0, true, true}});
+  }
+}
+
 namespace {
 
 void TestRowSegmenterConstantBatch(
@@ -1094,6 +1115,15 @@ TEST(Grouper, StringInt64Key) {
                   "[0, 4, 4, 2, 5, 2, 0, 6]");
 }
 
+TEST(Grouper, EmptyStringKey) {
+  // No offsets are decoded without groups, the first one must still be zero
+  TestGrouper g({utf8(), int64()});
+  g.ExpectUniques("[]");
+
+  g.ExpectConsume("[]", "[]");
+  g.ExpectUniques("[]");
+}
+
 TEST(Grouper, DoubleStringInt64Key) {
   TestGrouper g({float64(), utf8(), int64()});
 
@@ -1129,6 +1159,17 @@ TEST(Grouper, RandomStringInt64Keys) {
   }
 }
 
+TEST(Grouper, RandomLargeStringInt64Keys) {
+  TestGrouper g({large_utf8(), int64()});
+  for (int i = 0; i < 4; ++i) {
+    SCOPED_TRACE(ToChars(i) + "th key batch");
+
+    ExecBatch key_batch{
+        *random::GenerateBatch(g.key_schema_->fields(), 1 << 12, 0xDEADBEEF)};
+    g.ConsumeAndValidate(key_batch);
+  }
+}
+
 TEST(Grouper, RandomStringInt64DoubleInt32Keys) {
   TestGrouper g({utf8(), int64(), float64(), int32()});
   for (int i = 0; i < 4; ++i) {
@@ -2088,6 +2129,191 @@ TEST_P(GroupBy, ApproximateMedian) {
   }
 }
 
+TEST_P(GroupBy, Quantile) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument", float64()), field("key", int64())}), R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3],
+    [1,    4],
+    [4,    null],
+    [3,    1],
+    [0,    2],
+    [-1,   2],
+    [1,    null],
+    [NaN,  3],
+    [1,    4],
+    [1,    4],
+    [null, 4]
+  ])");
+
+  auto several = std::make_shared<QuantileOptions>(std::vector<double>{0.25, 0.5, 0.99});
+  auto lower = std::make_shared<QuantileOptions>(/*q=*/0.5, QuantileOptions::LOWER);
+  auto higher = std::make_shared<QuantileOptions>(/*q=*/0.5, QuantileOptions::HIGHER);
+  auto keep_nulls = std::make_shared<QuantileOptions>(
+      /*q=*/0.5, QuantileOptions::LINEAR, /*skip_nulls=*/false, /*min_count=*/0);
+  auto min_count = std::make_shared<QuantileOptions>(
+      /*q=*/0.5, QuantileOptions::LINEAR, /*skip_nulls=*/true, /*min_count=*/3);
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       GroupByTest(
+                           {
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                               batch->GetColumnByName("argument"),
+                           },
+                           {
+                               batch->GetColumnByName("key"),
+                           },
+                           {},
+                           {
+                               {"hash_quantile", nullptr},
+                               {"hash_quantile", several},
+                               {"hash_quantile", lower},
+                               {"hash_quantile", higher},
+                               {"hash_quantile", keep_nulls},
+                               {"hash_quantile", min_count},
+                           },
+                           false));
+
+  AssertDatumsApproxEqual(
+      ArrayFromJSON(struct_({
+                        field("key_0", int64()),
+                        field("hash_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_quantile", fixed_size_list(float64(), 3)),
+                        field("hash_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_quantile", fixed_size_list(float64(), 1)),
+                        field("hash_quantile", fixed_size_list(float64(), 1)),
+                    }),
+                    R"([
+    [1,    [2.0],  [1.5, 2.0, 2.98],   [1.0],  [3.0],  [null], [null]],
+    [2,    [0.0],  [-0.5, 0.0, 0.0],   [0.0],  [0.0],  [0.0],  [0.0] ],
+    [3,    [null], [null, null, null], [null], [null], [null], [null]],
+    [4,    [1.0],  [1.0, 1.0, 1.0],    [1.0],  [1.0],  [null], [1.0] ],
+    [null, [2.5],  [1.75, 2.5, 3.97],  [1.0],  [4.0],  [2.5],  [null]]
+  ])"),
+      aggregated_and_grouped,
+      /*verbose=*/true);
+}
+
+TEST_P(GroupBy, QuantileDataPointType) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("argument0", int32()), field("argument1", decimal128(3, 2)),
+              field("key", int64())}),
+      R"([
+    [1,    "1.01",  1],
+    [null, null,    1],
+    [0,    "0.00",  2],
+    [4,    "4.42",  null],
+    [3,    "3.86",  1],
+    [0,    "0.00",  2],
+    [-1,   "-1.93", 2],
+    [1,    "1.85",  null]
+  ])");
+
+  auto lower = std::make_shared<QuantileOptions>(std::vector<double>{0.5, 1.0},
+                                                 QuantileOptions::LOWER);
+  ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                       GroupByTest(
+                           {
+                               batch->GetColumnByName("argument0"),
+                               batch->GetColumnByName("argument1"),
+                               batch->GetColumnByName("argument1"),
+                           },
+                           {batch->GetColumnByName("key")},
+                           {
+                               {"hash_quantile", lower},
+                               {"hash_quantile", lower},
+                               {"hash_quantile", nullptr},
+                           },
+                           false));
+
+  AssertDatumsApproxEqual(
+      ArrayFromJSON(struct_({
+                        field("key_0", int64()),
+                        field("hash_quantile", fixed_size_list(int32(), 2)),
+                        field("hash_quantile", fixed_size_list(decimal128(3, 2), 2)),
+                        field("hash_quantile", fixed_size_list(float64(), 1)),
+                    }),
+                    R"([
+    [1,    [1, 3],  ["1.01", "3.86"],  [2.435]],
+    [2,    [0, 0],  ["0.00", "0.00"],  [0.0]  ],
+    [null, [1, 4],  ["1.85", "4.42"],  [3.135]]
+  ])"),
+      aggregated_and_grouped,
+      /*verbose=*/true);
+}
+
+TEST_P(GroupBy, Median) {
+  for (const auto& type : {float64(), int8()}) {
+    auto batch =
+        RecordBatchFromJSON(schema({field("argument", type), field("key", int64())}), R"([
+    [1,    1],
+    [null, 1],
+    [0,    2],
+    [null, 3],
+    [1,    4],
+    [4,    null],
+    [3,    1],
+    [0,    2],
+    [-1,   2],
+    [1,    null],
+    [null, 3],
+    [1,    4],
+    [1,    4],
+    [null, 4]
+  ])");
+
+    std::shared_ptr<ScalarAggregateOptions> options;
+    auto keep_nulls = std::make_shared<ScalarAggregateOptions>(
+        /*skip_nulls=*/false, /*min_count=*/0);
+    auto min_count = std::make_shared<ScalarAggregateOptions>(
+        /*skip_nulls=*/true, /*min_count=*/3);
+    auto keep_nulls_min_count = std::make_shared<ScalarAggregateOptions>(
+        /*skip_nulls=*/false, /*min_count=*/3);
+    ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                         GroupByTest(
+                             {
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                                 batch->GetColumnByName("argument"),
+                             },
+                             {
+                                 batch->GetColumnByName("key"),
+                             },
+                             {},
+                             {
+                                 {"hash_median", options},
+                                 {"hash_median", keep_nulls},
+                                 {"hash_median", min_count},
+                                 {"hash_median", keep_nulls_min_count},
+                             },
+                             false));
+
+    AssertDatumsApproxEqual(ArrayFromJSON(struct_({
+                                              field("key_0", int64()),
+                                              field("hash_median", float64()),
+                                              field("hash_median", float64()),
+                                              field("hash_median", float64()),
+                                              field("hash_median", float64()),
+                                          }),
+                                          R"([
+    [1,    2.0,  null, null, null],
+    [2,    0.0,  0.0,  0.0,  0.0 ],
+    [3,    null, null, null, null],
+    [4,    1.0,  null, 1.0,  null],
+    [null, 2.5,  2.5,  null, null]
+  ])"),
+                            aggregated_and_grouped,
+                            /*verbose=*/true);
+  }
+}
+
 TEST_P(GroupBy, StddevVarianceTDigestScalar) {
   BatchesWithSchema input;
   input.batches = {
@@ -2963,6 +3189,77 @@ TEST_P(GroupBy, CountDistinct) {
   }
 }
 
+TEST_P(GroupBy, ApproximateCountDistinct) {
+  auto precision_8 = std::make_shared<ApproximateCountDistinctOptions>(8);
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+
+    auto table =
+        TableFromJSON(schema({field("argument", utf8()), field("key", int64())}), {R"([
+    ["foo",  1],
+    ["foo",  1]
+])",
+                                                                                   R"([
+    ["bar",  2],
+    [null,   3],
+    [null,   3]
+])",
+                                                                                   R"([
+    [null, 4],
+    [null, 4]
+])",
+                                                                                   R"([
+    ["baz",  null],
+    ["foo",  3]
+])",
+                                                                                   R"([
+    ["bar",  2],
+    ["spam", 2]
+])",
+                                                                                   R"([
+    ["eggs", null],
+    ["ham",  3]
+  ])"});
+
+    ASSERT_OK_AND_ASSIGN(
+        Datum aggregated_and_grouped,
+        AltGroupBy(
+            {
+                table->GetColumnByName("argument"),
+                table->GetColumnByName("argument"),
+            },
+            {
+                table->GetColumnByName("key"),
+            },
+            {},
+            {
+                {"hash_approximate_count_distinct", nullptr, "agg_0",
+                 "hash_approximate_count_distinct"},
+                {"hash_approximate_count_distinct", precision_8, "agg_1",
+                 "hash_approximate_count_distinct"},
+            },
+            use_threads));
+    SortBy({"key_0"}, &aggregated_and_grouped);
+    ValidateOutput(aggregated_and_grouped);
+
+    // Small numbers of distinct values are counted exactly
+    AssertDatumsEqual(ArrayFromJSON(struct_({
+                                        field("key_0", int64()),
+                                        field("hash_approximate_count_distinct", int64()),
+                                        field("hash_approximate_count_distinct", int64()),
+                                    }),
+                                    R"([
+    [1,    1, 1],
+    [2,    2, 2],
+    [3,    2, 2],
+    [4,    0, 0],
+    [null, 2, 2]
+  ])"),
+                      aggregated_and_grouped,
+                      /*verbose=*/true);
+  }
+}
+
 TEST_P(GroupBy, Distinct) {
   auto all = std::make_shared<CountOptions>(CountOptions::ALL);
   auto only_valid = std::make_shared<CountOptions>(CountOptions::ONLY_VALID);
@@ -3670,6 +3967,73 @@ TEST_P(GroupBy, ListBinaryTypes) {
   }
 }
 
+TEST_P(GroupBy, ListBinaryManyGroups) {
+  constexpr int kNumRows = 1000;
+  constexpr int kNumGroups = 97;
+  // Each chunk spreads its three-character values over all groups, every 13th value
+  // being null
+  auto value_of = [](int i) {
+    std::string value = std::to_string(i);
+    return std::string(3 - value.size(), '0') + value;
+  };
+  std::vector<std::string> json_chunks;
+  std::vector<std::vector<std::string>> expected_values(kNumGroups);
+  std::vector<int> expected_nulls(kNumGroups);
+  for (int chunk_start = 0; chunk_start < kNumRows; chunk_start += 100) {
+    std::string json = "[";
+    for (int i = chunk_start; i < chunk_start + 100; ++i) {
+      if (i > chunk_start) json += ",";
+      const int group = i % kNumGroups;
+      if (i % 13 == 0) {
+        json += "[null, " + std::to_string(group) + "]";
+        ++expected_nulls[group];
+      } else {
+        json += "[\"" + value_of(i) + "\", " + std::to_string(group) + "]";
+        expected_values[group].push_back(value_of(i));
+      }
+    }
+    json_chunks.push_back(json + "]");
+  }
+  std::vector<std::string> expected_json(kNumGroups);
+  for (int group = 0; group < kNumGroups; ++group) {
+    std::vector<std::string>& values = expected_values[group];
+    std::sort(values.begin(), values.end());
+    std::string json = "[";
+    for (const auto& value : values) json += "\"" + value + "\",";
+    for (int i = 0; i < expected_nulls[group]; ++i) json += "null,";
+    if (json.size() > 1) json.pop_back();
+    expected_json[group] = json + "]";
+  }
+
+  for (bool use_threads : {true, false}) {
+    for (const auto& type : {utf8(), large_binary(), fixed_size_binary(3)}) {
+      SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+      SCOPED_TRACE(type->ToString());
+      const auto table = TableFromJSON(
+          schema({field("argument0", type), field("key", int64())}), json_chunks);
+
+      ASSERT_OK_AND_ASSIGN(Datum aggregated_and_grouped,
+                           AltGroupBy({table->GetColumnByName("argument0")},
+                                      {table->GetColumnByName("key")}, {},
+                                      {{"hash_list", nullptr, "agg_0", "hash_list"}},
+                                      use_threads));
+      ValidateOutput(aggregated_and_grouped);
+      SortBy({"key_0"}, &aggregated_and_grouped);
+
+      const auto& struct_arr = aggregated_and_grouped.array_as<StructArray>();
+      auto list_arr = checked_pointer_cast<ListArray>(struct_arr->field(1));
+      ASSERT_EQ(kNumGroups, list_arr->length());
+      for (int group = 0; group < kNumGroups; ++group) {
+        auto slice = list_arr->value_slice(group);
+        ASSERT_OK_AND_ASSIGN(auto indices, SortIndices(*slice));
+        ASSERT_OK_AND_ASSIGN(Datum sorted, Take(*slice, *indices));
+        AssertDatumsEqual(ArrayFromJSON(type, expected_json[group]), sorted,
+                          /*verbose=*/true);
+      }
+    }
+  }
+}
+
 TEST_P(GroupBy, ListMiscTypes) {
   auto in_schema = schema({
       field("floats", float64()),
@@ -3827,6 +4191,96 @@ TEST_P(GroupBy, ListMiscTypes) {
   }
 }
 
+TEST_P(GroupBy, PivotWider) {
+  for (const auto& key_type : BaseBinaryTypes()) {
+    SCOPED_TRACE(key_type->ToString());
+    BatchesWithSchema input;
+    input.batches = {
+        ExecBatchFromJSON({int64(), key_type, float64()}, R"([
+    [1, "width",  10.5],
+    [2, "width",  11.5]
+])"),
+        ExecBatchFromJSON({int64(), key_type, float64()}, R"([
+    [2, "height", 12.5],
+    [3, "width",  13.5],
+    [1, "height", 14.5],
+    [3, "depth",  15.5],
+    [3, null,     16.5],
+    [1, "width",  null],
+    [4, "depth",  17.5]
+])")};
+    input.schema = schema({field("key", int64()), field("pivot_key", key_type),
+                           field("pivot_value", float64())});
+    auto options = std::make_shared<PivotWiderOptions>(
+        std::vector<std::string>{"height", "width"});
+
+    for (bool use_threads : {true, false}) {
+      SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+      ASSERT_OK_AND_ASSIGN(
+          Datum actual,
+          RunGroupBy(input, {"key"},
+                     {{"hash_pivot_wider", options,
+                       std::vector<FieldRef>{"pivot_key", "pivot_value"}, "pivoted"}},
+                     use_threads));
+      ValidateOutput(actual);
+      SortBy({"key"}, &actual);
+
+      const auto& struct_arr = actual.array_as<StructArray>();
+      AssertDatumsEqual(ArrayFromJSON(int64(), "[1, 2, 3, 4]"), struct_arr->field(0));
+      AssertDatumsEqual(
+          ArrayFromJSON(struct_({field("height", float64()), field("width", float64())}),
+                        R"([
+    {"height": 14.5, "width": 10.5},
+    {"height": 12.5, "width": 11.5},
+    {"height": null, "width": 13.5},
+    {"height": null, "width": null}
+  ])"),
+          struct_arr->field(1), /*verbose=*/true);
+    }
+  }
+}
+
+TEST_P(GroupBy, PivotWiderErrors) {
+  BatchesWithSchema input;
+  input.batches = {ExecBatchFromJSON({int64(), utf8(), int32()}, R"([
+    [1, "width",  10],
+    [2, "height", 11]
+])"),
+                   ExecBatchFromJSON({int64(), utf8(), int32()}, R"([
+    [1, "depth", 12],
+    [2, "width", 13],
+    [1, "width", 14]
+])")};
+  input.schema = schema({field("key", int64()), field("pivot_key", utf8()),
+                         field("pivot_value", int32())});
+  auto run = [&](std::shared_ptr<PivotWiderOptions> options, bool use_threads) {
+    return RunGroupBy(input, {"key"},
+                      {{"hash_pivot_wider", std::move(options),
+                        std::vector<FieldRef>{"pivot_key", "pivot_value"}, "pivoted"}},
+                      use_threads);
+  };
+
+  for (bool use_threads : {true, false}) {
+    SCOPED_TRACE(use_threads ? "parallel/merged" : "serial");
+    // Two values for "width" in group 1
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, HasSubstr("more than one non-null value for pivot key 'width'"),
+        run(std::make_shared<PivotWiderOptions>(
+                std::vector<std::string>{"height", "width"}),
+            use_threads));
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        KeyError, HasSubstr("Unexpected pivot key: "),
+        run(std::make_shared<PivotWiderOptions>(std::vector<std::string>{"height"},
+                                                PivotWiderOptions::RAISE),
+            use_threads));
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        KeyError, HasSubstr("Duplicate pivot key name 'height'"),
+        run(std::make_shared<PivotWiderOptions>(
+                std::vector<std::string>{"height", "height"}),
+            use_threads));
+  }
+}
+
 TEST_P(GroupBy, CountAndSum) {
   auto batch = RecordBatchFromJSON(
       schema({field("argument", float64()), field("key", int64())}), R"([
@@ -74,6 +74,13 @@ class HashJoinBasicImpl : public HashJoinImpl {
     }
 
     dict_probe_.Init(num_threads_);
+    probe_has_dictionaries_ = false;
+    for (int icol = 0; icol < schema_[0]->num_cols(HashJoinProjection::INPUT); ++icol) {
+      if (schema_[0]->data_type(HashJoinProjection::INPUT, icol)->id() ==
+          Type::DICTIONARY) {
+        probe_has_dictionaries_ = true;
+      }
+    }
 
     has_hash_table_ = false;
     num_batches_produced_.store(0);
@@ -494,7 +501,13 @@ class HashJoinBasicImpl : public HashJoinImpl {
     ThreadLocalState& local_state = local_states_[thread_index];
     RETURN_NOT_OK(InitLocalStateIfNeeded(thread_index));
 
-    local_state.exec_batch_keys.Clear();
+    // Probe batches may each reference their own dictionaries, while dictionary
+    // encoders stick to the first one they see, so they are reinitialized then
+    if (probe_has_dictionaries_) {
+      InitEncoder(0, HashJoinProjection::KEY, &local_state.exec_batch_keys);
+    } else {
+      local_state.exec_batch_keys.Clear();
+    }
 
     ExecBatch batch_key_for_lookups;
 
@@ -502,7 +515,11 @@ class HashJoinBasicImpl : public HashJoinImpl {
                               batch, &batch_key_for_lookups));
     bool has_left_payload = (schema_[0]->num_cols(HashJoinProjection::PAYLOAD) > 0);
     if (has_left_payload) {
-      local_state.exec_batch_payloads.Clear();
+      if (probe_has_dictionaries_) {
+        InitEncoder(0, HashJoinProjection::PAYLOAD, &local_state.exec_batch_payloads);
+      } else {
+        local_state.exec_batch_payloads.Clear();
+      }
       RETURN_NOT_OK(EncodeBatch(0, HashJoinProjection::PAYLOAD,
                                 &local_state.exec_batch_payloads, batch));
     }
@@ -563,6 +580,8 @@ class HashJoinBasicImpl : public HashJoinImpl {
 
   Status BuildHashTable_exec_task(size_t thread_index, int64_t /*task_id*/) {
     AccumulationQueue batches = std::move(build_batches_);
+    // Have each dictionary column reference a single dictionary in the hash table
+    RETURN_NOT_OK(HashJoinDictUtil::UnifyDictionaries(&batches, ctx_->exec_context()));
     dict_build_.InitEncoder(*schema_[1], &hash_table_keys_, ctx_->exec_context());
     bool has_payload = (schema_[1]->num_cols(HashJoinProjection::PAYLOAD) > 0);
     if (has_payload) {
@@ -780,6 +799,7 @@ class HashJoinBasicImpl : public HashJoinImpl {
   //
   HashJoinDictBuildMulti dict_build_;
   HashJoinDictProbeMulti dict_probe_;
+  bool probe_has_dictionaries_;
 
   bool has_hash_table_;
 
@@ -17,6 +17,7 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/acero/bloom_filter.h"
 #include "arrow/acero/hash_join.h"
 #include "arrow/acero/hash_join_node.h"
 #include "arrow/acero/options.h"
@@ -25,11 +26,14 @@
 #include "arrow/api.h"
 #include "arrow/compute/kernels/row_encoder_internal.h"
 #include "arrow/testing/random.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/thread_pool.h"
 
 #include <cstdint>
 #include <cstdio>
 #include <memory>
+#include <random>
+#include <vector>
 
 #include <omp.h>
 
@@ -246,6 +250,44 @@ static void BM_HashJoinBasic_ProbeParallelism(benchmark::State& st) {
   HashJoinBasicBenchmarkImpl(st, settings);
 }
 
+// Probe a bloom filter built from the given number of hashes, with the instruction
+// set given by the hardware flags
+static void BM_BloomFilterFind(benchmark::State& st) {
+  const int64_t hardware_flags = st.range(0);
+  if (!arrow::internal::CpuInfo::GetInstance()->IsSupported(hardware_flags)) {
+    st.SkipWithError("Instruction set not supported by this CPU");
+    return;
+  }
+  const int64_t num_build = st.range(1) * 1024;
+  constexpr int64_t kNumProbe = 1 << 20;
+  constexpr int64_t kBatchSize = 1024;
+
+  std::mt19937_64 rng(42);
+  std::vector<uint64_t> build_hashes(num_build);
+  for (uint64_t& hash : build_hashes) hash = rng();
+  // Half of the probed hashes are present in the filter
+  std::vector<uint64_t> probe_hashes(kNumProbe);
+  for (int64_t i = 0; i < kNumProbe; ++i) {
+    probe_hashes[i] = (i % 2 == 0) ? build_hashes[rng() % num_build] : rng();
+  }
+
+  BlockedBloomFilter bloom;
+  auto builder = BloomFilterBuilder::Make(BloomFilterBuildStrategy::SINGLE_THREADED);
+  DCHECK_OK(builder->Begin(/*num_threads=*/1, hardware_flags, default_memory_pool(),
+                           num_build, /*num_batches=*/1, &bloom));
+  DCHECK_OK(builder->PushNextBatch(/*thread_index=*/0, num_build, build_hashes.data()));
+
+  std::vector<uint8_t> result_bit_vector(kBatchSize / 8);
+  for (auto _ : st) {
+    for (int64_t i = 0; i < kNumProbe; i += kBatchSize) {
+      bloom.Find(hardware_flags, kBatchSize, probe_hashes.data() + i,
+                 result_bit_vector.data());
+    }
+    benchmark::DoNotOptimize(result_bit_vector.data());
+  }
+  st.SetItemsProcessed(st.iterations() * kNumProbe);
+}
+
 #ifdef ARROW_BUILD_DETAILED_BENCHMARKS  // Necessary to suppress warnings
 template <typename... Args>
 static void BM_HashJoinBasic_Selectivity(benchmark::State& st,
@@ -640,5 +682,10 @@ BENCHMARK(BM_HashJoinBasic_ProbeParallelism)
 
 #endif  // ARROW_BUILD_DETAILED_BENCHMARKS
 
+BENCHMARK(BM_BloomFilterFind)
+    ->ArgNames({"HardwareFlags", "Build krows"})
+    ->ArgsProduct({{0, arrow::internal::CpuInfo::AVX2, arrow::internal::CpuInfo::AVX512},
+                   {64, 1024, 16384}});
+
 }  // namespace acero
 }  // namespace arrow
@@ -19,7 +19,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <vector>
 
@@ -212,6 +214,126 @@ std::shared_ptr<Array> HashJoinDictUtil::ExtractDictionary(const Datum& data) {
                          : data.scalar_as<DictionaryScalar>().value.dictionary;
 }
 
+Status HashJoinDictUtil::UnifyDictionaries(util::AccumulationQueue* batches,
+                                           ExecContext* ctx) {
+  std::vector<ExecBatch*> non_empty_batches;
+  for (size_t ibatch = 0; ibatch < batches->batch_count(); ++ibatch) {
+    if ((*batches)[ibatch].length > 0) {
+      non_empty_batches.push_back(&(*batches)[ibatch]);
+    }
+  }
+  if (non_empty_batches.size() <= 1) {
+    return Status::OK();
+  }
+
+  const size_t num_cols = non_empty_batches[0]->values.size();
+  for (size_t icol = 0; icol < num_cols; ++icol) {
+    // A copy, since the columns are replaced below
+    const std::shared_ptr<DataType> data_type = non_empty_batches[0]->values[icol].type();
+    if (data_type->id() != Type::DICTIONARY) {
+      continue;
+    }
+    const auto& dict_type = checked_cast<const DictionaryType&>(*data_type);
+
+    std::vector<std::shared_ptr<Array>> dictionaries(non_empty_batches.size());
+    bool all_equal = true;
+    for (size_t ibatch = 0; ibatch < non_empty_batches.size(); ++ibatch) {
+      dictionaries[ibatch] = ExtractDictionary(non_empty_batches[ibatch]->values[icol]);
+      all_equal = all_equal && dictionaries[ibatch]->Equals(dictionaries[0]);
+    }
+    if (all_equal) {
+      continue;
+    }
+
+    // Encode the values of each distinct dictionary and assign ids to them in order of
+    // first appearance, computing for each dictionary the mapping of its ids
+    //
+    RowEncoder encoder;
+    std::vector<TypeHolder> encoder_types = {dict_type.value_type()};
+    encoder.Init(encoder_types, ctx);
+    std::unordered_map<std::string, int32_t> value_ids;
+    std::vector<int32_t> entries_to_take;
+    std::vector<std::shared_ptr<ArrayData>> id_maps(non_empty_batches.size());
+    for (size_t ibatch = 0; ibatch < non_empty_batches.size(); ++ibatch) {
+      const std::shared_ptr<Array>& dictionary = dictionaries[ibatch];
+      if (ibatch > 0 && dictionary->Equals(dictionaries[ibatch - 1])) {
+        id_maps[ibatch] = id_maps[ibatch - 1];
+        continue;
+      }
+
+      int64_t length = dictionary->length();
+      if (encoder.num_rows() + length >= std::numeric_limits<int32_t>::max()) {
+        return Status::Invalid(
+            "Dictionary length in hash join must fit into signed 32-bit integer.");
+      }
+      int32_t first_row = encoder.num_rows();
+      RETURN_NOT_OK(encoder.EncodeAndAppend(ExecSpan({*dictionary->data()}, length)));
+
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> non_nulls_buf,
+                            AllocateBitmap(length, ctx->memory_pool()));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> ids_buf,
+                            AllocateBuffer(length * sizeof(int32_t), ctx->memory_pool()));
+      uint8_t* non_nulls = non_nulls_buf->mutable_data();
+      int32_t* ids = reinterpret_cast<int32_t*>(ids_buf->mutable_data());
+      memset(non_nulls, 0xff, bit_util::BytesForBits(length));
+
+      for (int64_t i = 0; i < length; ++i) {
+        int32_t row = first_row + static_cast<int32_t>(i);
+        std::string str = encoder.encoded_row(row);
+        // Null entries are not part of the unified dictionary, indices pointing to them
+        // become null.
+        if (KeyEncoder::IsNull(reinterpret_cast<const uint8_t*>(str.data()))) {
+          ids[i] = kNullId;
+          bit_util::ClearBit(non_nulls, i);
+          continue;
+        }
+        auto iter = value_ids.find(str);
+        if (iter == value_ids.end()) {
+          ids[i] = static_cast<int32_t>(entries_to_take.size());
+          value_ids.insert(std::make_pair(std::move(str), ids[i]));
+          entries_to_take.push_back(row);
+        } else {
+          ids[i] = iter->second;
+        }
+      }
+      id_maps[ibatch] = ArrayData::Make(int32(), length,
+                                        {std::move(non_nulls_buf), std::move(ids_buf)});
+    }
+
+    const int32_t num_entries = static_cast<int32_t>(entries_to_take.size());
+    const int index_bit_width = dict_type.index_type()->bit_width();
+    if (index_bit_width < 32) {
+      const int64_t max_index = is_signed_integer(dict_type.index_type()->id())
+                                    ? (int64_t{1} << (index_bit_width - 1)) - 1
+                                    : (int64_t{1} << index_bit_width) - 1;
+      if (num_entries - 1 > max_index) {
+        return Status::Invalid("Unified dictionary of ", num_entries,
+                               " entries does not fit dictionary index type ",
+                               dict_type.index_type()->ToString(), " in hash join");
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch unified,
+                          encoder.Decode(num_entries, entries_to_take.data()));
+    std::shared_ptr<ArrayData> unified_dictionary = unified.values[0].array();
+
+    // Transpose indices of each batch
+    //
+    for (size_t ibatch = 0; ibatch < non_empty_batches.size(); ++ibatch) {
+      Datum& value = non_empty_batches[ibatch]->values[icol];
+      const int64_t batch_length = non_empty_batches[ibatch]->length;
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<ArrayData> ids,
+          IndexRemapUsingLUT(ctx, value, batch_length, id_maps[ibatch], data_type));
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<ArrayData> indices,
+          ConvertFromInt32(dict_type.index_type(), Datum(ids), batch_length, ctx));
+      value = ArrayData::Make(data_type, batch_length, indices->buffers, {},
+                              unified_dictionary);
+    }
+  }
+  return Status::OK();
+}
+
 Status HashJoinDictBuild::Init(ExecContext* ctx, std::shared_ptr<Array> dictionary,
                                std::shared_ptr<DataType> index_type,
                                std::shared_ptr<DataType> value_type) {
@@ -410,16 +532,12 @@ Result<std::shared_ptr<ArrayData>> HashJoinDictProbe::RemapInput(
     auto dict = HashJoinDictUtil::ExtractDictionary(data);
     const auto& dict_type = checked_cast<const DictionaryType&>(*probe_data_type);
 
-    // Verify that the dictionary is always the same.
-    if (dictionary_) {
-      if (!dictionary_->Equals(dict)) {
-        return Status::NotImplemented(
-            "Unifying differing dictionaries for probe key of hash join");
-      }
-    } else {
+    // Precompute helper data for the given dictionary if this is the first call or if
+    // the dictionary differs from the one of the previous batch. This is done once per
+    // dictionary rather than for every row.
+    if (!dictionary_ || !dictionary_->Equals(dict)) {
       dictionary_ = dict;
 
-      // Precompute helper data for the given dictionary if this is the first call.
       if (r_is_dict) {
         ARROW_DCHECK(opt_build_side);
         ARROW_ASSIGN_OR_RAISE(
@@ -428,6 +546,7 @@ Result<std::shared_ptr<ArrayData>> HashJoinDictProbe::RemapInput(
       } else {
         std::vector<TypeHolder> encoder_types = {dict_type.value_type()};
         encoder_.Init(encoder_types, ctx);
+        encoder_.Clear();
         RETURN_NOT_OK(
             encoder_.EncodeAndAppend(ExecSpan({*dict->data()}, dict->length())));
       }
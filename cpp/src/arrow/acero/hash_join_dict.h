@@ -20,6 +20,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include "arrow/acero/accumulation_queue.h"
 #include "arrow/acero/schema_util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/kernels/row_encoder_internal.h"
@@ -38,8 +39,12 @@
 // - dictionary column can be matched against dictionary column with a different index
 // type, and potentially using a different dictionary, if underlying value types are equal
 //
-// We currently require in hash join that for all dictionary encoded columns, the same
-// dictionary is used in all input exec batches.
+// Exec batches may reference different dictionaries. On build side, dictionary columns
+// are transposed to the union of their dictionaries before building the hash table, so
+// that a single dictionary is used for each of them. On probe side, the mapping to the
+// unified representation is recomputed whenever a batch references a new dictionary,
+// which costs one lookup per dictionary entry, and dictionary columns are output with
+// the dictionaries of their input batches.
 //
 // In order to allow matching columns with different dictionaries, different dictionary
 // index types, and dictionary key against non-dictionary key, internally comparisons will
@@ -107,6 +112,13 @@ class HashJoinDictUtil {
 
   // Return dictionary referenced in either dictionary array or dictionary scalar
   static std::shared_ptr<Array> ExtractDictionary(const Datum& data);
+
+  // Make each dictionary column of the given batches reference a single dictionary.
+  // If the batches reference differing dictionaries, their values are unified (null
+  // entries excluded) and indices are transposed to the unified dictionary, keeping
+  // the original index type. Empty batches are left unchanged.
+  //
+  static Status UnifyDictionaries(util::AccumulationQueue* batches, ExecContext* ctx);
 };
 
 /// Implements processing of dictionary arrays/scalars in key columns on the build side of
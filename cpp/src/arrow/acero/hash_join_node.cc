@@ -25,10 +25,13 @@
 #include "arrow/acero/hash_join_dict.h"
 #include "arrow/acero/hash_join_node.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/schema_util.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/key_hash_internal.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/counters.h"
 #include "arrow/util/future.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/tracing_internal.h"
@@ -38,7 +41,6 @@ namespace arrow {
 using internal::checked_cast;
 
 using compute::field_ref;
-using compute::FilterOptions;
 using compute::Hashing32;
 using compute::KeyColumnArray;
 
@@ -478,6 +480,11 @@ Status ValidateHashJoinNodeOptions(const HashJoinNodeOptions& join_options) {
     return Status::Invalid("key_cmp and keys must have the same size");
   }
 
+  if (join_options.spill_threshold_bytes >= 0 && join_options.num_spill_partitions < 1) {
+    return Status::Invalid(
+        "num_spill_partitions must be positive when spilling is enabled");
+  }
+
   return Status::OK();
 }
 
@@ -490,6 +497,10 @@ class HashJoinNode;
 // pushdown target. Once a join has received all of its Bloom filters, it will evaluate it
 // on every batch that has been queued so far as well as any new probe-side batch that
 // comes in.
+//
+// The Bloom filter is also offered as a RuntimeFilter to the input of the pushdown
+// target, so that nodes further up the probe side (e.g. a filter or a scan) can drop
+// rows that cannot match before they are queued by the target.
 struct BloomFilterPushdownContext {
   using RegisterTaskGroupCallback = std::function<int(
       std::function<Status(size_t, int64_t)>, std::function<Status(size_t)>)>;
@@ -505,7 +516,12 @@ struct BloomFilterPushdownContext {
 
   Status StartProducing(size_t thread_index);
 
-  void ExpectBloomFilter() { eval_.num_expected_bloom_filters_ += 1; }
+  // Registers a Bloom filter which will be evaluated on the given input columns.
+  void ExpectBloomFilter(std::shared_ptr<RuntimeFilter> filter,
+                         std::vector<int> column_map) {
+    eval_.filters_.Add(std::move(filter), std::move(column_map));
+    eval_.num_expected_bloom_filters_ += 1;
+  }
 
   // Builds the Bloom filter, taking ownership of the batches until the build
   // is done.
@@ -515,19 +531,16 @@ struct BloomFilterPushdownContext {
   // Sends the Bloom filter to the pushdown target.
   Status PushBloomFilter(size_t thread_index);
 
-  // Receives a Bloom filter and its associated column map.
-  Status ReceiveBloomFilter(size_t thread_index,
-                            std::unique_ptr<BlockedBloomFilter> filter,
-                            std::vector<int> column_map) {
+  // Notifies that one of the expected Bloom filters has been published.
+  Status ReceiveBloomFilter(size_t thread_index) {
     bool proceed;
     {
       std::lock_guard<std::mutex> guard(eval_.receive_mutex_);
-      eval_.received_filters_.emplace_back(std::move(filter));
-      eval_.received_maps_.emplace_back(std::move(column_map));
-      proceed = eval_.num_expected_bloom_filters_ == eval_.received_filters_.size();
+      eval_.num_received_bloom_filters_ += 1;
+      proceed = eval_.num_expected_bloom_filters_ == eval_.num_received_bloom_filters_;
 
-      ARROW_DCHECK_EQ(eval_.received_filters_.size(), eval_.received_maps_.size());
-      ARROW_DCHECK_LE(eval_.received_filters_.size(), eval_.num_expected_bloom_filters_);
+      ARROW_DCHECK_LE(eval_.num_received_bloom_filters_,
+                      eval_.num_expected_bloom_filters_);
     }
     if (proceed) {
       return eval_.all_received_callback_(thread_index);
@@ -551,61 +564,8 @@ struct BloomFilterPushdownContext {
 
   // Applies all Bloom filters on the input batch.
   Status FilterSingleBatch(size_t thread_index, ExecBatch* batch_ptr) {
-    ExecBatch& batch = *batch_ptr;
-    if (eval_.num_expected_bloom_filters_ == 0 || batch.length == 0) return Status::OK();
-
-    int64_t bit_vector_bytes = bit_util::BytesForBits(batch.length);
-    std::vector<uint8_t> selected(bit_vector_bytes);
-    std::vector<uint32_t> hashes(batch.length);
-    std::vector<uint8_t> bv(bit_vector_bytes);
-
-    ARROW_ASSIGN_OR_RAISE(arrow::util::TempVectorStack * stack,
-                          ctx_->GetTempStack(thread_index));
-
-    // Start with full selection for the current batch
-    memset(selected.data(), 0xff, bit_vector_bytes);
-    for (size_t ifilter = 0; ifilter < eval_.num_expected_bloom_filters_; ifilter++) {
-      std::vector<Datum> keys(eval_.received_maps_[ifilter].size());
-      for (size_t i = 0; i < keys.size(); i++) {
-        int input_idx = eval_.received_maps_[ifilter][i];
-        keys[i] = batch[input_idx];
-        if (keys[i].is_scalar()) {
-          ARROW_ASSIGN_OR_RAISE(
-              keys[i],
-              MakeArrayFromScalar(*keys[i].scalar(), batch.length, ctx_->memory_pool()));
-        }
-      }
-      ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(keys)));
-      std::vector<KeyColumnArray> temp_column_arrays;
-      RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data(), temp_column_arrays,
-                                         ctx_->cpu_info()->hardware_flags(), stack, 0,
-                                         key_batch.length));
-
-      eval_.received_filters_[ifilter]->Find(ctx_->cpu_info()->hardware_flags(),
-                                             key_batch.length, hashes.data(), bv.data());
-      arrow::internal::BitmapAnd(bv.data(), 0, selected.data(), 0, key_batch.length, 0,
-                                 selected.data());
-    }
-    auto selected_buffer = std::make_unique<Buffer>(selected.data(), bit_vector_bytes);
-    ArrayData selected_arraydata(boolean(), batch.length,
-                                 {nullptr, std::move(selected_buffer)});
-    Datum selected_datum(selected_arraydata);
-    FilterOptions options;
-    size_t first_nonscalar = batch.values.size();
-    for (size_t i = 0; i < batch.values.size(); i++) {
-      if (!batch.values[i].is_scalar()) {
-        ARROW_ASSIGN_OR_RAISE(batch.values[i], Filter(batch.values[i], selected_datum,
-                                                      options, ctx_->exec_context()));
-        first_nonscalar = std::min(first_nonscalar, i);
-        ARROW_DCHECK_EQ(batch.values[i].length(), batch.values[first_nonscalar].length());
-      }
-    }
-    // If they're all Scalar, then the length of the batch is the number of set bits
-    if (first_nonscalar == batch.values.size())
-      batch.length = arrow::internal::CountSetBits(selected.data(), 0, batch.length);
-    else
-      batch.length = batch.values[first_nonscalar].length();
-    return Status::OK();
+    if (eval_.num_expected_bloom_filters_ == 0) return Status::OK();
+    return eval_.filters_.Apply(ctx_, thread_index, batch_ptr);
   }
 
  private:
@@ -639,7 +599,8 @@ struct BloomFilterPushdownContext {
   } build_;
 
   struct {
-    std::unique_ptr<BlockedBloomFilter> bloom_filter_;
+    std::shared_ptr<BlockedBloomFilter> bloom_filter_;
+    std::shared_ptr<RuntimeFilter> runtime_filter_;
     HashJoinNode* pushdown_target_;
     std::vector<int> column_map_;
   } push_;
@@ -648,8 +609,8 @@ struct BloomFilterPushdownContext {
     int task_id_;
     size_t num_expected_bloom_filters_ = 0;
     std::mutex receive_mutex_;
-    std::vector<std::unique_ptr<BlockedBloomFilter>> received_filters_;
-    std::vector<std::vector<int>> received_maps_;
+    size_t num_received_bloom_filters_ = 0;
+    RuntimeFilterSet filters_;
     AccumulationQueue batches_;
     FiltersReceivedCallback all_received_callback_;
     FilterFinishedCallback on_finished_;
@@ -688,7 +649,8 @@ class HashJoinNode : public ExecNode, public TracedNode {
   HashJoinNode(ExecPlan* plan, NodeVector inputs, const HashJoinNodeOptions& join_options,
                std::shared_ptr<Schema> output_schema,
                std::unique_ptr<HashJoinSchema> schema_mgr, Expression filter,
-               std::unique_ptr<HashJoinImpl> impl)
+               std::unique_ptr<HashJoinImpl> impl,
+               std::vector<std::unique_ptr<HashJoinImpl>> spill_impls)
       : ExecNode(plan, inputs, {"left", "right"},
                  /*output_schema=*/std::move(output_schema)),
         TracedNode(this),
@@ -699,6 +661,13 @@ class HashJoinNode : public ExecNode, public TracedNode {
         impl_(std::move(impl)),
         disable_bloom_filter_(join_options.disable_bloom_filter) {
     complete_.store(false);
+    spill_.threshold_bytes = join_options.spill_threshold_bytes;
+    spill_.num_partitions = static_cast<int>(spill_impls.size());
+    spill_.impls = std::move(spill_impls);
+    MemoryBudget* memory_budget = plan->query_context()->memory_budget();
+    build_accumulator_.set_memory_budget(memory_budget);
+    probe_accumulator_.set_memory_budget(memory_budget);
+    queued_batches_to_probe_.set_memory_budget(memory_budget);
   }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
@@ -755,20 +724,63 @@ class HashJoinNode : public ExecNode, public TracedNode {
       ARROW_ASSIGN_OR_RAISE(impl, HashJoinImpl::MakeBasic());
     }
 
+    // If the join may spill, one additional implementation object is needed per spill
+    // partition.  They have to be created (and their task groups registered) up front,
+    // even though they will only be used if the build side exceeds its memory budget.
+    std::vector<std::unique_ptr<HashJoinImpl>> spill_impls;
+    if (join_options.spill_threshold_bytes >= 0) {
+      if (!use_swiss_join) {
+        return Status::NotImplemented(
+            "Spilling is not supported for hash joins on dictionary or large binary "
+            "columns");
+      }
+      spill_impls.resize(join_options.num_spill_partitions);
+      for (auto& spill_impl : spill_impls) {
+        ARROW_ASSIGN_OR_RAISE(spill_impl, HashJoinImpl::MakeSwiss());
+      }
+    }
+
     return plan->EmplaceNode<HashJoinNode>(
         plan, inputs, join_options, std::move(output_schema), std::move(schema_mgr),
-        std::move(filter), std::move(impl));
+        std::move(filter), std::move(impl), std::move(spill_impls));
   }
 
   const char* kind_name() const override { return "HashJoinNode"; }
 
   Status OnBuildSideBatch(size_t thread_index, ExecBatch batch) {
-    std::lock_guard<std::mutex> guard(build_side_mutex_);
-    build_accumulator_.InsertBatch(std::move(batch));
+    AccumulationQueue to_spill[2];
+    {
+      std::lock_guard<std::mutex> guard(build_side_mutex_);
+      if (spill_.active.load()) {
+        to_spill[1].InsertBatch(std::move(batch));
+      } else {
+        build_bytes_ += batch.TotalBufferSize();
+        build_accumulator_.InsertBatch(std::move(batch));
+        if (!spill_.enabled() || (build_bytes_ <= spill_.threshold_bytes &&
+                                  !plan_->query_context()->memory_budget_exceeded())) {
+          return Status::OK();
+        }
+        RETURN_NOT_OK(StartSpilling(&to_spill[0], &to_spill[1]));
+      }
+    }
+    for (int side = 0; side <= 1; ++side) {
+      for (size_t i = 0; i < to_spill[side].batch_count(); ++i) {
+        RETURN_NOT_OK(SpillBatch(thread_index, side, std::move(to_spill[side][i])));
+      }
+    }
     return Status::OK();
   }
 
   Status OnBuildSideFinished(size_t thread_index) {
+    // The decision to spill is only ever made while build side batches are arriving,
+    // so it is final at this point.
+    if (spill_.active.load()) {
+      {
+        std::lock_guard<std::mutex> guard(probe_side_mutex_);
+        spill_.build_side_finished = true;
+      }
+      return MaybeStartSpilledJoin(thread_index);
+    }
     return pushdown_context_.BuildBloomFilter(
         thread_index, std::move(build_accumulator_),
         [this](size_t thread_index, AccumulationQueue batches) {
@@ -797,33 +809,46 @@ class HashJoinNode : public ExecNode, public TracedNode {
   }
 
   Status OnProbeSideBatch(size_t thread_index, ExecBatch batch) {
+    static ::arrow::util::Counter* const probe_rows =
+        ::arrow::util::GetCounter("acero.hashjoin.probe_rows");
+    probe_rows->Add(batch.length);
+
+    bool spill = false;
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
-      if (!bloom_filters_ready_) {
+      spill = spill_.active.load();
+      if (!spill && !bloom_filters_ready_) {
         probe_accumulator_.InsertBatch(std::move(batch));
         return Status::OK();
       }
     }
+    // Spilled probe side batches are filtered when they are read back
+    if (spill) return SpillBatch(thread_index, /*side=*/0, std::move(batch));
     RETURN_NOT_OK(pushdown_context_.FilterSingleBatch(thread_index, &batch));
 
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
-      if (!hash_table_ready_) {
+      spill = spill_.active.load();
+      if (!spill && !hash_table_ready_) {
         probe_accumulator_.InsertBatch(std::move(batch));
         return Status::OK();
       }
     }
+    if (spill) return SpillBatch(thread_index, /*side=*/0, std::move(batch));
     RETURN_NOT_OK(impl_->ProbeSingleBatch(thread_index, std::move(batch)));
     return Status::OK();
   }
 
   Status OnProbeSideFinished(size_t thread_index) {
     bool probing_finished;
+    bool spill;
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       probing_finished = queued_batches_probed_ && !probe_side_finished_;
       probe_side_finished_ = true;
+      spill = spill_.active.load();
     }
+    if (spill) return MaybeStartSpilledJoin(thread_index);
     if (probing_finished) return impl_->ProbingFinished(thread_index);
     return Status::OK();
   }
@@ -842,12 +867,22 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
   Status OnQueuedBatchesFiltered(size_t thread_index, AccumulationQueue batches) {
     bool should_probe;
+    bool spill;
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
-      probe_accumulator_.Concatenate(std::move(batches));
+      spill = spill_.active.load();
+      if (!spill) {
+        probe_accumulator_.Concatenate(std::move(batches));
+      }
       should_probe = !queued_batches_filtered_ && hash_table_ready_;
       queued_batches_filtered_ = true;
     }
+    if (spill) {
+      for (size_t i = 0; i < batches.batch_count(); ++i) {
+        RETURN_NOT_OK(SpillBatch(thread_index, /*side=*/0, std::move(batches[i])));
+      }
+      return MaybeStartSpilledJoin(thread_index);
+    }
     if (should_probe) {
       return ProbeQueuedBatches(thread_index);
     }
@@ -876,7 +911,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
     if (complete_.load()) {
       return Status::OK();
@@ -940,7 +975,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
           return ctx->StartTaskGroup(task_group_id, num_tasks);
         },
         [this](size_t thread_index) { return OnFiltersReceived(thread_index); },
-        disable_bloom_filter_, use_sync_execution);
+        disable_bloom_filter_ || spill_.enabled(), use_sync_execution);
 
     RETURN_NOT_OK(impl_->Init(
         ctx, join_type_, num_threads, &(schema_mgr_->proj_maps[0]),
@@ -966,9 +1001,161 @@ class HashJoinNode : public ExecNode, public TracedNode {
           return OnQueuedBatchesProbed(thread_index);
         });
 
+    if (spill_.enabled()) {
+      RETURN_NOT_OK(InitSpilling(num_threads));
+    }
+
+    return Status::OK();
+  }
+
+  Status InitSpilling(size_t num_threads) {
+    QueryContext* ctx = plan_->query_context();
+    for (int side = 0; side <= 1; ++side) {
+      SchemaProjectionMap key_to_input = schema_mgr_->proj_maps[side].map(
+          HashJoinProjection::KEY, HashJoinProjection::INPUT);
+      spill_.key_columns[side].resize(key_to_input.num_cols);
+      for (int i = 0; i < key_to_input.num_cols; ++i) {
+        spill_.key_columns[side][i] = key_to_input.get(i);
+      }
+    }
+    for (int prtn = 0; prtn < spill_.num_partitions; ++prtn) {
+      RETURN_NOT_OK(spill_.impls[prtn]->Init(
+          ctx, join_type_, num_threads, &(schema_mgr_->proj_maps[0]),
+          &(schema_mgr_->proj_maps[1]), key_cmp_, filter_,
+          [ctx](std::function<Status(size_t, int64_t)> fn,
+                std::function<Status(size_t)> on_finished) {
+            return ctx->RegisterTaskGroup(std::move(fn), std::move(on_finished));
+          },
+          [ctx](int task_group_id, int64_t num_tasks) {
+            return ctx->StartTaskGroup(task_group_id, num_tasks);
+          },
+          [this](int64_t, ExecBatch batch) { return this->OutputBatchCallback(batch); },
+          [this, prtn](int64_t num_batches) {
+            return OnSpilledPartitionFinished(prtn, num_batches);
+          }));
+      spill_.probe_task_groups.push_back(ctx->RegisterTaskGroup(
+          [this, prtn](size_t thread_index, int64_t task_id) -> Status {
+            ARROW_ASSIGN_OR_RAISE(
+                ExecBatch batch,
+                spill_.files[0][prtn]->ReadBatch(static_cast<int>(task_id)));
+            RETURN_NOT_OK(pushdown_context_.FilterSingleBatch(thread_index, &batch));
+            return spill_.impls[prtn]->ProbeSingleBatch(thread_index, std::move(batch));
+          },
+          [this, prtn](size_t thread_index) -> Status {
+            spill_.files[0][prtn].reset();
+            return spill_.impls[prtn]->ProbingFinished(thread_index);
+          }));
+    }
     return Status::OK();
   }
 
+  // Switches the join to spilling mode.  Must be called with build_side_mutex_ held.
+  // Everything accumulated so far is handed back to the caller, to be spilled.
+  Status StartSpilling(AccumulationQueue* probe_batches,
+                       AccumulationQueue* build_batches) {
+    QueryContext* ctx = plan_->query_context();
+    spill_.directory = std::make_unique<SpillDirectory>("arrow-acero-hashjoin-");
+    for (int side = 0; side <= 1; ++side) {
+      spill_.files[side].resize(spill_.num_partitions);
+      for (int prtn = 0; prtn < spill_.num_partitions; ++prtn) {
+        ARROW_ASSIGN_OR_RAISE(spill_.files[side][prtn],
+                              spill_.directory->MakeFile(inputs_[side]->output_schema(),
+                                                         ctx->memory_pool()));
+      }
+    }
+    *build_batches = std::move(build_accumulator_);
+    std::lock_guard<std::mutex> guard(probe_side_mutex_);
+    *probe_batches = std::move(probe_accumulator_);
+    spill_.active.store(true);
+    return Status::OK();
+  }
+
+  // Partitions a batch on the hash of its key columns and writes each partition to
+  // its spill file from an IO task.
+  Status SpillBatch(size_t thread_index, int side, ExecBatch batch) {
+    QueryContext* ctx = plan_->query_context();
+    ARROW_ASSIGN_OR_RAISE(
+        std::vector<ExecBatch> partitions,
+        PartitionBatchByHash(batch, spill_.key_columns[side], spill_.num_partitions, ctx,
+                             thread_index));
+    for (int prtn = 0; prtn < spill_.num_partitions; ++prtn) {
+      if (partitions[prtn].length == 0) continue;
+      auto io_mark = std::make_shared<QueryContext::TempFileIOMark>(
+          ctx, static_cast<size_t>(partitions[prtn].TotalBufferSize()));
+      SpillFile* file = spill_.files[side][prtn].get();
+      spill_.pending_writes.fetch_add(1);
+      ctx->ScheduleIOTask(
+          [this, file, io_mark, prtn_batch = std::move(partitions[prtn])]() -> Status {
+            RETURN_NOT_OK(file->Write(prtn_batch));
+            spill_.pending_writes.fetch_sub(1);
+            return MaybeStartSpilledJoin(plan_->query_context()->GetThreadIndex());
+          },
+          "HashJoinNode::SpillBatch");
+    }
+    return Status::OK();
+  }
+
+  // Starts joining the spilled partitions once both inputs have been fully written
+  // out to disk.
+  Status MaybeStartSpilledJoin(size_t thread_index) {
+    {
+      std::lock_guard<std::mutex> guard(probe_side_mutex_);
+      if (spill_.started || !spill_.build_side_finished || !probe_side_finished_ ||
+          !queued_batches_filtered_ || spill_.pending_writes.load() > 0) {
+        return Status::OK();
+      }
+      spill_.started = true;
+    }
+    for (int side = 0; side <= 1; ++side) {
+      for (auto& file : spill_.files[side]) {
+        RETURN_NOT_OK(file->FinishWriting());
+      }
+    }
+    return StartSpilledPartition(/*prtn=*/0);
+  }
+
+  // Joins partition `prtn` (or the next non-empty one) by reading its build side back
+  // into a fresh hash table and then probing it with the spilled probe side rows.
+  // Partitions are processed one at a time so only one hash table is in memory.
+  Status StartSpilledPartition(int prtn) {
+    while (prtn < spill_.num_partitions && spill_.files[0][prtn]->num_rows() == 0 &&
+           spill_.files[1][prtn]->num_rows() == 0) {
+      ++prtn;
+    }
+    if (prtn == spill_.num_partitions) {
+      return FinishedCallback(spill_.num_output_batches);
+    }
+    plan_->query_context()->ScheduleIOTask(
+        [this, prtn]() -> Status {
+          {
+            // Release the hash tables of the partitions that are done
+            std::lock_guard<std::mutex> guard(spill_.impls_mutex);
+            for (int i = 0; i < prtn; ++i) spill_.impls[i].reset();
+          }
+          AccumulationQueue batches;
+          SpillFile* file = spill_.files[1][prtn].get();
+          for (int i = 0; i < file->num_batches(); ++i) {
+            ARROW_ASSIGN_OR_RAISE(ExecBatch batch, file->ReadBatch(i));
+            batches.InsertBatch(std::move(batch));
+          }
+          spill_.files[1][prtn].reset();
+          QueryContext* ctx = plan_->query_context();
+          return spill_.impls[prtn]->BuildHashTable(
+              ctx->GetThreadIndex(), std::move(batches),
+              [this, ctx, prtn](size_t thread_index) {
+                return ctx->StartTaskGroup(spill_.probe_task_groups[prtn],
+                                           spill_.files[0][prtn]->num_batches());
+              });
+        },
+        "HashJoinNode::ReadSpilledPartition");
+    return Status::OK();
+  }
+
+  Status OnSpilledPartitionFinished(int prtn, int64_t num_batches) {
+    spill_.num_output_batches += num_batches;
+    return StartSpilledPartition(prtn + 1);
+  }
+
   Status StartProducing() override {
     NoteStartProducing(ToStringExtra());
     RETURN_NOT_OK(
@@ -988,6 +1175,10 @@ class HashJoinNode : public ExecNode, public TracedNode {
     bool expected = false;
     if (complete_.compare_exchange_strong(expected, true)) {
       impl_->Abort([]() {});
+      std::lock_guard<std::mutex> guard(spill_.impls_mutex);
+      for (auto& spill_impl : spill_.impls) {
+        if (spill_impl) spill_impl->Abort([]() {});
+      }
     }
     return Status::OK();
   }
@@ -1035,6 +1226,33 @@ class HashJoinNode : public ExecNode, public TracedNode {
   friend struct BloomFilterPushdownContext;
   bool disable_bloom_filter_;
   BloomFilterPushdownContext pushdown_context_;
+
+  // Size of the build side accumulated so far, protected by build_side_mutex_
+  int64_t build_bytes_ = 0;
+
+  // State of the grace hash join used once the build side exceeds its memory budget
+  struct {
+    bool enabled() const { return threshold_bytes >= 0; }
+
+    int64_t threshold_bytes = -1;
+    int num_partitions = 0;
+    std::vector<int> key_columns[2];
+    // One join implementation and one probe task group per partition
+    std::vector<std::unique_ptr<HashJoinImpl>> impls;
+    std::mutex impls_mutex;
+    std::vector<int> probe_task_groups;
+    std::unique_ptr<SpillDirectory> directory;
+    // Spill files of each side, indexed by partition
+    std::vector<std::unique_ptr<SpillFile>> files[2];
+    // Set with both build_side_mutex_ and probe_side_mutex_ held
+    std::atomic<bool> active{false};
+    std::atomic<int64_t> pending_writes{0};
+    // Protected by probe_side_mutex_
+    bool build_side_finished = false;
+    bool started = false;
+    // Only accessed while partitions are joined, one at a time
+    int64_t num_output_batches = 0;
+  } spill_;
 };
 
 void BloomFilterPushdownContext::Init(
@@ -1050,8 +1268,13 @@ void BloomFilterPushdownContext::Init(
   eval_.all_received_callback_ = std::move(on_bloom_filters_received);
   if (!disable_bloom_filter_) {
     ARROW_CHECK(push_.pushdown_target_);
-    push_.bloom_filter_ = std::make_unique<BlockedBloomFilter>();
-    push_.pushdown_target_->pushdown_context_.ExpectBloomFilter();
+    push_.bloom_filter_ = std::make_shared<BlockedBloomFilter>();
+    push_.runtime_filter_ = std::make_shared<RuntimeFilter>();
+    push_.pushdown_target_->pushdown_context_.ExpectBloomFilter(push_.runtime_filter_,
+                                                                push_.column_map_);
+    // Whether or not the probe side accepts the filter, the target still evaluates it
+    push_.pushdown_target_->inputs()[0]->AddRuntimeFilter(push_.runtime_filter_,
+                                                          push_.column_map_);
 
     build_.builder_ = BloomFilterBuilder::Make(
         use_sync_execution ? BloomFilterBuildStrategy::SINGLE_THREADED
@@ -1101,9 +1324,10 @@ Status BloomFilterPushdownContext::BuildBloomFilter(size_t thread_index,
 }
 
 Status BloomFilterPushdownContext::PushBloomFilter(size_t thread_index) {
-  if (!disable_bloom_filter_)
-    return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
-        thread_index, std::move(push_.bloom_filter_), std::move(push_.column_map_));
+  if (!disable_bloom_filter_) {
+    push_.runtime_filter_->Publish(std::move(push_.bloom_filter_));
+    return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(thread_index);
+  }
   return Status::OK();
 }
 
@@ -22,27 +22,34 @@
 #include <random>
 #include <unordered_set>
 
+#include "arrow/acero/bloom_filter.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/util.h"
 #include "arrow/api.h"
 #include "arrow/compute/kernels/row_encoder_internal.h"
+#include "arrow/compute/key_hash_internal.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/testing/extension_type.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/thread_pool.h"
 
 using testing::UnorderedElementsAreArray;
 
 namespace arrow {
 
+using compute::and_;
 using compute::call;
 using compute::default_exec_context;
 using compute::ExecSpan;
 using compute::field_ref;
+using compute::Hashing32;
+using compute::KeyColumnArray;
 using compute::SortIndices;
 using compute::SortKey;
 using compute::Take;
@@ -1668,21 +1675,35 @@ TEST(HashJoin, Scalars) {
   }
 }
 
-TEST(HashJoin, DictNegative) {
-  // For dictionary keys, all batches must share a single dictionary.
-  // Eventually, differing dictionaries will be unified and indices transposed
-  // during encoding to relieve this restriction.
+TEST(HashJoin, DictDiffering) {
+  // Batches may reference differing dictionaries, on either side of the join and in
+  // either key or payload columns. Dictionary columns keep their encoding in the output.
   const auto dictA = ArrayFromJSON(utf8(), R"(["ex", "why", "zee", null])");
-  const auto dictB = ArrayFromJSON(utf8(), R"(["different", "dictionary"])");
+  const auto dictB = ArrayFromJSON(utf8(), R"(["zee", "different", "ex"])");
 
   Datum datumFirst = Datum(
       *DictionaryArray::FromArrays(ArrayFromJSON(int32(), R"([0, 1, 2, 3])"), dictA));
   Datum datumSecondA = Datum(
       *DictionaryArray::FromArrays(ArrayFromJSON(int32(), R"([3, 2, 2, 3])"), dictA));
   Datum datumSecondB = Datum(
-      *DictionaryArray::FromArrays(ArrayFromJSON(int32(), R"([0, 1, 1, 0])"), dictB));
+      *DictionaryArray::FromArrays(ArrayFromJSON(int32(), R"([2, 1, 0, null])"), dictB));
+
+  auto make_join = [](const BatchesWithSchema& l, const BatchesWithSchema& r) {
+    Declaration left{"source", SourceNodeOptions{l.schema, l.gen(/*parallel=*/false,
+                                                                 /*slow=*/false)}};
+    Declaration right{"source", SourceNodeOptions{r.schema, r.gen(/*parallel=*/false,
+                                                                  /*slow=*/false)}};
+    HashJoinNodeOptions join_options{JoinType::FULL_OUTER,
+                                     {FieldRef("l_key")},
+                                     {FieldRef("r_key")},
+                                     {FieldRef("l_key"), FieldRef("l_payload")},
+                                     {FieldRef("r_key"), FieldRef("r_payload")},
+                                     {JoinKeyCmp::EQ}};
+    return Declaration{"hashjoin", {std::move(left), std::move(right)}, join_options};
+  };
 
   for (int i = 0; i < 4; ++i) {
+    ARROW_SCOPED_TRACE("differing column ", i);
     BatchesWithSchema l, r;
     l.schema = schema({field("l_key", dictionary(int32(), utf8())),
                        field("l_payload", dictionary(int32(), utf8()))});
@@ -1699,21 +1720,32 @@ TEST(HashJoin, DictNegative) {
                          ExecBatch::Make({i == 2 ? datumSecondB : datumSecondA,
                                           i == 3 ? datumSecondB : datumSecondA}));
 
-    Declaration left{"source", SourceNodeOptions{l.schema, l.gen(/*parallel=*/false,
-                                                                 /*slow=*/false)}};
-    Declaration right{"source", SourceNodeOptions{r.schema, r.gen(/*parallel=*/false,
-                                                                  /*slow=*/false)}};
-    HashJoinNodeOptions join_options{JoinType::INNER,
-                                     {FieldRef("l_key")},
-                                     {FieldRef("r_key")},
-                                     {FieldRef("l_key"), FieldRef("l_payload")},
-                                     {FieldRef("r_key"), FieldRef("r_payload")},
-                                     {JoinKeyCmp::EQ}};
-    Declaration join{"hashjoin", {std::move(left), std::move(right)}, join_options};
+    ASSERT_OK_AND_ASSIGN(auto actual,
+                         DeclarationToTable(make_join(l, r), /*use_threads=*/false));
+    for (const auto& field : actual->schema()->fields()) {
+      ASSERT_EQ(field->type()->id(), Type::DICTIONARY) << field->ToString();
+    }
 
-    EXPECT_RAISES_WITH_MESSAGE_THAT(
-        NotImplemented, ::testing::HasSubstr("Unifying differing dictionaries"),
-        DeclarationToTable(std::move(join), /*use_threads=*/false));
+    // Compare with the join of decoded inputs
+    BatchesWithSchema l_decoded = l, r_decoded = r;
+    l_decoded.schema = UpdateSchemaAfterDecodingDictionaries(l.schema);
+    r_decoded.schema = UpdateSchemaAfterDecodingDictionaries(r.schema);
+    for (auto* batches : {&l_decoded.batches, &r_decoded.batches}) {
+      for (ExecBatch& batch : *batches) {
+        ASSERT_NO_FATAL_FAILURE(
+            DecodeScalarsAndDictionariesInBatch(&batch, default_memory_pool()));
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(
+        auto expected,
+        DeclarationToTable(make_join(l_decoded, r_decoded), /*use_threads=*/false));
+    std::vector<std::shared_ptr<ChunkedArray>> decoded_columns;
+    for (const auto& column : actual->columns()) {
+      ASSERT_OK_AND_ASSIGN(Datum decoded, compute::Cast(column, utf8()));
+      decoded_columns.push_back(decoded.chunked_array());
+    }
+    AssertTablesEqualIgnoringOrder(expected,
+                                   Table::Make(expected->schema(), decoded_columns));
   }
 }
 
@@ -2036,6 +2068,52 @@ TEST(HashJoin, ResidualFilter) {
                   [3, 4, "alpha", 4, 16, "alpha"]])")});
 }
 
+TEST(HashJoin, ConjunctiveResidualFilter) {
+  BatchesWithSchema input_left;
+  input_left.batches = {ExecBatchFromJSON({int32(), int32(), utf8()}, R"([
+                            [1, 6, "alpha"],
+                            [2, 5, "beta"],
+                            [3, 4, "alpha"]])")};
+  input_left.schema =
+      schema({field("l1", int32()), field("l2", int32()), field("l_str", utf8())});
+
+  BatchesWithSchema input_right;
+  input_right.batches = {ExecBatchFromJSON({int32(), int32(), utf8()}, R"([
+                             [5, 11, "alpha"],
+                             [2, 12, "beta"],
+                             [4, 16, "alpha"],
+                             [null, 20, "alpha"]])")};
+  input_right.schema =
+      schema({field("r1", int32()), field("r2", int32()), field("r_str", utf8())});
+
+  const ResidualFilterCaseRunner runner{std::move(input_left), std::move(input_right)};
+
+  // Conjuncts are evaluated one after the other, each referring to other columns
+  Expression mul = call("multiply", {field_ref("l1"), field_ref("l2")});
+  Expression combination = call("add", {mul, field_ref("r1")});
+  Expression filter = and_({literal(true), less_equal(combination, field_ref("r2")),
+                            and_(not_equal(field_ref("l_str"), literal("beta")),
+                                 greater(field_ref("r2"), literal(11)))});
+  runner.Run(JoinType::INNER, {"l_str"}, {"r_str"}, filter,
+             {ExecBatchFromJSON({int32(), int32(), utf8(), int32(), int32(), utf8()}, R"([
+                  [1, 6, "alpha", 4, 16, "alpha"],
+                  [3, 4, "alpha", 4, 16, "alpha"]])")});
+
+  // No row passes the first conjunct, nor the second
+  for (const Expression& first :
+       {greater(field_ref("l1"), literal(10)), is_null(field_ref("l2"))}) {
+    runner.Run(JoinType::INNER, {"l_str"}, {"r_str"},
+               and_(first, less_equal(combination, field_ref("r2"))),
+               {ExecBatchFromJSON(
+                   {int32(), int32(), utf8(), int32(), int32(), utf8()}, R"([])")});
+  }
+
+  // A trivially false conjunct makes the whole filter false
+  runner.Run(JoinType::LEFT_SEMI, {"l_str"}, {"r_str"},
+             and_(less_equal(combination, field_ref("r2")), literal(false)),
+             {ExecBatchFromJSON({int32(), int32(), utf8()}, R"([])")});
+}
+
 TEST(HashJoin, FilterEmptyRows) {
   // Regression test for GH-41121.
   BatchesWithSchema input_left;
@@ -3201,5 +3279,206 @@ TEST(HashJoin, ChainedIntegerHashJoins) {
   }
 }
 
+BatchesWithSchema MakeSpillTestBatches(random::RandomArrayGenerator* rng,
+                                       const std::string& prefix, int num_batches,
+                                       int batch_size) {
+  BatchesWithSchema out;
+  out.schema =
+      schema({field(prefix + "_key", int32()), field(prefix + "_payload", utf8())});
+  for (int i = 0; i < num_batches; ++i) {
+    out.batches.push_back(ExecBatch({rng->Int32(batch_size, 0, 500, 0.05),
+                                     rng->String(batch_size, 0, 8, 0.1)},
+                                    batch_size));
+  }
+  return out;
+}
+
+TEST(HashJoin, Spilling) {
+  random::RandomArrayGenerator rng(42);
+  BatchesWithSchema left = MakeSpillTestBatches(&rng, "l", 20, 256);
+  BatchesWithSchema right = MakeSpillTestBatches(&rng, "r", 20, 256);
+
+  auto run_join = [&](JoinType join_type, JoinKeyCmp key_cmp, bool parallel,
+                      int64_t spill_threshold_bytes) -> Result<std::shared_ptr<Table>> {
+    Declaration left_source{"source",
+                            SourceNodeOptions{left.schema, left.gen(parallel,
+                                                                    /*slow=*/false)}};
+    Declaration right_source{"source",
+                             SourceNodeOptions{right.schema, right.gen(parallel,
+                                                                       /*slow=*/false)}};
+    HashJoinNodeOptions join_options{join_type, {FieldRef("l_key")}, {FieldRef("r_key")},
+                                     {},        {},                  {key_cmp}};
+    join_options.output_all = true;
+    join_options.spill_threshold_bytes = spill_threshold_bytes;
+    join_options.num_spill_partitions = 7;
+    Declaration join{"hashjoin", {left_source, right_source}, join_options};
+    return DeclarationToTable(std::move(join), parallel);
+  };
+
+  for (JoinType join_type :
+       {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::RIGHT_OUTER,
+        JoinType::FULL_OUTER, JoinType::LEFT_SEMI, JoinType::RIGHT_SEMI,
+        JoinType::LEFT_ANTI, JoinType::RIGHT_ANTI}) {
+    for (JoinKeyCmp key_cmp : {JoinKeyCmp::EQ, JoinKeyCmp::IS}) {
+      for (bool parallel : {false, true}) {
+        ARROW_SCOPED_TRACE("join_type=", ToString(join_type),
+                           " key_cmp=", key_cmp == JoinKeyCmp::EQ ? "EQ" : "IS",
+                           " parallel=", parallel);
+        ASSERT_OK_AND_ASSIGN(auto expected,
+                             run_join(join_type, key_cmp, parallel, /*no spilling*/ -1));
+        // The whole build side fits in the budget
+        ASSERT_OK_AND_ASSIGN(auto in_memory,
+                             run_join(join_type, key_cmp, parallel, 1LL << 30));
+        AssertTablesEqualIgnoringOrder(expected, in_memory);
+        // The join spills as soon as the first build side batch arrives
+        ASSERT_OK_AND_ASSIGN(auto spilled, run_join(join_type, key_cmp, parallel, 0));
+        AssertTablesEqualIgnoringOrder(expected, spilled);
+      }
+    }
+  }
+}
+
+TEST(HashJoin, SpillingUnsupported) {
+  BatchesWithSchema left = GenerateBatchesFromString(
+      schema({field("l_key", dictionary(int32(), utf8()))}), {R"(["a", "b"])"});
+  BatchesWithSchema right = GenerateBatchesFromString(
+      schema({field("r_key", dictionary(int32(), utf8()))}), {R"(["b", "c"])"});
+  Declaration left_source{"source",
+                          SourceNodeOptions{left.schema, left.gen(false, false)}};
+  Declaration right_source{"source",
+                           SourceNodeOptions{right.schema, right.gen(false, false)}};
+  HashJoinNodeOptions join_options{{FieldRef("l_key")}, {FieldRef("r_key")}};
+  join_options.spill_threshold_bytes = 0;
+  Declaration join{"hashjoin", {left_source, right_source}, join_options};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
+                                  ::testing::HasSubstr("Spilling is not supported"),
+                                  DeclarationToStatus(std::move(join)));
+
+  join_options.num_spill_partitions = 0;
+  Declaration invalid_join{"hashjoin", {left_source, right_source}, join_options};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("num_spill_partitions"),
+                                  DeclarationToStatus(std::move(invalid_join)));
+}
+
+TEST(HashJoin, RuntimeFilterPushdown) {
+  random::RandomArrayGenerator rng(42);
+  BatchesWithSchema left = MakeSpillTestBatches(&rng, "l", 20, 256);
+  BatchesWithSchema right = MakeSpillTestBatches(&rng, "r", 2, 16);
+
+  // The probe side filter and projection let the Bloom filter through to the source
+  auto run_join = [&](JoinType join_type, bool parallel,
+                      bool disable_bloom_filter) -> Result<std::shared_ptr<Table>> {
+    Declaration left_side = Declaration::Sequence(
+        {{"source", SourceNodeOptions{left.schema, left.gen(parallel, /*slow=*/false)}},
+         {"filter", FilterNodeOptions{call("is_valid", {field_ref("l_payload")})}},
+         {"project", ProjectNodeOptions{{field_ref("l_payload"), field_ref("l_key")},
+                                        {"l_payload", "l_key"}}}});
+    Declaration right_source{"source",
+                             SourceNodeOptions{right.schema, right.gen(parallel,
+                                                                       /*slow=*/false)}};
+    HashJoinNodeOptions join_options{join_type, {FieldRef("l_key")}, {FieldRef("r_key")}};
+    join_options.output_all = true;
+    join_options.disable_bloom_filter = disable_bloom_filter;
+    Declaration join{"hashjoin", {std::move(left_side), right_source}, join_options};
+    return DeclarationToTable(std::move(join), parallel);
+  };
+
+  for (JoinType join_type : {JoinType::INNER, JoinType::RIGHT_OUTER, JoinType::LEFT_SEMI,
+                             JoinType::RIGHT_SEMI, JoinType::RIGHT_ANTI}) {
+    for (bool parallel : {false, true}) {
+      ARROW_SCOPED_TRACE("join_type=", ToString(join_type), " parallel=", parallel);
+      ASSERT_OK_AND_ASSIGN(auto expected, run_join(join_type, parallel, true));
+      ASSERT_OK_AND_ASSIGN(auto actual, run_join(join_type, parallel, false));
+      AssertTablesEqualIgnoringOrder(expected, actual);
+    }
+  }
+}
+
+// Builds a published runtime filter accepting the rows of `keys`
+Result<std::shared_ptr<RuntimeFilter>> MakeRuntimeFilter(const ExecBatch& keys) {
+  int64_t hardware_flags = arrow::internal::CpuInfo::GetInstance()->hardware_flags();
+  arrow::util::TempVectorStack stack;
+  RETURN_NOT_OK(stack.Init(default_memory_pool(),
+                           32 * arrow::util::MiniBatch::kMiniBatchLength *
+                               sizeof(uint64_t)));
+  std::vector<uint32_t> hashes(keys.length);
+  std::vector<KeyColumnArray> temp_column_arrays;
+  RETURN_NOT_OK(Hashing32::HashBatch(keys, hashes.data(), temp_column_arrays,
+                                     hardware_flags, &stack, 0, keys.length));
+
+  auto bloom_filter = std::make_shared<BlockedBloomFilter>();
+  auto builder = BloomFilterBuilder::Make(BloomFilterBuildStrategy::SINGLE_THREADED);
+  RETURN_NOT_OK(builder->Begin(/*num_threads=*/1, hardware_flags, default_memory_pool(),
+                               keys.length, /*num_batches=*/1, bloom_filter.get()));
+  RETURN_NOT_OK(builder->PushNextBatch(/*thread_index=*/0, keys.length, hashes.data()));
+  builder->CleanUp();
+
+  auto filter = std::make_shared<RuntimeFilter>();
+  filter->Publish(std::move(bloom_filter));
+  return filter;
+}
+
+TEST(HashJoin, RuntimeFilterPlacement) {
+  constexpr int kNumRows = 1000;
+  std::vector<int32_t> values(kNumRows);
+  std::iota(values.begin(), values.end(), 0);
+  auto make_batch = [](const std::vector<int32_t>& keys) {
+    std::shared_ptr<Array> array;
+    ArrayFromVector<Int32Type>(keys, &array);
+    return ExecBatch({std::move(array)}, static_cast<int64_t>(keys.size()));
+  };
+  auto input_schema = schema({field("k", int32())});
+  std::vector<ExecBatch> batches;
+  for (int i = 0; i < kNumRows; i += 100) {
+    batches.push_back(
+        make_batch(std::vector<int32_t>(values.begin() + i, values.begin() + i + 100)));
+  }
+
+  // Accepts multiples of 10 as `k`
+  std::vector<int32_t> tens;
+  for (int32_t i = 0; i < kNumRows; i += 10) tens.push_back(i);
+  ASSERT_OK_AND_ASSIGN(auto tens_filter, MakeRuntimeFilter(make_batch(tens)));
+  // Accepts multiples of 20 as `k + 1`
+  std::vector<int32_t> twenties;
+  for (int32_t i = 0; i < kNumRows; i += 20) twenties.push_back(i + 1);
+  ASSERT_OK_AND_ASSIGN(auto twenties_filter, MakeRuntimeFilter(make_batch(twenties)));
+
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * source,
+      MakeExecNode("exec_batch_source", plan.get(), {},
+                   ExecBatchSourceNodeOptions(input_schema, batches)));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * project,
+      MakeExecNode("project", plan.get(), {source},
+                   ProjectNodeOptions({field_ref("k"),
+                                       call("add", {field_ref("k"), literal(1)})},
+                                      {"k", "k1"})));
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * filter,
+      MakeExecNode("filter", plan.get(), {project}, FilterNodeOptions(literal(true))));
+  AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+  ASSERT_OK(
+      MakeExecNode("sink", plan.get(), {filter}, SinkNodeOptions{&sink_gen}).status());
+
+  // A key projected unchanged is forwarded to the source
+  ASSERT_TRUE(filter->AddRuntimeFilter(tens_filter, {0}));
+  // A computed key can't go through the projection, so the filter node applies it
+  ASSERT_FALSE(project->AddRuntimeFilter(twenties_filter, {1}));
+  ASSERT_TRUE(filter->AddRuntimeFilter(twenties_filter, {1}));
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto result, StartAndCollect(plan.get(), sink_gen));
+  std::unordered_set<int32_t> output;
+  for (const ExecBatch& batch : result) {
+    const auto& keys = batch[0].array_as<Int32Array>();
+    for (int64_t i = 0; i < keys->length(); ++i) output.insert(keys->Value(i));
+  }
+  // A Bloom filter may let a few other rows through, but never drops a match
+  for (int32_t i = 0; i < kNumRows; i += 20) {
+    ASSERT_EQ(output.count(i), 1) << i;
+  }
+  ASSERT_LT(output.size(), static_cast<size_t>(kNumRows / 10));
+}
+
 }  // namespace acero
 }  // namespace arrow
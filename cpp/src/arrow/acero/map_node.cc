@@ -69,7 +69,7 @@ void MapNode::ResumeProducing(ExecNode* output, int32_t counter) {
 Status MapNode::StopProducingImpl() { return Status::OK(); }
 
 Status MapNode::InputReceived(ExecNode* input, ExecBatch batch) {
-  auto scope = TraceInputReceived(batch);
+  auto scope = TraceInputReceived(input, batch);
   DCHECK_EQ(input, inputs_[0]);
   compute::Expression guarantee = batch.guarantee;
   int64_t index = batch.index;
@@ -0,0 +1,125 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "arrow/acero/memory_budget.h"
+
+#include <utility>
+
+#include "arrow/acero/backpressure_handler.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace acero {
+
+class MemoryBudget::RoomControl : public BackpressureControl {
+ public:
+  explicit RoomControl(MemoryBudget* budget) : budget_(budget) {}
+
+  // Both are called with the budget's mutex held
+  void Pause() override {
+    if (budget_->room_.is_finished()) {
+      budget_->room_ = Future<>::Make();
+    }
+  }
+
+  void Resume() override {
+    if (!budget_->room_.is_finished()) {
+      budget_->room_to_finish_ = std::move(budget_->room_);
+      budget_->room_ = Future<>::MakeFinished();
+    }
+  }
+
+ private:
+  MemoryBudget* budget_;
+};
+
+MemoryBudget::MemoryBudget(int64_t capacity) : capacity_(capacity) {}
+
+MemoryBudget::~MemoryBudget() = default;
+
+Result<std::shared_ptr<MemoryBudget>> MemoryBudget::Make(int64_t capacity) {
+  if (capacity <= 0) {
+    return Status::Invalid("A memory budget must have a positive capacity, got ",
+                           capacity);
+  }
+  std::shared_ptr<MemoryBudget> budget(new MemoryBudget(capacity));
+  auto high_threshold = static_cast<size_t>(capacity);
+  ARROW_ASSIGN_OR_RAISE(
+      auto backpressure,
+      BackpressureHandler::Make(/*input=*/nullptr, high_threshold / 4 * 3, high_threshold,
+                                std::make_unique<RoomControl>(budget.get())));
+  budget->backpressure_ = std::make_unique<BackpressureHandler>(std::move(backpressure));
+  return budget;
+}
+
+int64_t MemoryBudget::bytes_reserved() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return bytes_reserved_;
+}
+
+int64_t MemoryBudget::bytes_spilling() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return bytes_spilling_;
+}
+
+bool MemoryBudget::exceeded() const {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return bytes_reserved_ + bytes_spilling_ > capacity_;
+}
+
+void MemoryBudget::Reserve(int64_t bytes) { Update(bytes, 0); }
+
+void MemoryBudget::Release(int64_t bytes) { Update(-bytes, 0); }
+
+void MemoryBudget::StartSpilling(int64_t bytes) { Update(0, bytes); }
+
+void MemoryBudget::FinishSpilling(int64_t bytes) { Update(0, -bytes); }
+
+Future<> MemoryBudget::WaitForRoom() {
+  std::lock_guard<std::mutex> lk(mutex_);
+  return room_;
+}
+
+size_t MemoryBudget::PendingLevel() const {
+  // Only memory being spilled is certain to be released while sources are paused
+  return bytes_spilling_ > 0 ? static_cast<size_t>(bytes_reserved_ + bytes_spilling_)
+                             : 0;
+}
+
+void MemoryBudget::Update(int64_t reserved_delta, int64_t spilling_delta) {
+  if (reserved_delta == 0 && spilling_delta == 0) {
+    return;
+  }
+  Future<> to_finish;
+  {
+    std::lock_guard<std::mutex> lk(mutex_);
+    size_t start_level = PendingLevel();
+    bytes_reserved_ += reserved_delta;
+    bytes_spilling_ += spilling_delta;
+    DCHECK_GE(bytes_reserved_, 0);
+    DCHECK_GE(bytes_spilling_, 0);
+    backpressure_->Handle(start_level, PendingLevel());
+    to_finish = std::move(room_to_finish_);
+    room_to_finish_ = Future<>();
+  }
+  // Sources resume from here, possibly reserving more memory
+  if (to_finish.is_valid()) {
+    to_finish.MarkFinished();
+  }
+}
+
+}  // namespace acero
+}  // namespace arrow
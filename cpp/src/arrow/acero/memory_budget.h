@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+
+#include "arrow/acero/visibility.h"
+#include "arrow/result.h"
+#include "arrow/util/future.h"
+
+namespace arrow {
+namespace acero {
+
+class BackpressureHandler;
+
+/// \brief A budget for the memory buffered by the nodes of one or more plans
+///
+/// Nodes that hold on to data reserve the bytes they buffer and release them once the
+/// data is gone: the accumulation queues (e.g. of the hash join build side), the
+/// aggregate node when it may spill and the order_by node.  Reservations never fail,
+/// the budget is a soft limit that nodes cooperate with:
+///
+/// - once the budget is exceeded, nodes that are allowed to spill (see e.g.
+///   HashJoinNodeOptions::spill_threshold_bytes) spill as though their own threshold
+///   was reached
+/// - while the budget is exceeded and spilled data is being written out, source nodes
+///   stop reading.  They resume once the bytes reserved and being written fall to
+///   three quarters of the capacity, or once the writes are done.  Sources are not
+///   paused otherwise, since most buffering nodes only release memory once they
+///   receive more input.
+///
+/// A budget can be shared by several plans (see QueryOptions::memory_budget) to cap
+/// their combined memory.  All methods are thread safe.
+class ARROW_ACERO_EXPORT MemoryBudget {
+ public:
+  /// \brief Make a budget of `capacity` bytes
+  static Result<std::shared_ptr<MemoryBudget>> Make(int64_t capacity);
+
+  ~MemoryBudget();
+
+  int64_t capacity() const { return capacity_; }
+
+  /// \brief The number of bytes currently reserved
+  int64_t bytes_reserved() const;
+
+  /// \brief The number of bytes currently being written out to spill files
+  int64_t bytes_spilling() const;
+
+  /// \brief True if the bytes reserved and being spilled exceed the capacity
+  bool exceeded() const;
+
+  /// \brief Reserve `bytes`, which always succeeds even past the capacity
+  void Reserve(int64_t bytes);
+
+  /// \brief Release `bytes` previously reserved
+  void Release(int64_t bytes);
+
+  /// \brief Note that `bytes` started being written out to spill files
+  ///
+  /// Each call must eventually be matched by a call to FinishSpilling.  This is done by
+  /// QueryContext::TempFileIOMark.
+  void StartSpilling(int64_t bytes);
+
+  /// \brief Note that `bytes` were written out to spill files
+  void FinishSpilling(int64_t bytes);
+
+  /// \brief A future that finishes once sources may read more data
+  Future<> WaitForRoom();
+
+ private:
+  explicit MemoryBudget(int64_t capacity);
+
+  class RoomControl;
+
+  void Update(int64_t reserved_delta, int64_t spilling_delta);
+
+  // The level, for the backpressure handler, of the memory that will be released
+  // without further input
+  size_t PendingLevel() const;
+
+  const int64_t capacity_;
+  mutable std::mutex mutex_;
+  int64_t bytes_reserved_ = 0;
+  int64_t bytes_spilling_ = 0;
+  Future<> room_ = Future<>::MakeFinished();
+  // A paused room to finish once the mutex is released
+  Future<> room_to_finish_;
+  std::unique_ptr<BackpressureHandler> backpressure_;
+};
+
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,115 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/memory_budget.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace acero {
+
+using util::AccumulationQueue;
+
+TEST(MemoryBudget, Invalid) {
+  ASSERT_RAISES(Invalid, MemoryBudget::Make(0));
+  ASSERT_RAISES(Invalid, MemoryBudget::Make(-1));
+}
+
+TEST(MemoryBudget, ReserveRelease) {
+  ASSERT_OK_AND_ASSIGN(auto budget, MemoryBudget::Make(100));
+  ASSERT_EQ(100, budget->capacity());
+  budget->Reserve(60);
+  budget->Reserve(40);
+  ASSERT_EQ(100, budget->bytes_reserved());
+  ASSERT_FALSE(budget->exceeded());
+  budget->Reserve(1);
+  ASSERT_TRUE(budget->exceeded());
+  // Reserving past the capacity alone never pauses sources
+  ASSERT_TRUE(budget->WaitForRoom().is_finished());
+  budget->Release(101);
+  ASSERT_EQ(0, budget->bytes_reserved());
+  ASSERT_FALSE(budget->exceeded());
+}
+
+TEST(MemoryBudget, WaitForRoomWhileSpilling) {
+  ASSERT_OK_AND_ASSIGN(auto budget, MemoryBudget::Make(100));
+  budget->Reserve(90);
+  // A spilled batch moves from reserved to spilling
+  budget->StartSpilling(20);
+  budget->Release(20);
+  ASSERT_EQ(20, budget->bytes_spilling());
+  ASSERT_TRUE(budget->WaitForRoom().is_finished());
+
+  budget->Reserve(30);
+  ASSERT_TRUE(budget->exceeded());
+  Future<> room = budget->WaitForRoom();
+  ASSERT_FALSE(room.is_finished());
+  // Still above three quarters of the capacity
+  budget->Release(20);
+  ASSERT_FALSE(room.is_finished());
+  budget->Release(5);
+  ASSERT_FINISHES_OK(room);
+  ASSERT_TRUE(budget->WaitForRoom().is_finished());
+
+  // Sources also resume once nothing is being spilled anymore
+  budget->Reserve(30);
+  room = budget->WaitForRoom();
+  ASSERT_FALSE(room.is_finished());
+  budget->FinishSpilling(20);
+  ASSERT_FINISHES_OK(room);
+  ASSERT_EQ(0, budget->bytes_spilling());
+  ASSERT_EQ(105, budget->bytes_reserved());
+  ASSERT_TRUE(budget->exceeded());
+  ASSERT_TRUE(budget->WaitForRoom().is_finished());
+}
+
+TEST(MemoryBudget, AccumulationQueue) {
+  ASSERT_OK_AND_ASSIGN(auto budget, MemoryBudget::Make(1 << 20));
+  ExecBatch batch = ExecBatchFromJSON({int32()}, "[[1], [2], [3]]");
+  int64_t batch_bytes = batch.TotalBufferSize();
+  {
+    AccumulationQueue queue;
+    queue.set_memory_budget(budget.get());
+    queue.InsertBatch(batch);
+    queue.InsertBatch(batch);
+    ASSERT_EQ(2 * batch_bytes, budget->bytes_reserved());
+
+    // The reservation follows the batches when queues are moved or concatenated
+    AccumulationQueue moved = std::move(queue);
+    ASSERT_EQ(2 * batch_bytes, budget->bytes_reserved());
+    AccumulationQueue other;
+    other.InsertBatch(batch);
+    ASSERT_EQ(2 * batch_bytes, budget->bytes_reserved());
+    other.Concatenate(std::move(moved));
+    ASSERT_EQ(2 * batch_bytes, budget->bytes_reserved());
+    other.InsertBatch(batch);
+    ASSERT_EQ(3 * batch_bytes, budget->bytes_reserved());
+
+    other.Clear();
+    ASSERT_EQ(0, budget->bytes_reserved());
+    other.InsertBatch(batch);
+    ASSERT_EQ(batch_bytes, budget->bytes_reserved());
+  }
+  ASSERT_EQ(0, budget->bytes_reserved());
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <functional>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <string>
@@ -254,6 +255,10 @@ class ARROW_ACERO_EXPORT FilterNodeOptions : public ExecNodeOptions {
   ///
   /// The return type of this expression must be boolean
   Expression filter_expression;
+  /// \brief the compiler of the filter expression
+  ///
+  /// If this is null then QueryOptions::expression_compiler is used
+  std::shared_ptr<ExpressionCompiler> expression_compiler;
 };
 
 /// \brief a node which selects a specified subset from the input
@@ -295,6 +300,10 @@ class ARROW_ACERO_EXPORT ProjectNodeOptions : public ExecNodeOptions {
   ///
   /// This list should either be empty or have the same length as `expressions`
   std::vector<std::string> names;
+  /// \brief the compiler of the expressions
+  ///
+  /// If this is null then QueryOptions::expression_compiler is used
+  std::shared_ptr<ExpressionCompiler> expression_compiler;
 };
 
 /// \brief a node which aggregates input batches and calculates summary statistics
@@ -345,6 +354,136 @@ class ARROW_ACERO_EXPORT AggregateNodeOptions : public ExecNodeOptions {
   std::vector<FieldRef> keys;
   // keys by which aggregations will be segmented (optional)
   std::vector<FieldRef> segment_keys;
+  // the amount of input data, in bytes, that a grouped aggregation may accumulate
+  // into in-memory aggregate states before spilling to disk
+  //
+  // When spilling is enabled the groups are split into `num_spill_partitions`
+  // partitions on the hash of the keys.  Once the budget is exceeded, further input
+  // rows are written to one temporary file per partition, and each partition is
+  // then finished on its own, combining its in-memory states with the rows read back
+  // from disk.  A negative value (the default) disables spilling.  When spilling is
+  // enabled, the aggregation also starts spilling once the plan's memory budget is
+  // exceeded (see QueryOptions::memory_budget).
+  //
+  // Spilling is not supported for segmented aggregations, ordered aggregate
+  // functions or dictionary keys, and has no effect on scalar aggregations.
+  int64_t spill_threshold_bytes = -1;
+  // number of partitions to split the groups into when spilling is enabled
+  int num_spill_partitions = 16;
+  // number of partitions to split the groups into so that the thread local states of a
+  // grouped aggregation can be merged in parallel
+  //
+  // By default every thread aggregates its input into one local state and, once the
+  // input ends, these states are merged serially into one.  With high-cardinality keys
+  // that merge is a serial tail which grows with the number of threads.  When this is
+  // greater than one, the groups are instead split on the hash of the keys as the input
+  // is consumed, each thread keeping one state per partition, and the partitions are
+  // then merged and output independently on the CPU executor.  This is ignored when
+  // spilling is enabled, which partitions on its own, and has the same restrictions.
+  int num_merge_partitions = 1;
+};
+
+/// \brief Make a node which drops the rows whose keys were already seen
+///
+/// Rows are output as soon as they arrive, so that a downstream fetch can end the
+/// plan early: the first row received with each distinct combination of keys is kept,
+/// along with all of its columns.  When the input is processed in parallel which of
+/// the duplicate rows is received first is arbitrary and the output is unordered.
+///
+/// SELECT DISTINCT is expressed by leaving `keys` empty, which uses all of the input
+/// columns as keys.
+class ARROW_ACERO_EXPORT DistinctNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "distinct";
+  /// \brief create an instance from values
+  explicit DistinctNodeOptions(std::vector<FieldRef> keys = {}) : keys(std::move(keys)) {}
+
+  /// \brief The columns which identify duplicate rows, all columns if empty
+  std::vector<FieldRef> keys;
+  /// \brief The amount of key data, in bytes, that may be kept in memory to detect
+  /// duplicates before spilling to disk
+  ///
+  /// When spilling is enabled the keys are split into `num_spill_partitions`
+  /// partitions on their hash.  Once the budget is exceeded, the partition holding the
+  /// most keys is spilled: the keys it has seen are written to disk along with all of
+  /// its further input rows, which are deduplicated against them once the input ends.
+  /// A negative value (the default) disables spilling.  When spilling is enabled,
+  /// partitions are also spilled once the plan's memory budget is exceeded (see
+  /// QueryOptions::memory_budget).
+  int64_t spill_threshold_bytes = -1;
+  /// \brief number of partitions to split the keys into when spilling is enabled
+  int num_spill_partitions = 16;
+  /// \brief Forget the seen keys rather than spilling them
+  ///
+  /// Once `spill_threshold_bytes` is exceeded, the seen keys are dropped and detection
+  /// starts over, so some duplicate rows are output.  This bounds the memory of the
+  /// node, e.g. as a cheap pre-filter in front of an exact distinct or an aggregation.
+  /// Requires `spill_threshold_bytes` to be set.
+  bool approximate = false;
+};
+
+/// \brief Make a node which merges small batches into larger ones
+///
+/// Selective filters leave many small batches, each of which pays the per-batch
+/// overhead of every downstream node.  Batches shorter than half of `target_rows`
+/// are buffered and concatenated once `target_rows` rows have accumulated; larger
+/// batches are passed on unchanged.  If the input is ordered the output keeps that
+/// order, buffered rows being emitted before the next large batch.
+class ARROW_ACERO_EXPORT CoalesceNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "coalesce";
+  /// \brief the size of the batches sources produce, ExecPlan::kMaxBatchSize
+  static constexpr int64_t kDefaultTargetRows = 1 << 15;
+  static constexpr int kDefaultMaxBufferedBatches = 64;
+
+  /// \brief create an instance from values
+  explicit CoalesceNodeOptions(int64_t target_rows = kDefaultTargetRows,
+                               int max_buffered_batches = kDefaultMaxBufferedBatches)
+      : target_rows(target_rows), max_buffered_batches(max_buffered_batches) {}
+
+  /// \brief the number of rows to accumulate before emitting a batch
+  int64_t target_rows;
+  /// \brief the number of small batches after which buffered rows are emitted even if
+  /// fewer than `target_rows`
+  ///
+  /// This bounds how long rows are held back when few of them arrive.
+  int max_buffered_batches;
+};
+
+/// \brief Make a node which outputs the batches of all of its inputs
+///
+/// The inputs must all have the same schema.  Passing the base ExecNodeOptions
+/// selects the UNORDERED mode.
+class ARROW_ACERO_EXPORT UnionNodeOptions : public ExecNodeOptions {
+ public:
+  enum Mode {
+    /// Forward batches as they arrive, the output is unordered
+    UNORDERED,
+    /// Forward batches as they arrive, but pause the inputs which are more than
+    /// `max_batches_ahead` batches ahead of the slowest unfinished input so that a
+    /// fast input doesn't starve the others
+    FAIR,
+    /// Output the batches of each input in the input's order, all the batches of an
+    /// input coming before those of the next input
+    ///
+    /// The inputs must be ordered and the output has an implicit ordering, so that
+    /// order sensitive nodes such as "fetch" can follow.  At most `max_batches_ahead`
+    /// batches of the inputs not yet being output are buffered before pausing them.
+    ORDERED,
+  };
+
+  static constexpr std::string_view kName = "union";
+  static constexpr int kDefaultMaxBatchesAhead = 16;
+
+  explicit UnionNodeOptions(Mode mode = UNORDERED,
+                            int max_batches_ahead = kDefaultMaxBatchesAhead)
+      : mode(mode), max_batches_ahead(max_batches_ahead) {}
+
+  /// \brief How the batches of the inputs are interleaved
+  Mode mode;
+  /// \brief How far an input may run ahead before it is paused, unused in the
+  /// UNORDERED mode
+  int max_batches_ahead;
 };
 
 /// \brief a default value at which backpressure will be applied
@@ -511,6 +650,96 @@ class ARROW_ACERO_EXPORT ConsumingSinkNodeOptions : public ExecNodeOptions {
   std::optional<bool> sequence_output;
 };
 
+/// \brief A transport which sends batches from an exchange sink to the receivers of
+/// its partitions, e.g. in plan fragments running on other machines
+class ARROW_ACERO_EXPORT ExchangeSender {
+ public:
+  virtual ~ExchangeSender() = default;
+  /// \brief The number of partitions batches are sent to
+  virtual int num_partitions() const = 0;
+  /// \brief Prepare to send batches of the given schema
+  ///
+  /// The transport may pause the sending plan through backpressure_control, e.g. while
+  /// the receivers are falling behind.
+  virtual Status Init(const std::shared_ptr<Schema>& schema,
+                      BackpressureControl* backpressure_control) = 0;
+  /// \brief Send a batch to the receiver of a partition
+  ///
+  /// This may be called concurrently from several threads.
+  virtual Status Send(int partition, const ExecBatch& batch) = 0;
+  /// \brief Signal that all batches have been sent
+  ///
+  /// The returned future should finish once all batches have been delivered.
+  virtual Future<> Finish() = 0;
+  /// \brief Signal that the sending plan ended early or failed
+  ///
+  /// The receivers should fail with the given status instead of waiting for more
+  /// batches.
+  virtual void Abort(const Status& status) = 0;
+};
+
+/// \brief The receiving end of an ExchangeSender for a single partition
+class ARROW_ACERO_EXPORT ExchangeReceiver {
+ public:
+  virtual ~ExchangeReceiver() = default;
+  /// \brief The schema of the received batches
+  virtual const std::shared_ptr<Schema>& schema() const = 0;
+  /// \brief Receive the next batch, or an empty optional once all senders finished
+  virtual Future<std::optional<ExecBatch>> Receive() = 0;
+};
+
+/// \brief Make a sink node which sends its input to the partitions of an exchange
+///
+/// Rows are either partitioned by the hash of the key columns, so that all rows with
+/// the same key are sent to the same partition, or every batch is broadcast to all
+/// partitions.  Together with "exchange_source" nodes this allows a plan to be split
+/// into fragments that run on several machines or threads.
+class ARROW_ACERO_EXPORT ExchangeSinkNodeOptions : public ExecNodeOptions {
+ public:
+  enum Distribution {
+    /// Send each row to the partition given by the hash of its keys
+    HASH,
+    /// Send every batch to all partitions
+    BROADCAST,
+  };
+
+  static constexpr std::string_view kName = "exchange_sink";
+
+  ExchangeSinkNodeOptions(std::shared_ptr<ExchangeSender> sender,
+                          std::vector<FieldRef> keys)
+      : sender(std::move(sender)), distribution(HASH), keys(std::move(keys)) {}
+
+  /// \brief Make options which broadcast every batch to all partitions
+  static ExchangeSinkNodeOptions Broadcast(std::shared_ptr<ExchangeSender> sender) {
+    ExchangeSinkNodeOptions options(std::move(sender), {});
+    options.distribution = BROADCAST;
+    return options;
+  }
+
+  /// \brief The transport batches are sent with
+  std::shared_ptr<ExchangeSender> sender;
+  /// \brief How rows are distributed across the partitions
+  Distribution distribution;
+  /// \brief The columns to hash partition rows by
+  ///
+  /// Receivers of different senders agree on the partition of a key as long as the
+  /// keys have the same types.
+  std::vector<FieldRef> keys;
+};
+
+/// \brief Make a source node which emits the batches received for one partition of
+/// an exchange
+class ARROW_ACERO_EXPORT ExchangeSourceNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "exchange_source";
+
+  explicit ExchangeSourceNodeOptions(std::shared_ptr<ExchangeReceiver> receiver)
+      : receiver(std::move(receiver)) {}
+
+  /// \brief The receiving end of the exchange
+  std::shared_ptr<ExchangeReceiver> receiver;
+};
+
 /// \brief Make a node which sorts rows passed through it
 ///
 /// All batches pushed to this node will be accumulated, then sorted, by the given
@@ -540,6 +769,97 @@ class ARROW_ACERO_EXPORT OrderByNodeOptions : public ExecNodeOptions {
 
   /// \brief The new ordering to apply to outgoing data
   Ordering ordering;
+  /// \brief The amount of input data, in bytes, to accumulate before sorting it as a
+  /// run and spilling the run to disk
+  ///
+  /// Runs are sorted as the input arrives and, once the input is finished, are merged
+  /// back into a single sorted output.  If the whole input stays under the budget it
+  /// is sorted in memory as usual.  A negative value (the default) disables spilling.
+  ///
+  /// With spilling enabled, a run is also spilled whenever the plan's memory budget
+  /// is exceeded.  \see QueryOptions::memory_budget
+  int64_t spill_threshold_bytes = -1;
+};
+
+/// \brief The rows, relative to the current row, that a window function aggregates
+///
+/// A ROWS frame counts rows: `preceding` rows before the current row and `following`
+/// rows after it.  A RANGE frame compares values of the (single) ordering key: it
+/// contains the rows whose key is at most `preceding` before and at most `following`
+/// after the key of the current row, in the direction of the ordering.  RANGE frames
+/// require an integer or temporal ordering key.  Rows with a null key only ever
+/// share a RANGE frame with each other.
+struct ARROW_ACERO_EXPORT WindowFrame {
+  enum Type { ROWS, RANGE };
+
+  /// \brief A bound that extends to the start or end of the partition
+  static constexpr int64_t kUnbounded = std::numeric_limits<int64_t>::max();
+
+  Type type = ROWS;
+  /// \brief The extent of the frame before the current row, must be non-negative
+  int64_t preceding = kUnbounded;
+  /// \brief The extent of the frame after the current row, must be non-negative
+  int64_t following = 0;
+};
+
+/// \brief A window function evaluated by a window node
+///
+/// The supported functions are
+/// - "row_number", "rank" and "dense_rank", which take no target and rank rows
+///   within their partition according to the ordering,
+/// - "lag" and "lead", which return the target value `offset` rows before or after
+///   the current row in the partition, or null,
+/// - "count", "sum", "mean", "min" and "max", which aggregate the non-null target
+///   values of the rows in `frame`.  All but "count" are null for frames without
+///   non-null values.
+struct ARROW_ACERO_EXPORT WindowFunction {
+  WindowFunction(std::string function, FieldRef target, std::string name,
+                 WindowFrame frame = {}, int64_t offset = 1)
+      : function(std::move(function)),
+        target(std::move(target)),
+        name(std::move(name)),
+        frame(frame),
+        offset(offset) {}
+
+  /// \brief The name of the window function
+  std::string function;
+  /// \brief The field the function is applied to, ignored by ranking functions
+  FieldRef target;
+  /// \brief The name of the output field
+  std::string name;
+  /// \brief The frame of aggregate functions
+  WindowFrame frame;
+  /// \brief The offset of "lag" and "lead", must be non-negative
+  int64_t offset;
+};
+
+/// \brief A node which evaluates window functions
+///
+/// The input must be sorted on the partition keys followed by the sort keys of
+/// `ordering` (e.g. by an order_by node), so that each partition is a contiguous
+/// run of rows.  Partitions are evaluated one at a time, as soon as they end, and
+/// so only a single partition needs to be held in memory.  The output contains all
+/// of the input columns followed by one column per window function, in the order
+/// of the input.
+class ARROW_ACERO_EXPORT WindowNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "window";
+  /// \brief create an instance from values
+  explicit WindowNodeOptions(std::vector<WindowFunction> functions,
+                             std::vector<FieldRef> partition_keys = {},
+                             Ordering ordering = Ordering::Unordered())
+      : functions(std::move(functions)),
+        partition_keys(std::move(partition_keys)),
+        ordering(std::move(ordering)) {}
+
+  /// \brief The window functions to evaluate
+  std::vector<WindowFunction> functions;
+  /// \brief The keys which split the input into independent partitions
+  std::vector<FieldRef> partition_keys;
+  /// \brief The order of the rows within each partition
+  ///
+  /// Used by ranking functions and RANGE frames.
+  Ordering ordering;
 };
 
 enum class JoinType {
@@ -677,6 +997,19 @@ class ARROW_ACERO_EXPORT HashJoinNodeOptions : public ExecNodeOptions {
   Expression filter = literal(true);
   // whether or not to disable Bloom filters in this join
   bool disable_bloom_filter = false;
+  // memory budget, in bytes, for the accumulated build side (right input).  If the
+  // build side grows past this budget the join switches to a grace hash join: both
+  // inputs are partitioned on the hash of their key columns, written to temporary
+  // files, and then joined one partition at a time.  Joins whose build side stays
+  // under the budget are not affected.  A negative value (the default) disables
+  // spilling.  A join that may spill also spills once the plan's memory budget (see
+  // QueryOptions::memory_budget) is exceeded while the build side accumulates.
+  //
+  // Spilling is not supported for dictionary or large binary columns.  A join that
+  // may spill does not push a Bloom filter for its own build side.
+  int64_t spill_threshold_bytes = -1;
+  // number of partitions to split the inputs into once the join spills
+  int num_spill_partitions = 16;
 };
 
 /// \brief a node which implements the asof join operation
@@ -727,6 +1060,60 @@ class ARROW_ACERO_EXPORT AsofJoinNodeOptions : public ExecNodeOptions {
   ///
   /// The tolerance is interpreted in the same units as the "on" key.
   int64_t tolerance;
+  /// \brief Number of partitions the inputs are split into on the hash of the "by" key
+  ///
+  /// Each partition is matched independently, in parallel on the plan's executor, and
+  /// the outputs of the partitions are merged back in "on" key order.  Rows with equal
+  /// "on" key values but different "by" key values may then be output in a different
+  /// order than in the left input.  A value greater than 1 requires a "by" key.
+  int num_partitions = 1;
+};
+
+/// \brief a node which joins two inputs sorted on the join keys by merging them
+///
+/// Unlike the hash join this streams both inputs, holding only the right rows sharing
+/// the current key, and never hashes the keys.  It supports inner, left outer, left
+/// semi and left anti joins and preserves the order of the left input.  Null keys
+/// never match.
+///
+/// Both inputs must be sorted on the keys, in the order in which the keys are given.
+/// An input with an explicit ordering (e.g. the output of an order_by node) must sort
+/// on the keys first, with the same sort orders and null placement as the other input.
+/// An input which is only implicitly ordered (e.g. a table or file source, whose
+/// batches are numbered but carry no sort keys) is trusted to be sorted like the other
+/// input, or ascending with nulls at the end if neither input has an explicit
+/// ordering.  A plan fails if an input turns out not to be sorted accordingly.
+///
+/// The output has the columns of the left input followed, except for semi and anti
+/// joins, by those of the right input.  As with the hash join, the suffixes are only
+/// added to the names of the fields found in both inputs.
+class ARROW_ACERO_EXPORT SortMergeJoinNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "sort_merge_join";
+  static constexpr const char* default_output_suffix_for_left = "";
+  static constexpr const char* default_output_suffix_for_right = "";
+
+  SortMergeJoinNodeOptions(
+      JoinType join_type, std::vector<FieldRef> left_keys,
+      std::vector<FieldRef> right_keys,
+      std::string output_suffix_for_left = default_output_suffix_for_left,
+      std::string output_suffix_for_right = default_output_suffix_for_right)
+      : join_type(join_type),
+        left_keys(std::move(left_keys)),
+        right_keys(std::move(right_keys)),
+        output_suffix_for_left(std::move(output_suffix_for_left)),
+        output_suffix_for_right(std::move(output_suffix_for_right)) {}
+
+  /// \brief the type of join, one of INNER, LEFT_OUTER, LEFT_SEMI and LEFT_ANTI
+  JoinType join_type;
+  /// \brief the keys of the left input, which must not be empty
+  std::vector<FieldRef> left_keys;
+  /// \brief the keys of the right input, of the same types as the left keys
+  std::vector<FieldRef> right_keys;
+  /// \brief suffix added to the names of the colliding output fields from the left
+  std::string output_suffix_for_left;
+  /// \brief suffix added to the names of the colliding output fields from the right
+  std::string output_suffix_for_right;
 };
 
 /// \brief a node which select top_k/bottom_k rows passed through it
@@ -860,6 +1247,55 @@ class ARROW_ACERO_EXPORT PivotLongerNodeOptions : public ExecNodeOptions {
   std::vector<std::string> measurement_field_names;
 };
 
+/// \brief Options for a node that pivots rows into columns, the reverse of pivot_longer
+///
+/// For example, pivoting this table on "location" and "temp" with the key names
+/// "left" and "right", and "time" as the key:
+///
+/// | time | location | temp |
+/// | ---  | ---      | ---  |
+/// | 1    | left     | 10   |
+/// | 1    | right    | 20   |
+/// | 2    | left     | 15   |
+///
+/// gives:
+///
+/// | time | left | right |
+/// | ---- | ---- | ----- |
+/// | 1    | 10   | 20    |
+/// | 2    | 15   | null  |
+///
+/// The rows are grouped on `keys` by a hash aggregation with the "hash_pivot_wider"
+/// function, so that this node accumulates all of its input and emits it unordered.
+/// Rows whose pivot key or value is null are ignored.  An error is raised if a group
+/// has more than one non-null value for the same pivot key.
+///
+/// The output has the keys followed by one column for each of the key names.
+class ARROW_ACERO_EXPORT PivotWiderNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "pivot_wider";
+  PivotWiderNodeOptions(std::vector<FieldRef> keys, FieldRef pivot_key,
+                        FieldRef pivot_value, std::vector<std::string> key_names,
+                        compute::PivotWiderOptions::UnexpectedKeyBehavior
+                            unexpected_key_behavior = compute::PivotWiderOptions::IGNORE)
+      : keys(std::move(keys)),
+        pivot_key(std::move(pivot_key)),
+        pivot_value(std::move(pivot_value)),
+        key_names(std::move(key_names)),
+        unexpected_key_behavior(unexpected_key_behavior) {}
+
+  /// The columns identifying an output row, there must be at least one
+  std::vector<FieldRef> keys;
+  /// The string or binary column naming the output column of each value
+  FieldRef pivot_key;
+  /// The column holding the values
+  FieldRef pivot_value;
+  /// The expected pivot keys, which name the output columns
+  std::vector<std::string> key_names;
+  /// What to do with pivot keys not in `key_names`
+  compute::PivotWiderOptions::UnexpectedKeyBehavior unexpected_key_behavior;
+};
+
 /// @}
 
 }  // namespace acero
@@ -22,9 +22,13 @@
 #include <mutex>
 #include <vector>
 #include "arrow/acero/options.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -34,6 +38,11 @@ namespace arrow {
 
 using internal::checked_cast;
 
+using compute::Expression;
+using compute::FilterOptions;
+using compute::NullOptions;
+using compute::SortKey;
+using compute::SortOrder;
 using compute::TakeOptions;
 
 namespace acero {
@@ -44,9 +53,10 @@ class SortBasicImpl : public OrderByImpl {
                 const SortOptions& options = SortOptions{})
       : ctx_(ctx), output_schema_(output_schema), options_(options) {}
 
-  void InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
     std::unique_lock<std::mutex> lock(mutex_);
     batches_.push_back(batch);
+    return Status::OK();
   }
 
   Result<Datum> DoFinish() override {
@@ -69,24 +79,125 @@ class SortBasicImpl : public OrderByImpl {
   const SortOptions options_;
 };  // namespace compute
 
+// Keeps memory bounded by k: whenever 2 * k rows have been buffered they are reduced
+// to the top k rows.  The k-th value of the first sort key of such a reduction is
+// then used to drop input rows that can't make it into the result before buffering.
 class SelectKBasicImpl : public SortBasicImpl {
  public:
   SelectKBasicImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
                    const SelectKOptions& options)
       : SortBasicImpl(ctx, output_schema), options_(options) {}
 
+  Status InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    Expression bound_filter;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      bound_filter = bound_filter_;
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> kept,
+                          ApplyBound(batch, bound_filter));
+
+    std::vector<std::shared_ptr<RecordBatch>> to_reduce;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (kept->num_rows() > 0) {
+        num_rows_ += kept->num_rows();
+        batches_.push_back(std::move(kept));
+      }
+      if (num_rows_ - options_.k < options_.k) {
+        return Status::OK();
+      }
+      to_reduce = std::move(batches_);
+      batches_.clear();
+      num_rows_ = 0;
+    }
+
+    // Reduce outside of the lock so other threads can keep buffering meanwhile
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> top, SelectK(std::move(to_reduce)));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> top_batch,
+                          top->CombineChunksToBatch(ctx_->memory_pool()));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Scalar> bound, KthValue(*top_batch));
+    if (bound) {
+      ARROW_ASSIGN_OR_RAISE(bound_filter, MakeBoundFilter(bound));
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    num_rows_ += top_batch->num_rows();
+    batches_.push_back(std::move(top_batch));
+    // The k-th value of any k input rows is a valid bound
+    if (bound) bound_filter_ = std::move(bound_filter);
+    return Status::OK();
+  }
+
   Result<Datum> DoFinish() override {
     std::unique_lock<std::mutex> lock(mutex_);
-    ARROW_ASSIGN_OR_RAISE(auto table,
-                          Table::FromRecordBatches(output_schema_, std::move(batches_)));
-    ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
-    return Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_);
+    ARROW_ASSIGN_OR_RAISE(auto table, SelectK(std::move(batches_)));
+    return Datum(std::move(table));
   }
 
   std::string ToString() const override { return options_.ToString(); }
 
  private:
+  Result<std::shared_ptr<Table>> SelectK(
+      std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
+    ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum selected,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return selected.table();
+  }
+
+  // Returns the first sort key of the k-th row of `top`, which is ordered, or null if
+  // it can't be used to discard rows
+  Result<std::shared_ptr<Scalar>> KthValue(const RecordBatch& top) {
+    if (top.num_rows() < options_.k) return nullptr;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> keys,
+                          options_.sort_keys[0].target.GetOne(top));
+    const DataType& type = *keys->type();
+    if (!is_primitive(type.id()) && !is_base_binary_like(type.id()) &&
+        !is_decimal(type.id())) {
+      return nullptr;
+    }
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Scalar> value,
+                          keys->GetScalar(options_.k - 1));
+    if (!value->is_valid) return nullptr;
+    if (is_floating(type.id())) {
+      ARROW_ASSIGN_OR_RAISE(Datum is_nan, CallFunction("is_nan", {value}, ctx_));
+      if (is_nan.scalar_as<BooleanScalar>().value) return nullptr;
+    }
+    return value;
+  }
+
+  // Returns the predicate selecting the rows that aren't ordered after `bound`.  Nulls
+  // and NaNs are kept, their ordering depends on the sort order and is left to
+  // select_k_unstable.  It is bound once per bound rather than dispatching its
+  // functions again for every batch.
+  Result<Expression> MakeBoundFilter(const std::shared_ptr<Scalar>& bound) {
+    const SortKey& sort_key = options_.sort_keys[0];
+    Expression keys = compute::field_ref(sort_key.target);
+    const char* compare = sort_key.order == SortOrder::Ascending ? "less_equal"
+                                                                 : "greater_equal";
+    Expression filter =
+        compute::or_(compute::call(compare, {keys, compute::literal(bound)}),
+                     compute::call("is_null", {keys}, NullOptions(/*nan_is_null=*/true)));
+    return filter.Bind(*output_schema_, ctx_);
+  }
+
+  // Drops the rows that `bound_filter` doesn't select, if any
+  Result<std::shared_ptr<RecordBatch>> ApplyBound(
+      const std::shared_ptr<RecordBatch>& batch, const Expression& bound_filter) {
+    if (!bound_filter.is_valid() || batch->num_rows() == 0) return batch;
+    ARROW_ASSIGN_OR_RAISE(Datum mask, compute::ExecuteScalarExpression(
+                                          bound_filter, ExecBatch(*batch), ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum kept,
+                          Filter(batch, mask, FilterOptions::Defaults(), ctx_));
+    return kept.record_batch();
+  }
+
   const SelectKOptions options_;
+  int64_t num_rows_ = 0;
+  Expression bound_filter_;
 };
 
 Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSort(
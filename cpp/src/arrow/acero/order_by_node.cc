@@ -15,7 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <sstream>
@@ -25,7 +28,11 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
@@ -40,13 +47,172 @@ using compute::TakeOptions;
 namespace acero {
 namespace {
 
+// Reads the batches of a sorted run in order, returns null once the run is exhausted
+using SortedRunReader = std::function<Result<std::shared_ptr<RecordBatch>>()>;
+
+// Merges sorted runs into a single sorted stream of batches.
+//
+// The head batch of every run is exposed as one chunk of a virtual table so that the
+// row comparator of the table sort kernel can compare rows of different runs.  Rows
+// are picked from a binary heap of runs.  Whenever the head batch of a run is
+// exhausted the batch being assembled is emitted and the comparator is rebuilt over
+// the new head batches.
+class SortedRunMerger {
+ public:
+  using ResolvedSortKey = compute::internal::ResolvedTableSortKey;
+  using Comparator = compute::internal::MultipleKeyComparator<ResolvedSortKey>;
+
+  SortedRunMerger(std::shared_ptr<Schema> schema, const Ordering& ordering,
+                  std::vector<SortedRunReader> runs, ExecContext* ctx)
+      : schema_(std::move(schema)),
+        ordering_(ordering),
+        runs_(std::move(runs)),
+        ctx_(ctx),
+        heads_(runs_.size()),
+        positions_(runs_.size(), 0) {}
+
+  // Returns the next batch of merged rows, or null once all runs are exhausted
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (!initialized_) {
+      for (int run = 0; run < static_cast<int>(runs_.size()); ++run) {
+        RETURN_NOT_OK(Advance(run));
+      }
+      RETURN_NOT_OK(ResetHeap());
+      initialized_ = true;
+    }
+
+    std::vector<std::pair<int, int64_t>> selection;
+    while (!heap_.empty() && selection.size() < ExecPlan::kMaxBatchSize) {
+      std::pop_heap(heap_.begin(), heap_.end(), heap_order_);
+      int run = heap_.back();
+      selection.emplace_back(run, positions_[run]);
+      if (++positions_[run] < heads_[run]->num_rows()) {
+        std::push_heap(heap_.begin(), heap_.end(), heap_order_);
+        continue;
+      }
+      // The rows selected so far refer to the head batch of `run`, gather them before
+      // moving on to the next batch of the run
+      ARROW_ASSIGN_OR_RAISE(auto out, Gather(selection));
+      RETURN_NOT_OK(Advance(run));
+      RETURN_NOT_OK(ResetHeap());
+      return out;
+    }
+    if (selection.empty()) {
+      return nullptr;
+    }
+    return Gather(selection);
+  }
+
+ private:
+  // Loads the next non-empty batch of `run`
+  Status Advance(int run) {
+    positions_[run] = 0;
+    do {
+      ARROW_ASSIGN_OR_RAISE(heads_[run], runs_[run]());
+    } while (heads_[run] && heads_[run]->num_rows() == 0);
+    return Status::OK();
+  }
+
+  Status ResetHeap() {
+    sort_keys_.clear();
+    for (const compute::SortKey& sort_key : ordering_.sort_keys()) {
+      ARROW_ASSIGN_OR_RAISE(FieldPath path, sort_key.target.FindOne(*schema_));
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Field> field, path.Get(*schema_));
+      const std::shared_ptr<DataType>& type = field->type();
+      std::shared_ptr<DataType> physical_type = GetPhysicalType(type);
+      ArrayVector chunks(heads_.size());
+      int64_t null_count = 0;
+      for (size_t run = 0; run < heads_.size(); ++run) {
+        if (!heads_[run]) continue;
+        ARROW_ASSIGN_OR_RAISE(auto column, path.GetFlattened(*heads_[run]));
+        null_count += column->null_count();
+        chunks[run] = compute::internal::GetPhysicalArray(*column, physical_type);
+      }
+      sort_keys_.emplace_back(type, std::move(chunks), sort_key.order, null_count);
+    }
+    comparator_ = std::make_unique<Comparator>(sort_keys_, ordering_.null_placement());
+    RETURN_NOT_OK(comparator_->status());
+
+    // std::*_heap keep the greatest element first, so order runs by decreasing row
+    heap_order_ = [this](int left, int right) {
+      ::arrow::internal::ChunkLocation left_loc{left, positions_[left]};
+      ::arrow::internal::ChunkLocation right_loc{right, positions_[right]};
+      if (comparator_->Equals(left_loc, right_loc, 0)) {
+        return left > right;
+      }
+      return comparator_->Compare(right_loc, left_loc, 0);
+    };
+    heap_.clear();
+    for (int run = 0; run < static_cast<int>(heads_.size()); ++run) {
+      if (heads_[run]) heap_.push_back(run);
+    }
+    std::make_heap(heap_.begin(), heap_.end(), heap_order_);
+    return Status::OK();
+  }
+
+  // Materializes the selected rows, in order.  Rows are first taken from each head
+  // batch separately and then interleaved, so that the cost is proportional to the
+  // number of rows selected rather than to the size of the head batches.
+  Result<std::shared_ptr<RecordBatch>> Gather(
+      const std::vector<std::pair<int, int64_t>>& selection) {
+    std::vector<std::vector<int64_t>> run_rows(heads_.size());
+    for (const auto& [run, row] : selection) {
+      run_rows[run].push_back(row);
+    }
+
+    RecordBatchVector taken;
+    std::vector<int64_t> run_offsets(heads_.size(), 0);
+    int64_t offset = 0;
+    for (size_t run = 0; run < heads_.size(); ++run) {
+      if (run_rows[run].empty()) continue;
+      Int64Builder builder(ctx_->memory_pool());
+      RETURN_NOT_OK(builder.AppendValues(run_rows[run]));
+      ARROW_ASSIGN_OR_RAISE(auto indices, builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(
+          Datum rows, Take(heads_[run], indices, TakeOptions::NoBoundsCheck(), ctx_));
+      taken.push_back(rows.record_batch());
+      run_offsets[run] = offset;
+      offset += static_cast<int64_t>(run_rows[run].size());
+    }
+    if (taken.size() == 1) {
+      return taken[0];
+    }
+
+    Int64Builder builder(ctx_->memory_pool());
+    RETURN_NOT_OK(builder.Reserve(static_cast<int64_t>(selection.size())));
+    for (const auto& [run, row] : selection) {
+      builder.UnsafeAppend(run_offsets[run]++);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices, builder.Finish());
+    ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(schema_, taken));
+    ARROW_ASSIGN_OR_RAISE(Datum merged,
+                          Take(table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    return merged.table()->CombineChunksToBatch(ctx_->memory_pool());
+  }
+
+  const std::shared_ptr<Schema> schema_;
+  const Ordering& ordering_;
+  std::vector<SortedRunReader> runs_;
+  ExecContext* ctx_;
+  bool initialized_ = false;
+
+  std::vector<std::shared_ptr<RecordBatch>> heads_;
+  std::vector<int64_t> positions_;
+  std::vector<ResolvedSortKey> sort_keys_;
+  std::unique_ptr<Comparator> comparator_;
+  std::function<bool(int, int)> heap_order_;
+  std::vector<int> heap_;
+};
+
 class OrderByNode : public ExecNode, public TracedNode {
  public:
   OrderByNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-              std::shared_ptr<Schema> output_schema, Ordering new_ordering)
+              std::shared_ptr<Schema> output_schema, Ordering new_ordering,
+              int64_t spill_threshold_bytes = -1)
       : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
         TracedNode(this),
-        ordering_(std::move(new_ordering)) {}
+        ordering_(std::move(new_ordering)),
+        spill_threshold_bytes_(spill_threshold_bytes) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -60,7 +226,8 @@ class OrderByNode : public ExecNode, public TracedNode {
 
     std::shared_ptr<Schema> output_schema = inputs[0]->output_schema();
     return plan->EmplaceNode<OrderByNode>(
-        plan, std::move(inputs), std::move(output_schema), order_options.ordering);
+        plan, std::move(inputs), std::move(output_schema), order_options.ordering,
+        order_options.spill_threshold_bytes);
   }
 
   const char* kind_name() const override { return "OrderByNode"; }
@@ -94,15 +261,33 @@ class OrderByNode : public ExecNode, public TracedNode {
   Status StopProducingImpl() override { return Status::OK(); }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
     DCHECK_EQ(input, inputs_[0]);
 
+    int64_t batch_bytes = batch.TotalBufferSize();
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
                           batch.ToRecordBatch(output_schema_));
 
+    QueryContext* ctx = plan_->query_context();
+    if (MemoryBudget* memory_budget = ctx->memory_budget()) {
+      memory_budget->Reserve(batch_bytes);
+    }
+    std::vector<std::shared_ptr<RecordBatch>> run;
+    int64_t run_bytes = 0;
     {
       std::lock_guard lk(mutex_);
       accumulation_queue_.push_back(std::move(record_batch));
+      accumulated_bytes_ += batch_bytes;
+      if (spill_threshold_bytes_ >= 0 && (accumulated_bytes_ > spill_threshold_bytes_ ||
+                                          ctx->memory_budget_exceeded())) {
+        run = std::move(accumulation_queue_);
+        accumulation_queue_.clear();
+        run_bytes = accumulated_bytes_;
+        accumulated_bytes_ = 0;
+      }
+    }
+    if (!run.empty()) {
+      RETURN_NOT_OK(SpillRun(std::move(run), run_bytes));
     }
 
     if (counter_.Increment()) {
@@ -111,22 +296,140 @@ class OrderByNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
-  Status DoFinish() {
-    ARROW_ASSIGN_OR_RAISE(
-        auto table,
-        Table::FromRecordBatches(output_schema_, std::move(accumulation_queue_)));
+  Result<std::shared_ptr<Table>> SortBatches(
+      std::vector<std::shared_ptr<RecordBatch>> batches) {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches)));
     SortOptions sort_options(ordering_.sort_keys(), ordering_.null_placement());
     ExecContext* ctx = plan_->query_context()->exec_context();
     ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, sort_options, ctx));
     ARROW_ASSIGN_OR_RAISE(Datum sorted,
                           Take(table, indices, TakeOptions::NoBoundsCheck(), ctx));
-    const std::shared_ptr<Table>& sorted_table = sorted.table();
+    return sorted.table();
+  }
+
+  // Sorts the batches accumulated so far and writes them out as a sorted run.  Runs
+  // are sorted by the thread that fills them, so sorting overlaps with ingest.
+  Status SpillRun(std::vector<std::shared_ptr<RecordBatch>> batches,
+                  int64_t run_bytes) {
+    QueryContext* ctx = plan_->query_context();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted, SortBatches(std::move(batches)));
+    SpillFile* file;
+    {
+      std::lock_guard lk(mutex_);
+      if (!spill_directory_) {
+        spill_directory_ =
+            std::make_unique<SpillDirectory>("arrow-acero-order-by-spill-");
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          auto run_file, spill_directory_->MakeFile(output_schema_, ctx->memory_pool()));
+      file = run_file.get();
+      spilled_runs_.push_back(std::move(run_file));
+      pending_writes_.fetch_add(1);
+    }
+    auto io_mark = std::make_shared<QueryContext::TempFileIOMark>(
+        ctx, static_cast<size_t>(run_bytes));
+    // The run now counts against the memory budget as being spilled
+    if (MemoryBudget* memory_budget = ctx->memory_budget()) {
+      memory_budget->Release(run_bytes);
+    }
+    ctx->ScheduleIOTask(
+        [this, file, io_mark, sorted = std::move(sorted)]() -> Status {
+          TableBatchReader reader(*sorted);
+          reader.set_chunksize(ExecPlan::kMaxBatchSize);
+          while (true) {
+            ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
+            if (!next) break;
+            RETURN_NOT_OK(file->Write(ExecBatch(*next)));
+          }
+          RETURN_NOT_OK(file->FinishWriting());
+          pending_writes_.fetch_sub(1);
+          return MaybeMergeRuns(/*input_finished=*/false);
+        },
+        "OrderByNode::SpillRun");
+    return Status::OK();
+  }
+
+  // Starts merging the sorted runs once the input is finished and all runs have been
+  // written out
+  Status MaybeMergeRuns(bool input_finished) {
+    {
+      std::lock_guard lk(mutex_);
+      input_finished_ |= input_finished;
+      if (!input_finished_ || merge_started_ || pending_writes_.load() > 0) {
+        return Status::OK();
+      }
+      merge_started_ = true;
+    }
+    if (spilled_runs_.empty()) {
+      return SortAndOutput();
+    }
+    // Reading the runs back is blocking so the merge runs as an IO task
+    plan_->query_context()->ScheduleIOTask([this]() { return MergeRuns(); },
+                                           "OrderByNode::MergeRuns");
+    return Status::OK();
+  }
+
+  Status MergeRuns() {
+    std::vector<SortedRunReader> runs;
+    for (auto& file : spilled_runs_) {
+      runs.push_back([this, file = file.get(),
+                      i = 0]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+        if (i >= file->num_batches()) return nullptr;
+        ARROW_ASSIGN_OR_RAISE(ExecBatch batch, file->ReadBatch(i++));
+        return batch.ToRecordBatch(output_schema_);
+      });
+    }
+    // The batches that never reached the threshold form a last, in-memory, run
+    std::shared_ptr<Table> last_run;
+    std::shared_ptr<TableBatchReader> last_run_reader;
+    if (!accumulation_queue_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(last_run, SortBatches(std::move(accumulation_queue_)));
+      last_run_reader = std::make_shared<TableBatchReader>(*last_run);
+      last_run_reader->set_chunksize(ExecPlan::kMaxBatchSize);
+      runs.push_back([last_run_reader]() { return last_run_reader->Next(); });
+    }
+
+    SortedRunMerger merger(output_schema_, ordering_, std::move(runs),
+                           plan_->query_context()->exec_context());
+    int batch_index = 0;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, merger.Next());
+      if (!next) {
+        ReleaseAccumulatedBytes();
+        return output_->InputFinished(this, batch_index);
+      }
+      ExecBatch exec_batch(*next);
+      exec_batch.index = batch_index++;
+      RETURN_NOT_OK(output_->InputReceived(this, std::move(exec_batch)));
+    }
+  }
+
+  // Called once the input kept in memory is output
+  void ReleaseAccumulatedBytes() {
+    if (MemoryBudget* memory_budget = plan_->query_context()->memory_budget()) {
+      memory_budget->Release(accumulated_bytes_);
+    }
+    accumulated_bytes_ = 0;
+  }
+
+  Status DoFinish() {
+    if (spill_threshold_bytes_ >= 0) {
+      return MaybeMergeRuns(/*input_finished=*/true);
+    }
+    return SortAndOutput();
+  }
+
+  Status SortAndOutput() {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> sorted_table,
+                          SortBatches(std::move(accumulation_queue_)));
     TableBatchReader reader(*sorted_table);
     reader.set_chunksize(ExecPlan::kMaxBatchSize);
     int batch_index = 0;
     while (true) {
       ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next, reader.Next());
       if (!next) {
+        ReleaseAccumulatedBytes();
         return output_->InputFinished(this, batch_index);
       }
       int index = batch_index++;
@@ -152,6 +455,15 @@ class OrderByNode : public ExecNode, public TracedNode {
   Ordering ordering_;
   std::vector<std::shared_ptr<RecordBatch>> accumulation_queue_;
   std::mutex mutex_;
+
+  // External sort state, see OrderByNodeOptions::spill_threshold_bytes
+  const int64_t spill_threshold_bytes_;
+  int64_t accumulated_bytes_ = 0;
+  std::unique_ptr<SpillDirectory> spill_directory_;
+  std::vector<std::unique_ptr<SpillFile>> spilled_runs_;
+  std::atomic<int> pending_writes_{0};
+  bool input_finished_ = false;
+  bool merge_started_ = false;
 };
 
 }  // namespace
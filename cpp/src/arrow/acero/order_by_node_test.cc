@@ -32,6 +32,7 @@ namespace arrow {
 
 using internal::checked_pointer_cast;
 
+using compute::NullPlacement;
 using compute::SortKey;
 using compute::SortOrder;
 
@@ -111,6 +112,58 @@ TEST(OrderByNode, Large) {
   }
 }
 
+TEST(OrderByNode, Spilling) {
+  constexpr int kSpillNumBatches = 16;
+  constexpr int kSpillBatchSize = 1000;
+
+  OrderByNodeOptions spilling({{SortKey("up")}});
+  spilling.spill_threshold_bytes = 0;
+  CheckOrderBy(spilling);
+
+  // Duplicates and nulls in the leading keys, the last key breaks all ties
+  random::RandomArrayGenerator rng(42);
+  auto test_schema =
+      schema({field("i", int32()), field("s", utf8()), field("id", int32())});
+  RecordBatchVector batches;
+  for (int i = 0; i < kSpillNumBatches; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto ids, gen::Step(i * kSpillBatchSize, /*step=*/1,
+                                             /*signed_int=*/true)
+                                       ->Generate(kSpillBatchSize));
+    batches.push_back(RecordBatch::Make(
+        test_schema, kSpillBatchSize,
+        {rng.Int32(kSpillBatchSize, 0, 50, /*null_probability=*/0.1),
+         rng.String(kSpillBatchSize, 0, 2, /*null_probability=*/0.1), ids}));
+  }
+  ASSERT_OK_AND_ASSIGN(auto input, Table::FromRecordBatches(test_schema, batches));
+
+  for (auto null_placement : {NullPlacement::AtStart, NullPlacement::AtEnd}) {
+    Ordering ordering({SortKey("i", SortOrder::Descending), SortKey("s"), SortKey("id")},
+                      null_placement);
+    auto run_order_by = [&](bool use_threads, int64_t spill_threshold_bytes) {
+      OrderByNodeOptions options(ordering);
+      options.spill_threshold_bytes = spill_threshold_bytes;
+      Declaration plan = Declaration::Sequence(
+          {{"table_source", TableSourceNodeOptions(input, kSpillBatchSize)},
+           {"order_by", std::move(options)}});
+      QueryOptions query_options;
+      query_options.sequence_output = true;
+      query_options.use_threads = use_threads;
+      return DeclarationToTable(std::move(plan), query_options);
+    };
+
+    for (bool use_threads : {false, true}) {
+      ASSERT_OK_AND_ASSIGN(auto expected, run_order_by(use_threads, -1));
+      for (int64_t spill_threshold_bytes : {0, 20000, 1 << 30}) {
+        ARROW_SCOPED_TRACE("use_threads = ", use_threads,
+                           ", spill_threshold_bytes = ", spill_threshold_bytes);
+        ASSERT_OK_AND_ASSIGN(auto actual,
+                             run_order_by(use_threads, spill_threshold_bytes));
+        AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+      }
+    }
+  }
+}
+
 TEST(OrderByNode, Invalid) {
   CheckOrderByInvalid(OrderByNodeOptions(Ordering::Implicit()),
                       "`ordering` must be an explicit non-empty ordering");
@@ -226,7 +226,7 @@ class PivotLongerNode : public ExecNode, public TracedNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
     DCHECK_EQ(input, inputs_[0]);
     for (const auto& row_template : templates_) {
       ExecBatch template_batch = ApplyTemplate(row_template, batch);
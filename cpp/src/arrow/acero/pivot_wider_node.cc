@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/util.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/expression.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace acero {
+namespace {
+
+// A pivot_wider node is an aggregate node grouping on the keys, whose hash_pivot_wider
+// aggregate gathers the values of each group into a struct, followed by a project node
+// unpacking that struct into one column per key name.
+Result<ExecNode*> MakePivotWiderNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                     const ExecNodeOptions& options) {
+  RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "PivotWiderNode"));
+  const auto& pivot_options = checked_cast<const PivotWiderNodeOptions&>(options);
+  if (pivot_options.keys.empty()) {
+    return Status::Invalid("A pivot_wider node requires at least one key");
+  }
+  if (pivot_options.key_names.empty()) {
+    return Status::Invalid("A pivot_wider node requires at least one key name");
+  }
+
+  auto aggregate_options = std::make_shared<compute::PivotWiderOptions>(
+      pivot_options.key_names, pivot_options.unexpected_key_behavior);
+  AggregateNodeOptions aggregate_node_options(
+      {compute::Aggregate("hash_pivot_wider", std::move(aggregate_options),
+                          std::vector<FieldRef>{pivot_options.pivot_key,
+                                                pivot_options.pivot_value},
+                          "pivoted")},
+      pivot_options.keys);
+  ARROW_ASSIGN_OR_RAISE(
+      ExecNode * aggregate,
+      MakeExecNode("aggregate", plan, std::move(inputs), aggregate_node_options));
+
+  // The aggregate node outputs the keys, then the struct
+  const auto& aggregate_schema = aggregate->output_schema();
+  const int pivoted_index = aggregate_schema->num_fields() - 1;
+  std::vector<compute::Expression> exprs;
+  std::vector<std::string> names;
+  for (int i = 0; i < pivoted_index; ++i) {
+    exprs.push_back(compute::field_ref(i));
+    names.push_back(aggregate_schema->field(i)->name());
+  }
+  for (int i = 0; i < static_cast<int>(pivot_options.key_names.size()); ++i) {
+    exprs.push_back(compute::field_ref(FieldRef(pivoted_index, i)));
+    names.push_back(pivot_options.key_names[i]);
+  }
+  return MakeExecNode("project", plan, {aggregate},
+                      ProjectNodeOptions(std::move(exprs), std::move(names)));
+}
+
+}  // namespace
+
+namespace internal {
+
+void RegisterPivotWiderNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(PivotWiderNodeOptions::kName),
+                                 MakePivotWiderNode));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/matchers.h"
+
+#include "arrow/table.h"
+
+namespace arrow {
+
+using compute::PivotWiderOptions;
+using compute::SortKey;
+
+namespace acero {
+
+std::shared_ptr<Table> Observations() {
+  return TableFromJSON(schema({field("time", int32()), field("location", utf8()),
+                               field("temp", float64())}),
+                       {R"([
+    [1, "left",  10],
+    [2, "left",  15],
+    [1, "right", 20]
+  ])",
+                        R"([
+    [3, "right", 22],
+    [2, "top",   30],
+    [2, "right", null],
+    [3, null,    40]
+  ])"});
+}
+
+Declaration PivotWiderPlan(std::shared_ptr<Table> input, PivotWiderNodeOptions options) {
+  return Declaration::Sequence({
+      {"table_source", TableSourceNodeOptions(std::move(input), /*max_batch_size=*/2)},
+      {"pivot_wider", std::move(options)},
+  });
+}
+
+TEST(PivotWiderNode, Basic) {
+  PivotWiderNodeOptions options({"time"}, "location", "temp", {"left", "right"});
+  for (bool use_threads : {false, true}) {
+    SCOPED_TRACE(use_threads ? "parallel" : "serial");
+    ASSERT_OK_AND_ASSIGN(
+        std::shared_ptr<Table> output,
+        DeclarationToTable(
+            Declaration::Sequence(
+                {PivotWiderPlan(Observations(), options),
+                 {"order_by", OrderByNodeOptions(Ordering({SortKey("time")}))}}),
+            use_threads));
+    auto expected = TableFromJSON(
+        schema({field("time", int32()), field("left", float64()),
+                field("right", float64())}),
+        {R"([
+    [1, 10,   20],
+    [2, 15,   null],
+    [3, null, 22]
+  ])"});
+    AssertTablesEqual(*expected, *output, /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(PivotWiderNode, RoundTrip) {
+  std::shared_ptr<Table> input = gen::Gen({gen::Step(), gen::Step(), gen::Step()})
+                                     ->FailOnError()
+                                     ->Table(/*rows_per_chunk=*/64, /*num_chunks=*/16);
+
+  PivotLongerNodeOptions longer;
+  longer.feature_field_names = {"feature"};
+  longer.measurement_field_names = {"value"};
+  longer.row_templates = {{{"a"}, {{1}}}, {{"b"}, {{2}}}};
+
+  Declaration plan = Declaration::Sequence({
+      {"table_source", TableSourceNodeOptions(input)},
+      {"pivot_longer", std::move(longer)},
+      {"pivot_wider", PivotWiderNodeOptions({"f0"}, "feature", "value", {"a", "b"})},
+      {"order_by", OrderByNodeOptions(Ordering({SortKey("f0")}))},
+  });
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> output,
+                       DeclarationToTable(std::move(plan)));
+
+  ASSERT_OK_AND_ASSIGN(auto expected, input->RenameColumns({"f0", "a", "b"}));
+  AssertTablesEqual(*expected, *output, /*same_chunk_layout=*/false);
+}
+
+TEST(PivotWiderNode, Errors) {
+  // "top" isn't expected
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      KeyError, ::testing::HasSubstr("Unexpected pivot key: top"),
+      DeclarationToTable(PivotWiderPlan(
+          Observations(), PivotWiderNodeOptions({"time"}, "location", "temp",
+                                                {"left", "right"},
+                                                PivotWiderOptions::RAISE))));
+  // Two values for "left" in the "left" group
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("more than one non-null value"),
+      DeclarationToTable(PivotWiderPlan(
+          Observations(),
+          PivotWiderNodeOptions({"location"}, "location", "temp", {"left"}))));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("at least one key"),
+      DeclarationToTable(PivotWiderPlan(
+          Observations(), PivotWiderNodeOptions({}, "location", "temp", {"left"}))));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("at least one key name"),
+      DeclarationToTable(PivotWiderPlan(
+          Observations(), PivotWiderNodeOptions({"time"}, "location", "temp", {}))));
+}
+
+}  // namespace acero
+}  // namespace arrow
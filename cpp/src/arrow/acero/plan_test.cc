@@ -17,14 +17,18 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <sstream>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/test_nodes.h"
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
 #include "arrow/io/util_internal.h"
@@ -55,10 +59,12 @@ using compute::call;
 using compute::CountOptions;
 using compute::field_ref;
 using compute::ScalarAggregateOptions;
+using compute::SelectKUnstable;
 using compute::SortKey;
 using compute::SortOrder;
 using compute::Take;
 using compute::TDigestOptions;
+using compute::VarianceOptions;
 
 namespace acero {
 
@@ -456,6 +462,8 @@ TEST(ExecPlanExecution, SinkNodeBackpressure) {
   ASSERT_FINISHES_OK(sink_gen());
   BusyWait(10, [&] { return !backpressure_monitor->is_paused(); });
   ASSERT_FALSE(backpressure_monitor->is_paused());
+  // The source is expected to have accounted for the time spent paused
+  ASSERT_GT(plan->GetStats().nodes[0].paused_time_nanos, 0);
 
   // Cleanup
   batch_producer.producer().Push(IterationEnd<std::optional<ExecBatch>>());
@@ -560,6 +568,53 @@ custom_sink_label:OrderBySinkNode{by={sort_keys=[FieldRef.Name(sum(multiply(i32,
 )a");
 }
 
+TEST(ExecPlan, Stats) {
+  auto basic_data = MakeBasicBatches();
+  AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ExecPlan> plan, ExecPlan::Make());
+  ASSERT_OK(Declaration::Sequence(
+                {{"source", SourceNodeOptions{basic_data.schema,
+                                              basic_data.gen(/*parallel=*/false,
+                                                             /*slow=*/false)}},
+                 {"filter", FilterNodeOptions{equal(field_ref("i32"), literal(6))}},
+                 {"sink", SinkNodeOptions{&sink_gen}}})
+                .AddToPlan(plan.get()));
+  ASSERT_FINISHES_OK(StartAndCollect(plan.get(), sink_gen));
+
+  ExecPlanStats stats = plan->GetStats();
+  ASSERT_EQ(stats.nodes.size(), 3);
+  const ExecNodeStats& source = stats.nodes[0];
+  const ExecNodeStats& filter = stats.nodes[1];
+  const ExecNodeStats& sink = stats.nodes[2];
+  EXPECT_EQ(source.kind_name, "SourceNode");
+  EXPECT_EQ(filter.kind_name, "FilterNode");
+  EXPECT_EQ(sink.kind_name, "SinkNode");
+
+  EXPECT_EQ(source.input_batches, 0);
+  EXPECT_EQ(source.output_batches, 2);
+  EXPECT_EQ(source.output_rows, 5);
+  EXPECT_EQ(filter.input_batches, 2);
+  EXPECT_EQ(filter.input_rows, 5);
+  EXPECT_EQ(filter.input_bytes, source.output_bytes);
+  EXPECT_EQ(filter.output_batches, 2);
+  EXPECT_EQ(filter.output_rows, 1);
+  EXPECT_EQ(sink.input_batches, 2);
+  EXPECT_EQ(sink.input_rows, 1);
+  EXPECT_EQ(sink.input_bytes, filter.output_bytes);
+  EXPECT_EQ(sink.output_batches, 0);
+
+  EXPECT_GE(filter.processing_time_nanos, 0);
+  EXPECT_GE(sink.processing_time_nanos, 0);
+  EXPECT_EQ(source.paused_time_nanos, 0);
+  EXPECT_GT(stats.peak_memory_bytes, 0);
+
+  std::string plan_str = plan->ToStringWithStats();
+  EXPECT_THAT(plan_str, HasSubstr("nodes (peak memory: "));
+  EXPECT_THAT(plan_str,
+              HasSubstr(":FilterNode{filter=(i32 == 6)} [in: 2 batches, 5 rows, "));
+  EXPECT_THAT(plan_str, HasSubstr(":SinkNode{} [in: 2 batches, 1 rows, "));
+}
+
 TEST(ExecPlanExecution, CustomFieldNames) {
   auto generator = gen::Gen({{"x", gen::Step()}})->FailOnError();
   std::vector<::arrow::compute::ExecBatch> ebatches =
@@ -1041,6 +1096,172 @@ TEST(ExecPlanExecution, SourceProjectSink) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
 }
 
+TEST(ExecPlanExecution, SourceFilterProjectSink) {
+  // The filter only materializes the fields read by the projection
+  auto basic_data = MakeBasicBatches();
+  auto make_plan = [&](ProjectNodeOptions project_options) {
+    return Declaration::Sequence(
+        {{"source",
+          SourceNodeOptions{basic_data.schema,
+                            basic_data.gen(/*parallel=*/false, /*slow=*/false)}},
+         {"filter", FilterNodeOptions{greater_equal(field_ref("i32"), literal(5))}},
+         {"project", std::move(project_options)}});
+  };
+
+  ASSERT_OK_AND_ASSIGN(
+      auto result,
+      DeclarationToExecBatches(make_plan(ProjectNodeOptions{
+          {call("add", {field_ref("i32"), literal(1)}), literal(true)}, {"a", "b"}})));
+  std::vector<ExecBatch> exp_batches = {
+      ExecBatchFromJSON({int32(), boolean()}, "[]"),
+      ExecBatchFromJSON({int32(), boolean()}, "[[6, true], [7, true], [8, true]]")};
+  AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
+
+  // No field is read at all
+  ASSERT_OK_AND_ASSIGN(result, DeclarationToExecBatches(make_plan(
+                                   ProjectNodeOptions{{literal(true)}, {"b"}})));
+  exp_batches = {ExecBatchFromJSON({boolean()}, "[]"),
+                 ExecBatchFromJSON({boolean()}, "[[true], [true], [true]]")};
+  AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
+}
+
+// Interprets the expressions, counting how often it is used
+class CountingExpressionCompiler : public ExpressionCompiler {
+ public:
+  class Compiled : public CompiledExpressions {
+   public:
+    Compiled(std::vector<Expression> exprs, std::atomic<int>* num_executed)
+        : exprs_(std::move(exprs)), num_executed_(num_executed) {}
+
+    Result<std::vector<Datum>> Execute(const ExecBatch& batch,
+                                       ExecContext* exec_context) override {
+      ++*num_executed_;
+      return compute::ExecuteScalarExpressions(exprs_, batch, exec_context);
+    }
+
+   private:
+    std::vector<Expression> exprs_;
+    std::atomic<int>* num_executed_;
+  };
+
+  Result<std::unique_ptr<CompiledExpressions>> Compile(
+      const std::vector<Expression>& exprs,
+      const std::shared_ptr<Schema>& schema) override {
+    ++num_compiled;
+    if (exprs[0].call() == nullptr) return nullptr;
+    return std::make_unique<Compiled>(exprs, &num_executed);
+  }
+
+  std::atomic<int> num_compiled{0};
+  std::atomic<int> num_executed{0};
+};
+
+TEST(ExecPlanExecution, SourceFilterProjectSinkCompiled) {
+  auto basic_data = MakeBasicBatches();
+  Declaration plan = Declaration::Sequence(
+      {{"source",
+        SourceNodeOptions{basic_data.schema,
+                          basic_data.gen(/*parallel=*/false, /*slow=*/false)}},
+       {"filter", FilterNodeOptions{greater_equal(field_ref("i32"), literal(5))}},
+       {"project", ProjectNodeOptions{{call("add", {field_ref("i32"), literal(1)}),
+                                       field_ref("bool")},
+                                      {"a", "b"}}}});
+
+  auto compiler = std::make_shared<CountingExpressionCompiler>();
+  QueryOptions query_options;
+  query_options.expression_compiler = compiler;
+  ASSERT_OK_AND_ASSIGN(auto result, DeclarationToExecBatches(plan, query_options));
+  std::vector<ExecBatch> exp_batches = {
+      ExecBatchFromJSON({int32(), boolean()}, "[]"),
+      ExecBatchFromJSON({int32(), boolean()}, "[[6, null], [7, false], [8, false]]")};
+  AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
+  // Both nodes compile their expressions once and evaluate them for each batch
+  ASSERT_EQ(compiler->num_compiled, 2);
+  ASSERT_EQ(compiler->num_executed, 2 * static_cast<int>(basic_data.batches.size()));
+
+  // Expressions that are not compiled are interpreted
+  plan = Declaration::Sequence(
+      {{"source",
+        SourceNodeOptions{basic_data.schema,
+                          basic_data.gen(/*parallel=*/false, /*slow=*/false)}},
+       {"project", ProjectNodeOptions{{field_ref("i32")}, {"a"}}}});
+  compiler = std::make_shared<CountingExpressionCompiler>();
+  query_options.expression_compiler = compiler;
+  ASSERT_OK_AND_ASSIGN(result, DeclarationToExecBatches(plan, query_options));
+  ASSERT_EQ(compiler->num_compiled, 1);
+  ASSERT_EQ(compiler->num_executed, 0);
+}
+
+// Also selects the rows of filters, interpreting their predicate
+class SelectingExpressionCompiler : public CountingExpressionCompiler {
+ public:
+  class Selection : public CompiledFilter {
+   public:
+    Selection(Expression predicate, std::atomic<int>* num_selected)
+        : predicate_(std::move(predicate)), num_selected_(num_selected) {}
+
+    Result<std::shared_ptr<Array>> Select(const ExecBatch& batch,
+                                          ExecContext* exec_context) override {
+      ++*num_selected_;
+      ARROW_ASSIGN_OR_RAISE(
+          Datum mask, compute::ExecuteScalarExpression(predicate_, batch, exec_context));
+      if (mask.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(mask, MakeArrayFromScalar(*mask.scalar(), batch.length));
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          Datum indices, compute::CallFunction("indices_nonzero", {mask}, exec_context));
+      return indices.make_array();
+    }
+
+   private:
+    Expression predicate_;
+    std::atomic<int>* num_selected_;
+  };
+
+  Result<std::unique_ptr<CompiledFilter>> CompileFilter(
+      const Expression& predicate, const std::shared_ptr<Schema>& schema) override {
+    ++num_compiled;
+    return std::make_unique<Selection>(predicate, &num_selected);
+  }
+
+  std::atomic<int> num_selected{0};
+};
+
+TEST(ExecPlanExecution, SourceFilterProjectSinkCompiledPerNode) {
+  auto basic_data = MakeBasicBatches();
+  auto filter_compiler = std::make_shared<SelectingExpressionCompiler>();
+  auto project_compiler = std::make_shared<CountingExpressionCompiler>();
+  FilterNodeOptions filter_options{greater_equal(field_ref("i32"), literal(5))};
+  filter_options.expression_compiler = filter_compiler;
+  ProjectNodeOptions project_options{
+      {call("add", {field_ref("i32"), literal(1)}), field_ref("bool")}, {"a", "b"}};
+  project_options.expression_compiler = project_compiler;
+  Declaration plan = Declaration::Sequence(
+      {{"source",
+        SourceNodeOptions{basic_data.schema,
+                          basic_data.gen(/*parallel=*/false, /*slow=*/false)}},
+       {"filter", std::move(filter_options)},
+       {"project", std::move(project_options)}});
+
+  // The compilers of the nodes take precedence over the one of the query
+  auto query_compiler = std::make_shared<CountingExpressionCompiler>();
+  QueryOptions query_options;
+  query_options.expression_compiler = query_compiler;
+  ASSERT_OK_AND_ASSIGN(auto result, DeclarationToExecBatches(plan, query_options));
+  std::vector<ExecBatch> exp_batches = {
+      ExecBatchFromJSON({int32(), boolean()}, "[]"),
+      ExecBatchFromJSON({int32(), boolean()}, "[[6, null], [7, false], [8, false]]")};
+  AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
+  const int num_batches = static_cast<int>(basic_data.batches.size());
+  ASSERT_EQ(query_compiler->num_compiled, 0);
+  // The filter selects the rows instead of computing a mask
+  ASSERT_EQ(filter_compiler->num_compiled, 1);
+  ASSERT_EQ(filter_compiler->num_selected, num_batches);
+  ASSERT_EQ(filter_compiler->num_executed, 0);
+  ASSERT_EQ(project_compiler->num_compiled, 1);
+  ASSERT_EQ(project_compiler->num_executed, num_batches);
+}
+
 TEST(ExecPlanExecution, ProjectMaintainsOrder) {
   RegisterTestNodes();
   constexpr int kRandomSeed = 42;
@@ -1338,6 +1559,54 @@ TEST(ExecPlanExecution, SourceFilterProjectGroupedSumTopK) {
   }
 }
 
+TEST(ExecPlanExecution, SourceSelectKSinkManyBatches) {
+  // Enough batches for the buffered rows to be reduced to k several times
+  BatchesWithSchema input;
+  input.schema = schema({field("key", int32()), field("id", int32())});
+  for (int batch_index = 0; batch_index < 20; ++batch_index) {
+    std::stringstream json;
+    json << '[';
+    for (int row = 0; row < 50; ++row) {
+      int id = batch_index * 50 + row;
+      if (row > 0) json << ", ";
+      json << '[';
+      if (id % 13 == 0) {
+        json << "null";
+      } else {
+        json << (id * 37) % 101;
+      }
+      json << ", " << id << ']';
+    }
+    json << ']';
+    input.batches.push_back(ExecBatchFromJSON({int32(), int32()}, json.str()));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, TableFromExecBatches(input.schema, input.batches));
+
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "serial");
+    for (SortOrder order : {SortOrder::Ascending, SortOrder::Descending}) {
+      SelectKOptions options(
+          /*k=*/7, {SortKey("key", order), SortKey("id", SortOrder::Ascending)});
+      ASSERT_OK_AND_ASSIGN(auto indices, SelectKUnstable(table, options));
+      ASSERT_OK_AND_ASSIGN(Datum expected, Take(table, indices));
+
+      ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+      AsyncGenerator<std::optional<ExecBatch>> sink_gen;
+      ASSERT_OK(
+          Declaration::Sequence(
+              {
+                  {"source",
+                   SourceNodeOptions{input.schema, input.gen(parallel, /*slow=*/false)}},
+                  {"select_k_sink", SelectKSinkNodeOptions{options, &sink_gen}},
+              })
+              .AddToPlan(plan.get()));
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, StartAndCollect(plan.get(), sink_gen));
+      ASSERT_OK_AND_ASSIGN(auto actual, TableFromExecBatches(input.schema, batches));
+      AssertTablesEqual(*expected.table(), *actual, /*same_chunk_layout=*/false);
+    }
+  }
+}
+
 TEST(ExecPlanExecution, SourceScalarAggSink) {
   auto basic_data = MakeBasicBatches();
 
@@ -1354,6 +1623,46 @@ TEST(ExecPlanExecution, SourceScalarAggSink) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, result.batches, exp_batches);
 }
 
+TEST(ExecPlanExecution, SourceScalarAggSinkFused) {
+  // Aggregates sharing a numeric column are computed with a single pass over it,
+  // which must yield the same results as computing each of them on its own
+  for (const auto& type : {int8(), int32(), uint64(), float32(), float64()}) {
+    SCOPED_TRACE(type->ToString());
+    auto random_data = MakeRandomBatches(schema({field("x", type)}), /*num_batches=*/10);
+    std::vector<Aggregate> aggregates = {
+        {"count", nullptr, "x", "count"},
+        {"count", std::make_shared<CountOptions>(CountOptions::ONLY_NULL), "x",
+         "count_null"},
+        {"sum", nullptr, "x", "sum"},
+        {"mean", nullptr, "x", "mean"},
+        {"mean", std::make_shared<ScalarAggregateOptions>(/*skip_nulls=*/false), "x",
+         "mean_no_skip"},
+        {"min", nullptr, "x", "min"},
+        {"max", nullptr, "x", "max"},
+        {"min_max", nullptr, "x", "min_max"},
+        {"variance", std::make_shared<VarianceOptions>(/*ddof=*/1), "x", "variance"},
+        {"stddev", nullptr, "x", "stddev"},
+    };
+    auto run = [&](std::vector<Aggregate> aggs) {
+      return DeclarationToTable(
+          Declaration::Sequence(
+              {{"source", SourceNodeOptions{random_data.schema,
+                                            random_data.gen(/*parallel=*/false,
+                                                            /*slow=*/false)}},
+               {"aggregate", AggregateNodeOptions{std::move(aggs)}}}),
+          /*use_threads=*/false);
+    };
+
+    ASSERT_OK_AND_ASSIGN(auto fused, run(aggregates));
+    for (int i = 0; i < static_cast<int>(aggregates.size()); ++i) {
+      SCOPED_TRACE(aggregates[i].name);
+      ASSERT_OK_AND_ASSIGN(auto single, run({aggregates[i]}));
+      ASSERT_OK_AND_ASSIGN(auto expected, fused->SelectColumns({i}));
+      AssertTablesEqual(*expected, *single);
+    }
+  }
+}
+
 TEST(ExecPlanExecution, AggregationPreservesOptions) {
   // ARROW-13638: aggregation nodes initialize per-thread kernel state lazily
   // and need to keep a copy/strong reference to function options
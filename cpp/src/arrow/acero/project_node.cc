@@ -18,6 +18,7 @@
 #include <sstream>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/expression_compiler.h"
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
@@ -42,9 +43,11 @@ namespace {
 class ProjectNode : public MapNode {
  public:
   ProjectNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
-              std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs)
+              std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs,
+              std::shared_ptr<ExpressionCompiler> compiler)
       : MapNode(plan, std::move(inputs), std::move(output_schema)),
-        exprs_(std::move(exprs)) {}
+        exprs_(std::move(exprs)),
+        compiler_(std::move(compiler)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -71,27 +74,82 @@ class ProjectNode : public MapNode {
       fields[i] = field(std::move(names[i]), expr.type()->GetSharedPtr());
       ++i;
     }
+    auto compiler = project_options.expression_compiler
+                        ? project_options.expression_compiler
+                        : plan->query_context()->options().expression_compiler;
     return plan->EmplaceNode<ProjectNode>(plan, std::move(inputs),
-                                          schema(std::move(fields)), std::move(exprs));
+                                          schema(std::move(fields)), std::move(exprs),
+                                          std::move(compiler));
   }
 
   const char* kind_name() const override { return "ProjectNode"; }
 
+  bool AddRuntimeFilter(std::shared_ptr<RuntimeFilter> filter,
+                        std::vector<int> key_ids) override {
+    // The filter can only be forwarded if its keys are projected unchanged
+    const Schema& input_schema = *inputs_[0]->output_schema();
+    for (int& key_id : key_ids) {
+      const FieldRef* ref = exprs_[key_id].field_ref();
+      if (ref == nullptr) return false;
+      auto match = ref->FindOne(input_schema);
+      if (!match.ok() || match->indices().size() != 1) return false;
+      key_id = (*match)[0];
+    }
+    return inputs_[0]->AddRuntimeFilter(std::move(filter), std::move(key_ids));
+  }
+
+  // Rows are projected one for one and in order
+  bool SetRowLimit(int64_t num_rows) override {
+    return inputs_[0]->SetRowLimit(num_rows);
+  }
+
+  Status Init() override {
+    // Only the fields referenced by the expressions need to be materialized upstream,
+    // e.g. a filter can then skip copying the rows of the other fields
+    const Schema& input_schema = *inputs_[0]->output_schema();
+    std::vector<bool> is_read(input_schema.num_fields(), false);
+    for (const Expression& expr : exprs_) {
+      for (const FieldRef& ref : FieldsInExpression(expr)) {
+        ARROW_ASSIGN_OR_RAISE(FieldPath path, ref.FindOne(input_schema));
+        is_read[path[0]] = true;
+      }
+    }
+    std::vector<int> field_ids;
+    for (int i = 0; i < input_schema.num_fields(); ++i) {
+      if (is_read[i]) field_ids.push_back(i);
+    }
+    if (static_cast<int>(field_ids.size()) < input_schema.num_fields()) {
+      inputs_[0]->SetFieldsRead(field_ids);
+    }
+    if (compiler_) {
+      ARROW_ASSIGN_OR_RAISE(compiled_exprs_,
+                            compiler_->Compile(exprs_, inputs_[0]->output_schema()));
+    }
+    return MapNode::Init();
+  }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
-    std::vector<Datum> values{exprs_.size()};
+    arrow::util::tracing::Span span;
+    START_COMPUTE_SPAN(
+        span, "Project",
+        {{"project.length", batch.length},
+         {"project.num_expressions", static_cast<int64_t>(exprs_.size())}});
+    if (compiled_exprs_) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::vector<Datum> values,
+          compiled_exprs_->Execute(batch, plan()->query_context()->exec_context()));
+      return ExecBatch{std::move(values), batch.length};
+    }
+    std::vector<Expression> simplified_exprs(exprs_.size());
     for (size_t i = 0; i < exprs_.size(); ++i) {
-      arrow::util::tracing::Span span;
-      START_COMPUTE_SPAN(span, "Project",
-                         {{"project.type", exprs_[i].type()->ToString()},
-                          {"project.length", batch.length},
-                          {"project.expression", exprs_[i].ToString()}});
-      ARROW_ASSIGN_OR_RAISE(Expression simplified_expr,
+      ARROW_ASSIGN_OR_RAISE(simplified_exprs[i],
                             SimplifyWithGuarantee(exprs_[i], batch.guarantee));
-
-      ARROW_ASSIGN_OR_RAISE(
-          values[i], ExecuteScalarExpression(simplified_expr, batch,
-                                             plan()->query_context()->exec_context()));
     }
+    // Subexpressions shared between the projected columns are only computed once
+    ARROW_ASSIGN_OR_RAISE(
+        std::vector<Datum> values,
+        ExecuteScalarExpressions(simplified_exprs, batch,
+                                 plan()->query_context()->exec_context()));
     return ExecBatch{std::move(values), batch.length};
   }
 
@@ -113,6 +171,8 @@ class ProjectNode : public MapNode {
 
  private:
   std::vector<Expression> exprs_;
+  std::shared_ptr<ExpressionCompiler> compiler_;
+  std::unique_ptr<CompiledExpressions> compiled_exprs_;
 };
 
 }  // namespace
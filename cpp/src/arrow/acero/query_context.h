@@ -19,6 +19,7 @@
 #include <string_view>
 
 #include "arrow/acero/exec_plan.h"
+#include "arrow/acero/memory_budget.h"
 #include "arrow/acero/task_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
@@ -49,6 +50,12 @@ class ARROW_ACERO_EXPORT QueryContext {
   IOContext* io_context() { return &io_context_; }
   TaskScheduler* scheduler() { return task_scheduler_.get(); }
   arrow::util::AsyncTaskScheduler* async_scheduler() { return async_scheduler_; }
+  /// \brief The memory budget of the plan, null if there is none
+  MemoryBudget* memory_budget() const { return options_.memory_budget.get(); }
+  /// \brief True if the plan has a memory budget and it is exceeded
+  bool memory_budget_exceeded() const {
+    return options_.memory_budget != NULLPTR && options_.memory_budget->exceeded();
+  }
 
   size_t GetThreadIndex();
   size_t max_concurrency() const;
@@ -121,12 +128,18 @@ class ARROW_ACERO_EXPORT QueryContext {
 
     TempFileIOMark(QueryContext* ctx, size_t bytes) : ctx_(ctx), bytes_(bytes) {
       ctx_->in_flight_bytes_to_disk_.fetch_add(bytes_, std::memory_order_acquire);
+      if (MemoryBudget* budget = ctx_->memory_budget()) {
+        budget->StartSpilling(static_cast<int64_t>(bytes_));
+      }
     }
 
     ARROW_DISALLOW_COPY_AND_ASSIGN(TempFileIOMark);
 
     ~TempFileIOMark() {
       ctx_->in_flight_bytes_to_disk_.fetch_sub(bytes_, std::memory_order_release);
+      if (MemoryBudget* budget = ctx_->memory_budget()) {
+        budget->FinishSpilling(static_cast<int64_t>(bytes_));
+      }
     }
   };
 
@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/runtime_filter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "arrow/acero/bloom_filter.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using compute::FilterOptions;
+using compute::Hashing32;
+using compute::KeyColumnArray;
+
+namespace acero {
+
+void RuntimeFilter::Publish(std::shared_ptr<BlockedBloomFilter> bloom_filter) {
+  DCHECK(!is_ready());
+  bloom_filter_ = std::move(bloom_filter);
+  ready_.store(true, std::memory_order_release);
+}
+
+void RuntimeFilterSet::Add(std::shared_ptr<RuntimeFilter> filter,
+                           std::vector<int> key_ids) {
+  filters_.push_back(std::move(filter));
+  key_ids_.push_back(std::move(key_ids));
+}
+
+Status RuntimeFilterSet::Apply(QueryContext* ctx, size_t thread_index,
+                               ExecBatch* batch_ptr) const {
+  ExecBatch& batch = *batch_ptr;
+  if (batch.length == 0) return Status::OK();
+
+  int64_t bit_vector_bytes = bit_util::BytesForBits(batch.length);
+  std::vector<uint8_t> selected;
+  std::vector<uint32_t> hashes(batch.length);
+  std::vector<uint8_t> bv(bit_vector_bytes);
+
+  ARROW_ASSIGN_OR_RAISE(arrow::util::TempVectorStack * stack,
+                        ctx->GetTempStack(thread_index));
+
+  for (size_t ifilter = 0; ifilter < filters_.size(); ifilter++) {
+    if (!filters_[ifilter]->is_ready()) continue;
+    if (selected.empty()) {
+      // Start with full selection for the current batch
+      selected.resize(bit_vector_bytes, 0xff);
+    }
+    std::vector<Datum> keys(key_ids_[ifilter].size());
+    for (size_t i = 0; i < keys.size(); i++) {
+      keys[i] = batch[key_ids_[ifilter][i]];
+      if (keys[i].is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(
+            keys[i],
+            MakeArrayFromScalar(*keys[i].scalar(), batch.length, ctx->memory_pool()));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(keys)));
+    std::vector<KeyColumnArray> temp_column_arrays;
+    RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data(), temp_column_arrays,
+                                       ctx->cpu_info()->hardware_flags(), stack, 0,
+                                       key_batch.length));
+
+    filters_[ifilter]->bloom_filter().Find(ctx->cpu_info()->hardware_flags(),
+                                           key_batch.length, hashes.data(), bv.data());
+    arrow::internal::BitmapAnd(bv.data(), 0, selected.data(), 0, key_batch.length, 0,
+                               selected.data());
+  }
+  if (selected.empty()) return Status::OK();
+
+  int64_t num_selected = arrow::internal::CountSetBits(selected.data(), 0, batch.length);
+  if (num_selected == batch.length) return Status::OK();
+
+  auto selected_buffer = std::make_unique<Buffer>(selected.data(), bit_vector_bytes);
+  ArrayData selected_arraydata(boolean(), batch.length,
+                               {nullptr, std::move(selected_buffer)});
+  Datum selected_datum(selected_arraydata);
+  FilterOptions options;
+  for (size_t i = 0; i < batch.values.size(); i++) {
+    if (!batch.values[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(batch.values[i],
+                            compute::Filter(batch.values[i], selected_datum, options,
+                                            ctx->exec_context()));
+      ARROW_DCHECK_EQ(batch.values[i].length(), num_selected);
+    }
+  }
+  batch.length = num_selected;
+  return Status::OK();
+}
+
+}  // namespace acero
+}  // namespace arrow
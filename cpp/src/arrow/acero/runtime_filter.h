@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "arrow/acero/type_fwd.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace acero {
+
+class BlockedBloomFilter;
+
+/// \brief A Bloom filter on the build-side keys of a hash join, published at runtime
+///
+/// A hash join creates its runtime filter during Init() and offers it to the nodes on
+/// its probe side (see ExecNode::AddRuntimeFilter).  The Bloom filter is published
+/// once the build side has been accumulated.  From then on the nodes which accepted
+/// the filter drop the rows whose keys certainly have no match.  Rows seen before that
+/// pass through unchanged, which is always correct since the join still probes them.
+class ARROW_ACERO_EXPORT RuntimeFilter {
+ public:
+  /// \brief Make the Bloom filter available to the nodes applying this filter
+  ///
+  /// This must be called at most once.
+  void Publish(std::shared_ptr<BlockedBloomFilter> bloom_filter);
+
+  bool is_ready() const { return ready_.load(std::memory_order_acquire); }
+
+  /// \brief The published Bloom filter, only valid once is_ready() is true
+  const BlockedBloomFilter& bloom_filter() const { return *bloom_filter_; }
+
+ private:
+  std::shared_ptr<BlockedBloomFilter> bloom_filter_;
+  std::atomic<bool> ready_{false};
+};
+
+/// \brief The runtime filters applied by a node to its batches
+///
+/// Filters must all be added before the set is first applied, typically from Init().
+class ARROW_ACERO_EXPORT RuntimeFilterSet {
+ public:
+  /// \brief Add a filter whose keys are the given columns of the batches, in order
+  void Add(std::shared_ptr<RuntimeFilter> filter, std::vector<int> key_ids);
+
+  bool empty() const { return filters_.empty(); }
+  size_t size() const { return filters_.size(); }
+
+  /// \brief Remove the rows of `batch` which are rejected by any of the ready filters
+  ///
+  /// The batch is left untouched if no filter is ready yet or all rows are accepted.
+  Status Apply(QueryContext* ctx, size_t thread_index, compute::ExecBatch* batch) const;
+
+ private:
+  std::vector<std::shared_ptr<RuntimeFilter>> filters_;
+  std::vector<std::vector<int>> key_ids_;
+};
+
+}  // namespace acero
+}  // namespace arrow
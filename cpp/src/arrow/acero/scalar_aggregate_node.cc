@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <map>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
@@ -52,10 +53,54 @@ using compute::KernelState;
 using compute::RowSegmenter;
 using compute::ScalarAggregateKernel;
 using compute::Segment;
+using compute::internal::FusedScalarAggregator;
 
 namespace acero {
 namespace aggregate {
 
+namespace {
+
+// Group the aggregates a FusedScalarAggregator can compute by their target column, so
+// that a column targeted by several of them is scanned once per batch
+Result<std::vector<FusedAggregates>> MakeFusedAggregates(
+    const Schema& input_schema, const std::vector<Aggregate>& aggs,
+    const std::vector<std::vector<int>>& target_fieldsets, ExecContext* exec_ctx,
+    size_t concurrency) {
+  std::map<int, std::vector<int>> candidates;
+  for (size_t i = 0; i < aggs.size(); ++i) {
+    if (target_fieldsets[i].size() != 1) continue;
+    const int field_id = target_fieldsets[i][0];
+    if (!FusedScalarAggregator::CanFuse(aggs[i], *input_schema.field(field_id)->type())) {
+      continue;
+    }
+    // A custom registry may bind the name to a different function
+    auto function = exec_ctx->func_registry()->GetFunction(aggs[i].function);
+    auto builtin = compute::GetFunctionRegistry()->GetFunction(aggs[i].function);
+    if (!function.ok() || !builtin.ok() || *function != *builtin) continue;
+    candidates[field_id].push_back(static_cast<int>(i));
+  }
+
+  std::vector<FusedAggregates> fused;
+  for (auto& [field_id, aggregate_ids] : candidates) {
+    if (aggregate_ids.size() < 2) continue;
+    std::vector<Aggregate> fused_aggs;
+    for (int id : aggregate_ids) {
+      fused_aggs.push_back(aggs[id]);
+    }
+    FusedAggregates fused_aggregates{std::move(aggregate_ids), field_id, {}};
+    for (size_t i = 0; i < concurrency; ++i) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto state,
+          FusedScalarAggregator::Make(input_schema.field(field_id)->type(), fused_aggs));
+      fused_aggregates.states.push_back(std::move(state));
+    }
+    fused.push_back(std::move(fused_aggregates));
+  }
+  return fused;
+}
+
+}  // namespace
+
 Result<AggregateNodeArgs<ScalarAggregateKernel>>
 ScalarAggregateNode::MakeAggregateNodeArgs(const std::shared_ptr<Schema>& input_schema,
                                            const std::vector<FieldRef>& keys,
@@ -195,15 +240,25 @@ Result<ExecNode*> ScalarAggregateNode::Make(ExecPlan* plan, std::vector<ExecNode
     }
   }
 
+  ARROW_ASSIGN_OR_RAISE(auto fused,
+                        MakeFusedAggregates(*input_schema, args.aggregates,
+                                            args.target_fieldsets, exec_ctx, concurrency));
+
   return plan->EmplaceNode<ScalarAggregateNode>(
       plan, std::move(inputs), std::move(args.output_schema), std::move(args.segmenter),
       std::move(args.segment_key_field_ids), std::move(args.target_fieldsets),
       std::move(args.aggregates), std::move(args.kernels), std::move(args.kernel_intypes),
-      std::move(args.states));
+      std::move(args.states), std::move(fused));
 }
 
 Status ScalarAggregateNode::DoConsume(const ExecSpan& batch, size_t thread_index) {
+  for (auto& fused_aggregates : fused_) {
+    DCHECK_LT(thread_index, fused_aggregates.states.size());
+    RETURN_NOT_OK(fused_aggregates.states[thread_index]->Consume(
+        batch.values[fused_aggregates.target_field_id], batch.length));
+  }
   for (size_t i = 0; i < kernels_.size(); ++i) {
+    if (is_fused_[i]) continue;
     arrow::util::tracing::Span span;
     START_COMPUTE_SPAN(span, aggs_[i].function,
                        {{"function.name", aggs_[i].function},
@@ -225,7 +280,7 @@ Status ScalarAggregateNode::DoConsume(const ExecSpan& batch, size_t thread_index
 }
 
 Status ScalarAggregateNode::InputReceived(ExecNode* input, ExecBatch batch) {
-  auto scope = TraceInputReceived(batch);
+  auto scope = TraceInputReceived(input, batch);
   DCHECK_EQ(input, inputs_[0]);
 
   auto thread_index = plan_->query_context()->GetThreadIndex();
@@ -275,7 +330,13 @@ std::string ScalarAggregateNode::ToStringExtra(int indent) const {
 
 Status ScalarAggregateNode::ResetKernelStates() {
   auto exec_ctx = plan()->query_context()->exec_context();
+  for (auto& fused_aggregates : fused_) {
+    for (auto& state : fused_aggregates.states) {
+      state->Reset();
+    }
+  }
   for (size_t i = 0; i < kernels_.size(); ++i) {
+    if (is_fused_[i]) continue;
     states_[i].resize(plan()->query_context()->max_concurrency());
     KernelContext kernel_ctx{exec_ctx};
     RETURN_NOT_OK(Kernel::InitAll(
@@ -295,7 +356,19 @@ Status ScalarAggregateNode::OutputResult(bool is_last) {
 
   // Followed by aggregate values
   std::size_t base = segment_field_ids_.size();
+  for (auto& fused_aggregates : fused_) {
+    // Merge in the same order as ScalarAggregateKernel::MergeAll
+    auto& states = fused_aggregates.states;
+    for (size_t i = 0; i + 1 < states.size(); ++i) {
+      RETURN_NOT_OK(states.back()->MergeFrom(*states[i]));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto values, states.back()->Finalize());
+    for (size_t i = 0; i < values.size(); ++i) {
+      batch.values[base + fused_aggregates.aggregate_ids[i]] = std::move(values[i]);
+    }
+  }
   for (size_t i = 0; i < kernels_.size(); ++i) {
+    if (is_fused_[i]) continue;
     arrow::util::tracing::Span span;
     START_COMPUTE_SPAN(span, aggs_[i].function,
                        {{"function.name", aggs_[i].function},
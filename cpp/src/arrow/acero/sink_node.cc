@@ -221,7 +221,7 @@ class SinkNode : public ExecNode,
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
 
     DCHECK_EQ(input, inputs_[0]);
 
@@ -379,7 +379,7 @@ class ConsumingSinkNode : public ExecNode,
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
 
     DCHECK_EQ(input, inputs_[0]);
 
@@ -507,7 +507,7 @@ struct OrderBySinkNode final : public SinkNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
 
     DCHECK_EQ(input, inputs_[0]);
 
@@ -515,7 +515,7 @@ struct OrderBySinkNode final : public SinkNode {
                           batch.ToRecordBatch(inputs_[0]->output_schema(),
                                               plan()->query_context()->memory_pool()));
 
-    impl_->InputReceived(std::move(record_batch));
+    RETURN_NOT_OK(impl_->InputReceived(std::move(record_batch)));
     if (input_counter_.Increment()) {
       return Finish();
     }
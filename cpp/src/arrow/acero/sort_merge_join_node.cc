@@ -0,0 +1,826 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/builder_base.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::NullPlacement;
+using compute::SortOrder;
+
+namespace acero {
+namespace {
+
+constexpr int kLeft = 0;
+constexpr int kRight = 1;
+
+// An input is paused once this many of its batches are queued waiting for the other
+// input, and resumed once the queue has drained down to kResumeIfBelow batches
+constexpr size_t kPauseIfAbove = 16;
+constexpr size_t kResumeIfBelow = 4;
+
+// Compares the values of a key column at two rows, which may belong to different
+// batches, returning a negative number, zero or a positive number
+using KeyComparator = int (*)(const ArraySpan&, int64_t, const ArraySpan&, int64_t);
+
+template <typename CType>
+int CompareNumbers(const ArraySpan& a, int64_t i, const ArraySpan& b, int64_t j) {
+  CType x = a.GetValues<CType>(1)[i];
+  CType y = b.GetValues<CType>(1)[j];
+  if constexpr (std::is_floating_point_v<CType>) {
+    // NaNs are sorted after all other values
+    if (std::isnan(x) || std::isnan(y)) {
+      return static_cast<int>(std::isnan(x)) - static_cast<int>(std::isnan(y));
+    }
+  }
+  return (y < x) - (x < y);
+}
+
+int CompareBooleans(const ArraySpan& a, int64_t i, const ArraySpan& b, int64_t j) {
+  return static_cast<int>(bit_util::GetBit(a.buffers[1].data, a.offset + i)) -
+         static_cast<int>(bit_util::GetBit(b.buffers[1].data, b.offset + j));
+}
+
+template <typename OffsetType>
+std::string_view GetView(const ArraySpan& array, int64_t i) {
+  const OffsetType* offsets = array.GetValues<OffsetType>(1);
+  return std::string_view(reinterpret_cast<const char*>(array.buffers[2].data) +
+                              offsets[i],
+                          static_cast<size_t>(offsets[i + 1] - offsets[i]));
+}
+
+template <typename OffsetType>
+int CompareBinaries(const ArraySpan& a, int64_t i, const ArraySpan& b, int64_t j) {
+  return GetView<OffsetType>(a, i).compare(GetView<OffsetType>(b, j));
+}
+
+int CompareFixedSizeBinaries(const ArraySpan& a, int64_t i, const ArraySpan& b,
+                             int64_t j) {
+  int width = checked_cast<const FixedSizeBinaryType&>(*a.type).byte_width();
+  return std::memcmp(a.buffers[1].data + (a.offset + i) * width,
+                     b.buffers[1].data + (b.offset + j) * width, width);
+}
+
+Result<KeyComparator> GetKeyComparator(const DataType& type) {
+  switch (type.id()) {
+    case Type::BOOL:
+      return CompareBooleans;
+    case Type::INT8:
+      return CompareNumbers<int8_t>;
+    case Type::INT16:
+      return CompareNumbers<int16_t>;
+    case Type::INT32:
+    case Type::DATE32:
+    case Type::TIME32:
+      return CompareNumbers<int32_t>;
+    case Type::INT64:
+    case Type::DATE64:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+      return CompareNumbers<int64_t>;
+    case Type::UINT8:
+      return CompareNumbers<uint8_t>;
+    case Type::UINT16:
+      return CompareNumbers<uint16_t>;
+    case Type::UINT32:
+      return CompareNumbers<uint32_t>;
+    case Type::UINT64:
+      return CompareNumbers<uint64_t>;
+    case Type::FLOAT:
+      return CompareNumbers<float>;
+    case Type::DOUBLE:
+      return CompareNumbers<double>;
+    case Type::STRING:
+    case Type::BINARY:
+      return CompareBinaries<int32_t>;
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      return CompareBinaries<int64_t>;
+    case Type::FIXED_SIZE_BINARY:
+      return CompareFixedSizeBinaries;
+    default:
+      return Status::TypeError("Unsupported type for sort-merge join key: ",
+                               type.ToString());
+  }
+}
+
+// A batch queued by one of the inputs
+struct InputBatch {
+  ExecBatch batch;
+  std::vector<ArraySpan> columns;
+  std::vector<ArraySpan> keys;
+
+  int64_t length() const { return batch.length; }
+};
+
+// A range of consecutive rows of a batch
+struct RowRange {
+  std::shared_ptr<InputBatch> batch;
+  int64_t offset;
+  int64_t length;
+};
+
+class SortMergeJoinNode : public ExecNode, public TracedNode {
+ public:
+  SortMergeJoinNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                    std::shared_ptr<Schema> output_schema,
+                    SortMergeJoinNodeOptions options,
+                    std::vector<std::vector<int>> key_ids,
+                    std::vector<KeyComparator> comparators,
+                    std::vector<SortOrder> sort_orders, NullPlacement null_placement)
+      : ExecNode(plan, std::move(inputs), {"left", "right"}, std::move(output_schema)),
+        TracedNode(this),
+        options_(std::move(options)),
+        comparators_(std::move(comparators)),
+        sort_orders_(std::move(sort_orders)),
+        null_placement_(null_placement) {
+    for (int side : {kLeft, kRight}) {
+      inputs_state_[side].key_ids = std::move(key_ids[side]);
+      sequencers_[side].node = this;
+      sequencers_[side].side = side;
+      inputs_state_[side].queue = util::SerialSequencingQueue::Make(&sequencers_[side]);
+    }
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 2, "SortMergeJoinNode"));
+    const auto& join_options = checked_cast<const SortMergeJoinNodeOptions&>(options);
+
+    switch (join_options.join_type) {
+      case JoinType::INNER:
+      case JoinType::LEFT_OUTER:
+      case JoinType::LEFT_SEMI:
+      case JoinType::LEFT_ANTI:
+        break;
+      default:
+        return Status::NotImplemented("Sort-merge join does not support ",
+                                      acero::ToString(join_options.join_type), " joins");
+    }
+    if (join_options.left_keys.empty()) {
+      return Status::Invalid("Sort-merge join requires at least one key");
+    }
+    if (join_options.left_keys.size() != join_options.right_keys.size()) {
+      return Status::Invalid("Sort-merge join got ", join_options.left_keys.size(),
+                             " left keys but ", join_options.right_keys.size(),
+                             " right keys");
+    }
+
+    std::vector<std::vector<int>> key_ids(2);
+    for (int side : {kLeft, kRight}) {
+      const auto& keys = side == kLeft ? join_options.left_keys : join_options.right_keys;
+      const auto& input_schema = inputs[side]->output_schema();
+      for (const FieldRef& key : keys) {
+        ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*input_schema));
+        key_ids[side].push_back(match[0]);
+      }
+      for (const auto& field : input_schema->fields()) {
+        if (field->type()->id() == Type::DICTIONARY) {
+          return Status::NotImplemented(
+              "Sort-merge join does not support dictionary columns, got ",
+              field->ToString());
+        }
+      }
+    }
+
+    std::vector<KeyComparator> comparators;
+    for (size_t i = 0; i < key_ids[kLeft].size(); ++i) {
+      const auto& left_type =
+          inputs[kLeft]->output_schema()->field(key_ids[kLeft][i])->type();
+      const auto& right_type =
+          inputs[kRight]->output_schema()->field(key_ids[kRight][i])->type();
+      if (!left_type->Equals(*right_type)) {
+        return Status::TypeError("Sort-merge join key ", i, " has type ",
+                                 left_type->ToString(), " on the left but ",
+                                 right_type->ToString(), " on the right");
+      }
+      ARROW_ASSIGN_OR_RAISE(KeyComparator comparator, GetKeyComparator(*left_type));
+      comparators.push_back(comparator);
+    }
+
+    // Find how the inputs are sorted on the keys.  An explicit ordering must start
+    // with the keys, while an implicit ordering is trusted to match the other input.
+    std::vector<SortOrder> sort_orders(key_ids[kLeft].size(), SortOrder::Ascending);
+    NullPlacement null_placement = NullPlacement::AtEnd;
+    const Ordering* explicit_ordering = nullptr;
+    for (int side : {kLeft, kRight}) {
+      const Ordering& ordering = inputs[side]->ordering();
+      const char* side_name = side == kLeft ? "left" : "right";
+      if (ordering.is_unordered()) {
+        return Status::Invalid("The ", side_name,
+                               " input of the sort-merge join has no meaningful "
+                               "ordering.  Both inputs must be sorted on the join keys");
+      }
+      if (ordering.is_implicit()) {
+        continue;
+      }
+      const auto& sort_keys = ordering.sort_keys();
+      bool sorted_on_keys = sort_keys.size() >= key_ids[side].size();
+      for (size_t i = 0; sorted_on_keys && i < key_ids[side].size(); ++i) {
+        auto match = sort_keys[i].target.FindOne(*inputs[side]->output_schema());
+        sorted_on_keys = match.ok() && (*match)[0] == key_ids[side][i];
+      }
+      if (!sorted_on_keys) {
+        return Status::Invalid("The ", side_name,
+                               " input of the sort-merge join must be sorted on the "
+                               "join keys first, but is ordered by ",
+                               ordering.ToString());
+      }
+      if (explicit_ordering == nullptr) {
+        explicit_ordering = &ordering;
+        for (size_t i = 0; i < sort_orders.size(); ++i) {
+          sort_orders[i] = sort_keys[i].order;
+        }
+        null_placement = ordering.null_placement();
+        continue;
+      }
+      for (size_t i = 0; i < sort_orders.size(); ++i) {
+        if (sort_keys[i].order != sort_orders[i] ||
+            ordering.null_placement() != null_placement) {
+          return Status::Invalid(
+              "The inputs of the sort-merge join must be sorted alike on the join "
+              "keys, but are ordered by ",
+              explicit_ordering->ToString(), " and ", ordering.ToString());
+        }
+      }
+    }
+
+    bool output_right = join_options.join_type == JoinType::INNER ||
+                        join_options.join_type == JoinType::LEFT_OUTER;
+    // Like the hash join, suffixes only distinguish the fields whose names are found
+    // in both inputs
+    const auto& left_schema = *inputs[kLeft]->output_schema();
+    const auto& right_schema = *inputs[kRight]->output_schema();
+    FieldVector output_fields;
+    for (const auto& field : left_schema.fields()) {
+      bool collides = output_right && right_schema.GetFieldIndex(field->name()) != -1;
+      output_fields.push_back(
+          collides ? field->WithName(field->name() + join_options.output_suffix_for_left)
+                   : field);
+    }
+    if (output_right) {
+      for (const auto& field : right_schema.fields()) {
+        auto output_field = field;
+        if (left_schema.GetFieldIndex(field->name()) != -1) {
+          output_field =
+              field->WithName(field->name() + join_options.output_suffix_for_right);
+        }
+        if (join_options.join_type == JoinType::LEFT_OUTER) {
+          output_field = output_field->WithNullable(true);
+        }
+        output_fields.push_back(std::move(output_field));
+      }
+    }
+
+    return plan->EmplaceNode<SortMergeJoinNode>(
+        plan, std::move(inputs), schema(std::move(output_fields)), join_options,
+        std::move(key_ids), std::move(comparators), std::move(sort_orders),
+        null_placement);
+  }
+
+  const char* kind_name() const override { return "SortMergeJoinNode"; }
+
+  // The output follows the order of the left input
+  const Ordering& ordering() const override { return inputs_[kLeft]->ordering(); }
+
+  Status Init() override {
+    for (const auto& field : output_schema_->fields()) {
+      std::unique_ptr<ArrayBuilder> builder;
+      RETURN_NOT_OK(MakeBuilder(pool(), field->type(), &builder));
+      builders_.push_back(std::move(builder));
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    std::vector<BackpressureAction> actions;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (counter <= downstream_counter_) return;
+      downstream_counter_ = counter;
+      downstream_paused_ = true;
+      UpdateBackpressure(&actions);
+    }
+    ApplyBackpressure(actions);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    std::vector<BackpressureAction> actions;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (counter <= downstream_counter_) return;
+      downstream_counter_ = counter;
+      downstream_paused_ = false;
+      UpdateBackpressure(&actions);
+    }
+    ApplyBackpressure(actions);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(input, batch);
+    int side = input == inputs_[kLeft] ? kLeft : kRight;
+    DCHECK_EQ(input, inputs_[side]);
+    return inputs_state_[side].queue->InsertBatch(std::move(batch));
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    int side = input == inputs_[kLeft] ? kLeft : kRight;
+    DCHECK_EQ(input, inputs_[side]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"side", side},
+                                           {"batches.length", total_batches}});
+    if (inputs_state_[side].counter.SetTotal(total_batches)) {
+      return Update(side, std::nullopt, /*finished=*/true);
+    }
+    return Status::OK();
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "type=" << acero::ToString(options_.join_type) << ", left_keys=[";
+    for (size_t i = 0; i < options_.left_keys.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << options_.left_keys[i].ToString();
+    }
+    ss << "], right_keys=[";
+    for (size_t i = 0; i < options_.right_keys.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << options_.right_keys[i].ToString();
+    }
+    ss << "]";
+    return ss.str();
+  }
+
+ private:
+  // Delivers the batches of one input in order
+  struct Sequencer : public util::SerialSequencingQueue::Processor {
+    Status Process(ExecBatch batch) override {
+      bool finished = node->inputs_state_[side].counter.Increment();
+      return node->Update(side, std::move(batch), finished);
+    }
+
+    SortMergeJoinNode* node;
+    int side;
+  };
+
+  struct InputState {
+    std::vector<int> key_ids;
+    std::unique_ptr<util::SerialSequencingQueue> queue;
+    AtomicCounter counter;
+
+    // The batches received but not yet passed by the merge, the first one starting
+    // at `row`
+    std::deque<std::shared_ptr<InputBatch>> batches;
+    int64_t row = 0;
+    // The last batch received, to check the input is sorted across batches
+    std::shared_ptr<InputBatch> last_batch;
+    bool finished = false;
+    bool paused = false;
+
+    bool empty() const { return batches.empty(); }
+    const InputBatch& current() const { return *batches.front(); }
+  };
+
+  // The right rows whose keys equal those of the current left row
+  struct RightGroup {
+    std::vector<RowRange> ranges;
+    // Whether all the rows of the group have been received
+    bool complete = false;
+
+    bool valid() const { return !ranges.empty(); }
+    const InputBatch& first_batch() const { return *ranges.front().batch; }
+    int64_t first_row() const { return ranges.front().offset; }
+  };
+
+  struct BackpressureAction {
+    int side;
+    bool pause;
+    int32_t counter;
+  };
+
+  MemoryPool* pool() const { return plan_->query_context()->memory_pool(); }
+
+  bool output_right() const {
+    return options_.join_type == JoinType::INNER ||
+           options_.join_type == JoinType::LEFT_OUTER;
+  }
+
+  bool output_unmatched() const {
+    return options_.join_type == JoinType::LEFT_OUTER ||
+           options_.join_type == JoinType::LEFT_ANTI;
+  }
+
+  // Adds a batch and/or the end of an input to the merge, then sends the output and
+  // applies backpressure outside of the lock
+  Status Update(int side, std::optional<ExecBatch> batch, bool finished) {
+    std::vector<ExecBatch> out;
+    std::vector<BackpressureAction> actions;
+    bool finish = false;
+    bool stop_right = false;
+    int total_batches = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (finished_) return Status::OK();
+      if (batch) {
+        RETURN_NOT_OK(Enqueue(side, std::move(*batch)));
+      }
+      inputs_state_[side].finished = finished;
+      RETURN_NOT_OK(Merge());
+      if (finished_) {
+        RETURN_NOT_OK(FlushOutput());
+        finish = true;
+        // No more right rows are needed
+        stop_right = !inputs_state_[kRight].finished;
+        total_batches = out_batch_count_;
+      }
+      out = std::move(out_batches_);
+      out_batches_.clear();
+      UpdateBackpressure(&actions);
+    }
+    ApplyBackpressure(actions);
+    for (ExecBatch& out_batch : out) {
+      RETURN_NOT_OK(output_->InputReceived(this, std::move(out_batch)));
+    }
+    if (finish) {
+      if (stop_right) {
+        RETURN_NOT_OK(inputs_[kRight]->StopProducing());
+      }
+      return output_->InputFinished(this, total_batches);
+    }
+    return Status::OK();
+  }
+
+  Status Enqueue(int side, ExecBatch batch) {
+    if (batch.length == 0) return Status::OK();
+    InputState& input = inputs_state_[side];
+    auto entry = std::make_shared<InputBatch>();
+    for (Datum& value : batch.values) {
+      if (value.is_scalar()) {
+        ARROW_ASSIGN_OR_RAISE(value,
+                              MakeArrayFromScalar(*value.scalar(), batch.length, pool()));
+      }
+      entry->columns.emplace_back(*value.array());
+    }
+    for (int key_id : input.key_ids) {
+      entry->keys.push_back(entry->columns[key_id]);
+    }
+    entry->batch = std::move(batch);
+    if (input.last_batch != nullptr &&
+        CompareRows(*input.last_batch, input.last_batch->length() - 1, *entry, 0) > 0) {
+      return NotSorted(side);
+    }
+    input.last_batch = entry;
+    input.batches.push_back(std::move(entry));
+    return Status::OK();
+  }
+
+  Status NotSorted(int side) const {
+    return Status::Invalid("The ", side == kLeft ? "left" : "right",
+                           " input of the sort-merge join is not sorted on the join "
+                           "keys");
+  }
+
+  // Compares the keys of two rows in the order of the inputs
+  int CompareRows(const InputBatch& a, int64_t i, const InputBatch& b, int64_t j) const {
+    for (size_t k = 0; k < comparators_.size(); ++k) {
+      bool a_null = a.keys[k].IsNull(i);
+      bool b_null = b.keys[k].IsNull(j);
+      if (a_null || b_null) {
+        if (a_null && b_null) continue;
+        int nulls_last = a_null ? 1 : -1;
+        return null_placement_ == NullPlacement::AtEnd ? nulls_last : -nulls_last;
+      }
+      int result = comparators_[k](a.keys[k], i, b.keys[k], j);
+      if (result != 0) {
+        return sort_orders_[k] == SortOrder::Ascending ? result : -result;
+      }
+    }
+    return 0;
+  }
+
+  bool HasNullKey(const InputBatch& batch, int64_t row) const {
+    for (const ArraySpan& key : batch.keys) {
+      if (key.IsNull(row)) return true;
+    }
+    return false;
+  }
+
+  // Moves past the current row of an input, checking the input is sorted
+  Status Advance(int side) {
+    InputState& input = inputs_state_[side];
+    const InputBatch& batch = input.current();
+    if (input.row + 1 < batch.length()) {
+      if (CompareRows(batch, input.row, batch, input.row + 1) > 0) {
+        return NotSorted(side);
+      }
+      ++input.row;
+    } else {
+      input.batches.pop_front();
+      input.row = 0;
+    }
+    return Status::OK();
+  }
+
+  // Advances the merge as far as the rows received so far allow
+  Status Merge() {
+    InputState& left = inputs_state_[kLeft];
+    InputState& right = inputs_state_[kRight];
+    while (true) {
+      if (left.empty()) {
+        finished_ = left.finished;
+        return Status::OK();
+      }
+      const InputBatch& left_batch = left.current();
+      const int64_t left_row = left.row;
+
+      if (group_.valid()) {
+        int cmp = CompareRows(left_batch, left_row, group_.first_batch(),
+                              group_.first_row());
+        if (cmp == 0) {
+          RETURN_NOT_OK(ExtendGroup());
+          if (!group_.complete) return Status::OK();
+          RETURN_NOT_OK(EmitMatches(left.batches.front(), left_row));
+          RETURN_NOT_OK(Advance(kLeft));
+          continue;
+        }
+        if (cmp < 0) {
+          RETURN_NOT_OK(EmitUnmatched(left.batches.front(), left_row));
+          RETURN_NOT_OK(Advance(kLeft));
+          continue;
+        }
+        group_ = {};
+      }
+
+      if (HasNullKey(left_batch, left_row)) {
+        RETURN_NOT_OK(EmitUnmatched(left.batches.front(), left_row));
+        RETURN_NOT_OK(Advance(kLeft));
+        continue;
+      }
+
+      // Skip the right rows sorted before the left row
+      int cmp = 1;
+      while (!right.empty()) {
+        cmp = CompareRows(left_batch, left_row, right.current(), right.row);
+        if (cmp <= 0) break;
+        RETURN_NOT_OK(Advance(kRight));
+      }
+      if (right.empty()) {
+        if (!right.finished) return Status::OK();
+        if (!output_unmatched()) {
+          // No more output is possible, drop the remaining left rows
+          left.batches.clear();
+          left.row = 0;
+          continue;
+        }
+        RETURN_NOT_OK(EmitUnmatched(left.batches.front(), left_row,
+                                    left_batch.length() - left_row));
+        left.batches.pop_front();
+        left.row = 0;
+        continue;
+      }
+      if (cmp < 0) {
+        RETURN_NOT_OK(EmitUnmatched(left.batches.front(), left_row));
+        RETURN_NOT_OK(Advance(kLeft));
+        continue;
+      }
+      // The current right row starts the group of the left row
+      group_.ranges.push_back({right.batches.front(), right.row, 0});
+    }
+  }
+
+  // Adds the following right rows with the same keys to the group
+  Status ExtendGroup() {
+    InputState& right = inputs_state_[kRight];
+    while (!group_.complete) {
+      if (right.empty()) {
+        group_.complete = right.finished;
+        return Status::OK();
+      }
+      const std::shared_ptr<InputBatch>& batch = right.batches.front();
+      if (CompareRows(group_.first_batch(), group_.first_row(), *batch, right.row) !=
+          0) {
+        group_.complete = true;
+        return Status::OK();
+      }
+      RowRange& last = group_.ranges.back();
+      if (last.batch == batch && last.offset + last.length == right.row) {
+        ++last.length;
+      } else {
+        group_.ranges.push_back({batch, right.row, 1});
+      }
+      RETURN_NOT_OK(Advance(kRight));
+    }
+    return Status::OK();
+  }
+
+  Status EmitMatches(const std::shared_ptr<InputBatch>& left_batch, int64_t left_row) {
+    if (options_.join_type == JoinType::LEFT_ANTI) return Status::OK();
+    if (options_.join_type == JoinType::LEFT_SEMI) {
+      return EmitLeft(left_batch, left_row, 1);
+    }
+    RETURN_NOT_OK(FlushPendingLeft());
+    const int num_left_columns = static_cast<int>(left_batch->columns.size());
+    for (const RowRange& range : group_.ranges) {
+      int64_t offset = range.offset;
+      int64_t remaining = range.length;
+      while (remaining > 0) {
+        int64_t length = std::min(remaining, ExecPlan::kMaxBatchSize - output_length_);
+        for (int i = 0; i < num_left_columns; ++i) {
+          for (int64_t r = 0; r < length; ++r) {
+            RETURN_NOT_OK(
+                builders_[i]->AppendArraySlice(left_batch->columns[i], left_row, 1));
+          }
+        }
+        for (size_t i = 0; i < range.batch->columns.size(); ++i) {
+          RETURN_NOT_OK(builders_[num_left_columns + i]->AppendArraySlice(
+              range.batch->columns[i], offset, length));
+        }
+        offset += length;
+        remaining -= length;
+        output_length_ += length;
+        if (output_length_ == ExecPlan::kMaxBatchSize) {
+          RETURN_NOT_OK(FlushOutput());
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  Status EmitUnmatched(const std::shared_ptr<InputBatch>& left_batch, int64_t left_row,
+                       int64_t length = 1) {
+    if (!output_unmatched()) return Status::OK();
+    return EmitLeft(left_batch, left_row, length);
+  }
+
+  // Emits left rows on their own, with nulls for the right columns if any.  Runs of
+  // consecutive rows are coalesced and only appended to the builders once complete.
+  Status EmitLeft(const std::shared_ptr<InputBatch>& left_batch, int64_t left_row,
+                  int64_t length) {
+    if (pending_left_.batch != left_batch ||
+        pending_left_.offset + pending_left_.length != left_row) {
+      RETURN_NOT_OK(FlushPendingLeft());
+      pending_left_ = {left_batch, left_row, 0};
+    }
+    while (true) {
+      int64_t capacity = ExecPlan::kMaxBatchSize - output_length_ - pending_left_.length;
+      int64_t appended = std::min(length, capacity);
+      pending_left_.length += appended;
+      length -= appended;
+      if (length == 0 && appended < capacity) return Status::OK();
+      int64_t next_row = pending_left_.offset + pending_left_.length;
+      RETURN_NOT_OK(FlushPendingLeft());
+      RETURN_NOT_OK(FlushOutput());
+      if (length == 0) return Status::OK();
+      pending_left_ = {left_batch, next_row, 0};
+    }
+  }
+
+  Status FlushPendingLeft() {
+    if (pending_left_.batch == nullptr || pending_left_.length == 0) {
+      pending_left_ = {};
+      return Status::OK();
+    }
+    const auto& columns = pending_left_.batch->columns;
+    for (size_t i = 0; i < columns.size(); ++i) {
+      RETURN_NOT_OK(builders_[i]->AppendArraySlice(columns[i], pending_left_.offset,
+                                                   pending_left_.length));
+    }
+    for (size_t i = columns.size(); i < builders_.size(); ++i) {
+      RETURN_NOT_OK(builders_[i]->AppendNulls(pending_left_.length));
+    }
+    output_length_ += pending_left_.length;
+    pending_left_ = {};
+    return Status::OK();
+  }
+
+  Status FlushOutput() {
+    RETURN_NOT_OK(FlushPendingLeft());
+    if (output_length_ == 0) return Status::OK();
+    ExecBatch out;
+    out.length = output_length_;
+    for (auto& builder : builders_) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> array, builder->Finish());
+      out.values.emplace_back(std::move(array));
+    }
+    out.index = out_batch_count_++;
+    out_batches_.push_back(std::move(out));
+    output_length_ = 0;
+    return Status::OK();
+  }
+
+  // Pauses the inputs which are too far ahead of the other, or all of them while the
+  // output is paused.  Must be called with the lock held.
+  void UpdateBackpressure(std::vector<BackpressureAction>* actions) {
+    for (int side : {kLeft, kRight}) {
+      InputState& input = inputs_state_[side];
+      bool pause;
+      if (finished_ || input.finished) {
+        pause = false;
+      } else if (downstream_paused_ || input.batches.size() >= kPauseIfAbove) {
+        pause = true;
+      } else if (input.batches.size() <= kResumeIfBelow) {
+        pause = false;
+      } else {
+        pause = input.paused;
+      }
+      if (pause != input.paused) {
+        input.paused = pause;
+        actions->push_back({side, pause, ++backpressure_counter_});
+      }
+    }
+  }
+
+  void ApplyBackpressure(const std::vector<BackpressureAction>& actions) {
+    for (const BackpressureAction& action : actions) {
+      if (action.pause) {
+        inputs_[action.side]->PauseProducing(this, action.counter);
+      } else {
+        inputs_[action.side]->ResumeProducing(this, action.counter);
+      }
+    }
+  }
+
+  const SortMergeJoinNodeOptions options_;
+  const std::vector<KeyComparator> comparators_;
+  const std::vector<SortOrder> sort_orders_;
+  const NullPlacement null_placement_;
+
+  Sequencer sequencers_[2];
+
+  std::mutex mutex_;
+  InputState inputs_state_[2];
+  RightGroup group_;
+  bool finished_ = false;
+  bool downstream_paused_ = false;
+  int32_t downstream_counter_ = 0;
+  int32_t backpressure_counter_ = 0;
+
+  std::vector<std::unique_ptr<ArrayBuilder>> builders_;
+  RowRange pending_left_{};
+  int64_t output_length_ = 0;
+  std::vector<ExecBatch> out_batches_;
+  int out_batch_count_ = 0;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterSortMergeJoinNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory(std::string(SortMergeJoinNodeOptions::kName),
+                                 SortMergeJoinNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
@@ -0,0 +1,281 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace acero {
+
+using compute::SortKey;
+using compute::SortOrder;
+
+std::shared_ptr<Schema> LeftSchema() {
+  return schema({field("k", int32()), field("lv", utf8())});
+}
+
+std::shared_ptr<Schema> RightSchema() {
+  return schema({field("k", int32()), field("rv", int64())});
+}
+
+// Both sorted ascending on k with nulls at end
+std::shared_ptr<Table> LeftTable() {
+  return TableFromJSON(LeftSchema(), {R"([
+    [1, "a"],
+    [2, "b"],
+    [2, "c"],
+    [4, "d"],
+    [5, "e"],
+    [null, "f"]
+  ])"});
+}
+
+std::shared_ptr<Table> RightTable() {
+  return TableFromJSON(RightSchema(), {R"([
+    [0, 100],
+    [2, 200],
+    [2, 201],
+    [3, 300],
+    [5, 500],
+    [null, 600]
+  ])"});
+}
+
+SortMergeJoinNodeOptions JoinOptions(JoinType join_type) {
+  return SortMergeJoinNodeOptions(join_type, {"k"}, {"k"}, "_l", "_r");
+}
+
+Result<std::shared_ptr<Table>> RunJoin(const std::shared_ptr<Table>& left,
+                                       const std::shared_ptr<Table>& right,
+                                       SortMergeJoinNodeOptions options,
+                                       int64_t max_batch_size, bool use_threads) {
+  Declaration plan{
+      "sort_merge_join",
+      {Declaration{"table_source", TableSourceNodeOptions(left, max_batch_size)},
+       Declaration{"table_source", TableSourceNodeOptions(right, max_batch_size)}},
+      std::move(options)};
+  QueryOptions query_options;
+  query_options.sequence_output = true;
+  query_options.use_threads = use_threads;
+  return DeclarationToTable(std::move(plan), query_options);
+}
+
+void CheckJoin(JoinType join_type, const std::shared_ptr<Table>& expected) {
+  for (int64_t max_batch_size : {1, 2, 4, 64}) {
+    for (bool use_threads : {false, true}) {
+      ARROW_SCOPED_TRACE("max_batch_size = ", max_batch_size,
+                         ", use_threads = ", use_threads);
+      ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                           RunJoin(LeftTable(), RightTable(), JoinOptions(join_type),
+                                   max_batch_size, use_threads));
+      AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    }
+  }
+}
+
+std::shared_ptr<Schema> JoinedSchema() {
+  return schema({field("k_l", int32()), field("lv", utf8()), field("k_r", int32()),
+                 field("rv", int64())});
+}
+
+TEST(SortMergeJoinNode, Inner) {
+  CheckJoin(JoinType::INNER, TableFromJSON(JoinedSchema(), {R"([
+    [2, "b", 2, 200],
+    [2, "b", 2, 201],
+    [2, "c", 2, 200],
+    [2, "c", 2, 201],
+    [5, "e", 5, 500]
+  ])"}));
+}
+
+TEST(SortMergeJoinNode, LeftOuter) {
+  CheckJoin(JoinType::LEFT_OUTER, TableFromJSON(JoinedSchema(), {R"([
+    [1, "a", null, null],
+    [2, "b", 2, 200],
+    [2, "b", 2, 201],
+    [2, "c", 2, 200],
+    [2, "c", 2, 201],
+    [4, "d", null, null],
+    [5, "e", 5, 500],
+    [null, "f", null, null]
+  ])"}));
+}
+
+TEST(SortMergeJoinNode, LeftSemi) {
+  CheckJoin(JoinType::LEFT_SEMI, TableFromJSON(LeftSchema(), {R"([
+    [2, "b"],
+    [2, "c"],
+    [5, "e"]
+  ])"}));
+}
+
+TEST(SortMergeJoinNode, LeftAnti) {
+  CheckJoin(JoinType::LEFT_ANTI, TableFromJSON(LeftSchema(), {R"([
+    [1, "a"],
+    [4, "d"],
+    [null, "f"]
+  ])"}));
+}
+
+TEST(SortMergeJoinNode, EmptyRight) {
+  auto right = TableFromJSON(RightSchema(), {"[]"});
+  ASSERT_OK_AND_ASSIGN(auto actual,
+                       RunJoin(LeftTable(), right, JoinOptions(JoinType::LEFT_ANTI),
+                               /*max_batch_size=*/2, /*use_threads=*/true));
+  AssertTablesEqual(*LeftTable(), *actual, /*same_chunk_layout=*/false);
+  ASSERT_OK_AND_ASSIGN(actual, RunJoin(LeftTable(), right, JoinOptions(JoinType::INNER),
+                                       /*max_batch_size=*/2, /*use_threads=*/true));
+  ASSERT_EQ(0, actual->num_rows());
+}
+
+TEST(SortMergeJoinNode, AfterOrderBy) {
+  // Sorted explicitly, descending with nulls first, from reversed inputs
+  Ordering ordering({SortKey("k", SortOrder::Descending)},
+                    compute::NullPlacement::AtStart);
+  auto sorted = [&](std::shared_ptr<Table> table) {
+    return Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(std::move(table), 2)},
+         {"order_by", OrderByNodeOptions(ordering)}});
+  };
+  Declaration plan{"sort_merge_join",
+                   {sorted(RightTable()->RenameColumns({"k", "lv"}).ValueOrDie()),
+                    sorted(LeftTable()->RenameColumns({"k", "rv"}).ValueOrDie())},
+                   SortMergeJoinNodeOptions(JoinType::LEFT_OUTER, {"k"}, {"k"})};
+  QueryOptions query_options;
+  query_options.sequence_output = true;
+  ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToTable(std::move(plan), query_options));
+  auto expected = TableFromJSON(
+      schema({field("k", int32()), field("lv", int64()), field("k", int32()),
+              field("rv", utf8())}),
+      {R"([
+    [null, 600, null, null],
+    [5, 500, 5, "e"],
+    [3, 300, null, null],
+    [2, 200, 2, "b"],
+    [2, 200, 2, "c"],
+    [2, 201, 2, "b"],
+    [2, 201, 2, "c"],
+    [0, 100, null, null]
+  ])"});
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(SortMergeJoinNode, MatchesHashJoin) {
+  // Many duplicate keys, spread over batches of various sizes
+  random::RandomArrayGenerator rng(42);
+  auto make_sorted = [&](const std::shared_ptr<Schema>& schema, int64_t length) {
+    auto keys = rng.Int32(length, 0, 200, /*null_probability=*/0.05);
+    auto values = rng.Int64(length, 0, 1000000);
+    auto table = Table::Make(schema, {keys, values});
+    auto indices = compute::SortIndices(
+                       Datum(table),
+                       compute::SortOptions({SortKey(0), SortKey(1)},
+                                            compute::NullPlacement::AtEnd))
+                       .ValueOrDie();
+    return compute::Take(table, indices).ValueOrDie().table();
+  };
+  auto left = make_sorted(schema({field("k", int32()), field("lv", int64())}), 2000);
+  auto right = make_sorted(RightSchema(), 1500);
+
+  for (JoinType join_type : {JoinType::INNER, JoinType::LEFT_OUTER,
+                             JoinType::LEFT_SEMI, JoinType::LEFT_ANTI}) {
+    ARROW_SCOPED_TRACE("join_type = ", ToString(join_type));
+    ASSERT_OK_AND_ASSIGN(auto actual, RunJoin(left, right, JoinOptions(join_type),
+                                              /*max_batch_size=*/37,
+                                              /*use_threads=*/true));
+
+    Declaration hash_plan{
+        "hashjoin",
+        {Declaration{"table_source", TableSourceNodeOptions(left)},
+         Declaration{"table_source", TableSourceNodeOptions(right)}},
+        HashJoinNodeOptions(join_type, {"k"}, {"k"}, literal(true), "_l", "_r")};
+    ASSERT_OK_AND_ASSIGN(auto expected, DeclarationToTable(std::move(hash_plan)));
+
+    // The hash join does not preserve the order of the left input
+    std::vector<SortKey> sort_keys;
+    for (int i = 0; i < actual->num_columns(); ++i) {
+      sort_keys.emplace_back(i);
+    }
+    auto sort = [&](const std::shared_ptr<Table>& table) {
+      auto indices =
+          compute::SortIndices(Datum(table), compute::SortOptions(sort_keys))
+              .ValueOrDie();
+      return compute::Take(table, indices).ValueOrDie().table();
+    };
+    // The hash join makes all its output fields nullable
+    ASSERT_OK_AND_ASSIGN(expected, expected->CombineChunks());
+    expected = Table::Make(actual->schema(), expected->columns());
+    ASSERT_EQ(expected->num_rows(), actual->num_rows());
+    AssertTablesEqual(*sort(expected), *sort(actual), /*same_chunk_layout=*/false);
+  }
+}
+
+TEST(SortMergeJoinNode, UnsortedInput) {
+  auto unsorted = TableFromJSON(RightSchema(), {R"([
+    [0, 100],
+    [3, 300],
+    [2, 200]
+  ])"});
+  for (int64_t max_batch_size : {1, 64}) {
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, testing::HasSubstr("right input of the sort-merge join is not sorted"),
+        RunJoin(LeftTable(), unsorted, JoinOptions(JoinType::INNER), max_batch_size,
+                /*use_threads=*/false));
+  }
+}
+
+TEST(SortMergeJoinNode, Invalid) {
+  auto check_invalid = [](Declaration left, SortMergeJoinNodeOptions options,
+                          StatusCode code, const std::string& message) {
+    Declaration right{"table_source", TableSourceNodeOptions(RightTable())};
+    Declaration plan{"sort_merge_join", {std::move(left), std::move(right)},
+                     std::move(options)};
+    Status status = DeclarationToStatus(std::move(plan));
+    ASSERT_EQ(code, status.code()) << status.ToString();
+    EXPECT_THAT(status.message(), testing::HasSubstr(message));
+  };
+  Declaration left{"table_source", TableSourceNodeOptions(LeftTable())};
+
+  check_invalid(left, JoinOptions(JoinType::FULL_OUTER), StatusCode::NotImplemented,
+                "does not support FULL_OUTER");
+  check_invalid(left, SortMergeJoinNodeOptions(JoinType::INNER, {}, {}),
+                StatusCode::Invalid, "at least one key");
+  check_invalid(left, SortMergeJoinNodeOptions(JoinType::INNER, {"k"}, {"k", "rv"}),
+                StatusCode::Invalid, "1 left keys but 2 right keys");
+  check_invalid(left, SortMergeJoinNodeOptions(JoinType::INNER, {"lv"}, {"k"}),
+                StatusCode::TypeError, "has type string on the left but int32");
+  check_invalid(Declaration::Sequence(
+                    {{"table_source", TableSourceNodeOptions(LeftTable())},
+                     {"order_by", OrderByNodeOptions(Ordering({SortKey("lv")}))}}),
+                JoinOptions(JoinType::INNER), StatusCode::Invalid,
+                "must be sorted on the join keys first");
+  check_invalid(
+      Declaration::Sequence({{"table_source", TableSourceNodeOptions(LeftTable())},
+                             {"union", ExecNodeOptions{}}}),
+      JoinOptions(JoinType::INNER), StatusCode::Invalid, "has no meaningful ordering");
+}
+
+}  // namespace acero
+}  // namespace arrow
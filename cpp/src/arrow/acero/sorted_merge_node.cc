@@ -15,8 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <any>
 #include <atomic>
+#include <limits>
 #include <mutex>
 #include <sstream>
 #include <thread>
@@ -164,39 +166,43 @@ class InputState {
 
   bool Finished() const { return batches_processed_ == total_batches_; }
 
-  void Advance(SingleRecordBatchSliceBuilder& builder) {
-    // Advance the row until a new time is encountered or the record batch
-    // ends. This will return a range of {-1, -1} and a nullptr if there is
-    // no input
-    bool active =
-        (latest_ref_row_ > 0 /*short circuit the lock on the queue*/) || !queue_.Empty();
-
-    if (!active) {
-      return;
-    }
-
-    row_index_t start = latest_ref_row_;
-    row_index_t end = latest_ref_row_;
-    time_unit_t startTime = GetLatestTime();
+  // Advance past the rows of the latest batch whose time is at most `bound`, at least
+  // one row (precondition: must not be empty and GetLatestTime() <= bound)
+  void AdvanceUntil(SingleRecordBatchSliceBuilder& builder, time_unit_t bound) {
     std::shared_ptr<arrow::RecordBatch> batch = queue_.UnsyncFront();
-    auto rows_in_batch = (row_index_t)batch->num_rows();
-
-    while (GetLatestTime() == startTime) {
-      end = ++latest_ref_row_;
-      if (latest_ref_row_ >= rows_in_batch) {
-        // hit the end of the batch, need to get the next batch if
-        // possible.
-        ++batches_processed_;
-        latest_ref_row_ = 0;
-        active &= !queue_.TryPop();
-        if (active) {
-          DCHECK_GT(queue_.UnsyncFront()->num_rows(),
-                    0);  // empty batches disallowed, sanity check
-        }
-        break;
+    const auto rows_in_batch = static_cast<row_index_t>(batch->num_rows());
+    const row_index_t start = latest_ref_row_;
+    auto time_at = [&](row_index_t row) {
+      return GetTime(batch.get(), time_type_id_, time_col_index_, row);
+    };
+
+    // The times are sorted, so look for the end of the run by galloping then
+    // bisecting, as runs are usually short when many inputs are interleaved
+    row_index_t last_in_run = start;
+    row_index_t probe = start + 1;
+    for (row_index_t step = 2; probe < rows_in_batch && time_at(probe) <= bound;
+         step *= 2) {
+      last_in_run = probe;
+      probe = start + step;
+    }
+    row_index_t lo = last_in_run + 1;
+    row_index_t hi = std::min(probe, rows_in_batch);
+    while (lo < hi) {
+      const row_index_t mid = lo + (hi - lo) / 2;
+      if (time_at(mid) <= bound) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
       }
     }
-    builder.AddEntry(batch, start, end);
+
+    latest_ref_row_ = lo;
+    builder.AddEntry(batch, start, lo);
+    if (latest_ref_row_ >= rows_in_batch) {
+      ++batches_processed_;
+      latest_ref_row_ = 0;
+      queue_.TryPop();
+    }
   }
 
   arrow::Status Push(const std::shared_ptr<arrow::RecordBatch>& rb) {
@@ -235,23 +241,98 @@ class InputState {
   time_unit_t latest_time_ = std::numeric_limits<time_unit_t>::lowest();
 };
 
-struct InputStateComparator {
-  bool operator()(const std::shared_ptr<InputState>& lhs,
-                  const std::shared_ptr<InputState>& rhs) const {
-    // True if lhs is ahead of time of rhs
-    if (lhs->Finished()) {
-      return false;
+/// A tournament tree of losers over the inputs, whose winner is the input with the
+/// earliest latest time.  Once the winner advanced, only the matches on its path to
+/// the root are replayed, i.e. log2(n) comparisons instead of the n needed to rebuild
+/// a heap.
+class LoserTree {
+ public:
+  /// `inputs` must not be empty, nor contain empty inputs which aren't finished
+  explicit LoserTree(std::vector<InputState*> inputs)
+      : inputs_(std::move(inputs)), keys_(inputs_.size()), nodes_(inputs_.size()) {
+    const size_t n = inputs_.size();
+    DCHECK_GT(n, 0);
+    for (size_t i = 0; i < n; ++i) {
+      UpdateKey(i);
     }
-    if (rhs->Finished()) {
-      return false;
+    // The leaf of input i is the node n + i.  Internal nodes keep the loser of their
+    // match and nodes_[0] the overall winner.
+    std::vector<size_t> winners(2 * n);
+    for (size_t i = 0; i < n; ++i) {
+      winners[n + i] = i;
+    }
+    for (size_t node = n - 1; node > 0; --node) {
+      size_t left = winners[2 * node];
+      size_t right = winners[2 * node + 1];
+      if (Less(right, left)) {
+        std::swap(left, right);
+      }
+      winners[node] = left;
+      nodes_[node] = right;
+    }
+    nodes_[0] = winners[1];
+  }
+
+  InputState* winner() const { return inputs_[nodes_[0]]; }
+
+  /// Whether all inputs finished
+  bool done() const { return keys_[nodes_[0]].finished; }
+
+  /// The latest time of the best input besides the winner, which is one of the inputs
+  /// that lost to it, or the maximum time if the other inputs finished
+  time_unit_t RunnerUpTime() const {
+    time_unit_t time = std::numeric_limits<time_unit_t>::max();
+    for (size_t node = (inputs_.size() + nodes_[0]) / 2; node > 0; node /= 2) {
+      const Key& key = keys_[nodes_[node]];
+      if (!key.finished) {
+        time = std::min(time, key.time);
+      }
+    }
+    return time;
+  }
+
+  /// Find the new winner once the winner advanced
+  void Update() {
+    size_t winner = nodes_[0];
+    UpdateKey(winner);
+    for (size_t node = (inputs_.size() + winner) / 2; node > 0; node /= 2) {
+      if (Less(nodes_[node], winner)) {
+        std::swap(nodes_[node], winner);
+      }
     }
-    time_unit_t lFirst = lhs->GetLatestTime();
-    time_unit_t rFirst = rhs->GetLatestTime();
-    return lFirst > rFirst;
+    nodes_[0] = winner;
   }
+
+ private:
+  struct Key {
+    bool finished;
+    time_unit_t time;
+  };
+
+  void UpdateKey(size_t i) {
+    keys_[i].finished = inputs_[i]->Finished();
+    keys_[i].time = keys_[i].finished ? 0 : inputs_[i]->GetLatestTime();
+  }
+
+  // Finished inputs come last, ties are broken by input order
+  bool Less(size_t a, size_t b) const {
+    const Key& lhs = keys_[a];
+    const Key& rhs = keys_[b];
+    if (lhs.finished != rhs.finished) {
+      return rhs.finished;
+    }
+    if (lhs.finished || lhs.time == rhs.time) {
+      return a < b;
+    }
+    return lhs.time < rhs.time;
+  }
+
+  std::vector<InputState*> inputs_;
+  std::vector<Key> keys_;
+  std::vector<size_t> nodes_;
 };
 
-class SortedMergeNode : public ExecNode {
+class SortedMergeNode : public ExecNode, public TracedNode {
   static constexpr int64_t kTargetOutputBatchSize = 1024 * 1024;
 
  public:
@@ -260,6 +341,7 @@ class SortedMergeNode : public ExecNode {
                   std::shared_ptr<arrow::Schema> output_schema,
                   arrow::Ordering new_ordering)
       : ExecNode(plan, inputs, GetInputLabels(inputs), std::move(output_schema)),
+        TracedNode(this),
         ordering_(std::move(new_ordering)),
         input_counter(inputs_.size()),
         output_counter(inputs_.size()),
@@ -346,6 +428,7 @@ class SortedMergeNode : public ExecNode {
 
   arrow::Status InputReceived(arrow::acero::ExecNode* input,
                               arrow::ExecBatch batch) override {
+    NoteInputReceived(input, batch);
     ARROW_DCHECK(std_has(inputs_, input));
     const size_t index = std_find(inputs_, input) - inputs_.begin();
     ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> rb,
@@ -438,23 +521,16 @@ class SortedMergeNode : public ExecNode {
       }
     }
 
-    std::vector<std::shared_ptr<InputState>> heap = state;
-    // filter out finished states
-    heap.erase(std::remove_if(
-                   heap.begin(), heap.end(),
-                   [](const std::shared_ptr<InputState>& s) { return s->Finished(); }),
-               heap.end());
-
-    // If any are Empty(), then return early since we don't have enough data
-    if (std::any_of(heap.begin(), heap.end(),
-                    [](const std::shared_ptr<InputState>& s) { return s->Empty(); })) {
+    std::vector<InputState*> inputs;
+    for (const auto& s : state) {
+      if (!s->Finished()) {
+        inputs.push_back(s.get());
+      }
+    }
+    if (inputs.empty()) {
       return nullptr;
     }
-
-    // Currently we only support one sort key
-    const auto sort_col = *ordering_.sort_keys().at(0).target.name();
-    const auto comp = InputStateComparator();
-    std::make_heap(heap.begin(), heap.end(), comp);
+    LoserTree tree(std::move(inputs));
 
     // Each slice only has one record batch with the same schema as the output
     std::unordered_map<int, std::pair<int, int>> output_col_to_src;
@@ -466,36 +542,21 @@ class SortedMergeNode : public ExecNode {
                                            plan()->query_context()->memory_pool());
 
     // Generate rows until we run out of data or we exceed the target output
-    // size
-    bool waiting_for_more_data = false;
-    while (!waiting_for_more_data && !heap.empty() &&
-           output.Size() < kTargetOutputBatchSize) {
-      std::pop_heap(heap.begin(), heap.end(), comp);
-
-      auto& next_item = heap.back();
-      time_unit_t latest_time = std::numeric_limits<time_unit_t>::min();
-      time_unit_t new_time = next_item->GetLatestTime();
-      ARROW_CHECK(new_time >= latest_time)
-          << "Input state " << next_item->index()
-          << " has out of order data. newTime=" << new_time
-          << " latestTime=" << latest_time;
-
-      latest_time = new_time;
+    // size.  The winner emits all its rows up to the time of the runner-up at once.
+    while (!tree.done() && output.Size() < kTargetOutputBatchSize) {
+      InputState* next_item = tree.winner();
       SingleRecordBatchSliceBuilder builder{&output};
-      next_item->Advance(builder);
+      next_item->AdvanceUntil(builder, tree.RunnerUpTime());
 
       if (builder.Size() > 0) {
         output_counter[next_item->index()] += builder.Size();
         builder.Finalize();
       }
-      if (next_item->Finished()) {
-        heap.pop_back();
-      } else if (next_item->Empty()) {
+      if (!next_item->Finished() && next_item->Empty()) {
         // We've run out of data on one of the inputs
-        waiting_for_more_data = true;
-        continue;  // skip the unnecessary make_heap
+        break;
       }
-      std::make_heap(heap.begin(), heap.end(), comp);
+      tree.Update();
     }
 
     // Emit the batch
@@ -17,11 +17,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/test_nodes.h"
 #include "arrow/array/builder_base.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/compute/ordering.h"
 #include "arrow/result.h"
@@ -84,4 +88,36 @@ TEST(SortedMergeNode, Basic) {
   AssertArraysEqual(*expected_ts, *output_ts);
 }
 
+TEST(SortedMergeNode, ManyInputs) {
+  constexpr int kNumInputs = 130;
+  std::vector<Declaration::Input> src_decls;
+  std::vector<int32_t> expected;
+  for (int i = 0; i < kNumInputs; ++i) {
+    const int start = i % 17;
+    const int step = 1 + i % 5;
+    const int rows_per_batch = 1 + i % 9;
+    const int num_batches = 1 + i % 4;
+    for (int row = 0; row < rows_per_batch * num_batches; ++row) {
+      expected.push_back(start + row * step);
+    }
+    src_decls.emplace_back(
+        Declaration("table_source",
+                    TableSourceNodeOptions(
+                        TestTable(start, step, rows_per_batch, num_batches))));
+  }
+  std::sort(expected.begin(), expected.end());
+
+  auto ops = OrderByNodeOptions(compute::Ordering({compute::SortKey("timestamp")}));
+  Declaration sorted_merge{"sorted_merge", src_decls, ops};
+  ASSERT_OK_AND_ASSIGN(auto output,
+                       DeclarationToTable(sorted_merge, /*use_threads=*/false));
+  ASSERT_EQ(output->num_rows(), static_cast<int64_t>(expected.size()));
+
+  Int32Builder expected_ts_builder;
+  ASSERT_OK(expected_ts_builder.AppendValues(expected));
+  ASSERT_OK_AND_ASSIGN(auto expected_ts, expected_ts_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto output_ts, Concatenate(output->column(0)->chunks()));
+  AssertArraysEqual(*expected_ts, *output_ts);
+}
+
 }  // namespace arrow::acero
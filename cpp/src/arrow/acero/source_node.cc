@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <atomic>
 #include <mutex>
 #include <optional>
@@ -22,6 +23,7 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
@@ -154,6 +156,11 @@ struct SourceNode : ExecNode, public TracedNode {
             }
             offset += batch_size;
             batch_index++;
+            if (!runtime_filters_.empty()) {
+              QueryContext* ctx = plan_->query_context();
+              ARROW_RETURN_NOT_OK(
+                  runtime_filters_.Apply(ctx, ctx->GetThreadIndex(), &batch));
+            }
             ARROW_RETURN_NOT_OK(output_->InputReceived(this, std::move(batch)));
           } while (offset < morsel.length);
           return Status::OK();
@@ -190,7 +197,7 @@ struct SourceNode : ExecNode, public TracedNode {
     }
     auto fut = Loop([this, options] {
       std::unique_lock<std::mutex> lock(mutex_);
-      if (stop_requested_) {
+      if (stop_requested_ || RowLimitReached()) {
         return Future<ControlFlow<int>>::MakeFinished(Break(batch_count_));
       }
       lock.unlock();
@@ -208,11 +215,21 @@ struct SourceNode : ExecNode, public TracedNode {
             lock.unlock();
             SliceAndDeliverMorsel(*morsel_or_end);
             lock.lock();
+            rows_produced_ += morsel_or_end->length;
             if (!backpressure_future_.is_finished()) {
               EVENT_ON_CURRENT_SPAN("SourceNode::BackpressureApplied");
               return backpressure_future_.Then(
                   []() -> ControlFlow<int> { return Continue(); });
             }
+            lock.unlock();
+            // Wait while spilling nodes write out enough to get back under the budget
+            if (MemoryBudget* memory_budget = plan_->query_context()->memory_budget()) {
+              Future<> room = memory_budget->WaitForRoom();
+              if (!room.is_finished()) {
+                EVENT_ON_CURRENT_SPAN("SourceNode::MemoryBudgetExceeded");
+                return room.Then([]() -> ControlFlow<int> { return Continue(); });
+              }
+            }
             return Future<ControlFlow<int>>::MakeFinished(Continue());
           },
           [](const Status& err) -> Future<ControlFlow<int>> { return err; }, options);
@@ -234,6 +251,23 @@ struct SourceNode : ExecNode, public TracedNode {
 
   const Ordering& ordering() const override { return ordering_; }
 
+  bool AddRuntimeFilter(std::shared_ptr<RuntimeFilter> filter,
+                        std::vector<int> key_ids) override {
+    runtime_filters_.Add(std::move(filter), std::move(key_ids));
+    return true;
+  }
+
+  // The generator is no longer read once the leading rows are all produced, which only
+  // makes sense if their order is meaningful
+  bool SetRowLimit(int64_t num_rows) override {
+    if (ordering_.is_unordered()) {
+      return false;
+    }
+    std::lock_guard<std::mutex> lg(mutex_);
+    row_limit_ = row_limit_ < 0 ? num_rows : std::min(row_limit_, num_rows);
+    return true;
+  }
+
   void PauseProducing(ExecNode* output, int32_t counter) override {
     std::lock_guard<std::mutex> lg(mutex_);
     if (counter <= backpressure_counter_) {
@@ -245,6 +279,7 @@ struct SourceNode : ExecNode, public TracedNode {
       return;
     }
     backpressure_future_ = Future<>::Make();
+    metrics_.NotePaused();
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
@@ -260,6 +295,7 @@ struct SourceNode : ExecNode, public TracedNode {
       }
       to_finish = backpressure_future_;
       backpressure_future_ = Future<>::MakeFinished();
+      metrics_.NoteResumed();
     }
     to_finish.MarkFinished();
   }
@@ -272,6 +308,7 @@ struct SourceNode : ExecNode, public TracedNode {
       if (!backpressure_future_.is_finished()) {
         to_finish = backpressure_future_;
         backpressure_future_ = Future<>::MakeFinished();
+        metrics_.NoteResumed();
       }
     }
     if (to_finish.is_valid()) {
@@ -288,14 +325,24 @@ struct SourceNode : ExecNode, public TracedNode {
   }
 
  private:
+  // Rows removed by runtime filters don't count towards the limit, hence it is
+  // only applied without them
+  bool RowLimitReached() const {
+    return row_limit_ >= 0 && rows_produced_ >= row_limit_ && runtime_filters_.empty();
+  }
+
   std::mutex mutex_;
   std::atomic<int32_t> backpressure_counter_{0};
   Future<> backpressure_future_ = Future<>::MakeFinished();
   bool stop_requested_{false};
   bool started_ = false;
   int batch_count_{0};
+  // A negative limit means all rows are needed
+  int64_t row_limit_ = -1;
+  int64_t rows_produced_ = 0;
   const AsyncGenerator<std::optional<ExecBatch>> generator_;
   const Ordering ordering_;
+  RuntimeFilterSet runtime_filters_;
 };
 
 struct TableSourceNode : public SourceNode {
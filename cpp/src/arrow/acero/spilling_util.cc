@@ -0,0 +1,245 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/spilling_util.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/light_array_internal.h"
+#include "arrow/compute/util.h"
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using compute::Hashing32;
+using compute::KeyColumnArray;
+using compute::TakeOptions;
+using internal::PlatformFilename;
+using internal::TemporaryDir;
+
+namespace acero {
+
+SpillFile::SpillFile(std::string path, std::shared_ptr<Schema> schema)
+    : path_(std::move(path)), schema_(std::move(schema)) {}
+
+SpillFile::~SpillFile() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (writer_) {
+    ARROW_WARN_NOT_OK(writer_->Close(), "Error closing spill file writer");
+    writer_.reset();
+  }
+  if (sink_ && !sink_->closed()) {
+    ARROW_WARN_NOT_OK(sink_->Close(), "Error closing spill file");
+  }
+  reader_.reset();
+  if (source_ && !source_->closed()) {
+    ARROW_WARN_NOT_OK(source_->Close(), "Error closing spill file");
+  }
+  auto maybe_filename = PlatformFilename::FromString(path_);
+  if (maybe_filename.ok()) {
+    ARROW_WARN_NOT_OK(::arrow::internal::DeleteFile(*maybe_filename).status(),
+                      "Error deleting spill file");
+  }
+}
+
+Result<std::unique_ptr<SpillFile>> SpillFile::Make(std::string path,
+                                                   std::shared_ptr<Schema> schema,
+                                                   MemoryPool* pool) {
+  std::unique_ptr<SpillFile> file(new SpillFile(std::move(path), std::move(schema)));
+  ARROW_ASSIGN_OR_RAISE(file->sink_, io::FileOutputStream::Open(file->path_));
+  ipc::IpcWriteOptions options = ipc::IpcWriteOptions::Defaults();
+  options.memory_pool = pool;
+  options.use_threads = false;
+  ARROW_ASSIGN_OR_RAISE(file->writer_,
+                        ipc::MakeFileWriter(file->sink_, file->schema_, options));
+  return std::move(file);
+}
+
+Status SpillFile::Write(const ExecBatch& batch) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                        batch.ToRecordBatch(schema_));
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!writer_) {
+    return Status::Invalid("Cannot write to a spill file after FinishWriting");
+  }
+  RETURN_NOT_OK(writer_->WriteRecordBatch(*record_batch));
+  ++num_batches_;
+  num_rows_ += batch.length;
+  bytes_written_ = writer_->stats().total_raw_body_size;
+  return Status::OK();
+}
+
+Status SpillFile::FinishWriting() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!writer_) {
+    return Status::OK();
+  }
+  RETURN_NOT_OK(writer_->Close());
+  writer_.reset();
+  RETURN_NOT_OK(sink_->Close());
+  sink_.reset();
+  return Status::OK();
+}
+
+Result<ExecBatch> SpillFile::ReadBatch(int i) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (writer_) {
+    return Status::Invalid("Cannot read from a spill file before FinishWriting");
+  }
+  if (!reader_) {
+    ARROW_ASSIGN_OR_RAISE(source_, io::ReadableFile::Open(path_));
+    ipc::IpcReadOptions options = ipc::IpcReadOptions::Defaults();
+    options.use_threads = false;
+    ARROW_ASSIGN_OR_RAISE(reader_, ipc::RecordBatchFileReader::Open(source_, options));
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                        reader_->ReadRecordBatch(i));
+  return ExecBatch(*record_batch);
+}
+
+int SpillFile::num_batches() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_batches_;
+}
+
+int64_t SpillFile::num_rows() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_rows_;
+}
+
+int64_t SpillFile::bytes_written() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return bytes_written_;
+}
+
+SpillDirectory::SpillDirectory(std::string prefix) : prefix_(std::move(prefix)) {}
+
+SpillDirectory::~SpillDirectory() = default;
+
+Result<std::unique_ptr<SpillFile>> SpillDirectory::MakeFile(
+    std::shared_ptr<Schema> schema, MemoryPool* pool) {
+  std::string path;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!dir_) {
+      ARROW_ASSIGN_OR_RAISE(dir_, TemporaryDir::Make(prefix_));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        PlatformFilename filename,
+        dir_->path().Join("spill-" + std::to_string(next_file_id_++) + ".arrow"));
+    path = filename.ToString();
+  }
+  return SpillFile::Make(std::move(path), std::move(schema), pool);
+}
+
+Result<std::vector<ExecBatch>> PartitionBatchByHash(const ExecBatch& batch,
+                                                    const std::vector<int>& key_columns,
+                                                    int num_partitions,
+                                                    QueryContext* ctx,
+                                                    size_t thread_index) {
+  DCHECK_GT(num_partitions, 0);
+  DCHECK_LE(batch.length, std::numeric_limits<int32_t>::max());
+  std::vector<ExecBatch> partitions(num_partitions, ExecBatch({}, 0));
+  if (batch.length == 0) {
+    return partitions;
+  }
+  if (num_partitions == 1) {
+    partitions[0] = batch;
+    return partitions;
+  }
+
+  std::vector<Datum> keys(key_columns.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = batch[key_columns[i]];
+    if (keys[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(keys[i], MakeArrayFromScalar(*keys[i].scalar(), batch.length,
+                                                         ctx->memory_pool()));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(keys)));
+
+  ARROW_ASSIGN_OR_RAISE(arrow::util::TempVectorStack * stack,
+                        ctx->GetTempStack(thread_index));
+  std::vector<uint32_t> hashes(batch.length);
+  std::vector<KeyColumnArray> temp_column_arrays;
+  for (int64_t start = 0; start < batch.length;
+       start += arrow::util::MiniBatch::kMiniBatchLength) {
+    int64_t length =
+        std::min(static_cast<int64_t>(batch.length - start),
+                 static_cast<int64_t>(arrow::util::MiniBatch::kMiniBatchLength));
+    RETURN_NOT_OK(Hashing32::HashBatch(key_batch, hashes.data() + start,
+                                       temp_column_arrays, ctx->hardware_flags(), stack,
+                                       start, length));
+  }
+
+  // Bucket sort row ids on partition id.  The low bits of the hash are used so that
+  // the resulting partitions stay evenly spread over the hash tables built from them
+  // (which bucket rows on the high bits).
+  std::vector<int64_t> prtn_offsets(num_partitions + 1, 0);
+  for (int64_t i = 0; i < batch.length; ++i) {
+    ++prtn_offsets[hashes[i] % num_partitions + 1];
+  }
+  for (int i = 0; i < num_partitions; ++i) {
+    prtn_offsets[i + 1] += prtn_offsets[i];
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      std::shared_ptr<Buffer> row_ids,
+      AllocateBuffer(batch.length * sizeof(int32_t), ctx->memory_pool()));
+  int32_t* row_ids_data = row_ids->mutable_data_as<int32_t>();
+  std::vector<int64_t> write_pos(prtn_offsets.begin(), prtn_offsets.end() - 1);
+  for (int64_t i = 0; i < batch.length; ++i) {
+    row_ids_data[write_pos[hashes[i] % num_partitions]++] = static_cast<int32_t>(i);
+  }
+
+  for (int prtn = 0; prtn < num_partitions; ++prtn) {
+    int64_t prtn_length = prtn_offsets[prtn + 1] - prtn_offsets[prtn];
+    if (prtn_length == 0) {
+      continue;
+    }
+    auto indices = std::make_shared<Int32Array>(
+        prtn_length, SliceBuffer(row_ids, prtn_offsets[prtn] * sizeof(int32_t),
+                                 prtn_length * sizeof(int32_t)));
+    ExecBatch& out = partitions[prtn];
+    out.length = prtn_length;
+    out.values.resize(batch.values.size());
+    for (size_t icol = 0; icol < batch.values.size(); ++icol) {
+      if (batch.values[icol].is_scalar()) {
+        out.values[icol] = batch.values[icol];
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(out.values[icol],
+                            compute::Take(batch.values[icol], indices,
+                                          TakeOptions::NoBoundsCheck(),
+                                          ctx->exec_context()));
+    }
+  }
+  return partitions;
+}
+
+}  // namespace acero
+}  // namespace arrow
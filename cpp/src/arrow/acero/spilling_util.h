@@ -0,0 +1,138 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+
+namespace io {
+class RandomAccessFile;
+}  // namespace io
+
+namespace ipc {
+class RecordBatchFileReader;
+class RecordBatchWriter;
+}  // namespace ipc
+
+namespace acero {
+
+/// \brief A temporary file holding a sequence of batches that did not fit in memory
+///
+/// Batches are stored using the Arrow IPC file format so that they can be read
+/// back individually, in any order, once writing has finished.  Writes and reads
+/// are blocking and should be issued from an IO task (see
+/// QueryContext::ScheduleIOTask).  All methods are thread safe.
+///
+/// The file is deleted when the SpillFile is destroyed.
+class ARROW_ACERO_EXPORT SpillFile {
+ public:
+  ~SpillFile();
+
+  /// \brief Create a new, empty, spill file at `path`
+  static Result<std::unique_ptr<SpillFile>> Make(std::string path,
+                                                 std::shared_ptr<Schema> schema,
+                                                 MemoryPool* pool);
+
+  /// \brief Append a batch to the file
+  ///
+  /// Scalar columns are broadcast to the length of the batch.  Must not be called
+  /// after FinishWriting.
+  Status Write(const ExecBatch& batch);
+
+  /// \brief Flush all written batches and prepare the file for reading
+  Status FinishWriting();
+
+  /// \brief Read back the i-th batch written to the file
+  ///
+  /// FinishWriting must have been called.
+  Result<ExecBatch> ReadBatch(int i);
+
+  int num_batches() const;
+  int64_t num_rows() const;
+  int64_t bytes_written() const;
+  const std::string& path() const { return path_; }
+
+ private:
+  SpillFile(std::string path, std::shared_ptr<Schema> schema);
+
+  const std::string path_;
+  const std::shared_ptr<Schema> schema_;
+
+  mutable std::mutex mutex_;
+  std::shared_ptr<io::OutputStream> sink_;
+  std::shared_ptr<ipc::RecordBatchWriter> writer_;
+  std::shared_ptr<io::RandomAccessFile> source_;
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  int num_batches_ = 0;
+  int64_t num_rows_ = 0;
+  int64_t bytes_written_ = 0;
+};
+
+/// \brief A directory owning the spill files of a single node
+///
+/// The directory is created lazily, the first time a file is requested, inside
+/// the system temporary directory.  It is removed, along with any file left in
+/// it, when the SpillDirectory is destroyed.
+class ARROW_ACERO_EXPORT SpillDirectory {
+ public:
+  /// \param prefix a prefix for the name of the directory, for debugging purposes
+  explicit SpillDirectory(std::string prefix);
+  ~SpillDirectory();
+
+  /// \brief Create a new spill file with a unique name in this directory
+  Result<std::unique_ptr<SpillFile>> MakeFile(std::shared_ptr<Schema> schema,
+                                              MemoryPool* pool);
+
+ private:
+  const std::string prefix_;
+  std::mutex mutex_;
+  std::unique_ptr<::arrow::internal::TemporaryDir> dir_;
+  int64_t next_file_id_ = 0;
+};
+
+/// \brief Split a batch into `num_partitions` batches on the hash of some columns
+///
+/// Rows with equal values in `key_columns` are always assigned to the same partition,
+/// regardless of which batch they came from, so that partitions produced from the two
+/// inputs of a join (or from different batches of the same input) can be processed
+/// independently.  Partitions that receive no rows are returned as batches of length
+/// zero.
+///
+/// The columns referenced by `key_columns` must not be dictionary-encoded.
+ARROW_ACERO_EXPORT
+Result<std::vector<ExecBatch>> PartitionBatchByHash(const ExecBatch& batch,
+                                                    const std::vector<int>& key_columns,
+                                                    int num_partitions,
+                                                    QueryContext* ctx,
+                                                    size_t thread_index);
+
+}  // namespace acero
+}  // namespace arrow
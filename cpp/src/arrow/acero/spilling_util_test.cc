@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <unordered_map>
+
+#include "arrow/acero/spilling_util.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/acero/test_util_internal.h"
+#include "arrow/io/file.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace acero {
+
+TEST(SpillFile, RoundTrip) {
+  auto test_schema = schema({field("i", int32()), field("s", utf8())});
+  SpillDirectory directory("arrow-acero-spilling-test-");
+  ASSERT_OK_AND_ASSIGN(auto file,
+                       directory.MakeFile(test_schema, default_memory_pool()));
+  std::string path = file->path();
+
+  ExecBatch first = ExecBatchFromJSON({int32(), utf8()}, R"([[1, "a"], [2, null]])");
+  // Scalars are broadcast when written
+  ExecBatch second({Datum(MakeScalar(int32_t(7))), Datum(MakeScalar("x"))}, 3);
+  ASSERT_OK(file->Write(first));
+  ASSERT_OK(file->Write(second));
+  ASSERT_OK(file->FinishWriting());
+  ASSERT_RAISES(Invalid, file->Write(first));
+
+  ASSERT_EQ(2, file->num_batches());
+  ASSERT_EQ(5, file->num_rows());
+  ASSERT_GT(file->bytes_written(), 0);
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch second_read, file->ReadBatch(1));
+  AssertExecBatchesEqual(
+      test_schema,
+      {ExecBatchFromJSON({int32(), utf8()}, R"([[7, "x"], [7, "x"], [7, "x"]])")},
+      {second_read});
+  ASSERT_OK_AND_ASSIGN(ExecBatch first_read, file->ReadBatch(0));
+  AssertExecBatchesEqual(test_schema, {first}, {first_read});
+
+  // The file is removed once it is no longer needed
+  file.reset();
+  ASSERT_RAISES(IOError, io::ReadableFile::Open(path));
+}
+
+TEST(PartitionBatchByHash, Basic) {
+  QueryContext ctx;
+  ASSERT_OK(ctx.Init(/*max_num_threads=*/1, /*scheduler=*/nullptr));
+
+  random::RandomArrayGenerator rng(42);
+  constexpr int kNumRows = 5000;
+  constexpr int kNumPartitions = 5;
+  auto make_batch = [&]() {
+    return ExecBatch({rng.Int32(kNumRows, 0, 100, /*null_probability=*/0.1),
+                      rng.String(kNumRows, 0, 4, /*null_probability=*/0.1)},
+                     kNumRows);
+  };
+  ExecBatch batches[2] = {make_batch(), make_batch()};
+
+  // Assign each key value to the partition it was first seen in and check that equal
+  // keys always land in the same partition, across batches.
+  std::unordered_map<std::optional<int32_t>, int> key_to_partition;
+  for (const ExecBatch& batch : batches) {
+    ASSERT_OK_AND_ASSIGN(auto partitions,
+                         PartitionBatchByHash(batch, {0}, kNumPartitions, &ctx,
+                                              /*thread_index=*/0));
+    ASSERT_EQ(kNumPartitions, static_cast<int>(partitions.size()));
+    int64_t total_rows = 0;
+    for (int prtn = 0; prtn < kNumPartitions; ++prtn) {
+      total_rows += partitions[prtn].length;
+      if (partitions[prtn].length == 0) continue;
+      auto keys = partitions[prtn][0].array_as<Int32Array>();
+      ASSERT_EQ(partitions[prtn].length, partitions[prtn][1].length());
+      for (int64_t i = 0; i < keys->length(); ++i) {
+        std::optional<int32_t> key;
+        if (keys->IsValid(i)) key = keys->Value(i);
+        auto inserted = key_to_partition.emplace(key, prtn);
+        ASSERT_EQ(inserted.first->second, prtn);
+      }
+    }
+    ASSERT_EQ(kNumRows, total_rows);
+  }
+  ASSERT_GT(key_to_partition.size(), static_cast<size_t>(kNumPartitions));
+
+  // A single partition gets the whole batch
+  ASSERT_OK_AND_ASSIGN(auto single, PartitionBatchByHash(batches[0], {0, 1}, 1, &ctx,
+                                                         /*thread_index=*/0));
+  ASSERT_EQ(1, static_cast<int>(single.size()));
+  ASSERT_EQ(kNumRows, single[0].length);
+}
+
+}  // namespace acero
+}  // namespace arrow
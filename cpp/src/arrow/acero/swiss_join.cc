@@ -1884,6 +1884,31 @@ void CollectPassingBatchIds(int passing_bit, int64_t hardware_flags, int batch_s
   }
 }
 
+// Appends the conjuncts of `filter` to `conjuncts`, flattening nested "and_kleene" and
+// "and" calls: a row passes the filter if and only if it passes every conjunct.
+void FlattenConjuncts(const Expression& filter, std::vector<Expression>* conjuncts) {
+  const Expression::Call* call = filter.call();
+  if (call != nullptr &&
+      (call->function_name == "and_kleene" || call->function_name == "and")) {
+    for (const Expression& argument : call->arguments) {
+      FlattenConjuncts(argument, conjuncts);
+    }
+    return;
+  }
+  conjuncts->push_back(filter);
+}
+
+// Appends the indices of the filter columns a bound expression refers to
+void CollectFilterColumns(const Expression& expr, std::vector<int>* columns) {
+  if (const Expression::Parameter* param = expr.parameter()) {
+    columns->push_back(param->indices[0]);
+  } else if (const Expression::Call* call = expr.call()) {
+    for (const Expression& argument : call->arguments) {
+      CollectFilterColumns(argument, columns);
+    }
+  }
+}
+
 }  // namespace
 
 void JoinResidualFilter::Init(Expression filter, QueryContext* ctx, MemoryPool* pool,
@@ -1935,6 +1960,31 @@ void JoinResidualFilter::Init(Expression filter, QueryContext* ctx, MemoryPool*
       }
     }
   }
+
+  // Conjuncts are evaluated one after the other so that rows failing one are not
+  // evaluated further. Trivially true ones are dropped, and a trivially false (or null)
+  // one makes the whole filter false.
+  if (filter_ == literal(true)) return;
+  std::vector<Expression> conjuncts;
+  FlattenConjuncts(filter_, &conjuncts);
+  for (Expression& conjunct : conjuncts) {
+    if (conjunct == literal(true)) continue;
+    if (conjunct.IsNullLiteral() || conjunct == literal(false)) {
+      filter_ = literal(false);
+      conjuncts_.clear();
+      conjunct_columns_.clear();
+      return;
+    }
+    std::vector<int> columns;
+    CollectFilterColumns(conjunct, &columns);
+    std::sort(columns.begin(), columns.end());
+    columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+    conjuncts_.push_back(std::move(conjunct));
+    conjunct_columns_.push_back(std::move(columns));
+  }
+  if (conjuncts_.empty()) {
+    filter_ = literal(true);
+  }
 }
 
 void JoinResidualFilter::OnBuildFinished() {
@@ -2172,26 +2222,15 @@ Status JoinResidualFilter::FilterOneBatch(const ExecBatch& keypayload_batch,
     return Status::OK();
   }
 
-  ARROW_ASSIGN_OR_RAISE(Datum mask,
-                        EvalFilter(keypayload_batch, num_batch_rows, batch_row_ids,
-                                   key_ids_maybe_null, payload_ids_maybe_null));
-  if (mask.is_scalar()) {
-    const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
-    if (mask_scalar.is_valid && mask_scalar.value) {
-      *num_passing_rows = num_batch_rows;
-    }
-    return Status::OK();
-  }
+  auto passing_bitvector_buf = arrow::util::TempVectorHolder<uint8_t>(
+      temp_stack, static_cast<uint32_t>(bit_util::BytesForBits(num_batch_rows)));
+  uint8_t* passing_bitvector = passing_bitvector_buf.mutable_data();
+  RETURN_NOT_OK(EvalFilter(keypayload_batch, num_batch_rows, batch_row_ids,
+                           key_ids_maybe_null, payload_ids_maybe_null,
+                           passing_bitvector));
 
-  ARROW_DCHECK_EQ(mask.array()->offset, 0);
-  ARROW_DCHECK_EQ(mask.array()->length, static_cast<int64_t>(num_batch_rows));
-  const uint8_t* validity =
-      mask.array()->buffers[0] ? mask.array()->buffers[0]->data() : nullptr;
-  const uint8_t* comparisons = mask.array()->buffers[1]->data();
   for (int irow = 0; irow < num_batch_rows; ++irow) {
-    bool is_valid = !validity || bit_util::GetBit(validity, irow);
-    bool is_cmp_true = bit_util::GetBit(comparisons, irow);
-    if (is_valid && is_cmp_true) {
+    if (bit_util::GetBit(passing_bitvector, irow)) {
       batch_row_ids[*num_passing_rows] = batch_row_ids[irow];
       if (output_key_ids) {
         key_ids_maybe_null[*num_passing_rows] = key_ids_maybe_null[irow];
@@ -2206,67 +2245,109 @@ Status JoinResidualFilter::FilterOneBatch(const ExecBatch& keypayload_batch,
   return Status::OK();
 }
 
-Result<Datum> JoinResidualFilter::EvalFilter(
-    const ExecBatch& keypayload_batch, int num_batch_rows, const uint16_t* batch_row_ids,
-    const uint32_t* key_ids_maybe_null, const uint32_t* payload_ids_maybe_null) const {
+Status JoinResidualFilter::EvalFilter(const ExecBatch& keypayload_batch,
+                                      int num_batch_rows, const uint16_t* batch_row_ids,
+                                      const uint32_t* key_ids_maybe_null,
+                                      const uint32_t* payload_ids_maybe_null,
+                                      uint8_t* passing_bitvector) const {
   ARROW_DCHECK(!filter_.IsNullLiteral() && filter_ != literal(true) &&
                filter_ != literal(false));
+  ARROW_DCHECK(!conjuncts_.empty());
+
+  bit_util::SetBitsTo(passing_bitvector, 0, num_batch_rows, true);
+
+  // Columns are gathered when a conjunct first refers to them, so those only referred
+  // to by later conjuncts are never gathered if no row passes the earlier ones.
+  ExecBatch filter_input;
+  filter_input.length = num_batch_rows;
+  filter_input.values.resize(probe_filter_to_key_and_payload_.size() +
+                             num_build_keys_referred_ + num_build_payloads_referred_);
+
+  for (size_t i = 0; i < conjuncts_.size(); ++i) {
+    RETURN_NOT_OK(MaterializeFilterColumns(conjunct_columns_[i], keypayload_batch,
+                                           num_batch_rows, batch_row_ids,
+                                           key_ids_maybe_null, payload_ids_maybe_null,
+                                           &filter_input));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum mask,
+        ExecuteScalarExpression(conjuncts_[i], filter_input, ctx_->exec_context()));
 
-  ARROW_ASSIGN_OR_RAISE(
-      ExecBatch input,
-      MaterializeFilterInput(keypayload_batch, num_batch_rows, batch_row_ids,
-                             key_ids_maybe_null, payload_ids_maybe_null));
-  return ExecuteScalarExpression(filter_, input, ctx_->exec_context());
+    if (mask.is_scalar()) {
+      const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
+      if (mask_scalar.is_valid && mask_scalar.value) continue;
+      bit_util::SetBitsTo(passing_bitvector, 0, num_batch_rows, false);
+      return Status::OK();
+    }
+
+    // A row passes if the conjunct is valid and true
+    const ArrayData& mask_data = *mask.array();
+    ARROW_DCHECK_EQ(mask_data.length, static_cast<int64_t>(num_batch_rows));
+    arrow::internal::BitmapAnd(passing_bitvector, 0, mask_data.buffers[1]->data(),
+                               mask_data.offset, num_batch_rows, 0, passing_bitvector);
+    if (mask_data.MayHaveNulls()) {
+      arrow::internal::BitmapAnd(passing_bitvector, 0, mask_data.buffers[0]->data(),
+                                 mask_data.offset, num_batch_rows, 0, passing_bitvector);
+    }
+    if (i + 1 < conjuncts_.size() &&
+        arrow::internal::CountSetBits(passing_bitvector, 0, num_batch_rows) == 0) {
+      break;
+    }
+  }
+  return Status::OK();
 }
 
-Result<ExecBatch> JoinResidualFilter::MaterializeFilterInput(
-    const ExecBatch& keypayload_batch, int num_batch_rows, const uint16_t* batch_row_ids,
-    const uint32_t* key_ids_maybe_null, const uint32_t* payload_ids_maybe_null) const {
-  ExecBatch out;
-  out.length = num_batch_rows;
-  out.values.resize(probe_filter_to_key_and_payload_.size() + num_build_keys_referred_ +
-                    num_build_payloads_referred_);
+Status JoinResidualFilter::MaterializeFilterColumns(
+    const std::vector<int>& filter_columns, const ExecBatch& keypayload_batch,
+    int num_batch_rows, const uint16_t* batch_row_ids,
+    const uint32_t* key_ids_maybe_null, const uint32_t* payload_ids_maybe_null,
+    ExecBatch* filter_input) const {
+  const int num_probe_cols = static_cast<int>(probe_filter_to_key_and_payload_.size());
 
-  if (probe_filter_to_key_and_payload_.size() > 0) {
+  // Probe side columns not gathered yet, gathered together
+  std::vector<int> probe_cols, probe_col_ids;
+  for (int col : filter_columns) {
+    if (col < num_probe_cols && filter_input->values[col].kind() == Datum::NONE) {
+      probe_cols.push_back(col);
+      probe_col_ids.push_back(probe_filter_to_key_and_payload_[col]);
+    }
+  }
+  if (!probe_cols.empty()) {
     ExecBatchBuilder probe_batch_builder;
     RETURN_NOT_OK(probe_batch_builder.AppendSelected(
         pool_, keypayload_batch, num_batch_rows, batch_row_ids,
-        static_cast<int>(probe_filter_to_key_and_payload_.size()),
-        probe_filter_to_key_and_payload_.data()));
+        static_cast<int>(probe_col_ids.size()), probe_col_ids.data()));
     ExecBatch probe_batch = probe_batch_builder.Flush();
-    ARROW_DCHECK(probe_batch.values.size() == probe_filter_to_key_and_payload_.size());
-    for (size_t i = 0; i < probe_batch.values.size(); ++i) {
-      out.values[i] = std::move(probe_batch.values[i]);
+    ARROW_DCHECK(probe_batch.values.size() == probe_cols.size());
+    for (size_t i = 0; i < probe_cols.size(); ++i) {
+      filter_input->values[probe_cols[i]] = std::move(probe_batch.values[i]);
     }
   }
 
-  if (num_build_keys_referred_ > 0 || num_build_payloads_referred_ > 0) {
-    ARROW_DCHECK(num_build_keys_referred_ == 0 || key_ids_maybe_null);
-    ARROW_DCHECK(num_build_payloads_referred_ == 0 || payload_ids_maybe_null);
-
-    int num_build_cols = build_schemas_->num_cols(HashJoinProjection::FILTER);
-    auto to_key =
-        build_schemas_->map(HashJoinProjection::FILTER, HashJoinProjection::KEY);
-    auto to_payload =
-        build_schemas_->map(HashJoinProjection::FILTER, HashJoinProjection::PAYLOAD);
-    for (int i = 0; i < num_build_cols; ++i) {
-      ResizableArrayData column_data;
-      column_data.Init(build_schemas_->data_type(HashJoinProjection::FILTER, i), pool_,
-                       bit_util::Log2(num_batch_rows));
-      if (auto idx = to_key.get(i); idx != SchemaProjectionMap::kMissingField) {
-        RETURN_NOT_OK(build_keys_->DecodeSelected(&column_data, idx, num_batch_rows,
-                                                  key_ids_maybe_null, pool_));
-      } else if (idx = to_payload.get(i); idx != SchemaProjectionMap::kMissingField) {
-        RETURN_NOT_OK(build_payloads_->DecodeSelected(&column_data, idx, num_batch_rows,
-                                                      payload_ids_maybe_null, pool_));
-      } else {
-        ARROW_DCHECK(false);
-      }
-      out.values[probe_filter_to_key_and_payload_.size() + i] = column_data.array_data();
+  auto to_key = build_schemas_->map(HashJoinProjection::FILTER, HashJoinProjection::KEY);
+  auto to_payload =
+      build_schemas_->map(HashJoinProjection::FILTER, HashJoinProjection::PAYLOAD);
+  for (int col : filter_columns) {
+    if (col < num_probe_cols || filter_input->values[col].kind() != Datum::NONE) {
+      continue;
     }
+    const int i = col - num_probe_cols;
+    ResizableArrayData column_data;
+    column_data.Init(build_schemas_->data_type(HashJoinProjection::FILTER, i), pool_,
+                     bit_util::Log2(num_batch_rows));
+    if (auto idx = to_key.get(i); idx != SchemaProjectionMap::kMissingField) {
+      ARROW_DCHECK(key_ids_maybe_null);
+      RETURN_NOT_OK(build_keys_->DecodeSelected(&column_data, idx, num_batch_rows,
+                                                key_ids_maybe_null, pool_));
+    } else if (idx = to_payload.get(i); idx != SchemaProjectionMap::kMissingField) {
+      ARROW_DCHECK(payload_ids_maybe_null);
+      RETURN_NOT_OK(build_payloads_->DecodeSelected(&column_data, idx, num_batch_rows,
+                                                    payload_ids_maybe_null, pool_));
+    } else {
+      ARROW_DCHECK(false);
+    }
+    filter_input->values[col] = column_data.array_data();
   }
-
-  return out;
+  return Status::OK();
 }
 
 void JoinProbeProcessor::Init(int num_key_columns, JoinType join_type,
@@ -849,19 +849,29 @@ class JoinResidualFilter {
                         bool output_payload_ids, arrow::util::TempVectorStack* temp_stack,
                         int* num_passing_rows) const;
 
-  Result<Datum> EvalFilter(const ExecBatch& keypayload_batch, int num_batch_rows,
-                           const uint16_t* batch_row_ids,
-                           const uint32_t* key_ids_maybe_null,
-                           const uint32_t* payload_ids_maybe_null) const;
+  // Evaluates the conjuncts of the filter one after the other, clearing the bits of the
+  // rows failing each in `passing_bitvector`. Stops as soon as no row passes.
+  //
+  Status EvalFilter(const ExecBatch& keypayload_batch, int num_batch_rows,
+                    const uint16_t* batch_row_ids, const uint32_t* key_ids_maybe_null,
+                    const uint32_t* payload_ids_maybe_null,
+                    uint8_t* passing_bitvector) const;
 
-  Result<ExecBatch> MaterializeFilterInput(const ExecBatch& keypayload_batch,
-                                           int num_batch_rows,
-                                           const uint16_t* batch_row_ids,
-                                           const uint32_t* key_ids_maybe_null,
-                                           const uint32_t* payload_ids_maybe_null) const;
+  // Gathers the given filter columns of the matching rows into `filter_input`, unless
+  // already gathered.
+  //
+  Status MaterializeFilterColumns(const std::vector<int>& filter_columns,
+                                  const ExecBatch& keypayload_batch, int num_batch_rows,
+                                  const uint16_t* batch_row_ids,
+                                  const uint32_t* key_ids_maybe_null,
+                                  const uint32_t* payload_ids_maybe_null,
+                                  ExecBatch* filter_input) const;
 
  private:
   Expression filter_;
+  // The non-trivial conjuncts of filter_, and the filter columns each refers to
+  std::vector<Expression> conjuncts_;
+  std::vector<std::vector<int>> conjunct_columns_;
 
   QueryContext* ctx_;
   MemoryPool* pool_;
@@ -84,6 +84,14 @@ class TaskSchedulerImpl : public TaskScheduler {
   Status OnTaskGroupFinished(size_t thread_id, int group_id,
                              bool* all_task_groups_finished);
   Status ScheduleMore(size_t thread_id, int num_tasks_finished = 0);
+  Status RunSlot(size_t thread_id, int group_id, int64_t task_id);
+
+  // The number of tasks a scheduled task runs, picking the next one itself, before
+  // handing its slot back.  Running a few tasks in a row keeps their state in the
+  // caches of one core and saves a round trip through the executor for each task,
+  // while handing the slot back now and then lets other work queued on the executor
+  // run.
+  static constexpr int kMaxTasksPerSlot = 64;
 
   bool use_sync_execution_;
   int num_concurrent_tasks_;
@@ -369,23 +377,42 @@ Status TaskSchedulerImpl::ScheduleMore(size_t thread_id, int num_tasks_finished)
     int group_id = tasks[i].first;
     int64_t task_id = tasks[i].second;
     RETURN_NOT_OK(schedule_impl_([this, group_id, task_id](size_t thread_id) -> Status {
-      RETURN_NOT_OK(ScheduleMore(thread_id, 1));
-
-      bool task_group_finished = false;
-      RETURN_NOT_OK(ExecuteTask(thread_id, group_id, task_id, &task_group_finished));
-
-      if (task_group_finished) {
-        bool all_task_groups_finished = false;
-        return OnTaskGroupFinished(thread_id, group_id, &all_task_groups_finished);
-      }
-
-      return Status::OK();
+      return RunSlot(thread_id, group_id, task_id);
     }));
   }
 
   return Status::OK();
 }
 
+Status TaskSchedulerImpl::RunSlot(size_t thread_id, int group_id, int64_t task_id) {
+  for (int num_tasks_run = 1;; ++num_tasks_run) {
+    bool task_group_finished = false;
+    RETURN_NOT_OK(ExecuteTask(thread_id, group_id, task_id, &task_group_finished));
+
+    if (task_group_finished) {
+      bool all_task_groups_finished = false;
+      RETURN_NOT_OK(
+          OnTaskGroupFinished(thread_id, group_id, &all_task_groups_finished));
+    }
+
+    if (aborted_) {
+      return Status::Cancelled("Scheduler cancelled");
+    }
+    if (num_tasks_run == kMaxTasksPerSlot) {
+      break;
+    }
+    // Task groups are picked from in order of priority, as by ScheduleMore
+    const auto& tasks = PickTasks(1);
+    if (tasks.empty()) {
+      break;
+    }
+    group_id = tasks[0].first;
+    task_id = tasks[0].second;
+  }
+  // Hand the slot back, scheduling tasks that were added while this one ran
+  return ScheduleMore(thread_id, 1);
+}
+
 void TaskSchedulerImpl::Abort(AbortContinuationImpl impl) {
   bool all_finished = true;
   {
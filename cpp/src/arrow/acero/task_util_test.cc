@@ -231,5 +231,51 @@ TEST(TaskScheduler, StressTwo) {
   }
 }
 
+// A scheduled task keeps running the tasks that are ready instead of going through
+// the executor for each of them
+TEST(TaskScheduler, RunsReadyTasksInSlot) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  constexpr int kTasksPerGroup = 1000;
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ThreadPool> thread_pool, ThreadPool::Make(2));
+  ThreadIndexer thread_indexer;
+  std::atomic<int> num_tasks_run(0);
+  std::atomic<int> num_scheduled(0);
+  std::atomic<int> final_counter(1);
+  std::mutex mutex;
+  std::condition_variable finish_cv;
+
+  auto scheduler = TaskScheduler::Make();
+  int group_id = scheduler->RegisterTaskGroup(
+      [&](std::size_t, int64_t) {
+        num_tasks_run.fetch_add(1);
+        return Status::OK();
+      },
+      MakeFinalContinuation(&final_counter, &mutex, &finish_cv));
+  scheduler->RegisterEnd();
+
+  TaskScheduler::ScheduleImpl schedule =
+      [&](TaskScheduler::TaskGroupContinuationImpl task) {
+        num_scheduled.fetch_add(1);
+        return thread_pool->Spawn([&, task] {
+          std::size_t thread_id = thread_indexer();
+          ASSERT_OK(task(thread_id));
+        });
+      };
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_OK(scheduler->StartScheduling(0, schedule, /*num_concurrent_tasks=*/1, false));
+  ASSERT_OK(scheduler->StartTaskGroup(0, group_id, kTasksPerGroup));
+  finish_cv.wait(lock, [&] { return final_counter.load() == 0; });
+  lock.unlock();
+  thread_pool->WaitForIdle();
+
+  ASSERT_EQ(kTasksPerGroup, num_tasks_run.load());
+  // Every slot runs at most 64 tasks before it is scheduled again
+  ASSERT_GE(num_scheduled.load(), kTasksPerGroup / 64);
+  ASSERT_LE(num_scheduled.load(), kTasksPerGroup / 64 + 2);
+}
+
 }  // namespace acero
 }  // namespace arrow
@@ -337,7 +337,7 @@ struct GatedNode : public ExecNode, public TracedNode {
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    auto scope = TraceInputReceived(batch);
+    auto scope = TraceInputReceived(input, batch);
     DCHECK_EQ(input, inputs_[0]);
 
     // This may be called concurrently by the source and by a restart attempt.  Process
@@ -121,8 +121,8 @@ void ValidateOutput(const Datum& output) {
 }
 
 std::vector<int64_t> HardwareFlagsForTesting() {
-  // Acero currently only has AVX2 optimizations
-  return arrow::GetSupportedHardwareFlags({CpuInfo::AVX2});
+  // Acero currently has AVX2 and AVX-512 optimizations
+  return arrow::GetSupportedHardwareFlags({CpuInfo::AVX2, CpuInfo::AVX512});
 }
 
 namespace {
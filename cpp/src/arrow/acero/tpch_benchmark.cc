@@ -14,116 +14,1011 @@
 // KIND, either express or implied.  See the License for the
 // specific language governing permissions and limitations
 // under the License.
+// Runs the 22 TPC-H queries over generated data.
+//
+// The data is generated once per scale factor and held in memory, so that the
+// generation isn't part of the timings.  The scale factor is read from the
+// ARROW_TPCH_SCALE_FACTOR environment variable (1 by default) and the thread counts
+// to run every query with from ARROW_TPCH_THREADS (a comma separated list, 1 and the
+// number of hardware threads by default).  Use --benchmark_format=json for a machine
+// readable report; each run reports the peak memory allocated by the query and the
+// processing time of each kind of node as counters.  Queries 13 and 16 need the
+// match_like function, i.e. a build with RE2.
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
-#include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/tpch_node.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
-#include "arrow/testing/future_util.h"
-
-#include <memory>
+#include "arrow/memory_pool.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
+using compute::and_;
 using compute::call;
 using compute::CountOptions;
 using compute::field_ref;
-using compute::ScalarAggregateOptions;
+using compute::literal;
+using compute::not_;
+using compute::or_;
 using compute::SortKey;
+using compute::SortOrder;
 
 namespace acero {
 namespace internal {
+namespace {
+
+// Fixed width strings are padded with zero bytes by the generator
+Expression Text(std::string value, int32_t width) {
+  value.resize(width, '\0');
+  return literal(std::make_shared<FixedSizeBinaryScalar>(
+      Buffer::FromString(std::move(value)), fixed_size_binary(width)));
+}
+
+Expression TextIn(const std::string& column, std::vector<std::string> values,
+                  int32_t width) {
+  FixedSizeBinaryBuilder builder(fixed_size_binary(width));
+  for (std::string& value : values) {
+    value.resize(width, '\0');
+    ARROW_CHECK_OK(builder.Append(value));
+  }
+  return call("is_in", {field_ref(column)},
+              compute::SetLookupOptions(builder.Finish().ValueOrDie()));
+}
+
+Expression IntIn(const std::string& column, const std::vector<int32_t>& values) {
+  Int32Builder builder;
+  ARROW_CHECK_OK(builder.AppendValues(values));
+  return call("is_in", {field_ref(column)},
+              compute::SetLookupOptions(builder.Finish().ValueOrDie()));
+}
+
+// Patterns with a single literal part that is anchored to neither end, the start or
+// the end are matched without a regular expression
+Expression Like(const std::string& column, std::string pattern) {
+  std::string_view literal_part = pattern;
+  bool any_prefix = !literal_part.empty() && literal_part.front() == '%';
+  if (any_prefix) literal_part.remove_prefix(1);
+  bool any_suffix = !literal_part.empty() && literal_part.back() == '%';
+  if (any_suffix) literal_part.remove_suffix(1);
+  const char* function = "match_like";
+  if ((any_prefix || any_suffix) &&
+      literal_part.find_first_of("%_\\") == std::string_view::npos) {
+    function = !any_prefix ? "starts_with" : any_suffix ? "match_substring" : "ends_with";
+    pattern = std::string(literal_part);
+  }
+  return call(function, {field_ref(column)},
+              compute::MatchSubstringOptions(std::move(pattern)));
+}
+
+Expression Date(std::string_view value) {
+  return literal(Scalar::Parse(date32(), value).ValueOrDie());
+}
+
+Expression Money(std::string_view value) {
+  Decimal128 parsed;
+  int32_t precision, scale;
+  ARROW_CHECK_OK(Decimal128::FromString(value, &parsed, &precision, &scale));
+  return literal(std::make_shared<Decimal128Scalar>(parsed.Rescale(scale, 2).ValueOrDie(),
+                                                    decimal(12, 2)));
+}
+
+Expression Float(Expression value) {
+  return call("cast", {std::move(value)}, compute::CastOptions::Safe(float64()));
+}
+
+Expression Between(const std::string& column, Expression low, Expression high) {
+  return and_(greater_equal(field_ref(column), std::move(low)),
+              less_equal(field_ref(column), std::move(high)));
+}
+
+// low <= column < high
+Expression InRange(const std::string& column, Expression low, Expression high) {
+  return and_(greater_equal(field_ref(column), std::move(low)),
+              less(field_ref(column), std::move(high)));
+}
+
+Expression Year(const std::string& column) { return call("year", {field_ref(column)}); }
+
+// l_extendedprice * (1 - l_discount)
+Expression Revenue() {
+  return call("multiply", {field_ref("L_EXTENDEDPRICE"),
+                           call("subtract", {Money("1"), field_ref("L_DISCOUNT")})});
+}
+
+Declaration Filter(Declaration input, Expression predicate) {
+  return Declaration("filter", {std::move(input)},
+                     FilterNodeOptions(std::move(predicate)));
+}
+
+Declaration Project(Declaration input, std::vector<Expression> expressions,
+                    std::vector<std::string> names) {
+  return Declaration("project", {std::move(input)},
+                     ProjectNodeOptions(std::move(expressions), std::move(names)));
+}
+
+// The right input is the build side
+Declaration Join(Declaration left, Declaration right, std::vector<FieldRef> left_keys,
+                 std::vector<FieldRef> right_keys, JoinType join_type = JoinType::INNER,
+                 Expression filter = literal(true)) {
+  return Declaration("hashjoin", {std::move(left), std::move(right)},
+                     HashJoinNodeOptions(join_type, std::move(left_keys),
+                                         std::move(right_keys), std::move(filter)));
+}
+
+Declaration Aggregate(Declaration input, std::vector<compute::Aggregate> aggregates,
+                      std::vector<FieldRef> keys = {}) {
+  return Declaration("aggregate", {std::move(input)},
+                     AggregateNodeOptions(std::move(aggregates), std::move(keys)));
+}
+
+Declaration OrderBy(Declaration input, std::vector<SortKey> keys) {
+  return Declaration("order_by", {std::move(input)},
+                     OrderByNodeOptions(Ordering(std::move(keys))));
+}
+
+Declaration Fetch(Declaration input, int64_t count) {
+  return Declaration("fetch", {std::move(input)}, FetchNodeOptions(0, count));
+}
+
+// Adds a constant key to join the single row of a scalar aggregate with every row
+Declaration WithJoinKey(Declaration input, const std::vector<std::string>& columns) {
+  std::vector<Expression> expressions = {literal(0)};
+  std::vector<std::string> names = {"join_key"};
+  for (const std::string& column : columns) {
+    expressions.push_back(field_ref(column));
+    names.push_back(column);
+  }
+  return Project(std::move(input), std::move(expressions), std::move(names));
+}
+
+class TpchTables {
+ public:
+  static Result<std::unique_ptr<TpchTables>> Generate(double scale_factor) {
+    auto tables = std::unique_ptr<TpchTables>(new TpchTables(scale_factor));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> plan, ExecPlan::Make());
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<TpchGen> gen,
+                          TpchGen::Make(plan.get(), scale_factor));
+    std::vector<std::pair<std::string, ExecNode*>> nodes;
+    ARROW_ASSIGN_OR_RAISE(nodes.emplace_back("lineitem", nullptr).second,
+                          gen->Lineitem());
+    ARROW_ASSIGN_OR_RAISE(nodes.emplace_back("orders", nullptr).second, gen->Orders());
+    ARROW_ASSIGN_OR_RAISE(nodes.emplace_back("customer", nullptr).second,
+                          gen->Customer());
+    ARROW_ASSIGN_OR_RAISE(nodes.emplace_back("part", nullptr).second, gen->Part());
+    ARROW_ASSIGN_OR_RAISE(nodes.emplace_back("partsupp", nullptr).second,
+                          gen->PartSupp());
+    ARROW_ASSIGN_OR_RAISE(nodes.emplace_back("supplier", nullptr).second,
+                          gen->Supplier());
+    ARROW_ASSIGN_OR_RAISE(nodes.emplace_back("nation", nullptr).second, gen->Nation());
+    ARROW_ASSIGN_OR_RAISE(nodes.emplace_back("region", nullptr).second, gen->Region());
+    for (const auto& [name, node] : nodes) {
+      Declaration sink("table_sink", {Declaration::Input(node)},
+                       TableSinkNodeOptions(&tables->tables_[name]));
+      RETURN_NOT_OK(sink.AddToPlan(plan.get()));
+    }
+    RETURN_NOT_OK(plan->Validate());
+    plan->StartProducing();
+    RETURN_NOT_OK(plan->finished().status());
+    return tables;
+  }
+
+  double scale_factor() const { return scale_factor_; }
+
+  // The given columns of a table
+  Declaration Scan(const std::string& table,
+                   const std::vector<std::string>& columns) const {
+    std::vector<Expression> expressions;
+    for (const std::string& column : columns) {
+      expressions.push_back(field_ref(column));
+    }
+    return Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(tables_.at(table))},
+         {"project", ProjectNodeOptions(std::move(expressions), columns)}});
+  }
+
+ private:
+  explicit TpchTables(double scale_factor) : scale_factor_(scale_factor) {}
+
+  double scale_factor_;
+  std::map<std::string, std::shared_ptr<Table>> tables_;
+};
+
+// Pricing summary report
+Declaration Q1(const TpchTables& t) {
+  Declaration lineitem = Filter(
+      t.Scan("lineitem", {"L_QUANTITY", "L_EXTENDEDPRICE", "L_DISCOUNT", "L_TAX",
+                          "L_RETURNFLAG", "L_LINESTATUS", "L_SHIPDATE"}),
+      less_equal(field_ref("L_SHIPDATE"), Date("1998-09-02")));
+  Expression disc_price = Revenue();
+  // Keep the precision of the product within the limits of decimal128
+  Expression charge = call(
+      "multiply",
+      {call("cast", {disc_price}, compute::CastOptions::Unsafe(decimal(12, 2))),
+       call("add", {Money("1"), field_ref("L_TAX")})});
+  Declaration projected = Project(
+      std::move(lineitem),
+      {field_ref("L_RETURNFLAG"), field_ref("L_LINESTATUS"), field_ref("L_QUANTITY"),
+       field_ref("L_EXTENDEDPRICE"), disc_price, charge, field_ref("L_DISCOUNT")},
+      {"l_returnflag", "l_linestatus", "l_quantity", "l_extendedprice", "disc_price",
+       "charge", "l_discount"});
+  Declaration aggregated =
+      Aggregate(std::move(projected),
+                {{"hash_sum", "l_quantity", "sum_qty"},
+                 {"hash_sum", "l_extendedprice", "sum_base_price"},
+                 {"hash_sum", "disc_price", "sum_disc_price"},
+                 {"hash_sum", "charge", "sum_charge"},
+                 {"hash_mean", "l_quantity", "avg_qty"},
+                 {"hash_mean", "l_extendedprice", "avg_price"},
+                 {"hash_mean", "l_discount", "avg_disc"},
+                 {"hash_count_all", "count_order"}},
+                {"l_returnflag", "l_linestatus"});
+  return OrderBy(std::move(aggregated),
+                 {SortKey("l_returnflag"), SortKey("l_linestatus")});
+}
+
+// Minimum cost supplier
+Declaration Q2(const TpchTables& t) {
+  auto european_partsupp = [&t] {
+    Declaration region =
+        Filter(t.Scan("region", {"R_REGIONKEY", "R_NAME"}),
+               equal(field_ref("R_NAME"), Text("EUROPE", 25)));
+    Declaration nation = Join(t.Scan("nation", {"N_NATIONKEY", "N_NAME", "N_REGIONKEY"}),
+                              std::move(region), {"N_REGIONKEY"}, {"R_REGIONKEY"});
+    Declaration supplier =
+        Join(t.Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_ADDRESS", "S_NATIONKEY",
+                                 "S_PHONE", "S_ACCTBAL", "S_COMMENT"}),
+             std::move(nation), {"S_NATIONKEY"}, {"N_NATIONKEY"});
+    return Join(t.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY", "PS_SUPPLYCOST"}),
+                std::move(supplier), {"PS_SUPPKEY"}, {"S_SUPPKEY"});
+  };
+  Declaration part = Filter(t.Scan("part", {"P_PARTKEY", "P_MFGR", "P_SIZE", "P_TYPE"}),
+                            and_(equal(field_ref("P_SIZE"), literal(15)),
+                                 Like("P_TYPE", "%BRASS")));
+  Declaration min_cost = Project(
+      Aggregate(european_partsupp(), {{"hash_min", "PS_SUPPLYCOST", "min_cost"}},
+                {"PS_PARTKEY"}),
+      {field_ref("PS_PARTKEY"), field_ref("min_cost")}, {"min_partkey", "min_cost"});
+  Declaration joined =
+      Join(Join(european_partsupp(), std::move(part), {"PS_PARTKEY"}, {"P_PARTKEY"}),
+           std::move(min_cost), {"PS_PARTKEY", "PS_SUPPLYCOST"},
+           {"min_partkey", "min_cost"});
+  Declaration projected = Project(
+      std::move(joined),
+      {field_ref("S_ACCTBAL"), field_ref("S_NAME"), field_ref("N_NAME"),
+       field_ref("P_PARTKEY"), field_ref("P_MFGR"), field_ref("S_ADDRESS"),
+       field_ref("S_PHONE"), field_ref("S_COMMENT")},
+      {"s_acctbal", "s_name", "n_name", "p_partkey", "p_mfgr", "s_address", "s_phone",
+       "s_comment"});
+  return Fetch(OrderBy(std::move(projected),
+                       {SortKey("s_acctbal", SortOrder::Descending), SortKey("n_name"),
+                        SortKey("s_name"), SortKey("p_partkey")}),
+               100);
+}
+
+// Shipping priority
+Declaration Q3(const TpchTables& t) {
+  Declaration customer = Filter(t.Scan("customer", {"C_CUSTKEY", "C_MKTSEGMENT"}),
+                                equal(field_ref("C_MKTSEGMENT"), Text("BUILDING", 10)));
+  Declaration orders = Filter(
+      t.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE", "O_SHIPPRIORITY"}),
+      less(field_ref("O_ORDERDATE"), Date("1995-03-15")));
+  Declaration lineitem = Filter(
+      t.Scan("lineitem", {"L_ORDERKEY", "L_EXTENDEDPRICE", "L_DISCOUNT", "L_SHIPDATE"}),
+      greater(field_ref("L_SHIPDATE"), Date("1995-03-15")));
+  Declaration joined = Join(
+      std::move(lineitem),
+      Join(std::move(orders), std::move(customer), {"O_CUSTKEY"}, {"C_CUSTKEY"}),
+      {"L_ORDERKEY"}, {"O_ORDERKEY"});
+  Declaration projected =
+      Project(std::move(joined),
+              {field_ref("L_ORDERKEY"), field_ref("O_ORDERDATE"),
+               field_ref("O_SHIPPRIORITY"), Revenue()},
+              {"l_orderkey", "o_orderdate", "o_shippriority", "volume"});
+  Declaration aggregated =
+      Aggregate(std::move(projected), {{"hash_sum", "volume", "revenue"}},
+                {"l_orderkey", "o_orderdate", "o_shippriority"});
+  return Fetch(OrderBy(std::move(aggregated), {SortKey("revenue", SortOrder::Descending),
+                                               SortKey("o_orderdate")}),
+               10);
+}
+
+// Order priority checking
+Declaration Q4(const TpchTables& t) {
+  Declaration orders =
+      Filter(t.Scan("orders", {"O_ORDERKEY", "O_ORDERDATE", "O_ORDERPRIORITY"}),
+             InRange("O_ORDERDATE", Date("1993-07-01"), Date("1993-10-01")));
+  Declaration lineitem =
+      Filter(t.Scan("lineitem", {"L_ORDERKEY", "L_COMMITDATE", "L_RECEIPTDATE"}),
+             less(field_ref("L_COMMITDATE"), field_ref("L_RECEIPTDATE")));
+  // The orders for which a late lineitem exists
+  Declaration late_orders = Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"},
+                                 {"O_ORDERKEY"}, JoinType::RIGHT_SEMI);
+  Declaration aggregated = Aggregate(std::move(late_orders),
+                                     {{"hash_count_all", "order_count"}},
+                                     {"O_ORDERPRIORITY"});
+  return OrderBy(std::move(aggregated), {SortKey("O_ORDERPRIORITY")});
+}
+
+// Local supplier volume
+Declaration Q5(const TpchTables& t) {
+  Declaration region = Filter(t.Scan("region", {"R_REGIONKEY", "R_NAME"}),
+                              equal(field_ref("R_NAME"), Text("ASIA", 25)));
+  Declaration nation = Join(t.Scan("nation", {"N_NATIONKEY", "N_NAME", "N_REGIONKEY"}),
+                            std::move(region), {"N_REGIONKEY"}, {"R_REGIONKEY"});
+  Declaration supplier = Join(t.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}),
+                              std::move(nation), {"S_NATIONKEY"}, {"N_NATIONKEY"});
+  Declaration orders =
+      Filter(t.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE"}),
+             InRange("O_ORDERDATE", Date("1994-01-01"), Date("1995-01-01")));
+  Declaration customer_orders =
+      Join(std::move(orders), t.Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"}),
+           {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  Declaration lineitem = t.Scan(
+      "lineitem", {"L_ORDERKEY", "L_SUPPKEY", "L_EXTENDEDPRICE", "L_DISCOUNT"});
+  // Customers and suppliers of the same nation
+  Declaration joined =
+      Join(Join(std::move(lineitem), std::move(supplier), {"L_SUPPKEY"}, {"S_SUPPKEY"}),
+           std::move(customer_orders), {"L_ORDERKEY", "S_NATIONKEY"},
+           {"O_ORDERKEY", "C_NATIONKEY"});
+  Declaration aggregated = Aggregate(
+      Project(std::move(joined), {field_ref("N_NAME"), Revenue()}, {"n_name", "volume"}),
+      {{"hash_sum", "volume", "revenue"}}, {"n_name"});
+  return OrderBy(std::move(aggregated), {SortKey("revenue", SortOrder::Descending)});
+}
+
+// Forecasting revenue change
+Declaration Q6(const TpchTables& t) {
+  Declaration lineitem = Filter(
+      t.Scan("lineitem", {"L_SHIPDATE", "L_DISCOUNT", "L_QUANTITY", "L_EXTENDEDPRICE"}),
+      and_({greater_equal(field_ref("L_SHIPDATE"), Date("1994-01-01")),
+            less(field_ref("L_SHIPDATE"), Date("1995-01-01")),
+            Between("L_DISCOUNT", Money("0.05"), Money("0.07")),
+            less(field_ref("L_QUANTITY"), Money("24"))}));
+  Declaration projected = Project(
+      std::move(lineitem),
+      {call("multiply", {field_ref("L_EXTENDEDPRICE"), field_ref("L_DISCOUNT")})},
+      {"volume"});
+  return Aggregate(std::move(projected), {{"sum", "volume", "revenue"}});
+}
+
+// Volume shipping
+Declaration Q7(const TpchTables& t) {
+  auto nation = [&t](std::string key_name, std::string name) {
+    return Project(Filter(t.Scan("nation", {"N_NATIONKEY", "N_NAME"}),
+                          TextIn("N_NAME", {"FRANCE", "GERMANY"}, 25)),
+                   {field_ref("N_NATIONKEY"), field_ref("N_NAME")},
+                   {std::move(key_name), std::move(name)});
+  };
+  Declaration supplier =
+      Join(t.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}),
+           nation("n1_nationkey", "supp_nation"), {"S_NATIONKEY"}, {"n1_nationkey"});
+  Declaration customer =
+      Join(t.Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"}),
+           nation("n2_nationkey", "cust_nation"), {"C_NATIONKEY"}, {"n2_nationkey"});
+  Declaration orders = Join(t.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY"}),
+                            std::move(customer), {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  Declaration lineitem =
+      Filter(t.Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY", "L_SHIPDATE",
+                                 "L_EXTENDEDPRICE", "L_DISCOUNT"}),
+             Between("L_SHIPDATE", Date("1995-01-01"), Date("1996-12-31")));
+  Declaration joined =
+      Join(Join(std::move(lineitem), std::move(supplier), {"L_SUPPKEY"}, {"S_SUPPKEY"}),
+           std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"});
+  Declaration filtered = Filter(
+      std::move(joined),
+      or_(and_(equal(field_ref("supp_nation"), Text("FRANCE", 25)),
+               equal(field_ref("cust_nation"), Text("GERMANY", 25))),
+          and_(equal(field_ref("supp_nation"), Text("GERMANY", 25)),
+               equal(field_ref("cust_nation"), Text("FRANCE", 25)))));
+  Declaration projected =
+      Project(std::move(filtered),
+              {field_ref("supp_nation"), field_ref("cust_nation"), Year("L_SHIPDATE"),
+               Revenue()},
+              {"supp_nation", "cust_nation", "l_year", "volume"});
+  Declaration aggregated =
+      Aggregate(std::move(projected), {{"hash_sum", "volume", "revenue"}},
+                {"supp_nation", "cust_nation", "l_year"});
+  return OrderBy(std::move(aggregated),
+                 {SortKey("supp_nation"), SortKey("cust_nation"), SortKey("l_year")});
+}
+
+// National market share
+Declaration Q8(const TpchTables& t) {
+  Declaration region = Filter(t.Scan("region", {"R_REGIONKEY", "R_NAME"}),
+                              equal(field_ref("R_NAME"), Text("AMERICA", 25)));
+  Declaration customer_nation =
+      Project(Join(t.Scan("nation", {"N_NATIONKEY", "N_REGIONKEY"}), std::move(region),
+                   {"N_REGIONKEY"}, {"R_REGIONKEY"}),
+              {field_ref("N_NATIONKEY")}, {"n1_nationkey"});
+  Declaration customer =
+      Join(t.Scan("customer", {"C_CUSTKEY", "C_NATIONKEY"}), std::move(customer_nation),
+           {"C_NATIONKEY"}, {"n1_nationkey"});
+  Declaration orders = Join(
+      Filter(t.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE"}),
+             Between("O_ORDERDATE", Date("1995-01-01"), Date("1996-12-31"))),
+      std::move(customer), {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  Declaration part =
+      Filter(t.Scan("part", {"P_PARTKEY", "P_TYPE"}),
+             equal(field_ref("P_TYPE"), literal("ECONOMY ANODIZED STEEL")));
+  Declaration supplier_nation =
+      Project(t.Scan("nation", {"N_NATIONKEY", "N_NAME"}),
+              {field_ref("N_NATIONKEY"), field_ref("N_NAME")},
+              {"n2_nationkey", "n2_name"});
+  Declaration supplier =
+      Join(t.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}), std::move(supplier_nation),
+           {"S_NATIONKEY"}, {"n2_nationkey"});
+  Declaration lineitem = t.Scan("lineitem", {"L_ORDERKEY", "L_PARTKEY", "L_SUPPKEY",
+                                             "L_EXTENDEDPRICE", "L_DISCOUNT"});
+  Declaration joined = Join(
+      Join(Join(std::move(lineitem), std::move(part), {"L_PARTKEY"}, {"P_PARTKEY"}),
+           std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"}),
+      std::move(supplier), {"L_SUPPKEY"}, {"S_SUPPKEY"});
+  Expression volume = Float(Revenue());
+  Declaration projected = Project(
+      std::move(joined),
+      {Year("O_ORDERDATE"), volume,
+       call("if_else", {equal(field_ref("n2_name"), Text("BRAZIL", 25)), volume,
+                        literal(0.0)})},
+      {"o_year", "volume", "brazil_volume"});
+  Declaration aggregated = Aggregate(std::move(projected),
+                                     {{"hash_sum", "brazil_volume", "brazil_volume"},
+                                      {"hash_sum", "volume", "volume"}},
+                                     {"o_year"});
+  Declaration share = Project(
+      std::move(aggregated),
+      {field_ref("o_year"),
+       call("divide", {field_ref("brazil_volume"), field_ref("volume")})},
+      {"o_year", "mkt_share"});
+  return OrderBy(std::move(share), {SortKey("o_year")});
+}
+
+// Product type profit measure
+Declaration Q9(const TpchTables& t) {
+  Declaration part =
+      Filter(t.Scan("part", {"P_PARTKEY", "P_NAME"}), Like("P_NAME", "%green%"));
+  Declaration supplier =
+      Join(t.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}),
+           t.Scan("nation", {"N_NATIONKEY", "N_NAME"}), {"S_NATIONKEY"}, {"N_NATIONKEY"});
+  Declaration lineitem =
+      t.Scan("lineitem", {"L_ORDERKEY", "L_PARTKEY", "L_SUPPKEY", "L_QUANTITY",
+                          "L_EXTENDEDPRICE", "L_DISCOUNT"});
+  Declaration joined =
+      Join(Join(Join(Join(std::move(lineitem), std::move(part), {"L_PARTKEY"},
+                          {"P_PARTKEY"}),
+                     t.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY", "PS_SUPPLYCOST"}),
+                     {"L_PARTKEY", "L_SUPPKEY"}, {"PS_PARTKEY", "PS_SUPPKEY"}),
+                std::move(supplier), {"L_SUPPKEY"}, {"S_SUPPKEY"}),
+           t.Scan("orders", {"O_ORDERKEY", "O_ORDERDATE"}), {"L_ORDERKEY"},
+           {"O_ORDERKEY"});
+  Expression amount =
+      call("subtract", {Revenue(), call("multiply", {field_ref("PS_SUPPLYCOST"),
+                                                      field_ref("L_QUANTITY")})});
+  Declaration projected =
+      Project(std::move(joined), {field_ref("N_NAME"), Year("O_ORDERDATE"), amount},
+              {"nation", "o_year", "amount"});
+  Declaration aggregated = Aggregate(std::move(projected),
+                                     {{"hash_sum", "amount", "sum_profit"}},
+                                     {"nation", "o_year"});
+  return OrderBy(std::move(aggregated),
+                 {SortKey("nation"), SortKey("o_year", SortOrder::Descending)});
+}
+
+// Returned item reporting
+Declaration Q10(const TpchTables& t) {
+  Declaration orders =
+      Filter(t.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE"}),
+             InRange("O_ORDERDATE", Date("1993-10-01"), Date("1994-01-01")));
+  Declaration lineitem = Filter(
+      t.Scan("lineitem", {"L_ORDERKEY", "L_RETURNFLAG", "L_EXTENDEDPRICE", "L_DISCOUNT"}),
+      equal(field_ref("L_RETURNFLAG"), Text("R", 1)));
+  Declaration customer =
+      Join(t.Scan("customer", {"C_CUSTKEY", "C_NAME", "C_ACCTBAL", "C_PHONE",
+                               "C_NATIONKEY", "C_ADDRESS", "C_COMMENT"}),
+           t.Scan("nation", {"N_NATIONKEY", "N_NAME"}), {"C_NATIONKEY"}, {"N_NATIONKEY"});
+  Declaration joined =
+      Join(Join(std::move(lineitem), std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"}),
+           std::move(customer), {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  Declaration projected = Project(
+      std::move(joined),
+      {field_ref("C_CUSTKEY"), field_ref("C_NAME"), field_ref("C_ACCTBAL"),
+       field_ref("C_PHONE"), field_ref("N_NAME"), field_ref("C_ADDRESS"),
+       field_ref("C_COMMENT"), Revenue()},
+      {"c_custkey", "c_name", "c_acctbal", "c_phone", "n_name", "c_address",
+       "c_comment", "volume"});
+  Declaration aggregated = Aggregate(std::move(projected),
+                                     {{"hash_sum", "volume", "revenue"}},
+                                     {"c_custkey", "c_name", "c_acctbal", "c_phone",
+                                      "n_name", "c_address", "c_comment"});
+  return Fetch(
+      OrderBy(std::move(aggregated), {SortKey("revenue", SortOrder::Descending)}), 20);
+}
+
+// Important stock identification
+Declaration Q11(const TpchTables& t) {
+  auto german_stock = [&t] {
+    Declaration nation = Filter(t.Scan("nation", {"N_NATIONKEY", "N_NAME"}),
+                                equal(field_ref("N_NAME"), Text("GERMANY", 25)));
+    Declaration supplier = Join(t.Scan("supplier", {"S_SUPPKEY", "S_NATIONKEY"}),
+                                std::move(nation), {"S_NATIONKEY"}, {"N_NATIONKEY"});
+    Declaration partsupp =
+        Join(t.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY", "PS_SUPPLYCOST",
+                                 "PS_AVAILQTY"}),
+             std::move(supplier), {"PS_SUPPKEY"}, {"S_SUPPKEY"});
+    return Project(std::move(partsupp),
+                   {field_ref("PS_PARTKEY"),
+                    call("multiply", {Float(field_ref("PS_SUPPLYCOST")),
+                                      Float(field_ref("PS_AVAILQTY"))})},
+                   {"ps_partkey", "value"});
+  };
+  Declaration part_value = WithJoinKey(
+      Aggregate(german_stock(), {{"hash_sum", "value", "value"}}, {"ps_partkey"}),
+      {"ps_partkey", "value"});
+  Declaration threshold = WithJoinKey(
+      Project(Aggregate(german_stock(), {{"sum", "value", "total_value"}}),
+              {call("multiply",
+                    {field_ref("total_value"), literal(0.0001 / t.scale_factor())})},
+              {"threshold"}),
+      {"threshold"});
+  Declaration joined = Join(std::move(part_value), std::move(threshold), {"join_key"},
+                            {"join_key"}, JoinType::LEFT_SEMI,
+                            greater(field_ref("value"), field_ref("threshold")));
+  Declaration projected = Project(std::move(joined),
+                                  {field_ref("ps_partkey"), field_ref("value")},
+                                  {"ps_partkey", "value"});
+  return OrderBy(std::move(projected), {SortKey("value", SortOrder::Descending)});
+}
+
+// Shipping modes and order priority
+Declaration Q12(const TpchTables& t) {
+  Declaration lineitem = Filter(
+      t.Scan("lineitem", {"L_ORDERKEY", "L_SHIPMODE", "L_COMMITDATE", "L_RECEIPTDATE",
+                          "L_SHIPDATE"}),
+      and_({TextIn("L_SHIPMODE", {"MAIL", "SHIP"}, 10),
+            less(field_ref("L_COMMITDATE"), field_ref("L_RECEIPTDATE")),
+            less(field_ref("L_SHIPDATE"), field_ref("L_COMMITDATE")),
+            InRange("L_RECEIPTDATE", Date("1994-01-01"), Date("1995-01-01"))}));
+  Declaration joined =
+      Join(std::move(lineitem), t.Scan("orders", {"O_ORDERKEY", "O_ORDERPRIORITY"}),
+           {"L_ORDERKEY"}, {"O_ORDERKEY"});
+  Expression is_high = TextIn("O_ORDERPRIORITY", {"1-URGENT", "2-HIGH"}, 15);
+  Declaration projected =
+      Project(std::move(joined),
+              {field_ref("L_SHIPMODE"),
+               call("if_else", {is_high, literal(1), literal(0)}),
+               call("if_else", {is_high, literal(0), literal(1)})},
+              {"l_shipmode", "high_line", "low_line"});
+  Declaration aggregated = Aggregate(std::move(projected),
+                                     {{"hash_sum", "high_line", "high_line_count"},
+                                      {"hash_sum", "low_line", "low_line_count"}},
+                                     {"l_shipmode"});
+  return OrderBy(std::move(aggregated), {SortKey("l_shipmode")});
+}
 
-std::shared_ptr<ExecPlan> Plan_Q1(AsyncGenerator<std::optional<ExecBatch>>* sink_gen,
-                                  int scale_factor) {
-  std::shared_ptr<ExecPlan> plan = *ExecPlan::Make();
-  std::unique_ptr<TpchGen> gen =
-      *TpchGen::Make(plan.get(), static_cast<double>(scale_factor));
-
-  ExecNode* lineitem =
-      *gen->Lineitem({"L_QUANTITY", "L_EXTENDEDPRICE", "L_TAX", "L_DISCOUNT",
-                      "L_SHIPDATE", "L_RETURNFLAG", "L_LINESTATUS"});
-
-  auto sept_2_1998 = std::make_shared<Date32Scalar>(
-      10471);  // September 2, 1998 is 10471 days after January 1, 1970
-  Expression filter =
-      less_equal(field_ref("L_SHIPDATE"), literal(std::move(sept_2_1998)));
-  FilterNodeOptions filter_opts(filter);
-
-  Expression l_returnflag = field_ref("L_RETURNFLAG");
-  Expression l_linestatus = field_ref("L_LINESTATUS");
-  Expression quantity = field_ref("L_QUANTITY");
-  Expression base_price = field_ref("L_EXTENDEDPRICE");
-
-  std::shared_ptr<Decimal128Scalar> decimal_1 =
-      std::make_shared<Decimal128Scalar>(Decimal128{0, 100}, decimal(12, 2));
-  Expression discount_multiplier =
-      call("subtract", {literal(decimal_1), field_ref("L_DISCOUNT")});
-  Expression tax_multiplier = call("add", {literal(decimal_1), field_ref("L_TAX")});
-  Expression disc_price =
-      call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier});
-  Expression charge =
-      call("multiply",
-           {call("cast",
-                 {call("multiply", {field_ref("L_EXTENDEDPRICE"), discount_multiplier})},
-                 compute::CastOptions::Unsafe(decimal(12, 2))),
-            tax_multiplier});
-  Expression discount = field_ref("L_DISCOUNT");
-
-  std::vector<Expression> projection_list = {l_returnflag, l_linestatus, quantity,
-                                             base_price,   disc_price,   charge,
-                                             quantity,     base_price,   discount};
-  std::vector<std::string> project_names = {
-      "l_returnflag", "l_linestatus", "sum_qty",   "sum_base_price", "sum_disc_price",
-      "sum_charge",   "avg_qty",      "avg_price", "avg_disc"};
-  ProjectNodeOptions project_opts(std::move(projection_list), std::move(project_names));
-
-  auto sum_opts =
-      std::make_shared<ScalarAggregateOptions>(ScalarAggregateOptions::Defaults());
-  auto count_opts = std::make_shared<CountOptions>(CountOptions::CountMode::ALL);
-  std::vector<arrow::compute::Aggregate> aggs = {
-      {"hash_sum", sum_opts, "sum_qty", "sum_qty"},
-      {"hash_sum", sum_opts, "sum_base_price", "sum_base_price"},
-      {"hash_sum", sum_opts, "sum_disc_price", "sum_disc_price"},
-      {"hash_sum", sum_opts, "sum_charge", "sum_charge"},
-      {"hash_mean", sum_opts, "avg_qty", "avg_qty"},
-      {"hash_mean", sum_opts, "avg_price", "avg_price"},
-      {"hash_mean", sum_opts, "avg_disc", "avg_disc"},
-      {"hash_count", count_opts, "sum_qty", "count_order"}};
-
-  std::vector<FieldRef> keys = {"l_returnflag", "l_linestatus"};
-  AggregateNodeOptions agg_opts(aggs, keys);
-
-  SortKey l_returnflag_key("l_returnflag");
-  SortKey l_linestatus_key("l_linestatus");
-  SortOptions sort_opts({l_returnflag_key, l_linestatus_key});
-  OrderBySinkNodeOptions order_by_opts(sort_opts, sink_gen);
-
-  Declaration filter_decl("filter", {Declaration::Input(lineitem)}, filter_opts);
-  Declaration project_decl("project", project_opts);
-  Declaration aggregate_decl("aggregate", agg_opts);
-  Declaration orderby_decl("order_by_sink", order_by_opts);
-
-  Declaration q1 =
-      Declaration::Sequence({filter_decl, project_decl, aggregate_decl, orderby_decl});
-  std::ignore = *q1.AddToPlan(plan.get());
-  return plan;
-}
-
-static void BM_Tpch_Q1(benchmark::State& st) {
-  for (auto _ : st) {
-    st.PauseTiming();
-    AsyncGenerator<std::optional<ExecBatch>> sink_gen;
-    std::shared_ptr<ExecPlan> plan = Plan_Q1(&sink_gen, static_cast<int>(st.range(0)));
-    st.ResumeTiming();
-    auto fut = StartAndCollect(plan.get(), sink_gen);
-    auto res = *fut.MoveResult();
+// Customer distribution
+Declaration Q13(const TpchTables& t) {
+  Declaration orders = Filter(t.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_COMMENT"}),
+                              not_(Like("O_COMMENT", "%special%requests%")));
+  Declaration joined = Join(t.Scan("customer", {"C_CUSTKEY"}), std::move(orders),
+                            {"C_CUSTKEY"}, {"O_CUSTKEY"}, JoinType::LEFT_OUTER);
+  auto count_valid = std::make_shared<CountOptions>(CountOptions::ONLY_VALID);
+  Declaration order_counts = Aggregate(
+      std::move(joined), {{"hash_count", count_valid, "O_ORDERKEY", "c_count"}},
+      {"C_CUSTKEY"});
+  Declaration aggregated = Aggregate(std::move(order_counts),
+                                     {{"hash_count_all", "custdist"}}, {"c_count"});
+  return OrderBy(std::move(aggregated), {SortKey("custdist", SortOrder::Descending),
+                                         SortKey("c_count", SortOrder::Descending)});
+}
+
+// Promotion effect
+Declaration Q14(const TpchTables& t) {
+  Declaration lineitem = Filter(
+      t.Scan("lineitem", {"L_PARTKEY", "L_EXTENDEDPRICE", "L_DISCOUNT", "L_SHIPDATE"}),
+      InRange("L_SHIPDATE", Date("1995-09-01"), Date("1995-10-01")));
+  Declaration joined = Join(std::move(lineitem), t.Scan("part", {"P_PARTKEY", "P_TYPE"}),
+                            {"L_PARTKEY"}, {"P_PARTKEY"});
+  Expression volume = Float(Revenue());
+  Declaration projected = Project(
+      std::move(joined),
+      {call("if_else", {Like("P_TYPE", "PROMO%"), volume, literal(0.0)}), volume},
+      {"promo_volume", "volume"});
+  Declaration aggregated = Aggregate(
+      std::move(projected),
+      {{"sum", "promo_volume", "promo_volume"}, {"sum", "volume", "volume"}});
+  Expression promo_share =
+      call("divide", {field_ref("promo_volume"), field_ref("volume")});
+  return Project(std::move(aggregated),
+                 {call("multiply", {literal(100.0), std::move(promo_share)})},
+                 {"promo_revenue"});
+}
+
+// Top supplier
+Declaration Q15(const TpchTables& t) {
+  auto supplier_revenue = [&t] {
+    Declaration lineitem = Filter(
+        t.Scan("lineitem", {"L_SUPPKEY", "L_EXTENDEDPRICE", "L_DISCOUNT", "L_SHIPDATE"}),
+        InRange("L_SHIPDATE", Date("1996-01-01"), Date("1996-04-01")));
+    return Aggregate(Project(std::move(lineitem), {field_ref("L_SUPPKEY"), Revenue()},
+                             {"supplier_no", "volume"}),
+                     {{"hash_sum", "volume", "total_revenue"}}, {"supplier_no"});
+  };
+  Declaration max_revenue =
+      Aggregate(supplier_revenue(), {{"max", "total_revenue", "max_revenue"}});
+  Declaration top_suppliers =
+      Join(supplier_revenue(), std::move(max_revenue), {"total_revenue"},
+           {"max_revenue"}, JoinType::LEFT_SEMI);
+  Declaration joined =
+      Join(t.Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_ADDRESS", "S_PHONE"}),
+           std::move(top_suppliers), {"S_SUPPKEY"}, {"supplier_no"});
+  Declaration projected = Project(
+      std::move(joined),
+      {field_ref("S_SUPPKEY"), field_ref("S_NAME"), field_ref("S_ADDRESS"),
+       field_ref("S_PHONE"), field_ref("total_revenue")},
+      {"s_suppkey", "s_name", "s_address", "s_phone", "total_revenue"});
+  return OrderBy(std::move(projected), {SortKey("s_suppkey")});
+}
+
+// Parts/supplier relationship
+Declaration Q16(const TpchTables& t) {
+  Declaration part =
+      Filter(t.Scan("part", {"P_PARTKEY", "P_BRAND", "P_TYPE", "P_SIZE"}),
+             and_({not_equal(field_ref("P_BRAND"), Text("Brand#45", 10)),
+                   not_(Like("P_TYPE", "MEDIUM POLISHED%")),
+                   IntIn("P_SIZE", {49, 14, 23, 45, 19, 3, 36, 9})}));
+  Declaration complaints = Filter(t.Scan("supplier", {"S_SUPPKEY", "S_COMMENT"}),
+                                  Like("S_COMMENT", "%Customer%Complaints%"));
+  Declaration partsupp =
+      Join(t.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY"}), std::move(complaints),
+           {"PS_SUPPKEY"}, {"S_SUPPKEY"}, JoinType::LEFT_ANTI);
+  Declaration joined =
+      Join(std::move(partsupp), std::move(part), {"PS_PARTKEY"}, {"P_PARTKEY"});
+  Declaration aggregated = Aggregate(
+      std::move(joined), {{"hash_count_distinct", "PS_SUPPKEY", "supplier_cnt"}},
+      {"P_BRAND", "P_TYPE", "P_SIZE"});
+  return OrderBy(std::move(aggregated),
+                 {SortKey("supplier_cnt", SortOrder::Descending), SortKey("P_BRAND"),
+                  SortKey("P_TYPE"), SortKey("P_SIZE")});
+}
+
+// Small-quantity-order revenue
+Declaration Q17(const TpchTables& t) {
+  // The lineitems of the parts of interest
+  auto lineitem = [&t] {
+    Declaration part =
+        Filter(t.Scan("part", {"P_PARTKEY", "P_BRAND", "P_CONTAINER"}),
+               and_(equal(field_ref("P_BRAND"), Text("Brand#23", 10)),
+                    equal(field_ref("P_CONTAINER"), Text("MED BOX", 10))));
+    return Join(t.Scan("lineitem", {"L_PARTKEY", "L_QUANTITY", "L_EXTENDEDPRICE"}),
+                std::move(part), {"L_PARTKEY"}, {"P_PARTKEY"}, JoinType::LEFT_SEMI);
+  };
+  Declaration average_quantity = Aggregate(
+      Project(lineitem(), {field_ref("L_PARTKEY"), Float(field_ref("L_QUANTITY"))},
+              {"avg_partkey", "quantity"}),
+      {{"hash_mean", "quantity", "avg_quantity"}}, {"avg_partkey"});
+  Declaration small_quantity =
+      Project(std::move(average_quantity),
+              {field_ref("avg_partkey"),
+               call("multiply", {literal(0.2), field_ref("avg_quantity")})},
+              {"avg_partkey", "max_quantity"});
+  Declaration joined =
+      Join(lineitem(), std::move(small_quantity), {"L_PARTKEY"}, {"avg_partkey"},
+           JoinType::LEFT_SEMI,
+           less(Float(field_ref("L_QUANTITY")), field_ref("max_quantity")));
+  Declaration aggregated =
+      Aggregate(std::move(joined), {{"sum", "L_EXTENDEDPRICE", "total_price"}});
+  return Project(std::move(aggregated),
+                 {call("divide", {Float(field_ref("total_price")), literal(7.0)})},
+                 {"avg_yearly"});
+}
+
+// Large volume customer
+Declaration Q18(const TpchTables& t) {
+  Declaration large_orders = Project(
+      Filter(Aggregate(t.Scan("lineitem", {"L_ORDERKEY", "L_QUANTITY"}),
+                       {{"hash_sum", "L_QUANTITY", "sum_quantity"}}, {"L_ORDERKEY"}),
+             greater(field_ref("sum_quantity"), Money("300"))),
+      {field_ref("L_ORDERKEY")}, {"large_orderkey"});
+  Declaration orders =
+      Join(t.Scan("orders", {"O_ORDERKEY", "O_CUSTKEY", "O_ORDERDATE", "O_TOTALPRICE"}),
+           std::move(large_orders), {"O_ORDERKEY"}, {"large_orderkey"},
+           JoinType::LEFT_SEMI);
+  Declaration customer_orders =
+      Join(std::move(orders), t.Scan("customer", {"C_CUSTKEY", "C_NAME"}),
+           {"O_CUSTKEY"}, {"C_CUSTKEY"});
+  Declaration joined =
+      Join(t.Scan("lineitem", {"L_ORDERKEY", "L_QUANTITY"}), std::move(customer_orders),
+           {"L_ORDERKEY"}, {"O_ORDERKEY"});
+  Declaration aggregated = Aggregate(
+      std::move(joined), {{"hash_sum", "L_QUANTITY", "sum_quantity"}},
+      {"C_NAME", "C_CUSTKEY", "O_ORDERKEY", "O_ORDERDATE", "O_TOTALPRICE"});
+  return Fetch(OrderBy(std::move(aggregated),
+                       {SortKey("O_TOTALPRICE", SortOrder::Descending),
+                        SortKey("O_ORDERDATE")}),
+               100);
+}
+
+// Discounted revenue
+Declaration Q19(const TpchTables& t) {
+  Declaration lineitem =
+      Filter(t.Scan("lineitem", {"L_PARTKEY", "L_QUANTITY", "L_EXTENDEDPRICE",
+                                 "L_DISCOUNT", "L_SHIPMODE", "L_SHIPINSTRUCT"}),
+             and_({TextIn("L_SHIPMODE", {"AIR", "AIR REG"}, 10),
+                   equal(field_ref("L_SHIPINSTRUCT"), Text("DELIVER IN PERSON", 25)),
+                   Between("L_QUANTITY", Money("1"), Money("30"))}));
+  Declaration part =
+      Filter(t.Scan("part", {"P_PARTKEY", "P_BRAND", "P_CONTAINER", "P_SIZE"}),
+             and_({TextIn("P_BRAND", {"Brand#12", "Brand#23", "Brand#34"}, 10),
+                   Between("P_SIZE", literal(1), literal(15))}));
+  Declaration joined =
+      Join(std::move(lineitem), std::move(part), {"L_PARTKEY"}, {"P_PARTKEY"});
+  auto matches = [](std::string brand, std::vector<std::string> containers,
+                    std::string_view min_quantity, std::string_view max_quantity,
+                    int32_t max_size) {
+    return and_({equal(field_ref("P_BRAND"), Text(std::move(brand), 10)),
+                 TextIn("P_CONTAINER", std::move(containers), 10),
+                 Between("L_QUANTITY", Money(min_quantity), Money(max_quantity)),
+                 less_equal(field_ref("P_SIZE"), literal(max_size))});
+  };
+  Declaration filtered = Filter(
+      std::move(joined),
+      or_({matches("Brand#12", {"SM CASE", "SM BOX", "SM PACK", "SM PKG"}, "1", "11", 5),
+           matches("Brand#23", {"MED BAG", "MED BOX", "MED PKG", "MED PACK"}, "10", "20",
+                   10),
+           matches("Brand#34", {"LG CASE", "LG BOX", "LG PACK", "LG PKG"}, "20", "30",
+                   15)}));
+  return Aggregate(Project(std::move(filtered), {Revenue()}, {"volume"}),
+                   {{"sum", "volume", "revenue"}});
+}
+
+// Potential part promotion
+Declaration Q20(const TpchTables& t) {
+  Declaration forest_part =
+      Filter(t.Scan("part", {"P_PARTKEY", "P_NAME"}), Like("P_NAME", "forest%"));
+  Declaration shipped = Aggregate(
+      Filter(t.Scan("lineitem", {"L_PARTKEY", "L_SUPPKEY", "L_QUANTITY", "L_SHIPDATE"}),
+             InRange("L_SHIPDATE", Date("1994-01-01"), Date("1995-01-01"))),
+      {{"hash_sum", "L_QUANTITY", "sum_quantity"}}, {"L_PARTKEY", "L_SUPPKEY"});
+  Declaration partsupp =
+      Join(t.Scan("partsupp", {"PS_PARTKEY", "PS_SUPPKEY", "PS_AVAILQTY"}),
+           std::move(forest_part), {"PS_PARTKEY"}, {"P_PARTKEY"}, JoinType::LEFT_SEMI);
+  Declaration excess = Join(
+      std::move(partsupp), std::move(shipped), {"PS_PARTKEY", "PS_SUPPKEY"},
+      {"L_PARTKEY", "L_SUPPKEY"}, JoinType::LEFT_SEMI,
+      greater(Float(field_ref("PS_AVAILQTY")),
+              call("multiply", {literal(0.5), Float(field_ref("sum_quantity"))})));
+  Declaration nation = Filter(t.Scan("nation", {"N_NATIONKEY", "N_NAME"}),
+                              equal(field_ref("N_NAME"), Text("CANADA", 25)));
+  Declaration supplier =
+      Join(t.Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_ADDRESS", "S_NATIONKEY"}),
+           std::move(nation), {"S_NATIONKEY"}, {"N_NATIONKEY"});
+  Declaration joined = Join(std::move(supplier), std::move(excess), {"S_SUPPKEY"},
+                            {"PS_SUPPKEY"}, JoinType::LEFT_SEMI);
+  return OrderBy(Project(std::move(joined), {field_ref("S_NAME"), field_ref("S_ADDRESS")},
+                         {"s_name", "s_address"}),
+                 {SortKey("s_name")});
+}
+
+// Suppliers who kept orders waiting
+Declaration Q21(const TpchTables& t) {
+  auto late_lineitem = [&t] {
+    return Filter(t.Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY", "L_COMMITDATE",
+                                      "L_RECEIPTDATE"}),
+                  greater(field_ref("L_RECEIPTDATE"), field_ref("L_COMMITDATE")));
+  };
+  Declaration nation = Filter(t.Scan("nation", {"N_NATIONKEY", "N_NAME"}),
+                              equal(field_ref("N_NAME"), Text("SAUDI ARABIA", 25)));
+  Declaration supplier =
+      Join(t.Scan("supplier", {"S_SUPPKEY", "S_NAME", "S_NATIONKEY"}), std::move(nation),
+           {"S_NATIONKEY"}, {"N_NATIONKEY"});
+  Declaration orders = Filter(t.Scan("orders", {"O_ORDERKEY", "O_ORDERSTATUS"}),
+                              equal(field_ref("O_ORDERSTATUS"), Text("F", 1)));
+  Declaration joined = Join(
+      Join(late_lineitem(), std::move(supplier), {"L_SUPPKEY"}, {"S_SUPPKEY"}),
+      std::move(orders), {"L_ORDERKEY"}, {"O_ORDERKEY"});
+  // Another supplier delivered part of the order
+  Declaration other_lineitem =
+      Project(t.Scan("lineitem", {"L_ORDERKEY", "L_SUPPKEY"}),
+              {field_ref("L_ORDERKEY"), field_ref("L_SUPPKEY")},
+              {"l2_orderkey", "l2_suppkey"});
+  Declaration multi_supplier =
+      Join(std::move(joined), std::move(other_lineitem), {"L_ORDERKEY"}, {"l2_orderkey"},
+           JoinType::LEFT_SEMI,
+           not_equal(field_ref("L_SUPPKEY"), field_ref("l2_suppkey")));
+  // but no other supplier was late
+  Declaration other_late_lineitem =
+      Project(late_lineitem(), {field_ref("L_ORDERKEY"), field_ref("L_SUPPKEY")},
+              {"l3_orderkey", "l3_suppkey"});
+  Declaration only_late = Join(
+      std::move(multi_supplier), std::move(other_late_lineitem), {"L_ORDERKEY"},
+      {"l3_orderkey"}, JoinType::LEFT_ANTI,
+      not_equal(field_ref("L_SUPPKEY"), field_ref("l3_suppkey")));
+  Declaration aggregated =
+      Aggregate(std::move(only_late), {{"hash_count_all", "numwait"}}, {"S_NAME"});
+  return Fetch(OrderBy(std::move(aggregated),
+                       {SortKey("numwait", SortOrder::Descending), SortKey("S_NAME")}),
+               100);
+}
+
+// Global sales opportunity
+Declaration Q22(const TpchTables& t) {
+  auto customer = [&t] {
+    Expression country_code = call(
+        "utf8_slice_codeunits",
+        {call("cast", {field_ref("C_PHONE")}, compute::CastOptions::Safe(utf8()))},
+        compute::SliceOptions(0, 2));
+    StringBuilder builder;
+    ARROW_CHECK_OK(builder.AppendValues({"13", "31", "23", "29", "30", "18", "17"}));
+    return Filter(
+        Project(t.Scan("customer", {"C_CUSTKEY", "C_PHONE", "C_ACCTBAL"}),
+                {field_ref("C_CUSTKEY"), country_code, Float(field_ref("C_ACCTBAL"))},
+                {"c_custkey", "cntrycode", "c_acctbal"}),
+        call("is_in", {field_ref("cntrycode")},
+             compute::SetLookupOptions(builder.Finish().ValueOrDie())));
+  };
+  Declaration average_balance = WithJoinKey(
+      Aggregate(
+          Filter(customer(), greater(field_ref("c_acctbal"), literal(0.0))),
+          {{"mean", "c_acctbal", "avg_acctbal"}}),
+      {"avg_acctbal"});
+  Declaration above_average =
+      Join(WithJoinKey(customer(), {"c_custkey", "cntrycode", "c_acctbal"}),
+           std::move(average_balance), {"join_key"}, {"join_key"}, JoinType::LEFT_SEMI,
+           greater(field_ref("c_acctbal"), field_ref("avg_acctbal")));
+  Declaration without_orders =
+      Join(std::move(above_average), t.Scan("orders", {"O_CUSTKEY"}), {"c_custkey"},
+           {"O_CUSTKEY"}, JoinType::LEFT_ANTI);
+  Declaration aggregated = Aggregate(
+      std::move(without_orders),
+      {{"hash_count_all", "numcust"}, {"hash_sum", "c_acctbal", "totacctbal"}},
+      {"cntrycode"});
+  return OrderBy(std::move(aggregated), {SortKey("cntrycode")});
+}
+
+using QueryFactory = Declaration (*)(const TpchTables&);
+
+constexpr QueryFactory kQueries[] = {Q1,  Q2,  Q3,  Q4,  Q5,  Q6,  Q7,  Q8,
+                                     Q9,  Q10, Q11, Q12, Q13, Q14, Q15, Q16,
+                                     Q17, Q18, Q19, Q20, Q21, Q22};
+
+double ScaleFactor() {
+  auto value = ::arrow::internal::GetEnvVar("ARROW_TPCH_SCALE_FACTOR");
+  return value.ok() ? std::stod(*value) : 1.0;
+}
+
+std::vector<int64_t> ThreadCounts() {
+  std::vector<int64_t> thread_counts;
+  auto value = ::arrow::internal::GetEnvVar("ARROW_TPCH_THREADS");
+  if (value.ok()) {
+    for (std::string_view count : ::arrow::internal::SplitString(*value, ',')) {
+      thread_counts.push_back(std::stoll(std::string(count)));
+    }
+  } else {
+    thread_counts = {1, std::max<int64_t>(1, std::thread::hardware_concurrency())};
+  }
+  std::sort(thread_counts.begin(), thread_counts.end());
+  thread_counts.erase(std::unique(thread_counts.begin(), thread_counts.end()),
+                      thread_counts.end());
+  return thread_counts;
+}
+
+// The generated tables are shared by all benchmarks
+Result<const TpchTables*> GetTables() {
+  static std::mutex mutex;
+  static std::unique_ptr<TpchTables> tables;
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!tables) {
+    ARROW_ASSIGN_OR_RAISE(tables, TpchTables::Generate(ScaleFactor()));
   }
+  return tables.get();
+}
+
+struct QueryRun {
+  ExecPlanStats stats;
+  int64_t num_rows;
+};
+
+Result<QueryRun> RunQuery(const TpchTables& tables, int query, MemoryPool* pool,
+                          ::arrow::internal::Executor* executor) {
+  ExecContext exec_context(pool, executor);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<ExecPlan> plan,
+                        ExecPlan::Make(QueryOptions{}, exec_context));
+  std::shared_ptr<Table> output;
+  Declaration declaration = Declaration::Sequence(
+      {kQueries[query - 1](tables), {"table_sink", TableSinkNodeOptions(&output)}});
+  RETURN_NOT_OK(declaration.AddToPlan(plan.get()));
+  RETURN_NOT_OK(plan->Validate());
+  plan->StartProducing();
+  RETURN_NOT_OK(plan->finished().status());
+  return QueryRun{plan->GetStats(), output->num_rows()};
 }
 
-BENCHMARK(BM_Tpch_Q1)->Args({1})->ArgNames({"ScaleFactor"});
+void BM_Tpch(benchmark::State& state) {
+  const int query = static_cast<int>(state.range(0));
+  auto tables = GetTables();
+  if (!tables.ok()) {
+    state.SkipWithError(tables.status().ToString().c_str());
+    return;
+  }
+  // Tasks may still release memory after a plan finished, so the pool must outlive the
+  // threads running them
+  ProxyMemoryPool pool(default_memory_pool());
+  auto thread_pool =
+      ::arrow::internal::ThreadPool::Make(static_cast<int>(state.range(1)));
+  if (!thread_pool.ok()) {
+    state.SkipWithError(thread_pool.status().ToString().c_str());
+    return;
+  }
+
+  int64_t num_rows = 0;
+  int64_t rows_scanned = 0;
+  std::map<std::string, int64_t> processing_time_nanos;
+  for (auto _ : state) {
+    auto run = RunQuery(**tables, query, &pool, thread_pool->get());
+    if (!run.ok()) {
+      state.SkipWithError(run.status().ToString().c_str());
+      return;
+    }
+    num_rows = run->num_rows;
+    for (const ExecNodeStats& node : run->stats.nodes) {
+      processing_time_nanos[node.kind_name] += node.processing_time_nanos;
+      if (node.kind_name == "TableSourceNode") rows_scanned += node.output_rows;
+    }
+  }
+
+  state.SetItemsProcessed(rows_scanned);
+  // The pool only serves the runs of this query
+  state.counters["peak_memory_bytes"] = static_cast<double>(pool.max_memory());
+  state.counters["output_rows"] = static_cast<double>(num_rows);
+  for (const auto& [kind_name, nanos] : processing_time_nanos) {
+    state.counters[kind_name + "_seconds"] =
+        benchmark::Counter(static_cast<double>(nanos) * 1e-9,
+                           benchmark::Counter::kAvgIterations);
+  }
+}
+
+void TpchArguments(benchmark::internal::Benchmark* bench) {
+  bench->ArgNames({"Query", "Threads"});
+  for (int64_t num_threads : ThreadCounts()) {
+    for (int64_t query = 1; query <= static_cast<int64_t>(std::size(kQueries)); ++query) {
+      bench->Args({query, num_threads});
+    }
+  }
+}
+
+// Recorded in the "context" of the JSON report
+const bool kScaleFactorInContext = [] {
+  benchmark::AddCustomContext("tpch_scale_factor", std::to_string(ScaleFactor()));
+  return true;
+}();
+
+}  // namespace
+
+BENCHMARK(BM_Tpch)
+    ->Apply(TpchArguments)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
 }  // namespace internal
 }  // namespace acero
 }  // namespace arrow
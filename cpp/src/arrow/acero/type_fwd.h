@@ -24,10 +24,14 @@ namespace arrow {
 namespace acero {
 
 class ExecNode;
+class ExecNodeMetrics;
 class ExecPlan;
 class ExecNodeOptions;
 class ExecFactoryRegistry;
+class ExpressionCompiler;
+class MemoryBudget;
 class QueryContext;
+class RuntimeFilter;
 struct QueryOptions;
 struct Declaration;
 class SinkNodeConsumer;
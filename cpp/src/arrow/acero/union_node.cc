@@ -15,10 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <limits>
 #include <mutex>
+#include <optional>
+#include <vector>
 
+#include "arrow/acero/accumulation_queue.h"
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/api.h"
 #include "arrow/util/bitmap_ops.h"
@@ -48,10 +54,14 @@ std::vector<std::string> GetInputLabels(const ExecNode::NodeVector& inputs) {
 
 class UnionNode : public ExecNode, public TracedNode {
  public:
-  UnionNode(ExecPlan* plan, std::vector<ExecNode*> inputs)
+  UnionNode(ExecPlan* plan, std::vector<ExecNode*> inputs, UnionNodeOptions::Mode mode,
+            int max_batches_ahead)
       : ExecNode(plan, inputs, GetInputLabels(inputs),
                  /*output_schema=*/inputs[0]->output_schema()),
-        TracedNode(this) {
+        TracedNode(this),
+        mode_(mode),
+        max_batches_ahead_(max_batches_ahead),
+        input_states_(inputs.size()) {
     bool counter_completed = input_count_.SetTotal(static_cast<int>(inputs.size()));
     ARROW_DCHECK(counter_completed == false);
   }
@@ -73,13 +83,63 @@ class UnionNode : public ExecNode, public TracedNode {
             schema->ToString(), " got schema: ", input->output_schema()->ToString());
       }
     }
-    return plan->EmplaceNode<UnionNode>(plan, std::move(inputs));
+    // The base options are accepted for backwards compatibility
+    UnionNodeOptions union_options;
+    if (const auto* given = dynamic_cast<const UnionNodeOptions*>(&options)) {
+      union_options = *given;
+    }
+    if (union_options.mode != UnionNodeOptions::UNORDERED &&
+        union_options.max_batches_ahead <= 0) {
+      return Status::Invalid("`max_batches_ahead` must be positive");
+    }
+    if (union_options.mode == UnionNodeOptions::ORDERED) {
+      for (auto input : inputs) {
+        if (input->ordering().is_unordered()) {
+          return Status::Invalid(
+              "An ordered UnionNode requires ordered inputs, got unordered input ",
+              input->label());
+        }
+      }
+    }
+    return plan->EmplaceNode<UnionNode>(plan, std::move(inputs), union_options.mode,
+                                        union_options.max_batches_ahead);
+  }
+
+  const Ordering& ordering() const override {
+    if (mode_ == UnionNodeOptions::ORDERED) {
+      return kImplicitOrdering;
+    }
+    return ExecNode::ordering();
+  }
+
+  Status Init() override {
+    if (mode_ == UnionNodeOptions::ORDERED) {
+      for (size_t i = 0; i < inputs_.size(); ++i) {
+        InputState& state = input_states_[i];
+        state.processor.node = this;
+        state.processor.input_index = i;
+        state.sequencing_queue = util::SequencingQueue::Make(&state.processor);
+      }
+    }
+    return Status::OK();
   }
 
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
-    NoteInputReceived(batch);
-    ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
+    NoteInputReceived(input, batch);
+    const size_t input_index = GetInputIndex(input);
 
+    if (mode_ == UnionNodeOptions::ORDERED) {
+      return input_states_[input_index].sequencing_queue->InsertBatch(std::move(batch));
+    }
+    if (mode_ == UnionNodeOptions::FAIR) {
+      std::vector<BackpressureRequest> requests;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++input_states_[input_index].num_batches;
+        BalanceInputs(&requests);
+      }
+      SendBackpressure(requests);
+    }
     if (inputs_.size() > 1) {
       batch.index = compute::kUnsequencedIndex;
     }
@@ -87,10 +147,25 @@ class UnionNode : public ExecNode, public TracedNode {
   }
 
   Status InputFinished(ExecNode* input, int total_batches) override {
-    ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
+    const size_t input_index = GetInputIndex(input);
 
     total_batches_.fetch_add(total_batches);
 
+    std::vector<ExecBatch> to_send;
+    std::vector<BackpressureRequest> requests;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      InputState& state = input_states_[input_index];
+      state.total_batches = total_batches;
+      if (mode_ == UnionNodeOptions::FAIR) {
+        BalanceInputs(&requests);
+      } else if (mode_ == UnionNodeOptions::ORDERED) {
+        AdvanceOrderedInput(&to_send, &requests);
+      }
+    }
+    SendBackpressure(requests);
+    RETURN_NOT_OK(SendBatches(std::move(to_send)));
+
     if (input_count_.Increment()) {
       return output_->InputFinished(this, total_batches_.load());
     }
@@ -103,29 +178,226 @@ class UnionNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
+  // Inputs paused by this node stay paused when the output resumes
   void PauseProducing(ExecNode* output, int32_t counter) override {
-    for (auto* input : inputs_) {
-      input->PauseProducing(this, counter);
+    std::vector<BackpressureRequest> requests;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (counter <= output_backpressure_counter_) {
+        return;
+      }
+      output_backpressure_counter_ = counter;
+      if (output_paused_) {
+        return;
+      }
+      output_paused_ = true;
+      for (size_t i = 0; i < inputs_.size(); ++i) {
+        InputState& state = input_states_[i];
+        if (!state.held) {
+          requests.push_back({inputs_[i], true, ++state.backpressure_counter});
+        }
+      }
     }
+    SendBackpressure(requests);
   }
 
   void ResumeProducing(ExecNode* output, int32_t counter) override {
-    for (auto* input : inputs_) {
-      input->ResumeProducing(this, counter);
+    std::vector<BackpressureRequest> requests;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (counter <= output_backpressure_counter_) {
+        return;
+      }
+      output_backpressure_counter_ = counter;
+      if (!output_paused_) {
+        return;
+      }
+      output_paused_ = false;
+      for (size_t i = 0; i < inputs_.size(); ++i) {
+        InputState& state = input_states_[i];
+        if (!state.held) {
+          requests.push_back({inputs_[i], false, ++state.backpressure_counter});
+        }
+      }
     }
+    SendBackpressure(requests);
   }
 
   Status StopProducingImpl() override { return Status::OK(); }
 
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    switch (mode_) {
+      case UnionNodeOptions::UNORDERED:
+        return "mode=unordered";
+      case UnionNodeOptions::FAIR:
+        return "mode=fair max_batches_ahead=" + ToChars(max_batches_ahead_);
+      case UnionNodeOptions::ORDERED:
+        return "mode=ordered max_batches_ahead=" + ToChars(max_batches_ahead_);
+    }
+    return "";
+  }
+
  private:
+  // Sequences the batches of one input in the ORDERED mode
+  struct InputProcessor : public util::SequencingQueue::Processor {
+    Result<std::optional<util::SequencingQueue::Task>> Process(ExecBatch batch) override {
+      return node->ProcessOrdered(input_index, std::move(batch));
+    }
+
+    void Schedule(util::SequencingQueue::Task task) override {
+      node->plan()->query_context()->ScheduleTask(std::move(task), "UnionNode::Send");
+    }
+
+    UnionNode* node = NULLPTR;
+    size_t input_index = 0;
+  };
+
+  struct InputState {
+    // Whether this node paused the input
+    bool held = false;
+    int32_t backpressure_counter = 0;
+    // The number of batches received, in order in the ORDERED mode
+    int num_batches = 0;
+    // Set once the input finished
+    int total_batches = -1;
+    // The batches received before the input's turn in the ORDERED mode
+    std::vector<ExecBatch> pending;
+    InputProcessor processor;
+    std::unique_ptr<util::SequencingQueue> sequencing_queue;
+  };
+
+  struct BackpressureRequest {
+    ExecNode* input;
+    bool pause;
+    int32_t counter;
+  };
+
+  size_t GetInputIndex(ExecNode* input) const {
+    auto it = std::find(inputs_.begin(), inputs_.end(), input);
+    ARROW_DCHECK(it != inputs_.end());
+    return static_cast<size_t>(it - inputs_.begin());
+  }
+
+  bool finished(const InputState& state) const {
+    return state.total_batches >= 0 && state.num_batches == state.total_batches;
+  }
+
+  // Pause or resume an input on behalf of this node.  Requires the lock, the requests
+  // are sent once it is released as a resumed input may produce synchronously.
+  void Hold(size_t input_index, bool held, std::vector<BackpressureRequest>* requests) {
+    InputState& state = input_states_[input_index];
+    if (state.held == held) {
+      return;
+    }
+    state.held = held;
+    if (!output_paused_) {
+      requests->push_back({inputs_[input_index], held, ++state.backpressure_counter});
+    }
+  }
+
+  void SendBackpressure(const std::vector<BackpressureRequest>& requests) {
+    for (const BackpressureRequest& request : requests) {
+      if (request.pause) {
+        request.input->PauseProducing(this, request.counter);
+      } else {
+        request.input->ResumeProducing(this, request.counter);
+      }
+    }
+  }
+
+  // FAIR mode: hold the inputs too far ahead of the slowest unfinished one
+  void BalanceInputs(std::vector<BackpressureRequest>* requests) {
+    int min_batches = std::numeric_limits<int>::max();
+    for (const InputState& state : input_states_) {
+      if (state.total_batches < 0) {
+        min_batches = std::min(min_batches, state.num_batches);
+      }
+    }
+    for (size_t i = 0; i < input_states_.size(); ++i) {
+      const InputState& state = input_states_[i];
+      Hold(i,
+           state.total_batches < 0 &&
+               state.num_batches - min_batches > max_batches_ahead_,
+           requests);
+    }
+  }
+
+  Result<std::optional<util::SequencingQueue::Task>> ProcessOrdered(size_t input_index,
+                                                                    ExecBatch batch) {
+    std::vector<ExecBatch> to_send;
+    std::vector<BackpressureRequest> requests;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      InputState& state = input_states_[input_index];
+      ++state.num_batches;
+      if (input_index == current_input_) {
+        batch.index = num_output_batches_++;
+        to_send.push_back(std::move(batch));
+        AdvanceOrderedInput(&to_send, &requests);
+      } else {
+        state.pending.push_back(std::move(batch));
+        if (static_cast<int>(state.pending.size()) >= max_batches_ahead_) {
+          Hold(input_index, true, &requests);
+        }
+      }
+    }
+    SendBackpressure(requests);
+    if (to_send.empty()) {
+      return std::nullopt;
+    }
+    return [this, to_send = std::move(to_send)]() mutable {
+      return SendBatches(std::move(to_send));
+    };
+  }
+
+  // ORDERED mode: move on to the next inputs once the current one finished, releasing
+  // their pending batches
+  void AdvanceOrderedInput(std::vector<ExecBatch>* to_send,
+                           std::vector<BackpressureRequest>* requests) {
+    while (current_input_ < input_states_.size() &&
+           finished(input_states_[current_input_])) {
+      if (++current_input_ == input_states_.size()) {
+        break;
+      }
+      InputState& next = input_states_[current_input_];
+      for (ExecBatch& batch : next.pending) {
+        batch.index = num_output_batches_++;
+        to_send->push_back(std::move(batch));
+      }
+      next.pending.clear();
+      Hold(current_input_, false, requests);
+    }
+  }
+
+  Status SendBatches(std::vector<ExecBatch> batches) {
+    for (ExecBatch& batch : batches) {
+      RETURN_NOT_OK(output_->InputReceived(this, std::move(batch)));
+    }
+    return Status::OK();
+  }
+
+  static inline const Ordering kImplicitOrdering = Ordering::Implicit();
+
+  const UnionNodeOptions::Mode mode_;
+  const int max_batches_ahead_;
   AtomicCounter input_count_;
   std::atomic<int> total_batches_{0};
+
+  // Guards the following members and input_states_, except for the sequencing queues
+  std::mutex mutex_;
+  std::vector<InputState> input_states_;
+  bool output_paused_ = false;
+  int32_t output_backpressure_counter_ = 0;
+  // The input whose batches are being output in the ORDERED mode
+  size_t current_input_ = 0;
+  int num_output_batches_ = 0;
 };
 
 namespace internal {
 
 void RegisterUnionNode(ExecFactoryRegistry* registry) {
-  DCHECK_OK(registry->AddFactory("union", UnionNode::Make));
+  DCHECK_OK(registry->AddFactory(std::string(UnionNodeOptions::kName), UnionNode::Make));
 }
 
 }  // namespace internal
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <gmock/gmock-matchers.h>
+#include <optional>
 #include <random>
 
 #include "arrow/acero/options.h"
@@ -79,12 +80,16 @@ struct TestUnionNode : public ::testing::Test {
   }
 
   void CheckRunOutput(const std::vector<BatchesWithSchema>& batches,
-                      const BatchesWithSchema& exp_batches, bool parallel = false) {
+                      const BatchesWithSchema& exp_batches, bool parallel = false,
+                      std::optional<UnionNodeOptions> options = std::nullopt) {
     SCOPED_TRACE(parallel ? "parallel" : "single threaded");
 
     ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
 
     Declaration union_decl{"union", ExecNodeOptions{}};
+    if (options) {
+      union_decl.options = std::make_shared<UnionNodeOptions>(*options);
+    }
 
     for (const auto& batch : batches) {
       union_decl.inputs.emplace_back(Declaration{
@@ -118,7 +123,8 @@ struct TestUnionNode : public ::testing::Test {
     }
   }
 
-  void CheckUnionExecNode(size_t num_input_nodes, size_t num_batches, bool parallel) {
+  void CheckUnionExecNode(size_t num_input_nodes, size_t num_batches, bool parallel,
+                          std::optional<UnionNodeOptions> options = std::nullopt) {
     auto random_schema = GenerateRandomSchema(num_input_nodes);
 
     int multiplicity = parallel ? 10 : 1;
@@ -133,7 +139,7 @@ struct TestUnionNode : public ::testing::Test {
         exp_batches.batches.push_back(batch);
       }
     }
-    CheckRunOutput(input_batches, exp_batches, parallel);
+    CheckRunOutput(input_batches, exp_batches, parallel, options);
   }
 
   ::arrow::random::RandomArrayGenerator rng_;
@@ -154,5 +160,82 @@ TEST_F(TestUnionNode, TestEmpty) {
   this->CheckUnionExecNode(/*num_input_nodes*/ 0, /*num_batches=*/0, /*parallel=*/false);
 }
 
+TEST_F(TestUnionNode, TestFair) {
+  for (bool parallel : {false, true}) {
+    for (int max_batches_ahead : {1, 4}) {
+      for (int64_t num_input_nodes : {1, 2, 4}) {
+        this->CheckUnionExecNode(
+            num_input_nodes, kNumBatches, parallel,
+            UnionNodeOptions(UnionNodeOptions::FAIR, max_batches_ahead));
+      }
+    }
+  }
+}
+
+// A table of `num_rows` rows whose "id" column starts at `first_id`
+std::shared_ptr<Table> MakeIdTable(int32_t first_id, int32_t num_rows) {
+  Int32Builder builder;
+  for (int32_t i = 0; i < num_rows; ++i) {
+    ARROW_EXPECT_OK(builder.Append(first_id + i));
+  }
+  return Table::Make(schema({field("id", int32())}), {builder.Finish().ValueOrDie()});
+}
+
+Declaration OrderedUnion(const std::vector<int32_t>& input_rows, int max_batches_ahead) {
+  Declaration union_decl{"union",
+                         UnionNodeOptions(UnionNodeOptions::ORDERED, max_batches_ahead)};
+  int32_t first_id = 0;
+  for (int32_t num_rows : input_rows) {
+    union_decl.inputs.emplace_back(Declaration{
+        "table_source",
+        TableSourceNodeOptions(MakeIdTable(first_id, num_rows), /*max_batch_size=*/7)});
+    first_id += num_rows;
+  }
+  return union_decl;
+}
+
+TEST(UnionNode, Ordered) {
+  const std::vector<int32_t> input_rows = {100, 0, 35, 1, 200};
+  const int32_t total_rows = 336;
+  for (bool use_threads : {false, true}) {
+    for (int max_batches_ahead : {1, 3, 100}) {
+      ARROW_SCOPED_TRACE("use_threads = ", use_threads,
+                         ", max_batches_ahead = ", max_batches_ahead);
+      ASSERT_OK_AND_ASSIGN(
+          auto actual,
+          DeclarationToTable(OrderedUnion(input_rows, max_batches_ahead), use_threads));
+      AssertTablesEqual(*MakeIdTable(0, total_rows), *actual,
+                        /*same_chunk_layout=*/false);
+
+      // Order sensitive nodes can follow
+      Declaration fetch = Declaration::Sequence(
+          {OrderedUnion(input_rows, max_batches_ahead),
+           {"fetch", FetchNodeOptions(/*offset=*/90, /*count=*/50)}});
+      ASSERT_OK_AND_ASSIGN(actual, DeclarationToTable(std::move(fetch), use_threads));
+      AssertTablesEqual(*MakeIdTable(90, 50), *actual, /*same_chunk_layout=*/false);
+    }
+  }
+}
+
+TEST(UnionNode, InvalidOptions) {
+  auto table = MakeIdTable(0, 10);
+  std::shared_ptr<Schema> schema = table->schema();
+  AsyncGenerator<std::optional<ExecBatch>> gen = [] {
+    return Future<std::optional<ExecBatch>>::MakeFinished(std::nullopt);
+  };
+
+  // The inputs of an ordered union must be ordered
+  Declaration unordered{"union", {Declaration{"source", SourceNodeOptions(schema, gen)}},
+                        UnionNodeOptions(UnionNodeOptions::ORDERED)};
+  ASSERT_RAISES(Invalid, DeclarationToTable(std::move(unordered)));
+
+  for (auto mode : {UnionNodeOptions::FAIR, UnionNodeOptions::ORDERED}) {
+    Declaration invalid{"union",
+                        {Declaration{"table_source", TableSourceNodeOptions(table)}},
+                        UnionNodeOptions(mode, /*max_batches_ahead=*/0)};
+    ASSERT_RAISES(Invalid, DeclarationToTable(std::move(invalid)));
+  }
+}
+
 }  // namespace acero
 }  // namespace arrow
@@ -17,6 +17,8 @@
 
 #include "arrow/acero/util.h"
 
+#include <chrono>
+
 #include "arrow/acero/exec_plan.h"
 #include "arrow/table.h"
 #include "arrow/util/bit_util.h"
@@ -111,16 +113,55 @@ void TracedNode::NoteStartProducing(std::string extra_details) const {
                                                          {"node.label", node_->label()}});
 }
 
-[[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceInputReceived(
-    const ExecBatch& batch) const {
+namespace {
+
+int64_t SteadyClockNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+// The innermost InputReceivedScope of the current thread
+thread_local InputReceivedScope* current_input_received_scope = nullptr;
+
+}  // namespace
+
+InputReceivedScope::InputReceivedScope(
+    ExecNodeMetrics* metrics, std::unique_ptr<::arrow::internal::tracing::Scope> scope)
+    : scope_(std::move(scope)),
+      metrics_(metrics),
+      parent_(current_input_received_scope),
+      start_nanos_(SteadyClockNanos()) {
+  current_input_received_scope = this;
+}
+
+InputReceivedScope::~InputReceivedScope() {
+  int64_t elapsed = SteadyClockNanos() - start_nanos_;
+  metrics_->AddProcessingTime(elapsed - nested_nanos_);
+  if (parent_ != nullptr) {
+    parent_->nested_nanos_ += elapsed;
+  }
+  current_input_received_scope = parent_;
+}
+
+[[nodiscard]] InputReceivedScope TracedNode::TraceInputReceived(
+    ExecNode* input, const ExecBatch& batch) const {
+  input->metrics()->RecordOutput(batch);
+  node_->metrics()->RecordInput(batch);
+  std::unique_ptr<::arrow::internal::tracing::Scope> scope;
+#ifdef ARROW_WITH_OPENTELEMETRY
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
-  return START_SCOPED_SPAN(
+  scope = std::make_unique<::arrow::internal::tracing::Scope>(START_SCOPED_SPAN(
       span, node_kind + "::InputReceived",
-      {{"node.label", node_->label()}, {"node.batch_length", batch.length}});
+      {{"node.label", node_->label()}, {"node.batch_length", batch.length}}));
+#endif
+  return InputReceivedScope(node_->metrics(), std::move(scope));
 }
 
-void TracedNode::NoteInputReceived(const ExecBatch& batch) const {
+void TracedNode::NoteInputReceived(ExecNode* input, const ExecBatch& batch) const {
+  input->metrics()->RecordOutput(batch);
+  node_->metrics()->RecordInput(batch);
   std::string node_kind(node_->kind_name());
   EVENT_ON_CURRENT_SPAN(
       node_kind + "::InputReceived",
@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <optional>
 #include <thread>
 #include <unordered_map>
@@ -141,6 +142,29 @@ class ARROW_ACERO_EXPORT NullSinkNodeConsumer : public SinkNodeConsumer {
   }
 };
 
+/// \brief Scope of the processing of a batch by a node, returned by TraceInputReceived
+///
+/// Adds the time spent in the scope to the node's processing time, less the time spent
+/// in the scopes of downstream nodes nested in it on the same thread.
+class ARROW_ACERO_EXPORT InputReceivedScope {
+ public:
+  InputReceivedScope(ExecNodeMetrics* metrics,
+                     std::unique_ptr<::arrow::internal::tracing::Scope> scope);
+  ~InputReceivedScope();
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(InputReceivedScope);
+  InputReceivedScope(InputReceivedScope&&) = delete;
+  InputReceivedScope& operator=(InputReceivedScope&&) = delete;
+
+ private:
+  // Only set if tracing is enabled
+  std::unique_ptr<::arrow::internal::tracing::Scope> scope_;
+  ExecNodeMetrics* metrics_;
+  InputReceivedScope* parent_;
+  int64_t start_nanos_;
+  int64_t nested_nanos_ = 0;
+};
+
 /// CRTP helper for tracing helper functions
 
 class ARROW_ACERO_EXPORT TracedNode {
@@ -161,13 +185,14 @@ class ARROW_ACERO_EXPORT TracedNode {
   // All nodes should call TraceInputReceived for each batch they receive.  This call
   // should track the time spent processing the batch.  NoteInputReceived is available
   // but usually won't be used unless a node is simply adding batches to a trivial queue.
+  // Both update the metrics of this node and of the input the batch came from.
 
-  // Create a span to record the InputReceived work
-  [[nodiscard]] ::arrow::internal::tracing::Scope TraceInputReceived(
-      const ExecBatch& batch) const;
+  // Create a span to record the InputReceived work and time it
+  [[nodiscard]] InputReceivedScope TraceInputReceived(ExecNode* input,
+                                                      const ExecBatch& batch) const;
 
   // Record a call to InputReceived without creating with a span
-  void NoteInputReceived(const ExecBatch& batch) const;
+  void NoteInputReceived(ExecNode* input, const ExecBatch& batch) const;
 
   // Create a span to record any "finish" work.  This should NOT be called as part of
   // InputFinished and many nodes may not need to call this at all.  This should be used
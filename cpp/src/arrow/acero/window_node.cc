@@ -0,0 +1,729 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/acero/accumulation_queue.h"
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/row/grouper.h"
+#include "arrow/datum.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util_overflow.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+using compute::ExecSpan;
+using compute::NullPlacement;
+using compute::RowSegmenter;
+using compute::Segment;
+using compute::SortOrder;
+using compute::TakeOptions;
+
+namespace acero {
+namespace {
+
+enum class WindowKind {
+  kRowNumber,
+  kRank,
+  kDenseRank,
+  kLag,
+  kLead,
+  kCount,
+  kSum,
+  kMean,
+  kMin,
+  kMax
+};
+
+Result<WindowKind> GetWindowKind(const std::string& function) {
+  static const std::unordered_map<std::string, WindowKind> kinds = {
+      {"row_number", WindowKind::kRowNumber},
+      {"rank", WindowKind::kRank},
+      {"dense_rank", WindowKind::kDenseRank},
+      {"lag", WindowKind::kLag},
+      {"lead", WindowKind::kLead},
+      {"count", WindowKind::kCount},
+      {"sum", WindowKind::kSum},
+      {"mean", WindowKind::kMean},
+      {"min", WindowKind::kMin},
+      {"max", WindowKind::kMax}};
+  auto it = kinds.find(function);
+  if (it == kinds.end()) {
+    return Status::Invalid("Unknown window function '", function, "'");
+  }
+  return it->second;
+}
+
+bool IsRanking(WindowKind kind) {
+  return kind == WindowKind::kRowNumber || kind == WindowKind::kRank ||
+         kind == WindowKind::kDenseRank;
+}
+
+bool IsFramed(WindowKind kind) {
+  return kind == WindowKind::kCount || kind == WindowKind::kSum ||
+         kind == WindowKind::kMean || kind == WindowKind::kMin ||
+         kind == WindowKind::kMax;
+}
+
+bool IsFloatingOrInteger(const DataType& type) {
+  return is_integer(type.id()) || type.id() == Type::FLOAT || type.id() == Type::DOUBLE;
+}
+
+// Reinterprets temporal arrays as their integer storage
+std::shared_ptr<Array> GetIntegerView(const Array& array) {
+  auto data = array.data()->Copy();
+  data->type = GetPhysicalType(data->type);
+  return MakeArray(std::move(data));
+}
+
+struct BoundWindowFunction {
+  WindowKind kind;
+  int target_id;
+  WindowFrame frame;
+  int64_t offset;
+};
+
+// The rows aggregated for each row of a partition, as half-open ranges.  Both bounds
+// are non-decreasing, which lets aggregates slide over the partition.
+struct Frames {
+  std::vector<int64_t> begins;
+  std::vector<int64_t> ends;
+};
+
+int64_t SaturatingAdd(int64_t value, int64_t delta) {
+  int64_t out;
+  if (internal::AddWithOverflow(value, delta, &out)) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  return out;
+}
+
+int64_t SaturatingSubtract(int64_t value, int64_t delta) {
+  int64_t out;
+  if (internal::SubtractWithOverflow(value, delta, &out)) {
+    return std::numeric_limits<int64_t>::min();
+  }
+  return out;
+}
+
+Frames MakeRowsFrames(const WindowFrame& frame, int64_t length) {
+  Frames frames;
+  frames.begins.resize(length);
+  frames.ends.resize(length);
+  for (int64_t i = 0; i < length; ++i) {
+    frames.begins[i] = frame.preceding >= i ? 0 : i - frame.preceding;
+    frames.ends[i] = frame.following >= length - i ? length : i + frame.following + 1;
+  }
+  return frames;
+}
+
+Frames MakeRangeFrames(const WindowFrame& frame, const Int64Array& keys, SortOrder order,
+                       NullPlacement null_placement) {
+  const int64_t length = keys.length();
+  const int64_t null_count = keys.null_count();
+  const bool unbounded_preceding = frame.preceding == WindowFrame::kUnbounded;
+  const bool unbounded_following = frame.following == WindowFrame::kUnbounded;
+  int64_t valid_begin = 0;
+  int64_t valid_end = length - null_count;
+  if (null_placement == NullPlacement::AtStart) {
+    valid_begin = null_count;
+    valid_end = length;
+  }
+
+  Frames frames;
+  frames.begins.resize(length);
+  frames.ends.resize(length);
+  // Null keys are only peers of each other
+  const int64_t null_begin = valid_begin == 0 ? valid_end : 0;
+  const int64_t null_end = valid_begin == 0 ? length : valid_begin;
+  for (int64_t i = null_begin; i < null_end; ++i) {
+    frames.begins[i] = unbounded_preceding ? 0 : null_begin;
+    frames.ends[i] = unbounded_following ? length : null_end;
+  }
+
+  const bool ascending = order == SortOrder::Ascending;
+  int64_t begin = valid_begin;
+  int64_t end = valid_begin;
+  for (int64_t i = valid_begin; i < valid_end; ++i) {
+    const int64_t key = keys.Value(i);
+    if (ascending) {
+      const int64_t lowest = SaturatingSubtract(key, frame.preceding);
+      const int64_t highest = SaturatingAdd(key, frame.following);
+      while (begin < valid_end && keys.Value(begin) < lowest) ++begin;
+      while (end < valid_end && keys.Value(end) <= highest) ++end;
+    } else {
+      const int64_t highest = SaturatingAdd(key, frame.preceding);
+      const int64_t lowest = SaturatingSubtract(key, frame.following);
+      while (begin < valid_end && keys.Value(begin) > highest) ++begin;
+      while (end < valid_end && keys.Value(end) >= lowest) ++end;
+    }
+    frames.begins[i] = unbounded_preceding ? 0 : begin;
+    frames.ends[i] = unbounded_following ? length : end;
+  }
+  return frames;
+}
+
+// Evaluates a framed aggregate in a single pass over the partition: values enter the
+// frame at its end and leave it at its start, so the running sum and count, or the
+// monotonic deque of candidates for min/max, are updated in amortized O(1) per row.
+template <typename ArrowType>
+Result<std::shared_ptr<Array>> SlidingAggregate(WindowKind kind, const Array& values,
+                                                const Frames& frames,
+                                                MemoryPool* pool) {
+  using CType = typename ArrowType::c_type;
+  const auto& typed_values = checked_cast<const NumericArray<ArrowType>&>(values);
+  const int64_t length = typed_values.length();
+
+  auto add = [](CType left, CType right) -> CType {
+    if constexpr (std::is_integral_v<CType>) {
+      return internal::SafeSignedAdd(left, right);
+    } else {
+      return left + right;
+    }
+  };
+  auto subtract = [](CType left, CType right) -> CType {
+    if constexpr (std::is_integral_v<CType>) {
+      return internal::SafeSignedSubtract(left, right);
+    } else {
+      return left - right;
+    }
+  };
+  // Whether `candidate` makes `value` useless as a future min or max of the frame
+  auto supersedes = [kind](CType candidate, CType value) {
+    return kind == WindowKind::kMin ? candidate <= value : candidate >= value;
+  };
+
+  NumericBuilder<ArrowType> value_builder(pool);
+  Int64Builder count_builder(pool);
+  DoubleBuilder mean_builder(pool);
+  RETURN_NOT_OK(value_builder.Reserve(length));
+  RETURN_NOT_OK(count_builder.Reserve(length));
+  RETURN_NOT_OK(mean_builder.Reserve(length));
+
+  CType sum = 0;
+  int64_t count = 0;
+  std::deque<int64_t> candidates;
+  int64_t begin = 0;
+  int64_t end = 0;
+  for (int64_t i = 0; i < length; ++i) {
+    for (; end < frames.ends[i]; ++end) {
+      if (typed_values.IsNull(end)) continue;
+      const CType value = typed_values.Value(end);
+      sum = add(sum, value);
+      ++count;
+      while (!candidates.empty() &&
+             supersedes(value, typed_values.Value(candidates.back()))) {
+        candidates.pop_back();
+      }
+      candidates.push_back(end);
+    }
+    for (; begin < frames.begins[i]; ++begin) {
+      if (typed_values.IsNull(begin)) continue;
+      sum = subtract(sum, typed_values.Value(begin));
+      --count;
+    }
+    while (!candidates.empty() && candidates.front() < begin) {
+      candidates.pop_front();
+    }
+    if (count == 0) {
+      // Don't let floating point error accumulate across empty frames
+      sum = 0;
+    }
+
+    switch (kind) {
+      case WindowKind::kCount:
+        count_builder.UnsafeAppend(count);
+        break;
+      case WindowKind::kSum:
+        if (count == 0) {
+          value_builder.UnsafeAppendNull();
+        } else {
+          value_builder.UnsafeAppend(sum);
+        }
+        break;
+      case WindowKind::kMean:
+        if (count == 0) {
+          mean_builder.UnsafeAppendNull();
+        } else {
+          mean_builder.UnsafeAppend(static_cast<double>(sum) / count);
+        }
+        break;
+      default:
+        if (candidates.empty()) {
+          value_builder.UnsafeAppendNull();
+        } else {
+          value_builder.UnsafeAppend(typed_values.Value(candidates.front()));
+        }
+        break;
+    }
+  }
+
+  switch (kind) {
+    case WindowKind::kCount:
+      return count_builder.Finish();
+    case WindowKind::kMean:
+      return mean_builder.Finish();
+    default:
+      return value_builder.Finish();
+  }
+}
+
+class WindowNode : public ExecNode, public TracedNode, util::SequencingQueue::Processor {
+ public:
+  WindowNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+             std::shared_ptr<Schema> output_schema, WindowNodeOptions options,
+             std::vector<BoundWindowFunction> functions,
+             std::vector<int> partition_key_ids, std::vector<int> order_key_ids,
+             std::unique_ptr<RowSegmenter> partition_segmenter,
+             std::unique_ptr<RowSegmenter> order_segmenter)
+      : ExecNode(plan, std::move(inputs), {"input"}, std::move(output_schema)),
+        TracedNode(this),
+        options_(std::move(options)),
+        functions_(std::move(functions)),
+        partition_key_ids_(std::move(partition_key_ids)),
+        order_key_ids_(std::move(order_key_ids)),
+        partition_segmenter_(std::move(partition_segmenter)),
+        order_segmenter_(std::move(order_segmenter)),
+        sequencing_queue_(util::SequencingQueue::Make(this)) {}
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "WindowNode"));
+
+    const auto& window_options = checked_cast<const WindowNodeOptions&>(options);
+    const auto& input_schema = inputs[0]->output_schema();
+    ExecContext* ctx = plan->query_context()->exec_context();
+
+    std::vector<int> partition_key_ids;
+    std::vector<TypeHolder> partition_key_types;
+    for (const FieldRef& key : window_options.partition_keys) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.FindOne(*input_schema));
+      partition_key_ids.push_back(match[0]);
+      partition_key_types.emplace_back(input_schema->field(match[0])->type().get());
+    }
+
+    std::vector<int> order_key_ids;
+    std::vector<TypeHolder> order_key_types;
+    for (const compute::SortKey& key : window_options.ordering.sort_keys()) {
+      ARROW_ASSIGN_OR_RAISE(auto match, key.target.FindOne(*input_schema));
+      order_key_ids.push_back(match[0]);
+      order_key_types.emplace_back(input_schema->field(match[0])->type().get());
+    }
+
+    FieldVector output_fields = input_schema->fields();
+    std::vector<BoundWindowFunction> functions;
+    for (const WindowFunction& function : window_options.functions) {
+      ARROW_ASSIGN_OR_RAISE(WindowKind kind, GetWindowKind(function.function));
+      BoundWindowFunction bound{kind, /*target_id=*/-1, function.frame, function.offset};
+
+      std::shared_ptr<DataType> out_type = uint64();
+      if (!IsRanking(kind)) {
+        ARROW_ASSIGN_OR_RAISE(auto match, function.target.FindOne(*input_schema));
+        bound.target_id = match[0];
+        const auto& target_type = input_schema->field(bound.target_id)->type();
+        out_type = target_type;
+        if (IsFramed(kind) && kind != WindowKind::kCount &&
+            !IsFloatingOrInteger(*target_type)) {
+          return Status::TypeError("Window function '", function.function,
+                                   "' is not supported for type ",
+                                   target_type->ToString());
+        }
+        if (kind == WindowKind::kCount) {
+          out_type = int64();
+        } else if (kind == WindowKind::kMean) {
+          out_type = float64();
+        } else if (kind == WindowKind::kSum) {
+          out_type = is_integer(target_type->id()) ? int64() : float64();
+        }
+      }
+
+      if (kind == WindowKind::kLag || kind == WindowKind::kLead) {
+        if (function.offset < 0) {
+          return Status::Invalid("The offset of window function '", function.function,
+                                 "' must be non-negative");
+        }
+      }
+      if (IsFramed(kind)) {
+        if (function.frame.preceding < 0 || function.frame.following < 0) {
+          return Status::Invalid("The frame bounds of window function '",
+                                 function.function, "' must be non-negative");
+        }
+        if (function.frame.type == WindowFrame::RANGE) {
+          if (order_key_ids.size() != 1) {
+            return Status::Invalid(
+                "A RANGE frame requires an ordering with exactly one sort key");
+          }
+          const auto& key_type = input_schema->field(order_key_ids[0])->type();
+          if (!is_integer(GetPhysicalType(key_type)->id())) {
+            return Status::TypeError("A RANGE frame requires an integer or temporal ",
+                                     "ordering key, got ", key_type->ToString());
+          }
+        }
+      }
+      output_fields.push_back(field(function.name, std::move(out_type)));
+      functions.push_back(bound);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto partition_segmenter,
+        RowSegmenter::Make(partition_key_types, /*nullable_keys=*/true, ctx));
+    ARROW_ASSIGN_OR_RAISE(
+        auto order_segmenter,
+        RowSegmenter::Make(order_key_types, /*nullable_keys=*/true, ctx));
+
+    return plan->EmplaceNode<WindowNode>(
+        plan, std::move(inputs), schema(std::move(output_fields)), window_options,
+        std::move(functions), std::move(partition_key_ids), std::move(order_key_ids),
+        std::move(partition_segmenter), std::move(order_segmenter));
+  }
+
+  const char* kind_name() const override { return "WindowNode"; }
+
+  const Ordering& ordering() const override { return inputs_[0]->ordering(); }
+
+  Status Validate() const override {
+    ARROW_RETURN_NOT_OK(ExecNode::Validate());
+    if (inputs_[0]->ordering().is_unordered()) {
+      return Status::Invalid(
+          "Window node's input has no meaningful ordering and so partitions cannot be "
+          "delimited.  Please sort the input on the partition keys and the ordering "
+          "(e.g. by inserting an order_by node)");
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(input, batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    return sequencing_queue_->InsertBatch(std::move(batch));
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    DCHECK_EQ(input, inputs_[0]);
+    EVENT_ON_CURRENT_SPAN("InputFinished", {{"batches.length", total_batches}});
+    if (in_batch_counter_.SetTotal(total_batches)) {
+      std::vector<ExecBatch> out;
+      RETURN_NOT_OK(Finish(&out));
+      if (!out.empty()) {
+        Schedule(SendBatches(std::move(out)));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Batches are processed in order, so that a partition is known to be complete as
+  // soon as a row of the next partition is seen
+  Result<std::optional<util::SequencingQueue::Task>> Process(ExecBatch batch) override {
+    std::vector<ExecBatch> out;
+    if (partition_key_ids_.empty()) {
+      if (batch.length > 0) {
+        buffered_.push_back(std::move(batch));
+      }
+    } else {
+      ARROW_ASSIGN_OR_RAISE(ExecBatch keys, batch.SelectValues(partition_key_ids_));
+      ExecSpan key_span(keys);
+      int64_t offset = 0;
+      while (true) {
+        ARROW_ASSIGN_OR_RAISE(Segment segment,
+                              partition_segmenter_->GetNextSegment(key_span, offset));
+        if (segment.offset >= key_span.length) break;
+        if (!segment.extends) {
+          RETURN_NOT_OK(EvaluatePartition(&out));
+        }
+        buffered_.push_back(batch.Slice(segment.offset, segment.length));
+        offset = segment.offset + segment.length;
+      }
+    }
+
+    if (in_batch_counter_.Increment()) {
+      RETURN_NOT_OK(Finish(&out));
+    }
+    if (out.empty()) {
+      return std::nullopt;
+    }
+    return SendBatches(std::move(out));
+  }
+
+  void Schedule(util::SequencingQueue::Task task) override {
+    plan_->query_context()->ScheduleTask(std::move(task), "WindowNode::ProcessBatch");
+  }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    std::stringstream ss;
+    ss << "functions=[";
+    for (size_t i = 0; i < options_.functions.size(); ++i) {
+      if (i > 0) ss << ", ";
+      const WindowFunction& function = options_.functions[i];
+      ss << function.function << "(" << function.target.ToString() << ")";
+    }
+    ss << "], partition_keys=[";
+    for (size_t i = 0; i < options_.partition_keys.size(); ++i) {
+      if (i > 0) ss << ", ";
+      ss << options_.partition_keys[i].ToString();
+    }
+    ss << "], ordering=" << options_.ordering.ToString();
+    return ss.str();
+  }
+
+ private:
+  util::SequencingQueue::Task SendBatches(std::vector<ExecBatch> batches) {
+    return [this, batches = std::move(batches)]() mutable {
+      for (ExecBatch& batch : batches) {
+        RETURN_NOT_OK(output_->InputReceived(this, std::move(batch)));
+      }
+      return Status::OK();
+    };
+  }
+
+  // Evaluates the last partition and ends the output
+  Status Finish(std::vector<ExecBatch>* out) {
+    RETURN_NOT_OK(EvaluatePartition(out));
+    return output_->InputFinished(this, out_batch_count_);
+  }
+
+  // Evaluates the window functions over the buffered partition and slices the result
+  // into output batches
+  Status EvaluatePartition(std::vector<ExecBatch>* out) {
+    if (buffered_.empty()) {
+      return Status::OK();
+    }
+    const auto& input_schema = inputs_[0]->output_schema();
+    RecordBatchVector batches;
+    for (const ExecBatch& batch : buffered_) {
+      ARROW_ASSIGN_OR_RAISE(auto record_batch, batch.ToRecordBatch(input_schema));
+      batches.push_back(std::move(record_batch));
+    }
+    buffered_.clear();
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> partition,
+                          ConcatenateRecordBatches(batches, pool()));
+    batches.clear();
+
+    std::vector<Datum> values(partition->columns().begin(), partition->columns().end());
+    for (const BoundWindowFunction& function : functions_) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> column,
+                            EvaluateFunction(function, *partition));
+      values.emplace_back(std::move(column));
+    }
+
+    ExecBatch result(std::move(values), partition->num_rows());
+    for (int64_t offset = 0; offset < result.length; offset += ExecPlan::kMaxBatchSize) {
+      ExecBatch slice = result.Slice(offset, ExecPlan::kMaxBatchSize);
+      slice.index = out_batch_count_++;
+      out->push_back(std::move(slice));
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Array>> EvaluateFunction(const BoundWindowFunction& function,
+                                                  const RecordBatch& partition) {
+    switch (function.kind) {
+      case WindowKind::kRowNumber:
+      case WindowKind::kRank:
+      case WindowKind::kDenseRank:
+        return EvaluateRanking(function.kind, partition);
+      case WindowKind::kLag:
+      case WindowKind::kLead:
+        return EvaluateOffset(function, partition);
+      default:
+        return EvaluateFramed(function, partition);
+    }
+  }
+
+  Result<std::shared_ptr<Array>> EvaluateRanking(WindowKind kind,
+                                                 const RecordBatch& partition) {
+    const int64_t length = partition.num_rows();
+    UInt64Builder builder(pool());
+    RETURN_NOT_OK(builder.Reserve(length));
+    if (kind == WindowKind::kRowNumber) {
+      for (int64_t i = 0; i < length; ++i) {
+        builder.UnsafeAppend(static_cast<uint64_t>(i + 1));
+      }
+      return builder.Finish();
+    }
+
+    // The input is sorted, so peers are consecutive rows with equal sort keys
+    std::vector<Datum> keys;
+    for (int id : order_key_ids_) {
+      keys.emplace_back(partition.column(id));
+    }
+    ExecBatch key_batch(std::move(keys), length);
+    ExecSpan key_span(key_batch);
+    RETURN_NOT_OK(order_segmenter_->Reset());
+    uint64_t dense_rank = 0;
+    int64_t offset = 0;
+    while (offset < length) {
+      ARROW_ASSIGN_OR_RAISE(Segment segment,
+                            order_segmenter_->GetNextSegment(key_span, offset));
+      ++dense_rank;
+      const uint64_t rank = kind == WindowKind::kRank
+                                ? static_cast<uint64_t>(segment.offset + 1)
+                                : dense_rank;
+      for (int64_t i = 0; i < segment.length; ++i) {
+        builder.UnsafeAppend(rank);
+      }
+      offset = segment.offset + segment.length;
+    }
+    return builder.Finish();
+  }
+
+  Result<std::shared_ptr<Array>> EvaluateOffset(const BoundWindowFunction& function,
+                                                const RecordBatch& partition) {
+    const int64_t length = partition.num_rows();
+    Int64Builder indices(pool());
+    RETURN_NOT_OK(indices.Reserve(length));
+    for (int64_t i = 0; i < length; ++i) {
+      if (function.offset >= length) {
+        indices.UnsafeAppendNull();
+        continue;
+      }
+      int64_t source = function.kind == WindowKind::kLag ? i - function.offset
+                                                         : i + function.offset;
+      if (source < 0 || source >= length) {
+        indices.UnsafeAppendNull();
+      } else {
+        indices.UnsafeAppend(source);
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices_array, indices.Finish());
+    ARROW_ASSIGN_OR_RAISE(Datum taken, Take(partition.column(function.target_id),
+                                            indices_array, TakeOptions::NoBoundsCheck(),
+                                            plan_->query_context()->exec_context()));
+    return taken.make_array();
+  }
+
+  Result<std::shared_ptr<Array>> EvaluateFramed(const BoundWindowFunction& function,
+                                                const RecordBatch& partition) {
+    ExecContext* ctx = plan_->query_context()->exec_context();
+    Frames frames;
+    if (function.frame.type == WindowFrame::RANGE) {
+      const compute::SortKey& sort_key = options_.ordering.sort_keys()[0];
+      std::shared_ptr<Array> keys = GetIntegerView(*partition.column(order_key_ids_[0]));
+      ARROW_ASSIGN_OR_RAISE(keys, compute::Cast(*keys, int64(), compute::CastOptions{},
+                                                ctx));
+      frames = MakeRangeFrames(function.frame, checked_cast<const Int64Array&>(*keys),
+                               sort_key.order, options_.ordering.null_placement());
+    } else {
+      frames = MakeRowsFrames(function.frame, partition.num_rows());
+    }
+
+    // Aggregate integers as int64 and floating point values as double
+    const std::shared_ptr<Array>& target = partition.column(function.target_id);
+    std::shared_ptr<Array> values;
+    if (IsFloatingOrInteger(*target->type())) {
+      auto values_type = is_integer(target->type_id()) ? int64() : float64();
+      ARROW_ASSIGN_OR_RAISE(values, compute::Cast(*target, values_type,
+                                                  compute::CastOptions::Safe(), ctx));
+    } else {
+      // Only the validity matters when counting the values of other types
+      DCHECK_EQ(function.kind, WindowKind::kCount);
+      ARROW_ASSIGN_OR_RAISE(
+          auto zeros, MakeArrayFromScalar(Int64Scalar(0), target->length(), pool()));
+      std::shared_ptr<Buffer> validity;
+      if (target->null_count() > 0) {
+        ARROW_ASSIGN_OR_RAISE(
+            validity, compute::IsValid(target, ctx).Map([](const Datum& datum) {
+              return datum.array()->buffers[1];
+            }));
+      }
+      values = MakeArray(ArrayData::Make(int64(), target->length(),
+                                         {std::move(validity), zeros->data()->buffers[1]},
+                                         target->null_count()));
+    }
+
+    std::shared_ptr<Array> result;
+    if (values->type_id() == Type::INT64) {
+      ARROW_ASSIGN_OR_RAISE(
+          result, SlidingAggregate<Int64Type>(function.kind, *values, frames, pool()));
+    } else {
+      ARROW_ASSIGN_OR_RAISE(
+          result, SlidingAggregate<DoubleType>(function.kind, *values, frames, pool()));
+    }
+    if (function.kind == WindowKind::kMin || function.kind == WindowKind::kMax) {
+      ARROW_ASSIGN_OR_RAISE(result, compute::Cast(*result, target->type(),
+                                                  compute::CastOptions::Safe(), ctx));
+    }
+    return result;
+  }
+
+  MemoryPool* pool() const { return plan_->query_context()->memory_pool(); }
+
+  const WindowNodeOptions options_;
+  const std::vector<BoundWindowFunction> functions_;
+  const std::vector<int> partition_key_ids_;
+  const std::vector<int> order_key_ids_;
+  std::unique_ptr<RowSegmenter> partition_segmenter_;
+  std::unique_ptr<RowSegmenter> order_segmenter_;
+
+  // The slices of the current partition received so far
+  std::vector<ExecBatch> buffered_;
+  AtomicCounter in_batch_counter_;
+  int32_t out_batch_count_ = 0;
+  std::unique_ptr<util::SequencingQueue> sequencing_queue_;
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterWindowNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(
+      registry->AddFactory(std::string(WindowNodeOptions::kName), WindowNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
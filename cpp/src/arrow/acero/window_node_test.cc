@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace acero {
+
+using compute::SortKey;
+using compute::SortOrder;
+
+// Small enough for partitions to span several batches
+static constexpr int64_t kMaxBatchSize = 2;
+
+std::shared_ptr<Schema> TestSchema() {
+  return schema({field("p", int32()), field("t", int64()), field("v", int64())});
+}
+
+// Sorted on p then t
+std::shared_ptr<Table> TestTable() {
+  return TableFromJSON(TestSchema(), {R"([
+    [1, 1, 10],
+    [1, 2, null],
+    [1, 2, 30],
+    [1, 4, 40],
+    [2, 1, 5],
+    [2, 3, 6],
+    [2, 5, 7]
+  ])"});
+}
+
+Ordering TestOrdering() { return Ordering({SortKey("t")}); }
+
+void CheckWindow(const std::shared_ptr<Table>& input, WindowNodeOptions options,
+                 const std::shared_ptr<Table>& expected) {
+  for (bool use_threads : {false, true}) {
+    ARROW_SCOPED_TRACE("use_threads = ", use_threads);
+    Declaration plan = Declaration::Sequence(
+        {{"table_source", TableSourceNodeOptions(input, kMaxBatchSize)},
+         {"window", options}});
+    QueryOptions query_options;
+    query_options.sequence_output = true;
+    query_options.use_threads = use_threads;
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                         DeclarationToTable(std::move(plan), query_options));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
+void CheckWindowInvalid(WindowNodeOptions options, StatusCode code,
+                        const std::string& message) {
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(TestTable())}, {"window", options}});
+  Status status = DeclarationToStatus(std::move(plan));
+  ASSERT_EQ(code, status.code()) << status.ToString();
+  EXPECT_THAT(status.message(), testing::HasSubstr(message));
+}
+
+TEST(WindowNode, Ranking) {
+  WindowNodeOptions options({{"row_number", FieldRef(), "row_number"},
+                             {"rank", FieldRef(), "rank"},
+                             {"dense_rank", FieldRef(), "dense_rank"}},
+                            {"p"}, TestOrdering());
+  auto expected = TableFromJSON(
+      schema({field("p", int32()), field("t", int64()), field("v", int64()),
+              field("row_number", uint64()), field("rank", uint64()),
+              field("dense_rank", uint64())}),
+      {R"([
+    [1, 1, 10, 1, 1, 1],
+    [1, 2, null, 2, 2, 2],
+    [1, 2, 30, 3, 2, 2],
+    [1, 4, 40, 4, 4, 3],
+    [2, 1, 5, 1, 1, 1],
+    [2, 3, 6, 2, 2, 2],
+    [2, 5, 7, 3, 3, 3]
+  ])"});
+  CheckWindow(TestTable(), std::move(options), expected);
+}
+
+TEST(WindowNode, LagLead) {
+  WindowNodeOptions options(
+      {{"lag", "v", "lag"}, {"lead", "v", "lead"}, {"lead", "v", "lead2", {}, 2}},
+      {"p"}, TestOrdering());
+  auto expected = TableFromJSON(
+      schema({field("p", int32()), field("t", int64()), field("v", int64()),
+              field("lag", int64()), field("lead", int64()), field("lead2", int64())}),
+      {R"([
+    [1, 1, 10, null, null, 30],
+    [1, 2, null, 10, 30, 40],
+    [1, 2, 30, null, 40, null],
+    [1, 4, 40, 30, null, null],
+    [2, 1, 5, null, 6, 7],
+    [2, 3, 6, 5, 7, null],
+    [2, 5, 7, 6, null, null]
+  ])"});
+  CheckWindow(TestTable(), std::move(options), expected);
+}
+
+TEST(WindowNode, RowsFrames) {
+  WindowFrame cumulative;
+  WindowFrame previous;
+  previous.preceding = 1;
+  WindowFrame around;
+  around.preceding = 1;
+  around.following = 1;
+  WindowNodeOptions options(
+      {{"count", "v", "count", cumulative},
+       {"min", "v", "min", cumulative},
+       {"sum", "v", "sum", previous},
+       {"mean", "v", "mean", previous},
+       {"max", "v", "max", around}},
+      {"p"}, TestOrdering());
+  auto expected = TableFromJSON(
+      schema({field("p", int32()), field("t", int64()), field("v", int64()),
+              field("count", int64()), field("min", int64()), field("sum", int64()),
+              field("mean", float64()), field("max", int64())}),
+      {R"([
+    [1, 1, 10, 1, 10, 10, 10.0, 10],
+    [1, 2, null, 1, 10, 10, 10.0, 30],
+    [1, 2, 30, 2, 10, 30, 30.0, 40],
+    [1, 4, 40, 3, 10, 70, 35.0, 40],
+    [2, 1, 5, 1, 5, 5, 5.0, 6],
+    [2, 3, 6, 2, 5, 11, 5.5, 7],
+    [2, 5, 7, 3, 5, 13, 6.5, 7]
+  ])"});
+  CheckWindow(TestTable(), std::move(options), expected);
+}
+
+TEST(WindowNode, RangeFrames) {
+  WindowFrame previous;
+  previous.type = WindowFrame::RANGE;
+  previous.preceding = 1;
+  WindowFrame peers;
+  peers.type = WindowFrame::RANGE;
+  peers.preceding = 0;
+  WindowNodeOptions options(
+      {{"sum", "v", "sum", previous}, {"count", "v", "count", peers}}, {"p"},
+      TestOrdering());
+  auto expected = TableFromJSON(
+      schema({field("p", int32()), field("t", int64()), field("v", int64()),
+              field("sum", int64()), field("count", int64())}),
+      {R"([
+    [1, 1, 10, 10, 1],
+    [1, 2, null, 40, 1],
+    [1, 2, 30, 40, 1],
+    [1, 4, 40, 40, 1],
+    [2, 1, 5, 5, 1],
+    [2, 3, 6, 6, 1],
+    [2, 5, 7, 7, 1]
+  ])"});
+  CheckWindow(TestTable(), std::move(options), expected);
+}
+
+TEST(WindowNode, RangeFramesDescending) {
+  auto input = TableFromJSON(schema({field("t", int64()), field("v", int64())}), {R"([
+    [null, 1],
+    [9, 2],
+    [8, 3],
+    [6, 4],
+    [5, 5]
+  ])"});
+  WindowFrame frame;
+  frame.type = WindowFrame::RANGE;
+  frame.preceding = 1;
+  frame.following = 1;
+  WindowNodeOptions options(
+      {{"sum", "v", "sum", frame}}, {},
+      Ordering({SortKey("t", SortOrder::Descending)}, compute::NullPlacement::AtStart));
+  auto expected = TableFromJSON(
+      schema({field("t", int64()), field("v", int64()), field("sum", int64())}), {R"([
+    [null, 1, 1],
+    [9, 2, 5],
+    [8, 3, 5],
+    [6, 4, 9],
+    [5, 5, 9]
+  ])"});
+  CheckWindow(input, std::move(options), expected);
+}
+
+TEST(WindowNode, AfterOrderBy) {
+  auto input = TableFromJSON(TestSchema(), {R"([
+    [2, 3, 6],
+    [1, 4, 40],
+    [2, 1, 5],
+    [1, 1, 10],
+    [2, 5, 7],
+    [1, 2, 30]
+  ])"});
+  Declaration plan = Declaration::Sequence(
+      {{"table_source", TableSourceNodeOptions(input, kMaxBatchSize)},
+       {"order_by", OrderByNodeOptions(Ordering({SortKey("p"), SortKey("t")}))},
+       {"window", WindowNodeOptions({{"sum", "v", "sum"}}, {"p"}, TestOrdering())}});
+  QueryOptions query_options;
+  query_options.sequence_output = true;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Table> actual,
+                       DeclarationToTable(std::move(plan), query_options));
+  auto expected = TableFromJSON(
+      schema({field("p", int32()), field("t", int64()), field("v", int64()),
+              field("sum", int64())}),
+      {R"([
+    [1, 1, 10, 10],
+    [1, 2, 30, 40],
+    [1, 4, 40, 80],
+    [2, 1, 5, 5],
+    [2, 3, 6, 11],
+    [2, 5, 7, 18]
+  ])"});
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(WindowNode, Invalid) {
+  CheckWindowInvalid(WindowNodeOptions({{"ntile", "v", "out"}}), StatusCode::Invalid,
+                     "Unknown window function 'ntile'");
+  CheckWindowInvalid(WindowNodeOptions({{"lag", "v", "out", {}, -1}}),
+                     StatusCode::Invalid, "must be non-negative");
+  WindowFrame negative;
+  negative.preceding = -1;
+  CheckWindowInvalid(WindowNodeOptions({{"sum", "v", "out", negative}}),
+                     StatusCode::Invalid, "must be non-negative");
+  WindowFrame range;
+  range.type = WindowFrame::RANGE;
+  CheckWindowInvalid(WindowNodeOptions({{"sum", "v", "out", range}}),
+                     StatusCode::Invalid, "exactly one sort key");
+}
+
+}  // namespace acero
+}  // namespace arrow
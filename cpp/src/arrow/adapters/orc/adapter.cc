@@ -18,8 +18,12 @@
 #include "arrow/adapters/orc/adapter.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -30,9 +34,11 @@
 
 #include "arrow/adapters/orc/util.h"
 #include "arrow/builder.h"
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/table_builder.h"
@@ -40,9 +46,14 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/future.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/thread_pool.h"
 #include "orc/Exceptions.hh"
+#include "orc/Statistics.hh"
 
 // alias to not interfere with nested orc namespace
 namespace liborc = orc;
@@ -113,6 +124,13 @@ class ArrowInputFile : public liborc::InputStream {
   uint64_t getNaturalReadSize() const override { return 128 * 1024; }
 
   void read(void* buf, uint64_t length, uint64_t offset) override {
+    const io::ReadRange range{static_cast<int64_t>(offset), static_cast<int64_t>(length)};
+    if (auto cache = FindCache(range)) {
+      ORC_ASSIGN_OR_THROW(auto buffer, cache->Read(range));
+      std::memcpy(buf, buffer->data(), static_cast<size_t>(length));
+      return;
+    }
+
     ORC_ASSIGN_OR_THROW(int64_t bytes_read, file_->ReadAt(offset, length, buf));
 
     if (static_cast<uint64_t>(bytes_read) != length) {
@@ -125,8 +143,46 @@ class ArrowInputFile : public liborc::InputStream {
     return filename;
   }
 
+  // Serve the reads within the range from the cache, until RemoveCachedRange()
+  void AddCachedRange(const io::ReadRange& range,
+                      std::shared_ptr<io::internal::ReadRangeCache> cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cached_ranges_.push_back({range, std::move(cache)});
+  }
+
+  void RemoveCachedRange(const io::ReadRange& range,
+                         const io::internal::ReadRangeCache* cache) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = std::find_if(cached_ranges_.begin(), cached_ranges_.end(),
+                           [&](const CachedRange& cached) {
+                             return cached.range == range && cached.cache.get() == cache;
+                           });
+    if (it != cached_ranges_.end()) {
+      cached_ranges_.erase(it);
+    }
+  }
+
  private:
+  struct CachedRange {
+    io::ReadRange range;
+    std::shared_ptr<io::internal::ReadRangeCache> cache;
+  };
+
+  std::shared_ptr<io::internal::ReadRangeCache> FindCache(const io::ReadRange& range) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& cached : cached_ranges_) {
+      if (cached.range.Contains(range)) {
+        return cached.cache;
+      }
+    }
+    return nullptr;
+  }
+
   std::shared_ptr<io::RandomAccessFile> file_;
+  std::mutex mutex_;
+  // The ranges of the stripes being decoded by GetRecordBatchGenerator(), which
+  // are few at any time
+  std::vector<CachedRange> cached_ranges_;
 };
 
 // The number of rows to read in a ColumnVectorBatch
@@ -212,9 +268,12 @@ class ORCFileReader::Impl {
 
   Status Open(const std::shared_ptr<io::RandomAccessFile>& file, MemoryPool* pool) {
     std::unique_ptr<ArrowInputFile> io_wrapper(new ArrowInputFile(file));
+    ArrowInputFile* input = io_wrapper.get();
     liborc::ReaderOptions options;
     std::unique_ptr<liborc::Reader> liborc_reader;
     ORC_CATCH_NOT_OK(liborc_reader = createReader(std::move(io_wrapper), options));
+    file_ = file;
+    input_ = input;
     pool_ = pool;
     reader_ = std::move(liborc_reader);
     current_row_ = 0;
@@ -246,6 +305,111 @@ class ORCFileReader::Impl {
     return stripes_[static_cast<size_t>(stripe)];
   }
 
+  Result<std::vector<ColumnStatistics>> GetStripeStatistics(int64_t stripe) {
+    ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                    Status::Invalid("Out of bounds stripe: ", stripe));
+    std::vector<ColumnStatistics> statistics;
+    uint64_t num_stripe_statistics;
+    std::unique_ptr<liborc::StripeStatistics> stripe_statistics;
+    ORC_BEGIN_CATCH_NOT_OK
+    num_stripe_statistics = reader_->getNumberOfStripeStatistics();
+    if (static_cast<uint64_t>(stripe) >= num_stripe_statistics) {
+      return statistics;
+    }
+    stripe_statistics = reader_->getStripeStatistics(static_cast<uint64_t>(stripe));
+    ORC_END_CATCH_NOT_OK
+
+    const liborc::Type& type = reader_->getType();
+    for (uint64_t i = 0; i < type.getSubtypeCount(); ++i) {
+      const liborc::Type* field_type = type.getSubtype(i);
+      ColumnStatistics field_statistics;
+      if (field_type->getColumnId() < stripe_statistics->getNumberOfColumns()) {
+        ARROW_ASSIGN_OR_RAISE(auto arrow_type, GetArrowType(field_type));
+        const liborc::ColumnStatistics* column_statistics =
+            stripe_statistics->getColumnStatistics(
+                static_cast<uint32_t>(field_type->getColumnId()));
+        ARROW_ASSIGN_OR_RAISE(field_statistics,
+                              ConvertStatistics(*column_statistics, arrow_type));
+      }
+      statistics.push_back(std::move(field_statistics));
+    }
+    return statistics;
+  }
+
+  static Result<ColumnStatistics> ConvertStatistics(
+      const liborc::ColumnStatistics& column_statistics,
+      const std::shared_ptr<DataType>& type) {
+    ColumnStatistics statistics;
+    statistics.num_values = static_cast<int64_t>(column_statistics.getNumberOfValues());
+    statistics.has_null = column_statistics.hasNull();
+    switch (type->id()) {
+      case Type::BOOL: {
+        const auto* bool_statistics =
+            dynamic_cast<const liborc::BooleanColumnStatistics*>(&column_statistics);
+        if (bool_statistics != nullptr && bool_statistics->hasCount()) {
+          statistics.min = MakeScalar(bool_statistics->getFalseCount() == 0);
+          statistics.max = MakeScalar(bool_statistics->getTrueCount() > 0);
+        }
+        break;
+      }
+      case Type::INT8:
+      case Type::INT16:
+      case Type::INT32:
+      case Type::INT64: {
+        const auto* int_statistics =
+            dynamic_cast<const liborc::IntegerColumnStatistics*>(&column_statistics);
+        if (int_statistics != nullptr && int_statistics->hasMinimum() &&
+            int_statistics->hasMaximum()) {
+          ARROW_ASSIGN_OR_RAISE(statistics.min,
+                                MakeScalar(type, int_statistics->getMinimum()));
+          ARROW_ASSIGN_OR_RAISE(statistics.max,
+                                MakeScalar(type, int_statistics->getMaximum()));
+        }
+        break;
+      }
+      case Type::FLOAT:
+      case Type::DOUBLE: {
+        const auto* double_statistics =
+            dynamic_cast<const liborc::DoubleColumnStatistics*>(&column_statistics);
+        if (double_statistics != nullptr && double_statistics->hasMinimum() &&
+            double_statistics->hasMaximum() &&
+            !std::isnan(double_statistics->getMinimum()) &&
+            !std::isnan(double_statistics->getMaximum())) {
+          ARROW_ASSIGN_OR_RAISE(statistics.min,
+                                MakeScalar(type, double_statistics->getMinimum()));
+          ARROW_ASSIGN_OR_RAISE(statistics.max,
+                                MakeScalar(type, double_statistics->getMaximum()));
+        }
+        break;
+      }
+      case Type::STRING: {
+        const auto* string_statistics =
+            dynamic_cast<const liborc::StringColumnStatistics*>(&column_statistics);
+        if (string_statistics != nullptr && string_statistics->hasMinimum() &&
+            string_statistics->hasMaximum()) {
+          statistics.min = std::make_shared<StringScalar>(
+              std::string(string_statistics->getMinimum()));
+          statistics.max = std::make_shared<StringScalar>(
+              std::string(string_statistics->getMaximum()));
+        }
+        break;
+      }
+      case Type::DATE32: {
+        const auto* date_statistics =
+            dynamic_cast<const liborc::DateColumnStatistics*>(&column_statistics);
+        if (date_statistics != nullptr && date_statistics->hasMinimum() &&
+            date_statistics->hasMaximum()) {
+          statistics.min = std::make_shared<Date32Scalar>(date_statistics->getMinimum());
+          statistics.max = std::make_shared<Date32Scalar>(date_statistics->getMaximum());
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    return statistics;
+  }
+
   FileVersion GetFileVersion() {
     liborc::FileVersion orc_file_version = reader_->getFormatVersion();
     return FileVersion(orc_file_version.getMajor(), orc_file_version.getMinor());
@@ -548,7 +712,106 @@ class ORCFileReader::Impl {
     return NextStripeReader(batch_size, empty_vec);
   }
 
+  Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      std::shared_ptr<ORCFileReader> reader, const std::vector<int>& stripes,
+      const std::vector<int>& include_indices, const AsyncReadOptions& options) {
+    ARROW_RETURN_IF(options.batch_size <= 0,
+                    Status::Invalid("Batch size must be positive"));
+    ARROW_RETURN_IF(options.stripe_readahead <= 0,
+                    Status::Invalid("Stripe readahead must be positive"));
+    liborc::RowReaderOptions opts = DefaultRowReaderOptions();
+    if (!include_indices.empty()) {
+      RETURN_NOT_OK(SelectIndices(&opts, include_indices));
+    }
+    std::vector<bool> selected(stripes_.size(), false);
+    std::vector<io::ReadRange> ranges;
+    for (int stripe : stripes) {
+      ARROW_RETURN_IF(stripe < 0 || stripe >= NumberOfStripes(),
+                      Status::Invalid("Out of bounds stripe: ", stripe));
+      ARROW_RETURN_IF(selected[stripe], Status::Invalid("Duplicate stripe: ", stripe));
+      selected[stripe] = true;
+      ranges.push_back({stripes_[stripe].offset, stripes_[stripe].length});
+    }
+    ARROW_ASSIGN_OR_RAISE(auto schema, ReadSchema(opts));
+
+    // A single cache holds all the stripes so that it coalesces small ones, each
+    // stripe being released once decoded
+    auto cache = std::make_shared<io::internal::ReadRangeCache>(
+        file_, options.io_context, options.cache_options);
+    RETURN_NOT_OK(cache->Cache(ranges));
+
+    const int64_t batch_size = options.batch_size;
+    ::arrow::internal::Executor* cpu_executor = options.cpu_executor;
+    using BatchGenerator = AsyncGenerator<std::shared_ptr<RecordBatch>>;
+    auto read_stripe = [this, reader, cache, opts, schema, batch_size,
+                        cpu_executor](const int& stripe) -> Future<BatchGenerator> {
+      const io::ReadRange range{stripes_[stripe].offset, stripes_[stripe].length};
+      auto decode = [this, reader, cache, opts, schema, batch_size, stripe,
+                     range]() -> Result<BatchGenerator> {
+        input_->AddCachedRange(range, cache);
+        auto batches = ReadStripeBatches(opts, stripe, schema, batch_size);
+        input_->RemoveCachedRange(range, cache.get());
+        RETURN_NOT_OK(cache->Release({range}));
+        ARROW_ASSIGN_OR_RAISE(auto stripe_batches, std::move(batches));
+        return MakeVectorGenerator(std::move(stripe_batches));
+      };
+      return cache->WaitFor({range}).Then(
+          [cpu_executor, decode]() -> Future<BatchGenerator> {
+            if (cpu_executor == nullptr) {
+              return Future<BatchGenerator>::MakeFinished(decode());
+            }
+            return DeferNotOk(cpu_executor->Submit(decode));
+          });
+    };
+    AsyncGenerator<BatchGenerator> stripe_generator =
+        [stripes, read_stripe = std::move(read_stripe),
+         next = std::make_shared<std::atomic<size_t>>(0)]() -> Future<BatchGenerator> {
+      const size_t index = next->fetch_add(1);
+      if (index >= stripes.size()) {
+        return AsyncGeneratorEnd<BatchGenerator>();
+      }
+      return read_stripe(stripes[index]);
+    };
+    stripe_generator =
+        MakeReadaheadGenerator(std::move(stripe_generator), options.stripe_readahead);
+    return MakeConcatenatedGenerator(std::move(stripe_generator));
+  }
+
+  // Read a stripe as batches of up to batch_size rows. Stripes may be read
+  // concurrently.
+  Result<RecordBatchVector> ReadStripeBatches(const liborc::RowReaderOptions& row_opts,
+                                              int64_t stripe,
+                                              const std::shared_ptr<Schema>& schema,
+                                              int64_t batch_size) {
+    liborc::RowReaderOptions opts(row_opts);
+    RETURN_NOT_OK(SelectStripe(&opts, stripe));
+    std::unique_ptr<liborc::RowReader> row_reader;
+    {
+      // The liborc reader isn't documented as thread-safe, only the row readers are
+      // independent
+      std::lock_guard<std::mutex> lock(row_reader_mutex_);
+      ORC_CATCH_NOT_OK(row_reader = reader_->createRowReader(opts));
+    }
+    OrcStripeReader stripe_reader(std::move(row_reader), schema, batch_size, pool_);
+    RecordBatchVector batches;
+    while (true) {
+      std::shared_ptr<RecordBatch> batch;
+      ORC_BEGIN_CATCH_NOT_OK
+      RETURN_NOT_OK(stripe_reader.ReadNext(&batch));
+      ORC_END_CATCH_NOT_OK
+      if (batch == nullptr) {
+        break;
+      }
+      batches.push_back(std::move(batch));
+    }
+    return batches;
+  }
+
  private:
+  std::shared_ptr<io::RandomAccessFile> file_;
+  // Owned by reader_
+  ArrowInputFile* input_;
+  std::mutex row_reader_mutex_;
   MemoryPool* pool_;
   std::unique_ptr<liborc::Reader> reader_;
   std::vector<StripeInformation> stripes_;
@@ -630,6 +893,16 @@ Result<std::shared_ptr<RecordBatchReader>> ORCFileReader::NextStripeReader(
   return impl_->NextStripeReader(batch_size, include_indices);
 }
 
+Result<AsyncGenerator<std::shared_ptr<RecordBatch>>>
+ORCFileReader::GetRecordBatchGenerator(std::shared_ptr<ORCFileReader> reader,
+                                       const std::vector<int>& stripes,
+                                       const std::vector<int>& include_indices,
+                                       const AsyncReadOptions& options) {
+  DCHECK_EQ(reader.get(), this);
+  return impl_->GetRecordBatchGenerator(std::move(reader), stripes, include_indices,
+                                        options);
+}
+
 int64_t ORCFileReader::NumberOfStripes() { return impl_->NumberOfStripes(); }
 
 int64_t ORCFileReader::NumberOfRows() { return impl_->NumberOfRows(); }
@@ -638,6 +911,11 @@ StripeInformation ORCFileReader::GetStripeInformation(int64_t stripe) {
   return impl_->GetStripeInformation(stripe);
 }
 
+Result<std::vector<ColumnStatistics>> ORCFileReader::GetStripeStatistics(
+    int64_t stripe) {
+  return impl_->GetStripeStatistics(stripe);
+}
+
 FileVersion ORCFileReader::GetFileVersion() { return impl_->GetFileVersion(); }
 
 std::string ORCFileReader::GetSoftwareVersion() { return impl_->GetSoftwareVersion(); }
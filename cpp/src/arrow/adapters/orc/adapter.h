@@ -28,6 +28,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/async_generator_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -47,6 +48,20 @@ struct StripeInformation {
   int64_t first_row_id;
 };
 
+/// \brief Statistics of a top-level column of an ORC stripe
+struct ARROW_EXPORT ColumnStatistics {
+  /// \brief Number of non-null values
+  int64_t num_values = 0;
+  /// \brief Whether the column has null values
+  bool has_null = true;
+  /// \brief Minimum value, as a scalar of the Arrow type of the column, or null
+  /// if unknown
+  std::shared_ptr<Scalar> min;
+  /// \brief Maximum value, as a scalar of the Arrow type of the column, or null
+  /// if unknown
+  std::shared_ptr<Scalar> max;
+};
+
 /// \class ORCFileReader
 /// \brief Read an Arrow Table or RecordBatch from an ORC file.
 class ARROW_EXPORT ORCFileReader {
@@ -174,6 +189,25 @@ class ARROW_EXPORT ORCFileReader {
   Result<std::shared_ptr<RecordBatchReader>> GetRecordBatchReader(
       int64_t batch_size, const std::vector<std::string>& include_names);
 
+  /// \brief Get a generator of the record batches of the given stripes.
+  ///
+  /// The byte ranges of the stripes are prefetched with a ReadRangeCache and up to
+  /// `options.stripe_readahead` stripes are decoded concurrently on
+  /// `options.cpu_executor`. The batches are yielded in the order of `stripes`, each
+  /// stripe being split into batches of up to `options.batch_size` rows.
+  ///
+  /// \param[in] reader the owning pointer to this reader, which the generator keeps
+  /// alive
+  /// \param[in] stripes the distinct indices of the stripes to read
+  /// \param[in] include_indices the selected field indices to read, if not empty
+  /// (otherwise all fields are read)
+  /// \param[in] options the options of the read
+  /// \return the record batch generator
+  Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      std::shared_ptr<ORCFileReader> reader, const std::vector<int>& stripes,
+      const std::vector<int>& include_indices,
+      const AsyncReadOptions& options = AsyncReadOptions());
+
   /// \brief The number of stripes in the file
   int64_t NumberOfStripes();
 
@@ -183,6 +217,16 @@ class ARROW_EXPORT ORCFileReader {
   /// \brief StripeInformation for each stripe.
   StripeInformation GetStripeInformation(int64_t stripe);
 
+  /// \brief Get the statistics of the top-level fields in a stripe.
+  ///
+  /// The minimum and maximum are only known for boolean, integer, floating-point,
+  /// string and date fields.
+  ///
+  /// \param[in] stripe the stripe index
+  /// \return the statistics of each top-level field, or an empty vector if the file
+  /// has no statistics for the stripe
+  Result<std::vector<ColumnStatistics>> GetStripeStatistics(int64_t stripe);
+
   /// \brief Get the format version of the file.
   ///         Currently known values are 0.11 and 0.12.
   ///
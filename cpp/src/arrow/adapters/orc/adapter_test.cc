@@ -30,14 +30,18 @@
 #include "arrow/compute/cast.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/random.h"
 #include "arrow/type.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 namespace liborc = orc;
 
@@ -456,6 +460,86 @@ TEST(TestAdapterRead, ReadIntAndStringFileMultipleStripes) {
   EXPECT_EQ(num_rows / reader_batch_size, batches);
 }
 
+TEST(TestAdapterRead, ReadStripesAsync) {
+  MemoryOutputStream mem_stream(kDefaultMemStreamSize);
+  std::unique_ptr<liborc::Type> type(
+      liborc::Type::buildTypeFromString("struct<col1:bigint,col2:string>"));
+
+  constexpr int64_t stripe_count = 8;
+  constexpr int64_t stripe_row_count = 4096;
+
+  auto writer = CreateWriter(/*stripe_size=*/1024, *type, &mem_stream);
+  auto batch = writer->createRowBatch(stripe_row_count);
+  auto struct_batch = internal::checked_cast<liborc::StructVectorBatch*>(batch.get());
+  auto long_batch =
+      internal::checked_cast<liborc::LongVectorBatch*>(struct_batch->fields[0]);
+  auto str_batch =
+      internal::checked_cast<liborc::StringVectorBatch*>(struct_batch->fields[1]);
+  for (int64_t j = 0; j < stripe_count; ++j) {
+    // Each stripe has a single distinct string
+    std::string str_data = "stripe" + std::to_string(j);
+    for (int64_t i = 0; i < stripe_row_count; ++i) {
+      long_batch->data[i] = j * stripe_row_count + i;
+      str_batch->data[i] = &str_data[0];
+      str_batch->length[i] = static_cast<int64_t>(str_data.size());
+    }
+    struct_batch->numElements = stripe_row_count;
+    long_batch->numElements = stripe_row_count;
+    str_batch->numElements = stripe_row_count;
+    writer->add(*batch);
+  }
+  writer->close();
+
+  std::shared_ptr<io::RandomAccessFile> in_stream(new io::BufferReader(
+      std::make_shared<Buffer>(reinterpret_cast<const uint8_t*>(mem_stream.getData()),
+                               static_cast<int64_t>(mem_stream.getLength()))));
+  ASSERT_OK_AND_ASSIGN(
+      std::shared_ptr<adapters::orc::ORCFileReader> reader,
+      adapters::orc::ORCFileReader::Open(in_stream, default_memory_pool()));
+  ASSERT_EQ(stripe_count, reader->NumberOfStripes());
+
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->GetStripeStatistics(2));
+  ASSERT_EQ(statistics.size(), 2U);
+  ASSERT_EQ(statistics[0].num_values, stripe_row_count);
+  ASSERT_FALSE(statistics[0].has_null);
+  AssertScalarsEqual(*MakeScalar(int64_t{2 * stripe_row_count}), *statistics[0].min);
+  AssertScalarsEqual(*MakeScalar(int64_t{3 * stripe_row_count - 1}),
+                     *statistics[0].max);
+  AssertScalarsEqual(*MakeScalar("stripe2"), *statistics[1].min);
+  AssertScalarsEqual(*MakeScalar("stripe2"), *statistics[1].max);
+  ASSERT_RAISES(Invalid, reader->GetStripeStatistics(stripe_count));
+
+  const std::vector<int> stripes = {5, 1, 2};
+  for (auto executor : {static_cast<internal::Executor*>(internal::GetCpuThreadPool()),
+                        static_cast<internal::Executor*>(nullptr)}) {
+    adapters::orc::AsyncReadOptions options;
+    options.batch_size = 1000;
+    options.stripe_readahead = 2;
+    options.cpu_executor = executor;
+    ASSERT_OK_AND_ASSIGN(auto generator,
+                         reader->GetRecordBatchGenerator(reader, stripes, {0}, options));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(generator));
+
+    std::vector<int64_t> expected, actual;
+    for (int stripe : stripes) {
+      for (int64_t i = 0; i < stripe_row_count; ++i) {
+        expected.push_back(stripe * stripe_row_count + i);
+      }
+    }
+    for (const auto& record_batch : batches) {
+      ASSERT_EQ(record_batch->num_columns(), 1);
+      ASSERT_LE(record_batch->num_rows(), options.batch_size);
+      auto int64_array = checked_pointer_cast<Int64Array>(record_batch->column(0));
+      actual.insert(actual.end(), int64_array->raw_values(),
+                    int64_array->raw_values() + int64_array->length());
+    }
+    ASSERT_EQ(expected, actual);
+  }
+
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchGenerator(reader, {1, 1}, {}));
+  ASSERT_RAISES(Invalid, reader->GetRecordBatchGenerator(reader, {stripe_count}, {}));
+}
+
 TEST(TestAdapterRead, ReadCharAndVarcharType) {
   MemoryOutputStream mem_stream(kDefaultMemStreamSize);
   auto orc_type = liborc::Type::buildTypeFromString("struct<c1:char(6),c2:varchar(6)>");
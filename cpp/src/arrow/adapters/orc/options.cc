@@ -31,6 +31,12 @@ std::string FileVersion::ToString() const {
   return ss.str();
 }
 
+io::CacheOptions AsyncReadOptions::DefaultCacheOptions() {
+  io::CacheOptions options = io::CacheOptions::Defaults();
+  options.memory_limit = 256 * 1024 * 1024;
+  return options;
+}
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -19,8 +19,10 @@
 
 #include <vector>
 
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/status.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
@@ -115,6 +117,25 @@ struct ARROW_EXPORT WriteOptions {
   double bloom_filter_fpp = 0.05;
 };
 
+/// Options for reading stripes with ORCFileReader::GetRecordBatchGenerator
+struct ARROW_EXPORT AsyncReadOptions {
+  /// The maximum number of rows in each record batch, default 64Ki
+  int64_t batch_size = 64 * 1024;
+  /// The maximum number of stripes read and decoded concurrently, default 4
+  int32_t stripe_readahead = 4;
+  /// The I/O context used to prefetch the stripes
+  io::IOContext io_context;
+  /// How the byte ranges of the stripes are coalesced and prefetched, default
+  /// DefaultCacheOptions(). The memory limit bounds the bytes read ahead of
+  /// decoding: without one, all the stripes are read at once.
+  io::CacheOptions cache_options = DefaultCacheOptions();
+  /// The executor decoding the stripes, or null to decode them on the I/O threads
+  ::arrow::internal::Executor* cpu_executor = NULLPTR;
+
+  /// io::CacheOptions::Defaults() with a memory limit of 256 MiB
+  static io::CacheOptions DefaultCacheOptions();
+};
+
 }  // namespace orc
 }  // namespace adapters
 }  // namespace arrow
@@ -18,13 +18,19 @@
 #include "arrow/array/array_binary.h"
 
 #include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
+#include <vector>
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/util.h"
 #include "arrow/array/validate.h"
+#include "arrow/buffer.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/binary_view_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -110,6 +116,72 @@ std::string_view BinaryViewArray::GetView(int64_t i) const {
   return util::FromBinaryView(raw_values_[i], data_buffers);
 }
 
+Result<std::shared_ptr<Array>> BinaryViewArray::CompactDataBuffers(
+    double threshold, MemoryPool* pool) const {
+  const std::shared_ptr<Buffer>* data_buffers = data_->buffers.data() + 2;
+  int64_t data_buffers_size = 0;
+  for (size_t i = 2; i < data_->buffers.size(); ++i) {
+    if (data_->buffers[i]) {
+      data_buffers_size += data_->buffers[i]->size();
+    }
+  }
+
+  // The out-of-line values are packed into as few buffers as possible, each of them
+  // small enough to be addressed by the 32-bit offsets of the views
+  constexpr int64_t kMaxBufferSize = std::numeric_limits<int32_t>::max();
+  std::vector<int64_t> buffer_sizes;
+  int64_t referenced_size = 0;
+  for (int64_t i = 0; i < length(); ++i) {
+    if (IsNull(i) || raw_values_[i].is_inline()) continue;
+    const int64_t size = raw_values_[i].size();
+    referenced_size += size;
+    if (buffer_sizes.empty() || buffer_sizes.back() + size > kMaxBufferSize) {
+      buffer_sizes.push_back(0);
+    }
+    buffer_sizes.back() += size;
+  }
+  if (static_cast<double>(referenced_size) >=
+      threshold * static_cast<double>(data_buffers_size)) {
+    return MakeArray(data_);
+  }
+
+  BufferVector buffers(2 + buffer_sizes.size());
+  if (data_->buffers[0] && data_->MayHaveNulls()) {
+    ARROW_ASSIGN_OR_RAISE(buffers[0],
+                          internal::CopyBitmap(pool, data_->buffers[0]->data(),
+                                               data_->offset, data_->length));
+  }
+  ARROW_ASSIGN_OR_RAISE(buffers[1], AllocateBuffer(length() * BinaryViewType::kSize,
+                                                   pool));
+  for (size_t i = 0; i < buffer_sizes.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(buffers[2 + i], AllocateBuffer(buffer_sizes[i], pool));
+  }
+
+  auto* views = buffers[1]->mutable_data_as<c_type>();
+  int32_t buffer_index = 0;
+  int64_t buffer_offset = 0;
+  for (int64_t i = 0; i < length(); ++i) {
+    if (IsNull(i)) {
+      views[i] = {};
+      continue;
+    }
+    views[i] = raw_values_[i];
+    if (views[i].is_inline()) continue;
+    const int64_t size = views[i].size();
+    if (buffer_offset + size > buffer_sizes[buffer_index]) {
+      ++buffer_index;
+      buffer_offset = 0;
+    }
+    std::memcpy(buffers[2 + buffer_index]->mutable_data() + buffer_offset,
+                util::FromBinaryView(raw_values_[i], data_buffers).data(), size);
+    views[i].ref.buffer_index = buffer_index;
+    views[i].ref.offset = static_cast<int32_t>(buffer_offset);
+    buffer_offset += size;
+  }
+  return MakeArray(ArrayData::Make(data_->type, length(), std::move(buffers),
+                                   data_->null_count.load()));
+}
+
 StringViewArray::StringViewArray(std::shared_ptr<ArrayData> data) {
   ARROW_CHECK_EQ(data->type->id(), Type::STRING_VIEW);
   SetData(std::move(data));
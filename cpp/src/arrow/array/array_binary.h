@@ -250,6 +250,21 @@ class ARROW_EXPORT BinaryViewArray : public FlatArray {
   IteratorType begin() const { return IteratorType(*this); }
   IteratorType end() const { return IteratorType(*this, length()); }
 
+  /// \brief Copy the out-of-line values to new, densely packed data buffers
+  ///
+  /// Slices, takes and filters of view arrays keep all the data buffers of their
+  /// input alive, even when their views only reference a small part of them.
+  /// If the out-of-line values of the non-null views take less than `threshold`
+  /// times the size of the data buffers, this returns an array with the same
+  /// values whose views reference new data buffers holding only those values.
+  /// Otherwise, it returns an array sharing the buffers of this one.
+  ///
+  /// \param[in] threshold the fraction of the data buffers' bytes under which
+  /// they are compacted; the default compacts arrays with any unused byte
+  /// \param[in] pool the memory pool to allocate the new buffers from
+  Result<std::shared_ptr<Array>> CompactDataBuffers(
+      double threshold = 1.0, MemoryPool* pool = default_memory_pool()) const;
+
  protected:
   using FlatArray::FlatArray;
 
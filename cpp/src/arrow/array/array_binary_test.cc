@@ -741,6 +741,18 @@ class TestStringBuilder : public ::testing::Test {
     ASSERT_EQ(reps * 40, result_->value_data()->size());
   }
 
+  void TestReserveHint() {
+    ArrayBuilder* builder = builder_.get();
+    ASSERT_OK(builder->ReserveHint(10, 1000));
+    ASSERT_EQ(10, builder_->capacity());
+    ASSERT_EQ(bit_util::RoundUpToMultipleOf64(1000), builder_->value_data_capacity());
+    ASSERT_OK(builder->ReserveHint(5, 100));
+    ASSERT_EQ(10, builder_->capacity());
+    ASSERT_EQ(bit_util::RoundUpToMultipleOf64(1000), builder_->value_data_capacity());
+    Done();
+    ASSERT_EQ(0, result_->length());
+  }
+
   void TestOverflowCheck() {
     auto max_size = builder_->memory_limit();
 
@@ -800,6 +812,8 @@ TYPED_TEST(TestStringBuilder, TestCapacityReserve) { this->TestCapacityReserve()
 
 TYPED_TEST(TestStringBuilder, TestZeroLength) { this->TestZeroLength(); }
 
+TYPED_TEST(TestStringBuilder, TestReserveHint) { this->TestReserveHint(); }
+
 TYPED_TEST(TestStringBuilder, TestOverflowCheck) { this->TestOverflowCheck(); }
 
 // ----------------------------------------------------------------------
@@ -871,6 +885,27 @@ TEST_F(TestChunkedBinaryBuilder, Reserve) {
   ASSERT_EQ(default_memory_pool()->bytes_allocated(), bytes_after_first_reserve);
 }
 
+TEST_F(TestChunkedBinaryBuilder, ReserveData) {
+  const int32_t chunksize = 1000;
+  Init(chunksize);
+  ASSERT_OK(builder_->Reserve(10));
+  ASSERT_OK(builder_->Append(std::string(100, 'a')));
+  auto bytes_before_reserve = default_memory_pool()->bytes_allocated();
+  // Only the rest of the current chunk is reserved
+  ASSERT_OK(builder_->ReserveData(10 * chunksize));
+  auto bytes_after_reserve = default_memory_pool()->bytes_allocated();
+  ASSERT_LT(bytes_after_reserve - bytes_before_reserve, chunksize);
+  for (int i = 0; i < 9; ++i) {
+    ASSERT_OK(builder_->Append(std::string(100, 'b')));
+  }
+  ASSERT_EQ(default_memory_pool()->bytes_allocated(), bytes_after_reserve);
+
+  ArrayVector chunks;
+  ASSERT_OK(builder_->Finish(&chunks));
+  ASSERT_EQ(1, chunks.size());
+  ASSERT_EQ(10, chunks[0]->length());
+}
+
 TEST_F(TestChunkedBinaryBuilder, NoData) {
   Init(1000);
 
@@ -2178,6 +2178,55 @@ void CheckFloatingZeroEquality() {
   }
 }
 
+// Values are compared by blocks, the results under null entries being masked out
+template <typename TYPE>
+void CheckBlockwiseEquality() {
+  using c_type = typename TYPE::c_type;
+  std::shared_ptr<DataType> type = TypeTraits<TYPE>::type_singleton();
+  constexpr int kLength = 300;
+
+  std::vector<bool> is_valid(kLength);
+  std::vector<c_type> left_values(kLength), right_values(kLength);
+  for (int i = 0; i < kLength; ++i) {
+    // All valid in [64, 128), all null in [192, 256), mixed elsewhere
+    is_valid[i] = (i >= 64 && i < 128) || ((i < 192 || i >= 256) && i % 3 != 0);
+    left_values[i] = static_cast<c_type>(i % 100);
+    // Differ under null entries
+    right_values[i] = is_valid[i] ? left_values[i] : static_cast<c_type>(i % 7 + 1);
+  }
+  std::shared_ptr<Array> a, b;
+  ArrayFromVector<TYPE>(type, is_valid, left_values, &a);
+  ArrayFromVector<TYPE>(type, is_valid, right_values, &b);
+  ASSERT_TRUE(a->Equals(b));
+  ASSERT_TRUE(a->ApproxEquals(b));
+  for (int start : {0, 1, 63, 65, 130}) {
+    ASSERT_TRUE(a->RangeEquals(b, start, kLength, start));
+    ASSERT_TRUE(a->Slice(start)->Equals(b->Slice(start)));
+  }
+
+  for (int i : {1, 100, 170, 299}) {
+    ARROW_SCOPED_TRACE("different value at ", i);
+    ASSERT_TRUE(is_valid[i]);
+    auto different_values = right_values;
+    different_values[i] = static_cast<c_type>(different_values[i] + 1);
+    ArrayFromVector<TYPE>(type, is_valid, different_values, &b);
+    ASSERT_FALSE(a->Equals(b));
+    ASSERT_FALSE(a->ApproxEquals(b));
+    ASSERT_FALSE(a->RangeEquals(b, 0, i + 1, 0));
+    ASSERT_TRUE(a->RangeEquals(b, 0, i, 0));
+    ASSERT_TRUE(a->RangeEquals(b, i + 1, kLength, i + 1));
+    ASSERT_FALSE(a->Slice(1)->Equals(b->Slice(1)));
+  }
+}
+
+TEST(TestPrimitiveAdHoc, BlockwiseEquality) {
+  CheckBlockwiseEquality<Int8Type>();
+  CheckBlockwiseEquality<Int32Type>();
+  CheckBlockwiseEquality<UInt64Type>();
+  CheckBlockwiseEquality<FloatType>();
+  CheckBlockwiseEquality<DoubleType>();
+}
+
 TEST(TestPrimitiveAdHoc, FloatingApproxEquals) {
   CheckApproxEquals<FloatType>();
   CheckApproxEquals<DoubleType>();
@@ -3647,6 +3696,50 @@ TEST(TestSwapEndianArrayData, RandomData) {
   }
 }
 
+TEST(TestSwapEndianArrayData, InPlace) {
+  random::RandomArrayGenerator rng(42);
+
+  auto assert_swapped = [](const Array& expected,
+                           const std::shared_ptr<ArrayData>& swapped_data) {
+    ASSERT_OK_AND_ASSIGN(auto roundtripped_data,
+                         ::arrow::internal::SwapEndianArrayData(swapped_data));
+    auto roundtripped = MakeArray(roundtripped_data);
+    ASSERT_OK(roundtripped->ValidateFull());
+    AssertArraysEqual(expected, *roundtripped, /*verbose=*/true);
+  };
+
+  for (const auto& type : SwappableTypes()) {
+    ARROW_SCOPED_TRACE("type = ", type->ToString());
+    // Long enough to exercise the vectorized paths and their suffix
+    auto arr = rng.ArrayOf(*field("", type), /*size=*/133);
+
+    // Buffers owned by the array data alone are swapped in place
+    ASSERT_OK_AND_ASSIGN(auto copy, arr->CopyTo(default_cpu_memory_manager()));
+    std::shared_ptr<ArrayData> data = copy->data();
+    copy.reset();
+    std::vector<const uint8_t*> addresses;
+    for (const auto& buffer : data->buffers) {
+      addresses.push_back(buffer ? buffer->data() : nullptr);
+    }
+    ASSERT_OK_AND_ASSIGN(auto swapped_data,
+                         ::arrow::internal::SwapEndianArrayData(std::move(data)));
+    ASSERT_EQ(swapped_data->buffers.size(), addresses.size());
+    for (size_t i = 0; i < addresses.size(); ++i) {
+      ASSERT_EQ(swapped_data->buffers[i] ? swapped_data->buffers[i]->data() : nullptr,
+                addresses[i]);
+    }
+    assert_swapped(*arr, swapped_data);
+
+    // Shared array data is copied
+    ASSERT_OK_AND_ASSIGN(copy, arr->CopyTo(default_cpu_memory_manager()));
+    data = copy->data();
+    ASSERT_OK_AND_ASSIGN(swapped_data,
+                         ::arrow::internal::SwapEndianArrayData(std::move(data)));
+    AssertArraysEqual(*arr, *copy, /*verbose=*/true);
+    assert_swapped(*arr, swapped_data);
+  }
+}
+
 TEST(TestSwapEndianArrayData, InvalidLength) {
   // IPC-incoming data may be invalid, SwapEndianArrayData shouldn't crash
   // by accessing memory out of bounds.
@@ -145,6 +145,24 @@ class ARROW_EXPORT ArrayBuilder {
     return Resize(new_capacity);
   }
 
+  /// \brief Ensure that there is enough space allocated to append the indicated
+  /// number of elements and bytes of variable-size data without any further
+  /// reallocation.
+  ///
+  /// Callers knowing the size of what they are about to append, e.g. readers
+  /// from the row and byte counts of a block, should prefer this to Reserve()
+  /// so that the data of binary-like builders isn't reallocated (and copied)
+  /// while it grows. Builders without variable-size data ignore
+  /// additional_data_size.
+  ///
+  /// \param[in] additional_capacity the number of additional array values
+  /// \param[in] additional_data_size an estimate of the number of additional
+  /// bytes of variable-size data
+  /// \return Status
+  virtual Status ReserveHint(int64_t additional_capacity, int64_t additional_data_size) {
+    return Reserve(additional_capacity);
+  }
+
   /// Reset the builder.
   virtual void Reset();
 
@@ -262,6 +262,12 @@ Status ChunkedBinaryBuilder::Reserve(int64_t values) {
   return builder_->Resize(max_chunk_length_);
 }
 
+Status ChunkedBinaryBuilder::ReserveData(int64_t num_bytes) {
+  const int64_t chunk_remaining =
+      max_chunk_value_length_ - builder_->value_data_length();
+  return builder_->ReserveData(std::min(num_bytes, chunk_remaining));
+}
+
 }  // namespace internal
 
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
@@ -333,6 +334,14 @@ class BaseBinaryBuilder
     return value_data_builder_.Reserve(elements);
   }
 
+  Status ReserveHint(int64_t additional_capacity,
+                     int64_t additional_data_size) override {
+    ARROW_RETURN_NOT_OK(Reserve(additional_capacity));
+    // The estimate may overshoot what the array can hold
+    return value_data_builder_.Reserve(std::min<int64_t>(
+        additional_data_size, memory_limit() - value_data_builder_.length()));
+  }
+
   Status FinishInternal(std::shared_ptr<ArrayData>* out) override {
     // Write final offset (values length)
     ARROW_RETURN_NOT_OK(AppendNextOffset());
@@ -650,6 +659,13 @@ class ARROW_EXPORT BinaryViewBuilder : public ArrayBuilder {
   /// additional allocations
   Status ReserveData(int64_t length);
 
+  Status ReserveHint(int64_t additional_capacity,
+                     int64_t additional_data_size) override {
+    ARROW_RETURN_NOT_OK(Reserve(additional_capacity));
+    return ReserveData(std::min<int64_t>(additional_data_size,
+                                         internal::StringHeapBuilder::ValueSizeLimit()));
+  }
+
   Status AppendNulls(int64_t length) final {
     ARROW_RETURN_NOT_OK(Reserve(length));
     data_builder_.UnsafeAppend(length, BinaryViewType::c_type{});
@@ -940,6 +956,12 @@ class ARROW_EXPORT ChunkedBinaryBuilder {
 
   Status Reserve(int64_t values);
 
+  /// \brief Reserve space for the indicated number of bytes of value data
+  ///
+  /// Only the part fitting in the current chunk is reserved, as the data of
+  /// later chunks is allocated when they are started.
+  Status ReserveData(int64_t num_bytes);
+
   virtual Status Finish(ArrayVector* out);
 
  protected:
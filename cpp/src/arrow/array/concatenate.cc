@@ -44,8 +44,10 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/list_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/ree_util.h"
 #include "arrow/util/slice_util_internal.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
 
@@ -75,45 +77,117 @@ struct Bitmap {
   bool AllSet() const { return data == nullptr; }
 };
 
+int64_t SumBufferSizesInBytes(const BufferVector& buffers) {
+  int64_t size = 0;
+  for (const auto& buffer : buffers) {
+    size += buffer->size();
+  }
+  return size;
+}
+
+// Outputs of at least twice this many elements are copied in parallel, each task
+// copying at least this many elements
+constexpr int64_t kMinParallelCopyLength = 1 << 20;
+
+// Copy the inputs to a single output, where out_offsets holds the output offset of
+// each input followed by the output length.  copy_piece(i, in_offset, out_offset,
+// length) copies `length` elements of the i-th input, starting at in_offset.
+// Tasks start at multiples of task_alignment elements.
+//
+// Large outputs are split into ranges copied concurrently on the CPU thread pool,
+// unless already running on one of its threads, so that nested concatenations
+// (e.g. of the columns of a table) stay serial.
+template <typename CopyPiece>
+Status CopyPieces(const std::vector<int64_t>& out_offsets, CopyPiece&& copy_piece,
+                  int64_t task_alignment = 1) {
+  const int64_t num_inputs = static_cast<int64_t>(out_offsets.size()) - 1;
+  const int64_t out_length = out_offsets.back();
+  auto* executor = ::arrow::internal::GetCpuThreadPool();
+  int num_tasks = 1;
+  if (out_length >= 2 * kMinParallelCopyLength && !executor->OwnsThisThread()) {
+    num_tasks = static_cast<int>(std::min<int64_t>(
+        executor->GetCapacity(), out_length / kMinParallelCopyLength));
+  }
+  if (num_tasks <= 1) {
+    for (int64_t i = 0; i < num_inputs; ++i) {
+      const int64_t length = out_offsets[i + 1] - out_offsets[i];
+      if (length > 0) {
+        copy_piece(i, 0, out_offsets[i], length);
+      }
+    }
+    return Status::OK();
+  }
+  const int64_t task_length =
+      bit_util::RoundUp(bit_util::CeilDiv(out_length, num_tasks), task_alignment);
+  return ::arrow::internal::ParallelFor(
+      num_tasks,
+      [&](int task) {
+        const int64_t begin = std::min(out_length, task * task_length);
+        const int64_t end = std::min(out_length, begin + task_length);
+        // Start with the last input beginning at or before `begin`
+        auto it = std::upper_bound(out_offsets.begin(), out_offsets.end() - 1, begin);
+        for (int64_t i = (it - out_offsets.begin()) - 1;
+             i < num_inputs && out_offsets[i] < end; ++i) {
+          const int64_t piece_begin = std::max(begin, out_offsets[i]);
+          const int64_t piece_end = std::min(end, out_offsets[i + 1]);
+          if (piece_begin < piece_end) {
+            copy_piece(i, piece_begin - out_offsets[i], piece_begin,
+                       piece_end - piece_begin);
+          }
+        }
+        return Status::OK();
+      },
+      executor);
+}
+
 // Allocate a buffer and concatenate bitmaps into it.
 Status ConcatenateBitmaps(const std::vector<Bitmap>& bitmaps, MemoryPool* pool,
                           std::shared_ptr<Buffer>* out) {
-  int64_t out_length = 0;
-  for (const auto& bitmap : bitmaps) {
-    if (internal::AddWithOverflow(out_length, bitmap.range.length, &out_length)) {
+  std::vector<int64_t> out_offsets(bitmaps.size() + 1, 0);
+  for (size_t i = 0; i < bitmaps.size(); ++i) {
+    if (internal::AddWithOverflow(out_offsets[i], bitmaps[i].range.length,
+                                  &out_offsets[i + 1])) {
       return Status::Invalid("Length overflow when concatenating arrays");
     }
   }
-  ARROW_ASSIGN_OR_RAISE(*out, AllocateBitmap(out_length, pool));
+  ARROW_ASSIGN_OR_RAISE(*out, AllocateBitmap(out_offsets.back(), pool));
   uint8_t* dst = (*out)->mutable_data();
 
-  int64_t bitmap_offset = 0;
-  for (auto bitmap : bitmaps) {
-    if (bitmap.AllSet()) {
-      bit_util::SetBitsTo(dst, bitmap_offset, bitmap.range.length, true);
-    } else {
-      internal::CopyBitmap(bitmap.data, bitmap.range.offset, bitmap.range.length, dst,
-                           bitmap_offset);
-    }
-    bitmap_offset += bitmap.range.length;
-  }
-
-  return Status::OK();
+  // Tasks start on byte boundaries so that they don't write to the same bytes
+  return CopyPieces(
+      out_offsets,
+      [&](int64_t i, int64_t in_offset, int64_t out_offset, int64_t length) {
+        const Bitmap& bitmap = bitmaps[i];
+        if (bitmap.AllSet()) {
+          bit_util::SetBitsTo(dst, out_offset, length, true);
+        } else {
+          internal::CopyBitmap(bitmap.data, bitmap.range.offset + in_offset, length,
+                               dst, out_offset);
+        }
+      },
+      /*task_alignment=*/8);
 }
 
-int64_t SumBufferSizesInBytes(const BufferVector& buffers) {
-  int64_t size = 0;
-  for (const auto& buffer : buffers) {
-    size += buffer->size();
-  }
-  return size;
+// Like ConcatenateBuffers(), copying large outputs in parallel
+Result<std::shared_ptr<Buffer>> ParallelConcatenateBuffers(const BufferVector& buffers,
+                                                           MemoryPool* pool) {
+  std::vector<int64_t> out_offsets(buffers.size() + 1, 0);
+  for (size_t i = 0; i < buffers.size(); ++i) {
+    out_offsets[i + 1] = out_offsets[i] + buffers[i]->size();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(out_offsets.back(), pool));
+  uint8_t* out_data = out->mutable_data();
+  RETURN_NOT_OK(CopyPieces(out_offsets, [&](int64_t i, int64_t in_offset,
+                                            int64_t out_offset, int64_t length) {
+    std::memcpy(out_data + out_offset, buffers[i]->data() + in_offset, length);
+  }));
+  return std::shared_ptr<Buffer>(std::move(out));
 }
 
-// Write offsets in src into dst, adjusting them such that first_offset
-// will be the first offset written.
+// Compute the range of values spanned by the offsets in src, checking that they
+// can be displaced so that the first one becomes first_offset.
 template <typename Offset>
-Status PutOffsets(const Buffer& src, Offset first_offset, Offset* dst,
-                  Range* values_range);
+Status GetValuesRange(const Buffer& src, Offset first_offset, Range* values_range);
 
 // Concatenate buffers holding offsets into a single buffer of offsets,
 // also computing the ranges of values spanned by each buffer of offsets.
@@ -123,30 +197,44 @@ Status ConcatenateOffsets(const BufferVector& buffers, MemoryPool* pool,
                           std::vector<Range>* values_ranges) {
   values_ranges->resize(buffers.size());
 
-  // allocate output buffer
-  const int64_t out_size_in_bytes = SumBufferSizesInBytes(buffers);
-  ARROW_ASSIGN_OR_RAISE(*out, AllocateBuffer(sizeof(Offset) + out_size_in_bytes, pool));
-  auto* out_data = (*out)->mutable_data_as<Offset>();
-
-  int64_t elements_length = 0;
+  // Prefix pass: the offsets from buffers[i] are displaced by the cumulative length
+  // of values spanned by offsets in previous buffers
+  std::vector<int64_t> out_offsets(buffers.size() + 1, 0);
+  std::vector<Offset> displacements(buffers.size());
   Offset values_length = 0;
   for (size_t i = 0; i < buffers.size(); ++i) {
-    // the first offset from buffers[i] will be adjusted to values_length
-    // (the cumulative length of values spanned by offsets in previous buffers)
-    RETURN_NOT_OK(PutOffsets<Offset>(*buffers[i], values_length,
-                                     out_data + elements_length, &(*values_ranges)[i]));
-    elements_length += buffers[i]->size() / sizeof(Offset);
-    values_length += static_cast<Offset>((*values_ranges)[i].length);
+    Range* values_range = &(*values_ranges)[i];
+    RETURN_NOT_OK(GetValuesRange<Offset>(*buffers[i], values_length, values_range));
+    displacements[i] = values_length - static_cast<Offset>(values_range->offset);
+    out_offsets[i + 1] = out_offsets[i] + buffers[i]->size() / sizeof(Offset);
+    values_length += static_cast<Offset>(values_range->length);
   }
 
+  // allocate output buffer
+  ARROW_ASSIGN_OR_RAISE(*out,
+                        AllocateBuffer((out_offsets.back() + 1) * sizeof(Offset), pool));
+  auto* out_data = (*out)->mutable_data_as<Offset>();
+
+  RETURN_NOT_OK(CopyPieces(out_offsets, [&](int64_t i, int64_t in_offset,
+                                            int64_t out_offset, int64_t length) {
+    const Offset* src = buffers[i]->data_as<Offset>() + in_offset;
+    const Offset displacement = displacements[i];
+    // NOTE: Concatenate can be called during IPC reads to append delta dictionaries.
+    // Avoid UB on non-validated input by doing the addition in the unsigned domain.
+    // (the result can later be validated using Array::ValidateFull)
+    std::transform(src, src + length, out_data + out_offset,
+                   [displacement](Offset offset) {
+                     return SafeSignedAdd(offset, displacement);
+                   });
+  }));
+
   // the final element in out_data is the length of all values spanned by the offsets
-  out_data[out_size_in_bytes / sizeof(Offset)] = values_length;
+  out_data[out_offsets.back()] = values_length;
   return Status::OK();
 }
 
 template <typename Offset>
-Status PutOffsets(const Buffer& src, Offset first_offset, Offset* dst,
-                  Range* values_range) {
+Status GetValuesRange(const Buffer& src, Offset first_offset, Range* values_range) {
   if (src.size() == 0) {
     // It's allowed to have an empty offsets buffer for a 0-length array
     // (see Array::Validate)
@@ -165,16 +253,6 @@ Status PutOffsets(const Buffer& src, Offset first_offset, Offset* dst,
   if (first_offset > std::numeric_limits<Offset>::max() - values_range->length) {
     return Status::Invalid("offset overflow while concatenating arrays");
   }
-
-  // Write offsets into dst, ensuring that the first offset written is
-  // first_offset
-  auto displacement = first_offset - src_begin[0];
-  // NOTE: Concatenate can be called during IPC reads to append delta dictionaries.
-  // Avoid UB on non-validated input by doing the addition in the unsigned domain.
-  // (the result can later be validated using Array::ValidateFull)
-  std::transform(src_begin, src_end, dst, [displacement](Offset offset) {
-    return SafeSignedAdd(offset, displacement);
-  });
   return Status::OK();
 }
 
@@ -334,7 +412,7 @@ class ConcatenateImpl {
   Status Visit(const FixedWidthType& fixed) {
     // Handles numbers, decimal128, decimal256, fixed_size_binary
     ARROW_ASSIGN_OR_RAISE(auto buffers, Buffers(1, fixed));
-    return ConcatenateBuffers(buffers, pool_).Value(&out_->buffers[1]);
+    return ParallelConcatenateBuffers(buffers, pool_).Value(&out_->buffers[1]);
   }
 
   Status Visit(const BinaryType&) {
@@ -343,7 +421,7 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int32_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ParallelConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
   }
 
   Status Visit(const LargeBinaryType&) {
@@ -352,7 +430,7 @@ class ConcatenateImpl {
     RETURN_NOT_OK(ConcatenateOffsets<int64_t>(index_buffers, pool_, &out_->buffers[1],
                                               &value_ranges));
     ARROW_ASSIGN_OR_RAISE(auto value_buffers, Buffers(2, value_ranges));
-    return ConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
+    return ParallelConcatenateBuffers(value_buffers, pool_).Value(&out_->buffers[2]);
   }
 
   Status Visit(const BinaryViewType& type) {
@@ -365,7 +443,8 @@ class ConcatenateImpl {
     }
 
     ARROW_ASSIGN_OR_RAISE(auto view_buffers, Buffers(1, BinaryViewType::kSize));
-    ARROW_ASSIGN_OR_RAISE(auto view_buffer, ConcatenateBuffers(view_buffers, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto view_buffer,
+                          ParallelConcatenateBuffers(view_buffers, pool_));
 
     auto* views = view_buffer->mutable_data_as<BinaryViewType::c_type>();
     size_t preceding_buffer_count = 0;
@@ -436,7 +515,8 @@ class ConcatenateImpl {
 
     // Concatenate the sizes first
     ARROW_ASSIGN_OR_RAISE(auto size_buffers, Buffers(2, sizeof(offset_type)));
-    RETURN_NOT_OK(ConcatenateBuffers(size_buffers, pool_).Value(&out_->buffers[2]));
+    RETURN_NOT_OK(
+        ParallelConcatenateBuffers(size_buffers, pool_).Value(&out_->buffers[2]));
 
     // Concatenate the offsets
     ARROW_ASSIGN_OR_RAISE(auto offset_buffers, Buffers(1, sizeof(offset_type)));
@@ -542,7 +622,7 @@ class ConcatenateImpl {
     ARROW_ASSIGN_OR_RAISE(auto index_buffers, Buffers(1, *fixed));
     if (dictionaries_same) {
       out_->dictionary = in_[0]->dictionary;
-      return ConcatenateBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
+      return ParallelConcatenateBuffers(index_buffers, pool_).Value(&out_->buffers[1]);
     } else {
       ARROW_ASSIGN_OR_RAISE(auto index_lookup, UnifyDictionaries(d));
       ARROW_ASSIGN_OR_RAISE(out_->buffers[1],
@@ -557,7 +637,8 @@ class ConcatenateImpl {
 
     // Concatenate the type buffers.
     ARROW_ASSIGN_OR_RAISE(auto type_buffers, Buffers(1, sizeof(int8_t)));
-    RETURN_NOT_OK(ConcatenateBuffers(type_buffers, pool_).Value(&out_->buffers[1]));
+    RETURN_NOT_OK(
+        ParallelConcatenateBuffers(type_buffers, pool_).Value(&out_->buffers[1]));
 
     // Concatenate the child data. For sparse unions the child data is sliced
     // based on the offset and length of the array data. For dense unions the
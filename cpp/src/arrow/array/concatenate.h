@@ -27,6 +27,9 @@ namespace arrow {
 
 /// \brief Concatenate arrays
 ///
+/// Large outputs are copied in parallel on the CPU thread pool, unless called from
+/// one of its threads.
+///
 /// \param[in] arrays a vector of arrays to be concatenated
 /// \param[in] pool memory to store the result will be allocated from this memory pool
 /// \return the concatenated array
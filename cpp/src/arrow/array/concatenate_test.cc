@@ -661,6 +661,26 @@ TEST_F(ConcatenateTest, ExtensionType) {
   });
 }
 
+TEST_F(ConcatenateTest, LargeArrays) {
+  // Large enough for the copies to be split between tasks, with slices neither
+  // aligned on bytes nor on the task boundaries
+  constexpr int32_t kSize = (1 << 22) + 123;
+  const std::vector<int32_t> offsets = {3, 10, 1000003, 1000003, 3000001, kSize - 1,
+                                        kSize};
+  for (auto array : {rag.PrimitiveArray<Int32Type>(kSize, 0.1),
+                     rag.PrimitiveArray<BooleanType>(kSize, 0.5),
+                     rag.StringArray(kSize, 0.1), rag.LargeStringArray(kSize, 0.0)}) {
+    ARROW_SCOPED_TRACE(*array->type());
+    auto expected = array->Slice(offsets.front(), offsets.back() - offsets.front());
+    ASSERT_OK_AND_ASSIGN(auto actual, Concatenate(rag.Slices(array, offsets)));
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*expected, *actual);
+    if (actual->data()->buffers[0]) {
+      CheckTrailingBitsAreZeroed(actual->data()->buffers[0], actual->length());
+    }
+  }
+}
+
 TEST_F(ConcatenateTest, OffsetOverflow) {
   auto fake_long = ArrayFromJSON(utf8(), "[\"\"]");
   fake_long->data()->GetMutableValues<int32_t>(1)[1] =
@@ -39,6 +39,7 @@
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/byte_swap_internal.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/endian.h"
@@ -80,10 +81,12 @@ class ArrayDataWrapper {
 
 class ArrayDataEndianSwapper {
  public:
-  explicit ArrayDataEndianSwapper(const std::shared_ptr<ArrayData>& data,
-                                  MemoryPool* pool)
-      : data_(data), pool_(pool) {
-    out_ = data->Copy();
+  // If `in_place` is true, the caller owns `data`, and the buffers owned by `data`
+  // alone are swapped in place instead of being copied
+  ArrayDataEndianSwapper(const std::shared_ptr<ArrayData>& data, MemoryPool* pool,
+                         bool in_place)
+      : data_(data), pool_(pool), in_place_(in_place) {
+    out_ = in_place ? data : data->Copy();
   }
 
   // WARNING: this facility can be called on invalid Array data by the IPC reader.
@@ -104,28 +107,51 @@ class ArrayDataEndianSwapper {
 
   Status SwapChildren(const FieldVector& child_fields) {
     for (size_t i = 0; i < child_fields.size(); i++) {
-      ARROW_ASSIGN_OR_RAISE(out_->child_data[i],
-                            internal::SwapEndianArrayData(data_->child_data[i], pool_));
+      if (in_place_) {
+        ARROW_ASSIGN_OR_RAISE(out_->child_data[i],
+                              internal::SwapEndianArrayData(
+                                  std::move(out_->child_data[i]), pool_));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            out_->child_data[i],
+            internal::SwapEndianArrayData(data_->child_data[i], pool_));
+      }
     }
     return Status::OK();
   }
 
+  bool CanSwapInPlace(const std::shared_ptr<Buffer>& buffer) const {
+    // A slice may overlap other buffers of its parent
+    return in_place_ && buffer.use_count() == 1 && buffer->is_mutable() &&
+           buffer->is_cpu() && buffer->parent() == nullptr;
+  }
+
+  // Swap the values of `kWidth` bytes of a buffer with `swap_values`
+  template <int kWidth>
+  Result<std::shared_ptr<Buffer>> SwapBuffer(
+      const std::shared_ptr<Buffer>& in_buffer,
+      void (*swap_values)(const uint8_t*, int64_t, uint8_t*)) {
+    // NOTE: data_->length not trusted (see warning above)
+    const int64_t length = in_buffer->size() / kWidth;
+    if (CanSwapInPlace(in_buffer)) {
+      swap_values(in_buffer->data(), length, in_buffer->mutable_data());
+      return in_buffer;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto out_buffer, AllocateBuffer(in_buffer->size(), pool_));
+    swap_values(in_buffer->data(), length, out_buffer->mutable_data());
+    return std::move(out_buffer);
+  }
+
   template <typename T>
   Result<std::shared_ptr<Buffer>> ByteSwapBuffer(
       const std::shared_ptr<Buffer>& in_buffer) {
-    if (sizeof(T) == 1) {
+    if constexpr (sizeof(T) == 1) {
       // if data size is 1, element is not swapped. We can use the original buffer
       return in_buffer;
+    } else {
+      return SwapBuffer<sizeof(T)>(in_buffer,
+                                   &util::internal::ByteSwapValues<sizeof(T)>);
     }
-    auto in_data = reinterpret_cast<const T*>(in_buffer->data());
-    ARROW_ASSIGN_OR_RAISE(auto out_buffer, AllocateBuffer(in_buffer->size(), pool_));
-    auto out_data = reinterpret_cast<T*>(out_buffer->mutable_data());
-    // NOTE: data_->length not trusted (see warning above)
-    int64_t length = in_buffer->size() / sizeof(T);
-    for (int64_t i = 0; i < length; i++) {
-      out_data[i] = bit_util::ByteSwap(in_data[i]);
-    }
-    return std::move(out_buffer);
   }
 
   template <typename VALUE_TYPE>
@@ -152,57 +178,16 @@ class ArrayDataEndianSwapper {
   }
 
   Status Visit(const Decimal128Type& type) {
-    auto data = reinterpret_cast<const uint64_t*>(data_->buffers[1]->data());
-    ARROW_ASSIGN_OR_RAISE(auto new_buffer,
-                          AllocateBuffer(data_->buffers[1]->size(), pool_));
-    auto new_data = reinterpret_cast<uint64_t*>(new_buffer->mutable_data());
-    // NOTE: data_->length not trusted (see warning above)
-    const int64_t length = data_->buffers[1]->size() / Decimal128Type::kByteWidth;
-    for (int64_t i = 0; i < length; i++) {
-      uint64_t tmp;
-      auto idx = i * 2;
-#if ARROW_LITTLE_ENDIAN
-      tmp = bit_util::FromBigEndian(data[idx]);
-      new_data[idx] = bit_util::FromBigEndian(data[idx + 1]);
-      new_data[idx + 1] = tmp;
-#else
-      tmp = bit_util::FromLittleEndian(data[idx]);
-      new_data[idx] = bit_util::FromLittleEndian(data[idx + 1]);
-      new_data[idx + 1] = tmp;
-#endif
-    }
-    out_->buffers[1] = std::move(new_buffer);
+    // Reversing all the bytes also swaps the two 64-bit words
+    ARROW_ASSIGN_OR_RAISE(out_->buffers[1],
+                          ByteSwapBuffer<Decimal128>(data_->buffers[1]));
     return Status::OK();
   }
 
   Status Visit(const Decimal256Type& type) {
-    auto data = reinterpret_cast<const uint64_t*>(data_->buffers[1]->data());
-    ARROW_ASSIGN_OR_RAISE(auto new_buffer, AllocateBuffer(data_->buffers[1]->size()));
-    auto new_data = reinterpret_cast<uint64_t*>(new_buffer->mutable_data());
-    // NOTE: data_->length not trusted (see warning above)
-    const int64_t length = data_->buffers[1]->size() / Decimal256Type::kByteWidth;
-    for (int64_t i = 0; i < length; i++) {
-      uint64_t tmp0, tmp1, tmp2;
-      auto idx = i * 4;
-#if ARROW_LITTLE_ENDIAN
-      tmp0 = bit_util::FromBigEndian(data[idx]);
-      tmp1 = bit_util::FromBigEndian(data[idx + 1]);
-      tmp2 = bit_util::FromBigEndian(data[idx + 2]);
-      new_data[idx] = bit_util::FromBigEndian(data[idx + 3]);
-      new_data[idx + 1] = tmp2;
-      new_data[idx + 2] = tmp1;
-      new_data[idx + 3] = tmp0;
-#else
-      tmp0 = bit_util::FromLittleEndian(data[idx]);
-      tmp1 = bit_util::FromLittleEndian(data[idx + 1]);
-      tmp2 = bit_util::FromLittleEndian(data[idx + 2]);
-      new_data[idx] = bit_util::FromLittleEndian(data[idx + 3]);
-      new_data[idx + 1] = tmp2;
-      new_data[idx + 2] = tmp1;
-      new_data[idx + 3] = tmp0;
-#endif
-    }
-    out_->buffers[1] = std::move(new_buffer);
+    // Reversing all the bytes also reverses the order of the four 64-bit words
+    ARROW_ASSIGN_OR_RAISE(out_->buffers[1],
+                          ByteSwapBuffer<Decimal256>(data_->buffers[1]));
     return Status::OK();
   }
 
@@ -213,26 +198,10 @@ class ArrayDataEndianSwapper {
 
   Status Visit(const MonthDayNanoIntervalType& type) {
     using MonthDayNanos = MonthDayNanoIntervalType::MonthDayNanos;
-    auto data = reinterpret_cast<const MonthDayNanos*>(data_->buffers[1]->data());
-    ARROW_ASSIGN_OR_RAISE(auto new_buffer,
-                          AllocateBuffer(data_->buffers[1]->size(), pool_));
-    auto new_data = reinterpret_cast<MonthDayNanos*>(new_buffer->mutable_data());
-    // NOTE: data_->length not trusted (see warning above)
-    const int64_t length = data_->buffers[1]->size() / sizeof(MonthDayNanos);
-    for (int64_t i = 0; i < length; i++) {
-      MonthDayNanos tmp = data[i];
-#if ARROW_LITTLE_ENDIAN
-      tmp.months = bit_util::FromBigEndian(tmp.months);
-      tmp.days = bit_util::FromBigEndian(tmp.days);
-      tmp.nanoseconds = bit_util::FromBigEndian(tmp.nanoseconds);
-#else
-      tmp.months = bit_util::FromLittleEndian(tmp.months);
-      tmp.days = bit_util::FromLittleEndian(tmp.days);
-      tmp.nanoseconds = bit_util::FromLittleEndian(tmp.nanoseconds);
-#endif
-      new_data[i] = tmp;
-    }
-    out_->buffers[1] = std::move(new_buffer);
+    static_assert(sizeof(MonthDayNanos) == 16);
+    ARROW_ASSIGN_OR_RAISE(out_->buffers[1],
+                          SwapBuffer<sizeof(MonthDayNanos)>(
+                              data_->buffers[1], &util::internal::ByteSwapMonthDayNanos));
     return Status::OK();
   }
 
@@ -313,6 +282,7 @@ class ArrayDataEndianSwapper {
 
   const std::shared_ptr<ArrayData>& data_;
   MemoryPool* pool_;
+  const bool in_place_;
   std::shared_ptr<ArrayData> out_;
 };
 
@@ -325,11 +295,25 @@ Result<std::shared_ptr<ArrayData>> SwapEndianArrayData(
   if (data->offset != 0) {
     return Status::Invalid("Unsupported data format: data.offset != 0");
   }
-  ArrayDataEndianSwapper swapper(data, pool);
+  ArrayDataEndianSwapper swapper(data, pool, /*in_place=*/false);
   RETURN_NOT_OK(swapper.SwapType(*data->type));
   return std::move(swapper.out_);
 }
 
+Result<std::shared_ptr<ArrayData>> SwapEndianArrayData(std::shared_ptr<ArrayData>&& data,
+                                                       MemoryPool* pool) {
+  std::shared_ptr<ArrayData> owned_data = std::move(data);
+  if (owned_data.use_count() != 1) {
+    return SwapEndianArrayData(owned_data, pool);
+  }
+  if (owned_data->offset != 0) {
+    return Status::Invalid("Unsupported data format: data.offset != 0");
+  }
+  ArrayDataEndianSwapper swapper(owned_data, pool, /*in_place=*/true);
+  RETURN_NOT_OK(swapper.SwapType(*owned_data->type));
+  return std::move(swapper.out_);
+}
+
 }  // namespace internal
 
 std::shared_ptr<Array> MakeArray(const std::shared_ptr<ArrayData>& data) {
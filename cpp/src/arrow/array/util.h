@@ -85,6 +85,15 @@ ARROW_EXPORT
 Result<std::shared_ptr<ArrayData>> SwapEndianArrayData(
     const std::shared_ptr<ArrayData>& data, MemoryPool* pool = default_memory_pool());
 
+/// \brief Swap endian of each element in a generic ArrayData, in place if possible
+///
+/// Like SwapEndianArrayData above, but if the caller held the last reference to
+/// `data`, the mutable CPU buffers which `data` alone references are swapped in
+/// place instead of being copied.
+ARROW_EXPORT
+Result<std::shared_ptr<ArrayData>> SwapEndianArrayData(
+    std::shared_ptr<ArrayData>&& data, MemoryPool* pool = default_memory_pool());
+
 /// Given a number of ArrayVectors, treat each ArrayVector as the
 /// chunks of a chunked array.  Then rechunk each ArrayVector such that
 /// all ArrayVectors are chunked identically.  It is mandatory that
@@ -150,6 +150,25 @@ static void BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const ref
   state.SetItemsProcessed(state.iterations() * kItemsProcessed);
 }
 
+static void BuildBinaryArrayWithHint(
+    benchmark::State& state) {  // NOLINT non-const reference
+  for (auto _ : state) {
+    BinaryBuilder builder(memory_tracker.memory_pool());
+    ABORT_NOT_OK(builder.ReserveHint(kRounds * kNumberOfElements,
+                                     kRounds * kNumberOfElements * kBinaryView.size()));
+
+    for (int64_t i = 0; i < kRounds * kNumberOfElements; i++) {
+      ABORT_NOT_OK(builder.Append(kBinaryView));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  state.SetItemsProcessed(state.iterations() * kItemsProcessed);
+}
+
 static void BuildChunkedBinaryArray(
     benchmark::State& state) {  // NOLINT non-const reference
   // 1MB chunks
@@ -455,6 +474,7 @@ BENCHMARK(BuildAdaptiveIntNoNulls);
 BENCHMARK(BuildAdaptiveIntNoNullsScalarAppend);
 
 BENCHMARK(BuildBinaryArray);
+BENCHMARK(BuildBinaryArrayWithHint);
 BENCHMARK(BuildChunkedBinaryArray);
 BENCHMARK(BuildFixedSizeBinaryArray);
 BENCHMARK(BuildDecimalArray);
@@ -228,6 +228,103 @@ struct ArrowDeviceArrayStream {
 
 #endif  // ARROW_C_DEVICE_STREAM_INTERFACE
 
+#ifndef ARROW_C_ASYNC_STREAM_INTERFACE
+#define ARROW_C_ASYNC_STREAM_INTERFACE
+
+// EXPERIMENTAL: a unit of data made available by an asynchronous producer
+// through ArrowAsyncDeviceStreamHandler.on_next_task.
+//
+// The data isn't materialized until the consumer calls extract_data, which
+// lets the consumer choose the thread on which any producer-side work (such as
+// decoding) happens.
+struct ArrowAsyncTask {
+  // Callback to populate the ArrowDeviceArray of this task. It must be called
+  // exactly once, and must not block on I/O. Ownership of the array is passed
+  // to the caller, which must release it independently. Any resources of the
+  // task are released by this call, whether it succeeds or not.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise.
+  int (*extract_data)(struct ArrowAsyncTask* self, struct ArrowDeviceArray* out);
+
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+// EXPERIMENTAL: the producer side of an asynchronous stream, owned by the
+// producer, through which the consumer applies backpressure.
+struct ArrowAsyncProducer {
+  // The device that this stream produces data on.
+  ArrowDeviceType device_type;
+
+  // Callback to request n more tasks (n > 0). The producer must not call
+  // on_next_task more times than requested in total. This may be called from
+  // within the handler callbacks, so the producer must not call on_next_task
+  // from within this call; it schedules it for later instead.
+  //
+  // Calls after `cancel` are no-ops. Errors are reported through on_error.
+  void (*request)(struct ArrowAsyncProducer* self, int64_t n);
+
+  // Callback to ask the producer to eventually stop calling on_next_task and
+  // release the handler. It must be idempotent and thread-safe. The consumer
+  // must be prepared to receive tasks that were already requested.
+  void (*cancel)(struct ArrowAsyncProducer* self);
+
+  // Optional metadata about the stream (such as the total number of rows),
+  // encoded like ArrowSchema metadata, or NULL. Valid until the handler is
+  // released.
+  const char* additional_metadata;
+
+  // Opaque producer-specific data
+  void* private_data;
+};
+
+// EXPERIMENTAL: the asynchronous counterpart of ArrowDeviceArrayStream.
+//
+// The handler is created by the consumer and passed to the producer, which
+// pushes data to it by calling its callbacks. The producer must not call the
+// callbacks concurrently.
+struct ArrowAsyncDeviceStreamHandler {
+  // Callback to receive the stream schema, which the handler takes ownership
+  // of. Unless on_error is called first, this is the first callback and is
+  // called exactly once, after `producer` is populated. No data is produced
+  // until the consumer calls producer->request.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise,
+  // in which case the producer stops producing and releases the handler.
+  int (*on_schema)(struct ArrowAsyncDeviceStreamHandler* self,
+                   struct ArrowSchema* stream_schema);
+
+  // Callback to receive the next task, or NULL at the end of the stream. The
+  // task struct is only valid during the call: a consumer extracting it later
+  // must move its contents. The metadata, if not NULL, is only valid during
+  // the call too.
+  //
+  // Return value: 0 if successful, an `errno`-compatible error code otherwise,
+  // in which case the producer stops producing and releases the handler.
+  int (*on_next_task)(struct ArrowAsyncDeviceStreamHandler* self,
+                      struct ArrowAsyncTask* task, const char* metadata);
+
+  // Callback to receive an error, after which the producer releases the
+  // handler. The message and metadata, if not NULL, are only valid during the
+  // call. This must not call back into the producer.
+  void (*on_error)(struct ArrowAsyncDeviceStreamHandler* self, int code,
+                   const char* message, const char* metadata);
+
+  // Release callback: release the handler's own resources. The producer
+  // always calls it when done with the handler, and calls nothing afterwards.
+  // This must not call back into the producer.
+  void (*release)(struct ArrowAsyncDeviceStreamHandler* self);
+
+  // The producer of the stream, populated by the producer before calling any
+  // callback other than release, and valid until release is called.
+  struct ArrowAsyncProducer* producer;
+
+  // Opaque consumer-specific data
+  void* private_data;
+};
+
+#endif  // ARROW_C_ASYNC_STREAM_INTERFACE
+
 #ifdef __cplusplus
 }
 #endif
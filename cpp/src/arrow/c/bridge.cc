@@ -20,7 +20,9 @@
 #include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -39,12 +41,15 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/range.h"
 #include "arrow/util/small_vector.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/value_parsing.h"
 #include "arrow/visit_type_inline.h"
 
@@ -2013,6 +2018,144 @@ Result<std::shared_ptr<RecordBatch>> ImportDeviceRecordBatch(
   return ImportDeviceRecordBatch(array, *maybe_schema, mapper);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Record batch importer
+
+namespace {
+
+int64_t EncodedMetadataSize(const char* metadata) {
+  if (metadata == nullptr) {
+    return 0;
+  }
+  auto read_int32 = [&](int64_t offset) {
+    int32_t value;
+    std::memcpy(&value, metadata + offset, sizeof(value));
+    return value;
+  };
+  const int32_t npairs = read_int32(0);
+  int64_t size = sizeof(int32_t);
+  for (int32_t i = 0; i < 2 * std::max(npairs, 0); ++i) {
+    size += sizeof(int32_t) + std::max(read_int32(size), 0);
+  }
+  return size;
+}
+
+}  // namespace
+
+// A copy of the strings and flags of an ArrowSchema, to tell whether another
+// ArrowSchema describes the same schema without importing it
+struct RecordBatchImporter::CachedSchema {
+  explicit CachedSchema(const struct ArrowSchema& schema)
+      : format(schema.format),
+        name(schema.name ? schema.name : ""),
+        metadata(schema.metadata ? schema.metadata : "",
+                 EncodedMetadataSize(schema.metadata)),
+        flags(schema.flags) {
+    children.reserve(schema.n_children);
+    for (int64_t i = 0; i < schema.n_children; ++i) {
+      children.emplace_back(*schema.children[i]);
+    }
+    if (schema.dictionary != nullptr) {
+      dictionary = std::make_unique<CachedSchema>(*schema.dictionary);
+    }
+  }
+
+  bool Equals(const struct ArrowSchema& schema) const {
+    if (schema.flags != flags ||
+        schema.n_children != static_cast<int64_t>(children.size()) ||
+        (schema.dictionary != nullptr) != (dictionary != nullptr) ||
+        std::strcmp(schema.format, format.c_str()) != 0 ||
+        std::strcmp(schema.name ? schema.name : "", name.c_str()) != 0) {
+      return false;
+    }
+    const int64_t metadata_size = EncodedMetadataSize(schema.metadata);
+    if (metadata_size != static_cast<int64_t>(metadata.size()) ||
+        (metadata_size > 0 &&
+         std::memcmp(schema.metadata, metadata.data(), metadata_size) != 0)) {
+      return false;
+    }
+    for (int64_t i = 0; i < schema.n_children; ++i) {
+      if (!children[i].Equals(*schema.children[i])) {
+        return false;
+      }
+    }
+    return dictionary == nullptr || dictionary->Equals(*schema.dictionary);
+  }
+
+  std::string format;
+  std::string name;
+  std::string metadata;
+  int64_t flags;
+  std::vector<CachedSchema> children;
+  std::unique_ptr<CachedSchema> dictionary;
+};
+
+RecordBatchImporter::RecordBatchImporter() = default;
+
+RecordBatchImporter::RecordBatchImporter(std::shared_ptr<Schema> schema)
+    : schema_(std::move(schema)), type_(struct_(schema_->fields())) {}
+
+RecordBatchImporter::~RecordBatchImporter() = default;
+RecordBatchImporter::RecordBatchImporter(RecordBatchImporter&&) noexcept = default;
+RecordBatchImporter& RecordBatchImporter::operator=(RecordBatchImporter&&) noexcept =
+    default;
+
+Status RecordBatchImporter::UpdateSchema(struct ArrowSchema* schema) {
+  if (cached_schema_ != nullptr && cached_schema_->Equals(*schema)) {
+    ArrowSchemaRelease(schema);
+    return Status::OK();
+  }
+  auto cached_schema = std::make_unique<CachedSchema>(*schema);
+  cached_schema_.reset();
+  ARROW_ASSIGN_OR_RAISE(schema_, ImportSchema(schema));
+  type_ = struct_(schema_->fields());
+  cached_schema_ = std::move(cached_schema);
+  return Status::OK();
+}
+
+Result<std::shared_ptr<RecordBatch>> RecordBatchImporter::Import(
+    struct ArrowArray* array) const {
+  if (schema_ == nullptr) {
+    ArrowArrayRelease(array);
+    return Status::Invalid("Cannot import a record batch without a schema");
+  }
+  ArrayImporter importer(type_);
+  RETURN_NOT_OK(importer.Import(array));
+  return importer.MakeRecordBatch(schema_);
+}
+
+Result<std::shared_ptr<RecordBatch>> RecordBatchImporter::Import(
+    struct ArrowArray* array, struct ArrowSchema* schema) {
+  Status status = UpdateSchema(schema);
+  if (!status.ok()) {
+    ArrowArrayRelease(array);
+    return status;
+  }
+  return Import(array);
+}
+
+Result<std::shared_ptr<RecordBatch>> RecordBatchImporter::ImportDevice(
+    struct ArrowDeviceArray* array, const DeviceMemoryMapper& mapper) const {
+  if (schema_ == nullptr) {
+    ArrowArrayRelease(&array->array);
+    return Status::Invalid("Cannot import a record batch without a schema");
+  }
+  ArrayImporter importer(type_);
+  RETURN_NOT_OK(importer.Import(array, mapper));
+  return importer.MakeRecordBatch(schema_);
+}
+
+Result<std::shared_ptr<RecordBatch>> RecordBatchImporter::ImportDevice(
+    struct ArrowDeviceArray* array, struct ArrowSchema* schema,
+    const DeviceMemoryMapper& mapper) {
+  Status status = UpdateSchema(schema);
+  if (!status.ok()) {
+    ArrowArrayRelease(&array->array);
+    return status;
+  }
+  return ImportDevice(array, mapper);
+}
+
 //////////////////////////////////////////////////////////////////////////
 // C stream export
 
@@ -2260,11 +2403,12 @@ class ArrayStreamBatchReader : public RecordBatchReader, public ArrayStreamReade
       : ArrayStreamReader(stream) {}
 
   Status Init() {
-    ARROW_ASSIGN_OR_RAISE(schema_, ReadSchema());
+    ARROW_ASSIGN_OR_RAISE(auto schema, ReadSchema());
+    importer_ = RecordBatchImporter(std::move(schema));
     return Status::OK();
   }
 
-  std::shared_ptr<Schema> schema() const override { return schema_; }
+  std::shared_ptr<Schema> schema() const override { return importer_.schema(); }
 
   Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
     ARROW_RETURN_NOT_OK(CheckNotReleased());
@@ -2277,7 +2421,7 @@ class ArrayStreamBatchReader : public RecordBatchReader, public ArrayStreamReade
       batch->reset();
       return Status::OK();
     } else {
-      return ImportRecordBatch(&c_array, schema_).Value(batch);
+      return importer_.Import(&c_array).Value(batch);
     }
   }
 
@@ -2287,7 +2431,7 @@ class ArrayStreamBatchReader : public RecordBatchReader, public ArrayStreamReade
   }
 
  private:
-  std::shared_ptr<Schema> schema_;
+  RecordBatchImporter importer_;
 };
 
 class ArrayStreamArrayReader : public ArrayStreamReader {
@@ -2360,4 +2504,476 @@ Result<std::shared_ptr<ChunkedArray>> ImportChunkedArray(
   return ChunkedArray::Make(std::move(chunks), std::move(data_type));
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Async C stream
+
+namespace {
+
+int ErrnoFromStatus(const Status& status) {
+  switch (status.code()) {
+    case StatusCode::OK:
+      return 0;
+    case StatusCode::IOError:
+      return EIO;
+    case StatusCode::NotImplemented:
+      return ENOSYS;
+    case StatusCode::OutOfMemory:
+      return ENOMEM;
+    default:
+      return EINVAL;
+  }
+}
+
+Status StatusFromErrno(int errno_like, const char* message) {
+  std::string msg = message ? std::string(message)
+                            : "Async C stream error " + ToChars(errno_like);
+  switch (errno_like) {
+    case EDOM:
+    case EINVAL:
+    case ERANGE:
+      return Status::Invalid(std::move(msg));
+    case ENOMEM:
+      return Status::OutOfMemory(std::move(msg));
+    case ENOSYS:
+      return Status::NotImplemented(std::move(msg));
+    default:
+      return Status::IOError(std::move(msg));
+  }
+}
+
+// The consumer side of an async C stream, behind the handler's private data
+class AsyncStreamConsumer : public std::enable_shared_from_this<AsyncStreamConsumer> {
+ public:
+  using BatchFuture = Future<std::shared_ptr<RecordBatch>>;
+
+  AsyncStreamConsumer(internal::Executor* executor, uint64_t queue_size,
+                      DeviceMemoryMapper mapper)
+      : executor_(executor),
+        queue_size_(std::max<uint64_t>(queue_size, 1)),
+        mapper_(std::move(mapper)),
+        schema_future_(Future<AsyncRecordBatchGenerator>::Make()) {}
+
+  ~AsyncStreamConsumer() {
+    // Release the data of the tasks that weren't consumed
+    for (auto& task : tasks_) {
+      struct ArrowDeviceArray c_array;
+      if (task.extract_data(&task, &c_array) == 0) {
+        ArrowArrayRelease(&c_array.array);
+      }
+    }
+  }
+
+  static Future<AsyncRecordBatchGenerator> Make(
+      struct ArrowAsyncDeviceStreamHandler* handler, internal::Executor* executor,
+      uint64_t queue_size, DeviceMemoryMapper mapper) {
+    auto consumer =
+        std::make_shared<AsyncStreamConsumer>(executor, queue_size, std::move(mapper));
+    auto schema_future = consumer->schema_future_;
+    handler->on_schema = StaticOnSchema;
+    handler->on_next_task = StaticOnNextTask;
+    handler->on_error = StaticOnError;
+    handler->release = StaticRelease;
+    handler->producer = nullptr;
+    handler->private_data = new std::shared_ptr<AsyncStreamConsumer>(std::move(consumer));
+    return schema_future;
+  }
+
+ private:
+  int OnSchema(struct ArrowAsyncProducer* producer, struct ArrowSchema* c_schema) {
+    auto maybe_schema = ImportSchema(c_schema);
+    if (!maybe_schema.ok()) {
+      EndStream(maybe_schema.status());
+      return ErrnoFromStatus(maybe_schema.status());
+    }
+    importer_ = std::make_shared<RecordBatchImporter>(*std::move(maybe_schema));
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      producer_ = producer;
+    }
+    FinishSchema(AsyncRecordBatchGenerator{
+        importer_->schema(), static_cast<DeviceAllocationType>(producer->device_type),
+        [self = shared_from_this()]() { return self->Next(); }});
+    producer->request(producer, static_cast<int64_t>(queue_size_));
+    return 0;
+  }
+
+  int OnNextTask(struct ArrowAsyncTask* task) {
+    if (task == nullptr) {
+      EndStream(Status::OK());
+      return 0;
+    }
+    BatchFuture waiter;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (waiters_.empty()) {
+        tasks_.push_back(*task);
+        return 0;
+      }
+      waiter = std::move(waiters_.front());
+      waiters_.pop_front();
+    }
+    RequestOne();
+    ExtractTask(*task).AddCallback(
+        [waiter](const Result<std::shared_ptr<RecordBatch>>& batch) mutable {
+          waiter.MarkFinished(batch);
+        });
+    return 0;
+  }
+
+  void OnError(int code, const char* message) {
+    EndStream(StatusFromErrno(code, message));
+  }
+
+  void Release() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      producer_ = nullptr;
+    }
+    EndStream(Status::Invalid("Async C stream released before its end"));
+  }
+
+  BatchFuture Next() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!tasks_.empty()) {
+      struct ArrowAsyncTask task = tasks_.front();
+      tasks_.pop_front();
+      lock.unlock();
+      RequestOne();
+      return ExtractTask(task);
+    }
+    if (finished_) {
+      if (!end_status_.ok()) {
+        return end_status_;
+      }
+      return BatchFuture::MakeFinished(IterationEnd<std::shared_ptr<RecordBatch>>());
+    }
+    auto waiter = BatchFuture::Make();
+    waiters_.push_back(waiter);
+    return waiter;
+  }
+
+  // Keep queue_size_ batches requested ahead of the consumer
+  void RequestOne() {
+    // The lock keeps the producer from releasing the handler meanwhile. This
+    // doesn't deadlock since the producer doesn't call the handler from request.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!finished_ && producer_ != nullptr) {
+      producer_->request(producer_, 1);
+    }
+  }
+
+  BatchFuture ExtractTask(struct ArrowAsyncTask task) {
+    auto extract = [task, importer = importer_,
+                    mapper = mapper_]() mutable -> Result<std::shared_ptr<RecordBatch>> {
+      struct ArrowDeviceArray c_array;
+      const int code = task.extract_data(&task, &c_array);
+      if (code != 0) {
+        return StatusFromErrno(code, "Could not extract the data of an async C task");
+      }
+      return importer->ImportDevice(&c_array, mapper);
+    };
+    if (executor_ == nullptr) {
+      return BatchFuture::MakeFinished(extract());
+    }
+    return DeferNotOk(executor_->Submit(std::move(extract)));
+  }
+
+  void EndStream(const Status& status) {
+    std::deque<BatchFuture> waiters;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (finished_) {
+        return;
+      }
+      finished_ = true;
+      end_status_ = status;
+      waiters.swap(waiters_);
+    }
+    for (auto& waiter : waiters) {
+      if (status.ok()) {
+        waiter.MarkFinished(IterationEnd<std::shared_ptr<RecordBatch>>());
+      } else {
+        waiter.MarkFinished(status);
+      }
+    }
+    if (schema_future_.is_valid()) {
+      FinishSchema(status.ok() ? Status::Invalid("Async C stream ended before its schema")
+                               : status);
+    }
+  }
+
+  void FinishSchema(Result<AsyncRecordBatchGenerator> generator) {
+    // Don't keep the generator, which refers to this
+    auto schema_future = std::move(schema_future_);
+    schema_future_ = {};
+    schema_future.MarkFinished(std::move(generator));
+  }
+
+  // C-compatible callbacks
+
+  static AsyncStreamConsumer* FromHandler(struct ArrowAsyncDeviceStreamHandler* handler) {
+    return reinterpret_cast<std::shared_ptr<AsyncStreamConsumer>*>(handler->private_data)
+        ->get();
+  }
+
+  static int StaticOnSchema(struct ArrowAsyncDeviceStreamHandler* handler,
+                            struct ArrowSchema* c_schema) {
+    return FromHandler(handler)->OnSchema(handler->producer, c_schema);
+  }
+
+  static int StaticOnNextTask(struct ArrowAsyncDeviceStreamHandler* handler,
+                              struct ArrowAsyncTask* task, const char* metadata) {
+    return FromHandler(handler)->OnNextTask(task);
+  }
+
+  static void StaticOnError(struct ArrowAsyncDeviceStreamHandler* handler, int code,
+                            const char* message, const char* metadata) {
+    FromHandler(handler)->OnError(code, message);
+  }
+
+  static void StaticRelease(struct ArrowAsyncDeviceStreamHandler* handler) {
+    if (handler->release == nullptr) {
+      return;
+    }
+    auto* consumer =
+        reinterpret_cast<std::shared_ptr<AsyncStreamConsumer>*>(handler->private_data);
+    (*consumer)->Release();
+    delete consumer;
+    handler->release = nullptr;
+    handler->private_data = nullptr;
+  }
+
+  internal::Executor* executor_;
+  const uint64_t queue_size_;
+  const DeviceMemoryMapper mapper_;
+  Future<AsyncRecordBatchGenerator> schema_future_;
+  std::shared_ptr<const RecordBatchImporter> importer_;
+
+  std::mutex mutex_;
+  struct ArrowAsyncProducer* producer_ = nullptr;
+  // Tasks received before the consumer asked for them
+  std::deque<struct ArrowAsyncTask> tasks_;
+  // Consumer requests made before the tasks were received
+  std::deque<BatchFuture> waiters_;
+  bool finished_ = false;
+  Status end_status_;
+};
+
+// The producer side of an async C stream, pulling batches from a generator
+class AsyncStreamProducer : public std::enable_shared_from_this<AsyncStreamProducer> {
+ public:
+  AsyncStreamProducer(AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+                      DeviceAllocationType device_type,
+                      struct ArrowAsyncDeviceStreamHandler* handler,
+                      internal::Executor* executor)
+      : generator_(std::move(generator)),
+        handler_(handler),
+        executor_(executor),
+        finished_(Future<>::Make()) {
+    producer_.device_type = static_cast<ArrowDeviceType>(device_type);
+    producer_.request = StaticRequest;
+    producer_.cancel = StaticCancel;
+    producer_.additional_metadata = nullptr;
+    producer_.private_data = this;
+  }
+
+  Future<> Start(const Schema& schema) {
+    // Keep this alive until the handler is released
+    self_ = shared_from_this();
+    auto finished = finished_;
+    handler_->producer = &producer_;
+
+    struct ArrowSchema c_schema;
+    Status status = ExportSchema(schema, &c_schema);
+    if (!status.ok()) {
+      Fail(status);
+      return finished;
+    }
+    const int code = handler_->on_schema(handler_, &c_schema);
+    if (code != 0) {
+      ReleaseHandler(
+          StatusFromErrno(code, "Async C stream consumer rejected the schema"));
+    }
+    return finished;
+  }
+
+ private:
+  void Request(int64_t n) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cancelled_ || !error_.ok()) {
+        return;
+      }
+      if (n <= 0) {
+        error_ = Status::Invalid("Async C stream request count must be positive, got ",
+                                 n);
+      } else {
+        requested_ += n;
+      }
+      if (pumping_) {
+        return;
+      }
+      pumping_ = true;
+    }
+    // The consumer may call this from its callbacks, which therefore can't be
+    // called synchronously
+    Schedule();
+  }
+
+  void Cancel() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (cancelled_) {
+        return;
+      }
+      cancelled_ = true;
+      if (pumping_) {
+        return;
+      }
+      pumping_ = true;
+    }
+    Schedule();
+  }
+
+  void Schedule() {
+    Status status = executor_->Spawn([self = shared_from_this()]() { self->Pump(); });
+    if (!status.ok()) {
+      Fail(status);
+    }
+  }
+
+  // Push batches to the consumer while it has requested some
+  void Pump() {
+    while (true) {
+      Status error;
+      bool cancelled;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error = error_;
+        cancelled = cancelled_;
+        if (error.ok() && !cancelled) {
+          if (requested_ == 0) {
+            pumping_ = false;
+            return;
+          }
+          --requested_;
+        }
+      }
+      if (!error.ok()) {
+        Fail(error);
+        return;
+      }
+      if (cancelled) {
+        ReleaseHandler(Status::OK());
+        return;
+      }
+      auto next = generator_();
+      if (!next.is_finished()) {
+        next.AddCallback([self = shared_from_this()](
+                             const Result<std::shared_ptr<RecordBatch>>& batch) {
+          if (self->Deliver(batch)) {
+            self->Pump();
+          }
+        });
+        return;
+      }
+      if (!Deliver(next.result())) {
+        return;
+      }
+    }
+  }
+
+  // Return whether the stream goes on
+  bool Deliver(const Result<std::shared_ptr<RecordBatch>>& maybe_batch) {
+    if (!maybe_batch.ok()) {
+      Fail(maybe_batch.status());
+      return false;
+    }
+    const auto& batch = *maybe_batch;
+    if (IsIterationEnd(batch)) {
+      const int code = handler_->on_next_task(handler_, nullptr, nullptr);
+      ReleaseHandler(code == 0 ? Status::OK()
+                               : StatusFromErrno(code, "Async C stream consumer failed"));
+      return false;
+    }
+    struct ArrowAsyncTask task;
+    task.extract_data = ExtractBatch;
+    task.private_data = new std::shared_ptr<RecordBatch>(batch);
+    const int code = handler_->on_next_task(handler_, &task, nullptr);
+    if (code != 0) {
+      ReleaseHandler(StatusFromErrno(code, "Async C stream consumer failed"));
+      return false;
+    }
+    return true;
+  }
+
+  void Fail(const Status& status) {
+    const std::string message = status.ToString();
+    handler_->on_error(handler_, ErrnoFromStatus(status), message.c_str(), nullptr);
+    ReleaseHandler(status);
+  }
+
+  void ReleaseHandler(const Status& status) {
+    handler_->release(handler_);
+    generator_ = {};
+    auto finished = finished_;
+    // May destroy this
+    self_.reset();
+    finished.MarkFinished(status);
+  }
+
+  static int ExtractBatch(struct ArrowAsyncTask* task, struct ArrowDeviceArray* out) {
+    auto* batch = reinterpret_cast<std::shared_ptr<RecordBatch>*>(task->private_data);
+    const Status status = ExportDeviceRecordBatch(**batch, /*sync=*/nullptr, out);
+    delete batch;
+    task->private_data = nullptr;
+    return ErrnoFromStatus(status);
+  }
+
+  static void StaticRequest(struct ArrowAsyncProducer* producer, int64_t n) {
+    reinterpret_cast<AsyncStreamProducer*>(producer->private_data)->Request(n);
+  }
+
+  static void StaticCancel(struct ArrowAsyncProducer* producer) {
+    reinterpret_cast<AsyncStreamProducer*>(producer->private_data)->Cancel();
+  }
+
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
+  struct ArrowAsyncDeviceStreamHandler* handler_;
+  internal::Executor* executor_;
+  struct ArrowAsyncProducer producer_;
+  Future<> finished_;
+  std::shared_ptr<AsyncStreamProducer> self_;
+
+  std::mutex mutex_;
+  int64_t requested_ = 0;
+  bool pumping_ = false;
+  bool cancelled_ = false;
+  Status error_;
+};
+
+}  // namespace
+
+Future<AsyncRecordBatchGenerator> CreateAsyncDeviceStreamHandler(
+    struct ArrowAsyncDeviceStreamHandler* handler, internal::Executor* executor,
+    uint64_t queue_size, DeviceMemoryMapper mapper) {
+  return AsyncStreamConsumer::Make(handler, executor, queue_size, std::move(mapper));
+}
+
+Future<> ExportAsyncRecordBatchReader(
+    std::shared_ptr<Schema> schema,
+    AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+    DeviceAllocationType device_type, struct ArrowAsyncDeviceStreamHandler* handler,
+    internal::Executor* executor) {
+  if (handler->release == nullptr) {
+    return Status::Invalid("Cannot export to a released ArrowAsyncDeviceStreamHandler");
+  }
+  if (executor == nullptr) {
+    executor = internal::GetCpuThreadPool();
+  }
+  auto producer = std::make_shared<AsyncStreamProducer>(std::move(generator),
+                                                        device_type, handler, executor);
+  return producer->Start(*schema);
+}
+
 }  // namespace arrow
@@ -26,7 +26,9 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/async_generator_fwd.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -293,6 +295,71 @@ Result<std::shared_ptr<RecordBatch>> ImportDeviceRecordBatch(
     struct ArrowDeviceArray* array, struct ArrowSchema* schema,
     const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper);
 
+/// \brief Import C++ record batches of a common schema from the C data interface.
+///
+/// Importing a schema involves parsing format strings and building the types and
+/// fields, which can cost more than importing the data of small record batches.
+/// This importer imports the schema once: ArrowSchema structs passed along with
+/// record batches are only compared with the previously imported one, and imported
+/// again if they differ.
+///
+/// The overloads taking an ArrowSchema update the cached schema, so they must not be
+/// called concurrently.
+class ARROW_EXPORT RecordBatchImporter {
+ public:
+  /// \brief Create an importer without a schema, to be provided along with the first
+  /// record batch.
+  RecordBatchImporter();
+  /// \brief Create an importer for record batches of the given schema.
+  explicit RecordBatchImporter(std::shared_ptr<Schema> schema);
+  ~RecordBatchImporter();
+  RecordBatchImporter(RecordBatchImporter&&) noexcept;
+  RecordBatchImporter& operator=(RecordBatchImporter&&) noexcept;
+
+  /// \brief Import a record batch of the current schema.
+  ///
+  /// \param[in,out] array C data interface struct holding the record batch data
+  /// \return Imported record batch object
+  Result<std::shared_ptr<RecordBatch>> Import(struct ArrowArray* array) const;
+
+  /// \brief Import a record batch along with its schema.
+  ///
+  /// The ArrowSchema struct is released, even if this function fails.
+  ///
+  /// \param[in,out] array C data interface struct holding the record batch data
+  /// \param[in,out] schema C data interface struct holding the record batch schema
+  /// \return Imported record batch object
+  Result<std::shared_ptr<RecordBatch>> Import(struct ArrowArray* array,
+                                              struct ArrowSchema* schema);
+
+  /// \brief EXPERIMENTAL: Import a record batch of the current schema with buffers
+  /// on a device.
+  Result<std::shared_ptr<RecordBatch>> ImportDevice(
+      struct ArrowDeviceArray* array,
+      const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper) const;
+
+  /// \brief EXPERIMENTAL: Import a record batch with buffers on a device along with
+  /// its schema.
+  ///
+  /// The ArrowSchema struct is released, even if this function fails.
+  Result<std::shared_ptr<RecordBatch>> ImportDevice(
+      struct ArrowDeviceArray* array, struct ArrowSchema* schema,
+      const DeviceMemoryMapper& mapper = DefaultDeviceMemoryMapper);
+
+  /// \brief The current schema, or null if none was provided yet.
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+ private:
+  struct CachedSchema;
+
+  Status UpdateSchema(struct ArrowSchema* schema);
+
+  std::shared_ptr<Schema> schema_;
+  // The struct type of the record batches
+  std::shared_ptr<DataType> type_;
+  std::unique_ptr<CachedSchema> cached_schema_;
+};
+
 /// @}
 
 /// \defgroup c-stream-interface Functions for working with the C data interface.
@@ -345,4 +412,63 @@ Result<std::shared_ptr<ChunkedArray>> ImportChunkedArray(struct ArrowArrayStream
 
 /// @}
 
+/// \defgroup c-async-stream-interface Functions for working with the async C data
+/// interface.
+///
+/// @{
+
+/// \brief EXPERIMENTAL: A record batch generator imported from the async C stream
+/// interface, along with the stream schema and device.
+struct AsyncRecordBatchGenerator {
+  std::shared_ptr<Schema> schema;
+  DeviceAllocationType device_type;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator;
+};
+
+/// \brief EXPERIMENTAL: Create an async C stream handler to consume a stream of
+/// record batches.
+///
+/// The handler is meant to be passed to a producer. The returned future finishes
+/// with a generator once the producer provides the stream schema, or with an error
+/// if it reports one first.
+///
+/// Up to queue_size batches are requested ahead of the consumer, and one more is
+/// requested each time the consumer takes one, so that producing and consuming
+/// overlap without unbounded buffering. The batches are extracted from the tasks
+/// of the producer and imported on the executor.
+///
+/// \param[out] handler C struct to populate with the handler
+/// \param[in] executor Executor on which to extract and import batches; if null,
+/// they are imported on the thread delivering them
+/// \param[in] queue_size Maximum number of batches requested ahead of the consumer
+/// \param[in] mapper A function to map device + id to memory manager
+/// \return Future of the imported generator
+ARROW_EXPORT
+Future<AsyncRecordBatchGenerator> CreateAsyncDeviceStreamHandler(
+    struct ArrowAsyncDeviceStreamHandler* handler, internal::Executor* executor,
+    uint64_t queue_size = 5, DeviceMemoryMapper mapper = DefaultDeviceMemoryMapper);
+
+/// \brief EXPERIMENTAL: Export a record batch generator to an async C stream handler.
+///
+/// The schema is passed to the handler immediately, then batches are pulled from the
+/// generator and pushed to the handler as the consumer requests them. The handler is
+/// released at the end of the stream, on error, or after the consumer cancels the
+/// stream.
+///
+/// \param[in] schema Schema of the record batches
+/// \param[in] generator Generator of the record batches to export
+/// \param[in] device_type Device on which the record batches are located
+/// \param[in,out] handler C struct of the consumer handler
+/// \param[in] executor Executor on which to pull from the generator; if null, the
+/// CPU thread pool is used
+/// \return Future which finishes once the handler is released
+ARROW_EXPORT
+Future<> ExportAsyncRecordBatchReader(
+    std::shared_ptr<Schema> schema,
+    AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+    DeviceAllocationType device_type, struct ArrowAsyncDeviceStreamHandler* handler,
+    internal::Executor* executor = NULLPTR);
+
+/// @}
+
 }  // namespace arrow
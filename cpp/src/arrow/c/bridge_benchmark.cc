@@ -43,10 +43,9 @@ std::shared_ptr<Schema> ExampleSchema() {
   return schema({f0, f1, f2, f3, f4, f5, f6, f7, f8});
 }
 
-std::shared_ptr<RecordBatch> ExampleRecordBatch() {
+std::shared_ptr<RecordBatch> ExampleRecordBatch(int64_t length = 1000) {
   // We don't care about the actual data, since it's exported as raw buffer pointers
   auto schema = ExampleSchema();
-  int64_t length = 1000;
   std::vector<std::shared_ptr<Array>> columns;
   for (const auto& field : schema->fields()) {
     auto array = *MakeArrayOfNull(field->type(), length);
@@ -146,6 +145,55 @@ static void ExportImportRecordBatch(
   state.SetItemsProcessed(state.iterations());
 }
 
+// Small record batches along with their schema, as when streaming them one by one
+// across the C ABI
+
+constexpr int64_t kSmallBatchLength = 8;
+
+static void ExportImportSmallRecordBatchWithSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  auto batch = ExampleRecordBatch(kSmallBatchLength);
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(ExportRecordBatch(*batch, &c_array, &c_schema));
+    ImportRecordBatch(&c_array, &c_schema).ValueOrDie();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void ExportImportSmallRecordBatchCachedSchema(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+  auto batch = ExampleRecordBatch(kSmallBatchLength);
+  RecordBatchImporter importer;
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(ExportRecordBatch(*batch, &c_array, &c_schema));
+    importer.Import(&c_array, &c_schema).ValueOrDie();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void ExportImportSmallRecordBatchStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArrayStream c_stream;
+  const RecordBatchVector batches(1000, ExampleRecordBatch(kSmallBatchLength));
+
+  for (auto _ : state) {
+    auto reader = RecordBatchReader::Make(batches).ValueOrDie();
+    ABORT_NOT_OK(ExportRecordBatchReader(std::move(reader), &c_stream));
+    auto imported = ImportRecordBatchReader(&c_stream).ValueOrDie();
+    std::shared_ptr<RecordBatch> batch;
+    do {
+      ABORT_NOT_OK(imported->ReadNext(&batch));
+    } while (batch != nullptr);
+  }
+  state.SetItemsProcessed(state.iterations() * batches.size());
+}
+
 BENCHMARK(ExportType);
 BENCHMARK(ExportSchema);
 BENCHMARK(ExportArray);
@@ -156,4 +204,8 @@ BENCHMARK(ExportImportSchema);
 BENCHMARK(ExportImportArray);
 BENCHMARK(ExportImportRecordBatch);
 
+BENCHMARK(ExportImportSmallRecordBatchWithSchema);
+BENCHMARK(ExportImportSmallRecordBatchCachedSchema);
+BENCHMARK(ExportImportSmallRecordBatchStream);
+
 }  // namespace arrow
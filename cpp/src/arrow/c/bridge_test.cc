@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
 #include <cerrno>
 #include <deque>
 #include <functional>
@@ -35,9 +36,11 @@
 #include "arrow/memory_pool.h"
 #include "arrow/testing/builder.h"
 #include "arrow/testing/extension_type.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/binary_view_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/endian.h"
@@ -45,6 +48,7 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/range.h"
+#include "arrow/util/thread_pool.h"
 
 // TODO(GH-37221): Remove these ifdef checks when compute dependency is removed
 #ifdef ARROW_COMPUTE
@@ -4333,6 +4337,80 @@ TEST_F(TestDeviceArrayRoundtrip, Struct) {
 ////////////////////////////////////////////////////////////////////////////
 // Array stream export tests
 
+////////////////////////////////////////////////////////////////////////////
+// Record batch importer tests
+
+TEST(RecordBatchImporter, Basics) {
+  auto orig_schema = schema({field("ints", int32()), field("strs", utf8())},
+                            key_value_metadata(kMetadataKeys1, kMetadataValues1));
+  auto batch = RecordBatch::Make(orig_schema, 2,
+                                 {ArrayFromJSON(int32(), "[1, null]"),
+                                  ArrayFromJSON(utf8(), R"(["foo", "bar"])")});
+  struct ArrowArray c_array;
+  struct ArrowSchema c_schema;
+
+  RecordBatchImporter importer;
+  ASSERT_EQ(importer.schema(), nullptr);
+  ASSERT_OK(ExportRecordBatch(*batch, &c_array));
+  ASSERT_RAISES(Invalid, importer.Import(&c_array));
+  ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+
+  ASSERT_OK(ExportRecordBatch(*batch, &c_array, &c_schema));
+  ASSERT_OK_AND_ASSIGN(auto imported, importer.Import(&c_array, &c_schema));
+  ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+  ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+  AssertBatchesEqual(*batch, *imported);
+  AssertSchemaEqual(*orig_schema, *imported->schema(), /*check_metadata=*/true);
+  const auto imported_schema = importer.schema();
+  ASSERT_EQ(imported->schema(), imported_schema);
+
+  // The same schema isn't imported again
+  ASSERT_OK(ExportRecordBatch(*batch, &c_array, &c_schema));
+  ASSERT_OK_AND_ASSIGN(imported, importer.Import(&c_array, &c_schema));
+  ASSERT_TRUE(ArrowSchemaIsReleased(&c_schema));
+  AssertBatchesEqual(*batch, *imported);
+  ASSERT_EQ(imported->schema(), imported_schema);
+
+  ASSERT_OK(ExportRecordBatch(*batch, &c_array));
+  ASSERT_OK_AND_ASSIGN(imported, importer.Import(&c_array));
+  AssertBatchesEqual(*batch, *imported);
+  ASSERT_EQ(imported->schema(), imported_schema);
+
+  // Other schemas are
+  for (const auto& other_schema :
+       {orig_schema->WithMetadata(key_value_metadata(kMetadataKeys2, kMetadataValues2)),
+        orig_schema->RemoveMetadata(),
+        schema({field("ints", int32()), field("other", utf8())}),
+        schema({field("ints", int32(), /*nullable=*/false), field("strs", utf8())}),
+        schema({field("ints", int32()), field("strs", binary())})}) {
+    ARROW_SCOPED_TRACE(other_schema->ToString());
+    auto other_batch = RecordBatch::Make(
+        other_schema, 2,
+        {batch->column(0),
+         ArrayFromJSON(other_schema->field(1)->type(), R"(["foo", "bar"])")});
+    ASSERT_OK(ExportRecordBatch(*other_batch, &c_array, &c_schema));
+    ASSERT_OK_AND_ASSIGN(imported, importer.Import(&c_array, &c_schema));
+    AssertBatchesEqual(*other_batch, *imported);
+    AssertSchemaEqual(*other_schema, *imported->schema(), /*check_metadata=*/true);
+    ASSERT_EQ(imported->schema(), importer.schema());
+  }
+}
+
+TEST(RecordBatchImporter, WithSchema) {
+  auto orig_schema = schema({field("ints", int32())});
+  auto batch = RecordBatch::Make(orig_schema, 2, {ArrayFromJSON(int32(), "[1, 2]")});
+  struct ArrowArray c_array;
+
+  RecordBatchImporter importer(orig_schema);
+  ASSERT_EQ(importer.schema(), orig_schema);
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK(ExportRecordBatch(*batch, &c_array));
+    ASSERT_OK_AND_ASSIGN(auto imported, importer.Import(&c_array));
+    AssertBatchesEqual(*batch, *imported);
+    ASSERT_EQ(imported->schema(), orig_schema);
+  }
+}
+
 class FailingRecordBatchReader : public RecordBatchReader {
  public:
   explicit FailingRecordBatchReader(Status error) : error_(std::move(error)) {}
@@ -4746,4 +4824,128 @@ TEST_F(TestArrayStreamRoundtrip, ChunkedArrayRoundtripEmpty) {
   });
 }
 
+////////////////////////////////////////////////////////////////////////////
+// Async C stream tests
+
+class TestAsyncDeviceArrayStreamRoundtrip : public BaseArrayStreamTest {
+ public:
+  void TearDown() override {
+    // Tasks may still hold on to batches right after the stream ends
+    internal::GetCpuThreadPool()->WaitForIdle();
+    BaseArrayStreamTest::TearDown();
+  }
+
+  void Roundtrip(const std::shared_ptr<Schema>& schema,
+                 AsyncGenerator<std::shared_ptr<RecordBatch>> source,
+                 internal::Executor* executor, uint64_t queue_size,
+                 AsyncRecordBatchGenerator* out, Future<>* exported) {
+    auto fut_generator = CreateAsyncDeviceStreamHandler(&handler_, executor, queue_size);
+    ASSERT_FALSE(fut_generator.is_finished());
+
+    *exported = ExportAsyncRecordBatchReader(schema, std::move(source),
+                                             DeviceAllocationType::kCPU, &handler_);
+    ASSERT_FINISHES_OK_AND_ASSIGN(*out, fut_generator);
+    AssertSchemaEqual(*schema, *out->schema, /*check_metadata=*/true);
+    ASSERT_EQ(out->device_type, DeviceAllocationType::kCPU);
+  }
+
+ protected:
+  // Used by the producer until it releases it
+  struct ArrowAsyncDeviceStreamHandler handler_;
+};
+
+TEST_F(TestAsyncDeviceArrayStreamRoundtrip, Simple) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = MakeBatches(orig_schema, {ArrayFromJSON(int32(), "[1, 2]"),
+                                           ArrayFromJSON(int32(), "[4, 5, null]"),
+                                           ArrayFromJSON(int32(), "[]"),
+                                           ArrayFromJSON(int32(), "[6]")});
+
+  for (auto executor : {static_cast<internal::Executor*>(internal::GetCpuThreadPool()),
+                        static_cast<internal::Executor*>(nullptr)}) {
+    for (uint64_t queue_size : {1, 2, 10}) {
+      ARROW_SCOPED_TRACE("queue_size = ", queue_size);
+      AsyncRecordBatchGenerator generator;
+      Future<> exported;
+      ASSERT_NO_FATAL_FAILURE(Roundtrip(orig_schema, MakeVectorGenerator(batches),
+                                        executor, queue_size, &generator, &exported));
+
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto got, CollectAsyncGenerator(generator.generator));
+      ASSERT_EQ(got.size(), batches.size());
+      for (size_t i = 0; i < batches.size(); ++i) {
+        AssertBatchesEqual(*batches[i], *got[i]);
+      }
+      ASSERT_FINISHES_OK(exported);
+      ASSERT_EQ(handler_.release, nullptr);
+    }
+  }
+}
+
+TEST_F(TestAsyncDeviceArrayStreamRoundtrip, Backpressure) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = MakeBatches(orig_schema, {ArrayFromJSON(int32(), "[1, 2]"),
+                                           ArrayFromJSON(int32(), "[3]"),
+                                           ArrayFromJSON(int32(), "[4, 5, null]"),
+                                           ArrayFromJSON(int32(), "[6]")});
+
+  std::atomic<int> pulled{0};
+  AsyncGenerator<std::shared_ptr<RecordBatch>> source =
+      [&, gen = MakeVectorGenerator(batches)]() {
+        ++pulled;
+        return gen();
+      };
+  AsyncRecordBatchGenerator generator;
+  Future<> exported;
+  ASSERT_NO_FATAL_FAILURE(Roundtrip(orig_schema, std::move(source),
+                                    internal::GetCpuThreadPool(), /*queue_size=*/2,
+                                    &generator, &exported));
+
+  // The producer only pulls the batches requested ahead of the consumer
+  BusyWait(10, [&] { return pulled.load() == 2; });
+  SleepABit();
+  ASSERT_EQ(pulled.load(), 2);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, generator.generator());
+  AssertBatchesEqual(*batches[0], *batch);
+  BusyWait(10, [&] { return pulled.load() == 3; });
+  SleepABit();
+  ASSERT_EQ(pulled.load(), 3);
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto rest, CollectAsyncGenerator(generator.generator));
+  ASSERT_EQ(rest.size(), 3U);
+  ASSERT_FINISHES_OK(exported);
+}
+
+TEST_F(TestAsyncDeviceArrayStreamRoundtrip, Errors) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = MakeBatches(orig_schema, {ArrayFromJSON(int32(), "[1, 2]")});
+  auto source = MakeGeneratorStartsWith(
+      batches, MakeFailingGenerator<std::shared_ptr<RecordBatch>>(
+                   Status::IOError("roundtrip error example")));
+
+  AsyncRecordBatchGenerator generator;
+  Future<> exported;
+  ASSERT_NO_FATAL_FAILURE(Roundtrip(orig_schema, std::move(source),
+                                    internal::GetCpuThreadPool(), /*queue_size=*/5,
+                                    &generator, &exported));
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batch, generator.generator());
+  AssertBatchesEqual(*batches[0], *batch);
+  ASSERT_FINISHES_AND_RAISES(IOError, generator.generator());
+  ASSERT_FINISHES_AND_RAISES(IOError, exported);
+}
+
+TEST_F(TestAsyncDeviceArrayStreamRoundtrip, SchemaError) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  struct ArrowAsyncDeviceStreamHandler handler;
+  auto fut_generator =
+      CreateAsyncDeviceStreamHandler(&handler, internal::GetCpuThreadPool());
+  // The producer fails before sending the schema
+  handler.on_error(&handler, EIO, "Expected error", nullptr);
+  handler.release(&handler);
+  ASSERT_EQ(handler.release, nullptr);
+  ASSERT_FINISHES_AND_RAISES(IOError, fut_generator);
+  ASSERT_THAT(fut_generator.status().message(), ::testing::HasSubstr("Expected error"));
+}
+
 }  // namespace arrow
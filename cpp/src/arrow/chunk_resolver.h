@@ -20,6 +20,7 @@
 #include <atomic>
 #include <cassert>
 #include <cstdint>
+#include <type_traits>
 #include <vector>
 
 #include "arrow/type_fwd.h"
@@ -55,6 +56,9 @@ struct ARROW_EXPORT ChunkResolver {
   /// \invariant `cached_chunk_ in [0, chunks.size()]`
   mutable std::atomic<int64_t> cached_chunk_;
 
+  /// \brief Up to this many chunks, ResolveMany() scans all the offsets
+  static constexpr int64_t kMaxChunksForLinearSearch = 16;
+
  public:
   explicit ChunkResolver(const ArrayVector& chunks) noexcept;
   explicit ChunkResolver(const std::vector<const Array*>& chunks) noexcept;
@@ -105,6 +109,63 @@ struct ARROW_EXPORT ChunkResolver {
     return {chunk_index, index - offsets_[chunk_index]};
   }
 
+  /// \brief Resolve `n_indices` logical indices to ChunkLocations.
+  ///
+  /// This is faster than calling Resolve() in a loop: the cached chunk is not
+  /// updated, runs of indices falling in the same chunk (e.g. sorted indices) are
+  /// resolved with two comparisons each, and when there are few chunks the others
+  /// are resolved with a branchless linear scan of the offsets that the compiler
+  /// can vectorize.
+  ///
+  /// \post out_chunk_location_vec[i].chunk_index in [0, chunks.size()]
+  /// \param n_indices The number of logical indices to resolve
+  /// \param logical_index_vec The logical indices to resolve
+  /// \param out_chunk_location_vec The output array of `n_indices` ChunkLocations.
+  ///        Out-of-bounds indices resolve to `chunk_index == chunks.size()`.
+  /// \param chunk_hint 0 or the chunk index of the ChunkLocation of the index
+  ///        preceding `logical_index_vec[0]`
+  template <typename IndexType>
+  inline void ResolveMany(int64_t n_indices, const IndexType* logical_index_vec,
+                          ChunkLocation* out_chunk_location_vec,
+                          int64_t chunk_hint = 0) const {
+    // Unsigned indices avoid the need to check for negative values
+    static_assert(std::is_unsigned_v<IndexType>, "IndexType must be unsigned");
+    const auto num_offsets = static_cast<int64_t>(offsets_.size());
+    const int64_t* offsets = offsets_.data();
+    assert(chunk_hint >= 0 && chunk_hint < num_offsets);
+    if (num_offsets <= kMaxChunksForLinearSearch + 1) {
+      for (int64_t i = 0; i < n_indices; ++i) {
+        const auto index = static_cast<uint64_t>(logical_index_vec[i]);
+        int64_t chunk_index = 0;
+        for (int64_t j = 1; j < num_offsets; ++j) {
+          chunk_index += index >= static_cast<uint64_t>(offsets[j]);
+        }
+        out_chunk_location_vec[i] = {
+            chunk_index, static_cast<int64_t>(index) - offsets[chunk_index]};
+      }
+      return;
+    }
+    const auto length = static_cast<uint64_t>(offsets[num_offsets - 1]);
+    // From here on chunk_hint is always the index of an existing chunk
+    if (chunk_hint == num_offsets - 1) {
+      chunk_hint = 0;
+    }
+    for (int64_t i = 0; i < n_indices; ++i) {
+      const auto index = static_cast<uint64_t>(logical_index_vec[i]);
+      if (ARROW_PREDICT_FALSE(index >= length)) {
+        out_chunk_location_vec[i] = {num_offsets - 1, 0};
+        continue;
+      }
+      if (index < static_cast<uint64_t>(offsets[chunk_hint]) ||
+          index >= static_cast<uint64_t>(offsets[chunk_hint + 1])) {
+        chunk_hint = Bisect(static_cast<int64_t>(index), offsets, /*lo=*/0,
+                            /*hi=*/num_offsets);
+      }
+      out_chunk_location_vec[i] = {chunk_hint,
+                                   static_cast<int64_t>(index) - offsets[chunk_hint]};
+    }
+  }
+
  private:
   template <bool StoreCachedChunk>
   inline int64_t ResolveChunkIndex(int64_t index, int64_t cached_chunk) const {
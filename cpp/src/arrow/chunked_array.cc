@@ -25,6 +25,7 @@
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_nested.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/util.h"
 #include "arrow/array/validate.h"
 #include "arrow/pretty_print.h"
@@ -233,6 +234,44 @@ Result<std::vector<std::shared_ptr<ChunkedArray>>> ChunkedArray::Flatten(
   return flattened;
 }
 
+Result<std::shared_ptr<ChunkedArray>> ChunkedArray::CoalesceChunks(
+    int64_t target_length, MemoryPool* pool) const {
+  if (target_length <= 0) {
+    return Status::Invalid("Target chunk length must be positive, got ", target_length);
+  }
+  ArrayVector chunks;
+  ArrayVector pending;
+  int64_t pending_length = 0;
+  auto flush_pending = [&]() -> Status {
+    if (pending.size() == 1) {
+      chunks.push_back(std::move(pending[0]));
+    } else if (pending.size() > 1) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, Concatenate(pending, pool));
+      chunks.push_back(std::move(chunk));
+    }
+    pending.clear();
+    pending_length = 0;
+    return Status::OK();
+  };
+  for (const auto& chunk : chunks_) {
+    if (chunk->length() == 0) {
+      continue;
+    }
+    if (chunk->length() >= target_length / 2) {
+      RETURN_NOT_OK(flush_pending());
+      chunks.push_back(chunk);
+      continue;
+    }
+    pending.push_back(chunk);
+    pending_length += chunk->length();
+    if (pending_length >= target_length) {
+      RETURN_NOT_OK(flush_pending());
+    }
+  }
+  RETURN_NOT_OK(flush_pending());
+  return std::make_shared<ChunkedArray>(std::move(chunks), type_);
+}
+
 Result<std::shared_ptr<ChunkedArray>> ChunkedArray::View(
     const std::shared_ptr<DataType>& type) const {
   ArrayVector out_chunks(this->num_chunks());
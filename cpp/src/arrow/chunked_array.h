@@ -137,6 +137,19 @@ class ARROW_EXPORT ChunkedArray {
   Result<std::vector<std::shared_ptr<ChunkedArray>>> Flatten(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Merge runs of consecutive small chunks
+  ///
+  /// Chunks shorter than half of `target_length` are concatenated with the
+  /// following ones until reaching `target_length` elements, so that kernels run
+  /// over steadily sized chunks.  Larger chunks are kept as-is, and empty chunks
+  /// are dropped.  The chunk layout only depends on the chunk lengths, so chunked
+  /// arrays with the same layout still share it afterwards.
+  ///
+  /// \param[in] target_length The length of the merged chunks
+  /// \param[in] pool The pool for buffer allocations
+  Result<std::shared_ptr<ChunkedArray>> CoalesceChunks(
+      int64_t target_length, MemoryPool* pool = default_memory_pool()) const;
+
   /// Construct a zero-copy view of this chunked array with the given
   /// type. Calls Array::View on each constituent chunk. Always succeeds if
   /// there are zero chunks
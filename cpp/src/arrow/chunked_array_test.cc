@@ -23,6 +23,7 @@
 #include <memory>
 #include <vector>
 
+#include "arrow/chunk_resolver.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/testing/builder.h"
@@ -289,6 +290,41 @@ TEST_F(TestChunkedArray, View) {
   AssertChunkedEqual(*expected, *result);
 }
 
+TEST_F(TestChunkedArray, CoalesceChunks) {
+  auto ty = int32();
+  ArrayVector chunks{ArrayFromJSON(ty, "[1, 2, null]"), ArrayFromJSON(ty, "[]"),
+                     ArrayFromJSON(ty, "[3, 4, 5, 6]"),
+                     ArrayFromJSON(ty, "[7, 8, 9, 10, 11, 12]"),
+                     ArrayFromJSON(ty, "[null, 13]"), ArrayFromJSON(ty, "[14]")};
+  ChunkedArray carr(chunks);
+
+  // Small chunks are concatenated, chunks of at least half the target are kept
+  ASSERT_OK_AND_ASSIGN(auto result, carr.CoalesceChunks(10));
+  ASSERT_OK(result->ValidateFull());
+  AssertChunkedEquivalent(carr, *result);
+  ASSERT_EQ(result->num_chunks(), 3);
+  ASSERT_EQ(result->chunk(0)->length(), 7);
+  ASSERT_EQ(result->chunk(1).get(), chunks[3].get());
+  ASSERT_EQ(result->chunk(2)->length(), 3);
+
+  // Small chunks are flushed once they reach the target
+  ASSERT_OK_AND_ASSIGN(result, carr.CoalesceChunks(14));
+  AssertChunkedEquivalent(carr, *result);
+  ASSERT_EQ(result->num_chunks(), 2);
+  ASSERT_EQ(result->chunk(0)->length(), 15);
+  ASSERT_EQ(result->chunk(1)->length(), 1);
+
+  // Zero length
+  ArrayVector empty = {};
+  ChunkedArray empty_carr(empty, ty);
+  ASSERT_OK_AND_ASSIGN(result, empty_carr.CoalesceChunks(10));
+  ASSERT_EQ(result->num_chunks(), 0);
+  AssertTypeEqual(*ty, *result->type());
+
+  ASSERT_RAISES(Invalid, carr.CoalesceChunks(0));
+  ASSERT_RAISES(Invalid, carr.CoalesceChunks(-1));
+}
+
 TEST_F(TestChunkedArray, GetScalar) {
   auto ty = int32();
   ArrayVector chunks{ArrayFromJSON(ty, "[6, 7, null]"), ArrayFromJSON(ty, "[]"),
@@ -310,4 +346,39 @@ TEST_F(TestChunkedArray, GetScalar) {
   ASSERT_RAISES(IndexError, carr.GetScalar(7));
 }
 
+TEST(TestChunkResolver, ResolveMany) {
+  for (int num_chunks : {0, 1, 3, 30}) {
+    ARROW_SCOPED_TRACE("num_chunks = ", num_chunks);
+    // Chunks of lengths 0, 1, 2, 0, 1, 2...
+    ArrayVector chunks;
+    for (int i = 0; i < num_chunks; ++i) {
+      const char* json[] = {"[]", "[1]", "[1, 2]"};
+      chunks.push_back(ArrayFromJSON(int8(), json[i % 3]));
+    }
+    internal::ChunkResolver resolver(chunks);
+    const int64_t length = ChunkedArray(chunks, int8()).length();
+
+    std::vector<uint32_t> indices;
+    for (int64_t i = 0; i < length + 2; ++i) {
+      indices.push_back(static_cast<uint32_t>(i));
+    }
+    for (int64_t i = length + 1; i >= 0; --i) {
+      indices.push_back(static_cast<uint32_t>(i));
+    }
+    std::vector<internal::ChunkLocation> locations(indices.size());
+    resolver.ResolveMany(static_cast<int64_t>(indices.size()), indices.data(),
+                         locations.data());
+    for (size_t i = 0; i < indices.size(); ++i) {
+      ARROW_SCOPED_TRACE("index = ", indices[i]);
+      if (indices[i] >= length) {
+        ASSERT_EQ(locations[i].chunk_index, num_chunks);
+      } else {
+        auto expected = resolver.Resolve(indices[i]);
+        ASSERT_EQ(locations[i].chunk_index, expected.chunk_index);
+        ASSERT_EQ(locations[i].index_in_chunk, expected.index_in_chunk);
+      }
+    }
+  }
+}
+
 }  // namespace arrow
@@ -81,17 +81,21 @@ struct FloatingEquality {
   explicit FloatingEquality(const EqualOptions& options)
       : epsilon(static_cast<T>(options.atol())) {}
 
+  // Branch-free so that loops over values can be vectorized
   bool operator()(T x, T y) const {
-    if (x == y) {
-      return Flags::signed_zeros_equal || (std::signbit(x) == std::signbit(y));
+    const bool same = x == y;
+    bool equal = same;
+    if (!Flags::signed_zeros_equal) {
+      equal &= std::signbit(x) == std::signbit(y);
     }
-    if (Flags::nans_equal && std::isnan(x) && std::isnan(y)) {
-      return true;
+    if (Flags::nans_equal) {
+      equal |= std::isnan(x) & std::isnan(y);
     }
-    if (Flags::approximate && (fabs(x - y) <= epsilon)) {
-      return true;
+    if (Flags::approximate) {
+      // Identical values are only compared above, so that signed zeros can differ
+      equal |= !same & (std::fabs(x - y) <= epsilon);
     }
-    return false;
+    return equal;
   }
 
   const T epsilon;
@@ -463,32 +467,82 @@ class RangeDataEqualsImpl {
  protected:
   template <typename TypeClass, typename CType = typename TypeClass::c_type>
   Status ComparePrimitive(const TypeClass&) {
+    if (left_.MayHaveNulls()) {
+      CompareValueBlocks<CType>([](CType x, CType y) { return x == y; });
+      return Status::OK();
+    }
     const CType* left_values = left_.GetValues<CType>(1);
     const CType* right_values = right_.GetValues<CType>(1);
-    VisitValidRuns([&](int64_t i, int64_t length) {
-      return memcmp(left_values + left_start_idx_ + i,
-                    right_values + right_start_idx_ + i, length * sizeof(CType)) == 0;
-    });
+    result_ = memcmp(left_values + left_start_idx_, right_values + right_start_idx_,
+                     range_length_ * sizeof(CType)) == 0;
     return Status::OK();
   }
 
   template <typename TypeClass>
   Status CompareFloating(const TypeClass&) {
     using CType = typename TypeClass::c_type;
-    const CType* left_values = left_.GetValues<CType>(1);
-    const CType* right_values = right_.GetValues<CType>(1);
-
     auto visitor = [&](auto&& compare_func) {
-      VisitValues([&](int64_t i) {
-        const CType x = left_values[i + left_start_idx_];
-        const CType y = right_values[i + right_start_idx_];
-        return compare_func(x, y);
-      });
+      CompareValueBlocks<CType>(std::forward<decltype(compare_func)>(compare_func));
     };
     VisitFloatingEquality<CType>(options_, floating_approximate_, std::move(visitor));
     return Status::OK();
   }
 
+  // Compare the non-null values with `equal(x, y)`, by blocks of 64 values.
+  //
+  // Every value of a block is compared without branching, so that the loop can be
+  // vectorized, and the results at null positions are masked out with the validity
+  // bitmap.  Blocks without any valid value are skipped.
+  template <typename CType, typename Equal>
+  void CompareValueBlocks(Equal&& equal) {
+    constexpr int64_t kBlockLength = 64;
+    const CType* left_values = left_.GetValues<CType>(1) + left_start_idx_;
+    const CType* right_values = right_.GetValues<CType>(1) + right_start_idx_;
+    auto all_equal = [&](int64_t offset, int64_t length) {
+      bool all_equal = true;
+      for (int64_t j = offset; j < offset + length; ++j) {
+        all_equal &= equal(left_values[j], right_values[j]);
+      }
+      return all_equal;
+    };
+
+    const uint8_t* left_null_bitmap = left_.GetValues<uint8_t>(0, 0);
+    if (left_null_bitmap == nullptr) {
+      for (int64_t i = 0; i < range_length_; i += kBlockLength) {
+        if (!all_equal(i, std::min(kBlockLength, range_length_ - i))) {
+          result_ = false;
+          return;
+        }
+      }
+      return;
+    }
+    BitmapUInt64Reader valid_reader(left_null_bitmap, left_.offset + left_start_idx_,
+                                    range_length_);
+    for (int64_t i = 0; i < range_length_; i += kBlockLength) {
+      const int64_t length = std::min(kBlockLength, range_length_ - i);
+      const uint64_t valid = valid_reader.NextWord();
+      if (valid == 0) {
+        continue;
+      }
+      bool block_equal;
+      if (length == kBlockLength && valid == ~uint64_t{0}) {
+        block_equal = all_equal(i, kBlockLength);
+      } else {
+        uint64_t not_equal = 0;
+        for (int64_t j = 0; j < length; ++j) {
+          not_equal |= static_cast<uint64_t>(!equal(left_values[i + j],
+                                                    right_values[i + j]))
+                       << j;
+        }
+        block_equal = (not_equal & valid) == 0;
+      }
+      if (!block_equal) {
+        result_ = false;
+        return;
+      }
+    }
+  }
+
   template <typename TypeClass>
   Status CompareBinary(const TypeClass&) {
     const uint8_t* left_data = left_.GetValues<uint8_t>(2, 0);
@@ -606,16 +660,6 @@ class RangeDataEqualsImpl {
     VisitValidRuns(compare_runs);
   }
 
-  template <typename CompareValues>
-  void VisitValues(CompareValues&& compare_values) {
-    internal::VisitSetBitRunsVoid(left_.buffers[0], left_.offset + left_start_idx_,
-                                  range_length_, [&](int64_t position, int64_t length) {
-                                    for (int64_t i = 0; i < length; ++i) {
-                                      result_ &= compare_values(position + i);
-                                    }
-                                  });
-  }
-
   // Visit and compare runs of non-null values
   template <typename CompareRuns>
   void VisitValidRuns(CompareRuns&& compare_runs) {
@@ -52,6 +52,21 @@ static void BenchmarkArrayRangeEquals(const std::shared_ptr<Array>& array,
   }
 }
 
+static void BenchmarkArrayApproxEquals(const std::shared_ptr<Array>& array,
+                                       benchmark::State& state) {
+  const auto left_array = array;
+  // Make sure pointer equality can't be used as a shortcut
+  const auto right_array = MakeArray(array->data()->Copy());
+  const auto options = EqualOptions().atol(1e-6).nans_equal(true);
+
+  for (auto _ : state) {
+    const bool are_ok = ArrayApproxEquals(*left_array, *right_array, options);
+    if (ARROW_PREDICT_FALSE(!are_ok)) {
+      ARROW_LOG(FATAL) << "Arrays should have compared equal";
+    }
+  }
+}
+
 static void ArrayRangeEqualsInt32(benchmark::State& state) {
   RegressionArgs args(state, /*size_is_bytes=*/false);
 
@@ -70,6 +85,33 @@ static void ArrayRangeEqualsFloat32(benchmark::State& state) {
   BenchmarkArrayRangeEquals(array, state);
 }
 
+static void ArrayRangeEqualsFloat64(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto array = rng.Float64(args.size, 0, 100, args.null_proportion);
+
+  BenchmarkArrayRangeEquals(array, state);
+}
+
+static void ArrayApproxEqualsFloat32(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto array = rng.Float32(args.size, 0, 100, args.null_proportion);
+
+  BenchmarkArrayApproxEquals(array, state);
+}
+
+static void ArrayApproxEqualsFloat64(benchmark::State& state) {
+  RegressionArgs args(state, /*size_is_bytes=*/false);
+
+  auto rng = random::RandomArrayGenerator(kSeed);
+  auto array = rng.Float64(args.size, 0, 100, args.null_proportion);
+
+  BenchmarkArrayApproxEquals(array, state);
+}
+
 static void ArrayRangeEqualsBoolean(benchmark::State& state) {
   RegressionArgs args(state, /*size_is_bytes=*/false);
 
@@ -153,6 +195,9 @@ static void ArrayRangeEqualsDenseUnion(benchmark::State& state) {
 
 BENCHMARK(ArrayRangeEqualsInt32)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsFloat32)->Apply(RegressionSetArgs);
+BENCHMARK(ArrayRangeEqualsFloat64)->Apply(RegressionSetArgs);
+BENCHMARK(ArrayApproxEqualsFloat32)->Apply(RegressionSetArgs);
+BENCHMARK(ArrayApproxEqualsFloat64)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsBoolean)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsString)->Apply(RegressionSetArgs);
 BENCHMARK(ArrayRangeEqualsFixedSizeBinary)->Apply(RegressionSetArgs);
@@ -31,6 +31,7 @@
 #include "arrow/compute/api_aggregate.h"     // IWYU pragma: export
 #include "arrow/compute/api_scalar.h"        // IWYU pragma: export
 #include "arrow/compute/api_vector.h"        // IWYU pragma: export
+#include "arrow/compute/array_hash.h"        // IWYU pragma: export
 #include "arrow/compute/cast.h"              // IWYU pragma: export
 #include "arrow/compute/function.h"          // IWYU pragma: export
 #include "arrow/compute/function_options.h"  // IWYU pragma: export
@@ -44,6 +44,23 @@ struct EnumTraits<compute::CountOptions::CountMode>
   }
 };
 
+template <>
+struct EnumTraits<compute::PivotWiderOptions::UnexpectedKeyBehavior>
+    : BasicEnumTraits<compute::PivotWiderOptions::UnexpectedKeyBehavior,
+                      compute::PivotWiderOptions::IGNORE,
+                      compute::PivotWiderOptions::RAISE> {
+  static std::string name() { return "PivotWiderOptions::UnexpectedKeyBehavior"; }
+  static std::string value_name(compute::PivotWiderOptions::UnexpectedKeyBehavior value) {
+    switch (value) {
+      case compute::PivotWiderOptions::IGNORE:
+        return "IGNORE";
+      case compute::PivotWiderOptions::RAISE:
+        return "RAISE";
+    }
+    return "<INVALID>";
+  }
+};
+
 template <>
 struct EnumTraits<compute::QuantileOptions::Interpolation>
     : BasicEnumTraits<compute::QuantileOptions::Interpolation,
@@ -101,8 +118,14 @@ static auto kTDigestOptionsType = GetFunctionOptionsType<TDigestOptions>(
     DataMember("buffer_size", &TDigestOptions::buffer_size),
     DataMember("skip_nulls", &TDigestOptions::skip_nulls),
     DataMember("min_count", &TDigestOptions::min_count));
+static auto kApproximateCountDistinctOptionsType =
+    GetFunctionOptionsType<ApproximateCountDistinctOptions>(
+        DataMember("precision", &ApproximateCountDistinctOptions::precision));
 static auto kIndexOptionsType =
     GetFunctionOptionsType<IndexOptions>(DataMember("value", &IndexOptions::value));
+static auto kPivotWiderOptionsType = GetFunctionOptionsType<PivotWiderOptions>(
+    DataMember("key_names", &PivotWiderOptions::key_names),
+    DataMember("unexpected_key_behavior", &PivotWiderOptions::unexpected_key_behavior));
 }  // namespace
 }  // namespace internal
 
@@ -164,11 +187,24 @@ TDigestOptions::TDigestOptions(std::vector<double> q, uint32_t delta,
       min_count{min_count} {}
 constexpr char TDigestOptions::kTypeName[];
 
+ApproximateCountDistinctOptions::ApproximateCountDistinctOptions(int32_t precision)
+    : FunctionOptions(internal::kApproximateCountDistinctOptionsType),
+      precision(precision) {}
+constexpr char ApproximateCountDistinctOptions::kTypeName[];
+
 IndexOptions::IndexOptions(std::shared_ptr<Scalar> value)
     : FunctionOptions(internal::kIndexOptionsType), value{std::move(value)} {}
 IndexOptions::IndexOptions() : IndexOptions(std::make_shared<NullScalar>()) {}
 constexpr char IndexOptions::kTypeName[];
 
+PivotWiderOptions::PivotWiderOptions(std::vector<std::string> key_names,
+                                     UnexpectedKeyBehavior unexpected_key_behavior)
+    : FunctionOptions(internal::kPivotWiderOptionsType),
+      key_names(std::move(key_names)),
+      unexpected_key_behavior(unexpected_key_behavior) {}
+PivotWiderOptions::PivotWiderOptions() : PivotWiderOptions(std::vector<std::string>{}) {}
+constexpr char PivotWiderOptions::kTypeName[];
+
 namespace internal {
 void RegisterAggregateOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kScalarAggregateOptionsType));
@@ -177,7 +213,9 @@ void RegisterAggregateOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kVarianceOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kQuantileOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kTDigestOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kApproximateCountDistinctOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kIndexOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kPivotWiderOptionsType));
 }
 }  // namespace internal
 
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <string>
 #include <vector>
 
 #include "arrow/compute/function_options.h"
@@ -175,6 +176,48 @@ class ARROW_EXPORT TDigestOptions : public FunctionOptions {
   uint32_t min_count;
 };
 
+/// \brief Control approximate distinct count kernel behavior
+///
+/// The distinct values are estimated with a HyperLogLog sketch of 2^precision
+/// one-byte registers, whose relative standard error is about
+/// 1.04 / sqrt(2^precision).  Null values are not counted.
+class ARROW_EXPORT ApproximateCountDistinctOptions : public FunctionOptions {
+ public:
+  explicit ApproximateCountDistinctOptions(int32_t precision = 12);
+  static constexpr char const kTypeName[] = "ApproximateCountDistinctOptions";
+  static ApproximateCountDistinctOptions Defaults() {
+    return ApproximateCountDistinctOptions{};
+  }
+
+  /// The number of hash bits picking a register, between 4 and 18 inclusive
+  int32_t precision;
+};
+
+/// \brief Control the hash_pivot_wider kernel behavior
+///
+/// Each name in `key_names` becomes a field of the output struct, holding for each
+/// group the value found next to that pivot key.
+class ARROW_EXPORT PivotWiderOptions : public FunctionOptions {
+ public:
+  enum UnexpectedKeyBehavior {
+    /// Ignore pivot keys not in `key_names`
+    IGNORE,
+    /// Return an error on pivot keys not in `key_names`
+    RAISE,
+  };
+
+  explicit PivotWiderOptions(std::vector<std::string> key_names,
+                             UnexpectedKeyBehavior unexpected_key_behavior = IGNORE);
+  // Default constructor for serialization
+  PivotWiderOptions();
+  static constexpr char const kTypeName[] = "PivotWiderOptions";
+
+  /// The pivot keys, in output field order
+  std::vector<std::string> key_names;
+  /// What to do with pivot keys not in `key_names`
+  UnexpectedKeyBehavior unexpected_key_behavior;
+};
+
 /// \brief Control Index kernel behavior
 class ARROW_EXPORT IndexOptions : public FunctionOptions {
  public:
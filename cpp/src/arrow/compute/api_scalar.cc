@@ -335,6 +335,9 @@ static auto kMakeStructOptionsType = GetFunctionOptionsType<MakeStructOptions>(
 static auto kMapLookupOptionsType = GetFunctionOptionsType<MapLookupOptions>(
     DataMember("occurrence", &MapLookupOptions::occurrence),
     DataMember("query_key", &MapLookupOptions::query_key));
+static auto kMatchAnyOptionsType = GetFunctionOptionsType<MatchAnyOptions>(
+    DataMember("patterns", &MatchAnyOptions::patterns),
+    DataMember("ignore_case", &MatchAnyOptions::ignore_case));
 static auto kMatchSubstringOptionsType = GetFunctionOptionsType<MatchSubstringOptions>(
     DataMember("pattern", &MatchSubstringOptions::pattern),
     DataMember("ignore_case", &MatchSubstringOptions::ignore_case));
@@ -469,6 +472,13 @@ MapLookupOptions::MapLookupOptions()
     : MapLookupOptions(std::make_shared<NullScalar>(), Occurrence::FIRST) {}
 constexpr char MapLookupOptions::kTypeName[];
 
+MatchAnyOptions::MatchAnyOptions(std::vector<std::string> patterns, bool ignore_case)
+    : FunctionOptions(internal::kMatchAnyOptionsType),
+      patterns(std::move(patterns)),
+      ignore_case(ignore_case) {}
+MatchAnyOptions::MatchAnyOptions() : MatchAnyOptions({}, false) {}
+constexpr char MatchAnyOptions::kTypeName[];
+
 MatchSubstringOptions::MatchSubstringOptions(std::string pattern, bool ignore_case)
     : FunctionOptions(internal::kMatchSubstringOptionsType),
       pattern(std::move(pattern)),
@@ -686,6 +696,7 @@ void RegisterScalarOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kListSliceOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMakeStructOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMapLookupOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kMatchAnyOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kMatchSubstringOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kNullOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kPadOptionsType));
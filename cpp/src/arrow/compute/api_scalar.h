@@ -200,6 +200,19 @@ class ARROW_EXPORT MatchSubstringOptions : public FunctionOptions {
   bool ignore_case;
 };
 
+class ARROW_EXPORT MatchAnyOptions : public FunctionOptions {
+ public:
+  explicit MatchAnyOptions(std::vector<std::string> patterns, bool ignore_case = false);
+  MatchAnyOptions();
+  static constexpr char const kTypeName[] = "MatchAnyOptions";
+
+  /// The regexes (or LIKE patterns, depending on kernel) to look for inside input
+  /// values.
+  std::vector<std::string> patterns;
+  /// Whether to perform a case-insensitive match.
+  bool ignore_case;
+};
+
 class ARROW_EXPORT SplitOptions : public FunctionOptions {
  public:
   explicit SplitOptions(int64_t max_splits = -1, bool reverse = false);
@@ -392,6 +392,10 @@ Result<std::shared_ptr<Array>> DropNull(const Array& values, ExecContext* ctx) {
   return out.make_array();
 }
 
+Result<Datum> CompactViews(const Datum& values, ExecContext* ctx) {
+  return CallFunction("compact_views", {values}, ctx);
+}
+
 // ----------------------------------------------------------------------
 // Cumulative functions
 
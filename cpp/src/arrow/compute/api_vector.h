@@ -382,6 +382,22 @@ Result<Datum> DropNull(const Datum& values, ExecContext* ctx = NULLPTR);
 ARROW_EXPORT
 Result<std::shared_ptr<Array>> DropNull(const Array& values, ExecContext* ctx = NULLPTR);
 
+/// \brief Copy the out-of-line values of binary or string views to new buffers
+///
+/// Takes and filters of view arrays only compact the data buffers of their
+/// output when it references a small part of them.  This packs the out-of-line
+/// values of the non-null views into new data buffers, so that the output doesn't
+/// keep the unused bytes of the input buffers alive.
+///
+/// \param[in] values array or chunked array of binary or string views
+/// \param[in] ctx the function execution context, optional
+/// \return the resulting datum
+///
+/// \since 16.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Result<Datum> CompactViews(const Datum& values, ExecContext* ctx = NULLPTR);
+
 /// \brief Return indices that partition an array around n-th sorted element.
 ///
 /// Find index of n-th(0 based) smallest value and perform indirect
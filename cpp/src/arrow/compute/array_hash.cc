@@ -0,0 +1,402 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/array_hash.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/light_array_internal.h"
+#include "arrow/compute/util.h"
+#include "arrow/extension_type.h"
+#include "arrow/type.h"
+#include "arrow/util/binary_view_util.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/ree_util.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+// Hashes the values of an array into a buffer of hashes.  Nested values are hashed
+// by combining the hashes of their children, so that all the actual hashing happens
+// in batches in Hashing64::HashMultiColumn().
+class ArrayHasher {
+ public:
+  Status Init(MemoryPool* pool) {
+    ctx_.hardware_flags = arrow::internal::CpuInfo::GetInstance()->hardware_flags();
+    ctx_.stack = &stack_;
+    return stack_.Init(pool, 64 * util::MiniBatch::kMiniBatchLength);
+  }
+
+  Status Hash(const ArraySpan& array, uint64_t* out) {
+    const DataType* type = array.type;
+    if (type->id() == Type::EXTENSION) {
+      type = checked_cast<const ExtensionType&>(*type).storage_type().get();
+    }
+    switch (type->id()) {
+      case Type::DICTIONARY:
+        return HashDictionary(array, out);
+      case Type::STRUCT:
+        return HashStruct(array, out);
+      case Type::LIST:
+      case Type::MAP:
+        return HashList<int32_t>(array, out);
+      case Type::LARGE_LIST:
+        return HashList<int64_t>(array, out);
+      case Type::FIXED_SIZE_LIST:
+        return HashFixedSizeList(array, out);
+      case Type::LIST_VIEW:
+        return HashListView<int32_t>(array, out);
+      case Type::LARGE_LIST_VIEW:
+        return HashListView<int64_t>(array, out);
+      case Type::SPARSE_UNION:
+      case Type::DENSE_UNION:
+        return HashUnion(array, checked_cast<const UnionType&>(*type), out);
+      case Type::RUN_END_ENCODED:
+        return HashRunEndEncoded(array, out);
+      case Type::STRING_VIEW:
+      case Type::BINARY_VIEW:
+        return HashBinaryView(array, out);
+      default:
+        return HashKeyColumn(array, *type, out);
+    }
+  }
+
+ private:
+  // Fixed-width, boolean, null and (large) binary arrays: hash them directly
+  Status HashKeyColumn(const ArraySpan& array, const DataType& type, uint64_t* out) {
+    ARROW_ASSIGN_OR_RAISE(KeyColumnMetadata metadata,
+                          ColumnMetadataFromDataType(type.GetSharedPtr()));
+    const uint8_t* validity =
+        array.GetNullCount() > 0 ? array.buffers[0].data : nullptr;
+    KeyColumnArray column(metadata, array.offset + array.length, validity,
+                          array.buffers[1].data, array.buffers[2].data);
+    HashKeyColumn(column, array.offset, array.length, out);
+    return Status::OK();
+  }
+
+  void HashKeyColumn(const KeyColumnArray& column, int64_t offset, int64_t length,
+                     uint64_t* out) {
+    // HashMultiColumn() counts rows with 32 bits
+    constexpr int64_t kMaxRowsPerCall = int64_t{1} << 30;
+    for (int64_t start = 0; start < length; start += kMaxRowsPerCall) {
+      const int64_t num_rows = std::min(kMaxRowsPerCall, length - start);
+      Hashing64::HashMultiColumn({column.Slice(offset + start, num_rows)}, &ctx_,
+                                 out + start);
+    }
+  }
+
+  // Hash a child of a nested array, whose rows `offset` to `offset + length` are
+  // relative to the start of the child
+  Status HashChild(const ArraySpan& child, int64_t offset, int64_t length,
+                   std::vector<uint64_t>* out) {
+    ArraySpan slice = child;
+    slice.SetSlice(child.offset + offset, length);
+    out->resize(length);
+    return Hash(slice, out->data());
+  }
+
+  static void ZeroNulls(const ArraySpan& array, uint64_t* out) {
+    if (array.MayHaveNulls()) {
+      const uint8_t* validity = array.buffers[0].data;
+      for (int64_t i = 0; i < array.length; ++i) {
+        if (!bit_util::GetBit(validity, array.offset + i)) {
+          out[i] = 0;
+        }
+      }
+    }
+  }
+
+  // Dictionary values hash like the values themselves, so that equal values with
+  // different dictionaries have equal hashes
+  Status HashDictionary(const ArraySpan& array, uint64_t* out) {
+    std::vector<uint64_t> dictionary_hashes;
+    const ArraySpan& dictionary = array.dictionary();
+    RETURN_NOT_OK(HashChild(dictionary, 0, dictionary.length, &dictionary_hashes));
+    const auto& index_type =
+        *checked_cast<const DictionaryType&>(*array.type).index_type();
+    switch (index_type.id()) {
+      case Type::INT8:
+        GatherDictionaryHashes<int8_t>(array, dictionary_hashes, out);
+        break;
+      case Type::UINT8:
+        GatherDictionaryHashes<uint8_t>(array, dictionary_hashes, out);
+        break;
+      case Type::INT16:
+        GatherDictionaryHashes<int16_t>(array, dictionary_hashes, out);
+        break;
+      case Type::UINT16:
+        GatherDictionaryHashes<uint16_t>(array, dictionary_hashes, out);
+        break;
+      case Type::INT32:
+        GatherDictionaryHashes<int32_t>(array, dictionary_hashes, out);
+        break;
+      case Type::UINT32:
+        GatherDictionaryHashes<uint32_t>(array, dictionary_hashes, out);
+        break;
+      case Type::INT64:
+        GatherDictionaryHashes<int64_t>(array, dictionary_hashes, out);
+        break;
+      case Type::UINT64:
+        GatherDictionaryHashes<uint64_t>(array, dictionary_hashes, out);
+        break;
+      default:
+        return Status::TypeError("Invalid dictionary index type: ", index_type);
+    }
+    return Status::OK();
+  }
+
+  template <typename IndexCType>
+  static void GatherDictionaryHashes(const ArraySpan& array,
+                                     const std::vector<uint64_t>& dictionary_hashes,
+                                     uint64_t* out) {
+    const IndexCType* indices = array.GetValues<IndexCType>(1);
+    if (array.MayHaveNulls()) {
+      const uint8_t* validity = array.buffers[0].data;
+      for (int64_t i = 0; i < array.length; ++i) {
+        // The indices of null values may be out of bounds
+        out[i] = bit_util::GetBit(validity, array.offset + i)
+                     ? dictionary_hashes[indices[i]]
+                     : 0;
+      }
+    } else {
+      for (int64_t i = 0; i < array.length; ++i) {
+        out[i] = dictionary_hashes[indices[i]];
+      }
+    }
+  }
+
+  // Struct values hash like a row of their fields
+  Status HashStruct(const ArraySpan& array, uint64_t* out) {
+    std::fill(out, out + array.length, 0);
+    std::vector<uint64_t> child_hashes;
+    for (size_t i = 0; i < array.child_data.size(); ++i) {
+      RETURN_NOT_OK(
+          HashChild(array.child_data[i], array.offset, array.length, &child_hashes));
+      if (i == 0) {
+        std::copy(child_hashes.begin(), child_hashes.end(), out);
+      } else {
+        for (int64_t j = 0; j < array.length; ++j) {
+          out[j] = Hashing64::CombineHashes(out[j], child_hashes[j]);
+        }
+      }
+    }
+    ZeroNulls(array, out);
+    return Status::OK();
+  }
+
+  // Combine the hashes of the `size` elements of a list starting at `values`
+  static uint64_t HashListElements(const uint64_t* values, int64_t size) {
+    // Start from the size, so that empty lists don't hash like nulls
+    uint64_t hash = Hashing64::CombineHashes(0, static_cast<uint64_t>(size));
+    for (int64_t i = 0; i < size; ++i) {
+      hash = Hashing64::CombineHashes(hash, values[i]);
+    }
+    return hash;
+  }
+
+  template <typename OffsetType>
+  Status HashList(const ArraySpan& array, uint64_t* out) {
+    const OffsetType* offsets = array.GetValues<OffsetType>(1);
+    const int64_t values_start = offsets[0];
+    std::vector<uint64_t> value_hashes;
+    RETURN_NOT_OK(HashChild(array.child_data[0], values_start,
+                            offsets[array.length] - values_start, &value_hashes));
+    for (int64_t i = 0; i < array.length; ++i) {
+      out[i] = HashListElements(value_hashes.data() + (offsets[i] - values_start),
+                                offsets[i + 1] - offsets[i]);
+    }
+    ZeroNulls(array, out);
+    return Status::OK();
+  }
+
+  Status HashFixedSizeList(const ArraySpan& array, uint64_t* out) {
+    const int64_t list_size =
+        checked_cast<const FixedSizeListType&>(*array.type).list_size();
+    std::vector<uint64_t> value_hashes;
+    RETURN_NOT_OK(HashChild(array.child_data[0], array.offset * list_size,
+                            array.length * list_size, &value_hashes));
+    for (int64_t i = 0; i < array.length; ++i) {
+      out[i] = HashListElements(value_hashes.data() + i * list_size, list_size);
+    }
+    ZeroNulls(array, out);
+    return Status::OK();
+  }
+
+  template <typename OffsetType>
+  Status HashListView(const ArraySpan& array, uint64_t* out) {
+    // List views may share or skip values in any order: hash all of them
+    const ArraySpan& values = array.child_data[0];
+    std::vector<uint64_t> value_hashes;
+    RETURN_NOT_OK(HashChild(values, 0, values.length, &value_hashes));
+    const OffsetType* offsets = array.GetValues<OffsetType>(1);
+    const OffsetType* sizes = array.GetValues<OffsetType>(2);
+    const uint8_t* validity = array.MayHaveNulls() ? array.buffers[0].data : nullptr;
+    for (int64_t i = 0; i < array.length; ++i) {
+      // The offsets and sizes of null values may be invalid
+      if (validity != nullptr && !bit_util::GetBit(validity, array.offset + i)) {
+        out[i] = 0;
+      } else {
+        out[i] = HashListElements(value_hashes.data() + offsets[i], sizes[i]);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Union values hash like their type code and value
+  Status HashUnion(const ArraySpan& array, const UnionType& type, uint64_t* out) {
+    const int8_t* type_codes = array.GetValues<int8_t>(1);
+    const auto& child_ids = type.child_ids();
+    const bool is_dense = type.id() == Type::DENSE_UNION;
+    const int32_t* value_offsets = is_dense ? array.GetValues<int32_t>(2) : nullptr;
+
+    std::vector<std::vector<uint64_t>> child_hashes(array.child_data.size());
+    for (size_t i = 0; i < array.child_data.size(); ++i) {
+      const ArraySpan& child = array.child_data[i];
+      if (is_dense) {
+        RETURN_NOT_OK(HashChild(child, 0, child.length, &child_hashes[i]));
+      } else {
+        RETURN_NOT_OK(HashChild(child, array.offset, array.length, &child_hashes[i]));
+      }
+    }
+    for (int64_t i = 0; i < array.length; ++i) {
+      const int8_t type_code = type_codes[i];
+      const int64_t index = is_dense ? value_offsets[i] : i;
+      const uint64_t value_hash = child_hashes[child_ids[type_code]][index];
+      out[i] = value_hash == 0 ? 0
+                               : Hashing64::CombineHashes(
+                                     static_cast<uint64_t>(type_code), value_hash);
+    }
+    return Status::OK();
+  }
+
+  Status HashRunEndEncoded(const ArraySpan& array, uint64_t* out) {
+    const auto& run_end_type =
+        *checked_cast<const RunEndEncodedType&>(*array.type).run_end_type();
+    switch (run_end_type.id()) {
+      case Type::INT16:
+        return HashRunEndEncoded<int16_t>(array, out);
+      case Type::INT32:
+        return HashRunEndEncoded<int32_t>(array, out);
+      case Type::INT64:
+        return HashRunEndEncoded<int64_t>(array, out);
+      default:
+        return Status::TypeError("Invalid run end type: ", run_end_type);
+    }
+  }
+
+  template <typename RunEndCType>
+  Status HashRunEndEncoded(const ArraySpan& array, uint64_t* out) {
+    // Hash each run once
+    const ArraySpan& values = array.child_data[1];
+    const ree_util::RunEndEncodedArraySpan<RunEndCType> ree_span(array);
+    auto it = ree_span.begin();
+    if (it.is_end(ree_span)) {
+      return Status::OK();
+    }
+    const int64_t first_run = it.index_into_array();
+    const int64_t num_runs = ree_span.end().index_into_array() - first_run;
+    std::vector<uint64_t> value_hashes;
+    RETURN_NOT_OK(HashChild(values, first_run, num_runs, &value_hashes));
+    for (; !it.is_end(ree_span); ++it) {
+      std::fill_n(out + it.logical_position(), it.run_length(),
+                  value_hashes[it.index_into_array() - first_run]);
+    }
+    return Status::OK();
+  }
+
+  // Binary views hash like the non-view binary values
+  Status HashBinaryView(const ArraySpan& array, uint64_t* out) {
+    const auto* views = array.GetValues<BinaryViewType::c_type>(1);
+    const auto data_buffers = array.GetVariadicBuffers();
+    std::vector<uint64_t> offsets(array.length + 1);
+    int64_t data_size = 0;
+    for (int64_t i = 0; i < array.length; ++i) {
+      offsets[i] = data_size;
+      data_size += views[i].size();
+    }
+    offsets[array.length] = data_size;
+    std::vector<uint8_t> data(data_size);
+    for (int64_t i = 0; i < array.length; ++i) {
+      const std::string_view value = util::FromBinaryView(views[i], data_buffers.data());
+      std::copy(value.begin(), value.end(), data.begin() + offsets[i]);
+    }
+
+    const uint8_t* validity =
+        array.GetNullCount() > 0 ? array.buffers[0].data + array.offset / 8 : nullptr;
+    KeyColumnArray column(KeyColumnMetadata(/*is_fixed_length=*/false, sizeof(uint64_t)),
+                          array.length, validity,
+                          reinterpret_cast<const uint8_t*>(offsets.data()), data.data(),
+                          static_cast<int>(array.offset % 8));
+    HashKeyColumn(column, 0, array.length, out);
+    return Status::OK();
+  }
+
+  LightContext ctx_;
+  util::TempVectorStack stack_;
+};
+
+}  // namespace
+
+Status HashArray(const ArrayData& array, uint64_t* out, MemoryPool* pool) {
+  ArrayHasher hasher;
+  RETURN_NOT_OK(hasher.Init(pool));
+  return hasher.Hash(ArraySpan(array), out);
+}
+
+Status CombineHashArray(const ArrayData& array, uint64_t* hashes, MemoryPool* pool) {
+  ArrayHasher hasher;
+  RETURN_NOT_OK(hasher.Init(pool));
+  std::vector<uint64_t> array_hashes(array.length);
+  RETURN_NOT_OK(hasher.Hash(ArraySpan(array), array_hashes.data()));
+  for (int64_t i = 0; i < array.length; ++i) {
+    hashes[i] = Hashing64::CombineHashes(hashes[i], array_hashes[i]);
+  }
+  return Status::OK();
+}
+
+Status HashArrays(const ArrayDataVector& columns, uint64_t* out, MemoryPool* pool) {
+  if (columns.empty()) {
+    return Status::Invalid("HashArrays requires at least one column");
+  }
+  const int64_t length = columns[0]->length;
+  ArrayHasher hasher;
+  RETURN_NOT_OK(hasher.Init(pool));
+  RETURN_NOT_OK(hasher.Hash(ArraySpan(*columns[0]), out));
+  std::vector<uint64_t> column_hashes(length);
+  for (size_t i = 1; i < columns.size(); ++i) {
+    if (columns[i]->length != length) {
+      return Status::Invalid("HashArrays requires columns of the same length");
+    }
+    RETURN_NOT_OK(hasher.Hash(ArraySpan(*columns[i]), column_hashes.data()));
+    for (int64_t j = 0; j < length; ++j) {
+      out[j] = Hashing64::CombineHashes(out[j], column_hashes[j]);
+    }
+  }
+  return Status::OK();
+}
+
+}  // namespace compute
+}  // namespace arrow
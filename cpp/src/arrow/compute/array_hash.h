@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/array/data.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace compute {
+
+/// \defgroup compute-array-hash Hashing of array values
+///
+/// Vectorized 64-bit hashing of the values of arrays of any type, for e.g. hash
+/// partitioning.  Fixed-width and binary values are hashed in batches with the
+/// xxh3-based hashing of the hash join and group by (using AVX2 when available);
+/// the values of nested types are hashed from the hashes of their children.
+///
+/// Guarantees:
+/// - equal values of the same type have equal hashes, including dictionary values
+///   with different dictionaries and binary values of view and non-view types;
+/// - null values hash to 0;
+/// - values are compared by their bytes, e.g. 0.0 and -0.0 have different hashes.
+///
+/// The hashes are not stable across versions and must not be persisted.
+///
+/// @{
+
+/// \brief Hash each value of `array` into `out`, which must hold `array.length`
+/// hashes
+///
+/// \param[in] array the values to hash
+/// \param[out] out the hashes
+/// \param[in] pool the pool for temporary allocations
+ARROW_EXPORT Status HashArray(const ArrayData& array, uint64_t* out,
+                              MemoryPool* pool = default_memory_pool());
+
+/// \brief Combine the hash of each value of `array` into `hashes`
+///
+/// Calling HashArray() on a first column then CombineHashArray() on the next
+/// ones yields the same hashes as HashArrays().
+ARROW_EXPORT Status CombineHashArray(const ArrayData& array, uint64_t* hashes,
+                                     MemoryPool* pool = default_memory_pool());
+
+/// \brief Hash each row of `columns`, which must all have the same length, into
+/// `out`
+ARROW_EXPORT Status HashArrays(const ArrayDataVector& columns, uint64_t* out,
+                               MemoryPool* pool = default_memory_pool());
+
+/// @}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/compute/array_hash.h"
+#include "arrow/scalar.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace compute {
+
+std::vector<uint64_t> HashOf(const std::shared_ptr<Array>& array) {
+  std::vector<uint64_t> hashes(array->length());
+  ARROW_EXPECT_OK(HashArray(*array->data(), hashes.data()));
+  return hashes;
+}
+
+// Check that equal values have equal hashes, nulls hash to 0, different values have
+// different hashes and slicing doesn't change the hashes
+void CheckHashes(const std::shared_ptr<Array>& array) {
+  ARROW_SCOPED_TRACE(array->ToString());
+  const std::vector<uint64_t> hashes = HashOf(array);
+  for (int64_t i = 0; i < array->length(); ++i) {
+    if (array->IsNull(i)) {
+      ASSERT_EQ(hashes[i], 0U) << i;
+    }
+    for (int64_t j = 0; j < i; ++j) {
+      ASSERT_OK_AND_ASSIGN(auto left, array->GetScalar(i));
+      ASSERT_OK_AND_ASSIGN(auto right, array->GetScalar(j));
+      if (left->Equals(*right)) {
+        ASSERT_EQ(hashes[i], hashes[j]) << i << " " << j;
+      } else {
+        ASSERT_NE(hashes[i], hashes[j]) << i << " " << j;
+      }
+    }
+  }
+  for (int64_t offset : {1, 3}) {
+    if (offset > array->length()) continue;
+    const std::vector<uint64_t> sliced = HashOf(array->Slice(offset));
+    ASSERT_EQ(sliced, std::vector<uint64_t>(hashes.begin() + offset, hashes.end()));
+  }
+}
+
+TEST(HashArray, Primitive) {
+  CheckHashes(ArrayFromJSON(null(), "[null, null]"));
+  CheckHashes(ArrayFromJSON(boolean(), "[true, false, null, true, false, false]"));
+  for (const auto& type : {int8(), uint16(), int32(), int64(), float64()}) {
+    CheckHashes(ArrayFromJSON(type, "[1, 2, null, 1, 0, 42, 2, 5, null, 7]"));
+  }
+  CheckHashes(ArrayFromJSON(fixed_size_binary(3), R"(["abc", null, "abd", "abc"])"));
+  CheckHashes(ArrayFromJSON(decimal128(5, 2), R"(["1.23", null, "-1.23", "1.23"])"));
+}
+
+TEST(HashArray, Binary) {
+  const char* json = R"(["foo", "", null, "a string longer than twelve", "foo", ""])";
+  for (const auto& type : {utf8(), binary(), large_utf8(), utf8_view()}) {
+    CheckHashes(ArrayFromJSON(type, json));
+  }
+  // Views hash like the other binary types
+  ASSERT_EQ(HashOf(ArrayFromJSON(utf8_view(), json)),
+            HashOf(ArrayFromJSON(large_utf8(), json)));
+}
+
+TEST(HashArray, Dictionary) {
+  auto dict_type = dictionary(int8(), utf8());
+  auto dict_array = DictArrayFromJSON(dict_type, "[0, 1, null, 2, 0, 1]",
+                                      R"(["foo", "bar", "baz"])");
+  CheckHashes(dict_array);
+  // Values hash the same whatever the dictionary
+  auto other_dict_array = DictArrayFromJSON(dict_type, "[1, 0, null, 2, 1, 0]",
+                                            R"(["bar", "foo", "baz"])");
+  ASSERT_EQ(HashOf(dict_array), HashOf(other_dict_array));
+  auto decoded = ArrayFromJSON(utf8(), R"(["foo", "bar", null, "baz", "foo", "bar"])");
+  ASSERT_EQ(HashOf(dict_array), HashOf(decoded));
+}
+
+TEST(HashArray, Struct) {
+  auto type = struct_({field("a", int32()), field("b", utf8())});
+  CheckHashes(ArrayFromJSON(
+      type,
+      R"([[1, "x"], [1, "y"], null, [2, "x"], [1, "x"], [null, "x"], [1, null]])"));
+  CheckHashes(ArrayFromJSON(struct_({}), "[{}, null, {}]"));
+}
+
+TEST(HashArray, List) {
+  const char* json = "[[1, 2], [], null, [2, 1], [1, 2], [null], [1, 2, 3], [1]]";
+  for (const auto& type : {list(int16()), large_list(int16()), list_view(int16()),
+                           large_list_view(int16())}) {
+    CheckHashes(ArrayFromJSON(type, json));
+  }
+  // The offsets don't change the hashes
+  ASSERT_EQ(HashOf(ArrayFromJSON(list(int16()), json)),
+            HashOf(ArrayFromJSON(large_list_view(int16()), json)));
+
+  CheckHashes(ArrayFromJSON(fixed_size_list(int16(), 2),
+                            "[[1, 2], null, [2, 1], [1, 2], [null, 1], [1, null]]"));
+  CheckHashes(ArrayFromJSON(map(utf8(), int32()),
+                            R"([[["a", 1]], [], null, [["a", 2]], [["a", 1]]])"));
+}
+
+TEST(HashArray, Union) {
+  const char* json = R"([[0, 1], [1, "1"], [0, null], [0, 1], [1, "2"], [0, 2]])";
+  auto sparse_type = sparse_union({field("i", int32()), field("s", utf8())}, {0, 1});
+  auto dense_type = dense_union({field("i", int32()), field("s", utf8())}, {0, 1});
+  CheckHashes(ArrayFromJSON(sparse_type, json));
+  CheckHashes(ArrayFromJSON(dense_type, json));
+  ASSERT_EQ(HashOf(ArrayFromJSON(sparse_type, json)),
+            HashOf(ArrayFromJSON(dense_type, json)));
+}
+
+TEST(HashArray, RunEndEncoded) {
+  auto run_ends = ArrayFromJSON(int32(), "[2, 3, 6, 7]");
+  auto values = ArrayFromJSON(utf8(), R"(["a", null, "b", "a"])");
+  ASSERT_OK_AND_ASSIGN(auto ree_array, RunEndEncodedArray::Make(7, run_ends, values));
+  auto decoded = ArrayFromJSON(utf8(), R"(["a", "a", null, "b", "b", "b", "a"])");
+  ASSERT_EQ(HashOf(ree_array), HashOf(decoded));
+  ASSERT_EQ(HashOf(ree_array->Slice(1, 4)), HashOf(decoded->Slice(1, 4)));
+}
+
+TEST(HashArray, MultipleColumns) {
+  auto a = ArrayFromJSON(int32(), "[1, 1, 2, null, 1]");
+  auto b = ArrayFromJSON(utf8(), R"(["x", "y", "x", "x", "x"])");
+  std::vector<uint64_t> hashes(5);
+  ASSERT_OK(HashArrays({a->data(), b->data()}, hashes.data()));
+  ASSERT_EQ(hashes[0], hashes[4]);
+  ASSERT_NE(hashes[0], hashes[1]);
+  ASSERT_NE(hashes[0], hashes[2]);
+
+  std::vector<uint64_t> combined = HashOf(a);
+  ASSERT_OK(CombineHashArray(*b->data(), combined.data()));
+  ASSERT_EQ(hashes, combined);
+
+  // Same as the hashes of a struct
+  auto struct_array =
+      std::make_shared<StructArray>(struct_({field("a", int32()), field("b", utf8())}),
+                                    5, ArrayVector{a, b});
+  ASSERT_EQ(hashes, HashOf(struct_array));
+
+  ASSERT_RAISES(Invalid, HashArrays({}, hashes.data()));
+  ASSERT_RAISES(Invalid, HashArrays({a->data(), b->Slice(1)->data()}, hashes.data()));
+}
+
+}  // namespace compute
+}  // namespace arrow
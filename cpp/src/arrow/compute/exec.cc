@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -46,6 +47,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/counters.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
@@ -781,6 +783,12 @@ class KernelExecutorImpl : public KernelExecutor {
 class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
  public:
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
+    static util::Counter* const rows = util::GetCounter("compute.scalar.rows");
+    rows->Add(batch.length);
+
+    if (batch.selection_vector != NULLPTR) {
+      return ExecuteSelection(batch, listener);
+    }
     RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize()));
 
     if (batch.length == 0) {
@@ -824,6 +832,38 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
   }
 
  protected:
+  // The kernel runs densely over all the rows and only the selected rows of its output
+  // are gathered, which is cheaper than gathering every argument beforehand
+  Status ExecuteSelection(const ExecBatch& batch, ExecListener* listener) {
+    bool all_same_length = false;
+    ExecBatch dense(batch.values, InferBatchLength(batch.values, &all_same_length));
+    DatumAccumulator dense_listener;
+    RETURN_NOT_OK(Execute(dense, &dense_listener));
+    Datum dense_out = WrapResults(dense.values, dense_listener.values());
+    if (dense_out.is_scalar()) {
+      // All arguments were scalars and so is the output, for every row
+      return listener->OnResult(std::move(dense_out));
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum out, CallFunction("take",
+                                                  {std::move(dense_out),
+                                                   Datum(batch.selection_vector->data())},
+                                                  exec_context()));
+    if (out.is_array()) {
+      return listener->OnResult(std::move(out));
+    }
+    const ChunkedArray& chunks = *out.chunked_array();
+    if (chunks.num_chunks() == 0) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> empty,
+                            MakeArrayOfNull(output_type_.GetSharedPtr(), /*length=*/0,
+                                            exec_context()->memory_pool()));
+      return listener->OnResult(empty->data());
+    }
+    for (const std::shared_ptr<Array>& chunk : chunks.chunks()) {
+      RETURN_NOT_OK(listener->OnResult(chunk->data()));
+    }
+    return Status::OK();
+  }
+
   Status EmitResult(std::shared_ptr<ArrayData> out, ExecListener* listener) {
     if (span_iterator_.have_all_scalars()) {
       // ARROW-16757 We boxed scalar inputs as ArraySpan, so now we have to
@@ -1356,7 +1396,22 @@ int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->len
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
     const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+  // Null mask values are not selected, as by the filter function
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Mask too long for a selection vector: ", arr.length());
+  }
+  int64_t num_selected = arr.true_count();
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> indices,
+                        AllocateBuffer(num_selected * sizeof(int32_t)));
+  auto out = indices->mutable_data_as<int32_t>();
+  for (int64_t i = 0; i < arr.length(); ++i) {
+    if (arr.IsValid(i) && arr.Value(i)) {
+      *out++ = static_cast<int32_t>(i);
+    }
+  }
+  return std::make_shared<SelectionVector>(
+      ArrayData::Make(int32(), num_selected, {nullptr, std::move(indices)},
+                      /*null_count=*/0));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
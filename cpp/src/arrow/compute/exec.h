@@ -131,7 +131,8 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// Scalar functions executed on an ExecBatch with a selection vector only output
+/// the selected rows, see ExecBatch::selection_vector.
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -146,6 +147,9 @@ class ARROW_EXPORT SelectionVector {
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
+  /// \brief The indices as an int32 array without nulls
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
+
  private:
   std::shared_ptr<ArrayData> data_;
   const int32_t* indices_;
@@ -201,6 +205,11 @@ struct ARROW_EXPORT ExecBatch {
   /// For example, the filter [true, true, false, true] would be represented as
   /// the selection vector [0, 1, 3]. When the selection vector is set,
   /// ExecBatch::length is equal to the length of this array.
+  ///
+  /// Scalar functions executed on such a batch (see Function::Execute) only output
+  /// the selected rows; their kernels run over all the rows and the selection is
+  /// applied to the output, so that only one column is ever gathered.  Other
+  /// functions see the selected rows of their arguments.
   std::shared_ptr<SelectionVector> selection_vector;
 
   /// A predicate Expression guaranteed to evaluate to true for all rows in this batch.
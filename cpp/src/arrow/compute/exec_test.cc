@@ -25,6 +25,7 @@
 #include "arrow/testing/random.h"
 
 #include "arrow/array/array_base.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
@@ -153,6 +154,18 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = ArrayFromJSON(boolean(), "[true, false, null, true, true]");
+  const auto& bool_mask = checked_cast<const BooleanArray&>(*mask);
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(bool_mask));
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[0, 3, 4]"), *MakeArray(sel_vector->data()));
+
+  mask = ArrayFromJSON(boolean(), "[false, null]");
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(
+                                       checked_cast<const BooleanArray&>(*mask)));
+  ASSERT_EQ(0, sel_vector->length());
+}
+
 void AssertValidityZeroExtraBits(const uint8_t* data, int64_t length, int64_t offset) {
   const int64_t bit_extent = ((offset + length + 7) / 8) * 8;
   for (int64_t i = offset + length; i < bit_extent; ++i) {
@@ -1396,6 +1409,49 @@ TEST_F(TestCallScalarFunctionScalarFunction, ExecCall) {
   TestCallScalarFunctionScalarFunction::DoTest(ExecFunctionCaller::Maker);
 }
 
+TEST_F(TestCallScalarFunction, SelectionVector) {
+  auto left = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, 6, 7]");
+  auto right = ArrayFromJSON(int32(), "[10, 20, 30, 40, 50, 60, 70]");
+  ExecBatch batch({left, right}, /*length=*/3);
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[1, 4, 5]"));
+  auto expected = ArrayFromJSON(int32(), "[22, 55, 66]");
+
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("test_scalar_add_int32", batch));
+  AssertDatumsEqual(expected, result);
+
+  // The kernel output is split into chunks
+  ExecContext exec_ctx;
+  exec_ctx.set_exec_chunksize(2);
+  exec_ctx.set_preallocate_contiguous(false);
+  ASSERT_OK_AND_ASSIGN(result,
+                       CallFunction("test_scalar_add_int32", batch, &exec_ctx));
+  if (result.is_chunked_array()) {
+    ASSERT_OK_AND_ASSIGN(result, Concatenate(result.chunked_array()->chunks()));
+  }
+  AssertDatumsEqual(expected, result);
+
+  // Kernels that allocate their own output
+  ExecBatch uint8_batch({ArrayFromJSON(uint8(), "[1, null, 3, 4]")}, /*length=*/2);
+  uint8_batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[1, 3]"));
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("test_nopre_data", uint8_batch));
+  AssertDatumsEqual(ArrayFromJSON(uint8(), "[null, 4]"), result);
+
+  batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[]"));
+  batch.length = 0;
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("test_scalar_add_int32", batch));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[]"), result);
+
+  // Other functions see the selected rows
+  ExecBatch unique_batch({ArrayFromJSON(int32(), "[1, 2, 1, 3, 2]")}, /*length=*/3);
+  unique_batch.selection_vector =
+      std::make_shared<SelectionVector>(*ArrayFromJSON(int32(), "[0, 2, 4]"));
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("unique", unique_batch));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[1, 2]"), result);
+}
+
 TEST(Ordering, IsSuborderOf) {
   Ordering a{{SortKey{3}, SortKey{1}, SortKey{7}}};
   Ordering b{{SortKey{3}, SortKey{1}}};
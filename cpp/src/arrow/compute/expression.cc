@@ -18,6 +18,7 @@
 #include "arrow/compute/expression.h"
 
 #include <algorithm>
+#include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <unordered_set>
@@ -27,6 +28,7 @@
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/expression_internal.h"
 #include "arrow/compute/function_internal.h"
+#include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/compute/util.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
@@ -716,53 +718,50 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
-Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
-                                      compute::ExecContext* exec_context) {
-  if (exec_context == nullptr) {
-    compute::ExecContext exec_context;
-    return ExecuteScalarExpression(expr, input, &exec_context);
-  }
+namespace {
 
-  if (!expr.IsBound()) {
-    return Status::Invalid("Cannot Execute unbound expression.");
+// The calls occurring more than once in a set of expressions, and their results
+// against the current batch once evaluated
+struct CommonSubexpressions {
+  struct Entry {
+    int count = 0;
+    std::optional<Datum> value;
+  };
+  std::unordered_map<Expression, Entry, Expression::Hash> calls;
+
+  void Count(const Expression& expr) {
+    const Expression::Call* call = expr.call();
+    if (call == nullptr) return;
+    // The arguments of a repeated call are only evaluated once too
+    if (++calls[expr].count > 1) return;
+    for (const Expression& argument : call->arguments) {
+      Count(argument);
+    }
   }
 
-  if (!expr.IsScalarExpression()) {
-    return Status::Invalid(
-        "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
+  Entry* Find(const Expression& expr) {
+    if (!CallNotNull(expr)->function->is_pure()) return nullptr;
+    auto it = calls.find(expr);
+    return it != calls.end() && it->second.count > 1 ? &it->second : nullptr;
   }
+};
 
-  if (auto lit = expr.literal()) return *lit;
-
-  if (auto param = expr.parameter()) {
-    if (param->type.id() == Type::NA) {
-      return MakeNullScalar(null());
-    }
-
-    Datum field = input[param->indices[0]];
-    if (param->indices.size() > 1) {
-      std::vector<int> indices(param->indices.begin() + 1, param->indices.end());
-      compute::StructFieldOptions options(std::move(indices));
-      ARROW_ASSIGN_OR_RAISE(
-          field, compute::CallFunction("struct_field", {std::move(field)}, &options));
-    }
-    if (!field.type()->Equals(*param->type.type)) {
-      return Status::Invalid("Referenced field ", expr.ToString(), " was ",
-                             field.type()->ToString(), " but should have been ",
-                             param->type.ToString());
-    }
-
-    return field;
-  }
+Result<Datum> ExecuteScalarExpressionImpl(const Expression& expr, const ExecBatch& input,
+                                          compute::ExecContext* exec_context,
+                                          CommonSubexpressions* common);
 
+Result<Datum> ExecuteCall(const Expression& expr, const ExecBatch& input,
+                          compute::ExecContext* exec_context,
+                          CommonSubexpressions* common) {
   auto call = CallNotNull(expr);
 
   std::vector<Datum> arguments(call->arguments.size());
 
   bool all_scalar = true;
   for (size_t i = 0; i < arguments.size(); ++i) {
-    ARROW_ASSIGN_OR_RAISE(
-        arguments[i], ExecuteScalarExpression(call->arguments[i], input, exec_context));
+    ARROW_ASSIGN_OR_RAISE(arguments[i],
+                          ExecuteScalarExpressionImpl(call->arguments[i], input,
+                                                      exec_context, common));
     if (arguments[i].is_array()) {
       all_scalar = false;
     }
@@ -797,6 +796,83 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
   return out;
 }
 
+Result<Datum> ExecuteScalarExpressionImpl(const Expression& expr, const ExecBatch& input,
+                                          compute::ExecContext* exec_context,
+                                          CommonSubexpressions* common) {
+  if (!expr.IsBound()) {
+    return Status::Invalid("Cannot Execute unbound expression.");
+  }
+
+  if (!expr.IsScalarExpression()) {
+    return Status::Invalid(
+        "ExecuteScalarExpression cannot Execute non-scalar expression ", expr.ToString());
+  }
+
+  if (auto lit = expr.literal()) return *lit;
+
+  if (auto param = expr.parameter()) {
+    if (param->type.id() == Type::NA) {
+      return MakeNullScalar(null());
+    }
+
+    Datum field = input[param->indices[0]];
+    if (param->indices.size() > 1) {
+      std::vector<int> indices(param->indices.begin() + 1, param->indices.end());
+      compute::StructFieldOptions options(std::move(indices));
+      ARROW_ASSIGN_OR_RAISE(
+          field, compute::CallFunction("struct_field", {std::move(field)}, &options));
+    }
+    if (!field.type()->Equals(*param->type.type)) {
+      return Status::Invalid("Referenced field ", expr.ToString(), " was ",
+                             field.type()->ToString(), " but should have been ",
+                             param->type.ToString());
+    }
+
+    return field;
+  }
+
+  CommonSubexpressions::Entry* entry = common ? common->Find(expr) : nullptr;
+  if (entry != nullptr && entry->value.has_value()) {
+    return *entry->value;
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum out, ExecuteCall(expr, input, exec_context, common));
+  if (entry != nullptr) {
+    entry->value = out;
+  }
+  return out;
+}
+
+}  // namespace
+
+Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
+                                      compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpression(expr, input, &exec_context);
+  }
+  return ExecuteScalarExpressionImpl(expr, input, exec_context, /*common=*/nullptr);
+}
+
+Result<std::vector<Datum>> ExecuteScalarExpressions(const std::vector<Expression>& exprs,
+                                                    const ExecBatch& input,
+                                                    compute::ExecContext* exec_context) {
+  if (exec_context == nullptr) {
+    compute::ExecContext exec_context;
+    return ExecuteScalarExpressions(exprs, input, &exec_context);
+  }
+
+  CommonSubexpressions common;
+  for (const Expression& expr : exprs) {
+    if (expr.IsBound()) common.Count(expr);
+  }
+  std::vector<Datum> results(exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(results[i], ExecuteScalarExpressionImpl(exprs[i], input,
+                                                                  exec_context, &common));
+  }
+  return results;
+}
+
 namespace {
 
 std::array<std::pair<const Expression&, const Expression&>, 2>
@@ -1053,6 +1129,101 @@ Result<Expression> HandleInconsistentTypes(Expression::Call call,
   return BindNonRecursive(std::move(call), /*insert_implicit_casts=*/false, exec_context);
 }
 
+// Append the regexes matched by a call to a regex or LIKE matching function
+bool GetMatchedRegexes(const Expression::Call& call, std::vector<std::string>* regexes,
+                       bool* ignore_case) {
+  if (call.options == nullptr) return false;
+  if (call.function_name == "match_substring_regex" ||
+      call.function_name == "match_like") {
+    const auto& options = checked_cast<const MatchSubstringOptions&>(*call.options);
+    regexes->push_back(call.function_name == "match_like"
+                           ? internal::MakeLikeRegex(options.pattern)
+                           : options.pattern);
+    *ignore_case = options.ignore_case;
+    return true;
+  }
+  if (call.function_name == "match_any_regex" || call.function_name == "match_any_like") {
+    const auto& options = checked_cast<const MatchAnyOptions&>(*call.options);
+    for (const auto& pattern : options.patterns) {
+      regexes->push_back(call.function_name == "match_any_like"
+                             ? internal::MakeLikeRegex(pattern)
+                             : pattern);
+    }
+    *ignore_case = options.ignore_case;
+    return true;
+  }
+  return false;
+}
+
+// Replace the operands of an "or" chain which match the same strings against regex
+// or LIKE patterns with a single call to match_any_regex, which matches all patterns
+// in one pass over the strings. Returns whether any operands were replaced.
+Result<bool> MergeRegexMatches(std::vector<Expression>* operands,
+                               compute::ExecContext* exec_context) {
+  struct Matches {
+    Expression strings;
+    bool ignore_case;
+    std::vector<std::string> regexes;
+    std::vector<size_t> operand_indices;
+  };
+  std::vector<Matches> all_matches;
+  for (size_t i = 0; i < operands->size(); ++i) {
+    auto call = (*operands)[i].call();
+    if (!call || call->arguments.size() != 1) continue;
+    std::vector<std::string> regexes;
+    bool ignore_case;
+    if (!GetMatchedRegexes(*call, &regexes, &ignore_case)) continue;
+
+    auto it = std::find_if(all_matches.begin(), all_matches.end(),
+                           [&](const Matches& matches) {
+                             return matches.ignore_case == ignore_case &&
+                                    matches.strings == call->arguments[0];
+                           });
+    if (it == all_matches.end()) {
+      all_matches.push_back({call->arguments[0], ignore_case, {}, {}});
+      it = all_matches.end() - 1;
+    }
+    std::move(regexes.begin(), regexes.end(), std::back_inserter(it->regexes));
+    it->operand_indices.push_back(i);
+  }
+
+  // Not available without RE2
+  if (!exec_context->func_registry()->GetFunction("match_any_regex").ok()) {
+    return false;
+  }
+
+  std::vector<bool> merged(operands->size(), false);
+  bool any_merged = false;
+  for (auto& matches : all_matches) {
+    if (matches.operand_indices.size() < 2) continue;
+
+    Expression::Call match_any;
+    match_any.function_name = "match_any_regex";
+    match_any.arguments = {std::move(matches.strings)};
+    match_any.options = std::make_shared<MatchAnyOptions>(std::move(matches.regexes),
+                                                          matches.ignore_case);
+    ARROW_ASSIGN_OR_RAISE(
+        (*operands)[matches.operand_indices.front()],
+        BindNonRecursive(std::move(match_any),
+                         /*insert_implicit_casts=*/false, exec_context));
+    for (auto it = matches.operand_indices.begin() + 1;
+         it != matches.operand_indices.end(); ++it) {
+      merged[*it] = true;
+    }
+    any_merged = true;
+  }
+  if (!any_merged) return false;
+
+  size_t num_remaining = 0;
+  for (size_t i = 0; i < operands->size(); ++i) {
+    if (!merged[i]) {
+      (*operands)[num_remaining++] = std::move((*operands)[i]);
+    }
+  }
+  operands->resize(num_remaining);
+  return true;
+}
+
 }  // namespace
 
 Result<Expression> Canonicalize(Expression expr, compute::ExecContext* exec_context) {
@@ -1104,7 +1275,16 @@ Result<Expression> Canonicalize(Expression expr, compute::ExecContext* exec_cont
 
           FlattenedAssociativeChain chain(expr);
 
-          if (chain.was_left_folded &&
+          bool merged_regex_matches = false;
+          if (call->function_name == "or" || call->function_name == "or_kleene") {
+            ARROW_ASSIGN_OR_RAISE(merged_regex_matches,
+                                  MergeRegexMatches(&chain.fringe, exec_context));
+            if (chain.fringe.size() == 1) {
+              return std::move(chain.fringe.front());
+            }
+          }
+
+          if (!merged_regex_matches && chain.was_left_folded &&
               std::is_sorted(chain.fringe.begin(), chain.fringe.end(),
                              CanonicalOrdering)) {
             // fast path for expressions which happen to have arrived in an
@@ -1345,17 +1525,26 @@ Result<Expression> SimplifyIsValidGuarantee(Expression expr,
       });
 }
 
-}  // namespace
-
-Result<Expression> SimplifyWithGuarantee(Expression expr,
-                                         const Expression& guaranteed_true_predicate) {
+// The parts of a guarantee used by SimplifyWithGuarantee(), which only depend on it
+struct PreparedGuarantee {
   KnownFieldValues known_values;
-  auto conjunction_members = GuaranteeConjunctionMembers(guaranteed_true_predicate);
+  // Conjunction members not represented in known_values
+  std::vector<Expression> conjunction_members;
+};
 
-  RETURN_NOT_OK(ExtractKnownFieldValues(&conjunction_members, &known_values));
+Result<std::shared_ptr<const PreparedGuarantee>> PrepareGuarantee(
+    const Expression& guaranteed_true_predicate) {
+  auto prepared = std::make_shared<PreparedGuarantee>();
+  prepared->conjunction_members = GuaranteeConjunctionMembers(guaranteed_true_predicate);
+  RETURN_NOT_OK(
+      ExtractKnownFieldValues(&prepared->conjunction_members, &prepared->known_values));
+  return prepared;
+}
 
-  ARROW_ASSIGN_OR_RAISE(expr,
-                        ReplaceFieldsWithKnownValues(known_values, std::move(expr)));
+Result<Expression> SimplifyWithPreparedGuarantee(Expression expr,
+                                                 const PreparedGuarantee& prepared) {
+  ARROW_ASSIGN_OR_RAISE(
+      expr, ReplaceFieldsWithKnownValues(prepared.known_values, std::move(expr)));
 
   auto CanonicalizeAndFoldConstants = [&expr] {
     ARROW_ASSIGN_OR_RAISE(expr, Canonicalize(std::move(expr)));
@@ -1364,7 +1553,7 @@ Result<Expression> SimplifyWithGuarantee(Expression expr,
   };
   RETURN_NOT_OK(CanonicalizeAndFoldConstants());
 
-  for (const auto& guarantee : conjunction_members) {
+  for (const auto& guarantee : prepared.conjunction_members) {
     if (!guarantee.call()) continue;
 
     if (auto inequality = Inequality::ExtractOne(guarantee)) {
@@ -1396,6 +1585,68 @@ Result<Expression> SimplifyWithGuarantee(Expression expr,
   return expr;
 }
 
+}  // namespace
+
+Result<Expression> SimplifyWithGuarantee(Expression expr,
+                                         const Expression& guaranteed_true_predicate) {
+  ARROW_ASSIGN_OR_RAISE(auto prepared, PrepareGuarantee(guaranteed_true_predicate));
+  return SimplifyWithPreparedGuarantee(std::move(expr), *prepared);
+}
+
+struct SimplifyWithGuaranteeCache::Impl {
+  using Key = std::pair<Expression, Expression>;
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      size_t hash = key.first.hash();
+      arrow::internal::hash_combine(hash, key.second.hash());
+      return hash;
+    }
+  };
+
+  explicit Impl(int64_t capacity) : capacity(capacity) {}
+
+  const int64_t capacity;
+  std::mutex mutex;
+  std::unordered_map<Expression, std::shared_ptr<const PreparedGuarantee>,
+                     Expression::Hash>
+      guarantees;
+  std::unordered_map<Key, Expression, KeyHash> simplified;
+};
+
+SimplifyWithGuaranteeCache::SimplifyWithGuaranteeCache(int64_t capacity)
+    : impl_(std::make_unique<Impl>(capacity)) {}
+
+SimplifyWithGuaranteeCache::~SimplifyWithGuaranteeCache() = default;
+
+Result<Expression> SimplifyWithGuaranteeCache::Simplify(
+    const Expression& expr, const Expression& guaranteed_true_predicate) {
+  Impl::Key key{expr, guaranteed_true_predicate};
+  std::shared_ptr<const PreparedGuarantee> prepared;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex);
+    auto it = impl_->simplified.find(key);
+    if (it != impl_->simplified.end()) return it->second;
+    auto guarantee_it = impl_->guarantees.find(guaranteed_true_predicate);
+    if (guarantee_it != impl_->guarantees.end()) prepared = guarantee_it->second;
+  }
+
+  // Simplify without holding the lock; concurrent misses on the same key do the
+  // same work and store the same result.
+  if (prepared == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(prepared, PrepareGuarantee(guaranteed_true_predicate));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithPreparedGuarantee(expr, *prepared));
+
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  if (static_cast<int64_t>(impl_->simplified.size()) >= impl_->capacity) {
+    impl_->simplified.clear();
+    impl_->guarantees.clear();
+  }
+  impl_->guarantees.emplace(guaranteed_true_predicate, std::move(prepared));
+  impl_->simplified.emplace(std::move(key), simplified);
+  return simplified;
+}
+
 Result<Expression> RemoveNamedRefs(Expression src) {
   if (!src.IsBound()) {
     return Status::Invalid("RemoveNamedRefs called on unbound expression");
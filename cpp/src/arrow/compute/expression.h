@@ -224,6 +224,32 @@ ARROW_EXPORT
 Result<Expression> SimplifyWithGuarantee(Expression,
                                          const Expression& guaranteed_true_predicate);
 
+/// \brief A thread-safe memo of SimplifyWithGuarantee()
+///
+/// The fragments of a dataset usually share a few partition expressions, so
+/// simplifying a filter against the guarantee of every fragment repeats the same work.
+/// A cache simplifies each distinct (expression, guarantee) pair once, and splits each
+/// distinct guarantee into known field values and remaining conjunction members once.
+///
+/// Keys are compared with Expression::Equals, which does not compare the types field
+/// references were bound to: a cache must only be used for expressions bound to a
+/// single schema, such as those of one scan.
+class ARROW_EXPORT SimplifyWithGuaranteeCache {
+ public:
+  /// \param[in] capacity the number of simplified pairs kept; the cache is emptied
+  /// when it is reached
+  explicit SimplifyWithGuaranteeCache(int64_t capacity = 4096);
+  ~SimplifyWithGuaranteeCache();
+
+  /// \brief Return SimplifyWithGuarantee(expr, guaranteed_true_predicate)
+  Result<Expression> Simplify(const Expression& expr,
+                              const Expression& guaranteed_true_predicate);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// Replace all named field refs (e.g. "x" or "x.y") with field paths (e.g. [0] or [1,3])
 ///
 /// This isn't usually needed and does not offer any simplification by itself.  However,
@@ -252,6 +278,14 @@ ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Schema& full_schema,
                                       const Datum& partial_input, ExecContext* = NULLPTR);
 
+/// Execute several scalar expressions against the same input ExecBatch. Calls to pure
+/// functions which occur more than once, whether in different expressions or within
+/// one of them, are only evaluated once. The expressions must be bound.
+ARROW_EXPORT
+Result<std::vector<Datum>> ExecuteScalarExpressions(const std::vector<Expression>&,
+                                                    const ExecBatch& input,
+                                                    ExecContext* = NULLPTR);
+
 // Serialization
 
 ARROW_EXPORT
@@ -32,6 +32,7 @@
 #include "arrow/compute/registry.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
+#include "arrow/util/config.h"
 
 using testing::Eq;
 using testing::HasSubstr;
@@ -909,6 +910,41 @@ TEST(Expression, ExecuteCallWithNoArguments) {
   EXPECT_EQ(actual.length(), kCount);
 }
 
+TEST(Expression, ExecuteCommonSubexpressions) {
+  auto input_schema = schema({field("i32", int32()), field("f32", float32())});
+  auto input = RecordBatchFromJSON(input_schema, R"([
+    {"i32": 1, "f32": 0.5},
+    {"i32": null, "f32": 1.5},
+    {"i32": 3, "f32": -2.0}
+  ])");
+  ASSERT_OK_AND_ASSIGN(ExecBatch batch, MakeExecBatch(*kBoringSchema, input));
+
+  auto as_i64 = call("cast", {field_ref("i32")}, CastOptions::Safe(int64()));
+  std::vector<Expression> exprs = {
+      add(as_i64, literal(int64_t(1))),
+      call("multiply", {as_i64, as_i64}),
+      as_i64,
+      add(field_ref("f32"), literal(1.0f)),
+      call("random", {}, RandomOptions::FromSystemRandom()),
+      call("random", {}, RandomOptions::FromSystemRandom()),
+  };
+  for (auto& expr : exprs) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(*kBoringSchema));
+  }
+
+  ASSERT_OK_AND_ASSIGN(std::vector<Datum> actual, ExecuteScalarExpressions(exprs, batch));
+  ASSERT_EQ(actual.size(), exprs.size());
+  for (size_t i = 0; i + 2 < exprs.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(exprs[i], batch));
+    AssertDatumsEqual(expected, actual[i], /*verbose=*/true);
+  }
+  // The common subexpression was computed once and its result reused
+  ASSERT_OK_AND_ASSIGN(auto twice, ExecuteScalarExpressions({exprs[2], exprs[2]}, batch));
+  ASSERT_EQ(twice[0].array(), twice[1].array());
+  // but calls to impure functions are not shared
+  ASSERT_FALSE(actual[4].Equals(actual[5]));
+}
+
 TEST(Expression, ExecuteDictionaryTransparent) {
   ExpectExecute(
       equal(field_ref("a"), field_ref("b")),
@@ -1252,6 +1288,34 @@ TEST(Expression, CanonicalizeComparison) {
                         less(field_ref("i32"), literal(1)));
 }
 
+#ifdef ARROW_WITH_RE2
+TEST(Expression, CanonicalizeRegexMatches) {
+  auto regex = [](std::string pattern, bool ignore_case = false) {
+    return call("match_substring_regex", {field_ref("str")},
+                MatchSubstringOptions(std::move(pattern), ignore_case));
+  };
+  auto like = [](std::string pattern) {
+    return call("match_like", {field_ref("str")}, MatchSubstringOptions(pattern));
+  };
+  auto match_any = [](std::vector<std::string> patterns) {
+    return call("match_any_regex", {field_ref("str")},
+                MatchAnyOptions(std::move(patterns)));
+  };
+  auto b = field_ref("bool");
+
+  ExpectCanonicalizesTo(or_(regex("a"), regex("b")), match_any({"a", "b"}));
+  ExpectCanonicalizesTo(or_({regex("a"), b, like("b%"), regex("c")}),
+                        or_(match_any({"a", "(?s:^b.*$)", "c"}), b));
+  ExpectCanonicalizesTo(or_(match_any({"a", "b"}), regex("c")),
+                        match_any({"a", "b", "c"}));
+
+  // only matches with the same options on the same strings are merged
+  ExpectCanonicalizesTo(or_(regex("a"), regex("b", /*ignore_case=*/true)),
+                        or_(regex("a"), regex("b", /*ignore_case=*/true)));
+  ExpectCanonicalizesTo(and_(regex("a"), regex("b")), and_(regex("a"), regex("b")));
+}
+#endif
+
 struct Simplify {
   Expression expr;
 
@@ -1581,6 +1645,27 @@ TEST(Expression, SimplifyWithComparisonAndNullableCaveat) {
           true_unless_null(field_ref("i32"))));  // not satisfiable, will drop row group
 }
 
+TEST(Expression, SimplifyWithGuaranteeCache) {
+  ASSERT_OK_AND_ASSIGN(auto filter, and_(greater(field_ref("i32"), literal(3)),
+                                         is_valid(field_ref("f32")))
+                                        .Bind(*kBoringSchema));
+  std::vector<Expression> guarantees = {
+      equal(field_ref("i32"), literal(5)),
+      and_(less(field_ref("i32"), literal(2)), is_valid(field_ref("f32"))),
+      is_null(field_ref("f32")),
+  };
+
+  // Fewer entries than pairs simplified, so that the cache is emptied along the way
+  SimplifyWithGuaranteeCache cache(/*capacity=*/2);
+  for (int round = 0; round < 3; ++round) {
+    for (const auto& guarantee : guarantees) {
+      ASSERT_OK_AND_ASSIGN(auto expected, SimplifyWithGuarantee(filter, guarantee));
+      ASSERT_OK_AND_ASSIGN(auto simplified, cache.Simplify(filter, guarantee));
+      EXPECT_EQ(simplified, expected) << "  guarantee:  " << guarantee.ToString();
+    }
+  }
+}
+
 TEST(Expression, SimplifyThenExecute) {
   auto filter =
       or_({equal(field_ref("f32"), literal(0)),
@@ -1592,7 +1677,8 @@ TEST(Expression, SimplifyThenExecute) {
 
   ASSERT_OK_AND_ASSIGN(auto simplified, SimplifyWithGuarantee(filter, guarantee));
 
-  auto input = RecordBatchFromJSON(kBoringSchema, R"([
+  auto input_schema = schema({field("i32", int32()), field("f32", float32())});
+  auto input = RecordBatchFromJSON(input_schema, R"([
       {"i64": 0, "f32": 0.1},
       {"i64": 0, "f32": 0.3},
       {"i64": 1, "f32": 0.5},
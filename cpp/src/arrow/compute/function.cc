@@ -22,7 +22,9 @@
 #include <sstream>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
+#include "arrow/compute/cast_internal.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/function_internal.h"
@@ -181,10 +183,14 @@ const Kernel* DispatchExactImpl(const Function* func,
 }
 
 struct FunctionExecutorImpl : public FunctionExecutor {
-  FunctionExecutorImpl(std::vector<TypeHolder> in_types, const Kernel* kernel,
+  FunctionExecutorImpl(std::vector<TypeHolder> arg_types,
+                       std::vector<TypeHolder> in_types, const Kernel* kernel,
                        std::unique_ptr<detail::KernelExecutor> executor,
                        const Function& func)
-      : in_types(std::move(in_types)),
+      : arg_types(std::move(arg_types)),
+        in_types(std::move(in_types)),
+        cast_options(this->in_types.size()),
+        casts(this->in_types.size()),
         kernel(kernel),
         kernel_ctx(default_exec_context(), kernel),
         executor(std::move(executor)),
@@ -216,10 +222,41 @@ struct FunctionExecutorImpl : public FunctionExecutor {
       exec_ctx = default_exec_context();
     }
     kernel_ctx = KernelContext{exec_ctx, kernel};
-    return KernelInit(options);
+    RETURN_NOT_OK(KernelInit(options));
+    return PrepareCasts(exec_ctx);
+  }
+
+  // Prepare the implicit casts of the arguments to the kernel's input types, so
+  // that they aren't dispatched again on every execution
+  Status PrepareCasts(ExecContext* exec_ctx) {
+    for (size_t i = 0; i < in_types.size(); ++i) {
+      casts[i].reset();
+      if (arg_types[i] == NULLPTR || arg_types[i] == in_types[i]) {
+        continue;
+      }
+      auto maybe_cast_func = internal::GetCastFunction(*in_types[i]);
+      if (!maybe_cast_func.ok()) {
+        // Left to Cast(), which reports the error if the argument comes
+        continue;
+      }
+      auto maybe_cast = (*maybe_cast_func)->GetBestExecutor({arg_types[i]});
+      if (!maybe_cast.ok()) {
+        continue;
+      }
+      cast_options[i] = CastOptions::Safe(in_types[i]);
+      RETURN_NOT_OK((*maybe_cast)->Init(&cast_options[i], exec_ctx));
+      casts[i] = *std::move(maybe_cast);
+    }
+    return Status::OK();
   }
 
   Result<Datum> Execute(const std::vector<Datum>& args, int64_t passed_length) override {
+    return Execute(args, passed_length, /*selection=*/NULLPTR);
+  }
+
+  // `selection` may only be given to scalar functions
+  Result<Datum> Execute(const std::vector<Datum>& args, int64_t passed_length,
+                        std::shared_ptr<SelectionVector> selection) {
     util::tracing::Span span;
 
     auto func_kind = func.kind();
@@ -243,7 +280,11 @@ struct FunctionExecutorImpl : public FunctionExecutor {
       const auto& in_type = in_types[i];
       auto arg = args[i];
       if (in_type != args[i].type()) {
-        ARROW_ASSIGN_OR_RAISE(arg, Cast(args[i], CastOptions::Safe(in_type), ctx));
+        if (casts[i] != NULLPTR && arg_types[i] == args[i].type()) {
+          ARROW_ASSIGN_OR_RAISE(arg, casts[i]->Execute({args[i]}));
+        } else {
+          ARROW_ASSIGN_OR_RAISE(arg, Cast(args[i], CastOptions::Safe(in_type), ctx));
+        }
       }
       args_with_cast[i] = std::move(arg);
     }
@@ -259,7 +300,12 @@ struct FunctionExecutorImpl : public FunctionExecutor {
       bool all_same_length = false;
       int64_t inferred_length = detail::InferBatchLength(input.values, &all_same_length);
       input.length = inferred_length;
-      if (func_kind == Function::SCALAR) {
+      if (selection != NULLPTR) {
+        // The kernel runs over all the rows of the arguments
+        DCHECK_EQ(func_kind, Function::SCALAR);
+        input.length = selection->length();
+        input.selection_vector = std::move(selection);
+      } else if (func_kind == Function::SCALAR) {
         if (passed_length != -1 && passed_length != inferred_length) {
           return Status::Invalid(
               "Passed batch length for execution did not match actual"
@@ -282,7 +328,12 @@ struct FunctionExecutorImpl : public FunctionExecutor {
     return out;
   }
 
+  // The argument types the executor was obtained for
+  std::vector<TypeHolder> arg_types;
+  // The input types of the kernel, which the arguments are implicitly cast to
   std::vector<TypeHolder> in_types;
+  std::vector<CastOptions> cast_options;
+  std::vector<std::shared_ptr<FunctionExecutor>> casts;
   const Kernel* kernel;
   KernelContext kernel_ctx;
   std::unique_ptr<detail::KernelExecutor> executor;
@@ -312,27 +363,28 @@ Result<const Kernel*> Function::DispatchBest(std::vector<TypeHolder>* values) co
   return DispatchExact(*values);
 }
 
-Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
-    std::vector<TypeHolder> inputs) const {
+namespace {
+
+Result<std::shared_ptr<detail::FunctionExecutorImpl>> MakeFunctionExecutor(
+    const Function& func, std::vector<TypeHolder> inputs) {
   std::unique_ptr<detail::KernelExecutor> executor;
-  if (kind() == Function::SCALAR) {
+  if (func.kind() == Function::SCALAR) {
     executor = detail::KernelExecutor::MakeScalar();
-  } else if (kind() == Function::VECTOR) {
+  } else if (func.kind() == Function::VECTOR) {
     executor = detail::KernelExecutor::MakeVector();
-  } else if (kind() == Function::SCALAR_AGGREGATE) {
+  } else if (func.kind() == Function::SCALAR_AGGREGATE) {
     executor = detail::KernelExecutor::MakeScalarAggregate();
   } else {
     return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
   }
 
-  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, DispatchBest(&inputs));
+  std::vector<TypeHolder> arg_types = inputs;
+  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, func.DispatchBest(&inputs));
 
-  return std::make_shared<detail::FunctionExecutorImpl>(std::move(inputs), kernel,
-                                                        std::move(executor), *this);
+  return std::make_shared<detail::FunctionExecutorImpl>(
+      std::move(arg_types), std::move(inputs), kernel, std::move(executor), func);
 }
 
-namespace {
-
 Result<Datum> ExecuteInternal(const Function& func, std::vector<Datum> args,
                               int64_t passed_length, const FunctionOptions* options,
                               ExecContext* ctx) {
@@ -342,8 +394,25 @@ Result<Datum> ExecuteInternal(const Function& func, std::vector<Datum> args,
   return func_exec->Execute(args, passed_length);
 }
 
+// The selected rows of the batch's values
+Result<std::vector<Datum>> MaterializeSelection(const ExecBatch& batch,
+                                                ExecContext* ctx) {
+  std::vector<Datum> values = batch.values;
+  Datum indices(batch.selection_vector->data());
+  for (Datum& value : values) {
+    if (value.is_scalar()) continue;
+    ARROW_ASSIGN_OR_RAISE(value, Take(value, indices, TakeOptions::Defaults(), ctx));
+  }
+  return values;
+}
+
 }  // namespace
 
+Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
+    std::vector<TypeHolder> inputs) const {
+  return MakeFunctionExecutor(*this, std::move(inputs));
+}
+
 Result<Datum> Function::Execute(const std::vector<Datum>& args,
                                 const FunctionOptions* options, ExecContext* ctx) const {
   return ExecuteInternal(*this, args, /*passed_length=*/-1, options, ctx);
@@ -351,7 +420,18 @@ Result<Datum> Function::Execute(const std::vector<Datum>& args,
 
 Result<Datum> Function::Execute(const ExecBatch& batch, const FunctionOptions* options,
                                 ExecContext* ctx) const {
-  return ExecuteInternal(*this, batch.values, batch.length, options, ctx);
+  if (batch.selection_vector == NULLPTR) {
+    return ExecuteInternal(*this, batch.values, batch.length, options, ctx);
+  }
+  if (kind() != Function::SCALAR) {
+    // Only scalar kernels apply a selection themselves
+    ARROW_ASSIGN_OR_RAISE(std::vector<Datum> args, MaterializeSelection(batch, ctx));
+    return ExecuteInternal(*this, std::move(args), batch.length, options, ctx);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto inputs, internal::GetFunctionArgumentTypes(batch.values));
+  ARROW_ASSIGN_OR_RAISE(auto func_exec, MakeFunctionExecutor(*this, std::move(inputs)));
+  ARROW_RETURN_NOT_OK(func_exec->Init(options, ctx));
+  return func_exec->Execute(batch.values, batch.length, batch.selection_vector);
 }
 
 namespace {
@@ -485,6 +565,10 @@ Result<Datum> MetaFunction::Execute(const std::vector<Datum>& args,
 Result<Datum> MetaFunction::Execute(const ExecBatch& batch,
                                     const FunctionOptions* options,
                                     ExecContext* ctx) const {
+  if (batch.selection_vector != NULLPTR) {
+    ARROW_ASSIGN_OR_RAISE(std::vector<Datum> args, MaterializeSelection(batch, ctx));
+    return Execute(args, options, ctx);
+  }
   return Execute(batch.values, options, ctx);
 }
 
@@ -113,6 +113,10 @@ struct ARROW_EXPORT FunctionDoc {
 };
 
 /// \brief An executor of a function with a preconfigured kernel
+///
+/// The kernel, its state and the implicit casts of the arguments are resolved
+/// once, which makes repeated executions on small batches much cheaper than
+/// CallFunction(). An executor must not be used by several threads at once.
 class ARROW_EXPORT FunctionExecutor {
  public:
   virtual ~FunctionExecutor() = default;
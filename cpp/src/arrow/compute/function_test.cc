@@ -57,6 +57,11 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new TDigestOptions());
   options.emplace_back(
       new TDigestOptions(/*q=*/0.75, /*delta=*/50, /*buffer_size=*/1024));
+  options.emplace_back(new ApproximateCountDistinctOptions());
+  options.emplace_back(new ApproximateCountDistinctOptions(/*precision=*/14));
+  options.emplace_back(new PivotWiderOptions());
+  options.emplace_back(new PivotWiderOptions({"height", "width"},
+                                             PivotWiderOptions::RAISE));
   options.emplace_back(new IndexOptions(ScalarFromJSON(int64(), "16")));
   options.emplace_back(new IndexOptions(ScalarFromJSON(boolean(), "true")));
   options.emplace_back(new IndexOptions(ScalarFromJSON(boolean(), "null")));
@@ -78,6 +83,8 @@ TEST(FunctionOptions, Equality) {
   options.emplace_back(new JoinOptions(JoinOptions::REPLACE, "replacement"));
   options.emplace_back(new MatchSubstringOptions("pattern"));
   options.emplace_back(new MatchSubstringOptions("pattern", /*ignore_case=*/true));
+  options.emplace_back(new MatchAnyOptions({"a+", "b.c"}));
+  options.emplace_back(new MatchAnyOptions({}, /*ignore_case=*/true));
   options.emplace_back(new SplitOptions());
   options.emplace_back(new SplitOptions(/*max_splits=*/2, /*reverse=*/true));
   options.emplace_back(new SplitPatternOptions("pattern"));
@@ -456,5 +463,55 @@ TEST(FunctionExecutor, Basics) {
   }
 }
 
+namespace {
+
+// Casts all its arguments to int32
+class Int32ScalarFunction : public ScalarFunction {
+ public:
+  using ScalarFunction::ScalarFunction;
+
+  Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* values) const override {
+    for (auto& value : *values) {
+      value = int32();
+    }
+    return DispatchExact(*values);
+  }
+};
+
+}  // namespace
+
+TEST(FunctionExecutor, ImplicitCasts) {
+  Int32ScalarFunction func("scalar_test", Arity::Binary(), /*doc=*/FunctionDoc::Empty());
+  auto exec = [](KernelContext* ctx, const ExecSpan& args, ExecResult* out) -> Status {
+    const int32_t* left = args[0].array.GetValues<int32_t>(1);
+    const int32_t* right = args[1].array.GetValues<int32_t>(1);
+    int32_t* out_values = out->array_span_mutable()->GetValues<int32_t>(1);
+    for (int64_t i = 0; i < args.length; ++i) {
+      out_values[i] = left[i] + right[i];
+    }
+    return Status::OK();
+  };
+  ScalarKernel kernel({int32(), int32()}, int32(), exec);
+  kernel.null_handling = NullHandling::INTERSECTION;
+  ASSERT_OK(func.AddKernel(kernel));
+
+  ASSERT_OK_AND_ASSIGN(auto func_exec, func.GetBestExecutor({int8(), int32()}));
+  ASSERT_OK(func_exec->Init());
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         func_exec->Execute({ArrayFromJSON(int8(), "[1, null, 3]"),
+                                             ArrayFromJSON(int32(), "[10, 20, 30]")}));
+    AssertDatumsEqual(ArrayFromJSON(int32(), "[11, null, 33]"), result);
+  }
+  // Arguments of other castable types are still accepted
+  ASSERT_OK_AND_ASSIGN(auto result,
+                       func_exec->Execute({ArrayFromJSON(int16(), "[1, 2]"),
+                                           ArrayFromJSON(int32(), "[10, 20]")}));
+  AssertDatumsEqual(ArrayFromJSON(int32(), "[11, 22]"), result);
+  // The prepared casts are safe
+  ASSERT_RAISES(Invalid, func_exec->Execute({ArrayFromJSON(int64(), "[1, 4294967296]"),
+                                             ArrayFromJSON(int32(), "[10, 20]")}));
+}
+
 }  // namespace compute
 }  // namespace arrow
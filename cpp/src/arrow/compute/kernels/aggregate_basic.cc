@@ -19,11 +19,15 @@
 #include "arrow/compute/kernels/aggregate_basic_internal.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/hyperloglog_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/hashing.h"
 
 #include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
 
 namespace arrow {
 namespace compute {
@@ -268,6 +272,50 @@ void AddCountDistinctKernels(ScalarAggregateFunction* func) {
       match::FixedSizeBinaryLike(), func);
 }
 
+// ----------------------------------------------------------------------
+// Approximate distinct count implementation
+
+struct ApproximateCountDistinctImpl : public ScalarAggregator {
+  explicit ApproximateCountDistinctImpl(int precision)
+      : precision(precision), registers(HyperLogLog::NumRegisters(precision), 0) {}
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    auto update = [&](int64_t, uint64_t hash) {
+      HyperLogLog::Update(precision, hash, registers.data());
+    };
+    if (batch[0].is_array()) return hasher.VisitValid(batch[0].array, update);
+    ARROW_ASSIGN_OR_RAISE(std::optional<uint64_t> hash,
+                          hasher.HashScalar(*batch[0].scalar));
+    if (hash) update(0, *hash);
+    return Status::OK();
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const ApproximateCountDistinctImpl&>(src);
+    HyperLogLog::Merge(precision, other.registers.data(), registers.data());
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext*, Datum* out) override {
+    *out = Datum(HyperLogLog::Estimate(precision, registers.data()));
+    return Status::OK();
+  }
+
+  const int precision;
+  std::vector<uint8_t> registers;
+  HyperLogLogHasher hasher;
+};
+
+Result<std::unique_ptr<KernelState>> ApproximateCountDistinctInit(
+    KernelContext* ctx, const KernelInitArgs& args) {
+  const int precision =
+      static_cast<const ApproximateCountDistinctOptions&>(*args.options).precision;
+  RETURN_NOT_OK(HyperLogLog::ValidatePrecision(precision));
+  auto state = std::make_unique<ApproximateCountDistinctImpl>(precision);
+  RETURN_NOT_OK(state->hasher.Init(ctx->exec_context(), args.inputs[0].GetSharedPtr()));
+  return std::move(state);
+}
+
 // ----------------------------------------------------------------------
 // Sum implementation
 
@@ -908,6 +956,134 @@ void AddMinMaxKernels(KernelInit init,
   }
 }
 
+// ----------------------------------------------------------------------
+// Fused count/sum/mean/min/max/variance implementation
+
+void FusedVarianceState::MergeFrom(int64_t count, double mean, double m2) {
+  if (count == 0) {
+    return;
+  }
+  if (this->count == 0) {
+    this->count = count;
+    this->mean = mean;
+    this->m2 = m2;
+    return;
+  }
+  MergeVarStd(this->count, this->mean, count, mean, m2, &this->count, &this->mean,
+              &this->m2);
+}
+
+template <typename CType>
+double SumSquaredDeviations(const ArraySpan& data, double mean) {
+  return SumArray<CType, double, SimdLevel::NONE>(data, [mean](CType value) {
+    const double v = static_cast<double>(value);
+    return (v - mean) * (v - mean);
+  });
+}
+
+template double SumSquaredDeviations<int64_t>(const ArraySpan&, double);
+template double SumSquaredDeviations<uint64_t>(const ArraySpan&, double);
+template double SumSquaredDeviations<float>(const ArraySpan&, double);
+template double SumSquaredDeviations<double>(const ArraySpan&, double);
+
+namespace {
+
+std::optional<FusedAggregateKind> GetFusedAggregateKind(std::string_view function) {
+  static const std::unordered_map<std::string_view, FusedAggregateKind> kinds = {
+      {"count", FusedAggregateKind::kCount},
+      {"sum", FusedAggregateKind::kSum},
+      {"mean", FusedAggregateKind::kMean},
+      {"min", FusedAggregateKind::kMin},
+      {"max", FusedAggregateKind::kMax},
+      {"min_max", FusedAggregateKind::kMinMax},
+      {"variance", FusedAggregateKind::kVariance},
+      {"stddev", FusedAggregateKind::kStddev},
+  };
+  auto it = kinds.find(function);
+  if (it == kinds.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
+}  // namespace
+
+bool FusedScalarAggregator::CanFuse(const Aggregate& aggregate, const DataType& type) {
+  if (!is_integer(type.id()) &&
+      (!is_floating(type.id()) || type.id() == Type::HALF_FLOAT)) {
+    return false;
+  }
+  const auto kind = GetFusedAggregateKind(aggregate.function);
+  if (!kind) {
+    return false;
+  }
+  const FunctionOptions* options = aggregate.options.get();
+  switch (*kind) {
+    case FusedAggregateKind::kCount:
+      return options == nullptr ||
+             std::string_view(options->type_name()) == CountOptions::kTypeName;
+    case FusedAggregateKind::kVariance:
+    case FusedAggregateKind::kStddev:
+      // The variance kernel tracks nulls per batch rather than for the whole
+      // aggregation, which is only observable when nulls aren't skipped
+      if (options == nullptr) {
+        return true;
+      }
+      return std::string_view(options->type_name()) == VarianceOptions::kTypeName &&
+             checked_cast<const VarianceOptions&>(*options).skip_nulls;
+    default:
+      return options == nullptr ||
+             std::string_view(options->type_name()) == ScalarAggregateOptions::kTypeName;
+  }
+}
+
+Result<std::unique_ptr<FusedScalarAggregator>> FusedScalarAggregator::Make(
+    std::shared_ptr<DataType> type, std::vector<Aggregate> aggregates) {
+  std::vector<FusedAggregateKind> kinds;
+  std::vector<std::shared_ptr<FunctionOptions>> options;
+  for (auto& aggregate : aggregates) {
+    if (!CanFuse(aggregate, *type)) {
+      return Status::Invalid("Aggregate '", aggregate.function,
+                             "' cannot be fused for type ", *type);
+    }
+    const auto kind = *GetFusedAggregateKind(aggregate.function);
+    if (aggregate.options == nullptr) {
+      switch (kind) {
+        case FusedAggregateKind::kCount:
+          aggregate.options = std::make_shared<CountOptions>();
+          break;
+        case FusedAggregateKind::kVariance:
+        case FusedAggregateKind::kStddev:
+          aggregate.options = std::make_shared<VarianceOptions>();
+          break;
+        default:
+          aggregate.options = std::make_shared<ScalarAggregateOptions>();
+          break;
+      }
+    }
+    kinds.push_back(kind);
+    options.push_back(std::move(aggregate.options));
+  }
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (arrow::internal::CpuInfo::GetInstance()->IsSupported(
+          arrow::internal::CpuInfo::AVX512)) {
+    return MakeFusedScalarAggregatorAvx512(std::move(type), std::move(kinds),
+                                           std::move(options));
+  }
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+  if (arrow::internal::CpuInfo::GetInstance()->IsSupported(
+          arrow::internal::CpuInfo::AVX2)) {
+    return MakeFusedScalarAggregatorAvx2(std::move(type), std::move(kinds),
+                                         std::move(options));
+  }
+#endif
+  FusedScalarAggregatorInit<SimdLevel::NONE> visitor{
+      nullptr, std::move(type), std::move(kinds), std::move(options)};
+  return visitor.Create();
+}
+
 namespace {
 
 const FunctionDoc count_all_doc{
@@ -925,6 +1101,14 @@ const FunctionDoc count_distinct_doc{"Count the number of unique values",
                                      {"array"},
                                      "CountOptions"};
 
+const FunctionDoc approximate_count_distinct_doc{
+    "Approximate the number of unique values",
+    ("The number is estimated with a HyperLogLog sketch, whose size and accuracy\n"
+     "are set through ApproximateCountDistinctOptions.  Null values are not\n"
+     "counted.  NaNs and signed zeroes are not normalized."),
+    {"array"},
+    "ApproximateCountDistinctOptions"};
+
 const FunctionDoc sum_doc{
     "Compute the sum of a numeric array",
     ("Null values are ignored by default. Minimum count of non-null\n"
@@ -1040,6 +1224,17 @@ void RegisterScalarAggregateBasic(FunctionRegistry* registry) {
   AddCountDistinctKernels(func.get());
   DCHECK_OK(registry->AddFunction(std::move(func)));
 
+  static auto default_approximate_count_distinct_options =
+      ApproximateCountDistinctOptions::Defaults();
+  func = std::make_shared<ScalarAggregateFunction>(
+      "approximate_count_distinct", Arity::Unary(), approximate_count_distinct_doc,
+      &default_approximate_count_distinct_options);
+  for (Type::type id : HyperLogLogHasher::InputTypes()) {
+    AddAggKernel(KernelSignature::Make({InputType(id)}, int64()),
+                 ApproximateCountDistinctInit, func.get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(func)));
+
   func = std::make_shared<ScalarAggregateFunction>("sum", Arity::Unary(), sum_doc,
                                                    &default_scalar_aggregate_options);
   AddArrayScalarAggKernels(SumInit, {boolean()}, uint64(), func.get());
@@ -83,6 +83,17 @@ void AddMinMaxAvx2AggKernels(ScalarAggregateFunction* func) {
   AddMinMaxKernel(MinMaxInitAvx2, Type::INTERVAL_MONTHS, func, SimdLevel::AVX2);
 }
 
+// ----------------------------------------------------------------------
+// Fused count/sum/mean/min/max/variance implementation
+
+Result<std::unique_ptr<FusedScalarAggregator>> MakeFusedScalarAggregatorAvx2(
+    std::shared_ptr<DataType> type, std::vector<FusedAggregateKind> kinds,
+    std::vector<std::shared_ptr<FunctionOptions>> options) {
+  FusedScalarAggregatorInit<SimdLevel::AVX2> visitor{
+      nullptr, std::move(type), std::move(kinds), std::move(options)};
+  return visitor.Create();
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
@@ -85,6 +85,17 @@ void AddMinMaxAvx512AggKernels(ScalarAggregateFunction* func) {
   AddMinMaxKernel(MinMaxInitAvx512, Type::INTERVAL_MONTHS, func, SimdLevel::AVX512);
 }
 
+// ----------------------------------------------------------------------
+// Fused count/sum/mean/min/max/variance implementation
+
+Result<std::unique_ptr<FusedScalarAggregator>> MakeFusedScalarAggregatorAvx512(
+    std::shared_ptr<DataType> type, std::vector<FusedAggregateKind> kinds,
+    std::vector<std::shared_ptr<FunctionOptions>> options) {
+  FusedScalarAggregatorInit<SimdLevel::AVX512> visitor{
+      nullptr, std::move(type), std::move(kinds), std::move(options)};
+  return visitor.Create();
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
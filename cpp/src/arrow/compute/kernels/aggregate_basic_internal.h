@@ -22,7 +22,9 @@
 #include <utility>
 
 #include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/kernels/aggregate_fused_internal.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/aggregate_var_std_internal.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
@@ -1033,4 +1035,344 @@ struct MinMaxInitState {
   }
 };
 
+
+// ----------------------------------------------------------------------
+// Fused count/sum/mean/min/max/variance implementation
+
+enum class FusedAggregateKind {
+  kCount,
+  kSum,
+  kMean,
+  kMin,
+  kMax,
+  kMinMax,
+  kVariance,
+  kStddev,
+};
+
+// Running state of "variance" and "stddev".  Merging and the second pass over the
+// values live in a translation unit compiled without SIMD flags, so that floating
+// point contraction cannot make the results differ from the variance kernel's.
+struct FusedVarianceState {
+  void MergeFrom(int64_t count, double mean, double m2);
+
+  int64_t count = 0;
+  double mean = 0;
+  double m2 = 0;  // m2 = count*s2 = sum((X-mean)^2)
+};
+
+// sum((X-mean)^2) over the valid values of `data`
+template <typename CType>
+double SumSquaredDeviations(const ArraySpan& data, double mean);
+
+template <typename ArrowType, SimdLevel::type SimdLevel>
+class FusedScalarAggregatorImpl : public FusedScalarAggregator {
+ public:
+  using ThisType = FusedScalarAggregatorImpl<ArrowType, SimdLevel>;
+  using CType = typename TypeTraits<ArrowType>::CType;
+  using SumType = typename FindAccumulatorType<ArrowType>::Type;
+  using SumCType = typename TypeTraits<SumType>::CType;
+  using SumScalarType = typename TypeTraits<SumType>::ScalarType;
+  // Sum the variance kernel computes its mean from (int128 for integers)
+  using VarianceSumType = typename GetSumType<ArrowType>::SumType;
+
+  // Like the variance kernel, use integer arithmetic for int8/16/32 and the two pass
+  // algorithm otherwise
+  static constexpr bool kIntegerVarStd =
+      is_integer_type<ArrowType>::value && sizeof(CType) <= 4;
+  // Max number of elements IntegerVarStd sums without overflowing
+  static constexpr int64_t kMaxIntegerVarStdLength =
+      int64_t{1} << (kIntegerVarStd ? 63 - sizeof(CType) * 8 : 62);
+
+  FusedScalarAggregatorImpl(std::shared_ptr<DataType> type,
+                            std::vector<FusedAggregateKind> kinds,
+                            std::vector<std::shared_ptr<FunctionOptions>> options)
+      : type_(std::move(type)), kinds_(std::move(kinds)), options_(std::move(options)) {
+    for (const auto kind : kinds_) {
+      need_variance_ = need_variance_ || kind == FusedAggregateKind::kVariance ||
+                       kind == FusedAggregateKind::kStddev;
+    }
+  }
+
+  Status Consume(const ExecValue& value, int64_t length) override {
+    if (value.is_array()) {
+      ConsumeArray(value.array);
+    } else {
+      ConsumeScalar(*value.scalar, length);
+    }
+    return Status::OK();
+  }
+
+  Status MergeFrom(const FusedScalarAggregator& src) override {
+    const auto& other = checked_cast<const ThisType&>(src).state_;
+    state_.length += other.length;
+    state_.count += other.count;
+    state_.nulls += other.nulls;
+    state_.nulls_observed = state_.nulls_observed || other.nulls_observed;
+    state_.sum += other.sum;
+    state_.double_sum += other.double_sum;
+    state_.min_max += other.min_max;
+    state_.variance.MergeFrom(other.variance.count, other.variance.mean,
+                              other.variance.m2);
+    return Status::OK();
+  }
+
+  Result<std::vector<Datum>> Finalize() const override {
+    std::vector<Datum> out(kinds_.size());
+    for (size_t i = 0; i < kinds_.size(); ++i) {
+      switch (kinds_[i]) {
+        case FusedAggregateKind::kCount:
+          out[i] = FinalizeCount(checked_cast<const CountOptions&>(*options_[i]));
+          break;
+        case FusedAggregateKind::kSum:
+          out[i] = FinalizeSum(checked_cast<const ScalarAggregateOptions&>(*options_[i]));
+          break;
+        case FusedAggregateKind::kMean:
+          out[i] =
+              FinalizeMean(checked_cast<const ScalarAggregateOptions&>(*options_[i]));
+          break;
+        case FusedAggregateKind::kMin:
+        case FusedAggregateKind::kMax:
+        case FusedAggregateKind::kMinMax: {
+          const auto& options = checked_cast<const ScalarAggregateOptions&>(*options_[i]);
+          ARROW_ASSIGN_OR_RAISE(out[i], FinalizeMinMax(kinds_[i], options));
+          break;
+        }
+        case FusedAggregateKind::kVariance:
+        case FusedAggregateKind::kStddev:
+          out[i] = FinalizeVariance(kinds_[i],
+                                    checked_cast<const VarianceOptions&>(*options_[i]));
+          break;
+      }
+    }
+    return out;
+  }
+
+  void Reset() override { state_ = State{}; }
+
+ private:
+  struct State {
+    // All rows, valid rows and null rows seen
+    int64_t length = 0;
+    int64_t count = 0;
+    int64_t nulls = 0;
+    bool nulls_observed = false;
+    // "sum" of integers; floating point sums are `double_sum`
+    SumCType sum = 0;
+    // Pairwise sum of "mean"
+    double double_sum = 0;
+    MinMaxState<ArrowType, SimdLevel> min_max;
+    FusedVarianceState variance;
+  };
+
+  void ConsumeArray(const ArraySpan& data) {
+    const int64_t null_count = data.GetNullCount();
+    const int64_t count = data.length - null_count;
+    state_.length += data.length;
+    state_.count += count;
+    state_.nulls += null_count;
+    state_.nulls_observed = state_.nulls_observed || null_count > 0;
+    if (count == 0) {
+      return;
+    }
+
+    // A single visit of the valid values feeds every statistic.  The pairwise sum is
+    // the one "mean" (and "sum" of floating point values) computes, while min/max and
+    // the integer sums are accumulated on the side in the same value order as their
+    // own kernels do, so the results match exactly.
+    MinMaxState<ArrowType, SimdLevel> local_min_max;
+    SumCType local_sum = 0;
+    VarianceSumType variance_sum = 0;
+    IntegerVarStd<ArrowType> integer_var_std;
+    const bool integer_variance = kIntegerVarStd && need_variance_ &&
+                                  data.length <= kMaxIntegerVarStdLength;
+    ARROW_UNUSED(local_sum);
+    ARROW_UNUSED(variance_sum);
+    ARROW_UNUSED(integer_var_std);
+    ARROW_UNUSED(integer_variance);
+    const double sum = SumArray<CType, double, SimdLevel>(data, [&](CType value) {
+      local_min_max.MergeOne(value);
+      if constexpr (is_integer_type<ArrowType>::value) {
+        local_sum += static_cast<SumCType>(value);
+        if constexpr (kIntegerVarStd) {
+          if (integer_variance) {
+            integer_var_std.ConsumeOne(value);
+          }
+        } else if (need_variance_) {
+          variance_sum += value;
+        }
+      }
+      return static_cast<double>(value);
+    });
+    state_.min_max += local_min_max;
+    state_.sum += local_sum;
+    state_.double_sum += sum;
+
+    if (!need_variance_) {
+      return;
+    }
+    if constexpr (kIntegerVarStd) {
+      if (integer_variance) {
+        state_.variance.MergeFrom(integer_var_std.count, integer_var_std.mean(),
+                                  integer_var_std.m2());
+      } else {
+        ConsumeIntegerVarianceInSlices(data);
+      }
+    } else {
+      double mean;
+      if constexpr (is_integer_type<ArrowType>::value) {
+        mean = static_cast<double>(variance_sum) / count;
+      } else {
+        mean = sum / count;
+      }
+      state_.variance.MergeFrom(count, mean, SumSquaredDeviations<CType>(data, mean));
+    }
+  }
+
+  // Arrays too long for IntegerVarStd are processed in slices, as the variance
+  // kernel does
+  void ConsumeIntegerVarianceInSlices(const ArraySpan& data) {
+    ArraySpan slice = data;
+    for (int64_t start = 0; start < data.length; start += kMaxIntegerVarStdLength) {
+      slice.SetSlice(data.offset + start,
+                     std::min(kMaxIntegerVarStdLength, data.length - start));
+      IntegerVarStd<ArrowType> var_std;
+      const CType* values = slice.GetValues<CType>(1);
+      arrow::internal::VisitSetBitRunsVoid(
+          slice.buffers[0].data, slice.offset, slice.length,
+          [&](int64_t pos, int64_t len) {
+            for (int64_t i = 0; i < len; ++i) {
+              var_std.ConsumeOne(values[pos + i]);
+            }
+          });
+      if (var_std.count > 0) {
+        state_.variance.MergeFrom(var_std.count, var_std.mean(), var_std.m2());
+      }
+    }
+  }
+
+  void ConsumeScalar(const Scalar& scalar, int64_t length) {
+    state_.length += length;
+    state_.nulls_observed = state_.nulls_observed || !scalar.is_valid;
+    if (!scalar.is_valid) {
+      state_.nulls += length;
+      return;
+    }
+    state_.count += length;
+    if (length == 0) {
+      return;
+    }
+    const CType value = UnboxScalar<ArrowType>::Unbox(scalar);
+    state_.sum += value * length;
+    state_.double_sum += value * length;
+    state_.min_max.MergeOne(value);
+    state_.variance.MergeFrom(length, static_cast<double>(value), /*m2=*/0);
+  }
+
+  Datum FinalizeCount(const CountOptions& options) const {
+    switch (options.mode) {
+      case CountOptions::ONLY_VALID:
+        return Datum(state_.count);
+      case CountOptions::ONLY_NULL:
+        return Datum(state_.nulls);
+      case CountOptions::ALL:
+        break;
+    }
+    return Datum(state_.length);
+  }
+
+  Datum FinalizeSum(const ScalarAggregateOptions& options) const {
+    if ((!options.skip_nulls && state_.nulls_observed) ||
+        (state_.count < static_cast<int64_t>(options.min_count))) {
+      return Datum(std::make_shared<SumScalarType>());
+    }
+    if constexpr (is_floating_type<ArrowType>::value) {
+      return Datum(std::make_shared<SumScalarType>(state_.double_sum));
+    } else {
+      return Datum(std::make_shared<SumScalarType>(state_.sum));
+    }
+  }
+
+  Datum FinalizeMean(const ScalarAggregateOptions& options) const {
+    if ((!options.skip_nulls && state_.nulls_observed) ||
+        (state_.count < static_cast<int64_t>(options.min_count))) {
+      return Datum(std::make_shared<DoubleScalar>());
+    }
+    return Datum(std::make_shared<DoubleScalar>(state_.double_sum / state_.count));
+  }
+
+  Result<Datum> FinalizeMinMax(FusedAggregateKind kind,
+                               const ScalarAggregateOptions& options) const {
+    const int64_t min_count = std::max<uint32_t>(1, options.min_count);
+    std::shared_ptr<Scalar> min, max;
+    if ((state_.nulls_observed && !options.skip_nulls) || (state_.count < min_count)) {
+      min = max = MakeNullScalar(type_);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(min, MakeScalar(type_, state_.min_max.min));
+      ARROW_ASSIGN_OR_RAISE(max, MakeScalar(type_, state_.min_max.max));
+    }
+    if (kind == FusedAggregateKind::kMin) {
+      return Datum(std::move(min));
+    }
+    if (kind == FusedAggregateKind::kMax) {
+      return Datum(std::move(max));
+    }
+    return Datum(std::make_shared<StructScalar>(
+        ScalarVector{std::move(min), std::move(max)},
+        struct_({field("min", type_), field("max", type_)})));
+  }
+
+  Datum FinalizeVariance(FusedAggregateKind kind, const VarianceOptions& options) const {
+    const auto& variance = state_.variance;
+    if (variance.count <= options.ddof || variance.count < options.min_count) {
+      return Datum(std::make_shared<DoubleScalar>());
+    }
+    const double var = variance.m2 / (variance.count - options.ddof);
+    return Datum(std::make_shared<DoubleScalar>(
+        kind == FusedAggregateKind::kVariance ? var : sqrt(var)));
+  }
+
+  std::shared_ptr<DataType> type_;
+  std::vector<FusedAggregateKind> kinds_;
+  std::vector<std::shared_ptr<FunctionOptions>> options_;
+  bool need_variance_ = false;
+  State state_;
+};
+
+template <SimdLevel::type SimdLevel>
+struct FusedScalarAggregatorInit {
+  std::unique_ptr<FusedScalarAggregator> aggregator;
+  std::shared_ptr<DataType> type;
+  std::vector<FusedAggregateKind> kinds;
+  std::vector<std::shared_ptr<FunctionOptions>> options;
+
+  Status Visit(const DataType& ty) {
+    return Status::NotImplemented("No fused aggregation implemented for ", ty);
+  }
+
+  Status Visit(const HalfFloatType& ty) {
+    return Status::NotImplemented("No fused aggregation implemented for ", ty);
+  }
+
+  template <typename Type>
+  enable_if_number<Type, Status> Visit(const Type&) {
+    aggregator = std::make_unique<FusedScalarAggregatorImpl<Type, SimdLevel>>(
+        type, std::move(kinds), std::move(options));
+    return Status::OK();
+  }
+
+  Result<std::unique_ptr<FusedScalarAggregator>> Create() {
+    RETURN_NOT_OK(VisitTypeInline(*type, this));
+    return std::move(aggregator);
+  }
+};
+
+// SIMD variants for the fused aggregator
+Result<std::unique_ptr<FusedScalarAggregator>> MakeFusedScalarAggregatorAvx2(
+    std::shared_ptr<DataType> type, std::vector<FusedAggregateKind> kinds,
+    std::vector<std::shared_ptr<FunctionOptions>> options);
+Result<std::unique_ptr<FusedScalarAggregator>> MakeFusedScalarAggregatorAvx512(
+    std::shared_ptr<DataType> type, std::vector<FusedAggregateKind> kinds,
+    std::vector<std::shared_ptr<FunctionOptions>> options);
+
 }  // namespace arrow::compute::internal
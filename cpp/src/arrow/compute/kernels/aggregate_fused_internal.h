@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/exec.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow::compute::internal {
+
+/// \brief Computes several scalar aggregates of one numeric column in a single pass
+///
+/// "count", "sum", "mean", "min", "max", "min_max", "variance" and "stddev" all
+/// derive from the same running statistics of a column.  Instead of each kernel
+/// scanning the column on its own, a FusedScalarAggregator visits the validity
+/// bitmap and the values once per batch and finalizes every aggregate from the
+/// shared state.  For array input, results are identical to those of the
+/// individual kernels.
+class ARROW_EXPORT FusedScalarAggregator {
+ public:
+  virtual ~FusedScalarAggregator() = default;
+
+  /// \brief Whether `aggregate` over a column of `type` can be part of a
+  /// FusedScalarAggregator
+  ///
+  /// The target of `aggregate` is not inspected.
+  static bool CanFuse(const Aggregate& aggregate, const DataType& type);
+
+  /// \brief Make an aggregator computing all of `aggregates` over a column of `type`
+  ///
+  /// Every aggregate must satisfy CanFuse().
+  static Result<std::unique_ptr<FusedScalarAggregator>> Make(
+      std::shared_ptr<DataType> type, std::vector<Aggregate> aggregates);
+
+  /// \brief Accumulate a batch of the column
+  virtual Status Consume(const ExecValue& value, int64_t length) = 0;
+
+  /// \brief Merge the state of another aggregator made with the same arguments
+  virtual Status MergeFrom(const FusedScalarAggregator& other) = 0;
+
+  /// \brief Compute the value of each aggregate, in the order given to Make()
+  virtual Result<std::vector<Datum>> Finalize() const = 0;
+
+  /// \brief Return to the state right after Make()
+  virtual void Reset() = 0;
+};
+
+}  // namespace arrow::compute::internal
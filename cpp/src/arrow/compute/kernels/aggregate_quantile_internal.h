@@ -0,0 +1,165 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+// Shared by the exact "quantile" and "hash_quantile" kernels.
+
+// output is at some input data point, not interpolated
+inline bool IsDataPoint(const QuantileOptions& options) {
+  // some interpolation methods return exact data point
+  return options.interpolation == QuantileOptions::LOWER ||
+         options.interpolation == QuantileOptions::HIGHER ||
+         options.interpolation == QuantileOptions::NEAREST;
+}
+
+// quantile to exact datapoint index (IsDataPoint == true)
+inline uint64_t QuantileToDataPoint(size_t length, double q,
+                                    enum QuantileOptions::Interpolation interpolation) {
+  const double index = (length - 1) * q;
+  uint64_t datapoint_index = static_cast<uint64_t>(index);
+  const double fraction = index - datapoint_index;
+
+  if (interpolation == QuantileOptions::LINEAR ||
+      interpolation == QuantileOptions::MIDPOINT) {
+    DCHECK_EQ(fraction, 0);
+  }
+
+  // convert NEAREST interpolation method to LOWER or HIGHER
+  if (interpolation == QuantileOptions::NEAREST) {
+    if (fraction < 0.5) {
+      interpolation = QuantileOptions::LOWER;
+    } else if (fraction > 0.5) {
+      interpolation = QuantileOptions::HIGHER;
+    } else {
+      // round 0.5 to nearest even number, similar to numpy.around
+      interpolation =
+          (datapoint_index & 1) ? QuantileOptions::HIGHER : QuantileOptions::LOWER;
+    }
+  }
+
+  if (interpolation == QuantileOptions::HIGHER && fraction != 0) {
+    ++datapoint_index;
+  }
+
+  return datapoint_index;
+}
+
+template <typename T>
+double DataPointToDouble(T value, const DataType&) {
+  return static_cast<double>(value);
+}
+inline double DataPointToDouble(const Decimal128& value, const DataType& ty) {
+  return value.ToDouble(::arrow::internal::checked_cast<const DecimalType&>(ty).scale());
+}
+inline double DataPointToDouble(const Decimal256& value, const DataType& ty) {
+  return value.ToDouble(::arrow::internal::checked_cast<const DecimalType&>(ty).scale());
+}
+
+// indices into options.q ordered by descending quantile
+inline std::vector<int64_t> DescendingQuantileIndices(const QuantileOptions& options) {
+  std::vector<int64_t> q_indices(options.q.size());
+  std::iota(q_indices.begin(), q_indices.end(), 0);
+  std::sort(q_indices.begin(), q_indices.end(),
+            [&options](int64_t left_index, int64_t right_index) {
+              return options.q[right_index] < options.q[left_index];
+            });
+  return q_indices;
+}
+
+// Selection of quantiles by partial sorting of the `length` values at `in`.
+// Quantiles are to be selected in descending order: the values are partitioned
+// around the data point at `*last_index` (pivot), so for the next quantile,
+// which is smaller, only values left of the pivot are considered.
+
+// return quantile located exactly at some input data point
+template <typename CType>
+CType GetQuantileAtDataPoint(CType* in, uint64_t length, uint64_t* last_index, double q,
+                             enum QuantileOptions::Interpolation interpolation) {
+  const uint64_t datapoint_index = QuantileToDataPoint(length, q, interpolation);
+
+  if (datapoint_index != *last_index) {
+    DCHECK_LT(datapoint_index, *last_index);
+    std::nth_element(in, in + datapoint_index, in + *last_index);
+    *last_index = datapoint_index;
+  }
+
+  return in[datapoint_index];
+}
+
+// return quantile interpolated from adjacent input data points
+template <typename CType>
+double GetQuantileByInterp(CType* in, uint64_t length, uint64_t* last_index, double q,
+                           enum QuantileOptions::Interpolation interpolation,
+                           const DataType& in_type) {
+  const double index = (length - 1) * q;
+  const uint64_t lower_index = static_cast<uint64_t>(index);
+  const double fraction = index - lower_index;
+
+  if (lower_index != *last_index) {
+    DCHECK_LT(lower_index, *last_index);
+    std::nth_element(in, in + lower_index, in + *last_index);
+  }
+
+  const double lower_value = DataPointToDouble(in[lower_index], in_type);
+  if (fraction == 0) {
+    *last_index = lower_index;
+    return lower_value;
+  }
+
+  const uint64_t higher_index = lower_index + 1;
+  DCHECK_LT(higher_index, length);
+  if (lower_index != *last_index && higher_index != *last_index) {
+    DCHECK_LT(higher_index, *last_index);
+    // higher value must be the minimal value after lower_index
+    auto min = std::min_element(in + higher_index, in + *last_index);
+    std::iter_swap(in + higher_index, min);
+  }
+  *last_index = lower_index;
+
+  const double higher_value = DataPointToDouble(in[higher_index], in_type);
+
+  if (interpolation == QuantileOptions::LINEAR) {
+    // more stable than naive linear interpolation
+    return fraction * higher_value + (1 - fraction) * lower_value;
+  } else if (interpolation == QuantileOptions::MIDPOINT) {
+    return lower_value / 2 + higher_value / 2;
+  } else {
+    DCHECK(false);
+    return NAN;
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
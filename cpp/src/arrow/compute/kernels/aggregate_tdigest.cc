@@ -15,6 +15,9 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <type_traits>
+#include <vector>
+
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
@@ -68,8 +71,12 @@ struct TDigestImpl : public ScalarAggregator {
         this->count += data.length - data.GetNullCount();
         VisitSetBitRunsVoid(data.buffers[0].data, data.offset, data.length,
                             [&](int64_t pos, int64_t len) {
-                              for (int64_t i = 0; i < len; ++i) {
-                                this->tdigest.NanAdd(ToDouble(values[pos + i]));
+                              if constexpr (std::is_arithmetic_v<CType>) {
+                                this->tdigest.NanAdd(values + pos, len);
+                              } else {
+                                for (int64_t i = 0; i < len; ++i) {
+                                  this->tdigest.NanAdd(ToDouble(values[pos + i]));
+                                }
                               }
                             });
       }
@@ -86,12 +93,17 @@ struct TDigestImpl : public ScalarAggregator {
   }
 
   Status MergeFrom(KernelContext*, KernelState&& src) override {
-    const auto& other = checked_cast<const ThisType&>(src);
+    auto& other = checked_cast<ThisType&>(src);
     if (!this->all_valid || !other.all_valid) {
       this->all_valid = false;
       return Status::OK();
     }
-    this->tdigest.Merge(other.tdigest);
+    // Merging the tdigests one by one would merge the centroids of this one
+    // again each time: defer to a single merge of all of them in Finalize()
+    this->pending_merges.push_back(std::move(other.tdigest));
+    for (auto& tdigest : other.pending_merges) {
+      this->pending_merges.push_back(std::move(tdigest));
+    }
     this->count += other.count;
     return Status::OK();
   }
@@ -104,6 +116,14 @@ struct TDigestImpl : public ScalarAggregator {
                           ctx->Allocate(out_length * sizeof(double)));
     double* out_buffer = out_data->template GetMutableValues<double>(1);
 
+    if (!this->pending_merges.empty()) {
+      ExecContext* exec_ctx = ctx->exec_context();
+      RETURN_NOT_OK(this->tdigest.Merge(
+          std::move(this->pending_merges),
+          exec_ctx->use_threads() ? exec_ctx->executor() : nullptr));
+      this->pending_merges.clear();
+    }
+
     if (this->tdigest.is_empty() || !this->all_valid || this->count < options.min_count) {
       ARROW_ASSIGN_OR_RAISE(out_data->buffers[0], ctx->AllocateBitmap(out_length));
       std::memset(out_data->buffers[0]->mutable_data(), 0x00,
@@ -121,6 +141,8 @@ struct TDigestImpl : public ScalarAggregator {
 
   const TDigestOptions options;
   TDigest tdigest;
+  // The tdigests of the merged states, not merged into `tdigest` yet
+  std::vector<TDigest> pending_merges;
   int64_t count;
   int32_t decimal_scale;
   bool all_valid;
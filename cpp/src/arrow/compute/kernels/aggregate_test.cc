@@ -16,6 +16,7 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <type_traits>
@@ -1140,6 +1141,69 @@ TEST_F(TestCountDistinctKernel, Random) {
   Check(input, memo.size(), false);
 }
 
+//
+// Approximate Count Distinct
+//
+
+TEST(TestApproximateCountDistinctKernel, Basics) {
+  auto expected = [](int64_t value) { return ResultWith(Datum(value)); };
+  auto count = [](const Datum& input) {
+    return CallFunction("approximate_count_distinct", {input});
+  };
+
+  // Small numbers of distinct values are counted exactly, without nulls
+  EXPECT_THAT(count(ArrayFromJSON(int32(), "[]")), expected(0));
+  EXPECT_THAT(count(ArrayFromJSON(int32(), "[null, null]")), expected(0));
+  EXPECT_THAT(count(ArrayFromJSON(int32(), "[1, 2, null, 1, 3, 2]")), expected(3));
+  EXPECT_THAT(count(ArrayFromJSON(boolean(), "[true, null, true, false]")), expected(2));
+  EXPECT_THAT(count(ArrayFromJSON(float64(), "[0.5, 1.5, 0.5]")), expected(2));
+  EXPECT_THAT(count(ArrayFromJSON(utf8(), R"(["a", "b", null, "a"])")), expected(2));
+  EXPECT_THAT(count(ArrayFromJSON(large_binary(), R"(["a", "b", "c"])")), expected(3));
+  EXPECT_THAT(count(ArrayFromJSON(fixed_size_binary(2), R"(["ab", "cd", "ab"])")),
+              expected(2));
+  EXPECT_THAT(count(ArrayFromJSON(decimal128(5, 2), R"(["1.00", "2.50"])")),
+              expected(2));
+  EXPECT_THAT(count(ArrayFromJSON(null(), "[null, null]")), expected(0));
+  EXPECT_THAT(count(ArrayFromJSON(int64(), "[1, 2, 3, 4]")->Slice(1, 2)), expected(2));
+  EXPECT_THAT(count(ChunkedArrayFromJSON(utf8(), {R"(["a", "b"])", R"(["b", "c"])"})),
+              expected(3));
+  EXPECT_THAT(count(ScalarFromJSON(int32(), "5")), expected(1));
+  EXPECT_THAT(count(ScalarFromJSON(int32(), "null")), expected(0));
+
+  ApproximateCountDistinctOptions invalid(/*precision=*/2);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("precision must be between 4 and 18"),
+      CallFunction("approximate_count_distinct", {ArrayFromJSON(int32(), "[1]")},
+                   &invalid));
+}
+
+TEST(TestApproximateCountDistinctKernel, Random) {
+  auto rand = random::RandomArrayGenerator(0x5487655);
+  auto values = rand.Int64(100000, 0, std::numeric_limits<int64_t>::max(),
+                           /*null_probability=*/0.1);
+  ASSERT_OK_AND_ASSIGN(Datum exact, CallFunction("count_distinct", {values}));
+
+  for (int32_t precision : {8, 12, 16}) {
+    ARROW_SCOPED_TRACE("precision = ", precision);
+    ApproximateCountDistinctOptions options(precision);
+    ASSERT_OK_AND_ASSIGN(Datum estimate,
+                         CallFunction("approximate_count_distinct", {values}, &options));
+    // Allow for four times the standard error of the estimate
+    const double expected = static_cast<double>(exact.scalar_as<Int64Scalar>().value);
+    const double tolerance = 4 * 1.04 / std::sqrt(std::ldexp(1.0, precision));
+    EXPECT_NEAR(static_cast<double>(estimate.scalar_as<Int64Scalar>().value), expected,
+                expected * tolerance);
+
+    // Merging the sketches of chunks estimates as if the values were one chunk
+    ASSERT_OK_AND_ASSIGN(auto chunked,
+                         ChunkedArray::Make({values->Slice(0, 30000),
+                                             values->Slice(30000, 50000),
+                                             values->Slice(80000)}));
+    EXPECT_THAT(CallFunction("approximate_count_distinct", {chunked}, &options),
+                ResultWith(estimate));
+  }
+}
+
 //
 // Mean
 //
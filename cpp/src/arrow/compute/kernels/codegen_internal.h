@@ -133,6 +133,7 @@ struct GetViewType<Type, enable_if_has_c_type<Type>> {
 
 template <typename Type>
 struct GetViewType<Type, enable_if_t<is_base_binary_type<Type>::value ||
+                                     is_binary_view_like_type<Type>::value ||
                                      is_fixed_size_binary_type<Type>::value>> {
   using T = std::string_view;
   using PhysicalType = T;
@@ -1262,6 +1263,20 @@ ArrayKernelExec GenerateVarBinaryToVarBinary(detail::GetTypeId get_id) {
   }
 }
 
+// Generate a kernel given a templated functor for binary and string view types
+template <template <typename...> class Generator, typename... Args>
+ArrayKernelExec GenerateBinaryView(detail::GetTypeId get_id) {
+  switch (get_id.id) {
+    case Type::BINARY_VIEW:
+      return Generator<BinaryViewType, Args...>::Exec;
+    case Type::STRING_VIEW:
+      return Generator<StringViewType, Args...>::Exec;
+    default:
+      DCHECK(false);
+      return nullptr;
+  }
+}
+
 // Generate a kernel given a templated functor for base binary types. Generates
 // a single kernel for binary/string and large binary/large string. If your kernel
 // implementation needs access to the specific type at compile time, please use
@@ -20,19 +20,24 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/concatenate.h"
+#include "arrow/array/util.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
+#include "arrow/compute/kernels/aggregate_quantile_internal.h"
 #include "arrow/compute/kernels/aggregate_var_std_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/hyperloglog_internal.h"
 #include "arrow/compute/kernels/row_encoder_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/compute/row/grouper.h"
@@ -1146,6 +1151,244 @@ struct GroupedVarStdFactory {
   InputType argument_type;
 };
 
+// ----------------------------------------------------------------------
+// Exact quantile implementation
+
+// The values of all groups are buffered in arrival order, together with their
+// group ids.  Finalize() moves them into per-group ranges with a counting sort
+// and selects the quantiles of each group with nth_element, like the scalar
+// "quantile" function does.
+template <typename Type>
+struct GroupedQuantileImpl : public GroupedAggregator {
+  using CType = typename TypeTraits<Type>::CType;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    options_ = *checked_cast<const QuantileOptions*>(args.options);
+    if (options_.q.empty()) {
+      return Status::Invalid("Requires quantile argument");
+    }
+    for (double q : options_.q) {
+      if (q < 0 || q > 1) {
+        return Status::Invalid("Quantile must be between 0 and 1");
+      }
+    }
+    type_ = args.inputs[0].GetSharedPtr();
+    ctx_ = ctx;
+    pool_ = ctx->memory_pool();
+    values_ = TypedBufferBuilder<CType>(pool_);
+    value_groups_ = TypedBufferBuilder<uint32_t>(pool_);
+    counts_ = TypedBufferBuilder<int64_t>(pool_);
+    no_nulls_ = TypedBufferBuilder<bool>(pool_);
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    RETURN_NOT_OK(counts_.Append(added_groups, 0));
+    RETURN_NOT_OK(no_nulls_.Append(added_groups, true));
+    return Status::OK();
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    RETURN_NOT_OK(values_.Reserve(batch.length));
+    RETURN_NOT_OK(value_groups_.Reserve(batch.length));
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    VisitGroupedValues<Type>(
+        batch,
+        [&](uint32_t g, CType value) {
+          counts[g]++;
+          // NaNs count towards min_count but are otherwise ignored
+          if constexpr (is_floating_type<Type>::value) {
+            if (std::isnan(value)) return;
+          }
+          values_.UnsafeAppend(value);
+          value_groups_.UnsafeAppend(g);
+        },
+        [&](uint32_t g) { bit_util::SetBitTo(no_nulls, g, false); });
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedQuantileImpl*>(&raw_other);
+
+    int64_t* counts = counts_.mutable_data();
+    uint8_t* no_nulls = no_nulls_.mutable_data();
+    const int64_t* other_counts = other->counts_.data();
+    const uint8_t* other_no_nulls = other->no_nulls_.data();
+
+    auto g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+      counts[g[other_g]] += other_counts[other_g];
+      bit_util::SetBitTo(no_nulls, g[other_g],
+                         bit_util::GetBit(no_nulls, g[other_g]) &&
+                             bit_util::GetBit(other_no_nulls, other_g));
+    }
+
+    // The other state's values are copied exactly once, with their group ids
+    // translated on the way
+    const int64_t num_other_values = other->values_.length();
+    RETURN_NOT_OK(values_.Append(other->values_.data(), num_other_values));
+    RETURN_NOT_OK(value_groups_.Reserve(num_other_values));
+    const uint32_t* other_value_groups = other->value_groups_.data();
+    for (int64_t i = 0; i < num_other_values; ++i) {
+      value_groups_.UnsafeAppend(g[other_value_groups[i]]);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    const bool is_datapoint = IsDataPoint(options_);
+    const int64_t slot_length = options_.q.size();
+    const int64_t num_out_values = num_groups_ * slot_length;
+    const int64_t* counts = counts_.data();
+    const uint8_t* no_nulls = no_nulls_.data();
+
+    // Group the values of the groups that will produce quantiles
+    std::vector<bool> emit(num_groups_);
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      emit[g] = counts[g] >= options_.min_count &&
+                (options_.skip_nulls || bit_util::GetBit(no_nulls, g));
+    }
+    const int64_t num_values = values_.length();
+    const CType* values = values_.data();
+    const uint32_t* value_groups = value_groups_.data();
+    std::vector<int64_t> offsets(num_groups_ + 1, 0);
+    for (int64_t i = 0; i < num_values; ++i) {
+      offsets[value_groups[i] + 1] += emit[value_groups[i]];
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    ARROW_ASSIGN_OR_RAISE(auto grouped,
+                          AllocateBuffer(offsets[num_groups_] * sizeof(CType), pool_));
+    CType* grouped_values = grouped->mutable_data_as<CType>();
+    {
+      std::vector<int64_t> positions(offsets.begin(), offsets.end() - 1);
+      for (int64_t i = 0; i < num_values; ++i) {
+        if (emit[value_groups[i]]) {
+          grouped_values[positions[value_groups[i]]++] = values[i];
+        }
+      }
+    }
+    values_.Reset();
+    value_groups_.Reset();
+
+    const std::vector<int64_t> q_indices = DescendingQuantileIndices(options_);
+    const std::shared_ptr<DataType> out_value_type = is_datapoint ? type_ : float64();
+    ARROW_ASSIGN_OR_RAISE(
+        std::shared_ptr<Buffer> out_values,
+        AllocateBuffer(num_out_values * out_value_type->byte_width(), pool_));
+    std::memset(out_values->mutable_data(), 0, out_values->size());
+    std::shared_ptr<Buffer> null_bitmap;
+    int64_t null_count = 0;
+    for (int64_t g = 0; g < num_groups_; ++g) {
+      CType* group_values = grouped_values + offsets[g];
+      const uint64_t length = offsets[g + 1] - offsets[g];
+      if (length == 0) {
+        if (!null_bitmap) {
+          ARROW_ASSIGN_OR_RAISE(null_bitmap, AllocateBitmap(num_out_values, pool_));
+          bit_util::SetBitsTo(null_bitmap->mutable_data(), 0, num_out_values, true);
+        }
+        null_count += slot_length;
+        bit_util::SetBitsTo(null_bitmap->mutable_data(), g * slot_length, slot_length,
+                            false);
+        continue;
+      }
+      uint64_t last_index = length;
+      for (int64_t q_index : q_indices) {
+        const int64_t out_index = g * slot_length + q_index;
+        if (is_datapoint) {
+          out_values->mutable_data_as<CType>()[out_index] =
+              GetQuantileAtDataPoint(group_values, length, &last_index,
+                                     options_.q[q_index], options_.interpolation);
+        } else {
+          out_values->mutable_data_as<double>()[out_index] =
+              GetQuantileByInterp(group_values, length, &last_index, options_.q[q_index],
+                                  options_.interpolation, *type_);
+        }
+      }
+    }
+
+    auto child =
+        ArrayData::Make(out_value_type, num_out_values,
+                        {std::move(null_bitmap), std::move(out_values)}, null_count);
+    return ArrayData::Make(out_type(), num_groups_, {nullptr}, {std::move(child)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return fixed_size_list(IsDataPoint(options_) ? type_ : float64(),
+                           static_cast<int32_t>(options_.q.size()));
+  }
+
+  QuantileOptions options_;
+  std::shared_ptr<DataType> type_;
+  int64_t num_groups_ = 0;
+  TypedBufferBuilder<CType> values_;
+  TypedBufferBuilder<uint32_t> value_groups_;
+  TypedBufferBuilder<int64_t> counts_;
+  TypedBufferBuilder<bool> no_nulls_;
+  ExecContext* ctx_;
+  MemoryPool* pool_;
+};
+
+struct GroupedQuantileFactory {
+  template <typename T>
+  enable_if_t<is_number_type<T>::value || is_decimal_type<T>::value, Status> Visit(
+      const T&) {
+    kernel =
+        MakeKernel(std::move(argument_type), HashAggregateInit<GroupedQuantileImpl<T>>);
+    return Status::OK();
+  }
+
+  Status Visit(const HalfFloatType& type) {
+    return Status::NotImplemented("Computing quantiles of data of type ", type);
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Computing quantiles of data of type ", type);
+  }
+
+  static Result<HashAggregateKernel> Make(const std::shared_ptr<DataType>& type) {
+    GroupedQuantileFactory factory;
+    factory.argument_type = type->id();
+    RETURN_NOT_OK(VisitTypeInline(*type, &factory));
+    return std::move(factory.kernel);
+  }
+
+  HashAggregateKernel kernel;
+  InputType argument_type;
+};
+
+HashAggregateKernel MakeMedianKernel(HashAggregateFunction* quantile_func) {
+  HashAggregateKernel kernel;
+  kernel.init = [quantile_func](
+                    KernelContext* ctx,
+                    const KernelInitArgs& args) -> Result<std::unique_ptr<KernelState>> {
+    ARROW_ASSIGN_OR_RAISE(auto kernel, quantile_func->DispatchExact(args.inputs));
+    const auto& scalar_options =
+        checked_cast<const ScalarAggregateOptions&>(*args.options);
+    // Default q = 0.5 with linear interpolation
+    QuantileOptions options;
+    options.min_count = scalar_options.min_count;
+    options.skip_nulls = scalar_options.skip_nulls;
+    KernelInitArgs new_args{kernel, args.inputs, &options};
+    return kernel->init(ctx, new_args);
+  };
+  kernel.signature = KernelSignature::Make({InputType::Any(), Type::UINT32}, float64());
+  kernel.resize = HashAggregateResize;
+  kernel.consume = HashAggregateConsume;
+  kernel.merge = HashAggregateMerge;
+  kernel.finalize = [](KernelContext* ctx, Datum* out) {
+    ARROW_ASSIGN_OR_RAISE(Datum temp,
+                          checked_cast<GroupedAggregator*>(ctx->state())->Finalize());
+    *out = temp.array_as<FixedSizeListArray>()->values();
+    return Status::OK();
+  };
+  return kernel;
+}
+
 // ----------------------------------------------------------------------
 // TDigest implementation
 
@@ -1175,6 +1418,7 @@ struct GroupedTDigestImpl : public GroupedAggregator {
     for (int64_t i = 0; i < added_groups; i++) {
       tdigests_.emplace_back(options_.delta, options_.buffer_size);
     }
+    pending_merges_.resize(new_num_groups);
     RETURN_NOT_OK(counts_.Append(new_num_groups, 0));
     RETURN_NOT_OK(no_nulls_.Append(new_num_groups, true));
     return Status::OK();
@@ -1214,9 +1458,14 @@ struct GroupedTDigestImpl : public GroupedAggregator {
     const int64_t* other_counts = other->counts_.data();
     const uint8_t* other_no_nulls = no_nulls_.mutable_data();
 
+    // Merging the tdigests one by one would merge the centroids of ours again
+    // each time: defer to a single merge of all of them in Finalize()
     auto g = group_id_mapping.GetValues<uint32_t>(1);
     for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
-      tdigests_[*g].Merge(other->tdigests_[other_g]);
+      pending_merges_[*g].push_back(std::move(other->tdigests_[other_g]));
+      for (auto& tdigest : other->pending_merges_[other_g]) {
+        pending_merges_[*g].push_back(std::move(tdigest));
+      }
       counts[*g] += other_counts[other_g];
       bit_util::SetBitTo(
           no_nulls, *g,
@@ -1237,6 +1486,10 @@ struct GroupedTDigestImpl : public GroupedAggregator {
 
     auto* results = values->mutable_data_as<double>();
     for (int64_t i = 0; static_cast<size_t>(i) < tdigests_.size(); ++i) {
+      if (!pending_merges_[i].empty()) {
+        tdigests_[i].Merge(pending_merges_[i]);
+        pending_merges_[i].clear();
+      }
       if (!tdigests_[i].is_empty() && counts[i] >= options_.min_count &&
           (options_.skip_nulls || bit_util::GetBit(no_nulls_.data(), i))) {
         for (int64_t j = 0; j < slot_length; j++) {
@@ -1268,6 +1521,8 @@ struct GroupedTDigestImpl : public GroupedAggregator {
   TDigestOptions options_;
   int32_t decimal_scale_;
   std::vector<TDigest> tdigests_;
+  // The tdigests of the merged groups, not merged into `tdigests_` yet
+  std::vector<std::vector<TDigest>> pending_merges_;
   TypedBufferBuilder<int64_t> counts_;
   TypedBufferBuilder<bool> no_nulls_;
   ExecContext* ctx_;
@@ -2528,62 +2783,132 @@ struct GroupedCountDistinctImpl : public GroupedAggregator {
   std::shared_ptr<DataType> out_type_;
 };
 
+// ----------------------------------------------------------------------
+// ApproximateCountDistinct implementation
+
+struct GroupedApproximateCountDistinctImpl : public GroupedAggregator {
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    precision_ =
+        checked_cast<const ApproximateCountDistinctOptions&>(*args.options).precision;
+    RETURN_NOT_OK(HyperLogLog::ValidatePrecision(precision_));
+    num_registers_ = HyperLogLog::NumRegisters(precision_);
+    pool_ = ctx->memory_pool();
+    registers_ = BufferBuilder(pool_);
+    return hasher_.Init(ctx, args.inputs[0].GetSharedPtr());
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    auto added_groups = new_num_groups - num_groups_;
+    num_groups_ = new_num_groups;
+    return registers_.Append(added_groups * num_registers_, 0);
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    uint8_t* registers = registers_.mutable_data();
+    const auto* g = batch[1].array.GetValues<uint32_t>(1);
+    auto update = [&](int64_t i, uint64_t hash) {
+      HyperLogLog::Update(precision_, hash, registers + g[i] * num_registers_);
+    };
+    if (batch[0].is_array()) return hasher_.VisitValid(batch[0].array, update);
+    ARROW_ASSIGN_OR_RAISE(std::optional<uint64_t> hash,
+                          hasher_.HashScalar(*batch[0].scalar));
+    if (hash) {
+      for (int64_t i = 0; i < batch.length; ++i) update(i, *hash);
+    }
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedApproximateCountDistinctImpl*>(&raw_other);
+
+    uint8_t* registers = registers_.mutable_data();
+    const uint8_t* other_registers = other->registers_.data();
+
+    auto* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g, ++g) {
+      HyperLogLog::Merge(precision_, other_registers + other_g * num_registers_,
+                         registers + *g * num_registers_);
+    }
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> values,
+                          AllocateBuffer(num_groups_ * sizeof(int64_t), pool_));
+    auto* counts = values->mutable_data_as<int64_t>();
+    const uint8_t* registers = registers_.data();
+    for (int64_t i = 0; i < num_groups_; ++i) {
+      counts[i] = HyperLogLog::Estimate(precision_, registers + i * num_registers_);
+    }
+    return ArrayData::Make(int64(), num_groups_, {nullptr, std::move(values)},
+                           /*null_count=*/0);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int64(); }
+
+  int precision_;
+  int64_t num_registers_;
+  int64_t num_groups_ = 0;
+  MemoryPool* pool_;
+  BufferBuilder registers_;
+  HyperLogLogHasher hasher_;
+};
+
 struct GroupedDistinctImpl : public GroupedCountDistinctImpl {
   Result<Datum> Finalize() override {
+    // The grouper holds each distinct (value, group) pair once: the uniques kept by
+    // the mode are counted per group, then gathered into their lists by a single
+    // Take following a stable counting sort by group
     ARROW_ASSIGN_OR_RAISE(auto uniques, grouper_->GetUniques());
-    ARROW_ASSIGN_OR_RAISE(auto groupings, grouper_->MakeGroupings(
-                                              *uniques[1].array_as<UInt32Array>(),
-                                              static_cast<uint32_t>(num_groups_), ctx_));
-    ARROW_ASSIGN_OR_RAISE(
-        auto list, grouper_->ApplyGroupings(*groupings, *uniques[0].make_array(), ctx_));
-    const auto& values = list->values();
-    DCHECK_EQ(values->offset(), 0);
-    auto* offsets = list->value_offsets()->mutable_data_as<int32_t>();
-    if (options_.mode == CountOptions::ALL ||
-        (options_.mode == CountOptions::ONLY_VALID && values->null_count() == 0)) {
-      return list;
-    } else if (options_.mode == CountOptions::ONLY_VALID) {
-      int32_t prev_offset = offsets[0];
-      for (int64_t i = 0; i < list->length(); i++) {
-        const int32_t slot_length = offsets[i + 1] - prev_offset;
-        const int64_t null_count =
-            slot_length - arrow::internal::CountSetBits(values->null_bitmap()->data(),
-                                                        prev_offset, slot_length);
-        DCHECK_LE(null_count, 1);
-        const int32_t offset = null_count > 0 ? slot_length - 1 : slot_length;
-        prev_offset = offsets[i + 1];
-        offsets[i + 1] = offsets[i] + offset;
-      }
-      auto filter =
-          std::make_shared<BooleanArray>(values->length(), values->null_bitmap());
-      ARROW_ASSIGN_OR_RAISE(
-          auto new_values,
-          Filter(std::move(values), filter, FilterOptions(FilterOptions::DROP), ctx_));
-      return std::make_shared<ListArray>(list->type(), list->length(),
-                                         list->value_offsets(), new_values.make_array());
-    }
-    // ONLY_NULL
-    if (values->null_count() == 0) {
-      std::fill(offsets + 1, offsets + list->length() + 1, offsets[0]);
+    const ArrayData& items = *uniques[0].array();
+    const auto* g = uniques[1].array()->GetValues<uint32_t>(1);
+    const int64_t num_uniques = uniques.length;
+
+    const bool keep_valid = options_.mode != CountOptions::ONLY_NULL;
+    const bool keep_null = options_.mode != CountOptions::ONLY_VALID;
+    const bool all_null = items.type->id() == Type::NA;
+    const uint8_t* validity = items.GetValues<uint8_t>(0, 0);
+    auto is_kept = [&](int64_t i) {
+      const bool valid =
+          !all_null && (!validity || bit_util::GetBit(validity, items.offset + i));
+      return valid ? keep_valid : keep_null;
+    };
+
+    ARROW_ASSIGN_OR_RAISE(auto offsets_buffer,
+                          AllocateBuffer((num_groups_ + 1) * sizeof(int32_t), pool_));
+    auto* offsets = offsets_buffer->mutable_data_as<int32_t>();
+    std::fill(offsets, offsets + num_groups_ + 1, 0);
+    for (int64_t i = 0; i < num_uniques; ++i) {
+      offsets[g[i] + 1] += is_kept(i);
+    }
+    for (int64_t group = 0; group < num_groups_; ++group) {
+      offsets[group + 1] += offsets[group];
+    }
+    const int32_t num_values = offsets[num_groups_];
+
+    std::shared_ptr<Array> values;
+    if (!keep_valid) {
+      // Only nulls are left, there is nothing to gather
+      ARROW_ASSIGN_OR_RAISE(values, MakeArrayOfNull(out_type_, num_values, pool_));
     } else {
-      int32_t prev_offset = offsets[0];
-      for (int64_t i = 0; i < list->length(); i++) {
-        const int32_t slot_length = offsets[i + 1] - prev_offset;
-        const int64_t null_count =
-            slot_length - arrow::internal::CountSetBits(values->null_bitmap()->data(),
-                                                        prev_offset, slot_length);
-        const int32_t offset = null_count > 0 ? 1 : 0;
-        prev_offset = offsets[i + 1];
-        offsets[i + 1] = offsets[i] + offset;
+      ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                            AllocateBuffer(num_values * sizeof(int32_t), pool_));
+      auto* indices = indices_buffer->mutable_data_as<int32_t>();
+      std::vector<int32_t> positions(offsets, offsets + num_groups_);
+      for (int64_t i = 0; i < num_uniques; ++i) {
+        if (is_kept(i)) {
+          indices[positions[g[i]]++] = static_cast<int32_t>(i);
+        }
       }
+      ARROW_ASSIGN_OR_RAISE(
+          Datum taken,
+          Take(uniques[0], Int32Array(num_values, std::move(indices_buffer)),
+               TakeOptions::NoBoundsCheck(), ctx_));
+      values = taken.make_array();
     }
-    ARROW_ASSIGN_OR_RAISE(
-        auto new_values,
-        MakeArrayOfNull(out_type_,
-                        list->length() > 0 ? offsets[list->length()] - offsets[0] : 0,
-                        pool_));
-    return std::make_shared<ListArray>(list->type(), list->length(),
-                                       list->value_offsets(), std::move(new_values));
+    return std::make_shared<ListArray>(list(out_type_), num_groups_,
+                                       std::move(offsets_buffer), std::move(values));
   }
 
   std::shared_ptr<DataType> out_type() const override { return list(out_type_); }
@@ -2959,9 +3284,9 @@ struct GroupedListImpl final : public GroupedAggregator {
     const auto* other_raw_groups = other->groups_.data();
     const auto* g = group_id_mapping.GetValues<uint32_t>(1);
 
-    for (uint32_t other_g = 0; static_cast<int64_t>(other_g) < other->num_args_;
-         ++other_g) {
-      RETURN_NOT_OK(groups_.Append(g[other_raw_groups[other_g]]));
+    RETURN_NOT_OK(groups_.Reserve(other->num_args_));
+    for (int64_t i = 0; i < other->num_args_; ++i) {
+      groups_.UnsafeAppend(g[other_raw_groups[i]]);
     }
 
     const auto* values = reinterpret_cast<const uint8_t*>(other->values_.data());
@@ -2996,7 +3321,7 @@ struct GroupedListImpl final : public GroupedAggregator {
         out_type_, num_args_,
         {has_nulls_ ? std::move(null_bitmap_buffer) : nullptr, std::move(values_buffer)});
     auto values = MakeArray(values_array_data);
-    return Grouper::ApplyGroupings(*groupings, *values);
+    return Grouper::ApplyGroupings(*groupings, *values, ctx_);
   }
 
   std::shared_ptr<DataType> out_type() const override { return list(out_type_); }
@@ -3014,16 +3339,21 @@ template <typename Type>
 struct GroupedListImpl<Type, enable_if_t<is_base_binary_type<Type>::value ||
                                          std::is_same<Type, FixedSizeBinaryType>::value>>
     final : public GroupedAggregator {
-  using Allocator = arrow::stl::allocator<char>;
-  using StringType = std::basic_string<char, std::char_traits<char>, Allocator>;
-  using GetSet = GroupedValueTraits<Type>;
+  static constexpr bool kIsFixedWidth = std::is_same<Type, FixedSizeBinaryType>::value;
+  // Unused for fixed-width values, which need no offsets
+  using offset_type =
+      typename std::conditional_t<kIsFixedWidth, BinaryType, Type>::offset_type;
 
   Status Init(ExecContext* ctx, const KernelInitArgs&) override {
     ctx_ = ctx;
-    allocator_ = Allocator(ctx_->memory_pool());
     // out_type_ initialized by GroupedListInit
     groups_ = TypedBufferBuilder<uint32_t>(ctx_->memory_pool());
     values_bitmap_ = TypedBufferBuilder<bool>(ctx_->memory_pool());
+    offsets_ = TypedBufferBuilder<offset_type>(ctx_->memory_pool());
+    data_ = BufferBuilder(ctx_->memory_pool());
+    if constexpr (!kIsFixedWidth) {
+      RETURN_NOT_OK(offsets_.Append(0));
+    }
     return Status::OK();
   }
 
@@ -3050,16 +3380,13 @@ struct GroupedListImpl<Type, enable_if_t<is_base_binary_type<Type>::value ||
           &values_bitmap_, values_bitmap, offset, num_values));
     }
     num_args_ += num_values;
+    if constexpr (!kIsFixedWidth) {
+      RETURN_NOT_OK(offsets_.Reserve(num_values));
+    }
     return VisitGroupedValues<Type>(
         batch,
-        [&](uint32_t group, std::string_view val) -> Status {
-          values_.emplace_back(StringType(val.data(), val.size(), allocator_));
-          return Status::OK();
-        },
-        [&](uint32_t group) -> Status {
-          values_.emplace_back("");
-          return Status::OK();
-        });
+        [&](uint32_t group, std::string_view val) -> Status { return AppendValue(val); },
+        [&](uint32_t group) -> Status { return AppendNull(); });
   }
 
   Status Merge(GroupedAggregator&& raw_other,
@@ -3068,12 +3395,22 @@ struct GroupedListImpl<Type, enable_if_t<is_base_binary_type<Type>::value ||
     const auto* other_raw_groups = other->groups_.data();
     const auto* g = group_id_mapping.GetValues<uint32_t>(1);
 
-    for (uint32_t other_g = 0; static_cast<int64_t>(other_g) < other->num_args_;
-         ++other_g) {
-      RETURN_NOT_OK(groups_.Append(g[other_raw_groups[other_g]]));
+    RETURN_NOT_OK(groups_.Reserve(other->num_args_));
+    for (int64_t i = 0; i < other->num_args_; ++i) {
+      groups_.UnsafeAppend(g[other_raw_groups[i]]);
     }
 
-    values_.insert(values_.end(), other->values_.begin(), other->values_.end());
+    if constexpr (!kIsFixedWidth) {
+      // Rebase the offsets of the other values after ours
+      RETURN_NOT_OK(CheckDataLength(other->data_.length()));
+      const auto base = static_cast<offset_type>(data_.length());
+      const offset_type* other_offsets = other->offsets_.data();
+      RETURN_NOT_OK(offsets_.Reserve(other->num_args_));
+      for (int64_t i = 1; i <= other->num_args_; ++i) {
+        offsets_.UnsafeAppend(base + other_offsets[i]);
+      }
+    }
+    RETURN_NOT_OK(data_.Append(other->data_.data(), other->data_.length()));
 
     const uint8_t* values_bitmap = other->values_bitmap_.data();
     RETURN_NOT_OK(GroupedValueTraits<BooleanType>::AppendBuffers(
@@ -3085,91 +3422,67 @@ struct GroupedListImpl<Type, enable_if_t<is_base_binary_type<Type>::value ||
   Result<Datum> Finalize() override {
     ARROW_ASSIGN_OR_RAISE(auto groups_buffer, groups_.Finish());
     ARROW_ASSIGN_OR_RAISE(auto null_bitmap_buffer, values_bitmap_.Finish());
+    ARROW_ASSIGN_OR_RAISE(auto data_buffer, data_.Finish());
 
     auto groups = UInt32Array(num_args_, groups_buffer);
     ARROW_ASSIGN_OR_RAISE(
         auto groupings,
         Grouper::MakeGroupings(groups, static_cast<uint32_t>(num_groups_), ctx_));
 
-    auto values_array_data =
-        ArrayData::Make(out_type_, num_args_, {std::move(null_bitmap_buffer), nullptr});
-    RETURN_NOT_OK(MakeOffsetsValues(values_array_data.get(), values_));
-    auto values = MakeArray(values_array_data);
-    return Grouper::ApplyGroupings(*groupings, *values);
+    // The values were accumulated in the layout of out_type_, so they are gathered
+    // into their lists by a single Take
+    std::shared_ptr<ArrayData> values_array_data;
+    if constexpr (kIsFixedWidth) {
+      values_array_data = ArrayData::Make(
+          out_type_, num_args_, {std::move(null_bitmap_buffer), std::move(data_buffer)});
+    } else {
+      ARROW_ASSIGN_OR_RAISE(auto offsets_buffer, offsets_.Finish());
+      values_array_data =
+          ArrayData::Make(out_type_, num_args_,
+                          {std::move(null_bitmap_buffer), std::move(offsets_buffer),
+                           std::move(data_buffer)});
+    }
+    return Grouper::ApplyGroupings(*groupings, *MakeArray(values_array_data), ctx_);
   }
 
-  template <typename T = Type>
-  enable_if_base_binary<T, Status> MakeOffsetsValues(
-      ArrayData* array, const std::vector<std::optional<StringType>>& values) {
-    using offset_type = typename T::offset_type;
-    ARROW_ASSIGN_OR_RAISE(
-        auto raw_offsets,
-        AllocateBuffer((1 + values.size()) * sizeof(offset_type), ctx_->memory_pool()));
-    auto* offsets = raw_offsets->mutable_data_as<offset_type>();
-    offsets[0] = 0;
-    offsets++;
-    const uint8_t* null_bitmap = array->buffers[0]->data();
-    offset_type total_length = 0;
-    for (size_t i = 0; i < values.size(); i++) {
-      if (bit_util::GetBit(null_bitmap, i)) {
-        const std::optional<StringType>& value = values[i];
-        DCHECK(value.has_value());
-        if (value->size() >
-                static_cast<size_t>(std::numeric_limits<offset_type>::max()) ||
-            arrow::internal::AddWithOverflow(
-                total_length, static_cast<offset_type>(value->size()), &total_length)) {
-          return Status::Invalid("Result is too large to fit in ", *array->type,
-                                 " cast to large_ variant of type");
-        }
-      }
-      offsets[i] = total_length;
-    }
-    ARROW_ASSIGN_OR_RAISE(auto data, AllocateBuffer(total_length, ctx_->memory_pool()));
-    int64_t offset = 0;
-    for (size_t i = 0; i < values.size(); i++) {
-      if (bit_util::GetBit(null_bitmap, i)) {
-        const std::optional<StringType>& value = values[i];
-        DCHECK(value.has_value());
-        std::memcpy(data->mutable_data() + offset, value->data(), value->size());
-        offset += value->size();
-      }
+  std::shared_ptr<DataType> out_type() const override { return list(out_type_); }
+
+  Status CheckDataLength(int64_t additional_length) const {
+    if (additional_length >
+        static_cast<int64_t>(std::numeric_limits<offset_type>::max()) - data_.length()) {
+      return Status::Invalid("Result is too large to fit in ", *out_type_,
+                             " cast to large_ variant of type");
     }
-    array->buffers[1] = std::move(raw_offsets);
-    array->buffers.push_back(std::move(data));
     return Status::OK();
   }
 
-  template <typename T = Type>
-  enable_if_same<T, FixedSizeBinaryType, Status> MakeOffsetsValues(
-      ArrayData* array, const std::vector<std::optional<StringType>>& values) {
-    const uint8_t* null_bitmap = array->buffers[0]->data();
-    const int32_t slot_width =
-        checked_cast<const FixedSizeBinaryType&>(*array->type).byte_width();
-    int64_t total_length = values.size() * slot_width;
-    ARROW_ASSIGN_OR_RAISE(auto data, AllocateBuffer(total_length, ctx_->memory_pool()));
-    int64_t offset = 0;
-    for (size_t i = 0; i < values.size(); i++) {
-      if (bit_util::GetBit(null_bitmap, i)) {
-        const std::optional<StringType>& value = values[i];
-        DCHECK(value.has_value());
-        std::memcpy(data->mutable_data() + offset, value->data(), slot_width);
-      } else {
-        std::memset(data->mutable_data() + offset, 0x00, slot_width);
-      }
-      offset += slot_width;
+  Status AppendValue(std::string_view value) {
+    if constexpr (kIsFixedWidth) {
+      return data_.Append(value.data(), static_cast<int64_t>(value.size()));
+    } else {
+      RETURN_NOT_OK(CheckDataLength(static_cast<int64_t>(value.size())));
+      RETURN_NOT_OK(data_.Append(value.data(), static_cast<int64_t>(value.size())));
+      return offsets_.Append(static_cast<offset_type>(data_.length()));
     }
-    array->buffers[1] = std::move(data);
-    return Status::OK();
   }
 
-  std::shared_ptr<DataType> out_type() const override { return list(out_type_); }
+  Status AppendNull() {
+    if constexpr (kIsFixedWidth) {
+      const int32_t byte_width =
+          checked_cast<const FixedSizeBinaryType&>(*out_type_).byte_width();
+      return data_.Append(byte_width, 0);
+    } else {
+      return offsets_.Append(static_cast<offset_type>(data_.length()));
+    }
+  }
 
   ExecContext* ctx_;
-  Allocator allocator_;
   int64_t num_groups_, num_args_ = 0;
-  std::vector<std::optional<StringType>> values_;
   TypedBufferBuilder<uint32_t> groups_;
   TypedBufferBuilder<bool> values_bitmap_;
+  // Values in the layout of out_type_: offsets (for non fixed-width types) and data
+  TypedBufferBuilder<offset_type> offsets_;
+  BufferBuilder data_;
   std::shared_ptr<DataType> out_type_;
 };
 
@@ -3299,6 +3612,171 @@ struct GroupedListFactory {
   HashAggregateKernel kernel;
   InputType argument_type;
 };
+
+// ----------------------------------------------------------------------
+// Pivot implementation
+
+// Rather than copying values, remember for each pivot key and group the position of its
+// value among the consumed batches, and gather all of them with Take() at the end.
+template <typename KeyType>
+struct GroupedPivotImpl final : public GroupedAggregator {
+  using KeyArrayType = typename TypeTraits<KeyType>::ArrayType;
+
+  Status Init(ExecContext* ctx, const KernelInitArgs& args) override {
+    if (args.options == nullptr) {
+      return Status::Invalid("hash_pivot_wider requires PivotWiderOptions");
+    }
+    ctx_ = ctx;
+    const auto& options = checked_cast<const PivotWiderOptions&>(*args.options);
+    key_names_ = options.key_names;
+    unexpected_key_behavior_ = options.unexpected_key_behavior;
+    value_type_ = args.inputs[1].GetSharedPtr();
+
+    FieldVector fields;
+    fields.reserve(key_names_.size());
+    for (const std::string& name : key_names_) {
+      if (!key_indices_.emplace(name, static_cast<int>(fields.size())).second) {
+        return Status::KeyError("Duplicate pivot key name '", name, "'");
+      }
+      fields.push_back(field(name, value_type_));
+    }
+    out_type_ = struct_(std::move(fields));
+    value_indices_.resize(key_names_.size());
+    return Status::OK();
+  }
+
+  Status Resize(int64_t new_num_groups) override {
+    num_groups_ = new_num_groups;
+    for (auto& indices : value_indices_) {
+      indices.resize(new_num_groups, -1);
+    }
+    return Status::OK();
+  }
+
+  Status Consume(const ExecSpan& batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto keys, ToArray(batch[0], batch.length));
+    ARROW_ASSIGN_OR_RAISE(auto values, ToArray(batch[1], batch.length));
+    const auto& key_array = checked_cast<const KeyArrayType&>(*keys);
+    const uint32_t* groups = batch[2].array.GetValues<uint32_t>(1);
+
+    bool any_value = false;
+    for (int64_t i = 0; i < batch.length; ++i) {
+      if (key_array.IsNull(i) || values->IsNull(i)) continue;
+      const auto key = key_array.GetView(i);
+      auto it = key_indices_.find(key);
+      if (it == key_indices_.end()) {
+        if (unexpected_key_behavior_ == PivotWiderOptions::RAISE) {
+          return Status::KeyError("Unexpected pivot key: ", key);
+        }
+        continue;
+      }
+      int64_t& index = value_indices_[it->second][groups[i]];
+      if (index != -1) {
+        return DuplicateValue(it->first);
+      }
+      index = num_values_ + i;
+      any_value = true;
+    }
+    // Batches without any pivoted value needn't be kept
+    if (any_value) {
+      values_.push_back(std::move(values));
+      num_values_ += batch.length;
+    }
+    return Status::OK();
+  }
+
+  Status Merge(GroupedAggregator&& raw_other,
+               const ArrayData& group_id_mapping) override {
+    auto other = checked_cast<GroupedPivotImpl*>(&raw_other);
+    const uint32_t* g = group_id_mapping.GetValues<uint32_t>(1);
+    for (size_t k = 0; k < value_indices_.size(); ++k) {
+      const std::vector<int64_t>& other_indices = other->value_indices_[k];
+      for (int64_t other_g = 0; other_g < group_id_mapping.length; ++other_g) {
+        if (other_indices[other_g] == -1) continue;
+        int64_t& index = value_indices_[k][g[other_g]];
+        if (index != -1) {
+          return DuplicateValue(key_names_[k]);
+        }
+        index = num_values_ + other_indices[other_g];
+      }
+    }
+    values_.insert(values_.end(), std::make_move_iterator(other->values_.begin()),
+                   std::make_move_iterator(other->values_.end()));
+    num_values_ += other->num_values_;
+    return Status::OK();
+  }
+
+  Result<Datum> Finalize() override {
+    MemoryPool* pool = ctx_->memory_pool();
+    std::shared_ptr<Array> values;
+    if (values_.empty()) {
+      ARROW_ASSIGN_OR_RAISE(values, MakeEmptyArray(value_type_, pool));
+    } else if (values_.size() == 1) {
+      values = std::move(values_[0]);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(values, Concatenate(values_, pool));
+    }
+    values_.clear();
+
+    ArrayVector columns;
+    columns.reserve(value_indices_.size());
+    for (const auto& indices : value_indices_) {
+      Int64Builder builder(pool);
+      RETURN_NOT_OK(builder.Reserve(num_groups_));
+      for (int64_t index : indices) {
+        if (index == -1) {
+          builder.UnsafeAppendNull();
+        } else {
+          builder.UnsafeAppend(index);
+        }
+      }
+      ARROW_ASSIGN_OR_RAISE(auto take_indices, builder.Finish());
+      ARROW_ASSIGN_OR_RAISE(auto column, Take(*values, *take_indices,
+                                              TakeOptions::NoBoundsCheck(), ctx_));
+      columns.push_back(std::move(column));
+    }
+    return std::make_shared<StructArray>(out_type_, num_groups_, std::move(columns))
+        ->data();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return out_type_; }
+
+ private:
+  Result<std::shared_ptr<Array>> ToArray(const ExecValue& value, int64_t length) {
+    if (value.is_array()) {
+      return value.array.ToArray();
+    }
+    return MakeArrayFromScalar(*value.scalar, length, ctx_->memory_pool());
+  }
+
+  static Status DuplicateValue(std::string_view key) {
+    return Status::Invalid("Encountered more than one non-null value for pivot key '",
+                           key, "' in a group");
+  }
+
+  ExecContext* ctx_;
+  std::vector<std::string> key_names_;
+  PivotWiderOptions::UnexpectedKeyBehavior unexpected_key_behavior_;
+  // Views into key_names_
+  std::unordered_map<std::string_view, int> key_indices_;
+  std::shared_ptr<DataType> value_type_;
+  std::shared_ptr<DataType> out_type_;
+  int64_t num_groups_ = 0;
+  // The consumed batches holding pivoted values, and their total length
+  ArrayVector values_;
+  int64_t num_values_ = 0;
+  // For each pivot key and group, the index of the value in values_, or -1
+  std::vector<std::vector<int64_t>> value_indices_;
+};
+
+template <typename KeyType>
+HashAggregateKernel MakePivotKernel() {
+  return MakeKernel(
+      KernelSignature::Make({InputType(KeyType::type_id), InputType::Any(),
+                             InputType(Type::UINT32)},
+                            OutputType(ResolveGroupOutputType)),
+      HashAggregateInit<GroupedPivotImpl<KeyType>>);
+}
 }  // namespace
 
 namespace {
@@ -3367,6 +3845,27 @@ const FunctionDoc hash_approximate_median_doc{
     {"array", "group_id_array"},
     "ScalarAggregateOptions"};
 
+const FunctionDoc hash_quantile_doc{
+    "Compute exact quantiles of values in each group",
+    ("By default, the 0.5 quantile (i.e. median) is returned.\n"
+     "If a quantile lies between two data points, an interpolated value is\n"
+     "returned based on the selected interpolation method.\n"
+     "Nulls and NaNs are ignored.\n"
+     "Nulls are returned if there are no valid data points.\n"
+     "All values of the groups are buffered until the result is computed."),
+    {"array", "group_id_array"},
+    "QuantileOptions"};
+
+const FunctionDoc hash_median_doc{
+    "Compute exact medians of values in each group",
+    ("The median of an even number of values is the mean of the two\n"
+     "middle values.\n"
+     "Nulls and NaNs are ignored.\n"
+     "Nulls are returned if there are no valid data points.\n"
+     "All values of the groups are buffered until the result is computed."),
+    {"array", "group_id_array"},
+    "ScalarAggregateOptions"};
+
 const FunctionDoc hash_first_last_doc{
     "Compute the first and last of values in each group",
     ("Null values are ignored by default.\n"
@@ -3422,6 +3921,14 @@ const FunctionDoc hash_count_distinct_doc{
     {"array", "group_id_array"},
     "CountOptions"};
 
+const FunctionDoc hash_approximate_count_distinct_doc{
+    "Approximate the number of distinct values in each group",
+    ("The number is estimated with a HyperLogLog sketch per group, whose size\n"
+     "and accuracy are set through ApproximateCountDistinctOptions.  Null values\n"
+     "are not counted.  NaNs and signed zeroes are not normalized."),
+    {"array", "group_id_array"},
+    "ApproximateCountDistinctOptions"};
+
 const FunctionDoc hash_distinct_doc{
     "Keep the distinct values in each group",
     ("Whether nulls/values are kept is controlled by CountOptions.\n"
@@ -3436,12 +3943,25 @@ const FunctionDoc hash_one_doc{"Get one value from each group",
 const FunctionDoc hash_list_doc{"List all values in each group",
                                 ("Null values are also returned."),
                                 {"array", "group_id_array"}};
+
+const FunctionDoc hash_pivot_wider_doc{
+    "Pivot values according to a pivot key column, in each group",
+    ("Each group's output is a struct with a field for each of the key names\n"
+     "in PivotWiderOptions, holding the value found next to that pivot key in\n"
+     "the group, or null if there is none. Rows whose key or value is null are\n"
+     "ignored. Other unexpected keys are ignored or raise an error depending on\n"
+     "PivotWiderOptions. An error is raised if several non-null values are found\n"
+     "for the same key in a group."),
+    {"pivot_keys", "pivot_values", "group_id_array"},
+    "PivotWiderOptions",
+    /*options_required=*/true};
 }  // namespace
 
 void RegisterHashAggregateBasic(FunctionRegistry* registry) {
   static auto default_count_options = CountOptions::Defaults();
   static auto default_scalar_aggregate_options = ScalarAggregateOptions::Defaults();
   static auto default_tdigest_options = TDigestOptions::Defaults();
+  static auto default_quantile_options = QuantileOptions::Defaults();
   static auto default_variance_options = VarianceOptions::Defaults();
 
   {
@@ -3564,6 +4084,31 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 
+  HashAggregateFunction* quantile_func = nullptr;
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_quantile", Arity::Binary(), hash_quantile_doc, &default_quantile_options);
+    DCHECK_OK(
+        AddHashAggKernels(SignedIntTypes(), GroupedQuantileFactory::Make, func.get()));
+    DCHECK_OK(
+        AddHashAggKernels(UnsignedIntTypes(), GroupedQuantileFactory::Make, func.get()));
+    DCHECK_OK(AddHashAggKernels(FloatingPointTypes(), GroupedQuantileFactory::Make,
+                                func.get()));
+    // Type parameters are ignored
+    DCHECK_OK(AddHashAggKernels({decimal128(1, 1), decimal256(1, 1)},
+                                GroupedQuantileFactory::Make, func.get()));
+    quantile_func = func.get();
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_median", Arity::Binary(), hash_median_doc,
+        &default_scalar_aggregate_options);
+    DCHECK_OK(func->AddKernel(MakeMedianKernel(quantile_func)));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
   HashAggregateFunction* first_last_func = nullptr;
   {
     auto func = std::make_shared<HashAggregateFunction>(
@@ -3654,6 +4199,19 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 
+  {
+    static auto default_approximate_count_distinct_options =
+        ApproximateCountDistinctOptions::Defaults();
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_approximate_count_distinct", Arity::Binary(),
+        hash_approximate_count_distinct_doc, &default_approximate_count_distinct_options);
+    for (Type::type id : HyperLogLogHasher::InputTypes()) {
+      DCHECK_OK(func->AddKernel(MakeKernel(
+          InputType(id), HashAggregateInit<GroupedApproximateCountDistinctImpl>)));
+    }
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+
   {
     auto func = std::make_shared<HashAggregateFunction>(
         "hash_distinct", Arity::Binary(), hash_distinct_doc, &default_count_options);
@@ -3685,6 +4243,16 @@ void RegisterHashAggregateBasic(FunctionRegistry* registry) {
                                 GroupedListFactory::Make, func.get()));
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
+
+  {
+    auto func = std::make_shared<HashAggregateFunction>(
+        "hash_pivot_wider", Arity::Ternary(), hash_pivot_wider_doc);
+    DCHECK_OK(func->AddKernel(MakePivotKernel<BinaryType>()));
+    DCHECK_OK(func->AddKernel(MakePivotKernel<StringType>()));
+    DCHECK_OK(func->AddKernel(MakePivotKernel<LargeBinaryType>()));
+    DCHECK_OK(func->AddKernel(MakePivotKernel<LargeStringType>()));
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
 }
 
 }  // namespace internal
@@ -0,0 +1,211 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "arrow/array/data.h"
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/key_hash_internal.h"
+#include "arrow/compute/light_array_internal.h"
+#include "arrow/compute/util.h"
+#include "arrow/result.h"
+#include "arrow/scalar.h"
+#include "arrow/status.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/cpu_info.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+/// \brief HyperLogLog sketches, estimating the number of distinct values
+///
+/// A sketch is 2^precision one-byte registers.  The first `precision` bits of the
+/// hash of a value pick a register, which keeps the largest rank (the position of
+/// the first set bit) of the remaining bits of the hashes it saw.  Merging sketches
+/// takes the maximum of each register, so merged partial states estimate exactly as
+/// if all values were seen by one sketch.
+struct HyperLogLog {
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+
+  static Status ValidatePrecision(int precision) {
+    if (precision < kMinPrecision || precision > kMaxPrecision) {
+      return Status::Invalid("HyperLogLog precision must be between ", kMinPrecision,
+                             " and ", kMaxPrecision, ", got ", precision);
+    }
+    return Status::OK();
+  }
+
+  static int64_t NumRegisters(int precision) { return int64_t{1} << precision; }
+
+  static void Update(int precision, uint64_t hash, uint8_t* registers) {
+    // The hashes of integers in key_hash_internal.h are a multiplication, whose
+    // high bits only depend on the low bits of the value, so mix them further
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+
+    const uint64_t index = hash >> (64 - precision);
+    // A guard bit bounds the rank when the remaining bits are all zero
+    const uint64_t rest = (hash << precision) | (uint64_t{1} << (precision - 1));
+    const auto rank = static_cast<uint8_t>(bit_util::CountLeadingZeros(rest) + 1);
+    registers[index] = std::max(registers[index], rank);
+  }
+
+  static void Merge(int precision, const uint8_t* other, uint8_t* registers) {
+    const int64_t num_registers = NumRegisters(precision);
+    for (int64_t i = 0; i < num_registers; ++i) {
+      registers[i] = std::max(registers[i], other[i]);
+    }
+  }
+
+  static int64_t Estimate(int precision, const uint8_t* registers) {
+    const int64_t num_registers = NumRegisters(precision);
+    const auto m = static_cast<double>(num_registers);
+    double sum = 0;
+    int64_t num_zeros = 0;
+    for (int64_t i = 0; i < num_registers; ++i) {
+      sum += std::ldexp(1.0, -registers[i]);
+      num_zeros += registers[i] == 0;
+    }
+    double alpha;
+    switch (num_registers) {
+      case 16:
+        alpha = 0.673;
+        break;
+      case 32:
+        alpha = 0.697;
+        break;
+      case 64:
+        alpha = 0.709;
+        break;
+      default:
+        alpha = 0.7213 / (1 + 1.079 / m);
+        break;
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && num_zeros > 0) {
+      // Linear counting is more accurate for small cardinalities
+      estimate = m * std::log(m / static_cast<double>(num_zeros));
+    }
+    return static_cast<int64_t>(std::llround(estimate));
+  }
+};
+
+/// \brief Hash values for HyperLogLog sketches with the hashing of key columns
+class HyperLogLogHasher {
+ public:
+  /// The types whose values can be hashed
+  static const std::vector<Type::type>& InputTypes() {
+    static const std::vector<Type::type> types = {
+        Type::NA,
+        Type::BOOL,
+        Type::UINT8,
+        Type::INT8,
+        Type::UINT16,
+        Type::INT16,
+        Type::UINT32,
+        Type::INT32,
+        Type::UINT64,
+        Type::INT64,
+        Type::HALF_FLOAT,
+        Type::FLOAT,
+        Type::DOUBLE,
+        Type::DATE32,
+        Type::DATE64,
+        Type::TIME32,
+        Type::TIME64,
+        Type::TIMESTAMP,
+        Type::DURATION,
+        Type::INTERVAL_MONTHS,
+        Type::INTERVAL_DAY_TIME,
+        Type::INTERVAL_MONTH_DAY_NANO,
+        Type::DECIMAL128,
+        Type::DECIMAL256,
+        Type::FIXED_SIZE_BINARY,
+        Type::BINARY,
+        Type::STRING,
+        Type::LARGE_BINARY,
+        Type::LARGE_STRING,
+    };
+    return types;
+  }
+
+  Status Init(ExecContext* ctx, const std::shared_ptr<DataType>& type) {
+    pool_ = ctx->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(metadata_, ColumnMetadataFromDataType(type));
+    ctx_.hardware_flags = ctx->cpu_info()->hardware_flags();
+    ctx_.stack = &stack_;
+    return stack_.Init(pool_,
+                       4 * arrow::util::MiniBatch::kMiniBatchLength * sizeof(uint64_t));
+  }
+
+  /// \brief Call visit(i, hash) for each valid value i of an array
+  template <typename Visit>
+  Status VisitValid(const ArraySpan& values, Visit&& visit) {
+    if (metadata_.is_null_type) return Status::OK();
+    const std::shared_ptr<ArrayData> data = values.ToArrayData();
+    const uint8_t* validity = values.MayHaveNulls() ? values.buffers[0].data : NULLPTR;
+    constexpr int64_t kBatchLength = arrow::util::MiniBatch::kMiniBatchLength;
+    uint64_t hashes[kBatchLength];
+    for (int64_t start = 0; start < values.length; start += kBatchLength) {
+      const int64_t length = std::min(values.length - start, kBatchLength);
+      Hashing64::HashMultiColumn(
+          {ColumnArrayFromArrayDataAndMetadata(data, metadata_, start, length)}, &ctx_,
+          hashes);
+      for (int64_t i = 0; i < length; ++i) {
+        if (validity == NULLPTR ||
+            bit_util::GetBit(validity, values.offset + start + i)) {
+          visit(start + i, hashes[i]);
+        }
+      }
+    }
+    return Status::OK();
+  }
+
+  /// \brief The hash of a scalar, or nothing if it is null
+  Result<std::optional<uint64_t>> HashScalar(const Scalar& value) {
+    std::optional<uint64_t> hash;
+    if (!value.is_valid) return hash;
+    ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(value, 1, pool_));
+    RETURN_NOT_OK(VisitValid(ArraySpan(*array->data()),
+                             [&](int64_t, uint64_t value_hash) { hash = value_hash; }));
+    return hash;
+  }
+
+ private:
+  MemoryPool* pool_;
+  KeyColumnMetadata metadata_;
+  LightContext ctx_;
+  arrow::util::TempVectorStack stack_;
+};
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -792,6 +792,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunction(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -806,6 +807,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionNotNull(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -818,6 +820,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunction(std::string name,
     DCHECK_OK(func->AddKernel({ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -840,6 +843,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunctionWithFixedIntOutType(
     DCHECK_OK(func->AddKernel({InputType(Type::DECIMAL256)}, int64(), exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -854,6 +858,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunctionNotNull(std::string n
     DCHECK_OK(func->AddKernel({ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -870,6 +875,7 @@ std::shared_ptr<ScalarFunction> MakeUnarySignedArithmeticFunctionNotNull(
     }
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -882,6 +888,7 @@ std::shared_ptr<ScalarFunction> MakeBitWiseFunctionNotNull(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -894,6 +901,7 @@ std::shared_ptr<ScalarFunction> MakeShiftFunctionNotNull(std::string name,
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -906,6 +914,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunctionFloatingPoint(
     DCHECK_OK(func->AddKernel({ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -919,6 +928,7 @@ std::shared_ptr<ScalarFunction> MakeUnaryArithmeticFunctionFloatingPointNotNull(
     DCHECK_OK(func->AddKernel({ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -932,6 +942,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionFloatingPoint(std::string
     DCHECK_OK(func->AddKernel({ty, ty}, ty, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -946,6 +957,7 @@ std::shared_ptr<ScalarFunction> MakeArithmeticFunctionFloatingPointNotNull(
     DCHECK_OK(func->AddKernel({ty, ty}, output, exec));
   }
   AddNullExec(func.get());
+  AddRunEndEncodedKernels(func.get());
   return func;
 }
 
@@ -1643,6 +1655,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
       DCHECK_OK(bit_wise_not->AddKernel({ty}, ty, exec));
     }
     AddNullExec(bit_wise_not.get());
+    AddRunEndEncodedKernels(bit_wise_not.get());
     DCHECK_OK(registry->AddFunction(std::move(bit_wise_not)));
   }
 
@@ -1152,6 +1152,49 @@ TEST(TestBinaryArithmetic, AddWithImplicitCastsUint64EdgeCase) {
                                      ArrayFromJSON(uint64(), "[18446744073709551615]")}));
 }
 
+TEST(TestBinaryArithmetic, RunEndEncoded) {
+  // Run-end encoded input gives run-end encoded output equal to the result on the
+  // decoded input
+  auto encode = [](const std::shared_ptr<Array>& array,
+                   const std::shared_ptr<DataType>& run_end_type) {
+    RunEndEncodeOptions options(run_end_type);
+    EXPECT_OK_AND_ASSIGN(Datum encoded,
+                         CallFunction("run_end_encode", {array}, &options));
+    return encoded.make_array();
+  };
+  auto check = [](const std::string& name, const std::vector<Datum>& args,
+                  const std::vector<Datum>& decoded_args) {
+    ARROW_SCOPED_TRACE(name);
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(name, decoded_args));
+    ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(name, args));
+    ValidateOutput(actual);
+    ASSERT_EQ(actual.type()->id(), Type::RUN_END_ENCODED);
+    ASSERT_OK_AND_ASSIGN(Datum decoded, CallFunction("run_end_decode", {actual}));
+    AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+  };
+
+  auto lhs = ArrayFromJSON(int32(), "[1, 1, 1, null, null, 5, 5, 7, 2, 2]");
+  auto rhs = ArrayFromJSON(int32(), "[3, 3, 4, 4, 4, 4, null, null, 0, 0]");
+  auto scalar = ScalarFromJSON(int64(), "3");
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE(run_end_type->ToString());
+    auto ree_lhs = encode(lhs, run_end_type);
+    auto ree_rhs = encode(rhs, int32());
+    for (auto [offset, length] : {std::pair<int64_t, int64_t>{0, 10}, {2, 6}, {4, 0}}) {
+      auto l = lhs->Slice(offset, length), r = rhs->Slice(offset, length);
+      auto ree_l = ree_lhs->Slice(offset, length), ree_r = ree_rhs->Slice(offset, length);
+      for (std::string name : {"add", "subtract_checked", "multiply", "power"}) {
+        check(name, {ree_l, scalar}, {l, scalar});
+        check(name, {scalar, ree_l}, {scalar, l});
+        check(name, {ree_l, ree_r}, {l, r});
+        check(name, {ree_l, r}, {l, r});
+      }
+      check("negate", {ree_l}, {l});
+      check("sqrt", {ree_l}, {l});
+    }
+  }
+}
+
 TEST(TestUnaryArithmetic, DispatchBest) {
   // All types (with _checked variant)
   for (std::string name : {"abs"}) {
@@ -33,7 +33,7 @@ using internal::BitBlockCount;
 using internal::CheckIntegersInRange;
 using internal::IntegersCanFit;
 using internal::OptionalBitBlockCounter;
-using internal::ParseValue;
+using internal::ParseValues;
 using internal::PrimitiveScalarBase;
 using util::Float16;
 
@@ -298,35 +298,38 @@ struct CastFunctor<O, BooleanType, enable_if_number<O>> {
 // ----------------------------------------------------------------------
 // String to number
 
-template <typename OutType>
-struct ParseString {
-  template <typename OutValue, typename Arg0Value>
-  OutValue Call(KernelContext* ctx, Arg0Value val, Status* st) const {
-    OutValue result = OutValue(0);
-    if (ARROW_PREDICT_FALSE(!ParseValue<OutType>(val.data(), val.size(), &result))) {
-      *st = Status::Invalid("Failed to parse string: '", val, "' as a scalar of type ",
-                            TypeTraits<OutType>::type_singleton()->ToString());
+// Parses all strings in one pass over the offsets, rather than visiting them one by one
+template <typename O, typename I>
+struct ParseStrings {
+  using OutValue = typename GetOutputType<O>::T;
+  using offset_type = typename I::offset_type;
+
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& out_type = checked_cast<const O&>(*out->type());
+    const ArraySpan& input = batch[0].array;
+    const offset_type* offsets = input.GetValues<offset_type>(1);
+    const uint8_t* data = input.buffers[2].data;
+    const int64_t failed_index = ParseValues(
+        out_type, offsets, data, input.MayHaveNulls() ? input.buffers[0].data : nullptr,
+        input.offset, input.length, out->array_span_mutable()->GetValues<OutValue>(1));
+    if (ARROW_PREDICT_FALSE(failed_index >= 0)) {
+      std::string_view val(reinterpret_cast<const char*>(data + offsets[failed_index]),
+                           offsets[failed_index + 1] - offsets[failed_index]);
+      return Status::Invalid("Failed to parse string: '", val, "' as a scalar of type ",
+                             out_type.ToString());
     }
-    return result;
+    return Status::OK();
   }
 };
 
 template <typename O, typename I>
 struct CastFunctor<
-    O, I, enable_if_t<(is_number_type<O>::value && is_base_binary_type<I>::value)>> {
-  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    return applicator::ScalarUnaryNotNull<O, I, ParseString<O>>::Exec(ctx, batch, out);
-  }
-};
+    O, I, enable_if_t<(is_number_type<O>::value && is_base_binary_type<I>::value)>>
+    : public ParseStrings<O, I> {};
 
 template <>
-struct CastFunctor<HalfFloatType, StringType, enable_if_t<true>> {
-  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    return applicator::ScalarUnaryNotNull<HalfFloatType, StringType,
-                                          ParseString<HalfFloatType>>::Exec(ctx, batch,
-                                                                            out);
-  }
-};
+struct CastFunctor<HalfFloatType, StringType, enable_if_t<true>>
+    : public ParseStrings<HalfFloatType, StringType> {};
 
 // ----------------------------------------------------------------------
 // Decimal to integer
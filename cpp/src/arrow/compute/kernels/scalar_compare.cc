@@ -22,8 +22,10 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bitmap_ops.h"
 
 namespace arrow {
@@ -309,6 +311,57 @@ struct CompareTimestamps {
   }
 };
 
+// Compare binary and string views without materializing them: equality checks the
+// size and inlined prefix as a single word, and orderings look at the out-of-line
+// data only when the prefixes tie.
+template <typename Op>
+struct CompareBinaryViews {
+  using c_type = BinaryViewType::c_type;
+
+  static bool Compare(const c_type& left, const c_type& right,
+                      const std::shared_ptr<Buffer>* left_buffers,
+                      const std::shared_ptr<Buffer>* right_buffers) {
+    if constexpr (std::is_same_v<Op, Equal>) {
+      return util::EqualBinaryView(left, right, left_buffers, right_buffers);
+    } else if constexpr (std::is_same_v<Op, NotEqual>) {
+      return !util::EqualBinaryView(left, right, left_buffers, right_buffers);
+    } else {
+      const int cmp = util::CompareBinaryView(left, right, left_buffers, right_buffers);
+      return Op::template Call<bool, int, int>(nullptr, cmp, 0, nullptr);
+    }
+  }
+
+  static Status Exec(KernelContext*, const ExecSpan& batch, ExecResult* out) {
+    // A scalar is laid out as a view array of length 1, which is then read with
+    // a stride of 0
+    std::optional<ArraySpan> left_scalar, right_scalar;
+    const ArraySpan& left = batch[0].is_array()
+                                ? batch[0].array
+                                : left_scalar.emplace(*batch[0].scalar);
+    const ArraySpan& right = batch[1].is_array()
+                                 ? batch[1].array
+                                 : right_scalar.emplace(*batch[1].scalar);
+    const int64_t left_stride = batch[0].is_array() ? 1 : 0;
+    const int64_t right_stride = batch[1].is_array() ? 1 : 0;
+    const c_type* left_views = left.GetValues<c_type>(1);
+    const c_type* right_views = right.GetValues<c_type>(1);
+    // Null scalars have no variadic buffers, but their views are never dereferenced
+    const auto* left_buffers = left.buffers[2].data_as<std::shared_ptr<Buffer>>();
+    const auto* right_buffers = right.buffers[2].data_as<std::shared_ptr<Buffer>>();
+
+    ArraySpan* out_arr = out->array_span_mutable();
+    int64_t i = 0;
+    GenerateBitsUnrolled(out_arr->buffers[1].data, out_arr->offset, batch.length, [&] {
+      const bool result = Compare(left_views[i * left_stride],
+                                  right_views[i * right_stride], left_buffers,
+                                  right_buffers);
+      ++i;
+      return result;
+    });
+    return Status::OK();
+  }
+};
+
 template <typename Op>
 ScalarKernel GetCompareKernel(InputType ty, Type::type compare_type,
                               ArrayKernelExec exec) {
@@ -432,6 +485,10 @@ std::shared_ptr<ScalarFunction> MakeCompareFunction(std::string name, FunctionDo
     DCHECK_OK(func->AddKernel({ty, ty}, boolean(), std::move(exec)));
   }
 
+  for (const auto& ty : {binary_view(), utf8_view()}) {
+    DCHECK_OK(func->AddKernel({ty, ty}, boolean(), CompareBinaryViews<Op>::Exec));
+  }
+
   for (const auto id : {Type::DECIMAL128, Type::DECIMAL256}) {
     auto exec = GenerateDecimal<applicator::ScalarBinaryEqualTypes, BooleanType, Op>(id);
     DCHECK_OK(
@@ -891,20 +948,22 @@ const FunctionDoc max_element_wise_doc{
 }  // namespace
 
 void RegisterScalarComparison(FunctionRegistry* registry) {
-  DCHECK_OK(registry->AddFunction(MakeCompareFunction<Equal>("equal", equal_doc)));
-  DCHECK_OK(
-      registry->AddFunction(MakeCompareFunction<NotEqual>("not_equal", not_equal_doc)));
-
+  auto equal = MakeCompareFunction<Equal>("equal", equal_doc);
+  auto not_equal = MakeCompareFunction<NotEqual>("not_equal", not_equal_doc);
   auto greater = MakeCompareFunction<Greater>("greater", greater_doc);
   auto greater_equal =
       MakeCompareFunction<GreaterEqual>("greater_equal", greater_equal_doc);
 
   auto less = MakeFlippedCompare("less", *greater, less_doc);
   auto less_equal = MakeFlippedCompare("less_equal", *greater_equal, less_equal_doc);
-  DCHECK_OK(registry->AddFunction(std::move(less)));
-  DCHECK_OK(registry->AddFunction(std::move(less_equal)));
-  DCHECK_OK(registry->AddFunction(std::move(greater)));
-  DCHECK_OK(registry->AddFunction(std::move(greater_equal)));
+
+  for (const auto& func : {equal, not_equal, greater, greater_equal, less, less_equal}) {
+    // Comparing a dictionary with a scalar only compares the dictionary values,
+    // and comparing run-end encoded input only compares the run values
+    AddDictionaryPredicateKernels(func.get());
+    AddRunEndEncodedKernels(func.get());
+    DCHECK_OK(registry->AddFunction(func));
+  }
 
   // ----------------------------------------------------------------------
   // Variadic element-wise functions
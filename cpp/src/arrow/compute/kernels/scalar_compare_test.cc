@@ -1175,6 +1175,142 @@ TEST_F(TestStringCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TEST_F(TestStringCompareKernel, StringViews) {
+  // Strings longer than 12 bytes are stored out-of-line, and these share prefixes
+  // so that the comparison has to look past the inlined part
+  const char* lhs = R"(["abc", "abcdefghijklmnopq", null, "", "abcd", "abcdefghijklmnopz",
+                        "ab", "abcdefghijklm"])";
+  const char* rhs = R"(["abd", "abcdefghijklmnopq", "x", "a", "abcd", "abcdefghijklmnopq",
+                        "abc", "abcdefghijkl"])";
+  for (const auto& ty : {utf8_view(), binary_view()}) {
+    ARROW_SCOPED_TRACE(ty->ToString());
+    auto lhs_arr = ArrayFromJSON(ty, lhs);
+    auto rhs_arr = ArrayFromJSON(ty, rhs);
+    auto scalar = ScalarFromJSON(ty, R"("abcdefghijklmnopq")");
+    auto check = [&](CompareOperator op, const char* array_array,
+                     const char* array_scalar) {
+      CompareOptions options(op);
+      ValidateCompare<StringViewType>(options, lhs_arr, rhs_arr,
+                                      ArrayFromJSON(boolean(), array_array));
+      ValidateCompare<StringViewType>(options, lhs_arr, scalar,
+                                      ArrayFromJSON(boolean(), array_scalar));
+    };
+    check(EQUAL, "[0, 1, null, 0, 1, 0, 0, 0]", "[0, 1, null, 0, 0, 0, 0, 0]");
+    check(NOT_EQUAL, "[1, 0, null, 1, 0, 1, 1, 1]", "[1, 0, null, 1, 1, 1, 1, 1]");
+    check(GREATER, "[0, 0, null, 0, 0, 1, 0, 1]", "[0, 0, null, 0, 0, 1, 0, 0]");
+    check(GREATER_EQUAL, "[0, 1, null, 0, 1, 1, 0, 1]", "[0, 1, null, 0, 0, 1, 0, 0]");
+    check(LESS, "[1, 0, null, 1, 0, 0, 1, 0]", "[1, 0, null, 1, 1, 0, 1, 1]");
+    check(LESS_EQUAL, "[1, 1, null, 1, 1, 0, 1, 0]", "[1, 1, null, 1, 1, 0, 1, 1]");
+
+    ValidateCompare<StringViewType>(
+        CompareOptions(LESS), scalar, lhs_arr,
+        ArrayFromJSON(boolean(), "[0, 0, null, 0, 0, 1, 0, 0]"));
+    ValidateCompare<StringViewType>(CompareOptions(EQUAL), lhs_arr,
+                                    ScalarFromJSON(ty, "null"),
+                                    ArrayFromJSON(boolean(), "[null, null, null, null, "
+                                                             "null, null, null, null]"));
+  }
+}
+
+TEST_F(TestStringCompareKernel, RandomCompareStringViews) {
+  // Cross-check against the offsets-based kernels
+  auto to_offsets = [](const Array& array) {
+    const auto& views = ::arrow::internal::checked_cast<const StringViewArray&>(array);
+    StringBuilder builder;
+    for (int64_t i = 0; i < views.length(); ++i) {
+      if (views.IsNull(i)) {
+        ARROW_EXPECT_OK(builder.AppendNull());
+      } else {
+        ARROW_EXPECT_OK(builder.Append(views.GetView(i)));
+      }
+    }
+    return builder.Finish().ValueOrDie();
+  };
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto lhs = rand.StringView(1000, 0, 16, null_probability);
+    auto rhs = rand.StringView(1000, 0, 16, null_probability);
+    auto lhs_offsets = to_offsets(*lhs);
+    auto rhs_offsets = to_offsets(*rhs);
+    for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+      const std::string function = CompareOperatorToFunctionName(op);
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           CallFunction(function, {lhs_offsets, rhs_offsets}));
+      ValidateCompare<StringViewType>(CompareOptions(op), lhs, rhs, expected);
+    }
+  }
+}
+
+TEST(TestCompareKernel, DictionaryArray) {
+  // Dictionary inputs are compared on their dictionary values and then mapped
+  // through the indices, which must give the same result as decoding first
+  auto dict = ArrayFromJSON(utf8(), R"(["abc", "xyz", null, "abd"])");
+  for (const auto& index_ty : all_dictionary_index_types()) {
+    ARROW_SCOPED_TRACE(index_ty->ToString());
+    auto indices = ArrayFromJSON(index_ty, "[0, 1, 2, 3, null, 3, 0]");
+    ASSERT_OK_AND_ASSIGN(auto array, DictionaryArray::FromArrays(
+                                         dictionary(index_ty, utf8()), indices, dict));
+    ASSERT_OK_AND_ASSIGN(Datum decoded, Cast(array, utf8()));
+    auto scalar = ScalarFromJSON(utf8(), R"("abd")");
+    for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+      const std::string function = CompareOperatorToFunctionName(op);
+      for (const auto& sliced : {array, array->Slice(2)}) {
+        ASSERT_OK_AND_ASSIGN(Datum decoded_slice, Cast(sliced, utf8()));
+        ASSERT_OK_AND_ASSIGN(Datum expected,
+                             CallFunction(function, {decoded_slice, scalar}));
+        CheckScalarBinary(function, sliced, scalar, expected.make_array());
+        ASSERT_OK_AND_ASSIGN(expected, CallFunction(function, {scalar, decoded_slice}));
+        CheckScalarBinary(function, scalar, sliced, expected.make_array());
+        // Other array arguments are compared against the decoded values
+        ASSERT_OK_AND_ASSIGN(expected,
+                             CallFunction(function, {decoded_slice, decoded_slice}));
+        ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(function, {sliced, sliced}));
+        AssertDatumsEqual(expected, actual, /*verbose=*/true);
+      }
+    }
+  }
+}
+
+TEST(TestCompareKernel, RunEndEncoded) {
+  // Run-end encoded inputs are compared on their run values
+  auto encode = [](const std::shared_ptr<Array>& array,
+                   const std::shared_ptr<DataType>& run_end_type) {
+    RunEndEncodeOptions options(run_end_type);
+    EXPECT_OK_AND_ASSIGN(Datum encoded,
+                         CallFunction("run_end_encode", {array}, &options));
+    return encoded.make_array();
+  };
+  auto lhs = ArrayFromJSON(utf8(), R"(["a", "a", null, "b", "b", "b", "c", "a"])");
+  auto rhs = ArrayFromJSON(utf8(), R"(["b", "b", "b", "b", null, null, "c", "c"])");
+  auto scalar = ScalarFromJSON(utf8(), R"("b")");
+  for (const auto& run_end_type : {int16(), int32(), int64()}) {
+    ARROW_SCOPED_TRACE(run_end_type->ToString());
+    auto ree_lhs = encode(lhs, run_end_type)->Slice(1);
+    auto ree_rhs = encode(rhs, int64())->Slice(1);
+    for (auto op : {EQUAL, NOT_EQUAL, GREATER, GREATER_EQUAL, LESS, LESS_EQUAL}) {
+      const std::string function = CompareOperatorToFunctionName(op);
+      for (const auto& args : std::vector<std::vector<Datum>>{
+               {ree_lhs, scalar}, {scalar, ree_lhs}, {ree_lhs, ree_rhs}}) {
+        std::vector<Datum> decoded_args;
+        for (const auto& arg : args) {
+          if (arg.is_array()) {
+            ASSERT_OK_AND_ASSIGN(Datum decoded, CallFunction("run_end_decode", {arg}));
+            decoded_args.push_back(decoded);
+          } else {
+            decoded_args.push_back(arg);
+          }
+        }
+        ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(function, decoded_args));
+        ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(function, args));
+        ValidateOutput(actual);
+        ASSERT_EQ(*actual.type(), *run_end_encoded(run_end_type, boolean()));
+        ASSERT_OK_AND_ASSIGN(Datum decoded, CallFunction("run_end_decode", {actual}));
+        AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+      }
+    }
+  }
+}
+
 template <typename T>
 class TestVarArgsCompare : public ::testing::Test {
  protected:
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstring>
+#include <optional>
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/builder_time.h"
@@ -36,6 +37,7 @@ namespace arrow {
 using internal::BitBlockCount;
 using internal::BitBlockCounter;
 using internal::Bitmap;
+using internal::BitmapUInt64Reader;
 using internal::BitmapWordReader;
 using internal::BitRunReader;
 
@@ -1758,10 +1760,199 @@ static Status ExecVarWidthArrayCaseWhen(
       });
 }
 
+// Compute the argument selected by each row of an array 'case when', i.e. the index
+// in the batch of the first value argument whose condition is true, or of the 'else'
+// argument if there is none.  Without an 'else' argument, 0 (the index of the
+// conditions) stands for a null output.  The condition bitmaps are scanned 64 rows at a
+// time, masking out the rows selected by a previous condition.
+Result<std::shared_ptr<Buffer>> SelectCaseWhenArguments(KernelContext* ctx,
+                                                        const ExecSpan& batch) {
+  const ArraySpan& conds_array = batch[0].array;
+  const int num_conds = static_cast<int>(conds_array.child_data.size());
+  const bool have_else_arg = num_conds < batch.num_values() - 1;
+  ARROW_ASSIGN_OR_RAISE(auto selection_buffer,
+                        ctx->Allocate(batch.length * sizeof(int32_t)));
+  int32_t* selection = selection_buffer->mutable_data_as<int32_t>();
+  std::fill(selection, selection + batch.length, have_else_arg ? num_conds + 1 : 0);
+
+  const int64_t num_words = bit_util::CeilDiv(batch.length, 64);
+  std::vector<uint64_t> unselected(num_words, ~uint64_t{0});
+  int64_t num_unselected = batch.length;
+  for (int i = 0; i < num_conds && num_unselected > 0; i++) {
+    const ArraySpan& cond_array = conds_array.child_data[i];
+    const int64_t cond_offset = conds_array.offset + cond_array.offset;
+    BitmapUInt64Reader values_reader(cond_array.buffers[1].data, cond_offset,
+                                     batch.length);
+    std::optional<BitmapUInt64Reader> valid_reader;
+    if (cond_array.MayHaveNulls()) {
+      valid_reader.emplace(cond_array.buffers[0].data, cond_offset, batch.length);
+    }
+    for (int64_t word_index = 0; word_index < num_words; word_index++) {
+      uint64_t word = values_reader.NextWord() & unselected[word_index];
+      if (valid_reader) {
+        word &= valid_reader->NextWord();
+      }
+      if (word == 0) continue;
+      unselected[word_index] &= ~word;
+      num_unselected -= bit_util::PopCount(word);
+      int32_t* word_selection = selection + word_index * 64;
+      do {
+        word_selection[bit_util::CountTrailingZeros(word)] = i + 1;
+        word &= word - 1;
+      } while (word != 0);
+    }
+  }
+  return selection_buffer;
+}
+
+// Implement an array 'case when' for binary and list types, without a builder: a first
+// pass over the selected arguments computes the output validity and offsets, a second
+// one copies the value bytes or child values.  Scalar arguments are seen as arrays
+// repeating their value for each row.
 template <typename Type>
-struct CaseWhenFunctor<Type, enable_if_base_binary<Type>> {
+struct OffsetsCaseWhenImpl {
   using offset_type = typename Type::offset_type;
-  using BuilderType = typename TypeTraits<Type>::BuilderType;
+  static constexpr bool kIsBinary = is_base_binary_type<Type>::value;
+
+  struct Source {
+    bool all_null = true;
+    const uint8_t* validity = nullptr;
+    int64_t validity_offset = 0;
+    const offset_type* offsets = nullptr;
+    // 1 for arrays, 0 for scalars
+    int64_t stride = 0;
+    // The value bytes of binary types
+    const uint8_t* data = nullptr;
+    // The child values of list types
+    ArraySpan values;
+    // The offsets of a scalar's value
+    offset_type scalar_offsets[2] = {0, 0};
+
+    bool IsValid(int64_t row) const {
+      return !all_null &&
+             (validity == nullptr || bit_util::GetBit(validity, validity_offset + row));
+    }
+    int64_t start(int64_t row) const { return offsets[row * stride]; }
+    int64_t end(int64_t row) const { return offsets[row * stride + 1]; }
+  };
+
+  static void InitSource(const ExecValue& value, Source* source) {
+    if (value.is_scalar()) {
+      if (!value.scalar->is_valid) return;
+      source->all_null = false;
+      source->offsets = source->scalar_offsets;
+      if constexpr (kIsBinary) {
+        const Buffer& scalar_value =
+            *checked_cast<const BaseBinaryScalar&>(*value.scalar).value;
+        source->data = scalar_value.data();
+        source->scalar_offsets[1] = static_cast<offset_type>(scalar_value.size());
+      } else {
+        const Array& scalar_value =
+            *checked_cast<const BaseListScalar&>(*value.scalar).value;
+        source->values.SetMembers(*scalar_value.data());
+        source->scalar_offsets[1] = static_cast<offset_type>(scalar_value.length());
+      }
+    } else {
+      const ArraySpan& array = value.array;
+      source->all_null = false;
+      source->validity = array.MayHaveNulls() ? array.buffers[0].data : nullptr;
+      source->validity_offset = array.offset;
+      source->offsets = array.GetValues<offset_type>(1);
+      source->stride = 1;
+      if constexpr (kIsBinary) {
+        source->data = array.buffers[2].data;
+      } else {
+        source->values = array.child_data[0];
+      }
+    }
+  }
+
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const int64_t length = batch.length;
+    ARROW_ASSIGN_OR_RAISE(auto selection_buffer, SelectCaseWhenArguments(ctx, batch));
+    const int32_t* selection = selection_buffer->data_as<int32_t>();
+    // Indexed like the batch, the conditions standing for null outputs.  The vector
+    // is not resized, as scalar sources point to their own offsets.
+    std::vector<Source> sources(batch.num_values());
+    for (int i = 1; i < batch.num_values(); i++) {
+      InitSource(batch[i], &sources[i]);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto validity_buffer, ctx->AllocateBitmap(length));
+    ARROW_ASSIGN_OR_RAISE(auto offsets_buffer,
+                          ctx->Allocate((length + 1) * sizeof(offset_type)));
+    uint8_t* out_valid = validity_buffer->mutable_data();
+    offset_type* out_offsets = offsets_buffer->mutable_data_as<offset_type>();
+    int64_t null_count = 0;
+    int64_t values_length = 0;
+    out_offsets[0] = 0;
+    for (int64_t row = 0; row < length; row++) {
+      const Source& source = sources[selection[row]];
+      const bool valid = source.IsValid(row);
+      if (valid) {
+        values_length += source.end(row) - source.start(row);
+      } else {
+        null_count++;
+      }
+      bit_util::SetBitTo(out_valid, row, valid);
+      out_offsets[row + 1] = static_cast<offset_type>(values_length);
+    }
+    if (values_length > std::numeric_limits<offset_type>::max()) {
+      return Status::CapacityError(
+          "Result will not fit in an array with 32-bit offsets, convert to large type");
+    }
+
+    std::vector<std::shared_ptr<Buffer>> buffers = {
+        null_count > 0 ? std::move(validity_buffer) : nullptr, std::move(offsets_buffer)};
+    if constexpr (kIsBinary) {
+      ARROW_ASSIGN_OR_RAISE(auto data_buffer, ctx->Allocate(values_length));
+      uint8_t* out_data = data_buffer->mutable_data();
+      for (int64_t row = 0; row < length; row++) {
+        const int64_t value_length = out_offsets[row + 1] - out_offsets[row];
+        if (value_length == 0) continue;
+        const Source& source = sources[selection[row]];
+        std::memcpy(out_data + out_offsets[row], source.data + source.start(row),
+                    value_length);
+      }
+      buffers.push_back(std::move(data_buffer));
+      out->value = ArrayData::Make(out->type()->GetSharedPtr(), length,
+                                   std::move(buffers), null_count);
+    } else {
+      const auto& list_type = checked_cast<const BaseListType&>(*out->type());
+      std::unique_ptr<ArrayBuilder> values_builder;
+      RETURN_NOT_OK(MakeBuilderExactIndex(ctx->memory_pool(), list_type.value_type(),
+                                          &values_builder));
+      RETURN_NOT_OK(values_builder->Reserve(values_length));
+      int64_t row = 0;
+      while (row < length) {
+        if (out_offsets[row + 1] == out_offsets[row]) {
+          row++;
+          continue;
+        }
+        // Append the values of the following rows along, as long as they are
+        // contiguous in the same array
+        const int32_t arg = selection[row];
+        const Source& source = sources[arg];
+        const int64_t start = source.start(row);
+        int64_t end = source.end(row);
+        for (row++; row < length && source.stride > 0; row++) {
+          if (out_offsets[row + 1] == out_offsets[row]) continue;
+          if (selection[row] != arg || source.start(row) != end) break;
+          end = source.end(row);
+        }
+        RETURN_NOT_OK(
+            values_builder->AppendArraySlice(source.values, start, end - start));
+      }
+      ARROW_ASSIGN_OR_RAISE(auto values, values_builder->Finish());
+      out->value = ArrayData::Make(out->type()->GetSharedPtr(), length,
+                                   std::move(buffers), {values->data()}, null_count);
+    }
+    return Status::OK();
+  }
+};
+
+template <typename Type>
+struct CaseWhenFunctor<Type, enable_if_base_binary<Type>> {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     /// TODO(wesm): should this be a DCHECK? Or checked elsewhere
     if (batch[0].null_count() > 0) {
@@ -1774,42 +1965,12 @@ struct CaseWhenFunctor<Type, enable_if_base_binary<Type>> {
   }
 
   static Status ExecArray(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    return ExecVarWidthArrayCaseWhenImpl(
-        ctx, batch, out,
-        // ReserveData
-        [&](ArrayBuilder* raw_builder) {
-          int64_t reservation = 0;
-          for (int arg = 1; arg < batch.num_values(); arg++) {
-            const ExecValue& source = batch[arg];
-            if (source.is_scalar()) {
-              const auto& scalar = checked_cast<const BaseBinaryScalar&>(*source.scalar);
-              if (!scalar.value) continue;
-              reservation =
-                  std::max<int64_t>(reservation, batch.length * scalar.value->size());
-            } else {
-              const ArraySpan& array = source.array;
-              const auto& offsets = array.GetValues<offset_type>(1);
-              reservation =
-                  std::max<int64_t>(reservation, offsets[array.length] - offsets[0]);
-            }
-          }
-          // checked_cast works since (Large)StringBuilder <: (Large)BinaryBuilder
-          return checked_cast<BuilderType*>(raw_builder)->ReserveData(reservation);
-        },
-        // AppendScalar
-        [](ArrayBuilder* raw_builder, const Scalar& raw_scalar) {
-          const auto& scalar = checked_cast<const BaseBinaryScalar&>(raw_scalar);
-          return checked_cast<BuilderType*>(raw_builder)
-              ->Append(scalar.value->data(),
-                       static_cast<offset_type>(scalar.value->size()));
-        });
+    return OffsetsCaseWhenImpl<Type>::Exec(ctx, batch, out);
   }
 };
 
 template <typename Type>
 struct CaseWhenFunctor<Type, enable_if_var_size_list<Type>> {
-  using offset_type = typename Type::offset_type;
-  using BuilderType = typename TypeTraits<Type>::BuilderType;
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     /// TODO(wesm): should this be a DCHECK? Or checked elsewhere
     if (batch[0].null_count() > 0) {
@@ -1822,28 +1983,7 @@ struct CaseWhenFunctor<Type, enable_if_var_size_list<Type>> {
   }
 
   static Status ExecArray(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-    return ExecVarWidthArrayCaseWhen(
-        ctx, batch, out,
-        // ReserveData
-        [&](ArrayBuilder* raw_builder) {
-          auto builder = checked_cast<BuilderType*>(raw_builder);
-          auto child_builder = builder->value_builder();
-
-          int64_t reservation = 0;
-          for (int arg = 1; arg < batch.num_values(); arg++) {
-            const ExecValue& source = batch[arg];
-            if (!source.is_array()) {
-              const auto& scalar = checked_cast<const BaseListScalar&>(*source.scalar);
-              if (!scalar.value) continue;
-              reservation =
-                  std::max<int64_t>(reservation, batch.length * scalar.value->length());
-            } else {
-              const ArraySpan& array = source.array;
-              reservation = std::max<int64_t>(reservation, array.child_data[0].length);
-            }
-          }
-          return child_builder->Reserve(reservation);
-        });
+    return OffsetsCaseWhenImpl<Type>::Exec(ctx, batch, out);
   }
 };
 
@@ -1347,6 +1347,48 @@ void TestCaseWhenRandom(const std::shared_ptr<DataType>& type, int64_t len = 300
   }
 }
 
+// Rows taking their value from arrays or a scalar, with runs of rows selecting the
+// same argument
+void TestCaseWhenRandomWithScalar(const std::shared_ptr<DataType>& type,
+                                  int64_t len = 1000) {
+  random::RandomArrayGenerator rand(/*seed=*/0);
+  auto cond1 = checked_pointer_cast<BooleanArray>(
+      rand.Boolean(len, /*true_probability=*/0.9, /*null_probability=*/0.05));
+  auto cond2 = checked_pointer_cast<BooleanArray>(
+      rand.Boolean(len, /*true_probability=*/0.5, /*null_probability=*/0.0));
+  auto value1 = rand.ArrayOf(type, len, /*null_probability=*/0.04);
+  ASSERT_OK_AND_ASSIGN(auto scalar2,
+                       rand.ArrayOf(type, 1, /*null_probability=*/0.0)->GetScalar(0));
+  auto value_else = rand.ArrayOf(type, len, /*null_probability=*/0.04);
+
+  auto value1_span = ArraySpan(*value1->data());
+  auto value_else_span = ArraySpan(*value_else->data());
+
+  for (const bool has_else : {true, false}) {
+    ASSERT_OK_AND_ASSIGN(auto builder, MakeBuilder(type));
+    ASSERT_OK(builder->Reserve(len));
+    for (int64_t i = 0; i < len; ++i) {
+      if (cond1->IsValid(i) && cond1->Value(i)) {
+        ASSERT_OK(builder->AppendArraySlice(value1_span, i, /*length=*/1));
+      } else if (cond2->Value(i)) {
+        ASSERT_OK(builder->AppendScalar(*scalar2));
+      } else if (has_else) {
+        ASSERT_OK(builder->AppendArraySlice(value_else_span, i, /*length=*/1));
+      } else {
+        ASSERT_OK(builder->AppendNull());
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto expected, builder->Finish());
+
+    if (has_else) {
+      CheckScalar("case_when", {MakeStruct({cond1, cond2}), value1, scalar2, value_else},
+                  expected);
+    } else {
+      CheckScalar("case_when", {MakeStruct({cond1, cond2}), value1, scalar2}, expected);
+    }
+  }
+}
+
 template <typename Type>
 class TestCaseWhenNumeric : public ::testing::Test {};
 
@@ -1917,6 +1959,10 @@ TYPED_TEST(TestCaseWhenBinary, Random) {
   TestCaseWhenRandom(default_type_instance<TypeParam>());
 }
 
+TYPED_TEST(TestCaseWhenBinary, RandomWithScalar) {
+  TestCaseWhenRandomWithScalar(default_type_instance<TypeParam>());
+}
+
 template <typename Type>
 class TestCaseWhenList : public ::testing::Test {};
 
@@ -1987,6 +2033,11 @@ TYPED_TEST(TestCaseWhenList, ListOfStringRandom) {
   TestCaseWhenRandom(type, /*len=*/200);
 }
 
+TYPED_TEST(TestCaseWhenList, ListOfStringRandomWithScalar) {
+  auto type = std::make_shared<TypeParam>(utf8());
+  TestCaseWhenRandomWithScalar(type);
+}
+
 // More minimal tests to check type coverage
 TYPED_TEST(TestCaseWhenList, ListOfBool) {
   auto type = std::make_shared<TypeParam>(boolean());
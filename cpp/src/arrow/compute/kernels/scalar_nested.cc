@@ -49,6 +49,17 @@ Status ListValueLength(KernelContext* ctx, const ExecSpan& batch, ExecResult* ou
   return Status::OK();
 }
 
+template <typename Type, typename offset_type = typename Type::offset_type>
+Status ListViewValueLength(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const ArraySpan& arr = batch[0].array;
+  ArraySpan* out_arr = out->array_span_mutable();
+  auto out_values = out_arr->GetValues<offset_type>(1);
+  const offset_type* sizes = arr.GetValues<offset_type>(2);
+  // Sizes are always well-defined, even for null values
+  std::copy(sizes, sizes + arr.length, out_values);
+  return Status::OK();
+}
+
 Status FixedSizeListValueLength(KernelContext* ctx, const ExecSpan& batch,
                                 ExecResult* out) {
   auto width = checked_cast<const FixedSizeListType&>(*batch[0].type()).list_size();
@@ -830,6 +841,10 @@ void RegisterScalarNested(FunctionRegistry* registry) {
                                          FixedSizeListValueLength));
   DCHECK_OK(list_value_length->AddKernel({InputType(Type::LARGE_LIST)}, int64(),
                                          ListValueLength<LargeListType>));
+  DCHECK_OK(list_value_length->AddKernel({InputType(Type::LIST_VIEW)}, int32(),
+                                         ListViewValueLength<ListViewType>));
+  DCHECK_OK(list_value_length->AddKernel({InputType(Type::LARGE_LIST_VIEW)}, int64(),
+                                         ListViewValueLength<LargeListViewType>));
   DCHECK_OK(registry->AddFunction(std::move(list_value_length)));
 
   auto list_element =
@@ -30,11 +30,12 @@ namespace arrow {
 namespace compute {
 
 static std::shared_ptr<DataType> GetOffsetType(const DataType& type) {
-  return type.id() == Type::LIST ? int32() : int64();
+  return type.id() == Type::LIST || type.id() == Type::LIST_VIEW ? int32() : int64();
 }
 
 TEST(TestScalarNested, ListValueLength) {
-  for (auto ty : {list(int32()), large_list(int32())}) {
+  for (auto ty : {list(int32()), large_list(int32()), list_view(int32()),
+                  large_list_view(int32())}) {
     CheckScalarUnary("list_value_length", ty, "[[0, null, 1], null, [2, 3], []]",
                      GetOffsetType(*ty), "[3, null, 2, 0]");
   }
@@ -15,7 +15,17 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+
 #include "arrow/array/array_base.h"
+#include "arrow/buffer.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common_internal.h"
@@ -34,17 +44,88 @@ using internal::HashTraits;
 namespace compute::internal {
 namespace {
 
+// Above this many values in the value set, the lookup table outgrows the CPU caches
+// and most probes of values not in the set would miss them: a Bloom filter in front
+// of the table, much smaller, rejects most of those values first.
+constexpr int64_t kMinBloomFilterValueSetLength = 1 << 16;
+
+// A blocked Bloom filter: each value sets (and is checked against) a few bits of a
+// single 64-bit block, so that each probe reads one word
+class SetLookupBloomFilter {
+ public:
+  using hash_t = ::arrow::internal::hash_t;
+
+  Status Init(int64_t num_values, MemoryPool* pool) {
+    // About 10 bits per value, for a false positive rate of about 2%
+    const int64_t num_blocks =
+        bit_util::NextPower2(std::max<int64_t>(1, num_values * 10 / 64));
+    ARROW_ASSIGN_OR_RAISE(blocks_buffer_,
+                          AllocateBuffer(num_blocks * sizeof(uint64_t), pool));
+    blocks_ = reinterpret_cast<uint64_t*>(blocks_buffer_->mutable_data());
+    std::memset(blocks_, 0, num_blocks * sizeof(uint64_t));
+    block_index_mask_ = static_cast<uint64_t>(num_blocks - 1);
+    return Status::OK();
+  }
+
+  void Insert(hash_t hash) { blocks_[BlockIndex(hash)] |= Mask(hash); }
+
+  bool MayContain(hash_t hash) const {
+    const uint64_t mask = Mask(hash);
+    return (blocks_[BlockIndex(hash)] & mask) == mask;
+  }
+
+ private:
+  static uint64_t Mask(hash_t hash) {
+    return (uint64_t{1} << (hash & 63)) | (uint64_t{1} << ((hash >> 6) & 63)) |
+           (uint64_t{1} << ((hash >> 12) & 63)) | (uint64_t{1} << ((hash >> 18) & 63));
+  }
+
+  uint64_t BlockIndex(hash_t hash) const { return (hash >> 32) & block_index_mask_; }
+
+  std::unique_ptr<Buffer> blocks_buffer_;
+  uint64_t* blocks_ = nullptr;
+  uint64_t block_index_mask_ = 0;
+};
+
 // This base class enables non-templated access to the value set type
-struct SetLookupStateBase : public KernelState {
+struct SetLookupStateBase {
+  virtual ~SetLookupStateBase() = default;
+
   std::shared_ptr<DataType> value_set_type;
 };
 
+// The kernel state, which refers to a set lookup state possibly shared with other
+// kernels through the SetLookupStateCache
+struct SetLookupKernelState : public KernelState {
+  explicit SetLookupKernelState(std::shared_ptr<const SetLookupStateBase> state)
+      : state(std::move(state)) {}
+
+  std::shared_ptr<const SetLookupStateBase> state;
+};
+
+template <typename StateType = SetLookupStateBase>
+const StateType& GetSetLookupState(KernelContext* ctx) {
+  return checked_cast<const StateType&>(
+      *checked_cast<const SetLookupKernelState&>(*ctx->state()).state);
+}
+
 template <typename Type>
 struct SetLookupState : public SetLookupStateBase {
+  using T = typename GetViewType<Type>::T;
+
+  // Booleans and 8-bit integers are looked up in tiny direct-indexed tables
+  static constexpr bool kMayUseBloomFilter =
+      !is_boolean_type<Type>::value && !is_8bit_int<Type>::value;
+
   explicit SetLookupState(MemoryPool* pool) : memory_pool(pool) {}
 
   Status Init(const SetLookupOptions& options) {
     this->null_matching_behavior = options.GetNullMatchingBehavior();
+    if (kMayUseBloomFilter && options.value_set.is_arraylike() &&
+        options.value_set.length() >= kMinBloomFilterValueSetLength) {
+      bloom_filter.emplace();
+      RETURN_NOT_OK(bloom_filter->Init(options.value_set.length(), memory_pool));
+    }
     if (options.value_set.is_array()) {
       const ArrayData& value_set = *options.value_set.array();
       memo_index_to_value_index.reserve(value_set.length);
@@ -75,9 +156,28 @@ struct SetLookupState : public SetLookupStateBase {
     return Status::OK();
   }
 
+  // The memo index of the given value, or -1 if it is not in the value set
+  int32_t Lookup(T v) const {
+    if (kMayUseBloomFilter && bloom_filter.has_value() &&
+        !bloom_filter->MayContain(Hash(v))) {
+      return -1;
+    }
+    return lookup_table->Get(v);
+  }
+
+  // The hash for the Bloom filter, which must differ from the one of the lookup table
+  template <typename Value>
+  static ::arrow::internal::hash_t Hash(const Value& v) {
+    return ::arrow::internal::ScalarHelper<Value, 1>::ComputeHash(v);
+  }
+
+  static ::arrow::internal::hash_t Hash(std::string_view v) {
+    return ::arrow::internal::ComputeStringHash<1>(v.data(),
+                                                   static_cast<int64_t>(v.size()));
+  }
+
   Status AddArrayValueSet(const SetLookupOptions& options, const ArrayData& data,
                           int64_t start_index = 0) {
-    using T = typename GetViewType<Type>::T;
     int32_t index = static_cast<int32_t>(start_index);
     auto visit_valid = [&](T v) {
       const auto memo_size = static_cast<int32_t>(memo_index_to_value_index.size());
@@ -92,6 +192,9 @@ struct SetLookupState : public SetLookupStateBase {
       };
       RETURN_NOT_OK(lookup_table->GetOrInsert(
           v, std::move(on_found), std::move(on_not_found), &unused_memo_index));
+      if (kMayUseBloomFilter && bloom_filter.has_value()) {
+        bloom_filter->Insert(Hash(v));
+      }
       ++index;
       return Status::OK();
     };
@@ -114,6 +217,7 @@ struct SetLookupState : public SetLookupStateBase {
 
   using MemoTable = typename HashTraits<Type>::MemoTableType;
   std::optional<MemoTable> lookup_table;  // use optional for delayed initialization
+  std::optional<SetLookupBloomFilter> bloom_filter;
   MemoryPool* memory_pool;
   // When there are duplicates in value_set, the MemoTable indices must
   // be mapped back to indices in the value_set.
@@ -138,6 +242,89 @@ struct SetLookupState<NullType> : public SetLookupStateBase {
   SetLookupOptions::NullMatchingBehavior null_matching_behavior;
 };
 
+// Keeps the states of the last few large value sets, so that later lookups in the
+// same value set (for example for each batch of a stream) don't build them again.
+//
+// Value sets are identified by their array data objects, which the cache keeps
+// alive so that they can't be mistaken for later ones, along with the options and
+// the type of the values looked up.
+class SetLookupStateCache {
+ public:
+  static constexpr size_t kCapacity = 4;
+  // The states of smaller value sets are cheap enough to build
+  static constexpr int64_t kMinValueSetLength = 1 << 12;
+
+  static SetLookupStateCache* GetInstance() {
+    static SetLookupStateCache instance;
+    return &instance;
+  }
+
+  // The key of the value set, or an empty string if its state should not be cached
+  static std::string MakeKey(const SetLookupOptions& options, const DataType& arg_type,
+                             MemoryPool* pool) {
+    // Cached states outlive the call, so they must not refer to a shorter-lived pool
+    if (pool != default_memory_pool() || !options.value_set.is_arraylike() ||
+        options.value_set.length() < kMinValueSetLength) {
+      return "";
+    }
+    const std::string& arg_fingerprint = arg_type.fingerprint();
+    const std::string& value_set_fingerprint = options.value_set.type()->fingerprint();
+    if (arg_fingerprint.empty() || value_set_fingerprint.empty()) {
+      return "";
+    }
+    std::stringstream ss;
+    ss << arg_fingerprint << ";" << value_set_fingerprint << ";"
+       << static_cast<int>(options.GetNullMatchingBehavior());
+    auto add_array = [&](const ArrayData& data) {
+      ss << ";" << &data << "," << data.offset << "," << data.length;
+    };
+    if (options.value_set.is_array()) {
+      add_array(*options.value_set.array());
+    } else {
+      for (const auto& chunk : options.value_set.chunked_array()->chunks()) {
+        add_array(*chunk->data());
+      }
+    }
+    return ss.str();
+  }
+
+  std::shared_ptr<const SetLookupStateBase> Get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end(); ++it) {
+      if (it->key == key) {
+        entries_.splice(entries_.begin(), entries_, it);
+        return entries_.front().state;
+      }
+    }
+    return nullptr;
+  }
+
+  void Put(std::string key, Datum value_set,
+           std::shared_ptr<const SetLookupStateBase> state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& entry : entries_) {
+      if (entry.key == key) {
+        return;
+      }
+    }
+    entries_.push_front({std::move(key), std::move(value_set), std::move(state)});
+    if (entries_.size() > kCapacity) {
+      entries_.pop_back();
+    }
+  }
+
+ private:
+  struct Entry {
+    std::string key;
+    Datum value_set;
+    std::shared_ptr<const SetLookupStateBase> state;
+  };
+
+  std::mutex mutex_;
+  // Most recently used first
+  std::list<Entry> entries_;
+};
+
 // TODO: Put this concept somewhere reusable
 template <int width>
 struct UnsignedIntType;
@@ -167,7 +354,7 @@ struct InitStateVisitor {
   KernelContext* ctx;
   SetLookupOptions options;
   TypeHolder arg_type;
-  std::unique_ptr<KernelState> result;
+  std::shared_ptr<SetLookupStateBase> result;
 
   InitStateVisitor(KernelContext* ctx, const KernelInitArgs& args)
       : ctx(ctx),
@@ -177,8 +364,10 @@ struct InitStateVisitor {
   template <typename Type>
   Status Init() {
     using StateType = SetLookupState<Type>;
-    result.reset(new StateType(ctx->exec_context()->memory_pool()));
-    return static_cast<StateType*>(result.get())->Init(options);
+    auto state = std::make_shared<StateType>(ctx->exec_context()->memory_pool());
+    RETURN_NOT_OK(state->Init(options));
+    result = std::move(state);
+    return Status::OK();
   }
 
   Status Visit(const DataType&) { return Init<NullType>(); }
@@ -209,6 +398,17 @@ struct InitStateVisitor {
   }
 
   Result<std::unique_ptr<KernelState>> GetResult() {
+    auto cache = SetLookupStateCache::GetInstance();
+    std::string cache_key = SetLookupStateCache::MakeKey(
+        options, *arg_type, ctx->exec_context()->memory_pool());
+    if (!cache_key.empty()) {
+      if (auto state = cache->Get(cache_key)) {
+        return std::make_unique<SetLookupKernelState>(std::move(state));
+      }
+    }
+    // The value set as given, before any cast
+    const Datum value_set = options.value_set;
+
     if (arg_type.id() == Type::TIMESTAMP &&
         options.value_set.type()->id() == Type::TIMESTAMP) {
       // Other types will fail when casting, so no separate check is needed
@@ -252,7 +452,10 @@ struct InitStateVisitor {
     }
 
     RETURN_NOT_OK(VisitTypeInline(*options.value_set.type(), this));
-    return std::move(result);
+    if (!cache_key.empty()) {
+      cache->Put(std::move(cache_key), value_set, result);
+    }
+    return std::make_unique<SetLookupKernelState>(std::move(result));
   }
 };
 
@@ -281,7 +484,7 @@ struct IndexInVisitor {
   }
 
   Status Visit(const NullType&) {
-    const auto& state = checked_cast<const SetLookupState<NullType>&>(*ctx->state());
+    const auto& state = GetSetLookupState<SetLookupState<NullType>>(ctx);
 
     if (data.length != 0) {
       bit_util::SetBitsTo(out_bitmap, out->offset, out->length,
@@ -303,7 +506,7 @@ struct IndexInVisitor {
     VisitArraySpanInline<Type>(
         input,
         [&](T v) {
-          int32_t index = state.lookup_table->Get(v);
+          int32_t index = state.Lookup(v);
           if (index != -1) {
             bitmap_writer.Set();
 
@@ -336,7 +539,7 @@ struct IndexInVisitor {
 
   template <typename Type>
   Status ProcessIndexIn() {
-    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+    const auto& state = GetSetLookupState<SetLookupState<Type>>(ctx);
     if (!data.type->Equals(state.value_set_type)) {
       auto materialized_input = data.ToArrayData();
       auto cast_result = Cast(*materialized_input, state.value_set_type,
@@ -383,7 +586,7 @@ struct IndexInVisitor {
   }
 
   Status Execute() {
-    const auto& state = checked_cast<const SetLookupStateBase&>(*ctx->state());
+    const auto& state = GetSetLookupState(ctx);
     return VisitTypeInline(*state.value_set_type, this);
   }
 };
@@ -413,7 +616,7 @@ struct IsInVisitor {
   }
 
   Status Visit(const NullType&) {
-    const auto& state = checked_cast<const SetLookupState<NullType>&>(*ctx->state());
+    const auto& state = GetSetLookupState<SetLookupState<NullType>>(ctx);
 
     if (state.null_matching_behavior == SetLookupOptions::MATCH &&
         state.value_set_has_null) {
@@ -439,7 +642,7 @@ struct IsInVisitor {
     VisitArraySpanInline<Type>(
         input,
         [&](T v) {
-          if (state.lookup_table->Get(v) != -1) {  // true
+          if (state.Lookup(v) != -1) {  // true
             writer_boolean.Set();
             writer_null.Set();
           } else if (state.null_matching_behavior == SetLookupOptions::INCONCLUSIVE &&
@@ -477,7 +680,7 @@ struct IsInVisitor {
 
   template <typename Type>
   Status ProcessIsIn() {
-    const auto& state = checked_cast<const SetLookupState<Type>&>(*ctx->state());
+    const auto& state = GetSetLookupState<SetLookupState<Type>>(ctx);
 
     if (!data.type->Equals(state.value_set_type)) {
       auto materialized_input = data.ToArrayData();
@@ -524,7 +727,7 @@ struct IsInVisitor {
   }
 
   Status Execute() {
-    const auto& state = checked_cast<const SetLookupStateBase&>(*ctx->state());
+    const auto& state = GetSetLookupState(ctx);
     return VisitTypeInline(*state.value_set_type, this);
   }
 };
@@ -635,6 +838,8 @@ struct SetLookupFunction : ScalarFunction {
   using ScalarFunction::ScalarFunction;
 
   Result<const Kernel*> DispatchBest(std::vector<TypeHolder>* values) const override {
+    using arrow::compute::detail::DispatchExactImpl;
+    if (auto kernel = DispatchExactImpl(this, *values)) return kernel;
     EnsureDictionaryDecoded(values);
     return DispatchExact(*values);
   }
@@ -655,6 +860,8 @@ void RegisterScalarSetLookup(FunctionRegistry* registry) {
 
     isin_base.signature = KernelSignature::Make({null()}, boolean());
     DCHECK_OK(is_in->AddKernel(isin_base));
+    // Dictionaries are looked up once per distinct dictionary value
+    AddDictionaryPredicateKernels(is_in.get());
     DCHECK_OK(registry->AddFunction(is_in));
 
     DCHECK_OK(registry->AddFunction(std::make_shared<IsInMetaBinary>()));
@@ -1559,6 +1559,53 @@ TEST_F(TestIndexInKernel, BinaryResizeTable) {
   ASSERT_ARRAYS_EQUAL(*expected, *actual);
 }
 
+TEST_F(TestIndexInKernel, LargeValueSet) {
+  // Large enough for the value set to be filtered through a Bloom filter and for
+  // its lookup state to be cached
+  const int64_t kValueSetLength = 1 << 17;
+  const int64_t kInputLength = 1 << 15;
+
+  Int64Builder value_set_builder, input_builder;
+  Int32Builder expected_builder, expected_sliced_builder;
+  for (int64_t i = 0; i < kValueSetLength; ++i) {
+    ASSERT_OK(value_set_builder.Append(i * 2));
+  }
+  for (int64_t i = 0; i < kInputLength; ++i) {
+    if (i % 100 == 0) {
+      ASSERT_OK(input_builder.AppendNull());
+      ASSERT_OK(expected_builder.AppendNull());
+      ASSERT_OK(expected_sliced_builder.AppendNull());
+      continue;
+    }
+    // Mostly misses, and values beyond the end of the value set
+    int64_t value = (i * 7919) % (kValueSetLength * 3);
+    ASSERT_OK(input_builder.Append(value));
+    if (value % 2 == 0 && value / 2 < kValueSetLength) {
+      ASSERT_OK(expected_builder.Append(static_cast<int32_t>(value / 2)));
+    } else {
+      ASSERT_OK(expected_builder.AppendNull());
+    }
+    if (value % 2 == 0 && value / 2 >= 1 && value / 2 < kValueSetLength) {
+      ASSERT_OK(expected_sliced_builder.Append(static_cast<int32_t>(value / 2 - 1)));
+    } else {
+      ASSERT_OK(expected_sliced_builder.AppendNull());
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto value_set, value_set_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto input, input_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected, expected_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected_sliced, expected_sliced_builder.Finish());
+
+  // The second lookup reuses the state of the first
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum actual, IndexIn(input, value_set));
+    ASSERT_ARRAYS_EQUAL(*expected, *actual.make_array());
+  }
+  // Slices of the same data are different value sets
+  ASSERT_OK_AND_ASSIGN(Datum actual, IndexIn(input, value_set->Slice(1)));
+  ASSERT_ARRAYS_EQUAL(*expected_sliced, *actual.make_array());
+}
+
 TEST_F(TestIndexInKernel, FixedSizeBinary) {
   CheckIndexIn(fixed_size_binary(3),
                /*input=*/R"(["bbb", null, "ddd", "aaa", "ccc", "aaa"])",
@@ -23,14 +23,18 @@
 
 #include "arrow/array/builder_nested.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
+#include "arrow/compute/kernels/util_internal.h"
 #include "arrow/result.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/config.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string.h"
+#include "arrow/util/utf8_internal.h"
 #include "arrow/util/value_parsing.h"
 
 #ifdef ARROW_WITH_RE2
 #include <re2/re2.h>
+#include <re2/set.h>
 #endif
 
 namespace arrow {
@@ -41,6 +45,49 @@ using internal::StartsWith;
 namespace compute {
 namespace internal {
 
+std::string MakeLikeRegex(std::string_view pattern) {
+  // Allow . to match \n
+  std::string like_pattern = "(?s:^";
+  like_pattern.reserve(pattern.size() + 7);
+  bool escaped = false;
+  for (const char c : pattern) {
+    if (!escaped && c == '%') {
+      like_pattern.append(".*");
+    } else if (!escaped && c == '_') {
+      like_pattern.append(".");
+    } else if (!escaped && c == '\\') {
+      escaped = true;
+    } else {
+      switch (c) {
+        case '.':
+        case '?':
+        case '+':
+        case '*':
+        case '^':
+        case '$':
+        case '\\':
+        case '[':
+        case '{':
+        case '(':
+        case ')':
+        case '|': {
+          like_pattern.push_back('\\');
+          like_pattern.push_back(c);
+          escaped = false;
+          break;
+        }
+        default: {
+          like_pattern.push_back(c);
+          escaped = false;
+          break;
+        }
+      }
+    }
+  }
+  like_pattern.append("$)");
+  return like_pattern;
+}
+
 namespace {
 
 // ----------------------------------------------------------------------
@@ -726,7 +773,7 @@ static inline uint8_t ascii_swapcase(uint8_t utf8_code_unit) {
 }
 
 void TransformAsciiUpper(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_toupper);
+  util::AsciiToUpper(input, length, output);
 }
 
 template <typename Type>
@@ -737,7 +784,7 @@ struct AsciiUpper {
 };
 
 void TransformAsciiLower(const uint8_t* input, int64_t length, uint8_t* output) {
-  std::transform(input, input + length, output, ascii_tolower);
+  util::AsciiToLower(input, length, output);
 }
 
 template <typename Type>
@@ -866,6 +913,16 @@ struct BinaryLength {
     std::fill(buffer, buffer + batch.length, width);
     return Status::OK();
   }
+
+  static Status BinaryViewExec(KernelContext*, const ExecSpan& batch, ExecResult* out) {
+    // Only the views are read, never the data buffers
+    const ArraySpan& input = batch[0].array;
+    const auto* views = input.GetValues<BinaryViewType::c_type>(1);
+    int32_t* buffer = out->array_span_mutable()->GetValues<int32_t>(1);
+    std::transform(views, views + batch.length, buffer,
+                   [](const BinaryViewType::c_type& view) { return view.size(); });
+    return Status::OK();
+  }
 };
 
 const FunctionDoc binary_length_doc(
@@ -891,6 +948,9 @@ void AddAsciiStringLength(FunctionRegistry* registry) {
   }
   DCHECK_OK(func->AddKernel({InputType(Type::FIXED_SIZE_BINARY)}, int32(),
                             BinaryLength::FixedSizeExec));
+  for (const auto& ty : {binary_view(), utf8_view()}) {
+    DCHECK_OK(func->AddKernel({ty}, int32(), BinaryLength::BinaryViewExec));
+  }
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -1358,6 +1418,71 @@ struct MatchSubstringImpl {
   }
 };
 
+// Matching on binary and string views. Sizes and inlined prefixes rule out most
+// non-matches of the plain matchers without touching the out-of-line buffers.
+
+template <typename Matcher>
+bool MatchView(const Matcher& matcher, const BinaryViewType::c_type& view,
+               const std::shared_ptr<Buffer>* data_buffers) {
+  return matcher.Match(util::FromBinaryView(view, data_buffers));
+}
+
+bool MatchView(const PlainSubstringMatcher& matcher, const BinaryViewType::c_type& view,
+               const std::shared_ptr<Buffer>* data_buffers) {
+  if (static_cast<size_t>(view.size()) < matcher.options_.pattern.size()) return false;
+  return matcher.Match(util::FromBinaryView(view, data_buffers));
+}
+
+bool MatchView(const PlainStartsWithMatcher& matcher, const BinaryViewType::c_type& view,
+               const std::shared_ptr<Buffer>* data_buffers) {
+  const std::string& pattern = matcher.options_.pattern;
+  if (static_cast<size_t>(view.size()) < pattern.size()) return false;
+  const size_t prefix_size =
+      std::min(pattern.size(), static_cast<size_t>(BinaryViewType::kPrefixSize));
+  if (memcmp(view.inline_data(), pattern.data(), prefix_size) != 0) return false;
+  if (pattern.size() == prefix_size) return true;
+  return matcher.Match(util::FromBinaryView(view, data_buffers));
+}
+
+bool MatchView(const PlainEndsWithMatcher& matcher, const BinaryViewType::c_type& view,
+               const std::shared_ptr<Buffer>* data_buffers) {
+  if (static_cast<size_t>(view.size()) < matcher.options_.pattern.size()) return false;
+  return matcher.Match(util::FromBinaryView(view, data_buffers));
+}
+
+template <typename Matcher>
+struct MatchBinaryViewsImpl {
+  using c_type = BinaryViewType::c_type;
+
+  static Status Exec(KernelContext*, const ExecSpan& batch, ExecResult* out,
+                     const Matcher* matcher) {
+    const ArraySpan& input = batch[0].array;
+    ArraySpan* out_arr = out->array_span_mutable();
+    if (input.length == 0) return Status::OK();
+    const c_type* views = input.GetValues<c_type>(1);
+    const auto* data_buffers = input.buffers[2].data_as<std::shared_ptr<Buffer>>();
+    // Null views are not guaranteed to point into the data buffers
+    const uint8_t* validity = input.null_count == 0 ? nullptr : input.buffers[0].data;
+    FirstTimeBitmapWriter bitmap_writer(out_arr->buffers[1].data, out_arr->offset,
+                                        input.length);
+    for (int64_t i = 0; i < input.length; ++i) {
+      if ((validity == nullptr || bit_util::GetBit(validity, input.offset + i)) &&
+          MatchView(*matcher, views[i], data_buffers)) {
+        bitmap_writer.Set();
+      }
+      bitmap_writer.Next();
+    }
+    bitmap_writer.Finish();
+    return Status::OK();
+  }
+};
+
+template <typename Matcher>
+struct MatchSubstringImpl<BinaryViewType, Matcher> : MatchBinaryViewsImpl<Matcher> {};
+
+template <typename Matcher>
+struct MatchSubstringImpl<StringViewType, Matcher> : MatchBinaryViewsImpl<Matcher> {};
+
 template <typename Type, typename Matcher>
 struct MatchSubstring {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
@@ -1452,50 +1577,6 @@ struct MatchSubstring<Type, PlainEndsWithMatcher> {
 
 // SQL LIKE match
 
-/// Convert a SQL-style LIKE pattern (using '%' and '_') into a regex pattern
-std::string MakeLikeRegex(const MatchSubstringOptions& options) {
-  // Allow . to match \n
-  std::string like_pattern = "(?s:^";
-  like_pattern.reserve(options.pattern.size() + 7);
-  bool escaped = false;
-  for (const char c : options.pattern) {
-    if (!escaped && c == '%') {
-      like_pattern.append(".*");
-    } else if (!escaped && c == '_') {
-      like_pattern.append(".");
-    } else if (!escaped && c == '\\') {
-      escaped = true;
-    } else {
-      switch (c) {
-        case '.':
-        case '?':
-        case '+':
-        case '*':
-        case '^':
-        case '$':
-        case '\\':
-        case '[':
-        case '{':
-        case '(':
-        case ')':
-        case '|': {
-          like_pattern.push_back('\\');
-          like_pattern.push_back(c);
-          escaped = false;
-          break;
-        }
-        default: {
-          like_pattern.push_back(c);
-          escaped = false;
-          break;
-        }
-      }
-    }
-  }
-  like_pattern.append("$)");
-  return like_pattern;
-}
-
 // Evaluate a SQL-like LIKE pattern by translating it to a regexp or
 // substring search as appropriate. See what Apache Impala does:
 // https://github.com/apache/impala/blob/9c38568657d62b6f6d7b10aa1c721ba843374dd8/be/src/exprs/like-predicate.cc
@@ -1548,7 +1629,7 @@ struct MatchLike {
     }
 
     if (!matched) {
-      MatchSubstringOptions converted_options{MakeLikeRegex(original_options),
+      MatchSubstringOptions converted_options{MakeLikeRegex(original_options.pattern),
                                               original_options.ignore_case};
       MatchSubstringState converted_state(converted_options);
       ctx->SetState(&converted_state);
@@ -1559,6 +1640,95 @@ struct MatchLike {
   }
 };
 
+// Match against many patterns at once
+
+using MatchAnyState = OptionsWrapper<MatchAnyOptions>;
+
+// Matches all patterns in a single pass over each string, rather than one pass per
+// pattern
+struct RegexSetMatcher {
+  const std::vector<std::string> patterns_;
+  const RE2::Options options_;
+  RE2::Set regex_set_;
+  // Only compiled if the set runs out of memory
+  mutable std::vector<std::unique_ptr<RE2>> regexes_;
+
+  static Result<std::unique_ptr<RegexSetMatcher>> Make(
+      std::vector<std::string> patterns, bool is_utf8, bool ignore_case) {
+    auto matcher =
+        std::make_unique<RegexSetMatcher>(std::move(patterns), is_utf8, ignore_case);
+    for (const auto& pattern : matcher->patterns_) {
+      std::string error;
+      if (matcher->regex_set_.Add(ToStringPiece(pattern), &error) < 0) {
+        return Status::Invalid("Invalid regular expression: ", error);
+      }
+    }
+    if (!matcher->patterns_.empty() && !matcher->regex_set_.Compile()) {
+      return Status::OutOfMemory("Could not compile set of ",
+                                 matcher->patterns_.size(), " regular expressions");
+    }
+    return std::move(matcher);
+  }
+
+  RegexSetMatcher(std::vector<std::string> patterns, bool is_utf8, bool ignore_case)
+      : patterns_(std::move(patterns)),
+        options_(MakeRE2Options(is_utf8, ignore_case)),
+        regex_set_(options_, RE2::UNANCHORED) {}
+
+  bool Match(std::string_view current) const {
+    if (patterns_.empty()) return false;
+    auto piece = ToStringPiece(current);
+    RE2::Set::ErrorInfo error_info;
+    if (regex_set_.Match(piece, /*v=*/nullptr, &error_info)) {
+      return true;
+    }
+    if (ARROW_PREDICT_TRUE(error_info.kind != RE2::Set::kOutOfMemory)) {
+      DCHECK_EQ(error_info.kind, RE2::Set::kNoError);
+      return false;
+    }
+    // The DFA of the set exceeded its memory budget, fall back to matching the
+    // patterns one by one
+    if (regexes_.empty()) {
+      for (const auto& pattern : patterns_) {
+        regexes_.push_back(std::make_unique<RE2>(pattern, options_));
+      }
+    }
+    return std::any_of(regexes_.begin(), regexes_.end(),
+                       [&](const std::unique_ptr<RE2>& regex) {
+                         return RE2::PartialMatch(piece, *regex);
+                       });
+  }
+};
+
+template <typename Type>
+struct MatchAnyRegex {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& options = MatchAnyState::Get(ctx);
+    ARROW_ASSIGN_OR_RAISE(auto matcher,
+                          RegexSetMatcher::Make(options.patterns, Type::is_utf8,
+                                                options.ignore_case));
+    return MatchSubstringImpl<Type, RegexSetMatcher>::Exec(ctx, batch, out,
+                                                           matcher.get());
+  }
+};
+
+template <typename Type>
+struct MatchAnyLike {
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    const auto& options = MatchAnyState::Get(ctx);
+    std::vector<std::string> patterns;
+    patterns.reserve(options.patterns.size());
+    for (const auto& pattern : options.patterns) {
+      patterns.push_back(MakeLikeRegex(pattern));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto matcher,
+                          RegexSetMatcher::Make(std::move(patterns), Type::is_utf8,
+                                                options.ignore_case));
+    return MatchSubstringImpl<Type, RegexSetMatcher>::Exec(ctx, batch, out,
+                                                           matcher.get());
+  }
+};
+
 #endif
 
 const FunctionDoc match_substring_doc(
@@ -1605,6 +1775,24 @@ const FunctionDoc match_like_doc(
      "To match a literal '%', '_', or '\\', precede the character with a backslash.\n"
      "Null inputs emit null.  The pattern must be given in MatchSubstringOptions."),
     {"strings"}, "MatchSubstringOptions", /*options_required=*/true);
+
+const FunctionDoc match_any_regex_doc(
+    "Match strings against several regex patterns",
+    ("For each string in `strings`, emit true iff it matches any of the given\n"
+     "patterns at any position. All patterns are matched in a single pass over\n"
+     "each string. The patterns must be given in MatchAnyOptions.\n"
+     "If ignore_case is set, only simple case folding is performed.\n"
+     "\n"
+     "Null inputs emit null."),
+    {"strings"}, "MatchAnyOptions", /*options_required=*/true);
+
+const FunctionDoc match_any_like_doc(
+    "Match strings against several SQL-style LIKE patterns",
+    ("For each string in `strings`, emit true iff it matches any of the given\n"
+     "LIKE patterns, as with match_like. All patterns are matched in a single\n"
+     "pass over each string.\n"
+     "Null inputs emit null.  The patterns must be given in MatchAnyOptions."),
+    {"strings"}, "MatchAnyOptions", /*options_required=*/true);
 #endif
 
 void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
@@ -1616,6 +1804,12 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    for (const auto& ty : {binary_view(), utf8_view()}) {
+      auto exec = GenerateBinaryView<MatchSubstring, PlainSubstringMatcher>(ty);
+      DCHECK_OK(
+          func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
+    }
+    AddDictionaryPredicateKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1627,6 +1821,12 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    for (const auto& ty : {binary_view(), utf8_view()}) {
+      auto exec = GenerateBinaryView<MatchSubstring, PlainStartsWithMatcher>(ty);
+      DCHECK_OK(
+          func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
+    }
+    AddDictionaryPredicateKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1637,6 +1837,12 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    for (const auto& ty : {binary_view(), utf8_view()}) {
+      auto exec = GenerateBinaryView<MatchSubstring, PlainEndsWithMatcher>(ty);
+      DCHECK_OK(
+          func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
+    }
+    AddDictionaryPredicateKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #ifdef ARROW_WITH_RE2
@@ -1648,6 +1854,12 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    for (const auto& ty : {binary_view(), utf8_view()}) {
+      auto exec = GenerateBinaryView<MatchSubstring, RegexSubstringMatcher>(ty);
+      DCHECK_OK(
+          func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
+    }
+    AddDictionaryPredicateKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
   {
@@ -1658,6 +1870,40 @@ void AddAsciiStringMatchSubstring(FunctionRegistry* registry) {
       DCHECK_OK(
           func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
     }
+    for (const auto& ty : {binary_view(), utf8_view()}) {
+      auto exec = GenerateBinaryView<MatchLike>(ty);
+      DCHECK_OK(
+          func->AddKernel({ty}, boolean(), std::move(exec), MatchSubstringState::Init));
+    }
+    AddDictionaryPredicateKernels(func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>("match_any_regex", Arity::Unary(),
+                                                 match_any_regex_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAnyRegex>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec), MatchAnyState::Init));
+    }
+    for (const auto& ty : {binary_view(), utf8_view()}) {
+      auto exec = GenerateBinaryView<MatchAnyRegex>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec), MatchAnyState::Init));
+    }
+    AddDictionaryPredicateKernels(func.get());
+    DCHECK_OK(registry->AddFunction(std::move(func)));
+  }
+  {
+    auto func = std::make_shared<ScalarFunction>("match_any_like", Arity::Unary(),
+                                                 match_any_like_doc);
+    for (const auto& ty : BaseBinaryTypes()) {
+      auto exec = GenerateVarBinaryToVarBinary<MatchAnyLike>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec), MatchAnyState::Init));
+    }
+    for (const auto& ty : {binary_view(), utf8_view()}) {
+      auto exec = GenerateBinaryView<MatchAnyLike>(ty);
+      DCHECK_OK(func->AddKernel({ty}, boolean(), std::move(exec), MatchAnyState::Init));
+    }
+    AddDictionaryPredicateKernels(func.get());
     DCHECK_OK(registry->AddFunction(std::move(func)));
   }
 #endif
@@ -18,6 +18,8 @@
 #pragma once
 
 #include <sstream>
+#include <string>
+#include <string_view>
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common_internal.h"
@@ -411,6 +413,9 @@ struct StringSplitExec {
 
 using StringSplitState = OptionsWrapper<SplitOptions>;
 
+/// Convert a SQL-style LIKE pattern (using '%' and '_') into a regex pattern
+std::string MakeLikeRegex(std::string_view pattern);
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
@@ -1015,6 +1015,133 @@ TEST_F(TestFixedSizeBinaryKernels, FindSubstringIgnoreCase) {
 }
 #endif
 
+class TestBinaryViewKernels : public ::testing::Test {
+ protected:
+  void CheckUnary(std::string func_name, std::shared_ptr<DataType> type,
+                  std::string json_input, std::shared_ptr<DataType> out_ty,
+                  std::string json_expected, const FunctionOptions* options = nullptr) {
+    CheckScalarUnary(func_name, type, json_input, out_ty, json_expected, options);
+    // Ensure the equivalent offsets-based kernel does the same thing
+    auto offsets_type = type->id() == Type::STRING_VIEW ? utf8() : binary();
+    CheckScalarUnary(func_name, offsets_type, json_input,
+                     out_ty->Equals(*type) ? offsets_type : out_ty, json_expected,
+                     options);
+  }
+
+  // Strings of more than 12 bytes are not inlined in their views
+  static constexpr const char* kStrings =
+      R"(["abc", "", null, "abcdefghijklmnop", "xabcdefghijklmnop", "ABCDEFGHIJKLMNOP",
+          "abcdefghijkl", "nop"])";
+};
+
+TEST_F(TestBinaryViewKernels, BinaryLength) {
+  for (const auto& ty : {binary_view(), utf8_view()}) {
+    CheckUnary("binary_length", ty, kStrings, int32(), "[3, 0, null, 16, 17, 16, 12, 3]");
+  }
+}
+
+TEST_F(TestBinaryViewKernels, Utf8Length) {
+  CheckUnary("utf8_length", utf8_view(), R"(["aáéíóú", null, "", "ááááááááá"])",
+             int32(), "[6, null, 0, 9]");
+}
+
+TEST_F(TestBinaryViewKernels, MatchSubstring) {
+  for (const auto& ty : {binary_view(), utf8_view()}) {
+    MatchSubstringOptions options{"abc"};
+    CheckUnary("match_substring", ty, kStrings, boolean(),
+               "[true, false, null, true, true, false, true, false]", &options);
+    CheckUnary("starts_with", ty, kStrings, boolean(),
+               "[true, false, null, true, false, false, true, false]", &options);
+    CheckUnary("ends_with", ty, kStrings, boolean(),
+               "[true, false, null, false, false, false, false, false]", &options);
+
+    // Patterns longer than the inlined prefix
+    MatchSubstringOptions long_options{"abcdefghijklmnop"};
+    CheckUnary("match_substring", ty, kStrings, boolean(),
+               "[false, false, null, true, true, false, false, false]", &long_options);
+    CheckUnary("starts_with", ty, kStrings, boolean(),
+               "[false, false, null, true, false, false, false, false]", &long_options);
+    CheckUnary("ends_with", ty, kStrings, boolean(),
+               "[false, false, null, true, true, false, false, false]", &long_options);
+
+    MatchSubstringOptions empty_options{""};
+    CheckUnary("starts_with", ty, kStrings, boolean(),
+               "[true, true, null, true, true, true, true, true]", &empty_options);
+  }
+}
+
+#ifdef ARROW_WITH_RE2
+TEST_F(TestBinaryViewKernels, MatchSubstringRegex) {
+  for (const auto& ty : {binary_view(), utf8_view()}) {
+    MatchSubstringOptions options{"abcdefghijklmnop", /*ignore_case=*/true};
+    CheckUnary("starts_with", ty, kStrings, boolean(),
+               "[false, false, null, true, false, true, false, false]", &options);
+    CheckUnary("ends_with", ty, kStrings, boolean(),
+               "[false, false, null, true, true, true, false, false]", &options);
+
+    MatchSubstringOptions regex_options{"^x?abc.*p$"};
+    CheckUnary("match_substring_regex", ty, kStrings, boolean(),
+               "[false, false, null, true, true, false, false, false]", &regex_options);
+
+    MatchSubstringOptions like_options{"%bcd_f%"};
+    CheckUnary("match_like", ty, kStrings, boolean(),
+               "[false, false, null, true, true, false, true, false]", &like_options);
+  }
+}
+#endif
+
+TEST_F(TestBinaryViewKernels, Utf8SliceCodeunits) {
+  SliceOptions options{1, -1};
+  CheckUnary("utf8_slice_codeunits", utf8_view(), kStrings, utf8_view(),
+             R"(["b", "", null, "bcdefghijklmno", "abcdefghijklmno", "BCDEFGHIJKLMNO",
+                 "bcdefghijk", "o"])",
+             &options);
+  SliceOptions step_options{0, 20, 2};
+  CheckUnary("utf8_slice_codeunits", utf8_view(), kStrings, utf8_view(),
+             R"(["ac", "", null, "acegikmo", "xbdfhjln", "ACEGIKMO", "acegik", "np"])",
+             &step_options);
+  SliceOptions reverse_options{-1, -30, -1};
+  CheckUnary("utf8_slice_codeunits", utf8_view(), R"(["aáéíóúaáéíóú", null, "ab"])",
+             utf8_view(), R"(["úóíéáaúóíéáa", null, "ba"])", &reverse_options);
+
+  // Slices with a step of 1 point into the data buffers of the input
+  auto input = ArrayFromJSON(utf8_view(), R"(["aaaaaaaaaaaaaaaaaaaa", "bbbbbbbbbbbbb"])");
+  SliceOptions prefix_options{0, 15};
+  ASSERT_OK_AND_ASSIGN(Datum sliced,
+                       CallFunction("utf8_slice_codeunits", {input}, &prefix_options));
+  ValidateOutput(sliced);
+  ASSERT_EQ(sliced.array()->buffers.size(), input->data()->buffers.size());
+  for (size_t i = 2; i < input->data()->buffers.size(); ++i) {
+    ASSERT_EQ(sliced.array()->buffers[i], input->data()->buffers[i]);
+  }
+  AssertArraysEqual(
+      *ArrayFromJSON(utf8_view(), R"(["aaaaaaaaaaaaaaa", "bbbbbbbbbbbbb"])"),
+      *sliced.make_array());
+}
+
+TEST(TestStringDictionaryKernels, MatchSubstring) {
+  // Dictionary inputs are matched once per dictionary value
+  for (const auto& index_ty : all_dictionary_index_types()) {
+    ARROW_SCOPED_TRACE(index_ty->ToString());
+    auto type = dictionary(index_ty, utf8());
+    auto input = DictArrayFromJSON(type, "[0, 1, 2, 3, null, 3, 0]",
+                                   R"(["abc", "xyzab", null, "ab"])");
+    MatchSubstringOptions options{"ab"};
+    CheckScalarUnary(
+        "match_substring", input,
+        ArrayFromJSON(boolean(), "[true, true, null, true, null, true, true]"),
+        &options);
+    CheckScalarUnary(
+        "starts_with", input,
+        ArrayFromJSON(boolean(), "[true, false, null, true, null, true, true]"),
+        &options);
+    CheckScalarUnary(
+        "ends_with", input,
+        ArrayFromJSON(boolean(), "[false, true, null, true, null, true, false]"),
+        &options);
+  }
+}
+
 TYPED_TEST(TestStringKernels, AsciiUpper) {
   this->CheckUnary("ascii_upper", "[]", this->type(), "[]");
   this->CheckUnary("ascii_upper", "[\"aAazZæÆ&\", null, \"\", \"bbb\"]", this->type(),
@@ -1707,6 +1834,54 @@ TYPED_TEST(TestBaseBinaryKernels, MatchLikeEscaping) {
   this->CheckUnary("match_like", R"(["\n\tfoo\t", "\n\t", "\n"])", boolean(),
                    "[true, true, false]", &escape_sequences);
 }
+
+TYPED_TEST(TestStringKernels, MatchAnyRegex) {
+  MatchAnyOptions options{{"ab", "\\d", "^x+$"}};
+  this->CheckUnary("match_any_regex", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_regex", R"(["abc", "acb", "a2", null, "xx", "xxy", "AB"])",
+                   boolean(), "[true, false, true, null, true, false, false]", &options);
+  MatchAnyOptions options_insensitive{{"ab", "é"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_regex", R"(["AB", "É", "e", null])", boolean(),
+                   "[true, true, false, null]", &options_insensitive);
+  MatchAnyOptions options_empty;
+  this->CheckUnary("match_any_regex", R"(["ab", "", null])", boolean(),
+                   "[false, false, null]", &options_empty);
+}
+
+TYPED_TEST(TestStringKernels, MatchAnyRegexManyPatterns) {
+  std::vector<std::string> patterns;
+  for (int i = 0; i < 100; ++i) {
+    patterns.push_back("^key" + std::to_string(i) + "=");
+  }
+  MatchAnyOptions options{std::move(patterns)};
+  this->CheckUnary("match_any_regex", R"(["key7=a", "key70", "key99=", "key100=", null])",
+                   boolean(), "[true, false, true, false, null]", &options);
+}
+
+TYPED_TEST(TestBaseBinaryKernels, MatchAnyRegexInvalid) {
+  Datum input = ArrayFromJSON(this->type(), "[null]");
+  MatchAnyOptions options{{"a", "invalid["}};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Invalid regular expression: missing ]"),
+      CallFunction("match_any_regex", {input}, &options));
+}
+
+TYPED_TEST(TestStringKernels, MatchAnyLike) {
+  auto inputs = R"(["foo", "bar", "foobar", "barfoo", "o", "\nfoo", "foo\n", null])";
+
+  MatchAnyOptions options{{"foo%", "%bar"}};
+  this->CheckUnary("match_any_like", "[]", boolean(), "[]", &options);
+  this->CheckUnary("match_any_like", inputs, boolean(),
+                   "[true, true, true, false, false, false, true, null]", &options);
+
+  MatchAnyOptions options_insensitive{{"_é%", "%BAR"}, /*ignore_case=*/true};
+  this->CheckUnary("match_any_like", R"(["éfoo", "aÉfoo", "foobar", "e"])", boolean(),
+                   "[false, true, true, false]", &options_insensitive);
+
+  MatchAnyOptions options_escaped{{"\\%%", "(%"}};
+  this->CheckUnary("match_any_like", R"(["%%foo", "_bar", "({", "\\baz"])", boolean(),
+                   "[true, false, true, false]", &options_escaped);
+}
 #endif
 
 TYPED_TEST(TestBaseBinaryKernels, SplitBasics) {
@@ -20,6 +20,7 @@
 #include <string>
 
 #include "arrow/compute/kernels/scalar_string_internal.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/config.h"
 #include "arrow/util/utf8_internal.h"
 
@@ -683,6 +684,11 @@ void AddUtf8StringLength(FunctionRegistry* registry) {
         applicator::ScalarUnaryNotNull<Int64Type, LargeStringType, Utf8Length>::Exec;
     DCHECK_OK(func->AddKernel({large_utf8()}, int64(), std::move(exec)));
   }
+  {
+    auto exec =
+        applicator::ScalarUnaryNotNull<Int32Type, StringViewType, Utf8Length>::Exec;
+    DCHECK_OK(func->AddKernel({utf8_view()}, int32(), std::move(exec)));
+  }
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
@@ -1113,16 +1119,17 @@ struct SliceCodeunitsTransform : StringSliceTransformBase {
     }                                 \
   } while (0)
 
-  int64_t SliceForward(const uint8_t* input, int64_t input_string_ncodeunits,
-                       uint8_t* output) {
-    // Slice in forward order (step > 0)
+  // Compute the codeunits spanned by a forward slice (step > 0), before skipping
+  // codepoints according to the step
+  int64_t SliceForwardRange(const uint8_t* input, int64_t input_string_ncodeunits,
+                            const uint8_t** out_begin, const uint8_t** out_end) {
     const SliceOptions& opt = *this->options;
     const uint8_t* begin = input;
     const uint8_t* end = input + input_string_ncodeunits;
     const uint8_t* begin_sliced = begin;
     const uint8_t* end_sliced = end;
+    *out_begin = *out_end = begin;
 
-    // First, compute begin_sliced and end_sliced
     if (opt.start >= 0) {
       // start counting from the left
       RETURN_IF_UTF8_ERROR(
@@ -1167,8 +1174,26 @@ struct SliceCodeunitsTransform : StringSliceTransformBase {
       }
     }
 
-    // Second, copy computed slice to output
     DCHECK(begin_sliced <= end_sliced);
+    *out_begin = begin_sliced;
+    *out_end = end_sliced;
+    return 0;
+  }
+
+  int64_t SliceForward(const uint8_t* input, int64_t input_string_ncodeunits,
+                       uint8_t* output) {
+    // Slice in forward order (step > 0)
+    const SliceOptions& opt = *this->options;
+    const uint8_t* begin_sliced;
+    const uint8_t* end_sliced;
+
+    // First, compute begin_sliced and end_sliced
+    if (SliceForwardRange(input, input_string_ncodeunits, &begin_sliced, &end_sliced) ==
+        kStringTransformError) {
+      return kStringTransformError;
+    }
+
+    // Second, copy computed slice to output
     if (opt.step == 1) {
       // fast case, where we simply can finish with a memcpy
       std::copy(begin_sliced, end_sliced, output);
@@ -1254,6 +1279,90 @@ struct SliceCodeunitsTransform : StringSliceTransformBase {
 template <typename Type>
 using SliceCodeunits = StringTransformExec<Type, SliceCodeunitsTransform>;
 
+// Slicing of string views. With a step of 1 the slices are views into the input's
+// data buffers, so no string data is copied.
+struct SliceCodeunitsStringView {
+  using c_type = BinaryViewType::c_type;
+
+  static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+    SliceCodeunitsTransform transform;
+    RETURN_NOT_OK(transform.PreExec(ctx, batch, out));
+
+    const ArraySpan& input = batch[0].array;
+    const c_type* views = input.GetValues<c_type>(1);
+    const auto data_buffers = input.GetVariadicBuffers();
+
+    ArrayData* output = out->array_data().get();
+    ARROW_ASSIGN_OR_RAISE(output->buffers[1],
+                          ctx->Allocate(input.length * BinaryViewType::kSize));
+    auto* out_views = output->buffers[1]->mutable_data_as<c_type>();
+
+    if (transform.options->step == 1) {
+      for (int64_t i = 0; i < input.length; ++i) {
+        if (input.IsNull(i)) {
+          out_views[i] = {};
+          continue;
+        }
+        const std::string_view value =
+            util::FromBinaryView(views[i], data_buffers.data());
+        const auto* begin = reinterpret_cast<const uint8_t*>(value.data());
+        const uint8_t* begin_sliced;
+        const uint8_t* end_sliced;
+        if (transform.SliceForwardRange(begin, value.size(), &begin_sliced,
+                                        &end_sliced) == kStringTransformError) {
+          return transform.InvalidInputSequence();
+        }
+        const auto size = static_cast<int32_t>(end_sliced - begin_sliced);
+        if (size <= BinaryViewType::kInlineSize) {
+          out_views[i] = util::ToInlineBinaryView(begin_sliced, size);
+        } else {
+          // Only out-of-line strings have slices too long to be inlined
+          out_views[i] = util::ToBinaryView(
+              begin_sliced, size, views[i].ref.buffer_index,
+              views[i].ref.offset + static_cast<int32_t>(begin_sliced - begin));
+        }
+      }
+      output->buffers.insert(output->buffers.end(), data_buffers.begin(),
+                             data_buffers.end());
+      return Status::OK();
+    }
+
+    // Other steps need to reencode the sliced codepoints into a new data buffer
+    int64_t input_ncodeunits = 0;
+    for (int64_t i = 0; i < input.length; ++i) {
+      if (input.IsValid(i)) input_ncodeunits += views[i].size();
+    }
+    const int64_t max_output_ncodeunits =
+        transform.MaxCodeunits(input.length, input_ncodeunits);
+    if (max_output_ncodeunits > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Result might not fit in a single data buffer");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto data_buffer, ctx->Allocate(max_output_ncodeunits));
+    uint8_t* output_data = data_buffer->mutable_data();
+    int32_t output_ncodeunits = 0;
+    for (int64_t i = 0; i < input.length; ++i) {
+      if (input.IsNull(i)) {
+        out_views[i] = {};
+        continue;
+      }
+      const std::string_view value = util::FromBinaryView(views[i], data_buffers.data());
+      const auto size = static_cast<int32_t>(
+          transform.Transform(reinterpret_cast<const uint8_t*>(value.data()),
+                              value.size(), output_data + output_ncodeunits));
+      if (size < 0) {
+        return transform.InvalidInputSequence();
+      }
+      out_views[i] = util::ToBinaryView(output_data + output_ncodeunits, size,
+                                        /*buffer_index=*/0, output_ncodeunits);
+      // Inlined slices leave their scratch space to the next one
+      if (size > BinaryViewType::kInlineSize) output_ncodeunits += size;
+    }
+    RETURN_NOT_OK(data_buffer->Resize(output_ncodeunits, /*shrink_to_fit=*/true));
+    output->buffers.push_back(std::move(data_buffer));
+    return Status::OK();
+  }
+};
+
 const FunctionDoc utf8_slice_codeunits_doc(
     "Slice string",
     ("For each string in `strings`, emit the substring defined by\n"
@@ -1273,6 +1382,10 @@ void AddUtf8StringSlice(FunctionRegistry* registry) {
     DCHECK_OK(
         func->AddKernel({ty}, ty, std::move(exec), SliceCodeunitsTransform::State::Init));
   }
+  ScalarKernel view_kernel{{utf8_view()}, utf8_view(), SliceCodeunitsStringView::Exec,
+                           SliceCodeunitsTransform::State::Init};
+  view_kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  DCHECK_OK(func->AddKernel(std::move(view_kernel)));
   DCHECK_OK(registry->AddFunction(std::move(func)));
 }
 
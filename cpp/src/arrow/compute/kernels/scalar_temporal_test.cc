@@ -1979,6 +1979,51 @@ TEST_F(ScalarTemporalTest, TestAssumeTimezoneNonexistent) {
                    &options_earliest);
 }
 
+TEST_F(ScalarTemporalTest, ZonedConversionsAcrossTransitions) {
+  // Hourly timestamps over two years, forwards then backwards, so that array
+  // conversions step through the time zones' transitions in both directions
+  constexpr int64_t kStart = 1609459200 + 1234;  // 2021-01-01T00:20:34
+  constexpr int64_t kNumHours = 2 * 365 * 24;
+  Int64Builder builder;
+  for (int64_t i = 0; i < kNumHours; ++i) {
+    ASSERT_OK(builder.Append(kStart + i * 3600));
+  }
+  for (int64_t i = kNumHours - 1; i >= 0; --i) {
+    ASSERT_OK(builder.Append(kStart + i * 3600 + 1800));
+  }
+  ASSERT_OK_AND_ASSIGN(auto values, builder.Finish());
+
+  const auto strftime_options = StrftimeOptions("%Y-%m-%dT%H:%M:%S %Z");
+  for (std::string timezone :
+       {"America/New_York", "Australia/Lord_Howe", "Pacific/Apia"}) {
+    ARROW_SCOPED_TRACE("timezone = ", timezone);
+    ASSERT_OK_AND_ASSIGN(auto zoned,
+                         values->View(timestamp(TimeUnit::SECOND, timezone)));
+    ASSERT_OK_AND_ASSIGN(auto local, values->View(timestamp(TimeUnit::SECOND)));
+    const auto assume_options =
+        AssumeTimezoneOptions(timezone, AssumeTimezoneOptions::AMBIGUOUS_EARLIEST,
+                              AssumeTimezoneOptions::NONEXISTENT_EARLIEST);
+    const std::vector<
+        std::tuple<std::string, std::shared_ptr<Array>, const FunctionOptions*>>
+        calls = {{"local_timestamp", zoned, nullptr},
+                 {"hour", zoned, nullptr},
+                 {"strftime", zoned, &strftime_options},
+                 {"assume_timezone", local, &assume_options}};
+    for (const auto& [function, input, options] : calls) {
+      ARROW_SCOPED_TRACE("function = ", function);
+      ASSERT_OK_AND_ASSIGN(Datum actual, CallFunction(function, {input}, options));
+      auto actual_array = actual.make_array();
+      // Each scalar is converted on its own
+      for (int64_t i = 0; i < input->length(); i += 7) {
+        ASSERT_OK_AND_ASSIGN(auto scalar, input->GetScalar(i));
+        ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(function, {scalar}, options));
+        ASSERT_OK_AND_ASSIGN(auto actual_scalar, actual_array->GetScalar(i));
+        AssertScalarsEqual(*expected.scalar(), *actual_scalar, /*verbose=*/true);
+      }
+    }
+  }
+}
+
 TEST_F(ScalarTemporalTest, Strftime) {
   auto options_default = StrftimeOptions();
   auto options = StrftimeOptions("%Y-%m-%dT%H:%M:%S%z");
@@ -321,8 +321,10 @@ struct YearMonthDayVisitValueFunction<Duration, TimestampType, BuilderType> {
       };
     }
     ARROW_ASSIGN_OR_RAISE(auto tz, LocateZone(timezone));
+    // Shared by all values, to reuse its offset cache
+    const ZonedLocalizer localizer{tz};
     return [=](TimestampType::c_type arg) {
-      const auto ymd = GetYearMonthDay<Duration>(arg, ZonedLocalizer{tz});
+      const auto ymd = GetYearMonthDay<Duration>(arg, localizer);
       field_builders[0]->UnsafeAppend(static_cast<const int32_t>(ymd[0]));
       field_builders[1]->UnsafeAppend(static_cast<const uint32_t>(ymd[1]));
       field_builders[2]->UnsafeAppend(static_cast<const uint32_t>(ymd[2]));
@@ -662,14 +664,14 @@ struct Nanosecond {
 template <typename Duration>
 struct IsDaylightSavings {
   explicit IsDaylightSavings(const FunctionOptions* options, const time_zone* tz)
-      : tz_(tz) {}
+      : zone_offsets_(tz) {}
 
   template <typename T, typename Arg0>
   T Call(KernelContext*, Arg0 arg, Status*) const {
-    return tz_->get_info(sys_time<Duration>{Duration{arg}}).save.count() != 0;
+    return zone_offsets_.GetInfo(sys_time<Duration>{Duration{arg}}).save.count() != 0;
   }
 
-  const time_zone* tz_;
+  mutable ZoneOffsetCache zone_offsets_;
 };
 
 // ----------------------------------------------------------------------
@@ -1352,7 +1354,7 @@ Result<TypeHolder> ResolveLocalTimestampOutput(KernelContext* ctx,
 template <typename Duration>
 struct AssumeTimezone {
   explicit AssumeTimezone(const AssumeTimezoneOptions* options, const time_zone* tz)
-      : options(*options), tz_(tz) {}
+      : options(*options), tz_(tz), zone_offsets_(tz) {}
 
   template <typename T, typename Arg0>
   T get_local_time(Arg0 arg, const time_zone* tz) const {
@@ -1374,8 +1376,15 @@ struct AssumeTimezone {
 
   template <typename T, typename Arg0>
   T Call(KernelContext*, Arg0 arg, Status* st) const {
+    sys_time<Duration> sys;
+    if (zone_offsets_.TryToSys(local_time<Duration>(Duration{arg}), &sys)) {
+      return static_cast<T>(sys.time_since_epoch().count());
+    }
     try {
-      return get_local_time<T, Arg0>(arg, tz_);
+      const T result = get_local_time<T, Arg0>(arg, tz_);
+      zone_offsets_.CacheLocalRange(
+          floor<std::chrono::seconds>(sys_time<Duration>(Duration{result})));
+      return result;
     } catch (const arrow_vendored::date::nonexistent_local_time& e) {
       switch (options.nonexistent) {
         case AssumeTimezoneOptions::Nonexistent::NONEXISTENT_RAISE: {
@@ -1411,6 +1420,7 @@ struct AssumeTimezone {
   }
   AssumeTimezoneOptions options;
   const time_zone* tz_;
+  mutable ZoneOffsetCache zone_offsets_;
 };
 
 // ----------------------------------------------------------------------
@@ -1484,8 +1494,10 @@ struct ISOCalendarVisitValueFunction<Duration, TimestampType, BuilderType> {
       };
     }
     ARROW_ASSIGN_OR_RAISE(auto tz, LocateZone(timezone));
+    // Shared by all values, to reuse its offset cache
+    const ZonedLocalizer localizer{tz};
     return [=](TimestampType::c_type arg) {
-      const auto iso_calendar = GetIsoCalendar<Duration>(arg, ZonedLocalizer{tz});
+      const auto iso_calendar = GetIsoCalendar<Duration>(arg, localizer);
       field_builders[0]->UnsafeAppend(iso_calendar[0]);
       field_builders[1]->UnsafeAppend(iso_calendar[1]);
       field_builders[2]->UnsafeAppend(iso_calendar[2]);
@@ -32,6 +32,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -711,5 +712,57 @@ TEST_F(TestSelectKWithTable, BottomKMultipleColumnKeys) {
   Check(schema, input, options, expected);
 }
 
+TEST(TestSelectKParallel, ChunkedArrayAndTable) {
+  // Long enough inputs have their top k selected over ranges in parallel, which
+  // must select the same values as a serial selection.
+  ::arrow::random::RandomArrayGenerator rng(0x7c3b5e91);
+  const int64_t length = 300000;
+  const int64_t chunk_length = 70000;
+  auto schema = ::arrow::schema({field("a", int32()), field("b", float64())});
+  auto a = rng.Int32(length, 0, 100, /*null_probability=*/0.05);
+  auto b = rng.Float64(length, -100.0, 100.0, /*null_probability=*/0.05,
+                       /*nan_probability=*/0.05);
+  ArrayVector a_chunks, b_chunks;
+  for (int64_t offset = 0; offset < length; offset += chunk_length) {
+    a_chunks.push_back(a->Slice(offset, chunk_length));
+    b_chunks.push_back(b->Slice(offset, chunk_length));
+  }
+  auto table = Table::Make(schema, {std::make_shared<ChunkedArray>(a_chunks),
+                                    std::make_shared<ChunkedArray>(b_chunks)});
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+
+  auto check = [&](const Datum& values, const SelectKOptions& options) {
+    ARROW_SCOPED_TRACE(options.ToString());
+    ASSERT_OK_AND_ASSIGN(auto expected_indices,
+                         SelectKUnstable(values, options, &serial_ctx));
+    ASSERT_OK_AND_ASSIGN(auto actual_indices,
+                         SelectKUnstable(values, options, &parallel_ctx));
+    ValidateOutput(*actual_indices);
+    ASSERT_EQ(expected_indices->length(), actual_indices->length());
+    // Ties may be broken differently, but the selected values are the same
+    ASSERT_OK_AND_ASSIGN(auto expected, Take(values, expected_indices));
+    ASSERT_OK_AND_ASSIGN(auto actual, Take(values, actual_indices));
+    if (values.is_chunked_array()) {
+      AssertChunkedEquivalent(*expected.chunked_array(), *actual.chunked_array());
+    } else {
+      AssertTablesEqual(*expected.table(), *actual.table(),
+                        /*same_chunk_layout=*/false);
+    }
+  };
+
+  for (int64_t k : {int64_t(1000), int64_t(200000), length}) {
+    for (const auto& column : table->columns()) {
+      check(column, SelectKOptions::TopKDefault(k));
+      check(column, SelectKOptions::BottomKDefault(k));
+    }
+    check(table, SelectKOptions::TopKDefault(k, {"a", "b"}));
+    check(table, SelectKOptions::BottomKDefault(k, {"a", "b"}));
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,10 +17,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 
 #include "arrow/compute/api_scalar.h"
+#include "arrow/util/macros.h"
 #include "arrow/vendored/datetime.h"
 
 namespace arrow {
@@ -31,9 +33,12 @@ namespace internal {
 using arrow_vendored::date::days;
 using arrow_vendored::date::floor;
 using arrow_vendored::date::local_days;
+using arrow_vendored::date::local_seconds;
 using arrow_vendored::date::local_time;
 using arrow_vendored::date::locate_zone;
 using arrow_vendored::date::sys_days;
+using arrow_vendored::date::sys_info;
+using arrow_vendored::date::sys_seconds;
 using arrow_vendored::date::sys_time;
 using arrow_vendored::date::time_zone;
 using arrow_vendored::date::year_month_day;
@@ -96,23 +101,87 @@ struct NonZonedLocalizer {
   sys_days ConvertDays(sys_days d) const { return d; }
 };
 
+// Caches the offset interval of the last time point converted from or to a time zone.
+// Successive values mostly fall within the same interval, e.g. between two DST
+// transitions, and then convert with a single addition rather than a search of the
+// time zone's transitions.
+class ZoneOffsetCache {
+ public:
+  explicit ZoneOffsetCache(const time_zone* tz) : tz_(tz) {}
+
+  // The offset interval containing `tp`
+  template <typename Duration>
+  const sys_info& GetInfo(sys_time<Duration> tp) {
+    const sys_seconds tp_seconds = floor<std::chrono::seconds>(tp);
+    if (ARROW_PREDICT_FALSE(tp_seconds < info_.begin || tp_seconds >= info_.end)) {
+      info_ = tz_->get_info(tp_seconds);
+    }
+    return info_;
+  }
+
+  // UTC -> local time
+  template <typename Duration>
+  local_time<Duration> ToLocal(sys_time<Duration> tp) {
+    return local_time<Duration>{(tp + GetInfo(tp).offset).time_since_epoch()};
+  }
+
+  // Local time -> UTC, if `t` falls within the cached range of local times that
+  // exist and are unambiguous
+  template <typename Duration>
+  bool TryToSys(local_time<Duration> t, sys_time<Duration>* out) const {
+    const local_seconds t_seconds = floor<std::chrono::seconds>(t);
+    if (ARROW_PREDICT_FALSE(t_seconds < local_begin_ || t_seconds >= local_end_)) {
+      return false;
+    }
+    *out = sys_time<Duration>{(t - local_offset_).time_since_epoch()};
+    return true;
+  }
+
+  // Cache the range of unambiguous local times of the interval containing `tp`
+  void CacheLocalRange(sys_seconds tp) {
+    const sys_info info = tz_->get_info(tp);
+    // Local times are ambiguous where they overlap those of the neighbouring
+    // intervals, and don't exist in the gaps between them
+    const auto prev_offset = tz_->get_info(info.begin - std::chrono::seconds{1}).offset;
+    const auto next_offset = tz_->get_info(info.end).offset;
+    local_begin_ = local_seconds{
+        (info.begin + std::max(info.offset, prev_offset)).time_since_epoch()};
+    local_end_ =
+        local_seconds{(info.end + std::min(info.offset, next_offset)).time_since_epoch()};
+    local_offset_ = info.offset;
+  }
+
+ private:
+  const time_zone* tz_;
+  // Empty ranges until the first lookup
+  sys_info info_{};
+  local_seconds local_begin_{};
+  local_seconds local_end_{};
+  std::chrono::seconds local_offset_{};
+};
+
 struct ZonedLocalizer {
   using days_t = local_days;
 
+  explicit ZonedLocalizer(const time_zone* tz) : tz(tz), cache(tz) {}
+
   // Timezone-localizing conversions: UTC -> local time
   const time_zone* tz;
+  mutable ZoneOffsetCache cache;
 
   template <typename Duration>
   local_time<Duration> ConvertTimePoint(int64_t t) const {
-    return tz->to_local(sys_time<Duration>(Duration{t}));
+    return cache.ToLocal(sys_time<Duration>(Duration{t}));
   }
 
   template <typename Duration>
   Duration ConvertLocalToSys(Duration t, Status* st) const {
+    sys_time<Duration> sys;
+    if (cache.TryToSys(local_time<Duration>(t), &sys)) {
+      return sys.time_since_epoch();
+    }
     try {
-      return zoned_time<Duration>{tz, local_time<Duration>(t)}
-          .get_sys_time()
-          .time_since_epoch();
+      sys = zoned_time<Duration>{tz, local_time<Duration>(t)}.get_sys_time();
     } catch (const arrow_vendored::date::nonexistent_local_time& e) {
       *st = Status::Invalid("Local time does not exist: ", e.what());
       return Duration{0};
@@ -120,6 +189,8 @@ struct ZonedLocalizer {
       *st = Status::Invalid("Local time is ambiguous: ", e.what());
       return Duration{0};
     }
+    cache.CacheLocalRange(floor<std::chrono::seconds>(sys));
+    return sys.time_since_epoch();
   }
 
   local_days ConvertDays(sys_days d) const { return local_days(year_month_day(d)); }
@@ -129,11 +200,12 @@ template <typename Duration>
 struct TimestampFormatter {
   const char* format;
   const time_zone* tz;
+  ZoneOffsetCache zone_offsets;
   std::ostringstream bufstream;
 
   explicit TimestampFormatter(const std::string& format, const time_zone* tz,
                               const std::locale& locale)
-      : format(format.c_str()), tz(tz) {
+      : format(format.c_str()), tz(tz), zone_offsets(tz) {
     bufstream.imbue(locale);
     // Propagate errors as C++ exceptions (to get an actual error message)
     bufstream.exceptions(std::ios::failbit | std::ios::badbit);
@@ -141,9 +213,14 @@ struct TimestampFormatter {
 
   Result<std::string> operator()(int64_t arg) {
     bufstream.str("");
-    const auto zt = zoned_time<Duration>{tz, sys_time<Duration>(Duration{arg})};
+    // Same as formatting a zoned_time, without looking up the offset of every value
+    const auto tp = sys_time<Duration>(Duration{arg});
+    const sys_info& info = zone_offsets.GetInfo(tp);
+    const auto local = local_time<std::common_type_t<Duration, std::chrono::seconds>>{
+        (tp + info.offset).time_since_epoch()};
     try {
-      arrow_vendored::date::to_stream(bufstream, format, zt);
+      arrow_vendored::date::to_stream(bufstream, format, local, &info.abbrev,
+                                      &info.offset);
     } catch (const std::runtime_error& ex) {
       bufstream.clear();
       return Status::Invalid("Failed formatting timestamp: ", ex.what());
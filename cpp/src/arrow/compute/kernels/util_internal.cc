@@ -18,11 +18,21 @@
 #include "arrow/compute/kernels/util_internal.h"
 
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include "arrow/array/data.h"
+#include "arrow/buffer_builder.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
+#include "arrow/scalar.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 
@@ -37,6 +47,401 @@ Status NullToNullExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out
   return Status::OK();
 }
 
+struct DictionaryPredicateState : public KernelState {
+  DictionaryPredicateState(std::string function_name,
+                           std::unique_ptr<FunctionOptions> options)
+      : function_name(std::move(function_name)), options(std::move(options)) {}
+
+  const std::string function_name;
+  const std::unique_ptr<FunctionOptions> options;
+
+  // The predicate results over the last dictionary seen, one byte per dictionary
+  // value holding the result in bit 0 and its validity in bit 1. The additional
+  // last byte is the result for null indices.
+  std::mutex mutex;
+  std::shared_ptr<ArrayData> dictionary;
+  ScalarVector scalar_args;
+  std::shared_ptr<const std::vector<uint8_t>> results;
+};
+
+// Whether `data` and `span` view the same memory. Buffers being immutable, this
+// means they hold the same values.
+bool SameData(const ArrayData& data, const ArraySpan& span) {
+  if (data.length != span.length || data.offset != span.offset ||
+      static_cast<int>(data.buffers.size()) != span.num_buffers() ||
+      data.child_data.size() != span.child_data.size() ||
+      !data.type->Equals(*span.type)) {
+    return false;
+  }
+  for (size_t i = 0; i < data.buffers.size(); ++i) {
+    const uint8_t* address = data.buffers[i] ? data.buffers[i]->data() : nullptr;
+    if (address != span.buffers[i].data) return false;
+  }
+  for (size_t i = 0; i < data.child_data.size(); ++i) {
+    if (!SameData(*data.child_data[i], span.child_data[i])) return false;
+  }
+  return data.dictionary == nullptr || SameData(*data.dictionary, span.dictionary());
+}
+
+Result<std::shared_ptr<Scalar>> DecodeScalar(const Scalar& scalar) {
+  if (scalar.type->id() == Type::DICTIONARY) {
+    return checked_cast<const DictionaryScalar&>(scalar).GetEncodedValue();
+  }
+  return scalar.GetSharedPtr();
+}
+
+Result<std::shared_ptr<const std::vector<uint8_t>>> GetDictionaryResults(
+    KernelContext* ctx, DictionaryPredicateState* state, const ExecSpan& batch,
+    int dictionary_arg) {
+  const ArraySpan& dictionary = batch[dictionary_arg].array.dictionary();
+  ScalarVector scalar_args;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (i == dictionary_arg) continue;
+    ARROW_ASSIGN_OR_RAISE(auto scalar, DecodeScalar(*batch[i].scalar));
+    scalar_args.push_back(std::move(scalar));
+  }
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->results != nullptr && SameData(*state->dictionary, dictionary) &&
+        std::equal(scalar_args.begin(), scalar_args.end(), state->scalar_args.begin(),
+                   state->scalar_args.end(),
+                   [](const std::shared_ptr<Scalar>& left,
+                      const std::shared_ptr<Scalar>& right) {
+                     return left->Equals(*right);
+                   })) {
+      return state->results;
+    }
+  }
+
+  std::shared_ptr<ArrayData> dictionary_data = dictionary.ToArrayData();
+  std::vector<Datum> args, null_args;
+  for (int i = 0, scalar_index = 0; i < batch.num_values(); ++i) {
+    if (i == dictionary_arg) {
+      args.emplace_back(dictionary_data);
+      null_args.emplace_back(MakeNullScalar(dictionary_data->type));
+    } else {
+      args.emplace_back(scalar_args[scalar_index]);
+      null_args.emplace_back(scalar_args[scalar_index++]);
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum values,
+                        CallFunction(state->function_name, args, state->options.get(),
+                                     ctx->exec_context()));
+  ARROW_ASSIGN_OR_RAISE(Datum null_value,
+                        CallFunction(state->function_name, null_args,
+                                     state->options.get(), ctx->exec_context()));
+  DCHECK_EQ(values.type()->id(), Type::BOOL);
+
+  auto results = std::make_shared<std::vector<uint8_t>>(dictionary.length + 1);
+  const ArrayData& values_data = *values.array();
+  const uint8_t* values_bitmap = values_data.buffers[1]->data();
+  for (int64_t i = 0; i < dictionary.length; ++i) {
+    (*results)[i] = static_cast<uint8_t>(
+        bit_util::GetBit(values_bitmap, values_data.offset + i) |
+        (values_data.IsValid(i) << 1));
+  }
+  const auto& null_result = checked_cast<const BooleanScalar&>(*null_value.scalar());
+  results->back() = static_cast<uint8_t>((null_result.is_valid && null_result.value) |
+                                         (null_result.is_valid << 1));
+
+  std::lock_guard<std::mutex> lock(state->mutex);
+  state->dictionary = std::move(dictionary_data);
+  state->scalar_args = std::move(scalar_args);
+  state->results = results;
+  return results;
+}
+
+template <typename IndexType>
+void GatherDictionaryResults(const ArraySpan& indices, const uint8_t* results,
+                             ArraySpan* out) {
+  using c_type = typename IndexType::c_type;
+  const c_type* index_values = indices.GetValues<c_type>(1);
+  const uint8_t* validity = indices.null_count == 0 ? nullptr : indices.buffers[0].data;
+  const int64_t null_slot = indices.dictionary().length;
+  int64_t i = 0;
+  auto next_result = [&]() {
+    const bool is_valid =
+        validity == nullptr || bit_util::GetBit(validity, indices.offset + i);
+    const int64_t slot = is_valid ? static_cast<int64_t>(index_values[i]) : null_slot;
+    ++i;
+    return results[slot];
+  };
+  GenerateBitsUnrolled(out->buffers[1].data, out->offset, out->length,
+                       [&] { return (next_result() & 1) != 0; });
+  i = 0;
+  GenerateBitsUnrolled(out->buffers[0].data, out->offset, out->length,
+                       [&] { return (next_result() & 2) != 0; });
+}
+
+// Decode the dictionaries and call the predicate on their values
+Status ExecDictionaryPredicateDecoded(KernelContext* ctx,
+                                      const DictionaryPredicateState& state,
+                                      const ExecSpan& batch, ArraySpan* out) {
+  std::vector<Datum> args;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (batch[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(auto scalar, DecodeScalar(*batch[i].scalar));
+      args.emplace_back(std::move(scalar));
+      continue;
+    }
+    Datum arg(batch[i].array.ToArrayData());
+    if (arg.type()->id() == Type::DICTIONARY) {
+      const auto& dict_type = checked_cast<const DictionaryType&>(*arg.type());
+      ARROW_ASSIGN_OR_RAISE(arg, Cast(arg, dict_type.value_type(), CastOptions::Safe(),
+                                      ctx->exec_context()));
+    }
+    args.push_back(std::move(arg));
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction(state.function_name, args,
+                                                   state.options.get(),
+                                                   ctx->exec_context()));
+  const ArrayData& result_data = *result.array();
+  ::arrow::internal::CopyBitmap(result_data.buffers[1]->data(), result_data.offset,
+                                out->length, out->buffers[1].data, out->offset);
+  if (result_data.MayHaveNulls()) {
+    ::arrow::internal::CopyBitmap(result_data.buffers[0]->data(), result_data.offset,
+                                  out->length, out->buffers[0].data, out->offset);
+  } else {
+    bit_util::SetBitsTo(out->buffers[0].data, out->offset, out->length, true);
+  }
+  out->null_count = result_data.GetNullCount();
+  return Status::OK();
+}
+
+Status ExecDictionaryPredicate(KernelContext* ctx, const ExecSpan& batch,
+                               ExecResult* out) {
+  auto* state = checked_cast<DictionaryPredicateState*>(ctx->state());
+  ArraySpan* out_arr = out->array_span_mutable();
+
+  // The dictionary results can only be reused for all rows if the other arguments
+  // are scalars
+  int dictionary_arg = -1;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (batch[i].is_scalar()) continue;
+    if (dictionary_arg >= 0 || batch[i].type()->id() != Type::DICTIONARY) {
+      return ExecDictionaryPredicateDecoded(ctx, *state, batch, out_arr);
+    }
+    dictionary_arg = i;
+  }
+  DCHECK_GE(dictionary_arg, 0);
+
+  ARROW_ASSIGN_OR_RAISE(auto results,
+                        GetDictionaryResults(ctx, state, batch, dictionary_arg));
+  const ArraySpan& indices = batch[dictionary_arg].array;
+  const auto& dict_type = checked_cast<const DictionaryType&>(*indices.type);
+  switch (dict_type.index_type()->id()) {
+    case Type::INT8:
+      GatherDictionaryResults<Int8Type>(indices, results->data(), out_arr);
+      break;
+    case Type::UINT8:
+      GatherDictionaryResults<UInt8Type>(indices, results->data(), out_arr);
+      break;
+    case Type::INT16:
+      GatherDictionaryResults<Int16Type>(indices, results->data(), out_arr);
+      break;
+    case Type::UINT16:
+      GatherDictionaryResults<UInt16Type>(indices, results->data(), out_arr);
+      break;
+    case Type::INT32:
+      GatherDictionaryResults<Int32Type>(indices, results->data(), out_arr);
+      break;
+    case Type::UINT32:
+      GatherDictionaryResults<UInt32Type>(indices, results->data(), out_arr);
+      break;
+    case Type::INT64:
+      GatherDictionaryResults<Int64Type>(indices, results->data(), out_arr);
+      break;
+    case Type::UINT64:
+      GatherDictionaryResults<UInt64Type>(indices, results->data(), out_arr);
+      break;
+    default:
+      return Status::TypeError("Invalid dictionary index type: ",
+                               *dict_type.index_type());
+  }
+  out_arr->null_count =
+      out_arr->length - CountSetBits(out_arr->buffers[0].data, out_arr->offset,
+                                     out_arr->length);
+  return Status::OK();
+}
+
+struct RunEndEncodedState : public KernelState {
+  RunEndEncodedState(std::string function_name, std::unique_ptr<FunctionOptions> options)
+      : function_name(std::move(function_name)), options(std::move(options)) {}
+
+  const std::string function_name;
+  const std::unique_ptr<FunctionOptions> options;
+  // run_end_encoded(<run end type of the first REE argument>, <function output type>)
+  std::shared_ptr<DataType> out_type;
+};
+
+Result<TypeHolder> ResolveRunEndEncodedOutput(KernelContext* ctx,
+                                              const std::vector<TypeHolder>&) {
+  return checked_cast<const RunEndEncodedState*>(ctx->state())->out_type;
+}
+
+// Run ends, relative to the start of the output, of the runs where neither input
+// changes value, and the physical indices of those runs in each input
+struct MergedRuns {
+  std::shared_ptr<ArrayData> run_ends;
+  std::shared_ptr<Buffer> left_indices;
+  std::shared_ptr<Buffer> right_indices;
+  int64_t length = 0;
+};
+
+template <typename LeftRunEndType, typename RightRunEndType>
+Result<MergedRuns> MergeRuns(const ArraySpan& left, const ArraySpan& right,
+                             MemoryPool* pool) {
+  using LeftRunEnd = typename LeftRunEndType::c_type;
+  using RightRunEnd = typename RightRunEndType::c_type;
+  ree_util::RunEndEncodedArraySpan<LeftRunEnd> left_span(left);
+  ree_util::RunEndEncodedArraySpan<RightRunEnd> right_span(right);
+  using Iterator =
+      ree_util::MergedRunsIterator<decltype(left_span), decltype(right_span)>;
+
+  TypedBufferBuilder<LeftRunEnd> run_ends(pool);
+  TypedBufferBuilder<int64_t> left_indices(pool), right_indices(pool);
+  for (Iterator it(left_span, right_span); !it.is_end(); ++it) {
+    RETURN_NOT_OK(run_ends.Append(static_cast<LeftRunEnd>(it.run_end())));
+    RETURN_NOT_OK(left_indices.Append(it.index_into_left_array()));
+    RETURN_NOT_OK(right_indices.Append(it.index_into_right_array()));
+  }
+  MergedRuns merged;
+  merged.length = run_ends.length();
+  ARROW_ASSIGN_OR_RAISE(auto run_ends_buffer, run_ends.Finish());
+  merged.run_ends = ArrayData::Make(TypeTraits<LeftRunEndType>::type_singleton(),
+                                    merged.length, {nullptr, std::move(run_ends_buffer)},
+                                    /*null_count=*/0);
+  ARROW_ASSIGN_OR_RAISE(merged.left_indices, left_indices.Finish());
+  ARROW_ASSIGN_OR_RAISE(merged.right_indices, right_indices.Finish());
+  return merged;
+}
+
+template <typename LeftRunEndType>
+Result<MergedRuns> MergeRuns(const ArraySpan& left, const ArraySpan& right,
+                             MemoryPool* pool) {
+  const auto& right_type = checked_cast<const RunEndEncodedType&>(*right.type);
+  switch (right_type.run_end_type()->id()) {
+    case Type::INT16:
+      return MergeRuns<LeftRunEndType, Int16Type>(left, right, pool);
+    case Type::INT32:
+      return MergeRuns<LeftRunEndType, Int32Type>(left, right, pool);
+    case Type::INT64:
+      return MergeRuns<LeftRunEndType, Int64Type>(left, right, pool);
+    default:
+      return Status::TypeError("Invalid run end type: ", *right_type.run_end_type());
+  }
+}
+
+Result<MergedRuns> MergeRuns(const ArraySpan& left, const ArraySpan& right,
+                             MemoryPool* pool) {
+  const auto& left_type = checked_cast<const RunEndEncodedType&>(*left.type);
+  switch (left_type.run_end_type()->id()) {
+    case Type::INT16:
+      return MergeRuns<Int16Type>(left, right, pool);
+    case Type::INT32:
+      return MergeRuns<Int32Type>(left, right, pool);
+    case Type::INT64:
+      return MergeRuns<Int64Type>(left, right, pool);
+    default:
+      return Status::TypeError("Invalid run end type: ", *left_type.run_end_type());
+  }
+}
+
+// The values of the runs of `span` that overlap its logical range
+std::shared_ptr<ArrayData> PhysicalValues(const ArraySpan& span) {
+  auto [offset, length] = ree_util::FindPhysicalRange(span, span.offset, span.length);
+  return ree_util::ValuesArray(span).ToArrayData()->Slice(offset, length);
+}
+
+// Decode the run-end encoded arguments, call the function on the decoded values and
+// encode the result again
+Status ExecRunEndEncodedDecoded(KernelContext* ctx, const RunEndEncodedState& state,
+                                const ExecSpan& batch, std::vector<Datum> args,
+                                ExecResult* out) {
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (args[i].is_array() && args[i].type()->id() == Type::RUN_END_ENCODED) {
+      ARROW_ASSIGN_OR_RAISE(args[i], CallFunction("run_end_decode", {args[i]},
+                                                  ctx->exec_context()));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum result, CallFunction(state.function_name, args,
+                                                   state.options.get(),
+                                                   ctx->exec_context()));
+  const auto& out_type = checked_cast<const RunEndEncodedType&>(*state.out_type);
+  RunEndEncodeOptions options(out_type.run_end_type());
+  ARROW_ASSIGN_OR_RAISE(result, CallFunction("run_end_encode", {result}, &options,
+                                             ctx->exec_context()));
+  out->value = result.array();
+  return Status::OK();
+}
+
+Status ExecRunEndEncoded(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const auto& state = checked_cast<const RunEndEncodedState&>(*ctx->state());
+
+  std::vector<Datum> args;
+  std::vector<int> ree_args;
+  bool have_other_arrays = false;
+  for (int i = 0; i < batch.num_values(); ++i) {
+    if (batch[i].is_scalar()) {
+      const Scalar& scalar = *batch[i].scalar;
+      if (scalar.type->id() == Type::RUN_END_ENCODED) {
+        args.emplace_back(checked_cast<const RunEndEncodedScalar&>(scalar).value);
+      } else {
+        args.emplace_back(scalar.GetSharedPtr());
+      }
+      continue;
+    }
+    args.emplace_back(batch[i].array.ToArrayData());
+    if (batch[i].type()->id() == Type::RUN_END_ENCODED) {
+      ree_args.push_back(i);
+    } else {
+      have_other_arrays = true;
+    }
+  }
+  if (have_other_arrays || ree_args.size() > 2) {
+    return ExecRunEndEncodedDecoded(ctx, state, batch, std::move(args), out);
+  }
+
+  std::shared_ptr<ArrayData> run_ends;
+  int64_t offset = 0;
+  if (ree_args.size() == 1) {
+    // The function is called once per run, and the run ends are shared with the input
+    const ArraySpan& span = batch[ree_args[0]].array;
+    auto [physical_offset, physical_length] =
+        ree_util::FindPhysicalRange(span, span.offset, span.length);
+    run_ends = ree_util::RunEndsArray(span).ToArrayData()->Slice(physical_offset,
+                                                                  physical_length);
+    args[ree_args[0]] = PhysicalValues(span);
+    offset = span.offset;
+  } else {
+    // The function is called once per run of the merged run boundaries
+    const ArraySpan& left = batch[ree_args[0]].array;
+    const ArraySpan& right = batch[ree_args[1]].array;
+    ARROW_ASSIGN_OR_RAISE(MergedRuns merged, MergeRuns(left, right, ctx->memory_pool()));
+    run_ends = std::move(merged.run_ends);
+    for (auto [arg, indices] : {std::make_pair(ree_args[0], merged.left_indices),
+                                std::make_pair(ree_args[1], merged.right_indices)}) {
+      auto indices_data =
+          ArrayData::Make(int64(), merged.length, {nullptr, std::move(indices)},
+                          /*null_count=*/0);
+      ARROW_ASSIGN_OR_RAISE(
+          args[arg],
+          CallFunction("take", {ree_util::ValuesArray(batch[arg].array).ToArrayData(),
+                                std::move(indices_data)},
+                       ctx->exec_context()));
+    }
+  }
+
+  ARROW_ASSIGN_OR_RAISE(Datum values, CallFunction(state.function_name, args,
+                                                   state.options.get(),
+                                                   ctx->exec_context()));
+  auto out_data = ArrayData::Make(state.out_type, batch.length, {nullptr},
+                                  /*null_count=*/0, offset);
+  out_data->child_data = {std::move(run_ends), values.array()};
+  out->value = std::move(out_data);
+  return Status::OK();
+}
+
 }  // namespace
 
 ExecValue GetExecValue(const Datum& value) {
@@ -63,6 +468,70 @@ void AddNullExec(ScalarFunction* func) {
   DCHECK_OK(func->AddKernel(std::move(input_types), OutputType(null()), NullToNullExec));
 }
 
+void AddDictionaryPredicateKernels(ScalarFunction* func) {
+  KernelInit init = [name = func->name()](KernelContext*, const KernelInitArgs& args)
+      -> Result<std::unique_ptr<KernelState>> {
+    return std::make_unique<DictionaryPredicateState>(
+        name, args.options ? args.options->Copy() : nullptr);
+  };
+  std::vector<std::vector<InputType>> signatures;
+  if (func->arity().num_args == 1) {
+    signatures.push_back({InputType(Type::DICTIONARY)});
+  } else {
+    DCHECK_EQ(func->arity().num_args, 2);
+    signatures.push_back({InputType(Type::DICTIONARY), InputType::Any()});
+    signatures.push_back({InputType::Any(), InputType(Type::DICTIONARY)});
+  }
+  for (auto& signature : signatures) {
+    ScalarKernel kernel(std::move(signature), boolean(), ExecDictionaryPredicate, init);
+    kernel.null_handling = NullHandling::COMPUTED_PREALLOCATE;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
+void AddRunEndEncodedKernels(ScalarFunction* func) {
+  KernelInit init = [name = func->name()](KernelContext* ctx, const KernelInitArgs& args)
+      -> Result<std::unique_ptr<KernelState>> {
+    auto state = std::make_unique<RunEndEncodedState>(
+        name, args.options ? args.options->Copy() : nullptr);
+    // Resolve the output type by calling the function on empty arrays of the values
+    std::shared_ptr<DataType> run_end_type;
+    std::vector<Datum> probes;
+    for (const TypeHolder& type : args.inputs) {
+      std::shared_ptr<DataType> value_type = type.GetSharedPtr();
+      if (type.id() == Type::RUN_END_ENCODED) {
+        const auto& ree_type = checked_cast<const RunEndEncodedType&>(*type);
+        if (!run_end_type) run_end_type = ree_type.run_end_type();
+        value_type = ree_type.value_type();
+      }
+      ARROW_ASSIGN_OR_RAISE(auto probe, MakeArrayOfNull(value_type, /*length=*/0,
+                                                        ctx->memory_pool()));
+      probes.emplace_back(std::move(probe));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        Datum result,
+        CallFunction(name, probes, state->options.get(), ctx->exec_context()));
+    state->out_type = run_end_encoded(std::move(run_end_type), result.type());
+    return state;
+  };
+  std::vector<std::vector<InputType>> signatures;
+  if (func->arity().num_args == 1) {
+    signatures.push_back({InputType(Type::RUN_END_ENCODED)});
+  } else {
+    DCHECK_EQ(func->arity().num_args, 2);
+    signatures.push_back({InputType(Type::RUN_END_ENCODED), InputType::Any()});
+    signatures.push_back({InputType::Any(), InputType(Type::RUN_END_ENCODED)});
+  }
+  for (auto& signature : signatures) {
+    ScalarKernel kernel(std::move(signature), OutputType(ResolveRunEndEncodedOutput),
+                        ExecRunEndEncoded, init);
+    kernel.null_handling = NullHandling::OUTPUT_NOT_NULL;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    kernel.can_write_into_slices = false;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
@@ -155,6 +155,21 @@ ArrayKernelExec GenerateArithmeticFloatingPoint(detail::GetTypeId get_id) {
 // A scalar kernel that ignores (assumed all-null) inputs and returns null.
 void AddNullExec(ScalarFunction* func);
 
+// Kernels for a unary or binary boolean predicate taking dictionary-encoded input.
+// The predicate is evaluated once over the dictionary values, by calling `func`
+// itself, and the results are gathered through the indices. The results are
+// reused while consecutive batches share the same dictionary (and the same scalar
+// arguments, for binary predicates). Otherwise-shaped inputs, such as a dictionary
+// compared to an array, are decoded first.
+void AddDictionaryPredicateKernels(ScalarFunction* func);
+
+// Kernels for a unary or binary function taking run-end encoded input and returning
+// run-end encoded output. With a single run-end encoded argument and otherwise
+// scalars, `func` itself is called once per run on the run values. Two run-end
+// encoded arguments are called once per run of their merged run boundaries. Other
+// arrays force the run-end encoded arguments to be decoded.
+void AddRunEndEncodedKernels(ScalarFunction* func);
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
@@ -275,6 +275,31 @@ class ArrayCompareSorter<StructType> {
   }
 };
 
+// Sort values with a LSD radix sort, or std::stable_sort if there are few of them
+template <typename ArrowType>
+class ArrayRadixOrCompareSorter {
+  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
+
+ public:
+  Result<NullPartitionResult> operator()(uint64_t* indices_begin, uint64_t* indices_end,
+                                         const Array& array, int64_t offset,
+                                         const ArraySortOptions& options,
+                                         ExecContext* ctx) {
+    if (indices_end - indices_begin < kMinRadixSortLength) {
+      return compare_sorter_(indices_begin, indices_end, array, offset, options, ctx);
+    }
+    const auto& values = checked_cast<const ArrayType&>(array);
+    const auto p = PartitionNulls<ArrayType, StablePartitioner>(
+        indices_begin, indices_end, values, offset, options.null_placement);
+    RETURN_NOT_OK(RadixSortIndicesByValues<ArrowType>(
+        p.non_nulls_begin, p.non_nulls_end, values, offset, options.order, ctx));
+    return p;
+  }
+
+ private:
+  ArrayCompareSorter<ArrowType> compare_sorter_;
+};
+
 template <typename ArrowType>
 class ArrayCountSorter {
   using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
@@ -412,8 +437,9 @@ class ArrayCountSorter<BooleanType> {
   }
 };
 
-// Sort integers with counting sort or comparison based sorting algorithm
+// Sort integers with counting sort, radix sort or comparison based sorting algorithm
 // - Use O(n) counting sort if values are in a small range
+// - Use O(n) radix sort if there are many values
 // - Use O(nlogn) std::stable_sort otherwise
 template <typename ArrowType>
 class ArrayCountOrCompareSorter {
@@ -440,11 +466,12 @@ class ArrayCountOrCompareSorter {
       }
     }
 
-    return compare_sorter_(indices_begin, indices_end, values, offset, options, ctx);
+    return radix_or_compare_sorter_(indices_begin, indices_end, values, offset, options,
+                                    ctx);
   }
 
  private:
-  ArrayCompareSorter<ArrowType> compare_sorter_;
+  ArrayRadixOrCompareSorter<ArrowType> radix_or_compare_sorter_;
   ArrayCountSorter<ArrowType> count_sorter_;
 
   // Cross point to prefer counting sort than stl::stable_sort(merge sort)
@@ -508,9 +535,16 @@ struct ArraySorter<Type, enable_if_t<is_integer_type<Type>::value &&
 
 template <typename Type>
 struct ArraySorter<
-    Type, enable_if_t<is_floating_type<Type>::value || is_base_binary_type<Type>::value ||
-                      is_fixed_size_binary_type<Type>::value ||
-                      is_dictionary_type<Type>::value || is_struct_type<Type>::value>> {
+    Type, enable_if_t<kIsRadixSortable<Type> && !is_integer_type<Type>::value>> {
+  ArrayRadixOrCompareSorter<Type> impl;
+};
+
+template <typename Type>
+struct ArraySorter<Type, enable_if_t<std::is_same_v<Type, HalfFloatType> ||
+                                     is_base_binary_type<Type>::value ||
+                                     is_decimal_type<Type>::value ||
+                                     is_dictionary_type<Type>::value ||
+                                     is_struct_type<Type>::value>> {
   ArrayCompareSorter<Type> impl;
 };
 
@@ -27,6 +27,8 @@
 #include "arrow/result.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
+#include "arrow/util/parallel.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow::compute::internal {
@@ -66,6 +68,7 @@ struct CumulativeOptionsWrapper : public OptionsWrapper<OptionsType> {
 // such as Add, Mul, Min, Max, etc.
 template <typename Op, typename ArgType>
 struct CumulativeBinaryOp {
+  using OpType = Op;
   using OutType = ArgType;
   using OutValue = typename GetOutputType<OutType>::T;
   using ArgValue = typename GetViewType<ArgType>::T;
@@ -83,6 +86,17 @@ struct CumulativeBinaryOp {
         Op::template Call<OutValue, ArgValue, ArgValue>(ctx, arg, current_value, st);
     return current_value;
   }
+
+  // Whether the chunks of a ChunkedArray may be scanned independently and their
+  // running values combined afterwards.  Wrapping integer addition and
+  // multiplication, min and max are associative; checked ops are not (whether
+  // an intermediate value overflows depends on the evaluation order) and
+  // floating-point addition and multiplication round differently when
+  // reassociated.
+  static constexpr bool kChunkParallel =
+      is_integer_type<ArgType>::value &&
+      (std::is_same_v<Op, Add> || std::is_same_v<Op, Multiply> ||
+       std::is_same_v<Op, Min> || std::is_same_v<Op, Max>);
 };
 
 template <typename ArgType>
@@ -97,6 +111,8 @@ struct CumulativeMean {
   // start value is ignored for CumulativeMean
   explicit CumulativeMean(const std::shared_ptr<Scalar> start) {}
 
+  static constexpr bool kChunkParallel = false;
+
   double Call(KernelContext* ctx, ArgValue arg, Status* st) {
     sum += static_cast<double>(arg);
     ++count;
@@ -173,6 +189,146 @@ struct CumulativeKernel {
   }
 };
 
+// Two-phase scan of a ChunkedArray for an associative Op: every chunk is first
+// scanned on its own from Op's identity, in parallel, writing straight into its
+// slice of the output.  The running value at the start of each chunk is then
+// derived from the chunk totals, and a second parallel pass folds it into the
+// chunk's output values.
+template <typename ArgType, typename Op>
+struct ChunkParallelCumulativeScan {
+  using OutValue = typename GetOutputType<ArgType>::T;
+  using ArgValue = typename GetViewType<ArgType>::T;
+
+  static Status Exec(KernelContext* ctx, const CumulativeOptions& options,
+                     const ChunkedArray& input, Datum* out) {
+    const int64_t length = input.length();
+    const int num_chunks = input.num_chunks();
+
+    // Without skip_nulls everything from the first null onwards is null, so
+    // chunks after the first one holding a null need not be scanned at all.
+    int num_scanned = num_chunks;
+    if (!options.skip_nulls) {
+      for (int i = 0; i < num_chunks; ++i) {
+        if (input.chunk(i)->null_count() > 0) {
+          num_scanned = i + 1;
+          break;
+        }
+      }
+    }
+
+    std::vector<int64_t> chunk_offsets(num_chunks + 1, 0);
+    for (int i = 0; i < num_chunks; ++i) {
+      chunk_offsets[i + 1] = chunk_offsets[i] + input.chunk(i)->length();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                          ctx->Allocate(length * sizeof(OutValue)));
+    OutValue* out_values = values_buffer->mutable_data_as<OutValue>();
+    const bool use_threads = ctx->exec_context()->use_threads();
+    ::arrow::internal::Executor* executor = ctx->exec_context()->executor();
+
+    // Phase 1: local scans.  For the last scanned chunk without skip_nulls,
+    // scanned_length stops at its first null.
+    std::vector<OutValue> totals(num_scanned);
+    std::vector<int64_t> scanned_length(num_scanned);
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads, num_scanned,
+        [&](int i) {
+          Status st;
+          OutValue acc = Identity<Op>::template value<OutValue>;
+          OutValue* out = out_values + chunk_offsets[i];
+          int64_t valid_prefix = 0;
+          bool encountered_null = false;
+          VisitArrayValuesInline<ArgType>(
+              *input.chunk(i)->data(),
+              [&](ArgValue v) {
+                if (encountered_null) {
+                  *out++ = OutValue{};
+                  return;
+                }
+                acc = Op::template Call<OutValue, OutValue, ArgValue>(ctx, acc, v, &st);
+                *out++ = acc;
+                ++valid_prefix;
+              },
+              [&]() {
+                encountered_null = !options.skip_nulls;
+                *out++ = OutValue{};
+              });
+          totals[i] = acc;
+          scanned_length[i] = options.skip_nulls ? input.chunk(i)->length()
+                                                 : valid_prefix;
+          return st;
+        },
+        executor));
+
+    // Running value at the start of each chunk
+    std::vector<OutValue> carry(num_scanned);
+    OutValue running = options.start.has_value()
+                           ? UnboxScalar<ArgType>::Unbox(*options.start.value())
+                           : Identity<Op>::template value<OutValue>;
+    for (int i = 0; i < num_scanned; ++i) {
+      carry[i] = running;
+      Status st;
+      running = Op::template Call<OutValue, OutValue, OutValue>(ctx, running,
+                                                                totals[i], &st);
+    }
+
+    // Phase 2: fold the carried value into every chunk that needs it
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        use_threads, num_scanned,
+        [&](int i) {
+          if (carry[i] == Identity<Op>::template value<OutValue>) {
+            return Status::OK();
+          }
+          Status st;
+          OutValue* out = out_values + chunk_offsets[i];
+          for (int64_t j = 0; j < scanned_length[i]; ++j) {
+            out[j] = Op::template Call<OutValue, OutValue, OutValue>(ctx, carry[i],
+                                                                     out[j], &st);
+          }
+          return st;
+        },
+        executor));
+    if (num_scanned < num_chunks) {
+      std::fill(out_values + chunk_offsets[num_scanned], out_values + length,
+                OutValue{});
+    }
+
+    std::shared_ptr<Buffer> validity;
+    int64_t null_count = 0;
+    if (options.skip_nulls) {
+      null_count = input.null_count();
+      if (null_count > 0) {
+        ARROW_ASSIGN_OR_RAISE(validity, ctx->AllocateBitmap(length));
+        uint8_t* bitmap = validity->mutable_data();
+        for (int i = 0; i < num_chunks; ++i) {
+          const ArrayData& chunk = *input.chunk(i)->data();
+          if (chunk.GetNullCount() == 0) {
+            bit_util::SetBitsTo(bitmap, chunk_offsets[i], chunk.length, true);
+          } else {
+            ::arrow::internal::CopyBitmap(chunk.buffers[0]->data(), chunk.offset,
+                                          chunk.length, bitmap, chunk_offsets[i]);
+          }
+        }
+      }
+    } else {
+      const int64_t valid_length =
+          chunk_offsets[num_scanned - 1] + scanned_length[num_scanned - 1];
+      null_count = length - valid_length;
+      if (null_count > 0) {
+        ARROW_ASSIGN_OR_RAISE(validity, ctx->AllocateBitmap(length));
+        bit_util::SetBitsTo(validity->mutable_data(), 0, valid_length, true);
+        bit_util::SetBitsTo(validity->mutable_data(), valid_length, null_count, false);
+      }
+    }
+
+    out->value = ArrayData::Make(TypeTraits<ArgType>::type_singleton(), length,
+                                 {std::move(validity), std::move(values_buffer)},
+                                 null_count);
+    return Status::OK();
+  }
+};
+
 template <typename ArgType, typename CumulativeState, typename OptionsType>
 struct CumulativeKernelChunked {
   using OutType = typename CumulativeState::OutType;
@@ -188,6 +344,13 @@ struct CumulativeKernelChunked {
     accumulator.skip_nulls = options.skip_nulls;
 
     const ChunkedArray& chunked_input = *batch[0].chunked_array();
+    if constexpr (CumulativeState::kChunkParallel) {
+      if (ctx->exec_context()->use_threads() && chunked_input.num_chunks() > 1) {
+        return ChunkParallelCumulativeScan<ArgType, typename CumulativeState::OpType>::
+            Exec(ctx, options, chunked_input, out);
+      }
+    }
+
     RETURN_NOT_OK(accumulator.builder.Reserve(chunked_input.length()));
     std::vector<std::shared_ptr<Array>> out_chunks;
     for (const auto& chunk : chunked_input.chunks()) {
@@ -26,6 +26,7 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/scalar.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 
@@ -949,5 +950,42 @@ TEST(TestCumulative, NaN) {
   CheckVectorUnary("cumulative_mean", ArrayFromJSON(float64(), "[5, 4, NaN, 2, 1]"),
                    ArrayFromJSON(float64(), "[5, 4.5, NaN, NaN, NaN]"));
 }
+
+TEST(TestCumulative, ChunkedParallelMatchesSerial) {
+  // Chunked integer inputs are scanned chunk by chunk in parallel when threads
+  // are enabled; the result must match the serial scan exactly.
+  random::RandomArrayGenerator rng(0x5eed);
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+  ExecContext parallel_ctx;
+  parallel_ctx.set_use_threads(true);
+
+  for (auto ty : IntTypes()) {
+    for (double null_probability : {0.0, 0.001}) {
+      ArrayVector chunks;
+      for (int64_t length : {1000, 0, 1, 777, 4096, 3}) {
+        chunks.push_back(rng.ArrayOf(ty, length, null_probability));
+      }
+      auto input = std::make_shared<ChunkedArray>(chunks, ty);
+      for (auto function :
+           {"cumulative_sum", "cumulative_prod", "cumulative_min", "cumulative_max"}) {
+        for (bool skip_nulls : {false, true}) {
+          for (auto start : {std::shared_ptr<Scalar>{}, ScalarFromJSON(ty, "7")}) {
+            ARROW_SCOPED_TRACE(function, " ", *ty, " skip_nulls=", skip_nulls,
+                               " null_probability=", null_probability);
+            auto options = start ? CumulativeOptions(start, skip_nulls)
+                                 : CumulativeOptions(skip_nulls);
+            ASSERT_OK_AND_ASSIGN(auto expected,
+                                 CallFunction(function, {input}, &options, &serial_ctx));
+            ASSERT_OK_AND_ASSIGN(auto actual, CallFunction(function, {input}, &options,
+                                                           &parallel_ctx));
+            ValidateOutput(actual);
+            AssertDatumsEqual(expected, actual, /*verbose=*/true);
+          }
+        }
+      }
+    }
+  }
+}
 }  // namespace compute
 }  // namespace arrow
@@ -15,9 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "arrow/array/array_base.h"
 #include "arrow/array/array_dict.h"
@@ -30,7 +33,10 @@
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/row/grouper.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/hashing.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/unreachable.h"
@@ -85,6 +91,11 @@ class UniqueAction final : public ActionBase {
   template <class Index>
   void ObserveNotFound(Index index) {}
 
+  Status ObserveGroups(const ArraySpan& input, const uint32_t* group_ids,
+                       int64_t num_groups) {
+    return Status::OK();
+  }
+
   bool ShouldEncodeNulls() { return true; }
 
   Status Flush(ExecResult* out) { return Status::OK(); }
@@ -158,6 +169,15 @@ class ValueCountsAction final : ActionBase {
     }
   }
 
+  Status ObserveGroups(const ArraySpan& input, const uint32_t* group_ids,
+                       int64_t num_groups) {
+    RETURN_NOT_OK(count_builder_.AppendEmptyValues(num_groups - count_builder_.length()));
+    for (int64_t i = 0; i < input.length; ++i) {
+      count_builder_[group_ids[i]]++;
+    }
+    return Status::OK();
+  }
+
   bool ShouldEncodeNulls() const { return true; }
 
  private:
@@ -212,6 +232,17 @@ class DictEncodeAction final : public ActionBase {
     ObserveFound(index);
   }
 
+  Status ObserveGroups(const ArraySpan& input, const uint32_t* group_ids,
+                       int64_t num_groups) {
+    // The caller ensures that group ids fit in the int32 indices
+    const auto* indices = reinterpret_cast<const int32_t*>(group_ids);
+    if (ShouldEncodeNulls() || input.GetNullCount() == 0) {
+      return indices_builder_.AppendValues(indices, input.length);
+    }
+    return indices_builder_.AppendValues(indices, input.length, input.buffers[0].data,
+                                         input.offset);
+  }
+
   bool ShouldEncodeNulls() {
     return encode_options_.null_encoding_behavior == DictionaryEncodeOptions::ENCODE;
   }
@@ -437,6 +468,94 @@ class NullHashKernel : public HashKernel {
   Action action_;
 };
 
+// ----------------------------------------------------------------------
+// Hash kernel implementation on top of a Grouper, whose SwissTable hashes, looks
+// up and inserts a whole minibatch of keys at a time
+
+template <typename Action>
+class GrouperHashKernel : public HashKernel {
+ public:
+  GrouperHashKernel(const std::shared_ptr<DataType>& type, const FunctionOptions* options,
+                    MemoryPool* pool)
+      : HashKernel(options), ctx_(pool), type_(type), action_(type, options, pool) {}
+
+  Status Reset() override {
+    ARROW_ASSIGN_OR_RAISE(grouper_, Grouper::Make({type_}, &ctx_));
+    memo_indices_.clear();
+    memo_groups_.clear();
+    return action_.Reset();
+  }
+
+  Status Append(const ArraySpan& arr) override {
+    RETURN_NOT_OK(action_.Reserve(arr.length));
+    ARROW_ASSIGN_OR_RAISE(Datum ids, grouper_->Consume(ExecSpan({arr}, arr.length)));
+    auto group_ids = ids.array()->GetMutableValues<uint32_t>(1);
+
+    // The grouper numbers groups in no particular order, while the dictionary must
+    // list values by order of first occurrence: number them again as they occur.
+    // Nulls are left out of the dictionary if they are not encoded.
+    memo_indices_.resize(grouper_->num_groups(), kNoMemoIndex);
+    auto to_memo_indices = [&](int64_t position, int64_t length) {
+      for (int64_t i = position; i < position + length; ++i) {
+        uint32_t& memo_index = memo_indices_[group_ids[i]];
+        if (memo_index == kNoMemoIndex) {
+          memo_index = static_cast<uint32_t>(memo_groups_.size());
+          memo_groups_.push_back(group_ids[i]);
+        }
+        group_ids[i] = memo_index;
+      }
+    };
+    if (action_.ShouldEncodeNulls() || arr.GetNullCount() == 0) {
+      to_memo_indices(0, arr.length);
+    } else {
+      int64_t end = 0;
+      ::arrow::internal::VisitSetBitRunsVoid(
+          arr.buffers[0].data, arr.offset, arr.length,
+          [&](int64_t position, int64_t length) {
+            std::fill(group_ids + end, group_ids + position, 0);
+            to_memo_indices(position, length);
+            end = position + length;
+          });
+      std::fill(group_ids + end, group_ids + arr.length, 0);
+    }
+    const auto num_memo_indices = static_cast<int64_t>(memo_groups_.size());
+    if (num_memo_indices > std::numeric_limits<int32_t>::max()) {
+      return Status::CapacityError("Too many distinct values to hash: ",
+                                   num_memo_indices);
+    }
+    return action_.ObserveGroups(arr, group_ids, num_memo_indices);
+  }
+
+  Status Flush(ExecResult* out) override { return action_.Flush(out); }
+
+  Status FlushFinal(ExecResult* out) override { return action_.FlushFinal(out); }
+
+  Status GetDictionary(std::shared_ptr<ArrayData>* out) override {
+    ARROW_ASSIGN_OR_RAISE(ExecBatch uniques, grouper_->GetUniques());
+    UInt32Array memo_groups(static_cast<int64_t>(memo_groups_.size()),
+                            Buffer::Wrap(memo_groups_));
+    ARROW_ASSIGN_OR_RAISE(Datum dictionary,
+                          Take(uniques.values[0], memo_groups.data(),
+                               TakeOptions::NoBoundsCheck(), &ctx_));
+    *out = dictionary.array();
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> value_type() const override { return type_; }
+
+ protected:
+  static constexpr uint32_t kNoMemoIndex = std::numeric_limits<uint32_t>::max();
+
+  ExecContext ctx_;
+  std::shared_ptr<DataType> type_;
+  Action action_;
+  std::unique_ptr<Grouper> grouper_;
+  // The memo index (position in the dictionary) of each group of the grouper
+  std::vector<uint32_t> memo_indices_;
+  // The group of each memo index
+  std::vector<uint32_t> memo_groups_;
+};
+
 // ----------------------------------------------------------------------
 // Hashing for dictionary type
 
@@ -534,7 +653,7 @@ Result<std::unique_ptr<KernelState>> HashInit(KernelContext* ctx,
 }
 
 template <typename Action>
-KernelInit GetHashInit(Type::type type_id) {
+KernelInit GetMemoTableHashInit(Type::type type_id) {
   // ARROW-8933: Generate only a single hash kernel per physical data
   // representation
   switch (type_id) {
@@ -584,14 +703,65 @@ KernelInit GetHashInit(Type::type type_id) {
   }
 }
 
+template <typename Action>
+Result<std::unique_ptr<KernelState>> FixedSizeBinaryHashInit(KernelContext* ctx,
+                                                             const KernelInitArgs& args) {
+  // The key encoding of the grouper would take zero-width values for booleans
+  if (checked_cast<const FixedSizeBinaryType&>(*args.inputs[0]).byte_width() == 0) {
+    return HashInit<RegularHashKernel<FixedSizeBinaryType, Action, std::string_view>>(
+        ctx, args);
+  }
+  return HashInit<GrouperHashKernel<Action>>(ctx, args);
+}
+
+template <typename Action>
+KernelInit GetHashInit(Type::type type_id) {
+  // Booleans and 8-bit integers are directly indexed in a small memo table, while
+  // the key encoding of the grouper doesn't support large binary and view types.
+  // Elsewhere, the vectorized hash table usually beats the memo table.
+#if ARROW_LITTLE_ENDIAN
+  switch (type_id) {
+    case Type::INT16:
+    case Type::UINT16:
+    case Type::INT32:
+    case Type::UINT32:
+    case Type::FLOAT:
+    case Type::DATE32:
+    case Type::TIME32:
+    case Type::INTERVAL_MONTHS:
+    case Type::INT64:
+    case Type::UINT64:
+    case Type::DOUBLE:
+    case Type::DATE64:
+    case Type::TIME64:
+    case Type::TIMESTAMP:
+    case Type::DURATION:
+    case Type::INTERVAL_DAY_TIME:
+    case Type::BINARY:
+    case Type::STRING:
+    case Type::DECIMAL128:
+    case Type::DECIMAL256:
+    case Type::INTERVAL_MONTH_DAY_NANO:
+      return HashInit<GrouperHashKernel<Action>>;
+    case Type::FIXED_SIZE_BINARY:
+      return FixedSizeBinaryHashInit<Action>;
+    default:
+      break;
+  }
+#endif
+  return GetMemoTableHashInit<Action>(type_id);
+}
+
 using DictionaryEncodeState = OptionsWrapper<DictionaryEncodeOptions>;
 
 template <typename Action>
 Result<std::unique_ptr<KernelState>> DictionaryHashInit(KernelContext* ctx,
                                                         const KernelInitArgs& args) {
   const auto& dict_type = checked_cast<const DictionaryType&>(*args.inputs[0].type);
-  ARROW_ASSIGN_OR_RAISE(auto indices_hasher,
-                        GetHashInit<Action>(dict_type.index_type()->id())(ctx, args));
+  // Memo table kernels only depend on the physical type of the indices
+  ARROW_ASSIGN_OR_RAISE(
+      auto indices_hasher,
+      GetMemoTableHashInit<Action>(dict_type.index_type()->id())(ctx, args));
   return std::make_unique<DictionaryHashKernel>(
       checked_pointer_cast<HashKernel>(std::move(indices_hasher)),
       dict_type.value_type());
@@ -23,6 +23,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -30,9 +31,11 @@
 
 #include "arrow/array.h"
 #include "arrow/array/builder_decimal.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/buffer.h"
 #include "arrow/chunked_array.h"
 #include "arrow/status.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
@@ -48,6 +51,7 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 namespace compute {
 
@@ -878,5 +882,57 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+TEST_F(TestHashKernel, OrderOfFirstOccurrence) {
+  // Many distinct values across chunks and hash table minibatches must still be
+  // listed by order of first occurrence
+  auto values = checked_pointer_cast<Int64Array>(
+      random::RandomArrayGenerator(0x7a1e3b).Int64(10000, 0, 2000,
+                                                   /*null_probability=*/0.1));
+  Int64Builder uniques_builder, dictionary_builder;
+  Int32Builder indices_builder;
+  std::unordered_map<int64_t, int32_t> memo;
+  bool seen_null = false;
+  for (int64_t i = 0; i < values->length(); ++i) {
+    if (values->IsNull(i)) {
+      if (!seen_null) {
+        ASSERT_OK(uniques_builder.AppendNull());
+        seen_null = true;
+      }
+      ASSERT_OK(indices_builder.AppendNull());
+      continue;
+    }
+    auto inserted = memo.emplace(values->Value(i), static_cast<int32_t>(memo.size()));
+    if (inserted.second) {
+      ASSERT_OK(uniques_builder.Append(values->Value(i)));
+      ASSERT_OK(dictionary_builder.Append(values->Value(i)));
+    }
+    ASSERT_OK(indices_builder.Append(inserted.first->second));
+  }
+  ASSERT_OK_AND_ASSIGN(auto expected_uniques, uniques_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected_dictionary, dictionary_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected_indices, indices_builder.Finish());
+
+  for (const auto& type : {int64(), utf8()}) {
+    ARROW_SCOPED_TRACE(*type);
+    ASSERT_OK_AND_ASSIGN(auto input, Cast(*values, type));
+    ASSERT_OK_AND_ASSIGN(auto uniques, Cast(*expected_uniques, type));
+    ASSERT_OK_AND_ASSIGN(auto dict, Cast(*expected_dictionary, type));
+    auto chunked_input = std::make_shared<ChunkedArray>(ArrayVector{
+        input->Slice(0, 1000), input->Slice(1000, 4000), input->Slice(5000)});
+
+    ASSERT_OK_AND_ASSIGN(auto actual, Unique(chunked_input));
+    AssertArraysEqual(*uniques, *actual);
+    ASSERT_OK_AND_ASSIGN(actual, ValueCounts(chunked_input));
+    AssertArraysEqual(*uniques, *checked_cast<const StructArray&>(*actual).field(0));
+
+    ASSERT_OK_AND_ASSIGN(Datum encoded, DictionaryEncode(chunked_input));
+    auto expected = std::make_shared<DictionaryArray>(dictionary(int32(), type),
+                                                      expected_indices, dict);
+    ASSERT_OK_AND_ASSIGN(auto actual_encoded,
+                         Concatenate(encoded.chunked_array()->chunks()));
+    AssertArraysEqual(*expected, *actual_encoded);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
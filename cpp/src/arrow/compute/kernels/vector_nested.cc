@@ -54,9 +54,9 @@ struct ListParentIndicesArray {
       // Note: In most cases, null slots are empty, but when they are non-empty
       // we write out the indices so make sure they are accounted for. This
       // behavior could be changed if needed in the future.
-      for (offset_type j = offsets[i]; j < offsets[i + 1]; ++j) {
-        *out_indices++ = i + base_output_offset;
-      }
+      const offset_type list_length = offsets[i + 1] - offsets[i];
+      std::fill(out_indices, out_indices + list_length, i + base_output_offset);
+      out_indices += list_length;
     }
 
     BufferVector buffers{nullptr, std::move(indices)};
@@ -66,10 +66,41 @@ struct ListParentIndicesArray {
     return Status::OK();
   }
 
+  // Emits an index for every value of every non-null list-view, in the order of
+  // the output of list_flatten
+  template <typename Type, typename offset_type = typename Type::offset_type>
+  Status VisitListView(const Type&) {
+    const auto* validity = input->GetValues<uint8_t>(0, 0);
+    const offset_type* sizes = input->GetValues<offset_type>(2);
+    auto is_valid = [&](int64_t i) {
+      return !validity || bit_util::GetBit(validity, input->offset + i);
+    };
+
+    int64_t values_length = 0;
+    for (int64_t i = 0; i < input->length; ++i) {
+      values_length += is_valid(i) ? sizes[i] : 0;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto indices, ctx->Allocate(values_length * sizeof(int64_t)));
+    auto out_indices = reinterpret_cast<int64_t*>(indices->mutable_data());
+    for (int64_t i = 0; i < input->length; ++i) {
+      if (is_valid(i)) {
+        std::fill(out_indices, out_indices + sizes[i], i + base_output_offset);
+        out_indices += sizes[i];
+      }
+    }
+    out = ArrayData::Make(int64(), values_length, {nullptr, std::move(indices)},
+                          /*null_count=*/0);
+    return Status::OK();
+  }
+
   Status Visit(const ListType& type) { return VisitList(type); }
 
   Status Visit(const LargeListType& type) { return VisitList(type); }
 
+  Status Visit(const ListViewType& type) { return VisitListView(type); }
+
+  Status Visit(const LargeListViewType& type) { return VisitListView(type); }
+
   Status Visit(const FixedSizeListType& type) {
     using offset_type = typename FixedSizeListType::offset_type;
     const offset_type slot_length = type.list_size();
@@ -164,6 +195,10 @@ void RegisterVectorNested(FunctionRegistry* registry) {
                                ListFlatten<FixedSizeListType>));
   DCHECK_OK(flatten->AddKernel({Type::LARGE_LIST}, OutputType(ListValuesType),
                                ListFlatten<LargeListType>));
+  DCHECK_OK(flatten->AddKernel({Type::LIST_VIEW}, OutputType(ListValuesType),
+                               ListFlatten<ListViewType>));
+  DCHECK_OK(flatten->AddKernel({Type::LARGE_LIST_VIEW}, OutputType(ListValuesType),
+                               ListFlatten<LargeListViewType>));
   DCHECK_OK(registry->AddFunction(std::move(flatten)));
 
   DCHECK_OK(registry->AddFunction(std::make_shared<ListParentIndicesFunction>()));
@@ -29,6 +29,15 @@ namespace compute {
 
 using arrow::internal::checked_cast;
 
+static Result<std::shared_ptr<Array>> MakeListViewArray(
+    const std::shared_ptr<DataType>& type, const Array& offsets, const Array& sizes,
+    const Array& values) {
+  if (type->id() == Type::LIST_VIEW) {
+    return ListViewArray::FromArrays(type, offsets, sizes, values);
+  }
+  return LargeListViewArray::FromArrays(type, offsets, sizes, values);
+}
+
 TEST(TestVectorNested, ListFlatten) {
   for (auto ty : {list(int16()), large_list(int16())}) {
     auto input = ArrayFromJSON(ty, "[[0, null, 1], null, [2, 3], []]");
@@ -42,6 +51,27 @@ TEST(TestVectorNested, ListFlatten) {
   }
 }
 
+TEST(TestVectorNested, ListFlattenListView) {
+  for (auto ty : {list_view(int16()), large_list_view(int16())}) {
+    ARROW_SCOPED_TRACE(ty->ToString());
+    auto input = ArrayFromJSON(ty, "[[0, null, 1], null, [2, 3], []]");
+    auto expected = ArrayFromJSON(int16(), "[0, null, 1, 2, 3]");
+    CheckVectorUnary("list_flatten", input, expected);
+
+    // Out of order and overlapping list-views
+    auto offset_type = ty->id() == Type::LIST_VIEW ? int32() : int64();
+    auto values = ArrayFromJSON(int16(), "[0, 1, 2, 3, 4, 5]");
+    ASSERT_OK_AND_ASSIGN(
+        auto views,
+        MakeListViewArray(ty, *ArrayFromJSON(offset_type, "[4, 0, 1, 5]"),
+                          *ArrayFromJSON(offset_type, "[2, 2, 3, 0]"), *values));
+    CheckVectorUnary("list_flatten", views,
+                     ArrayFromJSON(int16(), "[4, 5, 0, 1, 1, 2, 3]"));
+    CheckVectorUnary("list_parent_indices", views,
+                     ArrayFromJSON(int64(), "[0, 0, 1, 1, 2, 2, 2]"));
+  }
+}
+
 TEST(TestVectorNested, ListFlattenNulls) {
   const auto ty = list(int32());
   auto input = ArrayFromJSON(ty, "[null, null]");
@@ -100,6 +130,18 @@ TEST(TestVectorNested, ListParentIndices) {
     CheckVectorUnary("list_parent_indices", input, expected);
   }
 
+  for (auto ty : {list_view(int16()), large_list_view(int16())}) {
+    auto input = ArrayFromJSON(ty, "[[0, null, 1], null, [2, 3], [], [4, 5]]");
+
+    auto expected = ArrayFromJSON(int64(), "[0, 0, 0, 2, 2, 4, 4]");
+    CheckVectorUnary("list_parent_indices", input, expected);
+
+    // Unlike lists, non-empty null list-views emit nothing, like in list_flatten
+    auto tweaked = TweakValidityBit(input, 0, false);
+    expected = ArrayFromJSON(int64(), "[2, 2, 4, 4]");
+    CheckVectorUnary("list_parent_indices", tweaked, expected);
+  }
+
   // Construct a list with a non-empty null slot
   auto input = ArrayFromJSON(list(int16()), "[[0, null, 1], [0, 0], [2, 3], [], [4, 5]]");
   auto tweaked = TweakValidityBit(input, 1, false);
@@ -21,6 +21,8 @@
 #include <memory>
 
 #include "arrow/array/builder_base.h"
+#include "arrow/chunk_resolver.h"
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/function.h"
@@ -88,26 +90,88 @@ Status PairwiseExecImpl(KernelContext* ctx, const ArraySpan& input,
   return Status::OK();
 }
 
-Status PairwiseExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
-  const auto& state = checked_cast<const PairwiseState&>(*ctx->state());
-  auto input = batch[0].array;
-
-  // The scalar diff kernel will only write into the non-null output area.
-  // We must therefore pre-initialize the output, otherwise the left or right
-  // margin would be left uninitialized.
-  ARROW_ASSIGN_OR_RAISE(auto builder,
-                        MakeBuilder(out->type()->GetSharedPtr(), ctx->memory_pool()));
+// The scalar diff kernel will only write into the non-null output area.
+// We must therefore pre-initialize the output, otherwise the left or right
+// margin would be left uninitialized.
+Result<std::shared_ptr<ArrayData>> MakeNullOutput(KernelContext* ctx,
+                                                  const std::shared_ptr<DataType>& type,
+                                                  int64_t length) {
+  ARROW_ASSIGN_OR_RAISE(auto builder, MakeBuilder(type, ctx->memory_pool()));
   // Append nulls rather than empty values, so as to allocate a null bitmap.
-  RETURN_NOT_OK(builder->AppendNulls(out->length()));
+  RETURN_NOT_OK(builder->AppendNulls(length));
   std::shared_ptr<ArrayData> out_data;
   RETURN_NOT_OK(builder->FinishInternal(&out_data));
   out_data->null_count = kUnknownNullCount;
-  out->value = std::move(out_data);
+  return out_data;
+}
 
+Status PairwiseExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  const auto& state = checked_cast<const PairwiseState&>(*ctx->state());
+  ARROW_ASSIGN_OR_RAISE(out->value,
+                        MakeNullOutput(ctx, out->type()->GetSharedPtr(), out->length()));
   return PairwiseExecImpl(ctx, batch[0].array, state.scalar_exec, state.periods,
                           out->array_data_mutable());
 }
 
+/// Chunked variant that pairs up values across chunk boundaries in place,
+/// without concatenating the input.  The output has the chunk layout of the
+/// input: each output chunk is computed in runs over which both the value and
+/// the value `periods` positions before it lie in a single input chunk.
+Status PairwiseExecChunked(KernelContext* ctx, const ExecBatch& batch, Datum* out) {
+  const auto& state = checked_cast<const PairwiseState&>(*ctx->state());
+  const ChunkedArray& input = *batch[0].chunked_array();
+  const std::shared_ptr<DataType> out_type = out->type();
+  const int64_t periods = state.periods;
+  const int64_t length = input.length();
+  // Positions whose counterpart `periods` positions before lies within the input
+  const int64_t computed_begin = std::clamp<int64_t>(periods, 0, length);
+  const int64_t computed_end = std::clamp<int64_t>(length + periods, 0, length);
+  ::arrow::internal::ChunkResolver resolver(input.chunks());
+
+  ArrayVector out_chunks;
+  out_chunks.reserve(input.num_chunks());
+  int64_t chunk_begin = 0;
+  for (const auto& chunk : input.chunks()) {
+    const int64_t chunk_end = chunk_begin + chunk->length();
+    ARROW_ASSIGN_OR_RAISE(auto out_data, MakeNullOutput(ctx, out_type, chunk->length()));
+    const ArraySpan left_chunk(*chunk->data());
+    int64_t null_count = chunk->length();
+    const int64_t end = std::min(chunk_end, computed_end);
+    for (int64_t i = std::max(chunk_begin, computed_begin); i < end;) {
+      const ::arrow::internal::ChunkLocation location = resolver.Resolve(i - periods);
+      const auto& right_chunk = *input.chunk(static_cast<int>(location.chunk_index));
+      const int64_t run_length =
+          std::min(end - i, right_chunk.length() - location.index_in_chunk);
+
+      ArraySpan left(left_chunk);
+      left.SetSlice(left_chunk.offset + i - chunk_begin, run_length);
+      ArraySpan right(*right_chunk.data());
+      right.SetSlice(right.offset + location.index_in_chunk, run_length);
+      ArraySpan output_span;
+      output_span.SetMembers(*out_data);
+      output_span.offset = i - chunk_begin;
+      output_span.length = run_length;
+
+      uint8_t* out_validity = out_data->buffers[0]->mutable_data();
+      for (int64_t j = 0; j < run_length; ++j) {
+        if (left.IsValid(j) && right.IsValid(j)) {
+          bit_util::SetBit(out_validity, output_span.offset + j);
+          --null_count;
+        }
+      }
+      ExecResult output{output_span};
+      RETURN_NOT_OK(
+          state.scalar_exec(ctx, ExecSpan({left, right}, run_length), &output));
+      i += run_length;
+    }
+    out_data->null_count = null_count;
+    out_chunks.push_back(MakeArray(std::move(out_data)));
+    chunk_begin = chunk_end;
+  }
+  out->value = std::make_shared<ChunkedArray>(std::move(out_chunks), out_type);
+  return Status::OK();
+}
+
 const FunctionDoc pairwise_diff_doc(
     "Compute first order difference of an array",
     ("Computes the first order difference of an array, It internally calls \n"
@@ -170,6 +234,7 @@ void RegisterPairwiseDiffKernels(std::string_view func_name,
     kernel.signature =
         KernelSignature::Make({base_func_kernel_sig->in_types()[0]}, out_type);
     kernel.exec = PairwiseExec;
+    kernel.exec_chunked = PairwiseExecChunked;
     kernel.init = [scalar_exec = base_func_kernel->exec](KernelContext* ctx,
                                                          const KernelInitArgs& args) {
       return std::make_unique<PairwiseState>(
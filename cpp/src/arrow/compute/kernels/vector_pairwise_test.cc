@@ -18,6 +18,7 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <string>
+#include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/test_util.h"
 #include "arrow/compute/registry.h"
@@ -151,6 +152,27 @@ TEST_F(TestPairwiseDiff, Numeric) {
   }
 }
 
+TEST_F(TestPairwiseDiff, ChunkedArray) {
+  for (auto input_type : test_numerical_types_) {
+    ARROW_SCOPED_TRACE(*input_type);
+    auto input = ChunkedArrayFromJSON(
+        input_type, {"[1, 2]", "[]", "[4, null, 10]", "[6]", "[7, 20, 3, 5]"});
+    auto flat_input = ArrayFromJSON(input_type, "[1, 2, 4, null, 10, 6, 7, 20, 3, 5]");
+    for (int64_t periods : {-11, -10, -4, -1, 0, 1, 2, 3, 10, 11}) {
+      ARROW_SCOPED_TRACE("periods = ", periods);
+      PairwiseOptions options(periods);
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           CallFunction("pairwise_diff", {flat_input}, &options));
+      ASSERT_OK_AND_ASSIGN(Datum actual,
+                           CallFunction("pairwise_diff", {input}, &options));
+      ASSERT_TRUE(actual.is_chunked_array());
+      ValidateOutput(actual);
+      AssertDatumsEqual(std::make_shared<ChunkedArray>(expected.make_array()), actual,
+                        /*verbose=*/true);
+    }
+  }
+}
+
 TEST_F(TestPairwiseDiff, Overflow) {
   {
     PairwiseOptions options(1);
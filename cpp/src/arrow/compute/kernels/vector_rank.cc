@@ -18,6 +18,8 @@
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow::compute::internal {
 
@@ -38,9 +40,38 @@ Result<Datum> CreateRankings(ExecContext* ctx, const NullPartitionResult& sorted
   auto out_begin = rankings->GetMutableValues<uint64_t>(1);
   uint64_t rank;
 
+  // The sorted non-null values are ranked by ranges, in parallel if large enough.
+  // A range may start or end in the middle of a run of equal values, whose bounds
+  // are found beforehand.
+  const int64_t non_null_count = sorted.non_null_count();
+  const int num_tasks = static_cast<int>(std::max<int64_t>(
+      1, std::min<int64_t>(GetSortParallelism(ctx),
+                           non_null_count / kMinParallelSortTaskLength)));
+  const int64_t task_length = bit_util::CeilDiv(non_null_count, num_tasks);
+  auto task_begin = [&](int task) {
+    return sorted.non_nulls_begin + std::min(non_null_count, task * task_length);
+  };
+  auto run_tasks = [&](auto&& task) -> Status {
+    if (num_tasks == 1) {
+      return task(0);
+    }
+    return ::arrow::internal::ParallelFor(num_tasks, task, ctx->executor());
+  };
+  auto position = [&](const uint64_t* it) -> int64_t {
+    return it - sorted.overall_begin();
+  };
+  // Whether the sorted non-null value at `it` starts (resp. ends) a run
+  auto starts_run = [&](const uint64_t* it) {
+    return it == sorted.non_nulls_begin ||
+           value_selector(*it) != value_selector(*(it - 1));
+  };
+  auto ends_run = [&](const uint64_t* it) {
+    return it == sorted.non_nulls_end - 1 ||
+           value_selector(*it) != value_selector(*(it + 1));
+  };
+
   switch (tiebreaker) {
     case RankOptions::Dense: {
-      T curr_value, prev_value{};
       rank = 0;
 
       if (null_placement == NullPlacement::AtStart && sorted.null_count() > 0) {
@@ -50,15 +81,38 @@ Result<Datum> CreateRankings(ExecContext* ctx, const NullPartitionResult& sorted
         }
       }
 
-      for (auto it = sorted.non_nulls_begin; it < sorted.non_nulls_end; it++) {
-        curr_value = value_selector(*it);
-        if (it == sorted.non_nulls_begin || curr_value != prev_value) {
-          rank++;
+      // The rank before each range, from the number of runs started before it
+      std::vector<uint64_t> base_ranks(num_tasks, rank);
+      if (num_tasks > 1) {
+        std::vector<uint64_t> num_runs(num_tasks, 0);
+        RETURN_NOT_OK(run_tasks([&](int task) {
+          for (auto it = task_begin(task); it < task_begin(task + 1); it++) {
+            num_runs[task] += starts_run(it);
+          }
+          return Status::OK();
+        }));
+        for (int task = 1; task < num_tasks; ++task) {
+          base_ranks[task] = base_ranks[task - 1] + num_runs[task - 1];
         }
-
-        out_begin[*it] = rank;
-        prev_value = curr_value;
       }
+      std::vector<uint64_t> last_ranks(num_tasks);
+      RETURN_NOT_OK(run_tasks([&](int task) {
+        T curr_value, prev_value{};
+        uint64_t task_rank = base_ranks[task];
+        const auto begin = task_begin(task);
+        for (auto it = begin; it < task_begin(task + 1); it++) {
+          curr_value = value_selector(*it);
+          if (it == begin ? starts_run(it) : curr_value != prev_value) {
+            task_rank++;
+          }
+
+          out_begin[*it] = task_rank;
+          prev_value = curr_value;
+        }
+        last_ranks[task] = task_rank;
+        return Status::OK();
+      }));
+      rank = last_ranks.back();
 
       if (null_placement == NullPlacement::AtEnd) {
         rank++;
@@ -78,7 +132,6 @@ Result<Datum> CreateRankings(ExecContext* ctx, const NullPartitionResult& sorted
     }
 
     case RankOptions::Min: {
-      T curr_value, prev_value{};
       rank = 0;
 
       if (null_placement == NullPlacement::AtStart) {
@@ -88,14 +141,39 @@ Result<Datum> CreateRankings(ExecContext* ctx, const NullPartitionResult& sorted
         }
       }
 
-      for (auto it = sorted.non_nulls_begin; it < sorted.non_nulls_end; it++) {
-        curr_value = value_selector(*it);
-        if (it == sorted.non_nulls_begin || curr_value != prev_value) {
-          rank = (it - sorted.overall_begin()) + 1;
+      // The position where the run continuing at the start of each range starts
+      std::vector<int64_t> run_begins(num_tasks, position(sorted.non_nulls_begin));
+      if (num_tasks > 1) {
+        // The start of the last run starting in each range, if any
+        std::vector<int64_t> last_run_begins(num_tasks, -1);
+        RETURN_NOT_OK(run_tasks([&](int task) {
+          for (auto it = task_begin(task + 1); it > task_begin(task); it--) {
+            if (starts_run(it - 1)) {
+              last_run_begins[task] = position(it - 1);
+              break;
+            }
+          }
+          return Status::OK();
+        }));
+        for (int task = 1; task < num_tasks; ++task) {
+          run_begins[task] = last_run_begins[task - 1] >= 0 ? last_run_begins[task - 1]
+                                                            : run_begins[task - 1];
         }
-        out_begin[*it] = rank;
-        prev_value = curr_value;
       }
+      RETURN_NOT_OK(run_tasks([&](int task) {
+        T curr_value, prev_value{};
+        uint64_t task_rank = run_begins[task] + 1;
+        const auto begin = task_begin(task);
+        for (auto it = begin; it < task_begin(task + 1); it++) {
+          curr_value = value_selector(*it);
+          if (it == begin ? starts_run(it) : curr_value != prev_value) {
+            task_rank = position(it) + 1;
+          }
+          out_begin[*it] = task_rank;
+          prev_value = curr_value;
+        }
+        return Status::OK();
+      }));
 
       if (null_placement == NullPlacement::AtEnd) {
         rank = sorted.non_null_count() + 1;
@@ -108,7 +186,6 @@ Result<Datum> CreateRankings(ExecContext* ctx, const NullPartitionResult& sorted
 
     case RankOptions::Max: {
       // The algorithm for Max is just like Min, but in reverse order.
-      T curr_value, prev_value{};
       rank = length;
 
       if (null_placement == NullPlacement::AtEnd) {
@@ -117,15 +194,42 @@ Result<Datum> CreateRankings(ExecContext* ctx, const NullPartitionResult& sorted
         }
       }
 
-      for (auto it = sorted.non_nulls_end - 1; it >= sorted.non_nulls_begin; it--) {
-        curr_value = value_selector(*it);
-
-        if (it == sorted.non_nulls_end - 1 || curr_value != prev_value) {
-          rank = (it - sorted.overall_begin()) + 1;
+      // The position where the run continuing at the end of each range ends
+      std::vector<int64_t> run_ends(num_tasks, position(sorted.non_nulls_end) - 1);
+      if (num_tasks > 1) {
+        // The end of the first run ending in each range, if any
+        std::vector<int64_t> first_run_ends(num_tasks, -1);
+        RETURN_NOT_OK(run_tasks([&](int task) {
+          for (auto it = task_begin(task); it < task_begin(task + 1); it++) {
+            if (ends_run(it)) {
+              first_run_ends[task] = position(it);
+              break;
+            }
+          }
+          return Status::OK();
+        }));
+        for (int task = num_tasks - 2; task >= 0; --task) {
+          run_ends[task] = first_run_ends[task + 1] >= 0 ? first_run_ends[task + 1]
+                                                         : run_ends[task + 1];
         }
-        out_begin[*it] = rank;
-        prev_value = curr_value;
       }
+      RETURN_NOT_OK(run_tasks([&](int task) {
+        T curr_value, prev_value{};
+        uint64_t task_rank = run_ends[task] + 1;
+        const auto begin = task_begin(task);
+        const auto end = task_begin(task + 1);
+        for (auto it = end; it > begin;) {
+          --it;
+          curr_value = value_selector(*it);
+
+          if (it == end - 1 ? ends_run(it) : curr_value != prev_value) {
+            task_rank = position(it) + 1;
+          }
+          out_begin[*it] = task_rank;
+          prev_value = curr_value;
+        }
+        return Status::OK();
+      }));
 
       if (null_placement == NullPlacement::AtStart) {
         rank = sorted.null_count();
@@ -15,11 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <queue>
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -72,6 +74,24 @@ class SelectKComparator<SortOrder::Descending> {
   }
 };
 
+// Whether to select the first values of `num_ranges` ranges of `length` values in
+// parallel, before selecting among them
+bool SelectInParallel(ExecContext* ctx, int64_t num_ranges, int64_t length) {
+  return num_ranges > 1 && GetSortParallelism(ctx) > 1 &&
+         length >= kMinParallelSortTaskLength;
+}
+
+// Keep the first `k` of `candidates` according to `cmp`, in order
+template <typename T, typename Compare>
+void SelectFirstK(std::vector<T>* candidates, int64_t k, Compare&& cmp) {
+  if (static_cast<int64_t>(candidates->size()) > k) {
+    std::nth_element(candidates->begin(), candidates->begin() + k, candidates->end(),
+                     cmp);
+    candidates->resize(static_cast<size_t>(k));
+  }
+  std::sort(candidates->begin(), candidates->end(), cmp);
+}
+
 class ArraySelector : public TypeVisitor {
  public:
   ArraySelector(ExecContext* ctx, const Array& array, const SelectKOptions& options,
@@ -203,6 +223,9 @@ class ChunkedArraySelector : public TypeVisitor {
     if (k_ > chunked_array_.length()) {
       k_ = chunked_array_.length();
     }
+    if (SelectInParallel(ctx_, num_chunks, chunked_array_.length())) {
+      return SelectKthParallel<InType, sort_order>();
+    }
     std::function<bool(const HeapItem&, const HeapItem&)> cmp;
     SelectKComparator<sort_order> comparator;
 
@@ -264,6 +287,74 @@ class ChunkedArraySelector : public TypeVisitor {
     return Status::OK();
   }
 
+  // Select the first k values of every chunk in parallel, then the first k of those
+  template <typename InType, SortOrder sort_order>
+  Status SelectKthParallel() {
+    using GetView = GetViewType<InType>;
+    using ArrayType = typename TypeTraits<InType>::ArrayType;
+    using HeapItem = TypedHeapItem<ArrayType>;
+
+    std::vector<std::shared_ptr<ArrayType>> chunks;
+    std::vector<uint64_t> offsets;
+    uint64_t offset = 0;
+    for (const auto& chunk : physical_chunks_) {
+      if (chunk->length() > 0) {
+        chunks.push_back(std::make_shared<ArrayType>(chunk->data()));
+        offsets.push_back(offset);
+      }
+      offset += chunk->length();
+    }
+
+    SelectKComparator<sort_order> comparator;
+    std::vector<std::vector<HeapItem>> chunk_candidates(chunks.size());
+    auto select_chunk = [&](int i) -> Status {
+      ArrayType* arr = chunks[i].get();
+      std::vector<uint64_t> indices(arr->length());
+      uint64_t* indices_begin = indices.data();
+      uint64_t* indices_end = indices_begin + indices.size();
+      std::iota(indices_begin, indices_end, 0);
+
+      const auto p = PartitionNulls<ArrayType, NonStablePartitioner>(
+          indices_begin, indices_end, *arr, 0, NullPlacement::AtEnd);
+      const auto end_iter = p.non_nulls_end;
+      auto kth_begin = std::min(indices_begin + k_, end_iter);
+      std::nth_element(indices_begin, kth_begin, end_iter,
+                       [&](uint64_t left, uint64_t right) {
+                         const auto lval = GetView::LogicalValue(arr->GetView(left));
+                         const auto rval = GetView::LogicalValue(arr->GetView(right));
+                         return comparator(lval, rval);
+                       });
+      auto& candidates = chunk_candidates[i];
+      candidates.reserve(kth_begin - indices_begin);
+      for (auto iter = indices_begin; iter != kth_begin; ++iter) {
+        candidates.push_back(HeapItem{*iter, offsets[i], arr});
+      }
+      return Status::OK();
+    };
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(static_cast<int>(chunks.size()),
+                                                 select_chunk, ctx_->executor()));
+
+    std::vector<HeapItem> candidates;
+    for (auto& items : chunk_candidates) {
+      candidates.insert(candidates.end(), items.begin(), items.end());
+    }
+    SelectFirstK(&candidates, k_, [&](const HeapItem& left, const HeapItem& right) {
+      const auto lval = GetView::LogicalValue(left.array->GetView(left.index));
+      const auto rval = GetView::LogicalValue(right.array->GetView(right.index));
+      return comparator(lval, rval);
+    });
+
+    auto out_size = static_cast<int64_t>(candidates.size());
+    ARROW_ASSIGN_OR_RAISE(auto take_indices,
+                          MakeMutableUInt64Array(out_size, ctx_->memory_pool()));
+    auto* out_values = take_indices->GetMutableValues<uint64_t>(1);
+    for (const auto& item : candidates) {
+      *out_values++ = item.index + item.offset;
+    }
+    *output_ = Datum(take_indices);
+    return Status::OK();
+  }
+
   const ChunkedArray& chunked_array_;
   const std::shared_ptr<DataType> physical_type_;
   const ArrayVector physical_chunks_;
@@ -502,6 +593,11 @@ class TableSelector : public TypeVisitor {
     if (k_ > table_.num_rows()) {
       k_ = table_.num_rows();
     }
+    const int64_t num_ranges = std::min<int64_t>(GetSortParallelism(ctx_),
+                                                 num_rows / kMinParallelSortTaskLength);
+    if (SelectInParallel(ctx_, num_ranges, num_rows)) {
+      return SelectKthParallel<InType, sort_order>(static_cast<int>(num_ranges));
+    }
     std::function<bool(const uint64_t&, const uint64_t&)> cmp;
     SelectKComparator<sort_order> select_k_comparator;
     cmp = [&](const uint64_t& left, const uint64_t& right) -> bool {
@@ -549,6 +645,62 @@ class TableSelector : public TypeVisitor {
     return Status::OK();
   }
 
+  // Select the first k rows of `num_ranges` ranges of rows in parallel, then the
+  // first k of those
+  template <typename InType, SortOrder sort_order>
+  Status SelectKthParallel(int num_ranges) {
+    using ArrayType = typename TypeTraits<InType>::ArrayType;
+    auto& comparator = comparator_;
+    const auto& first_sort_key = sort_keys_[0];
+
+    SelectKComparator<sort_order> select_k_comparator;
+    auto cmp = [&](uint64_t left, uint64_t right) -> bool {
+      const auto value_left = first_sort_key.GetChunk(left).template Value<InType>();
+      const auto value_right = first_sort_key.GetChunk(right).template Value<InType>();
+      if (value_left == value_right) {
+        return comparator.Compare(left, right, 1);
+      }
+      return select_k_comparator(value_left, value_right);
+    };
+
+    const int64_t num_rows = table_.num_rows();
+    std::vector<uint64_t> indices(num_rows);
+    std::iota(indices.begin(), indices.end(), 0);
+    const int64_t range_length = bit_util::CeilDiv(num_rows, num_ranges);
+    // The selected rows of each range are moved to its start
+    std::vector<int64_t> num_selected(num_ranges);
+    auto select_range = [&](int i) -> Status {
+      const int64_t begin = std::min(num_rows, i * range_length);
+      uint64_t* indices_begin = indices.data() + begin;
+      uint64_t* indices_end = indices.data() + std::min(num_rows, begin + range_length);
+      const auto p = PartitionNulls<ArrayType, NonStablePartitioner>(
+          indices_begin, indices_end, first_sort_key.resolver,
+          first_sort_key.null_count, NullPlacement::AtEnd);
+      const auto end_iter = p.non_nulls_end;
+      auto kth_begin = std::min(indices_begin + k_, end_iter);
+      std::nth_element(indices_begin, kth_begin, end_iter, cmp);
+      num_selected[i] = kth_begin - indices_begin;
+      return Status::OK();
+    };
+    RETURN_NOT_OK(
+        ::arrow::internal::ParallelFor(num_ranges, select_range, ctx_->executor()));
+
+    std::vector<uint64_t> candidates;
+    for (int i = 0; i < num_ranges; ++i) {
+      const auto range_begin = indices.begin() + std::min(num_rows, i * range_length);
+      candidates.insert(candidates.end(), range_begin, range_begin + num_selected[i]);
+    }
+    SelectFirstK(&candidates, k_, cmp);
+
+    auto out_size = static_cast<int64_t>(candidates.size());
+    ARROW_ASSIGN_OR_RAISE(auto take_indices,
+                          MakeMutableUInt64Array(out_size, ctx_->memory_pool()));
+    std::copy(candidates.begin(), candidates.end(),
+              take_indices->GetMutableValues<uint64_t>(1));
+    *output_ = Datum(take_indices);
+    return Status::OK();
+  }
+
   Status status_;
   ExecContext* ctx_;
   const Table& table_;
@@ -229,6 +229,35 @@ const FunctionDoc indices_nonzero_doc(
      "of the value in the array if it's none of the those."),
     {"values"});
 
+const FunctionDoc compact_views_doc(
+    "Copy the out-of-line values of binary or string views to new buffers",
+    ("The views of the output reference new data buffers holding only the\n"
+     "out-of-line values of the non-null input views, so that the output\n"
+     "doesn't keep the unused bytes of the input data buffers alive."),
+    {"values"});
+
+Status CompactViewsExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  ARROW_ASSIGN_OR_RAISE(auto compacted,
+                        checked_cast<const BinaryViewArray&>(*batch[0].array.ToArray())
+                            .CompactDataBuffers(/*threshold=*/1.0, ctx->memory_pool()));
+  out->value = compacted->data();
+  return Status::OK();
+}
+
+std::shared_ptr<VectorFunction> MakeCompactViewsFunction() {
+  auto func = std::make_shared<VectorFunction>("compact_views", Arity::Unary(),
+                                               compact_views_doc);
+  VectorKernel kernel;
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  kernel.exec = CompactViewsExec;
+  for (const auto id : {Type::BINARY_VIEW, Type::STRING_VIEW}) {
+    kernel.signature = KernelSignature::Make({InputType(id)}, FirstType);
+    DCHECK_OK(func->AddKernel(kernel));
+  }
+  return func;
+}
+
 struct NonZeroVisitor {
   UInt64Builder* builder;
   const std::vector<ArraySpan>& arrays;
@@ -354,6 +383,8 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
 
   DCHECK_OK(registry->AddFunction(
       MakeIndicesNonZeroFunction("indices_nonzero", indices_nonzero_doc)));
+
+  DCHECK_OK(registry->AddFunction(MakeCompactViewsFunction()));
 }
 
 }  // namespace internal
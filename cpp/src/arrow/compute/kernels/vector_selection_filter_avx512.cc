@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/compute/kernels/vector_selection_filter_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+namespace {
+
+// Up to 64 bits of a bitmap starting at any bit offset, without reading past the
+// byte holding the last of them
+uint64_t LoadBits(const uint8_t* bitmap, int64_t offset, int64_t num_bits) {
+  const uint8_t* bytes = bitmap + offset / 8;
+  const int shift = static_cast<int>(offset % 8);
+  const int64_t num_bytes = bit_util::BytesForBits(shift + num_bits);
+  uint64_t word = 0;
+  memcpy(&word, bytes, std::min<int64_t>(num_bytes, 8));
+  word >>= shift;
+  if (num_bytes > 8) {
+    word |= static_cast<uint64_t>(bytes[8]) << (64 - shift);
+  }
+  if (num_bits < 64) {
+    word &= (uint64_t{1} << num_bits) - 1;
+  }
+  return word;
+}
+
+// Writes a bitmap from its start, a word at a time
+class BitmapAppender {
+ public:
+  explicit BitmapAppender(uint8_t* bitmap) : bitmap_(bitmap) {}
+
+  void Append(uint64_t bits, int num_bits) {
+    if (num_bits == 0) return;
+    pending_ |= bits << num_pending_;
+    if (num_pending_ + num_bits < 64) {
+      num_pending_ += num_bits;
+      return;
+    }
+    memcpy(bitmap_, &pending_, sizeof(pending_));
+    bitmap_ += sizeof(pending_);
+    pending_ = num_pending_ == 0 ? 0 : bits >> (64 - num_pending_);
+    num_pending_ += num_bits - 64;
+  }
+
+  void Finish() {
+    memcpy(bitmap_, &pending_, bit_util::BytesForBits(num_pending_));
+  }
+
+ private:
+  uint8_t* bitmap_;
+  uint64_t pending_ = 0;
+  int num_pending_ = 0;
+};
+
+// Writes the values of (up to) 64 consecutive rows selected by `selection`, and returns
+// the position after the last one.  Only the selected values are loaded, so that no
+// value past the end of the input is read.
+template <typename CType>
+CType* CompressValues(const CType* in, uint64_t selection, CType* out) {
+  if (selection == ~uint64_t{0}) {
+    memcpy(out, in, 64 * sizeof(CType));
+    return out + 64;
+  }
+  if constexpr (sizeof(CType) == 8) {
+    for (int i = 0; i < 64; i += 8) {
+      const auto mask = static_cast<__mmask8>(selection >> i);
+      if (mask == 0) continue;
+      __m512i selected = _mm512_maskz_compress_epi64(
+          mask, _mm512_maskz_loadu_epi64(mask, in + i));
+      const int count = _mm_popcnt_u32(mask);
+      _mm512_mask_storeu_epi64(out, static_cast<__mmask8>((1U << count) - 1), selected);
+      out += count;
+    }
+  } else {
+    // vpcompressb/w need VBMI2, so 8 and 16-bit values are compressed as 32-bit lanes
+    for (int i = 0; i < 64; i += 16) {
+      const auto mask = static_cast<__mmask16>(selection >> i);
+      if (mask == 0) continue;
+      const int count = _mm_popcnt_u32(mask);
+      const auto out_mask = static_cast<__mmask16>((1U << count) - 1);
+      if constexpr (sizeof(CType) == 4) {
+        __m512i selected = _mm512_maskz_compress_epi32(
+            mask, _mm512_maskz_loadu_epi32(mask, in + i));
+        _mm512_mask_storeu_epi32(out, out_mask, selected);
+      } else if constexpr (sizeof(CType) == 2) {
+        __m512i selected = _mm512_maskz_compress_epi32(
+            mask, _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(mask, in + i)));
+        _mm256_mask_storeu_epi16(out, out_mask, _mm512_cvtepi32_epi16(selected));
+      } else {
+        static_assert(sizeof(CType) == 1);
+        __m512i selected = _mm512_maskz_compress_epi32(
+            mask, _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(mask, in + i)));
+        _mm_mask_storeu_epi8(out, out_mask, _mm512_cvtepi32_epi8(selected));
+      }
+      out += count;
+    }
+  }
+  return out;
+}
+
+template <typename CType>
+void FilterValues(const ArraySpan& values, const uint8_t* filter_data,
+                  int64_t filter_offset, ArrayData* out_arr) {
+  const CType* in = values.GetValues<CType>(1);
+  auto* out = out_arr->GetMutableValues<CType>(1);
+  for (int64_t position = 0; position < values.length; position += 64) {
+    const int64_t num_rows = std::min<int64_t>(64, values.length - position);
+    out = CompressValues(in + position,
+                         LoadBits(filter_data, filter_offset + position, num_rows), out);
+  }
+}
+
+// The bits of a bitmap selected by the filter
+void FilterBits(const uint8_t* bitmap, int64_t offset, int64_t length,
+                const uint8_t* filter_data, int64_t filter_offset, uint8_t* out) {
+  BitmapAppender appender(out);
+  for (int64_t position = 0; position < length; position += 64) {
+    const int64_t num_rows = std::min<int64_t>(64, length - position);
+    const uint64_t selection = LoadBits(filter_data, filter_offset + position, num_rows);
+    const uint64_t bits = bitmap == nullptr
+                              ? ~uint64_t{0}
+                              : LoadBits(bitmap, offset + position, num_rows);
+    appender.Append(_pext_u64(bits, selection),
+                    static_cast<int>(_mm_popcnt_u64(selection)));
+  }
+  appender.Finish();
+}
+
+}  // namespace
+
+void FilterFixedWidthAvx512(const ArraySpan& values, const ArraySpan& filter,
+                            ArrayData* out_arr) {
+  const uint8_t* filter_data = filter.buffers[1].data;
+  if (out_arr->buffers[0] != nullptr) {
+    FilterBits(values.buffers[0].data, values.offset, values.length, filter_data,
+               filter.offset, out_arr->buffers[0]->mutable_data());
+  }
+  switch (values.type->bit_width()) {
+    case 1:
+      FilterBits(values.buffers[1].data, values.offset, values.length, filter_data,
+                 filter.offset, out_arr->buffers[1]->mutable_data());
+      break;
+    case 8:
+      FilterValues<uint8_t>(values, filter_data, filter.offset, out_arr);
+      break;
+    case 16:
+      FilterValues<uint16_t>(values, filter_data, filter.offset, out_arr);
+      break;
+    case 32:
+      FilterValues<uint32_t>(values, filter_data, filter.offset, out_arr);
+      break;
+    case 64:
+      FilterValues<uint64_t>(values, filter_data, filter.offset, out_arr);
+      break;
+    default:
+      DCHECK(false) << "Unexpected bit width " << values.type->bit_width();
+  }
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
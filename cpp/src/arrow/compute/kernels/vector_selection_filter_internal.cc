@@ -40,6 +40,7 @@
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
+#include "arrow/util/dispatch.h"
 
 namespace arrow {
 
@@ -48,6 +49,8 @@ using internal::BitBlockCount;
 using internal::BitBlockCounter;
 using internal::CopyBitmap;
 using internal::CountSetBits;
+using internal::DispatchLevel;
+using internal::DynamicDispatch;
 using internal::OptionalBitBlockCounter;
 
 namespace compute::internal {
@@ -439,6 +442,46 @@ class PrimitiveFilterImpl {
   int64_t out_position_;
 };
 
+// Filter by a boolean filter without nulls, for which the null selection behavior
+// doesn't matter
+void FilterFixedWidthDefault(const ArraySpan& values, const ArraySpan& filter,
+                             ArrayData* out_arr) {
+  switch (values.type->bit_width()) {
+    case 1:
+      PrimitiveFilterImpl<1, /*kIsBoolean=*/true>(values, filter, FilterOptions::DROP,
+                                                  out_arr)
+          .Exec();
+      break;
+    case 8:
+      PrimitiveFilterImpl<1>(values, filter, FilterOptions::DROP, out_arr).Exec();
+      break;
+    case 16:
+      PrimitiveFilterImpl<2>(values, filter, FilterOptions::DROP, out_arr).Exec();
+      break;
+    case 32:
+      PrimitiveFilterImpl<4>(values, filter, FilterOptions::DROP, out_arr).Exec();
+      break;
+    case 64:
+      PrimitiveFilterImpl<8>(values, filter, FilterOptions::DROP, out_arr).Exec();
+      break;
+    default:
+      DCHECK(false) << "Unexpected bit width " << values.type->bit_width();
+  }
+}
+
+struct FilterFixedWidthDynamicFunction {
+  using FunctionType = decltype(&FilterFixedWidthDefault);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, FilterFixedWidthDefault}
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, FilterFixedWidthAvx512}
+#endif
+    };
+  }
+};
+
 Status PrimitiveFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   const ArraySpan& values = batch[0].array;
   const ArraySpan& filter = batch[1].array;
@@ -472,6 +515,14 @@ Status PrimitiveFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult
   RETURN_NOT_OK(PreallocatePrimitiveArrayData(ctx, output_length, bit_width,
                                               allocate_validity, out_arr));
 
+  if (!is_ree_filter && filter_null_count_is_zero &&
+      (bit_width == 1 || bit_width == 8 || bit_width == 16 || bit_width == 32 ||
+       bit_width == 64)) {
+    static DynamicDispatch<FilterFixedWidthDynamicFunction> dispatch;
+    dispatch.func(values, filter, out_arr);
+    return Status::OK();
+  }
+
   switch (bit_width) {
     case 1:
       PrimitiveFilterImpl<1, /*kIsBoolean=*/true>(values, filter, null_selection, out_arr)
@@ -505,6 +556,11 @@ Status PrimitiveFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult
   return Status::OK();
 }
 
+Status BinaryViewFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  RETURN_NOT_OK(PrimitiveFilterExec(ctx, BinaryViewsAsFixedWidth(batch), out));
+  return FinishBinaryViewSelection(ctx, batch[0].array, out);
+}
+
 // ----------------------------------------------------------------------
 // Optimized filter for base binary types (32-bit and 64-bit)
 
@@ -1075,6 +1131,8 @@ void PopulateFilterKernels(std::vector<SelectionKernelData>* out) {
       {InputType(match::Primitive()), plain_filter, PrimitiveFilterExec},
       {InputType(match::BinaryLike()), plain_filter, BinaryFilterExec},
       {InputType(match::LargeBinaryLike()), plain_filter, BinaryFilterExec},
+      {InputType(Type::BINARY_VIEW), plain_filter, BinaryViewFilterExec},
+      {InputType(Type::STRING_VIEW), plain_filter, BinaryViewFilterExec},
       {InputType(null()), plain_filter, NullFilterExec},
       {InputType(Type::FIXED_SIZE_BINARY), plain_filter, PrimitiveFilterExec},
       {InputType(Type::DECIMAL128), plain_filter, PrimitiveFilterExec},
@@ -1093,6 +1151,8 @@ void PopulateFilterKernels(std::vector<SelectionKernelData>* out) {
       {InputType(match::Primitive()), ree_filter, PrimitiveFilterExec},
       {InputType(match::BinaryLike()), ree_filter, BinaryFilterExec},
       {InputType(match::LargeBinaryLike()), ree_filter, BinaryFilterExec},
+      {InputType(Type::BINARY_VIEW), ree_filter, BinaryViewFilterExec},
+      {InputType(Type::STRING_VIEW), ree_filter, BinaryViewFilterExec},
       {InputType(null()), ree_filter, NullFilterExec},
       {InputType(Type::FIXED_SIZE_BINARY), ree_filter, PrimitiveFilterExec},
       {InputType(Type::DECIMAL128), ree_filter, PrimitiveFilterExec},
@@ -34,6 +34,15 @@ std::unique_ptr<Function> MakeFilterMetaFunction();
 
 void PopulateFilterKernels(std::vector<SelectionKernelData>* out);
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+/// \brief Filter 1, 8, 16, 32 or 64-bit values by a boolean filter without nulls
+///
+/// The output buffers must be preallocated, including the validity bitmap when the
+/// values have one.
+void FilterFixedWidthAvx512(const ArraySpan& values, const ArraySpan& filter,
+                            ArrayData* out_arr);
+#endif
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
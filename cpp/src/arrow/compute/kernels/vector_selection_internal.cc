@@ -24,6 +24,7 @@
 #include "arrow/array/array_binary.h"
 #include "arrow/array/array_nested.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
@@ -900,6 +901,37 @@ Status FilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
 
 }  // namespace
 
+namespace {
+
+// Filters and takes only referencing less than this fraction of the data buffers of
+// binary views compact them
+constexpr double kBinaryViewCompactionThreshold = 0.5;
+
+}  // namespace
+
+ExecSpan BinaryViewsAsFixedWidth(const ExecSpan& batch) {
+  static const std::shared_ptr<DataType> kViewType =
+      fixed_size_binary(BinaryViewType::kSize);
+  ExecSpan views_batch = batch;
+  views_batch.values[0].array.type = kViewType.get();
+  return views_batch;
+}
+
+Status FinishBinaryViewSelection(KernelContext* ctx, const ArraySpan& values,
+                                 ExecResult* out) {
+  std::shared_ptr<ArrayData> out_data = out->array_data();
+  const auto data_buffers = values.GetVariadicBuffers();
+  out_data->buffers.resize(2);
+  out_data->buffers.insert(out_data->buffers.end(), data_buffers.begin(),
+                           data_buffers.end());
+  ARROW_ASSIGN_OR_RAISE(
+      auto compacted,
+      checked_cast<const BinaryViewArray&>(*MakeArray(std::move(out_data)))
+          .CompactDataBuffers(kBinaryViewCompactionThreshold, ctx->memory_pool()));
+  out->value = compacted->data();
+  return Status::OK();
+}
+
 Status ListFilterExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   return FilterExec<ListSelectionImpl<ListType>>(ctx, batch, out);
 }
@@ -942,6 +974,11 @@ Status LargeVarBinaryTakeExec(KernelContext* ctx, const ExecSpan& batch,
   return TakeExec<VarBinarySelectionImpl<LargeBinaryType>>(ctx, batch, out);
 }
 
+Status BinaryViewTakeExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
+  RETURN_NOT_OK(PrimitiveTakeExec(ctx, BinaryViewsAsFixedWidth(batch), out));
+  return FinishBinaryViewSelection(ctx, batch[0].array, out);
+}
+
 Status FSBTakeExec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
   const ArraySpan& values = batch[0].array;
   const auto byte_width = values.type->byte_width();
@@ -70,6 +70,19 @@ void VisitPlainxREEFilterOutputSegments(
     FilterOptions::NullSelectionBehavior null_selection,
     const EmitREEFilterSegment& emit_segment);
 
+/// \brief Replace the type of the values of a binary view take or filter with a
+/// fixed-size binary type, to select their views with the fixed-width kernels
+ExecSpan BinaryViewsAsFixedWidth(const ExecSpan& batch);
+
+/// \brief Finish the output of a binary view take or filter whose views were
+/// selected by a fixed-width kernel
+///
+/// The views keep referencing the data buffers of `values`, which are compacted
+/// when the output only references a small part of them, so that selections don't
+/// keep large unused buffers alive.
+Status FinishBinaryViewSelection(KernelContext* ctx, const ArraySpan& values,
+                                 ExecResult* out);
+
 Status ListFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status LargeListFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status FSLFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
@@ -79,6 +92,7 @@ Status MapFilterExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status VarBinaryTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status LargeVarBinaryTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status PrimitiveTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
+Status BinaryViewTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status FSBTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status ListTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
 Status LargeListTakeExec(KernelContext*, const ExecSpan&, ExecResult*);
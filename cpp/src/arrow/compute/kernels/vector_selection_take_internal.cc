@@ -24,6 +24,7 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/chunk_resolver.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/codegen_internal.h"
@@ -46,6 +47,8 @@ using internal::BinaryBitBlockCounter;
 using internal::BitBlockCount;
 using internal::BitBlockCounter;
 using internal::CheckIndexBounds;
+using internal::ChunkLocation;
+using internal::ChunkResolver;
 using internal::OptionalBitBlockCounter;
 
 namespace compute {
@@ -689,6 +692,155 @@ Result<std::shared_ptr<ArrayData>> TakeAAA(const std::shared_ptr<ArrayData>& val
   return result.array();
 }
 
+// Whether TakeFromChunks() can gather `values` without concatenating them first
+bool CanTakeFromChunks(const ChunkedArray& values, const DataType& index_type) {
+  if (values.num_chunks() <= 1 || !is_integer(index_type.id())) {
+    return false;
+  }
+  const DataType& type = *values.type();
+  switch (type.id()) {
+    case Type::FIXED_SIZE_BINARY:
+    case Type::DECIMAL128:
+    case Type::DECIMAL256:
+      return true;
+    default:
+      return is_primitive(type.id()) && type.id() != Type::BOOL;
+  }
+}
+
+// Gather the fixed-width `values` selected by `indices` directly from the chunks,
+// resolving the indices a batch at a time. A kByteWidth of 0 means the byte width
+// is only known at runtime.
+template <typename IndexCType, int kByteWidth>
+void GatherFromChunks(const ChunkedArray& values, const ChunkResolver& resolver,
+                      const ArraySpan& indices, int byte_width, uint8_t* out_is_valid,
+                      uint8_t* out_values) {
+  if constexpr (kByteWidth > 0) {
+    byte_width = kByteWidth;
+  }
+  const int num_chunks = values.num_chunks();
+  std::vector<const uint8_t*> chunk_values(num_chunks);
+  std::vector<const uint8_t*> chunk_is_valid(num_chunks);
+  std::vector<int64_t> chunk_offsets(num_chunks);
+  for (int i = 0; i < num_chunks; ++i) {
+    const ArrayData& chunk = *values.chunk(i)->data();
+    // Empty chunks may lack a data buffer, but nothing is read from those
+    chunk_values[i] =
+        chunk.buffers[1] ? chunk.buffers[1]->data() + chunk.offset * byte_width : nullptr;
+    chunk_is_valid[i] = (chunk.buffers[0] && chunk.GetNullCount() > 0)
+                            ? chunk.buffers[0]->data()
+                            : nullptr;
+    chunk_offsets[i] = chunk.offset;
+  }
+
+  const auto* raw_indices = indices.GetValues<IndexCType>(1);
+  const uint8_t* indices_is_valid = indices.null_count != 0 ? indices.buffers[0].data
+                                                            : nullptr;
+  constexpr int64_t kBatchSize = 1024;
+  ChunkLocation locations[kBatchSize];
+  int64_t chunk_hint = 0;
+  for (int64_t batch_start = 0; batch_start < indices.length;
+       batch_start += kBatchSize) {
+    const int64_t batch_size = std::min(kBatchSize, indices.length - batch_start);
+    resolver.ResolveMany(batch_size, raw_indices + batch_start, locations, chunk_hint);
+    for (int64_t i = 0; i < batch_size; ++i) {
+      const int64_t position = batch_start + i;
+      uint8_t* out = out_values + position * byte_width;
+      // Null indices may resolve to any location, including out-of-bounds ones
+      if (indices_is_valid &&
+          !bit_util::GetBit(indices_is_valid, indices.offset + position)) {
+        bit_util::ClearBit(out_is_valid, position);
+        std::memset(out, 0, byte_width);
+        continue;
+      }
+      const ChunkLocation& location = locations[i];
+      const uint8_t* is_valid = chunk_is_valid[location.chunk_index];
+      if (out_is_valid) {
+        bit_util::SetBitTo(
+            out_is_valid, position,
+            !is_valid || bit_util::GetBit(is_valid, chunk_offsets[location.chunk_index] +
+                                                        location.index_in_chunk));
+      }
+      std::memcpy(
+          out, chunk_values[location.chunk_index] + location.index_in_chunk * byte_width,
+          byte_width);
+    }
+    chunk_hint = locations[batch_size - 1].chunk_index;
+  }
+}
+
+template <typename IndexCType>
+void GatherFromChunks(const ChunkedArray& values, const ChunkResolver& resolver,
+                      const ArraySpan& indices, int byte_width, uint8_t* out_is_valid,
+                      uint8_t* out_values) {
+  switch (byte_width) {
+    case 1:
+      return GatherFromChunks<IndexCType, 1>(values, resolver, indices, byte_width,
+                                             out_is_valid, out_values);
+    case 2:
+      return GatherFromChunks<IndexCType, 2>(values, resolver, indices, byte_width,
+                                             out_is_valid, out_values);
+    case 4:
+      return GatherFromChunks<IndexCType, 4>(values, resolver, indices, byte_width,
+                                             out_is_valid, out_values);
+    case 8:
+      return GatherFromChunks<IndexCType, 8>(values, resolver, indices, byte_width,
+                                             out_is_valid, out_values);
+    case 16:
+      return GatherFromChunks<IndexCType, 16>(values, resolver, indices, byte_width,
+                                              out_is_valid, out_values);
+    default:
+      return GatherFromChunks<IndexCType, 0>(values, resolver, indices, byte_width,
+                                             out_is_valid, out_values);
+  }
+}
+
+// Take from the chunks of fixed-width `values` without concatenating them
+// (requires CanTakeFromChunks())
+Result<std::shared_ptr<ArrayData>> TakeFromChunks(const ChunkedArray& values,
+                                                  const ChunkResolver& resolver,
+                                                  const ArrayData& indices,
+                                                  const TakeOptions& options,
+                                                  ExecContext* ctx) {
+  const ArraySpan indices_span(indices);
+  if (options.boundscheck) {
+    RETURN_NOT_OK(CheckIndexBounds(indices_span, values.length()));
+  }
+  const int64_t length = indices.length;
+  const int byte_width = values.type()->byte_width();
+  const bool may_have_nulls = values.null_count() > 0 || indices.GetNullCount() > 0;
+
+  std::shared_ptr<Buffer> is_valid;
+  if (may_have_nulls) {
+    ARROW_ASSIGN_OR_RAISE(is_valid, AllocateBitmap(length, ctx->memory_pool()));
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> out_values,
+                        AllocateBuffer(length * byte_width, ctx->memory_pool()));
+  uint8_t* out_is_valid = is_valid ? is_valid->mutable_data() : nullptr;
+  // Bounds-checked signed indices are non-negative, so they can be read as unsigned
+  switch (indices.type->byte_width()) {
+    case 1:
+      GatherFromChunks<uint8_t>(values, resolver, indices_span, byte_width, out_is_valid,
+                                out_values->mutable_data());
+      break;
+    case 2:
+      GatherFromChunks<uint16_t>(values, resolver, indices_span, byte_width,
+                                 out_is_valid, out_values->mutable_data());
+      break;
+    case 4:
+      GatherFromChunks<uint32_t>(values, resolver, indices_span, byte_width,
+                                 out_is_valid, out_values->mutable_data());
+      break;
+    default:
+      GatherFromChunks<uint64_t>(values, resolver, indices_span, byte_width,
+                                 out_is_valid, out_values->mutable_data());
+      break;
+  }
+  return ArrayData::Make(values.type(), length,
+                         {std::move(is_valid), std::move(out_values)},
+                         may_have_nulls ? kUnknownNullCount : 0);
+}
+
 Result<std::shared_ptr<ChunkedArray>> TakeCAC(const ChunkedArray& values,
                                               const Array& indices,
                                               const TakeOptions& options,
@@ -704,7 +856,17 @@ Result<std::shared_ptr<ChunkedArray>> TakeCAC(const ChunkedArray& values,
     // TODO Case 3: If indices are sorted, can slice them and call Array Take
     // (these are relevant to TakeCCC as well)
 
-    // Case 4: Else, concatenate chunks and call Array Take
+    // Case 4: Fixed-width values can be gathered from the chunks directly
+    if (CanTakeFromChunks(values, *indices.type())) {
+      ChunkResolver resolver(values.chunks());
+      ARROW_ASSIGN_OR_RAISE(
+          std::shared_ptr<ArrayData> new_chunk,
+          TakeFromChunks(values, resolver, *indices.data(), options, ctx));
+      std::vector<std::shared_ptr<Array>> chunks = {MakeArray(std::move(new_chunk))};
+      return std::make_shared<ChunkedArray>(std::move(chunks), values.type());
+    }
+
+    // Case 5: Else, concatenate chunks and call Array Take
     if (values.chunks().empty()) {
       ARROW_ASSIGN_OR_RAISE(
           values_array, MakeArrayOfNull(values.type(), /*length=*/0, ctx->memory_pool()));
@@ -724,9 +886,21 @@ Result<std::shared_ptr<ChunkedArray>> TakeCCC(const ChunkedArray& values,
                                               const ChunkedArray& indices,
                                               const TakeOptions& options,
                                               ExecContext* ctx) {
-  // XXX: for every chunk in indices, values are gathered from all chunks in values to
-  // form a new chunk in the result. Performing this concatenation is not ideal, but
-  // greatly simplifies the implementation before something more efficient is
+  // For every chunk in indices, values are gathered from all chunks in values to
+  // form a new chunk in the result.
+  if (CanTakeFromChunks(values, *indices.type())) {
+    ChunkResolver resolver(values.chunks());
+    std::vector<std::shared_ptr<Array>> new_chunks(indices.num_chunks());
+    for (int i = 0; i < indices.num_chunks(); i++) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto chunk,
+          TakeFromChunks(values, resolver, *indices.chunk(i)->data(), options, ctx));
+      new_chunks[i] = MakeArray(std::move(chunk));
+    }
+    return std::make_shared<ChunkedArray>(std::move(new_chunks), values.type());
+  }
+  // XXX: for other types, the chunks of values are concatenated. This is not ideal,
+  // but greatly simplifies the implementation before something more efficient is
   // implemented.
   std::shared_ptr<Array> values_array;
   if (values.num_chunks() == 1) {
@@ -880,6 +1054,8 @@ void PopulateTakeKernels(std::vector<SelectionKernelData>* out) {
       {InputType(match::Primitive()), take_indices, PrimitiveTakeExec},
       {InputType(match::BinaryLike()), take_indices, VarBinaryTakeExec},
       {InputType(match::LargeBinaryLike()), take_indices, LargeVarBinaryTakeExec},
+      {InputType(Type::BINARY_VIEW), take_indices, BinaryViewTakeExec},
+      {InputType(Type::STRING_VIEW), take_indices, BinaryViewTakeExec},
       {InputType(Type::FIXED_SIZE_BINARY), take_indices, FSBTakeExec},
       {InputType(null()), take_indices, NullTakeExec},
       {InputType(Type::DECIMAL128), take_indices, PrimitiveTakeExec},
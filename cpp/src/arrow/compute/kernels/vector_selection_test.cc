@@ -677,6 +677,17 @@ TYPED_TEST(TestFilterKernelWithString, FilterDictionary) {
   this->AssertFilterDictionary(dict, "[3, 4, 2]", "[null, 1, 0]", "[null, 4]");
 }
 
+TEST_F(TestFilterKernel, FilterBinaryView) {
+  for (auto type : {utf8_view(), binary_view()}) {
+    ARROW_SCOPED_TRACE("type = ", *type);
+    AssertFilter(type, R"(["a", "b", "c"])", "[0, 1, 0]", R"(["b"])");
+    AssertFilter(type, R"([null, "b", "c"])", "[0, 1, 0]", R"(["b"])");
+    AssertFilter(type, R"(["a", "b", "c"])", "[null, 1, 0]", R"([null, "b"])");
+    AssertFilter(type, R"(["not inlined at all", "inlined", "neither is this one"])",
+                 "[1, 0, 1]", R"(["not inlined at all", "neither is this one"])");
+  }
+}
+
 class TestFilterKernelWithList : public TestFilterKernel {
  public:
 };
@@ -1346,6 +1357,27 @@ TYPED_TEST(TestTakeKernelWithString, TakeDictionary) {
   this->AssertTakeDictionary(dict, "[3, 4, 2]", "[null, 1, 0]", "[null, 4, 3]");
 }
 
+TEST_F(TestTakeKernel, TakeBinaryView) {
+  for (auto type : {utf8_view(), binary_view()}) {
+    ARROW_SCOPED_TRACE("type = ", *type);
+    CheckTake(type, R"(["a", "b", "c"])", "[0, 1, 0]", R"(["a", "b", "a"])");
+    CheckTake(type, R"([null, "b", "c"])", "[0, 1, 0]", R"([null, "b", null])");
+    CheckTake(type, R"(["not inlined at all", "inlined", "neither is this one"])",
+              "[2, null, 0]", R"(["neither is this one", null, "not inlined at all"])");
+  }
+}
+
+TEST(CompactViews, Basics) {
+  auto values = ArrayFromJSON(utf8_view(), R"(["not inlined at all", "inlined", null,
+                                              "neither is this one"])");
+  ASSERT_OK_AND_ASSIGN(Datum compacted, CompactViews(values->Slice(1)));
+  ValidateOutput(compacted);
+  AssertArraysEqual(*values->Slice(1), *compacted.make_array(), /*verbose=*/true);
+  const auto& data = *compacted.array();
+  ASSERT_EQ(data.buffers.size(), 3U);
+  ASSERT_EQ(data.buffers[2]->size(), static_cast<int64_t>(strlen("neither is this one")));
+}
+
 class TestTakeKernelFSB : public TestTakeKernelTyped<FixedSizeBinaryType> {
  public:
   std::shared_ptr<DataType> value_type() { return fixed_size_binary(3); }
@@ -1809,6 +1841,50 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
   ASSERT_RAISES(IndexError, this->TakeWithChunkedArray(int8(), {"[]"}, {"[0]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeFromManyChunks) {
+  // Enough chunks to resolve indices both by linear scan and by bisection
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  for (const auto& type :
+       {int8(), int16(), float32(), int64(), fixed_size_binary(3), decimal128(10, 2)}) {
+    ARROW_SCOPED_TRACE("type = ", *type);
+    for (int num_chunks : {2, 7, 40}) {
+      ARROW_SCOPED_TRACE("num_chunks = ", num_chunks);
+      ArrayVector chunks;
+      for (int i = 0; i < num_chunks; ++i) {
+        // Include empty and sliced chunks
+        auto chunk = rand.ArrayOf(type, /*size=*/(i % 3) * 25, /*null_probability=*/0.2);
+        chunks.push_back(i % 2 ? chunk->Slice(1) : chunk);
+      }
+      auto values = std::make_shared<ChunkedArray>(chunks, type);
+      ASSERT_OK_AND_ASSIGN(auto concatenated, Concatenate(chunks));
+      auto indices = rand.Int32(/*size=*/500, /*min=*/0,
+                                /*max=*/static_cast<int32_t>(values->length() - 1),
+                                /*null_probability=*/0.1);
+      ASSERT_OK_AND_ASSIGN(Datum expected, Take(concatenated, indices));
+      // Sorted indices mostly fall in the same chunk as the previous one
+      ASSERT_OK_AND_ASSIGN(auto sort_indices, SortIndices(*indices));
+      ASSERT_OK_AND_ASSIGN(Datum sorted_indices, Take(indices, sort_indices));
+      ASSERT_OK_AND_ASSIGN(Datum sorted_expected, Take(concatenated, sorted_indices));
+
+      ASSERT_OK_AND_ASSIGN(Datum actual, Take(values, indices));
+      ValidateOutput(actual);
+      AssertChunkedEquivalent(ChunkedArray(expected.make_array()),
+                              *actual.chunked_array());
+      ASSERT_OK_AND_ASSIGN(actual, Take(values, sorted_indices));
+      ValidateOutput(actual);
+      AssertChunkedEquivalent(ChunkedArray(sorted_expected.make_array()),
+                              *actual.chunked_array());
+
+      auto chunked_indices = std::make_shared<ChunkedArray>(
+          ArrayVector{indices->Slice(0, 200), indices->Slice(200)});
+      ASSERT_OK_AND_ASSIGN(actual, Take(values, chunked_indices));
+      ValidateOutput(actual);
+      AssertChunkedEquivalent(ChunkedArray(expected.make_array()),
+                              *actual.chunked_array());
+    }
+  }
+}
+
 class TestTakeKernelWithTable : public TestTakeKernelTyped<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
@@ -1882,7 +1958,7 @@ struct FilterRandomTest {
     auto rand = random::RandomArrayGenerator(kRandomSeed);
     const int64_t length = static_cast<int64_t>(1ULL << 10);
     for (auto null_probability : {0.0, 0.01, 0.1, 0.999, 1.0}) {
-      for (auto true_probability : {0.0, 0.1, 0.999, 1.0}) {
+      for (auto true_probability : {0.0, 0.1, 0.5, 0.999, 1.0}) {
         auto values = rand.ArrayOf(type, length, null_probability);
         auto filter = rand.Boolean(length + 1, true_probability, null_probability);
         auto filter_no_nulls = rand.Boolean(length + 1, true_probability, 0.0);
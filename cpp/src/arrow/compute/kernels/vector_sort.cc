@@ -15,11 +15,16 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <limits>
+#include <optional>
 #include <unordered_set>
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -86,26 +91,43 @@ class ChunkedArraySorter : public TypeVisitor {
     const auto arrays = GetArrayPointers(physical_chunks_);
 
     // Sort each chunk independently and merge to sorted indices.
-    // This is a serial implementation.
     std::vector<NullPartitionResult> sorted(num_chunks);
 
-    // First sort all individual chunks
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    // First sort all individual chunks, in parallel if allowed
+    std::vector<int64_t> begin_offsets(num_chunks + 1, 0);
     int64_t null_count = 0;
     for (int i = 0; i < num_chunks; ++i) {
+      begin_offsets[i + 1] = begin_offsets[i] + arrays[i]->length();
+      null_count += arrays[i]->null_count();
+    }
+    DCHECK_EQ(begin_offsets[num_chunks], indices_end_ - indices_begin_);
+    auto sort_chunk = [&](const ArraySortFunc& array_sorter, int i) -> Status {
       const auto array = checked_cast<const ArrayType*>(arrays[i]);
-      end_offset += array->length();
-      null_count += array->null_count();
-      ARROW_ASSIGN_OR_RAISE(sorted[i], array_sorter_(indices_begin_ + begin_offset,
-                                                     indices_begin_ + end_offset, *array,
-                                                     begin_offset, options, ctx_));
-      begin_offset = end_offset;
+      ARROW_ASSIGN_OR_RAISE(
+          sorted[i], array_sorter(indices_begin_ + begin_offsets[i],
+                                  indices_begin_ + begin_offsets[i + 1], *array,
+                                  begin_offsets[i], options, ctx_));
+      return Status::OK();
+    };
+    if (num_chunks > 1 && GetSortParallelism(ctx_) > 1 &&
+        begin_offsets[num_chunks] >= kMinParallelSortTaskLength) {
+      // Array sorters may keep state between calls, so each task needs its own
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          num_chunks,
+          [&](int i) -> Status {
+            ARROW_ASSIGN_OR_RAISE(auto array_sorter, GetArraySorter(*physical_type_));
+            return sort_chunk(array_sorter, i);
+          },
+          ctx_->executor()));
+    } else {
+      for (int i = 0; i < num_chunks; ++i) {
+        RETURN_NOT_OK(sort_chunk(array_sorter_, i));
+      }
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
+      const ChunkedArrayResolver resolver(arrays);
       auto merge_nulls = [&](uint64_t* nulls_begin, uint64_t* nulls_middle,
                              uint64_t* nulls_end, uint64_t* temp_indices,
                              int64_t null_count) {
@@ -115,32 +137,23 @@ class ChunkedArraySorter : public TypeVisitor {
                                                 null_placement_);
         }
       };
-      auto merge_non_nulls = [&](uint64_t* range_begin, uint64_t* range_middle,
-                                 uint64_t* range_end, uint64_t* temp_indices) {
-        MergeNonNulls<ArrayType>(range_begin, range_middle, range_end, arrays,
-                                 temp_indices);
+      auto merge_non_nulls = [&](const uint64_t* left_begin, const uint64_t* left_end,
+                                 const uint64_t* right_begin, const uint64_t* right_end,
+                                 uint64_t* out) {
+        MergeNonNulls<ArrayType>(left_begin, left_end, right_begin, right_end, arrays,
+                                 out);
+      };
+      auto compare_non_nulls = [&](uint64_t left, uint64_t right) {
+        return CompareNonNulls<ArrayType>(resolver.Resolve(left),
+                                          resolver.Resolve(right));
       };
 
       MergeImpl merge_impl{null_placement_, std::move(merge_nulls),
-                           std::move(merge_non_nulls)};
-      // std::merge is only called on non-null values, so size temp indices accordingly
-      RETURN_NOT_OK(merge_impl.Init(ctx_, indices_end_ - indices_begin_ - null_count));
-
-      while (sorted.size() > 1) {
-        auto out_it = sorted.begin();
-        auto it = sorted.begin();
-        while (it < sorted.end() - 1) {
-          const auto& left = *it++;
-          const auto& right = *it++;
-          DCHECK_EQ(left.overall_end(), right.overall_begin());
-          const auto merged = merge_impl.Merge(left, right, null_count);
-          *out_it++ = merged;
-        }
-        if (it < sorted.end()) {
-          *out_it++ = *it++;
-        }
-        sorted.erase(out_it, sorted.end());
-      }
+                           std::move(merge_non_nulls), std::move(compare_non_nulls)};
+      RETURN_NOT_OK(merge_impl.Init(ctx_, indices_begin_, indices_end_));
+      ARROW_ASSIGN_OR_RAISE(auto merged,
+                            merge_impl.MergeAll(std::move(sorted), null_count));
+      sorted = {merged};
     }
 
     DCHECK_EQ(sorted.size(), 1);
@@ -154,21 +167,35 @@ class ChunkedArraySorter : public TypeVisitor {
   }
 
   template <typename ArrayType>
-  void MergeNonNulls(uint64_t* range_begin, uint64_t* range_middle, uint64_t* range_end,
-                     const std::vector<const Array*>& arrays, uint64_t* temp_indices) {
+  bool CompareNonNulls(const ResolvedChunk& left, const ResolvedChunk& right) const {
+    using ArrowType = typename ArrayType::TypeClass;
+    if (order_ == SortOrder::Ascending) {
+      return left.Value<ArrowType>() < right.Value<ArrowType>();
+    } else {
+      // We don't use 'left > right' here to reduce required
+      // operator. If we use 'right < left' here, '<' is only
+      // required.
+      return right.Value<ArrowType>() < left.Value<ArrowType>();
+    }
+  }
+
+  template <typename ArrayType>
+  void MergeNonNulls(const uint64_t* left_begin, const uint64_t* left_end,
+                     const uint64_t* right_begin, const uint64_t* right_end,
+                     const std::vector<const Array*>& arrays, uint64_t* out) const {
     using ArrowType = typename ArrayType::TypeClass;
     const ChunkedArrayResolver left_resolver(arrays);
     const ChunkedArrayResolver right_resolver(arrays);
 
     if (order_ == SortOrder::Ascending) {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
+      std::merge(left_begin, left_end, right_begin, right_end, out,
                  [&](uint64_t left, uint64_t right) {
                    const auto chunk_left = left_resolver.Resolve(left);
                    const auto chunk_right = right_resolver.Resolve(right);
                    return chunk_left.Value<ArrowType>() < chunk_right.Value<ArrowType>();
                  });
     } else {
-      std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
+      std::merge(left_begin, left_end, right_begin, right_end, out,
                  [&](uint64_t left, uint64_t right) {
                    const auto chunk_left = left_resolver.Resolve(left);
                    const auto chunk_right = right_resolver.Resolve(right);
@@ -178,8 +205,6 @@ class ChunkedArraySorter : public TypeVisitor {
                    return chunk_right.Value<ArrowType>() < chunk_left.Value<ArrowType>();
                  });
     }
-    // Copy back temp area into main buffer
-    std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
   }
 
   uint64_t* indices_begin_;
@@ -366,17 +391,20 @@ class RadixRecordBatchSorter {
  public:
   using ResolvedSortKey = ResolvedRecordBatchSortKey;
 
-  RadixRecordBatchSorter(uint64_t* indices_begin, uint64_t* indices_end,
-                         std::vector<ResolvedSortKey> sort_keys,
+  RadixRecordBatchSorter(ExecContext* ctx, uint64_t* indices_begin,
+                         uint64_t* indices_end, std::vector<ResolvedSortKey> sort_keys,
                          const SortOptions& options)
-      : sort_keys_(std::move(sort_keys)),
+      : ctx_(ctx),
+        sort_keys_(std::move(sort_keys)),
         options_(options),
         indices_begin_(indices_begin),
         indices_end_(indices_end) {}
 
-  RadixRecordBatchSorter(uint64_t* indices_begin, uint64_t* indices_end,
-                         const RecordBatch& batch, const SortOptions& options)
-      : sort_keys_(ResolveRecordBatchSortKeys(batch, options.sort_keys, &status_)),
+  RadixRecordBatchSorter(ExecContext* ctx, uint64_t* indices_begin,
+                         uint64_t* indices_end, const RecordBatch& batch,
+                         const SortOptions& options)
+      : ctx_(ctx),
+        sort_keys_(ResolveRecordBatchSortKeys(batch, options.sort_keys, &status_)),
         options_(options),
         indices_begin_(indices_begin),
         indices_end_(indices_end) {}
@@ -384,6 +412,12 @@ class RadixRecordBatchSorter {
   // Offset is for table sorting
   Result<NullPartitionResult> Sort(int64_t offset = 0) {
     ARROW_RETURN_NOT_OK(status_);
+    if (MayUseNormalizedKeys()) {
+      ARROW_ASSIGN_OR_RAISE(auto result, NormalizedKeySort(offset));
+      if (result.has_value()) {
+        return *result;
+      }
+    }
 
     // Create column sorters from right to left
     std::vector<std::unique_ptr<RecordBatchColumnSorter>> column_sorts(sort_keys_.size());
@@ -442,11 +476,136 @@ class RadixRecordBatchSorter {
     std::unique_ptr<RecordBatchColumnSorter> result;
   };
 
+  // Appends the bits of one sort key to the normalized keys of the rows: 2 bits for
+  // the rank of nulls, NaNs and values if there are any nulls or NaNs, followed by
+  // the offset of the value from the smallest (resp. largest) one.
+  struct NormalizedKeyAppender {
+    template <typename Type>
+    enable_if_t<kIsRadixSortable<Type> && !is_fixed_size_binary_type<Type>::value,
+                Status>
+    Visit(const Type&) {
+      using c_type = typename Type::c_type;
+      const Array& array = sort_key.array;
+      const c_type* values = array.data()->GetValues<c_type>(1);
+      const bool may_have_nulls = array.null_count() > 0;
+      auto is_null_like = [&](int64_t index) {
+        if constexpr (has_null_like_values<Type>::value) {
+          return std::isnan(values[index]);
+        }
+        return false;
+      };
+
+      uint64_t min = std::numeric_limits<uint64_t>::max();
+      uint64_t max = 0;
+      int64_t num_null_likes = 0;
+      for (int64_t i = 0; i < array.length(); ++i) {
+        if (may_have_nulls && array.IsNull(i)) {
+          ++num_null_likes;
+        } else if (is_null_like(i)) {
+          ++num_null_likes;
+        } else {
+          const uint64_t key = RadixSortKey(values[i]);
+          min = std::min(min, key);
+          max = std::max(max, key);
+        }
+      }
+      first_null_count = num_null_likes;
+      const int rank_bits = num_null_likes > 0 ? 2 : 0;
+      const int value_bits =
+          num_null_likes == array.length() ? 0 : bit_util::NumRequiredBits(max - min);
+      if (*total_bits + rank_bits + value_bits > 64) {
+        *fits = false;
+        return Status::OK();
+      }
+      *total_bits += rank_bits + value_bits;
+
+      const bool at_start = null_placement == NullPlacement::AtStart;
+      const uint64_t null_rank = at_start ? 0 : 2;
+      const uint64_t value_rank = (at_start && rank_bits > 0) ? 2 : 0;
+      const bool descending = sort_key.order == SortOrder::Descending;
+      const int bits = rank_bits + value_bits;
+      const int64_t length = indices_end - indices_begin;
+      for (int64_t i = 0; i < length; ++i) {
+        const int64_t index = static_cast<int64_t>(indices_begin[i]) - offset;
+        uint64_t part;
+        if (may_have_nulls && array.IsNull(index)) {
+          part = null_rank << value_bits;
+        } else if (is_null_like(index)) {
+          part = uint64_t{1} << value_bits;
+        } else {
+          const uint64_t key = RadixSortKey(values[index]);
+          part = (value_rank << value_bits) | (descending ? max - key : key - min);
+        }
+        // Shifting by 64 is undefined, but then the previous keys had no bits
+        keys[i] = bits == 64 ? part : (keys[i] << bits) | part;
+      }
+      return Status::OK();
+    }
+
+    Status Visit(const DataType& type) {
+      return Status::TypeError("Unsupported type for normalized keys: ",
+                               type.ToString());
+    }
+
+    const ResolvedSortKey& sort_key;
+    NullPlacement null_placement;
+    const uint64_t* indices_begin;
+    const uint64_t* indices_end;
+    int64_t offset;
+    uint64_t* keys;
+    int* total_bits;
+    bool* fits;
+    int64_t first_null_count = 0;
+  };
+
+  // Whether all the sort keys may be packed in a 64-bit normalized key, to be sorted
+  // with a single radix sort
+  bool MayUseNormalizedKeys() const {
+    if (indices_end_ - indices_begin_ < kMinRadixSortLength) {
+      return false;
+    }
+    return std::all_of(sort_keys_.begin(), sort_keys_.end(), [](const auto& sort_key) {
+      const Type::type id = sort_key.type->id();
+      return is_integer(id) || id == Type::FLOAT || id == Type::DOUBLE;
+    });
+  }
+
+  // Sort with normalized keys, or return std::nullopt if they are more than 64 bits
+  Result<std::optional<NullPartitionResult>> NormalizedKeySort(int64_t offset) {
+    std::vector<uint64_t> keys(indices_end_ - indices_begin_, 0);
+    int total_bits = 0;
+    bool fits = true;
+    int64_t null_count = 0;
+    for (size_t i = 0; i < sort_keys_.size() && fits; ++i) {
+      NormalizedKeyAppender appender{sort_keys_[i], options_.null_placement,
+                                     indices_begin_, indices_end_, offset,
+                                     keys.data(),    &total_bits,  &fits};
+      RETURN_NOT_OK(VisitTypeInline(*sort_keys_[i].type, &appender));
+      if (i == 0) {
+        null_count = appender.first_null_count;
+      }
+    }
+    if (!fits) {
+      return std::nullopt;
+    }
+    RETURN_NOT_OK(RadixSortIndices(indices_begin_, indices_end_, keys.data(),
+                                   static_cast<int>(bit_util::CeilDiv(total_bits, 8)),
+                                   ctx_));
+    if (options_.null_placement == NullPlacement::AtStart) {
+      return NullPartitionResult::NullsAtStart(indices_begin_, indices_end_,
+                                               indices_begin_ + null_count);
+    } else {
+      return NullPartitionResult::NullsAtEnd(indices_begin_, indices_end_,
+                                             indices_end_ - null_count);
+    }
+  }
+
   static Result<std::vector<ResolvedSortKey>> ResolveSortKeys(
       const RecordBatch& batch, const std::vector<SortKey>& sort_keys) {
     return ::arrow::compute::internal::ResolveSortKeys<ResolvedSortKey>(batch, sort_keys);
   }
 
+  ExecContext* ctx_;
   const std::vector<ResolvedSortKey> sort_keys_;
   const SortOptions& options_;
   uint64_t* indices_begin_;
@@ -654,24 +813,37 @@ class TableSorter {
     }
     std::vector<NullPartitionResult> sorted(num_batches);
 
-    // First sort all individual batches
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
-    int64_t null_count = 0;
+    // First sort all individual batches, in parallel if allowed
+    std::vector<int64_t> begin_offsets(num_batches + 1, 0);
     for (int64_t i = 0; i < num_batches; ++i) {
+      begin_offsets[i + 1] = begin_offsets[i] + batches_[i]->num_rows();
+    }
+    DCHECK_EQ(begin_offsets[num_batches], indices_end_ - indices_begin_);
+    auto sort_batch = [&](int i) -> Status {
       const auto& batch = *batches_[i];
-      end_offset += batch.num_rows();
-      RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
-                                    indices_begin_ + end_offset, batch, options_);
-      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
-      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
-      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
+      RadixRecordBatchSorter sorter(ctx_, indices_begin_ + begin_offsets[i],
+                                    indices_begin_ + begin_offsets[i + 1], batch,
+                                    options_);
+      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offsets[i]));
+      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offsets[i]);
+      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + begin_offsets[i + 1]);
       DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(), batch.num_rows());
-      begin_offset = end_offset;
+      return Status::OK();
+    };
+    if (num_batches > 1 && GetSortParallelism(ctx_) > 1 &&
+        begin_offsets[num_batches] >= kMinParallelSortTaskLength) {
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(static_cast<int>(num_batches),
+                                                   sort_batch, ctx_->executor()));
+    } else {
+      for (int64_t i = 0; i < num_batches; ++i) {
+        RETURN_NOT_OK(sort_batch(static_cast<int>(i)));
+      }
+    }
+    int64_t null_count = 0;
+    for (const auto& p : sorted) {
       // XXX this is an upper bound on the true null count
-      null_count += sorted[i].null_count();
+      null_count += p.null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -708,32 +880,23 @@ class TableSorter {
                            int64_t null_count) {
       MergeNulls<Type>(nulls_begin, nulls_middle, nulls_end, temp_indices, null_count);
     };
-    auto merge_non_nulls = [&](uint64_t* range_begin, uint64_t* range_middle,
-                               uint64_t* range_end, uint64_t* temp_indices) {
-      MergeNonNulls<Type>(range_begin, range_middle, range_end, temp_indices);
+    auto merge_non_nulls = [&](const uint64_t* left_begin, const uint64_t* left_end,
+                               const uint64_t* right_begin, const uint64_t* right_end,
+                               uint64_t* out) {
+      MergeNonNulls<Type>(left_begin, left_end, right_begin, right_end, out);
+    };
+    auto compare_non_nulls = [&](uint64_t left, uint64_t right) {
+      return CompareNonNulls<Type>(left_resolver_.Resolve(left),
+                                   right_resolver_.Resolve(right));
     };
 
     MergeImpl merge_impl(options_.null_placement, std::move(merge_nulls),
-                         std::move(merge_non_nulls));
-    RETURN_NOT_OK(merge_impl.Init(ctx_, table_.num_rows()));
-
-    while (sorted.size() > 1) {
-      auto out_it = sorted.begin();
-      auto it = sorted.begin();
-      while (it < sorted.end() - 1) {
-        const auto& left = *it++;
-        const auto& right = *it++;
-        DCHECK_EQ(left.overall_end(), right.overall_begin());
-        *out_it++ = merge_impl.Merge(left, right, null_count);
-      }
-      if (it < sorted.end()) {
-        *out_it++ = *it++;
-      }
-      sorted.erase(out_it, sorted.end());
-    }
-    DCHECK_EQ(sorted.size(), 1);
-    DCHECK_EQ(sorted[0].overall_begin(), indices_begin_);
-    DCHECK_EQ(sorted[0].overall_end(), indices_end_);
+                         std::move(merge_non_nulls), std::move(compare_non_nulls));
+    RETURN_NOT_OK(merge_impl.Init(ctx_, indices_begin_, indices_end_));
+    ARROW_ASSIGN_OR_RAISE(auto merged,
+                          merge_impl.MergeAll(std::move(sorted), null_count));
+    DCHECK_EQ(merged.overall_begin(), indices_begin_);
+    DCHECK_EQ(merged.overall_end(), indices_end_);
     return comparator_.status();
   }
 
@@ -805,51 +968,70 @@ class TableSorter {
   // Merge rows with a non-null in the first sort key
   //
   template <typename Type>
-  enable_if_t<!is_null_type<Type>::value> MergeNonNulls(uint64_t* range_begin,
-                                                        uint64_t* range_middle,
-                                                        uint64_t* range_end,
-                                                        uint64_t* temp_indices) {
-    auto& comparator = comparator_;
+  enable_if_t<!is_null_type<Type>::value, bool> CompareNonNulls(
+      const ChunkLocation& left_loc, const ChunkLocation& right_loc) {
     const auto& first_sort_key = sort_keys_[0];
+    auto chunk_left = first_sort_key.GetChunk(left_loc);
+    auto chunk_right = first_sort_key.GetChunk(right_loc);
+    DCHECK(!chunk_left.IsNull());
+    DCHECK(!chunk_right.IsNull());
+    auto value_left = chunk_left.Value<Type>();
+    auto value_right = chunk_right.Value<Type>();
+    if (value_left == value_right) {
+      // If the left value equals to the right value,
+      // we need to compare the second and following
+      // sort keys.
+      return comparator_.Compare(left_loc, right_loc, 1);
+    } else {
+      auto compared = value_left < value_right;
+      if (first_sort_key.order == SortOrder::Ascending) {
+        return compared;
+      } else {
+        return !compared;
+      }
+    }
+  }
+
+  template <typename Type>
+  enable_if_null<Type, bool> CompareNonNulls(const ChunkLocation& left_loc,
+                                             const ChunkLocation& right_loc) {
+    return comparator_.Compare(left_loc, right_loc, 1);
+  }
 
+  template <typename Type>
+  enable_if_t<!is_null_type<Type>::value> MergeNonNulls(const uint64_t* left_begin,
+                                                        const uint64_t* left_end,
+                                                        const uint64_t* right_begin,
+                                                        const uint64_t* right_end,
+                                                        uint64_t* out) {
     ChunkLocation left_loc{0, 0};
     ChunkLocation right_loc{0, 0};
-    std::merge(range_begin, range_middle, range_middle, range_end, temp_indices,
+    std::merge(left_begin, left_end, right_begin, right_end, out,
                [&](uint64_t left, uint64_t right) {
                  // Both values are never null nor NaN.
                  left_loc =
                      left_resolver_.ResolveWithChunkIndexHint(left, /*hint=*/left_loc);
                  right_loc =
                      right_resolver_.ResolveWithChunkIndexHint(right, /*hint=*/right_loc);
-                 auto chunk_left = first_sort_key.GetChunk(left_loc);
-                 auto chunk_right = first_sort_key.GetChunk(right_loc);
-                 DCHECK(!chunk_left.IsNull());
-                 DCHECK(!chunk_right.IsNull());
-                 auto value_left = chunk_left.Value<Type>();
-                 auto value_right = chunk_right.Value<Type>();
-                 if (value_left == value_right) {
-                   // If the left value equals to the right value,
-                   // we need to compare the second and following
-                   // sort keys.
-                   return comparator.Compare(left_loc, right_loc, 1);
-                 } else {
-                   auto compared = value_left < value_right;
-                   if (first_sort_key.order == SortOrder::Ascending) {
-                     return compared;
-                   } else {
-                     return !compared;
-                   }
-                 }
+                 return CompareNonNulls<Type>(left_loc, right_loc);
                });
-    // Copy back temp area into main buffer
-    std::copy(temp_indices, temp_indices + (range_end - range_begin), range_begin);
   }
 
   template <typename Type>
-  enable_if_null<Type> MergeNonNulls(uint64_t* range_begin, uint64_t* range_middle,
-                                     uint64_t* range_end, uint64_t* temp_indices) {
-    const int64_t null_count = range_end - range_begin;
-    MergeNullsOnly(range_begin, range_middle, range_end, temp_indices, null_count);
+  enable_if_null<Type> MergeNonNulls(const uint64_t* left_begin, const uint64_t* left_end,
+                                     const uint64_t* right_begin,
+                                     const uint64_t* right_end, uint64_t* out) {
+    ChunkLocation left_loc{0, 0};
+    ChunkLocation right_loc{0, 0};
+    std::merge(left_begin, left_end, right_begin, right_end, out,
+               [&](uint64_t left, uint64_t right) {
+                 // First column is always null
+                 left_loc =
+                     left_resolver_.ResolveWithChunkIndexHint(left, /*hint=*/left_loc);
+                 right_loc =
+                     right_resolver_.ResolveWithChunkIndexHint(right, /*hint=*/right_loc);
+                 return comparator_.Compare(left_loc, right_loc, 1);
+               });
   }
 
   Status status_;
@@ -1003,7 +1185,8 @@ class SortIndicesMetaFunction : public MetaFunction {
     std::iota(out_begin, out_end, 0);
 
     if (n_sort_keys <= kMaxRadixSortKeys) {
-      RadixRecordBatchSorter sorter(out_begin, out_end, std::move(sort_keys), options);
+      RadixRecordBatchSorter sorter(ctx, out_begin, out_end, std::move(sort_keys),
+                                    options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
     } else {
       MultipleKeyRecordBatchSorter sorter(out_begin, out_end, std::move(sort_keys),
@@ -1113,6 +1296,103 @@ Result<std::vector<SortField>> FindSortKeys(const Schema& schema,
   return SortFieldPopulator{}.FindSortKeys(schema, sort_keys);
 }
 
+int GetSortParallelism(ExecContext* ctx) {
+  // Sorting in parallel from a thread of the executor could deadlock it
+  ::arrow::internal::Executor* executor = ctx->executor();
+  if (ctx->use_threads() && executor != nullptr && !executor->OwnsThisThread()) {
+    return std::max(1, executor->GetCapacity());
+  }
+  return 1;
+}
+
+Status RadixSortIndices(uint64_t* indices_begin, uint64_t* indices_end, uint64_t* keys,
+                        int key_bytes, ExecContext* ctx) {
+  DCHECK_LE(key_bytes, 8);
+  constexpr int kRadix = 256;
+  const int64_t length = indices_end - indices_begin;
+  if (length < 2) {
+    return Status::OK();
+  }
+
+  ::arrow::internal::Executor* executor = ctx->executor();
+  const int num_tasks = static_cast<int>(
+      std::max<int64_t>(1, std::min<int64_t>(GetSortParallelism(ctx),
+                                             length / kMinParallelSortTaskLength)));
+  const int64_t task_length = bit_util::CeilDiv(length, num_tasks);
+  auto run_tasks = [&](auto&& task) -> Status {
+    if (num_tasks == 1) {
+      return task(0);
+    }
+    return ::arrow::internal::ParallelFor(num_tasks, task, executor);
+  };
+  auto task_range = [&](int task) {
+    const int64_t begin = std::min(length, task * task_length);
+    return std::make_pair(begin, std::min(length, begin + task_length));
+  };
+
+  // Count the occurrences of every byte value in every key byte, for each task,
+  // in a single pass over the keys
+  std::vector<int64_t> counts(static_cast<size_t>(num_tasks) * key_bytes * kRadix, 0);
+  auto task_counts = [&](int task, int byte) {
+    return counts.data() + (static_cast<int64_t>(task) * key_bytes + byte) * kRadix;
+  };
+  RETURN_NOT_OK(run_tasks([&](int task) {
+    const auto [begin, end] = task_range(task);
+    int64_t* task_byte_counts = task_counts(task, 0);
+    for (int64_t i = begin; i < end; ++i) {
+      const uint64_t key = keys[i];
+      for (int byte = 0; byte < key_bytes; ++byte) {
+        ++task_byte_counts[byte * kRadix + ((key >> (byte * 8)) & 0xff)];
+      }
+    }
+    return Status::OK();
+  }));
+
+  std::vector<uint64_t> scratch_indices(length);
+  std::vector<uint64_t> scratch_keys(length);
+  uint64_t* src_indices = indices_begin;
+  uint64_t* src_keys = keys;
+  uint64_t* dest_indices = scratch_indices.data();
+  uint64_t* dest_keys = scratch_keys.data();
+  // The position where each task scatters its next value of each byte value
+  std::vector<int64_t> positions(static_cast<size_t>(num_tasks) * kRadix);
+  for (int byte = 0; byte < key_bytes; ++byte) {
+    // Compute the starting positions, in task order to keep the sort stable,
+    // skipping bytes which are the same for all keys
+    int64_t position = 0;
+    bool all_equal = false;
+    for (int value = 0; value < kRadix; ++value) {
+      int64_t value_count = 0;
+      for (int task = 0; task < num_tasks; ++task) {
+        positions[task * kRadix + value] = position + value_count;
+        value_count += task_counts(task, byte)[value];
+      }
+      all_equal |= value_count == length;
+      position += value_count;
+    }
+    if (all_equal) {
+      continue;
+    }
+    RETURN_NOT_OK(run_tasks([&](int task) {
+      const auto [begin, end] = task_range(task);
+      int64_t* task_positions = positions.data() + task * kRadix;
+      for (int64_t i = begin; i < end; ++i) {
+        const uint64_t key = src_keys[i];
+        const int64_t dest = task_positions[(key >> (byte * 8)) & 0xff]++;
+        dest_keys[dest] = key;
+        dest_indices[dest] = src_indices[i];
+      }
+      return Status::OK();
+    }));
+    std::swap(src_indices, dest_indices);
+    std::swap(src_keys, dest_keys);
+  }
+  if (src_indices != indices_begin) {
+    std::copy(src_indices, src_indices + length, indices_begin);
+  }
+  return Status::OK();
+}
+
 Result<NullPartitionResult> SortChunkedArray(ExecContext* ctx, uint64_t* indices_begin,
                                              uint64_t* indices_end,
                                              const ChunkedArray& chunked_array,
@@ -1154,7 +1434,7 @@ Result<NullPartitionResult> SortStructArray(ExecContext* ctx, uint64_t* indices_
   ARROW_ASSIGN_OR_RAISE(auto sort_keys,
                         ResolveRecordBatchSortKeys(*batch, options.sort_keys));
   if (sort_keys.size() <= kMaxRadixSortKeys) {
-    RadixRecordBatchSorter sorter(indices_begin, indices_end, std::move(sort_keys),
+    RadixRecordBatchSorter sorter(ctx, indices_begin, indices_end, std::move(sort_keys),
                                   options);
     return sorter.Sort();
   } else {
@@ -20,7 +20,11 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/compute/api_vector.h"
@@ -28,6 +32,7 @@
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace compute {
@@ -334,41 +339,94 @@ NullPartitionResult PartitionNulls(uint64_t* indices_begin, uint64_t* indices_en
                              std::max(q.nulls_end, p.nulls_end)};
 }
 
+// Below this many values per task, sorting or merging in parallel is not worth it
+constexpr int64_t kMinParallelSortTaskLength = 1 << 16;
+
+// The number of tasks a sort may run in parallel on the executor of `ctx`
+int GetSortParallelism(ExecContext* ctx);
+
 struct MergeImpl {
   using MergeNullsFunc = std::function<void(uint64_t* nulls_begin, uint64_t* nulls_middle,
                                             uint64_t* nulls_end, uint64_t* temp_indices,
                                             int64_t null_count)>;
 
+  // Merge the sorted ranges `[left_begin, left_end)` and `[right_begin, right_end)`
+  // of non-null values into `out`, stably.
   using MergeNonNullsFunc =
-      std::function<void(uint64_t* range_begin, uint64_t* range_middle,
-                         uint64_t* range_end, uint64_t* temp_indices)>;
+      std::function<void(const uint64_t* left_begin, const uint64_t* left_end,
+                         const uint64_t* right_begin, const uint64_t* right_end,
+                         uint64_t* out)>;
+
+  // Whether the non-null value at `left` is ordered before the one at `right`
+  using CompareNonNullsFunc = std::function<bool(uint64_t left, uint64_t right)>;
 
   MergeImpl(NullPlacement null_placement, MergeNullsFunc&& merge_nulls,
-            MergeNonNullsFunc&& merge_non_nulls)
+            MergeNonNullsFunc&& merge_non_nulls,
+            CompareNonNullsFunc&& compare_non_nulls)
       : null_placement_(null_placement),
         merge_nulls_(std::move(merge_nulls)),
-        merge_non_nulls_(std::move(merge_non_nulls)) {}
-
-  Status Init(ExecContext* ctx, int64_t temp_indices_length) {
-    ARROW_ASSIGN_OR_RAISE(
-        temp_buffer_,
-        AllocateBuffer(sizeof(int64_t) * temp_indices_length, ctx->memory_pool()));
+        merge_non_nulls_(std::move(merge_non_nulls)),
+        compare_non_nulls_(std::move(compare_non_nulls)) {}
+
+  // `indices_begin..indices_end` are all the indices to be merged
+  Status Init(ExecContext* ctx, uint64_t* indices_begin, uint64_t* indices_end) {
+    ctx_ = ctx;
+    indices_begin_ = indices_begin;
+    ARROW_ASSIGN_OR_RAISE(temp_buffer_,
+                          AllocateBuffer(sizeof(int64_t) * (indices_end - indices_begin),
+                                         ctx->memory_pool()));
     temp_indices_ = reinterpret_cast<uint64_t*>(temp_buffer_->mutable_data());
     return Status::OK();
   }
 
-  NullPartitionResult Merge(const NullPartitionResult& left,
-                            const NullPartitionResult& right, int64_t null_count) const {
+  // Merge adjacent sorted ranges by pairs, recursively, until one is left.
+  //
+  // Pairs are merged in parallel if there are enough of them, otherwise the merges
+  // of non-null values are split between parallel tasks.
+  Result<NullPartitionResult> MergeAll(std::vector<NullPartitionResult> sorted,
+                                       int64_t null_count) const {
+    DCHECK(!sorted.empty());
+    const int parallelism = GetSortParallelism(ctx_);
+    while (sorted.size() > 1) {
+      const auto num_pairs = static_cast<int>(sorted.size() / 2);
+      std::vector<NullPartitionResult> merged(num_pairs);
+      auto merge_pair = [&](int i, int num_tasks) -> Status {
+        const auto& left = sorted[2 * i];
+        const auto& right = sorted[2 * i + 1];
+        DCHECK_EQ(left.overall_end(), right.overall_begin());
+        ARROW_ASSIGN_OR_RAISE(merged[i], Merge(left, right, null_count, num_tasks));
+        return Status::OK();
+      };
+      if (parallelism > 1 && num_pairs >= parallelism) {
+        RETURN_NOT_OK(::arrow::internal::ParallelFor(
+            num_pairs, [&](int i) { return merge_pair(i, /*num_tasks=*/1); },
+            ctx_->executor()));
+      } else {
+        for (int i = 0; i < num_pairs; ++i) {
+          RETURN_NOT_OK(merge_pair(i, parallelism));
+        }
+      }
+      if (sorted.size() % 2 == 1) {
+        merged.push_back(sorted.back());
+      }
+      sorted = std::move(merged);
+    }
+    return sorted[0];
+  }
+
+  Result<NullPartitionResult> Merge(const NullPartitionResult& left,
+                                    const NullPartitionResult& right,
+                                    int64_t null_count, int num_tasks = 1) const {
     if (null_placement_ == NullPlacement::AtStart) {
-      return MergeNullsAtStart(left, right, null_count);
+      return MergeNullsAtStart(left, right, null_count, num_tasks);
     } else {
-      return MergeNullsAtEnd(left, right, null_count);
+      return MergeNullsAtEnd(left, right, null_count, num_tasks);
     }
   }
 
-  NullPartitionResult MergeNullsAtStart(const NullPartitionResult& left,
-                                        const NullPartitionResult& right,
-                                        int64_t null_count) const {
+  Result<NullPartitionResult> MergeNullsAtStart(const NullPartitionResult& left,
+                                                const NullPartitionResult& right,
+                                                int64_t null_count, int num_tasks) const {
     // Input layout:
     // [left nulls .... left non-nulls .... right nulls .... right non-nulls]
     DCHECK_EQ(left.nulls_end, left.non_nulls_begin);
@@ -388,22 +446,22 @@ struct MergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   TempIndices(p.nulls_begin), null_count);
     }
 
     // Merge the non-null values into temp area
     DCHECK_EQ(right.non_nulls_begin - p.non_nulls_begin, left.non_null_count());
     DCHECK_EQ(p.non_nulls_end - right.non_nulls_begin, right.non_null_count());
     if (p.non_null_count()) {
-      merge_non_nulls_(p.non_nulls_begin, right.non_nulls_begin, p.non_nulls_end,
-                       temp_indices_);
+      RETURN_NOT_OK(MergeNonNulls(p.non_nulls_begin, right.non_nulls_begin,
+                                  p.non_nulls_end, num_tasks));
     }
     return p;
   }
 
-  NullPartitionResult MergeNullsAtEnd(const NullPartitionResult& left,
-                                      const NullPartitionResult& right,
-                                      int64_t null_count) const {
+  Result<NullPartitionResult> MergeNullsAtEnd(const NullPartitionResult& left,
+                                              const NullPartitionResult& right,
+                                              int64_t null_count, int num_tasks) const {
     // Input layout:
     // [left non-nulls .... left nulls .... right non-nulls .... right nulls]
     DCHECK_EQ(left.non_nulls_end, left.nulls_begin);
@@ -423,23 +481,93 @@ struct MergeImpl {
     // null-like values (e.g. NaN) are ordered equally.
     if (p.null_count()) {
       merge_nulls_(p.nulls_begin, p.nulls_begin + left.null_count(), p.nulls_end,
-                   temp_indices_, null_count);
+                   TempIndices(p.nulls_begin), null_count);
     }
 
     // Merge the non-null values into temp area
     DCHECK_EQ(left.non_nulls_end - p.non_nulls_begin, left.non_null_count());
     DCHECK_EQ(p.non_nulls_end - left.non_nulls_end, right.non_null_count());
     if (p.non_null_count()) {
-      merge_non_nulls_(p.non_nulls_begin, left.non_nulls_end, p.non_nulls_end,
-                       temp_indices_);
+      RETURN_NOT_OK(MergeNonNulls(p.non_nulls_begin, left.non_nulls_end,
+                                  p.non_nulls_end, num_tasks));
     }
     return p;
   }
 
  private:
+  // The temp area for merging the indices starting at `indices`, so that merges of
+  // disjoint ranges may run concurrently
+  uint64_t* TempIndices(const uint64_t* indices) const {
+    return temp_indices_ + (indices - indices_begin_);
+  }
+
+  // Merge `[range_begin, range_middle)` and `[range_middle, range_end)` in place,
+  // splitting the merge in up to `num_tasks` parallel tasks (merge path partitioning)
+  Status MergeNonNulls(uint64_t* range_begin, uint64_t* range_middle,
+                       uint64_t* range_end, int num_tasks) const {
+    uint64_t* temp_indices = TempIndices(range_begin);
+    const int64_t left_length = range_middle - range_begin;
+    const int64_t right_length = range_end - range_middle;
+    const int64_t length = left_length + right_length;
+    num_tasks = static_cast<int>(
+        std::min<int64_t>(num_tasks, length / kMinParallelSortTaskLength));
+    if (num_tasks <= 1) {
+      merge_non_nulls_(range_begin, range_middle, range_middle, range_end, temp_indices);
+      std::copy(temp_indices, temp_indices + length, range_begin);
+      return Status::OK();
+    }
+
+    // The number of left values among the first `output_length` merged values
+    auto left_split = [&](int64_t output_length) {
+      int64_t lo = std::max<int64_t>(0, output_length - right_length);
+      int64_t hi = std::min(output_length, left_length);
+      while (lo < hi) {
+        const int64_t left_count = lo + (hi - lo) / 2;
+        const int64_t right_count = output_length - left_count;
+        // Ties are resolved in favor of the left values, for stability
+        if (right_count > 0 && !compare_non_nulls_(range_middle[right_count - 1],
+                                                   range_begin[left_count])) {
+          lo = left_count + 1;
+        } else {
+          hi = left_count;
+        }
+      }
+      return lo;
+    };
+    std::vector<int64_t> output_splits(num_tasks + 1);
+    std::vector<int64_t> left_splits(num_tasks + 1);
+    for (int i = 0; i <= num_tasks; ++i) {
+      output_splits[i] = length * i / num_tasks;
+      left_splits[i] = left_split(output_splits[i]);
+    }
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        num_tasks,
+        [&](int i) {
+          const int64_t right_begin = output_splits[i] - left_splits[i];
+          const int64_t right_end = output_splits[i + 1] - left_splits[i + 1];
+          merge_non_nulls_(range_begin + left_splits[i], range_begin + left_splits[i + 1],
+                           range_middle + right_begin, range_middle + right_end,
+                           temp_indices + output_splits[i]);
+          return Status::OK();
+        },
+        ctx_->executor()));
+    // Copy back temp area into main buffer, once all the inputs have been read
+    return ::arrow::internal::ParallelFor(
+        num_tasks,
+        [&](int i) {
+          std::copy(temp_indices + output_splits[i], temp_indices + output_splits[i + 1],
+                    range_begin + output_splits[i]);
+          return Status::OK();
+        },
+        ctx_->executor());
+  }
+
   NullPlacement null_placement_;
   MergeNullsFunc merge_nulls_;
   MergeNonNullsFunc merge_non_nulls_;
+  CompareNonNullsFunc compare_non_nulls_;
+  ExecContext* ctx_ = nullptr;
+  uint64_t* indices_begin_ = nullptr;
   std::unique_ptr<Buffer> temp_buffer_;
   uint64_t* temp_indices_ = nullptr;
 };
@@ -470,6 +598,115 @@ Result<NullPartitionResult> SortStructArray(ExecContext* ctx, uint64_t* indices_
                                             SortOrder sort_order,
                                             NullPlacement null_placement);
 
+// ----------------------------------------------------------------------
+// Radix sort
+
+// Below this many values, radix sorting is not worth its fixed costs and
+// std::stable_sort is used instead
+constexpr int64_t kMinRadixSortLength = 4096;
+
+// Stable LSD radix sort of `indices_begin..indices_end` by `keys`, which has the same
+// length and holds the key of each index. Only the `key_bytes` lowest bytes of the keys
+// are considered, and `keys` is clobbered. Large inputs are sorted in parallel on the
+// executor of `ctx`.
+Status RadixSortIndices(uint64_t* indices_begin, uint64_t* indices_end, uint64_t* keys,
+                        int key_bytes, ExecContext* ctx);
+
+// Stable LSD radix sort of `indices_begin..indices_end` by `key(index)`
+template <typename KeyFunc>
+Status RadixSortIndicesBy(uint64_t* indices_begin, uint64_t* indices_end, int key_bytes,
+                          KeyFunc&& key, ExecContext* ctx) {
+  std::vector<uint64_t> keys(indices_end - indices_begin);
+  std::transform(indices_begin, indices_end, keys.begin(), std::forward<KeyFunc>(key));
+  return RadixSortIndices(indices_begin, indices_end, keys.data(), key_bytes, ctx);
+}
+
+// Physical types whose values radix sort with RadixSortIndicesByValues()
+template <typename Type>
+constexpr bool kIsRadixSortable =
+    (is_integer_type<Type>::value || is_floating_type<Type>::value ||
+     is_fixed_size_binary_type<Type>::value) &&
+    !std::is_same_v<Type, HalfFloatType> && !is_decimal_type<Type>::value;
+
+// Map a value to an unsigned integer with the same ordering
+template <typename T>
+uint64_t RadixSortKey(T value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    using UInt = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    constexpr UInt kSignBit = UInt{1} << (sizeof(T) * 8 - 1);
+    // -0.0 and 0.0 compare equal, and must remain in their original order
+    if (value == 0) {
+      return kSignBit;
+    }
+    UInt bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return (bits & kSignBit) ? static_cast<UInt>(~bits) : (bits | kSignBit);
+  } else if constexpr (std::is_signed_v<T>) {
+    using UInt = std::make_unsigned_t<T>;
+    constexpr UInt kSignBit = UInt{1} << (sizeof(T) * 8 - 1);
+    return static_cast<UInt>(static_cast<UInt>(value) ^ kSignBit);
+  } else {
+    return value;
+  }
+}
+
+// Stable radix sort of `indices_begin..indices_end` by the values of `array` at
+// `index - offset`. Null and NaN values sort as the smallest value: callers are
+// expected to have partitioned them out or to order them afterwards.
+template <typename Type>
+Status RadixSortIndicesByValues(uint64_t* indices_begin, uint64_t* indices_end,
+                                const Array& array, int64_t offset, SortOrder order,
+                                ExecContext* ctx) {
+  static_assert(kIsRadixSortable<Type>);
+  const bool descending = order == SortOrder::Descending;
+  const ArrayData& data = *array.data();
+  const bool may_have_nulls = array.null_count() > 0;
+  if constexpr (is_fixed_size_binary_type<Type>::value) {
+    const int byte_width = array.type()->byte_width();
+    const uint8_t* values = data.GetValues<uint8_t>(1, data.offset * byte_width);
+    // Sort by 8-byte words of the values, from the least significant word (the last
+    // one) to the most significant one
+    for (int word_start = (byte_width - 1) / 8 * 8; word_start >= 0; word_start -= 8) {
+      const int word_bytes = std::min(8, byte_width - word_start);
+      RETURN_NOT_OK(RadixSortIndicesBy(
+          indices_begin, indices_end, word_bytes,
+          [&](uint64_t index) -> uint64_t {
+            index -= offset;
+            if (may_have_nulls && array.IsNull(index)) {
+              return descending ? ~uint64_t{0} : 0;
+            }
+            const uint8_t* word = values + index * byte_width + word_start;
+            uint64_t key = 0;
+            for (int i = 0; i < word_bytes; ++i) {
+              key = (key << 8) | word[i];
+            }
+            return descending ? ~key : key;
+          },
+          ctx));
+    }
+    return Status::OK();
+  } else {
+    using c_type = typename Type::c_type;
+    const c_type* values = data.GetValues<c_type>(1);
+    return RadixSortIndicesBy(
+        indices_begin, indices_end, sizeof(c_type),
+        [&](uint64_t index) -> uint64_t {
+          index -= offset;
+          uint64_t key = RadixSortKey(values[index]);
+          if constexpr (is_floating_type<Type>::value) {
+            if (std::isnan(values[index])) {
+              key = 0;
+            }
+          }
+          if (may_have_nulls && array.IsNull(index)) {
+            key = 0;
+          }
+          return descending ? ~key : key;
+        },
+        ctx);
+  }
+}
+
 // ----------------------------------------------------------------------
 // Helpers for Sort/SelectK/Rank implementations
 
@@ -766,10 +1003,12 @@ struct ResolvedTableSortKey {
       ArrayVector chunks;
       chunks.reserve(batches.size());
       int64_t null_count = 0;
+      const auto physical_type = GetPhysicalType(f.type->GetSharedPtr());
       for (const auto& batch : batches) {
         ARROW_ASSIGN_OR_RAISE(auto child, f.path.GetFlattened(*batch));
         null_count += child->null_count();
-        chunks.push_back(std::move(child));
+        // The comparators expect arrays of the physical type
+        chunks.push_back(GetPhysicalArray(*child, physical_type));
       }
 
       return ResolvedTableSortKey(f.type->GetSharedPtr(), std::move(chunks), f.order,
@@ -37,6 +37,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -1025,6 +1026,33 @@ TYPED_TEST(TestArraySortIndicesRandomCompare, SortRandomValuesCompare) {
   }
 }
 
+// Long array with big value range: radix sort
+// - length >= 4096(kMinRadixSortLength)
+template <typename ArrowType>
+class TestArraySortIndicesRandomRadix : public ::testing::Test {};
+
+TYPED_TEST_SUITE(TestArraySortIndicesRandomRadix, NumericArrowTypes);
+
+TYPED_TEST(TestArraySortIndicesRandomRadix, SortRandomValuesRadix) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+
+  Random<TypeParam> rand(0x5487658);
+  int length = 5000;
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto array = rand.Generate(length, null_probability);
+    for (auto order : AllOrders()) {
+      for (auto null_placement : AllNullPlacements()) {
+        ArraySortOptions options(order, null_placement);
+        ASSERT_OK_AND_ASSIGN(std::shared_ptr<Array> offsets,
+                             SortIndices(*array, options));
+        ValidateSorted<ArrayType>(*checked_pointer_cast<ArrayType>(array),
+                                  *checked_pointer_cast<UInt64Array>(offsets), order,
+                                  null_placement);
+      }
+    }
+  }
+}
+
 // Test basic cases for chunked array.
 class TestChunkedArraySortIndices : public ::testing::Test {};
 
@@ -1439,6 +1467,45 @@ TEST_F(TestRecordBatchSortIndices, DuplicateSortKeys) {
   AssertSortIndices(batch, options, "[3, 0, 4, 5, 6, 7, 1, 2]");
 }
 
+TEST_F(TestRecordBatchSortIndices, NormalizedKeys) {
+  // Long enough batches whose sort keys fit in 64 bits are radix sorted with
+  // normalized keys. Check against a table of short batches, which are sorted
+  // one column at a time.
+  ::arrow::random::RandomArrayGenerator rng(0x61549225);
+  const int64_t length = 5000;
+  auto schema = ::arrow::schema({field("a", int8()), field("b", float32()),
+                                 field("c", timestamp(TimeUnit::SECOND)),
+                                 field("d", int64())});
+  ASSERT_OK_AND_ASSIGN(auto c, rng.Int64(length, 0, 1000, /*null_probability=*/0.1)
+                                   ->View(schema->field(2)->type()));
+  auto batch = RecordBatch::Make(
+      schema, length,
+      {rng.Int8(length, -3, 3, /*null_probability=*/0.1),
+       rng.Float32(length, -2.0f, 2.0f, /*null_probability=*/0.1,
+                   /*nan_probability=*/0.1),
+       c, rng.Int64(length, -1000000000, 1000000000, /*null_probability=*/0.0)});
+  RecordBatchVector short_batches;
+  for (int64_t offset = 0; offset < length; offset += 1000) {
+    short_batches.push_back(batch->Slice(offset, 1000));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(short_batches));
+
+  for (const auto& sort_keys : std::vector<std::vector<SortKey>>{
+           {SortKey("a"), SortKey("c", SortOrder::Descending)},
+           {SortKey("a", SortOrder::Descending), SortKey("b")},
+           {SortKey("b"), SortKey("a"), SortKey("c")},
+           // Too wide for normalized keys
+           {SortKey("d"), SortKey("c")}}) {
+    for (auto null_placement : AllNullPlacements()) {
+      SortOptions options(sort_keys, null_placement);
+      ARROW_SCOPED_TRACE(options.ToString());
+      ASSERT_OK_AND_ASSIGN(auto expected, SortIndices(Datum(table), options));
+      ASSERT_OK_AND_ASSIGN(auto actual, SortIndices(Datum(batch), options));
+      AssertArraysEqual(*expected, *actual);
+    }
+  }
+}
+
 // Test basic cases for table.
 class TestTableSortIndices : public ::testing::Test {};
 
@@ -1762,6 +1829,54 @@ TEST_F(TestTableSortIndices, HeterogenousChunking) {
   AssertSortIndices(table, options, "[3, 4, 2, 5, 1, 0, 6, 7]");
 }
 
+TEST_F(TestTableSortIndices, Parallel) {
+  // Long enough inputs have their chunks sorted and merged in parallel, which
+  // must give the same (stable) result as a serial sort.
+  ::arrow::random::RandomArrayGenerator rng(0x2b8a3fc1);
+  const int64_t length = 300000;
+  auto schema = ::arrow::schema({field("a", float64()), field("b", int32())});
+  auto a = rng.Float64(length, -100.0, 100.0, /*null_probability=*/0.05,
+                       /*nan_probability=*/0.05);
+  auto b = rng.Int32(length, 0, 100, /*null_probability=*/0.05);
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+
+  // Few chunks give few parallel merges, many chunks give many
+  for (int64_t chunk_length : {int64_t(100000), int64_t(3000)}) {
+    ArrayVector a_chunks, b_chunks;
+    for (int64_t offset = 0; offset < length; offset += chunk_length) {
+      a_chunks.push_back(a->Slice(offset, chunk_length));
+      b_chunks.push_back(b->Slice(offset, chunk_length));
+    }
+    auto table = Table::Make(schema, {std::make_shared<ChunkedArray>(a_chunks),
+                                      std::make_shared<ChunkedArray>(b_chunks)});
+    for (auto order : AllOrders()) {
+      for (auto null_placement : AllNullPlacements()) {
+        ArraySortOptions array_options(order, null_placement);
+        ARROW_SCOPED_TRACE(chunk_length, " ", array_options.ToString());
+        for (const auto& column : table->columns()) {
+          ASSERT_OK_AND_ASSIGN(auto expected,
+                               SortIndices(*column, array_options, &serial_ctx));
+          ASSERT_OK_AND_ASSIGN(auto actual,
+                               SortIndices(*column, array_options, &parallel_ctx));
+          AssertArraysEqual(*expected, *actual);
+        }
+
+        SortOptions options({SortKey("a", order), SortKey("b", SortOrder::Descending)},
+                            null_placement);
+        ASSERT_OK_AND_ASSIGN(auto expected,
+                             SortIndices(Datum(table), options, &serial_ctx));
+        ASSERT_OK_AND_ASSIGN(auto actual,
+                             SortIndices(Datum(table), options, &parallel_ctx));
+        AssertArraysEqual(*expected, *actual);
+      }
+    }
+  }
+}
+
 // Tests for temporal types
 template <typename ArrowType>
 class TestTableSortIndicesForTemporal : public TestTableSortIndices {
@@ -2466,5 +2581,40 @@ TEST_F(TestRank, EmptyChunks) {
   }
 }
 
+TEST_F(TestRank, Parallel) {
+  // Long enough inputs have their ties handled over ranges in parallel, which
+  // must give the same result as a serial ranking.
+  ::arrow::random::RandomArrayGenerator rng(0x5e1d2a37);
+  const int64_t length = 300000;
+  // Long runs of equal values span several ranges
+  auto ints = rng.Int32(length, 0, 3, /*null_probability=*/0.05);
+  auto doubles = rng.Float64(length, -100.0, 100.0, /*null_probability=*/0.05,
+                             /*nan_probability=*/0.05);
+
+  ASSERT_OK_AND_ASSIGN(auto thread_pool, ::arrow::internal::ThreadPool::Make(4));
+  ExecContext parallel_ctx(default_memory_pool(), thread_pool.get());
+  ExecContext serial_ctx;
+  serial_ctx.set_use_threads(false);
+
+  for (const auto& array : {ints, doubles}) {
+    SetInput(array);
+    for (const auto& datum : datums_) {
+      for (auto order : AllOrders()) {
+        for (auto null_placement : AllNullPlacements()) {
+          for (auto tiebreaker : AllTiebreakers()) {
+            RankOptions options({SortKey("foo", order)}, null_placement, tiebreaker);
+            ARROW_SCOPED_TRACE(datum.ToString(), " ", options.ToString());
+            ASSERT_OK_AND_ASSIGN(auto expected,
+                                 CallFunction("rank", {datum}, &options, &serial_ctx));
+            ASSERT_OK_AND_ASSIGN(auto actual,
+                                 CallFunction("rank", {datum}, &options, &parallel_ctx));
+            AssertDatumsEqual(expected, actual);
+          }
+        }
+      }
+    }
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -169,6 +169,12 @@ class ARROW_EXPORT Hashing64 {
   static void HashFixed(bool combine_hashes, uint32_t num_keys, uint64_t key_length,
                         const uint8_t* keys, uint64_t* hashes);
 
+  /// \brief Combine `hash` into `previous_hash`, as HashMultiColumn() does for the
+  /// hashes of the columns after the first one
+  static uint64_t CombineHashes(uint64_t previous_hash, uint64_t hash) {
+    return CombineHashesImp(previous_hash, hash);
+  }
+
  private:
   static const uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
   static const uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
@@ -303,6 +303,13 @@ void SwissTable::early_filter(const int num_keys, const uint32_t* hashes,
   // Optimistically use simplified lookup involving only a start block to find
   // a single group id candidate for every input.
   int num_processed = 0;
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  // The AVX2 version keeps tiny tables in registers, which beats gathering blocks
+  if ((hardware_flags_ & CpuInfo::AVX512) == CpuInfo::AVX512 && log_blocks_ > 4) {
+    num_processed = early_filter_imp_avx512_x8(num_keys, hashes, out_match_bitvector,
+                                               out_local_slots);
+  }
+#endif
 #if defined(ARROW_HAVE_RUNTIME_AVX2) && defined(ARROW_HAVE_RUNTIME_BMI2)
   if ((hardware_flags_ & CpuInfo::AVX2) && CpuInfo::GetInstance()->HasEfficientBmi2()) {
     if (log_blocks_ <= 4) {
@@ -175,6 +175,11 @@ class ARROW_EXPORT SwissTable {
                              const uint8_t* local_slots, uint32_t* out_group_ids,
                              int byte_offset, int byte_multiplier, int byte_size) const;
 #endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  int early_filter_imp_avx512_x8(const int num_hashes, const uint32_t* hashes,
+                                 uint8_t* out_match_bitvector,
+                                 uint8_t* out_local_slots) const;
+#endif
 
   void run_comparisons(const int num_keys, const uint16_t* optional_selection_ids,
                        const uint8_t* optional_selection_bitvector,
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/compute/key_map_internal.h"
+
+namespace arrow {
+namespace compute {
+
+// AVX-512 version of early_filter_imp_avx2_x8(). Byte comparisons produce bit masks
+// and leading zero counts are native, which avoids the emulation needed with AVX2
+// as well as the BMI2 dependency.
+//
+// Returns the number of hashes actually processed, which may be less than
+// requested due to alignment required by SIMD.
+//
+int SwissTable::early_filter_imp_avx512_x8(const int num_hashes, const uint32_t* hashes,
+                                           uint8_t* out_match_bitvector,
+                                           uint8_t* out_local_slots) const {
+  // Number of inputs processed together in a loop
+  constexpr int unroll = 8;
+
+  const int num_group_id_bits = num_groupid_bits_from_log_blocks(log_blocks_);
+  const __m256i* vhash_ptr = reinterpret_cast<const __m256i*>(hashes);
+  const __m256i vstamp_mask = _mm256_set1_epi32((1 << bits_stamp_) - 1);
+  const uint8_t* blocks = blocks_->data();
+
+  constexpr uint64_t kEachByteIs8 = 0x0808080808080808ULL;
+  constexpr uint64_t kLowestByteOfEachBlock = 0x0101010101010101ULL;
+  const __m512i vbyte_repeat_pattern =
+      _mm512_set_epi64(kEachByteIs8, 0ULL, kEachByteIs8, 0ULL, kEachByteIs8, 0ULL,
+                       kEachByteIs8, 0ULL);
+
+  for (int i = 0; i < num_hashes / unroll; ++i) {
+    // Calculate block index and hash stamp for a byte in a block
+    //
+    __m256i vhash = _mm256_loadu_si256(vhash_ptr + i);
+    __m256i vblock_id = _mm256_srlv_epi32(
+        vhash, _mm256_set1_epi32(bits_hash_ - bits_stamp_ - log_blocks_));
+    __m256i vstamp = _mm256_and_si256(vblock_id, vstamp_mask);
+    vblock_id = _mm256_srli_epi32(vblock_id, bits_stamp_);
+
+    // Widen to one 64-bit lane per input, so that all eight blocks are loaded at once
+    //
+    __m512i voffset = _mm512_cvtepu32_epi64(
+        _mm256_mullo_epi32(vblock_id, _mm256_set1_epi32(num_group_id_bits + 8)));
+    __m512i vblock = _mm512_i64gather_epi64(voffset, blocks, 1);
+
+    // Replicate the stamp to all bytes of its lane and compare with slot status bytes.
+    // Stamps are 7-bit values, so they never match empty slots (0x80).
+    //
+    __m512i vstamp_repeated =
+        _mm512_shuffle_epi8(_mm512_cvtepu32_epi64(vstamp), vbyte_repeat_pattern);
+    __mmask64 empty = _mm512_cmpeq_epi8_mask(
+        vblock, _mm512_set1_epi8(static_cast<char>(static_cast<unsigned char>(0x80))));
+    __mmask64 matches = _mm512_cmpeq_epi8_mask(vblock, vstamp_repeated);
+
+    // In case when there are no matches in slots and the block is full (no empty slots),
+    // pretend that there is a match in the last slot (the lowest byte).
+    //
+    matches |= ~empty & kLowestByteOfEachBlock;
+
+    __m512i vmatches = _mm512_movm_epi8(matches);
+    out_match_bitvector[i] =
+        static_cast<uint8_t>(_mm512_test_epi64_mask(vmatches, vmatches));
+
+    // The highest byte corresponds to the first slot, so the leading zero count of
+    // matching or empty slots is 8x the slot index
+    //
+    __m512i vlocal_slot =
+        _mm512_srli_epi64(_mm512_lzcnt_epi64(_mm512_movm_epi8(matches | empty)), 3);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(out_local_slots + unroll * i),
+                     _mm512_cvtepi64_epi8(vlocal_slot));
+  }
+
+  return num_hashes - (num_hashes % unroll);
+}
+
+}  // namespace compute
+}  // namespace arrow
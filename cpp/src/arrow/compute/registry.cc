@@ -18,10 +18,12 @@
 #include "arrow/compute/registry.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/function_internal.h"
@@ -39,10 +41,13 @@ class FunctionRegistry::FunctionRegistryImpl {
       : parent_(parent) {}
   ~FunctionRegistryImpl() {}
 
+  void set_registry(FunctionRegistry* registry) { registry_ = registry; }
+
   Status CanAddFunction(std::shared_ptr<Function> function, bool allow_overwrite) {
     if (parent_ != NULLPTR) {
       RETURN_NOT_OK(parent_->CanAddFunction(function, allow_overwrite));
     }
+    MaterializeLazyFunctionsNamed(function->name());
     return DoAddFunction(function, allow_overwrite, /*add=*/false);
   }
 
@@ -50,6 +55,7 @@ class FunctionRegistry::FunctionRegistryImpl {
     if (parent_ != NULLPTR) {
       RETURN_NOT_OK(parent_->CanAddFunction(function, allow_overwrite));
     }
+    MaterializeLazyFunctionsNamed(function->name());
     return DoAddFunction(function, allow_overwrite, /*add=*/true);
   }
 
@@ -58,6 +64,7 @@ class FunctionRegistry::FunctionRegistryImpl {
       RETURN_NOT_OK(parent_->CanAddFunctionName(target_name,
                                                 /*allow_overwrite=*/false));
     }
+    MaterializeLazyFunctionsNamed(target_name);
     return DoAddAlias(target_name, source_name, /*add=*/false);
   }
 
@@ -66,9 +73,23 @@ class FunctionRegistry::FunctionRegistryImpl {
       RETURN_NOT_OK(parent_->CanAddFunctionName(target_name,
                                                 /*allow_overwrite=*/false));
     }
+    MaterializeLazyFunctionsNamed(target_name);
     return DoAddAlias(target_name, source_name, /*add=*/true);
   }
 
+  Status AddLazyFunctions(std::vector<std::string> function_names,
+                          std::function<void(FunctionRegistry*)> add_functions) {
+    auto lazy = std::make_unique<LazyFunctions>();
+    lazy->add_functions = std::move(add_functions);
+    std::lock_guard<std::mutex> mutation_guard(lock_);
+    for (auto& name : function_names) {
+      name_to_lazy_functions_.emplace(std::move(name), lazy.get());
+    }
+    lazy_functions_.push_back(std::move(lazy));
+    ++num_pending_lazy_functions_;
+    return Status::OK();
+  }
+
   Status CanAddFunctionOptionsType(const FunctionOptionsType* options_type,
                                    bool allow_overwrite = false) {
     if (parent_ != NULLPTR) {
@@ -85,24 +106,40 @@ class FunctionRegistry::FunctionRegistryImpl {
     return DoAddFunctionOptionsType(options_type, allow_overwrite, /*add=*/true);
   }
 
-  Result<std::shared_ptr<Function>> GetFunction(const std::string& name) const {
-    auto it = name_to_function_.find(name);
-    if (it == name_to_function_.end()) {
+  Result<std::shared_ptr<Function>> GetFunction(const std::string& name) {
+    std::shared_ptr<Function> function = FindFunction(name);
+    if (function == NULLPTR && num_pending_lazy_functions_.load() > 0) {
+      // Materialize the functions expected to be named so first, then all of them
+      LazyFunctions* lazy = FindLazyFunctions(name);
+      if (lazy != NULLPTR) {
+        MaterializeLazyFunctions(lazy);
+        function = FindFunction(name);
+      }
+      if (function == NULLPTR) {
+        MaterializeAllLazyFunctions();
+        function = FindFunction(name);
+      }
+    }
+    if (function == NULLPTR) {
       if (parent_ != NULLPTR) {
         return parent_->GetFunction(name);
       }
       return Status::KeyError("No function registered with name: ", name);
     }
-    return it->second;
+    return function;
   }
 
-  std::vector<std::string> GetFunctionNames() const {
+  std::vector<std::string> GetFunctionNames() {
     std::vector<std::string> results;
     if (parent_ != NULLPTR) {
       results = parent_->GetFunctionNames();
     }
-    for (auto it : name_to_function_) {
-      results.push_back(it.first);
+    MaterializeAllLazyFunctions();
+    {
+      std::lock_guard<std::mutex> mutation_guard(lock_);
+      for (const auto& it : name_to_function_) {
+        results.push_back(it.first);
+      }
     }
     std::sort(results.begin(), results.end());
     return results;
@@ -120,14 +157,85 @@ class FunctionRegistry::FunctionRegistryImpl {
     return it->second;
   }
 
-  int num_functions() const {
-    return (parent_ == NULLPTR ? 0 : parent_->num_functions()) +
-           static_cast<int>(name_to_function_.size());
+  int num_functions() {
+    const int num_parent_functions = parent_ == NULLPTR ? 0 : parent_->num_functions();
+    MaterializeAllLazyFunctions();
+    std::lock_guard<std::mutex> mutation_guard(lock_);
+    return num_parent_functions + static_cast<int>(name_to_function_.size());
   }
 
   const Function* cast_function() { return cast_function_; }
 
  private:
+  struct LazyFunctions {
+    std::function<void(FunctionRegistry*)> add_functions;
+    // Only accessed with lazy_lock_ held
+    bool pending = true;
+  };
+
+  std::shared_ptr<Function> FindFunction(const std::string& name) {
+    std::lock_guard<std::mutex> mutation_guard(lock_);
+    auto it = name_to_function_.find(name);
+    return it == name_to_function_.end() ? NULLPTR : it->second;
+  }
+
+  LazyFunctions* FindLazyFunctions(const std::string& name) {
+    std::lock_guard<std::mutex> mutation_guard(lock_);
+    auto it = name_to_lazy_functions_.find(name);
+    return it == name_to_lazy_functions_.end() ? NULLPTR : it->second;
+  }
+
+  // must not be called with lock_ held, as add_functions adds to this registry
+  void MaterializeLazyFunctions(LazyFunctions* lazy) {
+    // Recursive, as add_functions may look up functions added lazily too
+    std::lock_guard<std::recursive_mutex> lazy_guard(lazy_lock_);
+    if (!lazy->pending) {
+      // Already added, or being added up the stack by this thread
+      return;
+    }
+    lazy->pending = false;
+    --num_pending_lazy_functions_;
+    ++lazy_depth_;
+    lazy->add_functions(registry_);
+    --lazy_depth_;
+  }
+
+  void MaterializeAllLazyFunctions() {
+    if (num_pending_lazy_functions_.load() == 0) {
+      return;
+    }
+    std::vector<LazyFunctions*> all_lazy;
+    {
+      std::lock_guard<std::mutex> mutation_guard(lock_);
+      for (const auto& lazy : lazy_functions_) {
+        all_lazy.push_back(lazy.get());
+      }
+    }
+    for (LazyFunctions* lazy : all_lazy) {
+      MaterializeLazyFunctions(lazy);
+    }
+  }
+
+  // Before a function is added under `name`, materialize the lazy functions which
+  // may conflict with it, unless it is added by lazy functions themselves
+  void MaterializeLazyFunctionsNamed(const std::string& name) {
+    if (num_pending_lazy_functions_.load() == 0) {
+      return;
+    }
+    {
+      std::unique_lock<std::recursive_mutex> lazy_guard(lazy_lock_, std::try_to_lock);
+      if (lazy_guard.owns_lock() && lazy_depth_ > 0) {
+        return;
+      }
+    }
+    LazyFunctions* lazy = FindLazyFunctions(name);
+    if (lazy != NULLPTR) {
+      MaterializeLazyFunctions(lazy);
+    } else {
+      MaterializeAllLazyFunctions();
+    }
+  }
+
   // must not acquire mutex
   Status CanAddFunctionName(const std::string& name, bool allow_overwrite) {
     if (parent_ != NULLPTR) {
@@ -207,10 +315,18 @@ class FunctionRegistry::FunctionRegistryImpl {
   }
 
   FunctionRegistryImpl* parent_;
+  FunctionRegistry* registry_ = NULLPTR;
   std::mutex lock_;
   std::unordered_map<std::string, std::shared_ptr<Function>> name_to_function_;
   std::unordered_map<std::string, const FunctionOptionsType*> name_to_options_type_;
 
+  // Functions added on first use, by expected name
+  std::recursive_mutex lazy_lock_;
+  std::vector<std::unique_ptr<LazyFunctions>> lazy_functions_;
+  std::unordered_map<std::string, LazyFunctions*> name_to_lazy_functions_;
+  std::atomic<int> num_pending_lazy_functions_{0};
+  int lazy_depth_ = 0;
+
   const Function* cast_function_;
 };
 
@@ -225,7 +341,10 @@ std::unique_ptr<FunctionRegistry> FunctionRegistry::Make(FunctionRegistry* paren
 
 FunctionRegistry::FunctionRegistry() : FunctionRegistry(new FunctionRegistryImpl()) {}
 
-FunctionRegistry::FunctionRegistry(FunctionRegistryImpl* impl) { impl_.reset(impl); }
+FunctionRegistry::FunctionRegistry(FunctionRegistryImpl* impl) {
+  impl_.reset(impl);
+  impl_->set_registry(this);
+}
 
 FunctionRegistry::~FunctionRegistry() {}
 
@@ -249,6 +368,12 @@ Status FunctionRegistry::AddAlias(const std::string& target_name,
   return impl_->AddAlias(target_name, source_name);
 }
 
+Status FunctionRegistry::AddLazyFunctions(
+    std::vector<std::string> function_names,
+    std::function<void(FunctionRegistry*)> add_functions) {
+  return impl_->AddLazyFunctions(std::move(function_names), std::move(add_functions));
+}
+
 Status FunctionRegistry::CanAddFunctionOptionsType(
     const FunctionOptionsType* options_type, bool allow_overwrite) {
   return impl_->CanAddFunctionOptionsType(options_type, allow_overwrite);
@@ -293,42 +418,120 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterAggregateOptions(registry.get());
 
 #ifdef ARROW_COMPUTE
-  // Register additional kernels
+  auto add_lazy = [&](std::vector<std::string> names,
+                      void (*register_functions)(FunctionRegistry*)) {
+    DCHECK_OK(registry->AddLazyFunctions(std::move(names), register_functions));
+  };
+
+  // Register additional kernels on first use, as building them all is costly.
+  // The names listed are only hints: looking up any other name registers them all.
 
   // Scalar functions
-  RegisterScalarArithmetic(registry.get());
-  RegisterScalarBoolean(registry.get());
-  RegisterScalarComparison(registry.get());
-  RegisterScalarIfElse(registry.get());
-  RegisterScalarNested(registry.get());
-  RegisterScalarRandom(registry.get());  // Nullary
-  RegisterScalarRoundArithmetic(registry.get());
-  RegisterScalarSetLookup(registry.get());
-  RegisterScalarStringAscii(registry.get());
-  RegisterScalarStringUtf8(registry.get());
-  RegisterScalarTemporalBinary(registry.get());
-  RegisterScalarTemporalUnary(registry.get());
-  RegisterScalarValidity(registry.get());
+  add_lazy(
+      {"abs", "abs_checked", "add", "add_checked", "subtract", "subtract_checked",
+       "multiply", "multiply_checked", "divide", "divide_checked", "negate",
+       "negate_checked", "power", "power_checked", "exp", "sqrt", "sqrt_checked", "sign",
+       "bit_wise_not", "bit_wise_and", "bit_wise_or", "bit_wise_xor", "shift_left",
+       "shift_left_checked", "shift_right", "shift_right_checked", "sin", "sin_checked",
+       "cos", "cos_checked", "tan", "tan_checked", "asin", "asin_checked", "acos",
+       "acos_checked", "atan", "atan2", "ln", "ln_checked", "log10", "log10_checked",
+       "log2", "log2_checked", "log1p", "log1p_checked", "logb", "logb_checked"},
+      RegisterScalarArithmetic);
+  add_lazy(
+      {"invert", "and", "and_not", "or", "xor", "and_kleene", "and_not_kleene",
+       "or_kleene"},
+      RegisterScalarBoolean);
+  add_lazy(
+      {"equal", "not_equal", "greater", "greater_equal", "less", "less_equal",
+       "min_element_wise", "max_element_wise"},
+      RegisterScalarComparison);
+  add_lazy({"if_else", "case_when", "coalesce", "choose"}, RegisterScalarIfElse);
+  add_lazy(
+      {"list_value_length", "list_element", "list_slice", "struct_field", "map_lookup",
+       "make_struct"},
+      RegisterScalarNested);
+  add_lazy({"random"}, RegisterScalarRandom);
+  add_lazy(
+      {"floor", "ceil", "trunc", "round", "round_binary", "round_to_multiple"},
+      RegisterScalarRoundArithmetic);
+  add_lazy({"is_in", "index_in"}, RegisterScalarSetLookup);
+  add_lazy(
+      {"string_is_ascii", "ascii_is_alnum", "ascii_is_alpha", "ascii_is_decimal",
+       "ascii_is_lower", "ascii_is_printable", "ascii_is_space", "ascii_is_upper",
+       "ascii_is_title", "ascii_upper", "ascii_lower", "ascii_swapcase",
+       "ascii_capitalize", "ascii_title", "binary_length", "binary_reverse",
+       "ascii_reverse", "ascii_trim", "ascii_ltrim", "ascii_rtrim",
+       "ascii_trim_whitespace", "ascii_ltrim_whitespace", "ascii_rtrim_whitespace",
+       "ascii_lpad", "ascii_rpad", "ascii_center", "match_substring", "starts_with",
+       "ends_with", "match_substring_regex", "match_like", "find_substring",
+       "find_substring_regex", "count_substring", "count_substring_regex",
+       "replace_substring", "replace_substring_regex", "extract_regex",
+       "binary_replace_slice", "binary_slice", "split_pattern", "ascii_split_whitespace",
+       "split_pattern_regex", "binary_join", "binary_join_element_wise", "binary_repeat"},
+      RegisterScalarStringAscii);
+  add_lazy(
+      {"utf8_is_alnum", "utf8_is_alpha", "utf8_is_decimal", "utf8_is_digit",
+       "utf8_is_numeric", "utf8_is_lower", "utf8_is_printable", "utf8_is_space",
+       "utf8_is_title", "utf8_is_upper", "utf8_upper", "utf8_lower", "utf8_swapcase",
+       "utf8_capitalize", "utf8_title", "utf8_normalize", "utf8_length", "utf8_reverse",
+       "utf8_trim", "utf8_ltrim", "utf8_rtrim", "utf8_trim_whitespace",
+       "utf8_ltrim_whitespace", "utf8_rtrim_whitespace", "utf8_lpad", "utf8_rpad",
+       "utf8_center", "utf8_replace_slice", "utf8_slice_codeunits",
+       "utf8_split_whitespace"},
+      RegisterScalarStringUtf8);
+  add_lazy(
+      {"years_between", "quarters_between", "month_interval_between",
+       "month_day_nano_interval_between", "weeks_between", "day_time_interval_between",
+       "days_between", "hours_between", "minutes_between", "seconds_between",
+       "milliseconds_between", "microseconds_between", "nanoseconds_between"},
+      RegisterScalarTemporalBinary);
+  add_lazy(
+      {"year", "is_leap_year", "month", "day", "year_month_day", "day_of_week",
+       "day_of_year", "iso_year", "us_year", "iso_week", "us_week", "week",
+       "iso_calendar", "quarter", "hour", "minute", "second", "millisecond",
+       "microsecond", "nanosecond", "subsecond", "strftime", "strptime",
+       "assume_timezone", "is_dst", "local_timestamp", "floor_temporal", "ceil_temporal",
+       "round_temporal"},
+      RegisterScalarTemporalUnary);
+  add_lazy(
+      {"is_valid", "is_null", "true_unless_null", "is_finite", "is_inf", "is_nan"},
+      RegisterScalarValidity);
 
   // Vector functions
-  RegisterVectorArraySort(registry.get());
-  RegisterVectorCumulativeSum(registry.get());
-  RegisterVectorNested(registry.get());
-  RegisterVectorRank(registry.get());
-  RegisterVectorReplace(registry.get());
-  RegisterVectorSelectK(registry.get());
-  RegisterVectorSort(registry.get());
-  RegisterVectorRunEndEncode(registry.get());
-  RegisterVectorRunEndDecode(registry.get());
-  RegisterVectorPairwise(registry.get());
+  add_lazy({"array_sort_indices", "partition_nth_indices"}, RegisterVectorArraySort);
+  add_lazy(
+      {"cumulative_sum", "cumulative_sum_checked", "cumulative_prod",
+       "cumulative_prod_checked", "cumulative_min", "cumulative_max", "cumulative_mean"},
+      RegisterVectorCumulativeSum);
+  add_lazy({"list_flatten", "list_parent_indices"}, RegisterVectorNested);
+  add_lazy({"rank"}, RegisterVectorRank);
+  add_lazy(
+      {"replace_with_mask", "fill_null_forward", "fill_null_backward"},
+      RegisterVectorReplace);
+  add_lazy({"select_k_unstable"}, RegisterVectorSelectK);
+  add_lazy({"sort_indices"}, RegisterVectorSort);
+  add_lazy({"run_end_encode"}, RegisterVectorRunEndEncode);
+  add_lazy({"run_end_decode"}, RegisterVectorRunEndDecode);
+  add_lazy({"pairwise_diff", "pairwise_diff_checked"}, RegisterVectorPairwise);
 
   // Aggregate functions
-  RegisterHashAggregateBasic(registry.get());
-  RegisterScalarAggregateBasic(registry.get());
-  RegisterScalarAggregateMode(registry.get());
-  RegisterScalarAggregateQuantile(registry.get());
-  RegisterScalarAggregateTDigest(registry.get());
-  RegisterScalarAggregateVariance(registry.get());
+  add_lazy(
+      {"hash_count", "hash_count_all", "hash_sum", "hash_product", "hash_mean",
+       "hash_stddev", "hash_variance", "hash_tdigest", "hash_approximate_median",
+       "hash_quantile", "hash_median", "hash_first_last", "hash_first", "hash_last",
+       "hash_min_max", "hash_min", "hash_max", "hash_any", "hash_all",
+       "hash_count_distinct", "hash_approximate_count_distinct", "hash_distinct",
+       "hash_one", "hash_list", "hash_pivot_wider"},
+      RegisterHashAggregateBasic);
+  add_lazy(
+      {"count_all", "count", "count_distinct", "approximate_count_distinct", "sum",
+       "mean", "first_last", "first", "last", "min_max", "min", "max", "product", "any",
+       "all", "index"},
+      RegisterScalarAggregateBasic);
+  add_lazy({"mode"}, RegisterScalarAggregateMode);
+  add_lazy({"quantile"}, RegisterScalarAggregateQuantile);
+  add_lazy({"tdigest", "approximate_median"}, RegisterScalarAggregateTDigest);
+  add_lazy({"variance", "stddev"}, RegisterScalarAggregateVariance);
 #endif
 
   return registry;
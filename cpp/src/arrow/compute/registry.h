@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -78,6 +79,18 @@ class ARROW_EXPORT FunctionRegistry {
   /// \returns Status::KeyError if the function with the given name is not registered.
   Status AddAlias(const std::string& target_name, const std::string& source_name);
 
+  /// \brief Add functions to the registry on first use.
+  ///
+  /// `add_functions` is called with this registry, at most once, the first time
+  /// one of `function_names` is looked up.  It is also called before looking up
+  /// a name not registered yet, listing or counting the functions, or adding a
+  /// function which may conflict with the ones it adds, so the registry behaves
+  /// as if `add_functions` had been called right away.  `function_names` is
+  /// therefore only a hint of the names of the functions added, which avoids
+  /// calling `add_functions` when unrelated functions are looked up.
+  Status AddLazyFunctions(std::vector<std::string> function_names,
+                          std::function<void(FunctionRegistry*)> add_functions);
+
   /// \brief Check whether a new function options type can be added to the registry.
   ///
   /// \return Status::KeyError if a function options type with the same name is already
@@ -240,5 +240,76 @@ TEST(TestRegistry, RegisterNestedFunctions) {
   }
 }
 
+std::shared_ptr<Function> MakeTestFunction(std::string name) {
+  return std::make_shared<ScalarFunction>(std::move(name), Arity::Unary(),
+                                          /*doc=*/FunctionDoc::Empty());
+}
+
+TEST(TestRegistry, LazyFunctions) {
+  auto registry = FunctionRegistry::Make();
+  int num_calls_f = 0, num_calls_g = 0;
+  ASSERT_OK(registry->AddLazyFunctions({"f1"}, [&](FunctionRegistry* reg) {
+    ++num_calls_f;
+    ASSERT_OK(reg->AddFunction(MakeTestFunction("f1")));
+    ASSERT_OK(reg->AddFunction(MakeTestFunction("f2")));
+  }));
+  ASSERT_OK(registry->AddLazyFunctions({"g"}, [&](FunctionRegistry* reg) {
+    ++num_calls_g;
+    // Lazy functions may use other ones
+    ASSERT_OK(reg->GetFunction("f1"));
+    ASSERT_OK(reg->AddFunction(MakeTestFunction("g")));
+  }));
+
+  // Only the functions expected to be named so are added
+  ASSERT_OK_AND_ASSIGN(auto function, registry->GetFunction("f1"));
+  ASSERT_EQ(function->name(), "f1");
+  ASSERT_OK(registry->GetFunction("f2"));
+  ASSERT_EQ(num_calls_f, 1);
+  ASSERT_EQ(num_calls_g, 0);
+
+  // A name not hinted adds them all
+  ASSERT_RAISES(KeyError, registry->GetFunction("h"));
+  ASSERT_EQ(num_calls_f, 1);
+  ASSERT_EQ(num_calls_g, 1);
+  ASSERT_OK(registry->GetFunction("g"));
+  ASSERT_EQ(registry->num_functions(), 3);
+  ASSERT_EQ(num_calls_g, 1);
+}
+
+TEST(TestRegistry, LazyFunctionsListed) {
+  auto registry = FunctionRegistry::Make();
+  ASSERT_OK(registry->AddFunction(MakeTestFunction("f1")));
+  ASSERT_OK(registry->AddLazyFunctions({}, [](FunctionRegistry* reg) {
+    ASSERT_OK(reg->AddFunction(MakeTestFunction("f2")));
+  }));
+  ASSERT_EQ(registry->GetFunctionNames(), std::vector<std::string>({"f1", "f2"}));
+
+  auto nested = FunctionRegistry::Make(registry.get());
+  ASSERT_OK(nested->AddLazyFunctions({"f3"}, [](FunctionRegistry* reg) {
+    ASSERT_OK(reg->AddFunction(MakeTestFunction("f3")));
+  }));
+  ASSERT_EQ(nested->num_functions(), 3);
+  ASSERT_EQ(nested->GetFunctionNames(), std::vector<std::string>({"f1", "f2", "f3"}));
+}
+
+TEST(TestRegistry, LazyFunctionsConflicts) {
+  auto registry = FunctionRegistry::Make();
+  int num_calls = 0;
+  ASSERT_OK(registry->AddLazyFunctions({"f1"}, [&](FunctionRegistry* reg) {
+    ++num_calls;
+    ASSERT_OK(reg->AddFunction(MakeTestFunction("f1")));
+    ASSERT_OK(reg->AddFunction(MakeTestFunction("f2")));
+  }));
+  // Adding a function named like a lazy one fails as if they were added already
+  ASSERT_RAISES(KeyError, registry->CanAddFunction(MakeTestFunction("f2")));
+  ASSERT_EQ(num_calls, 1);
+  ASSERT_RAISES(KeyError, registry->AddFunction(MakeTestFunction("f1")));
+  ASSERT_RAISES(KeyError, registry->AddAlias("f2", "f1"));
+  ASSERT_OK(registry->AddAlias("f3", "f1"));
+  ASSERT_OK(registry->AddFunction(MakeTestFunction("f1"), /*allow_overwrite=*/true));
+  ASSERT_EQ(num_calls, 1);
+  ASSERT_EQ(registry->num_functions(), 3);
+}
+
 }  // namespace compute
 }  // namespace arrow
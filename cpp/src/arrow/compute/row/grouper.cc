@@ -17,11 +17,16 @@
 
 #include "arrow/compute/row/grouper.h"
 
+#include <limits>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
 #include <type_traits>
 
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
 
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/function.h"
@@ -214,6 +219,114 @@ struct SimpleKeySegmenter : public BaseRowSegmenter {
   bool extend_was_called_;
 };
 
+// Segments by comparing the key values of consecutive rows, without hashing them.  Used
+// for multiple, nullable or variable-length keys whose values compare bytewise.
+struct ComparingKeysSegmenter : public BaseRowSegmenter {
+  static bool CanCompare(const DataType& type) {
+    // Dictionary indices are only comparable within a batch
+    if (type.id() == Type::DICTIONARY || type.id() == Type::BOOL) return false;
+    return (is_fixed_width(type) && type.byte_width() > 0) || is_base_binary_like(type);
+  }
+
+  static bool CanCompare(const std::vector<TypeHolder>& key_types) {
+    for (const TypeHolder& key_type : key_types) {
+      if (key_type.type == NULLPTR || !CanCompare(*key_type.type)) return false;
+    }
+    return true;
+  }
+
+  explicit ComparingKeysSegmenter(const std::vector<TypeHolder>& key_types)
+      : BaseRowSegmenter(key_types), save_key_data_(key_types.size()) {}
+
+  Status Reset() override {
+    extend_was_called_ = false;
+    return Status::OK();
+  }
+
+  Result<Segment> GetNextSegment(const ExecSpan& batch, int64_t offset) override {
+    ARROW_RETURN_NOT_OK(CheckForGetNextSegment(batch, offset, key_types_));
+    if (offset == batch.length) {
+      return MakeSegment(batch.length, offset, 0, kEmptyExtends);
+    }
+    std::vector<std::shared_ptr<Array>> scalar_arrays;
+    std::vector<std::optional<std::string_view>> first_values(key_types_.size());
+    int64_t end = batch.length;
+    for (size_t i = 0; i < key_types_.size(); ++i) {
+      const ExecValue& value = batch[static_cast<int>(i)];
+      if (value.is_scalar()) {
+        // A scalar key never ends a segment within the batch
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> array,
+                              MakeArrayFromScalar(*value.scalar, 1));
+        first_values[i] = ValueAt(ArraySpan(*array->data()), 0);
+        scalar_arrays.push_back(std::move(array));
+        continue;
+      }
+      const ArraySpan& array = value.array;
+      first_values[i] = ValueAt(array, offset);
+      // Later keys only need to be compared up to the end found so far
+      end = offset + MatchLength(array, offset, end, first_values[i]);
+    }
+    bool extends = Extend(first_values);
+    return MakeSegment(batch.length, offset, end - offset, extends);
+  }
+
+ private:
+  // Returns the bytes of the value at `index`, or nullopt for a null
+  static std::optional<std::string_view> ValueAt(const ArraySpan& array, int64_t index) {
+    if (!array.IsValid(index)) return std::nullopt;
+    if (is_large_binary_like(*array.type)) {
+      const int64_t* offsets = array.GetValues<int64_t>(1);
+      return std::string_view(array.buffers[2].data_as<char>() + offsets[index],
+                              offsets[index + 1] - offsets[index]);
+    }
+    if (is_base_binary_like(*array.type)) {
+      const int32_t* offsets = array.GetValues<int32_t>(1);
+      return std::string_view(array.buffers[2].data_as<char>() + offsets[index],
+                              offsets[index + 1] - offsets[index]);
+    }
+    int64_t byte_width = array.type->byte_width();
+    return std::string_view(reinterpret_cast<const char*>(GetValuesAsBytes(array, index)),
+                            byte_width);
+  }
+
+  // Returns the number of rows from `offset` on, but before `end`, which are equal to
+  // `match`
+  static int64_t MatchLength(const ArraySpan& array, int64_t offset, int64_t end,
+                             const std::optional<std::string_view>& match) {
+    if (match.has_value() && array.GetNullCount() == 0 && is_fixed_width(*array.type)) {
+      return GetMatchLength(reinterpret_cast<const uint8_t*>(match->data()),
+                            array.type->byte_width(), GetValuesAsBytes(array), offset,
+                            end);
+    }
+    int64_t cursor = offset + 1;
+    while (cursor < end && ValueAt(array, cursor) == match) ++cursor;
+    return cursor - offset;
+  }
+
+  // Checks whether the first key values of a segment are equal to the previously seen
+  // ones, which are then replaced by them
+  bool Extend(const std::vector<std::optional<std::string_view>>& values) {
+    bool extends = kDefaultExtends;
+    if (extend_was_called_) {
+      for (size_t i = 0; i < values.size() && extends; ++i) {
+        extends = save_key_data_[i] == values[i];
+      }
+    }
+    extend_was_called_ = true;
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (values[i].has_value()) {
+        save_key_data_[i] = std::string(*values[i]);
+      } else {
+        save_key_data_[i].reset();
+      }
+    }
+    return extends;
+  }
+
+  std::vector<std::optional<std::string>> save_key_data_;
+  bool extend_was_called_ = false;
+};
+
 struct AnyKeysSegmenter : public BaseRowSegmenter {
   static Result<std::unique_ptr<RowSegmenter>> Make(
       const std::vector<TypeHolder>& key_types, ExecContext* ctx) {
@@ -332,6 +445,9 @@ Result<std::unique_ptr<RowSegmenter>> RowSegmenter::Make(
       return SimpleKeySegmenter::Make(key_types[0]);
     }
   }
+  if (ComparingKeysSegmenter::CanCompare(key_types)) {
+    return std::make_unique<ComparingKeysSegmenter>(key_types);
+  }
   return AnyKeysSegmenter::Make(key_types, ctx);
 }
 
@@ -517,11 +633,6 @@ struct GrouperFastImpl : public Grouper {
       return false;
     }
 #if ARROW_LITTLE_ENDIAN
-    for (size_t i = 0; i < key_types.size(); ++i) {
-      if (is_large_binary_like(key_types[i].id())) {
-        return false;
-      }
-    }
     return true;
 #else
     return false;
@@ -553,7 +664,9 @@ struct GrouperFastImpl : public Grouper {
       } else if (is_fixed_width(key.id())) {
         impl->col_metadata_[icol] = KeyColumnMetadata(
             true, checked_cast<const FixedWidthType&>(*key).bit_width() / 8);
-      } else if (is_binary_like(key.id())) {
+      } else if (is_binary_like(key.id()) || is_large_binary_like(key.id())) {
+        // Large binary offsets are narrowed to 32 bits batch by batch, see
+        // NarrowLargeOffsets()
         impl->col_metadata_[icol] = KeyColumnMetadata(false, sizeof(uint32_t));
       } else if (key.id() == Type::NA) {
         impl->col_metadata_[icol] = KeyColumnMetadata(true, 0, /*is_null_type_in=*/true);
@@ -589,6 +702,7 @@ struct GrouperFastImpl : public Grouper {
     };
     RETURN_NOT_OK(impl->map_.init(impl->encode_ctx_.hardware_flags, ctx->memory_pool()));
     impl->cols_.resize(num_columns);
+    impl->narrowed_offsets_.resize(num_columns);
     impl->minibatch_hashes_.resize(impl->minibatch_size_max_ +
                                    kPaddingForSIMD / sizeof(uint32_t));
 
@@ -663,6 +777,12 @@ struct GrouperFastImpl : public Grouper {
 
       int64_t offset = batch[icol].array.offset;
 
+      if (is_large_binary_like(key_types_[icol].id())) {
+        ARROW_ASSIGN_OR_RAISE(varlen,
+                              NarrowLargeOffsets(icol, batch[icol].array, &fixedlen));
+        offset = 0;
+      }
+
       auto col_base = KeyColumnArray(col_metadata_[icol], offset + num_rows, non_nulls,
                                      fixedlen, varlen);
 
@@ -716,6 +836,42 @@ struct GrouperFastImpl : public Grouper {
     return Datum(UInt32Array(batch.length, std::move(group_ids)));
   }
 
+  // The row encoder works on 32-bit offsets.  Rebase the 64-bit offsets of a
+  // large binary key column onto the first value of the span and narrow them
+  // into a scratch buffer, returning the matching start of the value data.
+  Result<const uint8_t*> NarrowLargeOffsets(int icol, const ArraySpan& data,
+                                            const uint8_t** out_offsets) {
+    std::vector<uint32_t>& narrowed = narrowed_offsets_[icol];
+    narrowed.assign(data.length + 1 + kPaddingForSIMD / sizeof(uint32_t), 0);
+    *out_offsets = reinterpret_cast<const uint8_t*>(narrowed.data());
+    if (data.length == 0) {
+      return data.buffers[2].data;
+    }
+    const int64_t* offsets = data.GetValues<int64_t>(1);
+    const int64_t base = offsets[0];
+    if (offsets[data.length] - base > std::numeric_limits<uint32_t>::max()) {
+      return Status::CapacityError("Key column ", icol, " holds more than 4 GiB of ",
+                                   *key_types_[icol], " data in a single batch");
+    }
+    for (int64_t i = 0; i <= data.length; ++i) {
+      narrowed[i] = static_cast<uint32_t>(offsets[i] - base);
+    }
+    return data.buffers[2].data + base;
+  }
+
+  // Widen the 32-bit offsets decoded for a large binary key column
+  Result<std::shared_ptr<Buffer>> WidenOffsets(const Buffer& narrowed,
+                                               int64_t num_groups) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> widened,
+                          AllocatePaddedBuffer((num_groups + 1) * sizeof(int64_t)));
+    const uint32_t* in = narrowed.data_as<uint32_t>();
+    int64_t* out = widened->mutable_data_as<int64_t>();
+    for (int64_t i = 0; i <= num_groups; ++i) {
+      out[i] = in[i];
+    }
+    return widened;
+  }
+
   uint32_t num_groups() const override { return static_cast<uint32_t>(rows_.length()); }
 
   // Make sure padded buffers end up with the right logical size
@@ -762,6 +918,8 @@ struct GrouperFastImpl : public Grouper {
       } else {
         ARROW_ASSIGN_OR_RAISE(fixedlen_bufs[i],
                               AllocatePaddedBuffer((num_groups + 1) * sizeof(uint32_t)));
+        // The decoding below doesn't write the offsets when there are no groups
+        reinterpret_cast<uint32_t*>(fixedlen_bufs[i]->mutable_data())[0] = 0;
       }
       cols_[i] =
           KeyColumnArray(col_metadata_[i], num_groups, non_null_bufs[i]->mutable_data(),
@@ -814,6 +972,10 @@ struct GrouperFastImpl : public Grouper {
             key_types_[i].GetSharedPtr(), num_groups,
             {std::move(non_null_bufs[i]), std::move(fixedlen_bufs[i])}, null_count);
       } else {
+        if (is_large_binary_like(key_types_[i].id())) {
+          ARROW_ASSIGN_OR_RAISE(fixedlen_bufs[i],
+                                WidenOffsets(*fixedlen_bufs[i], num_groups));
+        }
         out.values[i] =
             ArrayData::Make(key_types_[i].GetSharedPtr(), num_groups,
                             {std::move(non_null_bufs[i]), std::move(fixedlen_bufs[i]),
@@ -851,6 +1013,8 @@ struct GrouperFastImpl : public Grouper {
   std::vector<KeyColumnMetadata> col_metadata_;
   std::vector<KeyColumnArray> cols_;
   std::vector<uint32_t> minibatch_hashes_;
+  // Per key column scratch space for the narrowed offsets of large binary keys
+  std::vector<std::vector<uint32_t>> narrowed_offsets_;
 
   std::vector<std::shared_ptr<Array>> dictionaries_;
 
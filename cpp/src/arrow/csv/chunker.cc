@@ -18,14 +18,20 @@
 #include "arrow/csv/chunker.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace csv {
@@ -52,25 +58,47 @@ class Lexer {
     DCHECK_EQ(SpecializedOptions::escaping, options_.escaping);
   }
 
-  void Reset() { state_ = FIELD_START; }
+  void Reset(State state = FIELD_START) {
+    state_ = state;
+    if constexpr (kStructuralFilter) {
+      bulk_filter_.Reset();
+    }
+  }
+
+  State state() const { return state_; }
 
   // Decide whether it's worth using a bulk filter over the given data area
   bool ShouldUseBulkFilter(const char* data, const char* data_end) {
-    constexpr int32_t kWordSize = static_cast<int32_t>(sizeof(BulkWordType));
-
-    // Only probe the 32 first words and assume they are representative of the rest
-    const int64_t n_words = std::min<int64_t>(32, (data_end - data) / kWordSize);
-    int64_t n_skips = 0;
-    const auto words = reinterpret_cast<const BulkWordType*>(data);
-    for (int64_t i = 0; i < n_words - 3; i += 4) {
-      const auto a = words[i + 0];
-      const auto b = words[i + 1];
-      const auto c = words[i + 2];
-      const auto d = words[i + 3];
-      n_skips += !bulk_filter_.Matches(a) + !bulk_filter_.Matches(b) +
-                 !bulk_filter_.Matches(c) + !bulk_filter_.Matches(d);
+    if constexpr (kStructuralFilter) {
+      // Only probe the 256 first bytes and assume they are representative of the
+      // rest: use the filter if special chars are 8 bytes apart on average
+      constexpr int64_t kBlockSize = BulkFilterType::kBlockSize;
+      const int64_t probe_size = std::min<int64_t>(256, data_end - data - kBlockSize);
+      const char* probe_end = data + probe_size;
+      int64_t n_special = 0;
+      for (const char* p = bulk_filter_.FindNext(data, data_end); p < probe_end;
+           p = bulk_filter_.FindNext(p + 1, data_end)) {
+        ++n_special;
+      }
+      return probe_size > 0 && n_special * 8 <= probe_size;
+    } else {
+      using BulkWordType = typename BulkFilterType::WordType;
+      constexpr int32_t kWordSize = static_cast<int32_t>(sizeof(BulkWordType));
+
+      // Only probe the 32 first words and assume they are representative of the rest
+      const int64_t n_words = std::min<int64_t>(32, (data_end - data) / kWordSize);
+      int64_t n_skips = 0;
+      const auto words = reinterpret_cast<const BulkWordType*>(data);
+      for (int64_t i = 0; i < n_words - 3; i += 4) {
+        const auto a = words[i + 0];
+        const auto b = words[i + 1];
+        const auto c = words[i + 2];
+        const auto d = words[i + 3];
+        n_skips += !bulk_filter_.Matches(a) + !bulk_filter_.Matches(b) +
+                   !bulk_filter_.Matches(c) + !bulk_filter_.Matches(d);
+      }
+      return (n_skips * 4 + 1 >= n_words);
     }
-    return (n_skips * 4 + 1 >= n_words);
   }
 
   template <bool UseBulkFilter = true>
@@ -232,31 +260,55 @@ class Lexer {
     return nullptr;
   }
 
+  // Read as many lines as possible, return the end of the last complete line
+  // or nullptr if there is none
+  template <bool UseBulkFilter = true>
+  const char* ReadLines(const char* data, const char* data_end) {
+    const char* last_line_end = nullptr;
+    while (data < data_end) {
+      const char* line_end = ReadLine<UseBulkFilter>(data, data_end);
+      if (line_end == nullptr) {
+        // Cannot read any further
+        break;
+      }
+      DCHECK_GT(line_end, data);
+      data = last_line_end = line_end;
+    }
+    return last_line_end;
+  }
+
  protected:
   using BulkFilterType = internal::PreferredBulkFilterType<SpecializedOptions>;
-  using BulkWordType = typename BulkFilterType::WordType;
+  static constexpr bool kStructuralFilter =
+      internal::IsStructuralFilter<BulkFilterType>::value;
 
   const char* RunBulkFilter(const char* data, const char* data_end) {
-    while (true) {
-      if (ARROW_PREDICT_FALSE(static_cast<size_t>(data_end - data) <
-                              sizeof(BulkWordType))) {
-        if (ARROW_PREDICT_FALSE(data == data_end)) {
-          return nullptr;
+    if constexpr (kStructuralFilter) {
+      const char* next = bulk_filter_.FindNext(data, data_end);
+      return ARROW_PREDICT_FALSE(next == data_end) ? nullptr : next;
+    } else {
+      using BulkWordType = typename BulkFilterType::WordType;
+      while (true) {
+        if (ARROW_PREDICT_FALSE(static_cast<size_t>(data_end - data) <
+                                sizeof(BulkWordType))) {
+          if (ARROW_PREDICT_FALSE(data == data_end)) {
+            return nullptr;
+          }
+          return data;
         }
-        return data;
-      }
-      BulkWordType word;
-      memcpy(&word, data, sizeof(BulkWordType));
-      if (bulk_filter_.Matches(word)) {
-        return data;
+        BulkWordType word;
+        memcpy(&word, data, sizeof(BulkWordType));
+        if (bulk_filter_.Matches(word)) {
+          return data;
+        }
+        // No special chars
+        data += sizeof(BulkWordType);
       }
-      // No special chars
-      data += sizeof(BulkWordType);
     }
   }
 
   const ParseOptions& options_;
-  const BulkFilterType bulk_filter_;
+  BulkFilterType bulk_filter_;
   State state_ = FIELD_START;
 };
 
@@ -308,23 +360,13 @@ class LexingBoundaryFinder : public BoundaryFinder {
 
   template <bool UseBulkFilter>
   Status FindLastInternal(std::string_view block, int64_t* out_pos) {
-    const char* data = block.data();
-    const char* const data_end = block.data() + block.size();
-
-    while (data < data_end) {
-      const char* line_end = lexer_.template ReadLine<UseBulkFilter>(data, data_end);
-      if (line_end == nullptr) {
-        // Cannot read any further
-        break;
-      }
-      DCHECK_GT(line_end, data);
-      data = line_end;
-    }
-    if (data == block.data()) {
+    const char* line_end = lexer_.template ReadLines<UseBulkFilter>(
+        block.data(), block.data() + block.size());
+    if (line_end == nullptr) {
       // No complete CSV line
       *out_pos = -1;
     } else {
-      *out_pos = static_cast<int64_t>(data - block.data());
+      *out_pos = static_cast<int64_t>(line_end - block.data());
       DCHECK_GT(*out_pos, 0);
     }
     return Status::OK();
@@ -369,28 +411,203 @@ class LexingBoundaryFinder : public BoundaryFinder {
   Lexer<SpecializedOptions> lexer_;
 };
 
+// A LexingBoundaryFinder that lexes large blocks on several threads.
+//
+// The block is cut into segments just after unescaped newlines.  At such a cut,
+// the lexer can only be at the start of a line or, if quoting is enabled, inside
+// a quoted field.  Each segment but the first is therefore lexed speculatively
+// under both hypotheses, in parallel; once the state at the end of the preceding
+// segment is known, the matching hypothesis is kept and the other is discarded.
+template <typename SpecializedOptions>
+class ParallelLexingBoundaryFinder : public LexingBoundaryFinder<SpecializedOptions> {
+ public:
+  ParallelLexingBoundaryFinder(ParseOptions options,
+                               ::arrow::internal::Executor* executor)
+      : Base(std::move(options)), executor_(executor) {}
+
+  Status FindLast(std::string_view block, int64_t* out_pos) override {
+    const auto segments = SplitBlock(block);
+    if (segments.size() < 2) {
+      return Base::FindLast(block, out_pos);
+    }
+
+    // The first segment starts at the start of a line, the others are lexed
+    // under all hypotheses
+    const int num_tasks = 1 + static_cast<int>(segments.size() - 1) * kNumHypotheses;
+    std::vector<SegmentResult> results(num_tasks);
+    RunTasks(num_tasks, [&](int task) {
+      const size_t segment = task == 0 ? 0 : 1 + (task - 1) / kNumHypotheses;
+      const State state = task == 0 ? LexerType::FIELD_START
+                                    : kHypotheses[(task - 1) % kNumHypotheses];
+      results[task] = LexSegment(segments[segment], state);
+    });
+
+    // Chain the segments, keeping the hypotheses that turned out right
+    State state = LexerType::FIELD_START;
+    const char* last_line_end = nullptr;
+    for (size_t segment = 0; segment < segments.size(); ++segment) {
+      SegmentResult result;
+      bool found = false;
+      for (int i = 0; i < (segment == 0 ? 1 : kNumHypotheses); ++i) {
+        const auto& candidate =
+            results[segment == 0 ? 0 : 1 + (segment - 1) * kNumHypotheses + i];
+        if (candidate.start_state == state) {
+          result = candidate;
+          found = true;
+          break;
+        }
+      }
+      if (!found) {
+        // Should not happen given where segments are cut, but stay correct
+        result = LexSegment(segments[segment], state);
+      }
+      if (result.last_line_end != nullptr) {
+        last_line_end = result.last_line_end;
+      }
+      state = result.end_state;
+    }
+
+    if (last_line_end == nullptr) {
+      // No complete CSV line
+      *out_pos = -1;
+    } else {
+      *out_pos = static_cast<int64_t>(last_line_end - block.data());
+      DCHECK_GT(*out_pos, 0);
+    }
+    return Status::OK();
+  }
+
+ protected:
+  using Base = LexingBoundaryFinder<SpecializedOptions>;
+  using LexerType = Lexer<SpecializedOptions>;
+  using State = typename LexerType::State;
+
+  // Segments smaller than this are not worth a separate task
+  static constexpr int64_t kMinSegmentSize = 128 * 1024;
+  static constexpr int kNumHypotheses = SpecializedOptions::quoting ? 2 : 1;
+  static constexpr State kHypotheses[2] = {LexerType::FIELD_START,
+                                           LexerType::IN_QUOTED_FIELD};
+
+  struct SegmentResult {
+    State start_state;
+    State end_state;
+    const char* last_line_end;
+  };
+
+  std::vector<std::string_view> SplitBlock(std::string_view block) const {
+    std::vector<std::string_view> segments;
+    const int64_t num_segments = std::min<int64_t>(
+        executor_->GetCapacity(), static_cast<int64_t>(block.size()) / kMinSegmentSize);
+    size_t start = 0;
+    for (int64_t i = 1; i < num_segments; ++i) {
+      size_t pos = std::max(start, static_cast<size_t>(block.size() * i / num_segments));
+      // A newline preceded by an escape char may be escaped itself
+      while ((pos = block.find('\n', pos)) != std::string_view::npos &&
+             SpecializedOptions::escaping && pos > start &&
+             block[pos - 1] == this->options_.escape_char) {
+        ++pos;
+      }
+      if (pos == std::string_view::npos || pos + 1 >= block.size()) {
+        break;
+      }
+      segments.push_back(block.substr(start, pos + 1 - start));
+      start = pos + 1;
+    }
+    segments.push_back(block.substr(start));
+    return segments;
+  }
+
+  SegmentResult LexSegment(std::string_view segment, State start_state) const {
+    LexerType lexer(this->options_);
+    lexer.Reset(start_state);
+    const char* data = segment.data();
+    const char* data_end = segment.data() + segment.size();
+    SegmentResult result;
+    result.start_state = start_state;
+    if (lexer.ShouldUseBulkFilter(data, data_end)) {
+      result.last_line_end = lexer.template ReadLines<true>(data, data_end);
+    } else {
+      result.last_line_end = lexer.template ReadLines<false>(data, data_end);
+    }
+    result.end_state = lexer.state();
+    return result;
+  }
+
+  // Run tasks on the executor and on the calling thread.  The calling thread
+  // only waits for tasks that were already started, so that this is safe to
+  // call from one of the executor's threads.
+  void RunTasks(int num_tasks, const std::function<void(int)>& func) {
+    struct TaskState {
+      std::atomic<int> next_task{0};
+      std::mutex mutex;
+      std::condition_variable cv;
+      int num_finished = 0;
+    };
+    auto task_state = std::make_shared<TaskState>();
+    // `func` is only called for tasks claimed before all tasks are finished,
+    // hence while it is still alive
+    auto run_tasks = [task_state, num_tasks, &func]() {
+      int task;
+      while ((task = task_state->next_task.fetch_add(1)) < num_tasks) {
+        func(task);
+        std::lock_guard<std::mutex> lock(task_state->mutex);
+        if (++task_state->num_finished == num_tasks) {
+          task_state->cv.notify_one();
+        }
+      }
+    };
+    const int num_helpers = std::min(executor_->GetCapacity(), num_tasks) - 1;
+    for (int i = 0; i < num_helpers; ++i) {
+      if (!executor_->Spawn(run_tasks).ok()) {
+        // The remaining tasks will run on this thread
+        break;
+      }
+    }
+    run_tasks();
+    std::unique_lock<std::mutex> lock(task_state->mutex);
+    task_state->cv.wait(lock, [&] { return task_state->num_finished == num_tasks; });
+  }
+
+  ::arrow::internal::Executor* executor_;
+};
+
+template <typename SpecializedOptions>
+std::shared_ptr<BoundaryFinder> MakeLexingBoundaryFinder(
+    const ParseOptions& options, ::arrow::internal::Executor* executor) {
+  if (executor != nullptr && executor->GetCapacity() > 1) {
+    return std::make_shared<ParallelLexingBoundaryFinder<SpecializedOptions>>(options,
+                                                                              executor);
+  }
+  return std::make_shared<LexingBoundaryFinder<SpecializedOptions>>(options);
+}
+
 }  // namespace
 
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options) {
+  return MakeChunker(options, /*executor=*/nullptr);
+}
+
+std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options,
+                                     ::arrow::internal::Executor* executor) {
   std::shared_ptr<BoundaryFinder> delimiter;
   if (!options.newlines_in_values) {
     delimiter = MakeNewlineBoundaryFinder();
   } else {
     if (options.quoting) {
       if (options.escaping) {
-        delimiter = std::make_shared<
-            LexingBoundaryFinder<internal::SpecializedOptions<true, true>>>(options);
+        delimiter = MakeLexingBoundaryFinder<internal::SpecializedOptions<true, true>>(
+            options, executor);
       } else {
-        delimiter = std::make_shared<
-            LexingBoundaryFinder<internal::SpecializedOptions<true, false>>>(options);
+        delimiter = MakeLexingBoundaryFinder<internal::SpecializedOptions<true, false>>(
+            options, executor);
       }
     } else {
       if (options.escaping) {
-        delimiter = std::make_shared<
-            LexingBoundaryFinder<internal::SpecializedOptions<false, true>>>(options);
+        delimiter = MakeLexingBoundaryFinder<internal::SpecializedOptions<false, true>>(
+            options, executor);
       } else {
-        delimiter = std::make_shared<
-            LexingBoundaryFinder<internal::SpecializedOptions<false, false>>>(options);
+        delimiter = MakeLexingBoundaryFinder<internal::SpecializedOptions<false, false>>(
+            options, executor);
       }
     }
   }
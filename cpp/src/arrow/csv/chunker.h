@@ -24,6 +24,7 @@
 #include "arrow/status.h"
 #include "arrow/util/delimiting.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -32,5 +33,13 @@ namespace csv {
 ARROW_EXPORT
 std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options);
 
+/// \brief Make a chunker that may find block boundaries on several threads
+///
+/// If `options.newlines_in_values` is true, large blocks are lexed in parallel
+/// on `executor`, speculating on the quoting state where they are cut.
+ARROW_EXPORT
+std::unique_ptr<Chunker> MakeChunker(const ParseOptions& options,
+                                     ::arrow::internal::Executor* executor);
+
 }  // namespace csv
 }  // namespace arrow
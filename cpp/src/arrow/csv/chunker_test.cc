@@ -18,6 +18,7 @@
 #include <cstdint>
 #include <memory>
 #include <numeric>
+#include <random>
 #include <string>
 
 #include <gtest/gtest.h>
@@ -27,6 +28,7 @@
 #include "arrow/csv/options.h"
 #include "arrow/csv/test_common.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace csv {
@@ -379,5 +381,62 @@ TEST_P(BaseChunkerTest, ParseSkip) {
   }
 }
 
+// Make a large CSV block where many values contain newlines, quoted or escaped
+std::string MakeCSVWithNewlines(const ParseOptions& options, int64_t min_size) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> kind_dist(0, 5);
+  std::uniform_int_distribution<int> len_dist(0, 40);
+  std::string csv;
+  while (static_cast<int64_t>(csv.size()) < min_size) {
+    for (int col = 0; col < 4; ++col) {
+      if (col > 0) csv += options.delimiter;
+      const int kind = kind_dist(gen);
+      const std::string text(len_dist(gen), 'x');
+      if (options.quoting && kind == 0) {
+        csv += "\"" + text + "\n\"\"\n" + text + "\"";
+      } else if (options.quoting && kind == 1) {
+        csv += "\"" + text + "\"";
+      } else if (options.escaping && kind == 2) {
+        csv += text + options.escape_char + "\n" + options.escape_char +
+               options.escape_char + text;
+      } else {
+        csv += text;
+      }
+    }
+    csv += (kind_dist(gen) == 0) ? "\r\n" : "\n";
+  }
+  return csv;
+}
+
+class ParallelChunkerTest : public ::testing::TestWithParam<std::pair<bool, bool>> {};
+
+INSTANTIATE_TEST_SUITE_P(ParallelChunkerTest, ParallelChunkerTest,
+                         ::testing::Values(std::make_pair(false, false),
+                                           std::make_pair(false, true),
+                                           std::make_pair(true, false),
+                                           std::make_pair(true, true)));
+
+TEST_P(ParallelChunkerTest, SameAsSerial) {
+  auto options = ParseOptions::Defaults();
+  options.newlines_in_values = true;
+  options.quoting = GetParam().first;
+  options.escaping = GetParam().second;
+  ASSERT_OK_AND_ASSIGN(auto pool, ::arrow::internal::ThreadPool::Make(4));
+  auto serial_chunker = MakeChunker(options);
+  auto parallel_chunker = MakeChunker(options, pool.get());
+
+  const auto csv = MakeCSVWithNewlines(options, /*min_size=*/1 << 20);
+  auto buffer = std::make_shared<Buffer>(csv);
+  // Cut the block at various places, so that it ends in various lexing states
+  for (int64_t size = buffer->size(); size > (1 << 19); size -= 12345) {
+    auto block = SliceBuffer(buffer, 0, size);
+    std::shared_ptr<Buffer> expected_whole, expected_partial, whole, partial;
+    ASSERT_OK(serial_chunker->Process(block, &expected_whole, &expected_partial));
+    ASSERT_OK(parallel_chunker->Process(block, &whole, &partial));
+    ASSERT_EQ(whole->size(), expected_whole->size()) << "block size " << size;
+    ASSERT_EQ(partial->size(), expected_partial->size());
+  }
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -49,8 +49,12 @@ class BlockParser;
 class ConcreteColumnBuilder : public ColumnBuilder {
  public:
   explicit ConcreteColumnBuilder(MemoryPool* pool, std::shared_ptr<TaskGroup> task_group,
-                                 int32_t col_index = -1)
-      : ColumnBuilder(std::move(task_group)), pool_(pool), col_index_(col_index) {}
+                                 int32_t col_index = -1,
+                                 bool shared_dictionaries = false)
+      : ColumnBuilder(std::move(task_group)),
+        pool_(pool),
+        col_index_(col_index),
+        shared_dictionaries_(shared_dictionaries) {}
 
   void Append(const std::shared_ptr<BlockParser>& parser) override {
     Insert(static_cast<int64_t>(chunks_.size()), parser);
@@ -73,9 +77,30 @@ class ConcreteColumnBuilder : public ColumnBuilder {
       }
       DCHECK_EQ(chunk->type()->id(), type->id()) << "Chunk types not equal!";
     }
+    if (shared_dictionaries_ && type->id() == Type::DICTIONARY) {
+      ShareLongestDictionary();
+    }
     return std::make_shared<ChunkedArray>(chunks_, std::move(type));
   }
 
+  // All chunk dictionaries are prefixes of the longest one: give it to all chunks
+  void ShareLongestDictionary() {
+    std::shared_ptr<ArrayData> longest;
+    for (const auto& chunk : chunks_) {
+      const auto& dictionary = chunk->data()->dictionary;
+      if (longest == nullptr || dictionary->length > longest->length) {
+        longest = dictionary;
+      }
+    }
+    for (auto& chunk : chunks_) {
+      if (chunk->data()->dictionary != longest) {
+        auto data = chunk->data()->Copy();
+        data->dictionary = longest;
+        chunk = MakeArray(std::move(data));
+      }
+    }
+  }
+
   void ReserveChunks(int64_t block_index) {
     // Create a null Array pointer at the back at the list.
     std::lock_guard<std::mutex> lock(mutex_);
@@ -120,6 +145,8 @@ class ConcreteColumnBuilder : public ColumnBuilder {
 
   MemoryPool* pool_;
   int32_t col_index_;
+  // Whether dictionary chunks were converted with a shared dictionary
+  bool shared_dictionaries_;
 
   ArrayVector chunks_;
 
@@ -170,7 +197,7 @@ class TypedColumnBuilder : public ConcreteColumnBuilder {
   TypedColumnBuilder(const std::shared_ptr<DataType>& type, int32_t col_index,
                      const ConvertOptions& options, MemoryPool* pool,
                      const std::shared_ptr<TaskGroup>& task_group)
-      : ConcreteColumnBuilder(pool, task_group, col_index),
+      : ConcreteColumnBuilder(pool, task_group, col_index, options.shared_dictionaries),
         type_(type),
         options_(options) {}
 
@@ -213,7 +240,7 @@ class InferringColumnBuilder : public ConcreteColumnBuilder {
  public:
   InferringColumnBuilder(int32_t col_index, const ConvertOptions& options,
                          MemoryPool* pool, const std::shared_ptr<TaskGroup>& task_group)
-      : ConcreteColumnBuilder(pool, task_group, col_index),
+      : ConcreteColumnBuilder(pool, task_group, col_index, options.shared_dictionaries),
         options_(options),
         infer_status_(options) {}
 
@@ -690,5 +690,40 @@ TEST_F(InferringColumnBuilderTest, SingleChunkBinaryAutoDict) {
                        {expected_dictionary});
 }
 
+TEST_F(InferringColumnBuilderTest, MultipleChunkSharedAutoDict) {
+  auto options = ConvertOptions::Defaults();
+  options.auto_dict_encode = true;
+  options.auto_dict_max_cardinality = 3;
+  options.shared_dictionaries = true;
+
+  ChunkData csv_data = {{"ab", "cd", "ab"}, {"ef", "cd"}};
+  auto expected_dictionary = ArrayFromJSON(utf8(), R"(["ab", "cd", "ef"])");
+  CheckAutoDictEncoded(TaskGroup::MakeSerial(), csv_data, options,
+                       {ArrayFromJSON(int32(), "[0, 1, 0]"),
+                        ArrayFromJSON(int32(), "[2, 1]")},
+                       {expected_dictionary, expected_dictionary});
+
+  // All chunks get the same dictionary, whatever the conversion order
+  std::shared_ptr<ColumnBuilder> builder;
+  std::shared_ptr<ChunkedArray> actual;
+  ASSERT_OK_AND_ASSIGN(builder, ColumnBuilder::Make(default_memory_pool(), 0, options,
+                                                    TaskGroup::MakeThreaded(
+                                                        GetCpuThreadPool())));
+  AssertBuilding(builder, {{"ab"}, {"cd", "ab"}, {"ef"}, {"ab", "ef"}}, &actual);
+  ASSERT_EQ(actual->num_chunks(), 4);
+  const auto& dictionary = actual->chunk(0)->data()->dictionary;
+  ASSERT_EQ(dictionary->length, 3);
+  for (int i = 1; i < actual->num_chunks(); ++i) {
+    ASSERT_EQ(actual->chunk(i)->data()->dictionary, dictionary);
+  }
+
+  // The max cardinality applies to the whole column
+  options.auto_dict_max_cardinality = 2;
+  std::shared_ptr<ChunkedArray> expected;
+  ChunkedArrayFromVector<StringType, std::string>({{"ab", "cd", "ab"}, {"ef", "cd"}},
+                                                  &expected);
+  CheckInferred(TaskGroup::MakeSerial(), csv_data, options, expected);
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -213,7 +213,6 @@ Future<std::shared_ptr<Array>> InferringColumnDecoder::Decode(
   // without blocking a worker thread.
   return first_inference_run_.Then([this, parser] {
     DCHECK(type_frozen_);
-    auto maybe_array = converter_->Convert(*parser, col_index_);
     return WrapConversionError(converter_->Convert(*parser, col_index_));
   });
 }
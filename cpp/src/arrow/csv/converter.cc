@@ -20,22 +20,29 @@
 #include <array>
 #include <cstring>
 #include <limits>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array/array_dict.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_decimal.h"
 #include "arrow/array/builder_dict.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/buffer.h"
 #include "arrow/csv/parser.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/binary_view_util.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/trie.h"
 #include "arrow/util/utf8_internal.h"
 #include "arrow/util/value_parsing.h"  // IWYU pragma: keep
@@ -97,12 +104,7 @@ Status InitializeTrie(const std::vector<std::string>& inputs, Trie* trie) {
 // Presize a builder based on parser contents
 template <typename BuilderType>
 Status PresizeBuilder(const BlockParser& parser, BuilderType* builder) {
-  RETURN_NOT_OK(builder->Resize(parser.num_rows()));
-  if constexpr (is_base_binary_type<typename BuilderType::TypeClass>::value) {
-    return builder->ReserveData(parser.num_bytes());
-  } else {
-    return Status::OK();
-  }
+  return builder->ReserveHint(parser.num_rows(), parser.num_bytes());
 }
 
 /////////////////////////////////////////////////////////////////////////
@@ -557,6 +559,68 @@ class PrimitiveConverter : public ConcreteConverter {
   ValueDecoderType decoder_;
 };
 
+//
+// Concrete Converter for binary views
+//
+
+// Views point directly into the parser's buffer of (already unescaped) values,
+// which the resulting array holds on to instead of copying the data.
+
+template <bool CheckUTF8>
+class BinaryViewConverter : public ConcreteConverter {
+ public:
+  BinaryViewConverter(const std::shared_ptr<DataType>& type,
+                      const ConvertOptions& options, MemoryPool* pool)
+      : ConcreteConverter(type, options, pool), decoder_(type_, options_) {}
+
+  Result<std::shared_ptr<Array>> Convert(const BlockParser& parser,
+                                         int32_t col_index) override {
+    using c_type = BinaryViewType::c_type;
+
+    const int64_t length = parser.num_rows();
+    ARROW_ASSIGN_OR_RAISE(auto views, AllocateBuffer(length * sizeof(c_type), pool_));
+    ARROW_ASSIGN_OR_RAISE(auto validity, AllocateEmptyBitmap(length, pool_));
+    auto out_views = views->mutable_data_as<c_type>();
+    uint8_t* out_validity = validity->mutable_data();
+
+    const std::shared_ptr<Buffer>& parsed = parser.parsed_buffer();
+    int64_t index = 0;
+    int64_t null_count = 0;
+    bool references_parsed = false;
+
+    auto visit = [&](const uint8_t* data, uint32_t size, bool quoted) -> Status {
+      if (decoder_.IsNull(data, size, quoted)) {
+        std::memset(&out_views[index++], 0, sizeof(c_type));
+        ++null_count;
+        return Status::OK();
+      }
+      std::string_view value;
+      RETURN_NOT_OK(decoder_.Decode(data, size, quoted, &value));
+      bit_util::SetBit(out_validity, index);
+      out_views[index++] =
+          util::ToBinaryView(data, static_cast<int32_t>(size), /*buffer_index=*/0,
+                             static_cast<int32_t>(data - parsed->data()));
+      references_parsed |= size > BinaryViewType::kInlineSize;
+      return Status::OK();
+    };
+    RETURN_NOT_OK(parser.VisitColumn(col_index, visit));
+    DCHECK_EQ(index, length);
+
+    BufferVector buffers = {null_count > 0 ? std::move(validity) : nullptr,
+                            std::move(views)};
+    // Only retain the parsed block if some values are not inlined
+    if (references_parsed) {
+      buffers.push_back(parsed);
+    }
+    return MakeArray(ArrayData::Make(type_, length, std::move(buffers), null_count));
+  }
+
+ protected:
+  Status Initialize() override { return decoder_.Initialize(); }
+
+  BinaryValueDecoder<CheckUTF8> decoder_;
+};
+
 //
 // Concrete Converter for dictionaries
 //
@@ -593,19 +657,67 @@ class TypedDictionaryConverter : public ConcreteDictionaryConverter {
 
     std::shared_ptr<Array> res;
     RETURN_NOT_OK(builder.Finish(&res));
+    if (options_.shared_dictionaries) {
+      return ShareDictionary(checked_cast<const DictionaryArray&>(*res));
+    }
     return res;
   }
 
   void SetMaxCardinality(int32_t max_length) override { max_cardinality_ = max_length; }
 
  protected:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
   Status Initialize() override {
     util::InitializeUTF8();
+    if (options_.shared_dictionaries) {
+      shared_memo_table_ =
+          std::make_unique<::arrow::internal::DictionaryMemoTable>(pool_, value_type_);
+    }
     return decoder_.Initialize();
   }
 
+  // Intern the values of a chunk's dictionary in the dictionary shared by all
+  // chunks, and rewrite the chunk's indices accordingly.  The chunk gets the
+  // shared dictionary as it is after interning, hence a prefix of the final one.
+  Result<std::shared_ptr<Array>> ShareDictionary(const DictionaryArray& chunk) {
+    const auto& chunk_dictionary = checked_cast<const ArrayType&>(*chunk.dictionary());
+    std::vector<int32_t> transpose_map(chunk_dictionary.length());
+    bool is_identity = true;
+    std::shared_ptr<Array> dictionary;
+    {
+      std::lock_guard<std::mutex> lock(shared_mutex_);
+      for (int64_t i = 0; i < chunk_dictionary.length(); ++i) {
+        RETURN_NOT_OK(shared_memo_table_->GetOrInsert<T>(chunk_dictionary.GetView(i),
+                                                         &transpose_map[i]));
+        is_identity &= transpose_map[i] == i;
+      }
+      if (ARROW_PREDICT_FALSE(shared_memo_table_->size() > max_cardinality_)) {
+        return Status::IndexError("Dictionary length exceeded max cardinality");
+      }
+      if (shared_dictionary_ == nullptr ||
+          shared_dictionary_->length() != shared_memo_table_->size()) {
+        std::shared_ptr<ArrayData> data;
+        RETURN_NOT_OK(shared_memo_table_->GetArrayData(0, &data));
+        shared_dictionary_ = MakeArray(std::move(data));
+      }
+      dictionary = shared_dictionary_;
+    }
+    if (is_identity) {
+      // Only the dictionary changes
+      auto data = chunk.data()->Copy();
+      data->dictionary = dictionary->data();
+      return MakeArray(std::move(data));
+    }
+    return chunk.Transpose(type_, dictionary, transpose_map.data(), pool_);
+  }
+
   ValueDecoderType decoder_;
   int32_t max_cardinality_ = std::numeric_limits<int32_t>::max();
+
+  std::mutex shared_mutex_;
+  std::unique_ptr<::arrow::internal::DictionaryMemoTable> shared_memo_table_;
+  std::shared_ptr<Array> shared_dictionary_;
 };
 
 //
@@ -736,6 +848,16 @@ Result<std::shared_ptr<Converter>> Converter::Make(const std::shared_ptr<DataTyp
       }
       break;
 
+    CONVERTER_CASE(Type::BINARY_VIEW, BinaryViewConverter<false>)
+
+    case Type::STRING_VIEW:
+      if (options.check_utf8) {
+        ptr = std::make_shared<BinaryViewConverter<true>>(type, options, pool);
+      } else {
+        ptr = std::make_shared<BinaryViewConverter<false>>(type, options, pool);
+      }
+      break;
+
     case Type::DICTIONARY: {
       const auto& dict_type = checked_cast<const DictionaryType&>(*type);
       if (dict_type.index_type()->id() != Type::INT32) {
@@ -231,7 +231,7 @@ class BinaryConversionTest : public BinaryConversionTestBase<T> {
   }
 };
 
-using BinaryTestTypes = ::testing::Types<BinaryType, LargeBinaryType>;
+using BinaryTestTypes = ::testing::Types<BinaryType, LargeBinaryType, BinaryViewType>;
 
 TYPED_TEST_SUITE(BinaryConversionTest, BinaryTestTypes);
 
@@ -263,7 +263,7 @@ class StringConversionTest : public BinaryConversionTestBase<T> {
   }
 };
 
-using StringTestTypes = ::testing::Types<StringType, LargeStringType>;
+using StringTestTypes = ::testing::Types<StringType, LargeStringType, StringViewType>;
 
 TYPED_TEST_SUITE(StringConversionTest, StringTestTypes);
 
@@ -275,6 +275,35 @@ TYPED_TEST(StringConversionTest, CustomNulls) { this->TestCustomNulls(); }
 
 TYPED_TEST(StringConversionTest, InvalidUtf8) { this->TestInvalidUtf8(); }
 
+TEST(StringViewConversion, ReferencesParsedBlock) {
+  std::shared_ptr<BlockParser> parser;
+  std::shared_ptr<Array> expected;
+  MakeCSVParser({"ab,\"a long value with \"\"escaped\"\" quotes\"\n",
+                 "\"quoted short\",another long unquoted value\n"},
+                &parser);
+  auto options = ConvertOptions::Defaults();
+  ASSERT_OK_AND_ASSIGN(auto converter, Converter::Make(utf8_view(), options));
+
+  // All values are inlined: the parsed block is not retained
+  ASSERT_OK_AND_ASSIGN(auto array, converter->Convert(*parser, 0));
+  ASSERT_OK(array->ValidateFull());
+  ArrayFromVector<StringViewType, std::string>(utf8_view(), {"ab", "quoted short"},
+                                               &expected);
+  AssertArraysEqual(*expected, *array);
+  ASSERT_EQ(array->data()->buffers.size(), 2);
+
+  // Long values point into the parsed block, including unescaped ones
+  ASSERT_OK_AND_ASSIGN(array, converter->Convert(*parser, 1));
+  ASSERT_OK(array->ValidateFull());
+  ArrayFromVector<StringViewType, std::string>(
+      utf8_view(),
+      {"a long value with \"escaped\" quotes", "another long unquoted value"},
+      &expected);
+  AssertArraysEqual(*expected, *array);
+  ASSERT_EQ(array->data()->buffers.size(), 3);
+  ASSERT_EQ(array->data()->buffers[2], parser->parsed_buffer());
+}
+
 TEST(FixedSizeBinaryConversion, Basics) {
   AssertConversion<FixedSizeBinaryType, std::string>(
       fixed_size_binary(2), {"ab,cd\n", "gh,ij\n"}, {{"ab", "gh"}, {"cd", "ij"}});
@@ -18,8 +18,10 @@
 #pragma once
 
 #include <cstdint>
+#include <type_traits>
 
 #include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/simd.h"
 
 namespace arrow {
@@ -119,90 +121,137 @@ class BloomFilter4B : public BaseBloomFilter {
   }
 };
 
-#if defined(ARROW_HAVE_SSE4_2)
+// Whether a bulk filter finds the exact position of the special chars
+template <typename BulkFilter>
+struct IsStructuralFilter : std::false_type {};
 
-// SSE4.2 filter: 8 bytes at a time, using packed compare instruction
+#if defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
 
-// NOTE: on SVE, could use svmatch[_u8] for similar functionality.
+// Structural filter: 64 bytes at a time, computing a bitmask of the special
+// chars (bit N is set if byte N is special).  The mask of the current block is
+// kept, so that the parser jumps from one special char to the next without
+// scanning the data again, however often the filter matches.
 
 template <typename SpecializedOptions>
-class SSE42Filter {
+class StructuralFilter {
  public:
-  using WordType = uint64_t;
-
-  explicit SSE42Filter(const ParseOptions& options) : filter_(MakeFilter(options)) {}
-
-  bool Matches(WordType w) const {
-    // Look up every byte in `w` in the SIMD filter.
-    return _mm_cmpistrc(_mm_set1_epi64x(w), filter_,
-                        _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY);
+  static constexpr int64_t kBlockSize = 64;
+
+  explicit StructuralFilter(const ParseOptions& options)
+      : delim_(options.delimiter),
+        quote_(SpecializedOptions::quoting ? options.quote_char : '\n'),
+        escape_(SpecializedOptions::escaping ? options.escape_char : '\n') {}
+
+  // Forget the current block, before scanning data which may reuse its memory
+  void Reset() { block_ = nullptr; }
+
+  // Return the first special char at or after `data`, or the start of the
+  // trailing partial block if there is none before it.
+  const char* FindNext(const char* data, const char* data_end) {
+    while (true) {
+      // The cached block may have been scanned for a longer buffer
+      if (block_ == nullptr || data < block_ || data - block_ >= kBlockSize ||
+          data_end - block_ < kBlockSize) {
+        if (data_end - data < kBlockSize) {
+          return data;
+        }
+        block_ = data;
+        mask_ = Scan(data);
+      }
+      const uint64_t mask = mask_ & (~static_cast<uint64_t>(0) << (data - block_));
+      if (mask != 0) {
+        return block_ + bit_util::CountTrailingZeros(mask);
+      }
+      data = block_ + kBlockSize;
+    }
   }
 
- protected:
-  using BulkFilterType = __m128i;
-
-  BulkFilterType MakeFilter(const ParseOptions& options) {
-    // Make a SIMD word of the characters we want to match
-    const char cr = '\r';
-    const char lf = '\n';
-    const char delim = options.delimiter;
-    const char quote = SpecializedOptions::quoting ? options.quote_char : cr;
-    const char escape = SpecializedOptions::escaping ? options.escape_char : cr;
-
-    return _mm_set_epi8(delim, quote, escape, lf, cr, cr, cr, cr, cr, cr, cr, cr, cr, cr,
-                        cr, cr);
+ private:
+#if defined(ARROW_HAVE_AVX2)
+  uint64_t Scan(const char* data) const {
+    return Scan32(data) | (Scan32(data + 32) << 32);
   }
 
-  const BulkFilterType filter_;
-};
-
-#elif defined(ARROW_HAVE_NEON)
+  uint64_t Scan32(const char* data) const {
+    const __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    __m256i v = _mm256_cmpeq_epi8(w, _mm256_set1_epi8('\r'));
+    v = _mm256_or_si256(v, _mm256_cmpeq_epi8(w, _mm256_set1_epi8('\n')));
+    v = _mm256_or_si256(v, _mm256_cmpeq_epi8(w, _mm256_set1_epi8(delim_)));
+    if (SpecializedOptions::quoting) {
+      v = _mm256_or_si256(v, _mm256_cmpeq_epi8(w, _mm256_set1_epi8(quote_)));
+    }
+    if (SpecializedOptions::escaping) {
+      v = _mm256_or_si256(v, _mm256_cmpeq_epi8(w, _mm256_set1_epi8(escape_)));
+    }
+    return static_cast<uint32_t>(_mm256_movemask_epi8(v));
+  }
+#elif defined(ARROW_HAVE_SSE4_2)
+  uint64_t Scan(const char* data) const {
+    return Scan16(data) | (Scan16(data + 16) << 16) | (Scan16(data + 32) << 32) |
+           (Scan16(data + 48) << 48);
+  }
 
-// NEON filter: 8 bytes at a time, comparing with all special chars.
-// We could filter 16 bytes at a time but that actually decreases performance,
-// because the filter matches too often on mid-sized cell values.
+  uint64_t Scan16(const char* data) const {
+    const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    __m128i v = _mm_cmpeq_epi8(w, _mm_set1_epi8('\r'));
+    v = _mm_or_si128(v, _mm_cmpeq_epi8(w, _mm_set1_epi8('\n')));
+    v = _mm_or_si128(v, _mm_cmpeq_epi8(w, _mm_set1_epi8(delim_)));
+    if (SpecializedOptions::quoting) {
+      v = _mm_or_si128(v, _mm_cmpeq_epi8(w, _mm_set1_epi8(quote_)));
+    }
+    if (SpecializedOptions::escaping) {
+      v = _mm_or_si128(v, _mm_cmpeq_epi8(w, _mm_set1_epi8(escape_)));
+    }
+    return static_cast<uint16_t>(_mm_movemask_epi8(v));
+  }
+#else
+  uint64_t Scan(const char* data) const {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data);
+    // Keep one bit of each byte, then add up neighbouring bytes until
+    // each byte of the first lane holds the bits of 8 bytes
+    static const uint8_t kBits[16] = {1, 2, 4, 8, 16, 32, 64, 128,
+                                      1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t bits = vld1q_u8(kBits);
+    const uint8x16_t m0 = vandq_u8(Scan16(bytes), bits);
+    const uint8x16_t m1 = vandq_u8(Scan16(bytes + 16), bits);
+    const uint8x16_t m2 = vandq_u8(Scan16(bytes + 32), bits);
+    const uint8x16_t m3 = vandq_u8(Scan16(bytes + 48), bits);
+    uint8x16_t sum = vpaddq_u8(vpaddq_u8(m0, m1), vpaddq_u8(m2, m3));
+    sum = vpaddq_u8(sum, sum);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+  }
 
-template <typename SpecializedOptions>
-class NeonFilter {
- public:
-  // NOTE we cannot use xsimd as it doesn't expose the 64-bit Neon types,
-  // only 128-bit.
-  using WordType = uint8x8_t;
-
-  explicit NeonFilter(const ParseOptions& options)
-      : delim_(vdup_n_u8(options.delimiter)),
-        quote_(vdup_n_u8(SpecializedOptions::quoting ? options.quote_char : '\n')),
-        escape_(vdup_n_u8(SpecializedOptions::escaping ? options.escape_char : '\n')) {}
-
-  bool Matches(WordType w) const {
-    uint8x8_t v;
-    v = vceq_u8(w, vdup_n_u8('\r'));
-    v = vorr_u8(v, vceq_u8(w, vdup_n_u8('\n')));
-    v = vorr_u8(v, vceq_u8(w, delim_));
+  uint8x16_t Scan16(const uint8_t* data) const {
+    const uint8x16_t w = vld1q_u8(data);
+    uint8x16_t v = vceqq_u8(w, vdupq_n_u8('\r'));
+    v = vorrq_u8(v, vceqq_u8(w, vdupq_n_u8('\n')));
+    v = vorrq_u8(v, vceqq_u8(w, vdupq_n_u8(static_cast<uint8_t>(delim_))));
     if (SpecializedOptions::quoting) {
-      v = vorr_u8(v, vceq_u8(w, quote_));
+      v = vorrq_u8(v, vceqq_u8(w, vdupq_n_u8(static_cast<uint8_t>(quote_))));
     }
     if (SpecializedOptions::escaping) {
-      v = vorr_u8(v, vceq_u8(w, escape_));
+      v = vorrq_u8(v, vceqq_u8(w, vdupq_n_u8(static_cast<uint8_t>(escape_))));
     }
-    uint64_t r;
-    vst1_u64(&r, vreinterpret_u64_u8(v));
-    return r != 0;
+    return v;
   }
+#endif
 
- private:
-  const uint8x8_t delim_, quote_, escape_;
+  const char delim_, quote_, escape_;
+  // The current block and the mask of its special chars
+  const char* block_ = nullptr;
+  uint64_t mask_ = 0;
 };
 
+template <typename SpecializedOptions>
+struct IsStructuralFilter<StructuralFilter<SpecializedOptions>> : std::true_type {};
+
 #endif
 
-#if defined(ARROW_HAVE_SSE4_2) && (defined(__x86_64__) || defined(_M_X64))
-// (the SSE4.2 filter seems to crash on RTools with 32-bit MinGW)
-template <typename SpecializedOptions>
-using PreferredBulkFilterType = SSE42Filter<SpecializedOptions>;
-#elif defined(ARROW_HAVE_NEON)
+#if (defined(ARROW_HAVE_SSE4_2) && (defined(__x86_64__) || defined(_M_X64))) || \
+    defined(ARROW_HAVE_NEON)
+// (SSE4.2 filters used to crash on RTools with 32-bit MinGW)
 template <typename SpecializedOptions>
-using PreferredBulkFilterType = NeonFilter<SpecializedOptions>;
+using PreferredBulkFilterType = StructuralFilter<SpecializedOptions>;
 #else
 template <typename SpecializedOptions>
 using PreferredBulkFilterType = BloomFilter4B<SpecializedOptions>;
@@ -104,6 +104,15 @@ struct ARROW_EXPORT ConvertOptions {
   bool auto_dict_encode = false;
   int32_t auto_dict_max_cardinality = 50;
 
+  /// Whether dictionary-encoded columns share a single dictionary across chunks.
+  ///
+  /// If true, the dictionary of each chunk of a dictionary-encoded column (whether
+  /// inferred or given in `column_types`) is a prefix of a dictionary built for
+  /// the whole column, so that all chunks of a table column end up with the same
+  /// dictionary, and `auto_dict_max_cardinality` applies to the whole column.
+  /// If false, each chunk gets its own dictionary.
+  bool shared_dictionaries = false;
+
   /// Decimal point character for floating-point and decimal data
   char decimal_point = '.';
 
@@ -209,6 +218,12 @@ struct ARROW_EXPORT WriteOptions {
   /// \brief Quoting style
   QuotingStyle quoting_style = QuotingStyle::Needed;
 
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, consecutive batches of `batch_size` rows are converted to CSV
+  /// concurrently, then written out in order.
+  bool use_threads = false;
+
   /// Create write options with default values
   static WriteOptions Defaults();
 
@@ -21,6 +21,7 @@
 #include <cstdio>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
@@ -88,9 +89,21 @@ class PresizedDataWriter {
     parsed_size_ += sizeof(w);
   }
 
+  void PushFieldBytes(const char* data, int64_t length) {
+    DCHECK_GE(parsed_capacity_ - parsed_size_, length);
+    memcpy(parsed_ + parsed_size_, data, length);
+    parsed_size_ += length;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
+  // Discard the data written after the given size
+  void Truncate(int64_t size) {
+    DCHECK_LE(size, parsed_size_);
+    parsed_size_ = size;
+  }
+
   int64_t size() { return parsed_size_; }
 
  protected:
@@ -126,6 +139,14 @@ class ValueDescWriter {
         {static_cast<uint32_t>(parsed_writer->size()) & 0x7fffffffU, quoted_});
   }
 
+  // Discard the data of a field whose value is not stored, so that the next
+  // stored value starts where the last one ended
+  template <typename DataWriter>
+  void SkipField(DataWriter* parsed_writer) {
+    DCHECK_GT(values_size_, 0);
+    parsed_writer->Truncate(values_[values_size_ - 1].offset);
+  }
+
   void Finish(std::shared_ptr<Buffer>* out_values) {
     ARROW_CHECK_OK(values_buffer_->Resize(values_size_ * sizeof(*values_)));
     *out_values = values_buffer_;
@@ -196,6 +217,27 @@ class BlockParserImpl {
 
   int64_t first_row_num() const { return first_row_; }
 
+  void SetColumnSelection(const std::vector<int32_t>& column_indices) {
+    DCHECK(std::all_of(column_indices.begin(), column_indices.end(),
+                       [](int32_t index) { return index >= 0; }));
+    const int32_t max_index =
+        column_indices.empty()
+            ? 0
+            : *std::max_element(column_indices.begin(), column_indices.end());
+    // Columns past the end of `column_slots_` are not stored either
+    column_slots_.assign(max_index + 1, -1);
+    for (int32_t index : column_indices) {
+      column_slots_[index] = 0;
+    }
+    int32_t slot = 0;
+    for (auto& column_slot : column_slots_) {
+      if (column_slot == 0) {
+        column_slot = slot++;
+      }
+    }
+    batch_ = DataBatch{batch_.num_cols_, column_slots_};
+  }
+
   template <typename ValueDescWriter, typename DataWriter>
   Status HandleInvalidRow(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                           const char* start, const char* data, int32_t num_cols,
@@ -236,14 +278,22 @@ class BlockParserImpl {
             typename DataWriter, typename BulkFilter>
   Status ParseLine(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                    const char* data, const char* data_end, bool is_final,
-                   const char** out_data, const BulkFilter& bulk_filter) {
+                   const char** out_data, BulkFilter& bulk_filter) {
     int32_t num_cols = 0;
     char c;
     const auto start = data;
 
     DCHECK_GT(data_end, data);
 
-    auto FinishField = [&]() { values_writer->FinishField(parsed_writer); };
+    const int32_t num_column_slots = static_cast<int32_t>(column_slots_.size());
+    auto FinishField = [&]() {
+      if (ARROW_PREDICT_TRUE(num_column_slots == 0) ||
+          (num_cols < num_column_slots && column_slots_[num_cols] >= 0)) {
+        values_writer->FinishField(parsed_writer);
+      } else {
+        values_writer->SkipField(parsed_writer);
+      }
+    };
 
     values_writer->BeginLine();
     parsed_writer->BeginLine();
@@ -388,7 +438,7 @@ class BlockParserImpl {
     ++num_cols;
     if (ARROW_PREDICT_FALSE(num_cols != batch_.num_cols_)) {
       if (batch_.num_cols_ == -1) {
-        batch_.num_cols_ = num_cols;
+        batch_.SetNumColumns(num_cols);
       } else {
         return HandleInvalidRow(values_writer, parsed_writer, start, data, num_cols,
                                 out_data);
@@ -412,10 +462,10 @@ class BlockParserImpl {
     if (!options_.ignore_empty_lines) {
       if (batch_.num_cols_ == -1) {
         // Consider as single value
-        batch_.num_cols_ = 1;
+        batch_.SetNumColumns(1);
       }
       // Record as row of empty (null?) values
-      while (num_cols++ < batch_.num_cols_) {
+      for (; num_cols < batch_.num_cols_; ++num_cols) {
         values_writer->StartField(false /* quoted */);
         FinishField();
       }
@@ -428,24 +478,32 @@ class BlockParserImpl {
   template <typename DataWriter, typename SpecializedBulkFilter>
   const char* RunBulkFilter(DataWriter* data_writer, const char* data,
                             const char* data_end,
-                            const SpecializedBulkFilter& bulk_filter) {
-    while (true) {
-      using WordType = typename SpecializedBulkFilter::WordType;
-
-      if (ARROW_PREDICT_FALSE(static_cast<size_t>(data_end - data) < sizeof(WordType))) {
-        if (ARROW_PREDICT_FALSE(data == data_end)) {
-          return nullptr;
+                            SpecializedBulkFilter& bulk_filter) {
+    if constexpr (internal::IsStructuralFilter<SpecializedBulkFilter>::value) {
+      // Copy the field up to the next special char at once
+      const char* next = bulk_filter.FindNext(data, data_end);
+      data_writer->PushFieldBytes(data, next - data);
+      return ARROW_PREDICT_FALSE(next == data_end) ? nullptr : next;
+    } else {
+      while (true) {
+        using WordType = typename SpecializedBulkFilter::WordType;
+
+        if (ARROW_PREDICT_FALSE(static_cast<size_t>(data_end - data) <
+                                sizeof(WordType))) {
+          if (ARROW_PREDICT_FALSE(data == data_end)) {
+            return nullptr;
+          }
+          return data;
         }
-        return data;
-      }
-      WordType word;
-      memcpy(&word, data, sizeof(WordType));
-      if (bulk_filter.Matches(word)) {
-        return data;
+        WordType word;
+        memcpy(&word, data, sizeof(WordType));
+        if (bulk_filter.Matches(word)) {
+          return data;
+        }
+        // No special chars
+        data_writer->PushFieldWord(word);
+        data += sizeof(WordType);
       }
-      // No special chars
-      data_writer->PushFieldWord(word);
-      data += sizeof(WordType);
     }
   }
 
@@ -454,7 +512,7 @@ class BlockParserImpl {
   Status ParseChunk(ValueDescWriter* values_writer, DataWriter* parsed_writer,
                     const char* data, const char* data_end, bool is_final,
                     int32_t rows_in_chunk, const char** out_data, bool* finished_parsing,
-                    const BulkFilter& bulk_filter) {
+                    BulkFilter& bulk_filter) {
     const int32_t start_num_rows = batch_.num_rows_;
     const int32_t num_rows_deadline = batch_.num_rows_ + rows_in_chunk;
 
@@ -512,7 +570,7 @@ class BlockParserImpl {
                           uint32_t* out_size) {
     internal::PreferredBulkFilterType<SpecializedOptions> bulk_filter(options_);
 
-    batch_ = DataBatch{batch_.num_cols_};
+    batch_ = DataBatch{batch_.num_cols_, column_slots_};
     values_size_ = 0;
 
     size_t total_view_length = 0;
@@ -553,14 +611,16 @@ class BlockParserImpl {
 
         int32_t rows_in_chunk;
         constexpr int32_t kTargetChunkSize = 32768;  // in number of values
-        if (batch_.num_cols_ > 0) {
-          rows_in_chunk = std::min(std::max(kTargetChunkSize / batch_.num_cols_, 512),
-                                   max_num_rows_ - batch_.num_rows_);
+        if (batch_.num_stored_cols_ > 0) {
+          rows_in_chunk =
+              std::min(std::max(kTargetChunkSize / batch_.num_stored_cols_, 512),
+                       max_num_rows_ - batch_.num_rows_);
         } else {
           rows_in_chunk = std::min(kTargetChunkSize, max_num_rows_ - batch_.num_rows_);
         }
 
-        PresizedValueDescWriter values_writer(pool_, rows_in_chunk, batch_.num_cols_);
+        PresizedValueDescWriter values_writer(pool_, rows_in_chunk,
+                                              batch_.num_stored_cols_);
         values_writer.Start(parsed_writer);
 
         RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
@@ -584,7 +644,7 @@ class BlockParserImpl {
     if (batch_.num_cols_ == -1) {
       DCHECK_EQ(batch_.num_rows_, 0);
     }
-    DCHECK_EQ(values_size_, batch_.num_rows_ * batch_.num_cols_);
+    DCHECK_EQ(values_size_, batch_.num_rows_ * batch_.num_stored_cols_);
 #ifndef NDEBUG
     if (batch_.num_rows_ > 0) {
       // Ending parsed offset should be equal to number of parsed bytes
@@ -636,10 +696,28 @@ class BlockParserImpl {
 
   // Unparsed data size
   int32_t values_size_;
+  // Positions of the selected columns among stored values (see DataBatch)
+  std::vector<int32_t> column_slots_;
   // Parsed data batch
   DataBatch batch_;
 };
 
+namespace detail {
+
+void DataBatch::SetNumColumns(int32_t num_cols) {
+  num_cols_ = num_cols;
+  if (column_slots_.empty() || num_cols < 0) {
+    num_stored_cols_ = num_cols;
+    return;
+  }
+  const auto end = column_slots_.begin() +
+                   std::min(num_cols, static_cast<int32_t>(column_slots_.size()));
+  num_stored_cols_ = static_cast<int32_t>(
+      std::count_if(column_slots_.begin(), end, [](int32_t slot) { return slot >= 0; }));
+}
+
+}  // namespace detail
+
 BlockParser::BlockParser(ParseOptions options, int32_t num_cols, int64_t first_row,
                          int32_t max_num_rows)
     : BlockParser(default_memory_pool(), options, num_cols, first_row, max_num_rows) {}
@@ -672,6 +750,10 @@ const DataBatch& BlockParser::parsed_batch() const { return impl_->parsed_batch(
 
 int64_t BlockParser::first_row_num() const { return impl_->first_row_num(); }
 
+void BlockParser::SetColumnSelection(const std::vector<int32_t>& column_indices) {
+  impl_->SetColumnSelection(column_indices);
+}
+
 int32_t SkipRows(const uint8_t* data, uint32_t size, int32_t num_rows,
                  const uint8_t** out_data) {
   const auto end = data + size;
@@ -55,7 +55,10 @@ struct ParsedValueDesc {
 
 class ARROW_EXPORT DataBatch {
  public:
-  explicit DataBatch(int32_t num_cols) : num_cols_(num_cols) {}
+  explicit DataBatch(int32_t num_cols, std::vector<int32_t> column_slots = {})
+      : column_slots_(std::move(column_slots)) {
+    SetNumColumns(num_cols);
+  }
 
   /// \brief Return the number of parsed rows (not skipped)
   int32_t num_rows() const { return num_rows_; }
@@ -65,18 +68,24 @@ class ARROW_EXPORT DataBatch {
   uint32_t num_bytes() const { return parsed_size_; }
   /// \brief Return the number of skipped rows
   int32_t num_skipped_rows() const { return static_cast<int32_t>(skipped_rows_.size()); }
+  /// \brief Return the buffer holding the parsed values of all columns
+  const std::shared_ptr<Buffer>& parsed_buffer() const { return parsed_buffer_; }
 
   template <typename Visitor>
   Status VisitColumn(int32_t col_index, int64_t first_row, Visitor&& visit) const {
     using detail::ParsedValueDesc;
 
+    const int32_t slot = column_slot(col_index);
+    if (ARROW_PREDICT_FALSE(slot < 0)) {
+      return Status::Invalid("CSV column #", col_index, " was not selected for parsing");
+    }
     int32_t batch_row = 0;
     for (size_t buf_index = 0; buf_index < values_buffers_.size(); ++buf_index) {
       const auto& values_buffer = values_buffers_[buf_index];
       const auto values = reinterpret_cast<const ParsedValueDesc*>(values_buffer->data());
       const auto max_pos =
           static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc)) - 1;
-      for (int32_t pos = col_index; pos < max_pos; pos += num_cols_, ++batch_row) {
+      for (int32_t pos = slot; pos < max_pos; pos += num_stored_cols_, ++batch_row) {
         auto start = values[pos].offset;
         auto stop = values[pos + 1].offset;
         auto quoted = values[pos + 1].quoted;
@@ -97,8 +106,8 @@ class ARROW_EXPORT DataBatch {
     const auto values = reinterpret_cast<const ParsedValueDesc*>(values_buffer->data());
     const auto start_pos =
         static_cast<int32_t>(values_buffer->size() / sizeof(ParsedValueDesc)) -
-        num_cols_ - 1;
-    for (int32_t col_index = 0; col_index < num_cols_; ++col_index) {
+        num_stored_cols_ - 1;
+    for (int32_t col_index = 0; col_index < num_stored_cols_; ++col_index) {
       auto start = values[start_pos + col_index].offset;
       auto stop = values[start_pos + col_index + 1].offset;
       auto quoted = values[start_pos + col_index + 1].quoted;
@@ -108,6 +117,18 @@ class ARROW_EXPORT DataBatch {
   }
 
  protected:
+  // Return the position of a column among the stored values of a row, or -1
+  int32_t column_slot(int32_t col_index) const {
+    if (column_slots_.empty()) {
+      return col_index;
+    }
+    return col_index < std::min(num_cols_, static_cast<int32_t>(column_slots_.size()))
+               ? column_slots_[col_index]
+               : -1;
+  }
+
+  void SetNumColumns(int32_t num_cols);
+
   Status DecorateWithRowNumber(Status&& status, int64_t first_row,
                                int32_t batch_row) const {
     if (first_row >= 0) {
@@ -128,6 +149,12 @@ class ARROW_EXPORT DataBatch {
   int32_t num_rows_ = 0;
   // The number of columns
   int32_t num_cols_ = 0;
+  // The number of values stored for each row (less than num_cols_ if only
+  // some columns are selected)
+  int32_t num_stored_cols_ = 0;
+  // For each selected column, its position among the stored values of a row
+  // (-1 for other columns).  Empty if all columns are stored.
+  std::vector<int32_t> column_slots_;
 
   // XXX should we ensure the parsed buffer is padded with 8 or 16 excess zero bytes?
   // It may help with null parsing...
@@ -203,6 +230,15 @@ class ARROW_EXPORT BlockParser {
   /// \brief Return the row number of the first row in the block or -1 if unsupported
   int64_t first_row_num() const;
 
+  /// \brief Return the buffer holding the parsed values
+  ///
+  /// Values passed to VisitColumn() point into this buffer, already unquoted
+  /// and unescaped.  A new buffer is allocated for each parsed block, so
+  /// consumers may hold on to it to reference parsed values without copying.
+  const std::shared_ptr<Buffer>& parsed_buffer() const {
+    return parsed_batch().parsed_buffer();
+  }
+
   /// \brief Visit parsed values in a column
   ///
   /// The signature of the visitor is
@@ -213,11 +249,22 @@ class ARROW_EXPORT BlockParser {
                                       std::forward<Visitor>(visit));
   }
 
+  /// \brief Visit the stored values of the last parsed row
   template <typename Visitor>
   Status VisitLastRow(Visitor&& visit) const {
     return parsed_batch().VisitLastRow(std::forward<Visitor>(visit));
   }
 
+  /// \brief Only store the values of the given columns
+  ///
+  /// Other columns are still delimited (and the number of columns in each row
+  /// checked), but their values are discarded, so that parsing a few columns
+  /// out of a wide file keeps the parsed data small.  VisitColumn() may then
+  /// only be called for the selected columns.
+  ///
+  /// Must be called before parsing.
+  void SetColumnSelection(const std::vector<int32_t>& column_indices);
+
  protected:
   std::unique_ptr<BlockParserImpl> impl_;
 
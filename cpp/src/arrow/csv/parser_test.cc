@@ -794,6 +794,92 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+TEST(BlockParser, LongValues) {
+  // Values spanning several blocks of the bulk filter, with special chars
+  // at varying offsets
+  auto options = ParseOptions::Defaults();
+  options.escaping = true;
+  std::string csv;
+  std::vector<std::vector<std::string>> columns(2);
+  std::vector<std::vector<bool>> quoted(2);
+  for (int row = 0; row < 50; ++row) {
+    const std::string prefix(row * 7 % 150, 'a' + row % 26);
+    const std::string suffix(row * 13 % 90, 'z');
+    // An unquoted value with an escaped delimiter
+    csv += prefix + "\\," + suffix + ",";
+    columns[0].push_back(prefix + "," + suffix);
+    quoted[0].push_back(false);
+    // A quoted value with a newline and a double quote
+    csv += "\"" + suffix + "\n" + prefix + "\"\"" + suffix + "\"\n";
+    columns[1].push_back(suffix + "\n" + prefix + "\"" + suffix);
+    quoted[1].push_back(true);
+  }
+  BlockParser parser(options);
+  AssertParseOk(parser, csv);
+  AssertColumnsEq(parser, columns, quoted);
+}
+
+TEST(BlockParser, ColumnSelection) {
+  auto csv = MakeCSVData({"ab,cd,ef,gh\n", "\"i,j\",,kl,\n", "mn,op,\"q\"\"r\",st\n"});
+  auto assert_not_stored = [](const BlockParser& parser, int32_t col_index) {
+    auto visit = [](const uint8_t*, uint32_t, bool) { return Status::OK(); };
+    ASSERT_RAISES(Invalid, parser.VisitColumn(col_index, visit));
+  };
+  for (int32_t num_cols : {-1, 4}) {
+    BlockParser parser(ParseOptions::Defaults(), num_cols);
+    parser.SetColumnSelection({3, 0});
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_cols(), 4);
+    AssertColumnEq(parser, 0, {"ab", "i,j", "mn"}, {false, true, false});
+    AssertColumnEq(parser, 3, {"gh", "", "st"}, {false, false, false});
+    assert_not_stored(parser, 1);
+    assert_not_stored(parser, 2);
+    // Only the values of selected columns are kept
+    ASSERT_EQ(parser.num_bytes(), 11);
+  }
+  {
+    // Non-ignored empty lines and trailing selected columns
+    auto options = ParseOptions::Defaults();
+    options.ignore_empty_lines = false;
+    BlockParser parser(options);
+    parser.SetColumnSelection({1, 5});
+    AssertParseOk(parser, MakeCSVData({"a,b,c\n", "\n", "d,e,f\n"}));
+    AssertColumnEq(parser, 1, {"b", "", "e"});
+    assert_not_stored(parser, 0);
+    assert_not_stored(parser, 5);
+  }
+  {
+    // Long values going through the bulk filter
+    std::string long_csv;
+    std::vector<std::string> expected;
+    for (int row = 0; row < 50; ++row) {
+      const std::string value(row * 7 % 150, static_cast<char>('a' + row % 26));
+      long_csv += value + "," + value + "x," + value + "\n";
+      expected.push_back(value + "x");
+    }
+    BlockParser parser(ParseOptions::Defaults());
+    parser.SetColumnSelection({1});
+    AssertParseOk(parser, long_csv);
+    AssertColumnEq(parser, 1, expected);
+  }
+  {
+    // No column selected
+    BlockParser parser(ParseOptions::Defaults());
+    parser.SetColumnSelection({});
+    AssertParseOk(parser, csv);
+    ASSERT_EQ(parser.num_rows(), 3);
+    ASSERT_EQ(parser.num_bytes(), 0);
+    assert_not_stored(parser, 0);
+  }
+  {
+    // Rows with the wrong number of columns are still detected
+    BlockParser parser(ParseOptions::Defaults(), 2);
+    parser.SetColumnSelection({0});
+    uint32_t out_size;
+    ASSERT_RAISES(Invalid, Parse(parser, MakeCSVData({"a,b\n", "c,d,e\n"}), &out_size));
+  }
+}
+
 TEST(BlockParser, RowNumberAppendedToError) {
   auto options = ParseOptions::Defaults();
   auto csv = "a,b,c\nd,e,f\ng,h,i\n";
@@ -392,10 +392,12 @@ namespace {
 class BlockParsingOperator {
  public:
   BlockParsingOperator(io::IOContext io_context, ParseOptions parse_options,
-                       int num_csv_cols, int64_t first_row)
+                       int num_csv_cols, int64_t first_row,
+                       std::optional<std::vector<int32_t>> column_selection = {})
       : io_context_(io_context),
         parse_options_(parse_options),
         num_csv_cols_(num_csv_cols),
+        column_selection_(std::move(column_selection)),
         count_rows_(first_row >= 0),
         num_rows_seen_(first_row) {}
 
@@ -404,6 +406,9 @@ class BlockParsingOperator {
     constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
     auto parser = std::make_shared<BlockParser>(
         io_context_.pool(), parse_options_, num_csv_cols_, num_rows_seen_, max_num_rows);
+    if (column_selection_.has_value()) {
+      parser->SetColumnSelection(*column_selection_);
+    }
 
     std::shared_ptr<Buffer> straddling;
     std::vector<std::string_view> views;
@@ -458,6 +463,8 @@ class BlockParsingOperator {
   io::IOContext io_context_;
   const ParseOptions parse_options_;
   const int num_csv_cols_;
+  // The CSV columns whose values are needed, if not all of them
+  const std::optional<std::vector<int32_t>> column_selection_;
   const bool count_rows_;
   int64_t num_rows_seen_;
 };
@@ -648,11 +655,22 @@ class ReaderMixin {
 
     int32_t num_csv_cols = static_cast<int32_t>(column_names_.size());
     DCHECK_GT(num_csv_cols, 0);
+    RETURN_NOT_OK(MakeConversionSchema(num_csv_cols));
+
+    // When only some columns are converted, let the parser discard the others
+    std::optional<std::vector<int32_t>> column_selection;
+    if (!convert_options_.include_columns.empty()) {
+      column_selection.emplace();
+      for (const auto& column : conversion_schema_.columns) {
+        if (!column.is_missing) {
+          column_selection->push_back(column.index);
+        }
+      }
+    }
     // Since we know the number of columns, we can instantiate the BlockParsingOperator
     parsing_operator_.emplace(io_context_, parse_options_, num_csv_cols,
-                              count_rows_ ? num_rows_seen : -1);
-
-    RETURN_NOT_OK(MakeConversionSchema());
+                              count_rows_ ? num_rows_seen : -1,
+                              std::move(column_selection));
     return bytes_consumed;
   }
 
@@ -668,7 +686,7 @@ class ReaderMixin {
   }
 
   // Make conversion schema from options and parsed CSV header
-  Status MakeConversionSchema() {
+  Status MakeConversionSchema(int32_t num_csv_cols) {
     // Append a column converted from CSV data
     auto append_csv_column = [&](std::string col_name, int32_t col_index) {
       // Does the named column have a fixed type?
@@ -698,7 +716,7 @@ class ReaderMixin {
 
     if (convert_options_.include_columns.empty()) {
       // Include all columns in CSV file order
-      for (int32_t col_index = 0; col_index < num_csv_cols(); ++col_index) {
+      for (int32_t col_index = 0; col_index < num_csv_cols; ++col_index) {
         append_csv_column(column_names_[col_index], col_index);
       }
     } else {
@@ -1053,7 +1071,8 @@ class AsyncThreadedTableReader
     auto self = shared_from_this();
     return ProcessFirstBuffer().Then([self](const std::shared_ptr<Buffer>& first_buffer) {
       auto block_generator = ThreadedBlockReader::MakeAsyncIterator(
-          self->buffer_generator_, MakeChunker(self->parse_options_),
+          self->buffer_generator_,
+          MakeChunker(self->parse_options_, self->cpu_executor_),
           std::move(first_buffer), self->read_options_.skip_rows_after_names);
 
       std::function<Status(CSVBlock)> block_visitor =
@@ -1149,10 +1168,11 @@ class CSVRowCounter : public ReaderMixin,
  public:
   CSVRowCounter(io::IOContext io_context, Executor* cpu_executor,
                 std::shared_ptr<io::InputStream> input, const ReadOptions& read_options,
-                const ParseOptions& parse_options)
+                const ParseOptions& parse_options, bool validate_rows)
       : ReaderMixin(io_context, std::move(input), read_options, parse_options,
                     ConvertOptions::Defaults(), /*count_rows=*/true),
         cpu_executor_(cpu_executor),
+        validate_rows_(validate_rows),
         row_count_(0) {}
 
   Future<int64_t> Count() {
@@ -1189,6 +1209,11 @@ class CSVRowCounter : public ReaderMixin,
     // IterationEnd.
     std::function<Result<std::optional<int64_t>>(const CSVBlock&)> count_cb =
         [self](const CSVBlock& maybe_block) -> Result<std::optional<int64_t>> {
+      if (self->CanCountLines()) {
+        ARROW_ASSIGN_OR_RAISE(int64_t line_count, self->CountLines(maybe_block));
+        self->row_count_ += line_count;
+        return line_count;
+      }
       ARROW_ASSIGN_OR_RAISE(auto parsed_block, self->Parse(maybe_block));
       int32_t total_row_count = parsed_block.parser->total_num_rows();
       self->row_count_ += total_row_count;
@@ -1199,7 +1224,46 @@ class CSVRowCounter : public ReaderMixin,
         [self]() { return self->row_count_; });
   }
 
+  // Without newlines in values every line terminator ends a row, so rows can be
+  // counted by scanning for line terminators instead of lexing the fields.  An invalid
+  // row handler needs the parser to decide which rows are kept.
+  bool CanCountLines() const {
+    return !validate_rows_ && !parse_options_.newlines_in_values &&
+           parse_options_.ignore_empty_lines && !parse_options_.invalid_row_handler;
+  }
+
+  Result<int64_t> CountLines(const CSVBlock& block) {
+    int64_t num_rows = 0;
+    int64_t num_bytes = 0;
+    int64_t consumed = 0;
+    bool in_line = false;
+    for (const auto& buffer : {block.partial, block.completion, block.buffer}) {
+      const auto* data = reinterpret_cast<const char*>(buffer->data());
+      for (int64_t i = 0; i < buffer->size(); ++i) {
+        const char c = data[i];
+        if (c == '\n' || c == '\r') {
+          // Empty lines (including the '\n' of a "\r\n" pair) are ignored
+          num_rows += in_line;
+          in_line = false;
+          consumed = num_bytes + i + 1;
+        } else {
+          in_line = true;
+        }
+      }
+      num_bytes += buffer->size();
+    }
+    if (block.is_final) {
+      num_rows += in_line;
+      consumed = num_bytes;
+    }
+    if (block.consume_bytes) {
+      RETURN_NOT_OK(block.consume_bytes(consumed));
+    }
+    return num_rows;
+  }
+
   Executor* cpu_executor_;
+  const bool validate_rows_;
   AsyncGenerator<CSVBlock> block_generator_;
   int64_t row_count_;
 };
@@ -1240,11 +1304,12 @@ Future<std::shared_ptr<StreamingReader>> StreamingReader::MakeAsync(
 Future<int64_t> CountRowsAsync(io::IOContext io_context,
                                std::shared_ptr<io::InputStream> input,
                                Executor* cpu_executor, const ReadOptions& read_options,
-                               const ParseOptions& parse_options) {
+                               const ParseOptions& parse_options, bool validate_rows) {
   RETURN_NOT_OK(parse_options.Validate());
   RETURN_NOT_OK(read_options.Validate());
-  auto counter = std::make_shared<CSVRowCounter>(
-      io_context, cpu_executor, std::move(input), read_options, parse_options);
+  auto counter = std::make_shared<CSVRowCounter>(io_context, cpu_executor,
+                                                 std::move(input), read_options,
+                                                 parse_options, validate_rows);
   return counter->Count();
 }
 
@@ -102,11 +102,17 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
 
 /// \brief Count the logical rows of data in a CSV file (i.e. the
 /// number of rows you would get if you read the file into a table).
+///
+/// If `validate_rows` is false and values cannot contain newlines, rows are
+/// counted by scanning for line terminators instead of parsing them.  This is
+/// much faster but malformed rows are counted rather than reported.  It is
+/// ignored when empty lines are significant or an invalid row handler is set.
 ARROW_EXPORT
 Future<int64_t> CountRowsAsync(io::IOContext io_context,
                                std::shared_ptr<io::InputStream> input,
                                arrow::internal::Executor* cpu_executor,
-                               const ReadOptions&, const ParseOptions&);
+                               const ReadOptions&, const ParseOptions&,
+                               bool validate_rows = true);
 
 }  // namespace csv
 }  // namespace arrow
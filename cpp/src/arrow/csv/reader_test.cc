@@ -476,6 +476,39 @@ TEST(CountRowsAsync, Basics) {
   }
 }
 
+TEST(CountRowsAsync, WithoutValidation) {
+  constexpr int NROWS = 4096;
+  ASSERT_OK_AND_ASSIGN(auto table_buffer, MakeSampleCsvBuffer(NROWS));
+  auto parse_options = ParseOptions::Defaults();
+  for (int32_t block_size : {1024, 1 << 20}) {
+    ARROW_SCOPED_TRACE("block_size = ", block_size);
+    auto read_options = ReadOptions::Defaults();
+    read_options.block_size = block_size;
+    auto reader = std::make_shared<io::BufferReader>(table_buffer);
+    ASSERT_FINISHES_OK_AND_EQ(
+        NROWS, CountRowsAsync(io::default_io_context(), reader,
+                              internal::GetCpuThreadPool(), read_options, parse_options,
+                              /*validate_rows=*/false));
+
+    read_options.skip_rows = 20;
+    reader = std::make_shared<io::BufferReader>(table_buffer);
+    ASSERT_FINISHES_OK_AND_EQ(
+        NROWS - 20, CountRowsAsync(io::default_io_context(), reader,
+                                   internal::GetCpuThreadPool(), read_options,
+                                   parse_options, /*validate_rows=*/false));
+  }
+
+  // Malformed rows are not detected: the invalid row spans two lines
+  ASSERT_OK_AND_ASSIGN(table_buffer, MakeSampleCsvBuffer(NROWS, [](size_t row_num) {
+                         return row_num != 2048;
+                       }));
+  auto reader = std::make_shared<io::BufferReader>(table_buffer);
+  ASSERT_FINISHES_OK_AND_EQ(
+      NROWS + 1, CountRowsAsync(io::default_io_context(), reader,
+                                internal::GetCpuThreadPool(), ReadOptions::Defaults(),
+                                parse_options, /*validate_rows=*/false));
+}
+
 TEST(CountRowsAsync, Errors) {
   ASSERT_OK_AND_ASSIGN(auto table_buffer, MakeSampleCsvBuffer(4096, [](size_t row_num) {
                          return row_num != 2048;
@@ -24,12 +24,17 @@
 #include "arrow/result.h"
 #include "arrow/result_internal.h"
 #include "arrow/stl_allocator.h"
+#include "arrow/util/formatting.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
 #include <xsimd/xsimd.hpp>
@@ -38,6 +43,7 @@
 namespace arrow {
 
 using internal::checked_pointer_cast;
+using internal::StringFormatter;
 
 namespace csv {
 // This implementation is intentionally light on configurability to minimize the size of
@@ -47,16 +53,18 @@ namespace csv {
 // The algorithm used here at a high level is to break RecordBatches/Tables into slices
 // and convert each slice independently.  A slice is then converted to CSV by first
 // scanning each column to determine the size of its contents when rendered as a string in
-// CSV. For non-string types this requires casting the value to string (which is cached).
+// CSV. Numeric, decimal and temporal values are rendered with the formatters from
+// util/formatting.h into a scratch area; other non-string types are cast to string.
 // This data is used to understand the precise length of each row and a single allocation
 // for the final CSV data buffer. Once the final size is known each column is then
-// iterated over again to place its contents into the CSV data buffer. The rationale for
-// choosing this approach is it allows for reuse of the cast functionality in the compute
-// module and inline data visiting functionality in the core library. A performance
+// iterated over again to place its contents into the CSV data buffer. A performance
 // comparison has not been done using a naive single-pass approach. This approach might
 // still be competitive due to reduction in the number of per row branches necessary with
 // a single pass approach. Profiling would likely yield further opportunities for
 // optimization with this approach.
+//
+// Slices are independent from each other, so that several of them can be converted
+// concurrently (see WriteOptions::use_threads) and then written out in order.
 
 namespace {
 
@@ -124,6 +132,22 @@ class ColumnPopulator {
   // Adds the number of characters each entry in data will add to to elements
   // in row_lengths.
   Status UpdateRowLengths(const Array& data, int64_t* row_lengths) {
+    RETURN_NOT_OK(SetValues(data));
+    return UpdateRowLengths(row_lengths);
+  }
+
+  // Places string data onto each row in output and updates the corresponding row
+  // pointers in preparation for calls to other (next) ColumnPopulators.
+  // Implementations may apply certain checks e.g. for illegal values, which in case of
+  // failure causes this function to return an error Status.
+  // Args:
+  //   output: character buffer to write to.
+  //   offsets: an array of start of row column within the output buffer.
+  virtual Status PopulateRows(char* output, int64_t* offsets) const = 0;
+
+ protected:
+  // Renders the values of data as strings, by default by casting them to string.
+  virtual Status SetValues(const Array& data) {
     compute::ExecContext ctx(pool_);
     // Populators are intented to be applied to reasonably small data.  In most cases
     // threading overhead would not be justified.
@@ -142,19 +166,9 @@ class ColumnPopulator {
         return casted.status();
       }
     }
-    return UpdateRowLengths(row_lengths);
+    return Status::OK();
   }
 
-  // Places string data onto each row in output and updates the corresponding row
-  // pointers in preparation for calls to other (next) ColumnPopulators.
-  // Implementations may apply certain checks e.g. for illegal values, which in case of
-  // failure causes this function to return an error Status.
-  // Args:
-  //   output: character buffer to write to.
-  //   offsets: an array of start of row column within the output buffer.
-  virtual Status PopulateRows(char* output, int64_t* offsets) const = 0;
-
- protected:
   virtual Status UpdateRowLengths(int64_t* row_lengths) = 0;
   // It must be a `StringArray` or `LargeStringArray`.
   std::shared_ptr<Array> array_;
@@ -427,6 +441,96 @@ class QuotedColumnPopulator : public ColumnPopulator {
   std::vector<bool> row_needs_escaping_;
 };
 
+// Populator for types whose values are rendered with the formatters from
+// util/formatting.h, the same way as when casting them to string.  Values are
+// formatted into a scratch area that is reused from slice to slice, and never
+// need escaping.
+template <typename ArrowType>
+class FormattingColumnPopulator : public ColumnPopulator {
+ public:
+  FormattingColumnPopulator(const DataType& type, MemoryPool* pool,
+                            std::string end_chars, std::shared_ptr<Buffer> null_string,
+                            bool quote_values)
+      : ColumnPopulator(pool, std::move(end_chars), std::move(null_string)),
+        formatter_(&type),
+        quote_values_(quote_values) {}
+
+  Status PopulateRows(char* output, int64_t* offsets) const override {
+    const char* value = formatted_.data();
+    for (const int32_t length : value_lengths_) {
+      char* row = output + *offsets;
+      if (length < 0) {
+        memcpy(row, null_string_->data(), null_string_->size());
+        row += null_string_->size();
+      } else {
+        if (quote_values_) {
+          *row++ = '"';
+        }
+        memcpy(row, value, length);
+        row += length;
+        value += length;
+        if (quote_values_) {
+          *row++ = '"';
+        }
+      }
+      CopyEndChars(row, end_chars_.data(), end_chars_.size());
+      row += end_chars_.size();
+      *offsets++ = static_cast<int64_t>(row - output);
+    }
+    return Status::OK();
+  }
+
+ protected:
+  using CType = typename TypeTraits<ArrowType>::CType;
+
+  Status SetValues(const Array& data) override {
+    formatted_.clear();
+    value_lengths_.clear();
+    value_lengths_.reserve(data.length());
+    auto append = [&](std::string_view v) {
+      formatted_.append(v.data(), v.size());
+      value_lengths_.push_back(static_cast<int32_t>(v.size()));
+    };
+    if constexpr (is_decimal_type<ArrowType>::value) {
+      VisitArraySpanInline<ArrowType>(
+          *data.data(),
+          [&](std::string_view bytes) {
+            formatter_(CType(reinterpret_cast<const uint8_t*>(bytes.data())), append);
+          },
+          [&]() { value_lengths_.push_back(-1); });
+    } else {
+      VisitArraySpanInline<ArrowType>(
+          *data.data(), [&](CType v) { formatter_(v, append); },
+          [&]() { value_lengths_.push_back(-1); });
+    }
+    return Status::OK();
+  }
+
+  Status UpdateRowLengths(int64_t* row_lengths) override {
+    const int64_t quote_count = quote_values_ ? kQuoteCount : 0;
+    for (const int32_t length : value_lengths_) {
+      *row_lengths++ += length < 0 ? static_cast<int64_t>(null_string_->size())
+                                   : length + quote_count;
+    }
+    return Status::OK();
+  }
+
+  StringFormatter<ArrowType> formatter_;
+  const bool quote_values_;
+  std::string formatted_;
+  std::vector<int32_t> value_lengths_;
+};
+
+// Whether values of the type are rendered by FormattingColumnPopulator, rather
+// than cast to string.
+template <typename T>
+constexpr bool IsFormattedDirectly() {
+  return is_number_type<T>::value || is_boolean_type<T>::value ||
+         is_decimal128_type<T>::value || is_decimal256_type<T>::value ||
+         is_date_type<T>::value || is_time_type<T>::value ||
+         is_timestamp_type<T>::value || is_duration_type<T>::value;
+}
+
 Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
     const DataType& type, const std::string& end_chars, const char delimiter,
     const std::shared_ptr<Buffer>& null_string, QuotingStyle quoting_style,
@@ -435,6 +539,19 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
       [&](const auto& type) -> Result<std::unique_ptr<ColumnPopulator>> {
     using Type = std::decay_t<decltype(type)>;
 
+    if constexpr (IsFormattedDirectly<Type>()) {
+      // Timestamps with a time zone are rendered in that time zone by the cast
+      bool formatted_directly = true;
+      if constexpr (is_timestamp_type<Type>::value) {
+        formatted_directly = type.timezone().empty();
+      }
+      if (formatted_directly) {
+        return std::make_unique<FormattingColumnPopulator<Type>>(
+            type, pool, end_chars, null_string,
+            /*quote_values=*/quoting_style == QuotingStyle::AllValid);
+      }
+    }
+
     if constexpr (is_primitive_ctype<Type>::value || is_decimal_type<Type>::value ||
                   is_null_type<Type>::value || is_temporal_type<Type>::value) {
       switch (quoting_style) {
@@ -490,6 +607,90 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
                        pool);
 }
 
+// Converts slices of record batches to CSV data, one at a time.
+class BatchFormatter {
+ public:
+  BatchFormatter(std::vector<std::unique_ptr<ColumnPopulator>> populators,
+                 std::shared_ptr<ResizableBuffer> data_buffer,
+                 const WriteOptions& options)
+      : column_populators_(std::move(populators)),
+        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        data_buffer_(std::move(data_buffer)),
+        options_(options) {}
+
+  static Result<std::unique_ptr<BatchFormatter>> Make(
+      const Schema& schema, const std::shared_ptr<Buffer>& null_string,
+      const WriteOptions& options) {
+    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema.num_fields());
+    std::string delimiter(1, options.delimiter);
+    for (int col = 0; col < schema.num_fields(); col++) {
+      const std::string& end_chars =
+          col < schema.num_fields() - 1 ? delimiter : options.eol;
+      ASSIGN_OR_RAISE(
+          populators[col],
+          MakePopulator(*schema.field(col), end_chars, options.delimiter, null_string,
+                        options.quoting_style, options.io_context.pool()));
+    }
+    ASSIGN_OR_RAISE(std::shared_ptr<ResizableBuffer> data_buffer,
+                    AllocateResizableBuffer(
+                        options.batch_size * schema.num_fields() * kColumnSizeGuess,
+                        options.io_context.pool()));
+    return std::make_unique<BatchFormatter>(std::move(populators),
+                                            std::move(data_buffer), options);
+  }
+
+  // The CSV data for the last converted batch
+  const std::shared_ptr<ResizableBuffer>& data_buffer() const { return data_buffer_; }
+
+  Status TranslateMinimalBatch(const RecordBatch& batch) {
+    if (batch.num_rows() == 0) {
+      return data_buffer_->Resize(0, /*shrink_to_fit=*/false);
+    }
+    offsets_.resize(batch.num_rows());
+    std::fill(offsets_.begin(), offsets_.end(), 0);
+
+    // Calculate relative offsets for each row (excluding delimiters)
+    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
+      RETURN_NOT_OK(
+          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
+    }
+    // Calculate cumulative offsets for each row (including delimiters).
+    // - before conversion: offsets_[i] = length of i-th row
+    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
+    //   - offsets_[0] = 0
+    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
+    // Delimiters: ',' * (num_columns - 1) + eol
+    const int32_t delimiters_length =
+        static_cast<int32_t>(batch.num_columns() - 1 + options_.eol.size());
+    int64_t last_row_length = offsets_[0] + delimiters_length;
+    offsets_[0] = 0;
+    for (size_t row = 1; row < offsets_.size(); ++row) {
+      const int64_t this_row_length = offsets_[row] + delimiters_length;
+      offsets_[row] = offsets_[row - 1] + last_row_length;
+      last_row_length = this_row_length;
+    }
+    // Resize the target buffer to required size. We assume batch to batch sizes
+    // should be pretty close so don't shrink the buffer to avoid allocation churn.
+    RETURN_NOT_OK(
+        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+
+    // Use the offsets to populate contents.
+    for (auto& populator : column_populators_) {
+      RETURN_NOT_OK(populator->PopulateRows(
+          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+    }
+    DCHECK_EQ(data_buffer_->size(), offsets_.back());
+    return Status::OK();
+  }
+
+ private:
+  static constexpr int64_t kColumnSizeGuess = 8;
+  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
+  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
+  std::shared_ptr<ResizableBuffer> data_buffer_;
+  const WriteOptions& options_;
+};
+
 class CSVWriterImpl : public ipc::RecordBatchWriter {
  public:
   static Result<std::shared_ptr<CSVWriterImpl>> Make(
@@ -506,19 +707,17 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(null_string->mutable_data(), options.null_string.data(),
            options.null_string.length());
 
-    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
-    std::string delimiter(1, options.delimiter);
-    for (int col = 0; col < schema->num_fields(); col++) {
-      const std::string& end_chars =
-          col < schema->num_fields() - 1 ? delimiter : options.eol;
-      ASSIGN_OR_RAISE(
-          populators[col],
-          MakePopulator(*schema->field(col), end_chars, options.delimiter, null_string,
-                        options.quoting_style, options.io_context.pool()));
+    auto writer = std::make_shared<CSVWriterImpl>(sink, std::move(owned_sink),
+                                                  std::move(schema), options);
+    // One formatter per slice converted concurrently
+    const int num_formatters =
+        options.use_threads ? std::max(GetCpuThreadPoolCapacity(), 1) : 1;
+    for (int i = 0; i < num_formatters; ++i) {
+      ASSIGN_OR_RAISE(auto formatter,
+                      BatchFormatter::Make(*writer->schema_, null_string,
+                                           writer->options_));
+      writer->formatters_.push_back(std::move(formatter));
     }
-    auto writer = std::make_shared<CSVWriterImpl>(
-        sink, std::move(owned_sink), std::move(schema), std::move(populators), options);
-    RETURN_NOT_OK(writer->PrepareForContentsWrite());
     if (options.include_header) {
       RETURN_NOT_OK(writer->WriteHeader());
     }
@@ -529,11 +728,9 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     RecordBatchIterator iterator = RecordBatchSliceIterator(batch, options_.batch_size);
     for (auto maybe_slice : iterator) {
       ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
-      RETURN_NOT_OK(TranslateMinimalBatch(*slice));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
-      stats_.num_record_batches++;
+      RETURN_NOT_OK(AddBatch(std::move(slice)));
     }
-    return Status::OK();
+    return FlushBatches();
   }
 
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
@@ -542,13 +739,10 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     std::shared_ptr<RecordBatch> batch;
     RETURN_NOT_OK(reader.ReadNext(&batch));
     while (batch != nullptr) {
-      RETURN_NOT_OK(TranslateMinimalBatch(*batch));
-      RETURN_NOT_OK(sink_->Write(data_buffer_));
+      RETURN_NOT_OK(AddBatch(std::move(batch)));
       RETURN_NOT_OK(reader.ReadNext(&batch));
-      stats_.num_record_batches++;
     }
-
-    return Status::OK();
+    return FlushBatches();
   }
 
   Status Close() override { return Status::OK(); }
@@ -556,28 +750,13 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
   ipc::WriteStats stats() const override { return stats_; }
 
   CSVWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
-                std::shared_ptr<Schema> schema,
-                std::vector<std::unique_ptr<ColumnPopulator>> populators,
-                const WriteOptions& options)
+                std::shared_ptr<Schema> schema, const WriteOptions& options)
       : sink_(sink),
         owned_sink_(std::move(owned_sink)),
-        column_populators_(std::move(populators)),
-        offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
         schema_(std::move(schema)),
         options_(options) {}
 
  private:
-  Status PrepareForContentsWrite() {
-    // Only called once, as part of initialization
-    if (data_buffer_ == nullptr) {
-      ASSIGN_OR_RAISE(data_buffer_,
-                      AllocateResizableBuffer(
-                          options_.batch_size * schema_->num_fields() * kColumnSizeGuess,
-                          options_.io_context.pool()));
-    }
-    return Status::OK();
-  }
-
   int64_t CalculateHeaderSize() const {
     int64_t header_length = 0;
     for (int col = 0; col < schema_->num_fields(); col++) {
@@ -592,8 +771,9 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   Status WriteHeader() {
     // Only called once, as part of initialization
-    RETURN_NOT_OK(data_buffer_->Resize(CalculateHeaderSize(), /*shrink_to_fit=*/false));
-    char* next = reinterpret_cast<char*>(data_buffer_->mutable_data());
+    ASSIGN_OR_RAISE(std::shared_ptr<Buffer> header,
+                    AllocateBuffer(CalculateHeaderSize(), options_.io_context.pool()));
+    char* next = reinterpret_cast<char*>(header->mutable_data());
     for (int col = 0; col < schema_->num_fields(); ++col) {
       *next++ = '"';
       next = Escape(schema_->field(col)->name(), next);
@@ -604,60 +784,41 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     }
     memcpy(next, options_.eol.data(), options_.eol.size());
     next += options_.eol.size();
-    DCHECK_EQ(reinterpret_cast<uint8_t*>(next),
-              data_buffer_->data() + data_buffer_->size());
-    return sink_->Write(data_buffer_);
+    DCHECK_EQ(reinterpret_cast<uint8_t*>(next), header->data() + header->size());
+    return sink_->Write(header);
   }
 
-  Status TranslateMinimalBatch(const RecordBatch& batch) {
-    if (batch.num_rows() == 0) {
-      return Status::OK();
-    }
-    offsets_.resize(batch.num_rows());
-    std::fill(offsets_.begin(), offsets_.end(), 0);
-
-    // Calculate relative offsets for each row (excluding delimiters)
-    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
-      RETURN_NOT_OK(
-          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
-    }
-    // Calculate cumulative offsets for each row (including delimiters).
-    // - before conversion: offsets_[i] = length of i-th row
-    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
-    //   - offsets_[0] = 0
-    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
-    // Delimiters: ',' * (num_columns - 1) + eol
-    const int32_t delimiters_length =
-        static_cast<int32_t>(batch.num_columns() - 1 + options_.eol.size());
-    int64_t last_row_length = offsets_[0] + delimiters_length;
-    offsets_[0] = 0;
-    for (size_t row = 1; row < offsets_.size(); ++row) {
-      const int64_t this_row_length = offsets_[row] + delimiters_length;
-      offsets_[row] = offsets_[row - 1] + last_row_length;
-      last_row_length = this_row_length;
+  // Queue a batch for conversion, converting and writing the queued batches
+  // once there is one for each formatter
+  Status AddBatch(std::shared_ptr<RecordBatch> batch) {
+    pending_batches_.push_back(std::move(batch));
+    if (pending_batches_.size() == formatters_.size()) {
+      return FlushBatches();
     }
-    // Resize the target buffer to required size. We assume batch to batch sizes
-    // should be pretty close so don't shrink the buffer to avoid allocation churn.
-    RETURN_NOT_OK(
-        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
+    return Status::OK();
+  }
 
-    // Use the offsets to populate contents.
-    for (auto& populator : column_populators_) {
-      RETURN_NOT_OK(populator->PopulateRows(
-          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+  Status FlushBatches() {
+    const int num_batches = static_cast<int>(pending_batches_.size());
+    Status st = ::arrow::internal::OptionalParallelFor(
+        options_.use_threads && num_batches > 1, num_batches, [&](int i) {
+          return formatters_[i]->TranslateMinimalBatch(*pending_batches_[i]);
+        });
+    pending_batches_.clear();
+    RETURN_NOT_OK(st);
+    for (int i = 0; i < num_batches; ++i) {
+      RETURN_NOT_OK(sink_->Write(formatters_[i]->data_buffer()));
+      stats_.num_record_batches++;
     }
-    DCHECK_EQ(data_buffer_->size(), offsets_.back());
     return Status::OK();
   }
 
-  static constexpr int64_t kColumnSizeGuess = 8;
   io::OutputStream* sink_;
   std::shared_ptr<io::OutputStream> owned_sink_;
-  std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
-  std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
-  std::shared_ptr<ResizableBuffer> data_buffer_;
   const std::shared_ptr<Schema> schema_;
   const WriteOptions options_;
+  std::vector<std::unique_ptr<BatchFormatter>> formatters_;
+  std::vector<std::shared_ptr<RecordBatch>> pending_batches_;
   ipc::WriteStats stats_;
 };
 
@@ -327,6 +327,11 @@ TEST_P(TestWriteCSV, TestWrite) {
     EXPECT_RAISES_WITH_MESSAGE_THAT(
         Invalid, ::testing::HasSubstr(GetParam().expected_status.message()),
         ToCsvString(*record_batch, options));
+    options.use_threads = true;
+    options.batch_size = 1;
+    EXPECT_RAISES_WITH_MESSAGE_THAT(
+        Invalid, ::testing::HasSubstr(GetParam().expected_status.message()),
+        ToCsvString(*record_batch, options));
   } else {
     ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
     EXPECT_EQ(csv, GetParam().expected_output);
@@ -351,6 +356,14 @@ TEST_P(TestWriteCSV, TestWrite) {
     // The writer should work identically.
     ASSERT_OK_AND_ASSIGN(csv, ToCsvStringUsingWriter(*table, options));
     EXPECT_EQ(csv, GetParam().expected_output);
+
+    // Converting slices concurrently should work identically.
+    options.use_threads = true;
+    options.batch_size = 1;
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*table, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
   }
 }
 
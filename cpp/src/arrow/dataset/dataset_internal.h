@@ -22,6 +22,8 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/function.h"
+#include "arrow/compute/registry.h"
 #include "arrow/dataset/dataset.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -117,10 +119,11 @@ class FragmentDataset : public Dataset {
 
     // TODO(ARROW-12891) Provide subtree pruning for any vector of fragments
     FragmentVector fragments;
+    compute::SimplifyWithGuaranteeCache simplify_cache;
     for (const auto& fragment : fragments_) {
       ARROW_ASSIGN_OR_RAISE(
           auto simplified_filter,
-          compute::SimplifyWithGuarantee(predicate, fragment->partition_expression()));
+          simplify_cache.Simplify(predicate, fragment->partition_expression()));
 
       if (simplified_filter.IsSatisfiable()) {
         fragments.push_back(fragment);
@@ -156,5 +159,17 @@ inline RecordBatchGenerator MakeChunkedBatchGenerator(RecordBatchGenerator gen,
       });
 }
 
+// Name of the manifest written by EnableDatasetManifest() in the base directory
+constexpr char kDatasetManifestFileName[] = "_manifest.arrow";
+// Key of the manifest schema metadata holding the base64-encoded IPC serialization
+// of the schema of the files it lists
+constexpr char kDatasetManifestSchemaKey[] = "ARROW:dataset:physical_schema";
+
+// Whether the "min_max" function supports `type`
+inline bool HasMinMax(const std::shared_ptr<DataType>& type) {
+  auto maybe_function = compute::GetFunctionRegistry()->GetFunction("min_max");
+  return maybe_function.ok() && (*maybe_function)->DispatchExact({type}).ok();
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -27,6 +27,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/table.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/map.h"
@@ -53,6 +54,8 @@ class Throttle {
 
   bool Unthrottled() const { return max_value_ <= 0; }
 
+  uint64_t max_value() const { return max_value_; }
+
   Future<> Acquire(uint64_t values) {
     if (Unthrottled()) {
       return Future<>::MakeFinished();
@@ -94,18 +97,27 @@ class Throttle {
 };
 
 struct DatasetWriterState {
-  DatasetWriterState(uint64_t rows_in_flight, uint64_t max_open_files,
-                     uint64_t max_rows_staged)
+  DatasetWriterState(uint64_t rows_in_flight, uint64_t bytes_in_flight,
+                     uint64_t max_open_files, uint64_t max_rows_staged)
       : rows_in_flight_throttle(rows_in_flight),
+        bytes_in_flight_throttle(bytes_in_flight),
         open_files_throttle(max_open_files),
         staged_rows_count(0),
-        max_rows_staged(max_rows_staged) {}
+        max_rows_staged(max_rows_staged),
+        staged_bytes_count(0),
+        max_bytes_staged(bytes_in_flight / 4) {}
 
-  bool StagingFull() const { return staged_rows_count.load() >= max_rows_staged; }
+  bool StagingFull() const {
+    return staged_rows_count.load() >= max_rows_staged ||
+           (max_bytes_staged > 0 && staged_bytes_count.load() >= max_bytes_staged);
+  }
 
   // Throttle for how many rows the dataset writer will allow to be in process memory
   // When this is exceeded the dataset writer will pause / apply backpressure
   Throttle rows_in_flight_throttle;
+  // Same as rows_in_flight_throttle but counting the bytes referenced by the queued
+  // batches, which bounds memory regardless of row width.  Unthrottled if 0.
+  Throttle bytes_in_flight_throttle;
   // Control for how many files the dataset writer will open.  When this is exceeded
   // the dataset writer will pause and it will also close the largest open file.
   Throttle open_files_throttle;
@@ -117,6 +129,10 @@ struct DatasetWriterState {
   // are staged than max_rows_queued we will end up with deadlock.  To avoid this, once
   // we have too many staged rows we just ignore min_rows_per_group
   const uint64_t max_rows_staged;
+  // The byte counterparts of staged_rows_count and max_rows_staged.  With thousands
+  // of open partitions, rows staged for min_rows_per_group can be most of the queue.
+  std::atomic<uint64_t> staged_bytes_count;
+  const uint64_t max_bytes_staged;
   // Mutex to guard access to the file visitors in the writer options
   std::mutex visitors_mutex;
 };
@@ -126,6 +142,12 @@ Result<std::shared_ptr<FileWriter>> OpenWriter(
     const std::string& filename) {
   ARROW_ASSIGN_OR_RAISE(std::shared_ptr<io::OutputStream> out_stream,
                         write_options.filesystem->OpenOutputStream(filename));
+  if (!write_options.clustering_keys.empty()) {
+    return write_options.format()->MakeSortedWriter(
+        std::move(out_stream), std::move(schema), write_options.file_write_options,
+        {write_options.filesystem, filename},
+        compute::Ordering(write_options.clustering_keys));
+  }
   return write_options.format()->MakeWriter(std::move(out_stream), std::move(schema),
                                             write_options.file_write_options,
                                             {write_options.filesystem, filename});
@@ -153,26 +175,35 @@ class DatasetWriterFileQueue {
         "DatasetWriter::OpenWriter"sv);
   }
 
-  Result<std::shared_ptr<RecordBatch>> PopStagedBatch() {
+  // Pop up to max_rows_per_group staged rows.  The bytes acquired from
+  // bytes_in_flight_throttle for the popped rows are added to `bytes`.
+  Result<std::shared_ptr<RecordBatch>> PopStagedBatch(uint64_t* bytes) {
     std::vector<std::shared_ptr<RecordBatch>> batches_to_write;
     uint64_t num_rows = 0;
     while (!staged_batches_.empty()) {
-      std::shared_ptr<RecordBatch> next = std::move(staged_batches_.front());
+      StagedBatch next = std::move(staged_batches_.front());
       staged_batches_.pop_front();
-      if (num_rows + next->num_rows() <= options_.max_rows_per_group) {
-        num_rows += next->num_rows();
-        batches_to_write.push_back(std::move(next));
+      if (num_rows + next.batch->num_rows() <= options_.max_rows_per_group) {
+        num_rows += next.batch->num_rows();
+        *bytes += next.bytes;
+        batches_to_write.push_back(std::move(next.batch));
         if (num_rows == options_.max_rows_per_group) {
           break;
         }
       } else {
         uint64_t remaining = options_.max_rows_per_group - num_rows;
+        // Split the acquired bytes in proportion to the rows so that exactly what was
+        // acquired is eventually released
+        uint64_t partial_bytes =
+            next.bytes * remaining / static_cast<uint64_t>(next.batch->num_rows());
+        *bytes += partial_bytes;
         std::shared_ptr<RecordBatch> next_partial =
-            next->Slice(0, static_cast<int64_t>(remaining));
+            next.batch->Slice(0, static_cast<int64_t>(remaining));
         batches_to_write.push_back(std::move(next_partial));
         std::shared_ptr<RecordBatch> next_remainder =
-            next->Slice(static_cast<int64_t>(remaining));
-        staged_batches_.push_front(std::move(next_remainder));
+            next.batch->Slice(static_cast<int64_t>(remaining));
+        staged_batches_.push_front(
+            {std::move(next_remainder), next.bytes - partial_bytes});
         break;
       }
     }
@@ -182,42 +213,54 @@ class DatasetWriterFileQueue {
     return table->CombineChunksToBatch();
   }
 
-  void ScheduleBatch(std::shared_ptr<RecordBatch> batch) {
+  void ScheduleBatch(std::shared_ptr<RecordBatch> batch, uint64_t bytes) {
     file_tasks_->AddSimpleTask(
-        [self = this, batch = std::move(batch)]() {
-          return self->WriteNext(std::move(batch));
+        [self = this, batch = std::move(batch), bytes]() {
+          return self->WriteNext(std::move(batch), bytes);
         },
         "DatasetWriter::WriteBatch"sv);
   }
 
-  Result<int64_t> PopAndDeliverStagedBatch() {
-    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next_batch, PopStagedBatch());
+  Result<int64_t> PopAndDeliverStagedBatch(uint64_t* bytes_popped) {
+    uint64_t bytes = 0;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> next_batch,
+                          PopStagedBatch(&bytes));
     int64_t rows_popped = next_batch->num_rows();
     rows_currently_staged_ -= next_batch->num_rows();
-    ScheduleBatch(std::move(next_batch));
+    bytes_currently_staged_ -= bytes;
+    *bytes_popped = bytes;
+    ScheduleBatch(std::move(next_batch), bytes);
     return rows_popped;
   }
 
-  // Stage batches, popping and delivering batches if enough data has arrived
-  Status Push(std::shared_ptr<RecordBatch> batch) {
+  // Stage batches, popping and delivering batches if enough data has arrived.  `bytes`
+  // is the amount acquired from bytes_in_flight_throttle for this batch.
+  Status Push(std::shared_ptr<RecordBatch> batch, uint64_t bytes) {
     uint64_t delta_staged = batch->num_rows();
+    uint64_t delta_bytes_staged = bytes;
     rows_currently_staged_ += delta_staged;
-    staged_batches_.push_back(std::move(batch));
+    bytes_currently_staged_ += bytes;
+    staged_batches_.push_back({std::move(batch), bytes});
     while (!staged_batches_.empty() &&
            (writer_state_->StagingFull() ||
             rows_currently_staged_ >= options_.min_rows_per_group)) {
-      ARROW_ASSIGN_OR_RAISE(int64_t rows_popped, PopAndDeliverStagedBatch());
+      uint64_t bytes_popped = 0;
+      ARROW_ASSIGN_OR_RAISE(int64_t rows_popped, PopAndDeliverStagedBatch(&bytes_popped));
       delta_staged -= rows_popped;
+      delta_bytes_staged -= bytes_popped;
     }
-    // Note, delta_staged may be negative if we were able to deliver some data
+    // Note, the deltas may be negative if we were able to deliver some data
     writer_state_->staged_rows_count += delta_staged;
+    writer_state_->staged_bytes_count += delta_bytes_staged;
     return Status::OK();
   }
 
   Status Finish() {
     writer_state_->staged_rows_count -= rows_currently_staged_;
+    writer_state_->staged_bytes_count -= bytes_currently_staged_;
     while (!staged_batches_.empty()) {
-      RETURN_NOT_OK(PopAndDeliverStagedBatch());
+      uint64_t bytes_popped = 0;
+      RETURN_NOT_OK(PopAndDeliverStagedBatch(&bytes_popped));
     }
     // At this point all write tasks have been added.  Because the scheduler
     // is a 1-task FIFO we know this task will run at the very end and can
@@ -228,15 +271,23 @@ class DatasetWriterFileQueue {
   }
 
  private:
-  Future<> WriteNext(std::shared_ptr<RecordBatch> next) {
-    // May want to prototype / measure someday pushing the async write down further
-    return DeferNotOk(options_.filesystem->io_context().executor()->Submit(
-        [self = this, batch = std::move(next)]() {
-          int64_t rows_to_release = batch->num_rows();
-          Status status = self->writer_->Write(batch);
-          self->writer_state_->rows_in_flight_throttle.Release(rows_to_release);
-          return status;
-        }));
+  Future<> WriteNext(std::shared_ptr<RecordBatch> next, uint64_t bytes) {
+    // Encoding and compression happen in FileWriter::Write, so they run on the
+    // write executor; output streams that upload in the background then keep the
+    // IO threads busy with uploads only.
+    Executor* executor = options_.write_executor != nullptr
+                             ? options_.write_executor
+                             : options_.filesystem->io_context().executor();
+    return DeferNotOk(executor->Submit([self = this, batch = std::move(next), bytes]() {
+      int64_t rows_to_release = batch->num_rows();
+      Status status = self->writer_->Write(batch);
+      if (status.ok() && self->options_.collect_statistics) {
+        status = self->writer_->UpdateStatistics(*batch);
+      }
+      self->writer_state_->rows_in_flight_throttle.Release(rows_to_release);
+      self->writer_state_->bytes_in_flight_throttle.Release(bytes);
+      return status;
+    }));
   }
 
   Future<> DoFinish() {
@@ -256,8 +307,14 @@ class DatasetWriterFileQueue {
   std::shared_ptr<FileWriter> writer_;
   // Batches are accumulated here until they are large enough to write out at which
   // point they are merged together and added to write_queue_
-  std::deque<std::shared_ptr<RecordBatch>> staged_batches_;
+  struct StagedBatch {
+    std::shared_ptr<RecordBatch> batch;
+    // Bytes acquired from bytes_in_flight_throttle for this batch
+    uint64_t bytes;
+  };
+  std::deque<StagedBatch> staged_batches_;
   uint64_t rows_currently_staged_ = 0;
+  uint64_t bytes_currently_staged_ = 0;
   util::AsyncTaskScheduler* file_tasks_ = nullptr;
 };
 
@@ -299,13 +356,13 @@ class DatasetWriterDirectoryQueue {
     return to_queue;
   }
 
-  Status StartWrite(const std::shared_ptr<RecordBatch>& batch) {
+  Status StartWrite(const std::shared_ptr<RecordBatch>& batch, uint64_t bytes) {
     rows_written_ += batch->num_rows();
     WriteTask task{current_filename_, static_cast<uint64_t>(batch->num_rows())};
     if (!latest_open_file_) {
       ARROW_RETURN_NOT_OK(OpenFileQueue(current_filename_));
     }
-    return latest_open_file_->Push(batch);
+    return latest_open_file_->Push(batch, bytes);
   }
 
   Result<std::string> GetNextFilename() {
@@ -521,7 +578,8 @@ class DatasetWriter::DatasetWriterImpl {
               return Status::OK();
             })),
         write_options_(std::move(write_options)),
-        writer_state_(max_rows_queued, write_options_.max_open_files,
+        writer_state_(max_rows_queued, write_options_.max_bytes_queued,
+                      write_options_.max_open_files,
                       CalculateMaxRowsStaged(max_rows_queued)),
         pause_callback_(std::move(pause_callback)),
         resume_callback_(std::move(resume_callback)) {}
@@ -649,23 +707,40 @@ class DatasetWriter::DatasetWriterImpl {
         EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyRowsQueued");
         break;
       }
+      uint64_t chunk_bytes = 0;
+      if (!writer_state_.bytes_in_flight_throttle.Unthrottled()) {
+        ARROW_ASSIGN_OR_RAISE(int64_t referenced,
+                              util::ReferencedBufferSize(*next_chunk));
+        // A chunk larger than the whole budget must still be able to proceed alone
+        chunk_bytes = std::min(static_cast<uint64_t>(referenced),
+                               writer_state_.bytes_in_flight_throttle.max_value());
+        backpressure = writer_state_.bytes_in_flight_throttle.Acquire(chunk_bytes);
+        if (!backpressure.is_finished()) {
+          EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyBytesQueued");
+          writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
+          break;
+        }
+      }
       if (will_open_file) {
         backpressure = writer_state_.open_files_throttle.Acquire(1);
         if (!backpressure.is_finished()) {
           EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyOpenFiles");
           writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
+          writer_state_.bytes_in_flight_throttle.Release(chunk_bytes);
           RETURN_NOT_OK(TryCloseLargestFile());
           break;
         }
       }
-      auto s = dir_queue->StartWrite(next_chunk);
+      auto s = dir_queue->StartWrite(next_chunk, chunk_bytes);
       if (!s.ok()) {
         // If `StartWrite` succeeded, it will Release the
-        // `rows_in_flight_throttle` when the write task is finished.
+        // `rows_in_flight_throttle` and `bytes_in_flight_throttle` when the write
+        // task is finished.
         //
         // `open_files_throttle` will be handed by `DatasetWriterDirectoryQueue`
         // so we don't need to release it here.
         writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
+        writer_state_.bytes_in_flight_throttle.Release(chunk_bytes);
         return s;
       }
       batch = std::move(remainder);
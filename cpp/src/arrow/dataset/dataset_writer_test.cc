@@ -32,6 +32,7 @@
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/config.h"
+#include "arrow/util/thread_pool.h"
 #include "gtest/gtest.h"
 
 using namespace std::string_view_literals;  // NOLINT
@@ -419,6 +420,38 @@ TEST_F(DatasetWriterTestFixture, MinRowGroupBackpressure) {
   AssertCreatedData(expected_files);
 }
 
+TEST_F(DatasetWriterTestFixture, MaxBytesQueuedBackpressure) {
+  // Each batch references 72 bytes.  Staging a batch per partition would fill the
+  // 300 byte budget and stall the writer, so staged rows must be evicted once they
+  // reference a quarter of it.
+  write_options_.min_rows_per_group = 10;
+  write_options_.max_bytes_queued = 300;
+  auto dataset_writer = MakeDatasetWriter();
+  std::vector<ExpectedFile> expected_files;
+  for (int i = 0; i < 12; i++) {
+    expected_files.push_back({"testdir/" + std::to_string(i) + "/chunk-0.arrow",
+                              static_cast<uint64_t>(i * 9), 9, 1});
+    dataset_writer->WriteRecordBatch(MakeBatch(9), std::to_string(i));
+  }
+  EndWriterChecked(dataset_writer.get());
+  AssertCreatedData(expected_files);
+}
+
+TEST_F(DatasetWriterTestFixture, WriteExecutor) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Concurrent writes tests need threads";
+#endif
+  write_options_.write_executor = ::arrow::internal::GetCpuThreadPool();
+  write_options_.max_rows_per_group = 10;
+  // A single chunk larger than the byte budget still gets through
+  write_options_.max_bytes_queued = 16;
+  auto dataset_writer = MakeDatasetWriter();
+  dataset_writer->WriteRecordBatch(MakeBatch(25), "");
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "");
+  EndWriterChecked(dataset_writer.get());
+  AssertCreatedData({{"testdir/chunk-0.arrow", 0, 35, 4}});
+}
+
 TEST_F(DatasetWriterTestFixture, ConcurrentWritesSameFile) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Concurrent writes tests need threads";
@@ -18,22 +18,40 @@
 #include "arrow/dataset/discovery.h"
 
 #include <algorithm>
+#include <cmath>
+#include <functional>
 #include <memory>
 #include <string>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/array_binary.h"
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/compute/expression.h"
 #include "arrow/dataset/dataset.h"
+#include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/partition.h"
+#include "arrow/dataset/projector.h"
 #include "arrow/dataset/type_fwd.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/dictionary.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/table.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string.h"
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::StartsWith;
 
 namespace dataset {
@@ -168,6 +186,72 @@ bool StartsWithAnyOf(const std::string& path, const std::vector<std::string>& pr
   });
 }
 
+namespace {
+
+// Returns false if the partition expression parsed from `path` (relative to the
+// partition base dir) cannot satisfy `filter`, which is bound to `schema`. Paths that
+// fail to parse are kept.
+Result<bool> PartitionMaySatisfy(const Partitioning& partitioning,
+                                 const compute::Expression& filter,
+                                 const std::string& path, const Schema& schema) {
+  auto maybe_partition = partitioning.Parse(path);
+  if (!maybe_partition.ok()) return true;
+  ARROW_ASSIGN_OR_RAISE(auto partition, maybe_partition->Bind(schema));
+  ARROW_ASSIGN_OR_RAISE(auto simplified, SimplifyWithGuarantee(filter, partition));
+  return simplified.IsSatisfiable();
+}
+
+Result<bool> IsIgnored(const std::string& base_dir, const fs::FileInfo& info,
+                       const std::vector<std::string>& ignore_prefixes) {
+  auto relative = fs::internal::RemoveAncestor(base_dir, info.path());
+  if (!relative.has_value()) {
+    return Status::Invalid("GetFileInfo() yielded path '", info.path(),
+                           "', which is outside base dir '", base_dir, "'");
+  }
+  return StartsWithAnyOf(std::string(*relative), ignore_prefixes);
+}
+
+// Lists the tree under `selector.base_dir` level by level. The directories of each
+// level are listed with non-recursive selectors, up to `concurrency` at a time.
+// Directories rejected by `keep_dir` are neither returned nor descended into.
+Result<std::vector<fs::FileInfo>> ListLevelByLevel(
+    const std::shared_ptr<fs::FileSystem>& filesystem, const fs::FileSelector& selector,
+    int concurrency, const std::function<Result<bool>(const fs::FileInfo&)>& keep_dir) {
+  std::vector<fs::FileInfo> infos;
+  std::vector<std::string> dirs = {selector.base_dir};
+  for (int32_t depth = 0; !dirs.empty(); ++depth) {
+    // Only the base directory honors allow_not_found; nested directories may be
+    // removed concurrently with the walk.
+    const bool allow_not_found = depth == 0 ? selector.allow_not_found : true;
+    auto list_dir = [filesystem, allow_not_found](const std::string& dir) {
+      fs::FileSelector dir_selector;
+      dir_selector.base_dir = dir;
+      dir_selector.allow_not_found = allow_not_found;
+      return filesystem->GetFileInfoGenerator(dir_selector);
+    };
+    auto listings = MakeMergedGenerator(
+        MakeMappedGenerator(MakeVectorGenerator(std::move(dirs)), std::move(list_dir)),
+        concurrency);
+    ARROW_ASSIGN_OR_RAISE(auto level,
+                          CollectAsyncGenerator(std::move(listings)).result());
+
+    dirs.clear();
+    for (auto& batch : level) {
+      for (auto& info : batch) {
+        if (info.IsDirectory()) {
+          ARROW_ASSIGN_OR_RAISE(bool keep, keep_dir(info));
+          if (!keep) continue;
+          if (depth < selector.max_recursion) dirs.push_back(info.path());
+        }
+        infos.push_back(std::move(info));
+      }
+    }
+  }
+  return infos;
+}
+
+}  // namespace
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
@@ -179,23 +263,75 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
 
-  // Filter out anything that's not a file or that's explicitly ignored
+  std::shared_ptr<Partitioning> partitioning;
+  compute::Expression partition_filter = options.partition_filter;
+  const bool has_partition_filter = partition_filter != compute::literal(true);
+  if (has_partition_filter) {
+    partitioning = options.partitioning.partitioning();
+    if (partitioning == nullptr) {
+      return Status::Invalid(
+          "FileSystemFactoryOptions::partition_filter requires an explicit "
+          "Partitioning");
+    }
+    ARROW_ASSIGN_OR_RAISE(partition_filter,
+                          partition_filter.Bind(*partitioning->schema()));
+  }
+
+  auto is_ignored = [&](const fs::FileInfo& info) {
+    return IsIgnored(selector.base_dir, info, options.selector_ignore_prefixes);
+  };
+
+  std::vector<fs::FileInfo> files;
+  if (selector.recursive && (has_partition_filter || options.listing_concurrency > 1)) {
+    // Directory partitionings encode keys in directory names only, so a directory
+    // can be pruned as soon as its own partition expression is unsatisfiable.
+    const bool prune_dirs = has_partition_filter &&
+                            (partitioning->type_name() == "hive" ||
+                             partitioning->type_name() == "directory");
+    auto keep_dir = [&](const fs::FileInfo& info) -> Result<bool> {
+      ARROW_ASSIGN_OR_RAISE(bool ignored, is_ignored(info));
+      if (ignored) return false;
+      if (!prune_dirs) return true;
+      // A trailing separator makes the whole directory path parse as partition
+      // segments rather than the last segment being taken as a file name.
+      return PartitionMaySatisfy(
+          *partitioning, partition_filter,
+          StripPrefix(info.path(), options.partition_base_dir) + "/",
+          *partitioning->schema());
+    };
+    ARROW_ASSIGN_OR_RAISE(files,
+                          ListLevelByLevel(filesystem, selector,
+                                           std::max(options.listing_concurrency, 1),
+                                           keep_dir));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(files, filesystem->GetFileInfo(selector));
+  }
+
+  // Filter out anything that's not a file, that's explicitly ignored or whose
+  // partition cannot satisfy the partition filter
   Status st;
   auto files_end =
       std::remove_if(files.begin(), files.end(), [&](const fs::FileInfo& info) {
         if (!info.IsFile()) return true;
 
-        auto relative = fs::internal::RemoveAncestor(selector.base_dir, info.path());
-        if (!relative.has_value()) {
-          st = Status::Invalid("GetFileInfo() yielded path '", info.path(),
-                               "', which is outside base dir '", selector.base_dir, "'");
+        auto maybe_ignored = is_ignored(info);
+        if (!maybe_ignored.ok()) {
+          st = maybe_ignored.status();
           return false;
         }
-
-        if (StartsWithAnyOf(std::string(*relative), options.selector_ignore_prefixes)) {
-          return true;
+        if (*maybe_ignored) return true;
+
+        if (has_partition_filter) {
+          auto maybe_satisfy = PartitionMaySatisfy(
+              *partitioning, partition_filter,
+              StripPrefix(info.path(), options.partition_base_dir),
+              *partitioning->schema());
+          if (!maybe_satisfy.ok()) {
+            st = maybe_satisfy.status();
+            return false;
+          }
+          return !*maybe_satisfy;
         }
 
         return false;
@@ -237,16 +373,38 @@ Result<std::vector<std::shared_ptr<Schema>>> FileSystemDatasetFactory::InspectSc
   std::vector<std::shared_ptr<Schema>> schemas;
 
   const bool has_fragments_limit = options.fragments >= 0;
-  int fragments = options.fragments;
-  for (const auto& info : files_) {
-    if (has_fragments_limit && fragments-- == 0) break;
-    auto result = format_->Inspect({info, fs_});
+  const size_t num_inspected =
+      has_fragments_limit
+          ? std::min(files_.size(), static_cast<size_t>(options.fragments))
+          : files_.size();
+
+  auto inspect = [format = format_, filesystem = fs_](
+                     const fs::FileInfo& info) -> Result<std::shared_ptr<Schema>> {
+    auto result = format->Inspect({info, filesystem});
     if (ARROW_PREDICT_FALSE(!result.ok())) {
       return result.status().WithMessage(
           "Error creating dataset. Could not read schema from '", info.path(),
-          "'. Is this a '", format_->type_name(), "' file?: ", result.status().message());
+          "'. Is this a '", format->type_name(), "' file?: ", result.status().message());
+    }
+    return result;
+  };
+
+  if (options.fragment_readahead > 1 && num_inspected > 1) {
+    auto executor = fs_->io_context().executor();
+    auto inspect_async = [executor, inspect](const fs::FileInfo& info) {
+      return DeferNotOk(executor->Submit([inspect, info] { return inspect(info); }));
+    };
+    std::vector<fs::FileInfo> to_inspect(files_.begin(), files_.begin() + num_inspected);
+    auto inspected = MakeReadaheadGenerator(
+        MakeMappedGenerator(MakeVectorGenerator(std::move(to_inspect)),
+                            std::move(inspect_async)),
+        options.fragment_readahead);
+    ARROW_ASSIGN_OR_RAISE(schemas, CollectAsyncGenerator(std::move(inspected)).result());
+  } else {
+    for (size_t i = 0; i < num_inspected; ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto schema, inspect(files_[i]));
+      schemas.push_back(std::move(schema));
     }
-    schemas.push_back(result.MoveValueUnsafe());
   }
 
   ARROW_ASSIGN_OR_RAISE(auto partition_schema,
@@ -291,5 +449,208 @@ Result<std::shared_ptr<Dataset>> FileSystemDatasetFactory::Finish(FinishOptions
                                  std::move(fragments), std::move(partitioning));
 }
 
+FileSystemListingDataset::FileSystemListingDataset(
+    std::shared_ptr<Schema> schema, std::shared_ptr<fs::FileSystem> filesystem,
+    fs::FileSelector selector, std::shared_ptr<FileFormat> format,
+    std::shared_ptr<Partitioning> partitioning, FileSystemFactoryOptions options)
+    : Dataset(std::move(schema)),
+      filesystem_(std::move(filesystem)),
+      selector_(std::move(selector)),
+      format_(std::move(format)),
+      partitioning_(std::move(partitioning)),
+      options_(std::move(options)) {}
+
+Result<std::shared_ptr<FileSystemListingDataset>> FileSystemListingDataset::Make(
+    std::shared_ptr<Schema> schema, std::shared_ptr<fs::FileSystem> filesystem,
+    fs::FileSelector selector, std::shared_ptr<FileFormat> format,
+    FileSystemFactoryOptions options) {
+  auto partitioning = options.partitioning.partitioning();
+  if (partitioning == nullptr) {
+    return Status::Invalid("FileSystemListingDataset requires an explicit Partitioning");
+  }
+  // As in FileSystemDatasetFactory::Make, partitions are relative to the selector
+  if (options.partition_base_dir.empty() && !selector.base_dir.empty()) {
+    options.partition_base_dir = selector.base_dir;
+  }
+  ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
+  return std::shared_ptr<FileSystemListingDataset>(new FileSystemListingDataset(
+      std::move(schema), std::move(filesystem), std::move(selector), std::move(format),
+      std::move(partitioning), std::move(options)));
+}
+
+Result<std::shared_ptr<Dataset>> FileSystemListingDataset::ReplaceSchema(
+    std::shared_ptr<Schema> schema) const {
+  RETURN_NOT_OK(CheckProjectable(*schema_, *schema));
+  return std::shared_ptr<Dataset>(new FileSystemListingDataset(
+      std::move(schema), filesystem_, selector_, format_, partitioning_, options_));
+}
+
+Result<FragmentIterator> FileSystemListingDataset::GetFragmentsImpl(
+    compute::Expression predicate) {
+  const bool has_predicate = predicate != compute::literal(true);
+  const bool prune_dirs = has_predicate && (partitioning_->type_name() == "hive" ||
+                                            partitioning_->type_name() == "directory");
+  auto keep_dir = [&](const fs::FileInfo& info) -> Result<bool> {
+    ARROW_ASSIGN_OR_RAISE(bool ignored,
+                          IsIgnored(selector_.base_dir, info,
+                                    options_.selector_ignore_prefixes));
+    if (ignored) return false;
+    if (!prune_dirs) return true;
+    return PartitionMaySatisfy(
+        *partitioning_, predicate,
+        StripPrefix(info.path(), options_.partition_base_dir) + "/", *schema_);
+  };
+
+  std::vector<fs::FileInfo> files;
+  if (selector_.recursive) {
+    ARROW_ASSIGN_OR_RAISE(
+        files, ListLevelByLevel(filesystem_, selector_,
+                                std::max(options_.listing_concurrency, 1), keep_dir));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(files, filesystem_->GetFileInfo(selector_));
+  }
+  std::sort(files.begin(), files.end(), fs::FileInfo::ByPath());
+
+  FragmentVector fragments;
+  for (const auto& info : files) {
+    if (!info.IsFile()) continue;
+    ARROW_ASSIGN_OR_RAISE(bool ignored, IsIgnored(selector_.base_dir, info,
+                                                  options_.selector_ignore_prefixes));
+    if (ignored) continue;
+
+    ARROW_ASSIGN_OR_RAISE(
+        auto partition,
+        partitioning_->Parse(StripPrefix(info.path(), options_.partition_base_dir)));
+    if (has_predicate) {
+      ARROW_ASSIGN_OR_RAISE(auto bound_partition, partition.Bind(*schema_));
+      ARROW_ASSIGN_OR_RAISE(auto simplified,
+                            SimplifyWithGuarantee(predicate, bound_partition));
+      if (!simplified.IsSatisfiable()) continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto fragment, format_->MakeFragment({info, filesystem_},
+                                                               std::move(partition)));
+    fragments.push_back(std::move(fragment));
+  }
+  return MakeVectorIterator(std::move(fragments));
+}
+
+namespace {
+
+bool IsNan(const Scalar& value) {
+  if (value.type->id() == Type::FLOAT) {
+    return std::isnan(checked_cast<const FloatScalar&>(value).value);
+  } else if (value.type->id() == Type::DOUBLE) {
+    return std::isnan(checked_cast<const DoubleScalar&>(value).value);
+  }
+  return false;
+}
+
+// What the statistics of a column guarantee about its values, as
+// ParquetFileFragment::EvaluateStatisticsAsExpression derives from Parquet statistics
+std::optional<compute::Expression> StatisticsAsExpression(
+    const Field& field, int64_t num_rows, int64_t null_count,
+    const std::shared_ptr<Scalar>& min, const std::shared_ptr<Scalar>& max) {
+  auto field_expr = compute::field_ref(field.name());
+  if (num_rows > 0 && null_count == num_rows) {
+    return compute::is_null(std::move(field_expr));
+  }
+  if (min == nullptr || max == nullptr || !min->is_valid || !max->is_valid ||
+      IsNan(*min) || IsNan(*max)) {
+    return std::nullopt;
+  }
+  compute::Expression in_range;
+  if (min->Equals(*max)) {
+    in_range = compute::equal(field_expr, compute::literal(min));
+  } else {
+    in_range = compute::and_(compute::greater_equal(field_expr, compute::literal(min)),
+                             compute::less_equal(field_expr, compute::literal(max)));
+  }
+  if (null_count > 0) {
+    return compute::or_(std::move(in_range), compute::is_null(std::move(field_expr)));
+  }
+  return in_range;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<FileSystemDataset>> OpenDatasetManifest(
+    std::shared_ptr<fs::FileSystem> filesystem, const std::string& manifest_path,
+    std::shared_ptr<FileFormat> format, std::shared_ptr<Partitioning> partitioning) {
+  ARROW_ASSIGN_OR_RAISE(auto input, filesystem->OpenInputFile(manifest_path));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchFileReader::Open(input));
+  ARROW_ASSIGN_OR_RAISE(auto table, reader->ToTable());
+  ARROW_ASSIGN_OR_RAISE(auto manifest, table->CombineChunksToBatch());
+
+  const auto& metadata = manifest->schema()->metadata();
+  if (metadata == nullptr || !metadata->Contains(kDatasetManifestSchemaKey)) {
+    return Status::Invalid("'", manifest_path, "' is not a dataset manifest");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto encoded_schema, metadata->Get(kDatasetManifestSchemaKey));
+  io::BufferReader schema_reader(Buffer::FromString(
+      ::arrow::util::base64_decode(encoded_schema)));
+  ipc::DictionaryMemo dictionary_memo;
+  ARROW_ASSIGN_OR_RAISE(auto physical_schema,
+                        ipc::ReadSchema(&schema_reader, &dictionary_memo));
+
+  auto paths = manifest->GetColumnByName("path");
+  auto num_rows = manifest->GetColumnByName("num_rows");
+  auto num_bytes = manifest->GetColumnByName("num_bytes");
+  auto column_stats = manifest->GetColumnByName("columns");
+  if (paths == nullptr || paths->type_id() != Type::STRING || num_rows == nullptr ||
+      num_rows->type_id() != Type::INT64 || num_bytes == nullptr ||
+      num_bytes->type_id() != Type::INT64 || column_stats == nullptr ||
+      column_stats->type_id() != Type::STRUCT ||
+      column_stats->num_fields() != physical_schema->num_fields()) {
+    return Status::Invalid("'", manifest_path, "' is not a dataset manifest");
+  }
+  const auto& stats_struct = checked_cast<const StructArray&>(*column_stats);
+
+  const std::string base_dir = fs::internal::GetAbstractPathParent(manifest_path).first;
+  std::vector<std::shared_ptr<FileFragment>> fragments;
+  for (int64_t row = 0; row < manifest->num_rows(); ++row) {
+    const std::string path(checked_cast<const StringArray&>(*paths).GetView(row));
+    const int64_t file_rows = checked_cast<const Int64Array&>(*num_rows).Value(row);
+
+    std::vector<compute::Expression> guarantees;
+    if (partitioning != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(auto partition_expression, partitioning->Parse(path));
+      guarantees.push_back(std::move(partition_expression));
+    }
+    for (int i = 0; i < physical_schema->num_fields(); ++i) {
+      const auto& stats = checked_cast<const StructArray&>(*stats_struct.field(i));
+      const int64_t null_count =
+          checked_cast<const Int64Array&>(*stats.field(0)).Value(row);
+      std::shared_ptr<Scalar> min, max;
+      if (stats.num_fields() == 3) {
+        ARROW_ASSIGN_OR_RAISE(min, stats.field(1)->GetScalar(row));
+        ARROW_ASSIGN_OR_RAISE(max, stats.field(2)->GetScalar(row));
+      }
+      auto guarantee = StatisticsAsExpression(*physical_schema->field(i), file_rows,
+                                              null_count, min, max);
+      if (guarantee) {
+        ARROW_ASSIGN_OR_RAISE(auto bound, guarantee->Bind(*physical_schema));
+        guarantees.push_back(std::move(bound));
+      }
+    }
+
+    fs::FileInfo info(fs::internal::ConcatAbstractPath(base_dir, path),
+                      fs::FileType::File);
+    info.set_size(checked_cast<const Int64Array&>(*num_bytes).Value(row));
+    ARROW_ASSIGN_OR_RAISE(
+        auto fragment,
+        format->MakeFragment({std::move(info), filesystem},
+                             compute::and_(std::move(guarantees)), physical_schema));
+    fragments.push_back(std::move(fragment));
+  }
+
+  std::shared_ptr<Schema> schema = physical_schema;
+  if (partitioning != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(schema, UnifySchemas({schema, partitioning->schema()}));
+  }
+  return FileSystemDataset::Make(std::move(schema), compute::literal(true),
+                                 std::move(format), std::move(filesystem),
+                                 std::move(fragments), std::move(partitioning));
+}
+
 }  // namespace dataset
 }  // namespace arrow
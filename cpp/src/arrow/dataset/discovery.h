@@ -28,9 +28,11 @@
 #include <variant>
 #include <vector>
 
+#include "arrow/dataset/dataset.h"
 #include "arrow/dataset/partition.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/type_fwd.h"
 #include "arrow/result.h"
 #include "arrow/util/macros.h"
@@ -59,6 +61,14 @@ struct InspectOptions {
   /// altogether so only the partitioning schema will be inspected.
   int fragments = 1;
 
+  /// Maximum number of fragments whose schema is inspected at the same time.
+  ///
+  /// With a value greater than 1, fragments are inspected on the filesystem's IO
+  /// executor and up to this many inspections are kept in flight, which hides the
+  /// per-request latency of remote file systems. The default of `1` inspects
+  /// fragments one after another on the calling thread.
+  int fragment_readahead = 1;
+
   /// Control how to unify types. By default, types are merged strictly (the
   /// type must match exactly, except nulls can be merged with other types).
   Field::MergeOptions field_merge_options = Field::MergeOptions::Defaults();
@@ -196,6 +206,29 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  /// When discovering from a recursive Selector, skip directories and files whose
+  /// partition expression cannot satisfy this filter.
+  ///
+  /// The filter may only reference fields of the partitioning schema and requires
+  /// an explicit Partitioning (not a PartitioningFactory). With a non-trivial
+  /// filter the directory tree is listed level by level so that pruned directories
+  /// are never listed at all.
+  ///
+  /// Example (with HivePartitioning on "year" and filter year == 2020):
+  ///
+  /// - "/dataset/year=2020/data.parquet" -> discovered
+  /// - "/dataset/year=2019/" -> not listed
+  compute::Expression partition_filter = compute::literal(true);
+
+  /// Maximum number of directories listed at the same time when discovering from
+  /// a recursive Selector.
+  ///
+  /// With a value greater than 1 (or a non-trivial `partition_filter`), the
+  /// directory tree is walked level by level and the directories of each level
+  /// are listed concurrently. The default of `1` issues a single recursive
+  /// listing.
+  int listing_concurrency = 1;
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -271,5 +304,73 @@ class ARROW_DS_EXPORT FileSystemDatasetFactory : public DatasetFactory {
   FileSystemFactoryOptions options_;
 };
 
+/// \brief A Dataset which lists its files whenever fragments are requested
+///
+/// A FileSystemDataset holds the fragments discovered when it was created, so the
+/// whole tree is listed up front.  This dataset instead walks the tree on every call
+/// to GetFragments and, with a directory based partitioning, does not descend into
+/// directories whose partition expression cannot satisfy the predicate.  Listing cost
+/// is then proportional to the partitions a query touches.
+///
+/// The schema must be provided since inferring it would require a full listing, and
+/// `options.partitioning` must be an explicit Partitioning.  `partition_filter` and
+/// `exclude_invalid_files` are ignored.
+/// \ingroup dataset-filesystem
+class ARROW_DS_EXPORT FileSystemListingDataset : public Dataset {
+ public:
+  /// \brief Create a FileSystemListingDataset
+  ///
+  /// \param[in] schema the schema of the dataset
+  /// \param[in] filesystem the filesystem to list and read files from
+  /// \param[in] selector the selector listed by each call to GetFragments
+  /// \param[in] format the format of every file
+  /// \param[in] options see FileSystemFactoryOptions for more information.
+  static Result<std::shared_ptr<FileSystemListingDataset>> Make(
+      std::shared_ptr<Schema> schema, std::shared_ptr<fs::FileSystem> filesystem,
+      fs::FileSelector selector, std::shared_ptr<FileFormat> format,
+      FileSystemFactoryOptions options = {});
+
+  std::string type_name() const override { return "filesystem_listing"; }
+
+  Result<std::shared_ptr<Dataset>> ReplaceSchema(
+      std::shared_ptr<Schema> schema) const override;
+
+  const std::shared_ptr<FileFormat>& format() const { return format_; }
+  const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
+  const std::shared_ptr<Partitioning>& partitioning() const { return partitioning_; }
+
+ protected:
+  FileSystemListingDataset(std::shared_ptr<Schema> schema,
+                           std::shared_ptr<fs::FileSystem> filesystem,
+                           fs::FileSelector selector, std::shared_ptr<FileFormat> format,
+                           std::shared_ptr<Partitioning> partitioning,
+                           FileSystemFactoryOptions options);
+
+  Result<FragmentIterator> GetFragmentsImpl(compute::Expression predicate) override;
+
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  fs::FileSelector selector_;
+  std::shared_ptr<FileFormat> format_;
+  std::shared_ptr<Partitioning> partitioning_;
+  FileSystemFactoryOptions options_;
+};
+
+/// \brief Open the dataset listed by a manifest written by EnableDatasetManifest().
+///
+/// No file is listed or opened: fragments are made from the paths, sizes and physical
+/// schema recorded in the manifest, and the statistics of every file become part of its
+/// partition expression so that filters prune files without reading them.
+///
+/// \param[in] filesystem the filesystem holding the manifest and the files
+/// \param[in] manifest_path the path of the manifest, the files being listed relative
+/// to its directory
+/// \param[in] format the format of every file
+/// \param[in] partitioning if given, parses the directory of every file into a
+/// partition expression and adds its fields to the dataset schema
+ARROW_DS_EXPORT Result<std::shared_ptr<FileSystemDataset>> OpenDatasetManifest(
+    std::shared_ptr<fs::FileSystem> filesystem, const std::string& manifest_path,
+    std::shared_ptr<FileFormat> format,
+    std::shared_ptr<Partitioning> partitioning = NULLPTR);
+
 }  // namespace dataset
 }  // namespace arrow
@@ -363,6 +363,99 @@ TEST_F(FileSystemDatasetFactoryTest, InspectFragmentsLimit) {
   }
 }
 
+TEST_F(FileSystemDatasetFactoryTest, InspectFragmentReadahead) {
+  MakeFactory({fs::File("a"), fs::File("b"), fs::File("c"), fs::File("d")});
+
+  InspectOptions options;
+  options.fragment_readahead = 2;
+  for (int fragments : {0, 1, 3, InspectOptions::kInspectAllFragments}) {
+    options.fragments = fragments;
+    ASSERT_OK_AND_ASSIGN(auto schemas, factory_->InspectSchemas(options));
+    EXPECT_THAT(schemas, SizeIs((fragments < 0 ? 4 : fragments) + 1));
+  }
+}
+
+TEST_F(FileSystemDatasetFactoryTest, ListingConcurrency) {
+  selector_.base_dir = "base";
+  selector_.recursive = true;
+  factory_options_.listing_concurrency = 3;
+
+  MakeFactory({fs::File("base/a"), fs::File("base/_b"), fs::File("base/A/a"),
+               fs::File("base/A/B/a"), fs::File("base/.C/a"), fs::File("base/D/a"),
+               fs::File("other/a")});
+  AssertFinishWithPaths({"base/a", "base/A/a", "base/A/B/a", "base/D/a"});
+
+  selector_.max_recursion = 1;
+  MakeFactory({fs::File("base/a"), fs::File("base/A/a"), fs::File("base/A/B/a")});
+  AssertFinishWithPaths({"base/a", "base/A/a"});
+}
+
+TEST_F(FileSystemDatasetFactoryTest, PartitionFilter) {
+  selector_.base_dir = "base";
+  selector_.recursive = true;
+  auto year = field("year", int32());
+  auto month = field("month", int32());
+  factory_options_.partitioning =
+      std::make_shared<HivePartitioning>(schema({year, month}));
+  factory_options_.partition_filter = equal(field_ref("year"), literal(2020));
+
+  MakeFactory({fs::File("base/year=2019/month=1/a"), fs::File("base/year=2020/a"),
+               fs::File("base/year=2020/month=1/a"), fs::File("base/year=2020/month=2/a"),
+               fs::File("base/year=2021/month=2/a"), fs::File("base/unpartitioned")});
+  AssertFinishWithPaths({"base/unpartitioned", "base/year=2020/a",
+                         "base/year=2020/month=1/a", "base/year=2020/month=2/a"},
+                        schema({year, month}));
+
+  factory_options_.partitioning =
+      std::make_shared<DirectoryPartitioning>(schema({year, month}));
+  factory_options_.partition_filter = and_(equal(field_ref("year"), literal(2020)),
+                                           equal(field_ref("month"), literal(2)));
+  MakeFactory({fs::File("base/2019/2/a"), fs::File("base/2020/1/a"),
+               fs::File("base/2020/2/a"), fs::File("base/2020/2/b")});
+  AssertFinishWithPaths({"base/2020/2/a", "base/2020/2/b"}, schema({year, month}));
+
+  // The filter must be bound to an explicit partitioning
+  factory_options_.partitioning = HivePartitioning::MakeFactory();
+  MakeFileSystem({fs::File("base/year=2020/a")});
+  ASSERT_RAISES(Invalid, FileSystemDatasetFactory::Make(fs_, selector_, format_,
+                                                        factory_options_));
+}
+
+TEST_F(FileSystemDatasetFactoryTest, ListingDataset) {
+  selector_.base_dir = "base";
+  selector_.recursive = true;
+  auto year = field("year", int32());
+  auto month = field("month", int32());
+  auto dataset_schema = schema({year, month});
+  factory_options_.partitioning = std::make_shared<HivePartitioning>(dataset_schema);
+
+  MakeFileSystem({fs::File("base/year=2019/month=1/a"), fs::File("base/year=2020/a"),
+                  fs::File("base/year=2020/month=1/a"),
+                  fs::File("base/year=2021/month=2/a"), fs::File("base/unpartitioned")});
+  ASSERT_OK_AND_ASSIGN(auto dataset,
+                       FileSystemListingDataset::Make(dataset_schema, fs_, selector_,
+                                                      format_, factory_options_));
+
+  // Each call lists the file system again, pruning partitions with the predicate
+  ASSERT_OK_AND_ASSIGN(auto predicate,
+                       equal(field_ref("year"), literal(2020)).Bind(*dataset_schema));
+  ASSERT_OK_AND_ASSIGN(auto fragment_it, dataset->GetFragments(predicate));
+  AssertFragmentsAreFromPath(std::move(fragment_it),
+                             {"base/unpartitioned", "base/year=2020/a",
+                              "base/year=2020/month=1/a"});
+
+  ASSERT_OK_AND_ASSIGN(fragment_it, dataset->GetFragments());
+  AssertFragmentsAreFromPath(std::move(fragment_it),
+                             {"base/unpartitioned", "base/year=2019/month=1/a",
+                              "base/year=2020/a", "base/year=2020/month=1/a",
+                              "base/year=2021/month=2/a"});
+
+  // Discovery of the partitioning is not supported
+  factory_options_.partitioning = HivePartitioning::MakeFactory();
+  ASSERT_RAISES(Invalid, FileSystemListingDataset::Make(dataset_schema, fs_, selector_,
+                                                        format_, factory_options_));
+}
+
 TEST_F(FileSystemDatasetFactoryTest, FilenameNotPartOfPartitions) {
   // ARROW-8726: Ensure filename is not a partition.
 
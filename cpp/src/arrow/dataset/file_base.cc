@@ -22,6 +22,8 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -29,6 +31,12 @@
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_nested.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/util.h"
+#include "arrow/chunked_array.h"
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/dataset_writer.h"
@@ -40,9 +48,12 @@
 #include "arrow/io/compressed.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/map.h"
 #include "arrow/util/string.h"
@@ -178,6 +189,14 @@ Result<std::shared_ptr<FileFragment>> FileFormat::MakeFragment(
                        std::move(partition_expression), std::move(physical_schema)));
 }
 
+Result<std::shared_ptr<FileWriter>> FileFormat::MakeSortedWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<FileWriteOptions> options, fs::FileLocator destination_locator,
+    const compute::Ordering& ordering) const {
+  return MakeWriter(std::move(destination), std::move(schema), std::move(options),
+                    std::move(destination_locator));
+}
+
 Result<std::shared_ptr<Schema>> FileFragment::ReadPhysicalSchemaImpl() {
   return format_->Inspect(source_);
 }
@@ -367,6 +386,45 @@ Result<int64_t> FileWriter::GetBytesWritten() const {
   }
 }
 
+Status FileWriter::UpdateStatistics(const RecordBatch& batch) {
+  if (statistics_ == nullptr) {
+    statistics_ = std::make_unique<FileWriteStatistics>();
+    statistics_->columns.resize(schema_->num_fields());
+    for (const auto& field : schema_->fields()) {
+      has_min_max_.push_back(HasMinMax(field->type()));
+    }
+  }
+  if (batch.num_columns() != schema_->num_fields()) {
+    return Status::Invalid("Expected a batch with ", schema_->num_fields(),
+                           " columns, got ", batch.num_columns());
+  }
+  statistics_->num_rows += batch.num_rows();
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    const auto& column = batch.column(i);
+    ColumnWriteStatistics& stats = statistics_->columns[i];
+    stats.null_count += column->null_count();
+    if (!has_min_max_[i] || column->null_count() == column->length()) continue;
+
+    // Fold the previous extremes into the batch's rather than comparing scalars, so
+    // that every type supported by "min_max" is supported here.
+    Datum input = column;
+    if (stats.min != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(auto previous_min, MakeArrayFromScalar(*stats.min, 1));
+      ARROW_ASSIGN_OR_RAISE(auto previous_max, MakeArrayFromScalar(*stats.max, 1));
+      input = std::make_shared<ChunkedArray>(
+          ArrayVector{column, std::move(previous_min), std::move(previous_max)},
+          column->type());
+    }
+    ARROW_ASSIGN_OR_RAISE(Datum min_max, compute::CallFunction("min_max", {input}));
+    const auto& extremes = checked_cast<const StructScalar&>(*min_max.scalar());
+    if (extremes.value[0]->is_valid) {
+      stats.min = extremes.value[0];
+      stats.max = extremes.value[1];
+    }
+  }
+  return Status::OK();
+}
+
 namespace {
 
 Status WriteBatch(
@@ -479,7 +537,155 @@ Status FileSystemDataset::Write(const FileSystemDatasetWriteOptions& write_optio
       {"write", std::move(write_node_options)},
   });
 
-  return acero::DeclarationToStatus(std::move(plan), scanner->options()->use_threads);
+  RETURN_NOT_OK(
+      acero::DeclarationToStatus(std::move(plan), scanner->options()->use_threads));
+  return write_options.dataset_post_finish();
+}
+
+namespace {
+
+struct ManifestEntry {
+  std::string path;
+  int64_t num_bytes;
+  FileWriteStatistics statistics;
+};
+
+Status WriteDatasetManifest(const std::shared_ptr<fs::FileSystem>& filesystem,
+                            const std::string& base_dir,
+                            const std::shared_ptr<Schema>& physical_schema,
+                            const std::vector<ManifestEntry>& entries) {
+  const int64_t num_files = static_cast<int64_t>(entries.size());
+  StringBuilder path_builder;
+  Int64Builder num_rows_builder, num_bytes_builder;
+  for (const auto& entry : entries) {
+    RETURN_NOT_OK(path_builder.Append(entry.path));
+    RETURN_NOT_OK(num_rows_builder.Append(entry.statistics.num_rows));
+    RETURN_NOT_OK(num_bytes_builder.Append(entry.num_bytes));
+  }
+  ArrayVector columns(3);
+  RETURN_NOT_OK(path_builder.Finish(&columns[0]));
+  RETURN_NOT_OK(num_rows_builder.Finish(&columns[1]));
+  RETURN_NOT_OK(num_bytes_builder.Finish(&columns[2]));
+
+  // One struct<null_count, min, max> per column, without min/max for types "min_max"
+  // does not support
+  ArrayVector column_stats;
+  FieldVector column_stats_fields;
+  for (int i = 0; i < physical_schema->num_fields(); ++i) {
+    const auto& type = physical_schema->field(i)->type();
+    Int64Builder null_count_builder;
+    ScalarVector mins, maxes;
+    for (const auto& entry : entries) {
+      const ColumnWriteStatistics& stats = entry.statistics.columns[i];
+      RETURN_NOT_OK(null_count_builder.Append(stats.null_count));
+      mins.push_back(stats.min ? stats.min : MakeNullScalar(type));
+      maxes.push_back(stats.max ? stats.max : MakeNullScalar(type));
+    }
+    ArrayVector children(1);
+    FieldVector child_fields = {field("null_count", int64(), /*nullable=*/false)};
+    RETURN_NOT_OK(null_count_builder.Finish(&children[0]));
+    if (HasMinMax(type)) {
+      for (const ScalarVector* values : {&mins, &maxes}) {
+        std::unique_ptr<ArrayBuilder> builder;
+        RETURN_NOT_OK(MakeBuilder(default_memory_pool(), type, &builder));
+        RETURN_NOT_OK(builder->AppendScalars(*values));
+        children.emplace_back();
+        RETURN_NOT_OK(builder->Finish(&children.back()));
+      }
+      child_fields.push_back(field("min", type));
+      child_fields.push_back(field("max", type));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stats_array, StructArray::Make(children, child_fields));
+    column_stats_fields.push_back(
+        field(physical_schema->field(i)->name(), stats_array->type(), false));
+    column_stats.push_back(std::move(stats_array));
+  }
+  if (column_stats.empty()) {
+    columns.push_back(
+        std::make_shared<StructArray>(struct_({}), num_files, ArrayVector{}));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(columns.emplace_back(),
+                          StructArray::Make(column_stats, column_stats_fields));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto serialized_schema, ipc::SerializeSchema(*physical_schema));
+  auto manifest_schema =
+      schema({field("path", utf8(), false), field("num_rows", int64(), false),
+              field("num_bytes", int64(), false),
+              field("columns", columns.back()->type(), false)},
+             key_value_metadata({kDatasetManifestSchemaKey},
+                                {::arrow::util::base64_encode(
+                                    std::string_view(*serialized_schema))}));
+  auto batch = RecordBatch::Make(manifest_schema, num_files, std::move(columns));
+
+  const auto manifest_path =
+      fs::internal::ConcatAbstractPath(base_dir, kDatasetManifestFileName);
+  ARROW_ASSIGN_OR_RAISE(auto output, filesystem->OpenOutputStream(manifest_path));
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(output, manifest_schema));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  return output->Close();
+}
+
+}  // namespace
+
+Status EnableDatasetManifest(FileSystemDatasetWriteOptions* write_options) {
+  struct State {
+    std::mutex mutex;
+    std::shared_ptr<Schema> physical_schema;
+    std::vector<ManifestEntry> entries;
+  };
+  auto state = std::make_shared<State>();
+  const std::string base_dir = write_options->base_dir;
+  write_options->collect_statistics = true;
+
+  write_options->writer_post_finish =
+      [state, base_dir, previous = std::move(write_options->writer_post_finish)](
+          FileWriter* writer) -> Status {
+    RETURN_NOT_OK(previous(writer));
+    ManifestEntry entry;
+    const std::string& path = writer->destination().path;
+    auto relative = fs::internal::RemoveAncestor(base_dir, path);
+    entry.path = relative ? std::string(*relative) : path;
+    ARROW_ASSIGN_OR_RAISE(entry.num_bytes, writer->GetBytesWritten());
+    if (writer->statistics() != nullptr) {
+      entry.statistics = *writer->statistics();
+    } else {
+      // Nothing was written
+      entry.statistics.columns.resize(writer->schema()->num_fields());
+    }
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (state->physical_schema == nullptr) {
+      state->physical_schema = writer->schema();
+    } else if (!state->physical_schema->Equals(*writer->schema(),
+                                               /*check_metadata=*/false)) {
+      return Status::Invalid("Cannot write a manifest of files with different schemas: ",
+                             state->physical_schema->ToString(), " vs ",
+                             writer->schema()->ToString());
+    }
+    state->entries.push_back(std::move(entry));
+    return Status::OK();
+  };
+
+  write_options->dataset_post_finish =
+      [state, filesystem = write_options->filesystem, base_dir,
+       previous = std::move(write_options->dataset_post_finish)]() -> Status {
+    RETURN_NOT_OK(previous());
+    std::shared_ptr<Schema> physical_schema;
+    std::vector<ManifestEntry> entries;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      physical_schema = std::move(state->physical_schema);
+      entries.swap(state->entries);
+    }
+    if (physical_schema == nullptr) return Status::OK();
+    // Files finish in any order; sort them so the manifest is deterministic.
+    std::sort(entries.begin(), entries.end(),
+              [](const auto& l, const auto& r) { return l.path < r.path; });
+    return WriteDatasetManifest(filesystem, base_dir, physical_schema, entries);
+  };
+  return Status::OK();
 }
 
 Result<acero::ExecNode*> MakeWriteNode(acero::ExecPlan* plan,
@@ -534,6 +740,19 @@ Result<acero::ExecNode*> MakeWriteNode(acero::ExecPlan* plan,
     return Status::Invalid("Must provide partitioning");
   }
 
+  if (!write_options.clustering_keys.empty()) {
+    // The consuming sink sequences its input when it is ordered, so each file receives
+    // its rows in clustering order.
+    acero::OrderByNodeOptions order_by_options(
+        compute::Ordering(write_options.clustering_keys));
+    order_by_options.spill_threshold_bytes =
+        write_options.clustering_spill_threshold_bytes;
+    ARROW_ASSIGN_OR_RAISE(
+        acero::ExecNode * order_by,
+        acero::MakeExecNode("order_by", plan, std::move(inputs), order_by_options));
+    inputs = {order_by};
+  }
+
   std::shared_ptr<DatasetWritingSinkNodeConsumer> consumer =
       std::make_shared<DatasetWritingSinkNodeConsumer>(custom_schema, write_options);
 
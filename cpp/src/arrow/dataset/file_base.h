@@ -107,6 +107,9 @@ class ARROW_DS_EXPORT FileSource : public util::EqualityComparable<FileSource> {
     return filesystem_ ? file_info_.path() : buffer_ ? buffer_path : custom_open_path;
   }
 
+  /// \brief Return the file info, if any. Only valid when file source wraps a path.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
@@ -201,6 +204,15 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
       std::shared_ptr<FileWriteOptions> options,
       fs::FileLocator destination_locator) const = 0;
 
+  /// \brief Create a writer for files whose rows are sorted by `ordering`.
+  ///
+  /// Formats that can record a sort order in their metadata, such as Parquet's
+  /// sorting_columns, override this.  The default ignores the ordering.
+  virtual Result<std::shared_ptr<FileWriter>> MakeSortedWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<FileWriteOptions> options, fs::FileLocator destination_locator,
+      const compute::Ordering& ordering) const;
+
   /// \brief Get default write options for this format.
   ///
   /// May return null shared_ptr if this file format does not yet support
@@ -345,6 +357,21 @@ class ARROW_DS_EXPORT FileWriteOptions {
   std::shared_ptr<FileFormat> format_;
 };
 
+/// \brief Statistics of a column of a written file
+struct ARROW_DS_EXPORT ColumnWriteStatistics {
+  /// The smallest and largest non-null values, null if the column holds none or if
+  /// its type is not supported by the "min_max" function.
+  std::shared_ptr<Scalar> min, max;
+  int64_t null_count = 0;
+};
+
+/// \brief Statistics of a written file, accumulated as its batches are written
+struct ARROW_DS_EXPORT FileWriteStatistics {
+  int64_t num_rows = 0;
+  /// One per field of the written schema
+  std::vector<ColumnWriteStatistics> columns;
+};
+
 /// \brief A writer for this format.
 class ARROW_DS_EXPORT FileWriter {
  public:
@@ -367,6 +394,16 @@ class ARROW_DS_EXPORT FileWriter {
   /// \brief After Finish() is called, provides number of bytes written to file.
   Result<int64_t> GetBytesWritten() const;
 
+  /// \brief Add the rows of `batch` to statistics().
+  ///
+  /// The dataset writer calls this for every batch written if
+  /// FileSystemDatasetWriteOptions::collect_statistics is true.
+  Status UpdateStatistics(const RecordBatch& batch);
+
+  /// \brief Statistics of the batches passed to UpdateStatistics(), or null if it
+  /// was never called.
+  const FileWriteStatistics* statistics() const { return statistics_.get(); }
+
  protected:
   FileWriter(std::shared_ptr<Schema> schema, std::shared_ptr<FileWriteOptions> options,
              std::shared_ptr<io::OutputStream> destination,
@@ -383,6 +420,9 @@ class ARROW_DS_EXPORT FileWriter {
   std::shared_ptr<io::OutputStream> destination_;
   fs::FileLocator destination_locator_;
   std::optional<int64_t> bytes_written_;
+  std::unique_ptr<FileWriteStatistics> statistics_;
+  // Whether "min_max" supports the type of each field
+  std::vector<bool> has_min_max_;
 };
 
 /// \brief Options for writing a dataset.
@@ -438,6 +478,36 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
   /// group size is just barely larger than this value).
   uint64_t max_rows_per_group = 1 << 20;
 
+  /// If greater than 0 then this limits how many bytes of batches the dataset writer
+  /// keeps queued or staged before applying backpressure, in addition to its row
+  /// limit.  This bounds memory when rows are wide or when many partitions are open
+  /// and each stages rows for min_rows_per_group.
+  uint64_t max_bytes_queued = 0;
+
+  /// Executor on which batches are handed to the FileWriters, where they are encoded
+  /// and compressed.  If null, the filesystem's IO executor is used.
+  ///
+  /// Output streams that upload in the background (e.g. S3 with background_writes)
+  /// return from writes once the data is buffered, so passing the CPU thread pool
+  /// here keeps encoding off the IO threads while uploads proceed on them.
+  ::arrow::internal::Executor* write_executor = NULLPTR;
+
+  /// If not empty, rows are sorted by these keys before they are partitioned and
+  /// written, so that each file and row group covers a narrow range of the keys and
+  /// their statistics prune well.  The sort is done by an Acero order_by node ahead of
+  /// the writer and files record it where the format allows (see
+  /// FileFormat::MakeSortedWriter).
+  std::vector<compute::SortKey> clustering_keys;
+
+  /// Input size, in bytes, above which the clustering sort spills sorted runs to disk.
+  /// \see acero::OrderByNodeOptions::spill_threshold_bytes
+  int64_t clustering_spill_threshold_bytes = -1;
+
+  /// If true, the row count and the column min/max and null counts of every file are
+  /// accumulated as its batches are written, for FileWriter::statistics() to return
+  /// them in `writer_post_finish`.
+  bool collect_statistics = false;
+
   /// Controls what happens if an output directory already exists.
   ExistingDataBehavior existing_data_behavior = ExistingDataBehavior::kError;
 
@@ -457,11 +527,31 @@ struct ARROW_DS_EXPORT FileSystemDatasetWriteOptions {
     return Status::OK();
   };
 
+  /// Callback to be invoked once by FileSystemDataset::Write after every
+  /// FileWriter has been finished, e.g. to write dataset-level summary files.
+  std::function<Status()> dataset_post_finish = [] { return Status::OK(); };
+
   const std::shared_ptr<FileFormat>& format() const {
     return file_write_options->format();
   }
 };
 
+/// \brief Make FileSystemDataset::Write emit a manifest of the files it writes.
+///
+/// Sets `collect_statistics`, gathers the statistics of every file through
+/// `writer_post_finish` (chained after any existing callback) and, once all files are
+/// finished, `dataset_post_finish` writes them as an Arrow IPC file at
+/// `<base_dir>/_manifest.arrow`.  It has one row per file with its path relative to
+/// base_dir, its row count, its size and a "columns" struct holding the null count and
+/// min/max of each column.  OpenDatasetManifest() plans a dataset from that single file
+/// instead of opening every file written.
+///
+/// The manifest only lists the files of this write.  Call this once per
+/// FileSystemDatasetWriteOptions: each call chains another collector onto the
+/// callbacks.
+ARROW_DS_EXPORT Status EnableDatasetManifest(
+    FileSystemDatasetWriteOptions* write_options);
+
 /// \brief Wraps FileSystemDatasetWriteOptions for consumption as compute::ExecNodeOptions
 class ARROW_DS_EXPORT WriteNodeOptions : public acero::ExecNodeOptions {
  public:
@@ -24,6 +24,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "arrow/csv/chunker.h"
 #include "arrow/csv/options.h"
 #include "arrow/csv/parser.h"
 #include "arrow/csv/reader.h"
@@ -275,9 +276,12 @@ static inline Result<csv::ReadOptions> GetReadOptions(
   return read_options;
 }
 
+// If `input` is given it is read instead of opening `source`, which is then only used
+// to name the source in errors.
 static inline Future<std::shared_ptr<csv::StreamingReader>> OpenReaderAsync(
     const FileSource& source, const CsvFileFormat& format,
-    const std::shared_ptr<ScanOptions>& scan_options, Executor* cpu_executor) {
+    const std::shared_ptr<ScanOptions>& scan_options, Executor* cpu_executor,
+    std::shared_ptr<io::InputStream> input = nullptr) {
 #ifdef ARROW_WITH_OPENTELEMETRY
   auto tracer = arrow::internal::tracing::GetTracer();
   auto span = tracer->StartSpan("arrow::dataset::CsvFileFormat::OpenReaderAsync");
@@ -287,9 +291,11 @@ static inline Future<std::shared_ptr<csv::StreamingReader>> OpenReaderAsync(
       GetFragmentScanOptions<CsvFragmentScanOptions>(
           kCsvTypeName, scan_options.get(), format.default_fragment_scan_options));
   ARROW_ASSIGN_OR_RAISE(auto reader_options, GetReadOptions(format, scan_options));
-  ARROW_ASSIGN_OR_RAISE(auto input, source.OpenCompressed());
-  if (fragment_scan_options->stream_transform_func) {
-    ARROW_ASSIGN_OR_RAISE(input, fragment_scan_options->stream_transform_func(input));
+  if (!input) {
+    ARROW_ASSIGN_OR_RAISE(input, source.OpenCompressed());
+    if (fragment_scan_options->stream_transform_func) {
+      ARROW_ASSIGN_OR_RAISE(input, fragment_scan_options->stream_transform_func(input));
+    }
   }
   const auto& path = source.path();
   ARROW_ASSIGN_OR_RAISE(
@@ -348,6 +354,138 @@ static RecordBatchGenerator GeneratorFromReader(
   return MakeFromFuture(std::move(gen_fut));
 }
 
+struct CsvFileRanges {
+  // Column names of the file, as read from the header of the first range
+  std::vector<std::string> column_names;
+  // One stream per byte range, in file order
+  std::vector<std::shared_ptr<io::InputStream>> streams;
+};
+
+// Split a file into ranges of roughly `range_size` bytes that each end on a row
+// boundary.  This is only valid when values cannot contain newlines since the boundary
+// is simply the first newline found after the nominal split point.
+static Result<CsvFileRanges> SplitIntoRanges(
+    const std::shared_ptr<io::RandomAccessFile>& file,
+    const csv::ReadOptions& read_options, const csv::ParseOptions& parse_options,
+    int64_t range_size, MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(int64_t file_size, file->GetSize());
+  ARROW_ASSIGN_OR_RAISE(auto first_block, file->ReadAt(0, read_options.block_size));
+  CsvFileRanges ranges;
+  ARROW_ASSIGN_OR_RAISE(ranges.column_names,
+                        GetOrderedColumnNames(read_options, parse_options,
+                                              std::string_view(*first_block), pool));
+
+  auto chunker = csv::MakeChunker(parse_options);
+  int64_t start = 0;
+  do {
+    int64_t end = file_size;
+    // The byte before the split point is used as a non-empty partial row so that the
+    // chunker looks for the end of the row straddling the split point
+    int64_t split = start + range_size - 1;
+    for (int64_t window = read_options.block_size; split < file_size - 1; window *= 2) {
+      ARROW_ASSIGN_OR_RAISE(auto data,
+                            file->ReadAt(split, std::min(window, file_size - split)));
+      std::shared_ptr<Buffer> completion, rest;
+      if (chunker
+              ->ProcessWithPartial(SliceBuffer(data, 0, 1), SliceBuffer(data, 1),
+                                   &completion, &rest)
+              .ok()) {
+        end = split + 1 + completion->size();
+        break;
+      }
+      if (split + data->size() >= file_size) {
+        // The last row is not newline terminated
+        break;
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stream,
+                          io::RandomAccessFile::GetStream(file, start, end - start));
+    ranges.streams.push_back(std::move(stream));
+    start = end;
+  } while (start < file_size);
+  return ranges;
+}
+
+// Read a file as a sequence of byte ranges that are parsed and converted concurrently.
+//
+// The first range is read like a whole file would be (it contains the header) and its
+// schema fixes the column types of the remaining ranges so that type inference cannot
+// disagree between ranges.
+static Result<RecordBatchGenerator> MakeRangedGenerator(
+    const FileSource& source, const CsvFileFormat& format,
+    const std::shared_ptr<ScanOptions>& scan_options, int64_t range_size) {
+  using BatchGenerator = AsyncGenerator<std::shared_ptr<RecordBatch>>;
+  auto* cpu_executor = ::arrow::internal::GetCpuThreadPool();
+  ARROW_ASSIGN_OR_RAISE(auto read_options, GetReadOptions(format, scan_options));
+  range_size = std::max(range_size, static_cast<int64_t>(read_options.block_size));
+  ARROW_ASSIGN_OR_RAISE(auto file, source.Open());
+
+  auto ranges_fut = DeferNotOk(io::default_io_context().executor()->Submit(
+      [file, read_options, parse_options = format.parse_options, range_size,
+       pool = scan_options->pool]() {
+        return SplitIntoRanges(file, read_options, parse_options, range_size, pool);
+      }));
+  auto gen_fut = ranges_fut.Then([=](const CsvFileRanges& ranges)
+                                     -> Future<RecordBatchGenerator> {
+    auto first_reader_fut = OpenReaderAsync(source, format, scan_options, cpu_executor,
+                                            ranges.streams.front());
+    return first_reader_fut.Then(
+        [=](const std::shared_ptr<csv::StreamingReader>& first_reader)
+            -> Result<RecordBatchGenerator> {
+          BatchGenerator first_gen = [first_reader]() {
+            return first_reader->ReadNextAsync();
+          };
+          if (ranges.streams.size() == 1) {
+            return MakeChunkedBatchGenerator(std::move(first_gen),
+                                             scan_options->batch_size);
+          }
+
+          // The remaining ranges have no header
+          auto range_read_options = read_options;
+          range_read_options.skip_rows = 0;
+          range_read_options.skip_rows_after_names = 0;
+          range_read_options.autogenerate_column_names = false;
+          range_read_options.column_names = ranges.column_names;
+          ARROW_ASSIGN_OR_RAISE(auto csv_scan_options,
+                                GetFragmentScanOptions<CsvFragmentScanOptions>(
+                                    kCsvTypeName, scan_options.get(),
+                                    format.default_fragment_scan_options));
+          auto range_convert_options = csv_scan_options->convert_options;
+          range_convert_options.include_columns.clear();
+          for (const auto& field : first_reader->schema()->fields()) {
+            range_convert_options.include_columns.push_back(field->name());
+            range_convert_options.column_types[field->name()] = field->type();
+          }
+
+          std::vector<std::shared_ptr<io::InputStream>> rest(ranges.streams.begin() + 1,
+                                                             ranges.streams.end());
+          AsyncGenerator<BatchGenerator> rest_gens = MakeMappedGenerator(
+              MakeVectorGenerator(std::move(rest)),
+              [=](const std::shared_ptr<io::InputStream>& stream) {
+                return csv::StreamingReader::MakeAsync(
+                           io::default_io_context(), stream, cpu_executor,
+                           range_read_options, format.parse_options,
+                           range_convert_options)
+                    .Then([](const std::shared_ptr<csv::StreamingReader>& reader)
+                              -> BatchGenerator {
+                      return [reader]() { return reader->ReadNextAsync(); };
+                    });
+              });
+          std::vector<AsyncGenerator<BatchGenerator>> gens_of_gens = {
+              MakeVectorGenerator<BatchGenerator>({std::move(first_gen)}),
+              std::move(rest_gens)};
+          AsyncGenerator<BatchGenerator> all_gens =
+              MakeConcatenatedGenerator(MakeVectorGenerator(std::move(gens_of_gens)));
+          int max_subscriptions = std::max(2, cpu_executor->GetCapacity());
+          ARROW_ASSIGN_OR_RAISE(
+              auto merged, MakeSequencedMergedGenerator(std::move(all_gens),
+                                                        max_subscriptions));
+          return MakeChunkedBatchGenerator(std::move(merged), scan_options->batch_size);
+        });
+  });
+  return MakeFromFuture(std::move(gen_fut));
+}
+
 CsvFileFormat::CsvFileFormat() : FileFormat(std::make_shared<CsvFragmentScanOptions>()) {}
 
 bool CsvFileFormat::Equals(const FileFormat& format) const {
@@ -381,6 +519,20 @@ Result<RecordBatchGenerator> CsvFileFormat::ScanBatchesAsync(
     const std::shared_ptr<FileFragment>& file) const {
   auto this_ = checked_pointer_cast<const CsvFileFormat>(shared_from_this());
   auto source = file->source();
+  ARROW_ASSIGN_OR_RAISE(
+      auto csv_scan_options,
+      GetFragmentScanOptions<CsvFragmentScanOptions>(
+          kCsvTypeName, scan_options.get(), default_fragment_scan_options));
+  if (csv_scan_options->parallel_range_size > 0 && !parse_options.newlines_in_values &&
+      !csv_scan_options->stream_transform_func &&
+      source.compression() == Compression::UNCOMPRESSED) {
+    ARROW_ASSIGN_OR_RAISE(auto generator,
+                          MakeRangedGenerator(source, *this, scan_options,
+                                              csv_scan_options->parallel_range_size));
+    WRAP_ASYNC_GENERATOR_WITH_CHILD_SPAN(
+        generator, "arrow::dataset::CsvFileFormat::ScanBatchesAsync::Next");
+    return generator;
+  }
   auto reader_fut =
       OpenReaderAsync(source, *this, scan_options, ::arrow::internal::GetCpuThreadPool());
   auto generator = GeneratorFromReader(std::move(reader_fut), scan_options->batch_size);
@@ -407,7 +559,8 @@ Future<std::optional<int64_t>> CsvFileFormat::CountRows(
   }
   return csv::CountRowsAsync(options->io_context, std::move(input),
                              ::arrow::internal::GetCpuThreadPool(), read_options,
-                             self->parse_options)
+                             self->parse_options,
+                             fragment_scan_options->validate_counted_rows)
       .Then([](int64_t count) { return std::make_optional<int64_t>(count); });
 }
 
@@ -105,6 +105,23 @@ struct ARROW_DS_EXPORT CsvFragmentScanOptions : public FragmentScanOptions {
   /// through this function.  One possible use case is to transparently
   /// transcode all input files from a given character set to utf8.
   StreamWrapFunc stream_transform_func{};
+
+  /// Size in bytes of the ranges a single file is split into for parallel reading
+  ///
+  /// If greater than 0, uncompressed files larger than this (or than the block size,
+  /// whichever is larger) are split into byte ranges that end on row boundaries, and
+  /// the ranges are parsed and converted concurrently.  Batches are still produced in
+  /// file order.  Splitting is only safe when values cannot contain newlines, so it is
+  /// skipped if ParseOptions::newlines_in_values is set or a stream_transform_func is
+  /// given.  The rows to skip and the header must fit in the first range.
+  int64_t parallel_range_size = 0;
+
+  /// Whether CountRows parses rows to check they are well formed
+  ///
+  /// If false and ParseOptions::newlines_in_values is not set, rows are counted by
+  /// scanning for line terminators, which is much faster but counts malformed rows
+  /// instead of reporting them.  See csv::CountRowsAsync for the other conditions.
+  bool validate_counted_rows = true;
 };
 
 class ARROW_DS_EXPORT CsvFileWriteOptions : public FileWriteOptions {
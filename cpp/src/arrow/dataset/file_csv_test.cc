@@ -214,6 +214,37 @@ bar)");
   ASSERT_EQ(null_count, 1);
 }
 
+TEST_P(TestCsvFileFormat, ParallelRanges) {
+  if (UseScanV2() || GetCompression() != Compression::UNCOMPRESSED) {
+    GTEST_SKIP() << "Byte ranges are only used by the scanner for uncompressed files";
+  }
+  constexpr int kNumRows = 1000;
+  std::string csv = "header_skipped\ni,s\n";
+  for (int i = 0; i < kNumRows; i++) {
+    csv += std::to_string(i) + ",v" + std::to_string(i) + "\n";
+  }
+  auto source = GetFileSource(csv);
+  SetSchema({field("i", int64()), field("s", utf8())});
+  auto fragment_scan_options =
+      static_cast<CsvFragmentScanOptions*>(opts_->fragment_scan_options.get());
+  fragment_scan_options->read_options.skip_rows = 1;
+  fragment_scan_options->read_options.block_size = 64;
+  fragment_scan_options->parallel_range_size = 100;
+  auto fragment = MakeFragment(*source);
+
+  int64_t expected = 0;
+  for (auto maybe_batch : Batches(fragment)) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    const auto& i_values = checked_cast<const Int64Array&>(*batch->GetColumnByName("i"));
+    const auto& s_values = checked_cast<const StringArray&>(*batch->GetColumnByName("s"));
+    for (int64_t row = 0; row < batch->num_rows(); row++, expected++) {
+      ASSERT_EQ(i_values.Value(row), expected);
+      ASSERT_EQ(s_values.GetString(row), "v" + std::to_string(expected));
+    }
+  }
+  ASSERT_EQ(expected, kNumRows);
+}
+
 TEST_P(TestCsvFileFormat, CustomReadOptions) {
   auto source = GetFileSource(R"(header_skipped
 str
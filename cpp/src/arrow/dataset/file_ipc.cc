@@ -19,9 +19,12 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <utility>
 #include <vector>
 
+#include "arrow/compute/expression.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
@@ -104,6 +107,76 @@ static inline Result<std::vector<int>> GetIncludedFields(
   return included_fields;
 }
 
+static std::optional<compute::Expression> StatisticsAsExpression(
+    const FieldRef& ref, const std::optional<ipc::ColumnStatistics>& statistics,
+    int64_t num_rows) {
+  if (!statistics.has_value()) {
+    return std::nullopt;
+  }
+  auto field_expr = compute::field_ref(ref);
+  if (num_rows > 0 && statistics->null_count == num_rows) {
+    return compute::is_null(std::move(field_expr));
+  }
+  if (statistics->min == nullptr || statistics->max == nullptr) {
+    return std::nullopt;
+  }
+  auto lower_bound =
+      compute::greater_equal(field_expr, compute::literal(statistics->min));
+  auto upper_bound = compute::less_equal(field_expr, compute::literal(statistics->max));
+  if (statistics->null_count > 0) {
+    // Each bound disjuncted with is_null is a usable guarantee
+    lower_bound = compute::or_(std::move(lower_bound), compute::is_null(field_expr));
+    upper_bound = compute::or_(std::move(upper_bound), compute::is_null(field_expr));
+  }
+  return compute::and_(std::move(lower_bound), std::move(upper_bound));
+}
+
+// Return the indices of the record batches which may match the filter according
+// to the statistics of the file, or std::nullopt if all batches must be read.
+static Result<std::optional<std::vector<int>>> SelectRecordBatches(
+    const ipc::RecordBatchFileReader& reader, const compute::Expression& filter) {
+  if (!compute::ExpressionHasFieldRefs(filter)) {
+    return std::nullopt;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto statistics, reader.ReadStatistics());
+  if (statistics.empty()) {
+    return std::nullopt;
+  }
+  const auto& schema = *reader.schema();
+  std::vector<std::pair<FieldRef, int>> fields;
+  for (const FieldRef& ref : compute::FieldsInExpression(filter)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(schema));
+    if (match.indices().size() == 1) {
+      fields.emplace_back(ref, match.indices()[0]);
+    }
+  }
+  if (fields.empty()) {
+    return std::nullopt;
+  }
+
+  std::vector<int> batch_indices;
+  for (int i = 0; i < static_cast<int>(statistics.size()); ++i) {
+    std::vector<compute::Expression> guarantees;
+    for (const auto& [ref, field_index] : fields) {
+      if (auto guarantee = StatisticsAsExpression(
+              ref, statistics[i].columns[field_index], statistics[i].num_rows)) {
+        guarantees.push_back(std::move(*guarantee));
+      }
+    }
+    if (!guarantees.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto guarantee,
+                            compute::and_(std::move(guarantees)).Bind(schema));
+      ARROW_ASSIGN_OR_RAISE(auto simplified,
+                            compute::SimplifyWithGuarantee(filter, guarantee));
+      if (!simplified.IsSatisfiable()) {
+        continue;
+      }
+    }
+    batch_indices.push_back(i);
+  }
+  return batch_indices;
+}
+
 static inline Result<ipc::IpcReadOptions> GetReadOptions(
     const Schema& schema, const FileFormat& format, const ScanOptions& scan_options) {
   ARROW_ASSIGN_OR_RAISE(
@@ -158,16 +231,26 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
         GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
                                                        default_fragment_scan_options));
 
+    // Skip the record batches which can't match the filter
+    ARROW_ASSIGN_OR_RAISE(auto batch_indices,
+                          SelectRecordBatches(*reader, options->filter));
+    if (!batch_indices.has_value()) {
+      batch_indices.emplace(reader->num_record_batches());
+      std::iota(batch_indices->begin(), batch_indices->end(), 0);
+    }
+
     RecordBatchGenerator generator;
     if (ipc_scan_options->cache_options) {
       // Transferring helps performance when coalescing
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
-                                           /*coalesce=*/true, options->io_context,
+                                           std::move(*batch_indices), /*coalesce=*/true,
+                                           options->io_context,
                                            *ipc_scan_options->cache_options,
                                            ::arrow::internal::GetCpuThreadPool()));
     } else {
       ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
-                                           /*coalesce=*/false, options->io_context));
+                                           std::move(*batch_indices), /*coalesce=*/false,
+                                           options->io_context));
     }
     WRAP_ASYNC_GENERATOR_WITH_CHILD_SPAN(
         generator, "arrow::dataset::IpcFileFormat::ScanBatchesAsync::Next");
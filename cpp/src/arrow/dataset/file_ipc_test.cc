@@ -91,6 +91,48 @@ TEST_F(TestIpcFileFormat, IsSupported) { TestIsSupported(); }
 TEST_F(TestIpcFileFormat, CountRows) { TestCountRows(); }
 TEST_F(TestIpcFileFormat, FragmentEquals) { TestFragmentEquals(); }
 
+TEST_F(TestIpcFileFormat, SkipBatchesWithStatistics) {
+  auto ts = field("ts", int64());
+  auto name = field("name", utf8());
+  auto sch = schema({ts, name});
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  auto write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.write_statistics = true;
+  ASSERT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(sink, sch, write_options));
+  ASSERT_OK(writer->WriteRecordBatch(
+      *RecordBatchFromJSON(sch, R"([[1, "a"], [5, "b"], [null, "c"]])")));
+  ASSERT_OK(writer->WriteRecordBatch(
+      *RecordBatchFromJSON(sch, R"([[10, "d"], [15, "e"]])")));
+  ASSERT_OK(writer->WriteRecordBatch(
+      *RecordBatchFromJSON(sch, R"([[20, "f"], [25, "g"]])")));
+  ASSERT_OK(writer->WriteRecordBatch(
+      *RecordBatchFromJSON(sch, R"([[null, "h"], [null, "i"]])")));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto fragment = MakeFragment(FileSource(buffer));
+
+  auto check_scan = [&](compute::Expression filter, int64_t expected_batches,
+                        int64_t expected_rows) {
+    SetSchema({ts, name});
+    SetFilter(std::move(filter));
+    ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(opts_));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(batch_gen));
+    int64_t num_rows = 0;
+    for (const auto& batch : batches) {
+      num_rows += batch->num_rows();
+    }
+    ASSERT_EQ(static_cast<int64_t>(batches.size()), expected_batches);
+    ASSERT_EQ(num_rows, expected_rows);
+  };
+  // The batches which can't match the filter are not read
+  check_scan(greater_equal(field_ref("ts"), literal(int64_t(16))), 2, 5);
+  check_scan(less(field_ref("ts"), literal(int64_t(0))), 1, 3);
+  check_scan(is_null(field_ref("ts")), 2, 5);
+  check_scan(equal(field_ref("name"), literal("e")), 1, 2);
+  // Without field references, all batches are read
+  check_scan(literal(true), 4, 9);
+}
+
 class TestIpcFileSystemDataset : public testing::Test,
                                  public WriteFileSystemDatasetMixin {
  public:
@@ -131,6 +173,57 @@ TEST_F(TestIpcFileSystemDataset, WriteExceedsMaxPartitions) {
                                   FileSystemDataset::Write(write_options_, scanner));
 }
 
+TEST_F(TestIpcFileSystemDataset, WriteDatasetManifest) {
+  ASSERT_OK(EnableDatasetManifest(&write_options_));
+  auto partitioning = std::make_shared<DirectoryPartitioning>(
+      SchemaFromColumnNames(source_schema_, {"year", "month"}));
+  DoWrite(partitioning);
+
+  // One row per file, with the statistics of every column
+  ASSERT_OK_AND_ASSIGN(auto input, fs_->OpenInputFile("/new_root/_manifest.arrow"));
+  ASSERT_OK_AND_ASSIGN(auto reader, ipc::RecordBatchFileReader::Open(input));
+  ASSERT_OK_AND_ASSIGN(auto manifest, reader->ToTable());
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["2018/1/dat_0", "2019/1/dat_0"])"),
+                    *manifest->GetColumnByName("path")->chunk(0));
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[8, 8]"),
+                    *manifest->GetColumnByName("num_rows")->chunk(0));
+  auto sales_type = struct_({field("null_count", int64(), /*nullable=*/false),
+                             field("min", float64()), field("max", float64())});
+  auto columns = checked_pointer_cast<StructArray>(
+      manifest->GetColumnByName("columns")->chunk(0));
+  AssertArraysEqual(*ArrayFromJSON(sales_type, R"([
+      {"null_count": 0, "min": 1.0, "max": 978.0},
+      {"null_count": 0, "min": 10.0, "max": 273.5}
+    ])"),
+                    *columns->GetFieldByName("sales"));
+
+  // Files are pruned by partition and by statistics without being opened
+  ASSERT_OK_AND_ASSIGN(auto dataset,
+                       OpenDatasetManifest(fs_, "/new_root/_manifest.arrow", format_,
+                                           partitioning));
+  AssertSchemaEqual(*written_->schema(), *dataset->schema(), /*check_metadata=*/false);
+  auto fragment_paths = [&](compute::Expression predicate) {
+    std::vector<std::string> paths;
+    auto bound = predicate.Bind(*dataset->schema()).ValueOrDie();
+    for (const auto& fragment : dataset->GetFragments(bound).ValueOrDie()) {
+      paths.push_back(checked_pointer_cast<FileFragment>(*fragment)->source().path());
+    }
+    return paths;
+  };
+  EXPECT_THAT(fragment_paths(literal(true)),
+              testing::ElementsAre("/new_root/2018/1/dat_0", "/new_root/2019/1/dat_0"));
+  EXPECT_THAT(fragment_paths(greater(field_ref("sales"), literal(900.0))),
+              testing::ElementsAre("/new_root/2018/1/dat_0"));
+  EXPECT_THAT(fragment_paths(equal(field_ref("year"), literal(2019))),
+              testing::ElementsAre("/new_root/2019/1/dat_0"));
+  EXPECT_THAT(fragment_paths(equal(field_ref("region"), literal("ZZ"))),
+              testing::IsEmpty());
+
+  ASSERT_OK_AND_ASSIGN(auto scanner_builder, dataset->NewScan());
+  ASSERT_OK_AND_ASSIGN(auto scanner, scanner_builder->Finish());
+  ASSERT_OK_AND_EQ(16, scanner->CountRows());
+}
+
 class TestIpcFileFormatScan : public FileFormatScanMixin<IpcFormatHelper> {};
 
 TEST_P(TestIpcFileFormatScan, ScanRecordBatchReader) { TestScan(); }
@@ -319,6 +319,34 @@ Result<ReaderPtr> OpenReader(const FileSource& source, const JsonFileFormat& for
   return OpenReaderAsync(source, format, scan_options).result();
 }
 
+// Without newlines in values each non-blank line holds exactly one object, so objects
+// can be counted without parsing them.
+Result<int64_t> CountNonBlankLines(const FileSource& source, int64_t block_size) {
+  ARROW_ASSIGN_OR_RAISE(auto stream, source.OpenCompressed());
+  int64_t num_lines = 0;
+  bool in_line = false;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, stream->Read(block_size));
+    if (buffer->size() == 0) break;
+    const auto* data = reinterpret_cast<const char*>(buffer->data());
+    for (int64_t i = 0; i < buffer->size(); ++i) {
+      switch (data[i]) {
+        case '\n':
+        case '\r':
+          num_lines += in_line;
+          in_line = false;
+          break;
+        case ' ':
+        case '\t':
+          break;
+        default:
+          in_line = true;
+      }
+    }
+  }
+  return num_lines + in_line;
+}
+
 Result<RecordBatchGenerator> MakeBatchGenerator(
     const JsonFileFormat& format, const std::shared_ptr<ScanOptions>& scan_options,
     const std::shared_ptr<FileFragment>& file) {
@@ -389,6 +417,16 @@ Future<std::optional<int64_t>> JsonFileFormat::CountRows(
   if (ExpressionHasFieldRefs(predicate)) {
     return Future<std::optional<int64_t>>::MakeFinished(std::nullopt);
   }
+  ARROW_ASSIGN_OR_RAISE(auto json_options,
+                        GetJsonFormatOptions(*this, scan_options.get()));
+  if (!json_options->validate_counted_rows &&
+      !json_options->parse_options.newlines_in_values) {
+    auto block_size = json_options->read_options.block_size;
+    return DeferNotOk(scan_options->io_context.executor()->Submit(
+        [source = file->source(), block_size]() -> Result<std::optional<int64_t>> {
+          return CountNonBlankLines(source, block_size);
+        }));
+  }
   ARROW_ASSIGN_OR_RAISE(auto gen, MakeBatchGenerator(*this, scan_options, file));
   auto count = std::make_shared<int64_t>(0);
   return VisitAsyncGenerator(std::move(gen),
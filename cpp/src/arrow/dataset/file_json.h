@@ -91,6 +91,13 @@ struct ARROW_DS_EXPORT JsonFragmentScanOptions : public FragmentScanOptions {
 
   /// @brief Options that affect JSON reading
   json::ReadOptions read_options = json::ReadOptions::Defaults();
+
+  /// @brief Whether CountRows parses the objects to check they are well formed
+  ///
+  /// If false and `parse_options.newlines_in_values` is not set, objects are counted
+  /// as the non-blank lines of the file, which is much faster but counts malformed
+  /// objects instead of reporting them.
+  bool validate_counted_rows = true;
 };
 
 /// @}
@@ -296,6 +296,12 @@ TEST_F(TestJsonFormat, InspectFailureWithRelevantError) {
   TestInspectFailureWithRelevantError(StatusCode::Invalid, "JSON");
 }
 TEST_F(TestJsonFormat, CountRows) { TestCountRows(); }
+TEST_F(TestJsonFormat, CountRowsWithoutValidation) {
+  auto json_options = std::make_shared<JsonFragmentScanOptions>();
+  json_options->validate_counted_rows = false;
+  format_->default_fragment_scan_options = json_options;
+  TestCountRows();
+}
 
 // Common tests for new API
 TEST_F(TestJsonFormatV2, IsSupported) { TestIsSupported(); }
@@ -18,14 +18,18 @@
 #include "arrow/dataset/file_orc.h"
 
 #include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "arrow/adapters/orc/adapter.h"
+#include "arrow/compute/expression.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
-#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
 
@@ -58,87 +62,77 @@ Result<std::unique_ptr<arrow::adapters::orc::ORCFileReader>> OpenORCReader(
   return reader;
 }
 
-/// \brief A ScanTask backed by an ORC file.
-class OrcScanTask {
- public:
-  OrcScanTask(std::shared_ptr<FileFragment> fragment,
-              std::shared_ptr<ScanOptions> options)
-      : fragment_(std::move(fragment)), options_(std::move(options)) {}
-
-  Result<RecordBatchIterator> Execute() {
-    struct Impl {
-      static Result<RecordBatchIterator> Make(const FileSource& source,
-                                              const FileFormat& format,
-                                              const ScanOptions& scan_options) {
-        ARROW_ASSIGN_OR_RAISE(
-            auto reader,
-            OpenORCReader(source, std::make_shared<ScanOptions>(scan_options)));
-
-        auto materialized_fields = scan_options.MaterializedFields();
-        // filter out virtual columns
-        std::vector<std::string> included_fields;
-        ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
-        for (const auto& ref : materialized_fields) {
-          ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
-          if (match.indices().empty()) continue;
-
-          included_fields.push_back(schema->field(match.indices()[0])->name());
-        }
-
-        std::shared_ptr<RecordBatchReader> record_batch_reader;
-        ARROW_ASSIGN_OR_RAISE(
-            record_batch_reader,
-            reader->GetRecordBatchReader(scan_options.batch_size, included_fields));
-
-        return RecordBatchIterator(Impl{std::move(record_batch_reader)});
-      }
-
-      Result<std::shared_ptr<RecordBatch>> Next() {
-        std::shared_ptr<RecordBatch> batch;
-        RETURN_NOT_OK(record_batch_reader_->ReadNext(&batch));
-        return batch;
-      }
-
-      std::shared_ptr<RecordBatchReader> record_batch_reader_;
-    };
-
-    return Impl::Make(fragment_->source(),
-                      *checked_pointer_cast<FileFragment>(fragment_)->format(),
-                      *options_);
+// The guarantee that the statistics of a stripe make about a field
+std::optional<compute::Expression> StatisticsAsExpression(
+    const FieldRef& field_ref, const arrow::adapters::orc::ColumnStatistics& statistics) {
+  auto field_expr = compute::field_ref(field_ref);
+  if (statistics.num_values == 0 && statistics.has_null) {
+    return compute::is_null(std::move(field_expr));
+  }
+  if (statistics.min == nullptr || statistics.max == nullptr) {
+    return std::nullopt;
   }
+  auto min = compute::literal(statistics.min);
+  auto max = compute::literal(statistics.max);
+  compute::Expression in_range;
+  if (statistics.min->Equals(*statistics.max)) {
+    in_range = compute::equal(field_expr, std::move(min));
+  } else {
+    in_range = compute::and_(compute::greater_equal(field_expr, std::move(min)),
+                             compute::less_equal(field_expr, std::move(max)));
+  }
+  if (statistics.has_null) {
+    return compute::or_(std::move(in_range), compute::is_null(std::move(field_expr)));
+  }
+  return in_range;
+}
 
- private:
-  std::shared_ptr<FileFragment> fragment_;
-  std::shared_ptr<ScanOptions> options_;
-};
-
-class OrcScanTaskIterator {
- public:
-  static Result<Iterator<std::shared_ptr<OrcScanTask>>> Make(
-      std::shared_ptr<ScanOptions> options, std::shared_ptr<FileFragment> fragment) {
-    return Iterator<std::shared_ptr<OrcScanTask>>(
-        OrcScanTaskIterator(std::move(options), std::move(fragment)));
+// The stripes in which the predicate may be satisfied, according to their
+// statistics
+Result<std::vector<int>> FilterStripes(arrow::adapters::orc::ORCFileReader* reader,
+                                       const Schema& physical_schema,
+                                       compute::Expression predicate,
+                                       const compute::Expression& partition_expression) {
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression));
+  if (!predicate.IsSatisfiable()) {
+    return std::vector<int>{};
   }
 
-  Result<std::shared_ptr<OrcScanTask>> Next() {
-    if (once_) {
-      // Iteration is done.
-      return nullptr;
+  // Statistics are only known for top-level fields
+  std::vector<std::pair<FieldRef, int>> fields;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(physical_schema));
+    if (match.indices().size() == 1) {
+      fields.emplace_back(ref, match[0]);
     }
-
-    once_ = true;
-    return std::make_shared<OrcScanTask>(fragment_, options_);
   }
 
- private:
-  OrcScanTaskIterator(std::shared_ptr<ScanOptions> options,
-                      std::shared_ptr<FileFragment> fragment)
-      : options_(std::move(options)), fragment_(std::move(fragment)) {}
-
-  bool once_ = false;
-  std::shared_ptr<ScanOptions> options_;
-  std::shared_ptr<FileFragment> fragment_;
-};
+  std::vector<int> stripes;
+  const int num_stripes = static_cast<int>(reader->NumberOfStripes());
+  for (int stripe = 0; stripe < num_stripes; ++stripe) {
+    if (fields.empty()) {
+      stripes.push_back(stripe);
+      continue;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto statistics, reader->GetStripeStatistics(stripe));
+    std::vector<compute::Expression> guarantees;
+    for (const auto& [ref, index] : fields) {
+      if (static_cast<size_t>(index) >= statistics.size()) continue;
+      if (auto guarantee = StatisticsAsExpression(ref, statistics[index])) {
+        guarantees.push_back(std::move(*guarantee));
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto guarantee,
+                          compute::and_(std::move(guarantees)).Bind(physical_schema));
+    ARROW_ASSIGN_OR_RAISE(auto stripe_predicate,
+                          SimplifyWithGuarantee(predicate, guarantee));
+    if (stripe_predicate.IsSatisfiable()) {
+      stripes.push_back(stripe);
+    }
+  }
+  return stripes;
+}
 
 }  // namespace
 
@@ -157,45 +151,37 @@ Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source)
 Result<RecordBatchGenerator> OrcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
-  // TODO investigate "true" async version
-  // (https://issues.apache.org/jira/browse/ARROW-13795)
-  ARROW_ASSIGN_OR_RAISE(auto task_iter, OrcScanTaskIterator::Make(options, file));
-  struct IterState {
-    Iterator<std::shared_ptr<OrcScanTask>> iter;
-    RecordBatchIterator curr_iter;
-    bool first;
-    ::arrow::internal::Executor* io_executor;
-  };
-  struct {
-    Future<std::shared_ptr<RecordBatch>> operator()() {
-      auto state = state_;
-      return ::arrow::DeferNotOk(
-          state->io_executor->Submit([state]() -> Result<std::shared_ptr<RecordBatch>> {
-            if (state->first) {
-              ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-              ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-              state->first = false;
-            }
-            while (!IsIterationEnd(state->curr_iter)) {
-              ARROW_ASSIGN_OR_RAISE(auto next_batch, state->curr_iter.Next());
-              if (IsIterationEnd(next_batch)) {
-                ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-                if (IsIterationEnd(task)) {
-                  state->curr_iter = IterationEnd<RecordBatchIterator>();
-                } else {
-                  ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-                }
-              } else {
-                return next_batch;
-              }
-            }
-            return IterationEnd<std::shared_ptr<RecordBatch>>();
-          }));
+  auto make_generator = [options, file]() -> Result<RecordBatchGenerator> {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<arrow::adapters::orc::ORCFileReader> reader,
+                          OpenORCReader(file->source(), options));
+    ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
+    ARROW_ASSIGN_OR_RAISE(auto stripes, FilterStripes(reader.get(), *schema,
+                                                      options->filter,
+                                                      file->partition_expression()));
+    if (stripes.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+
+    // Only read the materialized fields, filtering out virtual columns
+    std::vector<int> included_fields;
+    for (const auto& ref : options->MaterializedFields()) {
+      ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
+      if (match.indices().empty()) continue;
+
+      included_fields.push_back(match.indices()[0]);
     }
-    std::shared_ptr<IterState> state_;
-  } iter_to_gen{std::shared_ptr<IterState>(
-      new IterState{std::move(task_iter), {}, true, options->io_context.executor()})};
-  return iter_to_gen;
+
+    arrow::adapters::orc::AsyncReadOptions read_options;
+    read_options.batch_size = options->batch_size;
+    read_options.io_context = options->io_context;
+    if (options->use_threads) {
+      read_options.cpu_executor = ::arrow::internal::GetCpuThreadPool();
+    } else {
+      read_options.stripe_readahead = 1;
+    }
+    return reader->GetRecordBatchGenerator(reader, stripes, included_fields,
+                                           read_options);
+  };
+  return MakeFromFuture(
+      DeferNotOk(options->io_context.executor()->Submit(std::move(make_generator))));
 }
 
 Future<std::optional<int64_t>> OrcFileFormat::CountRows(
@@ -21,6 +21,7 @@
 #include <utility>
 
 #include "arrow/adapters/orc/adapter.h"
+#include "arrow/array/builder_primitive.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/discovery.h"
 #include "arrow/dataset/file_base.h"
@@ -29,8 +30,10 @@
 #include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 
 namespace arrow {
 namespace dataset {
@@ -88,6 +91,53 @@ TEST_P(TestOrcFileFormatScan, ScanRecordBatchReaderWithDuplicateColumnError) {
   TestScanWithDuplicateColumnError();
 }
 TEST_P(TestOrcFileFormatScan, ScanWithPushdownNulls) { TestScanWithPushdownNulls(); }
+TEST_P(TestOrcFileFormatScan, ScanPrunesStripes) {
+  constexpr int64_t kNumRows = 10000;
+  auto i64 = field("i64", int64());
+  SetSchema({i64});
+  SetFilter(equal(field_ref("i64"), literal(int64_t{4321})));
+
+  // Sorted values in small stripes, so that the statistics exclude most stripes
+  Int64Builder builder;
+  for (int64_t i = 0; i < kNumRows; ++i) {
+    ASSERT_OK(builder.Append(i));
+  }
+  ASSERT_OK_AND_ASSIGN(auto array, builder.Finish());
+  auto table = Table::Make(schema({i64}), {array});
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  adapters::orc::WriteOptions write_options;
+  write_options.batch_size = 1000;
+  write_options.stripe_size = 1024;
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       adapters::orc::ORCFileWriter::Open(sink.get(), write_options));
+  ASSERT_OK(writer->Write(*table));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(
+      auto orc_reader,
+      adapters::orc::ORCFileReader::Open(std::make_shared<io::BufferReader>(buffer),
+                                         default_memory_pool()));
+  ASSERT_GT(orc_reader->NumberOfStripes(), 1);
+
+  auto fragment = MakeFragment(FileSource(buffer));
+  ASSERT_OK_AND_ASSIGN(auto generator, format_->ScanBatchesAsync(opts_, fragment));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(generator));
+  int64_t row_count = 0;
+  for (const auto& batch : batches) {
+    row_count += batch->num_rows();
+  }
+  ASSERT_GT(row_count, 0);
+  ASSERT_LT(row_count, kNumRows);
+
+  // The rows of the remaining stripes are still filtered by the scanner
+  row_count = 0;
+  for (auto maybe_batch : Batches(fragment)) {
+    ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+    row_count += batch->num_rows();
+  }
+  ASSERT_EQ(row_count, 1);
+}
 INSTANTIATE_TEST_SUITE_P(TestScan, TestOrcFileFormatScan,
                          ::testing::ValuesIn(TestFormatParams::Values()),
                          TestFormatParams::ToTestNameString);
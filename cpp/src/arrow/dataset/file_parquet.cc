@@ -17,13 +17,18 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <variant>
 #include <vector>
 
+#include "arrow/compute/api_aggregate.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
 #include "arrow/dataset/dataset_internal.h"
@@ -31,6 +36,9 @@
 #include "arrow/dataset/scanner.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/bit_run_reader.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
@@ -40,11 +48,19 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
+#include "parquet/column_page.h"
+#include "parquet/column_reader.h"
+#include "parquet/encoding.h"
 #include "parquet/encryption/crypto_factory.h"
 #include "parquet/encryption/encryption.h"
 #include "parquet/encryption/kms_client.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata_cache.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
+#include "parquet/row_ranges.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
@@ -75,6 +91,9 @@ parquet::ReaderProperties MakeReaderProperties(
     properties.disable_buffered_stream();
   }
   properties.set_buffer_size(parquet_scan_options->reader_properties->buffer_size());
+  if (parquet_scan_options->reader_properties->is_lazy_metadata_decoding_enabled()) {
+    properties.enable_lazy_metadata_decoding();
+  }
 
 #ifdef PARQUET_REQUIRE_ENCRYPTION
   auto parquet_decrypt_config = parquet_scan_options->parquet_decryption_config;
@@ -105,9 +124,25 @@ parquet::ReaderProperties MakeReaderProperties(
   properties.set_page_checksum_verification(
       parquet_scan_options->reader_properties->page_checksum_verification());
 
+  properties.set_file_metadata_cache(
+      parquet_scan_options->reader_properties->file_metadata_cache());
+
   return properties;
 }
 
+// Return the key under which the footer of `source` is cached, or nullopt if
+// it cannot be cached.
+std::optional<parquet::FileMetaDataCache::Key> GetMetaDataCacheKey(
+    const FileSource& source, const parquet::ReaderProperties& properties) {
+  if (properties.file_metadata_cache() == nullptr ||
+      properties.file_decryption_properties() != nullptr ||
+      source.filesystem() == nullptr) {
+    return std::nullopt;
+  }
+  return parquet::FileMetaDataCache::KeyFor(source.filesystem()->type_name(),
+                                            source.file_info());
+}
+
 parquet::ArrowReaderProperties MakeArrowReaderProperties(
     const ParquetFileFormat& format, const parquet::FileMetaData& metadata) {
   parquet::ArrowReaderProperties properties(/* use_threads = */ false);
@@ -185,6 +220,394 @@ std::optional<compute::Expression> ColumnChunkStatisticsAsExpression(
                                                              *statistics);
 }
 
+// The pages of a column chunk, as the first row of each page followed by the
+// row group size, and the guarantee given by the statistics of each page.
+struct ColumnPageGuarantees {
+  std::vector<int64_t> first_rows;
+  std::vector<compute::Expression> guarantees;
+};
+
+std::optional<ColumnPageGuarantees> ColumnPageStatisticsAsExpressions(
+    const FieldRef& field_ref, const SchemaField& schema_field,
+    const parquet::RowGroupMetaData& metadata,
+    parquet::RowGroupPageIndexReader* page_index_reader) {
+  // As for column chunk statistics, failure to extract the page statistics
+  // just disables the optimization.
+  const int column = schema_field.column_index;
+  // Only trust the page statistics where the column chunk statistics are trusted
+  if (!metadata.ColumnChunk(column)->is_stats_set()) {
+    return std::nullopt;
+  }
+  auto column_index = page_index_reader->GetColumnIndex(column);
+  auto offset_index = page_index_reader->GetOffsetIndex(column);
+  if (column_index == nullptr || offset_index == nullptr) {
+    return std::nullopt;
+  }
+  const auto& locations = offset_index->page_locations();
+  const size_t num_pages = locations.size();
+  if (num_pages == 0 || column_index->null_pages().size() != num_pages ||
+      locations.front().first_row_index != 0) {
+    return std::nullopt;
+  }
+
+  ColumnPageGuarantees pages;
+  const auto field_expr = compute::field_ref(field_ref);
+  for (size_t page = 0; page < num_pages; ++page) {
+    pages.first_rows.push_back(locations[page].first_row_index);
+    if (column_index->null_pages()[page]) {
+      pages.guarantees.push_back(compute::is_null(field_expr));
+      continue;
+    }
+    // Without null counts, assume that every page may hold nulls
+    const int64_t null_count =
+        column_index->has_null_counts() ? column_index->null_counts()[page] : 1;
+    auto statistics = parquet::Statistics::Make(
+        metadata.schema()->Column(column), column_index->encoded_min_values()[page],
+        column_index->encoded_max_values()[page], /*num_values=*/1, null_count,
+        /*distinct_count=*/0, /*has_min_max=*/true, /*has_null_count=*/true,
+        /*has_distinct_count=*/false);
+    auto guarantee = ParquetFileFragment::EvaluateStatisticsAsExpression(
+        *schema_field.field, field_ref, *statistics);
+    pages.guarantees.push_back(guarantee ? std::move(*guarantee)
+                                         : compute::literal(true));
+  }
+  pages.first_rows.push_back(metadata.num_rows());
+  for (size_t page = 0; page < num_pages; ++page) {
+    if (pages.first_rows[page] >= pages.first_rows[page + 1]) {
+      return std::nullopt;
+    }
+  }
+  return pages;
+}
+
+// A value as stored by a column of some physical type.
+using PhysicalValue = std::variant<int32_t, int64_t, std::string_view>;
+
+// Return the value as a column of the given physical type stores it, or
+// std::nullopt if the value has no unambiguous encoding in that physical type.
+std::optional<PhysicalValue> ToPhysicalValue(parquet::Type::type physical_type,
+                                             const Scalar& value) {
+  auto int32 = [&](int32_t v) -> std::optional<PhysicalValue> {
+    if (physical_type != parquet::Type::INT32) return std::nullopt;
+    return v;
+  };
+  auto int64 = [&](int64_t v) -> std::optional<PhysicalValue> {
+    if (physical_type != parquet::Type::INT64) return std::nullopt;
+    return v;
+  };
+  switch (value.type->id()) {
+    case Type::INT8:
+      return int32(checked_cast<const Int8Scalar&>(value).value);
+    case Type::INT16:
+      return int32(checked_cast<const Int16Scalar&>(value).value);
+    case Type::INT32:
+      return int32(checked_cast<const Int32Scalar&>(value).value);
+    case Type::UINT8:
+      return int32(checked_cast<const UInt8Scalar&>(value).value);
+    case Type::UINT16:
+      return int32(checked_cast<const UInt16Scalar&>(value).value);
+    case Type::UINT32:
+      return int32(static_cast<int32_t>(checked_cast<const UInt32Scalar&>(value).value));
+    case Type::DATE32:
+      return int32(checked_cast<const Date32Scalar&>(value).value);
+    case Type::INT64:
+      return int64(checked_cast<const Int64Scalar&>(value).value);
+    case Type::UINT64:
+      return int64(static_cast<int64_t>(checked_cast<const UInt64Scalar&>(value).value));
+    case Type::STRING:
+    case Type::BINARY:
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+    case Type::STRING_VIEW:
+    case Type::BINARY_VIEW: {
+      if (physical_type != parquet::Type::BYTE_ARRAY) return std::nullopt;
+      return checked_cast<const BaseBinaryScalar&>(value).view();
+    }
+    case Type::FIXED_SIZE_BINARY: {
+      if (physical_type != parquet::Type::FIXED_LEN_BYTE_ARRAY) return std::nullopt;
+      return checked_cast<const FixedSizeBinaryScalar&>(value).view();
+    }
+    default:
+      // Floating point values are not supported since equal values may have
+      // different encodings, such as 0.0 and -0.0.
+      return std::nullopt;
+  }
+}
+
+// Hash a value the way the bloom filter of a column of the given physical type does.
+uint64_t BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                         parquet::Type::type physical_type, const PhysicalValue& value) {
+  switch (physical_type) {
+    case parquet::Type::INT32:
+      return bloom_filter.Hash(std::get<int32_t>(value));
+    case parquet::Type::INT64:
+      return bloom_filter.Hash(std::get<int64_t>(value));
+    case parquet::Type::BYTE_ARRAY: {
+      parquet::ByteArray byte_array(std::get<std::string_view>(value));
+      return bloom_filter.Hash(&byte_array);
+    }
+    default: {
+      std::string_view data = std::get<std::string_view>(value);
+      parquet::FLBA flba(reinterpret_cast<const uint8_t*>(data.data()));
+      return bloom_filter.Hash(&flba, static_cast<uint32_t>(data.size()));
+    }
+  }
+}
+
+using EqualityColumns = std::unordered_map<FieldRef, const SchemaField*, FieldRef::Hash>;
+
+// Tests the equality comparisons of a predicate against literals with some
+// knowledge of the values held by the column chunks of a row group.
+class EqualityTester {
+ public:
+  EqualityTester(const EqualityColumns& columns, const parquet::SchemaDescriptor& descr)
+      : columns_(columns), descr_(descr) {}
+
+  virtual ~EqualityTester() = default;
+
+  // Return false if no row may satisfy the predicate.
+  bool MayMatch(const compute::Expression& predicate) {
+    const compute::Expression::Call* call = predicate.call();
+    if (call == nullptr) {
+      return true;
+    }
+    const std::string& function = call->function_name;
+    if (function == "and" || function == "and_kleene") {
+      return std::all_of(
+          call->arguments.begin(), call->arguments.end(),
+          [this](const compute::Expression& argument) { return MayMatch(argument); });
+    }
+    if (function == "or" || function == "or_kleene") {
+      return std::any_of(
+          call->arguments.begin(), call->arguments.end(),
+          [this](const compute::Expression& argument) { return MayMatch(argument); });
+    }
+    if (function == "equal") {
+      const compute::Expression* column = &call->arguments[0];
+      const compute::Expression* value = &call->arguments[1];
+      if (column->literal() != nullptr) {
+        std::swap(column, value);
+      }
+      if (column->field_ref() == nullptr || value->literal() == nullptr ||
+          !value->literal()->is_scalar()) {
+        return true;
+      }
+      return MayContainAny(*column->field_ref(), {value->literal()->scalar()});
+    }
+    if (function == "is_in") {
+      const FieldRef* ref = call->arguments[0].field_ref();
+      const auto& value_set =
+          checked_cast<const compute::SetLookupOptions&>(*call->options).value_set;
+      if (ref == nullptr || !value_set.is_array() || value_set.null_count() > 0) {
+        return true;
+      }
+      auto values = value_set.make_array();
+      ScalarVector scalars;
+      scalars.reserve(values->length());
+      for (int64_t i = 0; i < values->length(); ++i) {
+        auto scalar = values->GetScalar(i);
+        if (!scalar.ok()) {
+          return true;
+        }
+        scalars.push_back(scalar.MoveValueUnsafe());
+      }
+      return MayContainAny(*ref, scalars);
+    }
+    return true;
+  }
+
+ protected:
+  // Return whether the column chunk may hold the value, which is given as the
+  // column's physical type stores it.
+  virtual bool MayContain(int column_index, const PhysicalValue& value) = 0;
+
+  // Return whether the column chunk can be tested at all.
+  virtual bool CanTest(int column_index) = 0;
+
+  // Return whether the column may hold any of the values.
+  bool MayContainAny(const FieldRef& ref, const ScalarVector& values) {
+    auto it = columns_.find(ref);
+    if (it == columns_.end()) {
+      return true;
+    }
+    const SchemaField& schema_field = *it->second;
+    if (!CanTest(schema_field.column_index)) {
+      return true;
+    }
+    const auto physical_type = descr_.Column(schema_field.column_index)->physical_type();
+    for (const auto& value : values) {
+      if (!value->is_valid || !value->type->Equals(*schema_field.field->type())) {
+        return true;
+      }
+      auto physical_value = ToPhysicalValue(physical_type, *value);
+      if (!physical_value.has_value() ||
+          MayContain(schema_field.column_index, *physical_value)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  const EqualityColumns& columns_;
+  const parquet::SchemaDescriptor& descr_;
+};
+
+// Tests the equality comparisons of a predicate against literals with the bloom
+// filters of the column chunks of a row group.
+class BloomFilterTester : public EqualityTester {
+ public:
+  BloomFilterTester(const EqualityColumns& columns,
+                    const parquet::SchemaDescriptor& descr,
+                    std::shared_ptr<parquet::RowGroupBloomFilterReader> reader)
+      : EqualityTester(columns, descr), reader_(std::move(reader)) {}
+
+ protected:
+  bool CanTest(int column_index) override {
+    return GetBloomFilter(column_index) != nullptr;
+  }
+
+  bool MayContain(int column_index, const PhysicalValue& value) override {
+    const parquet::BloomFilter* bloom_filter = GetBloomFilter(column_index);
+    const auto physical_type = descr_.Column(column_index)->physical_type();
+    return bloom_filter->FindHash(BloomFilterHash(*bloom_filter, physical_type, value));
+  }
+
+ private:
+  const parquet::BloomFilter* GetBloomFilter(int column_index) {
+    if (reader_ == nullptr) {
+      return nullptr;
+    }
+    auto it = bloom_filters_.find(column_index);
+    if (it == bloom_filters_.end()) {
+      it = bloom_filters_
+               .emplace(column_index, reader_->GetColumnBloomFilter(column_index))
+               .first;
+    }
+    return it->second.get();
+  }
+
+  std::shared_ptr<parquet::RowGroupBloomFilterReader> reader_;
+  std::unordered_map<int, std::unique_ptr<parquet::BloomFilter>> bloom_filters_;
+};
+PhysicalValue AsPhysicalValue(int32_t value, int) { return value; }
+PhysicalValue AsPhysicalValue(int64_t value, int) { return value; }
+PhysicalValue AsPhysicalValue(const parquet::ByteArray& value, int) {
+  return std::string_view(value);
+}
+PhysicalValue AsPhysicalValue(const parquet::FLBA& value, int type_length) {
+  return std::string_view(reinterpret_cast<const char*>(value.ptr), type_length);
+}
+
+// Whether all the data pages of a column chunk are known to be dictionary encoded,
+// so that its dictionary holds every non-null value of the chunk.
+bool IsFullyDictionaryEncoded(const parquet::ColumnChunkMetaData& column) {
+  if (!column.has_dictionary_page() || column.encoding_stats().empty()) {
+    return false;
+  }
+  for (const parquet::PageEncodingStats& stats : column.encoding_stats()) {
+    if (stats.page_type == parquet::PageType::DICTIONARY_PAGE) continue;
+    if (stats.encoding != parquet::Encoding::PLAIN_DICTIONARY &&
+        stats.encoding != parquet::Encoding::RLE_DICTIONARY) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Tests the equality comparisons of a predicate against literals with the
+// dictionaries of the column chunks of a row group, for the chunks whose data
+// pages are all dictionary encoded.
+class DictionaryTester : public EqualityTester {
+ public:
+  DictionaryTester(const EqualityColumns& columns, const parquet::SchemaDescriptor& descr,
+                   std::unique_ptr<parquet::RowGroupMetaData> metadata,
+                   std::shared_ptr<parquet::RowGroupReader> reader, MemoryPool* pool)
+      : EqualityTester(columns, descr),
+        metadata_(std::move(metadata)),
+        reader_(std::move(reader)),
+        pool_(pool) {}
+
+ protected:
+  bool CanTest(int column_index) override {
+    return GetDictionary(column_index) != nullptr;
+  }
+
+  bool MayContain(int column_index, const PhysicalValue& value) override {
+    return GetDictionary(column_index)->values.count(value) > 0;
+  }
+
+ private:
+  struct Dictionary {
+    // Owns the data viewed by byte array values
+    std::shared_ptr<parquet::Page> page;
+    std::unordered_set<PhysicalValue> values;
+  };
+
+  const Dictionary* GetDictionary(int column_index) {
+    auto it = dictionaries_.find(column_index);
+    if (it == dictionaries_.end()) {
+      it = dictionaries_.emplace(column_index, ReadDictionary(column_index)).first;
+    }
+    return it->second.get();
+  }
+
+  std::unique_ptr<Dictionary> ReadDictionary(int column_index) {
+    if (!IsFullyDictionaryEncoded(*metadata_->ColumnChunk(column_index))) {
+      return nullptr;
+    }
+    auto page = reader_->GetColumnPageReader(column_index)->NextPage();
+    if (page == nullptr || page->type() != parquet::PageType::DICTIONARY_PAGE) {
+      return nullptr;
+    }
+    const auto& dictionary_page = static_cast<const parquet::DictionaryPage&>(*page);
+    if (dictionary_page.encoding() != parquet::Encoding::PLAIN &&
+        dictionary_page.encoding() != parquet::Encoding::PLAIN_DICTIONARY) {
+      return nullptr;
+    }
+    auto dictionary = std::make_unique<Dictionary>();
+    dictionary->page = std::move(page);
+    const parquet::ColumnDescriptor* column = descr_.Column(column_index);
+    switch (column->physical_type()) {
+      case parquet::Type::INT32:
+        DecodeValues<parquet::Int32Type>(dictionary_page, column, &dictionary->values);
+        break;
+      case parquet::Type::INT64:
+        DecodeValues<parquet::Int64Type>(dictionary_page, column, &dictionary->values);
+        break;
+      case parquet::Type::BYTE_ARRAY:
+        DecodeValues<parquet::ByteArrayType>(dictionary_page, column,
+                                             &dictionary->values);
+        break;
+      case parquet::Type::FIXED_LEN_BYTE_ARRAY:
+        DecodeValues<parquet::FLBAType>(dictionary_page, column, &dictionary->values);
+        break;
+      default:
+        return nullptr;
+    }
+    return dictionary;
+  }
+
+  template <typename DType>
+  void DecodeValues(const parquet::DictionaryPage& page,
+                    const parquet::ColumnDescriptor* column,
+                    std::unordered_set<PhysicalValue>* values) {
+    auto decoder =
+        parquet::MakeTypedDecoder<DType>(parquet::Encoding::PLAIN, column, pool_);
+    decoder->SetData(page.num_values(), page.data(), static_cast<int>(page.size()));
+    std::vector<typename DType::c_type> decoded(page.num_values());
+    const int num_decoded = decoder->Decode(decoded.data(), page.num_values());
+    values->reserve(num_decoded);
+    for (int i = 0; i < num_decoded; ++i) {
+      values->insert(AsPhysicalValue(decoded[i], column->type_length()));
+    }
+  }
+
+  std::unique_ptr<parquet::RowGroupMetaData> metadata_;
+  std::shared_ptr<parquet::RowGroupReader> reader_;
+  MemoryPool* pool_;
+  std::unordered_map<int, std::unique_ptr<Dictionary>> dictionaries_;
+};
+
 void AddColumnIndices(const SchemaField& schema_field,
                       std::vector<int>* column_projection) {
   if (schema_field.is_leaf()) {
@@ -481,13 +904,24 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties =
       MakeReaderProperties(*this, parquet_scan_options.get(), "", nullptr, options->pool);
+  std::shared_ptr<parquet::FileMetaData> known_metadata = metadata;
+  std::optional<parquet::FileMetaDataCache::Key> cache_key;
+  if (known_metadata == nullptr) {
+    cache_key = GetMetaDataCacheKey(source, properties);
+    if (cache_key.has_value()) {
+      known_metadata = properties.file_metadata_cache()->Get(*cache_key);
+    }
+  }
+  const bool cache_miss = cache_key.has_value() && known_metadata == nullptr;
+  auto cache = properties.file_metadata_cache();
+
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   // `parquet::ParquetFileReader::Open` will not wrap the exception as status,
   // so using `open_parquet_file` to wrap it.
   auto open_parquet_file = [&]() -> Result<std::unique_ptr<parquet::ParquetFileReader>> {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
-    auto reader = parquet::ParquetFileReader::Open(std::move(input),
-                                                   std::move(properties), metadata);
+    auto reader = parquet::ParquetFileReader::Open(
+        std::move(input), std::move(properties), std::move(known_metadata));
     return reader;
     END_PARQUET_CATCH_EXCEPTIONS
   };
@@ -499,6 +933,9 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   auto reader = std::move(reader_opt).ValueOrDie();
 
   std::shared_ptr<parquet::FileMetaData> reader_metadata = reader->metadata();
+  if (cache_miss) {
+    cache->Put(*cache_key, reader_metadata);
+  }
   auto arrow_properties =
       MakeArrowReaderProperties(*this, *reader_metadata, *options, *parquet_scan_options);
   std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
@@ -522,14 +959,27 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
   auto properties = MakeReaderProperties(*this, parquet_scan_options.get(), source.path(),
                                          source.filesystem(), options->pool);
   auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
+  std::shared_ptr<parquet::FileMetaData> known_metadata = metadata;
+  std::optional<parquet::FileMetaDataCache::Key> cache_key;
+  if (known_metadata == nullptr) {
+    cache_key = GetMetaDataCacheKey(source, properties);
+    if (cache_key.has_value()) {
+      known_metadata = properties.file_metadata_cache()->Get(*cache_key);
+    }
+  }
+  const bool cache_miss = cache_key.has_value() && known_metadata == nullptr;
+  auto cache = properties.file_metadata_cache();
 
   return source.OpenAsync().Then(
       [=](const std::shared_ptr<io::RandomAccessFile>& input) mutable {
         return parquet::ParquetFileReader::OpenAsync(input, std::move(properties),
-                                                     metadata)
+                                                     known_metadata)
             .Then(
                 [=](const std::unique_ptr<parquet::ParquetFileReader>& reader) mutable
                 -> Result<std::shared_ptr<parquet::arrow::FileReader>> {
+                  if (cache_miss) {
+                    cache->Put(*cache_key, reader->metadata());
+                  }
                   auto arrow_properties = MakeArrowReaderProperties(
                       *self, *reader->metadata(), *options, *parquet_scan_options);
 
@@ -594,6 +1044,257 @@ struct SlicingGenerator {
   std::shared_ptr<State> state;
 };
 
+namespace {
+
+// Map the rows selected by `mask`, which has one slot per row read from
+// `read_ranges`, back to rows of the row group.
+Result<parquet::RowRanges> MaskToRowRanges(const Datum& mask,
+                                           const parquet::RowRanges& read_ranges,
+                                           MemoryPool* pool) {
+  if (mask.type()->id() != Type::BOOL) {
+    return Status::TypeError("Filter expression must evaluate to bool, got ",
+                             *mask.type());
+  }
+  if (mask.is_scalar()) {
+    const auto& scalar = mask.scalar_as<BooleanScalar>();
+    return scalar.is_valid && scalar.value ? read_ranges : parquet::RowRanges();
+  }
+  const ArrayData& data = *mask.array();
+  std::shared_ptr<Buffer> selected_bitmap = data.buffers[1];
+  int64_t selected_offset = data.offset;
+  if (data.GetNullCount() > 0) {
+    // Null slots are not selected, whatever their value bit
+    ARROW_ASSIGN_OR_RAISE(
+        selected_bitmap,
+        ::arrow::internal::BitmapAnd(pool, data.buffers[0]->data(), data.offset,
+                                     data.buffers[1]->data(), data.offset, data.length,
+                                     /*out_offset=*/0));
+    selected_offset = 0;
+  }
+
+  std::vector<parquet::RowRanges::Range> selected;
+  auto range = read_ranges.ranges().begin();
+  // Position in the mask of the first row of *range
+  int64_t range_position = 0;
+  ::arrow::internal::VisitSetBitRunsVoid(
+      selected_bitmap, selected_offset, data.length,
+      [&](int64_t position, int64_t length) {
+        while (length > 0) {
+          while (position >= range_position + range->length) {
+            range_position += range->length;
+            ++range;
+          }
+          const int64_t run_length =
+              std::min(length, range_position + range->length - position);
+          selected.push_back({range->offset + position - range_position, run_length});
+          position += run_length;
+          length -= run_length;
+        }
+      });
+  return parquet::RowRanges(std::move(selected));
+}
+
+Result<std::shared_ptr<RecordBatch>> ConcatenateBatches(const RecordBatchVector& batches,
+                                                        MemoryPool* pool) {
+  if (batches.size() == 1) {
+    return batches[0];
+  }
+  ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(batches));
+  return table->CombineChunksToBatch(pool);
+}
+
+/// \brief Scan row groups by reading the columns referenced by the filter first,
+/// then the other projected columns for the rows matching the filter only.
+///
+/// The filter is evaluated on the filter columns of a whole row group. The other
+/// columns are then read with the selected rows as row ranges, so that their pages
+/// holding no selected row are not decoded and the other rows are skipped.
+class LateMaterializedScan : public std::enable_shared_from_this<LateMaterializedScan> {
+ public:
+  /// Return nullptr if late materialization does not apply to this scan, that is
+  /// when the filter needs no column of the file, references fields missing from the
+  /// file or nested fields, or when all projected columns are referenced by the
+  /// filter.
+  static Result<std::shared_ptr<LateMaterializedScan>> Make(
+      std::shared_ptr<parquet::arrow::FileReader> reader, const ScanOptions& options,
+      const compute::Expression& partition_expression,
+      const std::vector<int>& column_projection) {
+    ARROW_ASSIGN_OR_RAISE(auto predicate,
+                          SimplifyWithGuarantee(options.filter, partition_expression));
+    if (predicate.literal() != nullptr) {
+      return nullptr;
+    }
+    std::shared_ptr<Schema> physical_schema;
+    RETURN_NOT_OK(reader->GetSchema(&physical_schema));
+    const SchemaManifest& manifest = reader->manifest();
+
+    std::unordered_set<int> filter_fields;
+    for (const FieldRef& ref : FieldsInExpression(predicate)) {
+      ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema));
+      if (match.indices().size() != 1) {
+        return nullptr;
+      }
+      // The filter is bound against the physical types, which must then be those
+      // the filter was bound against in the dataset schema.
+      const auto& field = physical_schema->field(match[0]);
+      if (options.dataset_schema != nullptr) {
+        auto dataset_field = options.dataset_schema->GetFieldByName(field->name());
+        if (dataset_field == nullptr || !dataset_field->type()->Equals(field->type())) {
+          return nullptr;
+        }
+      }
+      filter_fields.insert(match[0]);
+    }
+
+    auto scan = std::make_shared<LateMaterializedScan>();
+    for (int column : column_projection) {
+      ARROW_ASSIGN_OR_RAISE(auto fields, manifest.GetFieldIndices({column}));
+      if (filter_fields.count(fields[0]) > 0) {
+        scan->filter_columns_.push_back(column);
+      } else {
+        scan->other_columns_.push_back(column);
+      }
+    }
+    if (scan->filter_columns_.empty() || scan->other_columns_.empty()) {
+      return nullptr;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto output_fields,
+                          manifest.GetFieldIndices(column_projection));
+    ARROW_ASSIGN_OR_RAISE(auto read_filter_fields,
+                          manifest.GetFieldIndices(scan->filter_columns_));
+    ARROW_ASSIGN_OR_RAISE(auto read_other_fields,
+                          manifest.GetFieldIndices(scan->other_columns_));
+    for (int field : output_fields) {
+      auto it = std::find(read_filter_fields.begin(), read_filter_fields.end(), field);
+      if (it != read_filter_fields.end()) {
+        scan->output_columns_.push_back({true, it - read_filter_fields.begin()});
+      } else {
+        it = std::find(read_other_fields.begin(), read_other_fields.end(), field);
+        scan->output_columns_.push_back({false, it - read_other_fields.begin()});
+      }
+    }
+
+    FieldVector filter_schema_fields;
+    for (int field : read_filter_fields) {
+      filter_schema_fields.push_back(physical_schema->field(field));
+    }
+    auto bound = predicate.Bind(*schema(std::move(filter_schema_fields)));
+    if (!bound.ok()) {
+      return nullptr;
+    }
+    scan->predicate_ = bound.MoveValueUnsafe();
+    scan->reader_ = std::move(reader);
+    scan->pool_ = options.pool;
+    return scan;
+  }
+
+  RecordBatchGenerator ScanRowGroups(std::vector<int> row_groups,
+                                     std::vector<parquet::RowRanges> row_ranges) {
+    auto self = shared_from_this();
+    std::vector<RecordBatchGenerator> row_group_generators;
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      // Only start reading a row group once the previous ones were consumed
+      row_group_generators.push_back(
+          [self, row_group = row_groups[i], row_ranges = std::move(row_ranges[i]),
+           generator = RecordBatchGenerator()]() mutable {
+            if (!generator) {
+              generator = MakeFromFuture(self->ScanRowGroup(row_group, row_ranges));
+            }
+            return generator();
+          });
+    }
+    return MakeConcatenatedGenerator(
+        MakeVectorGenerator(std::move(row_group_generators)));
+  }
+
+ private:
+  struct OutputColumn {
+    bool is_filter_column;
+    int64_t index;
+  };
+
+  Future<RecordBatchGenerator> ScanRowGroup(int row_group,
+                                            const parquet::RowRanges& row_ranges) {
+    auto self = shared_from_this();
+    ARROW_ASSIGN_OR_RAISE(auto filter_generator,
+                          reader_->GetRecordBatchGenerator(
+                              reader_, {row_group}, filter_columns_, {row_ranges},
+                              ::arrow::internal::GetCpuThreadPool(),
+                              /*rows_to_readahead=*/0));
+    return CollectAsyncGenerator(std::move(filter_generator))
+        .Then([self, row_group, row_ranges](
+                  const RecordBatchVector& batches) -> Future<RecordBatchGenerator> {
+          if (batches.empty()) {
+            return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+          }
+          ARROW_ASSIGN_OR_RAISE(auto filter_batch,
+                                ConcatenateBatches(batches, self->pool_));
+          compute::ExecContext exec_context(self->pool_);
+          ARROW_ASSIGN_OR_RAISE(
+              auto mask, compute::ExecuteScalarExpression(
+                             self->predicate_, compute::ExecBatch(*filter_batch),
+                             &exec_context));
+          ARROW_ASSIGN_OR_RAISE(auto selected,
+                                MaskToRowRanges(mask, row_ranges, self->pool_));
+          if (selected.empty()) {
+            return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+          }
+          if (mask.is_array()) {
+            ARROW_ASSIGN_OR_RAISE(
+                auto filtered,
+                compute::Filter(filter_batch, mask,
+                                compute::FilterOptions::Defaults(), &exec_context));
+            filter_batch = filtered.record_batch();
+          }
+
+          ARROW_ASSIGN_OR_RAISE(auto other_generator,
+                                self->reader_->GetRecordBatchGenerator(
+                                    self->reader_, {row_group}, self->other_columns_,
+                                    {std::move(selected)},
+                                    ::arrow::internal::GetCpuThreadPool(),
+                                    /*rows_to_readahead=*/0));
+          return CollectAsyncGenerator(std::move(other_generator))
+              .Then([self, filter_batch](const RecordBatchVector& batches)
+                        -> Result<RecordBatchGenerator> {
+                return self->Assemble(filter_batch, batches);
+              });
+        });
+  }
+
+  Result<RecordBatchGenerator> Assemble(const std::shared_ptr<RecordBatch>& filter_batch,
+                                        const RecordBatchVector& other_batches) const {
+    if (other_batches.empty()) {
+      return Status::Invalid("Expected ", filter_batch->num_rows(),
+                             " selected rows, got none");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto other_batch, ConcatenateBatches(other_batches, pool_));
+    if (other_batch->num_rows() != filter_batch->num_rows()) {
+      return Status::Invalid("Expected ", filter_batch->num_rows(),
+                             " selected rows, got ", other_batch->num_rows());
+    }
+    FieldVector fields;
+    ArrayVector columns;
+    for (const auto& column : output_columns_) {
+      const auto& batch = column.is_filter_column ? filter_batch : other_batch;
+      fields.push_back(batch->schema()->field(static_cast<int>(column.index)));
+      columns.push_back(batch->column(static_cast<int>(column.index)));
+    }
+    return MakeVectorGenerator<std::shared_ptr<RecordBatch>>({RecordBatch::Make(
+        schema(std::move(fields)), filter_batch->num_rows(), std::move(columns))});
+  }
+
+  std::shared_ptr<parquet::arrow::FileReader> reader_;
+  // Bound against the schema of the filter columns
+  compute::Expression predicate_;
+  std::vector<int> filter_columns_;
+  std::vector<int> other_columns_;
+  std::vector<OutputColumn> output_columns_;
+  MemoryPool* pool_;
+};
+
+}  // namespace
+
 Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
@@ -622,18 +1323,78 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
                             parquet_fragment->FilterRowGroups(options->filter));
       if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
     }
-    ARROW_ASSIGN_OR_RAISE(auto column_projection,
-                          InferColumnProjection(*reader, *options));
     ARROW_ASSIGN_OR_RAISE(
         auto parquet_scan_options,
         GetFragmentScanOptions<ParquetFragmentScanOptions>(
             kParquetTypeName, options.get(), default_fragment_scan_options));
+    if (parquet_scan_options->bloom_filter_filtering) {
+      ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroupsByBloomFilter(
+                                            reader.get(), options->filter,
+                                            std::move(row_groups)));
+      if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
+    if (parquet_scan_options->dictionary_filtering) {
+      ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroupsByDictionary(
+                                            reader.get(), options->filter,
+                                            std::move(row_groups), options->pool));
+      if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto column_projection,
+                          InferColumnProjection(*reader, *options));
+    std::optional<std::vector<parquet::RowRanges>> row_ranges;
+    if (parquet_scan_options->page_index_filtering) {
+      ARROW_ASSIGN_OR_RAISE(row_ranges,
+                            parquet_fragment->FilterPages(reader->parquet_reader(),
+                                                          options->filter, row_groups));
+    }
+    std::shared_ptr<LateMaterializedScan> late_materialized_scan;
+    if (parquet_scan_options->late_materialization) {
+      ARROW_ASSIGN_OR_RAISE(
+          late_materialized_scan,
+          LateMaterializedScan::Make(reader, *options,
+                                     parquet_fragment->partition_expression(),
+                                     column_projection));
+    }
     int batch_readahead = options->batch_readahead;
     int64_t rows_to_readahead = batch_readahead * options->batch_size;
-    ARROW_ASSIGN_OR_RAISE(auto generator,
-                          reader->GetRecordBatchGenerator(
-                              reader, row_groups, column_projection,
-                              ::arrow::internal::GetCpuThreadPool(), rows_to_readahead));
+    RecordBatchGenerator generator;
+    if (late_materialized_scan != nullptr && !row_ranges.has_value()) {
+      auto metadata = reader->parquet_reader()->metadata();
+      row_ranges.emplace();
+      for (int row_group : row_groups) {
+        row_ranges->push_back(
+            parquet::RowRanges::All(metadata->RowGroup(row_group)->num_rows()));
+      }
+    }
+    if (row_ranges.has_value()) {
+      // Drop the row groups in which no page may match
+      std::vector<int> selected_row_groups;
+      std::vector<parquet::RowRanges> selected_row_ranges;
+      for (size_t i = 0; i < row_groups.size(); ++i) {
+        if (!(*row_ranges)[i].empty()) {
+          selected_row_groups.push_back(row_groups[i]);
+          selected_row_ranges.push_back(std::move((*row_ranges)[i]));
+        }
+      }
+      if (selected_row_groups.empty()) {
+        return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+      }
+      if (late_materialized_scan != nullptr) {
+        generator = late_materialized_scan->ScanRowGroups(
+            std::move(selected_row_groups), std::move(selected_row_ranges));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            generator, reader->GetRecordBatchGenerator(
+                           reader, selected_row_groups, column_projection,
+                           selected_row_ranges, ::arrow::internal::GetCpuThreadPool(),
+                           rows_to_readahead));
+      }
+    } else {
+      ARROW_ASSIGN_OR_RAISE(generator, reader->GetRecordBatchGenerator(
+                                           reader, row_groups, column_projection,
+                                           ::arrow::internal::GetCpuThreadPool(),
+                                           rows_to_readahead));
+    }
     RecordBatchGenerator sliced =
         SlicingGenerator(std::move(generator), options->batch_size);
     if (batch_readahead == 0) {
@@ -765,6 +1526,115 @@ Future<> ParquetFileWriter::FinishInternal() {
       [this]() { return parquet_writer_->Close(); }));
 }
 
+Result<std::shared_ptr<FileWriter>> ParquetFileFormat::MakeSortedWriter(
+    std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+    std::shared_ptr<FileWriteOptions> options, fs::FileLocator destination_locator,
+    const compute::Ordering& ordering) const {
+  if (!Equals(*options->format())) {
+    return Status::TypeError("Mismatching format/write options");
+  }
+  auto parquet_options = checked_pointer_cast<ParquetFileWriteOptions>(options);
+
+  std::shared_ptr<parquet::SchemaDescriptor> parquet_schema;
+  RETURN_NOT_OK(parquet::arrow::ToParquetSchema(
+      schema.get(), *parquet_options->writer_properties,
+      *parquet_options->arrow_writer_properties, &parquet_schema));
+  std::vector<parquet::SortingColumn> sorting_columns;
+  for (const auto& key : ordering.sort_keys()) {
+    auto match = key.target.FindOne(*schema);
+    if (!match.ok() || match->indices().size() != 1) break;
+    const auto& field = schema->field(match->indices()[0]);
+    int column_index = parquet_schema->ColumnIndex(field->name());
+    if (column_index < 0) break;
+    parquet::SortingColumn column;
+    column.column_idx = column_index;
+    column.descending = key.order == compute::SortOrder::Descending;
+    column.nulls_first = ordering.null_placement() == compute::NullPlacement::AtStart;
+    sorting_columns.push_back(column);
+  }
+
+  if (!sorting_columns.empty()) {
+    auto sorted_options = std::make_shared<ParquetFileWriteOptions>(*parquet_options);
+    sorted_options->writer_properties =
+        parquet::WriterProperties::Builder(*parquet_options->writer_properties)
+            .set_sorting_columns(std::move(sorting_columns))
+            ->build();
+    options = std::move(sorted_options);
+  }
+  return MakeWriter(std::move(destination), std::move(schema), std::move(options),
+                    std::move(destination_locator));
+}
+
+Status EnableParquetMetadataFile(FileSystemDatasetWriteOptions* write_options,
+                                 bool append) {
+  if (write_options->format()->type_name() != kParquetTypeName) {
+    return Status::Invalid("A _metadata file can only be written for Parquet datasets");
+  }
+
+  struct State {
+    std::mutex mutex;
+    // Relative file path and footer of every file written
+    std::vector<std::pair<std::string, std::shared_ptr<parquet::FileMetaData>>> files;
+  };
+  auto state = std::make_shared<State>();
+  const std::string base_dir = write_options->base_dir;
+
+  write_options->writer_post_finish =
+      [state, base_dir, previous = std::move(write_options->writer_post_finish)](
+          FileWriter* writer) -> Status {
+    RETURN_NOT_OK(previous(writer));
+    auto metadata =
+        checked_cast<ParquetFileWriter*>(writer)->parquet_writer()->metadata();
+    const std::string& path = writer->destination().path;
+    auto relative = fs::internal::RemoveAncestor(base_dir, path);
+    std::string file_path = relative ? std::string(*relative) : path;
+    metadata->set_file_path(file_path);
+
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->files.emplace_back(std::move(file_path), std::move(metadata));
+    return Status::OK();
+  };
+
+  write_options->dataset_post_finish =
+      [state, append, filesystem = write_options->filesystem, base_dir,
+       previous = std::move(write_options->dataset_post_finish)]() -> Status {
+    RETURN_NOT_OK(previous());
+    std::vector<std::pair<std::string, std::shared_ptr<parquet::FileMetaData>>> files;
+    {
+      std::lock_guard<std::mutex> lock(state->mutex);
+      files.swap(state->files);
+    }
+    // Files finish in any order; sort them so the summary is deterministic.
+    std::sort(files.begin(), files.end(),
+              [](const auto& l, const auto& r) { return l.first < r.first; });
+
+    const auto metadata_path = fs::internal::ConcatAbstractPath(base_dir, "_metadata");
+    std::shared_ptr<parquet::FileMetaData> summary;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    if (append) {
+      ARROW_ASSIGN_OR_RAISE(auto info, filesystem->GetFileInfo(metadata_path));
+      if (info.IsFile()) {
+        ARROW_ASSIGN_OR_RAISE(auto input, filesystem->OpenInputFile(info));
+        summary = parquet::ReadMetaData(input);
+      }
+    }
+    for (auto& file : files) {
+      if (summary == nullptr) {
+        summary = std::move(file.second);
+      } else {
+        summary->AppendRowGroups(*file.second);
+      }
+    }
+    END_PARQUET_CATCH_EXCEPTIONS
+    if (summary == nullptr) return Status::OK();
+
+    ARROW_ASSIGN_OR_RAISE(auto output, filesystem->OpenOutputStream(metadata_path));
+    RETURN_NOT_OK(parquet::arrow::WriteMetaDataFile(*summary, output.get()));
+    return output->Close();
+  };
+  return Status::OK();
+}
+
 //
 // ParquetFileFragment
 //
@@ -959,6 +1829,198 @@ Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
   return row_groups;
 }
 
+Result<std::optional<std::vector<parquet::RowRanges>>> ParquetFileFragment::FilterPages(
+    parquet::ParquetFileReader* reader, compute::Expression predicate,
+    const std::vector<int>& row_groups) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  DCHECK_NE(metadata_, nullptr);
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+
+  std::vector<std::pair<FieldRef, const SchemaField*>> columns;
+  std::vector<int32_t> column_indices;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+
+    if (match.empty()) continue;
+    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
+
+    for (size_t i = 1; i < match.indices().size(); ++i) {
+      if (schema_field->field->type()->id() != Type::STRUCT) {
+        return Status::Invalid("nested paths only supported for structs");
+      }
+      schema_field = &schema_field->children[match[i]];
+    }
+
+    if (!schema_field->is_leaf()) continue;
+    columns.emplace_back(ref, schema_field);
+    column_indices.push_back(schema_field->column_index);
+  }
+  if (columns.empty() || row_groups.empty()) {
+    return std::nullopt;
+  }
+
+  std::vector<parquet::RowRanges> row_ranges;
+  row_ranges.reserve(row_groups.size());
+  bool pruned = false;
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto page_index_reader = reader->GetPageIndexReader();
+  if (page_index_reader == nullptr) {
+    return std::nullopt;
+  }
+  page_index_reader->WillNeed(row_groups, column_indices,
+                              {/*column_index=*/true, /*offset_index=*/true});
+
+  for (int row_group : row_groups) {
+    auto row_group_metadata = metadata_->RowGroup(row_group);
+    const int64_t num_rows = row_group_metadata->num_rows();
+    auto row_group_index_reader = page_index_reader->RowGroup(row_group);
+
+    std::vector<ColumnPageGuarantees> pages;
+    if (row_group_index_reader != nullptr) {
+      for (const auto& [ref, schema_field] : columns) {
+        if (auto column_pages = ColumnPageStatisticsAsExpressions(
+                ref, *schema_field, *row_group_metadata, row_group_index_reader.get())) {
+          pages.push_back(std::move(*column_pages));
+        }
+      }
+    }
+    if (pages.empty()) {
+      row_ranges.push_back(parquet::RowRanges::All(num_rows));
+      continue;
+    }
+
+    // Test each run of rows between consecutive page boundaries of all columns
+    // against the combined guarantees of the pages holding it.
+    std::vector<parquet::RowRanges::Range> selected;
+    std::vector<size_t> current_page(pages.size(), 0);
+    int64_t start = 0;
+    while (start < num_rows) {
+      int64_t end = num_rows;
+      compute::Expression guarantee = compute::literal(true);
+      for (size_t i = 0; i < pages.size(); ++i) {
+        const ColumnPageGuarantees& column_pages = pages[i];
+        while (column_pages.first_rows[current_page[i] + 1] <= start) {
+          ++current_page[i];
+        }
+        end = std::min(end, column_pages.first_rows[current_page[i] + 1]);
+        FoldingAnd(&guarantee, column_pages.guarantees[current_page[i]]);
+      }
+      ARROW_ASSIGN_OR_RAISE(guarantee, guarantee.Bind(*physical_schema_));
+      ARROW_ASSIGN_OR_RAISE(auto page_predicate,
+                            SimplifyWithGuarantee(predicate, guarantee));
+      if (page_predicate.IsSatisfiable()) {
+        selected.push_back({start, end - start});
+      } else {
+        pruned = true;
+      }
+      start = end;
+    }
+    row_ranges.emplace_back(std::move(selected));
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+
+  if (!pruned) {
+    return std::nullopt;
+  }
+  return row_ranges;
+}
+
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsByBloomFilter(
+    parquet::arrow::FileReader* reader, compute::Expression predicate,
+    std::vector<int> row_groups) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  DCHECK_NE(metadata_, nullptr);
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+
+  EqualityColumns columns;
+  std::vector<int32_t> column_indices;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+
+    if (match.empty()) continue;
+    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
+
+    for (size_t i = 1; i < match.indices().size(); ++i) {
+      if (schema_field->field->type()->id() != Type::STRUCT) {
+        return Status::Invalid("nested paths only supported for structs");
+      }
+      schema_field = &schema_field->children[match[i]];
+    }
+
+    if (!schema_field->is_leaf()) continue;
+    if (columns.emplace(ref, schema_field).second) {
+      column_indices.push_back(schema_field->column_index);
+    }
+  }
+  if (columns.empty() || row_groups.empty()) {
+    return row_groups;
+  }
+
+  std::vector<int> selected_row_groups;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto& bloom_filter_reader = reader->parquet_reader()->GetBloomFilterReader();
+  bloom_filter_reader.WillNeed(row_groups, column_indices,
+                               reader->properties().io_context(),
+                               reader->properties().cache_options());
+  for (int row_group : row_groups) {
+    BloomFilterTester tester(columns, *manifest_->descr,
+                             bloom_filter_reader.RowGroup(row_group));
+    if (tester.MayMatch(predicate)) {
+      selected_row_groups.push_back(row_group);
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return selected_row_groups;
+}
+
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsByDictionary(
+    parquet::arrow::FileReader* reader, compute::Expression predicate,
+    std::vector<int> row_groups, MemoryPool* pool) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  DCHECK_NE(metadata_, nullptr);
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+
+  EqualityColumns columns;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+
+    if (match.empty()) continue;
+    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
+
+    for (size_t i = 1; i < match.indices().size(); ++i) {
+      if (schema_field->field->type()->id() != Type::STRUCT) {
+        return Status::Invalid("nested paths only supported for structs");
+      }
+      schema_field = &schema_field->children[match[i]];
+    }
+
+    if (!schema_field->is_leaf()) continue;
+    columns.emplace(ref, schema_field);
+  }
+  if (columns.empty() || row_groups.empty()) {
+    return row_groups;
+  }
+
+  std::vector<int> selected_row_groups;
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  for (int row_group : row_groups) {
+    DictionaryTester tester(columns, *manifest_->descr, metadata_->RowGroup(row_group),
+                            reader->parquet_reader()->RowGroup(row_group), pool);
+    if (tester.MayMatch(predicate)) {
+      selected_row_groups.push_back(row_group);
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return selected_row_groups;
+}
+
 Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
     compute::Expression predicate) {
   DCHECK_NE(metadata_, nullptr);
@@ -979,6 +2041,174 @@ Result<std::optional<int64_t>> ParquetFileFragment::TryCountRows(
   return metadata()->num_rows();
 }
 
+namespace {
+
+using ColumnAggregates = ParquetFileFragment::ColumnAggregates;
+
+// Combine two minima or maxima, either of which may be missing.
+Result<std::shared_ptr<Scalar>> CombineExtrema(const std::string& function,
+                                               std::shared_ptr<Scalar> left,
+                                               std::shared_ptr<Scalar> right) {
+  if (left == nullptr) return right;
+  if (right == nullptr) return left;
+  ARROW_ASSIGN_OR_RAISE(auto combined, compute::CallFunction(function, {left, right}));
+  return combined.scalar();
+}
+
+Status MergeColumnAggregates(const ColumnAggregates& from, ColumnAggregates* into) {
+  into->count += from.count;
+  into->null_count += from.null_count;
+  ARROW_ASSIGN_OR_RAISE(into->min,
+                        CombineExtrema("min_element_wise", into->min, from.min));
+  ARROW_ASSIGN_OR_RAISE(into->max,
+                        CombineExtrema("max_element_wise", into->max, from.max));
+  return Status::OK();
+}
+
+// Return the aggregates of a column chunk given by its statistics, or std::nullopt
+// if the statistics are missing or inexact.
+std::optional<ColumnAggregates> ColumnChunkStatisticsAggregates(
+    const SchemaField& schema_field, const std::shared_ptr<DataType>& type,
+    const parquet::RowGroupMetaData& metadata) {
+  // Only non-repeated leaves count one value per row
+  if (!schema_field.is_leaf() ||
+      metadata.schema()->Column(schema_field.column_index)->max_repetition_level() > 0) {
+    return std::nullopt;
+  }
+  auto statistics = metadata.ColumnChunk(schema_field.column_index)->statistics();
+  if (statistics == nullptr || !statistics->HasNullCount()) {
+    return std::nullopt;
+  }
+  ColumnAggregates aggregates;
+  aggregates.count = statistics->num_values();
+  aggregates.null_count = statistics->null_count();
+  if (aggregates.count + aggregates.null_count != metadata.num_rows()) {
+    return std::nullopt;
+  }
+  if (aggregates.count == 0) {
+    return aggregates;
+  }
+
+  std::shared_ptr<Scalar> min, max;
+  if (!statistics->HasMinMax() || !StatisticsAsScalars(*statistics, &min, &max).ok()) {
+    return std::nullopt;
+  }
+  auto maybe_min = Cast(min, type);
+  auto maybe_max = Cast(max, type);
+  if (!maybe_min.ok() || !maybe_max.ok()) {
+    return std::nullopt;
+  }
+  aggregates.min = maybe_min->scalar();
+  aggregates.max = maybe_max->scalar();
+  // Statistics leave NaNs out, they cannot stand for the extrema
+  if (IsNan(*aggregates.min) || IsNan(*aggregates.max)) {
+    return std::nullopt;
+  }
+  return aggregates;
+}
+
+}  // namespace
+
+Result<ParquetFileFragment::Aggregates> ParquetFileFragment::AggregateWithStatistics(
+    compute::Expression predicate, const std::vector<std::string>& columns,
+    const std::shared_ptr<ScanOptions>& options) {
+  if (options->dataset_schema == nullptr) {
+    return Status::Invalid("AggregateWithStatistics requires the dataset schema");
+  }
+  RETURN_NOT_OK(EnsureCompleteMetadata());
+  ARROW_ASSIGN_OR_RAISE(predicate, predicate.Bind(*options->dataset_schema));
+
+  // The output type and file column of each requested column. Columns missing
+  // from the file are null in every row.
+  std::vector<std::shared_ptr<DataType>> types;
+  std::vector<const SchemaField*> schema_fields;
+  for (const auto& name : columns) {
+    auto field = options->dataset_schema->GetFieldByName(name);
+    if (field == nullptr) {
+      return Status::Invalid("No column named '", name, "' in the dataset schema");
+    }
+    types.push_back(field->type());
+    ARROW_ASSIGN_OR_RAISE(auto match, FieldRef(name).FindOneOrNone(*physical_schema_));
+    schema_fields.push_back(match.empty() ? nullptr
+                                          : &manifest_->schema_fields[match[0]]);
+  }
+
+  Aggregates result;
+  result.columns.resize(columns.size());
+  ARROW_ASSIGN_OR_RAISE(auto expressions, TestRowGroups(predicate));
+  std::vector<int> row_groups_to_read;
+  for (size_t i = 0; i < expressions.size(); ++i) {
+    const int row_group = (*row_groups_)[i];
+    if (!expressions[i].IsSatisfiable()) continue;
+    if (expressions[i] != compute::literal(true)) {
+      row_groups_to_read.push_back(row_group);
+      continue;
+    }
+
+    std::vector<ColumnAggregates> row_group_aggregates(columns.size());
+    bool complete = true;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    auto row_group_metadata = metadata_->RowGroup(row_group);
+    for (size_t j = 0; j < columns.size() && complete; ++j) {
+      if (schema_fields[j] == nullptr) {
+        row_group_aggregates[j].null_count = row_group_metadata->num_rows();
+        continue;
+      }
+      auto aggregates = ColumnChunkStatisticsAggregates(*schema_fields[j], types[j],
+                                                        *row_group_metadata);
+      if (aggregates.has_value()) {
+        row_group_aggregates[j] = std::move(*aggregates);
+      } else {
+        complete = false;
+      }
+    }
+    if (!complete) {
+      row_groups_to_read.push_back(row_group);
+      continue;
+    }
+    result.num_rows += row_group_metadata->num_rows();
+    END_PARQUET_CATCH_EXCEPTIONS
+    for (size_t j = 0; j < columns.size(); ++j) {
+      RETURN_NOT_OK(MergeColumnAggregates(row_group_aggregates[j], &result.columns[j]));
+    }
+  }
+
+  if (row_groups_to_read.empty()) {
+    return result;
+  }
+  result.num_row_groups_read = static_cast<int>(row_groups_to_read.size());
+
+  // Scan the other row groups, with the predicate applied to their rows
+  ARROW_ASSIGN_OR_RAISE(auto subset, Subset(std::move(row_groups_to_read)));
+  auto dataset = std::make_shared<FragmentDataset>(options->dataset_schema,
+                                                   FragmentVector{std::move(subset)});
+  ScannerBuilder builder(std::move(dataset), std::make_shared<ScanOptions>(*options));
+  RETURN_NOT_OK(builder.Filter(predicate));
+  RETURN_NOT_OK(builder.Project(columns));
+  ARROW_ASSIGN_OR_RAISE(auto scanner, builder.Finish());
+  ARROW_ASSIGN_OR_RAISE(auto table, scanner->ToTable());
+
+  result.num_rows += table->num_rows();
+  compute::ExecContext exec_context(options->pool);
+  for (size_t j = 0; j < columns.size(); ++j) {
+    const auto& column = table->column(static_cast<int>(j));
+    ColumnAggregates aggregates;
+    aggregates.null_count = column->null_count();
+    aggregates.count = column->length() - aggregates.null_count;
+    ARROW_ASSIGN_OR_RAISE(
+        auto min_max,
+        compute::MinMax(column, compute::ScalarAggregateOptions::Defaults(),
+                        &exec_context));
+    const auto& min_max_scalar = min_max.scalar_as<StructScalar>();
+    if (min_max_scalar.value[0]->is_valid) {
+      aggregates.min = min_max_scalar.value[0];
+      aggregates.max = min_max_scalar.value[1];
+    }
+    RETURN_NOT_OK(MergeColumnAggregates(aggregates, &result.columns[j]));
+  }
+  return result;
+}
+
 //
 // ParquetFragmentScanOptions
 //
@@ -37,6 +37,7 @@ class ParquetFileReader;
 class Statistics;
 class ColumnChunkMetaData;
 class RowGroupMetaData;
+class RowRanges;
 class FileMetaData;
 class FileDecryptionProperties;
 class FileEncryptionProperties;
@@ -138,6 +139,16 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
       std::shared_ptr<FileWriteOptions> options,
       fs::FileLocator destination_locator) const override;
 
+  /// \brief Create a writer recording `ordering` as the sorting_columns of every row
+  /// group.
+  ///
+  /// Only a leading run of sort keys naming top-level primitive columns can be
+  /// recorded; the keys from the first other one on are left out.
+  Result<std::shared_ptr<FileWriter>> MakeSortedWriter(
+      std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
+      std::shared_ptr<FileWriteOptions> options, fs::FileLocator destination_locator,
+      const compute::Ordering& ordering) const override;
+
   std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override;
 };
 
@@ -174,6 +185,42 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::shared_ptr<Fragment>> Subset(compute::Expression predicate);
   Result<std::shared_ptr<Fragment>> Subset(std::vector<int> row_group_ids);
 
+  /// \brief Aggregates of a column over the rows matching a predicate.
+  struct ColumnAggregates {
+    /// The number of non-null values.
+    int64_t count = 0;
+    int64_t null_count = 0;
+    /// The smallest and largest non-null values, or nullptr if there are none.
+    std::shared_ptr<Scalar> min;
+    std::shared_ptr<Scalar> max;
+  };
+
+  /// \brief Aggregates of a fragment over the rows matching a predicate.
+  struct Aggregates {
+    /// The number of matching rows, as `count(*)`.
+    int64_t num_rows = 0;
+    /// The aggregates of each requested column, in order.
+    std::vector<ColumnAggregates> columns;
+    /// The number of row groups whose data had to be read.
+    int num_row_groups_read = 0;
+  };
+
+  /// \brief Compute the number of rows matching a predicate, and the count, null
+  /// count, minimum and maximum of some columns over them, from the row group
+  /// statistics where possible.
+  ///
+  /// Row groups whose statistics exclude the predicate are skipped. Row groups whose
+  /// statistics show that every row matches the predicate are answered from their
+  /// column chunk statistics when those are complete. Only the remaining row groups
+  /// are read, with the predicate applied.
+  ///
+  /// \param[in] predicate the filter of the rows to aggregate
+  /// \param[in] columns names of top-level columns of the dataset schema
+  /// \param[in] options the scan options, whose dataset_schema must be set
+  Result<Aggregates> AggregateWithStatistics(compute::Expression predicate,
+                                             const std::vector<std::string>& columns,
+                                             const std::shared_ptr<ScanOptions>& options);
+
   static std::optional<compute::Expression> EvaluateStatisticsAsExpression(
       const Field& field, const parquet::Statistics& statistics);
 
@@ -201,6 +248,23 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::vector<int>> FilterRowGroups(compute::Expression predicate);
   /// Simplify the predicate against the statistics of each row group.
   Result<std::vector<compute::Expression>> TestRowGroups(compute::Expression predicate);
+  /// Select the rows of each of the given row groups lying in pages whose column
+  /// index statistics may satisfy the predicate. Returns std::nullopt if no page
+  /// could be excluded.
+  Result<std::optional<std::vector<parquet::RowRanges>>> FilterPages(
+      parquet::ParquetFileReader* reader, compute::Expression predicate,
+      const std::vector<int>& row_groups);
+  /// Return the subset of the given row groups for which the bloom filters of the
+  /// columns compared for equality by the predicate may hold the compared values.
+  Result<std::vector<int>> FilterRowGroupsByBloomFilter(
+      parquet::arrow::FileReader* reader, compute::Expression predicate,
+      std::vector<int> row_groups);
+  /// Return the subset of the given row groups for which the dictionaries of the
+  /// fully dictionary encoded columns compared for equality by the predicate may
+  /// hold the compared values.
+  Result<std::vector<int>> FilterRowGroupsByDictionary(
+      parquet::arrow::FileReader* reader, compute::Expression predicate,
+      std::vector<int> row_groups, MemoryPool* pool);
   /// Try to count rows matching the predicate using metadata. Expects
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
@@ -242,6 +306,25 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
   /// A configuration structure that provides decryption properties for a dataset
   std::shared_ptr<ParquetDecryptionConfig> parquet_decryption_config = NULLPTR;
+  /// Whether to use the page index of files, when present, to skip the pages of
+  /// columns referenced by the filter whose minimum and maximum values show that
+  /// no row can match. The filter is still applied to the rows that are read.
+  bool page_index_filtering = false;
+  /// Whether to read the bloom filters of columns compared for equality by the
+  /// filter, with `==` or `is_in`, to skip the row groups that cannot hold any of
+  /// the compared values. The bloom filter reads are coalesced according to
+  /// arrow_reader_properties' cache options.
+  bool bloom_filter_filtering = false;
+  /// Whether to read the dictionary pages of columns compared for equality by the
+  /// filter, with `==` or `is_in`, to skip the row groups whose dictionaries hold
+  /// none of the compared values. Only the column chunks whose data pages are all
+  /// dictionary encoded, as recorded in their encoding stats, are tested.
+  bool dictionary_filtering = false;
+  /// Whether to read the columns referenced by the filter first and evaluate the
+  /// filter on them, then read the other projected columns for the matching rows
+  /// only. This saves decoding work for selective filters on wide projections. Scans
+  /// whose filter references missing or nested fields are read as usual.
+  bool late_materialization = false;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
@@ -283,6 +366,24 @@ class ARROW_DS_EXPORT ParquetFileWriter : public FileWriter {
   friend class ParquetFileFormat;
 };
 
+/// \brief Make FileSystemDataset::Write emit a Parquet `_metadata` summary file.
+///
+/// The footer of every Parquet file written is collected through
+/// `write_options->writer_post_finish` (chained after any existing callback) and, once
+/// all files are finished, `dataset_post_finish` writes their row group metadata to
+/// `<base_dir>/_metadata` with file paths relative to base_dir. The result can be
+/// opened with ParquetDatasetFactory, which plans the dataset from that single file
+/// instead of reading every footer.
+///
+/// If `append` is true and `_metadata` already exists, its row groups are kept and the
+/// new files' row groups are appended after them, keeping the summary current across
+/// incremental writes (e.g. with ExistingDataBehavior::kOverwriteOrIgnore).
+///
+/// Call this once per FileSystemDatasetWriteOptions: each call chains another
+/// collector onto the callbacks.
+ARROW_DS_EXPORT Status EnableParquetMetadataFile(
+    FileSystemDatasetWriteOptions* write_options, bool append = false);
+
 /// \brief Options for making a FileSystemDataset from a Parquet _metadata file.
 struct ParquetFactoryOptions {
   /// Either an explicit Partitioning or a PartitioningFactory to discover one.
@@ -22,10 +22,12 @@
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
 #include "arrow/compute/api_scalar.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/parquet_encryption_config.h"
 #include "arrow/dataset/test_util_internal.h"
+#include "arrow/io/file.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/test_common.h"
@@ -39,9 +41,11 @@
 #include "arrow/util/io_util.h"
 #include "arrow/util/range.h"
 
+#include "parquet/arrow/reader.h"
 #include "parquet/arrow/writer.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/metadata_cache.h"
 #include "parquet/statistics.h"
 #include "parquet/types.h"
 
@@ -304,6 +308,69 @@ TEST_F(TestParquetFileFormat, CountRowsPredicatePushdown) {
   }
 }
 
+TEST_F(TestParquetFileFormat, AggregateWithStatistics) {
+  auto file_schema = schema({field("i64", int64()), field("s", utf8())});
+  ASSERT_OK_AND_ASSIGN(
+      auto reader,
+      RecordBatchReader::Make(
+          {RecordBatchFromJSON(file_schema, R"([[1, "c"], [2, "a"], [3, "b"]])"),
+           RecordBatchFromJSON(file_schema, R"([[4, "d"], [5, null], [6, "f"]])"),
+           RecordBatchFromJSON(file_schema, R"([[7, "g"], [8, "h"], [9, "i"]])")},
+          file_schema));
+  auto source = GetFileSource(reader.get());
+  auto fragment = checked_pointer_cast<ParquetFileFragment>(MakeFragment(*source));
+
+  auto options = std::make_shared<ScanOptions>();
+  options->dataset_schema =
+      schema({field("i64", int64()), field("s", utf8()), field("missing", int32())});
+  std::vector<std::string> columns = {"i64", "s", "missing"};
+
+  // Without a filter, everything comes from the statistics
+  ASSERT_OK_AND_ASSIGN(auto aggregates,
+                       fragment->AggregateWithStatistics(literal(true), columns,
+                                                         options));
+  ASSERT_EQ(aggregates.num_row_groups_read, 0);
+  ASSERT_EQ(aggregates.num_rows, 9);
+  ASSERT_EQ(aggregates.columns[0].count, 9);
+  ASSERT_EQ(aggregates.columns[0].null_count, 0);
+  AssertScalarsEqual(*MakeScalar(int64_t(1)), *aggregates.columns[0].min);
+  AssertScalarsEqual(*MakeScalar(int64_t(9)), *aggregates.columns[0].max);
+  ASSERT_EQ(aggregates.columns[1].count, 8);
+  ASSERT_EQ(aggregates.columns[1].null_count, 1);
+  AssertScalarsEqual(*MakeScalar("a"), *aggregates.columns[1].min);
+  AssertScalarsEqual(*MakeScalar("i"), *aggregates.columns[1].max);
+  ASSERT_EQ(aggregates.columns[2].count, 0);
+  ASSERT_EQ(aggregates.columns[2].null_count, 9);
+  ASSERT_EQ(aggregates.columns[2].min, nullptr);
+
+  // Only the row group partially covered by the filter is read
+  ASSERT_OK_AND_ASSIGN(aggregates, fragment->AggregateWithStatistics(
+                                       greater_equal(field_ref("i64"), literal(3)),
+                                       columns, options));
+  ASSERT_EQ(aggregates.num_row_groups_read, 1);
+  ASSERT_EQ(aggregates.num_rows, 7);
+  ASSERT_EQ(aggregates.columns[0].count, 7);
+  AssertScalarsEqual(*MakeScalar(int64_t(3)), *aggregates.columns[0].min);
+  AssertScalarsEqual(*MakeScalar(int64_t(9)), *aggregates.columns[0].max);
+  ASSERT_EQ(aggregates.columns[1].count, 6);
+  ASSERT_EQ(aggregates.columns[1].null_count, 1);
+  AssertScalarsEqual(*MakeScalar("b"), *aggregates.columns[1].min);
+  AssertScalarsEqual(*MakeScalar("i"), *aggregates.columns[1].max);
+  ASSERT_EQ(aggregates.columns[2].null_count, 7);
+
+  // Row groups excluded by the filter are not read either
+  ASSERT_OK_AND_ASSIGN(aggregates, fragment->AggregateWithStatistics(
+                                       greater(field_ref("i64"), literal(100)), columns,
+                                       options));
+  ASSERT_EQ(aggregates.num_row_groups_read, 0);
+  ASSERT_EQ(aggregates.num_rows, 0);
+  ASSERT_EQ(aggregates.columns[0].count, 0);
+  ASSERT_EQ(aggregates.columns[0].min, nullptr);
+
+  ASSERT_RAISES(Invalid, fragment->AggregateWithStatistics(literal(true), {"nope"},
+                                                            options));
+}
+
 TEST_F(TestParquetFileFormat, CachedMetadata) {
   // Create a test file
   auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
@@ -349,6 +416,61 @@ TEST_F(TestParquetFileFormat, CachedMetadata) {
   ASSERT_LT(bytes_read_second_time, bytes_read_first_time);
 }
 
+TEST_F(TestParquetFileFormat, FileMetaDataCache) {
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(42)));
+  std::shared_ptr<Schema> test_schema = schema({field("x", int32())});
+  std::shared_ptr<RecordBatch> batch = RecordBatchFromJSON(test_schema, "[[0], [1]]");
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<io::OutputStream> out_stream,
+                       mock_fs->OpenOutputStream("/foo.parquet"));
+  ASSERT_OK_AND_ASSIGN(
+      std::shared_ptr<FileWriter> writer,
+      format_->MakeWriter(out_stream, test_schema, format_->DefaultWriteOptions(),
+                          {mock_fs, "/foo.parquet"}));
+  ASSERT_OK(writer->Write(batch));
+  ASSERT_FINISHES_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(auto info, mock_fs->GetFileInfo("/foo.parquet"));
+
+  auto cache = std::make_shared<parquet::FileMetaDataCache>();
+  auto parquet_options = std::make_shared<ParquetFragmentScanOptions>();
+  parquet_options->reader_properties->set_file_metadata_cache(cache);
+  format_->default_fragment_scan_options = parquet_options;
+
+  auto options = std::make_shared<ScanOptions>();
+  options->filter = literal(true);
+  ASSERT_OK_AND_ASSIGN(auto projection_descr,
+                       ProjectionDescr::FromNames({"x"}, *test_schema));
+  options->projected_schema = projection_descr.schema;
+  options->projection = projection_descr.expression;
+
+  // Separate fragments over the same file share the cached footer
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(info, mock_fs)));
+    ASSERT_OK_AND_ASSIGN(auto generator, fragment->ScanBatchesAsync(options));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(generator));
+    ASSERT_EQ(batches.size(), 1);
+    ASSERT_EQ(batches[0]->num_rows(), 2);
+  }
+  ASSERT_EQ(cache->size(), 1);
+  ASSERT_EQ(cache->stats().misses, 1);
+  ASSERT_EQ(cache->stats().hits, 1);
+
+  // A rewritten file has a different size and misses the cache
+  ASSERT_OK_AND_ASSIGN(out_stream, mock_fs->OpenOutputStream("/foo.parquet"));
+  ASSERT_OK_AND_ASSIGN(writer,
+                       format_->MakeWriter(out_stream, test_schema,
+                                           format_->DefaultWriteOptions(),
+                                           {mock_fs, "/foo.parquet"}));
+  ASSERT_OK(writer->Write(RecordBatchFromJSON(test_schema, "[[0], [1], [2]]")));
+  ASSERT_FINISHES_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(info, mock_fs->GetFileInfo("/foo.parquet"));
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       format_->GetReader(FileSource(info, mock_fs), options));
+  ASSERT_EQ(reader->parquet_reader()->metadata()->num_rows(), 3);
+  ASSERT_EQ(cache->stats().misses, 2);
+  ASSERT_EQ(cache->size(), 2);
+}
+
 TEST_F(TestParquetFileFormat, MultithreadedScan) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -425,6 +547,74 @@ TEST_F(TestParquetFileSystemDataset, WriteWithEmptyPartitioningSchema) {
   TestWriteWithEmptyPartitioningSchema();
 }
 
+TEST_F(TestParquetFileSystemDataset, WriteMetadataFile) {
+  auto partitioning = std::make_shared<DirectoryPartitioning>(
+      SchemaFromColumnNames(source_schema_, {"year", "month"}));
+  ASSERT_OK(EnableParquetMetadataFile(&write_options_));
+  DoWrite(partitioning);
+
+  auto assert_summary = [&](std::vector<std::string> expected_paths,
+                            int64_t expected_rows) {
+    ParquetFactoryOptions factory_options;
+    factory_options.partitioning = partitioning;
+    ASSERT_OK_AND_ASSIGN(auto factory, ParquetDatasetFactory::Make(
+                                           "/new_root/_metadata", fs_,
+                                           std::make_shared<ParquetFileFormat>(),
+                                           factory_options));
+    ASSERT_OK_AND_ASSIGN(auto dataset, factory->Finish());
+    ASSERT_OK_AND_ASSIGN(auto fragment_it, dataset->GetFragments());
+    std::vector<std::string> paths;
+    for (const auto& maybe_fragment : fragment_it) {
+      ASSERT_OK_AND_ASSIGN(auto fragment, maybe_fragment);
+      paths.push_back(checked_pointer_cast<FileFragment>(fragment)->source().path());
+    }
+    EXPECT_EQ(paths, expected_paths);
+
+    ASSERT_OK_AND_ASSIGN(auto scanner_builder, dataset->NewScan());
+    ASSERT_OK_AND_ASSIGN(auto scanner, scanner_builder->Finish());
+    ASSERT_OK_AND_EQ(expected_rows, scanner->CountRows());
+  };
+  assert_summary({"/new_root/2018/1/dat_0", "/new_root/2019/1/dat_0"}, 16);
+
+  // Appending keeps the row groups of the files written before
+  write_options_ = FileSystemDatasetWriteOptions{};
+  SetWriteOptions(format_->DefaultWriteOptions());
+  write_options_.basename_template = "more_{i}";
+  write_options_.existing_data_behavior = ExistingDataBehavior::kOverwriteOrIgnore;
+  ASSERT_OK(EnableParquetMetadataFile(&write_options_, /*append=*/true));
+  DoWrite(partitioning);
+  assert_summary({"/new_root/2018/1/dat_0", "/new_root/2019/1/dat_0",
+                  "/new_root/2018/1/more_0", "/new_root/2019/1/more_0"},
+                 32);
+}
+
+TEST_F(TestParquetFileSystemDataset, WriteClustered) {
+  write_options_.clustering_keys = {compute::SortKey("sales")};
+  DoWrite(std::make_shared<DirectoryPartitioning>(
+      SchemaFromColumnNames(source_schema_, {"year", "month"})));
+
+  for (const auto& path : {"/new_root/2018/1/dat_0", "/new_root/2019/1/dat_0"}) {
+    ARROW_SCOPED_TRACE(path);
+    ASSERT_OK_AND_ASSIGN(auto input, fs_->OpenInputFile(path));
+    std::unique_ptr<parquet::arrow::FileReader> reader;
+    ASSERT_OK(parquet::arrow::OpenFile(input, default_memory_pool(), &reader));
+
+    // "sales" is the third column of the written files
+    auto row_group = reader->parquet_reader()->metadata()->RowGroup(0);
+    ASSERT_EQ(row_group->sorting_columns(),
+              (std::vector<parquet::SortingColumn>{{2, false, true}}));
+
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader->ReadTable(&table));
+    ASSERT_OK_AND_ASSIGN(auto combined,
+                         Concatenate(table->GetColumnByName("sales")->chunks()));
+    const auto& values = checked_cast<const DoubleArray&>(*combined);
+    for (int64_t i = 1; i < values.length(); ++i) {
+      ASSERT_LE(values.Value(i - 1), values.Value(i));
+    }
+  }
+}
+
 TEST_F(TestParquetFileSystemDataset, WriteWithEncryptionConfigNotSupported) {
 #ifndef PARQUET_REQUIRE_ENCRYPTION
   // Create a dummy ParquetEncryptionConfig
@@ -607,6 +797,132 @@ TEST_P(TestParquetFileFormatScan, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_P(TestParquetFileFormatScan, PredicatePushdownPageIndex) {
+  // A single row group of eight rows, written as four pages of two rows
+  auto table = TableFromJSON(schema({field("i64", int64()), field("str", utf8())}),
+                             {R"([[0, "a"], [1, "b"], [2, "c"], [3, "d"],
+                                  [4, "e"], [5, null], [null, "g"], [7, "h"]])"});
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->write_batch_size(2)
+                        ->data_pagesize(1)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/8,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment,
+                       format_->MakeFragment(FileSource(std::move(buffer))));
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  // Without page index filtering the whole row group is read
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(5)));
+  CountRowsAndBatchesInScan(fragment, 8, 1);
+
+  fragment_scan_options->page_index_filtering = true;
+  CountRowsAndBatchesInScan(fragment, 2, 1);
+  SetFilter(or_(equal(field_ref("i64"), literal<int64_t>(1)),
+                equal(field_ref("str"), literal("h"))));
+  CountRowsAndBatchesInScan(fragment, 4, 1);
+  SetFilter(and_(greater(field_ref("i64"), literal<int64_t>(1)),
+                 less(field_ref("str"), literal("e"))));
+  CountRowsAndBatchesInScan(fragment, 2, 1);
+  SetFilter(is_null(field_ref("i64")));
+  CountRowsAndBatchesInScan(fragment, 2, 1);
+  SetFilter(greater(field_ref("i64"), literal<int64_t>(7)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, 8, 1);
+
+  // Filtered rows are still exact once the scan filter is applied
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(5)));
+  ASSERT_OK_AND_ASSIGN(
+      auto dataset,
+      FileSystemDataset::Make(opts_->dataset_schema, literal(true), format_,
+                              /*filesystem=*/nullptr,
+                              {checked_pointer_cast<FileFragment>(fragment)}));
+  ScannerBuilder builder(dataset, opts_);
+  ASSERT_OK(builder.Filter(opts_->filter));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto actual, scanner->ToTable());
+  AssertTablesEqual(*table->Slice(5, 1), *actual, /*same_chunk_layout=*/false);
+}
+
+TEST_P(TestParquetFileFormatScan, LateMaterialization) {
+  // Two row groups of four rows, written as pages of two rows
+  auto table = TableFromJSON(
+      schema({field("i64", int64()), field("str", utf8()), field("f64", float64())}),
+      {R"([[0, "a", 0.5], [1, "b", 1.5], [2, "c", null], [3, "d", 3.5],
+           [4, "e", 4.5], [5, null, 5.5], [null, "g", 6.5], [7, "h", 7.5]])"});
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->write_batch_size(2)
+                        ->data_pagesize(1)
+                        ->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/4,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(buffer)));
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->late_materialization = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  // Only the matching rows are materialized
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(5)));
+  CountRowsAndBatchesInScan(fragment, 1, 1);
+  SetFilter(or_(less(field_ref("i64"), literal<int64_t>(2)),
+                equal(field_ref("str"), literal("h"))));
+  CountRowsAndBatchesInScan(fragment, 3, 2);
+  SetFilter(is_null(field_ref("i64")));
+  CountRowsAndBatchesInScan(fragment, 1, 1);
+  SetFilter(greater(field_ref("i64"), literal<int64_t>(7)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  // Filters referencing every projected column are not materialized late
+  SetFilter(and_(greater(field_ref("i64"), literal<int64_t>(2)),
+                 and_(not_equal(field_ref("str"), literal("z")),
+                      greater(field_ref("f64"), literal(0.0)))));
+  CountRowsAndBatchesInScan(fragment, 8, 2);
+
+  fragment_scan_options->page_index_filtering = true;
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(5)));
+  CountRowsAndBatchesInScan(fragment, 1, 1);
+
+  for (bool page_index_filtering : {false, true}) {
+    ARROW_SCOPED_TRACE("page_index_filtering = ", page_index_filtering);
+    fragment_scan_options->page_index_filtering = page_index_filtering;
+    ASSERT_OK_AND_ASSIGN(
+        auto dataset,
+        FileSystemDataset::Make(opts_->dataset_schema, literal(true), format_,
+                                /*filesystem=*/nullptr,
+                                {checked_pointer_cast<FileFragment>(fragment)}));
+    ScannerBuilder builder(dataset, opts_);
+    ASSERT_OK(builder.Filter(or_(greater_equal(field_ref("i64"), literal<int64_t>(5)),
+                                 equal(field_ref("str"), literal("b")))));
+    ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(auto actual, scanner->ToTable());
+    auto expected = TableFromJSON(table->schema(), {R"([[1, "b", 1.5], [5, null, 5.5],
+                                                        [7, "h", 7.5]])"});
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    // The filter columns need not be projected
+    ASSERT_OK(builder.Project({"f64"}));
+    ASSERT_OK_AND_ASSIGN(scanner, builder.Finish());
+    ASSERT_OK_AND_ASSIGN(actual, scanner->ToTable());
+    expected =
+        TableFromJSON(schema({field("f64", float64())}), {"[[1.5], [5.5], [7.5]]"});
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST_P(TestParquetFileFormatScan, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -840,6 +1156,93 @@ TEST(TestParquetStatistics, NullMax) {
   EXPECT_EQ(stat_expression->ToString(), "(x >= 1)");
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownBloomFilter) {
+  ASSERT_OK_AND_ASSIGN(std::string dir_string,
+                       arrow::internal::GetEnvVar("PARQUET_TEST_DATA"));
+  ASSERT_OK_AND_ASSIGN(auto file, io::ReadableFile::Open(
+                                      dir_string +
+                                      "/data_index_bloom_encoding_with_length.parquet"));
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource(file)));
+  ASSERT_OK_AND_ASSIGN(auto physical_schema, fragment->ReadPhysicalSchema());
+  SetSchema(physical_schema->fields());
+  // A single row group whose first column has a bloom filter holding "Hello"
+  auto column = field_ref(physical_schema->field(0)->name());
+  const auto& type = physical_schema->field(0)->type();
+  auto hello = literal(ScalarFromJSON(type, R"("Hello")"));
+  auto not_exists = literal(ScalarFromJSON(type, R"("NOT_EXISTS")"));
+  const int64_t num_rows =
+      checked_pointer_cast<ParquetFileFragment>(fragment)->metadata()->num_rows();
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->bloom_filter_filtering = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  SetFilter(equal(column, hello));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+  SetFilter(equal(column, not_exists));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(or_(equal(column, not_exists), equal(column, hello)));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+  SetFilter(and_(equal(column, not_exists), is_valid(column)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(call("is_in", {column},
+                 compute::SetLookupOptions(
+                     ArrayFromJSON(type, R"(["NOT_EXISTS", "ALSO_MISSING"])"))));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(call("is_in", {column},
+                 compute::SetLookupOptions(
+                     ArrayFromJSON(type, R"(["NOT_EXISTS", "Hello"])"))));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+  // Only equality comparisons are tested against bloom filters
+  SetFilter(not_equal(column, hello));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+
+  fragment_scan_options->bloom_filter_filtering = false;
+  SetFilter(equal(column, not_exists));
+  CountRowsAndBatchesInScan(fragment, num_rows, 1);
+}
+
+TEST_F(TestParquetFileFormat, PredicatePushdownDictionary) {
+  // Two row groups whose statistics do not tell their values apart
+  auto table = TableFromJSON(
+      schema({field("str", utf8()), field("i64", int64()), field("plain", int64())}),
+      {R"([["a", 0, 0], ["c", 2, 2], ["a", 0, 0], ["c", 2, 2],
+           ["b", 1, 1], ["d", 3, 3], ["b", 1, 1], ["d", 3, 3]])"});
+  auto properties = WriterProperties::Builder().disable_dictionary("plain")->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK(WriteTable(*table, default_memory_pool(), sink, /*chunk_size=*/4,
+                       properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  SetSchema(table->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment,
+                       format_->MakeFragment(FileSource(std::move(buffer))));
+
+  auto fragment_scan_options = std::make_shared<ParquetFragmentScanOptions>();
+  fragment_scan_options->dictionary_filtering = true;
+  opts_->fragment_scan_options = fragment_scan_options;
+
+  SetFilter(equal(field_ref("str"), literal("b")));
+  CountRowsAndBatchesInScan(fragment, 4, 1);
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(2)));
+  CountRowsAndBatchesInScan(fragment, 4, 1);
+  SetFilter(equal(field_ref("str"), literal("e")));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  SetFilter(or_(equal(field_ref("str"), literal("b")),
+                equal(field_ref("i64"), literal<int64_t>(0))));
+  CountRowsAndBatchesInScan(fragment, 8, 2);
+  SetFilter(call("is_in", {field_ref("str")},
+                 compute::SetLookupOptions(ArrayFromJSON(utf8(), R"(["a", "e"])"))));
+  CountRowsAndBatchesInScan(fragment, 4, 1);
+  // Column chunks that are not dictionary encoded are not tested
+  SetFilter(equal(field_ref("plain"), literal<int64_t>(1)));
+  CountRowsAndBatchesInScan(fragment, 8, 2);
+
+  fragment_scan_options->dictionary_filtering = false;
+  SetFilter(equal(field_ref("str"), literal("b")));
+  CountRowsAndBatchesInScan(fragment, 8, 2);
+}
+
 class DelayedBufferReader : public ::arrow::io::BufferReader {
  public:
   explicit DelayedBufferReader(const std::shared_ptr<::arrow::Buffer>& buffer)
@@ -15,16 +15,20 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
+#include <chrono>
 #include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/runtime_filter.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/expression_internal.h"
@@ -35,6 +39,7 @@
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/stopwatch.h"
 #include "arrow/util/string.h"
 #include "arrow/util/tracing_internal.h"
 #include "arrow/util/unreachable.h"
@@ -79,6 +84,136 @@ Future<AsyncGenerator<std::shared_ptr<Fragment>>> GetFragments(
       });
 }
 
+/// \brief A batch readahead throttle whose limit is adjusted while scanning
+///
+/// The limit is derived from two running averages: the I/O latency of a batch read
+/// and the rate (in bytes per second) at which the downstream nodes consume batches.
+/// By Little's law the bytes that must be in flight to keep the consumer busy are
+/// rate * latency.  We keep twice that (plus one batch) to absorb jitter and clamp
+/// the result to the configured memory target.
+class AdaptiveReadaheadThrottle : public util::ThrottledAsyncTaskScheduler::Throttle {
+ public:
+  AdaptiveReadaheadThrottle(int initial_limit, int memory_target)
+      : memory_target_(memory_target),
+        limit_(std::max(1, std::min(initial_limit, memory_target))) {}
+
+  ~AdaptiveReadaheadThrottle() override {
+    if (backoff_.is_valid()) {
+      backoff_.MarkFinished(Status::Cancelled("Throttle destroyed while paused"));
+    }
+  }
+
+  std::optional<Future<>> TryAcquire(int amt) override {
+    std::lock_guard<std::mutex> lk(mutex_);
+    if (backoff_.is_valid()) {
+      return backoff_;
+    }
+    // A task larger than the current limit may still run on its own
+    if (in_flight_ == 0 || in_flight_ + amt <= limit_) {
+      in_flight_ += amt;
+      return std::nullopt;
+    }
+    backoff_ = Future<>::Make();
+    return backoff_;
+  }
+
+  void Release(int amt) override {
+    std::unique_lock lk(mutex_);
+    in_flight_ -= amt;
+    NotifyUnlocked(std::move(lk));
+  }
+
+  void Pause() override {
+    std::lock_guard lg(mutex_);
+    paused_ = true;
+    if (!backoff_.is_valid()) {
+      backoff_ = Future<>::Make();
+    }
+  }
+
+  void Resume() override {
+    std::unique_lock lk(mutex_);
+    paused_ = false;
+    NotifyUnlocked(std::move(lk));
+  }
+
+  int Capacity() override { return memory_target_; }
+
+  /// Record the latency of one batch read of `bytes` estimated bytes
+  void RecordRead(int64_t bytes, uint64_t latency_ns) {
+    std::unique_lock lk(mutex_);
+    latency_ns_ = Average(latency_ns_, static_cast<double>(latency_ns));
+    batch_bytes_ = Average(batch_bytes_, static_cast<double>(bytes));
+    Update(std::move(lk));
+  }
+
+  /// Record that `bytes` estimated bytes were delivered downstream
+  void RecordConsumed(int64_t bytes) {
+    std::unique_lock lk(mutex_);
+    auto now = std::chrono::steady_clock::now();
+    if (window_bytes_ == 0) {
+      window_start_ = now;
+    }
+    window_bytes_ += bytes;
+    std::chrono::duration<double> elapsed = now - window_start_;
+    if (elapsed.count() < kMinWindowSeconds) {
+      lk.unlock();
+      return;
+    }
+    rate_ = Average(rate_, static_cast<double>(window_bytes_) / elapsed.count());
+    window_bytes_ = 0;
+    Update(std::move(lk));
+  }
+
+ private:
+  static constexpr double kMinWindowSeconds = 0.01;
+  static constexpr double kSmoothing = 0.25;
+
+  static double Average(double current, double sample) {
+    return current < 0 ? sample : current + kSmoothing * (sample - current);
+  }
+
+  void Update(std::unique_lock<std::mutex>&& lk) {
+    if (rate_ < 0 || latency_ns_ < 0) {
+      lk.unlock();
+      return;
+    }
+    double wanted = 2 * rate_ * latency_ns_ / 1e9 + batch_bytes_;
+    int old_limit = limit_;
+    limit_ = static_cast<int>(
+        std::max(1.0, std::min(wanted, static_cast<double>(memory_target_))));
+    if (limit_ > old_limit) {
+      NotifyUnlocked(std::move(lk));
+    } else {
+      lk.unlock();
+    }
+  }
+
+  void NotifyUnlocked(std::unique_lock<std::mutex>&& lk) {
+    if (backoff_.is_valid() && !paused_) {
+      Future<> backoff_to_fulfill = std::move(backoff_);
+      lk.unlock();
+      backoff_to_fulfill.MarkFinished();
+    } else {
+      lk.unlock();
+    }
+  }
+
+  std::mutex mutex_;
+  const int memory_target_;
+  int limit_;
+  int in_flight_ = 0;
+  bool paused_ = false;
+  Future<> backoff_;
+
+  // Running averages, negative until the first sample arrives
+  double latency_ns_ = -1;
+  double batch_bytes_ = -1;
+  double rate_ = -1;
+  std::chrono::steady_clock::time_point window_start_;
+  int64_t window_bytes_ = 0;
+};
+
 /// \brief A node that scans a dataset
 ///
 /// The scan node has three groups of io-tasks and one task.
@@ -116,10 +251,11 @@ Future<AsyncGenerator<std::shared_ptr<Fragment>>> GetFragments(
 /// readahead is handled by the fragment (and not the scanner) because the exact details
 /// of how it is performed depend on the underlying format.
 ///
-/// When a scan node is aborted (StopProducing) we send a cancel signal to any active
-/// fragments.  On destruction we continue consuming the fragments until they complete
-/// (which should be fairly quick since we cancelled the fragment).  This ensures the
-/// I/O work is completely finished before the node is destroyed.
+/// When a scan node is stopped (StopProducing), either because the plan is aborted or
+/// because a downstream node, such as a fetch, needs no more rows, no further fragments
+/// are listed and no further batch reads are issued.  On destruction we continue
+/// consuming the batch reads already issued until they complete.  This ensures the I/O
+/// work is completely finished before the node is destroyed.
 class ScanNode : public acero::ExecNode, public acero::TracedNode {
  public:
   ScanNode(acero::ExecPlan* plan, ScanV2Options options,
@@ -145,6 +281,12 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
           "Batch readahead may not be less than 0.  Set to 0 to disable readahead");
     }
 
+    if (options.readahead_memory_target < 0) {
+      return Status::Invalid(
+          "Readahead memory target may not be less than 0.  Set to 0 to disable "
+          "adaptive readahead");
+    }
+
     if (!normalized.filter.is_valid()) {
       normalized.filter = compute::literal(true);
     }
@@ -195,6 +337,13 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
   Status Init() override { return Status::OK(); }
 
+  // Runtime filters are applied to the scanned batches before they enter the pipeline
+  bool AddRuntimeFilter(std::shared_ptr<acero::RuntimeFilter> filter,
+                        std::vector<int> key_ids) override {
+    runtime_filters_.Add(std::move(filter), std::move(key_ids));
+    return true;
+  }
+
   struct KnownValue {
     std::size_t index;
     Datum value;
@@ -225,8 +374,13 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
     Result<Future<>> operator()() override {
       // Prevent concurrent calls to ScanBatch which might not be thread safe
       std::lock_guard<std::mutex> lk(scan_->mutex);
+      ::arrow::internal::StopWatch watch;
+      watch.Start();
       return scan_->fragment_scanner->ScanBatch(batch_index_)
-          .Then([this](const std::shared_ptr<RecordBatch>& batch) {
+          .Then([this, watch](const std::shared_ptr<RecordBatch>& batch) mutable {
+            if (node_->adaptive_throttle_ != nullptr) {
+              node_->adaptive_throttle_->RecordRead(cost_, watch.Stop());
+            }
             return HandleBatch(batch);
           });
     }
@@ -263,8 +417,18 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
               batch, node_->options_.columns, *scan_->scan_request.fragment_selection));
       compute::ExecBatch with_known_values = AddKnownValues(std::move(evolved_batch));
       node_->plan_->query_context()->ScheduleTask(
-          [node = node_, output_batch = std::move(with_known_values)] {
-            return node->output_->InputReceived(node, output_batch);
+          [node = node_, cost = cost_,
+           output_batch = std::move(with_known_values)]() mutable {
+            if (!node->runtime_filters_.empty()) {
+              acero::QueryContext* ctx = node->plan_->query_context();
+              RETURN_NOT_OK(node->runtime_filters_.Apply(ctx, ctx->GetThreadIndex(),
+                                                         &output_batch));
+            }
+            RETURN_NOT_OK(node->output_->InputReceived(node, std::move(output_batch)));
+            if (node->adaptive_throttle_ != nullptr) {
+              node->adaptive_throttle_->RecordConsumed(cost);
+            }
+            return Status::OK();
           },
           "ScanNode::ProcessMorsel");
       return Status::OK();
@@ -286,6 +450,10 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
     }
 
     Result<Future<>> operator()() override {
+      // Once the node is stopped, fragments not yet listed are no longer read from
+      if (node->stopped_) {
+        return Future<>::MakeFinished();
+      }
       return fragment
           ->InspectFragment(node->options_.format_options,
                             node->plan_->query_context()->exec_context())
@@ -339,10 +507,9 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
     Future<> BeginScan(const std::shared_ptr<InspectedFragment>& inspected_fragment) {
       // Based on the fragment's guarantee we may not need to retrieve all the columns
-      compute::Expression fragment_filter = node->options_.filter;
       ARROW_ASSIGN_OR_RAISE(
           compute::Expression filter_minus_part,
-          compute::SimplifyWithGuarantee(std::move(fragment_filter),
+          node->simplify_cache_.Simplify(node->options_.filter,
                                          fragment->partition_expression()));
 
       ARROW_ASSIGN_OR_RAISE(
@@ -384,6 +551,9 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
           node->batches_throttle_.get(),
           StateHolder{list_and_scan_done, std::move(scan_state)});
       for (int i = 0; i < fragment_scanner->NumBatches(); i++) {
+        if (node->stopped_) {
+          break;
+        }
         node->num_batches_.fetch_add(1);
         scan_tasks->AddTask(std::make_unique<ScanBatchTask>(node, state_view, i));
       }
@@ -405,7 +575,7 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
           compute::Expression devolution_guarantee,
           scan_state->fragment_evolution->GetGuarantee(desired_columns));
       ARROW_ASSIGN_OR_RAISE(compute::Expression simplified_filter,
-                            compute::SimplifyWithGuarantee(filter, devolution_guarantee));
+                            node->simplify_cache_.Simplify(filter, devolution_guarantee));
       ARROW_ASSIGN_OR_RAISE(
           scan_state->scan_request.filter,
           scan_state->fragment_evolution->DevolveFilter(std::move(simplified_filter)));
@@ -438,8 +608,17 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
   Status StartProducing() override {
     NoteStartProducing(ToStringExtra());
-    batches_throttle_ = util::ThrottledAsyncTaskScheduler::Make(
-        plan_->query_context()->async_scheduler(), options_.target_bytes_readahead + 1);
+    if (options_.readahead_memory_target > 0) {
+      auto throttle = std::make_unique<AdaptiveReadaheadThrottle>(
+          options_.target_bytes_readahead + 1, options_.readahead_memory_target);
+      adaptive_throttle_ = throttle.get();
+      batches_throttle_ = util::ThrottledAsyncTaskScheduler::MakeWithCustomThrottle(
+          plan_->query_context()->async_scheduler(), std::move(throttle));
+    } else {
+      batches_throttle_ = util::ThrottledAsyncTaskScheduler::Make(
+          plan_->query_context()->async_scheduler(),
+          options_.target_bytes_readahead + 1);
+    }
     plan_->query_context()->async_scheduler()->AddSimpleTask(
         [this] {
           return GetFragments(options_.dataset.get(), options_.filter)
@@ -463,8 +642,14 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
  private:
   ScanV2Options options_;
+  acero::RuntimeFilterSet runtime_filters_;
+  // Fragments mostly share a few partition expressions and schemas, so the filter is
+  // simplified against the same guarantees over and over
+  compute::SimplifyWithGuaranteeCache simplify_cache_;
   std::atomic<int> num_batches_{0};
   std::shared_ptr<util::ThrottledAsyncTaskScheduler> batches_throttle_;
+  // Owned by batches_throttle_, null unless adaptive readahead is enabled
+  AdaptiveReadaheadThrottle* adaptive_throttle_ = nullptr;
 };
 
 }  // namespace
@@ -249,6 +249,17 @@ struct ARROW_DS_EXPORT ScanV2Options : public acero::ExecNodeOptions {
   /// Set to 0 to disable fragment readahead.  When disabled the dataset will be scanned
   /// one fragment at a time.
   int32_t fragment_readahead = kDefaultFragmentReadahead;
+
+  /// \brief Upper bound, in bytes, for an adaptive batch readahead
+  ///
+  /// When greater than 0 the scan node adjusts the batch readahead while scanning
+  /// instead of using the fixed `target_bytes_readahead`.  The readahead is sized so
+  /// that enough bytes are in flight to cover the observed I/O latency at the rate
+  /// the downstream nodes consume batches, and it never exceeds this target.
+  /// `target_bytes_readahead` is used as the starting value.
+  ///
+  /// Set to 0 (the default) to disable adaptive readahead.
+  int32_t readahead_memory_target = 0;
   /// \brief Options specific to the file format
   const FragmentScanOptions* format_options = NULLPTR;
 
@@ -15,15 +15,22 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <chrono>
+
 #include "benchmark/benchmark.h"
 
 #include "arrow/acero/options.h"
 #include "arrow/api.h"
 #include "arrow/compute/api.h"
 #include "arrow/dataset/dataset.h"
+#include "arrow/dataset/discovery.h"
+#include "arrow/dataset/file_ipc.h"
 #include "arrow/dataset/plan.h"
 #include "arrow/dataset/scanner.h"
 #include "arrow/dataset/test_util_internal.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/caching.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/random.h"
@@ -269,5 +276,213 @@ static void ScanBenchmark_Customize(benchmark::internal::Benchmark* b) {
 BENCHMARK(MinimalEndToEndBench)->Apply(ScanBenchmark_Customize);
 BENCHMARK(ScanOnlyBench)->Apply(ScanBenchmark_Customize);
 
+// ----------------------------------------------------------------------
+// Scans of IPC files on emulated remote storage
+//
+// The files live in a MockFileSystem wrapped by a SlowFileSystem, which adds a
+// latency to every file system call and read, and by a per-file bandwidth limit.
+
+static constexpr int kRemoteNumFiles = 16;
+static constexpr int kRemoteBatchesPerFile = 16;
+static constexpr int kRemoteBatchSize = 16 * 1024;
+
+// Default latency (seconds) and bandwidth (bytes per second) of a single
+// request, roughly those of an object store accessed from the same region.
+static constexpr double kRemoteLatency = 0.01;
+static constexpr double kRemoteBandwidth = 100e6;
+
+// Forwards to another file, sleeping as long as reading the requested bytes
+// takes at the given bandwidth.
+class BandwidthLimitedFile : public io::RandomAccessFile {
+ public:
+  BandwidthLimitedFile(std::shared_ptr<io::RandomAccessFile> file,
+                       double bytes_per_second)
+      : file_(std::move(file)), bytes_per_second_(bytes_per_second) {}
+
+  Status Close() override { return file_->Close(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    Throttle(nbytes);
+    return file_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    Throttle(nbytes);
+    return file_->Read(nbytes);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    Throttle(nbytes);
+    return file_->ReadAt(position, nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    Throttle(nbytes);
+    return file_->ReadAt(position, nbytes);
+  }
+
+ private:
+  void Throttle(int64_t nbytes) {
+    if (bytes_per_second_ > 0) SleepFor(static_cast<double>(nbytes) / bytes_per_second_);
+  }
+
+  std::shared_ptr<io::RandomAccessFile> file_;
+  double bytes_per_second_;
+};
+
+class RemoteFileSystem : public fs::SlowFileSystem {
+ public:
+  RemoteFileSystem(std::shared_ptr<fs::FileSystem> base_fs, double latency,
+                   double bytes_per_second)
+      : fs::SlowFileSystem(std::move(base_fs), latency, /*seed=*/kSeed),
+        bytes_per_second_(bytes_per_second) {}
+
+  using fs::SlowFileSystem::OpenInputFile;
+
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override {
+    ARROW_ASSIGN_OR_RAISE(auto file, fs::SlowFileSystem::OpenInputFile(path));
+    return std::make_shared<BandwidthLimitedFile>(std::move(file), bytes_per_second_);
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const fs::FileInfo& info) override {
+    ARROW_ASSIGN_OR_RAISE(auto file, fs::SlowFileSystem::OpenInputFile(info));
+    return std::make_shared<BandwidthLimitedFile>(std::move(file), bytes_per_second_);
+  }
+
+ private:
+  static constexpr int32_t kSeed = 42;
+  double bytes_per_second_;
+};
+
+// The IPC files are written once and shared by all remote benchmarks.
+std::shared_ptr<fs::FileSystem> GetRemoteBaseFileSystem() {
+  static std::shared_ptr<fs::FileSystem> base_fs = [] {
+    auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+    auto batches = ::arrow::compute::GenerateBatches(GetSchema(), kRemoteBatchesPerFile,
+                                                     kRemoteBatchSize);
+    for (int i = 0; i < kRemoteNumFiles; ++i) {
+      EXPECT_OK_AND_ASSIGN(auto stream, mock_fs->OpenOutputStream(
+                                            "data/" + std::to_string(i) + ".arrow"));
+      EXPECT_OK_AND_ASSIGN(auto writer, ipc::MakeFileWriter(stream, GetSchema()));
+      for (const auto& batch : batches) {
+        ABORT_NOT_OK(writer->WriteRecordBatch(*batch));
+      }
+      ABORT_NOT_OK(writer->Close());
+      ABORT_NOT_OK(stream->Close());
+    }
+    return mock_fs;
+  }();
+  return base_fs;
+}
+
+// Cache modes of the IPC reader
+static constexpr int kNoPreBuffer = 0;
+static constexpr int kPreBufferCoalesced = 1;
+static constexpr int kPreBufferUncoalesced = 2;
+
+struct RemoteScanParams {
+  double latency = kRemoteLatency;
+  double bytes_per_second = kRemoteBandwidth;
+  int32_t fragment_readahead = kDefaultFragmentReadahead;
+  int32_t batch_readahead = kDefaultBatchReadahead;
+  int cache_mode = kNoPreBuffer;
+  int io_threads = 8;
+};
+
+void RemoteScan(benchmark::State& state, const RemoteScanParams& params) {
+  auto remote_fs = std::make_shared<RemoteFileSystem>(
+      GetRemoteBaseFileSystem(), params.latency, params.bytes_per_second);
+  fs::FileSelector selector;
+  selector.base_dir = "data";
+  ASSERT_OK_AND_ASSIGN(auto factory,
+                       FileSystemDatasetFactory::Make(remote_fs, selector,
+                                                      std::make_shared<IpcFileFormat>(),
+                                                      FileSystemFactoryOptions{}));
+  ASSERT_OK_AND_ASSIGN(auto dataset, factory->Finish());
+
+  auto fragment_scan_options = std::make_shared<IpcFragmentScanOptions>();
+  if (params.cache_mode != kNoPreBuffer) {
+    auto cache_options = io::CacheOptions::Defaults();
+    if (params.cache_mode == kPreBufferUncoalesced) {
+      cache_options.hole_size_limit = 0;
+      cache_options.range_size_limit = 1;
+    }
+    fragment_scan_options->cache_options =
+        std::make_shared<io::CacheOptions>(cache_options);
+  }
+
+  ScannerBuilder builder(dataset);
+  ABORT_NOT_OK(builder.UseThreads(true));
+  ABORT_NOT_OK(builder.FragmentReadahead(params.fragment_readahead));
+  ABORT_NOT_OK(builder.BatchReadahead(params.batch_readahead));
+  ABORT_NOT_OK(builder.FragmentScanOptions(fragment_scan_options));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+
+  const int old_io_threads = io::GetIOThreadPoolCapacity();
+  ABORT_NOT_OK(io::SetIOThreadPoolCapacity(params.io_threads));
+
+  int64_t num_rows = 0;
+  double time_to_first_batch = 0;
+  for (auto _ : state) {
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_OK_AND_ASSIGN(auto generator, scanner->ScanBatchesAsync());
+    bool first = true;
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto batch, generator().result());
+      if (IsIterationEnd(batch)) break;
+      if (first) {
+        time_to_first_batch += std::chrono::duration<double>(
+                                   std::chrono::steady_clock::now() - start)
+                                   .count();
+        first = false;
+      }
+      num_rows += batch.record_batch->num_rows();
+    }
+  }
+
+  ABORT_NOT_OK(io::SetIOThreadPoolCapacity(old_io_threads));
+
+  ASSERT_EQ(num_rows, state.iterations() * kRemoteNumFiles * kRemoteBatchesPerFile *
+                          kRemoteBatchSize);
+  state.SetItemsProcessed(num_rows);
+  state.SetBytesProcessed(num_rows * GetBytesForSchema());
+  state.counters["time_to_first_batch"] =
+      benchmark::Counter(time_to_first_batch, benchmark::Counter::kAvgIterations);
+}
+
+// Sweeps the scan options at the default latency and bandwidth
+static void RemoteScanOptionsBench(benchmark::State& state) {
+  RemoteScanParams params;
+  params.fragment_readahead = static_cast<int32_t>(state.range(0));
+  params.batch_readahead = static_cast<int32_t>(state.range(1));
+  params.cache_mode = static_cast<int>(state.range(2));
+  params.io_threads = static_cast<int>(state.range(3));
+  RemoteScan(state, params);
+}
+
+// Sweeps the storage characteristics with the default scan options
+static void RemoteStorageBench(benchmark::State& state) {
+  RemoteScanParams params;
+  params.latency = static_cast<double>(state.range(0)) / 1000;
+  params.bytes_per_second = static_cast<double>(state.range(1)) * 1e6;
+  RemoteScan(state, params);
+}
+
+BENCHMARK(RemoteScanOptionsBench)
+    ->ArgsProduct({{1, 4, 16},
+                   {1, 16},
+                   {kNoPreBuffer, kPreBufferCoalesced, kPreBufferUncoalesced},
+                   {8, 32}})
+    ->ArgNames({"fragment_readahead", "batch_readahead", "cache_mode", "io_threads"})
+    ->UseRealTime();
+
+BENCHMARK(RemoteStorageBench)
+    ->ArgsProduct({{0, 5, 20, 50}, {50, 200, 1000}})
+    ->ArgNames({"latency_ms", "bandwidth_MBps"})
+    ->UseRealTime();
+
 }  // namespace dataset
 }  // namespace arrow
@@ -660,6 +660,15 @@ TEST(TestNewScanner, Backpressure) {
   options.target_bytes_readahead = 50 * kRowsPerTestBatch;
   CheckScannerBackpressure(test_dataset, options, 4, 3,
                            ::arrow::internal::GetCpuThreadPool());
+
+  // Adaptive readahead never exceeds the memory target
+  test_dataset = MakeTestDataset(kNumFragments, kNumBatchesPerFragment);
+  options = ScanV2Options(test_dataset);
+  options.columns = ScanV2Options::AllColumns(*test_dataset->schema());
+  options.fragment_readahead = 4;
+  options.readahead_memory_target = 50 * kRowsPerTestBatch;
+  CheckScannerBackpressure(test_dataset, options, 4, 3,
+                           ::arrow::internal::GetCpuThreadPool());
 }
 
 TEST(TestNewScanner, NestedRead) {
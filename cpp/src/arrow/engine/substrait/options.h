@@ -107,7 +107,8 @@ struct ARROW_ENGINE_EXPORT ConversionOptions {
         named_table_provider(kDefaultNamedTableProvider),
         named_tap_provider(default_named_tap_provider()),
         extension_provider(default_extension_provider()),
-        allow_arrow_extensions(false) {}
+        allow_arrow_extensions(false),
+        choose_join_build_side(true) {}
 
   /// \brief How strictly the converter should adhere to the structure of the input.
   ConversionStrictness strictness;
@@ -129,6 +130,12 @@ struct ARROW_ENGINE_EXPORT ConversionOptions {
   /// Set to false to create plans that are more likely to be compatible with non-Arrow
   /// engines
   bool allow_arrow_extensions;
+  /// \brief If true then the smaller input of a join is used as its build side
+  ///
+  /// Inputs are compared by estimates of their row counts, from the data of in-memory
+  /// tables or from the metadata of dataset fragments.  The inputs are only swapped
+  /// when both have an estimate.  Semi and anti joins are never swapped.
+  bool choose_join_build_side;
 };
 
 }  // namespace engine
@@ -17,10 +17,12 @@
 
 #include "arrow/engine/substrait/relation_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -56,6 +58,7 @@
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/type_fwd.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -372,6 +375,63 @@ struct SortBehavior {
   }
 };
 
+// A rough upper bound on the number of rows output by a declaration, used to choose
+// the build side of joins.  Sources are counted from their data or, for datasets,
+// from fragment metadata.
+std::optional<int64_t> EstimateRowCount(const acero::Declaration& declaration) {
+  auto input_estimate = [&](size_t i) -> std::optional<int64_t> {
+    if (i >= declaration.inputs.size()) return std::nullopt;
+    const auto* input = std::get_if<acero::Declaration>(&declaration.inputs[i]);
+    if (input == nullptr) return std::nullopt;
+    return EstimateRowCount(*input);
+  };
+  const std::string& name = declaration.factory_name;
+  if (name == "table_source") {
+    const auto& options =
+        checked_cast<const acero::TableSourceNodeOptions&>(*declaration.options);
+    return options.table->num_rows();
+  }
+  if (name == "scan") {
+    const auto& options =
+        checked_cast<const dataset::ScanNodeOptions&>(*declaration.options);
+    auto fragments = options.dataset->GetFragments();
+    if (!fragments.ok()) return std::nullopt;
+    int64_t num_rows = 0;
+    for (auto fragment : *fragments) {
+      if (!fragment.ok()) return std::nullopt;
+      auto count =
+          (*fragment)->CountRows(compute::literal(true), options.scan_options).result();
+      if (!count.ok() || !count->has_value()) return std::nullopt;
+      num_rows += **count;
+    }
+    return num_rows;
+  }
+  if (name == "filter" || name == "project" || name == "order_by") {
+    return input_estimate(0);
+  }
+  if (name == "fetch") {
+    const auto& options =
+        checked_cast<const acero::FetchNodeOptions&>(*declaration.options);
+    std::optional<int64_t> estimate = input_estimate(0);
+    if (!estimate) return options.count;
+    return std::max<int64_t>(0, std::min(options.count, *estimate - options.offset));
+  }
+  if (name == "hashjoin") {
+    // Assume a foreign key join, which outputs about as many rows as its larger input
+    const auto& options =
+        checked_cast<const acero::HashJoinNodeOptions&>(*declaration.options);
+    std::optional<int64_t> left = input_estimate(0);
+    if (options.join_type == acero::JoinType::LEFT_SEMI ||
+        options.join_type == acero::JoinType::LEFT_ANTI) {
+      return left;
+    }
+    std::optional<int64_t> right = input_estimate(1);
+    if (!left || !right) return std::nullopt;
+    return std::max(*left, *right);
+  }
+  return std::nullopt;
+}
+
 }  // namespace
 
 Result<DeclarationInfo> FromProto(const substrait::Rel& rel, const ExtensionSet& ext_set,
@@ -747,13 +807,54 @@ Result<DeclarationInfo> FromProto(const substrait::Rel& rel, const ExtensionSet&
       std::vector<int> adjusted_field_indices(right_field_path->indices());
       adjusted_field_indices[0] -= num_left_fields;
       FieldPath adjusted_right_keys(adjusted_field_indices);
-      acero::HashJoinNodeOptions join_options{{std::move(*left_keys)},
-                                              {std::move(adjusted_right_keys)}};
-      join_options.join_type = join_type;
-      join_options.key_cmp = {join_key_cmp};
-      acero::Declaration join_dec{"hashjoin", std::move(join_options)};
-      join_dec.inputs.emplace_back(std::move(left.declaration));
-      join_dec.inputs.emplace_back(std::move(right.declaration));
+
+      // The hash join builds its hash table from its right input, which should then be
+      // the smaller one.  Semi and anti joins only output their left input and are
+      // kept as they are.
+      bool swap_inputs = false;
+      if (conversion_options.choose_join_build_side &&
+          join_type != acero::JoinType::LEFT_SEMI &&
+          join_type != acero::JoinType::LEFT_ANTI) {
+        std::optional<int64_t> left_rows = EstimateRowCount(left.declaration);
+        std::optional<int64_t> right_rows = EstimateRowCount(right.declaration);
+        swap_inputs = left_rows && right_rows && *right_rows > *left_rows;
+      }
+
+      acero::Declaration join_dec;
+      if (!swap_inputs) {
+        acero::HashJoinNodeOptions join_options{{std::move(*left_keys)},
+                                                {std::move(adjusted_right_keys)}};
+        join_options.join_type = join_type;
+        join_options.key_cmp = {join_key_cmp};
+        join_dec = acero::Declaration{"hashjoin", std::move(join_options)};
+        join_dec.inputs.emplace_back(std::move(left.declaration));
+        join_dec.inputs.emplace_back(std::move(right.declaration));
+      } else {
+        acero::HashJoinNodeOptions join_options{{std::move(adjusted_right_keys)},
+                                                {std::move(*left_keys)}};
+        join_options.join_type = join_type == acero::JoinType::LEFT_OUTER
+                                     ? acero::JoinType::RIGHT_OUTER
+                                 : join_type == acero::JoinType::RIGHT_OUTER
+                                     ? acero::JoinType::LEFT_OUTER
+                                     : join_type;
+        join_options.key_cmp = {join_key_cmp};
+        int num_right_fields = right.output_schema->num_fields();
+        acero::Declaration swapped{"hashjoin", std::move(join_options)};
+        swapped.inputs.emplace_back(std::move(right.declaration));
+        swapped.inputs.emplace_back(std::move(left.declaration));
+        // Restore the order of the fields, left ones first
+        std::vector<compute::Expression> fields;
+        std::vector<std::string> names;
+        for (int i = 0; i < join_schema->num_fields(); ++i) {
+          fields.push_back(compute::field_ref(
+              i < num_left_fields ? num_right_fields + i : i - num_left_fields));
+          names.push_back(join_schema->field(i)->name());
+        }
+        join_dec = acero::Declaration::Sequence(
+            {std::move(swapped),
+             {"project",
+              acero::ProjectNodeOptions{std::move(fields), std::move(names)}}});
+      }
 
       DeclarationInfo join_declaration{std::move(join_dec), join_schema};
 
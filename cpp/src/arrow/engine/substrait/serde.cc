@@ -18,8 +18,10 @@
 #include "arrow/engine/substrait/serde.h"
 
 #include <cstdint>
+#include <mutex>
 #include <type_traits>
 #include <utility>
+#include <variant>
 
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
@@ -44,6 +46,8 @@
 #include "arrow/engine/substrait/type_internal.h"
 #include "arrow/engine/substrait/util.h"
 #include "arrow/type.h"
+#include "arrow/util/cache_internal.h"
+#include "arrow/util/checked_cast.h"
 
 namespace arrow {
 namespace engine {
@@ -239,6 +243,122 @@ ARROW_ENGINE_EXPORT Result<PlanInfo> DeserializePlan(
   return PlanInfo{std::move(decl_info), std::move(names)};
 }
 
+namespace {
+
+// Replace the "named_table" declarations of a prepared plan with their source
+Result<acero::Declaration> BindNamedTables(
+    const acero::Declaration& declaration,
+    const NamedTableProvider& named_table_provider) {
+  if (declaration.factory_name == "named_table") {
+    if (!named_table_provider) {
+      return Status::Invalid(
+          "plan contained a named table but a NamedTableProvider has not been "
+          "configured");
+    }
+    const auto& options = ::arrow::internal::checked_cast<
+        const acero::NamedTableNodeOptions&>(*declaration.options);
+    ARROW_ASSIGN_OR_RAISE(acero::Declaration source_decl,
+                          named_table_provider(options.names, *options.schema));
+    if (!source_decl.IsValid()) {
+      return Status::Invalid("Invalid NamedTable Source");
+    }
+    return source_decl;
+  }
+  std::vector<acero::Declaration::Input> inputs;
+  inputs.reserve(declaration.inputs.size());
+  for (const acero::Declaration::Input& input : declaration.inputs) {
+    if (const auto* input_decl = std::get_if<acero::Declaration>(&input)) {
+      ARROW_ASSIGN_OR_RAISE(acero::Declaration bound_input,
+                            BindNamedTables(*input_decl, named_table_provider));
+      inputs.emplace_back(std::move(bound_input));
+    } else {
+      inputs.push_back(input);
+    }
+  }
+  return acero::Declaration(declaration.factory_name, std::move(inputs),
+                            declaration.options, declaration.label);
+}
+
+}  // namespace
+
+Result<std::shared_ptr<PreparedPlan>> PreparedPlan::Make(
+    const Buffer& buf, const ExtensionIdRegistry* registry,
+    const ConversionOptions& conversion_options) {
+  // Named tables are resolved by Bind()
+  ConversionOptions prepare_options = conversion_options;
+  prepare_options.named_table_provider =
+      [](const std::vector<std::string>& names,
+         const Schema& schema) -> Result<acero::Declaration> {
+    return acero::Declaration(
+        "named_table",
+        acero::NamedTableNodeOptions(names, std::make_shared<Schema>(schema)));
+  };
+  ARROW_ASSIGN_OR_RAISE(PlanInfo plan_info,
+                        DeserializePlan(buf, registry, /*ext_set_out=*/nullptr,
+                                        prepare_options));
+  return std::shared_ptr<PreparedPlan>(
+      new PreparedPlan(std::move(plan_info), conversion_options.named_table_provider));
+}
+
+Result<acero::Declaration> PreparedPlan::Bind(
+    const NamedTableProvider& named_table_provider) const {
+  return BindNamedTables(plan_info_.root.declaration, named_table_provider);
+}
+
+Result<acero::Declaration> PreparedPlan::Bind() const {
+  return Bind(named_table_provider_);
+}
+
+class PreparedPlanCache::Impl {
+ public:
+  Impl(int32_t capacity, const ExtensionIdRegistry* registry,
+       ConversionOptions conversion_options)
+      : registry_(registry),
+        conversion_options_(std::move(conversion_options)),
+        cache_(capacity) {}
+
+  Result<std::shared_ptr<PreparedPlan>> GetOrPrepare(const Buffer& buf) {
+    std::string key = buf.ToString();
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (auto* plan = cache_.Find(key)) {
+        return *plan;
+      }
+    }
+    // Prepare without holding the lock, so that other plans can be looked up meanwhile
+    ARROW_ASSIGN_OR_RAISE(auto plan,
+                          PreparedPlan::Make(buf, registry_, conversion_options_));
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.Replace(std::move(key), plan);
+    return plan;
+  }
+
+  int32_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.size();
+  }
+
+ private:
+  const ExtensionIdRegistry* registry_;
+  const ConversionOptions conversion_options_;
+  mutable std::mutex mutex_;
+  ::arrow::internal::LruCache<std::string, std::shared_ptr<PreparedPlan>> cache_;
+};
+
+PreparedPlanCache::PreparedPlanCache(int32_t capacity,
+                                     const ExtensionIdRegistry* registry,
+                                     ConversionOptions conversion_options)
+    : impl_(new Impl(capacity, registry, std::move(conversion_options))) {}
+
+PreparedPlanCache::~PreparedPlanCache() = default;
+
+Result<std::shared_ptr<PreparedPlan>> PreparedPlanCache::GetOrPrepare(
+    const Buffer& buf) {
+  return impl_->GetOrPrepare(buf);
+}
+
+int32_t PreparedPlanCache::size() const { return impl_->size(); }
+
 Result<BoundExpressions> DeserializeExpressions(
     const Buffer& buf, const ExtensionIdRegistry* registry,
     const ConversionOptions& conversion_options, ExtensionSet* ext_set_out) {
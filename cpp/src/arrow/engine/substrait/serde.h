@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -168,6 +169,72 @@ ARROW_ENGINE_EXPORT Result<PlanInfo> DeserializePlan(
     ExtensionSet* ext_set_out = NULLPTR,
     const ConversionOptions& conversion_options = {});
 
+/// \brief A single-relation Substrait Plan deserialized once, to be run many times
+///
+/// Parsing a plan, resolving its extensions and converting its relations may take
+/// longer than running a short query.  A prepared plan does this once, and only
+/// copies the resulting declarations for each run.
+///
+/// The named tables of the plan are resolved by each call to Bind(), so that the same
+/// prepared plan can run on different inputs.
+class ARROW_ENGINE_EXPORT PreparedPlan {
+ public:
+  /// \brief Deserialize and validate a Substrait Plan message
+  ///
+  /// \param[in] buf a buffer containing the protobuf serialization of a Substrait Plan
+  /// message
+  /// \param[in] registry an extension-id-registry to use, or null for the default one.
+  /// \param[in] conversion_options options to control how the conversion is to be done.
+  /// Its named table provider is the default one of Bind().
+  static Result<std::shared_ptr<PreparedPlan>> Make(
+      const Buffer& buf, const ExtensionIdRegistry* registry = NULLPTR,
+      const ConversionOptions& conversion_options = {});
+
+  /// \brief Make a declaration of the plan, resolving its named tables with
+  /// `named_table_provider`
+  ///
+  /// The declaration is suitable for use in any of the arrow::acero::DeclarationToXyz
+  /// methods.
+  Result<acero::Declaration> Bind(const NamedTableProvider& named_table_provider) const;
+
+  /// \brief Make a declaration of the plan, resolving its named tables with the
+  /// provider of the conversion options the plan was prepared with
+  Result<acero::Declaration> Bind() const;
+
+  /// \brief The deserialized plan, whose named tables are "named_table" declarations
+  const PlanInfo& plan_info() const { return plan_info_; }
+
+ private:
+  PreparedPlan(PlanInfo plan_info, NamedTableProvider named_table_provider)
+      : plan_info_(std::move(plan_info)),
+        named_table_provider_(std::move(named_table_provider)) {}
+
+  PlanInfo plan_info_;
+  NamedTableProvider named_table_provider_;
+};
+
+/// \brief A thread-safe cache of prepared plans, keyed by their Substrait message
+///
+/// Least recently used plans are evicted once the cache holds `capacity` plans.
+class ARROW_ENGINE_EXPORT PreparedPlanCache {
+ public:
+  explicit PreparedPlanCache(int32_t capacity,
+                             const ExtensionIdRegistry* registry = NULLPTR,
+                             ConversionOptions conversion_options = {});
+  ~PreparedPlanCache();
+
+  /// \brief Get the prepared plan of a Substrait Plan message, preparing it with the
+  /// options of the cache if it isn't cached yet
+  Result<std::shared_ptr<PreparedPlan>> GetOrPrepare(const Buffer& buf);
+
+  /// \brief The number of cached plans
+  int32_t size() const;
+
+ private:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \brief Deserialize a Substrait ExtendedExpression message to the corresponding Arrow
 /// type
 ///
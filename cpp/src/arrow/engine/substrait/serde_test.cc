@@ -1877,6 +1877,112 @@ TEST(Substrait, JoinPlanInvalidKeys) {
   }
 }
 
+TEST(Substrait, JoinPlanBuildSide) {
+  auto left_table = TableFromJSON(schema({field("A", int32()), field("B", int32())}),
+                                  {"[[1, 10], [2, 20]]"});
+  auto right_table = TableFromJSON(schema({field("A", int32()), field("C", int32())}),
+                                   {"[[1, 100], [1, 101], [3, 300], [4, 400]]"});
+  std::string substrait_json = R"({
+  "version": { "major_number": 9999, "minor_number": 9999, "patch_number": 9999 },
+  "relations": [{
+    "rel": {
+      "join": {
+        "left": {
+          "read": {
+            "base_schema": {
+              "names": ["A", "B"],
+              "struct": {"types": [{"i32": {}}, {"i32": {}}]}
+            },
+            "named_table": {"names": ["left"]}
+          }
+        },
+        "right": {
+          "read": {
+            "base_schema": {
+              "names": ["A", "C"],
+              "struct": {"types": [{"i32": {}}, {"i32": {}}]}
+            },
+            "named_table": {"names": ["right"]}
+          }
+        },
+        "expression": {
+          "scalarFunction": {
+            "functionReference": 0,
+            "arguments": [{
+              "value": {"selection": {"directReference": {"structField": {"field": 0}},
+                                      "rootReference": {}}}
+            }, {
+              "value": {"selection": {"directReference": {"structField": {"field": 2}},
+                                      "rootReference": {}}}
+            }],
+            "output_type": {"bool": {}}
+          }
+        },
+        "type": "JOIN_TYPE_LEFT"
+      }
+    }
+  }],
+  "extension_uris": [{
+    "extension_uri_anchor": 0,
+    "uri": ")" + std::string(kSubstraitComparisonFunctionsUri) +
+                               R"("
+  }],
+  "extensions": [{"extension_function": {
+    "extension_uri_reference": 0,
+    "function_anchor": 0,
+    "name": "equal"
+  }}]
+  })";
+  ASSERT_OK_AND_ASSIGN(auto buf,
+                       internal::SubstraitFromJSON("Plan", substrait_json,
+                                                   /*ignore_unknown_fields=*/false));
+  ConversionOptions conversion_options;
+  conversion_options.named_table_provider =
+      [&](const std::vector<std::string>& names,
+          const Schema&) -> Result<acero::Declaration> {
+    auto table = names[0] == "left" ? left_table : right_table;
+    return acero::Declaration("table_source", {},
+                              std::make_shared<acero::TableSourceNodeOptions>(table),
+                              names[0]);
+  };
+  auto expected = TableFromJSON(schema({field("A", int32()), field("B", int32()),
+                                        field("A", int32()), field("C", int32())}),
+                                {R"([
+    [1, 10, 1, 100],
+    [1, 10, 1, 101],
+    [2, 20, null, null]
+  ])"});
+
+  for (bool choose_join_build_side : {true, false}) {
+    ARROW_SCOPED_TRACE("choose_join_build_side = ", choose_join_build_side);
+    conversion_options.choose_join_build_side = choose_join_build_side;
+    ExtensionSet ext_set;
+    ASSERT_OK_AND_ASSIGN(
+        auto sink_decls,
+        DeserializePlans(
+            *buf, [] { return kNullConsumer; }, /*registry=*/nullptr, &ext_set,
+            conversion_options));
+    const auto& root = std::get<acero::Declaration>(sink_decls[0].inputs[0]);
+
+    // The larger right input is the probe side once swapped
+    const acero::Declaration* join = &root;
+    if (choose_join_build_side) {
+      ASSERT_EQ("project", root.factory_name);
+      join = &std::get<acero::Declaration>(root.inputs[0]);
+    }
+    ASSERT_EQ("hashjoin", join->factory_name);
+    const auto& join_options =
+        checked_cast<const acero::HashJoinNodeOptions&>(*join->options);
+    EXPECT_EQ(choose_join_build_side ? acero::JoinType::RIGHT_OUTER
+                                     : acero::JoinType::LEFT_OUTER,
+              join_options.join_type);
+    EXPECT_EQ(choose_join_build_side ? "right" : "left",
+              std::get<acero::Declaration>(join->inputs[0]).label);
+
+    CheckRoundTripResult(expected, buf, /*include_columns=*/{}, conversion_options);
+  }
+}
+
 TEST(Substrait, AggregateBasic) {
   ASSERT_OK_AND_ASSIGN(auto buf,
                        internal::SubstraitFromJSON("Plan", R"({
@@ -2558,6 +2664,74 @@ TEST(SubstraitRoundTrip, FilterNamedTable) {
                        /*include_columns=*/{}, conversion_options);
 }
 
+TEST(Substrait, PreparedPlan) {
+  const std::vector<std::string> table_names{"table", "1"};
+  const auto dummy_schema = schema({field("A", int32()), field("B", int32())});
+  auto make_plan = [&](compute::Expression filter) {
+    auto declarations = acero::Declaration::Sequence(
+        {acero::Declaration({"named_table",
+                             acero::NamedTableNodeOptions{table_names, dummy_schema},
+                             "n"}),
+         acero::Declaration({"filter", acero::FilterNodeOptions{std::move(filter)},
+                             "f"})});
+    ExtensionSet ext_set{};
+    return SerializePlan(declarations, &ext_set);
+  };
+  ASSERT_OK_AND_ASSIGN(
+      auto serialized_plan,
+      make_plan(compute::equal(compute::field_ref("A"), compute::field_ref("B"))));
+
+  auto provide_table = [&](std::shared_ptr<Table> table) -> NamedTableProvider {
+    return [table, &table_names](const std::vector<std::string>& names,
+                                 const Schema&) -> Result<acero::Declaration> {
+      if (table_names != names) {
+        return Status::Invalid("Table name mismatch");
+      }
+      return acero::Declaration("table_source", acero::TableSourceNodeOptions(table));
+    };
+  };
+  auto table1 = TableFromJSON(dummy_schema, {"[[1, 1], [2, 3]]"});
+  auto table2 = TableFromJSON(dummy_schema, {"[[4, 5], [6, 6], [7, 7]]"});
+
+  ConversionOptions conversion_options;
+  conversion_options.named_table_provider = provide_table(table1);
+  ASSERT_OK_AND_ASSIGN(auto prepared, PreparedPlan::Make(*serialized_plan, nullptr,
+                                                         conversion_options));
+
+  // The same prepared plan runs on different tables
+  for (int i = 0; i < 2; i++) {
+    ASSERT_OK_AND_ASSIGN(auto declaration, prepared->Bind());
+    ASSERT_OK_AND_ASSIGN(auto result, acero::DeclarationToTable(declaration));
+    engine::AssertTablesEqualIgnoringOrder(TableFromJSON(dummy_schema, {"[[1, 1]]"}),
+                                           result);
+  }
+  ASSERT_OK_AND_ASSIGN(auto declaration, prepared->Bind(provide_table(table2)));
+  ASSERT_OK_AND_ASSIGN(auto result, acero::DeclarationToTable(declaration));
+  engine::AssertTablesEqualIgnoringOrder(
+      TableFromJSON(dummy_schema, {"[[6, 6], [7, 7]]"}), result);
+  ASSERT_RAISES(Invalid, prepared->Bind(NamedTableProvider{}));
+
+  PreparedPlanCache cache(/*capacity=*/1, nullptr, conversion_options);
+  ASSERT_OK_AND_ASSIGN(auto cached, cache.GetOrPrepare(*serialized_plan));
+  ASSERT_OK_AND_ASSIGN(auto cached_again, cache.GetOrPrepare(*serialized_plan));
+  ASSERT_EQ(cached, cached_again);
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_OK_AND_ASSIGN(declaration, cached->Bind());
+  ASSERT_OK_AND_ASSIGN(result, acero::DeclarationToTable(declaration));
+  engine::AssertTablesEqualIgnoringOrder(TableFromJSON(dummy_schema, {"[[1, 1]]"}),
+                                         result);
+
+  // Preparing another plan evicts the least recently used one
+  ASSERT_OK_AND_ASSIGN(
+      auto other_plan,
+      make_plan(compute::less(compute::field_ref("A"), compute::field_ref("B"))));
+  ASSERT_OK_AND_ASSIGN(auto other_cached, cache.GetOrPrepare(*other_plan));
+  ASSERT_NE(cached, other_cached);
+  ASSERT_EQ(cache.size(), 1);
+  ASSERT_OK_AND_ASSIGN(cached_again, cache.GetOrPrepare(*serialized_plan));
+  ASSERT_NE(cached, cached_again);
+}
+
 TEST(SubstraitRoundTrip, ProjectRel) {
   compute::ExecContext exec_context;
   auto dummy_schema =
@@ -39,6 +39,7 @@
 #include "arrow/buffer.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/io/metrics.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
@@ -236,6 +237,8 @@ bool AzureOptions::Equals(const AzureOptions& other) const {
                       dfs_storage_authority == other.dfs_storage_authority &&
                       blob_storage_scheme == other.blob_storage_scheme &&
                       dfs_storage_scheme == other.dfs_storage_scheme &&
+                      read_chunk_size == other.read_chunk_size &&
+                      read_concurrency == other.read_concurrency &&
                       default_metadata == other.default_metadata &&
                       account_name == other.account_name &&
                       credential_kind_ == other.credential_kind_;
@@ -697,14 +700,38 @@ void ArrowMetadataToCommitBlockListOptions(
   }
 }
 
+/// \brief Download `nbytes` at `position` of a blob into `out`, as range requests of
+/// at most `chunk_size` bytes with up to `concurrency` of them in flight.
+Result<int64_t> DownloadRange(const Blobs::BlobClient& blob_client, int64_t position,
+                              int64_t nbytes, uint8_t* out, int64_t chunk_size,
+                              int32_t concurrency) {
+  Storage::Blobs::DownloadBlobToOptions download_options;
+  download_options.Range = Http::HttpRange{position, nbytes};
+  // The SDK downloads the first 256 MiB as a single request by default, which leaves
+  // the reads of file formats entirely serial.
+  download_options.TransferOptions.InitialChunkSize = chunk_size;
+  download_options.TransferOptions.ChunkSize = chunk_size;
+  download_options.TransferOptions.Concurrency = concurrency;
+  try {
+    return blob_client.DownloadTo(out, nbytes, download_options)
+        .Value.ContentRange.Length.Value();
+  } catch (const Storage::StorageException& exception) {
+    return ExceptionToStatus(
+        exception, "DownloadTo from '", blob_client.GetUrl(), "' at position ", position,
+        " for ", nbytes, " bytes failed. ReadAt failed to read the required byte range.");
+  }
+}
+
 class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<Blobs::BlobClient> blob_client,
                   const io::IOContext& io_context, AzureLocation location,
-                  int64_t size = kNoSize)
+                  const AzureOptions& options, int64_t size = kNoSize)
       : blob_client_(std::move(blob_client)),
         io_context_(io_context),
         location_(std::move(location)),
+        read_chunk_size_(options.read_chunk_size),
+        read_concurrency_(options.read_concurrency),
         content_length_(size) {}
 
   Status Init() {
@@ -798,20 +825,8 @@ class ObjectInputFile final : public io::RandomAccessFile {
       return 0;
     }
 
-    // Read the desired range of bytes
-    Http::HttpRange range{position, nbytes};
-    Storage::Blobs::DownloadBlobToOptions download_options;
-    download_options.Range = range;
-    try {
-      return blob_client_
-          ->DownloadTo(reinterpret_cast<uint8_t*>(out), nbytes, download_options)
-          .Value.ContentRange.Length.Value();
-    } catch (const Storage::StorageException& exception) {
-      return ExceptionToStatus(
-          exception, "DownloadTo from '", blob_client_->GetUrl(), "' at position ",
-          position, " for ", nbytes,
-          " bytes failed. ReadAt failed to read the required byte range.");
-    }
+    return DownloadRange(*blob_client_, position, nbytes, reinterpret_cast<uint8_t*>(out),
+                         read_chunk_size_, read_concurrency_);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -832,6 +847,26 @@ class ObjectInputFile final : public io::RandomAccessFile {
     return std::move(buffer);
   }
 
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed("read"));
+    RETURN_NOT_OK(CheckPosition(position, "read"));
+
+    nbytes = std::min(nbytes, content_length_ - position);
+    if (nbytes <= read_chunk_size_) {
+      return RandomAccessFile::ReadAsync(io_context, position, nbytes);
+    }
+    // Issue the range requests as IO tasks rather than from SDK threads, so that they
+    // are bounded by the IO thread pool along with the other reads of the file.
+    return internal::ReadAtInChunksAsync(
+        io_context, position, nbytes, read_chunk_size_,
+        [blob_client = blob_client_, chunk_size = read_chunk_size_](
+            int64_t position, int64_t nbytes, uint8_t* out) -> Result<int64_t> {
+          return DownloadRange(*blob_client, position, nbytes, out, chunk_size,
+                               /*concurrency=*/1);
+        });
+  }
+
   Result<int64_t> Read(int64_t nbytes, void* out) override {
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, ReadAt(pos_, nbytes, out));
     pos_ += bytes_read;
@@ -848,6 +883,8 @@ class ObjectInputFile final : public io::RandomAccessFile {
   std::shared_ptr<Blobs::BlobClient> blob_client_;
   const io::IOContext io_context_;
   AzureLocation location_;
+  const int64_t read_chunk_size_;
+  const int32_t read_concurrency_;
 
   bool closed_ = false;
   int64_t pos_ = 0;
@@ -1404,6 +1441,12 @@ class AzureFileSystem::Impl {
  public:
   static Result<std::unique_ptr<AzureFileSystem::Impl>> Make(AzureOptions options,
                                                              io::IOContext io_context) {
+    if (options.read_chunk_size <= 0) {
+      return Status::Invalid("AzureOptions::read_chunk_size must be positive");
+    }
+    if (options.read_concurrency <= 0) {
+      return Status::Invalid("AzureOptions::read_concurrency must be positive");
+    }
     auto self = std::unique_ptr<AzureFileSystem::Impl>(
         new AzureFileSystem::Impl(std::move(options), std::move(io_context)));
     ARROW_ASSIGN_OR_RAISE(self->blob_service_client_,
@@ -1852,7 +1895,7 @@ class AzureFileSystem::Impl {
         GetBlobClient(location.container, location.path));
 
     auto ptr = std::make_shared<ObjectInputFile>(blob_client, fs->io_context(),
-                                                 std::move(location));
+                                                 std::move(location), options_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -1870,8 +1913,8 @@ class AzureFileSystem::Impl {
     auto blob_client = std::make_shared<Blobs::BlobClient>(
         GetBlobClient(location.container, location.path));
 
-    auto ptr = std::make_shared<ObjectInputFile>(blob_client, fs->io_context(),
-                                                 std::move(location), info.size());
+    auto ptr = std::make_shared<ObjectInputFile>(
+        blob_client, fs->io_context(), std::move(location), options_, info.size());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -2922,28 +2965,36 @@ bool AzureFileSystem::Equals(const FileSystem& other) const {
 }
 
 Result<FileInfo> AzureFileSystem::GetFileInfo(const std::string& path) {
-  ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
-  if (location.container.empty()) {
-    DCHECK(location.path.empty());
-    // Root directory of the storage account.
-    return FileInfo{"", FileType::Directory};
-  }
-  if (location.path.empty()) {
-    // We have a container, but no path within the container.
-    // The container itself represents a directory.
-    auto container_client = impl_->GetBlobContainerClient(location.container);
-    return GetContainerPropsAsFileInfo(location, container_client);
-  }
-  return impl_->GetFileInfoOfPathWithinContainer(location);
+  return io::internal::RecordOperation(
+      io_context().metrics().get(), io::IOMetrics::Operation::kGetFileInfo,
+      [&]() -> Result<FileInfo> {
+        ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
+        if (location.container.empty()) {
+          DCHECK(location.path.empty());
+          // Root directory of the storage account.
+          return FileInfo{"", FileType::Directory};
+        }
+        if (location.path.empty()) {
+          // We have a container, but no path within the container.
+          // The container itself represents a directory.
+          auto container_client = impl_->GetBlobContainerClient(location.container);
+          return GetContainerPropsAsFileInfo(location, container_client);
+        }
+        return impl_->GetFileInfoOfPathWithinContainer(location);
+      });
 }
 
 Result<FileInfoVector> AzureFileSystem::GetFileInfo(const FileSelector& select) {
-  Core::Context context;
-  Azure::Nullable<int32_t> page_size_hint;  // unspecified
-  FileInfoVector results;
-  RETURN_NOT_OK(
-      impl_->GetFileInfoWithSelector(context, page_size_hint, select, &results));
-  return {std::move(results)};
+  return io::internal::RecordOperation(
+      io_context().metrics().get(), io::IOMetrics::Operation::kListDir,
+      [&]() -> Result<FileInfoVector> {
+        Core::Context context;
+        Azure::Nullable<int32_t> page_size_hint;  // unspecified
+        FileInfoVector results;
+        RETURN_NOT_OK(
+            impl_->GetFileInfoWithSelector(context, page_size_hint, select, &results));
+        return {std::move(results)};
+      });
 }
 
 Status AzureFileSystem::CreateDir(const std::string& path, bool recursive) {
@@ -3100,36 +3151,54 @@ Status AzureFileSystem::CopyFile(const std::string& src, const std::string& dest
 
 Result<std::shared_ptr<io::InputStream>> AzureFileSystem::OpenInputStream(
     const std::string& path) {
-  ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
-  return impl_->OpenInputFile(location, this);
+  return io::internal::OpenWithMetrics<io::InputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::InputStream>> {
+        ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
+        return impl_->OpenInputFile(location, this);
+      });
 }
 
 Result<std::shared_ptr<io::InputStream>> AzureFileSystem::OpenInputStream(
     const FileInfo& info) {
-  return impl_->OpenInputFile(info, this);
+  return io::internal::OpenWithMetrics<io::InputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::InputStream>> {
+        return impl_->OpenInputFile(info, this);
+      });
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> AzureFileSystem::OpenInputFile(
     const std::string& path) {
-  ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
-  return impl_->OpenInputFile(location, this);
+  return io::internal::OpenWithMetrics<io::RandomAccessFile>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
+        return impl_->OpenInputFile(location, this);
+      });
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> AzureFileSystem::OpenInputFile(
     const FileInfo& info) {
-  return impl_->OpenInputFile(info, this);
+  return io::internal::OpenWithMetrics<io::RandomAccessFile>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        return impl_->OpenInputFile(info, this);
+      });
 }
 
 Result<std::shared_ptr<io::OutputStream>> AzureFileSystem::OpenOutputStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
-  ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
-  return impl_->OpenAppendStream(location, metadata, true, this);
+  return io::internal::OpenWithMetrics<io::OutputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::OutputStream>> {
+        ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
+        return impl_->OpenAppendStream(location, metadata, true, this);
+      });
 }
 
 Result<std::shared_ptr<io::OutputStream>> AzureFileSystem::OpenAppendStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
-  ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
-  return impl_->OpenAppendStream(location, metadata, false, this);
+  return io::internal::OpenWithMetrics<io::OutputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::OutputStream>> {
+        ARROW_ASSIGN_OR_RAISE(auto location, AzureLocation::FromString(path));
+        return impl_->OpenAppendStream(location, metadata, false, this);
+      });
 }
 
 }  // namespace arrow::fs
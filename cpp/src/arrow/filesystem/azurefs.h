@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -99,6 +100,20 @@ struct ARROW_EXPORT AzureOptions {
   /// Default: "https"
   std::string dfs_storage_scheme = "https";
 
+  /// \brief Size of the range requests large reads are split into.
+  ///
+  /// A synchronous read larger than this is downloaded as concurrent range requests,
+  /// up to `read_concurrency` at a time, while ReadAsync() issues them as separate
+  /// tasks on the IO thread pool.
+  ///
+  /// Default: 4 MiB
+  int64_t read_chunk_size = 4 * 1024 * 1024;
+
+  /// \brief Maximum number of concurrent range requests of a synchronous read.
+  ///
+  /// Default: 8
+  int32_t read_concurrency = 8;
+
   // TODO(GH-38598): Add support for more auth methods.
   // std::string connection_string;
   // std::string sas_token;
@@ -51,6 +51,7 @@
 #include "arrow/filesystem/test_util.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/io_util.h"
@@ -2819,6 +2820,44 @@ TEST_F(TestAzuriteFileSystem, OpenInputFileRandomSeek) {
   }
 }
 
+TEST_F(TestAzuriteFileSystem, OpenInputFileReadInChunks) {
+  auto data = SetUpPreexistingData();
+  auto constexpr kLineWidth = 100;
+  auto constexpr kLineCount = 128;
+  std::vector<std::string> lines(kLineCount);
+  int lineno = 0;
+  std::generate_n(lines.begin(), lines.size(), [&] {
+    return PreexistingData::RandomLine(++lineno, kLineWidth, rng_);
+  });
+  std::string contents;
+  for (const auto& line : lines) {
+    contents += line;
+  }
+  const auto path = data.ContainerPath("OpenInputFileReadInChunks/object-name");
+  UploadLines(lines, path, kLineCount * kLineWidth);
+
+  auto options = options_;
+  options.read_chunk_size = 1000;
+  options.read_concurrency = 3;
+  ASSERT_OK_AND_ASSIGN(auto fs, AzureFileSystem::Make(options));
+  ASSERT_OK_AND_ASSIGN(auto file, fs->OpenInputFile(path));
+  // Smaller than a chunk, several chunks with a partial one, and past the end
+  for (auto range : {std::make_pair(150, 700), std::make_pair(50, 4321),
+                     std::make_pair(10000, 5000)}) {
+    auto expected = contents.substr(range.first, range.second);
+    ASSERT_OK_AND_ASSIGN(auto actual, file->ReadAt(range.first, range.second));
+    EXPECT_EQ(expected, actual->ToString());
+    ASSERT_FINISHES_OK_AND_ASSIGN(actual, file->ReadAsync(range.first, range.second));
+    EXPECT_EQ(expected, actual->ToString());
+  }
+
+  options.read_chunk_size = 0;
+  ASSERT_RAISES(Invalid, AzureFileSystem::Make(options));
+  options.read_chunk_size = 1000;
+  options.read_concurrency = 0;
+  ASSERT_RAISES(Invalid, AzureFileSystem::Make(options));
+}
+
 TEST_F(TestAzuriteFileSystem, OpenInputFileIoContext) {
   auto data = SetUpPreexistingData();
   // Create a test file.
@@ -0,0 +1,526 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachingfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/filesystem/util_internal.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace fs {
+
+namespace {
+
+constexpr char kBlockExtension[] = ".block";
+
+}  // namespace
+
+bool CachingFileSystemOptions::Equals(const CachingFileSystemOptions& other) const {
+  return cache_dir == other.cache_dir && capacity == other.capacity &&
+         block_size == other.block_size;
+}
+
+// The blocks stored in the cache directory, evicted in LRU order.
+//
+// Each block is stored in its own file named after a hash of its key.  The file
+// starts with the key itself so that hash collisions are detected.
+class CachingFileSystem::BlockCache {
+ public:
+  explicit BlockCache(CachingFileSystemOptions options)
+      : options_(std::move(options)),
+        local_fs_(std::make_shared<LocalFileSystem>()),
+        tmp_prefix_(".tmp" + std::to_string(::arrow::internal::GetRandomSeed())) {}
+
+  Status Init() {
+    RETURN_NOT_OK(local_fs_->CreateDir(options_.cache_dir, /*recursive=*/true));
+    FileSelector selector;
+    selector.base_dir = options_.cache_dir;
+    ARROW_ASSIGN_OR_RAISE(auto infos, local_fs_->GetFileInfo(selector));
+    // Adopt the blocks left in the directory, evicting the oldest first
+    std::sort(infos.begin(), infos.end(), [](const FileInfo& l, const FileInfo& r) {
+      return l.mtime() < r.mtime();
+    });
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (const auto& info : infos) {
+        if (info.IsFile() && info.extension() == &kBlockExtension[1]) {
+          InsertLocked(info.base_name(), info.size());
+        }
+      }
+      evicted = EvictLocked();
+    }
+    DeleteBlocks(evicted);
+    return Status::OK();
+  }
+
+  int64_t total_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_bytes_;
+  }
+
+  // Return the block with the given key, calling `fetch` if it is not cached.
+  // Concurrent calls for a block not cached yet share a single fetch.
+  Result<std::shared_ptr<Buffer>> GetBlock(
+      const std::string& key,
+      const std::function<Result<std::shared_ptr<Buffer>>()>& fetch) {
+    const std::string name = BlockName(key);
+    Future<std::shared_ptr<Buffer>> fetched;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto it = entries_.find(name);
+      if (it != entries_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        lock.unlock();
+        // The block may have been evicted in the meantime, fetch it again if so
+        auto maybe_block = ReadBlock(name, key);
+        if (maybe_block.ok()) return maybe_block;
+        lock.lock();
+      }
+      auto inflight_it = inflight_.find(key);
+      if (inflight_it != inflight_.end()) {
+        auto other_fetch = inflight_it->second;
+        lock.unlock();
+        return other_fetch.result();
+      }
+      fetched = Future<std::shared_ptr<Buffer>>::Make();
+      inflight_.emplace(key, fetched);
+    }
+
+    auto maybe_block = fetch();
+    if (maybe_block.ok()) {
+      // Caching is best effort, the block was fetched anyway
+      auto status = StoreBlock(name, key, **maybe_block);
+      if (!status.ok()) {
+        ARROW_LOG(WARNING) << "Failed to cache block: " << status.ToString();
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      inflight_.erase(key);
+    }
+    fetched.MarkFinished(maybe_block);
+    return maybe_block;
+  }
+
+ private:
+  struct Entry {
+    int64_t size;
+    std::list<std::string>::iterator lru_it;
+  };
+
+  static std::string BlockName(const std::string& key) {
+    const uint64_t hashes[2] = {
+        ::arrow::internal::ComputeStringHash<0>(key.data(), key.size()),
+        ::arrow::internal::ComputeStringHash<1>(key.data(), key.size())};
+    return ::arrow::HexEncode(reinterpret_cast<const uint8_t*>(hashes),
+                                        sizeof(hashes)) +
+           kBlockExtension;
+  }
+
+  std::string BlockPath(const std::string& name) const {
+    return internal::ConcatAbstractPath(options_.cache_dir, name);
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadBlock(const std::string& name,
+                                            const std::string& key) {
+    ARROW_ASSIGN_OR_RAISE(auto file, local_fs_->OpenInputFile(BlockPath(name)));
+    ARROW_ASSIGN_OR_RAISE(auto size, file->GetSize());
+    ARROW_ASSIGN_OR_RAISE(auto contents, file->ReadAt(0, size));
+    RETURN_NOT_OK(file->Close());
+    int64_t key_length = -1;
+    if (contents->size() >= static_cast<int64_t>(sizeof(key_length))) {
+      std::memcpy(&key_length, contents->data(), sizeof(key_length));
+    }
+    const int64_t data_offset = sizeof(key_length) + key_length;
+    if (key_length != static_cast<int64_t>(key.size()) ||
+        contents->size() < data_offset ||
+        std::memcmp(contents->data() + sizeof(key_length), key.data(), key.size()) !=
+            0) {
+      return Status::IOError("Cached block '", name, "' does not hold the expected key");
+    }
+    return SliceBuffer(std::move(contents), data_offset);
+  }
+
+  Status StoreBlock(const std::string& name, const std::string& key,
+                    const Buffer& data) {
+    // Write to a temporary file first so that readers, possibly in other
+    // processes, never see a partial block
+    const std::string path = BlockPath(name);
+    const std::string tmp_path = path + tmp_prefix_ + std::to_string(++tmp_counter_);
+    {
+      ARROW_ASSIGN_OR_RAISE(auto out, local_fs_->OpenOutputStream(tmp_path));
+      const int64_t key_length = static_cast<int64_t>(key.size());
+      RETURN_NOT_OK(out->Write(&key_length, sizeof(key_length)));
+      RETURN_NOT_OK(out->Write(key));
+      RETURN_NOT_OK(out->Write(data.data(), data.size()));
+      RETURN_NOT_OK(out->Close());
+    }
+    RETURN_NOT_OK(local_fs_->Move(tmp_path, path));
+
+    std::vector<std::string> evicted;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      InsertLocked(name, sizeof(int64_t) + key.size() + data.size());
+      evicted = EvictLocked();
+    }
+    DeleteBlocks(evicted);
+    return Status::OK();
+  }
+
+  void InsertLocked(const std::string& name, int64_t size) {
+    auto it = entries_.find(name);
+    if (it != entries_.end()) {
+      total_bytes_ += size - it->second.size;
+      it->second.size = size;
+      lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+      return;
+    }
+    lru_.push_front(name);
+    entries_.emplace(name, Entry{size, lru_.begin()});
+    total_bytes_ += size;
+  }
+
+  std::vector<std::string> EvictLocked() {
+    std::vector<std::string> evicted;
+    while (total_bytes_ > options_.capacity && !lru_.empty()) {
+      auto it = entries_.find(lru_.back());
+      total_bytes_ -= it->second.size;
+      evicted.push_back(std::move(lru_.back()));
+      entries_.erase(it);
+      lru_.pop_back();
+    }
+    return evicted;
+  }
+
+  void DeleteBlocks(const std::vector<std::string>& names) {
+    for (const auto& name : names) {
+      // Another cache may have deleted it already
+      ARROW_UNUSED(local_fs_->DeleteFile(BlockPath(name)));
+    }
+  }
+
+  const CachingFileSystemOptions options_;
+  const std::shared_ptr<LocalFileSystem> local_fs_;
+  const std::string tmp_prefix_;
+  std::atomic<int64_t> tmp_counter_{0};
+
+  mutable std::mutex mutex_;
+  // Most recently used first
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, Entry> entries_;
+  std::unordered_map<std::string, Future<std::shared_ptr<Buffer>>> inflight_;
+  int64_t total_bytes_ = 0;
+};
+
+// A file whose reads are served by the block cache, opening the base file only
+// when a block must be fetched
+class CachingFileSystem::CachedFile : public io::RandomAccessFile {
+ public:
+  CachedFile(std::shared_ptr<FileSystem> base_fs, FileInfo info,
+             std::shared_ptr<BlockCache> cache, int64_t block_size)
+      : base_fs_(std::move(base_fs)),
+        info_(std::move(info)),
+        cache_(std::move(cache)),
+        block_size_(block_size) {
+    // NUL cannot appear in paths, so keys cannot be ambiguous
+    key_prefix_ = info_.path();
+    key_prefix_ += '\0';
+    key_prefix_ += std::to_string(info_.size());
+    key_prefix_ += '\0';
+    key_prefix_ += std::to_string(info_.mtime().time_since_epoch().count());
+    key_prefix_ += '\0';
+  }
+
+  Status Close() override {
+    closed_ = true;
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ != nullptr) {
+      auto status = base_file_->Close();
+      base_file_.reset();
+      return status;
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return position_;
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Cannot seek to negative position");
+    }
+    position_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return info_.size();
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    if (position_ >= info_.size()) {
+      RETURN_NOT_OK(CheckClosed());
+      return 0;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read, ReadAt(position_, nbytes, out));
+    position_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    if (position_ >= info_.size()) {
+      RETURN_NOT_OK(CheckClosed());
+      return std::make_shared<Buffer>(nullptr, 0);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(position_, nbytes));
+    position_ += buffer->size();
+    return buffer;
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, info_.size()));
+    auto dest = static_cast<uint8_t*>(out);
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      const int64_t offset = position + bytes_read;
+      ARROW_ASSIGN_OR_RAISE(auto block, GetBlock(offset / block_size_));
+      const int64_t offset_in_block = offset % block_size_;
+      const int64_t length =
+          std::min(nbytes - bytes_read, block->size() - offset_in_block);
+      std::memcpy(dest + bytes_read, block->data() + offset_in_block, length);
+      bytes_read += length;
+    }
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    ARROW_ASSIGN_OR_RAISE(nbytes,
+                          io::internal::ValidateReadRange(position, nbytes, info_.size()));
+    if (nbytes > 0 && position / block_size_ == (position + nbytes - 1) / block_size_) {
+      // Within a single block, no copy needed
+      ARROW_ASSIGN_OR_RAISE(auto block, GetBlock(position / block_size_));
+      return SliceBuffer(std::move(block), position % block_size_, nbytes);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(nbytes));
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                          ReadAt(position, nbytes, buffer->mutable_data()));
+    DCHECK_EQ(bytes_read, nbytes);
+    return std::shared_ptr<Buffer>(std::move(buffer));
+  }
+
+ private:
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<io::RandomAccessFile>> BaseFile() {
+    std::lock_guard<std::mutex> lock(base_file_mutex_);
+    if (base_file_ == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(base_file_, base_fs_->OpenInputFile(info_));
+    }
+    return base_file_;
+  }
+
+  Result<std::shared_ptr<Buffer>> GetBlock(int64_t index) {
+    const int64_t offset = index * block_size_;
+    const int64_t length = std::min(block_size_, info_.size() - offset);
+    return cache_->GetBlock(
+        key_prefix_ + std::to_string(index),
+        [&]() -> Result<std::shared_ptr<Buffer>> {
+          ARROW_ASSIGN_OR_RAISE(auto file, BaseFile());
+          ARROW_ASSIGN_OR_RAISE(auto block, file->ReadAt(offset, length));
+          if (block->size() != length) {
+            return Status::IOError("File '", info_.path(),
+                                   "' changed while it was being read");
+          }
+          return block;
+        });
+  }
+
+  const std::shared_ptr<FileSystem> base_fs_;
+  const FileInfo info_;
+  const std::shared_ptr<BlockCache> cache_;
+  const int64_t block_size_;
+  std::string key_prefix_;
+
+  std::atomic<bool> closed_{false};
+  int64_t position_ = 0;
+  std::mutex base_file_mutex_;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+};
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     CachingFileSystemOptions options,
+                                     std::shared_ptr<BlockCache> cache)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      options_(std::move(options)),
+      cache_(std::move(cache)) {}
+
+CachingFileSystem::~CachingFileSystem() = default;
+
+Result<std::shared_ptr<CachingFileSystem>> CachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, CachingFileSystemOptions options) {
+  if (options.cache_dir.empty()) {
+    return Status::Invalid("CachingFileSystem requires a cache directory");
+  }
+  if (options.block_size <= 0) {
+    return Status::Invalid("CachingFileSystem block size must be positive, got ",
+                           options.block_size);
+  }
+  auto cache = std::make_shared<BlockCache>(options);
+  RETURN_NOT_OK(cache->Init());
+  return std::shared_ptr<CachingFileSystem>(
+      new CachingFileSystem(std::move(base_fs), std::move(options), std::move(cache)));
+}
+
+bool CachingFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& caching = checked_cast<const CachingFileSystem&>(other);
+  return options_.Equals(caching.options_) && base_fs_->Equals(caching.base_fs_);
+}
+
+Result<std::string> CachingFileSystem::PathFromUri(const std::string& uri_string) const {
+  return base_fs_->PathFromUri(uri_string);
+}
+
+int64_t CachingFileSystem::cached_bytes() const { return cache_->total_bytes(); }
+
+Result<FileInfo> CachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<FileInfoVector> CachingFileSystem::GetFileInfo(const FileSelector& selector) {
+  return base_fs_->GetFileInfo(selector);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path,
+                                            bool missing_dir_ok) {
+  return base_fs_->DeleteDirContents(path, missing_dir_ok);
+}
+
+Status CachingFileSystem::DeleteRootDirContents() {
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  return OpenInputFile(path);
+}
+
+Result<std::shared_ptr<io::InputStream>> CachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto info, base_fs_->GetFileInfo(path));
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> CachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  FileInfo file_info = info;
+  // The size and mtime are part of the cache keys
+  if (file_info.size() == kNoSize || file_info.mtime() == kNoTime) {
+    ARROW_ASSIGN_OR_RAISE(file_info, base_fs_->GetFileInfo(info.path()));
+  }
+  if (file_info.type() == FileType::NotFound) {
+    return internal::PathNotFound(file_info.path());
+  }
+  if (file_info.type() != FileType::File) {
+    return internal::NotAFile(file_info.path());
+  }
+  return std::make_shared<CachedFile>(base_fs_, std::move(file_info), cache_,
+                                      options_.block_size);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenOutputStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenOutputStream(path, metadata);
+}
+
+Result<std::shared_ptr<io::OutputStream>> CachingFileSystem::OpenAppendStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenAppendStream(path, metadata);
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for the CachingFileSystem implementation.
+struct ARROW_EXPORT CachingFileSystemOptions {
+  static constexpr int64_t kDefaultCapacity = int64_t(1) << 30;   // 1 GiB
+  static constexpr int64_t kDefaultBlockSize = int64_t(1) << 20;  // 1 MiB
+
+  /// Local directory holding the cached data, created if it does not exist.
+  ///
+  /// Blocks already in the directory, for example from a previous process, are
+  /// reused.  Several caches may share a directory, though each only accounts
+  /// for the blocks it knows of when enforcing its capacity.
+  std::string cache_dir;
+
+  /// The number of bytes of cached data above which the least recently used
+  /// blocks are evicted.
+  int64_t capacity = kDefaultCapacity;
+
+  /// The granularity of caching: reads fetch and cache the aligned blocks of
+  /// this size covering the requested range.
+  int64_t block_size = kDefaultBlockSize;
+
+  bool Equals(const CachingFileSystemOptions& other) const;
+};
+
+/// \brief A FileSystem wrapper caching the data read from another filesystem
+/// on local disk.
+///
+/// Files opened for reading fetch the blocks of the base file covering each
+/// requested range, store them in the cache directory, and serve subsequent
+/// reads of these blocks from there.  Only the blocks actually read are
+/// cached, not whole files.  Concurrent reads of a block not yet cached fetch
+/// it only once.
+///
+/// Blocks are keyed by path, size and modification time, so that a file
+/// rewritten in the base filesystem is not served stale.  Filesystems which do
+/// not report modification times are assumed to only rewrite files with a
+/// different size.  All other operations are forwarded to the base filesystem.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  static Result<std::shared_ptr<CachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, CachingFileSystemOptions options);
+
+  std::string type_name() const override { return "caching"; }
+  bool Equals(const FileSystem& other) const override;
+  Result<std::string> PathFromUri(const std::string& uri_string) const override;
+
+  const std::shared_ptr<FileSystem>& base_fs() const { return base_fs_; }
+  const CachingFileSystemOptions& options() const { return options_; }
+
+  /// The number of bytes of data currently cached
+  int64_t cached_bytes() const;
+
+  /// \cond FALSE
+  using FileSystem::CreateDir;
+  using FileSystem::DeleteDirContents;
+  using FileSystem::GetFileInfo;
+  using FileSystem::OpenAppendStream;
+  using FileSystem::OpenOutputStream;
+  /// \endcond
+
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path, bool missing_dir_ok) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+
+ private:
+  class BlockCache;
+  class CachedFile;
+
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs, CachingFileSystemOptions options,
+                    std::shared_ptr<BlockCache> cache);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<BlockCache> cache_;
+};
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/cachingfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow::fs {
+
+using ::arrow::internal::TemporaryDir;
+
+class TestCachingFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_, TemporaryDir::Make("cachingfs-test-"));
+    // MockFileSystem gives all files the same mtime, so only a size change
+    // invalidates cached blocks
+    base_fs_ =
+        std::make_shared<internal::MockFileSystem>(TimePoint(TimePoint::duration(42)));
+    options_.cache_dir = temp_dir_->path().ToString() + "cache";
+    options_.block_size = 4;
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK_AND_ASSIGN(fs_, CachingFileSystem::Make(base_fs_, options_));
+  }
+
+  std::string ReadAll(const std::string& path) {
+    std::shared_ptr<io::RandomAccessFile> file;
+    ARROW_EXPECT_OK(fs_->OpenInputFile(path).Value(&file));
+    auto size = file->GetSize().ValueOrDie();
+    return file->ReadAt(0, size).ValueOrDie()->ToString();
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::shared_ptr<FileSystem> base_fs_;
+  CachingFileSystemOptions options_;
+  std::shared_ptr<CachingFileSystem> fs_;
+};
+
+TEST_F(TestCachingFileSystem, Make) {
+  options_.cache_dir = "";
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options_));
+  options_.cache_dir = temp_dir_->path().ToString();
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(base_fs_, options_));
+}
+
+TEST_F(TestCachingFileSystem, ServesCachedBlocks) {
+  MakeFileSystem();
+  CreateFile(base_fs_.get(), "a", "0123456789");
+  ASSERT_EQ(ReadAll("a"), "0123456789");
+  // Each block is stored after its key length and key
+  ASSERT_EQ(fs_->cached_bytes(), 3 * (8 + 9) + 10);
+
+  // Same size and mtime: the cached blocks are served
+  CreateFile(base_fs_.get(), "a", "abcdefghij");
+  ASSERT_EQ(ReadAll("a"), "0123456789");
+
+  // Different size: the file is read again
+  CreateFile(base_fs_.get(), "a", "abcdefghijk");
+  ASSERT_EQ(ReadAll("a"), "abcdefghijk");
+
+  // Blocks survive the filesystem
+  CreateFile(base_fs_.get(), "a", "ABCDEFGHIJK");
+  MakeFileSystem();
+  ASSERT_EQ(ReadAll("a"), "abcdefghijk");
+}
+
+TEST_F(TestCachingFileSystem, Reads) {
+  MakeFileSystem();
+  CreateFile(base_fs_.get(), "a", "0123456789");
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("a"));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(5, 2));
+  AssertBufferEqual(*buffer, "56");
+  ASSERT_OK_AND_ASSIGN(buffer, file->ReadAt(2, 7));
+  AssertBufferEqual(*buffer, "2345678");
+  ASSERT_OK_AND_ASSIGN(buffer, file->ReadAt(8, 10));
+  AssertBufferEqual(*buffer, "89");
+  ASSERT_RAISES(IOError, file->ReadAt(11, 1));
+
+  ASSERT_OK(file->Seek(7));
+  ASSERT_OK_AND_ASSIGN(buffer, file->Read(2));
+  AssertBufferEqual(*buffer, "78");
+  char out[4];
+  ASSERT_OK_AND_EQ(2, file->Read(4, out));
+  ASSERT_EQ(std::string(out, 2), "9");
+  ASSERT_OK_AND_EQ(0, file->Read(4, out));
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 1));
+
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("a"));
+  ASSERT_OK_AND_ASSIGN(buffer, stream->Read(100));
+  AssertBufferEqual(*buffer, "0123456789");
+
+  ASSERT_OK(base_fs_->CreateDir("dir"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("dir"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("missing"));
+}
+
+TEST_F(TestCachingFileSystem, ConcurrentReads) {
+  MakeFileSystem();
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    data += static_cast<char>('a' + i % 26);
+  }
+  CreateFile(base_fs_.get(), "a", data);
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("a"));
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 8; ++i) {
+    threads.emplace_back([&, i] {
+      for (int64_t offset = i; offset < 990; offset += 7) {
+        auto buffer = file->ReadAt(offset, 10).ValueOrDie();
+        ASSERT_EQ(buffer->ToString(), data.substr(offset, 10));
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+TEST_F(TestCachingFileSystem, Eviction) {
+  // Room for a single block with its key
+  options_.capacity = 30;
+  MakeFileSystem();
+  CreateFile(base_fs_.get(), "a", "0123");
+  CreateFile(base_fs_.get(), "b", "4567");
+  ASSERT_EQ(ReadAll("a"), "0123");
+  ASSERT_EQ(ReadAll("b"), "4567");
+  ASSERT_LE(fs_->cached_bytes(), options_.capacity);
+
+  CreateFile(base_fs_.get(), "a", "abcd");
+  CreateFile(base_fs_.get(), "b", "efgh");
+  ASSERT_EQ(ReadAll("a"), "abcd");
+  ASSERT_EQ(ReadAll("b"), "efgh");
+}
+
+TEST_F(TestCachingFileSystem, ForwardsOperations) {
+  MakeFileSystem();
+  ASSERT_OK(fs_->CreateDir("dir/sub"));
+  CreateFile(fs_.get(), "dir/a", "data");
+  ASSERT_OK(fs_->CopyFile("dir/a", "dir/b"));
+  ASSERT_OK(fs_->Move("dir/b", "dir/sub/c"));
+  AssertFileInfo(base_fs_.get(), "dir/sub/c", FileType::File, 4);
+  AssertFileInfo(fs_.get(), "dir/sub/c", FileType::File, 4);
+  ASSERT_OK(fs_->DeleteFile("dir/sub/c"));
+  AssertFileInfo(base_fs_.get(), "dir/sub/c", FileType::NotFound);
+
+  ASSERT_OK_AND_ASSIGN(auto other, CachingFileSystem::Make(base_fs_, options_));
+  ASSERT_TRUE(fs_->Equals(*other));
+  options_.block_size = 8;
+  ASSERT_OK_AND_ASSIGN(other, CachingFileSystem::Make(base_fs_, options_));
+  ASSERT_FALSE(fs_->Equals(*other));
+  ASSERT_FALSE(fs_->Equals(*base_fs_));
+}
+
+}  // namespace arrow::fs
@@ -25,10 +25,12 @@
 #include "arrow/filesystem/gcsfs_internal.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/io/metrics.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/thread_pool.h"
+#include "arrow/util/value_parsing.h"
 
 #define ARROW_GCS_RETURN_NOT_OK(expr) \
   if (!expr.ok()) return internal::ToArrowStatus(expr)
@@ -242,8 +244,11 @@ using InputStreamFactory = std::function<Result<std::shared_ptr<GcsInputStream>>
 
 class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
  public:
-  GcsRandomAccessFile(InputStreamFactory factory, gcs::ObjectMetadata metadata)
-      : factory_(std::move(factory)), metadata_(std::move(metadata)) {}
+  GcsRandomAccessFile(InputStreamFactory factory, gcs::ObjectMetadata metadata,
+                      int64_t read_chunk_size)
+      : factory_(std::move(factory)),
+        metadata_(std::move(metadata)),
+        read_chunk_size_(read_chunk_size) {}
   ~GcsRandomAccessFile() override = default;
 
   //@{
@@ -305,6 +310,26 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
                                            gcs::ReadFromOffset()));
     return stream->Read(nbytes);
   }
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    if (closed()) return Status::Invalid("Cannot read from closed file");
+    const auto size = static_cast<int64_t>(metadata_.size());
+    if (read_chunk_size_ <= 0 || position < 0 || position >= size ||
+        std::min(nbytes, size - position) <= read_chunk_size_) {
+      return RandomAccessFile::ReadAsync(io_context, position, nbytes);
+    }
+    // Each chunk is a separate ranged download of the generation being read
+    return internal::ReadAtInChunksAsync(
+        io_context, position, std::min(nbytes, size - position), read_chunk_size_,
+        [factory = factory_, generation = metadata_.generation()](
+            int64_t position, int64_t nbytes, uint8_t* out) -> Result<int64_t> {
+          ARROW_ASSIGN_OR_RAISE(auto stream,
+                                factory(gcs::Generation(generation),
+                                        gcs::ReadRange(position, position + nbytes),
+                                        gcs::ReadFromOffset()));
+          return stream->Read(nbytes, out);
+        });
+  }
   //@}
 
   // from Seekable
@@ -326,6 +351,7 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   }
   InputStreamFactory factory_;
   gcs::ObjectMetadata metadata_;
+  const int64_t read_chunk_size_;
   std::shared_ptr<GcsInputStream> mutable stream_;
 };
 
@@ -708,7 +734,8 @@ bool GcsOptions::Equals(const GcsOptions& other) const {
          endpoint_override == other.endpoint_override && scheme == other.scheme &&
          default_bucket_location == other.default_bucket_location &&
          retry_limit_seconds == other.retry_limit_seconds &&
-         project_id == other.project_id;
+         project_id == other.project_id && read_chunk_size == other.read_chunk_size &&
+         connection_pool_size == other.connection_pool_size;
 }
 
 GcsOptions GcsOptions::Defaults() {
@@ -814,6 +841,24 @@ Result<GcsOptions> GcsOptions::FromUri(const arrow::util::Uri& uri,
       options.retry_limit_seconds = parsed_seconds;
     } else if (kv.first == "project_id") {
       options.project_id = kv.second;
+    } else if (kv.first == "read_chunk_size") {
+      int64_t read_chunk_size;
+      if (!::arrow::internal::ParseValue<Int64Type>(kv.second.data(), kv.second.size(),
+                                                    &read_chunk_size)) {
+        return Status::Invalid("read_chunk_size must be an integer, got '", kv.second,
+                               "'");
+      }
+      options.read_chunk_size = read_chunk_size;
+    } else if (kv.first == "connection_pool_size") {
+      int connection_pool_size;
+      if (!::arrow::internal::ParseValue<Int32Type>(kv.second.data(), kv.second.size(),
+                                                    &connection_pool_size) ||
+          connection_pool_size < 0) {
+        return Status::Invalid(
+            "connection_pool_size must be a non-negative integer, got '", kv.second,
+            "'");
+      }
+      options.connection_pool_size = connection_pool_size;
     } else {
       return Status::Invalid("Unexpected query parameter in GCS URI: '", kv.first, "'");
     }
@@ -850,12 +895,18 @@ Result<std::string> GcsFileSystem::PathFromUri(const std::string& uri_string) co
 }
 
 Result<FileInfo> GcsFileSystem::GetFileInfo(const std::string& path) {
-  ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
-  return impl_->GetFileInfo(p);
+  return io::internal::RecordOperation(
+      io_context().metrics().get(), io::IOMetrics::Operation::kGetFileInfo,
+      [&]() -> Result<FileInfo> {
+        ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
+        return impl_->GetFileInfo(p);
+      });
 }
 
 Result<FileInfoVector> GcsFileSystem::GetFileInfo(const FileSelector& select) {
-  return impl_->GetFileInfo(select);
+  return io::internal::RecordOperation(
+      io_context().metrics().get(), io::IOMetrics::Operation::kListDir,
+      [&]() -> Result<FileInfoVector> { return impl_->GetFileInfo(select); });
 }
 
 Status GcsFileSystem::CreateDir(const std::string& path, bool recursive) {
@@ -899,62 +950,79 @@ Status GcsFileSystem::CopyFile(const std::string& src, const std::string& dest)
 
 Result<std::shared_ptr<io::InputStream>> GcsFileSystem::OpenInputStream(
     const std::string& path) {
-  ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(path));
-  ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
-  return impl_->OpenInputStream(p, gcs::Generation(), gcs::ReadRange(),
-                                gcs::ReadFromOffset());
+  return io::internal::OpenWithMetrics<io::InputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::InputStream>> {
+        ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(path));
+        ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
+        return impl_->OpenInputStream(p, gcs::Generation(), gcs::ReadRange(),
+                                      gcs::ReadFromOffset());
+      });
 }
 
 Result<std::shared_ptr<io::InputStream>> GcsFileSystem::OpenInputStream(
     const FileInfo& info) {
-  if (info.IsDirectory()) {
-    return Status::IOError("Cannot open directory '", info.path(),
-                           "' as an input stream");
-  }
-  ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(info.path()));
-  ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(info.path()));
-  return impl_->OpenInputStream(p, gcs::Generation(), gcs::ReadRange(),
-                                gcs::ReadFromOffset());
+  return io::internal::OpenWithMetrics<io::InputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::InputStream>> {
+        if (info.IsDirectory()) {
+          return Status::IOError("Cannot open directory '", info.path(),
+                                 "' as an input stream");
+        }
+        ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(info.path()));
+        ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(info.path()));
+        return impl_->OpenInputStream(p, gcs::Generation(), gcs::ReadRange(),
+                                      gcs::ReadFromOffset());
+      });
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
     const std::string& path) {
-  ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(path));
-  ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
-  auto metadata = impl_->GetObjectMetadata(p);
-  ARROW_GCS_RETURN_NOT_OK(metadata.status());
-  auto open_stream = [impl = impl_, p](gcs::Generation g, gcs::ReadRange range,
-                                       gcs::ReadFromOffset offset) {
-    return impl->OpenInputStream(p, g, range, offset);
-  };
-
-  return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
-                                               *std::move(metadata));
+  return io::internal::OpenWithMetrics<io::RandomAccessFile>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(path));
+        ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
+        auto metadata = impl_->GetObjectMetadata(p);
+        ARROW_GCS_RETURN_NOT_OK(metadata.status());
+        auto open_stream = [impl = impl_, p](gcs::Generation g, gcs::ReadRange range,
+                                             gcs::ReadFromOffset offset) {
+          return impl->OpenInputStream(p, g, range, offset);
+        };
+
+        return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
+                                                     *std::move(metadata),
+                                                     impl_->options().read_chunk_size);
+      });
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
     const FileInfo& info) {
-  if (info.IsDirectory()) {
-    return Status::IOError("Cannot open directory '", info.path(),
-                           "' as an input stream");
-  }
-  ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(info.path()));
-  ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(info.path()));
-  auto metadata = impl_->GetObjectMetadata(p);
-  ARROW_GCS_RETURN_NOT_OK(metadata.status());
-  auto open_stream = [impl = impl_, p](gcs::Generation g, gcs::ReadRange range,
-                                       gcs::ReadFromOffset offset) {
-    return impl->OpenInputStream(p, g, range, offset);
-  };
-  return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
-                                               *std::move(metadata));
+  return io::internal::OpenWithMetrics<io::RandomAccessFile>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        if (info.IsDirectory()) {
+          return Status::IOError("Cannot open directory '", info.path(),
+                                 "' as an input stream");
+        }
+        ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(info.path()));
+        ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(info.path()));
+        auto metadata = impl_->GetObjectMetadata(p);
+        ARROW_GCS_RETURN_NOT_OK(metadata.status());
+        auto open_stream = [impl = impl_, p](gcs::Generation g, gcs::ReadRange range,
+                                             gcs::ReadFromOffset offset) {
+          return impl->OpenInputStream(p, g, range, offset);
+        };
+        return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
+                                                     *std::move(metadata),
+                                                     impl_->options().read_chunk_size);
+      });
 }
 
 Result<std::shared_ptr<io::OutputStream>> GcsFileSystem::OpenOutputStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
-  ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(path));
-  ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
-  return impl_->OpenOutputStream(p, metadata);
+  return io::internal::OpenWithMetrics<io::OutputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::OutputStream>> {
+        ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(path));
+        ARROW_ASSIGN_OR_RAISE(auto p, GcsPath::FromString(path));
+        return impl_->OpenOutputStream(p, metadata);
+      });
 }
 
 Result<std::shared_ptr<io::OutputStream>> GcsFileSystem::OpenAppendStream(
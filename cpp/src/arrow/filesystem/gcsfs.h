@@ -90,6 +90,20 @@ struct ARROW_EXPORT GcsOptions {
   /// that create new buckets need a project id.
   std::optional<std::string> project_id;
 
+  /// \brief Size of the ranged downloads ReadAsync() splits large reads into.
+  ///
+  /// The downloads are issued concurrently on the IO thread pool.  A non-positive
+  /// value disables splitting.
+  ///
+  /// Default: 8 MiB
+  int64_t read_chunk_size = 8 * 1024 * 1024;
+
+  /// \brief Maximum number of idle HTTP connections kept open for reuse.
+  ///
+  /// Concurrent reads beyond this number open short-lived connections.  If not set,
+  /// the client library default is used.
+  std::optional<int> connection_pool_size;
+
   bool Equals(const GcsOptions& other) const;
 
   /// \brief Initialize with Google Default Credentials
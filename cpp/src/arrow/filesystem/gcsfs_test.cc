@@ -53,6 +53,7 @@
 #include "arrow/filesystem/gcsfs_internal.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/testing/util.h"
@@ -375,7 +376,8 @@ TEST(GcsFileSystem, OptionsFromUri) {
       GcsOptions::FromUri("gs://mybucket/foo/bar/"
                           "?endpoint_override=localhost&scheme=http&location=us-west2"
                           "&retry_limit_seconds=40.5"
-                          "&project_id=test-project-id",
+                          "&project_id=test-project-id"
+                          "&read_chunk_size=1048576&connection_pool_size=16",
                           &path));
   EXPECT_EQ(options.default_bucket_location, "us-west2");
   EXPECT_EQ(options.scheme, "http");
@@ -385,6 +387,9 @@ TEST(GcsFileSystem, OptionsFromUri) {
   EXPECT_EQ(*options.retry_limit_seconds, 40.5);
   ASSERT_TRUE(options.project_id.has_value());
   EXPECT_EQ(*options.project_id, "test-project-id");
+  EXPECT_EQ(options.read_chunk_size, 1048576);
+  ASSERT_TRUE(options.connection_pool_size.has_value());
+  EXPECT_EQ(*options.connection_pool_size, 16);
 
   // Missing bucket name
   ASSERT_RAISES(Invalid, GcsOptions::FromUri("gs:///foo/bar/", &path));
@@ -397,6 +402,11 @@ TEST(GcsFileSystem, OptionsFromUri) {
                 GcsOptions::FromUri("gs://foo/bar/?retry_limit_seconds=0", &path));
   ASSERT_RAISES(Invalid,
                 GcsOptions::FromUri("gs://foo/bar/?retry_limit_seconds=-1", &path));
+
+  // Invalid read options
+  ASSERT_RAISES(Invalid, GcsOptions::FromUri("gs://foo/bar/?read_chunk_size=x", &path));
+  ASSERT_RAISES(Invalid,
+                GcsOptions::FromUri("gs://foo/bar/?connection_pool_size=-1", &path));
 }
 
 TEST(GcsFileSystem, OptionsAccessToken) {
@@ -452,23 +462,27 @@ TEST(GcsFileSystem, OptionsAsGoogleCloudOptions) {
   a.default_bucket_location = "us-central1";
   a.retry_limit_seconds = 40.5;
   a.project_id = "test-only-invalid-project-id";
+  a.connection_pool_size = 32;
 
   auto const o1 = internal::AsGoogleCloudOptions(a);
   EXPECT_TRUE(o1.has<google::cloud::UnifiedCredentialsOption>());
   EXPECT_TRUE(o1.has<gcs::RetryPolicyOption>());
   EXPECT_EQ(o1.get<gcs::RestEndpointOption>(), "http://localhost:8080");
   EXPECT_EQ(o1.get<gcs::ProjectIdOption>(), "test-only-invalid-project-id");
+  EXPECT_EQ(o1.get<gcs::ConnectionPoolSizeOption>(), 32);
 
   a.scheme.clear();
   a.endpoint_override.clear();
   a.retry_limit_seconds.reset();
   a.project_id.reset();
+  a.connection_pool_size.reset();
 
   auto const o2 = internal::AsGoogleCloudOptions(a);
   EXPECT_TRUE(o2.has<google::cloud::UnifiedCredentialsOption>());
   EXPECT_FALSE(o2.has<gcs::RetryPolicyOption>());
   EXPECT_FALSE(o2.has<gcs::RestEndpointOption>());
   EXPECT_FALSE(o2.has<gcs::ProjectIdOption>());
+  EXPECT_FALSE(o2.has<gcs::ConnectionPoolSizeOption>());
 }
 
 TEST(GcsFileSystem, ToArrowStatusOK) {
@@ -1363,6 +1377,34 @@ TEST_F(GcsIntegrationTest, OpenInputFileRandomSeek) {
   }
 }
 
+TEST_F(GcsIntegrationTest, OpenInputFileReadAsyncInChunks) {
+  auto options = TestGcsOptions();
+  options.read_chunk_size = 1000;
+  auto fs = GcsFileSystem::Make(options);
+
+  auto constexpr kLineWidth = 100;
+  auto constexpr kLineCount = 128;
+  std::string contents;
+  for (int lineno = 1; lineno <= kLineCount; ++lineno) {
+    contents += RandomLine(lineno, kLineWidth);
+  }
+  const auto path = PreexistingBucketPath() + "OpenInputFileReadAsyncInChunks/object";
+  std::shared_ptr<io::OutputStream> output;
+  ASSERT_OK_AND_ASSIGN(output, fs->OpenOutputStream(path, {}));
+  ASSERT_OK(output->Write(contents.data(), contents.size()));
+  ASSERT_OK(output->Close());
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK_AND_ASSIGN(file, fs->OpenInputFile(path));
+  // Smaller than a chunk, several chunks with a partial one, and past the end
+  for (auto range : {std::make_pair(150, 700), std::make_pair(50, 4321),
+                     std::make_pair(10000, 5000)}) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto actual,
+                                  file->ReadAsync(range.first, range.second));
+    EXPECT_EQ(contents.substr(range.first, range.second), actual->ToString());
+  }
+}
+
 TEST_F(GcsIntegrationTest, OpenInputFileIoContext) {
   auto fs = GcsFileSystem::Make(TestGcsOptions());
 
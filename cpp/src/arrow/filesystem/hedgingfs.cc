@@ -0,0 +1,414 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/hedgingfs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
+#include "arrow/util/tdigest.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace fs {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Latencies are summarized over windows of this many reads, so that the
+// hedging delay follows changes in the latency distribution
+constexpr int64_t kLatencyWindow = 4096;
+// The hedging delay is recomputed every this many reads
+constexpr int64_t kDelayUpdateInterval = 64;
+
+// Run callbacks after a delay on a dedicated thread
+class TimerQueue {
+ public:
+  static std::shared_ptr<TimerQueue> Make() {
+    auto queue = std::make_shared<TimerQueue>();
+    // The thread keeps the queue alive, so that it can be detached
+    queue->thread_ = std::thread([queue] { queue->Run(); });
+    return queue;
+  }
+
+  void Schedule(Clock::duration delay, std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    timers_.emplace(Clock::now() + delay, std::move(callback));
+    cv_.notify_one();
+  }
+
+  // Stop the thread, dropping the pending callbacks
+  void Stop() {
+    decltype(timers_) dropped;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+      dropped.swap(timers_);
+      cv_.notify_one();
+    }
+    dropped.clear();
+    // The last reference to the owner may be dropped by a callback
+    if (thread_.get_id() == std::this_thread::get_id()) {
+      thread_.detach();
+    } else {
+      thread_.join();
+    }
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+      if (timers_.empty()) {
+        cv_.wait(lock);
+        continue;
+      }
+      auto it = timers_.begin();
+      if (it->first > Clock::now()) {
+        cv_.wait_until(lock, it->first);
+        continue;
+      }
+      auto callback = std::move(it->second);
+      timers_.erase(it);
+      lock.unlock();
+      callback();
+      // Destroy the callback's state before taking the lock again
+      callback = nullptr;
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::multimap<Clock::time_point, std::function<void()>> timers_;
+  bool stopping_ = false;
+  std::thread thread_;
+};
+
+}  // namespace
+
+bool HedgingOptions::Equals(const HedgingOptions& other) const {
+  return latency_quantile == other.latency_quantile && min_delay == other.min_delay &&
+         min_samples == other.min_samples && max_hedged_ratio == other.max_hedged_ratio;
+}
+
+// The state shared by the files of a HedgingFileSystem: read latencies, the
+// hedging budget and the timers.
+class HedgingFileSystem::Hedger {
+ public:
+  explicit Hedger(HedgingOptions options)
+      : options_(std::move(options)), timers_(TimerQueue::Make()) {}
+
+  ~Hedger() { timers_->Stop(); }
+
+  int64_t reads() const { return reads_.load(); }
+  int64_t hedged_reads() const { return hedged_reads_.load(); }
+
+  // Return the delay after which a new read should be hedged, if any
+  std::optional<Clock::duration> StartRead() {
+    reads_.fetch_add(1);
+    std::lock_guard<std::mutex> lock(mutex_);
+    return delay_;
+  }
+
+  // Consume the hedging budget, returning whether a read may be hedged
+  bool TryHedge() {
+    int64_t hedged = hedged_reads_.load();
+    do {
+      if (hedged + 1 > options_.max_hedged_ratio * static_cast<double>(reads_.load())) {
+        return false;
+      }
+    } while (!hedged_reads_.compare_exchange_weak(hedged, hedged + 1));
+    return true;
+  }
+
+  void RecordLatency(Clock::duration latency) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    digest_.Add(std::chrono::duration<double>(latency).count());
+    ++samples_;
+    ++window_samples_;
+    if (samples_ == options_.min_samples ||
+        (samples_ > options_.min_samples && samples_ % kDelayUpdateInterval == 0)) {
+      UpdateDelayLocked();
+    }
+    if (window_samples_ >= kLatencyWindow) {
+      // The current delay stays in use until enough samples of the new window
+      digest_.Reset();
+      window_samples_ = 0;
+    }
+  }
+
+  void Schedule(Clock::duration delay, std::function<void()> callback) {
+    timers_->Schedule(delay, std::move(callback));
+  }
+
+ private:
+  void UpdateDelayLocked() {
+    if (window_samples_ < std::min<int64_t>(options_.min_samples, kDelayUpdateInterval)) {
+      return;
+    }
+    const double seconds =
+        std::max(options_.min_delay, digest_.Quantile(options_.latency_quantile));
+    delay_ = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(seconds));
+  }
+
+  const HedgingOptions options_;
+  const std::shared_ptr<TimerQueue> timers_;
+  std::atomic<int64_t> reads_{0};
+  std::atomic<int64_t> hedged_reads_{0};
+
+  std::mutex mutex_;
+  ::arrow::internal::TDigest digest_;
+  int64_t samples_ = 0;
+  int64_t window_samples_ = 0;
+  std::optional<Clock::duration> delay_;
+};
+
+// A file whose asynchronous reads are hedged
+class HedgingFileSystem::HedgedFile : public io::RandomAccessFile {
+ public:
+  HedgedFile(std::shared_ptr<io::RandomAccessFile> base,
+             std::shared_ptr<Hedger> hedger)
+      : base_(std::move(base)), hedger_(std::move(hedger)) {}
+
+  Status Close() override { return base_->Close(); }
+  Future<> CloseAsync() override { return base_->CloseAsync(); }
+  Status Abort() override { return base_->Abort(); }
+  bool closed() const override { return base_->closed(); }
+
+  Result<int64_t> Tell() const override { return base_->Tell(); }
+  Status Seek(int64_t position) override { return base_->Seek(position); }
+  Result<int64_t> GetSize() override { return base_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return base_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return base_->Read(nbytes);
+  }
+  Result<std::string_view> Peek(int64_t nbytes) override { return base_->Peek(nbytes); }
+  bool supports_zero_copy() const override { return base_->supports_zero_copy(); }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    return base_->ReadAt(position, nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return base_->ReadAt(position, nbytes);
+  }
+
+  Result<std::shared_ptr<const KeyValueMetadata>> ReadMetadata() override {
+    return base_->ReadMetadata();
+  }
+  Future<std::shared_ptr<const KeyValueMetadata>> ReadMetadataAsync(
+      const io::IOContext& io_context) override {
+    return base_->ReadMetadataAsync(io_context);
+  }
+  Status WillNeed(const std::vector<io::ReadRange>& ranges) override {
+    return base_->WillNeed(ranges);
+  }
+  const io::IOContext& io_context() const override { return base_->io_context(); }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    auto read = std::make_shared<HedgedRead>();
+    read->start = Clock::now();
+    read->outstanding = 1;
+    auto delay = hedger_->StartRead();
+    IssueRead(read, base_, hedger_, io_context, position, nbytes);
+    if (delay.has_value() && !read->result.is_finished()) {
+      hedger_->Schedule(*delay, [read, base = base_, hedger = hedger_, io_context,
+                                 position, nbytes] {
+        {
+          std::lock_guard<std::mutex> lock(read->mutex);
+          if (read->finished || !hedger->TryHedge()) {
+            return;
+          }
+          ++read->outstanding;
+        }
+        IssueRead(read, base, hedger, io_context, position, nbytes);
+      });
+    }
+    return read->result;
+  }
+
+ private:
+  struct HedgedRead {
+    std::mutex mutex;
+    bool finished = false;
+    int outstanding = 0;
+    Clock::time_point start;
+    Future<std::shared_ptr<Buffer>> result = Future<std::shared_ptr<Buffer>>::Make();
+  };
+
+  static void IssueRead(const std::shared_ptr<HedgedRead>& read,
+                        const std::shared_ptr<io::RandomAccessFile>& base,
+                        const std::shared_ptr<Hedger>& hedger,
+                        const io::IOContext& io_context, int64_t position,
+                        int64_t nbytes) {
+    base->ReadAsync(io_context, position, nbytes)
+        .AddCallback([read, hedger](const Result<std::shared_ptr<Buffer>>& result) {
+          {
+            std::lock_guard<std::mutex> lock(read->mutex);
+            --read->outstanding;
+            // An error only wins if no other request may still succeed
+            if (read->finished || (!result.ok() && read->outstanding > 0)) {
+              return;
+            }
+            read->finished = true;
+          }
+          if (result.ok()) {
+            hedger->RecordLatency(Clock::now() - read->start);
+          }
+          read->result.MarkFinished(result);
+        });
+  }
+
+  const std::shared_ptr<io::RandomAccessFile> base_;
+  const std::shared_ptr<Hedger> hedger_;
+};
+
+HedgingFileSystem::HedgingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     HedgingOptions options)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      options_(std::move(options)),
+      hedger_(std::make_shared<Hedger>(options_)) {}
+
+HedgingFileSystem::~HedgingFileSystem() = default;
+
+Result<std::shared_ptr<HedgingFileSystem>> HedgingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, HedgingOptions options) {
+  if (!(options.latency_quantile > 0 && options.latency_quantile <= 1)) {
+    return Status::Invalid("Hedging latency quantile must be in (0, 1], got ",
+                           options.latency_quantile);
+  }
+  if (!(options.max_hedged_ratio >= 0)) {
+    return Status::Invalid("Hedged read ratio must be non-negative, got ",
+                           options.max_hedged_ratio);
+  }
+  return std::shared_ptr<HedgingFileSystem>(
+      new HedgingFileSystem(std::move(base_fs), std::move(options)));
+}
+
+bool HedgingFileSystem::Equals(const FileSystem& other) const {
+  if (this == &other) {
+    return true;
+  }
+  if (other.type_name() != type_name()) {
+    return false;
+  }
+  const auto& hedging = checked_cast<const HedgingFileSystem&>(other);
+  return options_.Equals(hedging.options_) && base_fs_->Equals(hedging.base_fs_);
+}
+
+Result<std::string> HedgingFileSystem::PathFromUri(const std::string& uri_string) const {
+  return base_fs_->PathFromUri(uri_string);
+}
+
+int64_t HedgingFileSystem::reads() const { return hedger_->reads(); }
+
+int64_t HedgingFileSystem::hedged_reads() const { return hedger_->hedged_reads(); }
+
+Result<FileInfo> HedgingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<FileInfoVector> HedgingFileSystem::GetFileInfo(const FileSelector& selector) {
+  return base_fs_->GetFileInfo(selector);
+}
+
+Status HedgingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status HedgingFileSystem::DeleteDir(const std::string& path) {
+  return base_fs_->DeleteDir(path);
+}
+
+Status HedgingFileSystem::DeleteDirContents(const std::string& path,
+                                            bool missing_dir_ok) {
+  return base_fs_->DeleteDirContents(path, missing_dir_ok);
+}
+
+Status HedgingFileSystem::DeleteRootDirContents() {
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status HedgingFileSystem::DeleteFile(const std::string& path) {
+  return base_fs_->DeleteFile(path);
+}
+
+Status HedgingFileSystem::Move(const std::string& src, const std::string& dest) {
+  return base_fs_->Move(src, dest);
+}
+
+Status HedgingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> HedgingFileSystem::OpenInputStream(
+    const std::string& path) {
+  return base_fs_->OpenInputStream(path);
+}
+
+Result<std::shared_ptr<io::InputStream>> HedgingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return base_fs_->OpenInputStream(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> HedgingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(path));
+  return std::make_shared<HedgedFile>(std::move(file), hedger_);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> HedgingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(info));
+  return std::make_shared<HedgedFile>(std::move(file), hedger_);
+}
+
+Result<std::shared_ptr<io::OutputStream>> HedgingFileSystem::OpenOutputStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenOutputStream(path, metadata);
+}
+
+Result<std::shared_ptr<io::OutputStream>> HedgingFileSystem::OpenAppendStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  return base_fs_->OpenAppendStream(path, metadata);
+}
+
+}  // namespace fs
+}  // namespace arrow
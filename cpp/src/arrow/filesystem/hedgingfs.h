@@ -0,0 +1,128 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/filesystem/filesystem.h"
+
+namespace arrow {
+namespace fs {
+
+/// Options for the HedgingFileSystem implementation.
+struct ARROW_EXPORT HedgingOptions {
+  /// The quantile of the observed read latencies after which a read is hedged.
+  double latency_quantile = 0.95;
+
+  /// The minimum delay before hedging a read, in seconds.
+  double min_delay = 0.005;
+
+  /// The number of reads to observe before hedging any.
+  int64_t min_samples = 100;
+
+  /// The maximum number of hedged reads, as a fraction of all reads.
+  ///
+  /// This bounds the additional request rate (and cost) incurred by hedging.
+  double max_hedged_ratio = 0.05;
+
+  bool Equals(const HedgingOptions& other) const;
+};
+
+/// \brief A FileSystem wrapper hedging slow reads of another filesystem.
+///
+/// Object stores serve a small fraction of requests much slower than the median,
+/// and a scan waiting for all of its ranges is as slow as its slowest request.
+/// When an asynchronous read of a file opened through this filesystem has not
+/// completed after a quantile of the latencies observed so far, an identical
+/// read is issued and the first response wins.  Latencies are tracked for the
+/// whole filesystem.
+///
+/// Only ReadAsync, and therefore ReadManyAsync and the read range cache, is
+/// hedged; synchronous reads are forwarded as is.  All other operations are
+/// forwarded to the base filesystem.
+class ARROW_EXPORT HedgingFileSystem : public FileSystem {
+ public:
+  ~HedgingFileSystem() override;
+
+  static Result<std::shared_ptr<HedgingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, HedgingOptions options = {});
+
+  std::string type_name() const override { return "hedging"; }
+  bool Equals(const FileSystem& other) const override;
+  Result<std::string> PathFromUri(const std::string& uri_string) const override;
+
+  const std::shared_ptr<FileSystem>& base_fs() const { return base_fs_; }
+  const HedgingOptions& options() const { return options_; }
+
+  /// The number of asynchronous reads issued so far
+  int64_t reads() const;
+  /// The number of these reads which were hedged
+  int64_t hedged_reads() const;
+
+  /// \cond FALSE
+  using FileSystem::CreateDir;
+  using FileSystem::DeleteDirContents;
+  using FileSystem::GetFileInfo;
+  using FileSystem::OpenAppendStream;
+  using FileSystem::OpenOutputStream;
+  /// \endcond
+
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path, bool missing_dir_ok) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+
+ private:
+  class Hedger;
+  class HedgedFile;
+
+  HedgingFileSystem(std::shared_ptr<FileSystem> base_fs, HedgingOptions options);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  HedgingOptions options_;
+  std::shared_ptr<Hedger> hedger_;
+};
+
+}  // namespace fs
+}  // namespace arrow
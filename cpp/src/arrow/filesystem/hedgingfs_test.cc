@@ -0,0 +1,213 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/hedgingfs.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/memory.h"
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow::fs {
+
+namespace {
+
+// A filesystem whose files can be made to stall their next asynchronous read
+// until released
+class StallingFileSystem : public internal::MockFileSystem {
+ public:
+  using MockFileSystem::MockFileSystem;
+
+  using MockFileSystem::OpenInputFile;
+
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override {
+    ARROW_ASSIGN_OR_RAISE(auto file, MockFileSystem::OpenInputFile(path));
+    return std::make_shared<StallingFile>(std::move(file), this);
+  }
+
+  void StallNextRead() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stall_next_read_ = true;
+  }
+
+  int ReleaseStalledReads() {
+    std::vector<std::pair<Future<std::shared_ptr<Buffer>>,
+                          Result<std::shared_ptr<Buffer>>>>
+        stalled;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stalled.swap(stalled_reads_);
+    }
+    for (auto& [future, result] : stalled) {
+      future.MarkFinished(std::move(result));
+    }
+    return static_cast<int>(stalled.size());
+  }
+
+ private:
+  class StallingFile : public io::RandomAccessFile {
+   public:
+    StallingFile(std::shared_ptr<io::RandomAccessFile> base, StallingFileSystem* fs)
+        : base_(std::move(base)), fs_(fs) {}
+
+    Status Close() override { return base_->Close(); }
+    bool closed() const override { return base_->closed(); }
+    Result<int64_t> Tell() const override { return base_->Tell(); }
+    Status Seek(int64_t position) override { return base_->Seek(position); }
+    Result<int64_t> GetSize() override { return base_->GetSize(); }
+    Result<int64_t> Read(int64_t nbytes, void* out) override {
+      return base_->Read(nbytes, out);
+    }
+    Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+      return base_->Read(nbytes);
+    }
+    Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+      return base_->ReadAt(position, nbytes);
+    }
+
+    Future<std::shared_ptr<Buffer>> ReadAsync(const io::IOContext&, int64_t position,
+                                              int64_t nbytes) override {
+      auto result = base_->ReadAt(position, nbytes);
+      std::lock_guard<std::mutex> lock(fs_->mutex_);
+      if (!fs_->stall_next_read_) {
+        return result;
+      }
+      fs_->stall_next_read_ = false;
+      auto future = Future<std::shared_ptr<Buffer>>::Make();
+      fs_->stalled_reads_.emplace_back(future, std::move(result));
+      return future;
+    }
+
+   private:
+    std::shared_ptr<io::RandomAccessFile> base_;
+    StallingFileSystem* fs_;
+  };
+
+  std::mutex mutex_;
+  bool stall_next_read_ = false;
+  std::vector<
+      std::pair<Future<std::shared_ptr<Buffer>>, Result<std::shared_ptr<Buffer>>>>
+      stalled_reads_;
+};
+
+}  // namespace
+
+class TestHedgingFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    base_fs_ = std::make_shared<StallingFileSystem>(TimePoint(TimePoint::duration(42)));
+    CreateFile(base_fs_.get(), "a", "some data");
+    options_.min_samples = 10;
+    options_.min_delay = 0.001;
+    options_.max_hedged_ratio = 1;
+  }
+
+  void MakeFileSystem() {
+    ASSERT_OK_AND_ASSIGN(fs_, HedgingFileSystem::Make(base_fs_, options_));
+    ASSERT_OK_AND_ASSIGN(file_, fs_->OpenInputFile("a"));
+  }
+
+  void WarmUp() {
+    for (int i = 0; i < options_.min_samples; ++i) {
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, file_->ReadAsync({}, 5, 4));
+      AssertBufferEqual(*buffer, "data");
+    }
+  }
+
+ protected:
+  std::shared_ptr<StallingFileSystem> base_fs_;
+  HedgingOptions options_;
+  std::shared_ptr<HedgingFileSystem> fs_;
+  std::shared_ptr<io::RandomAccessFile> file_;
+};
+
+TEST_F(TestHedgingFileSystem, Make) {
+  options_.latency_quantile = 0;
+  ASSERT_RAISES(Invalid, HedgingFileSystem::Make(base_fs_, options_));
+  options_.latency_quantile = 0.5;
+  options_.max_hedged_ratio = -1;
+  ASSERT_RAISES(Invalid, HedgingFileSystem::Make(base_fs_, options_));
+}
+
+TEST_F(TestHedgingFileSystem, HedgesSlowReads) {
+  MakeFileSystem();
+  // No hedging before enough latencies are known
+  base_fs_->StallNextRead();
+  auto stalled = file_->ReadAsync({}, 0, 4);
+  SleepFor(0.05);
+  AssertNotFinished(stalled);
+  ASSERT_EQ(base_fs_->ReleaseStalledReads(), 1);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, stalled);
+  AssertBufferEqual(*buffer, "some");
+
+  WarmUp();
+  ASSERT_EQ(fs_->hedged_reads(), 0);
+  base_fs_->StallNextRead();
+  ASSERT_FINISHES_OK_AND_ASSIGN(buffer, file_->ReadAsync({}, 0, 4));
+  AssertBufferEqual(*buffer, "some");
+  ASSERT_EQ(fs_->hedged_reads(), 1);
+  ASSERT_EQ(fs_->reads(), options_.min_samples + 2);
+  // The slow response is ignored
+  ASSERT_EQ(base_fs_->ReleaseStalledReads(), 1);
+
+  // Synchronous reads are not hedged
+  ASSERT_OK_AND_ASSIGN(buffer, file_->ReadAt(5, 4));
+  AssertBufferEqual(*buffer, "data");
+}
+
+TEST_F(TestHedgingFileSystem, Budget) {
+  options_.max_hedged_ratio = 0;
+  MakeFileSystem();
+  WarmUp();
+  base_fs_->StallNextRead();
+  auto stalled = file_->ReadAsync({}, 0, 4);
+  SleepFor(0.05);
+  AssertNotFinished(stalled);
+  ASSERT_EQ(fs_->hedged_reads(), 0);
+  ASSERT_EQ(base_fs_->ReleaseStalledReads(), 1);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, stalled);
+  AssertBufferEqual(*buffer, "some");
+}
+
+TEST_F(TestHedgingFileSystem, ForwardsOperations) {
+  MakeFileSystem();
+  ASSERT_OK(fs_->CreateDir("dir"));
+  CreateFile(fs_.get(), "dir/b", "data");
+  AssertFileInfo(base_fs_.get(), "dir/b", FileType::File, 4);
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenInputStream("dir/b"));
+  ASSERT_OK_AND_ASSIGN(auto buffer, stream->Read(10));
+  AssertBufferEqual(*buffer, "data");
+  ASSERT_OK(fs_->DeleteFile("dir/b"));
+  AssertFileInfo(base_fs_.get(), "dir/b", FileType::NotFound);
+
+  ASSERT_OK_AND_ASSIGN(auto other, HedgingFileSystem::Make(base_fs_, options_));
+  ASSERT_TRUE(fs_->Equals(*other));
+  options_.latency_quantile = 0.5;
+  ASSERT_OK_AND_ASSIGN(other, HedgingFileSystem::Make(base_fs_, options_));
+  ASSERT_FALSE(fs_->Equals(*other));
+}
+
+}  // namespace arrow::fs
@@ -36,9 +36,12 @@
 #include "arrow/filesystem/type_fwd.h"
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/file.h"
+#include "arrow/io/metrics.h"
 #include "arrow/io/type_fwd.h"
+#include "arrow/io/uring_internal.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/uri.h"
 #include "arrow/util/windows_fixup.h"
 
@@ -220,7 +223,9 @@ LocalFileSystemOptions LocalFileSystemOptions::Defaults() { return {}; }
 
 bool LocalFileSystemOptions::Equals(const LocalFileSystemOptions& other) const {
   return use_mmap == other.use_mmap && directory_readahead == other.directory_readahead &&
-         file_info_batch_size == other.file_info_batch_size;
+         file_info_batch_size == other.file_info_batch_size &&
+         use_direct_io == other.use_direct_io && use_io_uring == other.use_io_uring &&
+         io_uring_queue_depth == other.io_uring_queue_depth;
 }
 
 Result<LocalFileSystemOptions> LocalFileSystemOptions::FromUri(
@@ -255,7 +260,17 @@ LocalFileSystem::LocalFileSystem(const io::IOContext& io_context)
 
 LocalFileSystem::LocalFileSystem(const LocalFileSystemOptions& options,
                                  const io::IOContext& io_context)
-    : FileSystem(io_context), options_(options) {}
+    : FileSystem(io_context), options_(options) {
+  if (options_.use_io_uring && !options_.use_mmap && !options_.use_direct_io) {
+    auto maybe_reader = io::internal::UringReader::Make(options_.io_uring_queue_depth);
+    if (maybe_reader.ok()) {
+      uring_reader_ = *std::move(maybe_reader);
+    } else {
+      ARROW_LOG(DEBUG) << "io_uring unavailable, reading with the I/O thread pool: "
+                       << maybe_reader.status().ToString();
+    }
+  }
+}
 
 LocalFileSystem::~LocalFileSystem() = default;
 
@@ -285,15 +300,21 @@ bool LocalFileSystem::Equals(const FileSystem& other) const {
 Result<FileInfo> LocalFileSystem::GetFileInfo(const std::string& path) {
   RETURN_NOT_OK(ValidatePath(path));
   ARROW_ASSIGN_OR_RAISE(auto fn, PlatformFilename::FromString(path));
-  return StatFile(fn.ToNative());
+  return io::internal::RecordOperation(io_context().metrics().get(),
+                                       io::IOMetrics::Operation::kGetFileInfo,
+                                       [&] { return StatFile(fn.ToNative()); });
 }
 
 Result<std::vector<FileInfo>> LocalFileSystem::GetFileInfo(const FileSelector& select) {
   RETURN_NOT_OK(ValidatePath(select.base_dir));
   ARROW_ASSIGN_OR_RAISE(auto fn, PlatformFilename::FromString(select.base_dir));
-  std::vector<FileInfo> results;
-  RETURN_NOT_OK(StatSelector(fn, select, 0, &results));
-  return results;
+  return io::internal::RecordOperation(
+      io_context().metrics().get(), io::IOMetrics::Operation::kListDir,
+      [&]() -> Result<std::vector<FileInfo>> {
+        std::vector<FileInfo> results;
+        RETURN_NOT_OK(StatSelector(fn, select, 0, &results));
+        return results;
+      });
 }
 
 namespace {
@@ -636,7 +657,7 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
   if (options.use_mmap) {
     return io::MemoryMappedFile::Open(path, io::FileMode::READ);
   } else {
-    return io::ReadableFile::Open(path, io_context.pool());
+    return io::ReadableFile::Open(path, io_context.pool(), options.use_direct_io);
   }
 }
 
@@ -644,12 +665,24 @@ Result<std::shared_ptr<InputStreamType>> OpenInputStreamGeneric(
 
 Result<std::shared_ptr<io::InputStream>> LocalFileSystem::OpenInputStream(
     const std::string& path) {
-  return OpenInputStreamGeneric<io::InputStream>(path, options_, io_context());
+  return io::internal::OpenWithMetrics<io::InputStream>(io_context(), [&] {
+    return OpenInputStreamGeneric<io::InputStream>(path, options_, io_context());
+  });
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> LocalFileSystem::OpenInputFile(
     const std::string& path) {
-  return OpenInputStreamGeneric<io::RandomAccessFile>(path, options_, io_context());
+  return io::internal::OpenWithMetrics<io::RandomAccessFile>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        if (uring_reader_ != nullptr) {
+          RETURN_NOT_OK(ValidatePath(path));
+          ARROW_ASSIGN_OR_RAISE(auto file,
+                                io::ReadableFile::Open(path, io_context().pool()));
+          return io::internal::MakeUringFile(std::move(file), uring_reader_);
+        }
+        return OpenInputStreamGeneric<io::RandomAccessFile>(path, options_,
+                                                            io_context());
+      });
 }
 
 namespace {
@@ -676,14 +709,16 @@ Result<std::shared_ptr<io::OutputStream>> LocalFileSystem::OpenOutputStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
   bool truncate = true;
   bool append = false;
-  return OpenOutputStreamGeneric(path, truncate, append);
+  return io::internal::OpenWithMetrics<io::OutputStream>(
+      io_context(), [&] { return OpenOutputStreamGeneric(path, truncate, append); });
 }
 
 Result<std::shared_ptr<io::OutputStream>> LocalFileSystem::OpenAppendStream(
     const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
   bool truncate = false;
   bool append = true;
-  return OpenOutputStreamGeneric(path, truncate, append);
+  return io::internal::OpenWithMetrics<io::OutputStream>(
+      io_context(), [&] { return OpenOutputStreamGeneric(path, truncate, append); });
 }
 
 }  // namespace arrow::fs
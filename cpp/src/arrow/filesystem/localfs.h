@@ -30,17 +30,46 @@ class Uri;
 
 }
 
+namespace io::internal {
+
+class UringReader;
+
+}
+
 namespace fs {
 
 /// Options for the LocalFileSystem implementation.
 struct ARROW_EXPORT LocalFileSystemOptions {
   static constexpr int32_t kDefaultDirectoryReadahead = 16;
   static constexpr int32_t kDefaultFileInfoBatchSize = 1000;
+  static constexpr int32_t kDefaultIoUringQueueDepth = 256;
 
   /// Whether OpenInputStream and OpenInputFile return a mmap'ed file,
   /// or a regular one.
   bool use_mmap = false;
 
+  /// EXPERIMENTAL: Whether reads of files returned by OpenInputStream and
+  /// OpenInputFile bypass the OS page cache.
+  ///
+  /// Useful for large one-shot scans that would otherwise evict data other
+  /// processes keep hot in the page cache.  See io::ReadableFile::Open.
+  /// Ignored if use_mmap is true.
+  bool use_direct_io = false;
+
+  /// EXPERIMENTAL: Whether the asynchronous reads of files returned by
+  /// OpenInputFile are served by io_uring instead of the I/O thread pool.
+  ///
+  /// Reads issued together (for example the coalesced ranges of a
+  /// ReadRangeCache) are submitted with a single system call and completed
+  /// from a dedicated thread, without blocking a thread per read.  This is
+  /// only available on Linux; elsewhere, or if the kernel refuses to create
+  /// the ring, the I/O thread pool is used.  Ignored if use_mmap or
+  /// use_direct_io is true.
+  bool use_io_uring = false;
+
+  /// EXPERIMENTAL: The number of submission entries of the io_uring ring.
+  int32_t io_uring_queue_depth = kDefaultIoUringQueueDepth;
+
   /// Options related to `GetFileInfoGenerator` interface.
 
   /// EXPERIMENTAL: The maximum number of directories processed in parallel
@@ -125,6 +154,9 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
 
  protected:
   LocalFileSystemOptions options_;
+  // Shared by the files opened by this filesystem, if use_io_uring is enabled
+  // and supported
+  std::shared_ptr<io::internal::UringReader> uring_reader_;
 };
 
 }  // namespace fs
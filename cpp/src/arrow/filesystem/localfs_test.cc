@@ -30,6 +30,8 @@
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/test_util.h"
 #include "arrow/filesystem/util_internal.h"
+#include "arrow/io/metrics.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
 #include "arrow/util/io_util.h"
@@ -261,6 +263,28 @@ class TestLocalFSGenericMMap : public TestLocalFSGeneric<CommonPathFormatter> {
 
 GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericMMap);
 
+class TestLocalFSGenericDirectIO : public TestLocalFSGeneric<CommonPathFormatter> {
+ protected:
+  LocalFileSystemOptions options() override {
+    auto options = LocalFileSystemOptions::Defaults();
+    options.use_direct_io = true;
+    return options;
+  }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericDirectIO);
+
+class TestLocalFSGenericIoUring : public TestLocalFSGeneric<CommonPathFormatter> {
+ protected:
+  LocalFileSystemOptions options() override {
+    auto options = LocalFileSystemOptions::Defaults();
+    options.use_io_uring = true;
+    return options;
+  }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericIoUring);
+
 ////////////////////////////////////////////////////////////////////////////
 // Concrete LocalFileSystem tests
 
@@ -525,6 +549,79 @@ TYPED_TEST(TestLocalFS, FileMTime) {
   AssertDurationBetween(t2 - infos[1].mtime(), -kTimeSlack, kTimeSlack);
 }
 
+TYPED_TEST(TestLocalFS, ReadManyAsyncIoUring) {
+  // Falls back to the I/O thread pool where io_uring is unavailable
+  this->options_.use_io_uring = true;
+  this->options_.io_uring_queue_depth = 4;
+  this->MakeFileSystem();
+
+  std::string data;
+  for (int i = 0; i < 100000; ++i) {
+    data.push_back(static_cast<char>(i % 127));
+  }
+  CreateFile(this->fs_.get(), "AB", data);
+  ASSERT_OK_AND_ASSIGN(auto file, this->fs_->OpenInputFile("AB"));
+
+  // More ranges than the queue depth, including ranges past the end of the file
+  std::vector<io::ReadRange> ranges;
+  for (int64_t offset = 0; offset < 100000; offset += 3000) {
+    ranges.push_back({offset, 4000});
+  }
+  ranges.push_back({99990, 100});
+  ranges.push_back({200000, 10});
+  auto futures = file->ReadManyAsync(ranges);
+  ASSERT_EQ(futures.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const auto& range = ranges[i];
+    ARROW_SCOPED_TRACE("offset = ", range.offset);
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, futures[i]);
+    const auto begin = std::min<int64_t>(range.offset, data.size());
+    const auto end = std::min<int64_t>(range.offset + range.length, data.size());
+    ASSERT_EQ(buffer->ToString(), data.substr(begin, end - begin));
+  }
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, file->ReadAsync({}, 10, 5));
+  ASSERT_EQ(buffer->ToString(), data.substr(10, 5));
+  ASSERT_FINISHES_AND_RAISES(Invalid, file->ReadAsync({}, -1, 5));
+  ASSERT_OK(file->Close());
+  ASSERT_FINISHES_AND_RAISES(Invalid, file->ReadAsync({}, 0, 5));
+}
+
+TYPED_TEST(TestLocalFS, IOMetrics) {
+  auto metrics = std::make_shared<io::IOMetrics>();
+  io::IOContext io_context;
+  io_context.set_metrics(metrics);
+  this->local_fs_ = std::make_shared<LocalFileSystem>(this->options_, io_context);
+  this->fs_ = std::make_shared<SubTreeFileSystem>(this->local_path_, this->local_fs_);
+
+  ASSERT_OK_AND_ASSIGN(auto out, this->fs_->OpenOutputStream("AB"));
+  ASSERT_OK(out->Write("some data"));
+  ASSERT_OK(out->Close());
+  ASSERT_OK_AND_ASSIGN(auto file, this->fs_->OpenInputFile("AB"));
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(5, 4));
+  ASSERT_EQ(buffer->ToString(), "data");
+  ASSERT_FINISHES_OK_AND_ASSIGN(buffer, file->ReadAsync({}, 0, 4));
+  ASSERT_EQ(buffer->ToString(), "some");
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(IOError, this->fs_->OpenInputStream("CD"));
+  ASSERT_OK_AND_ASSIGN(auto info, this->fs_->GetFileInfo("AB"));
+  AssertFileInfo(info, "AB", FileType::File, 9);
+  FileSelector selector;
+  ASSERT_OK_AND_ASSIGN(auto infos, this->fs_->GetFileInfo(selector));
+  ASSERT_EQ(infos.size(), 1);
+
+  auto open_stats = metrics->GetStats(io::IOMetrics::Operation::kOpen);
+  ASSERT_EQ(open_stats.count, 3);
+  ASSERT_EQ(open_stats.errors, 1);
+  auto read_stats = metrics->GetStats(io::IOMetrics::Operation::kRead);
+  ASSERT_EQ(read_stats.count, 2);
+  ASSERT_EQ(read_stats.bytes, 8);
+  auto write_stats = metrics->GetStats(io::IOMetrics::Operation::kWrite);
+  ASSERT_EQ(write_stats.bytes, 9);
+  ASSERT_EQ(metrics->GetStats(io::IOMetrics::Operation::kGetFileInfo).count, 1);
+  ASSERT_EQ(metrics->GetStats(io::IOMetrics::Operation::kListDir).count, 1);
+}
+
 struct DirTreeCreator {
   static constexpr int kFilesPerDir = 50;
   static constexpr int kDirLevels = 2;
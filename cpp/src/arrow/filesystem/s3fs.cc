@@ -21,6 +21,7 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -123,12 +124,14 @@
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/metrics.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/async_generator.h"
 #include "arrow/util/async_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/counters.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
@@ -435,8 +438,13 @@ bool S3Options::Equals(const S3Options& other) const {
           proxy_options.Equals(other.proxy_options) &&
           credentials_kind == other.credentials_kind &&
           background_writes == other.background_writes &&
+          upload_part_size == other.upload_part_size &&
+          max_concurrent_part_uploads == other.max_concurrent_part_uploads &&
+          max_buffered_upload_bytes == other.max_buffered_upload_bytes &&
           allow_bucket_creation == other.allow_bucket_creation &&
           allow_bucket_deletion == other.allow_bucket_deletion &&
+          read_part_size == other.read_part_size &&
+          read_part_concurrency == other.read_part_concurrency &&
           default_metadata_equals && GetAccessKey() == other.GetAccessKey() &&
           GetSecretKey() == other.GetSecretKey() &&
           GetSessionToken() == other.GetSessionToken());
@@ -560,6 +568,34 @@ std::string FormatRange(int64_t start, int64_t length) {
   return ss.str();
 }
 
+// An AWS RetryStrategy that records the retries decided by another strategy
+// into IOMetrics
+class CountingRetryStrategy : public Aws::Client::RetryStrategy {
+ public:
+  CountingRetryStrategy(std::shared_ptr<Aws::Client::RetryStrategy> wrapped,
+                        std::shared_ptr<io::IOMetrics> metrics)
+      : wrapped_(std::move(wrapped)), metrics_(std::move(metrics)) {}
+
+  bool ShouldRetry(const Aws::Client::AWSError<Aws::Client::CoreErrors>& error,
+                   long attempted_retries) const override {  // NOLINT runtime/int
+    const bool retry = wrapped_->ShouldRetry(error, attempted_retries);
+    if (retry) {
+      metrics_->RecordRetry();
+    }
+    return retry;
+  }
+
+  long CalculateDelayBeforeNextRetry(  // NOLINT runtime/int
+      const Aws::Client::AWSError<Aws::Client::CoreErrors>& error,
+      long attempted_retries) const override {  // NOLINT runtime/int
+    return wrapped_->CalculateDelayBeforeNextRetry(error, attempted_retries);
+  }
+
+ private:
+  std::shared_ptr<Aws::Client::RetryStrategy> wrapped_;
+  std::shared_ptr<io::IOMetrics> metrics_;
+};
+
 // An AWS RetryStrategy that wraps a provided arrow::fs::S3RetryStrategy
 class WrappedRetryStrategy : public Aws::Client::RetryStrategy {
  public:
@@ -1086,6 +1122,10 @@ class ClientBuilder {
     } else {
       client_config_.retryStrategy = std::make_shared<ConnectRetryStrategy>();
     }
+    if (io_context && io_context->metrics()) {
+      client_config_.retryStrategy = std::make_shared<CountingRetryStrategy>(
+          client_config_.retryStrategy, io_context->metrics());
+    }
     if (!internal::global_options.tls_ca_file_path.empty()) {
       client_config_.caFile = ToAwsString(internal::global_options.tls_ca_file_path);
     }
@@ -1255,6 +1295,11 @@ Aws::IOStreamFactory AwsWriteableStreamFactory(void* data, int64_t nbytes) {
 Result<S3Model::GetObjectResult> GetObjectRange(Aws::S3::S3Client* client,
                                                 const S3Path& path, int64_t start,
                                                 int64_t length, void* out) {
+  static util::Histogram* const get_latency = util::GetHistogram("s3.get.latency");
+  static util::Counter* const get_bytes = util::GetCounter("s3.get.bytes");
+  util::ScopedLatency latency(get_latency);
+  get_bytes->Add(length);
+
   S3Model::GetObjectRequest req;
   req.SetBucket(ToAwsString(path.bucket));
   req.SetKey(ToAwsString(path.key));
@@ -1384,10 +1429,12 @@ bool IsDirectory(std::string_view key, const S3Model::HeadObjectResult& result)
 class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<S3ClientHolder> holder, const io::IOContext& io_context,
-                  const S3Path& path, int64_t size = kNoSize)
+                  const S3Path& path, const S3Options& options, int64_t size = kNoSize)
       : holder_(std::move(holder)),
         io_context_(io_context),
         path_(path),
+        read_part_size_(options.read_part_size),
+        read_part_concurrency_(options.read_part_concurrency),
         content_length_(size) {}
 
   Status Init() {
@@ -1484,16 +1531,10 @@ class ObjectInputFile final : public io::RandomAccessFile {
     }
 
     // Read the desired range of bytes
-    ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
-    ARROW_ASSIGN_OR_RAISE(
-        S3Model::GetObjectResult result,
-        GetObjectRange(client_lock.get(), path_, position, nbytes, out));
-
-    auto& stream = result.GetBody();
-    stream.ignore(nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    return stream.gcount();
+    if (read_part_size_ > 0 && read_part_concurrency_ > 1 && nbytes > read_part_size_) {
+      return ReadAtInParts(position, nbytes, static_cast<uint8_t*>(out));
+    }
+    return ReadRange(holder_.get(), path_, position, nbytes, out);
   }
 
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
@@ -1526,9 +1567,86 @@ class ObjectInputFile final : public io::RandomAccessFile {
   }
 
  protected:
+  static Result<int64_t> ReadRange(S3ClientHolder* holder, const S3Path& path,
+                                   int64_t position, int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(auto client_lock, holder->Lock());
+    ARROW_ASSIGN_OR_RAISE(
+        S3Model::GetObjectResult result,
+        GetObjectRange(client_lock.get(), path, position, nbytes, out));
+
+    auto& stream = result.GetBody();
+    stream.ignore(nbytes);
+    // NOTE: the stream is a stringstream by default, there is no actual error
+    // to check for.  However, stream.fail() may return true if EOF is reached.
+    return stream.gcount();
+  }
+
+  // Read a large range with concurrent ranged GETs of read_part_size_ bytes.
+  //
+  // The parts are claimed one at a time by the spawned tasks and by the calling
+  // thread, which only waits for the parts already being read.  This cannot
+  // deadlock when called from a saturated IO executor: tasks which start late
+  // find no part left to read.
+  Result<int64_t> ReadAtInParts(int64_t position, int64_t nbytes, uint8_t* out) {
+    struct PartsState {
+      std::atomic<int64_t> next_part{0};
+      std::mutex mutex;
+      std::condition_variable parts_done_cv;
+      int64_t parts_done = 0;
+      std::vector<int64_t> part_bytes_read;
+      Status status;
+    };
+    const int64_t part_size = read_part_size_;
+    const int64_t num_parts = bit_util::CeilDiv(nbytes, part_size);
+    auto state = std::make_shared<PartsState>();
+    state->part_bytes_read.resize(num_parts);
+
+    auto read_parts = [state, num_parts, part_size, position, nbytes, out,
+                       holder = holder_, path = path_]() {
+      int64_t part;
+      while ((part = state->next_part.fetch_add(1)) < num_parts) {
+        const int64_t offset = part * part_size;
+        auto result = ReadRange(holder.get(), path, position + offset,
+                                std::min(part_size, nbytes - offset), out + offset);
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (result.ok()) {
+          state->part_bytes_read[part] = *result;
+        } else {
+          state->status &= result.status();
+        }
+        if (++state->parts_done == num_parts) {
+          state->parts_done_cv.notify_one();
+        }
+      }
+    };
+    const int64_t num_tasks = std::min<int64_t>(read_part_concurrency_, num_parts) - 1;
+    for (int64_t i = 0; i < num_tasks; ++i) {
+      // If spawning fails, the remaining parts are read by this thread
+      if (!io_context_.executor()->Spawn(read_parts).ok()) {
+        break;
+      }
+    }
+    read_parts();
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->parts_done_cv.wait(lock, [&] { return state->parts_done == num_parts; });
+    RETURN_NOT_OK(state->status);
+    // If the object was truncated meanwhile, only return the contiguous data
+    int64_t bytes_read = 0;
+    for (int64_t part = 0; part < num_parts; ++part) {
+      bytes_read += state->part_bytes_read[part];
+      if (state->part_bytes_read[part] < std::min(part_size, nbytes - part * part_size)) {
+        break;
+      }
+    }
+    return bytes_read;
+  }
+
   std::shared_ptr<S3ClientHolder> holder_;
   const io::IOContext io_context_;
   S3Path path_;
+  const int64_t read_part_size_;
+  const int32_t read_part_concurrency_;
 
   bool closed_ = false;
   int64_t pos_ = 0;
@@ -1536,15 +1654,6 @@ class ObjectInputFile final : public io::RandomAccessFile {
   std::shared_ptr<const KeyValueMetadata> metadata_;
 };
 
-// Upload size per part. While AWS and Minio support different sizes for each
-// part (only requiring a minimum of 5MB), Cloudflare R2 requires that every
-// part be exactly equal (except for the last part). We set this to 10 MB, so
-// that in combination with the maximum number of parts of 10,000, this gives a
-// file limit of 100k MB (or about 98 GB).
-// (see https://docs.aws.amazon.com/AmazonS3/latest/userguide/qfacts.html)
-// (for rational, see: https://github.com/apache/arrow/issues/34363)
-static constexpr int64_t kPartUploadSize = 10 * 1024 * 1024;
-
 // An OutputStream that writes to a S3 object
 class ObjectOutputStream final : public io::OutputStream {
  protected:
@@ -1560,7 +1669,10 @@ class ObjectOutputStream final : public io::OutputStream {
         path_(path),
         metadata_(metadata),
         default_metadata_(options.default_metadata),
-        background_writes_(options.background_writes) {}
+        background_writes_(options.background_writes),
+        part_upload_size_(options.upload_part_size),
+        max_concurrent_part_uploads_(options.max_concurrent_part_uploads),
+        max_buffered_upload_bytes_(options.max_buffered_upload_bytes) {}
 
   ~ObjectOutputStream() override {
     // For compliance with the rest of the IO stack, Close rather than Abort,
@@ -1569,6 +1681,10 @@ class ObjectOutputStream final : public io::OutputStream {
   }
 
   Status Init() {
+    if (part_upload_size_ <= 0) {
+      return Status::Invalid("S3 upload part size must be positive, got ",
+                             part_upload_size_);
+    }
     ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
 
     // Initiate the multi-part upload
@@ -1606,6 +1722,7 @@ class ObjectOutputStream final : public io::OutputStream {
       return Status::OK();
     }
 
+    DiscardQueuedParts(upload_state_);
     ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
 
     S3Model::AbortMultipartUploadRequest req;
@@ -1723,14 +1840,14 @@ class ObjectOutputStream final : public io::OutputStream {
     // Handle case where we have some bytes buffered from prior calls.
     if (current_part_size_ > 0) {
       // Try to fill current buffer
-      const int64_t to_copy = std::min(nbytes, kPartUploadSize - current_part_size_);
+      const int64_t to_copy = std::min(nbytes, part_upload_size_ - current_part_size_);
       RETURN_NOT_OK(current_part_->Write(data_ptr, to_copy));
       current_part_size_ += to_copy;
       advance_ptr(to_copy);
       pos_ += to_copy;
 
       // If buffer isn't full, break
-      if (current_part_size_ < kPartUploadSize) {
+      if (current_part_size_ < part_upload_size_) {
         return Status::OK();
       }
 
@@ -1739,17 +1856,17 @@ class ObjectOutputStream final : public io::OutputStream {
     }
 
     // We can upload chunks without copying them into a buffer
-    while (nbytes >= kPartUploadSize) {
-      RETURN_NOT_OK(UploadPart(data_ptr, kPartUploadSize));
-      advance_ptr(kPartUploadSize);
-      pos_ += kPartUploadSize;
+    while (nbytes >= part_upload_size_) {
+      RETURN_NOT_OK(UploadPart(data_ptr, part_upload_size_));
+      advance_ptr(part_upload_size_);
+      pos_ += part_upload_size_;
     }
 
     // Buffer remaining bytes
     if (nbytes > 0) {
       current_part_size_ = nbytes;
       ARROW_ASSIGN_OR_RAISE(current_part_, io::BufferOutputStream::Create(
-                                               kPartUploadSize, io_context_.pool()));
+                                               part_upload_size_, io_context_.pool()));
       RETURN_NOT_OK(current_part_->Write(data_ptr, current_part_size_));
       pos_ += current_part_size_;
     }
@@ -1814,23 +1931,39 @@ class ObjectOutputStream final : public io::OutputStream {
       req.SetBody(
           std::make_shared<StringViewStream>(owned_buffer->data(), owned_buffer->size()));
 
-      {
-        std::unique_lock<std::mutex> lock(upload_state_->mutex);
-        if (upload_state_->parts_in_progress++ == 0) {
-          upload_state_->pending_parts_completed = Future<>::Make();
+      std::unique_lock<std::mutex> lock(upload_state_->mutex);
+      if (upload_state_->parts_in_progress++ == 0) {
+        upload_state_->pending_parts_completed = Future<>::Make();
+      }
+      upload_state_->bytes_in_progress += nbytes;
+      // The queued part keeps the buffer alive
+      upload_state_->queued_parts.push_back(
+          QueuedPart{part_number_, std::move(req), std::move(owned_buffer)});
+
+      if (max_concurrent_part_uploads_ <= 0 ||
+          upload_state_->active_uploaders < max_concurrent_part_uploads_) {
+        ++upload_state_->active_uploaders;
+        // The closure keeps the upload state alive
+        auto uploader = [holder = holder_, state = upload_state_]() {
+          std::unique_lock<std::mutex> lock(state->mutex);
+          RunUploader(state, holder, &lock);
+        };
+        if (!io_context_.executor()->Spawn(std::move(uploader)).ok()) {
+          RunUploader(upload_state_, holder_, &lock);
         }
       }
 
-      // The closure keeps the buffer and the upload state alive
-      auto deferred = [owned_buffer, holder = holder_, req = std::move(req),
-                       state = upload_state_,
-                       part_number = part_number_]() mutable -> Status {
-        ARROW_ASSIGN_OR_RAISE(auto client_lock, holder->Lock());
-        auto outcome = client_lock.Move()->UploadPart(req);
-        HandleUploadOutcome(state, part_number, req, outcome);
-        return Status::OK();
-      };
-      RETURN_NOT_OK(SubmitIO(io_context_, std::move(deferred)));
+      // Apply backpressure.  Rather than only waiting for the uploaders, upload
+      // queued parts on this thread: uploaders spawned on a saturated IO executor
+      // may not start before this write returns.
+      while (max_buffered_upload_bytes_ > 0 &&
+             upload_state_->bytes_in_progress > max_buffered_upload_bytes_) {
+        if (!upload_state_->queued_parts.empty()) {
+          UploadQueuedPart(upload_state_, holder_, &lock);
+        } else {
+          upload_state_->part_uploaded.wait(lock);
+        }
+      }
     }
 
     ++part_number_;
@@ -1838,10 +1971,37 @@ class ObjectOutputStream final : public io::OutputStream {
     return Status::OK();
   }
 
+  // Upload queued parts until there is none left.  `lock` must hold the
+  // upload state mutex.
+  static void RunUploader(const std::shared_ptr<UploadState>& state,
+                          const std::shared_ptr<S3ClientHolder>& holder,
+                          std::unique_lock<std::mutex>* lock) {
+    while (!state->queued_parts.empty()) {
+      UploadQueuedPart(state, holder, lock);
+    }
+    --state->active_uploaders;
+  }
+
+  // Upload the first queued part, releasing `lock` meanwhile
+  static void UploadQueuedPart(const std::shared_ptr<UploadState>& state,
+                               const std::shared_ptr<S3ClientHolder>& holder,
+                               std::unique_lock<std::mutex>* lock) {
+    QueuedPart part = std::move(state->queued_parts.front());
+    state->queued_parts.pop_front();
+    lock->unlock();
+    auto result = [&]() -> Result<S3Model::UploadPartOutcome> {
+      ARROW_ASSIGN_OR_RAISE(auto client_lock, holder->Lock());
+      return client_lock.Move()->UploadPart(part.req);
+    }();
+    lock->lock();
+    HandleUploadOutcome(state, part.part_number, part.req, result);
+    state->bytes_in_progress -= part.buffer->size();
+    FinishPartInProgress(state);
+  }
+
   static void HandleUploadOutcome(const std::shared_ptr<UploadState>& state,
                                   int part_number, const S3Model::UploadPartRequest& req,
                                   const Result<S3Model::UploadPartOutcome>& result) {
-    std::unique_lock<std::mutex> lock(state->mutex);
     if (!result.ok()) {
       state->status &= result.status();
     } else {
@@ -1852,12 +2012,27 @@ class ObjectOutputStream final : public io::OutputStream {
         AddCompletedPart(state, part_number, outcome.GetResult());
       }
     }
+  }
+
+  // Must be called with the upload state mutex held
+  static void FinishPartInProgress(const std::shared_ptr<UploadState>& state) {
+    state->part_uploaded.notify_all();
     // Notify completion
     if (--state->parts_in_progress == 0) {
       state->pending_parts_completed.MarkFinished(state->status);
     }
   }
 
+  // Drop the parts not being uploaded yet, which are useless once aborted
+  static void DiscardQueuedParts(const std::shared_ptr<UploadState>& state) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (!state->queued_parts.empty()) {
+      state->bytes_in_progress -= state->queued_parts.front().buffer->size();
+      state->queued_parts.pop_front();
+      FinishPartInProgress(state);
+    }
+  }
+
   static void AddCompletedPart(const std::shared_ptr<UploadState>& state, int part_number,
                                const S3Model::UploadPartResult& result) {
     S3Model::CompletedPart part;
@@ -1888,6 +2063,9 @@ class ObjectOutputStream final : public io::OutputStream {
   const std::shared_ptr<const KeyValueMetadata> metadata_;
   const std::shared_ptr<const KeyValueMetadata> default_metadata_;
   const bool background_writes_;
+  const int64_t part_upload_size_;
+  const int32_t max_concurrent_part_uploads_;
+  const int64_t max_buffered_upload_bytes_;
 
   Aws::String upload_id_;
   bool closed_ = true;
@@ -1896,12 +2074,25 @@ class ObjectOutputStream final : public io::OutputStream {
   std::shared_ptr<io::BufferOutputStream> current_part_;
   int64_t current_part_size_ = 0;
 
+  struct QueuedPart {
+    int part_number;
+    S3Model::UploadPartRequest req;
+    std::shared_ptr<Buffer> buffer;
+  };
+
   // This struct is kept alive through background writes to avoid problems
   // in the completion handler.
   struct UploadState {
     std::mutex mutex;
     Aws::Vector<S3Model::CompletedPart> completed_parts;
+    // Background parts are queued, then uploaded by at most
+    // max_concurrent_part_uploads_ uploaders
+    std::deque<QueuedPart> queued_parts;
+    int32_t active_uploaders = 0;
+    // Parts and bytes queued or being uploaded
     int64_t parts_in_progress = 0;
+    int64_t bytes_in_progress = 0;
+    std::condition_variable part_uploaded;
     Status status;
     Future<> pending_parts_completed = Future<>::MakeFinished(Status::OK());
   };
@@ -2699,6 +2890,69 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     return DeferNotOk(SubmitIO(io_context_, std::move(deferred)));
   }
 
+  Result<FileInfo> GetFileInfo(const std::string& s) {
+    ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
+
+    ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
+    FileInfo info;
+    info.set_path(s);
+
+    if (path.empty()) {
+      // It's the root path ""
+      info.set_type(FileType::Directory);
+      return info;
+    } else if (path.key.empty()) {
+      // It's a bucket
+      S3Model::HeadBucketRequest req;
+      req.SetBucket(ToAwsString(path.bucket));
+
+      auto outcome = client_lock.Move()->HeadBucket(req);
+      if (!outcome.IsSuccess()) {
+        if (!IsNotFound(outcome.GetError())) {
+          const auto msg = "When getting information for bucket '" + path.bucket + "': ";
+          return ErrorToStatus(msg, "HeadBucket", outcome.GetError(), options().region);
+        }
+        info.set_type(FileType::NotFound);
+        return info;
+      }
+      // NOTE: S3 doesn't have a bucket modification time.  Only a creation
+      // time is available, and you have to list all buckets to get it.
+      info.set_type(FileType::Directory);
+      return info;
+    } else {
+      // It's an object
+      S3Model::HeadObjectRequest req;
+      req.SetBucket(ToAwsString(path.bucket));
+      req.SetKey(ToAwsString(path.key));
+
+      auto outcome = client_lock.Move()->HeadObject(req);
+      if (outcome.IsSuccess()) {
+        // "File" object found
+        FileObjectToInfo(path.key, outcome.GetResult(), &info);
+        return info;
+      }
+      if (!IsNotFound(outcome.GetError())) {
+        const auto msg = "When getting information for key '" + path.key +
+                         "' in bucket '" + path.bucket + "': ";
+        return ErrorToStatus(msg, "HeadObject", outcome.GetError(), options().region);
+      }
+      // Not found => perhaps it's an empty "directory"
+      ARROW_ASSIGN_OR_RAISE(bool is_dir, IsEmptyDirectory(path, &outcome));
+      if (is_dir) {
+        info.set_type(FileType::Directory);
+        return info;
+      }
+      // Not found => perhaps it's a non-empty "directory"
+      ARROW_ASSIGN_OR_RAISE(is_dir, IsNonEmptyDirectory(path));
+      if (is_dir) {
+        info.set_type(FileType::Directory);
+      } else {
+        info.set_type(FileType::NotFound);
+      }
+      return info;
+    }
+  }
+
   Result<std::shared_ptr<ObjectInputFile>> OpenInputFile(const std::string& s,
                                                          S3FileSystem* fs) {
     ARROW_RETURN_NOT_OK(internal::AssertNoTrailingSlash(s));
@@ -2707,7 +2961,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
 
     RETURN_NOT_OK(CheckS3Initialized());
 
-    auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path);
+    auto ptr =
+        std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path, options());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -2727,8 +2982,8 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
 
     RETURN_NOT_OK(CheckS3Initialized());
 
-    auto ptr =
-        std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path, info.size());
+    auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path,
+                                                 options(), info.size());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -2771,80 +3026,26 @@ S3Options S3FileSystem::options() const { return impl_->options(); }
 std::string S3FileSystem::region() const { return impl_->region(); }
 
 Result<FileInfo> S3FileSystem::GetFileInfo(const std::string& s) {
-  ARROW_ASSIGN_OR_RAISE(auto client_lock, impl_->holder_->Lock());
-
-  ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
-  FileInfo info;
-  info.set_path(s);
-
-  if (path.empty()) {
-    // It's the root path ""
-    info.set_type(FileType::Directory);
-    return info;
-  } else if (path.key.empty()) {
-    // It's a bucket
-    S3Model::HeadBucketRequest req;
-    req.SetBucket(ToAwsString(path.bucket));
-
-    auto outcome = client_lock.Move()->HeadBucket(req);
-    if (!outcome.IsSuccess()) {
-      if (!IsNotFound(outcome.GetError())) {
-        const auto msg = "When getting information for bucket '" + path.bucket + "': ";
-        return ErrorToStatus(msg, "HeadBucket", outcome.GetError(),
-                             impl_->options().region);
-      }
-      info.set_type(FileType::NotFound);
-      return info;
-    }
-    // NOTE: S3 doesn't have a bucket modification time.  Only a creation
-    // time is available, and you have to list all buckets to get it.
-    info.set_type(FileType::Directory);
-    return info;
-  } else {
-    // It's an object
-    S3Model::HeadObjectRequest req;
-    req.SetBucket(ToAwsString(path.bucket));
-    req.SetKey(ToAwsString(path.key));
-
-    auto outcome = client_lock.Move()->HeadObject(req);
-    if (outcome.IsSuccess()) {
-      // "File" object found
-      FileObjectToInfo(path.key, outcome.GetResult(), &info);
-      return info;
-    }
-    if (!IsNotFound(outcome.GetError())) {
-      const auto msg = "When getting information for key '" + path.key + "' in bucket '" +
-                       path.bucket + "': ";
-      return ErrorToStatus(msg, "HeadObject", outcome.GetError(),
-                           impl_->options().region);
-    }
-    // Not found => perhaps it's an empty "directory"
-    ARROW_ASSIGN_OR_RAISE(bool is_dir, impl_->IsEmptyDirectory(path, &outcome));
-    if (is_dir) {
-      info.set_type(FileType::Directory);
-      return info;
-    }
-    // Not found => perhaps it's a non-empty "directory"
-    ARROW_ASSIGN_OR_RAISE(is_dir, impl_->IsNonEmptyDirectory(path));
-    if (is_dir) {
-      info.set_type(FileType::Directory);
-    } else {
-      info.set_type(FileType::NotFound);
-    }
-    return info;
-  }
+  return io::internal::RecordOperation(io_context().metrics().get(),
+                                       io::IOMetrics::Operation::kGetFileInfo,
+                                       [&]() { return impl_->GetFileInfo(s); });
 }
 
 Result<FileInfoVector> S3FileSystem::GetFileInfo(const FileSelector& select) {
-  Future<std::vector<FileInfoVector>> file_infos_fut =
-      CollectAsyncGenerator(GetFileInfoGenerator(select));
-  ARROW_ASSIGN_OR_RAISE(std::vector<FileInfoVector> file_infos, file_infos_fut.result());
-  FileInfoVector combined_file_infos;
-  for (const auto& file_info_vec : file_infos) {
-    combined_file_infos.insert(combined_file_infos.end(), file_info_vec.begin(),
-                               file_info_vec.end());
-  }
-  return combined_file_infos;
+  return io::internal::RecordOperation(
+      io_context().metrics().get(), io::IOMetrics::Operation::kListDir,
+      [&]() -> Result<FileInfoVector> {
+        Future<std::vector<FileInfoVector>> file_infos_fut =
+            CollectAsyncGenerator(GetFileInfoGenerator(select));
+        ARROW_ASSIGN_OR_RAISE(std::vector<FileInfoVector> file_infos,
+                              file_infos_fut.result());
+        FileInfoVector combined_file_infos;
+        for (const auto& file_info_vec : file_infos) {
+          combined_file_infos.insert(combined_file_infos.end(), file_info_vec.begin(),
+                                     file_info_vec.end());
+        }
+        return combined_file_infos;
+      });
 }
 
 FileInfoGenerator S3FileSystem::GetFileInfoGenerator(const FileSelector& select) {
@@ -3009,22 +3210,34 @@ Status S3FileSystem::CopyFile(const std::string& src, const std::string& dest) {
 
 Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
     const std::string& s) {
-  return impl_->OpenInputFile(s, this);
+  return io::internal::OpenWithMetrics<io::InputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::InputStream>> {
+        return impl_->OpenInputFile(s, this);
+      });
 }
 
 Result<std::shared_ptr<io::InputStream>> S3FileSystem::OpenInputStream(
     const FileInfo& info) {
-  return impl_->OpenInputFile(info, this);
+  return io::internal::OpenWithMetrics<io::InputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::InputStream>> {
+        return impl_->OpenInputFile(info, this);
+      });
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
     const std::string& s) {
-  return impl_->OpenInputFile(s, this);
+  return io::internal::OpenWithMetrics<io::RandomAccessFile>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        return impl_->OpenInputFile(s, this);
+      });
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> S3FileSystem::OpenInputFile(
     const FileInfo& info) {
-  return impl_->OpenInputFile(info, this);
+  return io::internal::OpenWithMetrics<io::RandomAccessFile>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::RandomAccessFile>> {
+        return impl_->OpenInputFile(info, this);
+      });
 }
 
 Result<std::shared_ptr<io::OutputStream>> S3FileSystem::OpenOutputStream(
@@ -3035,10 +3248,13 @@ Result<std::shared_ptr<io::OutputStream>> S3FileSystem::OpenOutputStream(
 
   RETURN_NOT_OK(CheckS3Initialized());
 
-  auto ptr = std::make_shared<ObjectOutputStream>(impl_->holder_, io_context(), path,
-                                                  impl_->options(), metadata);
-  RETURN_NOT_OK(ptr->Init());
-  return ptr;
+  return io::internal::OpenWithMetrics<io::OutputStream>(
+      io_context(), [&]() -> Result<std::shared_ptr<io::OutputStream>> {
+        auto ptr = std::make_shared<ObjectOutputStream>(
+            impl_->holder_, io_context(), path, impl_->options(), metadata);
+        RETURN_NOT_OK(ptr->Init());
+        return ptr;
+      });
 }
 
 Result<std::shared_ptr<io::OutputStream>> S3FileSystem::OpenAppendStream(
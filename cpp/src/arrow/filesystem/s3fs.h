@@ -155,6 +155,28 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief Size of the parts OutputStream writes are uploaded in
+  ///
+  /// While AWS and Minio support different sizes for each part (only requiring a
+  /// minimum of 5 MB), Cloudflare R2 requires that every part be exactly equal
+  /// (except for the last part).  With the maximum number of parts of 10,000, the
+  /// default of 10 MB gives a file limit of about 98 GB.
+  int64_t upload_part_size = 10 * 1024 * 1024;
+
+  /// \brief Maximum number of parts of an OutputStream uploaded concurrently
+  ///
+  /// Only used with background_writes.  If 0 or negative, parts are uploaded as
+  /// soon as the IO executor has a thread available.
+  int32_t max_concurrent_part_uploads = 0;
+
+  /// \brief Maximum number of bytes of an OutputStream waiting to be uploaded
+  ///
+  /// Only used with background_writes.  When a write brings the parts queued or
+  /// being uploaded above this limit, it blocks until enough of them are uploaded,
+  /// uploading queued parts itself meanwhile.  If 0 or negative, there is no
+  /// limit and memory usage grows as long as writes outpace uploads.
+  int64_t max_buffered_upload_bytes = 0;
+
   /// Whether to allow creation of buckets
   ///
   /// When S3FileSystem creates new buckets, it does not pass any non-default settings.
@@ -166,6 +188,17 @@ struct ARROW_EXPORT S3Options {
   /// Whether to allow deletion of buckets
   bool allow_bucket_deletion = false;
 
+  /// \brief Size of the ranged GET requests large reads are split into
+  ///
+  /// Reads larger than this are split into parts of this size which are fetched
+  /// concurrently on the IO executor and written into the same buffer, since a
+  /// single connection's throughput is usually far below the instance bandwidth.
+  /// If 0 or negative, each read is issued as a single request.
+  int64_t read_part_size = 16 * 1024 * 1024;
+
+  /// Maximum number of concurrent requests issued for a single split read
+  int32_t read_part_concurrency = 8;
+
   /// \brief Default metadata for OpenOutputStream.
   ///
   /// This will be ignored if non-empty metadata is passed to OpenOutputStream.
@@ -1189,8 +1189,61 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileReadInParts) {
+  options_.read_part_size = 3;
+  options_.read_part_concurrency = 2;
+  MakeFileSystem();
+
+  std::string data;
+  for (int i = 0; i < 100; ++i) {
+    data += static_cast<char>('a' + i % 26);
+  }
+  ASSERT_OK_AND_ASSIGN(auto stream, fs_->OpenOutputStream("bucket/parts"));
+  ASSERT_OK(stream->Write(data));
+  ASSERT_OK(stream->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile("bucket/parts"));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 100));
+  AssertBufferEqual(*buf, data);
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(7, 50));
+  AssertBufferEqual(*buf, data.substr(7, 50));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(90, 20));
+  AssertBufferEqual(*buf, data.substr(90));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(4, 2));
+  AssertBufferEqual(*buf, "ef");
+
+  // Concurrent split reads from the IO executor itself
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  for (int i = 0; i < 20; ++i) {
+    futures.push_back(file->ReadAsync(io::default_io_context(), i, 80));
+  }
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(buf, futures[i]);
+    AssertBufferEqual(*buf, data.substr(i, 80));
+  }
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
+TEST_F(TestS3FS, OpenOutputStreamLimitedBackgroundWrites) {
+  // The minimum part size, so that the large writes in TestOpenOutputStream
+  // are split into several parts
+  options_.upload_part_size = 5 * 1024 * 1024;
+  options_.max_concurrent_part_uploads = 1;
+  options_.max_buffered_upload_bytes = 5 * 1024 * 1024;
+  MakeFileSystem();
+  TestOpenOutputStream();
+
+  options_.max_concurrent_part_uploads = 2;
+  options_.max_buffered_upload_bytes = 1;
+  MakeFileSystem();
+  TestOpenOutputStream();
+
+  options_.upload_part_size = 0;
+  MakeFileSystem();
+  ASSERT_RAISES(Invalid, fs_->OpenOutputStream("bucket/newfile1"));
+}
+
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
   options_.background_writes = false;
   MakeFileSystem();
@@ -19,12 +19,16 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
 #include "arrow/util/string.h"
 
 namespace arrow {
@@ -59,6 +63,37 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
   return Status::OK();
 }
 
+Future<std::shared_ptr<Buffer>> ReadAtInChunksAsync(
+    const io::IOContext& io_context, int64_t position, int64_t nbytes,
+    int64_t chunk_size,
+    std::function<Result<int64_t>(int64_t position, int64_t nbytes, uint8_t* out)>
+        read_at) {
+  DCHECK_GT(chunk_size, 0);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                        AllocateBuffer(nbytes, io_context.pool()));
+  std::vector<Future<>> chunks;
+  chunks.reserve(bit_util::CeilDiv(nbytes, chunk_size));
+  for (int64_t offset = 0; offset < nbytes; offset += chunk_size) {
+    const int64_t length = std::min(chunk_size, nbytes - offset);
+    // The buffer is kept alive by every chunk, as a failure completes the read before
+    // the remaining chunks are done writing to it.
+    auto read_chunk = [read_at, buffer, position, offset, length]() -> Status {
+      ARROW_ASSIGN_OR_RAISE(
+          int64_t bytes_read,
+          read_at(position + offset, length, buffer->mutable_data() + offset));
+      if (bytes_read != length) {
+        return Status::IOError("Expected to read ", length, " bytes at position ",
+                               position + offset, ", got ", bytes_read);
+      }
+      return Status::OK();
+    };
+    ARROW_ASSIGN_OR_RAISE(auto chunk,
+                          io::internal::SubmitIO(io_context, std::move(read_chunk)));
+    chunks.push_back(std::move(chunk));
+  }
+  return AllComplete(chunks).Then([buffer]() { return buffer; });
+}
+
 Status PathNotFound(std::string_view path) {
   return Status::IOError("Path does not exist '", path, "'")
       .WithDetail(StatusDetailFromErrno(ENOENT));
@@ -18,12 +18,14 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string_view>
 
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/uri.h"
 #include "arrow/util/visibility.h"
 
@@ -40,6 +42,18 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
                   const std::shared_ptr<io::OutputStream>& dest, int64_t chunk_size,
                   const io::IOContext& io_context);
 
+/// \brief Read a byte range as concurrent reads of at most `chunk_size` bytes
+///
+/// Each chunk is read on the IO executor of `io_context` into its slice of the
+/// returned buffer.  `read_at` must be safe to call concurrently and must not outlive
+/// what it captures; the range must lie within the file, a short read is an error.
+ARROW_EXPORT
+Future<std::shared_ptr<Buffer>> ReadAtInChunksAsync(
+    const io::IOContext& io_context, int64_t position, int64_t nbytes,
+    int64_t chunk_size,
+    std::function<Result<int64_t>(int64_t position, int64_t nbytes, uint8_t* out)>
+        read_at);
+
 ARROW_EXPORT
 Status PathNotFound(std::string_view path);
 
@@ -20,19 +20,24 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <atomic>
 #include <memory>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "arrow/buffer.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/ipc/options.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/future.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 
 #include "arrow/flight/client_auth.h"
@@ -110,6 +115,10 @@ std::shared_ptr<FlightWriteSizeStatusDetail> FlightWriteSizeStatusDetail::Unwrap
 
 FlightClientOptions FlightClientOptions::Defaults() { return FlightClientOptions(); }
 
+DoGetEndpointsOptions DoGetEndpointsOptions::Defaults() {
+  return DoGetEndpointsOptions();
+}
+
 arrow::Result<std::shared_ptr<Table>> FlightStreamReader::ToTable(
     const StopToken& stop_token) {
   ARROW_ASSIGN_OR_RAISE(auto batches, ToRecordBatches(stop_token));
@@ -680,6 +689,158 @@ arrow::Result<std::unique_ptr<FlightStreamReader>> FlightClient::DoGet(
   return stream_reader;
 }
 
+namespace {
+/// \brief The state of the read of one endpoint.
+///
+/// The DoGet is only made on the first read, so that the endpoints
+/// are opened as the generators get to them.
+struct EndpointReadState {
+  FlightClient* client;
+  // Keeps the client connected to the location of the endpoint alive
+  std::shared_ptr<FlightClient> owned_client;
+  FlightCallOptions options;
+  Ticket ticket;
+  std::unique_ptr<FlightStreamReader> reader;
+  // Set when the consumer stopped reading
+  std::shared_ptr<std::atomic<bool>> stopped;
+
+  arrow::Result<std::shared_ptr<RecordBatch>> Next() {
+    if (stopped->load()) {
+      if (reader) {
+        reader->Cancel();
+        reader.reset();
+      }
+      return IterationEnd<std::shared_ptr<RecordBatch>>();
+    }
+    if (!reader) {
+      ARROW_ASSIGN_OR_RAISE(reader, client->DoGet(options, ticket));
+    }
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, reader->Next());
+      // Skip the messages of only app_metadata
+      if (chunk.data || !chunk.app_metadata) return std::move(chunk.data);
+    }
+  }
+};
+
+arrow::Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> MakeEndpointsGenerator(
+    FlightClient* client, const FlightCallOptions& options, const FlightInfo& info,
+    const DoGetEndpointsOptions& endpoints_options,
+    std::shared_ptr<std::atomic<bool>> stopped) {
+  using BatchGenerator = AsyncGenerator<std::shared_ptr<RecordBatch>>;
+  if (endpoints_options.max_concurrency < 1) {
+    return Status::Invalid("max_concurrency must be positive, got ",
+                           endpoints_options.max_concurrency);
+  }
+  auto* executor = endpoints_options.executor;
+  if (executor == nullptr) executor = io::default_io_context().executor();
+
+  std::unordered_map<std::string, std::shared_ptr<FlightClient>> location_clients;
+  std::vector<BatchGenerator> endpoint_generators;
+  for (const auto& endpoint : info.endpoints()) {
+    auto state = std::make_shared<EndpointReadState>();
+    state->client = client;
+    if (!endpoint.locations.empty() &&
+        endpoint.locations[0] != Location::ReuseConnection()) {
+      auto& location_client = location_clients[endpoint.locations[0].ToString()];
+      if (!location_client) {
+        ARROW_ASSIGN_OR_RAISE(location_client,
+                              FlightClient::Connect(endpoint.locations[0],
+                                                    endpoints_options.client_options));
+      }
+      state->client = location_client.get();
+      state->owned_client = location_client;
+    }
+    state->options = options;
+    state->ticket = endpoint.ticket;
+    state->stopped = stopped;
+
+    auto batches = MakeFunctionIterator([state] { return state->Next(); });
+    ARROW_ASSIGN_OR_RAISE(auto background,
+                          MakeBackgroundGenerator(std::move(batches), executor));
+    endpoint_generators.push_back(
+        MakeTransferredGenerator(std::move(background), executor));
+  }
+
+  auto endpoints = MakeVectorGenerator(std::move(endpoint_generators));
+  if (!endpoints_options.ordered) {
+    return MakeMergedGenerator(std::move(endpoints), endpoints_options.max_concurrency);
+  }
+  if (endpoints_options.max_concurrency == 1) {
+    return MakeConcatenatedGenerator(std::move(endpoints));
+  }
+  return MakeSequencedMergedGenerator(std::move(endpoints),
+                                      endpoints_options.max_concurrency);
+}
+
+/// \brief A RecordBatchReader over the batches of the endpoints.
+class EndpointsRecordBatchReader : public RecordBatchReader {
+ public:
+  EndpointsRecordBatchReader(std::shared_ptr<Schema> schema,
+                             AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
+                             std::shared_ptr<std::atomic<bool>> stopped)
+      : schema_(std::move(schema)),
+        generator_(std::move(generator)),
+        stopped_(std::move(stopped)) {}
+
+  ~EndpointsRecordBatchReader() override {
+    ARROW_WARN_NOT_OK(Close(), "Failed to close the endpoints reader");
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (!generator_) {
+      *batch = nullptr;
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(*batch, generator_().result());
+    return Status::OK();
+  }
+
+  Status Close() override {
+    if (!generator_) return Status::OK();
+    // Stop the reads in progress, and wait for them, as they use the client
+    stopped_->store(true);
+    auto generator = std::move(generator_);
+    generator_ = nullptr;
+    return VisitAsyncGenerator(std::move(generator),
+                               [](const std::shared_ptr<RecordBatch>&) {
+                                 return Status::OK();
+                               })
+        .status();
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
+  std::shared_ptr<std::atomic<bool>> stopped_;
+};
+}  // namespace
+
+arrow::Result<AsyncGenerator<std::shared_ptr<RecordBatch>>>
+FlightClient::DoGetEndpointsAsync(const FlightCallOptions& options,
+                                  const FlightInfo& info,
+                                  const DoGetEndpointsOptions& endpoints_options) {
+  RETURN_NOT_OK(CheckOpen());
+  return MakeEndpointsGenerator(this, options, info, endpoints_options,
+                                std::make_shared<std::atomic<bool>>(false));
+}
+
+arrow::Result<std::shared_ptr<RecordBatchReader>> FlightClient::DoGetEndpoints(
+    const FlightCallOptions& options, const FlightInfo& info,
+    const DoGetEndpointsOptions& endpoints_options) {
+  RETURN_NOT_OK(CheckOpen());
+  ipc::DictionaryMemo dictionary_memo;
+  ARROW_ASSIGN_OR_RAISE(auto schema, info.GetSchema(&dictionary_memo));
+  auto stopped = std::make_shared<std::atomic<bool>>(false);
+  ARROW_ASSIGN_OR_RAISE(
+      auto generator,
+      MakeEndpointsGenerator(this, options, info, endpoints_options, stopped));
+  return std::make_shared<EndpointsRecordBatchReader>(
+      std::move(schema), std::move(generator), std::move(stopped));
+}
+
 arrow::Result<FlightClient::DoPutResult> FlightClient::DoPut(
     const FlightCallOptions& options, const FlightDescriptor& descriptor,
     const std::shared_ptr<Schema>& schema) {
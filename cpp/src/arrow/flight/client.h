@@ -32,7 +32,9 @@
 #include "arrow/ipc/writer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/async_generator_fwd.h"
 #include "arrow/util/cancel.h"
+#include "arrow/util/type_fwd.h"
 
 #include "arrow/flight/type_fwd.h"
 #include "arrow/flight/types.h"  // IWYU pragma: keep
@@ -127,6 +129,29 @@ struct ARROW_FLIGHT_EXPORT FlightClientOptions {
   static FlightClientOptions Defaults();
 };
 
+/// \brief Options for FlightClient::DoGetEndpoints.
+///
+/// This API is EXPERIMENTAL.
+struct ARROW_FLIGHT_EXPORT DoGetEndpointsOptions {
+  /// \brief The maximum number of endpoints read at once.
+  int max_concurrency = 4;
+  /// \brief Whether to return the batches in the order of the endpoints.
+  ///
+  /// If false, the batches are returned as soon as they are received,
+  /// which avoids waiting on a slow endpoint.
+  bool ordered = true;
+  /// \brief The options of the clients connecting to the locations of
+  ///     the endpoints.
+  FlightClientOptions client_options = FlightClientOptions::Defaults();
+  /// \brief The executor running the (blocking) reads of the endpoints.
+  ///
+  /// If null, the I/O executor is used.
+  ::arrow::internal::Executor* executor = NULLPTR;
+
+  /// \brief Get default options.
+  static DoGetEndpointsOptions Defaults();
+};
+
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
 /// operations.
 class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader {
@@ -345,6 +370,41 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket);
   }
 
+  /// \brief Read the data of all the endpoints of a flight, concurrently.
+  ///
+  /// An endpoint without locations, or whose first location is
+  /// Location::ReuseConnection(), is read with this client. The other
+  /// endpoints are read with one new client per location, shared by
+  /// the endpoints of that location. Only the first location of each
+  /// endpoint is tried. The application metadata of the streams is
+  /// dropped.
+  ///
+  /// This client must outlive the returned generator.
+  ///
+  /// This API is EXPERIMENTAL.
+  ///
+  /// \param[in] options Per-RPC options, used for every DoGet
+  /// \param[in] info The flight to read
+  /// \param[in] endpoints_options Concurrency and ordering options
+  /// \return Arrow result with a generator of the batches of all the endpoints
+  arrow::Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> DoGetEndpointsAsync(
+      const FlightCallOptions& options, const FlightInfo& info,
+      const DoGetEndpointsOptions& endpoints_options = DoGetEndpointsOptions::Defaults());
+
+  /// \brief Read the data of all the endpoints of a flight, concurrently.
+  ///
+  /// Like DoGetEndpointsAsync, but returns a reader. The schema is taken
+  /// from the FlightInfo, which must have one.
+  ///
+  /// This API is EXPERIMENTAL.
+  arrow::Result<std::shared_ptr<RecordBatchReader>> DoGetEndpoints(
+      const FlightCallOptions& options, const FlightInfo& info,
+      const DoGetEndpointsOptions& endpoints_options = DoGetEndpointsOptions::Defaults());
+  arrow::Result<std::shared_ptr<RecordBatchReader>> DoGetEndpoints(
+      const FlightInfo& info) {
+    return DoGetEndpoints({}, info);
+  }
+
   /// \brief DoPut return value
   struct DoPutResult {
     /// \brief a writer to write record batches to
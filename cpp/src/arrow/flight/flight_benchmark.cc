@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <fstream>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -29,9 +30,13 @@
 #include "arrow/ipc/api.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/config.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/stopwatch.h"
+#include "arrow/util/string.h"
 #include "arrow/util/tdigest.h"
 #include "arrow/util/thread_pool.h"
 
@@ -46,6 +51,9 @@
 #ifdef ARROW_WITH_UCX
 #include "arrow/flight/transport/ucx/ucx.h"
 #endif
+#ifndef _WIN32
+#include "arrow/flight/transport/shm/shm.h"
+#endif
 
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
@@ -53,6 +61,9 @@ DEFINE_string(transport, "grpc",
 #ifdef ARROW_WITH_UCX
               ", \"ucx\""
 #endif  // ARROW_WITH_UCX
+#ifndef _WIN32
+              ", \"shm\""
+#endif  // _WIN32
               ".");
 DEFINE_string(server_host, "",
               "An existing performance server to benchmark against (leave blank to spawn "
@@ -68,17 +79,29 @@ DEFINE_int32(num_perf_runs, 1,
 DEFINE_int32(num_servers, 1, "Number of performance servers to run");
 DEFINE_int32(num_streams, 4, "Number of streams for each server");
 DEFINE_int32(num_threads, 4, "Number of concurrent gets");
+DEFINE_string(num_threads_list, "",
+              "Comma-separated numbers of concurrent gets to run the test with, "
+              "one after the other (overrides -num_threads)");
 DEFINE_int64(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(test_exchange, false,
+            "Test DoExchange round trips (each batch sent is echoed back) instead of "
+            "DoGet");
+DEFINE_string(data_type, "int64",
+              "The data to transfer: \"int64\" (4 int64 columns, default), "
+              "\"string\" (4 string columns) or \"nested\" (struct and list columns)");
 DEFINE_string(compression, "",
               "Select compression method (\"zstd\", \"lz4\"). "
               "Leave blank to disable compression.\n"
               "E.g., \"zstd\":   zstd with default compression level.\n"
               "      \"zstd:7\": zstd with compression leve = 7.\n");
-DEFINE_string(
-    data_file, "",
-    "Instead of random data, use data from the given IPC file. Only affects -test_put.");
+DEFINE_string(data_file, "",
+              "Instead of random data, use data from the given IPC file. Only affects "
+              "-test_put and -test_exchange.");
+DEFINE_string(json_output, "",
+              "Also write the results to this file (\"-\" for stdout), as one JSON "
+              "object per line");
 DEFINE_string(cert_file, "", "Path to TLS certificate");
 DEFINE_string(key_file, "", "Path to TLS private key (used when spawning a server)");
 
@@ -128,10 +151,79 @@ struct PerformanceStats {
   uint64_t quantile_latency(double q) const { return latencies.Quantile(q) / 1000; }
 };
 
+// The methods that can be benchmarked
+enum class PerfMethod { kDoGet, kDoPut, kDoExchange };
+
+const char* PerfMethodName(PerfMethod method) {
+  switch (method) {
+    case PerfMethod::kDoGet:
+      return "DoGet";
+    case PerfMethod::kDoPut:
+      return "DoPut";
+    case PerfMethod::kDoExchange:
+      return "DoExchange";
+  }
+  return "unknown";
+}
+
+// Parse -compression: "zstd" -> name = "zstd", level = default;
+// "zstd:7" -> name = "zstd", level = 7
+void ParseCompression(const std::string& compression, std::string* name, int* level) {
+  const size_t delim = compression.find(":");
+  *name = compression.substr(0, delim);
+  const std::string level_str =
+      delim == std::string::npos
+          ? ""
+          : compression.substr(delim + 1, compression.length() - delim - 1);
+  *level = level_str.empty() ? arrow::util::kUseDefaultCompressionLevel
+                             : std::stoi(level_str);
+}
+
+// The schema of the data selected with -data_type
+arrow::Result<std::shared_ptr<Schema>> GetPerfSchema() {
+  if (FLAGS_data_type == "int64") {
+    return arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
+                          field("d", int64())});
+  }
+  // Short strings, like names or identifiers
+  auto string_metadata = key_value_metadata({"max_length"}, {"32"});
+  if (FLAGS_data_type == "string") {
+    return arrow::schema({field("a", utf8(), true, string_metadata),
+                          field("b", utf8(), true, string_metadata),
+                          field("c", utf8(), true, string_metadata),
+                          field("d", utf8(), true, string_metadata)});
+  }
+  if (FLAGS_data_type == "nested") {
+    auto list_metadata = key_value_metadata({"max_length"}, {"8"});
+    return arrow::schema(
+        {field("id", int64(), false),
+         field("point",
+               struct_({field("x", float64()), field("y", float64()),
+                        field("label", utf8(), true, string_metadata)})),
+         field("tags", list(field("item", utf8(), true, string_metadata)), true,
+               list_metadata),
+         field("values", list(int32()), true, list_metadata)});
+  }
+  return Status::Invalid("Unknown data type: ", FLAGS_data_type);
+}
+
+// The bytes of data in a batch
+int64_t GetBatchBytes(const RecordBatch& batch) {
+  if (FLAGS_data_type == "int64" && FLAGS_data_file.empty()) {
+    // This is hard-coded for right now, 4 columns each with int64
+    const int bytes_per_record = 32;
+    return batch.num_rows() * bytes_per_record;
+  }
+  return util::TotalBufferSize(batch);
+}
+
 Status WaitForReady(FlightClient* client, const FlightCallOptions& call_options) {
-  Action action{"ping", nullptr};
+  // Not all transports implement DoAction: plan an empty query instead
+  FlightDescriptor descriptor;
+  descriptor.type = FlightDescriptor::CMD;
+  perf::Perf().SerializeToString(&descriptor.cmd);
   for (int attempt = 0; attempt < 10; attempt++) {
-    if (client->DoAction(call_options, action).ok()) {
+    if (client->GetFlightInfo(call_options, descriptor).ok()) {
       return Status::OK();
     }
     std::this_thread::sleep_for(std::chrono::milliseconds(1000));
@@ -139,6 +231,25 @@ Status WaitForReady(FlightClient* client, const FlightCallOptions& call_options)
   return Status::IOError("Server was not available after 10 attempts");
 }
 
+// Connect to the server, waiting for it to start
+arrow::Result<std::unique_ptr<FlightClient>> ConnectWhenReady(
+    const Location& location, const FlightClientOptions& options,
+    const FlightCallOptions& call_options) {
+  // Some transports connect eagerly, and fail if the server is not listening yet
+  Status status;
+  for (int attempt = 0; attempt < 10; attempt++) {
+    auto maybe_client = FlightClient::Connect(location, options);
+    if (maybe_client.ok()) {
+      auto client = maybe_client.MoveValueUnsafe();
+      RETURN_NOT_OK(WaitForReady(client.get(), call_options));
+      return client;
+    }
+    status = maybe_client.status();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+  }
+  return status;
+}
+
 arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
                                               const FlightCallOptions& call_options,
                                               const perf::Token& token,
@@ -149,9 +260,6 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
 
   FlightStreamChunk batch;
 
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
-
   // This must also be set in perf_server.cc
   const bool verify = false;
 
@@ -179,9 +287,7 @@ arrow::Result<PerformanceResult> RunDoGetTest(FlightClient* client,
 
     ++num_batches;
     num_records += batch.data->num_rows();
-
-    // Hard-coded
-    num_bytes += batch.data->num_rows() * bytes_per_record;
+    num_bytes += GetBatchBytes(*batch.data);
   }
   return PerformanceResult{num_batches, num_records, num_bytes};
 }
@@ -204,24 +310,23 @@ arrow::Result<std::vector<SizedBatch>> GetPutData(const perf::Token& token) {
     return batches;
   }
 
-  std::shared_ptr<Schema> schema =
-      arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                     field("d", int64())});
-
-  // This is hard-coded for right now, 4 columns each with int64
-  const int bytes_per_record = 32;
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Schema> schema, GetPerfSchema());
 
   std::shared_ptr<ResizableBuffer> buffer;
   std::vector<std::shared_ptr<Array>> arrays;
 
   const int64_t total_records = token.definition().records_per_stream();
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
+  if (FLAGS_data_type == "int64") {
+    const int32_t ncolumns = 4;
+    for (int i = 0; i < ncolumns; ++i) {
+      RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
+                                         &buffer, static_cast<int32_t>(i) /* seed */));
+      arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+      RETURN_NOT_OK(arrays.back()->Validate());
+    }
+  } else {
+    arrays = random::GenerateBatch(schema->fields(), length, /*seed=*/0)->columns();
   }
 
   std::shared_ptr<RecordBatch> batch = RecordBatch::Make(schema, length, arrays);
@@ -231,13 +336,11 @@ arrow::Result<std::vector<SizedBatch>> GetPutData(const perf::Token& token) {
   while (records_sent < total_records) {
     if (records_sent + length > total_records) {
       const int64_t last_length = total_records - records_sent;
-      // Hard-coded
-      batches.push_back(SizedBatch{batch->Slice(0, last_length),
-                                   /*bytes=*/last_length * bytes_per_record});
+      auto last_batch = batch->Slice(0, last_length);
+      batches.push_back(SizedBatch{last_batch, GetBatchBytes(*last_batch)});
       records_sent += last_length;
     } else {
-      // Hard-coded
-      batches.push_back(SizedBatch{batch, /*bytes=*/length * bytes_per_record});
+      batches.push_back(SizedBatch{batch, GetBatchBytes(*batch)});
       records_sent += length;
     }
   }
@@ -276,14 +379,65 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
   return PerformanceResult{static_cast<int64_t>(batches.size()), num_records, num_bytes};
 }
 
+// Send each batch and wait for the server to echo it back. The latency is
+// that of a round trip.
+arrow::Result<PerformanceResult> RunDoExchangeTest(FlightClient* client,
+                                                   const FlightCallOptions& call_options,
+                                                   const perf::Token& token,
+                                                   const FlightEndpoint& endpoint,
+                                                   PerformanceStats* stats) {
+  ARROW_ASSIGN_OR_RAISE(const auto batches, GetPutData(token));
+  StopWatch timer;
+  int64_t num_records = 0;
+  int64_t num_bytes = 0;
+  // The server compresses the batches it sends back as requested here
+  FlightDescriptor descriptor;
+  descriptor.type = FlightDescriptor::CMD;
+  token.definition().SerializeToString(&descriptor.cmd);
+  ARROW_ASSIGN_OR_RAISE(auto exchange, client->DoExchange(call_options, descriptor));
+  RETURN_NOT_OK(exchange.writer->Begin(batches[0].batch->schema()));
+  FlightStreamChunk chunk;
+  for (const auto& batch : batches) {
+    timer.Start();
+    RETURN_NOT_OK(exchange.writer->WriteRecordBatch(*batch.batch));
+    ARROW_ASSIGN_OR_RAISE(chunk, exchange.reader->Next());
+    stats->AddLatency(timer.Stop());
+    if (!chunk.data) {
+      return Status::IOError("Server ended the exchange early");
+    }
+    num_records += chunk.data->num_rows();
+    num_bytes += batch.bytes;
+  }
+  RETURN_NOT_OK(exchange.writer->DoneWriting());
+  ARROW_ASSIGN_OR_RAISE(chunk, exchange.reader->Next());
+  if (chunk.data) {
+    return Status::IOError("Server sent more batches than it received");
+  }
+  RETURN_NOT_OK(exchange.writer->Close());
+  return PerformanceResult{static_cast<int64_t>(batches.size()), num_records, num_bytes};
+}
+
 Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_options,
-                       const FlightCallOptions& call_options, bool test_put,
-                       PerformanceStats* stats) {
+                       const FlightCallOptions& call_options, PerfMethod method,
+                       int num_threads, PerformanceStats* stats) {
   // schema not needed
   perf::Perf perf;
   perf.set_stream_count(FLAGS_num_streams);
   perf.set_records_per_stream(FLAGS_records_per_stream);
   perf.set_records_per_batch(FLAGS_records_per_batch);
+  if (FLAGS_data_type != "int64") {
+    ARROW_ASSIGN_OR_RAISE(auto schema, GetPerfSchema());
+    ARROW_ASSIGN_OR_RAISE(auto serialized_schema, ipc::SerializeSchema(*schema));
+    perf.set_schema(serialized_schema->ToString());
+  }
+  if (!FLAGS_compression.empty()) {
+    std::string name;
+    int level;
+    ParseCompression(FLAGS_compression, &name, &level);
+    perf.set_compression_codec(name);
+    perf.set_compression_level(level == arrow::util::kUseDefaultCompressionLevel ? 0
+                                                                                 : level);
+  }
 
   // Plan the query
   FlightDescriptor descriptor;
@@ -298,7 +452,9 @@ Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_op
 
   int64_t start_total_records = stats->total_records;
 
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
+  auto test_loop = method == PerfMethod::kDoPut        ? &RunDoPutTest
+                   : method == PerfMethod::kDoExchange ? &RunDoExchangeTest
+                                                       : &RunDoGetTest;
   auto ConsumeStream = [&client, &stats, &test_loop, &client_options,
                         &call_options](const FlightEndpoint& endpoint) {
     std::unique_ptr<FlightClient> local_client;
@@ -328,7 +484,7 @@ Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_op
   //   RETURN_NOT_OK(ConsumeStream(endpoint));
   // }
 
-  ARROW_ASSIGN_OR_RAISE(auto pool, ThreadPool::Make(FLAGS_num_threads));
+  ARROW_ASSIGN_OR_RAISE(auto pool, ThreadPool::Make(num_threads));
   std::vector<Future<>> tasks;
   for (const auto& endpoint : plan->endpoints()) {
     ARROW_ASSIGN_OR_RAISE(auto task, pool->Submit(ConsumeStream, endpoint));
@@ -352,14 +508,15 @@ Status DoSinglePerfRun(FlightClient* client, const FlightClientOptions client_op
 }
 
 Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& client_options,
-                          const FlightCallOptions& call_options, bool test_put) {
+                          const FlightCallOptions& call_options, PerfMethod method,
+                          int num_threads, std::ostream* json_output) {
   StopWatch timer;
   timer.Start();
 
   PerformanceStats stats;
   for (int i = 0; i < FLAGS_num_perf_runs; ++i) {
-    RETURN_NOT_OK(
-        DoSinglePerfRun(client, client_options, call_options, test_put, &stats));
+    RETURN_NOT_OK(DoSinglePerfRun(client, client_options, call_options, method,
+                                  num_threads, &stats));
   }
 
   // Elapsed time in seconds
@@ -368,26 +525,26 @@ Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& clien
       static_cast<double>(elapsed_nanos) / static_cast<double>(1000000000);
 
   constexpr double kMegabyte = static_cast<double>(1 << 20);
+  const double speed = static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed;
+  const double throughput = static_cast<double>(stats.total_batches) / time_elapsed;
 
   std::cout << "Number of perf runs: " << FLAGS_num_perf_runs << std::endl;
-  std::cout << "Number of concurrent gets/puts: " << FLAGS_num_threads << std::endl;
+  std::cout << "Number of concurrent " << PerfMethodName(method)
+            << " calls: " << num_threads << std::endl;
   std::cout << "Batch size: " << stats.total_bytes / stats.total_batches << std::endl;
-  if (FLAGS_test_put) {
-    std::cout << "Batches written: " << stats.total_batches << std::endl;
-    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
-  } else {
+  if (method == PerfMethod::kDoGet) {
     std::cout << "Batches read: " << stats.total_batches << std::endl;
     std::cout << "Bytes read: " << stats.total_bytes << std::endl;
+  } else {
+    std::cout << "Batches written: " << stats.total_batches << std::endl;
+    std::cout << "Bytes written: " << stats.total_bytes << std::endl;
   }
 
   std::cout << "Nanos: " << elapsed_nanos << std::endl;
-  std::cout << "Speed: "
-            << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
-            << " MB/s" << std::endl;
+  std::cout << "Speed: " << speed << " MB/s" << std::endl;
 
   // Calculate throughput(IOPS) and latency vs batch size
-  std::cout << "Throughput: " << (static_cast<double>(stats.total_batches) / time_elapsed)
-            << " batches/s" << std::endl;
+  std::cout << "Throughput: " << throughput << " batches/s" << std::endl;
   std::cout << "Latency mean: " << stats.mean_latency() << " us" << std::endl;
   for (auto q : stats.quantiles) {
     std::cout << "Latency quantile=" << q << ": " << stats.quantile_latency(q) << " us"
@@ -395,6 +552,28 @@ Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& clien
   }
   std::cout << "Latency max: " << stats.max_latency() << " us" << std::endl;
 
+  if (json_output) {
+    // The flag values are plain identifiers, so that they need no escaping
+    *json_output << "{\"method\": \"" << PerfMethodName(method) << "\", \"transport\": \""
+                 << FLAGS_transport << "\", \"data_type\": \"" << FLAGS_data_type
+                 << "\", \"compression\": \"" << FLAGS_compression
+                 << "\", \"num_threads\": " << num_threads
+                 << ", \"num_streams\": " << FLAGS_num_streams
+                 << ", \"num_perf_runs\": " << FLAGS_num_perf_runs
+                 << ", \"records_per_batch\": " << FLAGS_records_per_batch
+                 << ", \"batches\": " << stats.total_batches
+                 << ", \"records\": " << stats.total_records
+                 << ", \"bytes\": " << stats.total_bytes
+                 << ", \"nanos\": " << elapsed_nanos << ", \"mb_per_sec\": " << speed
+                 << ", \"batches_per_sec\": " << throughput
+                 << ", \"latency_us\": {\"mean\": " << stats.mean_latency();
+    for (auto q : stats.quantiles) {
+      *json_output << ", \"p" << static_cast<int>(q * 100)
+                   << "\": " << stats.quantile_latency(q);
+    }
+    *json_output << ", \"max\": " << stats.max_latency() << "}}" << std::endl;
+  }
+
   return Status::OK();
 }
 
@@ -404,45 +583,52 @@ Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& clien
 int main(int argc, char** argv) {
   gflags::ParseCommandLineFlags(&argc, &argv, true);
 
-  std::cout << "Testing method: ";
-  if (FLAGS_test_put) {
-    std::cout << "DoPut";
+  if (FLAGS_test_put && FLAGS_test_exchange) {
+    std::cerr << "Only one of \"-test_put\" and \"-test_exchange\" may be given"
+              << std::endl;
+    return 1;
+  }
+  const auto method = FLAGS_test_put        ? arrow::flight::PerfMethod::kDoPut
+                      : FLAGS_test_exchange ? arrow::flight::PerfMethod::kDoExchange
+                                            : arrow::flight::PerfMethod::kDoGet;
+  std::cout << "Testing method: " << arrow::flight::PerfMethodName(method) << std::endl;
+  std::cout << "Data type: " << FLAGS_data_type << std::endl;
+  if (!arrow::flight::GetPerfSchema().ok()) {
+    std::cerr << "Unknown data type: " << FLAGS_data_type << std::endl;
+    return 1;
+  }
+
+  std::vector<int> thread_counts;
+  if (FLAGS_num_threads_list.empty()) {
+    thread_counts.push_back(FLAGS_num_threads);
   } else {
-    std::cout << "DoGet";
+    for (const auto& count :
+         arrow::internal::SplitString(FLAGS_num_threads_list, ',')) {
+      thread_counts.push_back(std::stoi(std::string(count)));
+    }
   }
-  std::cout << std::endl;
 
   arrow::flight::FlightCallOptions call_options;
   if (!FLAGS_compression.empty()) {
-    if (!FLAGS_test_put) {
-      std::cerr << "Compression is only useful for Put test now, "
-                   "please append \"-test_put\" to command line"
-                << std::endl;
-      std::abort();
-    }
-
-    // "zstd"   -> name = "zstd", level = default
-    // "zstd:7" -> name = "zstd", level = 7
-    const size_t delim = FLAGS_compression.find(":");
-    const std::string name = FLAGS_compression.substr(0, delim);
-    const std::string level_str =
-        delim == std::string::npos
-            ? ""
-            : FLAGS_compression.substr(delim + 1, FLAGS_compression.length() - delim - 1);
-    const int level = level_str.empty() ? arrow::util::kUseDefaultCompressionLevel
-                                        : std::stoi(level_str);
+    std::string name;
+    int level;
+    arrow::flight::ParseCompression(FLAGS_compression, &name, &level);
     const auto type = arrow::util::Codec::GetCompressionType(name).ValueOrDie();
     auto codec = arrow::util::Codec::Create(type, level).ValueOrDie();
     std::cout << "Compression method: " << name;
-    if (!level_str.empty()) {
+    if (level != arrow::util::kUseDefaultCompressionLevel) {
       std::cout << ", level " << level;
     }
     std::cout << std::endl;
 
+    // The client compresses what it sends, and the server is asked to compress
+    // what it sends back
     call_options.write_options.codec = std::move(codec);
   }
-  if (!FLAGS_data_file.empty() && !FLAGS_test_put) {
-    std::cerr << "A data file can only be specified with \"-test_put\"" << std::endl;
+  if (!FLAGS_data_file.empty() && method == arrow::flight::PerfMethod::kDoGet) {
+    std::cerr << "A data file can only be specified with \"-test_put\" or "
+                 "\"-test_exchange\""
+              << std::endl;
     return 1;
   }
 
@@ -486,12 +672,6 @@ int main(int argc, char** argv) {
       } else {
         std::cout << "Using standalone TCP server" << std::endl;
       }
-      if (server) {
-        if (FLAGS_cuda && FLAGS_test_put) {
-          server_args.push_back("-cuda");
-        }
-        server->Start(server_args);
-      }
       std::cout << "Server host: " << FLAGS_server_host << std::endl
                 << "Server port: " << FLAGS_server_port << std::endl;
       if (FLAGS_cert_file.empty()) {
@@ -513,17 +693,52 @@ int main(int argc, char** argv) {
                 << std::endl;
       return EXIT_FAILURE;
     }
+    if (FLAGS_server_host == "") {
+      FLAGS_server_host = "localhost";
+      std::cout << "Using spawned UCX server" << std::endl;
+      server.reset(
+          new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_port));
+    } else {
+      std::cout << "Using standalone UCX server" << std::endl;
+    }
+    std::cout << "Server host: " << FLAGS_server_host << std::endl
+              << "Server port: " << FLAGS_server_port << std::endl;
     ARROW_CHECK_OK(arrow::flight::Location::Parse("ucx://" + FLAGS_server_host + ":" +
                                                   std::to_string(FLAGS_server_port))
                        .Value(&location));
 #else
     std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
+#endif
+  } else if (FLAGS_transport == "shm") {
+#ifndef _WIN32
+    arrow::flight::transport::shm::InitializeFlightShm();
+    // The server must be on the same host, and listens on a Unix socket
+    if (FLAGS_server_unix == "") {
+      FLAGS_server_unix = "/tmp/flight-bench-spawn-shm.sock";
+      std::cout << "Using spawned shared memory server" << std::endl;
+      server.reset(
+          new arrow::flight::TestServer("arrow-flight-perf-server", FLAGS_server_unix));
+    } else {
+      std::cout << "Using standalone shared memory server" << std::endl;
+    }
+    std::cout << "Server unix socket: " << FLAGS_server_unix << std::endl;
+    ABORT_NOT_OK(
+        arrow::flight::Location::Parse("shm://" + FLAGS_server_unix).Value(&location));
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
 #endif
   } else {
     std::cerr << "Unknown transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
   }
+  if (server) {
+    if (FLAGS_cuda && FLAGS_test_put) {
+      server_args.push_back("-cuda");
+    }
+    server->Start(server_args);
+  }
 
   if (FLAGS_cuda) {
 #ifdef ARROW_CUDA
@@ -553,11 +768,24 @@ int main(int argc, char** argv) {
 #endif
   }
 
-  auto client = arrow::flight::FlightClient::Connect(location, options).ValueOrDie();
-  ABORT_NOT_OK(arrow::flight::WaitForReady(client.get(), call_options));
+  std::ofstream json_file;
+  std::ostream* json_output = nullptr;
+  if (FLAGS_json_output == "-") {
+    json_output = &std::cout;
+  } else if (!FLAGS_json_output.empty()) {
+    json_file.open(FLAGS_json_output, std::ios::app);
+    json_output = &json_file;
+  }
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), options, call_options,
-                                                      FLAGS_test_put);
+  auto client = arrow::flight::ConnectWhenReady(location, options, call_options)
+                    .ValueOrDie();
+
+  arrow::Status s;
+  for (const int num_threads : thread_counts) {
+    s = arrow::flight::RunPerformanceTest(client.get(), options, call_options, method,
+                                          num_threads, json_output);
+    if (!s.ok()) break;
+  }
 
   if (server) {
     server->Stop();
@@ -731,6 +731,68 @@ TEST(GrpcTransport, FlightDataDeserialize) {
 #endif
 }
 
+TEST(GrpcTransport, FlightDataDeserializeSlices) {
+#ifndef _WIN32
+  pb::FlightData raw;
+  std::string body(1000, '\0');
+  for (size_t i = 0; i < body.size(); ++i) {
+    body[i] = static_cast<char>(i * 7);
+  }
+  raw.set_data_header("header");
+  raw.set_app_metadata("app metadata");
+  raw.set_data_body(body);
+  auto serialized = raw.SerializeAsString();
+  const size_t body_offset = serialized.size() - body.size();
+
+  auto deserialize = [&](const std::vector<size_t>& split_points,
+                         flight::internal::FlightData* out,
+                         std::vector<grpc_slice>* slices) {
+    size_t start = 0;
+    for (size_t end : split_points) {
+      slices->push_back(
+          grpc_slice_from_copied_buffer(serialized.data() + start, end - start));
+      start = end;
+    }
+    slices->push_back(grpc_slice_from_copied_buffer(serialized.data() + start,
+                                                    serialized.size() - start));
+    grpc::ByteBuffer buffer(reinterpret_cast<const grpc::Slice*>(slices->data()),
+                            slices->size());
+    return flight::transport::grpc::FlightDataDeserialize(&buffer, out);
+  };
+
+  // Fields split across slices are copied into aligned memory
+  {
+    flight::internal::FlightData out;
+    std::vector<grpc_slice> slices;
+    ASSERT_TRUE(deserialize({3, 9, body_offset + 1, body_offset + 500}, &out, &slices)
+                    .ok());
+    ASSERT_EQ("header", out.metadata->ToString());
+    ASSERT_EQ("app metadata", out.app_metadata->ToString());
+    ASSERT_EQ(body, out.body->ToString());
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(out.body->data()) % 8, 0);
+    for (auto& slice : slices) {
+      grpc_slice_unref(slice);
+    }
+  }
+
+  // A body contained in an aligned slice is referenced
+  {
+    flight::internal::FlightData out;
+    std::vector<grpc_slice> slices;
+    ASSERT_TRUE(deserialize({body_offset}, &out, &slices).ok());
+    ASSERT_EQ(body, out.body->ToString());
+    if (reinterpret_cast<uintptr_t>(GRPC_SLICE_START_PTR(slices[1])) % 8 == 0) {
+      ASSERT_EQ(out.body->data(), GRPC_SLICE_START_PTR(slices[1]));
+    }
+    for (auto& slice : slices) {
+      grpc_slice_unref(slice);
+    }
+  }
+#else
+  GTEST_SKIP() << "Can't use Protobuf symbols on Windows";
+#endif
+}
+
 // ----------------------------------------------------------------------
 // Transport abstraction tests
 
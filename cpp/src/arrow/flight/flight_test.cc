@@ -36,9 +36,11 @@
 #include "arrow/flight/server_tracing_middleware.h"
 #include "arrow/ipc/test_common.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/base64.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
@@ -1133,6 +1135,81 @@ TEST_F(TestFlightClient, Close) {
                                   client_->ListFlights());
 }
 
+TEST_F(TestFlightClient, DoGetEndpoints) {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  ASSERT_OK_AND_ASSIGN(auto location, Location::ForGrpcTcp("localhost", server_->port()));
+  // Read some endpoints with this client, and some with a client connected
+  // to the location
+  std::vector<FlightEndpoint> endpoints;
+  for (int i = 0; i < 8; ++i) {
+    FlightEndpoint endpoint;
+    endpoint.ticket.ticket = "ticket-ints-1";
+    if (i % 3 == 1) endpoint.locations.push_back(Location::ReuseConnection());
+    if (i % 3 == 2) endpoint.locations.push_back(location);
+    endpoints.push_back(std::move(endpoint));
+  }
+  ASSERT_OK_AND_ASSIGN(auto info,
+                       FlightInfo::Make(*ExampleIntSchema(), FlightDescriptor::Path({}),
+                                        endpoints, -1, -1));
+
+  for (const int max_concurrency : {1, 3, 16}) {
+    ARROW_SCOPED_TRACE("max_concurrency = ", max_concurrency);
+    auto options = DoGetEndpointsOptions::Defaults();
+    options.max_concurrency = max_concurrency;
+
+    // Ordered
+    ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints({}, info, options));
+    AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+    for (size_t i = 0; i < endpoints.size(); ++i) {
+      for (const auto& expected : expected_batches) {
+        ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+        ASSERT_NE(batch, nullptr);
+        AssertBatchesEqual(*expected, *batch);
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto end, reader->Next());
+    ASSERT_EQ(end, nullptr);
+    ASSERT_OK(reader->Close());
+
+    // Unordered
+    options.ordered = false;
+    ASSERT_OK_AND_ASSIGN(auto generator, client_->DoGetEndpointsAsync({}, info, options));
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(generator));
+    ASSERT_EQ(batches.size(), endpoints.size() * expected_batches.size());
+    int64_t num_rows = 0;
+    for (const auto& batch : batches) num_rows += batch->num_rows();
+    int64_t expected_rows = 0;
+    for (const auto& batch : expected_batches) expected_rows += batch->num_rows();
+    ASSERT_EQ(num_rows, expected_rows * static_cast<int64_t>(endpoints.size()));
+  }
+
+  // Stop reading early
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints(info));
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+  AssertBatchesEqual(*expected_batches[0], *batch);
+  ASSERT_OK(reader->Close());
+  ASSERT_OK_AND_ASSIGN(batch, reader->Next());
+  ASSERT_EQ(batch, nullptr);
+
+  auto options = DoGetEndpointsOptions::Defaults();
+  options.max_concurrency = 0;
+  ASSERT_RAISES(Invalid, client_->DoGetEndpoints({}, info, options));
+}
+
+TEST_F(TestFlightClient, DoGetEndpointsError) {
+  FlightEndpoint endpoint;
+  endpoint.ticket.ticket = "ticket-ints-1";
+  FlightEndpoint bad_endpoint;
+  bad_endpoint.ticket.ticket = "no-such-ticket";
+  ASSERT_OK_AND_ASSIGN(
+      auto info, FlightInfo::Make(*ExampleIntSchema(), FlightDescriptor::Path({}),
+                                  {endpoint, bad_endpoint, endpoint}, -1, -1));
+
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetEndpoints(info));
+  ASSERT_NOT_OK(reader->ToTable());
+}
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {}, std::make_unique<TestClientAuthHandler>("user", "p4ssw0rd")));
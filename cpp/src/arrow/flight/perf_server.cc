@@ -28,11 +28,14 @@
 #include <gflags/gflags.h>
 
 #include "arrow/array.h"
+#include "arrow/io/memory.h"
 #include "arrow/io/test_common.h"
+#include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/config.h"
 #include "arrow/util/logging.h"
 
@@ -47,6 +50,9 @@
 #ifdef ARROW_WITH_UCX
 #include "arrow/flight/transport/ucx/ucx.h"
 #endif
+#ifndef _WIN32
+#include "arrow/flight/transport/shm/shm.h"
+#endif
 
 DEFINE_bool(cuda, false, "Allocate results in CUDA memory");
 DEFINE_string(transport, "grpc",
@@ -54,10 +60,14 @@ DEFINE_string(transport, "grpc",
 #ifdef ARROW_WITH_UCX
               ", \"ucx\""
 #endif  // ARROW_WITH_UCX
+#ifndef _WIN32
+              ", \"shm\""
+#endif  // _WIN32
               ".");
 DEFINE_string(server_host, "localhost", "Host where the server is running on");
 DEFINE_int32(port, 31337, "Server port to listen on");
-DEFINE_string(server_unix, "", "Unix socket path where the server is running on");
+DEFINE_string(server_unix, "",
+              "Unix socket path where the server is running on (required by \"shm\")");
 DEFINE_string(cert_file, "", "Path to TLS certificate");
 DEFINE_string(key_file, "", "Path to TLS private key");
 
@@ -79,7 +89,8 @@ namespace flight {
 class PerfDataStream : public FlightDataStream {
  public:
   PerfDataStream(bool verify, const int64_t start, const int64_t total_records,
-                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays)
+                 const std::shared_ptr<Schema>& schema, const ArrayVector& arrays,
+                 const ipc::IpcWriteOptions& ipc_options)
       : start_(start),
         verify_(verify),
         batch_length_(arrays[0]->length()),
@@ -87,6 +98,7 @@ class PerfDataStream : public FlightDataStream {
         records_sent_(0),
         schema_(schema),
         mapper_(*schema),
+        ipc_options_(ipc_options),
         arrays_(arrays) {
     batch_ = RecordBatch::Make(schema, batch_length_, arrays_);
   }
@@ -143,23 +155,54 @@ class PerfDataStream : public FlightDataStream {
   ArrayVector arrays_;
 };
 
+// The schema requested by the client, or the default one
+arrow::Result<std::shared_ptr<Schema>> GetPerfSchema(
+    const perf::Perf& perf, const std::shared_ptr<Schema>& default_schema) {
+  if (perf.schema().empty()) {
+    return default_schema;
+  }
+  io::BufferReader schema_reader(std::make_shared<Buffer>(perf.schema()));
+  ipc::DictionaryMemo dict_memo;
+  return ipc::ReadSchema(&schema_reader, &dict_memo);
+}
+
+// The IPC options with the compression requested by the client
+arrow::Result<ipc::IpcWriteOptions> GetPerfWriteOptions(const perf::Perf& perf) {
+  auto options = ipc::IpcWriteOptions::Defaults();
+  if (!perf.compression_codec().empty()) {
+    ARROW_ASSIGN_OR_RAISE(auto type,
+                          util::Codec::GetCompressionType(perf.compression_codec()));
+    const int level = perf.compression_level() == 0 ? util::kUseDefaultCompressionLevel
+                                                    : perf.compression_level();
+    ARROW_ASSIGN_OR_RAISE(options.codec, util::Codec::Create(type, level));
+  }
+  return options;
+}
+
 Status GetPerfBatches(const perf::Token& token, const std::shared_ptr<Schema>& schema,
                       bool use_verifier, std::unique_ptr<FlightDataStream>* data_stream) {
   std::shared_ptr<ResizableBuffer> buffer;
   std::vector<std::shared_ptr<Array>> arrays;
 
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
+  if (token.definition().schema().empty()) {
+    const int32_t ncolumns = 4;
+    for (int i = 0; i < ncolumns; ++i) {
+      RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
+                                         &buffer, static_cast<int32_t>(i) /* seed */));
+      arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+      RETURN_NOT_OK(arrays.back()->Validate());
+    }
+  } else {
+    // Only the default int64 data can be verified
+    use_verifier = false;
+    arrays = random::GenerateBatch(schema->fields(), length, /*seed=*/0)->columns();
   }
+  ARROW_ASSIGN_OR_RAISE(auto ipc_options, GetPerfWriteOptions(token.definition()));
 
-  *data_stream = std::unique_ptr<FlightDataStream>(
-      new PerfDataStream(use_verifier, token.start(),
-                         token.definition().records_per_stream(), schema, arrays));
+  *data_stream = std::unique_ptr<FlightDataStream>(new PerfDataStream(
+      use_verifier, token.start(), token.definition().records_per_stream(), schema,
+      arrays, ipc_options));
   return Status::OK();
 }
 
@@ -176,6 +219,7 @@ class FlightPerfServer : public FlightServerBase {
                        std::unique_ptr<FlightInfo>* info) override {
     perf::Perf perf_request;
     CHECK_PARSE(perf_request.ParseFromString(request.cmd));
+    ARROW_ASSIGN_OR_RAISE(auto schema, GetPerfSchema(perf_request, perf_schema_));
 
     perf::Token token;
     token.mutable_definition()->CopyFrom(perf_request);
@@ -196,7 +240,7 @@ class FlightPerfServer : public FlightServerBase {
         perf_request.stream_count() * perf_request.records_per_stream();
 
     *info = std::make_unique<FlightInfo>(
-        MakeFlightInfo(*perf_schema_, request, endpoints, total_records, -1, false, ""));
+        MakeFlightInfo(*schema, request, endpoints, total_records, -1, false, ""));
     return Status::OK();
   }
 
@@ -204,8 +248,9 @@ class FlightPerfServer : public FlightServerBase {
                std::unique_ptr<FlightDataStream>* data_stream) override {
     perf::Token token;
     CHECK_PARSE(token.ParseFromString(request.ticket));
+    ARROW_ASSIGN_OR_RAISE(auto schema, GetPerfSchema(token.definition(), perf_schema_));
     // This must also be set in flight_benchmark.cc
-    return GetPerfBatches(token, perf_schema_, /*verify=*/false, data_stream);
+    return GetPerfBatches(token, schema, /*verify=*/false, data_stream);
   }
 
   Status DoPut(const ServerCallContext& context,
@@ -222,6 +267,24 @@ class FlightPerfServer : public FlightServerBase {
     return Status::OK();
   }
 
+  // Send the batches back as they are received
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    perf::Perf perf_request;
+    CHECK_PARSE(perf_request.ParseFromString(reader->descriptor().cmd));
+    ARROW_ASSIGN_OR_RAISE(auto write_options, GetPerfWriteOptions(perf_request));
+    ARROW_ASSIGN_OR_RAISE(auto schema, reader->GetSchema());
+    RETURN_NOT_OK(writer->Begin(schema, write_options));
+    FlightStreamChunk chunk;
+    while (true) {
+      ARROW_ASSIGN_OR_RAISE(chunk, reader->Next());
+      if (!chunk.data) break;
+      RETURN_NOT_OK(writer->WriteRecordBatch(*chunk.data));
+    }
+    return Status::OK();
+  }
+
   Status DoAction(const ServerCallContext& context, const Action& action,
                   std::unique_ptr<ResultStream>* result) override {
     if (action.type == "ping") {
@@ -302,6 +365,25 @@ int main(int argc, char** argv) {
 #else
     std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
     return EXIT_FAILURE;
+#endif
+  } else if (FLAGS_transport == "shm") {
+#ifndef _WIN32
+    arrow::flight::transport::shm::InitializeFlightShm();
+    if (FLAGS_server_unix.empty()) {
+      std::cerr << "Transport requires a Unix socket path: " << FLAGS_transport
+                << std::endl;
+      return EXIT_FAILURE;
+    }
+    if (!FLAGS_cert_file.empty() || !FLAGS_key_file.empty()) {
+      std::cerr << "Transport does not support TLS: " << FLAGS_transport << std::endl;
+      return EXIT_FAILURE;
+    }
+    ARROW_CHECK_OK(arrow::flight::Location::Parse("shm://" + FLAGS_server_unix)
+                       .Value(&bind_location));
+    connect_location = bind_location;
+#else
+    std::cerr << "Not built with transport: " << FLAGS_transport << std::endl;
+    return EXIT_FAILURE;
 #endif
   } else {
     std::cerr << "Unknown transport: " << FLAGS_transport << std::endl;
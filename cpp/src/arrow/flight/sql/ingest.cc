@@ -0,0 +1,208 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/sql/ingest.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/byte_size.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+IngestOptions IngestOptions::Defaults() { return IngestOptions(); }
+
+namespace {
+
+/// \brief Concatenate small batches until they reach the targets.
+class BatchCoalescer {
+ public:
+  explicit BatchCoalescer(const IngestOptions& options) : options_(options) {}
+
+  /// \brief Add a batch. Return a batch to write if a target is
+  ///   reached, else null.
+  arrow::Result<std::shared_ptr<RecordBatch>> Append(std::shared_ptr<RecordBatch> batch) {
+    if (batch->num_rows() == 0) return nullptr;
+    rows_ += batch->num_rows();
+    bytes_ += util::TotalBufferSize(*batch);
+    pending_.push_back(std::move(batch));
+    if ((options_.target_batch_rows > 0 && rows_ >= options_.target_batch_rows) ||
+        (options_.target_batch_bytes > 0 && bytes_ >= options_.target_batch_bytes) ||
+        (options_.target_batch_rows <= 0 && options_.target_batch_bytes <= 0)) {
+      return Flush();
+    }
+    return nullptr;
+  }
+
+  /// \brief Return the pending batches as one, or null if none.
+  arrow::Result<std::shared_ptr<RecordBatch>> Flush() {
+    std::shared_ptr<RecordBatch> batch;
+    if (pending_.size() == 1) {
+      batch = std::move(pending_[0]);
+    } else if (pending_.size() > 1) {
+      ARROW_ASSIGN_OR_RAISE(batch,
+                            ConcatenateRecordBatches(pending_, options_.memory_pool));
+    }
+    pending_.clear();
+    rows_ = bytes_ = 0;
+    return batch;
+  }
+
+ private:
+  const IngestOptions& options_;
+  RecordBatchVector pending_;
+  int64_t rows_ = 0;
+  int64_t bytes_ = 0;
+};
+
+/// \brief Write batches to a sink from a dedicated thread, holding
+///   at most max_pending_bytes of batches in the meantime.
+class SinkWorker {
+ public:
+  SinkWorker(IngestSink* sink, int64_t max_pending_bytes)
+      : sink_(sink), max_pending_bytes_(max_pending_bytes) {
+    thread_ = std::thread([this] { Run(); });
+  }
+
+  ~SinkWorker() { ARROW_CHECK(!thread_.joinable()); }
+
+  /// \brief Queue a batch, waiting for the sink to catch up if needed.
+  ///
+  /// Returns the error of the sink if it failed.
+  Status Push(std::shared_ptr<RecordBatch> batch) {
+    const int64_t bytes = util::TotalBufferSize(*batch);
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Always accept a batch if none is pending, however large
+    cv_.wait(lock, [&] {
+      return !status_.ok() || pending_bytes_ == 0 ||
+             pending_bytes_ + bytes <= max_pending_bytes_;
+    });
+    RETURN_NOT_OK(status_);
+    pending_bytes_ += bytes;
+    queue_.emplace_back(std::move(batch), bytes);
+    cv_.notify_all();
+    return Status::OK();
+  }
+
+  /// \brief Stop the thread, after writing the queued batches unless
+  ///   aborting, and return the status of the sink.
+  Status Join(bool abort) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      if (abort) queue_.clear();
+      cv_.notify_all();
+    }
+    thread_.join();
+    return status_;
+  }
+
+ private:
+  void Run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock, [&] { return !queue_.empty() || closed_; });
+      if (queue_.empty()) break;
+      auto [batch, bytes] = std::move(queue_.front());
+      queue_.pop_front();
+      lock.unlock();
+      Status st = sink_->Write(batch);
+      batch.reset();
+      lock.lock();
+      pending_bytes_ -= bytes;
+      if (!st.ok()) {
+        status_ = std::move(st);
+        queue_.clear();
+        cv_.notify_all();
+        break;
+      }
+      cv_.notify_all();
+    }
+  }
+
+  IngestSink* sink_;
+  const int64_t max_pending_bytes_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::pair<std::shared_ptr<RecordBatch>, int64_t>> queue_;
+  int64_t pending_bytes_ = 0;
+  bool closed_ = false;
+  Status status_;
+  std::thread thread_;
+};
+
+using WriteBatchFunc = std::function<Status(std::shared_ptr<RecordBatch>)>;
+
+/// \brief Read and coalesce the batches of an upload.
+arrow::Result<int64_t> ReadBatches(MetadataRecordBatchReader* reader,
+                                   const IngestOptions& options,
+                                   const WriteBatchFunc& write) {
+  BatchCoalescer coalescer(options);
+  int64_t num_rows = 0;
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(FlightStreamChunk chunk, reader->Next());
+    if (!chunk.data) {
+      if (chunk.app_metadata) continue;
+      break;
+    }
+    num_rows += chunk.data->num_rows();
+    ARROW_ASSIGN_OR_RAISE(auto batch, coalescer.Append(std::move(chunk.data)));
+    if (batch) RETURN_NOT_OK(write(std::move(batch)));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto batch, coalescer.Flush());
+  if (batch) RETURN_NOT_OK(write(std::move(batch)));
+  return num_rows;
+}
+
+}  // namespace
+
+arrow::Result<int64_t> IngestBatches(MetadataRecordBatchReader* reader,
+                                     IngestSink* sink, const IngestOptions& options) {
+  if (options.max_pending_bytes <= 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t num_rows,
+        ReadBatches(reader, options, [&](std::shared_ptr<RecordBatch> batch) {
+          return sink->Write(batch);
+        }));
+    RETURN_NOT_OK(sink->Finish());
+    return num_rows;
+  }
+
+  SinkWorker worker(sink, options.max_pending_bytes);
+  auto maybe_num_rows =
+      ReadBatches(reader, options, [&](std::shared_ptr<RecordBatch> batch) {
+        return worker.Push(std::move(batch));
+      });
+  // Prefer the error of the sink, which a failed Push returns as well
+  Status sink_status = worker.Join(/*abort=*/!maybe_num_rows.ok());
+  RETURN_NOT_OK(sink_status);
+  RETURN_NOT_OK(maybe_num_rows);
+  RETURN_NOT_OK(sink->Finish());
+  return maybe_num_rows;
+}
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
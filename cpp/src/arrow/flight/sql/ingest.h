@@ -0,0 +1,94 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers for servers receiving bulk uploads of record batches.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/flight/sql/visibility.h"
+#include "arrow/flight/types.h"
+#include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+/// \brief Options for IngestBatches.
+struct ARROW_FLIGHT_SQL_EXPORT IngestOptions {
+  /// \brief Coalesce the uploaded batches until they hold this many
+  ///   rows. 0 disables coalescing by row count.
+  int64_t target_batch_rows = 128 * 1024;
+  /// \brief Coalesce the uploaded batches until they hold this many
+  ///   bytes. 0 disables coalescing by size.
+  ///
+  /// A batch is passed to the sink as soon as either target is
+  /// reached. Batches reaching a target on their own are passed as-is,
+  /// without copying.
+  int64_t target_batch_bytes = 16 * 1024 * 1024;
+  /// \brief The maximum size of the batches read but not yet written
+  ///   by the sink.
+  ///
+  /// If positive, the sink runs on its own thread, so that it writes
+  /// a batch while the next ones are read. Past this size, reading
+  /// stops until the sink catches up, which in turn makes the transport
+  /// pause the client. If 0, the sink runs on the reading thread.
+  int64_t max_pending_bytes = 64 * 1024 * 1024;
+  /// \brief The memory pool of the coalesced batches.
+  MemoryPool* memory_pool = default_memory_pool();
+
+  static IngestOptions Defaults();
+};
+
+/// \brief The destination of the batches of an upload, e.g. a table
+///   being appended to or a dataset writer.
+class ARROW_FLIGHT_SQL_EXPORT IngestSink {
+ public:
+  virtual ~IngestSink() = default;
+
+  /// \brief Write a batch. Calls are never concurrent.
+  ///
+  /// An error stops the upload and is returned to the client.
+  virtual Status Write(const std::shared_ptr<RecordBatch>& batch) = 0;
+  /// \brief Called once all the batches are written, unless the
+  ///   upload failed.
+  virtual Status Finish() { return Status::OK(); }
+};
+
+/// \brief Read all the batches of an upload into a sink.
+///
+/// Meant for implementations of e.g. DoPutPreparedStatementUpdate, to
+/// store uploads made of many small batches efficiently. Messages
+/// carrying only application metadata are ignored.
+///
+/// \param[in] reader The uploaded batches, usually a FlightMessageReader.
+/// \param[in] sink Where to write the batches.
+/// \param[in] options How to coalesce and pipeline the batches.
+/// \return The number of rows ingested.
+ARROW_FLIGHT_SQL_EXPORT
+arrow::Result<int64_t> IngestBatches(
+    MetadataRecordBatchReader* reader, IngestSink* sink,
+    const IngestOptions& options = IngestOptions::Defaults());
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,240 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/sql/ingest.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+#include "arrow/util/byte_size.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+/// \brief A reader of in-memory batches, interleaved with
+///   metadata-only messages, that may fail after some batches.
+class VectorMetadataReader : public MetadataRecordBatchReader {
+ public:
+  explicit VectorMetadataReader(RecordBatchVector batches, int fail_after = -1)
+      : batches_(std::move(batches)), fail_after_(fail_after) {}
+
+  arrow::Result<std::shared_ptr<Schema>> GetSchema() override {
+    return batches_[0]->schema();
+  }
+
+  arrow::Result<FlightStreamChunk> Next() override {
+    FlightStreamChunk chunk;
+    if (metadata_next_) {
+      metadata_next_ = false;
+      chunk.app_metadata = Buffer::FromString("metadata");
+      return chunk;
+    }
+    const int index = num_read_.load();
+    if (index == fail_after_) return Status::IOError("Connection lost");
+    if (index < static_cast<int>(batches_.size())) {
+      chunk.data = batches_[index];
+      metadata_next_ = index % 10 == 0;
+      num_read_.store(index + 1);
+    }
+    return chunk;
+  }
+
+  int num_read() const { return num_read_.load(); }
+
+ private:
+  RecordBatchVector batches_;
+  int fail_after_;
+  bool metadata_next_ = false;
+  std::atomic<int> num_read_{0};
+};
+
+/// \brief A sink keeping the batches, which may fail or wait to be
+///   released.
+class CollectingSink : public IngestSink {
+ public:
+  Status Write(const std::shared_ptr<RecordBatch>& batch) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [&] { return released_; });
+    if (static_cast<int>(batches.size()) == fail_after) {
+      return Status::IOError("Disk full");
+    }
+    batches.push_back(batch);
+    return Status::OK();
+  }
+
+  Status Finish() override {
+    finished = true;
+    return Status::OK();
+  }
+
+  void Hold() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    released_ = false;
+  }
+
+  void Release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    released_ = true;
+    cv_.notify_all();
+  }
+
+  RecordBatchVector batches;
+  int fail_after = -1;
+  bool finished = false;
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool released_ = true;
+};
+
+RecordBatchVector MakeBatches(int num_batches, int64_t length) {
+  random::RandomArrayGenerator rng(/*seed=*/42);
+  auto schema = arrow::schema({field("a", int64()), field("b", utf8())});
+  RecordBatchVector batches;
+  for (int i = 0; i < num_batches; ++i) {
+    batches.push_back(rng.BatchOf(schema->fields(), length));
+  }
+  return batches;
+}
+
+void AssertSameRows(const RecordBatchVector& expected, const RecordBatchVector& actual) {
+  ASSERT_OK_AND_ASSIGN(auto expected_table, Table::FromRecordBatches(expected));
+  ASSERT_OK_AND_ASSIGN(auto actual_table,
+                       Table::FromRecordBatches(expected_table->schema(), actual));
+  AssertTablesEqual(*expected_table, *actual_table, /*same_chunk_layout=*/false);
+}
+
+class TestIngest : public ::testing::TestWithParam<bool> {
+ public:
+  IngestOptions MakeOptions() {
+    auto options = IngestOptions::Defaults();
+    // Run the sink on the reading thread or on its own
+    if (!GetParam()) options.max_pending_bytes = 0;
+    return options;
+  }
+};
+
+TEST_P(TestIngest, CoalesceByRows) {
+  auto batches = MakeBatches(/*num_batches=*/100, /*length=*/10);
+  VectorMetadataReader reader(batches);
+  CollectingSink sink;
+  auto options = MakeOptions();
+  options.target_batch_rows = 250;
+  options.target_batch_bytes = 0;
+
+  ASSERT_OK_AND_EQ(1000, IngestBatches(&reader, &sink, options));
+  ASSERT_TRUE(sink.finished);
+  ASSERT_EQ(sink.batches.size(), 4u);
+  for (const auto& batch : sink.batches) {
+    ASSERT_EQ(batch->num_rows(), 250);
+  }
+  AssertSameRows(batches, sink.batches);
+}
+
+TEST_P(TestIngest, CoalesceByBytes) {
+  auto batches = MakeBatches(/*num_batches=*/50, /*length=*/100);
+  VectorMetadataReader reader(batches);
+  CollectingSink sink;
+  auto options = MakeOptions();
+  options.target_batch_rows = 0;
+  options.target_batch_bytes = 1024;
+
+  ASSERT_OK_AND_EQ(5000, IngestBatches(&reader, &sink, options));
+  ASSERT_GT(sink.batches.size(), 1u);
+  ASSERT_LT(sink.batches.size(), batches.size());
+  AssertSameRows(batches, sink.batches);
+}
+
+TEST_P(TestIngest, LargeBatchesAreNotCopied) {
+  auto batches = MakeBatches(/*num_batches=*/5, /*length=*/1000);
+  VectorMetadataReader reader(batches);
+  CollectingSink sink;
+  auto options = MakeOptions();
+  options.target_batch_rows = 1000;
+
+  ASSERT_OK_AND_EQ(5000, IngestBatches(&reader, &sink, options));
+  ASSERT_EQ(sink.batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_EQ(sink.batches[i], batches[i]);
+  }
+}
+
+TEST_P(TestIngest, ReaderError) {
+  auto batches = MakeBatches(/*num_batches=*/20, /*length=*/10);
+  VectorMetadataReader reader(batches, /*fail_after=*/15);
+  CollectingSink sink;
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, ::testing::HasSubstr("Connection lost"),
+                                  IngestBatches(&reader, &sink, MakeOptions()));
+  ASSERT_FALSE(sink.finished);
+}
+
+TEST_P(TestIngest, SinkError) {
+  auto batches = MakeBatches(/*num_batches=*/20, /*length=*/10);
+  VectorMetadataReader reader(batches);
+  CollectingSink sink;
+  sink.fail_after = 2;
+  auto options = MakeOptions();
+  options.target_batch_rows = 10;
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(IOError, ::testing::HasSubstr("Disk full"),
+                                  IngestBatches(&reader, &sink, options));
+  ASSERT_FALSE(sink.finished);
+  ASSERT_EQ(sink.batches.size(), 2u);
+}
+
+INSTANTIATE_TEST_SUITE_P(Ingest, TestIngest, ::testing::Bool(),
+                         [](const ::testing::TestParamInfo<bool>& info) {
+                           return info.param ? "Pipelined" : "Synchronous";
+                         });
+
+TEST(TestIngestBackpressure, ReadingWaitsForSink) {
+  auto batches = MakeBatches(/*num_batches=*/50, /*length=*/100);
+  const int64_t batch_size = util::TotalBufferSize(*batches[0]);
+  VectorMetadataReader reader(batches);
+  CollectingSink sink;
+  auto options = IngestOptions::Defaults();
+  options.target_batch_rows = 100;
+  options.max_pending_bytes = 3 * batch_size;
+
+  sink.Hold();
+  auto future = std::async(std::launch::async,
+                           [&] { return IngestBatches(&reader, &sink, options); });
+  SleepFor(0.1);
+  // One batch is held by the sink and up to three are queued
+  ASSERT_LE(reader.num_read(), 5);
+  sink.Release();
+  ASSERT_OK_AND_EQ(5000, future.get());
+  AssertSameRows(batches, sink.batches);
+}
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,447 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/sql/result_cache.h"
+
+#include <atomic>
+#include <cctype>
+#include <list>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/sql/server_session_middleware.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+using arrow::internal::checked_cast;
+
+ResultCacheOptions ResultCacheOptions::Defaults() { return ResultCacheOptions(); }
+
+namespace {
+
+/// \brief Append a length-prefixed string, so that the concatenated
+///   parts of a key are unambiguous.
+void AppendKeyPart(std::string* key, std::string_view part) {
+  key->append(std::to_string(part.size()));
+  key->push_back(':');
+  key->append(part);
+}
+
+void AppendSessionOption(std::string* key, const SessionOptionValue& value) {
+  key->append(std::to_string(value.index()));
+  std::visit(
+      [&](const auto& v) {
+        using T = std::decay_t<decltype(v)>;
+        if constexpr (std::is_same_v<T, std::string>) {
+          AppendKeyPart(key, v);
+        } else if constexpr (std::is_same_v<T, std::vector<std::string>>) {
+          key->append(std::to_string(v.size()));
+          for (const auto& item : v) AppendKeyPart(key, item);
+        } else if constexpr (std::is_arithmetic_v<T>) {
+          key->append(reinterpret_cast<const char*>(&v), sizeof(v));
+        }
+      },
+      value);
+}
+
+/// \brief Identify the peer of a call and the options of its session,
+///   which may change the results of a query.
+arrow::Result<std::string> CallerKey(const ServerCallContext& context) {
+  std::string key;
+  AppendKeyPart(&key, context.peer_identity());
+  auto* middleware = context.GetMiddleware(ServerSessionMiddleware::kMiddlewareName);
+  if (middleware != nullptr) {
+    auto* session_middleware = checked_cast<ServerSessionMiddleware*>(middleware);
+    if (session_middleware->HasSession()) {
+      ARROW_ASSIGN_OR_RAISE(auto session, session_middleware->GetSession());
+      if (session) {
+        for (const auto& [name, value] : session->GetSessionOptions()) {
+          AppendKeyPart(&key, name);
+          AppendSessionOption(&key, value);
+        }
+      }
+    }
+  }
+  key.push_back('|');
+  return key;
+}
+
+int64_t PayloadSize(const FlightPayload& payload) {
+  int64_t size = payload.ipc_message.body_length;
+  if (payload.ipc_message.metadata) size += payload.ipc_message.metadata->size();
+  if (payload.app_metadata) size += payload.app_metadata->size();
+  return size;
+}
+
+struct CachedResult {
+  std::shared_ptr<Schema> schema;
+  FlightPayload schema_payload;
+  std::vector<FlightPayload> payloads;
+  int64_t size = 0;
+};
+
+/// \brief Replay the payloads of a cached result.
+class CachedResultStream : public FlightDataStream {
+ public:
+  explicit CachedResultStream(std::shared_ptr<const CachedResult> result)
+      : result_(std::move(result)) {}
+
+  std::shared_ptr<Schema> schema() override { return result_->schema; }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() override {
+    return result_->schema_payload;
+  }
+
+  arrow::Result<FlightPayload> Next() override {
+    if (position_ >= result_->payloads.size()) return FlightPayload();
+    return result_->payloads[position_++];
+  }
+
+ private:
+  std::shared_ptr<const CachedResult> result_;
+  size_t position_ = 0;
+};
+
+/// \brief Pass the payloads of a stream through, keeping them to add
+///   them to the cache once the stream is completely read.
+class RecordingStream : public FlightDataStream {
+ public:
+  using OnComplete = std::function<void(std::shared_ptr<const CachedResult>)>;
+
+  RecordingStream(OnComplete on_complete, int64_t max_bytes,
+                  std::unique_ptr<FlightDataStream> stream)
+      : on_complete_(std::move(on_complete)),
+        max_bytes_(max_bytes),
+        stream_(std::move(stream)),
+        result_(std::make_shared<CachedResult>()) {
+    result_->schema = stream_->schema();
+  }
+
+  std::shared_ptr<Schema> schema() override { return stream_->schema(); }
+
+  arrow::Result<FlightPayload> GetSchemaPayload() override {
+    ARROW_ASSIGN_OR_RAISE(auto payload, stream_->GetSchemaPayload());
+    if (result_ && Reserve(payload)) {
+      result_->schema_payload = payload;
+      has_schema_payload_ = true;
+    }
+    return payload;
+  }
+
+  arrow::Result<FlightPayload> Next() override {
+    ARROW_ASSIGN_OR_RAISE(auto payload, stream_->Next());
+    if (!result_) return payload;
+    if (!payload.ipc_message.metadata) {
+      if (has_schema_payload_) on_complete_(std::move(result_));
+      result_.reset();
+    } else if (Reserve(payload)) {
+      result_->payloads.push_back(payload);
+    }
+    return payload;
+  }
+
+  Status Close() override { return stream_->Close(); }
+
+ private:
+  /// \brief Account for a payload, giving up on the result if it is
+  ///   too large.
+  bool Reserve(const FlightPayload& payload) {
+    result_->size += PayloadSize(payload);
+    if (result_->size > max_bytes_) {
+      result_.reset();
+      return false;
+    }
+    return true;
+  }
+
+  OnComplete on_complete_;
+  int64_t max_bytes_;
+  std::unique_ptr<FlightDataStream> stream_;
+  std::shared_ptr<CachedResult> result_;
+  bool has_schema_payload_ = false;
+};
+
+}  // namespace
+
+class ResultCache::Impl {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /// \brief The state of a query.
+  struct Entry {
+    std::string query;
+    std::unique_ptr<FlightInfo> info;
+    /// The results of the tickets of the FlightInfo, null until read
+    std::unordered_map<std::string, std::shared_ptr<const CachedResult>> results;
+    int64_t size = 0;
+    Clock::time_point expiry;
+    std::list<std::string>::iterator lru_position;
+  };
+
+  explicit Impl(ResultCacheOptions options) : options_(std::move(options)) {}
+
+  const ResultCacheOptions& options() const { return options_; }
+
+  std::unique_ptr<FlightInfo> GetFlightInfo(const std::string& entry_key,
+                                            const FlightDescriptor& descriptor) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry* entry = FindEntry(entry_key);
+    if (entry == nullptr) return nullptr;
+    for (const auto& [ticket_key, result] : entry->results) {
+      if (!result) return nullptr;
+    }
+    Touch(entry);
+    num_hits_.fetch_add(1);
+    const FlightInfo& info = *entry->info;
+    FlightInfo::Data data;
+    data.schema = info.serialized_schema();
+    data.descriptor = descriptor;
+    data.endpoints = info.endpoints();
+    data.total_records = info.total_records();
+    data.total_bytes = info.total_bytes();
+    data.ordered = info.ordered();
+    data.app_metadata = info.app_metadata();
+    return std::make_unique<FlightInfo>(std::move(data));
+  }
+
+  void PutFlightInfo(const std::string& entry_key, std::string query,
+                     std::vector<std::string> ticket_keys, const FlightInfo& info) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(entry_key);
+    if (it != entries_.end()) EraseEntry(it);
+
+    Entry entry;
+    entry.query = std::move(query);
+    entry.info = std::make_unique<FlightInfo>(info);
+    entry.expiry = Clock::now() + std::chrono::duration_cast<Clock::duration>(
+                                      options_.time_to_live);
+    lru_.push_front(entry_key);
+    entry.lru_position = lru_.begin();
+    for (auto& ticket_key : ticket_keys) {
+      tickets_[ticket_key] = entry_key;
+      entry.results.emplace(std::move(ticket_key), nullptr);
+    }
+    entries_.emplace(entry_key, std::move(entry));
+  }
+
+  std::shared_ptr<const CachedResult> GetResult(const std::string& ticket_key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Entry* entry = FindTicketEntry(ticket_key);
+    if (entry == nullptr) return nullptr;
+    auto result = entry->results[ticket_key];
+    if (result) Touch(entry);
+    return result;
+  }
+
+  /// \brief Get the entry and generation to record the result of a
+  ///   ticket under, if any.
+  bool PrepareRecord(const std::string& ticket_key, std::string* entry_key,
+                     uint64_t* generation) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (FindTicketEntry(ticket_key) == nullptr) return false;
+    *entry_key = tickets_[ticket_key];
+    *generation = generation_;
+    return true;
+  }
+
+  void AddResult(const std::string& entry_key, const std::string& ticket_key,
+                 uint64_t generation, std::shared_ptr<const CachedResult> result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // Drop results read across an invalidation
+    if (generation != generation_) return;
+    Entry* entry = FindEntry(entry_key);
+    if (entry == nullptr) return;
+    auto it = entry->results.find(ticket_key);
+    if (it == entry->results.end() || it->second) return;
+    entry->size += result->size;
+    size_bytes_ += result->size;
+    it->second = std::move(result);
+    Touch(entry);
+    while (size_bytes_ > options_.max_bytes && !lru_.empty()) {
+      EraseEntry(entries_.find(lru_.back()));
+    }
+  }
+
+  void Invalidate(const std::function<bool(const std::string&)>& predicate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      auto current = it++;
+      if (!predicate || predicate(current->second.query)) EraseEntry(current);
+    }
+  }
+
+  int64_t size_bytes() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_bytes_;
+  }
+
+  int64_t num_hits() const { return num_hits_.load(); }
+
+ private:
+  // The following require the lock
+
+  Entry* FindEntry(const std::string& entry_key) {
+    auto it = entries_.find(entry_key);
+    if (it == entries_.end()) return nullptr;
+    if (Clock::now() >= it->second.expiry) {
+      EraseEntry(it);
+      return nullptr;
+    }
+    return &it->second;
+  }
+
+  Entry* FindTicketEntry(const std::string& ticket_key) {
+    auto it = tickets_.find(ticket_key);
+    if (it == tickets_.end()) return nullptr;
+    return FindEntry(it->second);
+  }
+
+  void Touch(Entry* entry) {
+    lru_.splice(lru_.begin(), lru_, entry->lru_position);
+  }
+
+  void EraseEntry(std::unordered_map<std::string, Entry>::iterator it) {
+    for (const auto& [ticket_key, result] : it->second.results) {
+      auto ticket_it = tickets_.find(ticket_key);
+      if (ticket_it != tickets_.end() && ticket_it->second == it->first) {
+        tickets_.erase(ticket_it);
+      }
+    }
+    size_bytes_ -= it->second.size;
+    lru_.erase(it->second.lru_position);
+    entries_.erase(it);
+  }
+
+  const ResultCacheOptions options_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  // The entry of each ticket
+  std::unordered_map<std::string, std::string> tickets_;
+  // The entries, most recently used first
+  std::list<std::string> lru_;
+  int64_t size_bytes_ = 0;
+  // Incremented by each invalidation
+  uint64_t generation_ = 0;
+  std::atomic<int64_t> num_hits_{0};
+};
+
+ResultCache::ResultCache(ResultCacheOptions options)
+    : impl_(std::make_shared<Impl>(std::move(options))) {}
+
+ResultCache::~ResultCache() = default;
+
+std::string ResultCache::NormalizeQuery(std::string_view query) {
+  std::string normalized;
+  normalized.reserve(query.size());
+  char quote = 0;
+  bool pending_space = false;
+  for (char c : query) {
+    if (quote != 0) {
+      normalized.push_back(c);
+      if (c == quote) quote = 0;
+      continue;
+    }
+    if (std::isspace(static_cast<unsigned char>(c))) {
+      pending_space = true;
+      continue;
+    }
+    if (pending_space && !normalized.empty()) normalized.push_back(' ');
+    pending_space = false;
+    if (c == '\'' || c == '"') quote = c;
+    normalized.push_back(c);
+  }
+  while (quote == 0 && !normalized.empty() &&
+         (normalized.back() == ';' || normalized.back() == ' ')) {
+    normalized.pop_back();
+  }
+  return normalized;
+}
+
+arrow::Result<std::unique_ptr<FlightInfo>> ResultCache::GetFlightInfo(
+    const ServerCallContext& context, std::string_view query,
+    const FlightDescriptor& descriptor) {
+  ARROW_ASSIGN_OR_RAISE(std::string entry_key, CallerKey(context));
+  AppendKeyPart(&entry_key, NormalizeQuery(query));
+  return impl_->GetFlightInfo(entry_key, descriptor);
+}
+
+Status ResultCache::PutFlightInfo(const ServerCallContext& context,
+                                  std::string_view query, const FlightInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(std::string caller_key, CallerKey(context));
+  std::vector<std::string> ticket_keys;
+  for (const auto& endpoint : info.endpoints()) {
+    ticket_keys.push_back(caller_key + endpoint.ticket.ticket);
+  }
+  std::string normalized = NormalizeQuery(query);
+  std::string entry_key = std::move(caller_key);
+  AppendKeyPart(&entry_key, normalized);
+  impl_->PutFlightInfo(entry_key, std::move(normalized), std::move(ticket_keys), info);
+  return Status::OK();
+}
+
+arrow::Result<std::unique_ptr<FlightDataStream>> ResultCache::GetResult(
+    const ServerCallContext& context, const Ticket& ticket) {
+  ARROW_ASSIGN_OR_RAISE(std::string ticket_key, CallerKey(context));
+  ticket_key += ticket.ticket;
+  auto result = impl_->GetResult(ticket_key);
+  if (!result) return nullptr;
+  return std::make_unique<CachedResultStream>(std::move(result));
+}
+
+arrow::Result<std::unique_ptr<FlightDataStream>> ResultCache::RecordResult(
+    const ServerCallContext& context, const Ticket& ticket,
+    std::unique_ptr<FlightDataStream> stream) {
+  ARROW_ASSIGN_OR_RAISE(std::string ticket_key, CallerKey(context));
+  ticket_key += ticket.ticket;
+  std::string entry_key;
+  uint64_t generation = 0;
+  if (!impl_->PrepareRecord(ticket_key, &entry_key, &generation)) return stream;
+  // The stream may outlive the cache
+  std::weak_ptr<Impl> weak_impl = impl_;
+  auto on_complete = [weak_impl, entry_key = std::move(entry_key),
+                      ticket_key = std::move(ticket_key),
+                      generation](std::shared_ptr<const CachedResult> result) {
+    if (auto impl = weak_impl.lock()) {
+      impl->AddResult(entry_key, ticket_key, generation, std::move(result));
+    }
+  };
+  return std::make_unique<RecordingStream>(
+      std::move(on_complete), impl_->options().max_result_bytes, std::move(stream));
+}
+
+void ResultCache::Invalidate(const std::function<bool(const std::string&)>& predicate) {
+  impl_->Invalidate(predicate);
+}
+
+void ResultCache::Clear() { impl_->Invalidate(nullptr); }
+
+int64_t ResultCache::size_bytes() const { return impl_->size_bytes(); }
+
+int64_t ResultCache::num_hits() const { return impl_->num_hits(); }
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// A cache of the results of Flight SQL statement queries.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "arrow/flight/server.h"
+#include "arrow/flight/sql/visibility.h"
+#include "arrow/flight/types.h"
+#include "arrow/result.h"
+
+namespace arrow {
+namespace flight {
+namespace sql {
+
+/// \brief Options for ResultCache.
+struct ARROW_FLIGHT_SQL_EXPORT ResultCacheOptions {
+  /// \brief The maximum size of the cached results, in IPC bytes.
+  ///
+  /// The least recently used queries are evicted beyond it.
+  int64_t max_bytes = 256 * 1024 * 1024;
+  /// \brief Results larger than this are not cached.
+  int64_t max_result_bytes = 64 * 1024 * 1024;
+  /// \brief How long a query is served from the cache.
+  std::chrono::duration<double> time_to_live = std::chrono::minutes(5);
+
+  static ResultCacheOptions Defaults();
+};
+
+/// \brief A cache of the results of statement queries, as the IPC
+///   payloads sent to the clients.
+///
+/// Queries are identified by their normalized text (see
+/// NormalizeQuery), the identity of the peer and the options of its
+/// session, if the ServerSessionMiddleware is installed. When a query
+/// is cached, GetFlightInfo returns the FlightInfo of its first
+/// execution, and DoGet replays the payloads of the tickets of that
+/// FlightInfo, without calling the server.
+///
+/// See FlightSqlServerBase::SetResultCache. All the methods are
+/// thread-safe.
+class ARROW_FLIGHT_SQL_EXPORT ResultCache {
+ public:
+  explicit ResultCache(ResultCacheOptions options = ResultCacheOptions::Defaults());
+  ~ResultCache();
+
+  /// \brief Collapse the whitespace outside quotes and strip the
+  ///   trailing semicolons of a query.
+  static std::string NormalizeQuery(std::string_view query);
+
+  /// \brief Get the FlightInfo of a query whose results are all
+  ///   cached, with the given descriptor, or null.
+  arrow::Result<std::unique_ptr<FlightInfo>> GetFlightInfo(
+      const ServerCallContext& context, std::string_view query,
+      const FlightDescriptor& descriptor);
+  /// \brief Remember the FlightInfo of a query, so that the results of
+  ///   its tickets are cached as they are read.
+  Status PutFlightInfo(const ServerCallContext& context, std::string_view query,
+                       const FlightInfo& info);
+
+  /// \brief Get a stream of the cached result of a ticket, or null.
+  arrow::Result<std::unique_ptr<FlightDataStream>> GetResult(
+      const ServerCallContext& context, const Ticket& ticket);
+  /// \brief Wrap the stream of the result of a ticket, to cache the
+  ///   result once it is completely read.
+  ///
+  /// The stream is returned as-is if the ticket is not part of a
+  /// FlightInfo passed to PutFlightInfo.
+  arrow::Result<std::unique_ptr<FlightDataStream>> RecordResult(
+      const ServerCallContext& context, const Ticket& ticket,
+      std::unique_ptr<FlightDataStream> stream);
+
+  /// \brief Drop the queries matching a predicate, given the
+  ///   normalized query text, e.g. the ones reading a modified table.
+  void Invalidate(const std::function<bool(const std::string&)>& predicate);
+  /// \brief Drop all the queries.
+  void Clear();
+
+  /// \brief The size of the cached results, in IPC bytes.
+  int64_t size_bytes() const;
+  /// \brief The number of GetFlightInfo calls served from the cache.
+  int64_t num_hits() const;
+
+ private:
+  class Impl;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace sql
+}  // namespace flight
+}  // namespace arrow
@@ -501,8 +501,18 @@ Status FlightSqlServerBase::GetFlightInfo(const ServerCallContext& context,
   if (any.Is<pb::sql::CommandStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(StatementQuery internal_command,
                           ParseCommandStatementQuery(any));
+    const bool cached = result_cache_ && internal_command.transaction_id.empty();
+    if (cached) {
+      ARROW_ASSIGN_OR_RAISE(
+          *info, result_cache_->GetFlightInfo(context, internal_command.query, request));
+      if (*info) return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*info,
                           GetFlightInfoStatement(context, internal_command, request));
+    if (cached) {
+      ARROW_RETURN_NOT_OK(
+          result_cache_->PutFlightInfo(context, internal_command.query, **info));
+    }
     return Status::OK();
   } else if (any.Is<pb::sql::CommandStatementSubstraitPlan>()) {
     ARROW_ASSIGN_OR_RAISE(StatementSubstraitPlan internal_command,
@@ -659,7 +669,15 @@ Status FlightSqlServerBase::DoGet(const ServerCallContext& context, const Ticket
     }
     StatementQueryTicket result;
     result.statement_handle = command.statement_handle();
+    if (result_cache_) {
+      ARROW_ASSIGN_OR_RAISE(*stream, result_cache_->GetResult(context, request));
+      if (*stream) return Status::OK();
+    }
     ARROW_ASSIGN_OR_RAISE(*stream, DoGetStatement(context, result));
+    if (result_cache_) {
+      ARROW_ASSIGN_OR_RAISE(
+          *stream, result_cache_->RecordResult(context, request, std::move(*stream)));
+    }
     return Status::OK();
   } else if (any.Is<pb::sql::CommandPreparedStatementQuery>()) {
     ARROW_ASSIGN_OR_RAISE(PreparedStatementQuery internal_command,
@@ -729,6 +747,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
                           ParseCommandStatementUpdate(any));
     ARROW_ASSIGN_OR_RAISE(auto record_count,
                           DoPutCommandStatementUpdate(context, internal_command))
+    if (result_cache_) result_cache_->Clear();
 
     pb::sql::DoPutUpdateResult result;
     result.set_record_count(record_count);
@@ -742,6 +761,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
                           ParseCommandStatementSubstraitPlan(any));
     ARROW_ASSIGN_OR_RAISE(auto record_count,
                           DoPutCommandSubstraitPlan(context, internal_command));
+    if (result_cache_) result_cache_->Clear();
 
     pb::sql::DoPutUpdateResult result;
     result.set_record_count(record_count);
@@ -760,6 +780,7 @@ Status FlightSqlServerBase::DoPut(const ServerCallContext& context,
     ARROW_ASSIGN_OR_RAISE(
         auto record_count,
         DoPutPreparedStatementUpdate(context, internal_command, reader.get()));
+    if (result_cache_) result_cache_->Clear();
 
     pb::sql::DoPutUpdateResult result;
     result.set_record_count(record_count);
@@ -891,6 +912,10 @@ Status FlightSqlServerBase::DoAction(const ServerCallContext& context,
       ARROW_ASSIGN_OR_RAISE(ActionEndTransactionRequest internal_command,
                             ParseActionEndTransactionRequest(any));
       ARROW_RETURN_NOT_OK(EndTransaction(context, internal_command));
+      if (result_cache_ &&
+          internal_command.action == ActionEndTransactionRequest::kCommit) {
+        result_cache_->Clear();
+      }
     } else {
       return Status::NotImplemented("Action not implemented: ", action.type);
     }
@@ -990,6 +1015,10 @@ void FlightSqlServerBase::RegisterSqlInfo(int32_t id, const SqlInfoResult& resul
   sql_info_id_to_result_[id] = result;
 }
 
+void FlightSqlServerBase::SetResultCache(std::shared_ptr<ResultCache> cache) {
+  result_cache_ = std::move(cache);
+}
+
 arrow::Result<std::unique_ptr<FlightDataStream>> FlightSqlServerBase::DoGetSqlInfo(
     const ServerCallContext& context, const GetSqlInfo& command) {
   MemoryPool* memory_pool = default_memory_pool();
@@ -28,6 +28,7 @@
 #include <unordered_map>
 
 #include "arrow/flight/server.h"
+#include "arrow/flight/sql/result_cache.h"
 #include "arrow/flight/sql/server.h"
 #include "arrow/flight/sql/types.h"
 #include "arrow/flight/sql/visibility.h"
@@ -245,6 +246,7 @@ arrow::Result<std::string> CreateStatementQueryTicket(
 class ARROW_FLIGHT_SQL_EXPORT FlightSqlServerBase : public FlightServerBase {
  private:
   SqlInfoResultMap sql_info_id_to_result_;
+  std::shared_ptr<ResultCache> result_cache_;
 
  public:
   /// \name Flight SQL methods
@@ -650,6 +652,15 @@ class ARROW_FLIGHT_SQL_EXPORT FlightSqlServerBase : public FlightServerBase {
   /// \param[in] result the result.
   void RegisterSqlInfo(int32_t id, const SqlInfoResult& result);
 
+  /// \brief Serve repeated statement queries from a cache.
+  ///
+  /// Only the queries outside transactions are cached. Updates made
+  /// through this server, and committed transactions, clear the cache;
+  /// other changes to the data must be signaled with
+  /// ResultCache::Invalidate. Must be called before serving.
+  /// \param[in] cache the cache, or null to disable caching.
+  void SetResultCache(std::shared_ptr<ResultCache> cache);
+
   /// @}
 
   /// \name Flight RPC handlers
@@ -29,6 +29,7 @@
 #include "arrow/flight/sql/example/sqlite_server.h"
 #include "arrow/flight/sql/example/sqlite_sql_info.h"
 #include "arrow/flight/sql/example/sqlite_type_info.h"
+#include "arrow/flight/sql/result_cache.h"
 #include "arrow/flight/sql/server.h"
 #include "arrow/flight/test_util.h"
 #include "arrow/flight/types.h"
@@ -166,7 +167,6 @@ class TestFlightSqlServer : public ::testing::Test {
     ASSERT_OK(server->Shutdown());
   }
 
- private:
   std::shared_ptr<arrow::flight::sql::example::SQLiteFlightSqlServer> server;
 };
 
@@ -821,4 +821,82 @@ TEST_F(TestFlightSqlServer, Transactions) {
   ASSERT_EQ(table->num_rows(), row_count);
 }
 
+class TestFlightSqlServerResultCache : public TestFlightSqlServer {
+ protected:
+  void SetUp() override {
+    ASSERT_NO_FATAL_FAILURE(TestFlightSqlServer::SetUp());
+    cache = std::make_shared<ResultCache>();
+    server->SetResultCache(cache);
+  }
+
+  arrow::Result<std::shared_ptr<Table>> ExecuteQuery(const std::string& query) {
+    ARROW_ASSIGN_OR_RAISE(auto flight_info, sql_client->Execute({}, query));
+    ARROW_ASSIGN_OR_RAISE(auto stream,
+                          sql_client->DoGet({}, flight_info->endpoints()[0].ticket));
+    return stream->ToTable();
+  }
+
+  std::shared_ptr<ResultCache> cache;
+};
+
+TEST(TestResultCache, NormalizeQuery) {
+  ASSERT_EQ("SELECT * FROM t", ResultCache::NormalizeQuery("  SELECT *\n\tFROM t ;; "));
+  ASSERT_EQ("SELECT 'a  b' FROM t WHERE x = \"c  d\"",
+            ResultCache::NormalizeQuery("SELECT 'a  b'  FROM t\nWHERE x = \"c  d\""));
+  ASSERT_EQ("SELECT 'it''s  ;'", ResultCache::NormalizeQuery("SELECT  'it''s  ;'"));
+}
+
+TEST_F(TestFlightSqlServerResultCache, RepeatedQuery) {
+  ASSERT_OK_AND_ASSIGN(auto expected, ExecuteQuery("SELECT * FROM intTable"));
+  ASSERT_EQ(cache->num_hits(), 0);
+  ASSERT_GT(cache->size_bytes(), 0);
+
+  ASSERT_OK_AND_ASSIGN(auto table, ExecuteQuery("SELECT *\n  FROM intTable;"));
+  ASSERT_EQ(cache->num_hits(), 1);
+  AssertTablesEqual(*expected, *table);
+
+  // Other queries are not served from the cache
+  ASSERT_OK_AND_ASSIGN(table, ExecuteQuery("SELECT * FROM intTable WHERE value > 0"));
+  ASSERT_EQ(cache->num_hits(), 1);
+  ASSERT_LT(table->num_rows(), expected->num_rows());
+}
+
+TEST_F(TestFlightSqlServerResultCache, UpdateClearsCache) {
+  ASSERT_OK_AND_EQ(4, ExecuteCountQuery("SELECT COUNT(*) FROM intTable"));
+  ASSERT_OK_AND_EQ(1, sql_client->ExecuteUpdate(
+                          {}, "INSERT INTO intTable (keyName, value) VALUES ('K', 1)"));
+  ASSERT_EQ(cache->size_bytes(), 0);
+  ASSERT_OK_AND_EQ(5, ExecuteCountQuery("SELECT COUNT(*) FROM intTable"));
+  ASSERT_EQ(cache->num_hits(), 0);
+}
+
+TEST_F(TestFlightSqlServerResultCache, Invalidate) {
+  ASSERT_OK(ExecuteQuery("SELECT * FROM intTable"));
+  ASSERT_OK(ExecuteQuery("SELECT * FROM foreignTable"));
+  const int64_t size = cache->size_bytes();
+
+  cache->Invalidate([](const std::string& query) {
+    return query.find("intTable") != std::string::npos;
+  });
+  ASSERT_GT(cache->size_bytes(), 0);
+  ASSERT_LT(cache->size_bytes(), size);
+  ASSERT_OK(ExecuteQuery("SELECT * FROM intTable"));
+  ASSERT_OK(ExecuteQuery("SELECT * FROM foreignTable"));
+  ASSERT_EQ(cache->num_hits(), 1);
+}
+
+TEST_F(TestFlightSqlServerResultCache, Transaction) {
+  ASSERT_OK_AND_ASSIGN(auto transaction, sql_client->BeginTransaction({}));
+  for (int i = 0; i < 2; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto flight_info,
+                         sql_client->Execute({}, "SELECT * FROM intTable", transaction));
+    ASSERT_OK_AND_ASSIGN(auto stream,
+                         sql_client->DoGet({}, flight_info->endpoints()[0].ticket));
+    ASSERT_OK(stream->ToTable());
+  }
+  ASSERT_EQ(cache->size_bytes(), 0);
+  ASSERT_EQ(cache->num_hits(), 0);
+  ASSERT_OK(sql_client->Rollback({}, transaction));
+}
+
 }  // namespace arrow::flight::sql
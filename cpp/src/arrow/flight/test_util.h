@@ -111,9 +111,13 @@ Status MakeServer(const Location& location, std::unique_ptr<FlightServerBase>* s
   FlightServerOptions server_options(location);
   RETURN_NOT_OK(make_server_options(&server_options));
   RETURN_NOT_OK((*server)->Init(server_options));
-  std::string uri =
-      location.scheme() + "://127.0.0.1:" + std::to_string((*server)->port());
-  ARROW_ASSIGN_OR_RAISE(auto real_location, Location::Parse(uri));
+  Location real_location = (*server)->location();
+  if ((*server)->port() >= 0) {
+    std::string uri =
+        location.scheme() + "://127.0.0.1:" + std::to_string((*server)->port());
+    ARROW_ASSIGN_OR_RAISE(real_location, Location::Parse(uri));
+  }
+  // Else, not a network location (e.g. a Unix socket): connect to it as is
   FlightClientOptions client_options = FlightClientOptions::Defaults();
   RETURN_NOT_OK(make_client_options(&client_options));
   return FlightClient::Connect(real_location, client_options).Value(client);
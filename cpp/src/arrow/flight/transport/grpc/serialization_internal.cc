@@ -50,6 +50,7 @@
 #include "arrow/flight/transport.h"
 #include "arrow/flight/transport/grpc/util_internal.h"
 #include "arrow/ipc/message.h"
+#include "arrow/ipc/util.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
@@ -69,19 +70,7 @@ using google::protobuf::io::CodedOutputStream;
 
 using ::grpc::ByteBuffer;
 
-bool ReadBytesZeroCopy(const std::shared_ptr<Buffer>& source_data,
-                       CodedInputStream* input, std::shared_ptr<Buffer>* out) {
-  uint32_t length;
-  if (!input->ReadVarint32(&length)) {
-    return false;
-  }
-  auto buf =
-      SliceBuffer(source_data, input->CurrentPosition(), static_cast<int64_t>(length));
-  *out = buf;
-  return input->Skip(static_cast<int>(length));
-}
-
-// Internal wrapper for gRPC ByteBuffer so its memory can be exposed to Arrow
+// Internal wrapper for gRPC slices so their memory can be exposed to Arrow
 // consumers with zero-copy
 class GrpcBuffer : public MutableBuffer {
  public:
@@ -95,61 +84,135 @@ class GrpcBuffer : public MutableBuffer {
     grpc_slice_unref(slice_);
   }
 
-  static Status Wrap(ByteBuffer* cpp_buf, std::shared_ptr<Buffer>* out) {
+  // Expose the slices of a ByteBuffer, without copying them unless they are inlined
+  static Status Wrap(ByteBuffer* cpp_buf, std::vector<std::shared_ptr<Buffer>>* out) {
     // These types are guaranteed by static assertions in gRPC to have the same
     // in-memory representation
-
     auto buffer = *reinterpret_cast<grpc_byte_buffer**>(cpp_buf);
 
-    // This part below is based on the Flatbuffers gRPC SerializationTraits in
-    // flatbuffers/grpc.h
-
-    // Check if this is a single uncompressed slice.
-    if ((buffer->type == GRPC_BB_RAW) &&
-        (buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
-        (buffer->data.raw.slice_buffer.count == 1)) {
-      // If it is, then we can reference the `grpc_slice` directly.
-      grpc_slice slice = buffer->data.raw.slice_buffer.slices[0];
-
-      if (slice.refcount) {
-        // Increment reference count so this memory remains valid
-        *out = std::make_shared<GrpcBuffer>(slice, true);
-      } else {
-        // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are
-        // inlined into the structure and must be copied.
-        const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
-        std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
-      }
-    } else {
-      // Otherwise, we need to use `grpc_byte_buffer_reader_readall` to read
-      // `buffer` into a single contiguous `grpc_slice`. The gRPC reader gives
-      // us back a new slice with the refcount already incremented.
-      grpc_byte_buffer_reader reader;
-      if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
-        return Status::IOError("Internal gRPC error reading from ByteBuffer");
-      }
-      grpc_slice slice = grpc_byte_buffer_reader_readall(&reader);
+    // The reader decompresses the buffer if needed, and otherwise gives us back
+    // its slices with their refcount already incremented.
+    grpc_byte_buffer_reader reader;
+    if (!grpc_byte_buffer_reader_init(&reader, buffer)) {
+      return Status::IOError("Internal gRPC error reading from ByteBuffer");
+    }
+    Status status;
+    grpc_slice slice;
+    while (grpc_byte_buffer_reader_next(&reader, &slice)) {
       if (slice.refcount) {
         // Steal the slice reference
-        *out = std::make_shared<GrpcBuffer>(slice, false);
-      } else {
-        // grpc_byte_buffer_reader_readall can give us an inlined slice,
-        // copy the data as above
-        const uint8_t length = slice.data.inlined.length;
-        ARROW_ASSIGN_OR_RAISE(*out, arrow::AllocateBuffer(length));
-        std::memcpy((*out)->mutable_data(), slice.data.inlined.bytes, length);
+        out->push_back(std::make_shared<GrpcBuffer>(slice, false));
+        continue;
+      }
+      // Small slices (less than GRPC_SLICE_INLINED_SIZE bytes) are
+      // inlined into the structure and must be copied.
+      const uint8_t length = slice.data.inlined.length;
+      auto maybe_buffer = arrow::AllocateBuffer(length);
+      if (!maybe_buffer.ok()) {
+        status = maybe_buffer.status();
+        continue;
       }
-      grpc_byte_buffer_reader_destroy(&reader);
+      std::memcpy((*maybe_buffer)->mutable_data(), slice.data.inlined.bytes, length);
+      out->push_back(*std::move(maybe_buffer));
     }
-
-    return Status::OK();
+    grpc_byte_buffer_reader_destroy(&reader);
+    return status;
   }
 
  private:
   grpc_slice slice_;
 };
 
+// A protobuf input stream over the slices of a ByteBuffer, which tells which
+// slice the bytes it returns belong to
+class GrpcSliceInputStream : public google::protobuf::io::ZeroCopyInputStream {
+ public:
+  explicit GrpcSliceInputStream(std::vector<std::shared_ptr<Buffer>> slices)
+      : slices_(std::move(slices)) {}
+
+  bool Next(const void** data, int* size) override {
+    // Skip the slices which were entirely read
+    while (index_ < slices_.size() && position_ == slices_[index_]->size()) {
+      ++index_;
+      position_ = 0;
+    }
+    if (index_ == slices_.size()) {
+      return false;
+    }
+    const auto& slice = slices_[index_];
+    *data = slice->data() + position_;
+    *size = static_cast<int>(slice->size() - position_);
+    position_ = slice->size();
+    byte_count_ += *size;
+    return true;
+  }
+
+  void BackUp(int count) override {
+    position_ -= count;
+    byte_count_ -= count;
+  }
+
+  bool Skip(int count) override {
+    while (count > 0) {
+      if (index_ == slices_.size()) {
+        return false;
+      }
+      const int64_t available = slices_[index_]->size() - position_;
+      if (count < available) {
+        position_ += count;
+        byte_count_ += count;
+        return true;
+      }
+      count -= static_cast<int>(available);
+      byte_count_ += available;
+      ++index_;
+      position_ = 0;
+    }
+    return true;
+  }
+
+  int64_t ByteCount() const override { return byte_count_; }
+
+  // The slice of the bytes last returned by Next()
+  const std::shared_ptr<Buffer>& current_slice() const { return slices_[index_]; }
+
+ private:
+  std::vector<std::shared_ptr<Buffer>> slices_;
+  size_t index_ = 0;
+  int64_t position_ = 0;
+  int64_t byte_count_ = 0;
+};
+
+// Read a length-delimited field.  The field references the gRPC slice if it is
+// contained in a single one and its start is a multiple of `alignment`, and is
+// copied to memory allocated from the default pool otherwise.
+bool ReadBytesZeroCopy(GrpcSliceInputStream* source, CodedInputStream* input,
+                       int64_t alignment, std::shared_ptr<Buffer>* out) {
+  uint32_t length;
+  if (!input->ReadVarint32(&length)) {
+    return false;
+  }
+  const void* data;
+  int size;
+  if (input->GetDirectBufferPointer(&data, &size) &&
+      static_cast<uint32_t>(size) >= length &&
+      reinterpret_cast<uintptr_t>(data) % alignment == 0) {
+    const auto& slice = source->current_slice();
+    const int64_t offset = static_cast<const uint8_t*>(data) - slice->data();
+    DCHECK(offset >= 0 && offset + length <= slice->size());
+    *out = SliceBuffer(slice, offset, static_cast<int64_t>(length));
+    return input->Skip(static_cast<int>(length));
+  }
+  // Copy the field at once into aligned memory, rather than assembling all the
+  // slices of the ByteBuffer and realigning the field later
+  auto maybe_buffer = AllocateBuffer(static_cast<int64_t>(length));
+  if (!maybe_buffer.ok()) {
+    return false;
+  }
+  *out = *std::move(maybe_buffer);
+  return input->ReadRaw((*out)->mutable_data(), static_cast<int>(length));
+}
+
 // Destructor callback for grpc::Slice
 static void ReleaseBuffer(void* buf_ptr) {
   delete reinterpret_cast<std::shared_ptr<Buffer>*>(buf_ptr);
@@ -298,7 +361,7 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
         const auto remainder = static_cast<int>(
             bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
         if (remainder) {
-          slices.emplace_back(kPaddingBytes, remainder);
+          slices.emplace_back(kPaddingBytes, remainder, ::grpc::Slice::STATIC_SLICE);
         }
       }
     }
@@ -326,17 +389,14 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   out->metadata = nullptr;
   out->body = nullptr;
 
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
-
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
+  std::vector<std::shared_ptr<arrow::Buffer>> slices;
+  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &slices));
 
-  pb_stream.SetTotalBytesLimit(buffer_length);
+  GrpcSliceInputStream slice_stream(std::move(slices));
+  CodedInputStream pb_stream(&slice_stream);
 
-  // This is the bytes remaining when using CodedInputStream like this
-  while (pb_stream.BytesUntilTotalBytesLimit()) {
-    const uint32_t tag = pb_stream.ReadTag();
+  // ReadTag() returns 0 at the end of the stream
+  while (const uint32_t tag = pb_stream.ReadTag()) {
     const int field_number = WireFormatLite::GetTagFieldNumber(tag);
     switch (field_number) {
       case pb::FlightData::kFlightDescriptorFieldNumber: {
@@ -359,18 +419,22 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
         out->descriptor = std::make_unique<arrow::flight::FlightDescriptor>(descriptor);
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!ReadBytesZeroCopy(&slice_stream, &pb_stream, /*alignment=*/1,
+                               &out->metadata)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to read FlightData metadata"};
         }
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!ReadBytesZeroCopy(&slice_stream, &pb_stream, /*alignment=*/1,
+                               &out->app_metadata)) {
           return {::grpc::StatusCode::INTERNAL,
                   "Unable to read FlightData application metadata"};
         }
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        // The IPC reader expects the body buffers to be aligned
+        if (!ReadBytesZeroCopy(&slice_stream, &pb_stream, ipc::kArrowIpcAlignment,
+                               &out->body)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to read FlightData body"};
         }
       } break;
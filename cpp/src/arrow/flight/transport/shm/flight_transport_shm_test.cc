@@ -0,0 +1,264 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/array/array_base.h"
+#include "arrow/flight/test_definitions.h"
+#include "arrow/flight/test_util.h"
+#include "arrow/flight/transport/shm/shm.h"
+#include "arrow/flight/transport/shm/shm_internal.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace flight {
+
+class ShmEnvironment : public ::testing::Environment {
+ public:
+  void SetUp() override { transport::shm::InitializeFlightShm(); }
+};
+
+testing::Environment* const kShmEnvironment =
+    testing::AddGlobalTestEnvironment(new ShmEnvironment());
+
+//------------------------------------------------------------
+// Common transport tests
+
+class ShmConnectivityTest : public ConnectivityTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+
+  // The server listens on a Unix socket, not a port
+  void TestGetPort() { GTEST_SKIP() << "No port"; }
+  void TestBuilderHook() { GTEST_SKIP() << "No port"; }
+  void TestShutdown() { GTEST_SKIP() << "No port"; }
+  void TestShutdownWithDeadline() { GTEST_SKIP() << "No port"; }
+  void TestBrokenConnection() { GTEST_SKIP() << "No port"; }
+};
+ARROW_FLIGHT_TEST_CONNECTIVITY(ShmConnectivityTest);
+
+class ShmDataTest : public DataTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_DATA(ShmDataTest);
+
+class ShmDoPutTest : public DoPutTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_DO_PUT(ShmDoPutTest);
+
+class ShmAppMetadataTest : public AppMetadataTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_APP_METADATA(ShmAppMetadataTest);
+
+class ShmIpcOptionsTest : public IpcOptionsTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+};
+ARROW_FLIGHT_TEST_IPC_OPTIONS(ShmIpcOptionsTest);
+
+class ShmErrorHandlingTest : public ErrorHandlingTest, public ::testing::Test {
+ protected:
+  std::string transport() const override { return "shm"; }
+  void SetUp() override { SetUpTest(); }
+  void TearDown() override { TearDownTest(); }
+
+  void TestGetFlightInfoMetadata() { GTEST_SKIP() << "Middleware not implemented"; }
+};
+ARROW_FLIGHT_TEST_ERROR_HANDLING(ShmErrorHandlingTest);
+
+//------------------------------------------------------------
+// Shared memory internals tests
+
+namespace transport {
+namespace shm {
+
+TEST(Status, RoundTrip) {
+  const std::vector<Status> statuses = {
+      Status::OK(),
+      Status::Invalid("Error message"),
+      Status::KeyError(""),
+      Status::IOError("foo",
+                      std::make_shared<FlightStatusDetail>(FlightStatusCode::Unauthorized,
+                                                           "extra")),
+  };
+  for (const auto& expected : statuses) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, SerializeStatus(expected));
+    Status actual;
+    ASSERT_OK(DeserializeStatus(*buffer, &actual));
+    ASSERT_EQ(actual.code(), expected.code()) << actual.ToString();
+    ASSERT_THAT(actual.message(), ::testing::HasSubstr(expected.message()));
+    auto expected_detail = FlightStatusDetail::UnwrapStatus(expected);
+    if (expected_detail) {
+      auto actual_detail = FlightStatusDetail::UnwrapStatus(actual);
+      ASSERT_NE(actual_detail, nullptr) << actual.ToString();
+      ASSERT_EQ(actual_detail->code(), expected_detail->code());
+      ASSERT_EQ(actual_detail->extra_info(), expected_detail->extra_info());
+    }
+  }
+
+  // Truncated
+  ASSERT_OK_AND_ASSIGN(auto buffer, SerializeStatus(Status::Invalid("Error message")));
+  Status actual;
+  ASSERT_RAISES(Invalid, DeserializeStatus(*SliceBuffer(buffer, 0, 3), &actual));
+}
+
+TEST(FrameType, MaxFrameType) {
+  for (const auto frame_type : {FrameType::kConnect, FrameType::kCall,
+                                FrameType::kBuffer, FrameType::kStatus}) {
+    ASSERT_LE(static_cast<int>(frame_type), static_cast<int>(FrameType::kMaxFrameType));
+  }
+}
+
+}  // namespace shm
+}  // namespace transport
+
+//------------------------------------------------------------
+// Ad-hoc shared memory-specific tests
+
+class SimpleTestServer : public FlightServerBase {
+ public:
+  Status GetFlightInfo(const ServerCallContext& context, const FlightDescriptor& request,
+                       std::unique_ptr<FlightInfo>* info) override {
+    if (request.path.size() > 0 && request.path[0] == "error") {
+      return Status::Invalid("Error message");
+    }
+    auto examples = ExampleFlightInfo();
+    info->reset(new FlightInfo(examples[0]));
+    return Status::OK();
+  }
+
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    RecordBatchVector batches;
+    RETURN_NOT_OK(ExampleIntBatches(&batches));
+    // Repeat the batches, so that they go around small rings many times
+    RecordBatchVector repeated;
+    for (int i = 0; i < 20; ++i) {
+      repeated.insert(repeated.end(), batches.begin(), batches.end());
+    }
+    auto batch_reader = std::make_shared<BatchIterator>(batches[0]->schema(), repeated);
+    *data_stream = std::make_unique<RecordBatchStream>(batch_reader);
+    return Status::OK();
+  }
+};
+
+class TestShm : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK_AND_ASSIGN(auto location, Location::ForScheme("shm", "localhost", 0));
+    ASSERT_OK(MakeServer<SimpleTestServer>(
+        location, &server_, &client_,
+        [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() {
+    ASSERT_OK(client_->Close());
+    ASSERT_OK(server_->Shutdown());
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+TEST_F(TestShm, GetFlightInfo) {
+  auto descriptor = FlightDescriptor::Path({"foo", "bar"});
+  std::unique_ptr<FlightInfo> info;
+  ASSERT_OK_AND_ASSIGN(info, client_->GetFlightInfo(descriptor));
+  // Test that we can reuse the connection
+  ASSERT_OK_AND_ASSIGN(info, client_->GetFlightInfo(descriptor));
+
+  descriptor = FlightDescriptor::Path({"error"});
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Error message"),
+                                  client_->GetFlightInfo(descriptor));
+  ASSERT_OK_AND_ASSIGN(info, client_->GetFlightInfo(FlightDescriptor::Path({"foo"})));
+}
+
+TEST_F(TestShm, ConcurrentClients) {
+  ASSERT_OK_AND_ASSIGN(
+      auto client2,
+      FlightClient::Connect(server_->location(), FlightClientOptions::Defaults()));
+
+  Ticket ticket{"a"};
+
+  ASSERT_OK_AND_ASSIGN(auto stream1, client_->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto stream2, client2->DoGet(ticket));
+
+  ASSERT_OK_AND_ASSIGN(auto table1, stream1->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto table2, stream2->ToTable());
+
+  AssertTablesEqual(*table1, *table2);
+  ASSERT_OK(client2->Close());
+}
+
+TEST_F(TestShm, SmallRing) {
+  // The client holds all the batches of the table, so that the records read
+  // past a quarter of the ring must be copied for the server to go on
+  ASSERT_OK_AND_ASSIGN(auto location,
+                       Location::Parse(server_->location().ToString() + "?" +
+                                       transport::shm::kRingCapacityParameter +
+                                       "=65536"));
+  ASSERT_OK_AND_ASSIGN(auto client,
+                       FlightClient::Connect(location, FlightClientOptions::Defaults()));
+
+  Ticket ticket{"a"};
+  ASSERT_OK_AND_ASSIGN(auto stream1, client_->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto table1, stream1->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto stream2, client->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto table2, stream2->ToTable());
+  AssertTablesEqual(*table1, *table2);
+  ASSERT_OK(client->Close());
+}
+
+TEST_F(TestShm, ShutdownWithIdleClient) {
+  ASSERT_OK_AND_ASSIGN(auto info,
+                       client_->GetFlightInfo(FlightDescriptor::Path({"foo"})));
+  // The client keeps its connection open
+  ASSERT_OK(server_->Shutdown());
+  ASSERT_OK(server_->Wait());
+
+  ASSERT_NOT_OK(client_->GetFlightInfo(FlightDescriptor::Path({"foo"})));
+}
+
+TEST(TestShmLocation, InvalidLocation) {
+  ASSERT_OK_AND_ASSIGN(auto location, Location::Parse("shm://localhost"));
+  ASSERT_RAISES(Invalid, FlightClient::Connect(location));
+
+  ASSERT_OK_AND_ASSIGN(location, Location::Parse("shm:///nonexistent/flight.sock"));
+  ASSERT_RAISES(IOError, FlightClient::Connect(location));
+}
+
+}  // namespace flight
+}  // namespace arrow
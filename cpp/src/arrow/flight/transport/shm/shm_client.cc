@@ -0,0 +1,340 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+/// The client-side implementation of the shared memory transport for
+/// Flight.
+///
+/// As with UCX, each connection supports one call at a time, so the
+/// client keeps a pool of connections for concurrent calls. The data
+/// streams only involve the rings of the connection: reading and
+/// writing them concurrently needs no synchronization.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/client.h"
+#include "arrow/flight/transport.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/uri.h"
+#include "arrow/util/value_parsing.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+namespace {
+class ShmClientImpl;
+
+Status MergeStatuses(Status server_status, Status transport_status) {
+  if (server_status.ok()) {
+    if (transport_status.ok()) return server_status;
+    return transport_status;
+  } else if (transport_status.ok()) {
+    return server_status;
+  }
+  return Status::FromDetailAndArgs(server_status.code(), server_status.detail(),
+                                   server_status.message(),
+                                   ". Transport context: ", transport_status.ToString());
+}
+
+class ShmClientStream : public internal::ClientDataStream {
+ public:
+  ShmClientStream(ShmClientImpl* impl, std::unique_ptr<ShmConnection> conn)
+      : impl_(impl), conn_(std::move(conn)) {
+    DCHECK_NE(impl, nullptr);
+    DCHECK_NE(conn_, nullptr);
+  }
+
+  bool ReadData(internal::FlightData* data) override {
+    std::lock_guard<std::mutex> guard(read_mutex_);
+    if (read_finished_) return false;
+
+    bool success = true;
+    read_status_ = ReadImpl(data).Value(&success);
+    if (!read_status_.ok() || !success) {
+      read_finished_ = true;
+    }
+    return success;
+  }
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    if (writes_done_) return false;
+    RETURN_NOT_OK(conn_->WritePayload(payload));
+    return true;
+  }
+
+  Status WritesDone() override {
+    std::lock_guard<std::mutex> guard(write_mutex_);
+    if (!writes_done_) {
+      writes_done_ = true;
+      RETURN_NOT_OK(conn_->WriteEndOfStream());
+    }
+    return Status::OK();
+  }
+
+ protected:
+  Status DoFinish() override;
+
+  // Read the next data record, or the server status at the end of the stream
+  arrow::Result<bool> ReadImpl(internal::FlightData* data) {
+    ARROW_ASSIGN_OR_RAISE(bool success, conn_->ReadData(data));
+    if (!success) {
+      RETURN_NOT_OK(conn_->ReadStatus(&server_status_));
+    }
+    return success;
+  }
+
+  // The rings may be read and written concurrently, but not each by
+  // several threads (e.g. when Finish() drains a stream being read)
+  std::mutex read_mutex_;
+  std::mutex write_mutex_;
+  std::mutex finish_mutex_;
+  ShmClientImpl* impl_;
+  std::unique_ptr<ShmConnection> conn_;
+  bool writes_done_ = false;
+  bool read_finished_ = false;
+  bool finished_ = false;
+  Status read_status_;
+  Status server_status_;
+};
+
+class GetClientStream : public ShmClientStream {
+ public:
+  GetClientStream(ShmClientImpl* impl, std::unique_ptr<ShmConnection> conn)
+      : ShmClientStream(impl, std::move(conn)) {
+    writes_done_ = true;
+  }
+};
+
+class PutClientStream : public ShmClientStream {
+ public:
+  using ShmClientStream::ShmClientStream;
+
+  bool ReadData(internal::FlightData* data) override { return false; }
+
+  bool ReadPutMetadata(std::shared_ptr<Buffer>* out) override {
+    internal::FlightData data;
+    if (!ShmClientStream::ReadData(&data)) {
+      *out = nullptr;
+      return false;
+    }
+    *out = std::move(data.app_metadata);
+    return true;
+  }
+};
+
+class ExchangeClientStream : public ShmClientStream {
+ public:
+  using ShmClientStream::ShmClientStream;
+};
+
+class ShmClientImpl : public arrow::flight::internal::ClientTransport {
+ public:
+  ShmClientImpl() = default;
+
+  ~ShmClientImpl() override {
+    ARROW_WARN_NOT_OK(Close(), "ShmClientImpl errored in Close() in destructor");
+  }
+
+  Status Init(const FlightClientOptions& options, const Location& location,
+              const arrow::util::Uri& uri) override {
+    path_ = uri.path();
+    if (path_.empty()) {
+      return Status::Invalid("shm location must give the path of the server socket: ",
+                             uri.ToString());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto query, uri.query_items());
+    for (const auto& item : query) {
+      if (item.first != kRingCapacityParameter) continue;
+      if (!::arrow::internal::ParseValue<Int64Type>(
+              item.second.data(), item.second.size(), &ring_capacity_) ||
+          ring_capacity_ <= 0) {
+        return Status::Invalid("Invalid shm ring capacity: '", item.second, "'");
+      }
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto connection, MakeConnection());
+    return ReturnConnection(std::move(connection));
+  }
+
+  Status Close() override {
+    std::lock_guard<std::mutex> guard(connections_mutex_);
+    connections_.clear();
+    return Status::OK();
+  }
+
+  Status GetFlightInfo(const FlightCallOptions& options,
+                       const FlightDescriptor& descriptor,
+                       std::unique_ptr<FlightInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+
+    Status server_status;
+    auto impl = [&]() {
+      ARROW_ASSIGN_OR_RAISE(std::string payload, descriptor.SerializeToString());
+      RETURN_NOT_OK(connection->SendFrame(FrameType::kCall, kMethodGetFlightInfo));
+      RETURN_NOT_OK(connection->SendFrame(FrameType::kBuffer, payload));
+
+      ARROW_ASSIGN_OR_RAISE(auto frame, connection->ReadNextFrame());
+      if (frame.type == FrameType::kBuffer) {
+        ARROW_ASSIGN_OR_RAISE(*info, FlightInfo::Deserialize(frame.view()));
+        ARROW_ASSIGN_OR_RAISE(frame, connection->ReadNextFrame());
+      }
+      RETURN_NOT_OK(connection->ExpectFrameType(frame, FrameType::kStatus));
+      return DeserializeStatus(*frame.buffer, &server_status);
+    };
+    auto status = impl();
+    return FinishUnaryCall(std::move(status), std::move(server_status),
+                           std::move(connection));
+  }
+
+  Status PollFlightInfo(const FlightCallOptions& options,
+                        const FlightDescriptor& descriptor,
+                        std::unique_ptr<PollInfo>* info) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+
+    Status server_status;
+    auto impl = [&]() {
+      ARROW_ASSIGN_OR_RAISE(std::string payload, descriptor.SerializeToString());
+      RETURN_NOT_OK(connection->SendFrame(FrameType::kCall, kMethodPollFlightInfo));
+      RETURN_NOT_OK(connection->SendFrame(FrameType::kBuffer, payload));
+
+      ARROW_ASSIGN_OR_RAISE(auto frame, connection->ReadNextFrame());
+      if (frame.type == FrameType::kBuffer) {
+        ARROW_ASSIGN_OR_RAISE(*info, PollInfo::Deserialize(frame.view()));
+        ARROW_ASSIGN_OR_RAISE(frame, connection->ReadNextFrame());
+      }
+      RETURN_NOT_OK(connection->ExpectFrameType(frame, FrameType::kStatus));
+      return DeserializeStatus(*frame.buffer, &server_status);
+    };
+    auto status = impl();
+    return FinishUnaryCall(std::move(status), std::move(server_status),
+                           std::move(connection));
+  }
+
+  Status DoExchange(const FlightCallOptions& options,
+                    std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+    RETURN_NOT_OK(connection->SendFrame(FrameType::kCall, kMethodDoExchange));
+    *out = std::make_unique<ExchangeClientStream>(this, std::move(connection));
+    return Status::OK();
+  }
+
+  Status DoGet(const FlightCallOptions& options, const Ticket& ticket,
+               std::unique_ptr<internal::ClientDataStream>* stream) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+    ARROW_ASSIGN_OR_RAISE(std::string payload, ticket.SerializeToString());
+    RETURN_NOT_OK(connection->SendFrame(FrameType::kCall, kMethodDoGet));
+    RETURN_NOT_OK(connection->SendFrame(FrameType::kBuffer, payload));
+    *stream = std::make_unique<GetClientStream>(this, std::move(connection));
+    return Status::OK();
+  }
+
+  Status DoPut(const FlightCallOptions& options,
+               std::unique_ptr<internal::ClientDataStream>* out) override {
+    ARROW_ASSIGN_OR_RAISE(auto connection, CheckoutConnection(options));
+    RETURN_NOT_OK(connection->SendFrame(FrameType::kCall, kMethodDoPut));
+    *out = std::make_unique<PutClientStream>(this, std::move(connection));
+    return Status::OK();
+  }
+
+  arrow::Result<std::unique_ptr<ShmConnection>> MakeConnection() {
+    return ShmConnection::Connect(path_, ring_capacity_);
+  }
+
+  arrow::Result<std::unique_ptr<ShmConnection>> CheckoutConnection(
+      const FlightCallOptions& options) {
+    std::unique_ptr<ShmConnection> connection;
+    {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      if (!connections_.empty()) {
+        connection = std::move(connections_.front());
+        connections_.pop_front();
+      }
+    }
+    if (!connection) {
+      ARROW_ASSIGN_OR_RAISE(connection, MakeConnection());
+    }
+    connection->set_read_memory_pool(options.read_options.memory_pool);
+    return connection;
+  }
+
+  // Only return connections whose calls completed: a failed call may have
+  // left frames or records behind
+  Status ReturnConnection(std::unique_ptr<ShmConnection> connection) {
+    std::lock_guard<std::mutex> guard(connections_mutex_);
+    if (connections_.size() < kMaxOpenConnections) {
+      connections_.push_back(std::move(connection));
+    }
+    return Status::OK();
+  }
+
+ private:
+  static constexpr size_t kMaxOpenConnections = 3;
+
+  Status FinishUnaryCall(Status transport_status, Status server_status,
+                         std::unique_ptr<ShmConnection> connection) {
+    // After a transport error, the connection is dropped
+    RETURN_NOT_OK(transport_status);
+    RETURN_NOT_OK(ReturnConnection(std::move(connection)));
+    return server_status;
+  }
+
+  std::string path_;
+  int64_t ring_capacity_ = kDefaultRingCapacity;
+  std::mutex connections_mutex_;
+  std::deque<std::unique_ptr<ShmConnection>> connections_;
+};
+
+Status ShmClientStream::DoFinish() {
+  // Both reader and writer may be used concurrently, and both may
+  // call Finish() - prevent concurrent state mutation
+  std::lock_guard<std::mutex> guard(finish_mutex_);
+  if (finished_) return MergeStatuses(server_status_, read_status_);
+  finished_ = true;
+
+  Status status = WritesDone();
+  // Drain the stream until the server status
+  internal::FlightData data;
+  while (ShmClientStream::ReadData(&data)) {
+  }
+  status &= read_status_;
+  if (status.ok()) {
+    RETURN_NOT_OK(impl_->ReturnConnection(std::move(conn_)));
+  }
+  read_status_ = status;
+  return MergeStatuses(server_status_, std::move(status));
+}
+}  // namespace
+
+std::unique_ptr<arrow::flight::internal::ClientTransport> MakeShmClientImpl() {
+  return std::make_unique<ShmClientImpl>();
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
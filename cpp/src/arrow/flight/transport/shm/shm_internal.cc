@@ -0,0 +1,603 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/types.h"
+#include "arrow/ipc/message.h"
+#include "arrow/memory_pool.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/string.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+
+using internal::FileDescriptor;
+using internal::IOErrorFromErrno;
+using internal::ToChars;
+
+namespace flight {
+namespace transport {
+namespace shm {
+
+namespace {
+
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+constexpr uint32_t kMissingFieldSentinel = std::numeric_limits<uint32_t>::max();
+constexpr int kNumStatusFields = 6;
+constexpr int kNumConnectFds = 2;
+
+static_assert(sizeof(RecordHeader) == 24, "RecordHeader must not be padded");
+
+void UInt32ToBytesBe(const uint32_t in, uint8_t* out) {
+  util::SafeStore(out, bit_util::ToBigEndian(in));
+}
+
+uint32_t BytesToUInt32Be(const uint8_t* in) {
+  return bit_util::FromBigEndian(util::SafeLoadAs<uint32_t>(in));
+}
+
+Status SendAll(int fd, const uint8_t* data, int64_t size) {
+  while (size > 0) {
+    const ssize_t n = send(fd, data, static_cast<size_t>(size), kSendFlags);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return IOErrorFromErrno(errno, "Failed to send to the shm transport socket");
+    }
+    data += n;
+    size -= n;
+  }
+  return Status::OK();
+}
+
+// Return the number of bytes read, less than `size` at the end of the stream
+arrow::Result<int64_t> RecvAll(int fd, uint8_t* out, int64_t size) {
+  int64_t total = 0;
+  while (total < size) {
+    const ssize_t n = recv(fd, out + total, static_cast<size_t>(size - total), 0);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return IOErrorFromErrno(errno, "Failed to receive from the shm transport socket");
+    }
+    if (n == 0) break;
+    total += n;
+  }
+  return total;
+}
+
+void SetFrameHeader(FrameType frame_type, uint32_t body_size, uint8_t* out) {
+  std::memset(out, 0, Frame::kFrameHeaderBytes);
+  out[0] = static_cast<uint8_t>(frame_type);
+  UInt32ToBytesBe(body_size, out + 4);
+}
+
+arrow::Result<uint32_t> FrameBodySize(int64_t size) {
+  if (size < 0 || size > std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid("Frame body must be less than 2 GiB, was: ", size);
+  }
+  return static_cast<uint32_t>(size);
+}
+
+// Send a kConnect frame with the file descriptors of the rings attached
+Status SendConnectFrame(int fd, const std::array<int, kNumConnectFds>& fds) {
+  uint8_t header[Frame::kFrameHeaderBytes];
+  SetFrameHeader(FrameType::kConnect, 0, header);
+
+  struct iovec iov;
+  iov.iov_base = header;
+  iov.iov_len = sizeof(header);
+  alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int) * kNumConnectFds)];
+  std::memset(control, 0, sizeof(control));
+
+  struct msghdr msg;
+  std::memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+  struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type = SCM_RIGHTS;
+  cmsg->cmsg_len = CMSG_LEN(sizeof(int) * kNumConnectFds);
+  std::memcpy(CMSG_DATA(cmsg), fds.data(), sizeof(int) * kNumConnectFds);
+
+  ssize_t n;
+  do {
+    n = sendmsg(fd, &msg, kSendFlags);
+  } while (n < 0 && errno == EINTR);
+  if (n < 0) {
+    return IOErrorFromErrno(errno, "Failed to send the shared memory to the server");
+  }
+  // The file descriptors went with the first byte
+  return SendAll(fd, header + n, static_cast<int64_t>(sizeof(header)) - n);
+}
+
+// Receive a kConnect frame and the file descriptors attached to it
+arrow::Result<std::array<FileDescriptor, kNumConnectFds>> ReceiveConnectFrame(int fd) {
+  uint8_t header[Frame::kFrameHeaderBytes];
+  struct iovec iov;
+  iov.iov_base = header;
+  iov.iov_len = sizeof(header);
+  alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(int) * kNumConnectFds)];
+
+  struct msghdr msg;
+  std::memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  msg.msg_control = control;
+  msg.msg_controllen = sizeof(control);
+
+  ssize_t n;
+  do {
+    n = recvmsg(fd, &msg, 0);
+  } while (n < 0 && errno == EINTR);
+  if (n < 0) {
+    return IOErrorFromErrno(errno, "Failed to receive the shared memory of the client");
+  }
+
+  std::array<FileDescriptor, kNumConnectFds> fds;
+  int num_fds = 0;
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr;
+       cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+    if (cmsg->cmsg_level != SOL_SOCKET || cmsg->cmsg_type != SCM_RIGHTS) continue;
+    const size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    for (size_t i = 0; i < count; ++i) {
+      int received_fd;
+      std::memcpy(&received_fd, CMSG_DATA(cmsg) + i * sizeof(int), sizeof(int));
+      if (num_fds < kNumConnectFds) {
+        fds[num_fds++] = FileDescriptor(received_fd);
+      } else {
+        close(received_fd);
+      }
+    }
+  }
+  if (n > 0 && n < static_cast<ssize_t>(sizeof(header))) {
+    ARROW_ASSIGN_OR_RAISE(auto rest, RecvAll(fd, header + n, sizeof(header) - n));
+    n += rest;
+  }
+  if (n != static_cast<ssize_t>(sizeof(header)) ||
+      header[0] != static_cast<uint8_t>(FrameType::kConnect) ||
+      BytesToUInt32Be(header + 4) != 0) {
+    return Status::IOError("Client did not send a connect frame");
+  }
+  if (num_fds != kNumConnectFds || (msg.msg_flags & MSG_CTRUNC)) {
+    return Status::IOError("Client did not send the shared memory of the connection");
+  }
+  return fds;
+}
+
+void AppendField(const std::optional<std::string>& field, std::string* out) {
+  uint8_t length[4];
+  UInt32ToBytesBe(field ? static_cast<uint32_t>(field->size()) : kMissingFieldSentinel,
+                  length);
+  out->append(reinterpret_cast<const char*>(length), sizeof(length));
+  if (field) out->append(*field);
+}
+
+arrow::Result<uint32_t> RecordFieldSize(const char* field,
+                                        const std::shared_ptr<Buffer>& data) {
+  if (!data) return kMissingFieldSentinel;
+  if (data->size() >= std::numeric_limits<int32_t>::max()) {
+    return Status::Invalid(field, " must be less than 2 GiB, was: ", data->size());
+  }
+  return static_cast<uint32_t>(data->size());
+}
+
+int64_t PaddedFieldSize(uint32_t size) {
+  return size == kMissingFieldSentinel ? 0 : bit_util::RoundUpToMultipleOf8(size);
+}
+
+// Copy a field of a record and zero its padding, returning the end of the field
+uint8_t* PackField(uint32_t size, const std::shared_ptr<Buffer>& data, uint8_t* out) {
+  if (size == kMissingFieldSentinel) return out;
+  if (size > 0) std::memcpy(out, data->data(), size);
+  const int64_t padded_size = PaddedFieldSize(size);
+  std::memset(out + size, 0, padded_size - size);
+  return out + padded_size;
+}
+
+// A record of the receive ring, counted as held until it and its slices are
+// destroyed
+class HeldRecord : public Buffer {
+ public:
+  HeldRecord(std::shared_ptr<Buffer> record,
+             std::shared_ptr<std::atomic<int64_t>> held_bytes)
+      : Buffer(record->data(), record->size()),
+        record_(std::move(record)),
+        held_bytes_(std::move(held_bytes)) {
+    held_bytes_->fetch_add(size_);
+  }
+
+  ~HeldRecord() override { held_bytes_->fetch_sub(size_); }
+
+ private:
+  std::shared_ptr<Buffer> record_;
+  std::shared_ptr<std::atomic<int64_t>> held_bytes_;
+};
+
+}  // namespace
+
+arrow::Result<std::shared_ptr<Buffer>> SerializeStatus(const Status& status) {
+  std::array<std::optional<std::string>, kNumStatusFields> fields;
+  auto transport_status = internal::TransportStatus::FromStatus(status);
+  fields[0] = ToChars(static_cast<int32_t>(transport_status.code));
+  fields[1] = std::move(transport_status.message);
+  if (!status.ok()) {
+    fields[2] = ToChars(static_cast<int32_t>(status.code()));
+    fields[3] = status.message();
+    if (status.detail()) {
+      fields[4] = status.detail()->ToString();
+      auto fsd = FlightStatusDetail::UnwrapStatus(status);
+      if (fsd && !fsd->extra_info().empty()) {
+        fields[5] = fsd->extra_info();
+      }
+    }
+  }
+  std::string out;
+  for (const auto& field : fields) {
+    AppendField(field, &out);
+  }
+  return Buffer::FromString(std::move(out));
+}
+
+Status DeserializeStatus(const Buffer& buffer, Status* out) {
+  std::array<std::optional<std::string>, kNumStatusFields> fields;
+  const uint8_t* payload = buffer.data();
+  const uint8_t* end = payload + buffer.size();
+  for (int i = 0; i < kNumStatusFields; ++i) {
+    if (end - payload < 4) {
+      return Status::Invalid("Buffer underflow, expected length of status field ", i);
+    }
+    const uint32_t length = BytesToUInt32Be(payload);
+    payload += 4;
+    if (length == kMissingFieldSentinel) continue;
+    if (static_cast<uint32_t>(end - payload) < length) {
+      return Status::Invalid("Buffer underflow, expected status field ", i,
+                             " to have length ", length, ", but only ", end - payload,
+                             " bytes remain");
+    }
+    fields[i] = std::string(reinterpret_cast<const char*>(payload), length);
+    payload += length;
+  }
+
+  if (!fields[0]) {
+    return Status::IOError("Server did not send a status code");
+  }
+  auto transport_status = internal::TransportStatus::FromCodeStringAndMessage(
+      *fields[0], fields[1].value_or("Server did not send a status message"));
+  if (transport_status.code == TransportStatusCode::kOk) {
+    *out = Status::OK();
+    return Status::OK();
+  }
+  *out = transport_status.ToStatus();
+  if (!fields[2]) {
+    // No Arrow status sent, go with the transport status
+    return Status::OK();
+  }
+  *out = internal::ReconstructStatus(*fields[2], *out, std::move(fields[3]),
+                                     std::move(fields[4]), std::move(fields[5]),
+                                     FlightStatusDetail::UnwrapStatus(*out));
+  return Status::OK();
+}
+
+ShmConnection::ShmConnection(FileDescriptor socket,
+                             std::shared_ptr<ipc::SharedMemoryChannel> send_ring,
+                             std::shared_ptr<ipc::SharedMemoryChannel> receive_ring,
+                             std::string peer)
+    : socket_(std::move(socket)),
+      send_ring_(std::move(send_ring)),
+      receive_ring_(std::move(receive_ring)),
+      peer_(std::move(peer)),
+      read_memory_pool_(default_memory_pool()),
+      held_bytes_(std::make_shared<std::atomic<int64_t>>(0)) {}
+
+ShmConnection::~ShmConnection() {
+  // Wake up a peer waiting on the rings
+  send_ring_->CloseWriter();
+  receive_ring_->CloseReader();
+}
+
+arrow::Result<std::unique_ptr<ShmConnection>> ShmConnection::Connect(
+    const std::string& path, int64_t ring_capacity) {
+  struct sockaddr_un address;
+  std::memset(&address, 0, sizeof(address));
+  if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+    return Status::Invalid("Invalid shm transport socket path: '", path, "'");
+  }
+  address.sun_family = AF_UNIX;
+  std::memcpy(address.sun_path, path.data(), path.size());
+
+  const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to create socket");
+  }
+  FileDescriptor socket(fd);
+  if (connect(fd, reinterpret_cast<const struct sockaddr*>(&address),
+              sizeof(address)) != 0) {
+    return IOErrorFromErrno(errno, "Failed to connect to '", path, "'");
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto send_ring, ipc::SharedMemoryChannel::Create(ring_capacity));
+  ARROW_ASSIGN_OR_RAISE(auto receive_ring,
+                        ipc::SharedMemoryChannel::Create(ring_capacity));
+  RETURN_NOT_OK(SendConnectFrame(fd, {send_ring->fd(), receive_ring->fd()}));
+
+  std::unique_ptr<ShmConnection> connection(new ShmConnection(
+      std::move(socket), std::move(send_ring), std::move(receive_ring), path));
+  Status status;
+  RETURN_NOT_OK(connection->ReadStatus(&status));
+  RETURN_NOT_OK(status);
+  return connection;
+}
+
+arrow::Result<std::unique_ptr<ShmConnection>> ShmConnection::Accept(FileDescriptor fd) {
+  std::string peer = "unknown";
+#ifdef SO_PEERCRED
+  {
+    struct ucred credentials;
+    socklen_t length = sizeof(credentials);
+    if (getsockopt(fd.fd(), SOL_SOCKET, SO_PEERCRED, &credentials, &length) == 0) {
+      peer = "pid:" + ToChars(credentials.pid);
+    }
+  }
+#endif
+
+  ARROW_ASSIGN_OR_RAISE(auto ring_fds, ReceiveConnectFrame(fd.fd()));
+  // The rings of the client are the other way around for the server
+  auto maybe_receive_ring = ipc::SharedMemoryChannel::Open(ring_fds[0].fd());
+  auto maybe_send_ring = ipc::SharedMemoryChannel::Open(ring_fds[1].fd());
+  Status status = maybe_receive_ring.status() & maybe_send_ring.status();
+  ARROW_ASSIGN_OR_RAISE(auto response, SerializeStatus(status));
+  uint8_t header[Frame::kFrameHeaderBytes];
+  SetFrameHeader(FrameType::kStatus, static_cast<uint32_t>(response->size()), header);
+  RETURN_NOT_OK(SendAll(fd.fd(), header, sizeof(header)));
+  RETURN_NOT_OK(SendAll(fd.fd(), response->data(), response->size()));
+  RETURN_NOT_OK(status);
+
+  return std::unique_ptr<ShmConnection>(
+      new ShmConnection(std::move(fd), maybe_send_ring.MoveValueUnsafe(),
+                        maybe_receive_ring.MoveValueUnsafe(), std::move(peer)));
+}
+
+Status ShmConnection::SendFrame(FrameType frame_type, const uint8_t* data,
+                                int64_t size) {
+  ARROW_ASSIGN_OR_RAISE(const uint32_t body_size, FrameBodySize(size));
+  // Frames are small: send them at once
+  std::string frame(Frame::kFrameHeaderBytes + body_size, '\0');
+  auto out = reinterpret_cast<uint8_t*>(&frame[0]);
+  SetFrameHeader(frame_type, body_size, out);
+  if (body_size > 0) {
+    std::memcpy(out + Frame::kFrameHeaderBytes, data, body_size);
+  }
+  return SendAll(socket_.fd(), out, static_cast<int64_t>(frame.size()));
+}
+
+Status ShmConnection::SendStatus(const Status& status) {
+  ARROW_ASSIGN_OR_RAISE(auto payload, SerializeStatus(status));
+  return SendFrame(FrameType::kStatus, payload->data(), payload->size());
+}
+
+arrow::Result<Frame> ShmConnection::ReadNextFrame() {
+  uint8_t header[Frame::kFrameHeaderBytes];
+  ARROW_ASSIGN_OR_RAISE(auto read, RecvAll(socket_.fd(), header, sizeof(header)));
+  if (read == 0) {
+    return Status::Cancelled("The peer closed the connection");
+  }
+  if (read != sizeof(header)) {
+    return Status::IOError("Connection closed in the middle of a frame header");
+  }
+  if (header[0] > static_cast<uint8_t>(FrameType::kMaxFrameType)) {
+    return Status::IOError("Unknown frame type ", static_cast<int>(header[0]));
+  }
+  Frame frame;
+  frame.type = static_cast<FrameType>(header[0]);
+  const uint32_t size = BytesToUInt32Be(header + 4);
+  ARROW_ASSIGN_OR_RAISE(frame.buffer, AllocateBuffer(size));
+  ARROW_ASSIGN_OR_RAISE(read, RecvAll(socket_.fd(), frame.buffer->mutable_data(),
+                                     static_cast<int64_t>(size)));
+  if (read != size) {
+    return Status::IOError("Connection closed in the middle of a frame");
+  }
+  return frame;
+}
+
+Status ShmConnection::ReadStatus(Status* out) {
+  ARROW_ASSIGN_OR_RAISE(auto frame, ReadNextFrame());
+  RETURN_NOT_OK(ExpectFrameType(frame, FrameType::kStatus));
+  return DeserializeStatus(*frame.buffer, out);
+}
+
+Status ShmConnection::ExpectFrameType(const Frame& frame, FrameType type) {
+  if (frame.type != type) {
+    return Status::IOError("Expected frame type ", static_cast<int32_t>(type),
+                           ", but got frame type ", static_cast<int32_t>(frame.type));
+  }
+  return Status::OK();
+}
+
+Status ShmConnection::WriteRecord(RecordType type, const FlightPayload& payload) {
+  RecordHeader header;
+  header.type = type;
+  ARROW_ASSIGN_OR_RAISE(header.descriptor_size,
+                        RecordFieldSize("descriptor", payload.descriptor));
+  ARROW_ASSIGN_OR_RAISE(header.app_metadata_size,
+                        RecordFieldSize("app_metadata", payload.app_metadata));
+  ARROW_ASSIGN_OR_RAISE(
+      header.metadata_size,
+      RecordFieldSize("ipc_message.metadata", payload.ipc_message.metadata));
+  const auto& body_buffers = payload.ipc_message.body_buffers;
+  header.body_size = 0;
+  if (payload.ipc_message.metadata) {
+    header.body_size = payload.ipc_message.body_length;
+    for (const auto& buffer : body_buffers) {
+      if (buffer && !buffer->is_cpu()) {
+        return Status::NotImplemented(
+            "The shm transport only supports record batches in CPU memory");
+      }
+    }
+  }
+
+  const int64_t fields_size = PaddedFieldSize(header.descriptor_size) +
+                              PaddedFieldSize(header.app_metadata_size) +
+                              PaddedFieldSize(header.metadata_size);
+  const int64_t body_offset = bit_util::RoundUpToMultipleOf64(
+      static_cast<int64_t>(sizeof(RecordHeader)) + fields_size);
+  return send_ring_->WriteRecord(body_offset + header.body_size, [&](uint8_t* data) {
+    std::memcpy(data, &header, sizeof(header));
+    uint8_t* out = data + sizeof(header);
+    out = PackField(header.descriptor_size, payload.descriptor, out);
+    out = PackField(header.app_metadata_size, payload.app_metadata, out);
+    out = PackField(header.metadata_size, payload.ipc_message.metadata, out);
+    std::memset(out, 0, data + body_offset - out);
+    if (header.body_size == 0) return Status::OK();
+
+    // Pad the body buffers to 8 bytes, as the IPC writer
+    out = data + body_offset;
+    uint8_t* const body_end = out + header.body_size;
+    for (const auto& buffer : body_buffers) {
+      // Buffer may be null when the row length is zero, or when all
+      // entries are invalid.
+      if (!buffer) continue;
+      const int64_t padded_size = bit_util::RoundUpToMultipleOf8(buffer->size());
+      if (padded_size > body_end - out) {
+        return Status::Invalid("IPC body buffers exceed the body length of ",
+                               header.body_size, " bytes");
+      }
+      if (buffer->size() > 0) std::memcpy(out, buffer->data(), buffer->size());
+      std::memset(out + buffer->size(), 0, padded_size - buffer->size());
+      out += padded_size;
+    }
+    std::memset(out, 0, body_end - out);
+    return Status::OK();
+  });
+}
+
+Status ShmConnection::WritePayload(const FlightPayload& payload) {
+  return WriteRecord(RecordType::kData, payload);
+}
+
+Status ShmConnection::WriteAppMetadata(const Buffer& app_metadata) {
+  FlightPayload payload;
+  // Not owned: the record is written before returning
+  payload.app_metadata =
+      std::make_shared<Buffer>(app_metadata.data(), app_metadata.size());
+  return WriteRecord(RecordType::kData, payload);
+}
+
+Status ShmConnection::WriteEndOfStream() {
+  return WriteRecord(RecordType::kEndOfStream, FlightPayload{});
+}
+
+arrow::Result<bool> ShmConnection::ReadData(internal::FlightData* data) {
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> record, receive_ring_->ReadRecord());
+  if (!record) {
+    return Status::IOError("The shm transport connection was closed");
+  }
+  if (record->size() < static_cast<int64_t>(sizeof(RecordHeader))) {
+    return Status::IOError("Invalid record of ", record->size(), " bytes");
+  }
+  RecordHeader header;
+  std::memcpy(&header, record->data(), sizeof(header));
+  if (header.type == RecordType::kEndOfStream) {
+    return false;
+  }
+  if (header.type != RecordType::kData) {
+    return Status::IOError("Unknown record type ", static_cast<uint32_t>(header.type));
+  }
+
+  if (held_bytes_->load() < receive_ring_->capacity() / 4) {
+    record = std::make_shared<HeldRecord>(std::move(record), held_bytes_);
+  } else {
+    // Release the ring, so that the writer does not wait for this reader
+    ARROW_ASSIGN_OR_RAISE(auto copy, AllocateBuffer(record->size(), read_memory_pool_));
+    std::memcpy(copy->mutable_data(), record->data(), record->size());
+    record = std::move(copy);
+  }
+
+  int64_t offset = sizeof(RecordHeader);
+  auto next_field = [&](const char* field,
+                        uint32_t size) -> arrow::Result<std::shared_ptr<Buffer>> {
+    if (size == kMissingFieldSentinel) return nullptr;
+    if (offset + static_cast<int64_t>(size) > record->size()) {
+      return Status::IOError("Invalid record: ", field, " of ", size,
+                             " bytes exceeds the record");
+    }
+    auto slice = SliceBuffer(record, offset, size);
+    offset += PaddedFieldSize(size);
+    return slice;
+  };
+  ARROW_ASSIGN_OR_RAISE(auto descriptor,
+                        next_field("descriptor", header.descriptor_size));
+  ARROW_ASSIGN_OR_RAISE(data->app_metadata,
+                        next_field("app_metadata", header.app_metadata_size));
+  ARROW_ASSIGN_OR_RAISE(data->metadata,
+                        next_field("IPC metadata", header.metadata_size));
+  if (descriptor) {
+    data->descriptor.reset(new FlightDescriptor());
+    ARROW_ASSIGN_OR_RAISE(*data->descriptor,
+                          FlightDescriptor::Deserialize(std::string_view(*descriptor)));
+  } else {
+    data->descriptor = nullptr;
+  }
+  data->body = nullptr;
+  if (data->metadata) {
+    offset = bit_util::RoundUpToMultipleOf64(offset);
+    if (header.body_size < 0 || offset + header.body_size > record->size()) {
+      return Status::IOError("Invalid record: body of ", header.body_size,
+                             " bytes exceeds the record");
+    }
+    data->body = SliceBuffer(record, offset, header.body_size);
+  }
+  return true;
+}
+
+void ShmConnection::Abort() {
+  // Both sides of each ring, so that the waits of this end fail too
+  send_ring_->CloseWriter();
+  send_ring_->CloseReader();
+  receive_ring_->CloseWriter();
+  receive_ring_->CloseReader();
+  shutdown(socket_.fd(), SHUT_RDWR);
+}
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
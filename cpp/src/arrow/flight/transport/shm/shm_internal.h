@@ -0,0 +1,231 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Common implementation of the shared memory transport.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/visibility.h"
+#include "arrow/ipc/shared_memory.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace flight {
+namespace transport {
+namespace shm {
+
+//------------------------------------------------------------
+// Protocol Constants
+
+static constexpr char kMethodDoExchange[] = "DoExchange";
+static constexpr char kMethodDoGet[] = "DoGet";
+static constexpr char kMethodDoPut[] = "DoPut";
+static constexpr char kMethodGetFlightInfo[] = "GetFlightInfo";
+static constexpr char kMethodPollFlightInfo[] = "PollFlightInfo";
+
+/// The query parameter of the location setting the capacity of the rings.
+static constexpr char kRingCapacityParameter[] = "capacity";
+/// The capacity of the rings, unless set by the location.
+static constexpr int64_t kDefaultRingCapacity = 64 * 1024 * 1024;
+
+//------------------------------------------------------------
+// Message Framing
+
+/// \brief The type of a frame sent over the control socket.
+enum class FrameType : uint8_t {
+  /// Sent once by the client when connecting, with the file
+  /// descriptors of the two rings attached. The server replies with a
+  /// kStatus frame.
+  kConnect = 0,
+  /// Starts a call. Contains the RPC method.
+  kCall,
+  /// Binary blob: a serialized request or response.
+  kBuffer,
+  /// Ends a call. Contains the server status.
+  kStatus,
+  /// Keep at end.
+  kMaxFrameType = kStatus,
+};
+
+/// \brief A single frame received over the control socket.
+///
+/// A frame is a header followed by a body:
+/// +-------+---------------------------------+
+/// | Bytes | Function                        |
+/// +=======+=================================+
+/// | 0     | Frame type (see FrameType)      |
+/// | 1-3   | Unused, reserved                |
+/// | 4-7   | Body size (big-endian)          |
+/// +-------+---------------------------------+
+struct Frame {
+  /// \brief The size of a frame header.
+  static constexpr int64_t kFrameHeaderBytes = 8;
+
+  FrameType type;
+  std::shared_ptr<Buffer> buffer;
+
+  std::string_view view() const { return std::string_view(*buffer); }
+};
+
+/// \brief The type of a record in the rings.
+enum class RecordType : uint32_t {
+  /// A FlightPayload.
+  kData = 0,
+  /// Ends the stream of the current call.
+  kEndOfStream,
+};
+
+/// \brief The layout of the records carrying a FlightPayload in the rings.
+///
+/// Both ends are on the same host, so integers are in native byte
+/// order. The fields are padded to 8 bytes, and the body to 64 bytes,
+/// so that the buffers read in place are aligned:
+/// +--------+--------------------------------+
+/// | Bytes  | Contents                       |
+/// +========+================================+
+/// | 0-3    | Record type (see RecordType)   |
+/// | 4-7    | Descriptor length              |
+/// | 8-11   | app_metadata length            |
+/// | 12-15  | IPC metadata length            |
+/// | 16-23  | IPC body length                |
+/// | 24..   | Descriptor, app_metadata, IPC  |
+/// |        | metadata, IPC body             |
+/// +--------+--------------------------------+
+///
+/// If a field is not present, its length is UINT32_MAX.
+struct RecordHeader {
+  RecordType type;
+  uint32_t descriptor_size;
+  uint32_t app_metadata_size;
+  uint32_t metadata_size;
+  int64_t body_size;
+};
+
+/// \brief Convert a status to the body of a kStatus frame.
+ARROW_FLIGHT_EXPORT
+arrow::Result<std::shared_ptr<Buffer>> SerializeStatus(const Status& status);
+
+/// \brief Convert the body of a kStatus frame to the server-sent status.
+ARROW_FLIGHT_EXPORT
+Status DeserializeStatus(const Buffer& buffer, Status* out);
+
+/// \brief A connection between a client and a server.
+///
+/// The connection is a Unix domain socket, which carries the control
+/// frames, and two shared memory rings, which carry the data of the
+/// streams, one in each direction. The client creates the rings and
+/// passes their file descriptors to the server when connecting. A
+/// connection serves one call at a time, and the records of each data
+/// stream end with a kEndOfStream record.
+///
+/// Reading and writing the rings may be done concurrently, but each
+/// ring, and the socket, must be used by one thread at a time.
+class ARROW_FLIGHT_EXPORT ShmConnection {
+ public:
+  ~ShmConnection();
+
+  /// \brief Connect to the server listening on the socket `path`.
+  static arrow::Result<std::unique_ptr<ShmConnection>> Connect(const std::string& path,
+                                                               int64_t ring_capacity);
+  /// \brief Accept the connection of a client on the socket `fd`.
+  static arrow::Result<std::unique_ptr<ShmConnection>> Accept(
+      ::arrow::internal::FileDescriptor fd);
+
+  /// \brief Synchronously send a frame.
+  Status SendFrame(FrameType frame_type, const uint8_t* data, int64_t size);
+  Status SendFrame(FrameType frame_type, std::string_view data) {
+    return SendFrame(frame_type, reinterpret_cast<const uint8_t*>(data.data()),
+                     static_cast<int64_t>(data.size()));
+  }
+  /// \brief Send a kStatus frame.
+  Status SendStatus(const Status& status);
+  /// \brief Synchronously read the next frame.
+  ///
+  /// Returns Cancelled if the peer closed the connection.
+  arrow::Result<Frame> ReadNextFrame();
+  /// \brief Read a kStatus frame and extract the server-sent status.
+  Status ReadStatus(Status* out);
+  /// \brief Validate that the frame is of the given type.
+  Status ExpectFrameType(const Frame& frame, FrameType type);
+
+  /// \brief Write a data record, waiting for space in the ring.
+  Status WritePayload(const FlightPayload& payload);
+  /// \brief Write a data record of only app_metadata.
+  Status WriteAppMetadata(const Buffer& app_metadata);
+  /// \brief Write a kEndOfStream record.
+  Status WriteEndOfStream();
+  /// \brief Read the next data record, or return false at the end of
+  ///   the stream.
+  ///
+  /// The fields reference the ring as long as the reader holds less
+  /// than a quarter of it, and are copied beyond that, so that a
+  /// reader keeping all the data (e.g. in a Table) does not stall the
+  /// writer.
+  arrow::Result<bool> ReadData(internal::FlightData* data);
+
+  /// \brief Close the rings, so that the waits on both sides fail,
+  ///   and shut the socket down, without releasing the resources.
+  ///
+  /// May be called from any thread.
+  void Abort();
+
+  /// \brief The socket, e.g. to poll it for disconnection.
+  int socket_fd() const { return socket_.fd(); }
+  /// \brief Get a debug string naming the peer.
+  const std::string& peer() const { return peer_; }
+
+  /// \brief Set memory pool for copies of the records read.
+  void set_read_memory_pool(MemoryPool* memory_pool) { read_memory_pool_ = memory_pool; }
+
+ private:
+  ShmConnection(::arrow::internal::FileDescriptor socket,
+                std::shared_ptr<ipc::SharedMemoryChannel> send_ring,
+                std::shared_ptr<ipc::SharedMemoryChannel> receive_ring, std::string peer);
+
+  Status WriteRecord(RecordType type, const FlightPayload& payload);
+
+  ::arrow::internal::FileDescriptor socket_;
+  std::shared_ptr<ipc::SharedMemoryChannel> send_ring_;
+  std::shared_ptr<ipc::SharedMemoryChannel> receive_ring_;
+  std::string peer_;
+  MemoryPool* read_memory_pool_;
+  // The bytes of the receive ring held by the reader
+  std::shared_ptr<std::atomic<int64_t>> held_bytes_;
+};
+
+ARROW_FLIGHT_EXPORT
+std::unique_ptr<arrow::flight::internal::ClientTransport> MakeShmClientImpl();
+
+ARROW_FLIGHT_EXPORT
+std::unique_ptr<arrow::flight::internal::ServerTransport> MakeShmServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager);
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
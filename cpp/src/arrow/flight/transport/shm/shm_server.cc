@@ -0,0 +1,484 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/transport/shm/shm_internal.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/flight/server.h"
+#include "arrow/flight/transport.h"
+#include "arrow/flight/transport_server.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/uri.h"
+
+namespace arrow {
+
+using internal::FileDescriptor;
+using internal::IOErrorFromErrno;
+
+namespace flight {
+namespace transport {
+namespace shm {
+
+// Send an error to the client and return OK.
+// Statuses returned up to the main server loop close the connection instead.
+#define SERVER_RETURN_NOT_OK(connection, status)    \
+  do {                                              \
+    ::arrow::Status s = (status);                   \
+    if (!s.ok()) {                                  \
+      RETURN_NOT_OK((connection)->SendStatus(s));   \
+      return ::arrow::Status::OK();                 \
+    }                                               \
+  } while (false)
+
+#define FLIGHT_LOG(LEVEL) (ARROW_LOG(LEVEL) << "[server] ")
+#define FLIGHT_LOG_PEER(LEVEL, PEER) \
+  (ARROW_LOG(LEVEL) << "[server]"    \
+                    << "[peer=" << (PEER) << "] ")
+
+namespace {
+class ShmServerCallContext : public flight::ServerCallContext {
+ public:
+  explicit ShmServerCallContext(const std::string& peer) : peer_(peer) {}
+
+  const std::string& peer_identity() const override { return peer_; }
+  const std::string& peer() const override { return peer_; }
+  // Not supported
+  void AddHeader(const std::string& key, const std::string& value) const override {}
+  void AddTrailer(const std::string& key, const std::string& value) const override {}
+  ServerMiddleware* GetMiddleware(const std::string& key) const override {
+    return nullptr;
+  }
+  bool is_cancelled() const override { return false; }
+  const CallHeaders& incoming_headers() const override { return incoming_headers_; }
+
+ private:
+  std::string peer_;
+  CallHeaders incoming_headers_;
+};
+
+class ShmServerStream : public internal::ServerDataStream {
+ public:
+  explicit ShmServerStream(ShmConnection* connection) : connection_(connection) {}
+
+  bool ReadData(internal::FlightData* data) override {
+    if (reads_done_) return false;
+
+    bool success = true;
+    read_status_ = connection_->ReadData(data).Value(&success);
+    if (!read_status_.ok() || !success) {
+      reads_done_ = true;
+      if (!read_status_.ok()) {
+        FLIGHT_LOG_PEER(WARNING, connection_->peer())
+            << "I/O error in data stream: " << read_status_.ToString();
+      }
+    }
+    return success;
+  }
+
+  arrow::Result<bool> WriteData(const FlightPayload& payload) override {
+    if (writes_done_) return false;
+    RETURN_NOT_OK(connection_->WritePayload(payload));
+    return true;
+  }
+
+  Status WritePutMetadata(const Buffer& payload) override {
+    return connection_->WriteAppMetadata(payload);
+  }
+
+  Status WritesDone() override {
+    writes_done_ = true;
+    return Status::OK();
+  }
+
+  /// \brief Read the records the handler left, up to the end of the stream.
+  Status Drain() {
+    internal::FlightData ignored;
+    while (ReadData(&ignored)) {
+    }
+    return read_status_;
+  }
+
+ private:
+  ShmConnection* connection_;
+  bool reads_done_ = false;
+  bool writes_done_ = false;
+  Status read_status_;
+};
+
+class ShmServerImpl : public arrow::flight::internal::ServerTransport {
+ public:
+  using arrow::flight::internal::ServerTransport::ServerTransport;
+
+  ~ShmServerImpl() override {
+    if (listening_.load()) {
+      ARROW_WARN_NOT_OK(Shutdown(), "Server did not shut down properly");
+    }
+  }
+
+  Status Init(const FlightServerOptions& options, const arrow::util::Uri& uri) override {
+    const auto max_threads = std::max<uint32_t>(8, std::thread::hardware_concurrency());
+    ARROW_ASSIGN_OR_RAISE(rpc_pool_, arrow::internal::ThreadPool::Make(max_threads));
+
+    socket_path_ = uri.path();
+    if (socket_path_.empty()) {
+      // No path given (e.g. shm://localhost:0): listen on a new socket
+      ARROW_ASSIGN_OR_RAISE(temp_dir_,
+                            arrow::internal::TemporaryDir::Make("arrow-flight-shm-"));
+      socket_path_ = temp_dir_->path().ToString() + "flight.sock";
+    }
+
+    struct sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    if (socket_path_.size() >= sizeof(address.sun_path)) {
+      return Status::Invalid("shm transport socket path is too long: ", socket_path_);
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, socket_path_.data(), socket_path_.size());
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+      return IOErrorFromErrno(errno, "Failed to create socket");
+    }
+    listen_socket_ = FileDescriptor(fd);
+    if (bind(fd, reinterpret_cast<const struct sockaddr*>(&address), sizeof(address)) !=
+        0) {
+      return IOErrorFromErrno(errno, "Failed to bind to '", socket_path_, "'");
+    }
+    bound_ = true;
+    if (listen(fd, SOMAXCONN) != 0) {
+      return IOErrorFromErrno(errno, "Failed to listen on '", socket_path_, "'");
+    }
+    ARROW_ASSIGN_OR_RAISE(location_, Location::Parse("shm://" + socket_path_));
+    FLIGHT_LOG(DEBUG) << "Listening on " << socket_path_;
+
+    // Written to wake up the listener thread
+    ARROW_ASSIGN_OR_RAISE(wake_pipe_, arrow::internal::CreatePipe());
+    RETURN_NOT_OK(arrow::internal::SetPipeFileDescriptorNonBlocking(wake_pipe_.rfd.fd()));
+    RETURN_NOT_OK(arrow::internal::SetPipeFileDescriptorNonBlocking(wake_pipe_.wfd.fd()));
+
+    listening_.store(true);
+    std::thread listener_thread(&ShmServerImpl::DriveConnections, this);
+    listener_thread_.swap(listener_thread);
+    return Status::OK();
+  }
+
+  Status Shutdown() override {
+    return Shutdown(std::chrono::system_clock::time_point::max());
+  }
+
+  Status Shutdown(const std::chrono::system_clock::time_point& deadline) override {
+    if (!listening_.exchange(false)) return Status::OK();
+    Status status;
+
+    WakeListener();
+    status &= Wait();
+
+    {
+      // Stop the idle connections, and wait for the current RPCs to finish
+      std::unique_lock<std::mutex> guard(connections_mutex_);
+      for (const auto& entry : connections_) {
+        shutdown(entry.first->socket_fd(), SHUT_RD);
+      }
+      connections_cv_.wait_until(guard, deadline, [&] { return connections_.empty(); });
+      for (const auto& entry : connections_) {
+        entry.first->Abort();
+      }
+    }
+
+    status &= rpc_pool_->Shutdown();
+    rpc_pool_.reset();
+
+    status &= listen_socket_.Close();
+    if (bound_ && unlink(socket_path_.c_str()) != 0) {
+      status &= IOErrorFromErrno(errno, "Failed to remove '", socket_path_, "'");
+    }
+    bound_ = false;
+    temp_dir_.reset();
+    status &= wake_pipe_.Close();
+    return status;
+  }
+
+  Status Wait() override {
+    std::lock_guard<std::mutex> guard(join_mutex_);
+    try {
+      listener_thread_.join();
+    } catch (const std::system_error& e) {
+      if (e.code() != std::errc::invalid_argument) {
+        return Status::UnknownError("Could not Wait(): ", e.what());
+      }
+      // Else, server wasn't running anyways
+    }
+    return Status::OK();
+  }
+
+  Location location() const override { return location_; }
+
+ private:
+  // End the stream of records sent to the client, then the call
+  Status FinishStream(ShmConnection* connection, const Status& status) {
+    RETURN_NOT_OK(connection->WriteEndOfStream());
+    return connection->SendStatus(status);
+  }
+
+  Status HandleGetFlightInfo(ShmConnection* connection) {
+    ShmServerCallContext context(connection->peer());
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, connection->ReadNextFrame());
+    RETURN_NOT_OK(connection->ExpectFrameType(frame, FrameType::kBuffer));
+    FlightDescriptor descriptor;
+    SERVER_RETURN_NOT_OK(connection,
+                         FlightDescriptor::Deserialize(frame.view()).Value(&descriptor));
+
+    std::unique_ptr<FlightInfo> info;
+    std::string response;
+    SERVER_RETURN_NOT_OK(connection, base_->GetFlightInfo(context, descriptor, &info));
+    SERVER_RETURN_NOT_OK(connection, info->SerializeToString().Value(&response));
+    RETURN_NOT_OK(connection->SendFrame(FrameType::kBuffer, response));
+    return connection->SendStatus(Status::OK());
+  }
+
+  Status HandlePollFlightInfo(ShmConnection* connection) {
+    ShmServerCallContext context(connection->peer());
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, connection->ReadNextFrame());
+    RETURN_NOT_OK(connection->ExpectFrameType(frame, FrameType::kBuffer));
+    FlightDescriptor descriptor;
+    SERVER_RETURN_NOT_OK(connection,
+                         FlightDescriptor::Deserialize(frame.view()).Value(&descriptor));
+
+    std::unique_ptr<PollInfo> info;
+    std::string response;
+    SERVER_RETURN_NOT_OK(connection, base_->PollFlightInfo(context, descriptor, &info));
+    SERVER_RETURN_NOT_OK(connection, info->SerializeToString().Value(&response));
+    RETURN_NOT_OK(connection->SendFrame(FrameType::kBuffer, response));
+    return connection->SendStatus(Status::OK());
+  }
+
+  Status HandleDoGet(ShmConnection* connection) {
+    ShmServerCallContext context(connection->peer());
+
+    ARROW_ASSIGN_OR_RAISE(auto frame, connection->ReadNextFrame());
+    RETURN_NOT_OK(connection->ExpectFrameType(frame, FrameType::kBuffer));
+    Ticket ticket;
+    auto status = Ticket::Deserialize(frame.view()).Value(&ticket);
+    if (status.ok()) {
+      ShmServerStream stream(connection);
+      status = DoGet(context, std::move(ticket), &stream);
+    }
+    return FinishStream(connection, status);
+  }
+
+  Status HandleDoPut(ShmConnection* connection) {
+    ShmServerCallContext context(connection->peer());
+
+    ShmServerStream stream(connection);
+    auto status = DoPut(context, &stream);
+    RETURN_NOT_OK(FinishStream(connection, status));
+    // Must drain any unread records, or the next call will get confused
+    return stream.Drain();
+  }
+
+  Status HandleDoExchange(ShmConnection* connection) {
+    ShmServerCallContext context(connection->peer());
+
+    ShmServerStream stream(connection);
+    auto status = DoExchange(context, &stream);
+    RETURN_NOT_OK(FinishStream(connection, status));
+    // Must drain any unread records, or the next call will get confused
+    return stream.Drain();
+  }
+
+  Status HandleOneCall(ShmConnection* connection, const Frame& frame) {
+    RETURN_NOT_OK(connection->ExpectFrameType(frame, FrameType::kCall));
+    const auto method = frame.view();
+    if (method == kMethodGetFlightInfo) {
+      return HandleGetFlightInfo(connection);
+    } else if (method == kMethodPollFlightInfo) {
+      return HandlePollFlightInfo(connection);
+    } else if (method == kMethodDoExchange) {
+      return HandleDoExchange(connection);
+    } else if (method == kMethodDoGet) {
+      return HandleDoGet(connection);
+    } else if (method == kMethodDoPut) {
+      return HandleDoPut(connection);
+    }
+    return connection->SendStatus(Status::NotImplemented(method));
+  }
+
+  void WorkerLoop(FileDescriptor fd) {
+    auto maybe_connection = ShmConnection::Accept(std::move(fd));
+    if (!maybe_connection.ok()) {
+      FLIGHT_LOG(WARNING) << "Failed to accept connection: "
+                          << maybe_connection.status().ToString();
+      return;
+    }
+    std::shared_ptr<ShmConnection> connection = maybe_connection.MoveValueUnsafe();
+    const std::string peer = connection->peer();
+    if (!RegisterConnection(connection)) return;
+    FLIGHT_LOG_PEER(DEBUG, peer) << "Connected";
+
+    while (true) {
+      auto maybe_frame = connection->ReadNextFrame();
+      if (!maybe_frame.ok()) {
+        if (!maybe_frame.status().IsCancelled()) {
+          FLIGHT_LOG_PEER(WARNING, peer)
+              << "Failed to read next message: " << maybe_frame.status().ToString();
+        }
+        break;
+      }
+
+      auto status = HandleOneCall(connection.get(), *maybe_frame);
+      if (!status.ok()) {
+        FLIGHT_LOG_PEER(WARNING, peer) << "Call failed: " << status.ToString();
+        break;
+      }
+    }
+
+    UnregisterConnection(connection);
+    FLIGHT_LOG_PEER(DEBUG, peer) << "Disconnected";
+  }
+
+  // Accept connections, and abort those whose client went away, so that a call
+  // waiting on the rings of a dead client does not wait forever
+  void DriveConnections() {
+    std::vector<struct pollfd> fds;
+    std::vector<std::shared_ptr<ShmConnection>> polled;
+    while (listening_.load()) {
+      fds.clear();
+      polled.clear();
+      fds.push_back({wake_pipe_.rfd.fd(), POLLIN, 0});
+      fds.push_back({listen_socket_.fd(), POLLIN, 0});
+      {
+        std::lock_guard<std::mutex> guard(connections_mutex_);
+        for (const auto& entry : connections_) {
+          if (entry.second) continue;  // Already aborted
+          // Poll for hangups only
+          fds.push_back({entry.first->socket_fd(), 0, 0});
+          polled.push_back(entry.first);
+        }
+      }
+
+      if (poll(fds.data(), fds.size(), -1) < 0) {
+        if (errno == EINTR) continue;
+        FLIGHT_LOG(WARNING) << IOErrorFromErrno(errno, "poll() failed").ToString();
+        break;
+      }
+      if (fds[0].revents) {
+        uint8_t buffer[64];
+        while (read(wake_pipe_.rfd.fd(), buffer, sizeof(buffer)) > 0) {
+        }
+      }
+      if (fds[1].revents & POLLIN) {
+        const int client_fd = accept(listen_socket_.fd(), nullptr, nullptr);
+        if (client_fd < 0) {
+          FLIGHT_LOG(WARNING) << IOErrorFromErrno(errno, "accept() failed").ToString();
+        } else {
+          auto client = std::make_shared<FileDescriptor>(client_fd);
+          auto submitted = rpc_pool_->Submit(
+              [this, client]() { WorkerLoop(std::move(*client)); });
+          ARROW_WARN_NOT_OK(submitted.status(), "Failed to submit task to handle client");
+        }
+      }
+      for (size_t i = 0; i < polled.size(); ++i) {
+        if (fds[i + 2].revents & (POLLHUP | POLLERR)) {
+          FLIGHT_LOG_PEER(DEBUG, polled[i]->peer()) << "Client hung up";
+          polled[i]->Abort();
+          std::lock_guard<std::mutex> guard(connections_mutex_);
+          auto it = connections_.find(polled[i]);
+          if (it != connections_.end()) it->second = true;
+        }
+      }
+    }
+  }
+
+  void WakeListener() {
+    const uint8_t byte = 0;
+    ARROW_UNUSED(write(wake_pipe_.wfd.fd(), &byte, 1));
+  }
+
+  bool RegisterConnection(const std::shared_ptr<ShmConnection>& connection) {
+    {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      // Checked under the lock, as Shutdown() stops the registered connections
+      if (!listening_.load()) return false;
+      connections_.emplace(connection, false);
+    }
+    WakeListener();
+    return true;
+  }
+
+  void UnregisterConnection(const std::shared_ptr<ShmConnection>& connection) {
+    {
+      std::lock_guard<std::mutex> guard(connections_mutex_);
+      connections_.erase(connection);
+      connections_cv_.notify_all();
+    }
+    WakeListener();
+  }
+
+  Location location_;
+  std::string socket_path_;
+  std::unique_ptr<arrow::internal::TemporaryDir> temp_dir_;
+  FileDescriptor listen_socket_;
+  bool bound_ = false;
+  arrow::internal::Pipe wake_pipe_;
+
+  std::shared_ptr<arrow::internal::ThreadPool> rpc_pool_;
+  std::atomic<bool> listening_{false};
+  std::thread listener_thread_;
+  // std::thread::join cannot be called concurrently
+  std::mutex join_mutex_;
+
+  // The connections being served, and whether they were aborted
+  std::mutex connections_mutex_;
+  std::condition_variable connections_cv_;
+  std::unordered_map<std::shared_ptr<ShmConnection>, bool> connections_;
+};
+}  // namespace
+
+std::unique_ptr<arrow::flight::internal::ServerTransport> MakeShmServerImpl(
+    FlightServerBase* base, std::shared_ptr<MemoryManager> memory_manager) {
+  return std::make_unique<ShmServerImpl>(base, memory_manager);
+}
+
+#undef SERVER_RETURN_NOT_OK
+#undef FLIGHT_LOG
+#undef FLIGHT_LOG_PEER
+
+}  // namespace shm
+}  // namespace transport
+}  // namespace flight
+}  // namespace arrow
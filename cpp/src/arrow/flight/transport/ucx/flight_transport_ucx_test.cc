@@ -318,6 +318,25 @@ TEST_F(TestUcx, ConcurrentClients) {
   AssertTablesEqual(*table1, *table2);
 }
 
+TEST_F(TestUcx, ClientUcxOptions) {
+  auto options = FlightClientOptions::Defaults();
+  options.generic_options.emplace_back("ucx.MAX_RNDV_RAILS", 2);
+  options.generic_options.emplace_back("ucx.RNDV_THRESH", std::string("8k"));
+  // Options for other transports are ignored
+  options.generic_options.emplace_back("grpc.max_receive_message_length", 1);
+  ASSERT_OK_AND_ASSIGN(auto client2, FlightClient::Connect(server_->location(), options));
+
+  Ticket ticket{"a"};
+  ASSERT_OK_AND_ASSIGN(auto stream1, client_->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto table1, stream1->ToTable());
+  ASSERT_OK_AND_ASSIGN(auto stream2, client2->DoGet(ticket));
+  ASSERT_OK_AND_ASSIGN(auto table2, stream2->ToTable());
+  AssertTablesEqual(*table1, *table2);
+
+  options.generic_options = {{"ucx.NOT_A_UCX_VARIABLE", 1}};
+  ASSERT_NOT_OK(FlightClient::Connect(server_->location(), options));
+}
+
 TEST_F(TestUcx, Errors) {
   auto descriptor = FlightDescriptor::Path({"error", "bar"});
   auto* server = reinterpret_cast<SimpleTestServer*>(server_.get());
@@ -35,7 +35,10 @@
 #include <deque>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <variant>
 
 #include <arpa/inet.h>
 #include <ucp/api/ucp.h>
@@ -47,6 +50,7 @@
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string.h"
 #include "arrow/util/uri.h"
 
 namespace arrow {
@@ -57,6 +61,8 @@ namespace ucx {
 namespace {
 class UcxClientImpl;
 
+constexpr std::string_view kUcxOptionPrefix = "ucx.";
+
 Status MergeStatuses(Status server_status, Status transport_status) {
   if (server_status.ok()) {
     if (transport_status.ok()) return server_status;
@@ -542,6 +548,18 @@ class UcxClientImpl : public arrow::flight::internal::ClientTransport {
         }
       }
 
+      // Generic options prefixed with "ucx." set UCX configuration variables, e.g.
+      // {"ucx.MAX_RNDV_RAILS", 2} to stripe large messages across two network devices
+      for (const auto& option : options.generic_options) {
+        if (!arrow::internal::StartsWith(option.first, kUcxOptionPrefix)) continue;
+        const std::string name = option.first.substr(kUcxOptionPrefix.size());
+        const std::string value = std::holds_alternative<int>(option.second)
+                                      ? std::to_string(std::get<int>(option.second))
+                                      : std::get<std::string>(option.second);
+        status = ucp_config_modify(ucp_config, name.c_str(), value.c_str());
+        RETURN_NOT_OK(FromUcsStatus("ucp_config_modify(" + name + ")", status));
+      }
+
       std::memset(&ucp_params, 0, sizeof(ucp_params));
       ucp_params.field_mask = UCP_PARAM_FIELD_FEATURES;
       ucp_params.features = UCP_FEATURE_AM | UCP_FEATURE_WAKEUP;
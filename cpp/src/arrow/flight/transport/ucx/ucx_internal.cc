@@ -683,8 +683,14 @@ class UcpCallDriver::Impl {
         const auto remainder = static_cast<int>(
             bit_util::RoundUpToMultipleOf8(buffer->size()) - buffer->size());
         if (remainder) {
-          iov->buffer =
-              const_cast<void*>(reinterpret_cast<const void*>(padding_bytes_.data()));
+          if (all_cpu) {
+            iov->buffer =
+                const_cast<void*>(reinterpret_cast<const void*>(padding_bytes_.data()));
+          } else {
+            // The whole IOV is sent as device memory, so padding must be too
+            ARROW_ASSIGN_OR_RAISE(pending_iov->device_padding, DevicePadding(*buffer));
+            iov->buffer = reinterpret_cast<void*>(pending_iov->device_padding->address());
+          }
           iov->length = remainder;
           ++iov;
         }
@@ -840,6 +846,7 @@ class UcpCallDriver::Impl {
    public:
     FlightPayload payload;
     std::vector<ucp_dt_iov_t> iovs;
+    std::shared_ptr<Buffer> device_padding;
 #if defined(ARROW_FLIGHT_UCX_SEND_IOV_MAP)
     std::vector<ucp_mem_h> memh_ps;
 
@@ -854,7 +861,7 @@ class UcpCallDriver::Impl {
   struct PendingAmRecv {
     UcpCallDriver::Impl* driver;
     std::shared_ptr<Frame> frame;
-    ucp_mem_h memh_p;
+    ucp_mem_h memh_p = nullptr;
 
     PendingAmRecv(UcpCallDriver::Impl* driver_, std::shared_ptr<Frame> frame_)
         : driver(driver_), frame(std::move(frame_)) {}
@@ -951,6 +958,14 @@ class UcpCallDriver::Impl {
       recv_param.cb.recv_am = AmRecvCallback;
       recv_param.user_data = pending_recv;
       recv_param.memory_type = InferMemoryType(*pending_recv->frame->buffer);
+#if UCP_API_VERSION >= UCP_VERSION(1, 14)
+      // Let UCX receive directly into the registered buffer instead of registering
+      // it again, or staging the data, for the transfer
+      if (pending_recv->memh_p) {
+        recv_param.op_attr_mask |= UCP_OP_ATTR_FIELD_MEMH;
+        recv_param.memh = pending_recv->memh_p;
+      }
+#endif
 
       void* dest =
           reinterpret_cast<void*>(pending_recv->frame->buffer->mutable_address());
@@ -1005,6 +1020,18 @@ class UcpCallDriver::Impl {
     return Status::OK();
   }
 
+  // Zeroes on the device of `buffer`, for padding device buffers
+  arrow::Result<std::shared_ptr<Buffer>> DevicePadding(const Buffer& buffer) {
+    if (!device_padding_ || !device_padding_->device()->Equals(*buffer.device())) {
+      ARROW_ASSIGN_OR_RAISE(
+          device_padding_,
+          MemoryManager::CopyNonOwned(
+              Buffer(padding_bytes_.data(), static_cast<int64_t>(padding_bytes_.size())),
+              buffer.memory_manager()));
+    }
+    return device_padding_;
+  }
+
   Status CheckClosed() {
     if (!endpoint_) {
       return Status::Invalid("UcpCallDriver is closed");
@@ -1022,6 +1049,7 @@ class UcpCallDriver::Impl {
   MemoryPool* read_memory_pool_;
   MemoryPool* write_memory_pool_;
   std::shared_ptr<MemoryManager> memory_manager_;
+  std::shared_ptr<Buffer> device_padding_;
 
   // Internal name for logging/tracing
   std::string name_;
@@ -0,0 +1,891 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/gpu/cuda_compute.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cuda.h>
+#include <nvrtc.h>
+
+#include "arrow/array/array_base.h"
+#include "arrow/array/util.h"
+#include "arrow/array/data.h"
+#include "arrow/buffer.h"
+#include "arrow/gpu/cuda_context.h"
+#include "arrow/gpu/cuda_internal.h"
+#include "arrow/gpu/cuda_memory.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace cuda {
+
+using internal::ContextSaver;
+
+namespace {
+
+constexpr int64_t kThreadsPerBlock = 256;
+
+// The kernels take the addresses of the buffers of their inputs along with the
+// array offsets, and write their outputs from offset 0. Bitmaps are written a byte
+// per thread, or a byte per element then packed when the output position of the
+// elements isn't known in advance.
+const char kKernelSource[] = R"cuda(
+typedef signed char int8_t;
+typedef unsigned char uint8_t;
+typedef short int16_t;
+typedef unsigned short uint16_t;
+typedef int int32_t;
+typedef unsigned int uint32_t;
+typedef long long int64_t;
+typedef unsigned long long uint64_t;
+
+__device__ __forceinline__ int64_t ThreadIndex() {
+  return static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+}
+
+__device__ __forceinline__ bool GetBit(const uint8_t* bits, int64_t i) {
+  return (bits[i >> 3] >> (i & 7)) & 1;
+}
+
+__device__ __forceinline__ bool IsValid(const uint8_t* validity, int64_t i) {
+  return validity == nullptr || GetBit(validity, i);
+}
+
+// The number of elements in the output byte of bitmap starting at `begin`
+__device__ __forceinline__ int NumBits(int64_t begin, int64_t length) {
+  return length - begin < 8 ? static_cast<int>(length - begin) : 8;
+}
+
+__device__ __forceinline__ void CountZeros(uint8_t bits, int num_bits,
+                                           uint64_t* count) {
+  const int zeros = num_bits - __popc(bits);
+  if (count != nullptr && zeros > 0) {
+    atomicAdd(count, static_cast<uint64_t>(zeros));
+  }
+}
+
+// Values are read as unsigned integers of their width, or as bits for booleans.
+// Selections write a byte per boolean, to be packed afterwards.
+template <typename U>
+struct Fixed {
+  typedef U Out;
+  static __device__ __forceinline__ U Read(const void* values, int64_t i) {
+    return static_cast<const U*>(values)[i];
+  }
+};
+
+struct Bit {
+  typedef uint8_t Out;
+  static __device__ __forceinline__ uint8_t Read(const void* values, int64_t i) {
+    return GetBit(static_cast<const uint8_t*>(values), i);
+  }
+};
+
+extern "C" __global__ void and_validity(const uint8_t* left, int64_t left_offset,
+                                        const uint8_t* right, int64_t right_offset,
+                                        int64_t length, uint8_t* out,
+                                        uint64_t* null_count) {
+  const int64_t begin = ThreadIndex() * 8;
+  if (begin >= length) return;
+  const int n = NumBits(begin, length);
+  uint8_t bits = 0;
+  for (int j = 0; j < n; ++j) {
+    const int64_t i = begin + j;
+    const bool valid = IsValid(left, left_offset + i) && IsValid(right, right_offset + i);
+    bits |= static_cast<uint8_t>(valid) << j;
+  }
+  out[begin / 8] = bits;
+  CountZeros(bits, n, null_count);
+}
+
+extern "C" __global__ void pack_bits(const uint8_t* bytes, int64_t length,
+                                     uint8_t* out, uint64_t* zero_count) {
+  const int64_t begin = ThreadIndex() * 8;
+  if (begin >= length) return;
+  const int n = NumBits(begin, length);
+  uint8_t bits = 0;
+  for (int j = 0; j < n; ++j) {
+    bits |= static_cast<uint8_t>(bytes[begin + j] != 0) << j;
+  }
+  out[begin / 8] = bits;
+  CountZeros(bits, n, zero_count);
+}
+
+#define COMPARE_KERNEL(NAME, OP, T)                                                  \
+  extern "C" __global__ void compare_##NAME##_##T(                                   \
+      const T* left, int64_t left_offset, const T* right, int64_t right_offset,      \
+      T right_value, int64_t length, uint8_t* out) {                                 \
+    const int64_t begin = ThreadIndex() * 8;                                         \
+    if (begin >= length) return;                                                     \
+    const int n = NumBits(begin, length);                                            \
+    uint8_t bits = 0;                                                                \
+    for (int j = 0; j < n; ++j) {                                                    \
+      const T r = right != nullptr ? right[right_offset + begin + j] : right_value;  \
+      bits |= static_cast<uint8_t>(left[left_offset + begin + j] OP r) << j;         \
+    }                                                                                \
+    out[begin / 8] = bits;                                                           \
+  }
+
+// Integers are computed as unsigned integers of at least 32 bits, so that overflow
+// wraps around instead of being undefined
+#define ARITHMETIC_KERNEL(NAME, OP, T, U)                                            \
+  extern "C" __global__ void arithmetic_##NAME##_##T(                                \
+      const T* left, int64_t left_offset, const T* right, int64_t right_offset,      \
+      T right_value, int64_t length, T* out) {                                       \
+    const int64_t i = ThreadIndex();                                                 \
+    if (i >= length) return;                                                         \
+    const T r = right != nullptr ? right[right_offset + i] : right_value;            \
+    const U l = static_cast<U>(left[left_offset + i]);                               \
+    out[i] = static_cast<T>(l OP static_cast<U>(r));                                 \
+  }
+
+#define NUMERIC_KERNELS(T, U)               \
+  COMPARE_KERNEL(eq, ==, T)                 \
+  COMPARE_KERNEL(ne, !=, T)                 \
+  COMPARE_KERNEL(lt, <, T)                  \
+  COMPARE_KERNEL(le, <=, T)                 \
+  COMPARE_KERNEL(gt, >, T)                  \
+  COMPARE_KERNEL(ge, >=, T)                 \
+  ARITHMETIC_KERNEL(add, +, T, U)           \
+  ARITHMETIC_KERNEL(sub, -, T, U)           \
+  ARITHMETIC_KERNEL(mul, *, T, U)
+
+NUMERIC_KERNELS(int8_t, uint32_t)
+NUMERIC_KERNELS(uint8_t, uint32_t)
+NUMERIC_KERNELS(int16_t, uint32_t)
+NUMERIC_KERNELS(uint16_t, uint32_t)
+NUMERIC_KERNELS(int32_t, uint32_t)
+NUMERIC_KERNELS(uint32_t, uint32_t)
+NUMERIC_KERNELS(int64_t, uint64_t)
+NUMERIC_KERNELS(uint64_t, uint64_t)
+NUMERIC_KERNELS(float, float)
+NUMERIC_KERNELS(double, double)
+
+// Same as Hashing64::HashInt() on the host
+__device__ __forceinline__ uint64_t HashInt(uint64_t value) {
+  const uint64_t product = value * 11400714785074694791ULL;
+  const uint64_t low = __byte_perm(static_cast<uint32_t>(product), 0, 0x0123);
+  const uint64_t high = __byte_perm(static_cast<uint32_t>(product >> 32), 0, 0x0123);
+  return (low << 32) | high;
+}
+
+#define HASH_KERNEL(WIDTH, U)                                                        \
+  extern "C" __global__ void hash_##WIDTH(const U* values, const uint8_t* validity,  \
+                                          int64_t offset, int64_t length,            \
+                                          uint64_t* out) {                           \
+    const int64_t i = ThreadIndex();                                                 \
+    if (i >= length) return;                                                         \
+    out[i] = IsValid(validity, offset + i) ? HashInt(values[offset + i]) : 0;        \
+  }
+
+HASH_KERNEL(1, uint8_t)
+HASH_KERNEL(2, uint16_t)
+HASH_KERNEL(4, uint32_t)
+HASH_KERNEL(8, uint64_t)
+
+__device__ __forceinline__ bool IsSelected(const uint8_t* mask,
+                                           const uint8_t* mask_validity,
+                                           int64_t mask_offset, int64_t i,
+                                           int64_t length) {
+  return i < length && GetBit(mask, mask_offset + i) &&
+         IsValid(mask_validity, mask_offset + i);
+}
+
+extern "C" __global__ void filter_count(const uint8_t* mask,
+                                        const uint8_t* mask_validity,
+                                        int64_t mask_offset, int64_t length,
+                                        uint32_t* block_counts) {
+  const bool selected =
+      IsSelected(mask, mask_validity, mask_offset, ThreadIndex(), length);
+  const int count = __syncthreads_count(selected);
+  if (threadIdx.x == 0) {
+    block_counts[blockIdx.x] = count;
+  }
+}
+
+// The output position of a selected element: the offset of its block plus the
+// number of selected elements before it in the block. All the threads of the block
+// must call it.
+__device__ __forceinline__ int64_t SelectedPosition(bool selected,
+                                                    const uint64_t* block_offsets) {
+  __shared__ int warp_counts[32];
+  const unsigned int lane = threadIdx.x & 31;
+  const unsigned int warp = threadIdx.x >> 5;
+  const unsigned int ballot = __ballot_sync(0xffffffffu, selected);
+  if (lane == 0) {
+    warp_counts[warp] = __popc(ballot);
+  }
+  __syncthreads();
+  int64_t position = block_offsets[blockIdx.x] + __popc(ballot & ((1u << lane) - 1));
+  for (unsigned int w = 0; w < warp; ++w) {
+    position += warp_counts[w];
+  }
+  return position;
+}
+
+template <typename Kind>
+__device__ __forceinline__ void Filter(const uint8_t* mask, const uint8_t* mask_validity,
+                                       int64_t mask_offset, int64_t length,
+                                       const uint64_t* block_offsets,
+                                       const void* values, const uint8_t* validity,
+                                       int64_t values_offset,
+                                       typename Kind::Out* out, uint8_t* out_valid) {
+  const int64_t i = ThreadIndex();
+  const bool selected = IsSelected(mask, mask_validity, mask_offset, i, length);
+  const int64_t position = SelectedPosition(selected, block_offsets);
+  if (!selected) return;
+  out[position] = Kind::Read(values, values_offset + i);
+  if (out_valid != nullptr) {
+    out_valid[position] = IsValid(validity, values_offset + i);
+  }
+}
+
+template <typename Kind, typename I>
+__device__ __forceinline__ void Take(const void* values, const uint8_t* validity,
+                                     int64_t values_offset, int64_t values_length,
+                                     const I* indices, const uint8_t* indices_validity,
+                                     int64_t indices_offset, int64_t length,
+                                     typename Kind::Out* out, uint8_t* out_valid,
+                                     uint64_t* out_of_bounds) {
+  const int64_t i = ThreadIndex();
+  if (i >= length) return;
+  typename Kind::Out value = 0;
+  bool valid = IsValid(indices_validity, indices_offset + i);
+  if (valid) {
+    const int64_t index = indices[indices_offset + i];
+    if (index < 0 || index >= values_length) {
+      *out_of_bounds = 1;
+      valid = false;
+    } else {
+      value = Kind::Read(values, values_offset + index);
+      valid = IsValid(validity, values_offset + index);
+    }
+  }
+  out[i] = value;
+  if (out_valid != nullptr) {
+    out_valid[i] = valid;
+  }
+}
+
+#define SELECTION_KERNELS(NAME, KIND)                                                \
+  extern "C" __global__ void filter_##NAME(                                          \
+      const uint8_t* mask, const uint8_t* mask_validity, int64_t mask_offset,        \
+      int64_t length, const uint64_t* block_offsets, const void* values,             \
+      const uint8_t* validity, int64_t values_offset, KIND::Out* out,                \
+      uint8_t* out_valid) {                                                          \
+    Filter<KIND>(mask, mask_validity, mask_offset, length, block_offsets, values,    \
+                 validity, values_offset, out, out_valid);                           \
+  }                                                                                  \
+  TAKE_KERNEL(NAME, KIND, int32_t)                                                   \
+  TAKE_KERNEL(NAME, KIND, int64_t)
+
+#define TAKE_KERNEL(NAME, KIND, I)                                                   \
+  extern "C" __global__ void take_##NAME##_##I(                                      \
+      const void* values, const uint8_t* validity, int64_t values_offset,            \
+      int64_t values_length, const I* indices, const uint8_t* indices_validity,      \
+      int64_t indices_offset, int64_t length, KIND::Out* out, uint8_t* out_valid,    \
+      uint64_t* out_of_bounds) {                                                     \
+    Take<KIND, I>(values, validity, values_offset, values_length, indices,           \
+                  indices_validity, indices_offset, length, out, out_valid,          \
+                  out_of_bounds);                                                    \
+  }
+
+SELECTION_KERNELS(1, Fixed<uint8_t>)
+SELECTION_KERNELS(2, Fixed<uint16_t>)
+SELECTION_KERNELS(4, Fixed<uint32_t>)
+SELECTION_KERNELS(8, Fixed<uint64_t>)
+SELECTION_KERNELS(bit, Bit)
+)cuda";
+
+#define NVRTC_RETURN_NOT_OK(FUNC_NAME, STMT)                                      \
+  do {                                                                            \
+    nvrtcResult __res = (STMT);                                                   \
+    if (__res != NVRTC_SUCCESS) {                                                 \
+      return Status::IOError("NVRTC error in function '", FUNC_NAME,              \
+                             "': ", nvrtcGetErrorString(__res));                  \
+    }                                                                             \
+  } while (0)
+
+// Compile the kernels to PTX for a compute capability
+Result<std::string> CompileKernels(int major, int minor) {
+  nvrtcProgram program;
+  NVRTC_RETURN_NOT_OK("nvrtcCreateProgram",
+                      nvrtcCreateProgram(&program, kKernelSource, "arrow_cuda_compute.cu",
+                                         /*numHeaders=*/0, /*headers=*/nullptr,
+                                         /*includeNames=*/nullptr));
+  struct ProgramGuard {
+    ~ProgramGuard() { nvrtcDestroyProgram(program); }
+    nvrtcProgram* program;
+  } guard{&program};
+
+  const std::string arch =
+      "--gpu-architecture=compute_" + std::to_string(major * 10 + minor);
+  const char* options[] = {arch.c_str(), "--std=c++14"};
+  const nvrtcResult res = nvrtcCompileProgram(program, 2, options);
+  if (res != NVRTC_SUCCESS) {
+    size_t log_size = 0;
+    std::string log;
+    if (nvrtcGetProgramLogSize(program, &log_size) == NVRTC_SUCCESS && log_size > 0) {
+      log.resize(log_size);
+      nvrtcGetProgramLog(program, &log[0]);
+      log.resize(log_size - 1);
+    }
+    return Status::IOError("NVRTC error in function 'nvrtcCompileProgram': ",
+                           nvrtcGetErrorString(res), "\n", log);
+  }
+  size_t ptx_size = 0;
+  NVRTC_RETURN_NOT_OK("nvrtcGetPTXSize", nvrtcGetPTXSize(program, &ptx_size));
+  // Includes the null terminator, which cuModuleLoadData() needs
+  std::string ptx(ptx_size, '\0');
+  NVRTC_RETURN_NOT_OK("nvrtcGetPTX", nvrtcGetPTX(program, &ptx[0]));
+  return ptx;
+}
+
+// The kernels loaded in a CUDA context
+class KernelModule {
+ public:
+  KernelModule(CUcontext context, CUmodule module) : context_(context), module_(module) {}
+
+  // The module is unloaded along with the context, so it isn't unloaded here
+  static Result<std::shared_ptr<KernelModule>> Get(
+      const std::shared_ptr<CudaContext>& context) {
+    struct Entry {
+      std::weak_ptr<CudaContext> context;
+      std::shared_ptr<KernelModule> module;
+    };
+    static std::mutex mutex;
+    // PTX by compute capability, modules by context handle
+    static std::unordered_map<int, std::string> ptx_cache;
+    static std::unordered_map<void*, Entry> modules;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = modules.find(context->handle());
+    // A handle may be reused by a new context once the previous one is destroyed
+    if (it != modules.end() && !it->second.context.expired()) {
+      return it->second.module;
+    }
+
+    const CUdevice device = context->device()->handle();
+    int major = 0;
+    int minor = 0;
+    CU_RETURN_NOT_OK("cuDeviceGetAttribute",
+                     cuDeviceGetAttribute(
+                         &major, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR, device));
+    CU_RETURN_NOT_OK("cuDeviceGetAttribute",
+                     cuDeviceGetAttribute(
+                         &minor, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR, device));
+    const int capability = major * 10 + minor;
+    auto ptx_it = ptx_cache.find(capability);
+    if (ptx_it == ptx_cache.end()) {
+      ARROW_ASSIGN_OR_RAISE(std::string ptx, CompileKernels(major, minor));
+      ptx_it = ptx_cache.emplace(capability, std::move(ptx)).first;
+    }
+
+    ContextSaver set_temporary(*context);
+    CUmodule module;
+    CU_RETURN_NOT_OK("cuModuleLoadData",
+                     cuModuleLoadData(&module, ptx_it->second.data()));
+    auto kernel_module = std::make_shared<KernelModule>(
+        reinterpret_cast<CUcontext>(context->handle()), module);
+    modules[context->handle()] = Entry{context, kernel_module};
+    return kernel_module;
+  }
+
+  // Launch a kernel with a thread per element of `num_threads`. `params` point to
+  // the values of its parameters.
+  Status Launch(const std::string& name, int64_t num_threads,
+                std::vector<void*> params) {
+    if (num_threads == 0) {
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(CUfunction function, GetFunction(name));
+    const int64_t num_blocks = bit_util::CeilDiv(num_threads, kThreadsPerBlock);
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuLaunchKernel",
+                     cuLaunchKernel(function, static_cast<unsigned int>(num_blocks), 1, 1,
+                                    static_cast<unsigned int>(kThreadsPerBlock), 1, 1,
+                                    /*sharedMemBytes=*/0, /*hStream=*/nullptr,
+                                    params.data(), /*extra=*/nullptr));
+    return Status::OK();
+  }
+
+ private:
+  Result<CUfunction> GetFunction(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = functions_.find(name);
+    if (it == functions_.end()) {
+      CUfunction function;
+      CU_RETURN_NOT_OK("cuModuleGetFunction",
+                       cuModuleGetFunction(&function, module_, name.c_str()));
+      it = functions_.emplace(name, function).first;
+    }
+    return it->second;
+  }
+
+  const CUcontext context_;
+  const CUmodule module_;
+  std::mutex mutex_;
+  std::unordered_map<std::string, CUfunction> functions_;
+};
+
+// The context of the device holding the buffers of the arrays, with its kernels
+struct DeviceContext {
+  static Result<DeviceContext> Make(const std::vector<const ArrayData*>& arrays) {
+    DeviceContext out;
+    for (const ArrayData* array : arrays) {
+      for (const auto& buffer : array->buffers) {
+        if (buffer == nullptr) {
+          continue;
+        }
+        if (out.context == nullptr) {
+          ARROW_ASSIGN_OR_RAISE(auto mm, AsCudaMemoryManager(buffer->memory_manager()));
+          ARROW_ASSIGN_OR_RAISE(out.context, mm->cuda_device()->GetContext());
+        } else if (!buffer->device()->Equals(*out.context->device())) {
+          return Status::Invalid("CUDA compute functions need all buffers on ",
+                                 out.context->device()->ToString(), ", got ",
+                                 buffer->device()->ToString());
+        }
+      }
+    }
+    if (out.context == nullptr) {
+      return Status::Invalid("CUDA compute functions need arrays with buffers");
+    }
+    ARROW_ASSIGN_OR_RAISE(out.kernels, KernelModule::Get(out.context));
+    return out;
+  }
+
+  // Device memory for `nbytes`, padded like host buffers
+  Result<std::shared_ptr<Buffer>> Allocate(int64_t nbytes) const {
+    ARROW_ASSIGN_OR_RAISE(
+        auto buffer,
+        context->Allocate(bit_util::RoundUpToMultipleOf64(std::max<int64_t>(nbytes, 1))));
+    return std::shared_ptr<Buffer>(std::move(buffer));
+  }
+
+  // A uint64 in device memory, initialized to 0, for kernels to count into
+  Result<std::shared_ptr<CudaBuffer>> AllocateCounter() const {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, context->Allocate(sizeof(uint64_t)));
+    const uint64_t zero = 0;
+    RETURN_NOT_OK(buffer->CopyFromHost(0, &zero, sizeof(zero)));
+    return std::shared_ptr<CudaBuffer>(std::move(buffer));
+  }
+
+  // Pack a byte per element into a bitmap, returning it along with its number of
+  // zeros
+  Result<std::pair<std::shared_ptr<Buffer>, int64_t>> PackBits(const Buffer& bytes,
+                                                                int64_t length) const {
+    ARROW_ASSIGN_OR_RAISE(auto bitmap, Allocate(bit_util::BytesForBits(length)));
+    ARROW_ASSIGN_OR_RAISE(auto zero_count, AllocateCounter());
+    CUdeviceptr bytes_address = bytes.address();
+    CUdeviceptr bitmap_address = bitmap->address();
+    CUdeviceptr zero_count_address = zero_count->address();
+    RETURN_NOT_OK(kernels->Launch(
+        "pack_bits", bit_util::CeilDiv(length, 8),
+        {&bytes_address, &length, &bitmap_address, &zero_count_address}));
+    uint64_t zeros = 0;
+    RETURN_NOT_OK(zero_count->CopyToHost(0, sizeof(zeros), &zeros));
+    return std::make_pair(std::move(bitmap), static_cast<int64_t>(zeros));
+  }
+
+  std::shared_ptr<CudaContext> context;
+  std::shared_ptr<KernelModule> kernels;
+};
+
+CUdeviceptr BufferAddress(const ArrayData& array, int i) {
+  const auto& buffer = array.buffers[i];
+  return buffer != nullptr ? buffer->address() : 0;
+}
+
+// The validity bitmap, or 0 if there are no nulls. The null count may be unknown,
+// but isn't computed since the bitmap isn't readable from the host.
+CUdeviceptr ValidityAddress(const ArrayData& array) {
+  return array.MayHaveNulls() ? BufferAddress(array, 0) : 0;
+}
+
+// The type of the values in the kernels, or null if it isn't supported
+const char* NumericKernelType(const DataType& type) {
+  switch (type.id()) {
+    case Type::INT8:
+      return "int8_t";
+    case Type::UINT8:
+      return "uint8_t";
+    case Type::INT16:
+      return "int16_t";
+    case Type::UINT16:
+      return "uint16_t";
+    case Type::INT32:
+      return "int32_t";
+    case Type::UINT32:
+      return "uint32_t";
+    case Type::INT64:
+      return "int64_t";
+    case Type::UINT64:
+      return "uint64_t";
+    case Type::FLOAT:
+      return "float";
+    case Type::DOUBLE:
+      return "double";
+    default:
+      return nullptr;
+  }
+}
+
+Result<const char*> GetNumericKernelType(const DataType& type) {
+  const char* name = NumericKernelType(type);
+  if (name == nullptr) {
+    return Status::NotImplemented("CUDA compute functions for type ", type);
+  }
+  return name;
+}
+
+int ByteWidth(const DataType& type) {
+  return checked_cast<const FixedWidthType&>(type).bit_width() / 8;
+}
+
+// The name of the selection kernels for the type of the values
+Result<std::string> SelectionKernelName(const DataType& type) {
+  if (type.id() == Type::BOOL) {
+    return "bit";
+  }
+  RETURN_NOT_OK(GetNumericKernelType(type));
+  return std::to_string(ByteWidth(type));
+}
+
+// Apply a binary kernel taking the left values and either the right values or
+// `right_value`
+Result<std::shared_ptr<Array>> ExecBinary(const std::string& kernel_name,
+                                          const ArrayData& left, const ArrayData* right,
+                                          const void* right_value,
+                                          const std::shared_ptr<DataType>& out_type) {
+  std::vector<const ArrayData*> inputs = {&left};
+  if (right != nullptr) {
+    inputs.push_back(right);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto device, DeviceContext::Make(inputs));
+
+  int64_t length = left.length;
+  const bool boolean_out = out_type->id() == Type::BOOL;
+  ARROW_ASSIGN_OR_RAISE(auto data,
+                        device.Allocate(boolean_out ? bit_util::BytesForBits(length)
+                                                    : length * ByteWidth(*out_type)));
+  CUdeviceptr left_values = BufferAddress(left, 1);
+  int64_t left_offset = left.offset;
+  CUdeviceptr right_values = right != nullptr ? BufferAddress(*right, 1) : 0;
+  int64_t right_offset = right != nullptr ? right->offset : 0;
+  uint64_t unused_value = 0;
+  void* right_value_param =
+      right_value != nullptr ? const_cast<void*>(right_value) : &unused_value;
+  CUdeviceptr out = data->address();
+  RETURN_NOT_OK(device.kernels->Launch(
+      kernel_name, boolean_out ? bit_util::CeilDiv(length, 8) : length,
+      {&left_values, &left_offset, &right_values, &right_offset, right_value_param,
+       &length, &out}));
+
+  std::shared_ptr<Buffer> validity;
+  int64_t null_count = 0;
+  CUdeviceptr left_validity = ValidityAddress(left);
+  CUdeviceptr right_validity = right != nullptr ? ValidityAddress(*right) : 0;
+  if (left_validity != 0 || right_validity != 0) {
+    ARROW_ASSIGN_OR_RAISE(validity, device.Allocate(bit_util::BytesForBits(length)));
+    ARROW_ASSIGN_OR_RAISE(auto counter, device.AllocateCounter());
+    CUdeviceptr validity_address = validity->address();
+    CUdeviceptr counter_address = counter->address();
+    RETURN_NOT_OK(device.kernels->Launch(
+        "and_validity", bit_util::CeilDiv(length, 8),
+        {&left_validity, &left_offset, &right_validity, &right_offset, &length,
+         &validity_address, &counter_address}));
+    uint64_t nulls = 0;
+    RETURN_NOT_OK(counter->CopyToHost(0, sizeof(nulls), &nulls));
+    null_count = static_cast<int64_t>(nulls);
+  }
+  return MakeArray(ArrayData::Make(out_type, length,
+                                   {std::move(validity), std::move(data)}, null_count));
+}
+
+Status CheckBinaryArrays(const Array& left, const Array& right) {
+  if (!left.type()->Equals(*right.type())) {
+    return Status::TypeError(
+        "CUDA compute functions need operands of the same type, got ", *left.type(),
+        " and ", *right.type());
+  }
+  if (left.length() != right.length()) {
+    return Status::Invalid("CUDA compute functions need operands of the same length");
+  }
+  return Status::OK();
+}
+
+Status CheckBinaryScalar(const Array& left, const Scalar& right) {
+  if (!left.type()->Equals(*right.type)) {
+    return Status::TypeError(
+        "CUDA compute functions need operands of the same type, got ", *left.type(),
+        " and ", *right.type);
+  }
+  if (!right.is_valid) {
+    return Status::Invalid("CUDA compute functions need a valid scalar operand");
+  }
+  return Status::OK();
+}
+
+const void* ScalarValue(const Scalar& scalar) {
+  return checked_cast<const ::arrow::internal::PrimitiveScalarBase&>(scalar).data();
+}
+
+const char* CompareName(CompareOperator op) {
+  switch (op) {
+    case CompareOperator::kEqual:
+      return "eq";
+    case CompareOperator::kNotEqual:
+      return "ne";
+    case CompareOperator::kLess:
+      return "lt";
+    case CompareOperator::kLessEqual:
+      return "le";
+    case CompareOperator::kGreater:
+      return "gt";
+    case CompareOperator::kGreaterEqual:
+      return "ge";
+  }
+  return "";
+}
+
+const char* ArithmeticName(ArithmeticOperator op) {
+  switch (op) {
+    case ArithmeticOperator::kAdd:
+      return "add";
+    case ArithmeticOperator::kSubtract:
+      return "sub";
+    case ArithmeticOperator::kMultiply:
+      return "mul";
+  }
+  return "";
+}
+
+Result<std::string> CompareKernelName(CompareOperator op, const DataType& type) {
+  ARROW_ASSIGN_OR_RAISE(const char* type_name, GetNumericKernelType(type));
+  return std::string("compare_") + CompareName(op) + "_" + type_name;
+}
+
+Result<std::string> ArithmeticKernelName(ArithmeticOperator op, const DataType& type) {
+  ARROW_ASSIGN_OR_RAISE(const char* type_name, GetNumericKernelType(type));
+  return std::string("arithmetic_") + ArithmeticName(op) + "_" + type_name;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Array>> Compare(CompareOperator op, const Array& left,
+                                       const Array& right) {
+  RETURN_NOT_OK(CheckBinaryArrays(left, right));
+  ARROW_ASSIGN_OR_RAISE(auto kernel_name, CompareKernelName(op, *left.type()));
+  return ExecBinary(kernel_name, *left.data(), right.data().get(),
+                    /*right_value=*/nullptr, boolean());
+}
+
+Result<std::shared_ptr<Array>> Compare(CompareOperator op, const Array& left,
+                                       const Scalar& right) {
+  RETURN_NOT_OK(CheckBinaryScalar(left, right));
+  ARROW_ASSIGN_OR_RAISE(auto kernel_name, CompareKernelName(op, *left.type()));
+  return ExecBinary(kernel_name, *left.data(), /*right=*/nullptr, ScalarValue(right),
+                    boolean());
+}
+
+Result<std::shared_ptr<Array>> Arithmetic(ArithmeticOperator op, const Array& left,
+                                          const Array& right) {
+  RETURN_NOT_OK(CheckBinaryArrays(left, right));
+  ARROW_ASSIGN_OR_RAISE(auto kernel_name, ArithmeticKernelName(op, *left.type()));
+  return ExecBinary(kernel_name, *left.data(), right.data().get(),
+                    /*right_value=*/nullptr, left.type());
+}
+
+Result<std::shared_ptr<Array>> Arithmetic(ArithmeticOperator op, const Array& left,
+                                          const Scalar& right) {
+  RETURN_NOT_OK(CheckBinaryScalar(left, right));
+  ARROW_ASSIGN_OR_RAISE(auto kernel_name, ArithmeticKernelName(op, *left.type()));
+  return ExecBinary(kernel_name, *left.data(), /*right=*/nullptr, ScalarValue(right),
+                    left.type());
+}
+
+Result<std::shared_ptr<Array>> Filter(const Array& values, const Array& selection) {
+  if (selection.type_id() != Type::BOOL) {
+    return Status::TypeError("Filter selection must be boolean, got ",
+                             *selection.type());
+  }
+  if (selection.length() != values.length()) {
+    return Status::Invalid("Filter selection must have the same length as the values");
+  }
+  ARROW_ASSIGN_OR_RAISE(const std::string kernel_name,
+                        SelectionKernelName(*values.type()));
+  const ArrayData& data = *values.data();
+  const ArrayData& mask = *selection.data();
+  ARROW_ASSIGN_OR_RAISE(auto device, DeviceContext::Make({&data, &mask}));
+
+  // Count the selected elements of each block, then compute the output offsets of
+  // the blocks on the host. There are few enough blocks for that to be cheap.
+  int64_t length = data.length;
+  const int64_t num_blocks = bit_util::CeilDiv(length, kThreadsPerBlock);
+  CUdeviceptr mask_values = BufferAddress(mask, 1);
+  CUdeviceptr mask_validity = ValidityAddress(mask);
+  int64_t mask_offset = mask.offset;
+  ARROW_ASSIGN_OR_RAISE(auto block_counts,
+                        device.Allocate(num_blocks * sizeof(uint32_t)));
+  CUdeviceptr block_counts_address = block_counts->address();
+  RETURN_NOT_OK(device.kernels->Launch(
+      "filter_count", length,
+      {&mask_values, &mask_validity, &mask_offset, &length, &block_counts_address}));
+  std::vector<uint32_t> counts(num_blocks);
+  std::vector<uint64_t> offsets(num_blocks);
+  int64_t out_length = 0;
+  if (num_blocks > 0) {
+    RETURN_NOT_OK(checked_cast<const CudaBuffer&>(*block_counts)
+                      .CopyToHost(0, num_blocks * sizeof(uint32_t), counts.data()));
+  }
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    offsets[i] = static_cast<uint64_t>(out_length);
+    out_length += counts[i];
+  }
+  ARROW_ASSIGN_OR_RAISE(auto block_offsets,
+                        device.Allocate(num_blocks * sizeof(uint64_t)));
+  if (num_blocks > 0) {
+    RETURN_NOT_OK(checked_cast<CudaBuffer&>(*block_offsets)
+                      .CopyFromHost(0, offsets.data(), num_blocks * sizeof(uint64_t)));
+  }
+
+  const bool is_boolean = data.type->id() == Type::BOOL;
+  ARROW_ASSIGN_OR_RAISE(
+      auto out, device.Allocate(is_boolean ? out_length
+                                           : out_length * ByteWidth(*data.type)));
+  CUdeviceptr validity = ValidityAddress(data);
+  std::shared_ptr<Buffer> out_valid;
+  if (validity != 0) {
+    ARROW_ASSIGN_OR_RAISE(out_valid, device.Allocate(out_length));
+  }
+  CUdeviceptr block_offsets_address = block_offsets->address();
+  CUdeviceptr values_address = BufferAddress(data, 1);
+  int64_t values_offset = data.offset;
+  CUdeviceptr out_address = out->address();
+  CUdeviceptr out_valid_address = out_valid != nullptr ? out_valid->address() : 0;
+  RETURN_NOT_OK(device.kernels->Launch(
+      "filter_" + kernel_name, length,
+      {&mask_values, &mask_validity, &mask_offset, &length, &block_offsets_address,
+       &values_address, &validity, &values_offset, &out_address, &out_valid_address}));
+
+  if (is_boolean) {
+    ARROW_ASSIGN_OR_RAISE(auto packed, device.PackBits(*out, out_length));
+    out = std::move(packed.first);
+  }
+  int64_t null_count = 0;
+  if (out_valid != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto packed, device.PackBits(*out_valid, out_length));
+    out_valid = std::move(packed.first);
+    null_count = packed.second;
+  }
+  return MakeArray(ArrayData::Make(data.type, out_length,
+                                   {std::move(out_valid), std::move(out)}, null_count));
+}
+
+Result<std::shared_ptr<Array>> Take(const Array& values, const Array& indices) {
+  if (indices.type_id() != Type::INT32 && indices.type_id() != Type::INT64) {
+    return Status::TypeError("Take indices must be int32 or int64, got ",
+                             *indices.type());
+  }
+  ARROW_ASSIGN_OR_RAISE(const std::string kernel_name,
+                        SelectionKernelName(*values.type()));
+  const ArrayData& data = *values.data();
+  const ArrayData& index_data = *indices.data();
+  ARROW_ASSIGN_OR_RAISE(auto device, DeviceContext::Make({&data, &index_data}));
+
+  int64_t length = index_data.length;
+  const bool is_boolean = data.type->id() == Type::BOOL;
+  ARROW_ASSIGN_OR_RAISE(
+      auto out,
+      device.Allocate(is_boolean ? length : length * ByteWidth(*data.type)));
+  CUdeviceptr validity = ValidityAddress(data);
+  CUdeviceptr indices_validity = ValidityAddress(index_data);
+  std::shared_ptr<Buffer> out_valid;
+  if (validity != 0 || indices_validity != 0) {
+    ARROW_ASSIGN_OR_RAISE(out_valid, device.Allocate(length));
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out_of_bounds, device.AllocateCounter());
+  CUdeviceptr values_address = BufferAddress(data, 1);
+  int64_t values_offset = data.offset;
+  int64_t values_length = data.length;
+  CUdeviceptr indices_address = BufferAddress(index_data, 1);
+  int64_t indices_offset = index_data.offset;
+  CUdeviceptr out_address = out->address();
+  CUdeviceptr out_valid_address = out_valid != nullptr ? out_valid->address() : 0;
+  CUdeviceptr out_of_bounds_address = out_of_bounds->address();
+  const char* index_type = indices.type_id() == Type::INT32 ? "_int32_t" : "_int64_t";
+  RETURN_NOT_OK(device.kernels->Launch(
+      "take_" + kernel_name + index_type, length,
+      {&values_address, &validity, &values_offset, &values_length, &indices_address,
+       &indices_validity, &indices_offset, &length, &out_address, &out_valid_address,
+       &out_of_bounds_address}));
+  uint64_t any_out_of_bounds = 0;
+  RETURN_NOT_OK(
+      out_of_bounds->CopyToHost(0, sizeof(any_out_of_bounds), &any_out_of_bounds));
+  if (any_out_of_bounds) {
+    return Status::IndexError("Take index out of bounds for values of length ",
+                              values_length);
+  }
+
+  if (is_boolean) {
+    ARROW_ASSIGN_OR_RAISE(auto packed, device.PackBits(*out, length));
+    out = std::move(packed.first);
+  }
+  int64_t null_count = 0;
+  if (out_valid != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto packed, device.PackBits(*out_valid, length));
+    out_valid = std::move(packed.first);
+    null_count = packed.second;
+  }
+  return MakeArray(ArrayData::Make(data.type, length,
+                                   {std::move(out_valid), std::move(out)}, null_count));
+}
+
+Result<std::shared_ptr<Array>> Hash(const Array& values) {
+  RETURN_NOT_OK(GetNumericKernelType(*values.type()));
+  const ArrayData& data = *values.data();
+  ARROW_ASSIGN_OR_RAISE(auto device, DeviceContext::Make({&data}));
+
+  int64_t length = data.length;
+  ARROW_ASSIGN_OR_RAISE(auto out, device.Allocate(length * sizeof(uint64_t)));
+  CUdeviceptr values_address = BufferAddress(data, 1);
+  CUdeviceptr validity = ValidityAddress(data);
+  int64_t offset = data.offset;
+  CUdeviceptr out_address = out->address();
+  RETURN_NOT_OK(device.kernels->Launch(
+      "hash_" + std::to_string(ByteWidth(*data.type)), length,
+      {&values_address, &validity, &offset, &length, &out_address}));
+  return MakeArray(ArrayData::Make(uint64(), length, {nullptr, std::move(out)},
+                                   /*null_count=*/0));
+}
+
+}  // namespace cuda
+}  // namespace arrow
@@ -0,0 +1,108 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace cuda {
+
+/// \defgroup cuda-compute-functions Compute functions on CUDA device memory
+///
+/// These functions take arrays whose buffers are in the memory of a CUDA device,
+/// e.g. read with ReadRecordBatch() or copied with Array::CopyTo(), and allocate
+/// their results on the same device, so that a sequence of operations doesn't
+/// copy the data back to the host. The kernels are compiled with NVRTC the first
+/// time they are used on a device and run on the default stream of its primary
+/// context.
+///
+/// The values must be integers or floating-point numbers, except that Filter()
+/// and Take() also accept booleans, e.g. the result of Compare().
+///
+/// @{
+
+enum class CompareOperator : int8_t {
+  kEqual,
+  kNotEqual,
+  kLess,
+  kLessEqual,
+  kGreater,
+  kGreaterEqual,
+};
+
+enum class ArithmeticOperator : int8_t {
+  kAdd,
+  kSubtract,
+  kMultiply,
+};
+
+/// \brief Compare two arrays of the same type and length element-wise
+///
+/// \return a boolean array, null where either input is null
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Compare(CompareOperator op, const Array& left,
+                                       const Array& right);
+
+/// \brief Compare each element of an array to a valid scalar of the same type
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Compare(CompareOperator op, const Array& left,
+                                       const Scalar& right);
+
+/// \brief Apply an arithmetic operator to two arrays of the same type and length
+///
+/// Integer overflow wraps around, as with the "_unchecked" compute functions.
+/// \return an array of the same type, null where either input is null
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Arithmetic(ArithmeticOperator op, const Array& left,
+                                          const Array& right);
+
+/// \brief Apply an arithmetic operator to each element of an array and a valid
+/// scalar of the same type
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Arithmetic(ArithmeticOperator op, const Array& left,
+                                          const Scalar& right);
+
+/// \brief Select the elements of `values` where `selection` is true
+///
+/// Null selections drop the element, as with FilterOptions::DROP.
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Filter(const Array& values, const Array& selection);
+
+/// \brief Select the elements of `values` at the int32 or int64 `indices`
+///
+/// Null indices yield nulls. Out of bounds indices return IndexError.
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Take(const Array& values, const Array& indices);
+
+/// \brief Hash each element of `values` into a uint64 array without nulls
+///
+/// The hashes are the same as those of arrow::compute::HashArray(), so that they
+/// can be mixed with hashes computed on the host, e.g. to partition rows. Null
+/// elements hash to 0.
+ARROW_EXPORT
+Result<std::shared_ptr<Array>> Hash(const Array& values);
+
+/// @}
+
+}  // namespace cuda
+}  // namespace arrow
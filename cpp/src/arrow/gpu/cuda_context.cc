@@ -64,6 +64,15 @@ struct DeviceProperties {
 
 const char kCudaDeviceTypeName[] = "arrow::cuda::CudaDevice";
 
+// Smaller copies between pageable host memory and a device are done directly, the
+// driver staging them with less overhead than the staging pool
+constexpr int64_t kMinStagedCopySize = 1 << 20;
+
+bool UseStagingPool(const Buffer& host_buffer) {
+  return host_buffer.device_type() != DeviceAllocationType::kCUDA_HOST &&
+         host_buffer.size() >= kMinStagedCopySize;
+}
+
 }  // namespace
 
 struct CudaDevice::Impl {
@@ -132,6 +141,22 @@ class CudaContext::Impl {
     return Status::OK();
   }
 
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                     cuMemcpyHtoDAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                               CUstream stream) {
+    ContextSaver set_temporary(context_);
+    CU_RETURN_NOT_OK("cuMemcpyDtoHAsync",
+                     cuMemcpyDtoHAsync(dst, src, static_cast<size_t>(nbytes), stream));
+    return Status::OK();
+  }
+
   Status CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes) {
     ContextSaver set_temporary(context_);
     CU_RETURN_NOT_OK("cuMemcpyDtoD", cuMemcpyDtoD(dst, src, static_cast<size_t>(nbytes)));
@@ -394,6 +419,15 @@ Result<std::shared_ptr<Device::SyncEvent>> CudaMemoryManager::WrapDeviceSyncEven
       new CudaDevice::SyncEvent(context, ev, release_sync_event));
 }
 
+Result<std::shared_ptr<CudaHostStagingPool>> CudaMemoryManager::staging_pool() {
+  std::lock_guard<std::mutex> lock(staging_pool_mutex_);
+  if (staging_pool_ == nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto context, cuda_device()->GetContext());
+    ARROW_ASSIGN_OR_RAISE(staging_pool_, CudaHostStagingPool::Make(std::move(context)));
+  }
+  return staging_pool_;
+}
+
 Result<std::shared_ptr<io::RandomAccessFile>> CudaMemoryManager::GetBufferReader(
     std::shared_ptr<Buffer> buf) {
   if (*buf->device() != *device_) {
@@ -442,8 +476,13 @@ Result<std::unique_ptr<Buffer>> CudaMemoryManager::CopyNonOwnedTo(
     std::unique_ptr<Buffer> dest;
     ARROW_ASSIGN_OR_RAISE(auto from_context, cuda_device()->GetContext());
     ARROW_ASSIGN_OR_RAISE(dest, to->AllocateBuffer(buf.size()));
-    RETURN_NOT_OK(
-        from_context->CopyDeviceToHost(dest->mutable_data(), buf.address(), buf.size()));
+    if (UseStagingPool(*dest)) {
+      ARROW_ASSIGN_OR_RAISE(auto pool, staging_pool());
+      RETURN_NOT_OK(pool->CopyToHost(buf.address(), buf.size(), dest->mutable_data()));
+    } else {
+      RETURN_NOT_OK(from_context->CopyDeviceToHost(dest->mutable_data(), buf.address(),
+                                                   buf.size()));
+    }
     return dest;
   }
   return nullptr;
@@ -461,7 +500,13 @@ Result<std::unique_ptr<Buffer>> CudaMemoryManager::CopyNonOwnedFrom(
     // CPU-to-device copy
     ARROW_ASSIGN_OR_RAISE(auto to_context, cuda_device()->GetContext());
     ARROW_ASSIGN_OR_RAISE(std::unique_ptr<Buffer> dest, to_context->Allocate(buf.size()));
-    RETURN_NOT_OK(to_context->CopyHostToDevice(dest->address(), buf.data(), buf.size()));
+    if (UseStagingPool(buf)) {
+      ARROW_ASSIGN_OR_RAISE(auto pool, staging_pool());
+      RETURN_NOT_OK(pool->CopyToDevice(buf.data(), buf.size(), dest->address()));
+    } else {
+      RETURN_NOT_OK(
+          to_context->CopyHostToDevice(dest->address(), buf.data(), buf.size()));
+    }
     return dest;
   }
   if (IsCudaMemoryManager(*from)) {
@@ -668,6 +713,16 @@ Status CudaContext::CopyHostToDevice(void* dst, const void* src, int64_t nbytes)
   return impl_->CopyHostToDevice(reinterpret_cast<uintptr_t>(dst), src, nbytes);
 }
 
+Status CudaContext::CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                                          CUstream stream) {
+  return impl_->CopyHostToDeviceAsync(dst, src, nbytes, stream);
+}
+
+Status CudaContext::CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                                          CUstream stream) {
+  return impl_->CopyDeviceToHostAsync(dst, src, nbytes, stream);
+}
+
 Status CudaContext::CopyDeviceToHost(void* dst, uintptr_t src, int64_t nbytes) {
   return impl_->CopyDeviceToHost(dst, src, nbytes);
 }
@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include <cuda.h>
@@ -36,6 +37,7 @@ class CudaDevice;
 class CudaDeviceManager;
 class CudaBuffer;
 class CudaHostBuffer;
+class CudaHostStagingPool;
 class CudaIpcMemHandle;
 class CudaMemoryManager;
 
@@ -279,6 +281,12 @@ class ARROW_EXPORT CudaMemoryManager : public MemoryManager {
   Result<std::shared_ptr<Device::SyncEvent>> WrapDeviceSyncEvent(
       void* sync_event, Device::SyncEvent::release_fn_t release_sync_event) override;
 
+  /// \brief The pool staging copies between pageable host memory and this device
+  ///
+  /// Copies of buffers between the CPU and this device go through this pool when
+  /// they are large enough to benefit from it. It is created on first use.
+  Result<std::shared_ptr<CudaHostStagingPool>> staging_pool();
+
  protected:
   using MemoryManager::MemoryManager;
   static std::shared_ptr<CudaMemoryManager> Make(const std::shared_ptr<Device>& device);
@@ -300,6 +308,9 @@ class ARROW_EXPORT CudaMemoryManager : public MemoryManager {
       const std::shared_ptr<Buffer>& buf,
       const std::shared_ptr<MemoryManager>& to) override;
 
+  std::mutex staging_pool_mutex_;
+  std::shared_ptr<CudaHostStagingPool> staging_pool_;
+
   friend class CudaDevice;
 };
 
@@ -393,6 +404,10 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   Status CopyHostToDevice(uintptr_t dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToHost(void* dst, uintptr_t src, int64_t nbytes);
+  Status CopyHostToDeviceAsync(uintptr_t dst, const void* src, int64_t nbytes,
+                               CUstream stream);
+  Status CopyDeviceToHostAsync(void* dst, uintptr_t src, int64_t nbytes,
+                               CUstream stream);
   Status CopyDeviceToDevice(void* dst, const void* src, int64_t nbytes);
   Status CopyDeviceToDevice(uintptr_t dst, uintptr_t src, int64_t nbytes);
   Status CopyDeviceToAnotherDevice(const std::shared_ptr<CudaContext>& dst_ctx, void* dst,
@@ -407,6 +422,7 @@ class ARROW_EXPORT CudaContext : public std::enable_shared_from_this<CudaContext
   friend class CudaBufferReader;
   friend class CudaBufferWriter;
   friend class CudaDevice;
+  friend class CudaHostStagingPool;
   friend class CudaMemoryManager;
   /// \cond FALSE
   // (note: emits warning on Doxygen < 1.8.15)
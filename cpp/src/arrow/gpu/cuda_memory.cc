@@ -18,20 +18,30 @@
 #include "arrow/gpu/cuda_memory.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include <cuda.h>
 
+#include "arrow/array/data.h"
 #include "arrow/buffer.h"
 #include "arrow/device.h"
+#include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/memory_pool.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/gpu/cuda_context.h"
 #include "arrow/gpu/cuda_internal.h"
@@ -40,6 +50,7 @@ namespace arrow {
 namespace cuda {
 
 using internal::ContextSaver;
+using ::arrow::internal::checked_cast;
 
 // ----------------------------------------------------------------------
 // CUDA IPC memory handle
@@ -171,6 +182,34 @@ Status CudaBuffer::CopyFromHost(const int64_t position, const void* data,
   return context_->CopyHostToDevice(const_cast<uint8_t*>(data_) + position, data, nbytes);
 }
 
+Result<std::shared_ptr<Device::SyncEvent>> CudaBuffer::CopyToHostAsync(
+    const int64_t position, const int64_t nbytes, void* out,
+    const Device::Stream& stream) const {
+  if (position < 0 || nbytes < 0 || nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  const auto& cuda_stream = checked_cast<const CudaDevice::Stream&>(stream);
+  RETURN_NOT_OK(context_->CopyDeviceToHostAsync(out, address() + position, nbytes,
+                                                cuda_stream.value()));
+  ARROW_ASSIGN_OR_RAISE(auto event, context_->memory_manager()->MakeDeviceSyncEvent());
+  RETURN_NOT_OK(event->Record(stream));
+  return event;
+}
+
+Result<std::shared_ptr<Device::SyncEvent>> CudaBuffer::CopyFromHostAsync(
+    const int64_t position, const void* data, int64_t nbytes,
+    const Device::Stream& stream) {
+  if (position < 0 || nbytes < 0 || nbytes > size_ - position) {
+    return Status::Invalid("Copy would overflow buffer");
+  }
+  const auto& cuda_stream = checked_cast<const CudaDevice::Stream&>(stream);
+  RETURN_NOT_OK(context_->CopyHostToDeviceAsync(address() + position, data, nbytes,
+                                                cuda_stream.value()));
+  ARROW_ASSIGN_OR_RAISE(auto event, context_->memory_manager()->MakeDeviceSyncEvent());
+  RETURN_NOT_OK(event->Record(stream));
+  return event;
+}
+
 Status CudaBuffer::CopyFromDevice(const int64_t position, const void* data,
                                   int64_t nbytes) {
   if (nbytes > size_ - position) {
@@ -459,6 +498,237 @@ int64_t CudaBufferWriter::buffer_size() const { return impl_->buffer_size(); }
 
 int64_t CudaBufferWriter::num_bytes_buffered() const { return impl_->buffer_position(); }
 
+// ----------------------------------------------------------------------
+// CudaHostStagingPool implementation
+
+namespace {
+
+// The page-locked chunks, stream and events used by one copy at a time.
+// Two chunks alternate so that filling or draining one on the host overlaps with
+// the transfer of the other.
+class Stager {
+ public:
+  ~Stager() {
+    ContextSaver set_temporary(*context_);
+    if (stream_ != nullptr) {
+      // A failed copy may have left transfers from the chunks in flight
+      DCHECK_OK(
+          internal::StatusFromCuda(cuStreamSynchronize(stream_), "cuStreamSynchronize"));
+    }
+    for (CUevent event : events_) {
+      if (event != nullptr) {
+        DCHECK_OK(internal::StatusFromCuda(cuEventDestroy(event), "cuEventDestroy"));
+      }
+    }
+    if (stream_ != nullptr) {
+      DCHECK_OK(internal::StatusFromCuda(cuStreamDestroy(stream_), "cuStreamDestroy"));
+    }
+  }
+
+  static Result<std::unique_ptr<Stager>> Make(std::shared_ptr<CudaContext> context,
+                                              int64_t chunk_size) {
+    std::unique_ptr<Stager> stager(new Stager(std::move(context), chunk_size));
+    for (auto& chunk : stager->chunks_) {
+      ARROW_ASSIGN_OR_RAISE(chunk, stager->context_->device()->AllocateHostBuffer(
+                                       chunk_size));
+    }
+    ContextSaver set_temporary(*stager->context_);
+    // A blocking stream, so that transfers are ordered with the default stream
+    CU_RETURN_NOT_OK("cuStreamCreate", cuStreamCreate(&stager->stream_, 0));
+    for (auto& event : stager->events_) {
+      CU_RETURN_NOT_OK("cuEventCreate", cuEventCreate(&event, CU_EVENT_DISABLE_TIMING));
+    }
+    return stager;
+  }
+
+  Status ToDevice(const std::vector<CudaHostStagingPool::HostRange>& ranges,
+                  uintptr_t device_address, int64_t nbytes) {
+    ContextSaver set_temporary(*context_);
+    auto range = ranges.begin();
+    int64_t chunk_index = 0;
+    for (int64_t offset = 0; offset < nbytes; offset += chunk_size_, ++chunk_index) {
+      const int slot = chunk_index % 2;
+      if (chunk_index >= 2) {
+        // Wait for the previous transfer from this chunk
+        CU_RETURN_NOT_OK("cuEventSynchronize", cuEventSynchronize(events_[slot]));
+      }
+      const int64_t size = std::min(chunk_size_, nbytes - offset);
+      uint8_t* chunk = chunks_[slot]->mutable_data();
+      while (range != ranges.end() && range->device_offset + range->nbytes <= offset) {
+        ++range;
+      }
+      int64_t filled = 0;
+      for (auto it = range; it != ranges.end() && it->device_offset < offset + size;
+           ++it) {
+        const int64_t begin = std::max(it->device_offset, offset) - offset;
+        const int64_t end =
+            std::min(it->device_offset + it->nbytes, offset + size) - offset;
+        std::memset(chunk + filled, 0, static_cast<size_t>(begin - filled));
+        std::memcpy(chunk + begin,
+                    static_cast<const uint8_t*>(it->data) + offset + begin -
+                        it->device_offset,
+                    static_cast<size_t>(end - begin));
+        filled = end;
+      }
+      std::memset(chunk + filled, 0, static_cast<size_t>(size - filled));
+      CU_RETURN_NOT_OK("cuMemcpyHtoDAsync",
+                       cuMemcpyHtoDAsync(device_address + offset, chunk,
+                                         static_cast<size_t>(size), stream_));
+      CU_RETURN_NOT_OK("cuEventRecord", cuEventRecord(events_[slot], stream_));
+    }
+    CU_RETURN_NOT_OK("cuStreamSynchronize", cuStreamSynchronize(stream_));
+    return Status::OK();
+  }
+
+  Status ToHost(uintptr_t device_address, int64_t nbytes, uint8_t* out) {
+    ContextSaver set_temporary(*context_);
+    const int64_t num_chunks = bit_util::CeilDiv(nbytes, chunk_size_);
+    auto chunk_bytes = [&](int64_t chunk_index) {
+      return std::min(chunk_size_, nbytes - chunk_index * chunk_size_);
+    };
+    auto enqueue = [&](int64_t chunk_index) -> Status {
+      const int slot = chunk_index % 2;
+      CU_RETURN_NOT_OK(
+          "cuMemcpyDtoHAsync",
+          cuMemcpyDtoHAsync(chunks_[slot]->mutable_data(),
+                            device_address + chunk_index * chunk_size_,
+                            static_cast<size_t>(chunk_bytes(chunk_index)), stream_));
+      CU_RETURN_NOT_OK("cuEventRecord", cuEventRecord(events_[slot], stream_));
+      return Status::OK();
+    };
+    if (num_chunks > 0) {
+      RETURN_NOT_OK(enqueue(0));
+    }
+    for (int64_t chunk_index = 0; chunk_index < num_chunks; ++chunk_index) {
+      if (chunk_index + 1 < num_chunks) {
+        RETURN_NOT_OK(enqueue(chunk_index + 1));
+      }
+      const int slot = chunk_index % 2;
+      CU_RETURN_NOT_OK("cuEventSynchronize", cuEventSynchronize(events_[slot]));
+      std::memcpy(out + chunk_index * chunk_size_, chunks_[slot]->data(),
+                  static_cast<size_t>(chunk_bytes(chunk_index)));
+    }
+    return Status::OK();
+  }
+
+ private:
+  Stager(std::shared_ptr<CudaContext> context, int64_t chunk_size)
+      : context_(std::move(context)), chunk_size_(chunk_size) {}
+
+  std::shared_ptr<CudaContext> context_;
+  const int64_t chunk_size_;
+  std::shared_ptr<CudaHostBuffer> chunks_[2];
+  CUstream stream_ = nullptr;
+  CUevent events_[2] = {nullptr, nullptr};
+};
+
+}  // namespace
+
+class CudaHostStagingPool::Impl {
+ public:
+  Impl(std::shared_ptr<CudaContext> context, int64_t chunk_size, int max_idle_copies)
+      : context_(std::move(context)),
+        chunk_size_(chunk_size),
+        max_idle_copies_(max_idle_copies) {}
+
+  template <typename CopyFunc>
+  Status Copy(CopyFunc&& copy) {
+    ARROW_ASSIGN_OR_RAISE(auto stager, Acquire());
+    Status st = copy(stager.get());
+    Release(std::move(stager), st);
+    return st;
+  }
+
+  int64_t chunk_size() const { return chunk_size_; }
+
+  int64_t bytes_allocated() const { return bytes_allocated_.load(); }
+
+ private:
+  Result<std::unique_ptr<Stager>> Acquire() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!idle_.empty()) {
+        auto stager = std::move(idle_.back());
+        idle_.pop_back();
+        return stager;
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(auto stager, Stager::Make(context_, chunk_size_));
+    bytes_allocated_ += 2 * chunk_size_;
+    return stager;
+  }
+
+  void Release(std::unique_ptr<Stager> stager, const Status& copy_status) {
+    // Stagers of failed copies are dropped, as their state is unknown
+    if (copy_status.ok()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (static_cast<int>(idle_.size()) < max_idle_copies_) {
+        idle_.push_back(std::move(stager));
+        return;
+      }
+    }
+    bytes_allocated_ -= 2 * chunk_size_;
+  }
+
+  std::shared_ptr<CudaContext> context_;
+  const int64_t chunk_size_;
+  const int max_idle_copies_;
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<Stager>> idle_;
+  std::atomic<int64_t> bytes_allocated_{0};
+};
+
+CudaHostStagingPool::CudaHostStagingPool(std::shared_ptr<CudaContext> context,
+                                         int64_t chunk_size, int max_idle_copies)
+    : impl_(new Impl(std::move(context), chunk_size, max_idle_copies)) {}
+
+CudaHostStagingPool::~CudaHostStagingPool() = default;
+
+Result<std::shared_ptr<CudaHostStagingPool>> CudaHostStagingPool::Make(
+    std::shared_ptr<CudaContext> context, int64_t chunk_size, int max_idle_copies) {
+  if (chunk_size <= 0) {
+    return Status::Invalid("Staging chunk size must be positive");
+  }
+  if (max_idle_copies < 0) {
+    return Status::Invalid("Number of idle staging copies must not be negative");
+  }
+  return std::shared_ptr<CudaHostStagingPool>(
+      new CudaHostStagingPool(std::move(context), chunk_size, max_idle_copies));
+}
+
+Status CudaHostStagingPool::CopyToDevice(const void* data, int64_t nbytes,
+                                         uintptr_t device_address) {
+  return CopyToDevice({HostRange{data, 0, nbytes}}, device_address);
+}
+
+Status CudaHostStagingPool::CopyToDevice(const std::vector<HostRange>& ranges,
+                                         uintptr_t device_address) {
+  if (ranges.empty()) {
+    return Status::OK();
+  }
+  const int64_t nbytes = ranges.back().device_offset + ranges.back().nbytes;
+  if (nbytes == 0) {
+    return Status::OK();
+  }
+  return impl_->Copy([&](Stager* stager) {
+    return stager->ToDevice(ranges, device_address, nbytes);
+  });
+}
+
+Status CudaHostStagingPool::CopyToHost(uintptr_t device_address, int64_t nbytes,
+                                       void* out) {
+  if (nbytes == 0) {
+    return Status::OK();
+  }
+  return impl_->Copy([&](Stager* stager) {
+    return stager->ToHost(device_address, nbytes, static_cast<uint8_t*>(out));
+  });
+}
+
+int64_t CudaHostStagingPool::chunk_size() const { return impl_->chunk_size(); }
+
+int64_t CudaHostStagingPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
 // ----------------------------------------------------------------------
 
 Result<std::shared_ptr<CudaHostBuffer>> AllocateCudaHostBuffer(int device_number,
@@ -486,6 +756,92 @@ Result<uint8_t*> GetHostAddress(uintptr_t device_ptr) {
   return static_cast<uint8_t*>(ptr);
 }
 
+namespace {
+
+// Lay out the buffers of an array and its children and dictionary for a single
+// device allocation, each at a 64-byte aligned offset
+Status CollectBufferRanges(const ArrayData& data, int64_t* total_size,
+                           std::vector<CudaHostStagingPool::HostRange>* ranges) {
+  for (const auto& buffer : data.buffers) {
+    if (buffer == nullptr) {
+      continue;
+    }
+    if (!buffer->is_cpu()) {
+      return Status::Invalid("Cannot copy a record batch with non-CPU buffers: ",
+                             buffer->device()->ToString());
+    }
+    ranges->push_back({buffer->data(), *total_size, buffer->size()});
+    *total_size += bit_util::RoundUpToMultipleOf64(buffer->size());
+  }
+  for (const auto& child : data.child_data) {
+    RETURN_NOT_OK(CollectBufferRanges(*child, total_size, ranges));
+  }
+  if (data.dictionary != nullptr) {
+    RETURN_NOT_OK(CollectBufferRanges(*data.dictionary, total_size, ranges));
+  }
+  return Status::OK();
+}
+
+// Rebuild the array data with slices of the device memory, visiting the buffers
+// in the same order as CollectBufferRanges
+std::shared_ptr<ArrayData> MakeDeviceArrayData(
+    const ArrayData& data, const std::shared_ptr<CudaBuffer>& device_memory,
+    std::vector<CudaHostStagingPool::HostRange>::const_iterator* range) {
+  auto out = data.Copy();
+  for (auto& buffer : out->buffers) {
+    if (buffer != nullptr) {
+      buffer = std::make_shared<CudaBuffer>(device_memory, (*range)->device_offset,
+                                            (*range)->nbytes);
+      ++*range;
+    }
+  }
+  for (auto& child : out->child_data) {
+    child = MakeDeviceArrayData(*child, device_memory, range);
+  }
+  if (out->dictionary != nullptr) {
+    out->dictionary = MakeDeviceArrayData(*out->dictionary, device_memory, range);
+  }
+  return out;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatch>> CopyBatchToDevice(
+    const RecordBatch& batch, const std::shared_ptr<CudaMemoryManager>& mm) {
+  int64_t total_size = 0;
+  std::vector<CudaHostStagingPool::HostRange> ranges;
+  for (const auto& column : batch.column_data()) {
+    RETURN_NOT_OK(CollectBufferRanges(*column, &total_size, &ranges));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto context, mm->cuda_device()->GetContext());
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<CudaBuffer> device_memory,
+                        context->Allocate(total_size));
+  ARROW_ASSIGN_OR_RAISE(auto pool, mm->staging_pool());
+  RETURN_NOT_OK(pool->CopyToDevice(ranges, device_memory->address()));
+
+  auto range = std::cbegin(ranges);
+  std::vector<std::shared_ptr<ArrayData>> columns;
+  columns.reserve(batch.num_columns());
+  for (const auto& column : batch.column_data()) {
+    columns.push_back(MakeDeviceArrayData(*column, device_memory, &range));
+  }
+  DCHECK(range == ranges.cend());
+  return RecordBatch::Make(batch.schema(), batch.num_rows(), std::move(columns));
+}
+
+Future<std::shared_ptr<RecordBatch>> CopyBatchToDeviceAsync(
+    std::shared_ptr<RecordBatch> batch, std::shared_ptr<CudaMemoryManager> mm,
+    ::arrow::internal::Executor* executor) {
+  if (executor == NULLPTR) {
+    executor = io::default_io_context().executor();
+  }
+  return DeferNotOk(executor->Submit(
+      [batch = std::move(batch), mm = std::move(mm)] {
+        return CopyBatchToDevice(*batch, mm);
+      }));
+}
+
 Result<std::shared_ptr<MemoryManager>> DefaultMemoryMapper(ArrowDeviceType device_type,
                                                            int64_t device_id) {
   switch (device_type) {
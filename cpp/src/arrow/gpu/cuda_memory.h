@@ -19,17 +19,21 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/c/abi.h"
+#include "arrow/device.h"
 #include "arrow/io/concurrency.h"
 #include "arrow/type_fwd.h"
+#include "arrow/util/type_fwd.h"
 
 namespace arrow {
 namespace cuda {
 
 class CudaContext;
 class CudaIpcMemHandle;
+class CudaMemoryManager;
 
 /// \class CudaBuffer
 /// \brief An Arrow buffer located on a GPU device
@@ -71,6 +75,33 @@ class ARROW_EXPORT CudaBuffer : public Buffer {
   /// \return Status
   Status CopyFromHost(const int64_t position, const void* data, int64_t nbytes);
 
+  /// \brief Enqueue a copy from GPU device to CPU host on a stream
+  /// \param[in] position start position inside buffer to copy bytes from
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[out] out start address of the host memory area to copy to
+  /// \param[in] stream the CUDA stream to order the copy on
+  /// \return an event completed once the copy is
+  ///
+  /// The copy is only asynchronous if the host memory is page-locked, e.g. a
+  /// CudaHostBuffer. The host memory must not be used until the event completes.
+  Result<std::shared_ptr<Device::SyncEvent>> CopyToHostAsync(
+      const int64_t position, const int64_t nbytes, void* out,
+      const Device::Stream& stream) const;
+
+  /// \brief Enqueue a copy from CPU host to device at position on a stream
+  /// \param[in] position start position to copy bytes to
+  /// \param[in] data the host data to copy
+  /// \param[in] nbytes number of bytes to copy
+  /// \param[in] stream the CUDA stream to order the copy on
+  /// \return an event completed once the copy is
+  ///
+  /// The copy is only asynchronous if the host memory is page-locked, e.g. a
+  /// CudaHostBuffer. The host memory must not be modified until the event
+  /// completes.
+  Result<std::shared_ptr<Device::SyncEvent>> CopyFromHostAsync(
+      const int64_t position, const void* data, int64_t nbytes,
+      const Device::Stream& stream);
+
   /// \brief Copy memory from device to device at position
   /// \param[in] position start position inside buffer to copy bytes to
   /// \param[in] data start address of the device memory area to copy from
@@ -119,6 +150,66 @@ class ARROW_EXPORT CudaHostBuffer : public MutableBuffer {
   Result<uintptr_t> GetDeviceAddress(const std::shared_ptr<CudaContext>& ctx);
 };
 
+/// \class CudaHostStagingPool
+/// \brief Page-locked host memory staging copies between pageable host memory
+/// and a GPU device
+///
+/// Copies are split into chunks: each chunk is copied between pageable memory and
+/// a page-locked chunk while the previous one is transferred asynchronously, so
+/// that host copies overlap with transfers. Page-locking memory is expensive, so
+/// the chunks are kept for later copies. Concurrent copies use separate chunks.
+///
+/// Transfers are ordered with the default stream of the device.
+class ARROW_EXPORT CudaHostStagingPool {
+ public:
+  static constexpr int64_t kDefaultChunkSize = 4 << 20;
+  static constexpr int kDefaultMaxIdleCopies = 4;
+
+  /// \brief An area of host memory and its offset in device memory
+  struct HostRange {
+    const void* data;
+    int64_t device_offset;
+    int64_t nbytes;
+  };
+
+  ~CudaHostStagingPool();
+
+  /// \brief Create a pool for copies with a device
+  /// \param[in] context the context of the device
+  /// \param[in] chunk_size the size of the page-locked chunks, each copy
+  /// using two of them
+  /// \param[in] max_idle_copies the number of copies to keep chunks for when
+  /// they are done
+  static Result<std::shared_ptr<CudaHostStagingPool>> Make(
+      std::shared_ptr<CudaContext> context, int64_t chunk_size = kDefaultChunkSize,
+      int max_idle_copies = kDefaultMaxIdleCopies);
+
+  /// \brief Copy host memory to device memory, returning once it is complete
+  Status CopyToDevice(const void* data, int64_t nbytes, uintptr_t device_address);
+
+  /// \brief Gather areas of host memory into device memory, returning once it is
+  /// complete
+  ///
+  /// The ranges must be sorted by device offset and not overlap. The gaps between
+  /// them are zeroed.
+  Status CopyToDevice(const std::vector<HostRange>& ranges, uintptr_t device_address);
+
+  /// \brief Copy device memory to host memory, returning once it is complete
+  Status CopyToHost(uintptr_t device_address, int64_t nbytes, void* out);
+
+  int64_t chunk_size() const;
+
+  /// \brief The number of bytes of page-locked memory held by the pool
+  int64_t bytes_allocated() const;
+
+ private:
+  CudaHostStagingPool(std::shared_ptr<CudaContext> context, int64_t chunk_size,
+                      int max_idle_copies);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \class CudaIpcHandle
 /// \brief A container for a CUDA IPC handle
 class ARROW_EXPORT CudaIpcMemHandle {
@@ -251,6 +342,32 @@ ARROW_EXPORT
 Result<std::shared_ptr<CudaHostBuffer>> AllocateCudaHostBuffer(int device_number,
                                                                const int64_t size);
 
+/// \brief Copy a record batch from the CPU to a GPU device
+///
+/// The buffers of all the columns, including children and dictionaries, are
+/// gathered into a single device allocation with one staged transfer, which is
+/// much faster than copying them one by one for batches with many small buffers.
+/// The device memory is released once no buffer of the result is referenced.
+///
+/// \param[in] batch a record batch with CPU buffers
+/// \param[in] mm the memory manager of the device
+/// \return the record batch with device buffers
+ARROW_EXPORT
+Result<std::shared_ptr<RecordBatch>> CopyBatchToDevice(
+    const RecordBatch& batch, const std::shared_ptr<CudaMemoryManager>& mm);
+
+/// \brief Copy a record batch from the CPU to a GPU device on an executor
+///
+/// Copies of several batches proceed concurrently, their transfers overlapping.
+///
+/// \param[in] batch a record batch with CPU buffers
+/// \param[in] mm the memory manager of the device
+/// \param[in] executor the executor to copy on, the IO thread pool if null
+ARROW_EXPORT
+Future<std::shared_ptr<RecordBatch>> CopyBatchToDeviceAsync(
+    std::shared_ptr<RecordBatch> batch, std::shared_ptr<CudaMemoryManager> mm,
+    ::arrow::internal::Executor* executor = NULLPTR);
+
 /// Low-level: get a device address through which the CPU data be accessed.
 ARROW_EXPORT
 Result<uintptr_t> GetDeviceAddress(const uint8_t* cpu_data,
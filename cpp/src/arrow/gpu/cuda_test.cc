@@ -18,18 +18,23 @@
 #include <cstdint>
 #include <limits>
 #include <string>
+#include <vector>
 
 #include <cuda.h>
 
 #include "gtest/gtest.h"
 
+#include "arrow/builder.h"
 #include "arrow/c/bridge.h"
 #include "arrow/c/util_internal.h"
+#include "arrow/compute/array_hash.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/test_common.h"
+#include "arrow/scalar.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 
@@ -220,6 +225,24 @@ TEST_F(TestCudaDevice, Copy) {
   }
 }
 
+TEST_F(TestCudaDevice, CopyStaged) {
+  // Large enough to go through the staging pool of the memory manager
+  const int64_t kSize = (3 << 20) + 123;
+  std::shared_ptr<ResizableBuffer> cpu_buffer;
+  ASSERT_OK(MakeRandomByteBuffer(kSize, default_memory_pool(), &cpu_buffer));
+
+  ASSERT_OK_AND_ASSIGN(auto device_buffer, Buffer::Copy(cpu_buffer, mm_));
+  ASSERT_EQ(device_buffer->device(), device_);
+  AssertCudaBufferEquals(*device_buffer, *cpu_buffer);
+
+  ASSERT_OK_AND_ASSIGN(auto roundtripped, Buffer::Copy(device_buffer, cpu_mm_));
+  ASSERT_TRUE(roundtripped->is_cpu());
+  AssertBufferEqual(*roundtripped, *cpu_buffer);
+
+  ASSERT_OK_AND_ASSIGN(auto pool, mm_->staging_pool());
+  ASSERT_GT(pool->bytes_allocated(), 0);
+}
+
 TEST_F(TestCudaDevice, CreateSyncEvent) {
   ASSERT_OK_AND_ASSIGN(auto ev, mm_->MakeDeviceSyncEvent());
   ASSERT_TRUE(ev);
@@ -333,6 +356,35 @@ TEST_F(TestCudaBuffer, CopyFromHost) {
   AssertCudaBufferEquals(*device_buffer, *host_buffer);
 }
 
+TEST_F(TestCudaBuffer, CopyAsync) {
+  const int64_t kSize = 1000;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<CudaBuffer> device_buffer,
+                       context_->Allocate(kSize));
+  ASSERT_OK_AND_ASSIGN(auto stream, device_->MakeStream());
+
+  ASSERT_OK_AND_ASSIGN(auto host_buffer, AllocateCudaHostBuffer(kGpuNumber, kSize));
+  random_bytes(kSize, 42, host_buffer->mutable_data());
+  ASSERT_OK_AND_ASSIGN(auto event,
+                       device_buffer->CopyFromHostAsync(0, host_buffer->data(), 500,
+                                                        *stream));
+  ASSERT_OK(event->Wait());
+  ASSERT_OK_AND_ASSIGN(event, device_buffer->CopyFromHostAsync(
+                                  500, host_buffer->data() + 500, kSize - 500, *stream));
+  ASSERT_OK(event->Wait());
+  AssertCudaBufferEquals(*device_buffer, *host_buffer);
+
+  ASSERT_OK_AND_ASSIGN(auto out_buffer, AllocateCudaHostBuffer(kGpuNumber, kSize));
+  ASSERT_OK_AND_ASSIGN(event, device_buffer->CopyToHostAsync(
+                                  0, kSize, out_buffer->mutable_data(), *stream));
+  ASSERT_OK(event->Wait());
+  AssertBufferEqual(*out_buffer, *host_buffer);
+
+  ASSERT_RAISES(Invalid, device_buffer->CopyFromHostAsync(500, host_buffer->data(),
+                                                          kSize, *stream));
+  ASSERT_RAISES(Invalid, device_buffer->CopyToHostAsync(
+                             500, kSize, out_buffer->mutable_data(), *stream));
+}
+
 TEST_F(TestCudaBuffer, FromBuffer) {
   const int64_t kSize = 1000;
   // Initialize device buffer with random data
@@ -463,6 +515,65 @@ TEST_F(TestCudaHostBuffer, ViewOnDevice) {
   ASSERT_EQ(buffer->device_type(), DeviceAllocationType::kCUDA_HOST);
 }
 
+// ------------------------------------------------------------------------
+// Test CudaHostStagingPool
+
+class TestCudaHostStagingPool : public TestCudaBase {
+ public:
+  // Small chunks so that copies span many of them
+  static constexpr int64_t kChunkSize = 1000;
+};
+
+TEST_F(TestCudaHostStagingPool, Roundtrip) {
+  ASSERT_OK_AND_ASSIGN(auto pool, CudaHostStagingPool::Make(context_, kChunkSize));
+  ASSERT_EQ(pool->chunk_size(), kChunkSize);
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+
+  for (const int64_t size : {int64_t(1), kChunkSize, 10 * kChunkSize + 1}) {
+    ARROW_SCOPED_TRACE("size = ", size);
+    std::shared_ptr<ResizableBuffer> host_buffer;
+    ASSERT_OK(MakeRandomByteBuffer(size, default_memory_pool(), &host_buffer));
+    ASSERT_OK_AND_ASSIGN(std::shared_ptr<CudaBuffer> device_buffer,
+                         context_->Allocate(size));
+    ASSERT_OK(pool->CopyToDevice(host_buffer->data(), size, device_buffer->address()));
+    AssertCudaBufferEquals(*device_buffer, *host_buffer);
+
+    std::vector<uint8_t> out(static_cast<size_t>(size));
+    ASSERT_OK(pool->CopyToHost(device_buffer->address(), size, out.data()));
+    AssertBufferEqual(*host_buffer, out);
+  }
+  // Chunks are kept for the next copies
+  ASSERT_EQ(pool->bytes_allocated(), 2 * kChunkSize);
+}
+
+TEST_F(TestCudaHostStagingPool, Gather) {
+  ASSERT_OK_AND_ASSIGN(auto pool, CudaHostStagingPool::Make(context_, kChunkSize));
+  const std::string a(1500, 'a'), b(10, 'b'), c(2500, 'c');
+  std::vector<CudaHostStagingPool::HostRange> ranges = {
+      {a.data(), 0, 1500},
+      {b.data(), 1995, 10},
+      // Empty ranges are ignored
+      {nullptr, 2100, 0},
+      {c.data(), 2500, 2500}};
+
+  std::string expected(5000, '\0');
+  expected.replace(0, 1500, a);
+  expected.replace(1995, 10, b);
+  expected.replace(2500, 2500, c);
+
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<CudaBuffer> device_buffer,
+                       context_->Allocate(5000));
+  // Garbage that the gaps must overwrite
+  ASSERT_OK(device_buffer->CopyFromHost(0, std::string(5000, 'x').data(), 5000));
+  ASSERT_OK(pool->CopyToDevice(ranges, device_buffer->address()));
+  AssertCudaBufferEquals(*device_buffer, expected);
+}
+
+TEST_F(TestCudaHostStagingPool, InvalidParameters) {
+  ASSERT_RAISES(Invalid, CudaHostStagingPool::Make(context_, 0));
+  ASSERT_RAISES(Invalid, CudaHostStagingPool::Make(context_, kChunkSize, -1));
+}
+
 // ------------------------------------------------------------------------
 // Test CudaBufferWriter
 
@@ -810,5 +921,221 @@ TEST_F(TestCudaDeviceArrayRoundtrip, Dictionary) {
   TestWithArrayFactory(factory);
 }
 
+
+// ------------------------------------------------------------------------
+// Test CopyBatchToDevice
+
+class TestCopyBatchToDevice : public TestCudaBase {
+ public:
+  std::shared_ptr<RecordBatch> MakeBatch() {
+    auto schema = ::arrow::schema({field("ints", int32()), field("strs", utf8()),
+                                   field("lists", list(int64())),
+                                   field("dicts", dictionary(int8(), utf8()))});
+    return RecordBatch::Make(
+        schema, 4,
+        {ArrayFromJSON(int32(), "[1, null, 3, 4]"),
+         ArrayFromJSON(utf8(), R"(["foo", "", null, "quux"])"),
+         ArrayFromJSON(list(int64()), "[[1, 2], null, [], [3, null]]"),
+         DictArrayFromJSON(dictionary(int8(), utf8()), "[1, 0, null, 1]",
+                           R"(["a", "bc"])")});
+  }
+
+  void AssertDeviceBatchEquals(const RecordBatch& expected,
+                               const RecordBatch& device_batch) {
+    for (const auto& column : device_batch.column_data()) {
+      for (const auto& buffer : column->buffers) {
+        if (buffer != nullptr) {
+          ASSERT_EQ(buffer->device(), device_);
+        }
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto actual, device_batch.CopyTo(cpu_mm_));
+    ASSERT_OK(actual->ValidateFull());
+    AssertBatchesEqual(expected, *actual);
+  }
+};
+
+TEST_F(TestCopyBatchToDevice, Basics) {
+  auto batch = MakeBatch();
+  ASSERT_OK_AND_ASSIGN(auto device_batch, CopyBatchToDevice(*batch, mm_));
+  AssertDeviceBatchEquals(*batch, *device_batch);
+
+  // Sliced
+  ASSERT_OK_AND_ASSIGN(device_batch, CopyBatchToDevice(*batch->Slice(1, 2), mm_));
+  AssertDeviceBatchEquals(*batch->Slice(1, 2), *device_batch);
+
+  // Non-CPU buffers
+  ASSERT_RAISES(Invalid, CopyBatchToDevice(*device_batch, mm_));
+}
+
+TEST_F(TestCopyBatchToDevice, Async) {
+  auto batch = MakeBatch();
+  std::vector<Future<std::shared_ptr<RecordBatch>>> futures;
+  for (int i = 0; i < 8; ++i) {
+    futures.push_back(CopyBatchToDeviceAsync(batch, mm_));
+  }
+  for (auto& future : futures) {
+    ASSERT_FINISHES_OK_AND_ASSIGN(auto device_batch, future);
+    AssertDeviceBatchEquals(*batch, *device_batch);
+  }
+}
+
+// ------------------------------------------------------------------------
+// Test compute functions
+
+class TestCudaCompute : public TestCudaBase {
+ public:
+  std::shared_ptr<Array> ToDevice(const std::shared_ptr<Array>& array) {
+    return array->CopyTo(mm_).ValueOrDie();
+  }
+
+  void AssertDeviceArrayEquals(const Array& expected,
+                               const Result<std::shared_ptr<Array>>& maybe_actual) {
+    ASSERT_OK_AND_ASSIGN(auto actual, maybe_actual);
+    ASSERT_TRUE(IsCudaDevice(*actual->data()->buffers[1]->device()));
+    ASSERT_OK_AND_ASSIGN(auto host_actual, actual->CopyTo(cpu_mm_));
+    ASSERT_OK(host_actual->ValidateFull());
+    AssertArraysEqual(expected, *host_actual, /*verbose=*/true);
+  }
+};
+
+TEST_F(TestCudaCompute, Compare) {
+  auto left = ArrayFromJSON(int32(), "[0, 1, 2, null, 4, 5, 6, 7, 8, 9]");
+  auto right = ArrayFromJSON(int32(), "[0, 2, 1, 3, null, 5, 7, 6, 8, 10]");
+  auto device_left = ToDevice(left);
+  auto device_right = ToDevice(right);
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(boolean(),
+                     "[true, false, false, null, null, true, false, false, true, false]"),
+      Compare(CompareOperator::kEqual, *device_left, *device_right));
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(boolean(),
+                     "[false, true, false, null, null, false, true, false, false, true]"),
+      Compare(CompareOperator::kLess, *device_left, *device_right));
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(boolean(), "[false, null, true, false, true]"),
+      Compare(CompareOperator::kGreaterEqual, *device_left->Slice(2, 5),
+              *device_right->Slice(1, 5)));
+
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(boolean(),
+                     "[false, false, false, null, false, true, true, true, true, true]"),
+      Compare(CompareOperator::kGreater, *device_left, Int32Scalar(4)));
+  auto doubles = ToDevice(ArrayFromJSON(float64(), "[1, 2, 3]"));
+  AssertDeviceArrayEquals(*ArrayFromJSON(boolean(), "[true, false, true]"),
+                          Compare(CompareOperator::kNotEqual, *doubles, DoubleScalar(2)));
+
+  ASSERT_RAISES(TypeError, Compare(CompareOperator::kEqual, *device_left,
+                                   *ToDevice(ArrayFromJSON(int64(), "[1]"))));
+  ASSERT_RAISES(Invalid,
+                Compare(CompareOperator::kEqual, *device_left, *device_right->Slice(1)));
+  ASSERT_RAISES(Invalid, Compare(CompareOperator::kEqual, *device_left,
+                                 *MakeNullScalar(int32())));
+  ASSERT_RAISES(NotImplemented,
+                Compare(CompareOperator::kEqual, *ToDevice(ArrayFromJSON(utf8(), "[]")),
+                        *ToDevice(ArrayFromJSON(utf8(), "[]"))));
+  // Host arrays
+  ASSERT_RAISES(TypeError, Compare(CompareOperator::kEqual, *left, *right));
+}
+
+TEST_F(TestCudaCompute, Arithmetic) {
+  auto left = ToDevice(ArrayFromJSON(int8(), "[127, 1, -128, null, 5]"));
+  auto right = ToDevice(ArrayFromJSON(int8(), "[1, null, 1, 2, 3]"));
+  AssertDeviceArrayEquals(*ArrayFromJSON(int8(), "[-128, null, -127, null, 8]"),
+                          Arithmetic(ArithmeticOperator::kAdd, *left, *right));
+  AssertDeviceArrayEquals(*ArrayFromJSON(int8(), "[126, null, 127, null, 2]"),
+                          Arithmetic(ArithmeticOperator::kSubtract, *left, *right));
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(int8(), "[-2, 2, 0, null, 10]"),
+      Arithmetic(ArithmeticOperator::kMultiply, *left, Int8Scalar(2)));
+
+  auto uint16_values = ToDevice(ArrayFromJSON(uint16(), "[65535, 2]"));
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(uint16(), "[1, 4]"),
+      Arithmetic(ArithmeticOperator::kMultiply, *uint16_values, *uint16_values));
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(float32(), "[1.5, -0.5]"),
+      Arithmetic(ArithmeticOperator::kAdd,
+                 *ToDevice(ArrayFromJSON(float32(), "[1, -1]")), FloatScalar(0.5)));
+}
+
+TEST_F(TestCudaCompute, Filter) {
+  // Spans several blocks of threads
+  constexpr int64_t kLength = 2000;
+  Int64Builder values_builder, expected_builder;
+  BooleanBuilder selection_builder;
+  for (int64_t i = 0; i < kLength; ++i) {
+    const bool is_valid = i % 7 != 0;
+    ASSERT_OK(is_valid ? values_builder.Append(i) : values_builder.AppendNull());
+    if (i % 11 == 0) {
+      ASSERT_OK(selection_builder.AppendNull());
+    } else {
+      const bool selected = i % 3 == 0;
+      ASSERT_OK(selection_builder.Append(selected));
+      if (selected) {
+        ASSERT_OK(is_valid ? expected_builder.Append(i) : expected_builder.AppendNull());
+      }
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto values, values_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto selection, selection_builder.Finish());
+  ASSERT_OK_AND_ASSIGN(auto expected, expected_builder.Finish());
+  AssertDeviceArrayEquals(*expected, Filter(*ToDevice(values), *ToDevice(selection)));
+
+  auto booleans = ToDevice(ArrayFromJSON(boolean(), "[true, false, null, true, false]"));
+  auto small_selection =
+      ToDevice(ArrayFromJSON(boolean(), "[true, true, true, false, null]"));
+  AssertDeviceArrayEquals(*ArrayFromJSON(boolean(), "[true, false, null]"),
+                          Filter(*booleans, *small_selection));
+  AssertDeviceArrayEquals(*ArrayFromJSON(boolean(), "[false, null]"),
+                          Filter(*booleans->Slice(1), *small_selection->Slice(0, 4)));
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(int16(), "[]"),
+      Filter(*ToDevice(ArrayFromJSON(int16(), "[1, 2]")),
+             *ToDevice(ArrayFromJSON(boolean(), "[false, false]"))));
+
+  ASSERT_RAISES(TypeError, Filter(*booleans, *ToDevice(ArrayFromJSON(int8(), "[]"))));
+  ASSERT_RAISES(Invalid, Filter(*booleans, *small_selection->Slice(1)));
+}
+
+TEST_F(TestCudaCompute, Take) {
+  auto values = ToDevice(ArrayFromJSON(float64(), "[0.5, 1.5, null, 3.5]"));
+  for (const auto& index_type : {int32(), int64()}) {
+    ARROW_SCOPED_TRACE("index type = ", *index_type);
+    auto indices = ToDevice(ArrayFromJSON(index_type, "[3, 0, null, 2, 0, 1]"));
+    AssertDeviceArrayEquals(*ArrayFromJSON(float64(), "[3.5, 0.5, null, null, 0.5, 1.5]"),
+                            Take(*values, *indices));
+    AssertDeviceArrayEquals(*ArrayFromJSON(float64(), "[null, 3.5]"),
+                            Take(*values->Slice(1), *indices->Slice(3, 2)));
+    ASSERT_RAISES(IndexError,
+                  Take(*values, *ToDevice(ArrayFromJSON(index_type, "[0, 4]"))));
+    ASSERT_RAISES(IndexError,
+                  Take(*values, *ToDevice(ArrayFromJSON(index_type, "[-1]"))));
+  }
+  AssertDeviceArrayEquals(
+      *ArrayFromJSON(boolean(), "[false, true, true]"),
+      Take(*ToDevice(ArrayFromJSON(boolean(), "[true, false]")),
+           *ToDevice(ArrayFromJSON(int32(), "[1, 0, 0]"))));
+  ASSERT_RAISES(TypeError, Take(*values, *ToDevice(ArrayFromJSON(uint32(), "[0]"))));
+}
+
+TEST_F(TestCudaCompute, Hash) {
+  for (const auto& type : {int8(), uint16(), int32(), int64(), float32(), float64()}) {
+    ARROW_SCOPED_TRACE("type = ", *type);
+    AssertDeviceArrayEquals(*ArrayFromJSON(uint64(), "[]"),
+                            Hash(*ToDevice(ArrayFromJSON(type, "[]"))));
+    auto values = ArrayFromJSON(type, "[1, 2, null, 1, 0, 42, 2, 5, null, 7]");
+    for (const auto& array : {values, values->Slice(3)}) {
+      // Same hashes as on the host
+      std::vector<uint64_t> hashes(array->length());
+      ASSERT_OK(compute::HashArray(*array->data(), hashes.data()));
+      AssertDeviceArrayEquals(UInt64Array(array->length(), Buffer::FromVector(hashes)),
+                              Hash(*ToDevice(array)));
+    }
+  }
+  ASSERT_RAISES(NotImplemented,
+                Hash(*ToDevice(ArrayFromJSON(boolean(), "[true, false]"))));
+}
+
 }  // namespace cuda
 }  // namespace arrow
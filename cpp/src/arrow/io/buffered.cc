@@ -18,7 +18,9 @@
 #include "arrow/io/buffered.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string_view>
@@ -28,7 +30,9 @@
 #include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -248,6 +252,72 @@ std::shared_ptr<OutputStream> BufferedOutputStream::raw() const { return impl_->
 // ----------------------------------------------------------------------
 // BufferedInputStream implementation
 
+namespace {
+
+// Call `method` on `target` on the executor
+// (closures defined in members of the non-exported Impl classes cannot be
+// given to Executor::Spawn, hence this helper)
+template <typename T>
+Status SpawnCall(::arrow::internal::Executor* executor, std::shared_ptr<T> target,
+                 void (T::*method)()) {
+  return executor->Spawn(
+      [target = std::move(target), method]() { ((*target).*method)(); });
+}
+
+// A chunk of the raw stream of a BufferedInputStream read ahead
+struct ReadaheadChunk {
+  ReadaheadChunk(std::shared_ptr<InputStream> raw, int64_t nbytes)
+      : raw(std::move(raw)), nbytes(nbytes) {}
+
+  // Read the chunk, unless another thread already does.  Both the readahead task
+  // and the reader waiting for the chunk call this, so that the reader does not
+  // wait for a task which a saturated executor did not start yet.
+  void Run() {
+    if (claimed.exchange(true)) {
+      return;
+    }
+    auto result = raw->Read(nbytes);
+    raw.reset();
+    data.MarkFinished(std::move(result));
+  }
+
+  // Give up reading the chunk, unless it is already being read
+  void Cancel(const Status& status) {
+    if (claimed.exchange(true)) {
+      return;
+    }
+    raw.reset();
+    data.MarkFinished(status);
+  }
+
+  std::shared_ptr<InputStream> raw;
+  int64_t nbytes;
+  std::atomic<bool> claimed{false};
+  Future<std::shared_ptr<Buffer>> data = Future<std::shared_ptr<Buffer>>::Make();
+};
+
+// Read `chunk` on `executor` once `previous`, if any, was read, as the reads
+// of the raw stream must be issued in order
+void ScheduleChunk(::arrow::internal::Executor* executor,
+                   const std::shared_ptr<ReadaheadChunk>& chunk,
+                   const std::shared_ptr<ReadaheadChunk>& previous) {
+  // If spawning fails, the chunk is read by the reader
+  if (previous == nullptr) {
+    ARROW_UNUSED(SpawnCall(executor, chunk, &ReadaheadChunk::Run));
+    return;
+  }
+  previous->data.AddCallback(
+      [executor, chunk](const Result<std::shared_ptr<Buffer>>& result) {
+        if (result.ok()) {
+          ARROW_UNUSED(SpawnCall(executor, chunk, &ReadaheadChunk::Run));
+        } else {
+          chunk->Cancel(result.status());
+        }
+      });
+}
+
+}  // namespace
+
 class BufferedInputStream::Impl : public BufferedBase {
  public:
   Impl(std::shared_ptr<InputStream> raw, MemoryPool* pool, int64_t raw_total_bytes_bound)
@@ -257,9 +327,15 @@ class BufferedInputStream::Impl : public BufferedBase {
         raw_read_bound_(raw_total_bytes_bound),
         bytes_buffered_(0) {}
 
+  void EnableReadahead(const BufferedReadaheadOptions& options) {
+    readahead_executor_ = options.io_context.executor();
+    readahead_ = std::max(options.readahead, 1);
+  }
+
   Status Close() {
     if (is_open_) {
       is_open_ = false;
+      StopReadahead();
       return raw_->Close();
     }
     return Status::OK();
@@ -268,12 +344,18 @@ class BufferedInputStream::Impl : public BufferedBase {
   Status Abort() {
     if (is_open_) {
       is_open_ = false;
+      StopReadahead();
       return raw_->Abort();
     }
     return Status::OK();
   }
 
   Result<int64_t> Tell() const {
+    if (readahead_started_) {
+      // The raw stream is ahead of the data read by the chunks read ahead
+      ARROW_ASSIGN_OR_RAISE(int64_t start_pos, readahead_start_pos_);
+      return start_pos + raw_read_total_ - bytes_buffered_;
+    }
     if (raw_pos_ == -1) {
       ARROW_ASSIGN_OR_RAISE(raw_pos_, raw_->Tell());
       DCHECK_GE(raw_pos_, 0);
@@ -317,8 +399,8 @@ class BufferedInputStream::Impl : public BufferedBase {
       }
       ARROW_ASSIGN_OR_RAISE(
           int64_t bytes_read,
-          raw_->Read(additional_bytes_to_read,
-                     buffer_->mutable_data() + buffer_pos_ + bytes_buffered_));
+          RawRead(additional_bytes_to_read,
+                  buffer_->mutable_data() + buffer_pos_ + bytes_buffered_));
       bytes_buffered_ += bytes_read;
       raw_read_total_ += bytes_read;
       nbytes = bytes_buffered_;
@@ -334,6 +416,7 @@ class BufferedInputStream::Impl : public BufferedBase {
 
   std::shared_ptr<InputStream> Detach() {
     is_open_ = false;
+    StopReadahead();
     return std::move(raw_);
   }
 
@@ -352,7 +435,7 @@ class BufferedInputStream::Impl : public BufferedBase {
     if (raw_read_bound_ >= 0) {
       bytes_to_buffer = std::min(buffer_size_, raw_read_bound_ - raw_read_total_);
     }
-    ARROW_ASSIGN_OR_RAISE(bytes_buffered_, raw_->Read(bytes_to_buffer, buffer_data_));
+    ARROW_ASSIGN_OR_RAISE(bytes_buffered_, RawRead(bytes_to_buffer, buffer_data_));
     buffer_pos_ = 0;
     raw_read_total_ += bytes_buffered_;
 
@@ -397,8 +480,8 @@ class BufferedInputStream::Impl : public BufferedBase {
     if (remaining_bytes >= buffer_size_) {
       // 2.1. If read is larger than buffer size, read directly from storage.
       ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
-                            raw_->Read(remaining_bytes, reinterpret_cast<uint8_t*>(out) +
-                                                            pre_buffer_copy_bytes));
+                            RawRead(remaining_bytes, reinterpret_cast<uint8_t*>(out) +
+                                                         pre_buffer_copy_bytes));
       raw_read_total_ += bytes_read;
       RewindBuffer();
       return pre_buffer_copy_bytes + bytes_read;
@@ -430,6 +513,92 @@ class BufferedInputStream::Impl : public BufferedBase {
   std::shared_ptr<InputStream> raw() const { return raw_; }
 
  private:
+  // Read from the raw stream, or from the chunks read ahead if enabled
+  Result<int64_t> RawRead(int64_t nbytes, uint8_t* out) {
+    if (readahead_executor_ == nullptr) {
+      return raw_->Read(nbytes, out);
+    }
+    int64_t bytes_read = 0;
+    while (bytes_read < nbytes) {
+      if (chunk_ == nullptr || chunk_pos_ == chunk_->size()) {
+        ARROW_ASSIGN_OR_RAISE(bool has_chunk, NextChunk());
+        if (!has_chunk) {
+          break;
+        }
+      }
+      const int64_t chunk_bytes =
+          std::min(nbytes - bytes_read, chunk_->size() - chunk_pos_);
+      std::memcpy(out + bytes_read, chunk_->data() + chunk_pos_, chunk_bytes);
+      chunk_pos_ += chunk_bytes;
+      bytes_read += chunk_bytes;
+    }
+    return bytes_read;
+  }
+
+  // Move to the next chunk read ahead, returning false at the end of the stream
+  Result<bool> NextChunk() {
+    chunk_.reset();
+    chunk_pos_ = 0;
+    RETURN_NOT_OK(readahead_status_);
+    ScheduleChunks();
+    if (readahead_chunks_.empty()) {
+      return false;
+    }
+    auto next = std::move(readahead_chunks_.front());
+    readahead_chunks_.pop_front();
+    // The previous chunk was read, so this one can be read here if no task
+    // started reading it yet
+    next->Run();
+    auto result = next->data.result();
+    if (!result.ok() || (*result)->size() == 0) {
+      readahead_finished_ = true;
+      StopReadahead();
+      readahead_status_ = result.status();
+      RETURN_NOT_OK(readahead_status_);
+      return false;
+    }
+    chunk_ = std::move(result).ValueUnsafe();
+    ScheduleChunks();
+    return true;
+  }
+
+  // Read the next chunks ahead, up to the readahead
+  void ScheduleChunks() {
+    while (!readahead_finished_ &&
+           static_cast<int>(readahead_chunks_.size()) < readahead_) {
+      int64_t nbytes = buffer_size_;
+      if (raw_read_bound_ >= 0) {
+        nbytes = std::min(nbytes, raw_read_bound_ - raw_read_scheduled_);
+        if (nbytes == 0) {
+          readahead_finished_ = true;
+          break;
+        }
+      }
+      if (!readahead_started_) {
+        // No read of the raw stream is in flight yet
+        readahead_start_pos_ = raw_->Tell();
+        readahead_started_ = true;
+      }
+      auto chunk = std::make_shared<ReadaheadChunk>(raw_, nbytes);
+      ScheduleChunk(readahead_executor_, chunk,
+                    readahead_chunks_.empty() ? nullptr : readahead_chunks_.back());
+      readahead_chunks_.push_back(std::move(chunk));
+      raw_read_scheduled_ += nbytes;
+    }
+  }
+
+  // Wait for the reads in flight and discard the chunks read ahead
+  void StopReadahead() {
+    for (const auto& chunk : readahead_chunks_) {
+      chunk->Cancel(Status::Cancelled("BufferedInputStream readahead stopped"));
+    }
+    for (const auto& chunk : readahead_chunks_) {
+      chunk->data.Wait();
+    }
+    readahead_chunks_.clear();
+    readahead_finished_ = true;
+  }
+
   std::shared_ptr<InputStream> raw_;
   int64_t raw_read_total_;
   int64_t raw_read_bound_;
@@ -437,6 +606,21 @@ class BufferedInputStream::Impl : public BufferedBase {
   // Number of remaining bytes in the buffer, to be reduced on each read from
   // the buffer
   int64_t bytes_buffered_;
+
+  // Readahead state, used if readahead_executor_ is not null
+  ::arrow::internal::Executor* readahead_executor_ = nullptr;
+  int readahead_ = 0;
+  std::deque<std::shared_ptr<ReadaheadChunk>> readahead_chunks_;
+  // The chunk being consumed
+  std::shared_ptr<Buffer> chunk_;
+  int64_t chunk_pos_ = 0;
+  // Number of bytes requested from the raw stream so far
+  int64_t raw_read_scheduled_ = 0;
+  bool readahead_finished_ = false;
+  Status readahead_status_;
+  bool readahead_started_ = false;
+  // The position of the raw stream before reading ahead
+  Result<int64_t> readahead_start_pos_;
 };
 
 BufferedInputStream::BufferedInputStream(std::shared_ptr<InputStream> raw,
@@ -456,6 +640,15 @@ Result<std::shared_ptr<BufferedInputStream>> BufferedInputStream::Create(
   return result;
 }
 
+Result<std::shared_ptr<BufferedInputStream>> BufferedInputStream::Create(
+    int64_t buffer_size, MemoryPool* pool, std::shared_ptr<InputStream> raw,
+    const BufferedReadaheadOptions& options, int64_t raw_total_bytes_bound) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto result, Create(buffer_size, pool, std::move(raw), raw_total_bytes_bound));
+  result->impl_->EnableReadahead(options);
+  return result;
+}
+
 Status BufferedInputStream::DoClose() { return impl_->Close(); }
 
 Status BufferedInputStream::DoAbort() { return impl_->Abort(); }
@@ -89,6 +89,16 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   std::unique_ptr<Impl> impl_;
 };
 
+/// \brief Options for reading the raw stream of a BufferedInputStream ahead of
+/// the reads
+struct ARROW_EXPORT BufferedReadaheadOptions {
+  /// The IOContext whose executor reads the raw stream
+  IOContext io_context = default_io_context();
+  /// The number of buffer-sized chunks to read ahead of the chunk being consumed,
+  /// 1 for double buffering
+  int readahead = 1;
+};
+
 /// \class BufferedInputStream
 /// \brief An InputStream that performs buffered reads from an unbuffered
 /// InputStream, which can mitigate the overhead of many small reads in some
@@ -110,6 +120,16 @@ class ARROW_EXPORT BufferedInputStream
       int64_t buffer_size, MemoryPool* pool, std::shared_ptr<InputStream> raw,
       int64_t raw_read_bound = -1);
 
+  /// \brief Create a BufferedInputStream reading the raw InputStream ahead
+  ///
+  /// The raw stream is read in chunks of the buffer size on the executor of
+  /// `options.io_context`, so that the next chunks are fetched while the
+  /// current one is consumed.  Reads of the raw stream are still issued one
+  /// at a time and in order.  Detach() discards the data read ahead.
+  static Result<std::shared_ptr<BufferedInputStream>> Create(
+      int64_t buffer_size, MemoryPool* pool, std::shared_ptr<InputStream> raw,
+      const BufferedReadaheadOptions& options, int64_t raw_read_bound = -1);
+
   /// \brief Resize internal read buffer; calls to Read(...) will read at least
   /// \param[in] new_buffer_size the new read buffer size
   /// \return Status
@@ -851,8 +851,10 @@ TEST_F(TestBufferedInputStreamChunk, BufferSmallerThanReadBound) {
 class TestBufferedInputStreamRandom : public ::testing::Test {
  public:
   void MakeBuffered(int64_t data_size, int64_t buffer_size,
-                    std::optional<int64_t> read_bound = std::nullopt) {
+                    std::optional<int64_t> read_bound = std::nullopt,
+                    std::optional<BufferedReadaheadOptions> readahead = std::nullopt) {
     buffer_size_ = buffer_size;
+    readahead_ = readahead ? readahead->readahead : 0;
     data_.clear();
     data_.reserve(data_size);
     while (data_.size() < static_cast<size_t>(data_size)) {
@@ -867,9 +869,16 @@ class TestBufferedInputStreamRandom : public ::testing::Test {
     // Read from a copy of data, so that data_.substr() below doesn't invalidate it
     raw_ = BufferReader::FromString(data_);
     tracked_ = TrackedRandomAccessFile::Make(raw_.get());
-    EXPECT_OK_AND_ASSIGN(buffered_,
-                         BufferedInputStream::Create(buffer_size, default_memory_pool(),
-                                                     tracked_, read_bound.value_or(-1)));
+    if (readahead) {
+      EXPECT_OK_AND_ASSIGN(
+          buffered_, BufferedInputStream::Create(buffer_size, default_memory_pool(),
+                                                 tracked_, *readahead,
+                                                 read_bound.value_or(-1)));
+    } else {
+      EXPECT_OK_AND_ASSIGN(buffered_, BufferedInputStream::Create(
+                                          buffer_size, default_memory_pool(), tracked_,
+                                          read_bound.value_or(-1)));
+    }
     if (read_bound) {
       data_ = data_.substr(0, *read_bound);
     }
@@ -886,13 +895,15 @@ class TestBufferedInputStreamRandom : public ::testing::Test {
       ASSERT_OK_AND_ASSIGN(auto buf, buffered_->Read(read_len));
       AssertBufferEqual(*buf, std::string_view(data_).substr(pos, read_len));
       pos += buf->size();
+      ASSERT_OK_AND_EQ(pos, buffered_->Tell());
     }
 
     // EOF was reached
     ASSERT_EQ(pos, size);
 
     // Number of reads should not be excessive given the buffer size
-    int64_t max_reads = (size + buffer_size_ - 1) / buffer_size_;
+    // (reading ahead may issue a few reads past EOF)
+    int64_t max_reads = (size + buffer_size_ - 1) / buffer_size_ + readahead_;
     EXPECT_LE(tracked_->num_reads(), max_reads);
     const auto& read_ranges = tracked_->get_read_ranges();
     pos = 0;
@@ -915,6 +926,7 @@ class TestBufferedInputStreamRandom : public ::testing::Test {
  protected:
   std::string data_;
   int64_t buffer_size_;
+  int readahead_ = 0;
   std::shared_ptr<RandomAccessFile> raw_;
   std::shared_ptr<TrackedRandomAccessFile> tracked_;
   std::shared_ptr<BufferedInputStream> buffered_;
@@ -938,4 +950,40 @@ TEST_F(TestBufferedInputStreamRandom, ReadsWithReadBound) {
   }
 }
 
+TEST_F(TestBufferedInputStreamRandom, ReadsWithReadahead) {
+  constexpr int kNumIters = 10;
+
+  for (int readahead : {1, 3}) {
+    ARROW_SCOPED_TRACE("readahead = ", readahead);
+    BufferedReadaheadOptions options;
+    options.readahead = readahead;
+    for (int i = 0; i < kNumIters; ++i) {
+      MakeBuffered(/*data_size=*/3000, /*buffer_size=*/11, std::nullopt, options);
+      TestReads();
+      MakeBuffered(/*data_size=*/3000, /*buffer_size=*/11, /*read_bound=*/2000, options);
+      TestReads();
+    }
+  }
+}
+
+TEST_F(TestBufferedInputStreamRandom, ReadaheadPeekAndDetach) {
+  BufferedReadaheadOptions options;
+  options.readahead = 2;
+  MakeBuffered(/*data_size=*/3000, /*buffer_size=*/100, std::nullopt, options);
+
+  ASSERT_OK_AND_ASSIGN(auto peeked, buffered_->Peek(10));
+  ASSERT_EQ(peeked, std::string_view(data_).substr(0, 10));
+  // Peeking more than the buffer size
+  ASSERT_OK_AND_ASSIGN(peeked, buffered_->Peek(250));
+  ASSERT_EQ(peeked, std::string_view(data_).substr(0, 250));
+  ASSERT_OK_AND_ASSIGN(auto buf, buffered_->Read(260));
+  AssertBufferEqual(*buf, std::string_view(data_).substr(0, 260));
+  ASSERT_OK_AND_EQ(260, buffered_->Tell());
+
+  // Detaching waits for the reads in flight
+  auto raw = buffered_->Detach();
+  ASSERT_OK_AND_ASSIGN(auto raw_pos, raw->Tell());
+  ASSERT_GE(raw_pos, 260);
+}
+
 }  // namespace arrow::io
@@ -17,7 +17,9 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
+#include <limits>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -28,6 +30,7 @@
 #include "arrow/result.h"
 #include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -46,6 +49,28 @@ CacheOptions CacheOptions::LazyDefaults() {
                       /*prefetch_limit=*/0};
 }
 
+namespace {
+
+CacheOptions MakeFromMetrics(double time_to_first_byte_sec,
+                             double transfer_bandwidth_bytes_per_sec,
+                             double ideal_bandwidth_utilization_frac,
+                             int64_t max_ideal_request_size_bytes) {
+  // hole_size_limit = TTFB * BW
+  const auto hole_size_limit = static_cast<int64_t>(
+      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
+
+  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
+  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
+  const int64_t range_size_limit = std::min(
+      max_ideal_request_size_bytes,
+      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
+                                      (1 - ideal_bandwidth_utilization_frac))));
+
+  return {hole_size_limit, range_size_limit, /*lazy=*/false, /*prefetch_limit=*/0};
+}
+
+}  // namespace
+
 CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_millis,
                                                   int64_t transfer_bandwidth_mib_per_sec,
                                                   double ideal_bandwidth_utilization_frac,
@@ -109,25 +134,72 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
       << "Ideal bandwidth utilization fraction must be < 1";
   DCHECK_GT(max_ideal_request_size_mib, 0) << "Max Ideal request size must be > 0";
 
-  const double time_to_first_byte_sec = time_to_first_byte_millis / 1000.0;
-  const int64_t transfer_bandwidth_bytes_per_sec =
-      transfer_bandwidth_mib_per_sec * 1024 * 1024;
-  const int64_t max_ideal_request_size_bytes = max_ideal_request_size_mib * 1024 * 1024;
+  const CacheOptions options = MakeFromMetrics(
+      time_to_first_byte_millis / 1000.0,
+      static_cast<double>(transfer_bandwidth_mib_per_sec * 1024 * 1024),
+      ideal_bandwidth_utilization_frac, max_ideal_request_size_mib * 1024 * 1024);
+  DCHECK_GT(options.hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+  DCHECK_GT(options.range_size_limit, 0) << "Computed range_size_limit must be > 0";
+  return options;
+}
 
-  // hole_size_limit = TTFB * BW
-  const auto hole_size_limit = static_cast<int64_t>(
-      std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec));
-  DCHECK_GT(hole_size_limit, 0) << "Computed hole_size_limit must be > 0";
+void StorageMetrics::RecordRead(int64_t nbytes, double seconds) {
+  const auto x = static_cast<double>(nbytes);
+  std::lock_guard<std::mutex> lock(mutex_);
+  sum_weights_ = sum_weights_ * kDecay + 1;
+  sum_x_ = sum_x_ * kDecay + x;
+  sum_y_ = sum_y_ * kDecay + seconds;
+  sum_xx_ = sum_xx_ * kDecay + x * x;
+  sum_xy_ = sum_xy_ * kDecay + x * seconds;
+  ++num_reads_;
+}
 
-  // range_size_limit = min(MAX_IDEAL_REQUEST_SIZE,
-  //                        hole_size_limit * BW_util_frac / (1 - BW_util_frac))
-  const int64_t range_size_limit = std::min(
-      max_ideal_request_size_bytes,
-      static_cast<int64_t>(std::round(hole_size_limit * ideal_bandwidth_utilization_frac /
-                                      (1 - ideal_bandwidth_utilization_frac))));
-  DCHECK_GT(range_size_limit, 0) << "Computed range_size_limit must be > 0";
+int64_t StorageMetrics::num_reads() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return num_reads_;
+}
 
-  return {hole_size_limit, range_size_limit, /*lazy=*/false, /*prefetch_limit=*/0};
+std::optional<StorageMetrics::Estimates> StorageMetrics::GetEstimates() const {
+  // Sizes must spread over at least 10% of their mean for the fit to be meaningful
+  constexpr double kMinRelativeSpread = 0.1;
+  // Latencies below this cannot be told apart from timing noise
+  constexpr double kMinTimeToFirstByteSeconds = 1e-5;
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (num_reads_ < kMinReads) {
+    return std::nullopt;
+  }
+  // Fit duration = TTFB + size / BW
+  const double mean_x = sum_x_ / sum_weights_;
+  const double mean_y = sum_y_ / sum_weights_;
+  const double variance_x = sum_xx_ / sum_weights_ - mean_x * mean_x;
+  const double covariance_xy = sum_xy_ / sum_weights_ - mean_x * mean_y;
+  const double min_spread = kMinRelativeSpread * mean_x;
+  if (!(variance_x > min_spread * min_spread)) {
+    return std::nullopt;
+  }
+  const double seconds_per_byte = covariance_xy / variance_x;
+  if (!(seconds_per_byte > 0)) {
+    return std::nullopt;
+  }
+  const double time_to_first_byte =
+      std::max(mean_y - seconds_per_byte * mean_x, kMinTimeToFirstByteSeconds);
+  return Estimates{time_to_first_byte, 1 / seconds_per_byte};
+}
+
+CacheOptions StorageMetrics::TuneCacheOptions(CacheOptions options) const {
+  const auto estimates = GetEstimates();
+  if (!estimates.has_value()) {
+    return options;
+  }
+  const CacheOptions tuned = MakeFromMetrics(
+      estimates->time_to_first_byte_seconds, estimates->bandwidth_bytes_per_second,
+      CacheOptions::kDefaultIdealBandwidthUtilizationFrac,
+      CacheOptions::kDefaultMaxIdealRequestSizeMib * 1024 * 1024);
+  // Coalescing requires a range size limit above the hole size limit
+  options.range_size_limit = std::max<int64_t>(tuned.range_size_limit, 2);
+  options.hole_size_limit = std::min(tuned.hole_size_limit, options.range_size_limit - 1);
+  return options;
 }
 
 namespace internal {
@@ -135,6 +207,10 @@ namespace internal {
 struct RangeCacheEntry {
   ReadRange range;
   Future<std::shared_ptr<Buffer>> future;
+  // The bytes of the requested ranges within this entry not released yet
+  int64_t unreleased_bytes = 0;
+  // Whether all the requested ranges within this entry were released
+  bool released = false;
 
   RangeCacheEntry() = default;
   RangeCacheEntry(const ReadRange& range_, Future<std::shared_ptr<Buffer>> future_)
@@ -153,9 +229,28 @@ struct ReadRangeCache::Impl {
 
   // Ordered by offset (so as to find a matching region by binary search)
   std::vector<RangeCacheEntry> entries;
+  // The bytes of the entries read or being read, and not released yet
+  int64_t held_bytes = 0;
 
   virtual ~Impl() = default;
 
+  // Read a range from the file, recording the duration of the read in the
+  // storage metrics if any
+  Future<std::shared_ptr<Buffer>> ReadAsync(const ReadRange& range) {
+    if (options.storage_metrics == nullptr) {
+      return file->ReadAsync(ctx, range.offset, range.length);
+    }
+    const auto start = std::chrono::steady_clock::now();
+    return file->ReadAsync(ctx, range.offset, range.length)
+        .Then([metrics = options.storage_metrics,
+               start](const std::shared_ptr<Buffer>& buffer) {
+          const std::chrono::duration<double> elapsed =
+              std::chrono::steady_clock::now() - start;
+          metrics->RecordRead(buffer->size(), elapsed.count());
+          return buffer;
+        });
+  }
+
   // Get the future corresponding to a range
   virtual Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) {
     return entry->future;
@@ -166,18 +261,52 @@ struct ReadRangeCache::Impl {
       const std::vector<ReadRange>& ranges) {
     std::vector<RangeCacheEntry> new_entries;
     new_entries.reserve(ranges.size());
+    if (options.storage_metrics == nullptr) {
+      // Issue the reads together so that the file can batch them
+      auto futures = file->ReadManyAsync(ctx, ranges);
+      for (size_t i = 0; i < ranges.size(); ++i) {
+        new_entries.emplace_back(ranges[i], std::move(futures[i]));
+        held_bytes += ranges[i].length;
+      }
+      return new_entries;
+    }
     for (const auto& range : ranges) {
-      new_entries.emplace_back(range, file->ReadAsync(ctx, range.offset, range.length));
+      new_entries.emplace_back(range, ReadAsync(range));
+      held_bytes += range.length;
     }
     return new_entries;
   }
 
+  // Find the entry containing the given range, or return entries.end()
+  std::vector<RangeCacheEntry>::iterator FindEntry(const ReadRange& range) {
+    const auto it = std::lower_bound(
+        entries.begin(), entries.end(), range,
+        [](const RangeCacheEntry& entry, const ReadRange& range) {
+          return entry.range.offset + entry.range.length < range.offset + range.length;
+        });
+    if (it != entries.end() && it->range.Contains(range)) {
+      return it;
+    }
+    return entries.end();
+  }
+
+  // Whether reading the given entry ahead of the reader would exceed the memory
+  // limit. An entry is always allowed when nothing else is held.
+  bool ExceedsMemoryLimit(const RangeCacheEntry& entry) const {
+    return options.memory_limit > 0 && held_bytes > 0 &&
+           held_bytes + entry.range.length > options.memory_limit;
+  }
+
   // Add the given ranges to the cache, coalescing them where possible
   virtual Status Cache(std::vector<ReadRange> ranges) {
-    ARROW_ASSIGN_OR_RAISE(
-        ranges, internal::CoalesceReadRanges(std::move(ranges), options.hole_size_limit,
-                                             options.range_size_limit));
-    std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(ranges);
+    const CacheOptions coalescing =
+        options.storage_metrics != nullptr
+            ? options.storage_metrics->TuneCacheOptions(options)
+            : options;
+    ARROW_ASSIGN_OR_RAISE(auto coalesced, internal::CoalesceReadRanges(
+                                              ranges, coalescing.hole_size_limit,
+                                              coalescing.range_size_limit));
+    std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(coalesced);
     // Add new entries, themselves ordered by offset
     if (entries.size() > 0) {
       std::vector<RangeCacheEntry> merged(entries.size() + new_entries.size());
@@ -187,8 +316,15 @@ struct ReadRangeCache::Impl {
     } else {
       entries = std::move(new_entries);
     }
+    // An entry is released once all the ranges requested within it are
+    for (const auto& range : ranges) {
+      const auto it = FindEntry(range);
+      if (it != entries.end()) {
+        it->unreleased_bytes += range.length;
+      }
+    }
     // Prefetch immediately, regardless of executor availability, if possible
-    return file->WillNeed(ranges);
+    return file->WillNeed(coalesced);
   }
 
   // Read the given range from the cache, blocking if needed. Cannot read a range
@@ -199,12 +335,12 @@ struct ReadRangeCache::Impl {
       return std::make_shared<Buffer>(&byte, 0);
     }
 
-    const auto it = std::lower_bound(
-        entries.begin(), entries.end(), range,
-        [](const RangeCacheEntry& entry, const ReadRange& range) {
-          return entry.range.offset + entry.range.length < range.offset + range.length;
-        });
-    if (it != entries.end() && it->range.Contains(range)) {
+    const auto it = FindEntry(range);
+    if (it != entries.end()) {
+      if (it->released) {
+        // The cached data was dropped, read the range again without caching it
+        return file->ReadAt(range.offset, range.length);
+      }
       auto fut = MaybeRead(&*it);
       ARROW_ASSIGN_OR_RAISE(auto buf, fut.result());
       if (options.lazy && options.prefetch_limit > 0) {
@@ -212,9 +348,14 @@ struct ReadRangeCache::Impl {
         for (auto next_it = it + 1;
              next_it != entries.end() && num_prefetched < options.prefetch_limit;
              ++next_it) {
+          if (next_it->released) {
+            continue;
+          }
           if (!next_it->future.is_valid()) {
-            next_it->future =
-                file->ReadAsync(ctx, next_it->range.offset, next_it->range.length);
+            if (ExceedsMemoryLimit(*next_it)) {
+              break;
+            }
+            ARROW_UNUSED(MaybeRead(&*next_it));
           }
           ++num_prefetched;
         }
@@ -227,7 +368,9 @@ struct ReadRangeCache::Impl {
   virtual Future<> Wait() {
     std::vector<Future<>> futures;
     for (auto& entry : entries) {
-      futures.emplace_back(MaybeRead(&entry));
+      if (!entry.released) {
+        futures.emplace_back(MaybeRead(&entry));
+      }
     }
     return AllComplete(futures);
   }
@@ -240,13 +383,11 @@ struct ReadRangeCache::Impl {
     std::vector<Future<>> futures;
     futures.reserve(ranges.size());
     for (auto& range : ranges) {
-      const auto it = std::lower_bound(
-          entries.begin(), entries.end(), range,
-          [](const RangeCacheEntry& entry, const ReadRange& range) {
-            return entry.range.offset + entry.range.length < range.offset + range.length;
-          });
-      if (it != entries.end() && it->range.Contains(range)) {
-        futures.push_back(Future<>(MaybeRead(&*it)));
+      const auto it = FindEntry(range);
+      if (it != entries.end()) {
+        if (!it->released) {
+          futures.push_back(Future<>(MaybeRead(&*it)));
+        }
       } else {
         return Status::Invalid("Range was not requested for caching: offset=",
                                range.offset, " length=", range.length);
@@ -254,6 +395,30 @@ struct ReadRangeCache::Impl {
     }
     return AllComplete(futures);
   }
+
+  // Release the given ranges, dropping the data of the entries whose requested
+  // ranges were all released
+  virtual Status Release(std::vector<ReadRange> ranges) {
+    for (const auto& range : ranges) {
+      if (range.length == 0) {
+        continue;
+      }
+      const auto it = FindEntry(range);
+      if (it == entries.end()) {
+        return Status::Invalid("Range was not requested for caching: offset=",
+                               range.offset, " length=", range.length);
+      }
+      it->unreleased_bytes -= range.length;
+      if (it->unreleased_bytes <= 0 && !it->released) {
+        if (it->future.is_valid()) {
+          held_bytes -= it->range.length;
+          it->future = Future<std::shared_ptr<Buffer>>();
+        }
+        it->released = true;
+      }
+    }
+    return Status::OK();
+  }
 };
 
 // Don't read ranges when they're first added. Instead, wait until they're requested
@@ -267,7 +432,8 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
     // Called by superclass Read()/WaitFor() so we have the lock
     if (!entry->future.is_valid()) {
-      entry->future = file->ReadAsync(ctx, entry->range.offset, entry->range.length);
+      entry->future = ReadAsync(entry->range);
+      held_bytes += entry->range.length;
     }
     return entry->future;
   }
@@ -303,12 +469,99 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
     std::unique_lock<std::mutex> guard(entry_mutex);
     return ReadRangeCache::Impl::WaitFor(std::move(ranges));
   }
+
+  Status Release(std::vector<ReadRange> ranges) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    return ReadRangeCache::Impl::Release(std::move(ranges));
+  }
+};
+
+// Issue reads ahead of the reader like the default cache, but only while the bytes
+// being read stay under a limit derived from the storage metrics, and the bytes
+// held stay under the memory limit. The remaining ranges are issued by later calls,
+// once earlier reads have completed or earlier ranges have been released.
+struct ReadRangeCache::BoundedImpl : public ReadRangeCache::LazyImpl {
+  // Shared with the read callbacks, which may outlive the cache
+  std::shared_ptr<std::atomic<int64_t>> in_flight_bytes =
+      std::make_shared<std::atomic<int64_t>>(0);
+
+  virtual ~BoundedImpl() = default;
+
+  Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
+    if (!entry->future.is_valid()) {
+      const int64_t length = entry->range.length;
+      in_flight_bytes->fetch_add(length);
+      ARROW_UNUSED(LazyImpl::MaybeRead(entry));
+      entry->future.AddCallback(
+          [in_flight_bytes = in_flight_bytes,
+           length](const Result<std::shared_ptr<Buffer>>&) {
+            in_flight_bytes->fetch_sub(length);
+          });
+    }
+    return entry->future;
+  }
+
+  // One range per thread of the I/O executor
+  int64_t MaxInFlightBytes() const {
+    const CacheOptions tuned = options.storage_metrics->TuneCacheOptions(options);
+    return std::max(ctx.executor()->GetCapacity(), 1) * tuned.range_size_limit;
+  }
+
+  // Issue the reads of the next ranges in offset order while under the limits
+  void ReadAhead() {
+    const int64_t max_in_flight_bytes = options.storage_metrics != nullptr
+                                            ? MaxInFlightBytes()
+                                            : std::numeric_limits<int64_t>::max();
+    for (auto& entry : entries) {
+      if (entry.released || entry.future.is_valid()) {
+        continue;
+      }
+      if (in_flight_bytes->load() >= max_in_flight_bytes || ExceedsMemoryLimit(entry)) {
+        break;
+      }
+      ARROW_UNUSED(MaybeRead(&entry));
+    }
+  }
+
+  Status Cache(std::vector<ReadRange> ranges) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    RETURN_NOT_OK(ReadRangeCache::Impl::Cache(std::move(ranges)));
+    ReadAhead();
+    return Status::OK();
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(ReadRange range) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadRangeCache::Impl::Read(range));
+    ReadAhead();
+    return buffer;
+  }
+
+  Future<> WaitFor(std::vector<ReadRange> ranges) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    auto future = ReadRangeCache::Impl::WaitFor(std::move(ranges));
+    ReadAhead();
+    return future;
+  }
+
+  Status Release(std::vector<ReadRange> ranges) override {
+    std::unique_lock<std::mutex> guard(entry_mutex);
+    RETURN_NOT_OK(ReadRangeCache::Impl::Release(std::move(ranges)));
+    ReadAhead();
+    return Status::OK();
+  }
 };
 
 ReadRangeCache::ReadRangeCache(std::shared_ptr<RandomAccessFile> owned_file,
                                RandomAccessFile* file, IOContext ctx,
-                               CacheOptions options)
-    : impl_(options.lazy ? new LazyImpl() : new Impl()) {
+                               CacheOptions options) {
+  if (options.lazy) {
+    impl_.reset(new LazyImpl());
+  } else if (options.storage_metrics != nullptr || options.memory_limit > 0) {
+    impl_.reset(new BoundedImpl());
+  } else {
+    impl_.reset(new Impl());
+  }
   impl_->owned_file = std::move(owned_file);
   impl_->file = file;
   impl_->ctx = std::move(ctx);
@@ -331,6 +584,10 @@ Future<> ReadRangeCache::WaitFor(std::vector<ReadRange> ranges) {
   return impl_->WaitFor(std::move(ranges));
 }
 
+Status ReadRangeCache::Release(std::vector<ReadRange> ranges) {
+  return impl_->Release(std::move(ranges));
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
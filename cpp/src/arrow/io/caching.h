@@ -19,6 +19,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,6 +32,8 @@
 namespace arrow {
 namespace io {
 
+class StorageMetrics;
+
 struct ARROW_EXPORT CacheOptions {
   static constexpr double kDefaultIdealBandwidthUtilizationFrac = 0.9;
   static constexpr int64_t kDefaultMaxIdealRequestSizeMib = 64;
@@ -51,11 +55,27 @@ struct ARROW_EXPORT CacheOptions {
   /// \brief The maximum number of ranges to be prefetched. This is only used
   ///   for lazy cache to asynchronously read some ranges after reading the target range.
   int64_t prefetch_limit = 0;
+  /// \brief The observed metrics of the storage being read, or null. When set, the
+  ///   cache records the duration of its reads in it and, once it holds estimates,
+  ///   coalesces ranges with the limits that MakeFromNetworkMetrics() derives from
+  ///   them instead of hole_size_limit and range_size_limit. A non-lazy cache then
+  ///   also issues reads ahead of the reader only while the bytes being read stay
+  ///   under one range_size_limit per thread of the I/O executor. Share a single
+  ///   instance among the caches reading from the same storage.
+  std::shared_ptr<StorageMetrics> storage_metrics;
+  /// \brief The maximum number of bytes of coalesced ranges that the cache holds at
+  ///   once, or 0 for no limit. Ranges are read ahead of the reader in offset order
+  ///   while they fit under the limit, and the following ones once earlier ranges
+  ///   are released (see ReadRangeCache::Release()). A range requested by the reader
+  ///   is always read, even beyond the limit.
+  int64_t memory_limit = 0;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
            range_size_limit == other.range_size_limit && lazy == other.lazy &&
-           prefetch_limit == other.prefetch_limit;
+           prefetch_limit == other.prefetch_limit &&
+           storage_metrics == other.storage_metrics &&
+           memory_limit == other.memory_limit;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -82,6 +102,49 @@ struct ARROW_EXPORT CacheOptions {
   static CacheOptions LazyDefaults();
 };
 
+/// \brief The time to first byte and transfer bandwidth of a storage, estimated
+/// from the sizes and durations of the reads made from it.
+///
+/// The estimates come from a least-squares fit of the read durations against
+/// the read sizes, in which recent reads weigh more so that the estimates follow
+/// changes of the storage conditions. This class is thread-safe.
+class ARROW_EXPORT StorageMetrics {
+ public:
+  /// The number of reads to record before making estimates
+  static constexpr int64_t kMinReads = 8;
+  /// The weight kept by the past reads when recording a new one
+  static constexpr double kDecay = 0.98;
+
+  struct Estimates {
+    double time_to_first_byte_seconds;
+    double bandwidth_bytes_per_second;
+  };
+
+  /// \brief Record a read of nbytes that completed in the given number of seconds.
+  void RecordRead(int64_t nbytes, double seconds);
+
+  /// \brief The number of reads recorded so far.
+  int64_t num_reads() const;
+
+  /// \brief The estimates, or nullopt if too few reads were recorded or if their
+  /// sizes are too alike to tell latency from transfer time.
+  std::optional<Estimates> GetEstimates() const;
+
+  /// \brief Return the given options with the hole and range size limits derived
+  /// from the estimates, or unchanged if there are no estimates yet.
+  CacheOptions TuneCacheOptions(CacheOptions options) const;
+
+ private:
+  mutable std::mutex mutex_;
+  int64_t num_reads_ = 0;
+  // Weighted sums over the reads of their sizes x and durations y
+  double sum_weights_ = 0;
+  double sum_x_ = 0;
+  double sum_y_ = 0;
+  double sum_xx_ = 0;
+  double sum_xy_ = 0;
+};
+
 namespace internal {
 
 /// \brief A read cache designed to hide IO latencies when reading.
@@ -107,6 +170,9 @@ namespace internal {
 /// 3. Call Read() to retrieve the actual data for the given ranges.
 ///    A synchronous application may skip WaitFor() and just call Read() - it will still
 ///    benefit from coalescing and parallel fetching.
+///
+/// 4. Optionally, call Release() once the data of the given ranges is no longer
+///    needed, so that the cache drops it (see CacheOptions.memory_limit).
 class ARROW_EXPORT ReadRangeCache {
  public:
   static constexpr int64_t kDefaultHoleSizeLimit = 8192;
@@ -142,9 +208,19 @@ class ARROW_EXPORT ReadRangeCache {
   /// \brief Wait until all given ranges have been cached.
   Future<> WaitFor(std::vector<ReadRange> ranges);
 
+  /// \brief Signal that the given ranges, previously given to Cache(), will not be
+  /// read anymore.
+  ///
+  /// The cache drops its data for a coalesced range once all the ranges within it
+  /// have been released, which lets a cache with a memory limit read the following
+  /// ranges. Buffers already returned by Read() remain valid. Reading a released
+  /// range again reads it from the file, without caching.
+  Status Release(std::vector<ReadRange> ranges);
+
  protected:
   struct Impl;
   struct LazyImpl;
+  struct BoundedImpl;
 
   ReadRangeCache(std::shared_ptr<RandomAccessFile> owned_file, RandomAccessFile* file,
                  IOContext ctx, CacheOptions options);
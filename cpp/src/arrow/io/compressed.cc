@@ -18,7 +18,10 @@
 #include "arrow/io/compressed.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,7 +32,9 @@
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -39,6 +44,81 @@ using util::Decompressor;
 
 namespace io {
 
+namespace {
+
+// Compress `input` as a complete compressed stream
+Result<std::shared_ptr<Buffer>> CompressBlock(Compressor* compressor, const Buffer& input,
+                                              MemoryPool* pool) {
+  ARROW_ASSIGN_OR_RAISE(
+      auto output,
+      AllocateResizableBuffer(std::max<int64_t>(input.size() / 2, 64 * 1024), pool));
+  int64_t output_pos = 0;
+  const uint8_t* data = input.data();
+  int64_t nbytes = input.size();
+  while (nbytes > 0) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result, compressor->Compress(nbytes, data, output->size() - output_pos,
+                                          output->mutable_data() + output_pos));
+    output_pos += result.bytes_written;
+    data += result.bytes_read;
+    nbytes -= result.bytes_read;
+    if (result.bytes_read == 0 || output_pos == output->size()) {
+      RETURN_NOT_OK(output->Resize(output->size() * 2));
+    }
+  }
+  while (true) {
+    ARROW_ASSIGN_OR_RAISE(auto result,
+                          compressor->End(output->size() - output_pos,
+                                          output->mutable_data() + output_pos));
+    output_pos += result.bytes_written;
+    if (!result.should_retry) {
+      break;
+    }
+    RETURN_NOT_OK(output->Resize(output->size() * 2));
+  }
+  RETURN_NOT_OK(output->Resize(output_pos));
+  return std::shared_ptr<Buffer>(std::move(output));
+}
+
+// Call `method` of `target` on `executor`
+//
+// (closures defined in members of the non-exported Impl classes cannot be
+// given to Executor::Spawn, hence this helper)
+template <typename T>
+Status SpawnCall(::arrow::internal::Executor* executor, std::shared_ptr<T> target,
+                 void (T::*method)()) {
+  return executor->Spawn(
+      [target = std::move(target), method]() { ((*target).*method)(); });
+}
+
+// A block of a CompressedOutputStream compressed in parallel
+struct PendingBlock {
+  PendingBlock(std::shared_ptr<Buffer> input, std::shared_ptr<Compressor> compressor,
+               MemoryPool* pool)
+      : input(std::move(input)), compressor(std::move(compressor)), pool(pool) {}
+
+  // Compress the block, unless another thread already does.  Both the compression
+  // task and the writer waiting for the block call this, so that the writer does
+  // not wait for a task which a saturated executor did not start yet.
+  void Run() {
+    if (claimed.exchange(true)) {
+      return;
+    }
+    auto result = CompressBlock(compressor.get(), *input, pool);
+    input.reset();
+    compressor.reset();
+    compressed.MarkFinished(std::move(result));
+  }
+
+  std::shared_ptr<Buffer> input;
+  std::shared_ptr<Compressor> compressor;
+  MemoryPool* pool;
+  std::atomic<bool> claimed{false};
+  Future<std::shared_ptr<Buffer>> compressed = Future<std::shared_ptr<Buffer>>::Make();
+};
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // CompressedOutputStream implementation
 
@@ -55,6 +135,23 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
+  Status InitParallel(Codec* codec, const ParallelCompressionOptions& options) {
+    if (options.block_size <= 0) {
+      return Status::Invalid("Compression block size must be strictly positive");
+    }
+    // Fail early if the codec cannot compress streams
+    RETURN_NOT_OK(codec->MakeCompressor());
+    codec_ = codec;
+    block_size_ = options.block_size;
+    executor_ = options.executor != nullptr ? options.executor
+                                            : ::arrow::internal::GetCpuThreadPool();
+    max_pending_blocks_ = options.max_pending_blocks > 0
+                              ? options.max_pending_blocks
+                              : std::max(executor_->GetCapacity(), 1);
+    is_open_ = true;
+    return Status::OK();
+  }
+
   Result<int64_t> Tell() const {
     std::lock_guard<std::mutex> guard(lock_);
     return total_pos_;
@@ -73,6 +170,9 @@ class CompressedOutputStream::Impl {
   Status Write(const void* data, int64_t nbytes) {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (codec_ != nullptr) {
+      return WriteBlocks(data, nbytes);
+    }
     auto input = reinterpret_cast<const uint8_t*>(data);
     while (nbytes > 0) {
       int64_t input_len = nbytes;
@@ -111,6 +211,12 @@ class CompressedOutputStream::Impl {
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (codec_ != nullptr) {
+      if (block_pos_ > 0) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+      return WriteCompressedBlocks(0);
+    }
     while (true) {
       // Flush compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -132,6 +238,14 @@ class CompressedOutputStream::Impl {
   }
 
   Status FinalizeCompression() {
+    if (codec_ != nullptr) {
+      // Always end with a block, so that an empty stream is still a valid
+      // compressed stream
+      if (block_pos_ > 0 || num_blocks_ == 0) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+      return WriteCompressedBlocks(0);
+    }
     while (true) {
       // Try to end compressor
       int64_t output_len = compressed_->size() - compressed_pos_;
@@ -170,6 +284,8 @@ class CompressedOutputStream::Impl {
 
     if (is_open_) {
       is_open_ = false;
+      // The compression tasks own the blocks they compress
+      pending_blocks_.clear();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -182,6 +298,63 @@ class CompressedOutputStream::Impl {
   }
 
  private:
+  Status WriteBlocks(const void* data, int64_t nbytes) {
+    auto input = reinterpret_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      if (block_ == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(block_, AllocateResizableBuffer(block_size_, pool_));
+        block_pos_ = 0;
+      }
+      const int64_t chunk_size = std::min(nbytes, block_size_ - block_pos_);
+      memcpy(block_->mutable_data() + block_pos_, input, chunk_size);
+      block_pos_ += chunk_size;
+      input += chunk_size;
+      nbytes -= chunk_size;
+      total_pos_ += chunk_size;
+      if (block_pos_ == block_size_) {
+        RETURN_NOT_OK(SubmitBlock());
+      }
+    }
+    return WriteCompressedBlocks(max_pending_blocks_);
+  }
+
+  // Start compressing the current block
+  Status SubmitBlock() {
+    std::shared_ptr<Buffer> input;
+    if (block_ != nullptr) {
+      RETURN_NOT_OK(block_->Resize(block_pos_, /*shrink_to_fit=*/false));
+      input = std::move(block_);
+    } else {
+      input = std::make_shared<Buffer>(nullptr, 0);
+    }
+    block_pos_ = 0;
+    ARROW_ASSIGN_OR_RAISE(auto compressor, codec_->MakeCompressor());
+    auto block =
+        std::make_shared<PendingBlock>(std::move(input), std::move(compressor), pool_);
+    pending_blocks_.push_back(block);
+    ++num_blocks_;
+    // If spawning fails, the block is compressed when written
+    ARROW_UNUSED(SpawnCall(executor_, block, &PendingBlock::Run));
+    return WriteCompressedBlocks(max_pending_blocks_);
+  }
+
+  // Write the compressed blocks in order, waiting until at most `max_pending`
+  // blocks remain
+  Status WriteCompressedBlocks(int max_pending) {
+    while (!pending_blocks_.empty()) {
+      const auto& block = pending_blocks_.front();
+      if (static_cast<int>(pending_blocks_.size()) > max_pending) {
+        block->Run();
+      } else if (!block->compressed.is_finished()) {
+        break;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto compressed, block->compressed.result());
+      RETURN_NOT_OK(raw_->Write(compressed));
+      pending_blocks_.pop_front();
+    }
+    return Status::OK();
+  }
+
   // Write 64 KB compressed data at a time
   static const int64_t kChunkSize = 64 * 1024;
 
@@ -194,6 +367,18 @@ class CompressedOutputStream::Impl {
   // Total number of bytes compressed
   int64_t total_pos_;
 
+  // Parallel compression (only if `codec_` is set)
+  Codec* codec_ = nullptr;
+  ::arrow::internal::Executor* executor_ = nullptr;
+  int64_t block_size_ = 0;
+  int max_pending_blocks_ = 0;
+  // The block being filled
+  std::shared_ptr<ResizableBuffer> block_;
+  int64_t block_pos_ = 0;
+  // The blocks being compressed or waiting to be written, in order
+  std::deque<std::shared_ptr<PendingBlock>> pending_blocks_;
+  int64_t num_blocks_ = 0;
+
   mutable std::mutex lock_;
 };
 
@@ -206,6 +391,16 @@ Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
   return res;
 }
 
+Result<std::shared_ptr<CompressedOutputStream>> CompressedOutputStream::Make(
+    util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+    const ParallelCompressionOptions& options, MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
+  res->impl_.reset(new Impl(pool, raw));
+  RETURN_NOT_OK(res->impl_->InitParallel(codec, options));
+  return res;
+}
+
 CompressedOutputStream::~CompressedOutputStream() { internal::CloseFromDestructor(this); }
 
 Status CompressedOutputStream::Close() { return impl_->Close(); }
@@ -227,7 +422,8 @@ std::shared_ptr<OutputStream> CompressedOutputStream::raw() const { return impl_
 // ----------------------------------------------------------------------
 // CompressedInputStream implementation
 
-class CompressedInputStream::Impl {
+class CompressedInputStream::Impl
+    : public std::enable_shared_from_this<CompressedInputStream::Impl> {
  public:
   Impl(MemoryPool* pool, const std::shared_ptr<InputStream>& raw)
       : pool_(pool),
@@ -245,9 +441,18 @@ class CompressedInputStream::Impl {
     return Status::OK();
   }
 
+  void InitReadahead(const DecompressionReadaheadOptions& options) {
+    executor_ = options.executor != nullptr ? options.executor
+                                            : ::arrow::internal::GetCpuThreadPool();
+    readahead_ = std::max(options.readahead, 1);
+    std::unique_lock<std::mutex> lock(readahead_mutex_);
+    MaybeStartProducer(&lock);
+  }
+
   Status Close() {
     if (is_open_) {
       is_open_ = false;
+      StopReadahead();
       return raw_->Close();
     } else {
       return Status::OK();
@@ -257,6 +462,7 @@ class CompressedInputStream::Impl {
   Status Abort() {
     if (is_open_) {
       is_open_ = false;
+      StopReadahead();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -386,6 +592,15 @@ class CompressedInputStream::Impl {
   }
 
   Result<int64_t> Read(int64_t nbytes, void* out) {
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                          readahead_ > 0 ? ReadFromReadahead(nbytes, out)
+                                         : ReadDecompressed(nbytes, out));
+    total_pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  // Read and decompress data from the raw stream
+  Result<int64_t> ReadDecompressed(int64_t nbytes, void* out) {
     auto* out_data = reinterpret_cast<uint8_t*>(out);
 
     int64_t total_read = 0;
@@ -403,7 +618,6 @@ class CompressedInputStream::Impl {
       ARROW_ASSIGN_OR_RAISE(decompressor_has_data, RefillDecompressed());
     }
 
-    total_pos_ += total_read;
     return total_read;
   }
 
@@ -419,6 +633,122 @@ class CompressedInputStream::Impl {
   const std::shared_ptr<InputStream>& raw() const { return raw_; }
 
  private:
+  // The state of the producer decompressing ahead of the reads.  Only one thread
+  // at a time, a producer task or a reader, decompresses.
+  enum class ProducerState { kIdle, kQueued, kRunning };
+
+  Result<std::shared_ptr<Buffer>> DecompressChunk() {
+    ARROW_ASSIGN_OR_RAISE(auto chunk, AllocateResizableBuffer(kDecompressSize, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto bytes_read,
+                          ReadDecompressed(kDecompressSize, chunk->mutable_data()));
+    RETURN_NOT_OK(chunk->Resize(bytes_read));
+    return std::shared_ptr<Buffer>(std::move(chunk));
+  }
+
+  // Must be called with the lock held
+  void PushChunk(Result<std::shared_ptr<Buffer>> chunk) {
+    // The end of the stream, or an error, is kept to be returned by all
+    // subsequent reads
+    if (!chunk.ok() || (*chunk)->size() == 0) {
+      producer_finished_ = true;
+    }
+    ready_chunks_.push_back(std::move(chunk));
+    readahead_cv_.notify_all();
+  }
+
+  // Start a producer task if more chunks should be decompressed
+  void MaybeStartProducer(std::unique_lock<std::mutex>* lock) {
+    if (producer_state_ != ProducerState::kIdle || producer_finished_ || stopping_ ||
+        static_cast<int>(ready_chunks_.size()) >= readahead_) {
+      return;
+    }
+    producer_state_ = ProducerState::kQueued;
+    lock->unlock();
+    auto st = SpawnCall(executor_, shared_from_this(), &Impl::RunProducer);
+    lock->lock();
+    if (!st.ok() && producer_state_ == ProducerState::kQueued) {
+      // Chunks will be decompressed by the reads
+      producer_state_ = ProducerState::kIdle;
+    }
+  }
+
+  void RunProducer() {
+    std::unique_lock<std::mutex> lock(readahead_mutex_);
+    // A reader may have taken over the queued producer
+    if (producer_state_ != ProducerState::kQueued) {
+      return;
+    }
+    producer_state_ = ProducerState::kRunning;
+    while (!producer_finished_ && !stopping_ &&
+           static_cast<int>(ready_chunks_.size()) < readahead_) {
+      lock.unlock();
+      auto chunk = DecompressChunk();
+      lock.lock();
+      PushChunk(std::move(chunk));
+    }
+    producer_state_ = ProducerState::kIdle;
+    readahead_cv_.notify_all();
+  }
+
+  Result<std::shared_ptr<Buffer>> NextChunk() {
+    std::unique_lock<std::mutex> lock(readahead_mutex_);
+    while (ready_chunks_.empty()) {
+      if (producer_state_ == ProducerState::kRunning) {
+        readahead_cv_.wait(lock);
+        continue;
+      }
+      // No producer is running, decompress the chunk ourselves rather than wait
+      // for a task which a saturated executor may not start soon
+      producer_state_ = ProducerState::kRunning;
+      lock.unlock();
+      auto chunk = DecompressChunk();
+      lock.lock();
+      PushChunk(std::move(chunk));
+      producer_state_ = ProducerState::kIdle;
+    }
+    auto chunk = ready_chunks_.front();
+    if (chunk.ok() && (*chunk)->size() > 0) {
+      ready_chunks_.pop_front();
+    }
+    MaybeStartProducer(&lock);
+    return chunk;
+  }
+
+  Result<int64_t> ReadFromReadahead(int64_t nbytes, void* out) {
+    auto* out_data = reinterpret_cast<uint8_t*>(out);
+    int64_t total_read = 0;
+    while (total_read < nbytes) {
+      if (current_chunk_ && current_chunk_pos_ < current_chunk_->size()) {
+        const int64_t read_bytes =
+            std::min(nbytes - total_read, current_chunk_->size() - current_chunk_pos_);
+        memcpy(out_data + total_read, current_chunk_->data() + current_chunk_pos_,
+               read_bytes);
+        current_chunk_pos_ += read_bytes;
+        total_read += read_bytes;
+        continue;
+      }
+      ARROW_ASSIGN_OR_RAISE(auto chunk, NextChunk());
+      if (chunk->size() == 0) {
+        // EOF
+        break;
+      }
+      current_chunk_ = std::move(chunk);
+      current_chunk_pos_ = 0;
+    }
+    return total_read;
+  }
+
+  void StopReadahead() {
+    if (readahead_ == 0) {
+      return;
+    }
+    std::unique_lock<std::mutex> lock(readahead_mutex_);
+    stopping_ = true;
+    readahead_cv_.wait(lock, [&] { return producer_state_ != ProducerState::kRunning; });
+    ready_chunks_.clear();
+    current_chunk_.reset();
+  }
+
   int64_t compressed_buffer_available() const {
     return compressed_ ? compressed_->size() - compressed_pos_ : 0;
   }
@@ -452,6 +782,21 @@ class CompressedInputStream::Impl {
   bool fresh_decompressor_;
   // Total number of bytes decompressed
   int64_t total_pos_;
+
+  // Decompression ahead of the reads (only if `readahead_` is non-zero)
+  ::arrow::internal::Executor* executor_ = nullptr;
+  int readahead_ = 0;
+  std::mutex readahead_mutex_;
+  std::condition_variable readahead_cv_;
+  ProducerState producer_state_ = ProducerState::kIdle;
+  // Decompressed chunks ready to be read, ending with an empty chunk at the end
+  // of the stream or with an error
+  std::deque<Result<std::shared_ptr<Buffer>>> ready_chunks_;
+  bool producer_finished_ = false;
+  bool stopping_ = false;
+  // The chunk being read
+  std::shared_ptr<Buffer> current_chunk_;
+  int64_t current_chunk_pos_ = 0;
 };
 
 Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
@@ -463,6 +808,17 @@ Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
   return res;
 }
 
+Result<std::shared_ptr<CompressedInputStream>> CompressedInputStream::Make(
+    Codec* codec, const std::shared_ptr<InputStream>& raw,
+    const DecompressionReadaheadOptions& options, MemoryPool* pool) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedInputStream> res(new CompressedInputStream);
+  res->impl_.reset(new Impl(pool, raw));
+  RETURN_NOT_OK(res->impl_->Init(codec));
+  res->impl_->InitReadahead(options);
+  return res;
+}
+
 CompressedInputStream::~CompressedInputStream() { internal::CloseFromDestructor(this); }
 
 Status CompressedInputStream::DoClose() { return impl_->Close(); }
@@ -19,11 +19,13 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -39,6 +41,26 @@ class Codec;
 
 namespace io {
 
+/// \brief Options for compressing the data of a CompressedOutputStream in parallel
+struct ARROW_EXPORT ParallelCompressionOptions {
+  /// The executor compressing the blocks, or null for the CPU thread pool
+  ::arrow::internal::Executor* executor = NULLPTR;
+  /// The number of uncompressed bytes compressed as an independent stream
+  int64_t block_size = 4 * 1024 * 1024;
+  /// The maximum number of blocks being compressed, or waiting to be written,
+  /// at a time, or 0 for the capacity of the executor
+  int max_pending_blocks = 0;
+};
+
+/// \brief Options for decompressing the data of a CompressedInputStream ahead
+/// of the reads
+struct ARROW_EXPORT DecompressionReadaheadOptions {
+  /// The executor decompressing the data, or null for the CPU thread pool
+  ::arrow::internal::Executor* executor = NULLPTR;
+  /// The number of decompressed chunks of about 1 MB to keep ready ahead of the reads
+  int readahead = 4;
+};
+
 class ARROW_EXPORT CompressedOutputStream : public OutputStream {
  public:
   ~CompressedOutputStream() override;
@@ -51,6 +73,21 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
       util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed output stream compressing blocks in parallel.
+  ///
+  /// Each block of `options.block_size` bytes (and the data given before each
+  /// Flush() call) is compressed as an independent stream on `options.executor`,
+  /// and the compressed streams are written in order.  The output is therefore a
+  /// concatenation of compressed streams, which CompressedInputStream and the
+  /// zstd, lz4 and gzip command-line tools decompress as a whole.
+  ///
+  /// The codec must be capable of streaming compression, and must outlive the
+  /// returned stream.
+  static Result<std::shared_ptr<CompressedOutputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<OutputStream>& raw,
+      const ParallelCompressionOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   // OutputStream interface
 
   /// \brief Close the compressed output stream.  This implicitly closes the
@@ -92,6 +129,16 @@ class ARROW_EXPORT CompressedInputStream
       util::Codec* codec, const std::shared_ptr<InputStream>& raw,
       MemoryPool* pool = default_memory_pool());
 
+  /// \brief Create a compressed input stream decompressing ahead of the reads.
+  ///
+  /// The raw stream is read and decompressed on `options.executor`, up to
+  /// `options.readahead` chunks ahead of the reads, so that decompression overlaps
+  /// with the processing of the data read.
+  static Result<std::shared_ptr<CompressedInputStream>> Make(
+      util::Codec* codec, const std::shared_ptr<InputStream>& raw,
+      const DecompressionReadaheadOptions& options,
+      MemoryPool* pool = default_memory_pool());
+
   // InputStream interface
 
   bool closed() const override;
@@ -117,7 +164,7 @@ class ARROW_EXPORT CompressedInputStream
   Result<std::shared_ptr<Buffer>> DoRead(int64_t nbytes);
 
   class ARROW_NO_EXPORT Impl;
-  std::unique_ptr<Impl> impl_;
+  std::shared_ptr<Impl> impl_;
 };
 
 }  // namespace io
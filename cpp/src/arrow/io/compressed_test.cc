@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <iterator>
 #include <memory>
+#include <optional>
 #include <random>
 #include <string>
 #include <utility>
@@ -80,11 +81,19 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
   return std::move(compressed);
 }
 
-Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                int64_t* stream_pos, std::vector<uint8_t>* out) {
+Status RunCompressedInputStream(
+    Codec* codec, std::shared_ptr<Buffer> compressed, int64_t* stream_pos,
+    std::vector<uint8_t>* out,
+    std::optional<DecompressionReadaheadOptions> readahead_options = std::nullopt) {
   // Create compressed input stream
   auto buffer_reader = std::make_shared<BufferReader>(compressed);
-  ARROW_ASSIGN_OR_RAISE(auto stream, CompressedInputStream::Make(codec, buffer_reader));
+  std::shared_ptr<CompressedInputStream> stream;
+  if (readahead_options.has_value()) {
+    ARROW_ASSIGN_OR_RAISE(stream, CompressedInputStream::Make(codec, buffer_reader,
+                                                              *readahead_options));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(stream, CompressedInputStream::Make(codec, buffer_reader));
+  }
 
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
@@ -154,6 +163,37 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
   ASSERT_EQ(decompressed, data);
 }
 
+void CheckParallelCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                         bool do_flush) {
+  ParallelCompressionOptions options;
+  options.block_size = 10000;
+  options.max_pending_blocks = 3;
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto stream,
+                       CompressedOutputStream::Make(codec, buffer_writer, options));
+
+  const uint8_t* input = data.data();
+  int64_t input_len = data.size();
+  const int64_t chunk_size = 1111;
+  while (input_len > 0) {
+    int64_t nbytes = std::min(chunk_size, input_len);
+    ASSERT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    if (do_flush) {
+      ASSERT_OK(stream->Flush());
+    }
+  }
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(data.size()), stream->Tell());
+  ASSERT_OK(stream->Close());
+
+  // The blocks are independent compressed streams, decompress them as a whole
+  ASSERT_OK_AND_ASSIGN(auto compressed, buffer_writer->Finish());
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+}
+
 class CompressedInputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -237,6 +277,43 @@ TEST_P(CompressedInputStreamTest, ConcatenatedStreams) {
   ASSERT_EQ(decompressed, expected);
 }
 
+TEST_P(CompressedInputStreamTest, Readahead) {
+  auto codec = MakeCodec();
+  auto data1 = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto data2 = MakeRandomData(RANDOM_DATA_SIZE);
+  std::vector<uint8_t> expected;
+  std::copy(data1.begin(), data1.end(), std::back_inserter(expected));
+  std::copy(data2.begin(), data2.end(), std::back_inserter(expected));
+  ASSERT_OK_AND_ASSIGN(auto concatenated,
+                       ConcatenateBuffers({CompressDataOneShot(codec.get(), data1),
+                                           CompressDataOneShot(codec.get(), data2)}));
+
+  for (int readahead : {1, 3}) {
+    ARROW_SCOPED_TRACE("readahead = ", readahead);
+    DecompressionReadaheadOptions options;
+    options.readahead = readahead;
+    std::vector<uint8_t> decompressed;
+    int64_t stream_pos = -1;
+    ASSERT_OK(RunCompressedInputStream(codec.get(), concatenated, &stream_pos,
+                                       &decompressed, options));
+    ASSERT_EQ(decompressed, expected);
+    ASSERT_EQ(stream_pos, static_cast<int64_t>(expected.size()));
+
+    auto truncated = SliceBuffer(concatenated, 0, concatenated->size() - 3);
+    ASSERT_RAISES(IOError, RunCompressedInputStream(codec.get(), truncated, nullptr,
+                                                    &decompressed, options));
+  }
+
+  // Closing the stream while decompressing ahead
+  auto buffer_reader = std::make_shared<BufferReader>(concatenated);
+  ASSERT_OK_AND_ASSIGN(auto stream, CompressedInputStream::Make(
+                                        codec.get(), buffer_reader,
+                                        DecompressionReadaheadOptions{}));
+  ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(10));
+  ASSERT_EQ(buf->ToString(), std::string(data1.begin(), data1.begin() + 10));
+  ASSERT_OK(stream->Close());
+}
+
 TEST_P(CompressedOutputStreamTest, CompressibleData) {
   auto codec = MakeCodec();
   auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
@@ -253,6 +330,22 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, Parallel) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+
+  CheckParallelCompressedOutputStream(codec.get(), data, false /* do_flush */);
+  CheckParallelCompressedOutputStream(codec.get(), MakeRandomData(RANDOM_DATA_SIZE),
+                                      true /* do_flush */);
+  CheckParallelCompressedOutputStream(codec.get(), {}, false /* do_flush */);
+
+  ParallelCompressionOptions options;
+  options.block_size = 0;
+  ASSERT_OK_AND_ASSIGN(auto buffer_writer, BufferOutputStream::Create());
+  ASSERT_RAISES(Invalid,
+                CompressedOutputStream::Make(codec.get(), buffer_writer, options));
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -53,6 +53,8 @@
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/counters.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -219,10 +221,48 @@ class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
 
-  Status Open(const std::string& path) { return OpenReadable(path); }
+  Status Open(const std::string& path, bool direct_io) {
+    RETURN_NOT_OK(OpenReadable(path));
+    if (direct_io) {
+      auto maybe_alignment = ::arrow::internal::FileEnableDirectIO(fd_.fd());
+      // Keep reading through the page cache if direct I/O is unsupported
+      if (!maybe_alignment.status().IsNotImplemented()) {
+        ARROW_ASSIGN_OR_RAISE(direct_io_alignment_, maybe_alignment);
+      }
+    }
+    return Status::OK();
+  }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (direct_io_alignment_ == 0) {
+      return OSFile::Read(nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadBuffer(nbytes));
+    std::memcpy(out, buffer->data(), buffer->size());
+    return buffer->size();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (direct_io_alignment_ == 0 ||
+        (position % direct_io_alignment_ == 0 && nbytes % direct_io_alignment_ == 0 &&
+         reinterpret_cast<uintptr_t>(out) % direct_io_alignment_ == 0)) {
+      return OSFile::ReadAt(position, nbytes, out);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadBufferAt(position, nbytes));
+    std::memcpy(out, buffer->data(), buffer->size());
+    return buffer->size();
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
+    if (direct_io_alignment_ > 0) {
+      RETURN_NOT_OK(CheckClosed());
+      RETURN_NOT_OK(CheckPositioned());
+      ARROW_ASSIGN_OR_RAISE(auto position, Tell());
+      ARROW_ASSIGN_OR_RAISE(auto buffer, DirectReadAt(position, nbytes));
+      RETURN_NOT_OK(::arrow::internal::FileSeek(fd_.fd(), position + buffer->size()));
+      return buffer;
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
@@ -234,6 +274,12 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
+    if (direct_io_alignment_ > 0) {
+      RETURN_NOT_OK(CheckClosed());
+      RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+      need_seeking_.store(true);
+      return DirectReadAt(position, nbytes);
+    }
     ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
@@ -286,7 +332,25 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
  private:
+  // Read the aligned range covering the requested one, and return the slice of
+  // it holding the requested bytes
+  Result<std::shared_ptr<Buffer>> DirectReadAt(int64_t position, int64_t nbytes) {
+    const int64_t start = position - position % direct_io_alignment_;
+    const int64_t length =
+        bit_util::RoundUp(position + nbytes, direct_io_alignment_) - start;
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer,
+                          AllocateBuffer(length, direct_io_alignment_, pool_));
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
+                          ::arrow::internal::FileReadAt(
+                              fd_.fd(), buffer->mutable_data(), start, length));
+    const int64_t offset = position - start;
+    return SliceBuffer(std::move(buffer), offset,
+                       std::clamp<int64_t>(bytes_read - offset, 0, nbytes));
+  }
+
   MemoryPool* pool_;
+  // Non-zero if reads bypass the page cache and must be aligned to this
+  int64_t direct_io_alignment_ = 0;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -294,9 +358,10 @@ ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(
 ReadableFile::~ReadableFile() { internal::CloseFromDestructor(this); }
 
 Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(const std::string& path,
-                                                         MemoryPool* pool) {
+                                                         MemoryPool* pool,
+                                                         bool direct_io) {
   auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
-  RETURN_NOT_OK(file->impl_->Open(path));
+  RETURN_NOT_OK(file->impl_->Open(path, direct_io));
   return file;
 }
 
@@ -316,20 +381,37 @@ Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
 
 Result<int64_t> ReadableFile::DoTell() const { return impl_->Tell(); }
 
+namespace {
+
+void CountBytesRead(int64_t nbytes) {
+  static util::Counter* const bytes_read = util::GetCounter("io.file.read.bytes");
+  bytes_read->Add(nbytes);
+}
+
+}  // namespace
+
 Result<int64_t> ReadableFile::DoRead(int64_t nbytes, void* out) {
-  return impl_->Read(nbytes, out);
+  ARROW_ASSIGN_OR_RAISE(auto bytes_read, impl_->Read(nbytes, out));
+  CountBytesRead(bytes_read);
+  return bytes_read;
 }
 
 Result<int64_t> ReadableFile::DoReadAt(int64_t position, int64_t nbytes, void* out) {
-  return impl_->ReadAt(position, nbytes, out);
+  ARROW_ASSIGN_OR_RAISE(auto bytes_read, impl_->ReadAt(position, nbytes, out));
+  CountBytesRead(bytes_read);
+  return bytes_read;
 }
 
 Result<std::shared_ptr<Buffer>> ReadableFile::DoReadAt(int64_t position, int64_t nbytes) {
-  return impl_->ReadBufferAt(position, nbytes);
+  ARROW_ASSIGN_OR_RAISE(auto buffer, impl_->ReadBufferAt(position, nbytes));
+  CountBytesRead(buffer->size());
+  return buffer;
 }
 
 Result<std::shared_ptr<Buffer>> ReadableFile::DoRead(int64_t nbytes) {
-  return impl_->ReadBuffer(nbytes);
+  ARROW_ASSIGN_OR_RAISE(auto buffer, impl_->ReadBuffer(nbytes));
+  CountBytesRead(buffer->size());
+  return buffer;
 }
 
 Result<int64_t> ReadableFile::DoGetSize() { return impl_->size(); }
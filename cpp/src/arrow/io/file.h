@@ -93,9 +93,17 @@ class ARROW_EXPORT ReadableFile
   /// \brief Open a local file for reading
   /// \param[in] path with UTF8 encoding
   /// \param[in] pool a MemoryPool for memory allocations
+  /// \param[in] direct_io whether reads bypass the OS page cache
   /// \return ReadableFile instance
+  ///
+  /// With direct_io, large one-shot reads neither evict other data from the page
+  /// cache nor get copied through it.  Where direct I/O requires aligned reads,
+  /// each read is widened to aligned bounds into a buffer allocated from `pool`,
+  /// and the buffers returned by ReadAt() are slices of it.  If the platform or
+  /// file system does not support direct I/O, reads go through the page cache.
   static Result<std::shared_ptr<ReadableFile>> Open(
-      const std::string& path, MemoryPool* pool = default_memory_pool());
+      const std::string& path, MemoryPool* pool = default_memory_pool(),
+      bool direct_io = false);
 
   /// \brief Open a local file for reading
   /// \param[in] fd file descriptor
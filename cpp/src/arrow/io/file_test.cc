@@ -377,6 +377,47 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
 }
 
+TEST_F(TestReadableFile, DirectIO) {
+  // Reads go through the page cache where direct I/O is unsupported, so this
+  // mostly checks the alignment handling where it is supported
+  std::string data;
+  for (int i = 0; i < 10000; ++i) {
+    data.push_back(static_cast<char>(i % 127));
+  }
+  {
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+  ASSERT_OK_AND_ASSIGN(file_, ReadableFile::Open(path_, default_memory_pool(),
+                                                 /*direct_io=*/true));
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(4000, 5000));
+  ASSERT_EQ(buffer->ToString(), data.substr(4000, 5000));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->ReadAt(8192, 4096));
+  ASSERT_EQ(buffer->ToString(), data.substr(8192));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->ReadAt(20000, 10));
+  ASSERT_EQ(buffer->size(), 0);
+
+  std::vector<uint8_t> out(6000);
+  ASSERT_OK_AND_EQ(6000, file_->ReadAt(1, 6000, out.data()));
+  ASSERT_EQ(std::string(out.begin(), out.end()), data.substr(1, 6000));
+
+  ASSERT_OK(file_->Seek(0));
+  ASSERT_OK_AND_EQ(3000, file_->Read(3000, out.data()));
+  ASSERT_EQ(std::string(out.begin(), out.begin() + 3000), data.substr(0, 3000));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->Read(3000));
+  ASSERT_EQ(buffer->ToString(), data.substr(3000, 3000));
+  ASSERT_OK_AND_EQ(6000, file_->Tell());
+  ASSERT_OK(file_->Seek(9000));
+  ASSERT_OK_AND_ASSIGN(buffer, file_->Read(2000));
+  ASSERT_EQ(buffer->ToString(), data.substr(9000));
+
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1));
+  ASSERT_RAISES(Invalid, file_->ReadAt(1, -1, out.data()));
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
+}
+
 TEST_F(TestReadableFile, ReadAsync) {
   MakeTestFile();
   OpenFile();
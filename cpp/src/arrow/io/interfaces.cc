@@ -65,6 +65,10 @@ Status SetIOThreadPoolCapacity(int threads) {
   return internal::GetIOThreadPool()->SetCapacity(threads);
 }
 
+Status SetIOThreadPoolAffinity(const CpuAffinity& affinity) {
+  return internal::GetIOThreadPool()->SetCpuAffinity(affinity);
+}
+
 FileInterface::~FileInterface() = default;
 
 Future<> FileInterface::CloseAsync() {
@@ -89,11 +89,24 @@ struct ARROW_EXPORT IOContext {
 
   StopToken stop_token() const { return stop_token_; }
 
+  /// The metrics the IO made with this context is recorded into, or null
+  const std::shared_ptr<IOMetrics>& metrics() const { return metrics_; }
+
+  void set_metrics(std::shared_ptr<IOMetrics> metrics) { metrics_ = std::move(metrics); }
+
+  /// The priority of the IO made with this context, forwarded to executor task
+  /// submissions.  The lower, the more urgent.
+  int32_t priority() const { return priority_; }
+
+  void set_priority(int32_t priority) { priority_ = priority; }
+
  private:
   MemoryPool* pool_;
   ::arrow::internal::Executor* executor_;
   int64_t external_id_;
   StopToken stop_token_;
+  std::shared_ptr<IOMetrics> metrics_;
+  int32_t priority_ = 0;
 };
 
 class ARROW_EXPORT FileInterface : public std::enable_shared_from_this<FileInterface> {
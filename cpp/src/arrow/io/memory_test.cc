@@ -20,11 +20,13 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <ostream>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -33,6 +35,8 @@
 #include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/metrics.h"
+#include "arrow/io/scheduler.h"
 #include "arrow/io/slow.h"
 #include "arrow/io/transform.h"
 #include "arrow/io/util_internal.h"
@@ -47,6 +51,7 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -943,6 +948,297 @@ TEST(CacheOptions, Basics) {
   check(CacheOptions::MakeFromNetworkMetrics(5, 500, .75, 5), 2.5, 5);
 }
 
+TEST(StorageMetrics, Basics) {
+  StorageMetrics metrics;
+  // TTFB = 1 ms, BW = 1 MiB/s
+  auto record = [&](int64_t nbytes) {
+    metrics.RecordRead(nbytes, 1e-3 + nbytes / (1024.0 * 1024.0));
+  };
+  for (int64_t i = 1; i < StorageMetrics::kMinReads; ++i) {
+    record(i * 1024);
+  }
+  ASSERT_EQ(metrics.num_reads(), StorageMetrics::kMinReads - 1);
+  ASSERT_FALSE(metrics.GetEstimates().has_value());
+  ASSERT_EQ(metrics.TuneCacheOptions(CacheOptions::Defaults()), CacheOptions::Defaults());
+
+  record(StorageMetrics::kMinReads * 1024);
+  auto estimates = metrics.GetEstimates();
+  ASSERT_TRUE(estimates.has_value());
+  ASSERT_NEAR(estimates->time_to_first_byte_seconds, 1e-3, 1e-9);
+  ASSERT_NEAR(estimates->bandwidth_bytes_per_second, 1024.0 * 1024.0, 1.0);
+
+  // We expect hole_size_limit = 1049 bytes and range_size_limit = 9 * 1049 bytes,
+  // other options being kept
+  auto tuned = metrics.TuneCacheOptions(CacheOptions::LazyDefaults());
+  ASSERT_EQ(tuned.hole_size_limit, 1049);
+  ASSERT_EQ(tuned.range_size_limit, 9441);
+  ASSERT_TRUE(tuned.lazy);
+  ASSERT_EQ(tuned.prefetch_limit, CacheOptions::LazyDefaults().prefetch_limit);
+
+  // Reads of a single size cannot tell latency from transfer time
+  StorageMetrics same_size;
+  for (int64_t i = 0; i < 2 * StorageMetrics::kMinReads; ++i) {
+    same_size.RecordRead(4096, 0.01);
+  }
+  ASSERT_FALSE(same_size.GetEstimates().has_value());
+}
+
+// A reader whose asynchronous reads only complete when the test finishes them
+class ManualAsyncBufferReader : public BufferReader {
+ public:
+  using BufferReader::BufferReader;
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext&, int64_t position,
+                                            int64_t nbytes) override {
+    auto future = Future<std::shared_ptr<Buffer>>::Make();
+    pending_.emplace_back(future, ReadAt(position, nbytes));
+    ++num_reads_;
+    return future;
+  }
+
+  void FinishReads() {
+    auto pending = std::move(pending_);
+    pending_.clear();
+    for (auto& [future, result] : pending) {
+      future.MarkFinished(std::move(result));
+    }
+  }
+
+  int64_t num_reads() const { return num_reads_; }
+
+ private:
+  std::vector<std::pair<Future<std::shared_ptr<Buffer>>, Result<std::shared_ptr<Buffer>>>>
+      pending_;
+  int64_t num_reads_ = 0;
+};
+
+TEST(RangeReadCache, StorageMetrics) {
+  std::string data(60000, '\0');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>('a' + i % 26);
+  }
+  auto file = std::make_shared<ManualAsyncBufferReader>(Buffer::FromString(data));
+  ASSERT_OK_AND_ASSIGN(auto executor, ::arrow::internal::ThreadPool::Make(1));
+
+  // TTFB = 1 ms, BW = 1 MiB/s: holes of up to 1049 bytes are coalesced into ranges
+  // of up to 9441 bytes, and a single I/O thread keeps one such range in flight
+  auto metrics = std::make_shared<StorageMetrics>();
+  for (int64_t i = 1; i <= StorageMetrics::kMinReads; ++i) {
+    metrics->RecordRead(i * 1024, 1e-3 + i / 1024.0);
+  }
+  CacheOptions options = CacheOptions::Defaults();
+  options.storage_metrics = metrics;
+  internal::ReadRangeCache cache(file, IOContext(default_memory_pool(), executor.get()),
+                                 options);
+
+  // Ten ranges of 4000 bytes separated by holes of 1000 bytes, coalesced in pairs
+  std::vector<ReadRange> ranges;
+  for (int64_t offset = 0; offset < 50000; offset += 5000) {
+    ranges.push_back({offset, 4000});
+  }
+  ASSERT_OK(cache.Cache(ranges));
+  // Reading stops once the first two coalesced ranges exceed the limit
+  ASSERT_EQ(file->num_reads(), 2);
+  file->FinishReads();
+  ASSERT_EQ(metrics->num_reads(), StorageMetrics::kMinReads + 2);
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, cache.Read(ranges[0]));
+  ASSERT_EQ(buffer->ToString(), data.substr(0, 4000));
+  ASSERT_EQ(file->num_reads(), 4);
+  file->FinishReads();
+
+  ASSERT_FINISHES_OK(cache.WaitFor({ranges[5]}));
+  ASSERT_EQ(file->num_reads(), 5);
+  file->FinishReads();
+  ASSERT_EQ(metrics->num_reads(), StorageMetrics::kMinReads + 5);
+
+  ASSERT_OK_AND_ASSIGN(buffer, cache.Read(ranges[9]));
+  ASSERT_EQ(buffer->ToString(), data.substr(45000, 4000));
+  ASSERT_EQ(file->num_reads(), 5);
+}
+
+TEST(RangeReadCache, MemoryLimit) {
+  std::string data(100, '\0');
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<char>('a' + i % 26);
+  }
+  auto file = std::make_shared<ManualAsyncBufferReader>(Buffer::FromString(data));
+
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 1;
+  options.range_size_limit = 100;
+  options.memory_limit = 25;
+  internal::ReadRangeCache cache(file, {}, options);
+
+  std::vector<ReadRange> ranges = {{0, 10}, {20, 10}, {40, 10}, {60, 10}};
+  ASSERT_OK(cache.Cache(ranges));
+  // A third range would exceed the limit
+  ASSERT_EQ(file->num_reads(), 2);
+  file->FinishReads();
+
+  ASSERT_OK_AND_ASSIGN(auto first, cache.Read(ranges[0]));
+  ASSERT_EQ(file->num_reads(), 2);
+  ASSERT_OK(cache.Release({ranges[0]}));
+  ASSERT_EQ(file->num_reads(), 3);
+  // Ranges may also be released without being read
+  ASSERT_OK(cache.Release({ranges[1]}));
+  ASSERT_EQ(file->num_reads(), 4);
+  file->FinishReads();
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, cache.Read(ranges[3]));
+  ASSERT_EQ(buffer->ToString(), data.substr(60, 10));
+  // Released ranges are read again from the file, and returned buffers stay valid
+  ASSERT_OK_AND_ASSIGN(buffer, cache.Read(ranges[0]));
+  ASSERT_EQ(buffer->ToString(), data.substr(0, 10));
+  ASSERT_EQ(first->ToString(), data.substr(0, 10));
+  ASSERT_FINISHES_OK(cache.WaitFor({ranges[2]}));
+  ASSERT_EQ(file->num_reads(), 4);
+
+  std::vector<ReadRange> uncached = {{5, 20}};
+  ASSERT_RAISES(Invalid, cache.Release(uncached));
+}
+
+TEST(RangeReadCache, ReleaseCoalesced) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+  auto file = std::make_shared<CountingBufferReader>(Buffer::FromString(data));
+  internal::ReadRangeCache cache(file, {}, CacheOptions::LazyDefaults());
+
+  std::vector<ReadRange> ranges = {{1, 2}, {5, 3}};
+  ASSERT_OK(cache.Cache(ranges));
+  ASSERT_OK(cache.Release({ranges[0]}));
+  // The coalesced range is kept until all the ranges within it are released
+  ASSERT_OK_AND_ASSIGN(auto buffer, cache.Read(ranges[1]));
+  ASSERT_EQ(buffer->ToString(), "fgh");
+  ASSERT_EQ(file->read_count(), 1);
+  ASSERT_OK(cache.Release({ranges[1]}));
+  ASSERT_OK_AND_ASSIGN(buffer, cache.Read(ranges[0]));
+  ASSERT_EQ(buffer->ToString(), "bc");
+  ASSERT_EQ(file->read_count(), 1);
+}
+
+TEST(IOMetrics, RecordOperation) {
+  IOMetrics metrics;
+  metrics.RecordOperation(IOMetrics::Operation::kRead, 1.5e-6, 10);
+  metrics.RecordOperation(IOMetrics::Operation::kRead, 3e-6, 20);
+  metrics.RecordOperation(IOMetrics::Operation::kRead, 1e-3, 0, /*error=*/true);
+  metrics.RecordRetry();
+
+  auto stats = metrics.GetStats(IOMetrics::Operation::kRead);
+  ASSERT_EQ(stats.count, 3);
+  ASSERT_EQ(stats.errors, 1);
+  ASSERT_EQ(stats.bytes, 30);
+  ASSERT_NEAR(stats.total_seconds, 1.0045e-3, 1e-8);
+  // The latencies fall in the [1, 2), [2, 4) and [512, 1024) microsecond buckets
+  ASSERT_EQ(stats.latency_histogram[1], 1);
+  ASSERT_EQ(stats.latency_histogram[2], 1);
+  ASSERT_EQ(stats.latency_histogram[10], 1);
+  ASSERT_EQ(stats.LatencyQuantile(0.0), 2e-6);
+  ASSERT_EQ(stats.LatencyQuantile(0.5), 4e-6);
+  ASSERT_EQ(stats.LatencyQuantile(1.0), 1024e-6);
+  ASSERT_EQ(metrics.GetStats(IOMetrics::Operation::kWrite).count, 0);
+  ASSERT_EQ(metrics.GetStats(IOMetrics::Operation::kWrite).LatencyQuantile(0.5), 0);
+  ASSERT_EQ(metrics.retries(), 1);
+
+  auto repr = metrics.ToString();
+  ASSERT_NE(repr.find("read: count=3 errors=1 bytes=30"), std::string::npos) << repr;
+  ASSERT_EQ(repr.find("write:"), std::string::npos) << repr;
+  ASSERT_NE(repr.find("retries: 1"), std::string::npos) << repr;
+
+  metrics.Reset();
+  ASSERT_EQ(metrics.GetStats(IOMetrics::Operation::kRead).count, 0);
+  ASSERT_EQ(metrics.GetStats(IOMetrics::Operation::kRead).latency_histogram[1], 0);
+  ASSERT_EQ(metrics.retries(), 0);
+}
+
+TEST(IOMetrics, WrapFiles) {
+  auto metrics = std::make_shared<IOMetrics>();
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  std::shared_ptr<RandomAccessFile> reader =
+      std::make_shared<BufferReader>(Buffer::FromString(data));
+  auto file = internal::WrapWithMetrics(reader, metrics);
+  ASSERT_OK_AND_ASSIGN(auto buffer, file->ReadAt(2, 3));
+  ASSERT_EQ(buffer->ToString(), "cde");
+  ASSERT_OK_AND_ASSIGN(buffer, file->Read(4));
+  ASSERT_EQ(buffer->ToString(), "abcd");
+  ASSERT_RAISES(Invalid, file->ReadAt(-1, 3));
+  auto stats = metrics->GetStats(IOMetrics::Operation::kRead);
+  ASSERT_EQ(stats.count, 3);
+  ASSERT_EQ(stats.errors, 1);
+  ASSERT_EQ(stats.bytes, 7);
+
+  // Asynchronous reads are also recorded into the metrics of the IOContext
+  // they are issued with
+  auto context_metrics = std::make_shared<IOMetrics>();
+  IOContext io_context;
+  io_context.set_metrics(context_metrics);
+  ASSERT_FINISHES_OK_AND_ASSIGN(buffer, file->ReadAsync(io_context, 10, 5));
+  ASSERT_EQ(buffer->ToString(), "klmno");
+  auto futures = file->ReadManyAsync(io_context, {{0, 1}, {1, 2}});
+  for (auto& future : futures) {
+    ASSERT_FINISHES_OK(future);
+  }
+  ASSERT_EQ(metrics->GetStats(IOMetrics::Operation::kRead).count, 6);
+  ASSERT_EQ(metrics->GetStats(IOMetrics::Operation::kRead).bytes, 15);
+  ASSERT_EQ(context_metrics->GetStats(IOMetrics::Operation::kRead).count, 3);
+  ASSERT_EQ(context_metrics->GetStats(IOMetrics::Operation::kRead).bytes, 8);
+
+  // The same metrics are not counted twice
+  io_context.set_metrics(metrics);
+  ASSERT_FINISHES_OK(file->ReadAsync(io_context, 0, 1));
+  ASSERT_EQ(metrics->GetStats(IOMetrics::Operation::kRead).count, 7);
+
+  std::shared_ptr<InputStream> stream = internal::WrapWithMetrics(
+      std::static_pointer_cast<InputStream>(
+          std::make_shared<BufferReader>(Buffer::FromString(data))),
+      metrics);
+  ASSERT_OK_AND_ASSIGN(buffer, stream->Read(30));
+  ASSERT_EQ(buffer->size(), 26);
+  ASSERT_EQ(metrics->GetStats(IOMetrics::Operation::kRead).bytes, 42);
+
+  ASSERT_OK_AND_ASSIGN(auto sink, BufferOutputStream::Create());
+  auto out = internal::WrapWithMetrics(std::static_pointer_cast<OutputStream>(sink),
+                                       metrics);
+  ASSERT_OK(out->Write("abc", 3));
+  ASSERT_OK(out->Write(Buffer::FromString("de")));
+  ASSERT_OK(out->Close());
+  ASSERT_RAISES(IOError, out->Write("f", 1));
+  stats = metrics->GetStats(IOMetrics::Operation::kWrite);
+  ASSERT_EQ(stats.count, 4);
+  ASSERT_EQ(stats.errors, 1);
+  ASSERT_EQ(stats.bytes, 5);
+  ASSERT_OK_AND_ASSIGN(buffer, sink->Finish());
+  ASSERT_EQ(buffer->ToString(), "abcde");
+
+  // Without metrics, files are returned as is
+  ASSERT_EQ(internal::WrapWithMetrics(reader, nullptr), reader);
+}
+
+TEST(IOMetrics, OpenWithMetrics) {
+  auto metrics = std::make_shared<IOMetrics>();
+  IOContext io_context;
+  auto open = [&]() -> Result<std::shared_ptr<RandomAccessFile>> {
+    return std::make_shared<BufferReader>(Buffer::FromString("abc"));
+  };
+  ASSERT_OK_AND_ASSIGN(auto file,
+                       internal::OpenWithMetrics<RandomAccessFile>(io_context, open));
+  ASSERT_NE(dynamic_cast<BufferReader*>(file.get()), nullptr);
+
+  io_context.set_metrics(metrics);
+  ASSERT_OK_AND_ASSIGN(file,
+                       internal::OpenWithMetrics<RandomAccessFile>(io_context, open));
+  ASSERT_EQ(dynamic_cast<BufferReader*>(file.get()), nullptr);
+  ASSERT_OK(file->Read(2));
+  auto fail = []() -> Result<std::shared_ptr<RandomAccessFile>> {
+    return Status::IOError("cannot open");
+  };
+  ASSERT_RAISES(IOError, internal::OpenWithMetrics<RandomAccessFile>(io_context, fail));
+  auto stats = metrics->GetStats(IOMetrics::Operation::kOpen);
+  ASSERT_EQ(stats.count, 2);
+  ASSERT_EQ(stats.errors, 1);
+  ASSERT_EQ(metrics->GetStats(IOMetrics::Operation::kRead).bytes, 2);
+}
+
 TEST(IOThreadPool, Capacity) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading enabled";
@@ -956,5 +1252,144 @@ TEST(IOThreadPool, Capacity) {
   ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 1);
 }
 
+// An executor running its tasks only when asked to
+class ManualExecutor : public ::arrow::internal::Executor {
+ public:
+  explicit ManualExecutor(int capacity) : capacity_(capacity) {}
+
+  int GetCapacity() override { return capacity_; }
+
+  int64_t num_pending() const { return static_cast<int64_t>(tasks_.size()); }
+
+  void RunOne() {
+    ASSERT_FALSE(tasks_.empty());
+    auto task = std::move(tasks_.front());
+    tasks_.pop_front();
+    std::move(task)();
+  }
+
+  void RunAll() {
+    while (!tasks_.empty()) {
+      RunOne();
+    }
+  }
+
+ protected:
+  Status SpawnReal(::arrow::internal::TaskHints hints,
+                   ::arrow::internal::FnOnce<void()> task, StopToken,
+                   StopCallback&&) override {
+    tasks_.push_back(std::move(task));
+    return Status::OK();
+  }
+
+ private:
+  int capacity_;
+  std::deque<::arrow::internal::FnOnce<void()>> tasks_;
+};
+
+TEST(IOScheduler, Priorities) {
+  ManualExecutor executor(/*capacity=*/4);
+  IOSchedulerOptions options;
+  options.max_in_flight = 1;
+  ASSERT_OK_AND_ASSIGN(auto scheduler, IOScheduler::Make(&executor, options));
+
+  std::vector<int> order;
+  auto submit = [&](int id, int32_t priority) {
+    IOContext io_context(scheduler.get());
+    io_context.set_priority(priority);
+    ASSERT_OK(internal::SubmitIO(io_context, [&order, id] { order.push_back(id); }));
+  };
+  submit(0, 10);
+  submit(1, 5);
+  submit(2, 1);
+  submit(3, 1);
+  ASSERT_EQ(executor.num_pending(), 1);
+  ASSERT_EQ(scheduler->num_running_tasks(), 1);
+  ASSERT_EQ(scheduler->num_queued_tasks(), 3);
+
+  executor.RunAll();
+  ASSERT_EQ(order, std::vector<int>({0, 2, 3, 1}));
+  ASSERT_EQ(scheduler->num_running_tasks(), 0);
+  ASSERT_EQ(scheduler->num_queued_tasks(), 0);
+}
+
+TEST(IOScheduler, TenantWeights) {
+  ManualExecutor executor(/*capacity=*/1);
+  IOSchedulerOptions options;
+  options.tenant_weights = {{1, 2.0}, {2, 1.0}};
+  ASSERT_OK_AND_ASSIGN(auto scheduler, IOScheduler::Make(&executor, options));
+
+  std::vector<int64_t> order;
+  auto submit = [&](int64_t tenant) {
+    ::arrow::internal::TaskHints hints;
+    hints.external_id = tenant;
+    ASSERT_OK(scheduler->Spawn(hints, [&order, tenant] { order.push_back(tenant); }));
+  };
+  // Keep the executor busy while both tenants queue their tasks
+  submit(0);
+  for (int i = 0; i < 6; ++i) {
+    submit(2);
+  }
+  for (int i = 0; i < 6; ++i) {
+    submit(1);
+  }
+  executor.RunAll();
+  ASSERT_EQ(order.size(), 13U);
+  // Tenant 1 gets twice the share of tenant 2 while both have queued tasks
+  std::vector<int64_t> first(order.begin() + 1, order.begin() + 7);
+  ASSERT_EQ(std::count(first.begin(), first.end(), int64_t{1}), 4);
+  ASSERT_EQ(std::count(first.begin(), first.end(), int64_t{2}), 2);
+}
+
+TEST(IOScheduler, InFlightPerTenant) {
+  ManualExecutor executor(/*capacity=*/4);
+  IOSchedulerOptions options;
+  options.max_in_flight_per_tenant = 1;
+  ASSERT_OK_AND_ASSIGN(auto scheduler, IOScheduler::Make(&executor, options));
+
+  auto submit = [&](int64_t tenant) {
+    ::arrow::internal::TaskHints hints;
+    hints.external_id = tenant;
+    ASSERT_OK(scheduler->Spawn(hints, [] {}));
+  };
+  submit(1);
+  submit(1);
+  submit(1);
+  submit(2);
+  ASSERT_EQ(scheduler->num_running_tasks(), 2);
+  ASSERT_EQ(scheduler->num_queued_tasks(), 2);
+  executor.RunOne();
+  ASSERT_EQ(scheduler->num_running_tasks(), 2);
+  ASSERT_EQ(scheduler->num_queued_tasks(), 1);
+  executor.RunAll();
+  ASSERT_EQ(scheduler->num_running_tasks(), 0);
+  ASSERT_EQ(scheduler->num_queued_tasks(), 0);
+}
+
+TEST(IOScheduler, OutlivedByRunningTasks) {
+  ManualExecutor executor(/*capacity=*/1);
+  ASSERT_OK_AND_ASSIGN(auto scheduler, IOScheduler::Make(&executor));
+  ASSERT_OK_AND_ASSIGN(auto running, scheduler->Submit([] { return 1; }));
+  ASSERT_OK_AND_ASSIGN(auto queued, scheduler->Submit([] { return 2; }));
+  executor.RunOne();
+  ASSERT_FINISHES_OK_AND_EQ(1, running);
+  // The second task was handed to the executor once the first one finished
+  executor.RunOne();
+  ASSERT_FINISHES_OK_AND_EQ(2, queued);
+
+  ASSERT_OK_AND_ASSIGN(auto blocked, scheduler->Submit([] { return 3; }));
+  ASSERT_OK_AND_ASSIGN(auto abandoned, scheduler->Submit([] { return 4; }));
+  scheduler.reset();
+  // The running task keeps the scheduler state alive and starts the queued one
+  executor.RunAll();
+  ASSERT_FINISHES_OK_AND_EQ(3, blocked);
+  ASSERT_FINISHES_OK_AND_EQ(4, abandoned);
+
+  ASSERT_RAISES(Invalid, IOScheduler::Make(nullptr));
+  IOSchedulerOptions options;
+  options.tenant_weights = {{1, 0.0}};
+  ASSERT_RAISES(Invalid, IOScheduler::Make(&executor, options));
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -0,0 +1,370 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/metrics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/future.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double SecondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+}  // namespace
+
+double IOMetrics::OperationStats::LatencyQuantile(double q) const {
+  int64_t total = 0;
+  for (auto n : latency_histogram) {
+    total += n;
+  }
+  if (total == 0) {
+    return 0;
+  }
+  const auto rank = static_cast<int64_t>(std::ceil(q * static_cast<double>(total)));
+  int64_t seen = 0;
+  for (int i = 0; i < kNumLatencyBuckets; ++i) {
+    seen += latency_histogram[i];
+    if (seen >= std::max<int64_t>(rank, 1)) {
+      return std::ldexp(1e-6, i);
+    }
+  }
+  return std::ldexp(1e-6, kNumLatencyBuckets - 1);
+}
+
+const char* IOMetrics::OperationName(Operation operation) {
+  switch (operation) {
+    case Operation::kRead:
+      return "read";
+    case Operation::kWrite:
+      return "write";
+    case Operation::kOpen:
+      return "open";
+    case Operation::kGetFileInfo:
+      return "get_file_info";
+    case Operation::kListDir:
+      return "list_dir";
+  }
+  return "unknown";
+}
+
+void IOMetrics::RecordOperation(Operation operation, double seconds, int64_t nbytes,
+                                bool error) {
+  auto& stats = stats_[static_cast<int>(operation)];
+  stats.count.fetch_add(1, std::memory_order_relaxed);
+  if (error) {
+    stats.errors.fetch_add(1, std::memory_order_relaxed);
+  }
+  stats.bytes.fetch_add(nbytes, std::memory_order_relaxed);
+  const auto nanos = static_cast<int64_t>(std::max(seconds, 0.0) * 1e9);
+  stats.total_nanos.fetch_add(nanos, std::memory_order_relaxed);
+  // Bucket i holds latencies in [2^(i-1), 2^i) microseconds
+  const int bucket =
+      std::min(bit_util::NumRequiredBits(static_cast<uint64_t>(nanos / 1000)),
+               kNumLatencyBuckets - 1);
+  stats.latency_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+IOMetrics::OperationStats IOMetrics::GetStats(Operation operation) const {
+  const auto& stats = stats_[static_cast<int>(operation)];
+  OperationStats result;
+  result.count = stats.count.load(std::memory_order_relaxed);
+  result.errors = stats.errors.load(std::memory_order_relaxed);
+  result.bytes = stats.bytes.load(std::memory_order_relaxed);
+  result.total_seconds =
+      static_cast<double>(stats.total_nanos.load(std::memory_order_relaxed)) * 1e-9;
+  for (int i = 0; i < kNumLatencyBuckets; ++i) {
+    result.latency_histogram[i] =
+        stats.latency_histogram[i].load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+void IOMetrics::Reset() {
+  for (auto& stats : stats_) {
+    stats.count.store(0, std::memory_order_relaxed);
+    stats.errors.store(0, std::memory_order_relaxed);
+    stats.bytes.store(0, std::memory_order_relaxed);
+    stats.total_nanos.store(0, std::memory_order_relaxed);
+    for (auto& bucket : stats.latency_histogram) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+  }
+  retries_.store(0, std::memory_order_relaxed);
+}
+
+std::string IOMetrics::ToString() const {
+  std::stringstream ss;
+  for (int i = 0; i < kNumOperations; ++i) {
+    const auto operation = static_cast<Operation>(i);
+    const auto stats = GetStats(operation);
+    if (stats.count == 0) {
+      continue;
+    }
+    ss << OperationName(operation) << ": count=" << stats.count
+       << " errors=" << stats.errors << " bytes=" << stats.bytes
+       << " total_seconds=" << stats.total_seconds
+       << " p50=" << stats.LatencyQuantile(0.5)
+       << " p99=" << stats.LatencyQuantile(0.99) << "\n";
+  }
+  ss << "retries: " << retries() << "\n";
+  return ss.str();
+}
+
+namespace internal {
+
+namespace {
+
+// Record a read (or write) of the number of bytes returned by `func`
+template <typename Function>
+auto RecordTransfer(IOMetrics* metrics, IOMetrics::Operation operation,
+                    Function&& func) -> decltype(func()) {
+  const auto start = Clock::now();
+  auto result = func();
+  const double seconds = SecondsSince(start);
+  if constexpr (std::is_same_v<decltype(result), Status>) {
+    metrics->RecordOperation(operation, seconds, 0, !result.ok());
+  } else {
+    int64_t nbytes = 0;
+    if (result.ok()) {
+      if constexpr (std::is_same_v<decltype(result), Result<int64_t>>) {
+        nbytes = *result;
+      } else {
+        nbytes = (*result)->size();
+      }
+    }
+    metrics->RecordOperation(operation, seconds, nbytes, !result.ok());
+  }
+  return result;
+}
+
+void RecordRead(IOMetrics* metrics, Clock::time_point start,
+                const Result<std::shared_ptr<Buffer>>& result) {
+  metrics->RecordOperation(IOMetrics::Operation::kRead, SecondsSince(start),
+                           result.ok() ? (*result)->size() : 0, !result.ok());
+}
+
+// Record the completion of an asynchronous read into the metrics of the file and
+// into those of the IOContext it was issued with, if different
+//
+// The returned future only completes once the read is recorded.
+Future<std::shared_ptr<Buffer>> RecordAsyncRead(
+    const Future<std::shared_ptr<Buffer>>& future,
+    const std::shared_ptr<IOMetrics>& metrics, const IOContext& io_context) {
+  auto context_metrics = io_context.metrics();
+  if (context_metrics == metrics) {
+    context_metrics.reset();
+  }
+  auto recorded = Future<std::shared_ptr<Buffer>>::Make();
+  future.AddCallback([start = Clock::now(), metrics, context_metrics,
+                      recorded](const Result<std::shared_ptr<Buffer>>& result) mutable {
+    RecordRead(metrics.get(), start, result);
+    if (context_metrics) {
+      RecordRead(context_metrics.get(), start, result);
+    }
+    recorded.MarkFinished(result);
+  });
+  return recorded;
+}
+
+class MetricsInputStream : public InputStream {
+ public:
+  MetricsInputStream(std::shared_ptr<InputStream> stream,
+                     std::shared_ptr<IOMetrics> metrics)
+      : stream_(std::move(stream)), metrics_(std::move(metrics)) {}
+
+  Status Close() override { return stream_->Close(); }
+  Status Abort() override { return stream_->Abort(); }
+  bool closed() const override { return stream_->closed(); }
+  Result<int64_t> Tell() const override { return stream_->Tell(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return RecordTransfer(metrics_.get(), IOMetrics::Operation::kRead,
+                          [&] { return stream_->Read(nbytes, out); });
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return RecordTransfer(metrics_.get(), IOMetrics::Operation::kRead,
+                          [&] { return stream_->Read(nbytes); });
+  }
+  Result<std::string_view> Peek(int64_t nbytes) override { return stream_->Peek(nbytes); }
+  bool supports_zero_copy() const override { return stream_->supports_zero_copy(); }
+
+  Result<std::shared_ptr<const KeyValueMetadata>> ReadMetadata() override {
+    return stream_->ReadMetadata();
+  }
+  Future<std::shared_ptr<const KeyValueMetadata>> ReadMetadataAsync(
+      const IOContext& io_context) override {
+    return stream_->ReadMetadataAsync(io_context);
+  }
+  const IOContext& io_context() const override { return stream_->io_context(); }
+
+ private:
+  std::shared_ptr<InputStream> stream_;
+  std::shared_ptr<IOMetrics> metrics_;
+};
+
+class MetricsRandomAccessFile : public RandomAccessFile {
+ public:
+  MetricsRandomAccessFile(std::shared_ptr<RandomAccessFile> file,
+                          std::shared_ptr<IOMetrics> metrics)
+      : file_(std::move(file)), metrics_(std::move(metrics)) {}
+
+  Status Close() override { return file_->Close(); }
+  Future<> CloseAsync() override { return file_->CloseAsync(); }
+  Status Abort() override { return file_->Abort(); }
+  bool closed() const override { return file_->closed(); }
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return RecordTransfer(metrics_.get(), IOMetrics::Operation::kRead,
+                          [&] { return file_->Read(nbytes, out); });
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return RecordTransfer(metrics_.get(), IOMetrics::Operation::kRead,
+                          [&] { return file_->Read(nbytes); });
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    return RecordTransfer(metrics_.get(), IOMetrics::Operation::kRead,
+                          [&] { return file_->ReadAt(position, nbytes, out); });
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return RecordTransfer(metrics_.get(), IOMetrics::Operation::kRead,
+                          [&] { return file_->ReadAt(position, nbytes); });
+  }
+  Result<std::string_view> Peek(int64_t nbytes) override { return file_->Peek(nbytes); }
+  bool supports_zero_copy() const override { return file_->supports_zero_copy(); }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    return RecordAsyncRead(file_->ReadAsync(io_context, position, nbytes), metrics_,
+                           io_context);
+  }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext& io_context, const std::vector<ReadRange>& ranges) override {
+    // Forward the ranges together, the file may read them more efficiently
+    auto futures = file_->ReadManyAsync(io_context, ranges);
+    for (auto& future : futures) {
+      future = RecordAsyncRead(future, metrics_, io_context);
+    }
+    return futures;
+  }
+
+  Status WillNeed(const std::vector<ReadRange>& ranges) override {
+    return file_->WillNeed(ranges);
+  }
+
+  Result<std::shared_ptr<const KeyValueMetadata>> ReadMetadata() override {
+    return file_->ReadMetadata();
+  }
+  Future<std::shared_ptr<const KeyValueMetadata>> ReadMetadataAsync(
+      const IOContext& io_context) override {
+    return file_->ReadMetadataAsync(io_context);
+  }
+  const IOContext& io_context() const override { return file_->io_context(); }
+
+ private:
+  std::shared_ptr<RandomAccessFile> file_;
+  std::shared_ptr<IOMetrics> metrics_;
+};
+
+class MetricsOutputStream : public OutputStream {
+ public:
+  MetricsOutputStream(std::shared_ptr<OutputStream> stream,
+                      std::shared_ptr<IOMetrics> metrics)
+      : stream_(std::move(stream)), metrics_(std::move(metrics)) {}
+
+  // Closing may upload the last buffered data, so count it as a write
+  Status Close() override {
+    return RecordTransfer(metrics_.get(), IOMetrics::Operation::kWrite,
+                          [&] { return stream_->Close(); });
+  }
+  Future<> CloseAsync() override { return stream_->CloseAsync(); }
+  Status Abort() override { return stream_->Abort(); }
+  bool closed() const override { return stream_->closed(); }
+  Result<int64_t> Tell() const override { return stream_->Tell(); }
+
+  Status Write(const void* data, int64_t nbytes) override {
+    const auto start = Clock::now();
+    auto status = stream_->Write(data, nbytes);
+    metrics_->RecordOperation(IOMetrics::Operation::kWrite, SecondsSince(start),
+                              status.ok() ? nbytes : 0, !status.ok());
+    return status;
+  }
+  Status Write(const std::shared_ptr<Buffer>& data) override {
+    const auto start = Clock::now();
+    auto status = stream_->Write(data);
+    metrics_->RecordOperation(IOMetrics::Operation::kWrite, SecondsSince(start),
+                              status.ok() ? data->size() : 0, !status.ok());
+    return status;
+  }
+  Status Flush() override {
+    return RecordTransfer(metrics_.get(), IOMetrics::Operation::kWrite,
+                          [&] { return stream_->Flush(); });
+  }
+
+ private:
+  std::shared_ptr<OutputStream> stream_;
+  std::shared_ptr<IOMetrics> metrics_;
+};
+
+}  // namespace
+
+std::shared_ptr<RandomAccessFile> WrapWithMetrics(std::shared_ptr<RandomAccessFile> file,
+                                                  std::shared_ptr<IOMetrics> metrics) {
+  if (metrics == nullptr) {
+    return file;
+  }
+  return std::make_shared<MetricsRandomAccessFile>(std::move(file), std::move(metrics));
+}
+
+std::shared_ptr<InputStream> WrapWithMetrics(std::shared_ptr<InputStream> stream,
+                                             std::shared_ptr<IOMetrics> metrics) {
+  if (metrics == nullptr) {
+    return stream;
+  }
+  return std::make_shared<MetricsInputStream>(std::move(stream), std::move(metrics));
+}
+
+std::shared_ptr<OutputStream> WrapWithMetrics(std::shared_ptr<OutputStream> stream,
+                                              std::shared_ptr<IOMetrics> metrics) {
+  if (metrics == nullptr) {
+    return stream;
+  }
+  return std::make_shared<MetricsOutputStream>(std::move(stream), std::move(metrics));
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
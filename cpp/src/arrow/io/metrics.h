@@ -0,0 +1,155 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+
+/// \brief Counters and latency histograms of IO operations
+///
+/// Attach an instance to an IOContext with IOContext::set_metrics().  The
+/// filesystems built with that IOContext then record their file opens, file info
+/// requests and the reads and writes of their files into it.  In addition,
+/// ReadAsync() calls given an IOContext with metrics also record the read into
+/// these metrics, so that a consumer such as a dataset scan can attribute its own
+/// IO by passing its own IOContext.
+///
+/// This class is thread-safe and recording does not take locks.
+class ARROW_EXPORT IOMetrics {
+ public:
+  enum class Operation : int8_t {
+    kRead,
+    kWrite,
+    kOpen,
+    kGetFileInfo,
+    kListDir,
+  };
+  static constexpr int kNumOperations = 5;
+
+  /// Bucket i of the latency histograms counts the operations which took less
+  /// than 2^i microseconds, and more than the previous bucket.  The last bucket
+  /// also counts the slower operations.
+  static constexpr int kNumLatencyBuckets = 32;
+
+  struct ARROW_EXPORT OperationStats {
+    /// The number of operations, including failed ones
+    int64_t count = 0;
+    /// The number of failed operations
+    int64_t errors = 0;
+    /// The number of bytes read or written
+    int64_t bytes = 0;
+    /// The total duration of the operations, in seconds
+    double total_seconds = 0;
+    std::array<int64_t, kNumLatencyBuckets> latency_histogram{};
+
+    /// \brief The upper bound of the latency histogram bucket holding quantile
+    /// `q`, in seconds, or 0 if there were no operations
+    double LatencyQuantile(double q) const;
+  };
+
+  static const char* OperationName(Operation operation);
+
+  /// \brief Record an operation which took `seconds`
+  void RecordOperation(Operation operation, double seconds, int64_t nbytes = 0,
+                       bool error = false);
+
+  /// \brief Record that a request was retried
+  void RecordRetry() { retries_.fetch_add(1, std::memory_order_relaxed); }
+
+  OperationStats GetStats(Operation operation) const;
+
+  /// The number of retried requests
+  int64_t retries() const { return retries_.load(std::memory_order_relaxed); }
+
+  void Reset();
+
+  std::string ToString() const;
+
+ private:
+  struct AtomicStats {
+    std::atomic<int64_t> count{0};
+    std::atomic<int64_t> errors{0};
+    std::atomic<int64_t> bytes{0};
+    std::atomic<int64_t> total_nanos{0};
+    std::array<std::atomic<int64_t>, kNumLatencyBuckets> latency_histogram{};
+  };
+
+  std::array<AtomicStats, kNumOperations> stats_;
+  std::atomic<int64_t> retries_{0};
+};
+
+namespace internal {
+
+/// \brief Call `func`, recording its duration and outcome into `metrics` unless
+/// it is null
+template <typename Function>
+auto RecordOperation(IOMetrics* metrics, IOMetrics::Operation operation,
+                     Function&& func) -> decltype(func()) {
+  if (metrics == NULLPTR) {
+    return func();
+  }
+  const auto start = std::chrono::steady_clock::now();
+  auto result = func();
+  metrics->RecordOperation(
+      operation,
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(),
+      /*nbytes=*/0, !result.ok());
+  return result;
+}
+
+/// \brief Wrap a file so that its reads are recorded into `metrics`
+///
+/// Returns `file` itself if `metrics` is null.
+ARROW_EXPORT std::shared_ptr<RandomAccessFile> WrapWithMetrics(
+    std::shared_ptr<RandomAccessFile> file, std::shared_ptr<IOMetrics> metrics);
+ARROW_EXPORT std::shared_ptr<InputStream> WrapWithMetrics(
+    std::shared_ptr<InputStream> stream, std::shared_ptr<IOMetrics> metrics);
+ARROW_EXPORT std::shared_ptr<OutputStream> WrapWithMetrics(
+    std::shared_ptr<OutputStream> stream, std::shared_ptr<IOMetrics> metrics);
+
+/// \brief Open a file with `open`, recording the open and the IO made through
+/// the file into the metrics of `io_context`, if any
+template <typename FileType, typename OpenFunction>
+Result<std::shared_ptr<FileType>> OpenWithMetrics(const IOContext& io_context,
+                                                  OpenFunction&& open) {
+  const auto& metrics = io_context.metrics();
+  if (metrics == NULLPTR) {
+    return open();
+  }
+  Result<std::shared_ptr<FileType>> file =
+      RecordOperation(metrics.get(), IOMetrics::Operation::kOpen, open);
+  ARROW_RETURN_NOT_OK(file);
+  return WrapWithMetrics(std::move(file).ValueUnsafe(), metrics);
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
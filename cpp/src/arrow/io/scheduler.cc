@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/scheduler.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::Executor;
+using internal::FnOnce;
+using internal::TaskHints;
+
+namespace io {
+
+IOSchedulerOptions IOSchedulerOptions::Defaults() { return IOSchedulerOptions(); }
+
+class IOScheduler::State : public std::enable_shared_from_this<IOScheduler::State> {
+ public:
+  State(Executor* executor, IOSchedulerOptions options)
+      : executor_(executor), options_(std::move(options)) {}
+
+  ~State() {
+    // Tasks still queued can't run anymore
+    for (auto& [tenant_id, tenant] : tenants_) {
+      for (auto& [priority, task] : tenant.tasks) {
+        if (task.stop_callback) {
+          std::move(task.stop_callback)(
+              Status::Cancelled("IOScheduler destroyed before running the task"));
+        }
+      }
+    }
+  }
+
+  int GetCapacity() const {
+    return options_.max_in_flight > 0 ? options_.max_in_flight
+                                      : executor_->GetCapacity();
+  }
+
+  void Enqueue(TaskHints hints, FnOnce<void()> task, StopToken stop_token,
+               StopCallback stop_callback) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto [it, inserted] = tenants_.try_emplace(hints.external_id);
+      Tenant& tenant = it->second;
+      if (inserted) {
+        auto weight_it = options_.tenant_weights.find(hints.external_id);
+        if (weight_it != options_.tenant_weights.end()) {
+          tenant.weight = weight_it->second;
+        }
+      }
+      if (tenant.tasks.empty()) {
+        // A tenant becoming active doesn't get credit for the time it was idle
+        tenant.virtual_time = std::max(tenant.virtual_time, virtual_time_);
+      }
+      tenant.tasks.emplace(hints.priority,
+                           QueuedTask{hints, std::move(task), std::move(stop_token),
+                                      std::move(stop_callback)});
+      ++num_queued_;
+    }
+    Dispatch();
+  }
+
+  void OnTaskFinished(int64_t tenant_id) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      --num_running_;
+      --tenants_[tenant_id].in_flight;
+    }
+    Dispatch();
+  }
+
+  int64_t num_queued() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_queued_;
+  }
+
+  int64_t num_running() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_running_;
+  }
+
+ private:
+  struct QueuedTask {
+    TaskHints hints;
+    FnOnce<void()> task;
+    StopToken stop_token;
+    StopCallback stop_callback;
+  };
+
+  struct Tenant {
+    // Tasks by priority, in submission order for a given priority
+    std::multimap<int32_t, QueuedTask> tasks;
+    int in_flight = 0;
+    double weight = 1;
+    // The start tag of the next task of the tenant
+    double virtual_time = 0;
+  };
+
+  // Pop the next task to start, if any may start now.
+  bool PopNext(QueuedTask* out) {
+    if (num_running_ >= GetCapacity()) {
+      return false;
+    }
+    const int per_tenant_limit = options_.max_in_flight_per_tenant > 0
+                                     ? options_.max_in_flight_per_tenant
+                                     : std::numeric_limits<int>::max();
+    Tenant* best = nullptr;
+    for (auto& [_, tenant] : tenants_) {
+      if (tenant.tasks.empty() || tenant.in_flight >= per_tenant_limit) {
+        continue;
+      }
+      if (best == nullptr) {
+        best = &tenant;
+        continue;
+      }
+      const int32_t priority = tenant.tasks.begin()->first;
+      const int32_t best_priority = best->tasks.begin()->first;
+      if (priority < best_priority ||
+          (priority == best_priority && tenant.virtual_time < best->virtual_time)) {
+        best = &tenant;
+      }
+    }
+    if (best == nullptr) {
+      return false;
+    }
+    virtual_time_ = best->virtual_time;
+    best->virtual_time += 1 / best->weight;
+    ++best->in_flight;
+    auto it = best->tasks.begin();
+    *out = std::move(it->second);
+    best->tasks.erase(it);
+    --num_queued_;
+    ++num_running_;
+    return true;
+  }
+
+  void Dispatch() {
+    std::vector<QueuedTask> to_start;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      QueuedTask task;
+      while (PopNext(&task)) {
+        to_start.push_back(std::move(task));
+      }
+    }
+    // Spawn outside of the lock, as the underlying executor may run the task inline
+    for (auto& task : to_start) {
+      Start(std::move(task));
+    }
+  }
+
+  void Start(QueuedTask task) {
+    const int64_t tenant_id = task.hints.external_id;
+    auto self = shared_from_this();
+    StopCallback stop_callback = std::move(task.stop_callback);
+    std::shared_ptr<StopCallback> shared_stop_callback;
+    if (stop_callback) {
+      shared_stop_callback = std::make_shared<StopCallback>(std::move(stop_callback));
+    }
+    auto run = [self, tenant_id, inner = std::move(task.task)]() mutable {
+      std::move(inner)();
+      self->OnTaskFinished(tenant_id);
+    };
+    // The underlying executor runs either the task or the stop callback, whose
+    // slot must be released too
+    auto stop = [self, tenant_id, shared_stop_callback](const Status& st) {
+      if (shared_stop_callback) {
+        std::move(*shared_stop_callback)(st);
+      }
+      self->OnTaskFinished(tenant_id);
+    };
+    Status st = executor_->Spawn(task.hints, std::move(run), task.stop_token,
+                                 StopCallback(std::move(stop)));
+    if (!st.ok()) {
+      if (shared_stop_callback && *shared_stop_callback) {
+        std::move(*shared_stop_callback)(st);
+      }
+      OnTaskFinished(tenant_id);
+    }
+  }
+
+  Executor* executor_;
+  const IOSchedulerOptions options_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<int64_t, Tenant> tenants_;
+  // The start tag of the last task started
+  double virtual_time_ = 0;
+  int64_t num_queued_ = 0;
+  int64_t num_running_ = 0;
+};
+
+IOScheduler::IOScheduler(Executor* executor, IOSchedulerOptions options)
+    : executor_(executor),
+      state_(std::make_shared<State>(executor, std::move(options))) {}
+
+IOScheduler::~IOScheduler() = default;
+
+Result<std::shared_ptr<IOScheduler>> IOScheduler::Make(Executor* executor,
+                                                       IOSchedulerOptions options) {
+  if (executor == nullptr) {
+    return Status::Invalid("IOScheduler requires an executor");
+  }
+  if (options.max_in_flight < 0 || options.max_in_flight_per_tenant < 0) {
+    return Status::Invalid("IOScheduler in-flight limits must be non-negative");
+  }
+  for (const auto& [tenant_id, weight] : options.tenant_weights) {
+    if (!(weight > 0)) {
+      return Status::Invalid("IOScheduler weight of tenant ", tenant_id,
+                             " must be positive, got ", weight);
+    }
+  }
+  return std::shared_ptr<IOScheduler>(new IOScheduler(executor, std::move(options)));
+}
+
+int IOScheduler::GetCapacity() { return state_->GetCapacity(); }
+
+bool IOScheduler::OwnsThisThread() { return executor_->OwnsThisThread(); }
+
+int64_t IOScheduler::num_queued_tasks() const { return state_->num_queued(); }
+
+int64_t IOScheduler::num_running_tasks() const { return state_->num_running(); }
+
+Status IOScheduler::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken stop_token,
+                              StopCallback&& stop_callback) {
+  state_->Enqueue(hints, std::move(task), std::move(stop_token),
+                  std::move(stop_callback));
+  return Status::OK();
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "arrow/result.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+
+struct ARROW_EXPORT IOSchedulerOptions {
+  /// The maximum number of tasks running at once on the underlying executor.
+  /// If 0, the current capacity of the underlying executor.
+  int max_in_flight = 0;
+  /// The maximum number of tasks of a tenant running at once.  If 0, tenants are
+  /// only limited by `max_in_flight`.
+  int max_in_flight_per_tenant = 0;
+  /// The weights of the tenants, by tenant id.  Tenants missing from the map have
+  /// a weight of 1.
+  std::unordered_map<int64_t, double> tenant_weights;
+
+  static IOSchedulerOptions Defaults();
+};
+
+/// \brief An executor queueing IO tasks by priority and tenant before running them
+/// on another executor
+///
+/// The tenant of a task is the external id of its TaskHints, which SubmitIO sets
+/// to IOContext::external_id(), and tasks carry the priority of their TaskHints,
+/// set from IOContext::priority().  So an IOContext built with an IOScheduler as
+/// executor and a tenant id as external id routes the reads of the filesystems
+/// and of ReadRangeCache made with it through the scheduler.
+///
+/// Whenever the underlying executor has room for a task, the scheduler starts
+/// the most urgent (lowest) priority task queued.  Among the tenants having a task
+/// of that priority, the one which received the smallest share of the started
+/// tasks relative to its weight goes first (start-time weighted fair queuing).
+/// Tenants at their in-flight limit are skipped.  The tasks of a tenant with the
+/// same priority start in submission order.
+///
+/// This class is thread-safe.
+class ARROW_EXPORT IOScheduler : public ::arrow::internal::Executor {
+ public:
+  /// \brief Create a scheduler running its tasks on `executor`, which must
+  /// outlive it
+  static Result<std::shared_ptr<IOScheduler>> Make(
+      ::arrow::internal::Executor* executor,
+      IOSchedulerOptions options = IOSchedulerOptions::Defaults());
+
+  ~IOScheduler() override;
+
+  int GetCapacity() override;
+
+  bool OwnsThisThread() override;
+
+  /// \brief The number of tasks queued and not started yet
+  int64_t num_queued_tasks() const;
+
+  /// \brief The number of tasks started and not finished yet
+  int64_t num_running_tasks() const;
+
+ protected:
+  Status SpawnReal(::arrow::internal::TaskHints hints,
+                   ::arrow::internal::FnOnce<void()> task, StopToken stop_token,
+                   StopCallback&& stop_callback) override;
+
+ private:
+  class State;
+
+  IOScheduler(::arrow::internal::Executor* executor, IOSchedulerOptions options);
+
+  ::arrow::internal::Executor* executor_;
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace io
+}  // namespace arrow
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "arrow/type_fwd.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -29,6 +30,7 @@ struct FileMode {
 
 struct IOContext;
 struct CacheOptions;
+class IOMetrics;
 
 /// EXPERIMENTAL: convenience global singleton for default IOContext settings
 ARROW_EXPORT
@@ -51,6 +53,11 @@ ARROW_EXPORT int GetIOThreadPoolCapacity();
 /// The current number is returned by GetIOThreadPoolCapacity().
 ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
 
+/// \brief Set the CPU affinity of the global I/O thread pool
+///
+/// \see SetCpuThreadPoolAffinity
+ARROW_EXPORT Status SetIOThreadPoolAffinity(const CpuAffinity& affinity);
+
 class FileInterface;
 class Seekable;
 class Writable;
@@ -0,0 +1,477 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring_internal.h"
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define ARROW_HAVE_IO_URING
+#endif
+
+#ifdef ARROW_HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#endif
+
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace io {
+namespace internal {
+
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+int SetupRing(uint32_t entries, io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int EnterRing(int ring_fd, uint32_t to_submit, uint32_t min_complete, uint32_t flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+bool IsTransientError(int errnum) {
+  return errnum == EINTR || errnum == EAGAIN || errnum == EBUSY;
+}
+
+// A read between its submission and its completion.  The file is kept alive so
+// that its descriptor is not closed and reused while the kernel reads from it.
+struct PendingRead {
+  std::shared_ptr<ReadableFile> file;
+  int64_t offset;
+  std::shared_ptr<ResizableBuffer> buffer;
+  struct iovec iov;
+  Future<std::shared_ptr<Buffer>> future;
+};
+
+}  // namespace
+
+class UringReader::Impl : public std::enable_shared_from_this<UringReader::Impl> {
+ public:
+  ~Impl() {
+    if (sqes_ != MAP_FAILED) munmap(sqes_, sqes_size_);
+    if (cq_ring_ != MAP_FAILED && cq_ring_ != sq_ring_) munmap(cq_ring_, cq_ring_size_);
+    if (sq_ring_ != MAP_FAILED) munmap(sq_ring_, sq_ring_size_);
+    if (ring_fd_ >= 0) close(ring_fd_);
+  }
+
+  Status Init(uint32_t queue_depth) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = SetupRing(queue_depth, &params);
+    if (ring_fd_ < 0) {
+      return IOErrorFromErrno(errno, "io_uring_setup failed");
+    }
+    // Older kernels drop completions when the completion ring overflows
+    if (!(params.features & IORING_FEAT_NODROP)) {
+      return Status::NotImplemented("io_uring may drop completions on this kernel");
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+    sq_ring_ = mmap(nullptr, sq_ring_size_, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring_ == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Failed to map io_uring submission ring");
+    }
+    if (single_mmap) {
+      cq_ring_ = sq_ring_;
+    } else {
+      cq_ring_ = mmap(nullptr, cq_ring_size_, PROT_READ | PROT_WRITE,
+                      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+      if (cq_ring_ == MAP_FAILED) {
+        return IOErrorFromErrno(errno, "Failed to map io_uring completion ring");
+      }
+    }
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = mmap(nullptr, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                 ring_fd_, IORING_OFF_SQES);
+    if (sqes_ == MAP_FAILED) {
+      return IOErrorFromErrno(errno, "Failed to map io_uring submission entries");
+    }
+
+    auto sq = static_cast<uint8_t*>(sq_ring_);
+    sq_head_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<uint32_t*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<uint32_t*>(sq + params.sq_off.array);
+    sq_entries_ = params.sq_entries;
+    auto cq = static_cast<uint8_t*>(cq_ring_);
+    cq_head_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<uint32_t*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<uint32_t*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+    cq_entries_ = params.cq_entries;
+
+    // The reaper keeps the ring alive until Stop() lets it exit
+    reaper_ = std::thread([self = shared_from_this()] { self->Reap(); });
+    reaper_id_ = reaper_.get_id();
+    return Status::OK();
+  }
+
+  void Submit(std::vector<std::unique_ptr<PendingRead>> reads) {
+    // The reaper cannot wait for room in the completion ring since it is the one
+    // making room; the kernel buffers its overflowing completions instead.
+    const bool on_reaper = std::this_thread::get_id() == reaper_id_;
+    std::vector<std::pair<std::unique_ptr<PendingRead>, Status>> failed;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      size_t next = 0;
+      while (next < reads.size()) {
+        if (!on_reaper) {
+          not_full_.wait(lock, [&] { return in_flight_ < cq_entries_; });
+        }
+        const uint32_t head = __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        uint32_t tail = *sq_tail_;
+        uint32_t queued = 0;
+        while (next < reads.size() && tail - head < sq_entries_ &&
+               (on_reaper || in_flight_ < cq_entries_)) {
+          PrepareRead(tail++, reads[next++].get());
+          ++queued;
+        }
+        __atomic_store_n(sq_tail_, tail, __ATOMIC_RELEASE);
+        in_flight_ += queued;
+
+        const uint32_t unsubmitted = EnterLocked(queued, on_reaper);
+        if (unsubmitted > 0) {
+          // Take back the entries the kernel did not consume, and fail them along
+          // with the reads not queued yet
+          __atomic_store_n(sq_tail_, tail - unsubmitted, __ATOMIC_RELEASE);
+          in_flight_ -= unsubmitted;
+          auto status = IOErrorFromErrno(errno, "io_uring_enter failed");
+          for (size_t i = next - unsubmitted; i < reads.size(); ++i) {
+            failed.emplace_back(std::move(reads[i]), status);
+          }
+          break;
+        }
+      }
+      // The remaining reads are owned by the ring until they complete
+      for (auto& read : reads) read.release();
+    }
+    for (auto& [read, status] : failed) {
+      read->future.MarkFinished(std::move(status));
+    }
+  }
+
+  void Stop() {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      const uint32_t tail = *sq_tail_;
+      auto sqe = &static_cast<io_uring_sqe*>(sqes_)[tail & sq_mask_];
+      std::memset(sqe, 0, sizeof(*sqe));
+      sqe->opcode = IORING_OP_NOP;
+      sqe->user_data = 0;
+      sq_array_[tail & sq_mask_] = tail & sq_mask_;
+      __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+      if (EnterLocked(1, /*on_reaper=*/false) > 0) {
+        ARROW_LOG(FATAL) << "Failed to stop io_uring reaper: "
+                         << IOErrorFromErrno(errno, "io_uring_enter failed").ToString();
+      }
+    }
+    if (std::this_thread::get_id() == reaper_id_) {
+      reaper_.detach();
+    } else {
+      reaper_.join();
+    }
+  }
+
+ private:
+  void PrepareRead(uint32_t tail, PendingRead* read) {
+    const uint32_t index = tail & sq_mask_;
+    auto sqe = &static_cast<io_uring_sqe*>(sqes_)[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = read->file->file_descriptor();
+    sqe->addr = reinterpret_cast<uint64_t>(&read->iov);
+    sqe->len = 1;
+    sqe->off = static_cast<uint64_t>(read->offset);
+    sqe->user_data = reinterpret_cast<uint64_t>(read);
+    sq_array_[index] = index;
+  }
+
+  // Submit the last `count` queued entries; return how many were not consumed
+  uint32_t EnterLocked(uint32_t count, bool on_reaper) {
+    while (count > 0) {
+      const int ret = EnterRing(ring_fd_, count, 0, 0);
+      if (ret > 0) {
+        count -= static_cast<uint32_t>(ret);
+      } else if (ret < 0 && !IsTransientError(errno)) {
+        break;
+      } else if (ret < 0 && errno == EBUSY && on_reaper) {
+        // The completion backlog can only be drained by this thread
+        break;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+    return count;
+  }
+
+  void Reap() {
+    std::vector<std::pair<std::unique_ptr<PendingRead>, int32_t>> completed;
+    bool stop_requested = false;
+    while (true) {
+      if (EnterRing(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS) < 0 &&
+          !IsTransientError(errno)) {
+        ARROW_LOG(FATAL) << "Failed to wait for io_uring completions: "
+                         << IOErrorFromErrno(errno, "io_uring_enter failed").ToString();
+      }
+      uint32_t head = *cq_head_;
+      const uint32_t tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+      for (; head != tail; ++head) {
+        const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+        if (cqe.user_data == 0) {
+          stop_requested = true;
+        } else {
+          completed.emplace_back(reinterpret_cast<PendingRead*>(cqe.user_data),
+                                 cqe.res);
+        }
+      }
+      __atomic_store_n(cq_head_, head, __ATOMIC_RELEASE);
+
+      bool done;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        in_flight_ -= static_cast<uint32_t>(completed.size());
+        done = stop_requested && in_flight_ == 0;
+      }
+      not_full_.notify_all();
+      for (auto& [read, res] : completed) {
+        Complete(read.get(), res);
+      }
+      completed.clear();
+      if (done) break;
+    }
+  }
+
+  static void Complete(PendingRead* read, int32_t res) {
+    if (res < 0) {
+      read->future.MarkFinished(IOErrorFromErrno(-res, "io_uring read failed"));
+      return;
+    }
+    int64_t bytes_read = res;
+    const int64_t nbytes = read->buffer->size();
+    // Regular files only return short reads at the end of the file or for very
+    // large reads; finish the latter synchronously.
+    if (bytes_read > 0 && bytes_read < nbytes) {
+      auto maybe_rest = ::arrow::internal::FileReadAt(
+          read->file->file_descriptor(), read->buffer->mutable_data() + bytes_read,
+          read->offset + bytes_read, nbytes - bytes_read);
+      if (!maybe_rest.ok()) {
+        read->future.MarkFinished(maybe_rest.status());
+        return;
+      }
+      bytes_read += *maybe_rest;
+    }
+    if (bytes_read < nbytes) {
+      auto status = read->buffer->Resize(bytes_read, /*shrink_to_fit=*/false);
+      if (!status.ok()) {
+        read->future.MarkFinished(std::move(status));
+        return;
+      }
+    }
+    read->future.MarkFinished(std::move(read->buffer));
+  }
+
+  int ring_fd_ = -1;
+  void* sq_ring_ = MAP_FAILED;
+  void* cq_ring_ = MAP_FAILED;
+  void* sqes_ = MAP_FAILED;
+  size_t sq_ring_size_ = 0;
+  size_t cq_ring_size_ = 0;
+  size_t sqes_size_ = 0;
+
+  uint32_t* sq_head_ = nullptr;
+  uint32_t* sq_tail_ = nullptr;
+  uint32_t* sq_array_ = nullptr;
+  uint32_t sq_mask_ = 0;
+  uint32_t sq_entries_ = 0;
+  uint32_t* cq_head_ = nullptr;
+  uint32_t* cq_tail_ = nullptr;
+  io_uring_cqe* cqes_ = nullptr;
+  uint32_t cq_mask_ = 0;
+  uint32_t cq_entries_ = 0;
+
+  // Protects the submission ring and in_flight_
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+  uint32_t in_flight_ = 0;
+
+  std::thread reaper_;
+  std::thread::id reaper_id_;
+};
+
+UringReader::UringReader(std::shared_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+UringReader::~UringReader() { impl_->Stop(); }
+
+Result<std::shared_ptr<UringReader>> UringReader::Make(int32_t queue_depth) {
+  if (queue_depth <= 0) {
+    return Status::Invalid("io_uring queue depth must be positive, got ", queue_depth);
+  }
+  auto impl = std::make_shared<Impl>();
+  RETURN_NOT_OK(impl->Init(static_cast<uint32_t>(queue_depth)));
+  return std::shared_ptr<UringReader>(new UringReader(std::move(impl)));
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> UringReader::ReadMany(
+    const std::shared_ptr<ReadableFile>& file, const std::vector<ReadRange>& ranges,
+    MemoryPool* pool) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(ranges.size());
+  std::vector<std::unique_ptr<PendingRead>> reads;
+  for (const auto& range : ranges) {
+    auto future = Future<std::shared_ptr<Buffer>>::Make();
+    futures.push_back(future);
+
+    auto status = ValidateRange(range.offset, range.length);
+    if (status.ok() && file->closed()) {
+      status = Status::Invalid("Operation on closed file");
+    }
+    if (!status.ok()) {
+      future.MarkFinished(std::move(status));
+      continue;
+    }
+    auto maybe_buffer = AllocateResizableBuffer(range.length, pool);
+    if (!maybe_buffer.ok()) {
+      future.MarkFinished(maybe_buffer.status());
+      continue;
+    }
+    std::shared_ptr<ResizableBuffer> buffer = std::move(*maybe_buffer);
+    if (range.length == 0) {
+      future.MarkFinished(std::move(buffer));
+      continue;
+    }
+    auto read = std::make_unique<PendingRead>();
+    read->file = file;
+    read->offset = range.offset;
+    read->iov.iov_base = buffer->mutable_data();
+    read->iov.iov_len = static_cast<size_t>(range.length);
+    read->buffer = std::move(buffer);
+    read->future = std::move(future);
+    reads.push_back(std::move(read));
+  }
+  if (!reads.empty()) {
+    impl_->Submit(std::move(reads));
+  }
+  return futures;
+}
+
+#else  // !ARROW_HAVE_IO_URING
+
+class UringReader::Impl {};
+
+UringReader::UringReader(std::shared_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+UringReader::~UringReader() = default;
+
+Result<std::shared_ptr<UringReader>> UringReader::Make(int32_t queue_depth) {
+  return Status::NotImplemented("io_uring is not supported on this platform");
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> UringReader::ReadMany(
+    const std::shared_ptr<ReadableFile>& file, const std::vector<ReadRange>& ranges,
+    MemoryPool* pool) {
+  return std::vector<Future<std::shared_ptr<Buffer>>>(
+      ranges.size(), Future<std::shared_ptr<Buffer>>::MakeFinished(
+                         Status::NotImplemented("io_uring is not supported")));
+}
+
+#endif  // ARROW_HAVE_IO_URING
+
+namespace {
+
+class UringFile : public RandomAccessFile {
+ public:
+  UringFile(std::shared_ptr<ReadableFile> file, std::shared_ptr<UringReader> reader)
+      : file_(std::move(file)), reader_(std::move(reader)) {}
+
+  Status Close() override { return file_->Close(); }
+  Status Abort() override { return file_->Abort(); }
+  bool closed() const override { return file_->closed(); }
+
+  Result<int64_t> Tell() const override { return file_->Tell(); }
+  Status Seek(int64_t position) override { return file_->Seek(position); }
+  Result<int64_t> GetSize() override { return file_->GetSize(); }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    return file_->Read(nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    return file_->Read(nbytes);
+  }
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    return file_->ReadAt(position, nbytes, out);
+  }
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    return file_->ReadAt(position, nbytes);
+  }
+  Status WillNeed(const std::vector<ReadRange>& ranges) override {
+    return file_->WillNeed(ranges);
+  }
+
+  Future<std::shared_ptr<Buffer>> ReadAsync(const IOContext& io_context,
+                                            int64_t position, int64_t nbytes) override {
+    return reader_->ReadMany(file_, {{position, nbytes}}, io_context.pool())[0];
+  }
+
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadManyAsync(
+      const IOContext& io_context, const std::vector<ReadRange>& ranges) override {
+    return reader_->ReadMany(file_, ranges, io_context.pool());
+  }
+
+ private:
+  std::shared_ptr<ReadableFile> file_;
+  std::shared_ptr<UringReader> reader_;
+};
+
+}  // namespace
+
+std::shared_ptr<RandomAccessFile> MakeUringFile(std::shared_ptr<ReadableFile> file,
+                                                std::shared_ptr<UringReader> reader) {
+  return std::make_shared<UringFile>(std::move(file), std::move(reader));
+}
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Asynchronous local file reads with Linux io_uring
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/io/type_fwd.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/future.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace io {
+
+class ReadableFile;
+
+namespace internal {
+
+/// \brief An io_uring instance serving asynchronous reads of local files
+///
+/// Reads are queued on the submission ring and submitted in batches with a
+/// single system call.  A dedicated thread reaps the completion ring and
+/// completes the returned futures, so no thread blocks on a read while it is in
+/// flight.  Continuations attached to the futures run on that thread unless
+/// they are transferred.
+class ARROW_EXPORT UringReader {
+ public:
+  static constexpr int32_t kDefaultQueueDepth = 256;
+
+  ~UringReader();
+
+  /// \brief Create a ring with room for `queue_depth` submissions
+  ///
+  /// Returns NotImplemented if io_uring is unavailable on this platform, and an
+  /// IOError if the kernel refuses to create the ring (for example because of a
+  /// seccomp policy).
+  static Result<std::shared_ptr<UringReader>> Make(
+      int32_t queue_depth = kDefaultQueueDepth);
+
+  /// \brief Read ranges of a file, allocating the buffers from `pool`
+  ///
+  /// All ranges are submitted together.  Reads past the end of the file return
+  /// truncated buffers, as ReadAt does.
+  std::vector<Future<std::shared_ptr<Buffer>>> ReadMany(
+      const std::shared_ptr<ReadableFile>& file, const std::vector<ReadRange>& ranges,
+      MemoryPool* pool);
+
+ private:
+  class Impl;
+
+  explicit UringReader(std::shared_ptr<Impl> impl);
+
+  std::shared_ptr<Impl> impl_;
+};
+
+/// \brief Wrap a file so that its asynchronous reads are served by `reader`
+///
+/// Synchronous calls are forwarded to `file`.
+ARROW_EXPORT std::shared_ptr<RandomAccessFile> MakeUringFile(
+    std::shared_ptr<ReadableFile> file, std::shared_ptr<UringReader> reader);
+
+}  // namespace internal
+}  // namespace io
+}  // namespace arrow
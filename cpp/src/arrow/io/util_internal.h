@@ -57,6 +57,7 @@ auto SubmitIO(IOContext io_context, SubmitArgs&&... submit_args)
     -> decltype(std::declval<::arrow::internal::Executor*>()->Submit(submit_args...)) {
   ::arrow::internal::TaskHints hints;
   hints.external_id = io_context.external_id();
+  hints.priority = io_context.priority();
   return io_context.executor()->Submit(hints, io_context.stop_token(),
                                        std::forward<SubmitArgs>(submit_args)...);
 }
@@ -65,7 +65,10 @@ struct ARROW_EXPORT IpcWriteOptions {
 
   /// \brief Compression codec to use for record batch body buffers
   ///
-  /// May only be UNCOMPRESSED, LZ4_FRAME and ZSTD.
+  /// May only be UNCOMPRESSED, LZ4_FRAME and ZSTD.  A ZSTD codec created with
+  /// util::ZstdCodecOptions compresses with a dictionary, which makes the
+  /// buffers of small record batches much smaller; readers must then be given
+  /// the same dictionary through IpcReadOptions::codec_options.
   std::shared_ptr<util::Codec> codec;
 
   /// \brief Minimum space savings percentage required for compression to be applied
@@ -83,6 +86,16 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// prior to 12.0.0.
   std::optional<double> min_space_savings;
 
+  /// \brief Compact the data buffers of binary and string view arrays when their
+  /// views reference less than this fraction of their bytes
+  ///
+  /// Slices, takes and filters of view arrays keep all the data buffers of their
+  /// input, which would otherwise be written entirely.  Their referenced values
+  /// are then copied to new buffers before writing.  0 disables compaction.
+  ///
+  /// \see BinaryViewArray::CompactDataBuffers
+  double view_compaction_threshold = 0.5;
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
@@ -119,6 +132,29 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// and deltas.
   bool unify_dictionaries = false;
 
+  /// \brief Whether to store the statistics of the record batches in IPC files
+  ///
+  /// If true, the file writer computes the null count, and the minimum and
+  /// maximum values of each top-level column of a numeric, temporal, string or
+  /// binary type, for each record batch.  They are stored in the custom metadata
+  /// of the file footer, so that readers can skip the record batches which can't
+  /// match a filter without reading them.
+  ///
+  /// This option is ignored for IPC streams.
+  ///
+  /// \see RecordBatchFileReader::ReadStatistics()
+  bool write_statistics = false;
+
+  /// \brief The maximum number of record batches serialized ahead of the sink
+  /// by RecordBatchWriter::WriteRecordBatchAsync
+  ///
+  /// The record batches written asynchronously are serialized, and their buffers
+  /// compressed, on the global CPU thread pool while the previous batches are
+  /// written to the sink.  The buffers of each batch are then compressed serially,
+  /// as the batches are compressed in parallel.  Once this many batches are
+  /// pending, WriteRecordBatchAsync waits for the oldest one to be written.
+  int max_pending_batches = 4;
+
   /// \brief Format version to use for IPC messages and their metadata.
   ///
   /// Presently using V5 version (readable by 1.0.0 and later).
@@ -149,6 +185,16 @@ struct ARROW_EXPORT IpcReadOptions {
   /// like decompression
   bool use_threads = true;
 
+  /// \brief The maximum number of record batches decoded ahead by
+  /// RecordBatchStreamReader
+  ///
+  /// If positive, the stream reader reads the next messages from the stream while
+  /// the previous record batches are decoded, and their buffers decompressed, on
+  /// the global CPU thread pool.  The buffers of each batch are then decompressed
+  /// serially, as the batches are decoded in parallel.  If 0 (the default), each
+  /// record batch is decoded when read.
+  int batch_readahead = 0;
+
   /// \brief Whether to convert incoming data to platform-native endianness
   ///
   /// If the endianness of the received schema is not equal to platform-native
@@ -166,6 +212,12 @@ struct ARROW_EXPORT IpcReadOptions {
   /// The lazy property will always be reset to true to deliver the expected behavior
   io::CacheOptions pre_buffer_cache_options = io::CacheOptions::LazyDefaults();
 
+  /// \brief Options for the codecs decompressing body buffers
+  ///
+  /// Set this to util::ZstdCodecOptions to decompress ZSTD buffers written
+  /// with a dictionary.
+  std::shared_ptr<util::CodecOptions> codec_options;
+
   static IpcReadOptions Defaults();
 };
 
@@ -857,6 +857,33 @@ TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   ASSERT_EQ(6 * sizeof(int32_t), result->column(0)->data()->buffers[1]->size());
 }
 
+TEST_F(TestWriteRecordBatch, CompactsBinaryViews) {
+  auto array = random::RandomArrayGenerator(42).StringView(
+      1000, /*min_length=*/20, /*max_length=*/40, /*null_probability=*/0.1);
+  auto schema = ::arrow::schema({field("f0", array->type())});
+  auto sliced_batch = RecordBatch::Make(schema, array->length(), {array})->Slice(10, 50);
+
+  auto write_options = IpcWriteOptions::Defaults();
+  for (double threshold : {0.0, 0.5}) {
+    ARROW_SCOPED_TRACE("view_compaction_threshold = ", threshold);
+    write_options.view_compaction_threshold = threshold;
+    IpcPayload payload;
+    ASSERT_OK(GetRecordBatchPayload(*sliced_batch, write_options, &payload));
+    int64_t data_size = 0;
+    for (size_t i = 2; i < payload.body_buffers.size(); ++i) {
+      data_size += payload.body_buffers[i]->size();
+    }
+    if (threshold == 0) {
+      // The whole data buffers of the array are written
+      ASSERT_GT(data_size, 20 * 900);
+    } else {
+      // Only the values of the slice are written
+      ASSERT_LE(data_size, 40 * 50);
+    }
+    CheckRoundtrip(*sliced_batch, write_options);
+  }
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBuffers) {
   auto CheckArray = [this](const std::shared_ptr<Array>& array) {
     auto f0 = field("f0", array->type());
@@ -1337,6 +1364,17 @@ struct StreamWriterHelper {
   std::shared_ptr<RecordBatchWriter> writer_;
 };
 
+struct PipelinedStreamWriterHelper : public StreamWriterHelper {
+  Status ReadBatches(const IpcReadOptions& options, RecordBatchVector* out_batches,
+                     ReadStats* out_stats = nullptr,
+                     MetadataVector* out_metadata_list = nullptr) override {
+    auto pipelined_options = options;
+    pipelined_options.batch_readahead = 3;
+    return StreamWriterHelper::ReadBatches(pipelined_options, out_batches, out_stats,
+                                           out_metadata_list);
+  }
+};
+
 class CopyCollectListener : public CollectListener {
  public:
   CopyCollectListener() : CollectListener() {}
@@ -2198,6 +2236,321 @@ TEST(TestRecordBatchStreamReader, MalformedInput) {
   ASSERT_RAISES(Invalid, RecordBatchStreamReader::Open(&garbage_reader));
 }
 
+TEST(TestRecordBatchStreamReader, BatchReadahead) {
+  std::vector<Compression::type> codecs = {Compression::UNCOMPRESSED};
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (util::Codec::IsAvailable(codec)) {
+      codecs.push_back(codec);
+    }
+  }
+  RecordBatchVector batches;
+  for (int i = 0; i < 20; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntBatchSized(/*length=*/500 + i, &batch, /*seed=*/i));
+    batches.push_back(batch);
+  }
+
+  for (auto codec : codecs) {
+    ARROW_SCOPED_TRACE("codec = ", util::Codec::GetCodecAsString(codec));
+    auto write_options = IpcWriteOptions::Defaults();
+    if (codec != Compression::UNCOMPRESSED) {
+      ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    }
+    StreamWriterHelper writer_helper;
+    ASSERT_OK(writer_helper.Init(batches[0]->schema(), write_options));
+    for (const auto& batch : batches) {
+      ASSERT_OK(writer_helper.WriteBatch(batch));
+    }
+    ASSERT_OK(writer_helper.Finish());
+
+    for (int batch_readahead : {1, 4, 100}) {
+      ARROW_SCOPED_TRACE("batch_readahead = ", batch_readahead);
+      auto read_options = IpcReadOptions::Defaults();
+      read_options.batch_readahead = batch_readahead;
+      RecordBatchVector out_batches;
+      ReadStats read_stats;
+      ASSERT_OK(writer_helper.ReadBatches(read_options, &out_batches, &read_stats));
+      ASSERT_EQ(out_batches.size(), batches.size());
+      for (size_t i = 0; i < batches.size(); ++i) {
+        AssertBatchesEqual(*batches[i], *out_batches[i]);
+      }
+      ASSERT_EQ(read_stats.num_record_batches, 20);
+      ASSERT_EQ(read_stats.num_messages, 21);  // including schema message
+    }
+
+    // Reading a few batches and dropping the reader waits for the batches in flight
+    auto read_options = IpcReadOptions::Defaults();
+    read_options.batch_readahead = 8;
+    auto buf_reader = std::make_shared<io::BufferReader>(writer_helper.buffer_);
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         RecordBatchStreamReader::Open(buf_reader, read_options));
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+    AssertBatchesEqual(*batches[0], *batch);
+  }
+}
+
+Result<std::shared_ptr<Buffer>> WriteFileToBuffer(const RecordBatchVector& batches,
+                                                  const IpcWriteOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+  ARROW_ASSIGN_OR_RAISE(auto writer,
+                        MakeFileWriter(sink, batches[0]->schema(), options));
+  for (const auto& batch : batches) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  RETURN_NOT_OK(writer->Close());
+  return sink->Finish();
+}
+
+void AssertColumnStatistics(const std::optional<ColumnStatistics>& statistics,
+                            int64_t null_count, const std::shared_ptr<Scalar>& min,
+                            const std::shared_ptr<Scalar>& max) {
+  ASSERT_TRUE(statistics.has_value());
+  ASSERT_EQ(statistics->null_count, null_count);
+  if (min == nullptr) {
+    ASSERT_EQ(statistics->min, nullptr);
+    ASSERT_EQ(statistics->max, nullptr);
+  } else {
+    AssertScalarsEqual(*min, *statistics->min, /*verbose=*/true);
+    AssertScalarsEqual(*max, *statistics->max, /*verbose=*/true);
+  }
+}
+
+TEST(TestRecordBatchFileReader, Statistics) {
+  auto sch = schema({field("i", int32()), field("ts", timestamp(TimeUnit::MILLI, "UTC")),
+                     field("s", utf8()), field("l", list(int8()))});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(sch, R"([[3, 10, "b", [1]], [1, 20, "a", null],
+                                   [null, null, null, []]])"),
+      RecordBatchFromJSON(sch, R"([[null, 5, "z", null], [null, 5, "y", null]])")};
+
+  // No statistics by default
+  ASSERT_OK_AND_ASSIGN(auto buffer,
+                       WriteFileToBuffer(batches, IpcWriteOptions::Defaults()));
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(
+                                        std::make_shared<io::BufferReader>(buffer)));
+  ASSERT_OK_AND_ASSIGN(auto statistics, reader->ReadStatistics());
+  ASSERT_TRUE(statistics.empty());
+
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.write_statistics = true;
+  ASSERT_OK_AND_ASSIGN(buffer, WriteFileToBuffer(batches, write_options));
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(
+                                   std::make_shared<io::BufferReader>(buffer)));
+  ASSERT_OK_AND_ASSIGN(statistics, reader->ReadStatistics());
+  ASSERT_EQ(statistics.size(), 2);
+  ASSERT_EQ(statistics[0].num_rows, 3);
+  ASSERT_EQ(statistics[0].columns.size(), 4);
+  AssertColumnStatistics(statistics[0].columns[0], 1, ScalarFromJSON(int32(), "1"),
+                         ScalarFromJSON(int32(), "3"));
+  AssertColumnStatistics(statistics[0].columns[1], 1,
+                         ScalarFromJSON(sch->field(1)->type(), "10"),
+                         ScalarFromJSON(sch->field(1)->type(), "20"));
+  AssertColumnStatistics(statistics[0].columns[2], 1, ScalarFromJSON(utf8(), R"("a")"),
+                         ScalarFromJSON(utf8(), R"("b")"));
+  ASSERT_FALSE(statistics[0].columns[3].has_value());
+  ASSERT_EQ(statistics[1].num_rows, 2);
+  AssertColumnStatistics(statistics[1].columns[0], 2, nullptr, nullptr);
+  AssertColumnStatistics(statistics[1].columns[2], 0, ScalarFromJSON(utf8(), R"("y")"),
+                         ScalarFromJSON(utf8(), R"("z")"));
+  ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(1));
+  AssertBatchesEqual(*batches[1], *batch);
+
+  // The statistics are indexed by field of the read schema
+  auto read_options = IpcReadOptions::Defaults();
+  read_options.included_fields = {2};
+  ASSERT_OK_AND_ASSIGN(reader,
+                       RecordBatchFileReader::Open(
+                           std::make_shared<io::BufferReader>(buffer), read_options));
+  ASSERT_OK_AND_ASSIGN(statistics, reader->ReadStatistics());
+  ASSERT_EQ(statistics.size(), 2);
+  ASSERT_EQ(statistics[0].columns.size(), 1);
+  AssertColumnStatistics(statistics[0].columns[0], 1, ScalarFromJSON(utf8(), R"("a")"),
+                         ScalarFromJSON(utf8(), R"("b")"));
+}
+
+TEST(TestRecordBatchFileReader, GeneratorWithBatchIndices) {
+  RecordBatchVector batches;
+  for (int i = 0; i < 5; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntBatchSized(/*length=*/100, &batch, /*seed=*/i));
+    batches.push_back(batch);
+  }
+  ASSERT_OK_AND_ASSIGN(auto buffer,
+                       WriteFileToBuffer(batches, IpcWriteOptions::Defaults()));
+
+  for (bool zero_copy : {true, false}) {
+    ARROW_SCOPED_TRACE("zero_copy = ", zero_copy);
+    std::shared_ptr<io::RandomAccessFile> file =
+        std::make_shared<io::BufferReader>(buffer);
+    if (!zero_copy) {
+      file = std::make_shared<NoZeroCopyBufferReader>(buffer);
+    }
+    for (bool coalesce : {false, true}) {
+      ARROW_SCOPED_TRACE("coalesce = ", coalesce);
+      ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(file));
+      ASSERT_OK_AND_ASSIGN(auto generator,
+                           reader->GetRecordBatchGenerator({3, 0, 4}, coalesce));
+      ASSERT_FINISHES_OK_AND_ASSIGN(auto out_batches, CollectAsyncGenerator(generator));
+      ASSERT_EQ(out_batches.size(), 3);
+      AssertBatchesEqual(*batches[3], *out_batches[0]);
+      AssertBatchesEqual(*batches[0], *out_batches[1]);
+      AssertBatchesEqual(*batches[4], *out_batches[2]);
+
+      ASSERT_OK_AND_ASSIGN(generator,
+                           reader->GetRecordBatchGenerator(std::vector<int>{}, coalesce));
+      ASSERT_FINISHES_OK_AND_ASSIGN(out_batches, CollectAsyncGenerator(generator));
+      ASSERT_EQ(out_batches.size(), 0);
+
+      ASSERT_RAISES(Invalid,
+                    reader->GetRecordBatchGenerator(std::vector<int>{5}, coalesce));
+    }
+  }
+}
+
+Result<std::shared_ptr<Buffer>> WriteBatchesAsync(const RecordBatchVector& batches,
+                                                   const IpcWriteOptions& options,
+                                                   bool file_format) {
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+  std::shared_ptr<RecordBatchWriter> writer;
+  if (file_format) {
+    ARROW_ASSIGN_OR_RAISE(writer, MakeFileWriter(sink, batches[0]->schema(), options));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(writer, MakeStreamWriter(sink, batches[0]->schema(), options));
+  }
+  std::vector<Future<>> futures;
+  for (size_t i = 0; i < batches.size(); ++i) {
+    if (i == batches.size() / 2) {
+      // Synchronous writes wait for the pending batches
+      RETURN_NOT_OK(writer->WriteRecordBatch(*batches[i]));
+      continue;
+    }
+    futures.push_back(writer->WriteRecordBatchAsync(batches[i]));
+  }
+  RETURN_NOT_OK(writer->Close());
+  for (const auto& future : futures) {
+    // Close waits for the pending batches
+    if (!future.is_finished()) {
+      return Status::Invalid("Pending batch after Close");
+    }
+    RETURN_NOT_OK(future.status());
+  }
+  if (writer->stats().num_record_batches != static_cast<int64_t>(batches.size())) {
+    return Status::Invalid("Unexpected number of record batches written");
+  }
+  return sink->Finish();
+}
+
+Result<RecordBatchVector> ReadBatchesFromBuffer(const std::shared_ptr<Buffer>& buffer,
+                                                bool file_format) {
+  auto source = std::make_shared<io::BufferReader>(buffer);
+  if (file_format) {
+    ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchFileReader::Open(source));
+    RecordBatchVector batches;
+    for (int i = 0; i < reader->num_record_batches(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(auto batch, reader->ReadRecordBatch(i));
+      batches.push_back(std::move(batch));
+    }
+    return batches;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto reader, RecordBatchStreamReader::Open(source));
+  return reader->ToRecordBatches();
+}
+
+TEST(TestRecordBatchWriter, WriteRecordBatchAsync) {
+  std::vector<Compression::type> codecs = {Compression::UNCOMPRESSED};
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (util::Codec::IsAvailable(codec)) {
+      codecs.push_back(codec);
+    }
+  }
+  RecordBatchVector batches;
+  for (int i = 0; i < 20; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ASSERT_OK(MakeIntBatchSized(/*length=*/500 + i, &batch, /*seed=*/i));
+    batches.push_back(batch);
+  }
+
+  for (auto codec : codecs) {
+    ARROW_SCOPED_TRACE("codec = ", util::Codec::GetCodecAsString(codec));
+    auto write_options = IpcWriteOptions::Defaults();
+    if (codec != Compression::UNCOMPRESSED) {
+      ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    }
+    for (bool file_format : {false, true}) {
+      ARROW_SCOPED_TRACE("file_format = ", file_format);
+      for (int max_pending_batches : {1, 4, 100}) {
+        ARROW_SCOPED_TRACE("max_pending_batches = ", max_pending_batches);
+        write_options.max_pending_batches = max_pending_batches;
+        ASSERT_OK_AND_ASSIGN(auto buffer,
+                             WriteBatchesAsync(batches, write_options, file_format));
+        ASSERT_OK_AND_ASSIGN(auto out_batches,
+                             ReadBatchesFromBuffer(buffer, file_format));
+        ASSERT_EQ(out_batches.size(), batches.size());
+        for (size_t i = 0; i < batches.size(); ++i) {
+          AssertBatchesEqual(*batches[i], *out_batches[i]);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestRecordBatchWriter, WriteRecordBatchAsyncDictionaries) {
+  auto dict_type = dictionary(int32(), utf8());
+  auto sch = schema({field("d", dict_type), field("i", int32())});
+  auto make_batch = [&](const std::string& dict_json, const std::string& indices_json) {
+    auto dict_array = DictArrayFromJSON(dict_type, indices_json, dict_json);
+    auto ints = ArrayFromJSON(int32(), indices_json);
+    return RecordBatch::Make(sch, ints->length(), {dict_array, ints});
+  };
+  // A delta, a replacement and an unchanged dictionary
+  RecordBatchVector batches = {
+      make_batch(R"(["a"])", "[0, 0]"), make_batch(R"(["a", "b"])", "[1, 0, 1]"),
+      make_batch(R"(["c"])", "[0]"), make_batch(R"(["c"])", "[null, 0]"),
+      make_batch(R"(["c", "d"])", "[1]")};
+
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.emit_dictionary_deltas = true;
+  ASSERT_OK_AND_ASSIGN(auto buffer, WriteBatchesAsync(batches, write_options,
+                                                      /*file_format=*/false));
+  ASSERT_OK_AND_ASSIGN(auto out_batches,
+                       ReadBatchesFromBuffer(buffer, /*file_format=*/false));
+  ASSERT_EQ(out_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    AssertBatchesEqual(*batches[i], *out_batches[i]);
+  }
+
+  // The file format only supports deltas
+  batches = {make_batch(R"(["a"])", "[0, 0]"), make_batch(R"(["a", "b"])", "[1, 0]"),
+             make_batch(R"(["a", "b", "c"])", "[2]")};
+  ASSERT_OK_AND_ASSIGN(buffer, WriteBatchesAsync(batches, write_options,
+                                                 /*file_format=*/true));
+  ASSERT_OK_AND_ASSIGN(out_batches, ReadBatchesFromBuffer(buffer, /*file_format=*/true));
+  ASSERT_EQ(out_batches.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    AssertBatchesEqual(*batches[i], *out_batches[i]);
+  }
+}
+
+TEST(TestRecordBatchWriter, WriteRecordBatchAsyncErrors) {
+  std::shared_ptr<RecordBatch> batch, other_batch;
+  ASSERT_OK(MakeIntBatchSized(/*length=*/10, &batch));
+  ASSERT_OK(MakeStringTypesRecordBatch(&other_batch));
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  auto write_options = IpcWriteOptions::Defaults();
+  write_options.max_pending_batches = 0;
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       MakeStreamWriter(sink, batch->schema(), write_options));
+  ASSERT_FINISHES_AND_RAISES(Invalid, writer->WriteRecordBatchAsync(batch));
+
+  ASSERT_OK_AND_ASSIGN(sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(writer, MakeStreamWriter(sink, batch->schema()));
+  ASSERT_FINISHES_OK(writer->WriteRecordBatchAsync(batch));
+  ASSERT_FINISHES_AND_RAISES(Invalid, writer->WriteRecordBatchAsync(other_batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_FINISHES_AND_RAISES(Invalid, writer->WriteRecordBatchAsync(batch));
+}
+
 class EndlessCollectListener : public CollectListener {
  public:
   EndlessCollectListener() : CollectListener(), decoder_(nullptr) {}
@@ -2735,8 +3088,8 @@ class TestDictionaryReplacement : public ::testing::Test {
 };
 
 using DictionaryReplacementTestTypes =
-    ::testing::Types<StreamWriterHelper, StreamDecoderBufferWriterHelper,
-                     FileWriterHelper>;
+    ::testing::Types<StreamWriterHelper, PipelinedStreamWriterHelper,
+                     StreamDecoderBufferWriterHelper, FileWriterHelper>;
 
 TYPED_TEST_SUITE(TestDictionaryReplacement, DictionaryReplacementTestTypes);
 
@@ -3078,10 +3431,15 @@ class PreBufferingTest : public ::testing::TestWithParam<bool> {
     file_buffer_ = MakeBooleanInt32Int64File(kRowsPerBatch, kNumBatches);
   }
 
-  void OpenReader() {
-    buffer_reader_ = std::make_shared<io::BufferReader>(file_buffer_);
+  void OpenReader(std::vector<int> included_fields = {}, bool zero_copy = true) {
+    if (zero_copy) {
+      buffer_reader_ = std::make_shared<io::BufferReader>(file_buffer_);
+    } else {
+      buffer_reader_ = std::make_shared<NoZeroCopyBufferReader>(file_buffer_);
+    }
     tracked_ = io::TrackedRandomAccessFile::Make(buffer_reader_.get());
     auto read_options = IpcReadOptions::Defaults();
+    read_options.included_fields = std::move(included_fields);
     if (ReadsArePlugged()) {
       // This will ensure that all reads get globbed together into one large read
       read_options.pre_buffer_cache_options.hole_size_limit =
@@ -3173,6 +3531,73 @@ TEST_P(PreBufferingTest, MetadataOnlySomeBatches) {
   CheckFileRead(3);
 }
 
+TEST_P(PreBufferingTest, BatchesWithColumns) {
+  // Only read the int64 field
+  OpenReader({2});
+  auto expected_batches = LoadExpected();
+  ASSERT_OK(reader_->PreBufferMetadata({1, 2, 3}));
+  AssertMetadataLoaded({1, 2, 3});
+  const auto& read_ranges = tracked_->get_read_ranges();
+  const std::size_t starting_reads = read_ranges.size();
+
+  ASSERT_OK(reader_->PreBufferBatches({1, 2, 3}));
+  for (int i : {1, 2, 3}) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader_->ReadRecordBatch(i));
+    ASSERT_OK_AND_ASSIGN(auto expected, expected_batches[i]->SelectColumns({2}));
+    AssertBatchesEqual(*expected, *batch);
+  }
+  // The int64 buffers of the three batches are coalesced into a single read
+  ASSERT_EQ(read_ranges.size(), starting_reads + 1);
+  if (!ReadsArePlugged()) {
+    // ... which doesn't include the other fields of the first and last batches
+    ASSERT_LT(read_ranges.back().length, 3 * kRowsPerBatch * (4 + 8));
+  }
+
+  // The buffered data is dropped once read, reading again goes to the file
+  ASSERT_OK_AND_ASSIGN(auto batch, reader_->ReadRecordBatch(2));
+  ASSERT_OK_AND_ASSIGN(auto expected, expected_batches[2]->SelectColumns({2}));
+  AssertBatchesEqual(*expected, *batch);
+  ASSERT_EQ(read_ranges.size(), starting_reads + 2);
+}
+
+TEST_P(PreBufferingTest, BatchesWithOtherColumns) {
+  OpenReader({1, 2});
+  auto expected_batches = LoadExpected();
+  // The buffered columns don't cover the included fields, so the batches are read
+  // from the file
+  ASSERT_OK(reader_->PreBufferBatches({}, {0, 2}));
+  for (int i = 0; i < kNumBatches; i++) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader_->ReadRecordBatch(i));
+    ASSERT_OK_AND_ASSIGN(auto expected, expected_batches[i]->SelectColumns({1, 2}));
+    AssertBatchesEqual(*expected, *batch);
+  }
+
+  ASSERT_RAISES(Invalid, reader_->PreBufferBatches({kNumBatches}));
+  ASSERT_RAISES(Invalid, reader_->PreBufferBatches({0}, {3}));
+}
+
+TEST_P(PreBufferingTest, GeneratorWithColumns) {
+  // The selected batches and columns are pre-buffered when coalescing
+  OpenReader({0, 2}, /*zero_copy=*/false);
+  auto expected_batches = LoadExpected();
+  ASSERT_OK(reader_->PreBufferMetadata({1, 2, 3}));
+  AssertMetadataLoaded({1, 2, 3});
+  const auto& read_ranges = tracked_->get_read_ranges();
+  const std::size_t starting_reads = read_ranges.size();
+
+  std::vector<int> indices = {3, 1, 2};
+  ASSERT_OK_AND_ASSIGN(auto generator,
+                       reader_->GetRecordBatchGenerator(indices, /*coalesce=*/true));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(generator));
+  ASSERT_EQ(batches.size(), indices.size());
+  for (size_t i = 0; i < batches.size(); i++) {
+    ASSERT_OK_AND_ASSIGN(auto expected,
+                         expected_batches[indices[i]]->SelectColumns({0, 2}));
+    AssertBatchesEqual(*expected, *batches[i]);
+  }
+  ASSERT_EQ(read_ranges.size(), starting_reads + 1);
+}
+
 INSTANTIATE_TEST_SUITE_P(PreBufferingTests, PreBufferingTest,
                          ::testing::Values(false, true),
                          [](const ::testing::TestParamInfo<bool>& info) {
@@ -20,8 +20,10 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
@@ -40,6 +42,7 @@
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
 #include "arrow/ipc/reader_internal.h"
+#include "arrow/ipc/statistics_internal.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
@@ -569,7 +572,10 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
   auto buffers = BufferAccumulator{}.Get(*fields);
 
   std::unique_ptr<util::Codec> codec;
-  ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
+  ARROW_ASSIGN_OR_RAISE(
+      codec, util::Codec::Create(compression, options.codec_options
+                                                  ? *options.codec_options
+                                                  : util::CodecOptions{}));
 
   return ::arrow::internal::OptionalParallelFor(
       options.use_threads, static_cast<int>(buffers.size()), [&](int i) {
@@ -632,7 +638,8 @@ Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
   if (context.swap_endian) {
     for (auto& filtered_column : filtered_columns) {
       ARROW_ASSIGN_OR_RAISE(filtered_column,
-                            arrow::internal::SwapEndianArrayData(filtered_column));
+                            arrow::internal::SwapEndianArrayData(
+                                std::move(filtered_column), context.options.memory_pool));
     }
   }
   return RecordBatch::Make(std::move(filtered_schema), metadata->length(),
@@ -845,8 +852,9 @@ Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
 
   // swap endian in dict_data if necessary (swap_endian == true)
   if (context.swap_endian) {
-    ARROW_ASSIGN_OR_RAISE(dict_data, ::arrow::internal::SwapEndianArrayData(
-                                         dict_data, context.options.memory_pool));
+    ARROW_ASSIGN_OR_RAISE(dict_data,
+                          ::arrow::internal::SwapEndianArrayData(
+                              std::move(dict_data), context.options.memory_pool));
   }
 
   if (dictionary_batch->isDelta()) {
@@ -976,6 +984,24 @@ class StreamDecoderInternal : public MessageDecoderListener {
 
   int num_read_initial_dictionaries() const { return num_read_initial_dictionaries_; }
 
+ protected:
+  // Decode a record batch message without notifying the listener.  This may be
+  // called concurrently as long as no dictionary message is decoded meanwhile.
+  Result<RecordBatchWithMetadata> DecodeRecordBatch(const Message& message,
+                                                    const IpcReadOptions& options) {
+    CHECK_HAS_BODY(message);
+    ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
+    IpcReadContext context(&dictionary_memo_, options, swap_endian_);
+    return ReadRecordBatchInternal(*message.metadata(), schema_, field_inclusion_mask_,
+                                   context, reader.get());
+  }
+
+  // Account for a record batch message decoded with DecodeRecordBatch()
+  void CountRecordBatchMessage() {
+    ++stats_.num_messages;
+    ++stats_.num_record_batches;
+  }
+
  private:
   Status OnSchemaMessageDecoded(std::unique_ptr<Message> message) {
     RETURN_NOT_OK(UnpackSchemaMessage(*message, options_, &dictionary_memo_, &schema_,
@@ -1012,13 +1038,8 @@ class StreamDecoderInternal : public MessageDecoderListener {
     if (message->type() == MessageType::DICTIONARY_BATCH) {
       return ReadDictionary(*message);
     } else {
-      CHECK_HAS_BODY(*message);
-      ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
-      IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
-      ARROW_ASSIGN_OR_RAISE(
-          auto batch_with_metadata,
-          ReadRecordBatchInternal(*message->metadata(), schema_, field_inclusion_mask_,
-                                  context, reader.get()));
+      ARROW_ASSIGN_OR_RAISE(auto batch_with_metadata,
+                            DecodeRecordBatch(*message, options_));
       ++stats_.num_record_batches;
       return listener_->OnRecordBatchWithMetadataDecoded(batch_with_metadata);
     }
@@ -1066,7 +1087,17 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
                               const IpcReadOptions& options)
       : RecordBatchStreamReader(),
         StreamDecoderInternal(std::make_shared<CollectListener>(), options),
-        message_reader_(std::move(message_reader)) {}
+        message_reader_(std::move(message_reader)),
+        decode_options_(options) {
+    // Batches are decoded in parallel, so their buffers are decompressed serially
+    decode_options_.use_threads = false;
+  }
+
+  ~RecordBatchStreamReaderImpl() override {
+    for (const auto& batch : decoding_batches_) {
+      batch.Wait();
+    }
+  }
 
   Status Init() {
     // Read schema
@@ -1084,31 +1115,16 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
   }
 
   Result<RecordBatchWithMetadata> ReadNext() override {
+    if (decode_options_.batch_readahead > 0) {
+      return ReadNextPipelined();
+    }
     auto collect_listener = checked_cast<CollectListener*>(raw_listener());
     while (collect_listener->num_record_batches() == 0 &&
            state() != StreamDecoderInternal::State::EOS) {
       ARROW_ASSIGN_OR_RAISE(auto message, message_reader_->ReadNextMessage());
       if (!message) {  // End of stream
-        if (state() == StreamDecoderInternal::State::INITIAL_DICTIONARIES) {
-          if (num_read_initial_dictionaries() == 0) {
-            // ARROW-6006: If we fail to find any dictionaries in the
-            // stream, then it may be that the stream has a schema
-            // but no actual data. In such case we communicate that
-            // we were unable to find the dictionaries (but there was
-            // no failure otherwise), so the caller can decide what
-            // to do
-            return RecordBatchWithMetadata{nullptr, nullptr};
-          } else {
-            // ARROW-6126, the stream terminated before receiving the
-            // expected number of dictionaries
-            return Status::Invalid(
-                "IPC stream ended without reading the "
-                "expected number (",
-                num_required_initial_dictionaries(), ") of dictionaries");
-          }
-        } else {
-          return RecordBatchWithMetadata{nullptr, nullptr};
-        }
+        RETURN_NOT_OK(CheckEndOfStream());
+        return RecordBatchWithMetadata{nullptr, nullptr};
       }
       ARROW_RETURN_NOT_OK(OnMessageDecoded(std::move(message)));
     }
@@ -1122,7 +1138,81 @@ class RecordBatchStreamReaderImpl : public RecordBatchStreamReader,
   ReadStats stats() const override { return StreamDecoderInternal::stats(); }
 
  private:
+  Status CheckEndOfStream() const {
+    if (state() == StreamDecoderInternal::State::INITIAL_DICTIONARIES &&
+        num_read_initial_dictionaries() != 0) {
+      // ARROW-6126, the stream terminated before receiving the
+      // expected number of dictionaries
+      return Status::Invalid(
+          "IPC stream ended without reading the "
+          "expected number (",
+          num_required_initial_dictionaries(), ") of dictionaries");
+    }
+    // ARROW-6006: If we fail to find any dictionaries in the
+    // stream, then it may be that the stream has a schema
+    // but no actual data. In such case we communicate that
+    // we were unable to find the dictionaries (but there was
+    // no failure otherwise), so the caller can decide what
+    // to do
+    return Status::OK();
+  }
+
+  // Read the next messages while the record batches read before are decoded on
+  // the CPU thread pool, keeping up to batch_readahead batches in flight
+  Result<RecordBatchWithMetadata> ReadNextPipelined() {
+    while (static_cast<int>(decoding_batches_.size()) < decode_options_.batch_readahead &&
+           !end_of_messages_) {
+      ARROW_ASSIGN_OR_RAISE(auto message, message_reader_->ReadNextMessage());
+      if (!message) {  // End of stream
+        RETURN_NOT_OK(CheckEndOfStream());
+        end_of_messages_ = true;
+      } else if (state() == StreamDecoderInternal::State::RECORD_BATCHES &&
+                 message->type() != MessageType::DICTIONARY_BATCH) {
+        CountRecordBatchMessage();
+        if (decode_next_batch_inline_) {
+          // Decoding the first batch after a delta dictionary concatenates the
+          // dictionary in the memo, which must not happen concurrently
+          decoding_batches_.push_back(
+              Future<RecordBatchWithMetadata>::MakeFinished(
+                  DecodeRecordBatch(*message, decode_options_)));
+          decode_next_batch_inline_ = false;
+        } else {
+          decoding_batches_.push_back(DecodeRecordBatchAsync(std::move(message)));
+        }
+      } else {
+        // Dictionaries must not change while record batches are decoded
+        for (const auto& batch : decoding_batches_) {
+          batch.Wait();
+        }
+        const int64_t num_dictionary_deltas = stats().num_dictionary_deltas;
+        ARROW_RETURN_NOT_OK(OnMessageDecoded(std::move(message)));
+        if (stats().num_dictionary_deltas != num_dictionary_deltas) {
+          decode_next_batch_inline_ = true;
+        }
+      }
+    }
+    if (decoding_batches_.empty()) {
+      return RecordBatchWithMetadata{nullptr, nullptr};
+    }
+    auto batch = std::move(decoding_batches_.front());
+    decoding_batches_.pop_front();
+    return batch.result();
+  }
+
+  Future<RecordBatchWithMetadata> DecodeRecordBatchAsync(
+      std::unique_ptr<Message> message) {
+    std::shared_ptr<Message> shared_message = std::move(message);
+    return DeferNotOk(::arrow::internal::GetCpuThreadPool()->Submit(
+        [this, shared_message]() -> Result<RecordBatchWithMetadata> {
+          return DecodeRecordBatch(*shared_message, decode_options_);
+        }));
+  }
+
   std::unique_ptr<MessageReader> message_reader_;
+  IpcReadOptions decode_options_;
+  std::deque<Future<RecordBatchWithMetadata>> decoding_batches_;
+  bool end_of_messages_ = false;
+  bool decode_next_batch_inline_ = false;
 };
 
 // ----------------------------------------------------------------------
@@ -1196,7 +1286,7 @@ class RecordBatchFileReaderImpl;
 
 /// A generator of record batches.
 ///
-/// All batches are yielded in order.
+/// The selected batches are yielded in order.
 class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
  public:
   using Item = std::shared_ptr<RecordBatch>;
@@ -1204,9 +1294,11 @@ class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
   explicit WholeIpcFileRecordBatchGenerator(
       std::shared_ptr<RecordBatchFileReaderImpl> state,
       std::shared_ptr<io::internal::ReadRangeCache> cached_source,
-      const io::IOContext& io_context, arrow::internal::Executor* executor)
+      std::vector<int> batch_indices, const io::IOContext& io_context,
+      arrow::internal::Executor* executor)
       : state_(std::move(state)),
         cached_source_(std::move(cached_source)),
+        batch_indices_(std::move(batch_indices)),
         io_context_(io_context),
         executor_(executor),
         index_(0) {}
@@ -1223,9 +1315,10 @@ class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
  private:
   std::shared_ptr<RecordBatchFileReaderImpl> state_;
   std::shared_ptr<io::internal::ReadRangeCache> cached_source_;
+  std::vector<int> batch_indices_;
   io::IOContext io_context_;
   arrow::internal::Executor* executor_;
-  int index_;
+  size_t index_;
   // Odd Future type, but this lets us use All() easily
   Future<> read_dictionaries_;
 };
@@ -1233,20 +1326,21 @@ class ARROW_EXPORT WholeIpcFileRecordBatchGenerator {
 /// A generator of record batches for use when reading
 /// a subset of columns from the file.
 ///
-/// All batches are yielded in order.
+/// The selected batches are yielded in order.
 class ARROW_EXPORT SelectiveIpcFileRecordBatchGenerator {
  public:
   using Item = std::shared_ptr<RecordBatch>;
 
-  explicit SelectiveIpcFileRecordBatchGenerator(
-      std::shared_ptr<RecordBatchFileReaderImpl> state)
-      : state_(std::move(state)), index_(0) {}
+  SelectiveIpcFileRecordBatchGenerator(std::shared_ptr<RecordBatchFileReaderImpl> state,
+                                       std::vector<int> batch_indices)
+      : state_(std::move(state)), batch_indices_(std::move(batch_indices)), index_(0) {}
 
   Future<Item> operator()();
 
  private:
   std::shared_ptr<RecordBatchFileReaderImpl> state_;
-  int index_;
+  std::vector<int> batch_indices_;
+  size_t index_;
 };
 
 class RecordBatchFileReaderImpl : public RecordBatchFileReader {
@@ -1353,8 +1447,13 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   Result<int64_t> CountRows() override {
     int64_t total = 0;
     for (int i = 0; i < num_record_batches(); i++) {
+      // Only the metadata holds the batch length so the body is never read
+      FileBlock block = GetRecordBatchBlock(i);
+      RETURN_NOT_OK(CheckAligned(block));
+      ARROW_ASSIGN_OR_RAISE(auto block_metadata,
+                            file_->ReadAt(block.offset, block.metadata_length));
       ARROW_ASSIGN_OR_RAISE(auto outer_message,
-                            ReadMessageFromBlock(GetRecordBatchBlock(i)));
+                            ReadMessage(std::move(block_metadata), /*body=*/nullptr));
       auto metadata = outer_message->metadata();
       const flatbuf::Message* message = nullptr;
       RETURN_NOT_OK(
@@ -1435,10 +1534,58 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
 
   ReadStats stats() const override { return stats_.poll(); }
 
+  Result<std::vector<RecordBatchStatistics>> ReadStatistics() const override {
+    const int index =
+        metadata_ ? metadata_->FindKey(internal::kStatisticsMetadataKey) : -1;
+    if (index < 0) {
+      return std::vector<RecordBatchStatistics>{};
+    }
+    ARROW_ASSIGN_OR_RAISE(auto statistics,
+                          internal::ParseStatistics(metadata_->value(index), *schema_,
+                                                    num_record_batches()));
+    if (!field_inclusion_mask_.empty()) {
+      // Index the columns by field of the read schema
+      for (auto& batch_statistics : statistics) {
+        std::vector<std::optional<ColumnStatistics>> columns;
+        for (size_t i = 0; i < field_inclusion_mask_.size(); ++i) {
+          if (field_inclusion_mask_[i]) {
+            columns.push_back(std::move(batch_statistics.columns[i]));
+          }
+        }
+        batch_statistics.columns = std::move(columns);
+      }
+    }
+    return statistics;
+  }
+
   Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
       const bool coalesce, const io::IOContext& io_context,
       const io::CacheOptions cache_options,
       arrow::internal::Executor* executor) override {
+    return MakeRecordBatchGenerator(AllIndices(), /*all_batches=*/true, coalesce,
+                                    io_context, cache_options, executor);
+  }
+
+  Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      std::vector<int> batch_indices, const bool coalesce,
+      const io::IOContext& io_context, const io::CacheOptions cache_options,
+      arrow::internal::Executor* executor) override {
+    bool all_batches = batch_indices.size() == static_cast<size_t>(num_record_batches());
+    for (size_t i = 0; i < batch_indices.size(); ++i) {
+      if (batch_indices[i] < 0 || batch_indices[i] >= num_record_batches()) {
+        return Status::Invalid("The file only has ", num_record_batches(),
+                               " record batches");
+      }
+      all_batches &= batch_indices[i] == static_cast<int>(i);
+    }
+    return MakeRecordBatchGenerator(std::move(batch_indices), all_batches, coalesce,
+                                    io_context, cache_options, executor);
+  }
+
+  Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> MakeRecordBatchGenerator(
+      std::vector<int> batch_indices, bool all_batches, const bool coalesce,
+      const io::IOContext& io_context, const io::CacheOptions cache_options,
+      arrow::internal::Executor* executor) {
     auto state = std::dynamic_pointer_cast<RecordBatchFileReaderImpl>(shared_from_this());
     // Prebuffering causes us to use a lot of futures which, at the moment,
     // can only slow things down when we are doing zero-copy in-memory reads.
@@ -1449,21 +1596,43 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     if (options_.included_fields.size() != 0 &&
         options_.included_fields.size() != schema_->fields().size() &&
         !file_->supports_zero_copy()) {
-      RETURN_NOT_OK(state->PreBufferMetadata({}));
-      return SelectiveIpcFileRecordBatchGenerator(std::move(state));
+      if (!batch_indices.empty() && coalesce) {
+        // Coalesce the reads of the selected columns across batches
+        RETURN_NOT_OK(state->DoPreBufferBatches(batch_indices, field_inclusion_mask_,
+                                                io_context, cache_options));
+      } else if (!batch_indices.empty()) {
+        RETURN_NOT_OK(state->PreBufferMetadata(batch_indices));
+      }
+      return SelectiveIpcFileRecordBatchGenerator(std::move(state),
+                                                  std::move(batch_indices));
     }
 
     std::shared_ptr<io::internal::ReadRangeCache> cached_source;
     if (coalesce && !file_->supports_zero_copy()) {
       if (!owned_file_) return Status::Invalid("Cannot coalesce without an owned file");
-      // Since the user is asking for all fields then we can cache the entire
-      // file (up to the footer)
       cached_source = std::make_shared<io::internal::ReadRangeCache>(file_, io_context,
                                                                      cache_options);
-      RETURN_NOT_OK(cached_source->Cache({{0, footer_offset_}}));
+      if (all_batches) {
+        // Since the user is asking for all fields then we can cache the entire
+        // file (up to the footer)
+        RETURN_NOT_OK(cached_source->Cache({{0, footer_offset_}}));
+      } else {
+        // Only cache the dictionaries and the selected record batches
+        std::vector<io::ReadRange> ranges;
+        for (int i = 0; i < num_dictionaries(); ++i) {
+          FileBlock block = GetDictionaryBlock(i);
+          ranges.push_back({block.offset, block.metadata_length + block.body_length});
+        }
+        for (int index : batch_indices) {
+          FileBlock block = GetRecordBatchBlock(index);
+          ranges.push_back({block.offset, block.metadata_length + block.body_length});
+        }
+        RETURN_NOT_OK(cached_source->Cache(std::move(ranges)));
+      }
     }
     return WholeIpcFileRecordBatchGenerator(std::move(state), std::move(cached_source),
-                                            io_context, executor);
+                                            std::move(batch_indices), io_context,
+                                            executor);
   }
 
   Status DoPreBufferMetadata(const std::vector<int>& indices) {
@@ -1499,6 +1668,80 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     }
   }
 
+  Status DoPreBufferBatches(const std::vector<int>& indices, std::vector<bool> columns,
+                            const io::IOContext& io_context,
+                            const io::CacheOptions& cache_options) {
+    std::vector<int> unique_indices;
+    std::vector<int> uncached_indices;
+    std::unordered_set<int> seen_indices;
+    for (int index : indices) {
+      if (!seen_indices.insert(index).second) {
+        continue;
+      }
+      unique_indices.push_back(index);
+      if (cached_metadata_.find(index) == cached_metadata_.end()) {
+        uncached_indices.push_back(index);
+      }
+    }
+    if (!uncached_indices.empty()) {
+      RETURN_NOT_OK(DoPreBufferMetadata(uncached_indices));
+    }
+    std::vector<Future<std::shared_ptr<Message>>> metadatas;
+    for (int index : unique_indices) {
+      metadatas.push_back(cached_metadata_[index]);
+    }
+
+    auto body_cache =
+        owned_file_ ? std::make_shared<io::internal::ReadRangeCache>(
+                          owned_file_, io_context, cache_options)
+                    : std::make_shared<io::internal::ReadRangeCache>(file_, io_context,
+                                                                     cache_options);
+    // The body ranges are known once the metadata is read.  They are cached
+    // together so that they are coalesced across batches.
+    auto self = std::dynamic_pointer_cast<RecordBatchFileReaderImpl>(shared_from_this());
+    auto all_body_ranges = All(std::move(metadatas)).Then(
+        [self, unique_indices, columns, body_cache](
+            const std::vector<Result<std::shared_ptr<Message>>>& maybe_messages) {
+          return self->CacheBodyRanges(unique_indices, maybe_messages, columns,
+                                       body_cache.get());
+        });
+    for (size_t i = 0; i < unique_indices.size(); ++i) {
+      auto body_ranges = all_body_ranges.Then(
+          [i](const std::vector<std::vector<io::ReadRange>>& body_ranges) {
+            return body_ranges[i];
+          });
+      cached_bodies_[unique_indices[i]] =
+          CachedBody{columns, body_cache, std::move(body_ranges)};
+    }
+    return Status::OK();
+  }
+
+  Status PreBufferBatches(const std::vector<int>& indices,
+                          const std::vector<int>& columns) override {
+    for (int index : indices) {
+      if (index < 0 || index >= num_record_batches()) {
+        return Status::Invalid("The file only has ", num_record_batches(),
+                               " record batches");
+      }
+    }
+    std::vector<bool> column_mask = field_inclusion_mask_;
+    if (!columns.empty()) {
+      column_mask.assign(schema_->num_fields(), false);
+      for (int column : columns) {
+        if (column < 0 || column >= schema_->num_fields()) {
+          return Status::Invalid("Out of bounds field index: ", column);
+        }
+        column_mask[column] = true;
+      }
+    }
+    // Start reading the bodies as soon as their ranges are known
+    io::CacheOptions cache_options = options_.pre_buffer_cache_options;
+    cache_options.lazy = false;
+    return DoPreBufferBatches(indices.empty() ? AllIndices() : indices,
+                              std::move(column_mask), file_->io_context(),
+                              cache_options);
+  }
+
  private:
   friend class WholeIpcFileRecordBatchGenerator;
 
@@ -1619,6 +1862,59 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return metadata_cache_->WaitFor(std::move(ranges));
   }
 
+  // Return the ranges of the body buffers of the given columns of a batch
+  Result<std::vector<io::ReadRange>> GetBodyRanges(
+      int index, const std::shared_ptr<Message>& message_obj,
+      const std::vector<bool>& columns) {
+    ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
+    ARROW_ASSIGN_OR_RAISE(auto batch, GetBatchFromMessage(message));
+    FileBlock block = GetRecordBatchBlock(index);
+    ArrayLoader loader(batch, internal::GetMetadataVersion(message->version()),
+                       options_,
+                       block.offset + static_cast<int64_t>(block.metadata_length));
+    for (int i = 0; i < schema_->num_fields(); ++i) {
+      const Field& field = *schema_->field(i);
+      if (columns.empty() || columns[i]) {
+        // Only compute the ranges, the buffers are not read
+        ArrayData column;
+        RETURN_NOT_OK(loader.Load(&field, &column));
+      } else {
+        RETURN_NOT_OK(loader.SkipField(&field));
+      }
+    }
+    return loader.read_request().ranges_to_read();
+  }
+
+  Result<std::vector<std::vector<io::ReadRange>>> CacheBodyRanges(
+      const std::vector<int>& indices,
+      const std::vector<Result<std::shared_ptr<Message>>>& maybe_messages,
+      const std::vector<bool>& columns, io::internal::ReadRangeCache* body_cache) {
+    ARROW_ASSIGN_OR_RAISE(auto messages, arrow::internal::UnwrapOrRaise(maybe_messages));
+    std::vector<std::vector<io::ReadRange>> body_ranges(messages.size());
+    std::vector<io::ReadRange> ranges;
+    for (size_t i = 0; i < messages.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(body_ranges[i],
+                            GetBodyRanges(indices[i], messages[i], columns));
+      ranges.insert(ranges.end(), body_ranges[i].begin(), body_ranges[i].end());
+    }
+    RETURN_NOT_OK(body_cache->Cache(std::move(ranges)));
+    return body_ranges;
+  }
+
+  // Whether a body pre-buffered for the given columns holds the fields to read
+  bool CoversIncludedFields(const std::vector<bool>& columns) const {
+    if (columns.empty()) {
+      return true;
+    }
+    for (size_t i = 0; i < columns.size(); ++i) {
+      const bool included = field_inclusion_mask_.empty() || field_inclusion_mask_[i];
+      if (included && !columns[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   Result<IpcReadContext> GetIpcReadContext(const flatbuf::Message* message,
                                            const flatbuf::RecordBatch* batch) {
     IpcReadContext context(&dictionary_memo_, options_, swap_endian_);
@@ -1707,10 +2003,11 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       return cache.WaitFor(loader.read_request().ranges_to_read());
     }
 
-    Result<std::shared_ptr<RecordBatch>> CreateRecordBatch() {
+    Result<std::shared_ptr<RecordBatch>> CreateRecordBatch(
+        io::internal::ReadRangeCache* source) {
       std::vector<std::shared_ptr<Buffer>> buffers;
       for (const auto& range_to_read : loader.read_request().ranges_to_read()) {
-        ARROW_ASSIGN_OR_RAISE(auto buffer, cache.Read(range_to_read));
+        ARROW_ASSIGN_OR_RAISE(auto buffer, source->Read(range_to_read));
         buffers.push_back(std::move(buffer));
       }
       loader.read_request().FulfillRequest(buffers);
@@ -1735,7 +2032,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
         for (int i = 0; i < static_cast<int>(filtered_columns.size()); ++i) {
           ARROW_ASSIGN_OR_RAISE(filtered_columns[i],
                                 arrow::internal::SwapEndianArrayData(
-                                    filtered_columns[i], context.options.memory_pool));
+                                    std::move(filtered_columns[i]),
+                                    context.options.memory_pool));
         }
       }
       return RecordBatch::Make(std::move(filtered_schema), length,
@@ -1760,8 +2058,16 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   Future<std::shared_ptr<RecordBatch>> ReadCachedRecordBatch(
       int index, Future<std::shared_ptr<Message>> message_fut) {
     stats_.num_record_batches.fetch_add(1, std::memory_order_relaxed);
+    // A body pre-buffered by PreBufferBatches is only used once, its data is
+    // released after the batch is read
+    std::optional<CachedBody> cached_body;
+    auto it = cached_bodies_.find(index);
+    if (it != cached_bodies_.end() && CoversIncludedFields(it->second.columns)) {
+      cached_body = std::move(it->second);
+      cached_bodies_.erase(it);
+    }
     return dictionary_load_finished_.Then([message_fut] { return message_fut; })
-        .Then([this, index](const std::shared_ptr<Message>& message_obj)
+        .Then([this, index, cached_body](const std::shared_ptr<Message>& message_obj)
                   -> Future<std::shared_ptr<RecordBatch>> {
           FileBlock block = GetRecordBatchBlock(index);
           ARROW_ASSIGN_OR_RAISE(auto message, GetFlatbufMessage(message_obj));
@@ -1772,8 +2078,23 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
               schema_, batch, std::move(context), file_, owned_file_,
               block.offset + static_cast<int64_t>(block.metadata_length));
           RETURN_NOT_OK(read_context->CalculateLoadRequest());
-          return read_context->ReadAsync().Then(
-              [read_context] { return read_context->CreateRecordBatch(); });
+          if (cached_body.has_value()) {
+            auto body_cache = cached_body->cache;
+            return cached_body->ranges.Then(
+                [read_context, body_cache](const std::vector<io::ReadRange>& ranges) {
+                  return body_cache->WaitFor(ranges).Then(
+                      [read_context, body_cache,
+                       ranges]() -> Result<std::shared_ptr<RecordBatch>> {
+                        ARROW_ASSIGN_OR_RAISE(auto batch, read_context->CreateRecordBatch(
+                                                              body_cache.get()));
+                        RETURN_NOT_OK(body_cache->Release(ranges));
+                        return batch;
+                      });
+                });
+          }
+          return read_context->ReadAsync().Then([read_context] {
+            return read_context->CreateRecordBatch(&read_context->cache);
+          });
         });
   }
 
@@ -1873,6 +2194,16 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
   std::unordered_map<int, Future<std::shared_ptr<Message>>> cached_metadata_;
   std::unordered_map<int, Future<>> cached_data_requests_;
 
+  // A record batch body pre-buffered by PreBufferBatches
+  struct CachedBody {
+    // The top-level fields buffered, all of them if empty
+    std::vector<bool> columns;
+    std::shared_ptr<io::internal::ReadRangeCache> cache;
+    // The ranges of the buffers of the fields, known once the metadata is read
+    Future<std::vector<io::ReadRange>> ranges;
+  };
+  std::unordered_map<int, CachedBody> cached_bodies_;
+
   bool swap_endian_;
 };
 
@@ -1947,11 +2278,10 @@ Result<std::shared_ptr<Table>> RecordBatchFileReader::ToTable() {
 
 Future<SelectiveIpcFileRecordBatchGenerator::Item>
 SelectiveIpcFileRecordBatchGenerator::operator()() {
-  int index = index_++;
-  if (index >= state_->num_record_batches()) {
+  if (index_ >= batch_indices_.size()) {
     return IterationEnd<SelectiveIpcFileRecordBatchGenerator::Item>();
   }
-  return state_->ReadRecordBatchAsync(index);
+  return state_->ReadRecordBatchAsync(batch_indices_[index_++]);
 }
 
 Future<WholeIpcFileRecordBatchGenerator::Item>
@@ -1973,10 +2303,11 @@ WholeIpcFileRecordBatchGenerator::operator()() {
           return ReadDictionaries(state.get(), std::move(messages));
         });
   }
-  if (index_ >= state_->num_record_batches()) {
+  if (index_ >= batch_indices_.size()) {
     return Future<Item>::MakeFinished(IterationTraits<Item>::End());
   }
-  auto block = FileBlockFromFlatbuffer(state->footer_->recordBatches()->Get(index_++));
+  auto block = FileBlockFromFlatbuffer(
+      state->footer_->recordBatches()->Get(batch_indices_[index_++]));
   auto read_message = ReadBlock(block);
   auto read_messages = read_dictionaries_.Then([read_message]() { return read_message; });
   // Force transfer. This may be wasteful in some cases, but ensures we get off the
@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
@@ -61,6 +62,26 @@ struct ReadStats {
   int64_t num_replaced_dictionaries = 0;
 };
 
+/// \brief Statistics of a column of a record batch
+struct ARROW_EXPORT ColumnStatistics {
+  /// The number of null values
+  int64_t null_count = 0;
+  /// The smallest and largest non-null values, or null if the column has no
+  /// non-null values (or has NaN values)
+  std::shared_ptr<Scalar> min;
+  std::shared_ptr<Scalar> max;
+};
+
+/// \brief Statistics of a record batch of an IPC file
+///
+/// \see IpcWriteOptions::write_statistics
+struct ARROW_EXPORT RecordBatchStatistics {
+  int64_t num_rows = 0;
+  /// The statistics of each top-level column, by field index, or std::nullopt
+  /// for the columns of a type without statistics
+  std::vector<std::optional<ColumnStatistics>> columns;
+};
+
 /// \brief Synchronous batch stream reader that reads from io::InputStream
 ///
 /// This class reads the schema (plus any dictionaries) as the first messages
@@ -215,6 +236,35 @@ class ARROW_EXPORT RecordBatchFileReader
   ///                If empty then all batches will be prefetched.
   virtual Status PreBufferMetadata(const std::vector<int>& indices) = 0;
 
+  /// \brief Begin loading the desired batches into memory, reading only the
+  /// body buffers of the desired columns.
+  ///
+  /// This pre-buffers the metadata of the batches as PreBufferMetadata() does.
+  /// Once it is read, the body ranges of the desired columns of all the batches
+  /// are coalesced according to IpcReadOptions::pre_buffer_cache_options and read
+  /// in the background, so that reading a few columns of a wide file takes a few
+  /// large reads instead of many small ones.
+  ///
+  /// Subsequent calls to ReadRecordBatch() for these batches use the buffered
+  /// data if the columns cover the fields selected by
+  /// IpcReadOptions::included_fields.  The data of a batch is dropped once the
+  /// batch is read.
+  ///
+  /// \param indices Indices of the batches to prefetch
+  ///                If empty then all batches will be prefetched.
+  /// \param columns Indices of the top-level fields of the file schema to
+  ///                prefetch.  If empty then the fields selected by
+  ///                IpcReadOptions::included_fields will be prefetched.
+  virtual Status PreBufferBatches(const std::vector<int>& indices,
+                                  const std::vector<int>& columns = {}) = 0;
+
+  /// \brief Return the statistics of the record batches, by batch index
+  ///
+  /// Returns an empty vector if the file was written without statistics.
+  ///
+  /// \see IpcWriteOptions::write_statistics
+  virtual Result<std::vector<RecordBatchStatistics>> ReadStatistics() const = 0;
+
   /// \brief Get a reentrant generator of record batches.
   ///
   /// \param[in] coalesce If true, enable I/O coalescing.
@@ -230,6 +280,19 @@ class ARROW_EXPORT RecordBatchFileReader
       const io::CacheOptions cache_options = io::CacheOptions::LazyDefaults(),
       arrow::internal::Executor* executor = NULLPTR) = 0;
 
+  /// \brief Get a reentrant generator of some record batches, in the given order
+  ///
+  /// Only the selected record batches are read, which allows reading the batches
+  /// matching a filter according to ReadStatistics().
+  ///
+  /// \param[in] batch_indices the indices of the record batches to read
+  /// \see GetRecordBatchGenerator() for the other parameters
+  virtual Result<AsyncGenerator<std::shared_ptr<RecordBatch>>> GetRecordBatchGenerator(
+      std::vector<int> batch_indices, const bool coalesce = false,
+      const io::IOContext& io_context = io::default_io_context(),
+      const io::CacheOptions cache_options = io::CacheOptions::LazyDefaults(),
+      arrow::internal::Executor* executor = NULLPTR) = 0;
+
   /// \brief Collect all batches as a vector of record batches
   Result<RecordBatchVector> ToRecordBatches();
 
@@ -0,0 +1,511 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/shared_memory.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+
+using internal::IOErrorFromErrno;
+
+namespace ipc {
+
+#ifndef _WIN32
+
+namespace {
+
+// The shared memory starts with a header page, followed by the ring.  Positions
+// in the ring increase monotonically; the offset of a position is the position
+// modulo the capacity.  Each message is a record made of a record header, holding
+// the length of the message, followed by the message padded to kRecordAlignment.
+// A record header with length kWrapMarker fills the end of the ring when the next
+// record does not fit there.
+
+constexpr uint64_t kMagic = 0x4152524f57534d31ULL;  // "ARROWSM1"
+constexpr int64_t kHeaderSize = 4096;
+constexpr int64_t kRecordAlignment = 64;
+constexpr uint64_t kWrapMarker = std::numeric_limits<uint64_t>::max();
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared memory positions need lock-free 64-bit atomics");
+static_assert(std::atomic<bool>::is_always_lock_free,
+              "shared memory flags need lock-free atomics");
+
+struct ChannelHeader {
+  uint64_t magic;
+  uint64_t capacity;
+  // Written by the writer only
+  alignas(64) std::atomic<uint64_t> write_pos;
+  std::atomic<bool> writer_closed;
+  // Written by the reader only
+  alignas(64) std::atomic<uint64_t> read_pos;
+  std::atomic<bool> reader_closed;
+};
+
+static_assert(sizeof(ChannelHeader) <= kHeaderSize, "header does not fit its page");
+
+struct RecordHeader {
+  uint64_t length;
+};
+
+// Wait until `ready` returns true: spin first, then yield, then sleep
+template <typename Predicate>
+void WaitUntil(Predicate&& ready) {
+  for (int i = 0; !ready(); ++i) {
+    if (i < 1000) {
+      std::atomic_signal_fence(std::memory_order_seq_cst);
+    } else if (i < 2000) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+    }
+  }
+}
+
+}  // namespace
+
+class SharedMemoryChannel::Impl : public std::enable_shared_from_this<Impl> {
+ public:
+  Impl(int fd, std::string unlink_name, uint8_t* base, int64_t map_size)
+      : fd_(fd),
+        unlink_name_(std::move(unlink_name)),
+        base_(base),
+        map_size_(map_size),
+        header_(reinterpret_cast<ChannelHeader*>(base)),
+        data_(base + kHeaderSize),
+        capacity_(static_cast<int64_t>(header_->capacity)) {}
+
+  ~Impl() {
+    if (munmap(base_, static_cast<size_t>(map_size_)) != 0) {
+      ARROW_LOG(WARNING) << "Failed to unmap shared memory: " << std::strerror(errno);
+    }
+    if (!unlink_name_.empty()) {
+      shm_unlink(unlink_name_.c_str());
+    }
+    close(fd_);
+  }
+
+  static Result<std::shared_ptr<Impl>> Map(int fd, std::string unlink_name,
+                                           int64_t capacity) {
+    auto close_on_error = [&](Status st) {
+      close(fd);
+      if (!unlink_name.empty()) {
+        shm_unlink(unlink_name.c_str());
+      }
+      return st;
+    };
+    int64_t map_size = kHeaderSize + capacity;
+    if (capacity > 0) {
+      // Creating: size the new shared memory, which is zero-filled
+      if (ftruncate(fd, static_cast<off_t>(map_size)) != 0) {
+        return close_on_error(
+            IOErrorFromErrno(errno, "Failed to resize shared memory"));
+      }
+    } else {
+      struct stat st;
+      if (fstat(fd, &st) != 0) {
+        return close_on_error(IOErrorFromErrno(errno, "Failed to stat shared memory"));
+      }
+      map_size = static_cast<int64_t>(st.st_size);
+      if (map_size <= kHeaderSize) {
+        return close_on_error(
+            Status::Invalid("Shared memory is not a SharedMemoryChannel"));
+      }
+    }
+    void* base = mmap(nullptr, static_cast<size_t>(map_size), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+      return close_on_error(IOErrorFromErrno(errno, "Failed to map shared memory"));
+    }
+    auto header = reinterpret_cast<ChannelHeader*>(base);
+    if (capacity > 0) {
+      header->capacity = static_cast<uint64_t>(capacity);
+      new (&header->write_pos) std::atomic<uint64_t>(0);
+      new (&header->writer_closed) std::atomic<bool>(false);
+      new (&header->read_pos) std::atomic<uint64_t>(0);
+      new (&header->reader_closed) std::atomic<bool>(false);
+      std::atomic_thread_fence(std::memory_order_release);
+      header->magic = kMagic;
+    } else if (header->magic != kMagic ||
+               static_cast<int64_t>(header->capacity) != map_size - kHeaderSize) {
+      munmap(base, static_cast<size_t>(map_size));
+      return close_on_error(Status::Invalid("Shared memory is not a SharedMemoryChannel"));
+    }
+    return std::make_shared<Impl>(fd, std::move(unlink_name),
+                                  reinterpret_cast<uint8_t*>(base), map_size);
+  }
+
+  int fd() const { return fd_; }
+  int64_t capacity() const { return capacity_; }
+
+  static int64_t RecordSize(int64_t length) {
+    return kRecordAlignment + bit_util::RoundUpToMultipleOf64(length);
+  }
+
+  // Writer side
+
+  // Wait for space for a message of `length` bytes and return where to write it
+  Result<uint8_t*> Reserve(int64_t length) {
+    const int64_t record_size = RecordSize(length);
+    if (record_size > capacity_) {
+      return Status::Invalid("IPC message of ", length,
+                             " bytes does not fit in a shared memory ring of ",
+                             capacity_, " bytes");
+    }
+    uint64_t pos = header_->write_pos.load(std::memory_order_relaxed);
+    const int64_t offset = static_cast<int64_t>(pos % capacity_);
+    const int64_t wrap_size = offset + record_size > capacity_ ? capacity_ - offset : 0;
+    const uint64_t end = pos + static_cast<uint64_t>(wrap_size + record_size);
+    bool reader_closed = false;
+    WaitUntil([&] {
+      reader_closed = header_->reader_closed.load(std::memory_order_acquire);
+      return reader_closed || end - header_->read_pos.load(std::memory_order_acquire) <=
+                                  static_cast<uint64_t>(capacity_);
+    });
+    if (reader_closed) {
+      return Status::IOError("The reader of the shared memory channel is closed");
+    }
+    if (wrap_size > 0) {
+      RecordAt(pos)->length = kWrapMarker;
+      pos += static_cast<uint64_t>(wrap_size);
+    }
+    reserved_pos_ = pos;
+    return data_ + pos % capacity_ + kRecordAlignment;
+  }
+
+  // Publish the message of `length` bytes written after Reserve()
+  void Commit(int64_t length) {
+    RecordAt(reserved_pos_)->length = static_cast<uint64_t>(length);
+    header_->write_pos.store(reserved_pos_ + RecordSize(length),
+                             std::memory_order_release);
+  }
+
+  void CloseWriter() { header_->writer_closed.store(true, std::memory_order_release); }
+
+  // Reader side
+
+  // Return the next message record, or null at the end of the stream
+  Result<std::shared_ptr<Buffer>> NextRecord() {
+    while (true) {
+      bool writer_closed = false;
+      uint64_t write_pos = 0;
+      WaitUntil([&] {
+        // Load the flag first, so that the messages written before closing are seen
+        writer_closed = header_->writer_closed.load(std::memory_order_acquire);
+        write_pos = header_->write_pos.load(std::memory_order_acquire);
+        return writer_closed || write_pos != consume_pos_;
+      });
+      if (write_pos == consume_pos_) {
+        return nullptr;
+      }
+      const uint64_t start = consume_pos_;
+      const uint64_t length = RecordAt(start)->length;
+      if (length == kWrapMarker) {
+        consume_pos_ += capacity_ - start % capacity_;
+        Release(start, consume_pos_);
+        continue;
+      }
+      consume_pos_ += RecordSize(static_cast<int64_t>(length));
+      return std::make_shared<RecordBuffer>(data_ + start % capacity_ + kRecordAlignment,
+                                            static_cast<int64_t>(length),
+                                            shared_from_this(), start, consume_pos_);
+    }
+  }
+
+  void CloseReader() { header_->reader_closed.store(true, std::memory_order_release); }
+
+  class PayloadWriter;
+  class StreamMessageReader;
+
+ private:
+  // A message record in the ring, which is handed back to the writer once the
+  // buffer and its slices are destroyed
+  class RecordBuffer : public Buffer {
+   public:
+    RecordBuffer(const uint8_t* data, int64_t size, std::shared_ptr<Impl> impl,
+                 uint64_t start, uint64_t end)
+        : Buffer(data, size), impl_(std::move(impl)), start_(start), end_(end) {}
+
+    ~RecordBuffer() override { impl_->Release(start_, end_); }
+
+   private:
+    std::shared_ptr<Impl> impl_;
+    uint64_t start_, end_;
+  };
+
+  RecordHeader* RecordAt(uint64_t pos) {
+    return reinterpret_cast<RecordHeader*>(data_ + pos % capacity_);
+  }
+
+  // Records may be released in any order, but the ring is only reused up to the
+  // first record still held
+  void Release(uint64_t start, uint64_t end) {
+    std::lock_guard<std::mutex> lock(release_mutex_);
+    if (start != released_pos_) {
+      pending_releases_.emplace(start, end);
+      return;
+    }
+    released_pos_ = end;
+    auto it = pending_releases_.begin();
+    while (it != pending_releases_.end() && it->first == released_pos_) {
+      released_pos_ = it->second;
+      it = pending_releases_.erase(it);
+    }
+    header_->read_pos.store(released_pos_, std::memory_order_release);
+  }
+
+  const int fd_;
+  const std::string unlink_name_;
+  uint8_t* const base_;
+  const int64_t map_size_;
+  ChannelHeader* const header_;
+  uint8_t* const data_;
+  const int64_t capacity_;
+
+  // Writer state
+  uint64_t reserved_pos_ = 0;
+
+  // Reader state
+  uint64_t consume_pos_ = 0;
+  std::mutex release_mutex_;
+  uint64_t released_pos_ = 0;
+  std::map<uint64_t, uint64_t> pending_releases_;
+};
+
+class SharedMemoryChannel::Impl::PayloadWriter : public internal::IpcPayloadWriter {
+ public:
+  PayloadWriter(std::shared_ptr<Impl> impl, const IpcWriteOptions& options)
+      : impl_(std::move(impl)), options_(options) {}
+
+  ~PayloadWriter() override {
+    // End the stream even if the writer was not closed, so that the reader does
+    // not wait forever
+    impl_->CloseWriter();
+  }
+
+  Status WritePayload(const IpcPayload& payload) override {
+    const int64_t size = GetPayloadSize(payload, options_);
+    ARROW_ASSIGN_OR_RAISE(uint8_t * data, impl_->Reserve(size));
+    io::FixedSizeBufferWriter stream(std::make_shared<MutableBuffer>(data, size));
+    int32_t metadata_length = 0;
+    RETURN_NOT_OK(WriteIpcPayload(payload, options_, &stream, &metadata_length));
+    ARROW_ASSIGN_OR_RAISE(int64_t written, stream.Tell());
+    DCHECK_EQ(written, size);
+    impl_->Commit(written);
+    return Status::OK();
+  }
+
+  Status Close() override {
+    impl_->CloseWriter();
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<Impl> impl_;
+  const IpcWriteOptions options_;
+};
+
+class SharedMemoryChannel::Impl::StreamMessageReader : public MessageReader {
+ public:
+  explicit StreamMessageReader(std::shared_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+  ~StreamMessageReader() override { impl_->CloseReader(); }
+
+  Result<std::unique_ptr<Message>> ReadNextMessage() override {
+    ARROW_ASSIGN_OR_RAISE(auto record, impl_->NextRecord());
+    if (record == nullptr) {
+      return nullptr;
+    }
+    // The metadata and body of the message are slices of the record
+    io::BufferReader reader(std::move(record));
+    return ReadMessage(&reader);
+  }
+
+ private:
+  std::shared_ptr<Impl> impl_;
+};
+
+SharedMemoryChannel::SharedMemoryChannel(std::shared_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+SharedMemoryChannel::~SharedMemoryChannel() = default;
+
+Result<std::shared_ptr<SharedMemoryChannel>> SharedMemoryChannel::Create(
+    int64_t capacity, const std::string& name) {
+  if (capacity <= 0) {
+    return Status::Invalid("Shared memory channel capacity must be positive");
+  }
+  capacity = bit_util::RoundUpToMultipleOf64(capacity);
+  int fd = -1;
+  if (!name.empty()) {
+    fd = shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+      return IOErrorFromErrno(errno, "Failed to create shared memory '", name, "'");
+    }
+  } else {
+#ifdef __linux__
+    fd = memfd_create("arrow-ipc", 0);
+    if (fd < 0) {
+      return IOErrorFromErrno(errno, "Failed to create shared memory");
+    }
+#else
+    // Create a uniquely named object and unlink it right away
+    static std::atomic<int64_t> counter{0};
+    const std::string tmp_name = "/arrow-ipc-" + std::to_string(getpid()) + "-" +
+                                 std::to_string(counter.fetch_add(1));
+    fd = shm_open(tmp_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) {
+      return IOErrorFromErrno(errno, "Failed to create shared memory");
+    }
+    shm_unlink(tmp_name.c_str());
+#endif
+  }
+  ARROW_ASSIGN_OR_RAISE(auto impl, Impl::Map(fd, name, capacity));
+  return std::shared_ptr<SharedMemoryChannel>(new SharedMemoryChannel(std::move(impl)));
+}
+
+Result<std::shared_ptr<SharedMemoryChannel>> SharedMemoryChannel::Open(
+    const std::string& name) {
+  const int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to open shared memory '", name, "'");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto impl, Impl::Map(fd, "", /*capacity=*/0));
+  return std::shared_ptr<SharedMemoryChannel>(new SharedMemoryChannel(std::move(impl)));
+}
+
+Result<std::shared_ptr<SharedMemoryChannel>> SharedMemoryChannel::Open(int fd) {
+  const int dup_fd = dup(fd);
+  if (dup_fd < 0) {
+    return IOErrorFromErrno(errno, "Failed to duplicate file descriptor");
+  }
+  ARROW_ASSIGN_OR_RAISE(auto impl, Impl::Map(dup_fd, "", /*capacity=*/0));
+  return std::shared_ptr<SharedMemoryChannel>(new SharedMemoryChannel(std::move(impl)));
+}
+
+int SharedMemoryChannel::fd() const { return impl_->fd(); }
+
+int64_t SharedMemoryChannel::capacity() const { return impl_->capacity(); }
+
+Result<std::shared_ptr<RecordBatchWriter>> SharedMemoryChannel::MakeStreamWriter(
+    const std::shared_ptr<Schema>& schema, const IpcWriteOptions& options) {
+  return internal::OpenRecordBatchWriter(
+      std::make_unique<Impl::PayloadWriter>(impl_, options), schema, options);
+}
+
+std::unique_ptr<MessageReader> SharedMemoryChannel::MakeMessageReader() {
+  return std::make_unique<Impl::StreamMessageReader>(impl_);
+}
+
+Status SharedMemoryChannel::WriteRecord(int64_t size,
+                                        const std::function<Status(uint8_t*)>& fill) {
+  ARROW_ASSIGN_OR_RAISE(uint8_t * data, impl_->Reserve(size));
+  RETURN_NOT_OK(fill(data));
+  impl_->Commit(size);
+  return Status::OK();
+}
+
+Result<std::shared_ptr<Buffer>> SharedMemoryChannel::ReadRecord() {
+  return impl_->NextRecord();
+}
+
+void SharedMemoryChannel::CloseWriter() { impl_->CloseWriter(); }
+
+void SharedMemoryChannel::CloseReader() { impl_->CloseReader(); }
+
+#else  // _WIN32
+
+class SharedMemoryChannel::Impl {};
+
+SharedMemoryChannel::SharedMemoryChannel(std::shared_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+SharedMemoryChannel::~SharedMemoryChannel() = default;
+
+Result<std::shared_ptr<SharedMemoryChannel>> SharedMemoryChannel::Create(
+    int64_t, const std::string&) {
+  return Status::NotImplemented("Shared memory channels are not available on Windows");
+}
+
+Result<std::shared_ptr<SharedMemoryChannel>> SharedMemoryChannel::Open(
+    const std::string&) {
+  return Status::NotImplemented("Shared memory channels are not available on Windows");
+}
+
+Result<std::shared_ptr<SharedMemoryChannel>> SharedMemoryChannel::Open(int) {
+  return Status::NotImplemented("Shared memory channels are not available on Windows");
+}
+
+int SharedMemoryChannel::fd() const { return -1; }
+
+int64_t SharedMemoryChannel::capacity() const { return 0; }
+
+Result<std::shared_ptr<RecordBatchWriter>> SharedMemoryChannel::MakeStreamWriter(
+    const std::shared_ptr<Schema>&, const IpcWriteOptions&) {
+  return Status::NotImplemented("Shared memory channels are not available on Windows");
+}
+
+std::unique_ptr<MessageReader> SharedMemoryChannel::MakeMessageReader() {
+  return nullptr;
+}
+
+Status SharedMemoryChannel::WriteRecord(int64_t,
+                                        const std::function<Status(uint8_t*)>&) {
+  return Status::NotImplemented("Shared memory channels are not available on Windows");
+}
+
+Result<std::shared_ptr<Buffer>> SharedMemoryChannel::ReadRecord() {
+  return Status::NotImplemented("Shared memory channels are not available on Windows");
+}
+
+void SharedMemoryChannel::CloseWriter() {}
+
+void SharedMemoryChannel::CloseReader() {}
+
+#endif  // _WIN32
+
+}  // namespace ipc
+}  // namespace arrow
@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Transport of IPC streams between processes through shared memory
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "arrow/ipc/message.h"
+#include "arrow/ipc/options.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace ipc {
+
+/// \class SharedMemoryChannel
+/// \brief A channel carrying an IPC stream between processes through shared memory
+///
+/// The channel is a single-producer single-consumer ring buffer in a shared
+/// memory file.  The writer serializes each IPC message directly into the ring,
+/// and the reader reads it in place: the metadata and body buffers of the
+/// messages read are Buffers referencing the shared memory, which is reused for
+/// new messages once they are released.  Exchanging messages takes neither locks
+/// nor system calls; a side waiting for the other spins briefly, then yields, then
+/// sleeps for short periods.
+///
+/// Each message must fit in the ring, and the writer waits while the ring is full,
+/// that is while the reader holds on to the messages.
+///
+/// This API is EXPERIMENTAL.  It is not available on Windows.
+class ARROW_EXPORT SharedMemoryChannel {
+ public:
+  ~SharedMemoryChannel();
+
+  /// \brief Create a channel in new shared memory, with a ring of at least
+  /// `capacity` bytes
+  ///
+  /// If `name` is empty, the shared memory is anonymous and other processes map
+  /// it through its file descriptor, either inherited or passed over a Unix
+  /// domain socket.  Otherwise it is a POSIX shared memory object which other
+  /// processes open by name, and which is unlinked when this channel is
+  /// destroyed.
+  static Result<std::shared_ptr<SharedMemoryChannel>> Create(
+      int64_t capacity, const std::string& name = "");
+
+  /// \brief Map the channel of the POSIX shared memory object `name`
+  static Result<std::shared_ptr<SharedMemoryChannel>> Open(const std::string& name);
+
+  /// \brief Map the channel of the shared memory file descriptor `fd`
+  ///
+  /// The file descriptor is duplicated, the caller keeps ownership of `fd`.
+  static Result<std::shared_ptr<SharedMemoryChannel>> Open(int fd);
+
+  /// \brief The file descriptor of the shared memory
+  int fd() const;
+
+  /// \brief The capacity of the ring, in bytes
+  int64_t capacity() const;
+
+  /// \brief Create the writer of the IPC stream carried by the channel
+  ///
+  /// Closing the writer ends the stream.  A channel has a single writer.
+  Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
+      const std::shared_ptr<Schema>& schema,
+      const IpcWriteOptions& options = IpcWriteOptions::Defaults());
+
+  /// \brief Create the reader of the messages carried by the channel
+  ///
+  /// Pass it to RecordBatchStreamReader::Open() to read the record batches, or
+  /// give the messages to a StreamDecoder.  A channel has a single reader;
+  /// destroying it makes the writer fail instead of waiting for space.
+  std::unique_ptr<MessageReader> MakeMessageReader();
+
+  /// \name Raw records
+  ///
+  /// For protocols which frame their own messages in the ring, instead of
+  /// carrying an IPC stream.  The two sides of a channel use either the IPC
+  /// stream or the raw records, not both.
+  /// @{
+
+  /// \brief Write a record of `size` bytes, filled in place by `fill`
+  ///
+  /// Waits for space in the ring.  If `fill` fails, the record is not written.
+  Status WriteRecord(int64_t size, const std::function<Status(uint8_t*)>& fill);
+
+  /// \brief Read the next record, or null once the writer is closed
+  ///
+  /// The record references the shared memory, whose space is reused for new
+  /// records once the record and its slices are destroyed.  Records are
+  /// 64-byte aligned.
+  Result<std::shared_ptr<Buffer>> ReadRecord();
+
+  /// \brief End the records, once the reader has read the ones written
+  void CloseWriter();
+
+  /// \brief Stop reading records, making the writer fail instead of waiting for
+  /// space
+  void CloseReader();
+
+  /// @}
+
+ private:
+  class Impl;
+
+  explicit SharedMemoryChannel(std::shared_ptr<Impl> impl);
+
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace ipc
+}  // namespace arrow
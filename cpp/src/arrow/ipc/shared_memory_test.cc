@@ -0,0 +1,217 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/shared_memory.h"
+#include "arrow/ipc/test_common.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace ipc {
+namespace test {
+
+std::vector<std::shared_ptr<RecordBatch>> MakeBatches(int num_batches, int length) {
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < num_batches; ++i) {
+    std::shared_ptr<RecordBatch> batch;
+    ARROW_EXPECT_OK(MakeIntBatchSized(length, &batch, /*seed=*/i));
+    batches.push_back(std::move(batch));
+  }
+  return batches;
+}
+
+Status WriteBatches(SharedMemoryChannel* channel,
+                    const std::vector<std::shared_ptr<RecordBatch>>& batches) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, channel->MakeStreamWriter(batches[0]->schema()));
+  for (const auto& batch : batches) {
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  }
+  return writer->Close();
+}
+
+void CheckReadBatches(SharedMemoryChannel* channel,
+                      const std::vector<std::shared_ptr<RecordBatch>>& expected) {
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       RecordBatchStreamReader::Open(channel->MakeMessageReader()));
+  // Check the batches as they are read: holding on to them all would keep the
+  // writer waiting for space in the ring
+  for (const auto& expected_batch : expected) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+    ASSERT_NE(batch, nullptr);
+    AssertBatchesEqual(*expected_batch, *batch);
+  }
+  ASSERT_OK_AND_ASSIGN(auto end, reader->Next());
+  ASSERT_EQ(end, nullptr);
+}
+
+TEST(TestSharedMemoryChannel, RoundTrip) {
+  ASSERT_OK_AND_ASSIGN(auto channel, SharedMemoryChannel::Create(1 << 20));
+  ASSERT_GE(channel->fd(), 0);
+  ASSERT_EQ(channel->capacity(), 1 << 20);
+
+  auto batches = MakeBatches(/*num_batches=*/20, /*length=*/1000);
+  std::thread writer([&] { ASSERT_OK(WriteBatches(channel.get(), batches)); });
+  CheckReadBatches(channel.get(), batches);
+  writer.join();
+}
+
+TEST(TestSharedMemoryChannel, WrapAround) {
+  // The ring holds only a few batches, so that the writer waits for the reader
+  // and the records wrap around the end of the ring many times
+  auto batches = MakeBatches(/*num_batches=*/100, /*length=*/500);
+  int64_t batch_size = 0;
+  ASSERT_OK(GetRecordBatchSize(*batches[0], &batch_size));
+  ASSERT_OK_AND_ASSIGN(auto channel, SharedMemoryChannel::Create(3 * batch_size + 100));
+
+  std::thread writer([&] { ASSERT_OK(WriteBatches(channel.get(), batches)); });
+  CheckReadBatches(channel.get(), batches);
+  writer.join();
+}
+
+TEST(TestSharedMemoryChannel, HeldMessagesAreNotOverwritten) {
+  auto batches = MakeBatches(/*num_batches=*/50, /*length=*/200);
+  int64_t batch_size = 0;
+  ASSERT_OK(GetRecordBatchSize(*batches[0], &batch_size));
+  ASSERT_OK_AND_ASSIGN(auto channel, SharedMemoryChannel::Create(6 * batch_size));
+
+  std::thread writer([&] { ASSERT_OK(WriteBatches(channel.get(), batches)); });
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       RecordBatchStreamReader::Open(channel->MakeMessageReader()));
+  // Hold on to the first batch while the others go through the ring
+  ASSERT_OK_AND_ASSIGN(auto first, reader->Next());
+  for (size_t i = 1; i < batches.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto batch, reader->Next());
+    ASSERT_NE(batch, nullptr);
+    AssertBatchesEqual(*batches[i], *batch);
+    if (i == 2) {
+      // Let the writer fill the rest of the ring
+      SleepFor(0.05);
+      AssertBatchesEqual(*batches[0], *first);
+      first.reset();
+    }
+  }
+  ASSERT_OK_AND_ASSIGN(auto end, reader->Next());
+  ASSERT_EQ(end, nullptr);
+  writer.join();
+}
+
+TEST(TestSharedMemoryChannel, ReaderClosed) {
+  auto batches = MakeBatches(/*num_batches=*/10, /*length=*/1000);
+  int64_t batch_size = 0;
+  ASSERT_OK(GetRecordBatchSize(*batches[0], &batch_size));
+  ASSERT_OK_AND_ASSIGN(auto channel, SharedMemoryChannel::Create(2 * batch_size));
+
+  channel->MakeMessageReader().reset();
+  ASSERT_RAISES(IOError, WriteBatches(channel.get(), batches));
+}
+
+TEST(TestSharedMemoryChannel, MessageTooLarge) {
+  auto batches = MakeBatches(/*num_batches=*/1, /*length=*/10000);
+  ASSERT_OK_AND_ASSIGN(auto channel, SharedMemoryChannel::Create(4096));
+
+  ASSERT_OK_AND_ASSIGN(auto writer, channel->MakeStreamWriter(batches[0]->schema()));
+  ASSERT_RAISES(Invalid, writer->WriteRecordBatch(*batches[0]));
+}
+
+TEST(TestSharedMemoryChannel, RawRecords) {
+  ASSERT_OK_AND_ASSIGN(auto channel, SharedMemoryChannel::Create(4096));
+
+  constexpr int kNumRecords = 200;
+  std::thread writer([&] {
+    for (int i = 0; i < kNumRecords; ++i) {
+      ASSERT_OK(channel->WriteRecord(i, [&](uint8_t* data) {
+        std::memset(data, i, i);
+        return Status::OK();
+      }));
+    }
+    // A failing fill does not write the record
+    ASSERT_RAISES(Invalid, channel->WriteRecord(
+                               10, [](uint8_t*) { return Status::Invalid("fill"); }));
+    channel->CloseWriter();
+  });
+  for (int i = 0; i < kNumRecords; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto record, channel->ReadRecord());
+    ASSERT_NE(record, nullptr);
+    ASSERT_EQ(record->size(), i);
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(record->data()) % 64, 0u);
+    ASSERT_EQ(record->ToString(), std::string(i, static_cast<char>(i)));
+  }
+  ASSERT_OK_AND_ASSIGN(auto end, channel->ReadRecord());
+  ASSERT_EQ(end, nullptr);
+  writer.join();
+}
+
+TEST(TestSharedMemoryChannel, OpenByName) {
+  const std::string name = "/arrow-ipc-test-" + std::to_string(getpid());
+  ASSERT_OK_AND_ASSIGN(auto channel, SharedMemoryChannel::Create(1 << 16, name));
+  ASSERT_RAISES(IOError, SharedMemoryChannel::Create(1 << 16, name));
+
+  ASSERT_OK_AND_ASSIGN(auto other, SharedMemoryChannel::Open(name));
+  ASSERT_EQ(other->capacity(), channel->capacity());
+  auto batches = MakeBatches(/*num_batches=*/5, /*length=*/100);
+  ASSERT_OK(WriteBatches(channel.get(), batches));
+  CheckReadBatches(other.get(), batches);
+
+  // The name is unlinked when the creating channel is destroyed
+  channel.reset();
+  ASSERT_RAISES(IOError, SharedMemoryChannel::Open(name));
+}
+
+TEST(TestSharedMemoryChannel, OpenInvalid) {
+  ASSERT_RAISES(Invalid, SharedMemoryChannel::Create(0));
+  ASSERT_RAISES(IOError, SharedMemoryChannel::Open(-1));
+}
+
+TEST(TestSharedMemoryChannel, CrossProcess) {
+  auto batches = MakeBatches(/*num_batches=*/100, /*length=*/500);
+  ASSERT_OK_AND_ASSIGN(auto channel, SharedMemoryChannel::Create(1 << 16));
+
+  const pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    // Child: write the batches through a mapping of the inherited descriptor
+    auto maybe_child_channel = SharedMemoryChannel::Open(channel->fd());
+    bool ok = maybe_child_channel.ok() &&
+              WriteBatches(maybe_child_channel->get(), batches).ok();
+    _exit(ok ? 0 : 1);
+  }
+  CheckReadBatches(channel.get(), batches);
+  int status = 0;
+  ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(WEXITSTATUS(status), 0);
+}
+
+}  // namespace test
+}  // namespace ipc
+}  // namespace arrow
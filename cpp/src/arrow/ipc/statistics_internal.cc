@@ -0,0 +1,274 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/ipc/statistics_internal.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/array_nested.h"
+#include "arrow/array/array_primitive.h"
+#include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_nested.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/builder_time.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/base64.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/value_parsing.h"
+#include "arrow/visit_data_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace ipc {
+namespace internal {
+
+namespace {
+
+template <typename ArrowType, typename Enable = void>
+struct StatisticsValue {
+  using type = typename ArrowType::c_type;
+};
+
+template <typename ArrowType>
+struct StatisticsValue<ArrowType, enable_if_base_binary<ArrowType>> {
+  using type = std::string_view;
+};
+
+template <typename T>
+bool IsNaN(const T& value) {
+  if constexpr (std::is_floating_point_v<T>) {
+    return std::isnan(value);
+  } else {
+    return false;
+  }
+}
+
+template <typename ArrowType>
+Status AppendStatistics(const ArraySpan& values, StructBuilder* builder) {
+  using T = typename StatisticsValue<ArrowType>::type;
+  using BuilderType = typename TypeTraits<ArrowType>::BuilderType;
+
+  T min{}, max{};
+  bool has_values = false;
+  bool has_nan = false;
+  VisitArraySpanInline<ArrowType>(
+      values,
+      [&](T value) {
+        if (IsNaN(value)) {
+          has_nan = true;
+        } else if (!has_values) {
+          min = max = value;
+          has_values = true;
+        } else if (value < min) {
+          min = value;
+        } else if (max < value) {
+          max = value;
+        }
+      },
+      [] {});
+
+  auto null_count_builder = checked_cast<Int64Builder*>(builder->field_builder(0));
+  auto min_builder = checked_cast<BuilderType*>(builder->field_builder(1));
+  auto max_builder = checked_cast<BuilderType*>(builder->field_builder(2));
+  RETURN_NOT_OK(builder->Append());
+  RETURN_NOT_OK(null_count_builder->Append(values.GetNullCount()));
+  // NaN values have no place in a [min, max] range
+  if (has_values && !has_nan) {
+    RETURN_NOT_OK(min_builder->Append(min));
+    return max_builder->Append(max);
+  }
+  RETURN_NOT_OK(min_builder->AppendNull());
+  return max_builder->AppendNull();
+}
+
+#define STATISTICS_TYPE_CASES(ACTION) \
+  ACTION(Int8);                       \
+  ACTION(Int16);                      \
+  ACTION(Int32);                      \
+  ACTION(Int64);                      \
+  ACTION(UInt8);                      \
+  ACTION(UInt16);                     \
+  ACTION(UInt32);                     \
+  ACTION(UInt64);                     \
+  ACTION(Float);                      \
+  ACTION(Double);                     \
+  ACTION(Date32);                     \
+  ACTION(Date64);                     \
+  ACTION(Time32);                     \
+  ACTION(Time64);                     \
+  ACTION(Timestamp);                  \
+  ACTION(Duration);                   \
+  ACTION(Binary);                     \
+  ACTION(String);                     \
+  ACTION(LargeBinary);                \
+  ACTION(LargeString)
+
+Status AppendStatistics(const ArraySpan& values, StructBuilder* builder) {
+#define APPEND_CASE(TYPE_CLASS)        \
+  case TYPE_CLASS##Type::type_id:      \
+    return AppendStatistics<TYPE_CLASS##Type>(values, builder)
+
+  switch (values.type->id()) {
+    STATISTICS_TYPE_CASES(APPEND_CASE);
+    default:
+      break;
+  }
+#undef APPEND_CASE
+  return Status::NotImplemented("No statistics for type ", *values.type);
+}
+
+}  // namespace
+
+bool HasStatistics(const DataType& type) {
+#define HAS_STATISTICS_CASE(TYPE_CLASS) \
+  case TYPE_CLASS##Type::type_id:       \
+    return true
+
+  switch (type.id()) {
+    STATISTICS_TYPE_CASES(HAS_STATISTICS_CASE);
+    default:
+      return false;
+  }
+#undef HAS_STATISTICS_CASE
+}
+
+#undef STATISTICS_TYPE_CASES
+
+Result<std::unique_ptr<StatisticsCollector>> StatisticsCollector::Make(
+    const Schema& schema, MemoryPool* pool) {
+  std::unique_ptr<StatisticsCollector> collector(new StatisticsCollector());
+  collector->pool_ = pool;
+  FieldVector fields = {field("num_rows", int64(), /*nullable=*/false)};
+  ARROW_ASSIGN_OR_RAISE(collector->num_rows_builder_, MakeBuilder(int64(), pool));
+  for (int i = 0; i < schema.num_fields(); ++i) {
+    const auto& type = schema.field(i)->type();
+    if (!HasStatistics(*type)) {
+      continue;
+    }
+    auto statistics_type = struct_({field("null_count", int64(), /*nullable=*/false),
+                                    field("min", type), field("max", type)});
+    fields.push_back(field(std::to_string(i), statistics_type));
+    ARROW_ASSIGN_OR_RAISE(auto builder, MakeBuilder(statistics_type, pool));
+    collector->field_indices_.push_back(i);
+    collector->field_builders_.push_back(std::move(builder));
+  }
+  collector->statistics_schema_ = ::arrow::schema(std::move(fields));
+  return collector;
+}
+
+Status StatisticsCollector::Append(const RecordBatch& batch) {
+  RETURN_NOT_OK(checked_cast<Int64Builder*>(num_rows_builder_.get())
+                    ->Append(batch.num_rows()));
+  for (size_t i = 0; i < field_indices_.size(); ++i) {
+    ArraySpan values(*batch.column_data(field_indices_[i]));
+    RETURN_NOT_OK(
+        AppendStatistics(values, checked_cast<StructBuilder*>(field_builders_[i].get())));
+  }
+  return Status::OK();
+}
+
+Result<std::string> StatisticsCollector::Finish() {
+  const int64_t num_batches = num_rows_builder_->length();
+  ArrayVector columns(1 + field_builders_.size());
+  RETURN_NOT_OK(num_rows_builder_->Finish(&columns[0]));
+  for (size_t i = 0; i < field_builders_.size(); ++i) {
+    RETURN_NOT_OK(field_builders_[i]->Finish(&columns[i + 1]));
+  }
+  auto batch = RecordBatch::Make(statistics_schema_, num_batches, std::move(columns));
+
+  auto options = IpcWriteOptions::Defaults();
+  options.memory_pool = pool_;
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create(1024, pool_));
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeStreamWriter(sink, statistics_schema_, options));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*batch));
+  RETURN_NOT_OK(writer->Close());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+  return ::arrow::util::base64_encode(std::string_view(*buffer));
+}
+
+Result<std::vector<RecordBatchStatistics>> ParseStatistics(const std::string& serialized,
+                                                           const Schema& schema,
+                                                           int num_batches) {
+  auto buffer = Buffer::FromString(::arrow::util::base64_decode(serialized));
+  ARROW_ASSIGN_OR_RAISE(
+      auto reader,
+      RecordBatchStreamReader::Open(std::make_shared<io::BufferReader>(buffer)));
+  ARROW_ASSIGN_OR_RAISE(auto batches, reader->ToRecordBatches());
+  if (batches.size() != 1 || batches[0]->num_rows() != num_batches ||
+      batches[0]->num_columns() == 0 || batches[0]->column(0)->type_id() != Type::INT64) {
+    return Status::Invalid("Invalid record batch statistics in IPC file footer");
+  }
+  const auto& batch = *batches[0];
+
+  std::vector<RecordBatchStatistics> statistics(num_batches);
+  const auto& num_rows = checked_cast<const Int64Array&>(*batch.column(0));
+  for (int i = 0; i < num_batches; ++i) {
+    statistics[i].num_rows = num_rows.Value(i);
+    statistics[i].columns.resize(schema.num_fields());
+  }
+  for (int c = 1; c < batch.num_columns(); ++c) {
+    const std::string& name = batch.schema()->field(c)->name();
+    int32_t field_index = -1;
+    if (!::arrow::internal::ParseValue<Int32Type>(name.data(), name.size(),
+                                                  &field_index) ||
+        field_index < 0 || field_index >= schema.num_fields()) {
+      return Status::Invalid("Invalid record batch statistics in IPC file footer");
+    }
+    const auto& column = batch.column(c);
+    const auto& type = schema.field(field_index)->type();
+    if (column->type_id() != Type::STRUCT || column->type()->num_fields() != 3 ||
+        !column->type()->field(1)->type()->Equals(type)) {
+      return Status::Invalid("Invalid record batch statistics in IPC file footer");
+    }
+    const auto& struct_array = checked_cast<const StructArray&>(*column);
+    const auto& null_counts = checked_cast<const Int64Array&>(*struct_array.field(0));
+    const auto& mins = *struct_array.field(1);
+    const auto& maxs = *struct_array.field(2);
+    for (int i = 0; i < num_batches; ++i) {
+      if (struct_array.IsNull(i)) {
+        continue;
+      }
+      ColumnStatistics column_statistics;
+      column_statistics.null_count = null_counts.Value(i);
+      if (mins.IsValid(i) && maxs.IsValid(i)) {
+        ARROW_ASSIGN_OR_RAISE(column_statistics.min, mins.GetScalar(i));
+        ARROW_ASSIGN_OR_RAISE(column_statistics.max, maxs.GetScalar(i));
+      }
+      statistics[i].columns[field_index] = std::move(column_statistics);
+    }
+  }
+  return statistics;
+}
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
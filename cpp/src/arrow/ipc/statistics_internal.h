@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Record batch statistics stored in the footer of IPC files
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/array/builder_base.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace ipc {
+namespace internal {
+
+/// The key of the file footer custom metadata holding the statistics
+///
+/// The value is the base64 encoding of an IPC stream of a single record batch,
+/// with one row per record batch of the file.  Its "num_rows" column holds the
+/// number of rows of the batches, and a column named after the index of each
+/// field with statistics holds a struct of the "null_count", "min" and "max" of
+/// the field, the latter two being of the type of the field.
+constexpr char kStatisticsMetadataKey[] = "ARROW:ipc:statistics";
+
+/// \brief Whether statistics are computed for columns of this type
+bool HasStatistics(const DataType& type);
+
+/// \brief Accumulate the statistics of the record batches written to a file
+class StatisticsCollector {
+ public:
+  static Result<std::unique_ptr<StatisticsCollector>> Make(const Schema& schema,
+                                                           MemoryPool* pool);
+
+  /// \brief Compute the statistics of a record batch
+  Status Append(const RecordBatch& batch);
+
+  /// \brief Serialize the statistics of all the batches appended
+  Result<std::string> Finish();
+
+ private:
+  StatisticsCollector() = default;
+
+  MemoryPool* pool_;
+  std::vector<int> field_indices_;
+  std::shared_ptr<Schema> statistics_schema_;
+  std::unique_ptr<ArrayBuilder> num_rows_builder_;
+  // One StructBuilder for each field with statistics
+  std::vector<std::unique_ptr<ArrayBuilder>> field_builders_;
+};
+
+/// \brief Deserialize the statistics of the `num_batches` record batches of a
+/// file of the given schema
+Result<std::vector<RecordBatchStatistics>> ParseStatistics(const std::string& serialized,
+                                                           const Schema& schema,
+                                                           int num_batches);
+
+}  // namespace internal
+}  // namespace ipc
+}  // namespace arrow
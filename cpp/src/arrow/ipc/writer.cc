@@ -18,11 +18,14 @@
 #include "arrow/ipc/writer.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <iomanip>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -39,6 +42,7 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/ipc/statistics_internal.h"
 #include "arrow/ipc/util.h"
 #include "arrow/record_batch.h"
 #include "arrow/result_internal.h"
@@ -52,10 +56,12 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_array_inline.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
@@ -470,13 +476,20 @@ class RecordBatchSerializer {
   }
 
   Status Visit(const BinaryViewArray& array) {
-    auto views = SliceBuffer(array.values(), array.offset() * BinaryViewType::kSize,
-                             array.length() * BinaryViewType::kSize);
+    std::shared_ptr<ArrayData> data = array.data();
+    if (options_.view_compaction_threshold > 0) {
+      ARROW_ASSIGN_OR_RAISE(auto compacted,
+                            array.CompactDataBuffers(options_.view_compaction_threshold,
+                                                     options_.memory_pool));
+      data = compacted->data();
+    }
+    auto views = SliceBuffer(data->buffers[1], data->offset * BinaryViewType::kSize,
+                             data->length * BinaryViewType::kSize);
     out_->body_buffers.emplace_back(std::move(views));
 
-    out_->variadic_buffer_counts.emplace_back(array.data()->buffers.size() - 2);
-    for (size_t i = 2; i < array.data()->buffers.size(); ++i) {
-      out_->body_buffers.emplace_back(array.data()->buffers[i]);
+    out_->variadic_buffer_counts.emplace_back(data->buffers.size() - 2);
+    for (size_t i = 2; i < data->buffers.size(); ++i) {
+      out_->body_buffers.emplace_back(data->buffers[i]);
     }
     return Status::OK();
   }
@@ -1122,6 +1135,12 @@ Status RecordBatchWriter::WriteRecordBatch(
       "Write record batch with custom metadata not implemented");
 }
 
+Future<> RecordBatchWriter::WriteRecordBatchAsync(
+    std::shared_ptr<RecordBatch> batch,
+    std::shared_ptr<const KeyValueMetadata> custom_metadata) {
+  return WriteRecordBatch(*batch, custom_metadata);
+}
+
 Status RecordBatchWriter::WriteTable(const Table& table, int64_t max_chunksize) {
   TableBatchReader reader(table);
 
@@ -1172,6 +1191,11 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     shared_schema_ = schema;
   }
 
+  ~IpcFormatWriter() override {
+    // The pending messages refer to this writer
+    ARROW_UNUSED(WaitForPendingMessages(0));
+  }
+
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteRecordBatch(batch, NULLPTR);
   }
@@ -1179,14 +1203,8 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   Status WriteRecordBatch(
       const RecordBatch& batch,
       const std::shared_ptr<const KeyValueMetadata>& custom_metadata) override {
-    if (closed_) {
-      return Status::Invalid("Destination already closed");
-    }
-    if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
-      return Status::Invalid("Tried to write record batch with different schema");
-    }
-
-    RETURN_NOT_OK(CheckStarted());
+    RETURN_NOT_OK(CheckWriteRecordBatch(batch));
+    RETURN_NOT_OK(WaitForPendingMessages(0));
 
     RETURN_NOT_OK(WriteDictionaries(batch));
 
@@ -1194,6 +1212,9 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     RETURN_NOT_OK(GetRecordBatchPayload(batch, custom_metadata, options_, &payload));
     RETURN_NOT_OK(WritePayload(payload));
     ++stats_.num_record_batches;
+    if (statistics_) {
+      RETURN_NOT_OK(statistics_->Append(batch));
+    }
 
     stats_.total_raw_body_size += payload.raw_body_length;
     stats_.total_serialized_body_size += payload.body_length;
@@ -1201,6 +1222,30 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  Future<> WriteRecordBatchAsync(
+      std::shared_ptr<RecordBatch> batch,
+      std::shared_ptr<const KeyValueMetadata> custom_metadata) override {
+    RETURN_NOT_OK(CheckWriteRecordBatch(*batch));
+    if (options_.max_pending_batches < 1) {
+      return Status::Invalid("max_pending_batches must be at least 1");
+    }
+    RETURN_NOT_OK(WaitForPendingMessages(options_.max_pending_batches - 1));
+    RETURN_NOT_OK(WriteDictionaries(*batch));
+
+    auto message = std::make_shared<PendingMessage>();
+    message->batch = std::move(batch);
+    message->custom_metadata = std::move(custom_metadata);
+    message->options = options_;
+    // The batches are compressed in parallel instead
+    message->options.use_threads = false;
+    Future<> written = message->written;
+    AddPendingMessage(message);
+    // If spawning fails, the batch is serialized when waited for
+    ARROW_UNUSED(::arrow::internal::GetCpuThreadPool()->Spawn(
+        [message]() { message->Serialize(); }));
+    return written;
+  }
+
   Status WriteTable(const Table& table, int64_t max_chunksize) override {
     if (is_file_format_ && options_.unify_dictionaries) {
       ARROW_ASSIGN_OR_RAISE(auto unified_table,
@@ -1211,15 +1256,14 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     }
   }
 
-  Status Close() override {
-    RETURN_NOT_OK(CheckStarted());
-    RETURN_NOT_OK(payload_writer_->Close());
-    closed_ = true;
-    return Status::OK();
-  }
+  Status Close() override;
 
   Status Start() {
     started_ = true;
+    if (is_file_format_ && options_.write_statistics) {
+      ARROW_ASSIGN_OR_RAISE(statistics_,
+                            StatisticsCollector::Make(schema_, options_.memory_pool));
+    }
     RETURN_NOT_OK(payload_writer_->Start());
 
     IpcPayload payload;
@@ -1227,9 +1271,144 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return WritePayload(payload);
   }
 
-  WriteStats stats() const override { return stats_; }
+  WriteStats stats() const override {
+    std::lock_guard<std::mutex> lock(pending_->mutex);
+    return stats_;
+  }
 
  protected:
+  // A message written by WriteRecordBatchAsync, or written after one: a record
+  // batch serialized in the background, or a dictionary batch
+  struct PendingMessage {
+    // Serialize the record batch, unless another thread already does.  Both the
+    // background task and the writer waiting for the batch call this, so that the
+    // writer does not wait for a task which a saturated executor did not start yet.
+    void Serialize() {
+      if (claimed.exchange(true)) {
+        return;
+      }
+      IpcPayload out;
+      Status status = GetRecordBatchPayload(*batch, custom_metadata, options, &out);
+      if (status.ok()) {
+        payload.MarkFinished(std::move(out));
+      } else {
+        payload.MarkFinished(std::move(status));
+      }
+    }
+
+    // Null for a dictionary batch
+    std::shared_ptr<RecordBatch> batch;
+    std::shared_ptr<const KeyValueMetadata> custom_metadata;
+    IpcWriteOptions options;
+    std::atomic<bool> claimed{false};
+    Future<IpcPayload> payload = Future<IpcPayload>::Make();
+    Future<> written = Future<>::Make();
+  };
+
+  // The messages waiting to be written, in order.  This is shared with the
+  // callbacks writing them, which may run after the last message is written.
+  struct PendingMessages {
+    std::mutex mutex;
+    std::deque<std::shared_ptr<PendingMessage>> messages;
+    int num_batches = 0;
+    // Whether a thread is writing the first message
+    bool writing = false;
+    // The first error, which fails the following messages
+    Status status;
+  };
+
+  Status CheckWriteRecordBatch(const RecordBatch& batch) {
+    if (closed_) {
+      return Status::Invalid("Destination already closed");
+    }
+    if (!batch.schema()->Equals(schema_, false /* check_metadata */)) {
+      return Status::Invalid("Tried to write record batch with different schema");
+    }
+    return CheckStarted();
+  }
+
+  void AddPendingMessage(const std::shared_ptr<PendingMessage>& message) {
+    {
+      std::lock_guard<std::mutex> lock(pending_->mutex);
+      pending_->messages.push_back(message);
+      pending_->num_batches += message->batch != nullptr;
+    }
+    message->payload.AddCallback(
+        [this, pending = pending_](const Result<IpcPayload>&) {
+          WritePendingMessages(this, pending);
+        });
+  }
+
+  // Write the pending messages whose payload is ready, in order
+  static void WritePendingMessages(IpcFormatWriter* writer,
+                                   const std::shared_ptr<PendingMessages>& pending) {
+    while (true) {
+      std::shared_ptr<PendingMessage> message;
+      Status status;
+      {
+        std::lock_guard<std::mutex> lock(pending->mutex);
+        if (pending->writing || pending->messages.empty() ||
+            !pending->messages.front()->payload.is_finished()) {
+          return;
+        }
+        pending->writing = true;
+        message = pending->messages.front();
+        status = pending->status;
+      }
+      // The writer stays alive while the message is pending
+      if (status.ok()) {
+        status = writer->WritePendingMessage(*message);
+      }
+      {
+        std::lock_guard<std::mutex> lock(pending->mutex);
+        pending->messages.pop_front();
+        pending->num_batches -= message->batch != nullptr;
+        if (pending->status.ok()) {
+          pending->status = status;
+        }
+        pending->writing = false;
+      }
+      message->written.MarkFinished(std::move(status));
+    }
+  }
+
+  Status WritePendingMessage(const PendingMessage& message) {
+    const auto& payload = message.payload.result();
+    RETURN_NOT_OK(payload.status());
+    RETURN_NOT_OK(payload_writer_->WritePayload(*payload));
+    if (statistics_ && message.batch) {
+      RETURN_NOT_OK(statistics_->Append(*message.batch));
+    }
+    std::lock_guard<std::mutex> lock(pending_->mutex);
+    ++stats_.num_messages;
+    if (message.batch) {
+      ++stats_.num_record_batches;
+      stats_.total_raw_body_size += payload->raw_body_length;
+      stats_.total_serialized_body_size += payload->body_length;
+    }
+    return Status::OK();
+  }
+
+  // Wait until at most `max_pending_batches` record batches are pending, and
+  // return the error of the messages written
+  Status WaitForPendingMessages(int max_pending_batches) {
+    while (true) {
+      std::shared_ptr<PendingMessage> message;
+      {
+        std::lock_guard<std::mutex> lock(pending_->mutex);
+        if (pending_->messages.empty() ||
+            (pending_->num_batches <= max_pending_batches && max_pending_batches > 0)) {
+          return pending_->status;
+        }
+        message = pending_->messages.front();
+      }
+      if (message->batch) {
+        message->Serialize();
+      }
+      message->written.Wait();
+    }
+  }
+
   Status CheckStarted() {
     if (!started_) {
       return Start();
@@ -1291,7 +1470,7 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
         RETURN_NOT_OK(
             GetDictionaryPayload(dictionary_id, dictionary, options_, &payload));
       }
-      RETURN_NOT_OK(WritePayload(payload));
+      RETURN_NOT_OK(WriteDictionaryPayload(std::move(payload)));
       ++stats_.num_dictionary_batches;
       if (dictionary_exists) {
         if (delta_start) {
@@ -1313,6 +1492,22 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  // Write a dictionary batch after the pending record batches
+  Status WriteDictionaryPayload(IpcPayload payload) {
+    bool has_pending_messages;
+    {
+      std::lock_guard<std::mutex> lock(pending_->mutex);
+      has_pending_messages = !pending_->messages.empty();
+    }
+    if (!has_pending_messages) {
+      return WritePayload(payload);
+    }
+    auto message = std::make_shared<PendingMessage>();
+    message->payload.MarkFinished(std::move(payload));
+    AddPendingMessage(message);
+    return Status::OK();
+  }
+
   std::unique_ptr<IpcPayloadWriter> payload_writer_;
   std::shared_ptr<Schema> shared_schema_;
   const Schema& schema_;
@@ -1326,6 +1521,12 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
   // The latter is also why we can't use weak_ptr.
   std::unordered_map<int64_t, std::shared_ptr<Array>> last_dictionaries_;
 
+  // The statistics of the record batches, if written
+  std::unique_ptr<StatisticsCollector> statistics_;
+
+  // The messages of WriteRecordBatchAsync waiting to be written
+  std::shared_ptr<PendingMessages> pending_ = std::make_shared<PendingMessages>();
+
   bool started_ = false;
   bool closed_ = false;
   IpcWriteOptions options_;
@@ -1492,6 +1693,12 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     return Write(kArrowMagicBytes, strlen(kArrowMagicBytes));
   }
 
+  void AppendFooterMetadata(std::string key, std::string value) {
+    auto metadata = metadata_ ? metadata_->Copy() : key_value_metadata({}, {});
+    metadata->Append(std::move(key), std::move(value));
+    metadata_ = std::move(metadata);
+  }
+
  protected:
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
@@ -1499,6 +1706,19 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
   std::vector<FileBlock> record_batches_;
 };
 
+Status IpcFormatWriter::Close() {
+  RETURN_NOT_OK(WaitForPendingMessages(0));
+  RETURN_NOT_OK(CheckStarted());
+  if (statistics_) {
+    ARROW_ASSIGN_OR_RAISE(auto serialized, statistics_->Finish());
+    checked_cast<PayloadFileWriter*>(payload_writer_.get())
+        ->AppendFooterMetadata(kStatisticsMetadataKey, std::move(serialized));
+  }
+  RETURN_NOT_OK(payload_writer_->Close());
+  closed_ = true;
+  return Status::OK();
+}
+
 }  // namespace internal
 
 Result<std::shared_ptr<RecordBatchWriter>> MakeStreamWriter(
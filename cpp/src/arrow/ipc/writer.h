@@ -27,6 +27,7 @@
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/options.h"
 #include "arrow/result.h"
+#include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -106,6 +107,23 @@ class ARROW_EXPORT RecordBatchWriter {
       const RecordBatch& batch,
       const std::shared_ptr<const KeyValueMetadata>& custom_metadata);
 
+  /// \brief Write a record batch to the stream asynchronously
+  ///
+  /// The returned future finishes once the batch is written to the sink.
+  /// Batches are written in the order of the calls, and calls must not be made
+  /// concurrently.  Close() waits for the pending batches to be written.
+  ///
+  /// The default implementation writes the batch synchronously.  The IPC writers
+  /// serialize and compress the batch in the background, overlapping with the
+  /// writes of the previous batches (see IpcWriteOptions::max_pending_batches).
+  ///
+  /// \param[in] batch the record batch to write to the stream
+  /// \param[in] custom_metadata the record batch's custom metadata, optional
+  /// \return a future finishing when the batch is written
+  virtual Future<> WriteRecordBatchAsync(
+      std::shared_ptr<RecordBatch> batch,
+      std::shared_ptr<const KeyValueMetadata> custom_metadata = NULLPTR);
+
   /// \brief Write possibly-chunked table by creating sequence of record batches
   /// \param[in] table table to write
   /// \return Status
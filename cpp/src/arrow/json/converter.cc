@@ -243,7 +243,6 @@ class BinaryConverter : public PrimitiveConverter {
 
     using Builder = typename TypeTraits<T>::BuilderType;
     Builder builder(out_type_, pool_);
-    RETURN_NOT_OK(builder.Resize(dict_array.indices()->length()));
 
     // TODO(bkietz) this can be computed during parsing at low cost
     int64_t data_length = 0;
@@ -259,7 +258,7 @@ class BinaryConverter : public PrimitiveConverter {
 
     RETURN_NOT_OK(
         VisitDictionaryEntries(dict_array, visit_lengths_valid, visit_lengths_null));
-    RETURN_NOT_OK(builder.ReserveData(data_length));
+    RETURN_NOT_OK(builder.ReserveHint(dict_array.indices()->length(), data_length));
 
     auto visit_valid = [&](string_view value) {
       builder.UnsafeAppend(value);
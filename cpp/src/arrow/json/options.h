@@ -20,7 +20,9 @@
 #include <cstdint>
 #include <memory>
 
+#include "arrow/io/interfaces.h"
 #include "arrow/json/type_fwd.h"
+#include "arrow/status.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -53,6 +55,12 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Whether to parse using a structural index instead of RapidJSON
+  ///
+  /// Each block is first scanned for structural characters using bitmask
+  /// operations over 64 bytes at a time; parsing then only visits those positions.
+  bool use_structural_parser = false;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -70,5 +78,27 @@ struct ARROW_EXPORT ReadOptions {
   static ReadOptions Defaults();
 };
 
+struct ARROW_EXPORT WriteOptions {
+  /// \brief Maximum number of rows processed at a time
+  ///
+  /// The JSON writer formats and writes data in batches of N rows.
+  int32_t batch_size = 1024;
+
+  /// \brief Whether to use the global CPU thread pool
+  ///
+  /// If true, consecutive batches of `batch_size` rows are formatted
+  /// concurrently, then written out in order.
+  bool use_threads = true;
+
+  /// \brief IO context for writing
+  io::IOContext io_context;
+
+  /// Create write options with default values
+  static WriteOptions Defaults();
+
+  /// \brief Test that all set options are valid
+  Status Validate() const;
+};
+
 }  // namespace json
 }  // namespace arrow
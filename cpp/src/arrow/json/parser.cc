@@ -17,9 +17,11 @@
 
 #include "arrow/json/parser.h"
 
+#include <algorithm>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <unordered_map>
@@ -33,12 +35,17 @@
 
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
+#include "arrow/array/builder_primitive.h"
+#include "arrow/array/builder_time.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/json/structural_parser_internal.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
 #include "arrow/util/bitset_stack.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/trie.h"
+#include "arrow/util/value_parsing.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -644,17 +651,68 @@ class RawBuilderSet {
       arenas_;
 };
 
+/// \brief Feed each JSON document in a block to a SAX handler
+///
+/// *num_rows is incremented for each parsed document.
+template <typename Handler, typename Stream>
+Status ParseDocuments(Handler& handler, Stream&& json, size_t json_size,
+                      int32_t* num_rows) {
+  constexpr auto parse_flags = rj::kParseIterativeFlag | rj::kParseNanAndInfFlag |
+                               rj::kParseStopWhenDoneFlag |
+                               rj::kParseNumbersAsStringsFlag;
+
+  rj::Reader reader;
+  // ensure that the loop can exit when the block too large.
+  for (; *num_rows < std::numeric_limits<int32_t>::max(); ++*num_rows) {
+    auto ok = reader.Parse<parse_flags>(json, handler);
+    switch (ok.Code()) {
+      case rj::kParseErrorNone:
+        // parse the next object
+        continue;
+      case rj::kParseErrorDocumentEmpty:
+        if (json.Tell() < json_size) {
+          return ParseError(rj::GetParseError_En(ok.Code()));
+        }
+        // parsed all objects, finish
+        return Status::OK();
+      case rj::kParseErrorTermination:
+        // handler emitted an error
+        return handler.Error();
+      default:
+        // rj emitted an error
+        return ParseError(rj::GetParseError_En(ok.Code()), " in row ", *num_rows);
+    }
+  }
+  return Status::Invalid("Row count overflowed int32_t");
+}
+
+template <typename Handler>
+Status ParseDocuments(Handler& handler, const Buffer& json,
+                      internal::StructuralParser* structural_parser, int32_t* num_rows) {
+  if (structural_parser) {
+    return structural_parser->Parse(std::string_view(json), &handler, num_rows);
+  }
+  rj::MemoryStream ms(reinterpret_cast<const char*>(json.data()), json.size());
+  using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
+  return ParseDocuments(handler, InputStream(ms), static_cast<size_t>(json.size()),
+                        num_rows);
+}
+
 /// Three implementations are provided for BlockParser, one for each
 /// UnexpectedFieldBehavior. However most of the logic is identical in each
 /// case, so the majority of the implementation is in this base class
 class HandlerBase : public BlockParser,
                     public rj::BaseReaderHandler<rj::UTF8<>, HandlerBase> {
  public:
-  explicit HandlerBase(MemoryPool* pool)
+  HandlerBase(MemoryPool* pool, const ParseOptions& options)
       : BlockParser(pool),
         builder_set_(pool),
         field_index_(-1),
-        scalar_values_builder_(pool) {}
+        scalar_values_builder_(pool) {
+    if (options.use_structural_parser) {
+      structural_parser_ = std::make_unique<internal::StructuralParser>();
+    }
+  }
 
   /// Retrieve a pointer to a builder from a BuilderPtr
   template <Kind::type kind>
@@ -762,43 +820,10 @@ class HandlerBase : public BlockParser,
   }
 
  protected:
-  template <typename Handler, typename Stream>
-  Status DoParse(Handler& handler, Stream&& json, size_t json_size) {
-    constexpr auto parse_flags = rj::kParseIterativeFlag | rj::kParseNanAndInfFlag |
-                                 rj::kParseStopWhenDoneFlag |
-                                 rj::kParseNumbersAsStringsFlag;
-
-    rj::Reader reader;
-    // ensure that the loop can exit when the block too large.
-    for (; num_rows_ < std::numeric_limits<int32_t>::max(); ++num_rows_) {
-      auto ok = reader.Parse<parse_flags>(json, handler);
-      switch (ok.Code()) {
-        case rj::kParseErrorNone:
-          // parse the next object
-          continue;
-        case rj::kParseErrorDocumentEmpty:
-          if (json.Tell() < json_size) {
-            return ParseError(rj::GetParseError_En(ok.Code()));
-          }
-          // parsed all objects, finish
-          return Status::OK();
-        case rj::kParseErrorTermination:
-          // handler emitted an error
-          return handler.Error();
-        default:
-          // rj emitted an error
-          return ParseError(rj::GetParseError_En(ok.Code()), " in row ", num_rows_);
-      }
-    }
-    return Status::Invalid("Row count overflowed int32_t");
-  }
-
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
-    rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
-    using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
-    return DoParse(handler, InputStream(ms), static_cast<size_t>(json->size()));
+    return ParseDocuments(handler, *json, structural_parser_.get(), &num_rows_);
   }
 
   /// \defgroup handlerbase-append-methods append non-nested values
@@ -929,6 +954,7 @@ class HandlerBase : public BlockParser,
   }
 
   Status status_;
+  std::unique_ptr<internal::StructuralParser> structural_parser_;
   RawBuilderSet builder_set_;
   BuilderPtr builder_;
   // top of this stack is the parent of builder_
@@ -1169,6 +1195,376 @@ class Handler<UnexpectedFieldBehavior::InferType> : public HandlerBase {
   }
 };
 
+/// \brief Decoder of the values of one column of a TypedHandler
+///
+/// Values are appended to a builder of the column's final type as they are
+/// parsed, so no unconverted array is materialized.
+class ColumnDecoder {
+ public:
+  explicit ColumnDecoder(Kind::type kind) : kind_(kind) {}
+  virtual ~ColumnDecoder() = default;
+
+  Kind::type kind() const { return kind_; }
+
+  virtual Status AppendNull() = 0;
+  // Only the method matching kind() is ever called
+  virtual Status AppendBool(bool) { return Status::OK(); }
+  virtual Status AppendNumber(std::string_view) { return Status::OK(); }
+  virtual Status AppendString(std::string_view) { return Status::OK(); }
+  virtual Status Finish(std::shared_ptr<Array>* out) = 0;
+
+ protected:
+  const Kind::type kind_;
+};
+
+template <typename T>
+class TypedColumnDecoder : public ColumnDecoder {
+ public:
+  using BuilderType = typename TypeTraits<T>::BuilderType;
+
+  TypedColumnDecoder(Kind::type kind, const std::shared_ptr<DataType>& type,
+                     MemoryPool* pool)
+      : ColumnDecoder(kind), builder_(type, pool) {}
+
+  Status AppendNull() override { return builder_.AppendNull(); }
+
+  Status Finish(std::shared_ptr<Array>* out) override { return builder_.Finish(out); }
+
+ protected:
+  Status ConversionError(std::string_view repr) {
+    return Status::Invalid("Failed to convert JSON to ", *builder_.type(),
+                           ", couldn't parse:", repr);
+  }
+
+  BuilderType builder_;
+};
+
+class NullColumnDecoder : public ColumnDecoder {
+ public:
+  NullColumnDecoder() : ColumnDecoder(Kind::kNull) {}
+
+  Status AppendNull() override {
+    ++length_;
+    return Status::OK();
+  }
+
+  Status Finish(std::shared_ptr<Array>* out) override {
+    *out = std::make_shared<NullArray>(length_);
+    length_ = 0;
+    return Status::OK();
+  }
+
+ private:
+  int64_t length_ = 0;
+};
+
+class BooleanColumnDecoder : public TypedColumnDecoder<BooleanType> {
+ public:
+  BooleanColumnDecoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : TypedColumnDecoder(Kind::kBoolean, type, pool) {}
+
+  Status AppendBool(bool value) override { return builder_.Append(value); }
+};
+
+/// Numbers, dates and times are parsed from the raw number; dates and times
+/// from their integer representation, as in the corresponding Converter
+template <typename T>
+class NumberColumnDecoder : public TypedColumnDecoder<T> {
+ public:
+  using ReprType = typename CTypeTraits<typename T::c_type>::ArrowType;
+
+  NumberColumnDecoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : TypedColumnDecoder<T>(Kind::kNumber, type, pool) {}
+
+  Status AppendNumber(std::string_view repr) override {
+    typename ReprType::c_type value;
+    if (ARROW_PREDICT_FALSE(!arrow::internal::ParseValue<ReprType>(
+            repr.data(), repr.size(), &value))) {
+      return this->ConversionError(repr);
+    }
+    return this->builder_.Append(value);
+  }
+};
+
+class TimestampColumnDecoder : public TypedColumnDecoder<TimestampType> {
+ public:
+  TimestampColumnDecoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : TypedColumnDecoder(Kind::kString, type, pool),
+        timestamp_type_(checked_cast<const TimestampType&>(*type)) {}
+
+  Status AppendString(std::string_view repr) override {
+    int64_t value;
+    if (ARROW_PREDICT_FALSE(!arrow::internal::ParseValue(timestamp_type_, repr.data(),
+                                                         repr.size(), &value))) {
+      return ConversionError(repr);
+    }
+    return builder_.Append(value);
+  }
+
+ private:
+  const TimestampType& timestamp_type_;
+};
+
+template <typename T>
+class BinaryColumnDecoder : public TypedColumnDecoder<T> {
+ public:
+  BinaryColumnDecoder(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : TypedColumnDecoder<T>(Kind::kString, type, pool) {}
+
+  Status AppendString(std::string_view value) override {
+    return this->builder_.Append(value);
+  }
+};
+
+Status MakeColumnDecoder(const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                         std::unique_ptr<ColumnDecoder>* out) {
+  switch (type->id()) {
+#define DECODER_CASE(TYPE_ID, DECODER_TYPE)            \
+  case TYPE_ID:                                        \
+    *out = std::make_unique<DECODER_TYPE>(type, pool); \
+    return Status::OK()
+    case Type::NA:
+      *out = std::make_unique<NullColumnDecoder>();
+      return Status::OK();
+    DECODER_CASE(Type::BOOL, BooleanColumnDecoder);
+    DECODER_CASE(Type::INT8, NumberColumnDecoder<Int8Type>);
+    DECODER_CASE(Type::INT16, NumberColumnDecoder<Int16Type>);
+    DECODER_CASE(Type::INT32, NumberColumnDecoder<Int32Type>);
+    DECODER_CASE(Type::INT64, NumberColumnDecoder<Int64Type>);
+    DECODER_CASE(Type::UINT8, NumberColumnDecoder<UInt8Type>);
+    DECODER_CASE(Type::UINT16, NumberColumnDecoder<UInt16Type>);
+    DECODER_CASE(Type::UINT32, NumberColumnDecoder<UInt32Type>);
+    DECODER_CASE(Type::UINT64, NumberColumnDecoder<UInt64Type>);
+    DECODER_CASE(Type::FLOAT, NumberColumnDecoder<FloatType>);
+    DECODER_CASE(Type::DOUBLE, NumberColumnDecoder<DoubleType>);
+    DECODER_CASE(Type::TIME32, NumberColumnDecoder<Time32Type>);
+    DECODER_CASE(Type::TIME64, NumberColumnDecoder<Time64Type>);
+    DECODER_CASE(Type::DATE32, NumberColumnDecoder<Date32Type>);
+    DECODER_CASE(Type::DATE64, NumberColumnDecoder<Date64Type>);
+    DECODER_CASE(Type::TIMESTAMP, TimestampColumnDecoder);
+    DECODER_CASE(Type::BINARY, BinaryColumnDecoder<BinaryType>);
+    DECODER_CASE(Type::STRING, BinaryColumnDecoder<StringType>);
+    DECODER_CASE(Type::LARGE_BINARY, BinaryColumnDecoder<LargeBinaryType>);
+    DECODER_CASE(Type::LARGE_STRING, BinaryColumnDecoder<LargeStringType>);
+    DECODER_CASE(Type::BINARY_VIEW, BinaryColumnDecoder<BinaryViewType>);
+    DECODER_CASE(Type::STRING_VIEW, BinaryColumnDecoder<StringViewType>);
+#undef DECODER_CASE
+    default:
+      return Status::NotImplemented("Direct JSON decoding of ", *type);
+  }
+}
+
+/// \brief BlockParser which decodes directly into the types of an explicit schema
+///
+/// Unexpected fields are skipped without being materialized.
+class TypedHandler : public BlockParser,
+                     public rj::BaseReaderHandler<rj::UTF8<>, TypedHandler> {
+ public:
+  TypedHandler(MemoryPool* pool, const ParseOptions& options)
+      : BlockParser(pool), schema_(options.explicit_schema) {
+    if (options.use_structural_parser) {
+      structural_parser_ = std::make_unique<internal::StructuralParser>();
+    }
+  }
+
+  Status Initialize() {
+    const auto& fields = schema_->fields();
+    decoders_.resize(fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+      RETURN_NOT_OK(MakeColumnDecoder(fields[i]->type(), pool_, &decoders_[i]));
+      name_to_index_.emplace(fields[i]->name(), static_cast<int>(i));
+    }
+    absent_.resize(fields.size());
+    return Status::OK();
+  }
+
+  Status ReserveScalarStorage(int64_t) override { return Status::OK(); }
+
+  Status Parse(const std::shared_ptr<Buffer>& json) override {
+    return ParseDocuments(*this, *json, structural_parser_.get(), &num_rows_);
+  }
+
+  Status Finish(std::shared_ptr<Array>* parsed) override {
+    ArrayVector columns(decoders_.size());
+    for (size_t i = 0; i < decoders_.size(); ++i) {
+      RETURN_NOT_OK(decoders_[i]->Finish(&columns[i]));
+    }
+    *parsed = std::make_shared<StructArray>(struct_(schema_->fields()), num_rows_,
+                                            std::move(columns));
+    return Status::OK();
+  }
+
+  Status Error() { return status_; }
+
+  /// \defgroup rapidjson-handler-interface functions expected by rj::Reader
+  ///
+  /// @{
+  bool Null() {
+    if (Skipping()) {
+      return true;
+    }
+    if (ARROW_PREDICT_FALSE(depth_ == 0)) {
+      return SetStatus(ValueIsNotAnObject(Kind::kNull));
+    }
+    if (ARROW_PREDICT_FALSE(!schema_->field(field_index_)->nullable())) {
+      return SetStatus(ParseError("a required field was null"));
+    }
+    return SetStatus(decoders_[field_index_]->AppendNull());
+  }
+
+  bool Bool(bool value) {
+    if (Skipping()) {
+      return true;
+    }
+    ColumnDecoder* decoder;
+    if (ARROW_PREDICT_FALSE(!GetDecoder(Kind::kBoolean, &decoder))) {
+      return false;
+    }
+    return SetStatus(decoder->AppendBool(value));
+  }
+
+  bool RawNumber(const char* data, rj::SizeType size, ...) {
+    if (Skipping()) {
+      return true;
+    }
+    ColumnDecoder* decoder;
+    if (ARROW_PREDICT_FALSE(!GetDecoder(Kind::kNumber, &decoder))) {
+      return false;
+    }
+    return SetStatus(decoder->AppendNumber(std::string_view(data, size)));
+  }
+
+  bool String(const char* data, rj::SizeType size, ...) {
+    if (Skipping()) {
+      return true;
+    }
+    ColumnDecoder* decoder;
+    if (ARROW_PREDICT_FALSE(!GetDecoder(Kind::kString, &decoder))) {
+      return false;
+    }
+    return SetStatus(decoder->AppendString(std::string_view(data, size)));
+  }
+
+  bool StartObject() {
+    ++depth_;
+    if (Skipping()) {
+      return true;
+    }
+    if (ARROW_PREDICT_FALSE(depth_ > 1)) {
+      return SetStatus(IllegallyChangedTo(Kind::kObject));
+    }
+    std::fill(absent_.begin(), absent_.end(), true);
+    return true;
+  }
+
+  bool Key(const char* key, rj::SizeType len, ...) {
+    MaybeStopSkipping();
+    if (Skipping()) {
+      return true;
+    }
+    auto it = name_to_index_.find(std::string_view(key, len));
+    if (it == name_to_index_.end()) {
+      skip_depth_ = depth_;
+      return true;
+    }
+    field_index_ = it->second;
+    if (ARROW_PREDICT_FALSE(!absent_[field_index_])) {
+      return SetStatus(
+          ParseError("Column(", Path(), ") was specified twice in row ", num_rows_));
+    }
+    absent_[field_index_] = false;
+    return true;
+  }
+
+  bool EndObject(...) {
+    MaybeStopSkipping();
+    --depth_;
+    if (Skipping()) {
+      return true;
+    }
+    for (size_t i = 0; i < absent_.size(); ++i) {
+      if (!absent_[i]) {
+        continue;
+      }
+      if (ARROW_PREDICT_FALSE(!schema_->field(static_cast<int>(i))->nullable())) {
+        return SetStatus(ParseError("a required field was absent"));
+      }
+      if (ARROW_PREDICT_FALSE(!SetStatus(decoders_[i]->AppendNull()))) {
+        return false;
+      }
+    }
+    field_index_ = -1;
+    return true;
+  }
+
+  bool StartArray() {
+    if (Skipping()) {
+      ++depth_;
+      return true;
+    }
+    if (depth_ == 0) {
+      return SetStatus(ValueIsNotAnObject(Kind::kArray));
+    }
+    return SetStatus(IllegallyChangedTo(Kind::kArray));
+  }
+
+  bool EndArray(rj::SizeType) {
+    --depth_;
+    return true;
+  }
+  /// @}
+
+ private:
+  bool Skipping() const { return depth_ >= skip_depth_; }
+
+  void MaybeStopSkipping() {
+    if (skip_depth_ == depth_) {
+      skip_depth_ = std::numeric_limits<int>::max();
+    }
+  }
+
+  bool SetStatus(Status st) {
+    status_ = std::move(st);
+    return status_.ok();
+  }
+
+  // Get the decoder for a scalar of the given kind, or store an error
+  bool GetDecoder(Kind::type kind, ColumnDecoder** decoder) {
+    if (ARROW_PREDICT_FALSE(depth_ == 0)) {
+      return SetStatus(ValueIsNotAnObject(kind));
+    }
+    *decoder = decoders_[field_index_].get();
+    if (ARROW_PREDICT_FALSE((*decoder)->kind() != kind)) {
+      return SetStatus(IllegallyChangedTo(kind));
+    }
+    return true;
+  }
+
+  std::string Path() const { return "/" + schema_->field(field_index_)->name(); }
+
+  Status IllegallyChangedTo(Kind::type illegally_changed_to) const {
+    return ParseError("Column(", Path(), ") changed from ",
+                      Kind::Name(decoders_[field_index_]->kind()), " to ",
+                      Kind::Name(illegally_changed_to), " in row ", num_rows_);
+  }
+
+  Status ValueIsNotAnObject(Kind::type kind) const {
+    return ParseError("Column() changed from object to ", Kind::Name(kind), " in row ",
+                      num_rows_);
+  }
+
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::unique_ptr<ColumnDecoder>> decoders_;
+  std::unordered_map<std::string_view, int> name_to_index_;
+  // Whether each field is yet to be seen in the current row
+  std::vector<bool> absent_;
+  int field_index_ = -1;
+  int depth_ = 0;
+  int skip_depth_ = std::numeric_limits<int>::max();
+  Status status_;
+  std::unique_ptr<internal::StructuralParser> structural_parser_;
+};
+
 Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
                          std::unique_ptr<BlockParser>* out) {
   DCHECK(options.unexpected_field_behavior == UnexpectedFieldBehavior::InferType ||
@@ -1176,15 +1572,15 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
 
   switch (options.unexpected_field_behavior) {
     case UnexpectedFieldBehavior::Ignore: {
-      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(pool);
+      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Ignore>>(pool, options);
       break;
     }
     case UnexpectedFieldBehavior::Error: {
-      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Error>>(pool);
+      *out = std::make_unique<Handler<UnexpectedFieldBehavior::Error>>(pool, options);
       break;
     }
     case UnexpectedFieldBehavior::InferType:
-      *out = std::make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
+      *out = std::make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool, options);
       break;
   }
   return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
@@ -1194,5 +1590,18 @@ Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParse
   return BlockParser::Make(default_memory_pool(), options, out);
 }
 
+Status BlockParser::MakeTyped(MemoryPool* pool, const ParseOptions& options,
+                              std::unique_ptr<BlockParser>* out) {
+  if (options.explicit_schema == nullptr ||
+      options.unexpected_field_behavior != UnexpectedFieldBehavior::Ignore) {
+    return Status::NotImplemented(
+        "Direct JSON decoding requires an explicit schema and ignored unexpected fields");
+  }
+  auto handler = std::make_unique<TypedHandler>(pool, options);
+  RETURN_NOT_OK(handler->Initialize());
+  *out = std::move(handler);
+  return Status::OK();
+}
+
 }  // namespace json
 }  // namespace arrow
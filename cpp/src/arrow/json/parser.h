@@ -94,6 +94,16 @@ class ARROW_EXPORT BlockParser {
 
   static Status Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out);
 
+  /// \brief Construct a BlockParser which emits converted Arrays
+  ///
+  /// Instead of unconverted Arrays, the parser emits a StructArray whose fields have
+  /// exactly the types of options.explicit_schema: values are decoded as they are
+  /// parsed and unexpected fields are skipped without being materialized. This is
+  /// only supported if unexpected fields are ignored and every field of the schema
+  /// has a non-nested, non-decimal type; otherwise NotImplemented is returned.
+  static Status MakeTyped(MemoryPool* pool, const ParseOptions& options,
+                          std::unique_ptr<BlockParser>* out);
+
  protected:
   ARROW_DISALLOW_COPY_AND_ASSIGN(BlockParser);
 
@@ -35,6 +35,7 @@
 namespace arrow {
 
 using internal::checked_cast;
+using internal::checked_pointer_cast;
 
 namespace json {
 
@@ -321,5 +322,137 @@ TEST(BlockParser, AdHoc) {
        R"([{"c":true, "d": "1991-02-03"}, {"c":false, "d":"2019-04-01"}])"});
 }
 
+TEST(BlockParser, StructuralParser) {
+  auto options = ParseOptions::Defaults();
+  options.use_structural_parser = true;
+  AssertParseColumns(
+      options, scalars_only_src(),
+      {field("hello", utf8()), field("world", boolean()), field("yo", utf8())},
+      {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]", "[false, null, null, true]",
+       "[\"thing\", null, \"\xe5\xbf\x8d\", null]"});
+  AssertParseColumns(
+      options, R"({"a": [1, -2.5e3, NaN], "b": {"c": "x\"y\\z\u00e9"}}
+{"a": [], "b": {"c": "\ud83d\ude00"}}
+)",
+      {field("a", list(utf8())), field("b", struct_({field("c", utf8())}))},
+      {R"([["1", "-2.5e3", "NaN"], []])",
+       "[{\"c\": \"x\\\"y\\\\z\xc3\xa9\"}, {\"c\": \"\xf0\x9f\x98\x80\"}]"});
+
+  options.explicit_schema = schema({field("hello", float64())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  AssertParseColumns(options, nested_src(), {field("hello", utf8())},
+                     {"[\"3.5\", \"3.25\", \"3.125\", \"0.0\"]"});
+}
+
+TEST(BlockParser, StructuralParserErrors) {
+  auto options = ParseOptions::Defaults();
+  options.use_structural_parser = true;
+  std::shared_ptr<Array> parsed;
+  for (std::string_view src :
+       {"{\"a\":0, \"b\"", "{\"a\":0}\n{\"a\" 1}", "{\"a\":\"b}", "{\"a\":tru}",
+        "{\"a\":01}", "{\"a\":\"\\x\"}", "{\"a\":[1 2]}", "}"}) {
+    ARROW_SCOPED_TRACE("src = ", src);
+    auto status = ParseFromString(options, src, &parsed);
+    ASSERT_RAISES(Invalid, status);
+    EXPECT_THAT(status.message(), ::testing::StartsWith("JSON parse error: "));
+  }
+
+  // Handler errors are propagated
+  options.explicit_schema = schema({field("a", int32())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":0, \"b\":1}", &parsed));
+  ASSERT_RAISES(Invalid, ParseFromString(options, "{\"a\":0, \"a\":1}", &parsed));
+}
+
+Status ParseTypedFromString(ParseOptions options, string_view src_str,
+                            std::shared_ptr<StructArray>* parsed) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+  RETURN_NOT_OK(parser->Parse(std::make_shared<Buffer>(src_str)));
+  std::shared_ptr<Array> parsed_non_struct;
+  RETURN_NOT_OK(parser->Finish(&parsed_non_struct));
+  *parsed = checked_pointer_cast<StructArray>(parsed_non_struct);
+  return Status::OK();
+}
+
+TEST(TypedBlockParser, Basics) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("hello", float64()), field("world", boolean()), field("yo", utf8()),
+              field("absent", int32())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  for (const auto& src : {scalars_only_src(), nested_src()}) {
+    std::shared_ptr<StructArray> parsed;
+    ASSERT_OK(ParseTypedFromString(options, src, &parsed));
+    ASSERT_OK(parsed->ValidateFull());
+    AssertTypeEqual(*struct_(options.explicit_schema->fields()), *parsed->type());
+    AssertArraysEqual(*ArrayFromJSON(float64(), "[3.5, 3.25, 3.125, 0.0]"),
+                      *parsed->field(0));
+    AssertArraysEqual(*ArrayFromJSON(boolean(), "[false, null, null, true]"),
+                      *parsed->field(1));
+    AssertArraysEqual(*ArrayFromJSON(utf8(), "[\"thing\", null, \"\xe5\xbf\x8d\", null]"),
+                      *parsed->field(2));
+    AssertArraysEqual(*ArrayFromJSON(int32(), "[null, null, null, null]"),
+                      *parsed->field(3));
+  }
+}
+
+TEST(TypedBlockParser, Temporal) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("ts", timestamp(TimeUnit::SECOND)),
+                                    field("d", date32()), field("n", null())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  std::shared_ptr<StructArray> parsed;
+  ASSERT_OK(ParseTypedFromString(options, R"({"ts": "1970-01-01T00:01:00", "d": 3}
+{"n": null, "ts": null, "d": null}
+)",
+                                 &parsed));
+  AssertArraysEqual(*ArrayFromJSON(timestamp(TimeUnit::SECOND), "[60, null]"),
+                    *parsed->field(0));
+  AssertArraysEqual(*ArrayFromJSON(date32(), "[3, null]"), *parsed->field(1));
+  AssertArraysEqual(*ArrayFromJSON(null(), "[null, null]"), *parsed->field(2));
+}
+
+TEST(TypedBlockParser, Errors) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema =
+      schema({field("a", int32(), /*nullable=*/false), field("b", utf8())});
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  std::shared_ptr<StructArray> parsed;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Column(/b) changed from string to number in row 1"),
+      ParseTypedFromString(options, "{\"a\": 0}\n{\"a\": 1, \"b\": 2}", &parsed));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Column(/a) changed from number to array in row 0"),
+      ParseTypedFromString(options, "{\"a\": [0]}", &parsed));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Failed to convert JSON to int32"),
+      ParseTypedFromString(options, "{\"a\": 1.5}", &parsed));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("Column(/a) was specified twice in row 0"),
+      ParseTypedFromString(options, "{\"a\": 0, \"a\": 1}", &parsed));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("a required field was null"),
+      ParseTypedFromString(options, "{\"a\": null}", &parsed));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("a required field was absent"),
+      ParseTypedFromString(options, "{\"b\": \"\"}", &parsed));
+}
+
+TEST(TypedBlockParser, Unsupported) {
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema({field("a", int32())});
+  std::unique_ptr<BlockParser> parser;
+  // Unexpected fields must be ignored
+  ASSERT_RAISES(NotImplemented,
+                BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  ASSERT_OK(BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+  // Nested fields are not supported
+  options.explicit_schema = schema({field("a", list(int32()))});
+  ASSERT_RAISES(NotImplemented,
+                BlockParser::MakeTyped(default_memory_pool(), options, &parser));
+}
+
 }  // namespace json
 }  // namespace arrow
@@ -137,11 +137,21 @@ class DecodeContext {
   MemoryPool* pool_;
 };
 
+// Prefer a parser which decodes directly into the types of the explicit schema
+Status MakeBlockParser(MemoryPool* pool, const ParseOptions& parse_options,
+                       std::unique_ptr<BlockParser>* out) {
+  Status st = BlockParser::MakeTyped(pool, parse_options, out);
+  if (st.IsNotImplemented()) {
+    return BlockParser::Make(pool, parse_options, out);
+  }
+  return st;
+}
+
 Result<std::shared_ptr<Array>> ParseBlock(const ChunkedBlock& block,
                                           const ParseOptions& parse_options,
                                           MemoryPool* pool, int64_t* out_size = nullptr) {
   std::unique_ptr<BlockParser> parser;
-  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(MakeBlockParser(pool, parse_options, &parser));
 
   int64_t size = block.partial->size() + block.completion->size() + block.whole->size();
   RETURN_NOT_OK(parser->ReserveScalarStorage(size));
@@ -539,7 +549,7 @@ Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
   DecodeContext context(std::move(options));
 
   std::unique_ptr<BlockParser> parser;
-  RETURN_NOT_OK(BlockParser::Make(context.parse_options(), &parser));
+  RETURN_NOT_OK(MakeBlockParser(context.pool(), context.parse_options(), &parser));
   RETURN_NOT_OK(parser->Parse(json));
   std::shared_ptr<Array> parsed;
   RETURN_NOT_OK(parser->Finish(&parsed));
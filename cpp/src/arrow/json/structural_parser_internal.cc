@@ -0,0 +1,375 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/structural_parser_internal.h"
+
+#include <cstring>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/simd.h"
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+namespace {
+
+constexpr int64_t kBlockSize = 64;
+
+// Bitmasks of the character classes in a 64-byte block (bit N for byte N)
+struct BlockMasks {
+  uint64_t quote;
+  uint64_t backslash;
+  uint64_t op;
+  uint64_t whitespace;
+  uint64_t control;
+};
+
+#if defined(ARROW_HAVE_SSE4_2)
+
+struct Masks16 {
+  uint16_t quote, backslash, op, whitespace, control;
+};
+
+inline uint16_t MoveMask(__m128i v) {
+  return static_cast<uint16_t>(_mm_movemask_epi8(v));
+}
+
+inline __m128i Eq(__m128i w, char c) { return _mm_cmpeq_epi8(w, _mm_set1_epi8(c)); }
+
+Masks16 Classify16(const char* data) {
+  const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  __m128i op = _mm_or_si128(Eq(w, '{'), Eq(w, '}'));
+  op = _mm_or_si128(op, _mm_or_si128(Eq(w, '['), Eq(w, ']')));
+  op = _mm_or_si128(op, _mm_or_si128(Eq(w, ':'), Eq(w, ',')));
+  __m128i ws = _mm_or_si128(Eq(w, ' '), Eq(w, '\t'));
+  ws = _mm_or_si128(ws, _mm_or_si128(Eq(w, '\n'), Eq(w, '\r')));
+  // Unsigned w <= 0x1f
+  const __m128i control = _mm_cmpeq_epi8(_mm_min_epu8(w, _mm_set1_epi8(0x1f)), w);
+  return {MoveMask(Eq(w, '"')), MoveMask(Eq(w, '\\')), MoveMask(op), MoveMask(ws),
+          MoveMask(control)};
+}
+
+BlockMasks Classify(const char* data) {
+  BlockMasks masks{0, 0, 0, 0, 0};
+  for (int i = 0; i < 4; ++i) {
+    const Masks16 m = Classify16(data + 16 * i);
+    masks.quote |= static_cast<uint64_t>(m.quote) << (16 * i);
+    masks.backslash |= static_cast<uint64_t>(m.backslash) << (16 * i);
+    masks.op |= static_cast<uint64_t>(m.op) << (16 * i);
+    masks.whitespace |= static_cast<uint64_t>(m.whitespace) << (16 * i);
+    masks.control |= static_cast<uint64_t>(m.control) << (16 * i);
+  }
+  return masks;
+}
+
+#else
+
+BlockMasks Classify(const char* data) {
+  BlockMasks masks{0, 0, 0, 0, 0};
+  for (int i = 0; i < kBlockSize; ++i) {
+    const auto c = static_cast<uint8_t>(data[i]);
+    const uint64_t bit = static_cast<uint64_t>(1) << i;
+    switch (c) {
+      case '"':
+        masks.quote |= bit;
+        break;
+      case '\\':
+        masks.backslash |= bit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        masks.op |= bit;
+        break;
+      case ' ':
+        masks.whitespace |= bit;
+        break;
+      case '\t':
+      case '\n':
+      case '\r':
+        masks.whitespace |= bit;
+        masks.control |= bit;
+        break;
+      default:
+        if (c < 0x20) {
+          masks.control |= bit;
+        }
+    }
+  }
+  return masks;
+}
+
+#endif
+
+// Return the mask of characters escaped by a backslash.  `*prev_escaped` is 1
+// if the first character of the block is escaped by the previous block.
+inline uint64_t FindEscaped(uint64_t backslash, uint64_t* prev_escaped) {
+  // An escaped backslash does not escape the next character
+  backslash &= ~*prev_escaped;
+  const uint64_t follows_escape = (backslash << 1) | *prev_escaped;
+  // In each run of backslashes, every other character (starting with the one
+  // after the first backslash) is escaped.  Runs starting on odd bits are
+  // found by adding their start to the run: the carry flips the parity.
+  constexpr uint64_t kEvenBits = 0x5555555555555555ULL;
+  const uint64_t odd_sequence_starts = backslash & ~kEvenBits & ~follows_escape;
+  const uint64_t sequences_starting_on_even_bits = odd_sequence_starts + backslash;
+  *prev_escaped = sequences_starting_on_even_bits < backslash ? 1 : 0;
+  const uint64_t invert_mask = sequences_starting_on_even_bits << 1;
+  return (kEvenBits ^ invert_mask) & follows_escape;
+}
+
+// Bit N of the result is the XOR of bits 0 to N of the input
+inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+void AppendPositions(uint64_t bits, uint32_t base, std::vector<uint32_t>* positions) {
+  const auto old_size = positions->size();
+  positions->resize(old_size + bit_util::PopCount(bits));
+  uint32_t* out = positions->data() + old_size;
+  while (bits != 0) {
+    *out++ = base + static_cast<uint32_t>(bit_util::CountTrailingZeros(bits));
+    bits &= bits - 1;
+  }
+}
+
+inline bool IsHexDigit(char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+inline uint32_t HexValue(char c) {
+  if (c <= '9') return c - '0';
+  return (c | 0x20) - 'a' + 10;
+}
+
+// Parse 4 hex digits at `data`, returning false if invalid
+bool ParseHex4(const char* data, const char* end, uint32_t* out) {
+  if (end - data < 4) {
+    return false;
+  }
+  uint32_t value = 0;
+  for (int i = 0; i < 4; ++i) {
+    if (!IsHexDigit(data[i])) {
+      return false;
+    }
+    value = (value << 4) | HexValue(data[i]);
+  }
+  *out = value;
+  return true;
+}
+
+void AppendUTF8(uint32_t codepoint, std::string* out) {
+  if (codepoint < 0x80) {
+    out->push_back(static_cast<char>(codepoint));
+  } else if (codepoint < 0x800) {
+    out->push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else if (codepoint < 0x10000) {
+    out->push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  } else {
+    out->push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+    out->push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+  }
+}
+
+}  // namespace
+
+Status StructuralIndex::Build(std::string_view json) {
+  if (ARROW_PREDICT_FALSE(json.size() > std::numeric_limits<uint32_t>::max())) {
+    return Status::Invalid("JSON block too large");
+  }
+  positions_.clear();
+  uint64_t prev_escaped = 0;
+  // All ones if the previous block ended inside a string
+  uint64_t prev_in_string = 0;
+  // 1 if the previous block ended with a number or literal
+  uint64_t prev_scalar = 0;
+  uint64_t control_in_strings = 0;
+
+  auto index_block = [&](const char* block, uint32_t base) {
+    const BlockMasks masks = Classify(block);
+    const uint64_t escaped = FindEscaped(masks.backslash, &prev_escaped);
+    const uint64_t quote = masks.quote & ~escaped;
+    // Set from each opening quote up to (excluding) the closing quote
+    const uint64_t in_string = PrefixXor(quote) ^ prev_in_string;
+    prev_in_string = static_cast<uint64_t>(static_cast<int64_t>(in_string) >> 63);
+    control_in_strings |= masks.control & in_string;
+
+    const uint64_t op = masks.op & ~in_string;
+    const uint64_t scalar = ~(masks.op | masks.whitespace | quote) & ~in_string;
+    const uint64_t scalar_start = scalar & ~((scalar << 1) | prev_scalar);
+    prev_scalar = scalar >> 63;
+    AppendPositions(op | quote | scalar_start, base, &positions_);
+  };
+
+  const char* data = json.data();
+  const auto size = static_cast<int64_t>(json.size());
+  int64_t offset = 0;
+  for (; offset + kBlockSize <= size; offset += kBlockSize) {
+    index_block(data + offset, static_cast<uint32_t>(offset));
+  }
+  if (offset < size) {
+    // Pad the trailing partial block with whitespace
+    char block[kBlockSize];
+    std::memset(block, ' ', kBlockSize);
+    std::memcpy(block, data + offset, size - offset);
+    index_block(block, static_cast<uint32_t>(offset));
+  }
+  control_chars_in_strings_ = control_in_strings != 0;
+  return Status::OK();
+}
+
+Status StructuralParser::ParseString(uint32_t pos, int32_t row, std::string_view* out) {
+  // The next indexed position is the closing quote, if any
+  if (ARROW_PREDICT_FALSE(next_ == num_positions_)) {
+    return ParseError("Missing a closing quotation mark in string.", row);
+  }
+  const uint32_t end_pos = positions_[next_++];
+  DCHECK_EQ(data_[end_pos], '"');
+  const char* begin = data_ + pos + 1;
+  const char* end = data_ + end_pos;
+
+  if (ARROW_PREDICT_FALSE(index_.has_control_chars_in_strings())) {
+    for (const char* p = begin; p < end; ++p) {
+      if (static_cast<uint8_t>(*p) < 0x20) {
+        return ParseError("Invalid encoding in string.", row);
+      }
+    }
+  }
+
+  auto backslash = static_cast<const char*>(std::memchr(begin, '\\', end - begin));
+  if (ARROW_PREDICT_TRUE(backslash == nullptr)) {
+    *out = std::string_view(begin, end - begin);
+    return Status::OK();
+  }
+
+  unescaped_.assign(begin, backslash);
+  const char* p = backslash;
+  while (p < end) {
+    if (*p != '\\') {
+      // Copy up to the next escape
+      backslash = static_cast<const char*>(std::memchr(p, '\\', end - p));
+      const char* run_end = backslash == nullptr ? end : backslash;
+      unescaped_.append(p, run_end);
+      p = run_end;
+      continue;
+    }
+    // A backslash cannot be last, as it would escape the closing quote
+    DCHECK_LT(p + 1, end);
+    const char c = p[1];
+    p += 2;
+    switch (c) {
+      case '"':
+      case '\\':
+      case '/':
+        unescaped_.push_back(c);
+        break;
+      case 'b':
+        unescaped_.push_back('\b');
+        break;
+      case 'f':
+        unescaped_.push_back('\f');
+        break;
+      case 'n':
+        unescaped_.push_back('\n');
+        break;
+      case 'r':
+        unescaped_.push_back('\r');
+        break;
+      case 't':
+        unescaped_.push_back('\t');
+        break;
+      case 'u': {
+        uint32_t codepoint;
+        if (ARROW_PREDICT_FALSE(!ParseHex4(p, end, &codepoint))) {
+          return ParseError("Incorrect hex digit after \\u escape in string.", row);
+        }
+        p += 4;
+        if (codepoint >= 0xD800 && codepoint <= 0xDFFF) {
+          // Must be a high surrogate followed by an escaped low surrogate
+          uint32_t low;
+          if (ARROW_PREDICT_FALSE(codepoint > 0xDBFF || end - p < 2 || p[0] != '\\' ||
+                                  p[1] != 'u' || !ParseHex4(p + 2, end, &low) ||
+                                  low < 0xDC00 || low > 0xDFFF)) {
+            return ParseError("The surrogate pair in string is invalid.", row);
+          }
+          p += 6;
+          codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+        }
+        AppendUTF8(codepoint, &unescaped_);
+        break;
+      }
+      default:
+        return ParseError("Invalid escape character in string.", row);
+    }
+  }
+  *out = unescaped_;
+  return Status::OK();
+}
+
+bool StructuralParser::IsNumber(std::string_view atom) {
+  size_t i = 0;
+  const size_t n = atom.size();
+  if (i < n && atom[i] == '-') {
+    ++i;
+  }
+  const std::string_view unsigned_part = atom.substr(i);
+  if (unsigned_part == "NaN" || unsigned_part == "Inf" || unsigned_part == "Infinity") {
+    return true;
+  }
+  auto is_digit = [&](size_t j) { return j < n && atom[j] >= '0' && atom[j] <= '9'; };
+  // Integer part, without leading zeros
+  if (i < n && atom[i] == '0') {
+    ++i;
+  } else if (is_digit(i)) {
+    while (is_digit(i)) ++i;
+  } else {
+    return false;
+  }
+  if (i < n && atom[i] == '.') {
+    ++i;
+    if (!is_digit(i)) return false;
+    while (is_digit(i)) ++i;
+  }
+  if (i < n && (atom[i] == 'e' || atom[i] == 'E')) {
+    ++i;
+    if (i < n && (atom[i] == '+' || atom[i] == '-')) ++i;
+    if (!is_digit(i)) return false;
+    while (is_digit(i)) ++i;
+  }
+  return i == n;
+}
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
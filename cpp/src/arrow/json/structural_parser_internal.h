@@ -0,0 +1,255 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace json {
+namespace internal {
+
+/// \brief Index of the structural characters in a block of JSON
+///
+/// The block is scanned 64 bytes at a time, computing bitmasks of the quotes,
+/// backslashes, operators and whitespace from which the extent of strings is
+/// derived without branching on each byte.  The index records, in order, the
+/// positions of the operators ({}[]:,) outside of strings, of all unescaped
+/// quotes, and of the first character of other values (numbers and literals).
+class ARROW_EXPORT StructuralIndex {
+ public:
+  Status Build(std::string_view json);
+
+  const std::vector<uint32_t>& positions() const { return positions_; }
+
+  /// \brief Whether some string contains an unescaped control character
+  bool has_control_chars_in_strings() const { return control_chars_in_strings_; }
+
+ private:
+  std::vector<uint32_t> positions_;
+  bool control_chars_in_strings_ = false;
+};
+
+/// \brief A parser for newline-delimited JSON driven by a StructuralIndex
+///
+/// This is an alternative to RapidJSON's reader: it emits the same events
+/// to a SAX handler (with numbers as raw strings, and NaN and Infinity
+/// allowed), but only visits the indexed positions instead of every byte.
+class ARROW_EXPORT StructuralParser {
+ public:
+  /// \brief Parse all JSON documents in `json`
+  ///
+  /// `*num_rows` is incremented for each parsed document.  If the handler
+  /// returns false, its Error() is returned.
+  template <typename Handler>
+  Status Parse(std::string_view json, Handler* handler, int32_t* num_rows) {
+    RETURN_NOT_OK(index_.Build(json));
+    data_ = json.data();
+    size_ = json.size();
+    positions_ = index_.positions().data();
+    num_positions_ = index_.positions().size();
+    next_ = 0;
+    while (next_ < num_positions_) {
+      if (ARROW_PREDICT_FALSE(*num_rows == std::numeric_limits<int32_t>::max())) {
+        return Status::Invalid("Row count overflowed int32_t");
+      }
+      RETURN_NOT_OK(ParseDocument(handler, *num_rows));
+      ++*num_rows;
+    }
+    return Status::OK();
+  }
+
+ private:
+  struct Container {
+    bool is_object;
+    uint32_t size;
+  };
+
+  template <typename Handler>
+  Status ParseDocument(Handler* handler, int32_t row) {
+    stack_.clear();
+
+#define ARROW_JSON_HANDLE(EVENT)              \
+  if (ARROW_PREDICT_FALSE(!handler->EVENT)) { \
+    return handler->Error();                  \
+  }
+
+  Value:
+    if (ARROW_PREDICT_FALSE(next_ == num_positions_)) {
+      return ParseError("Invalid value.", row);
+    }
+    {
+      const uint32_t pos = positions_[next_++];
+      switch (data_[pos]) {
+        case '{':
+          ARROW_JSON_HANDLE(StartObject());
+          if (next_ < num_positions_ && data_[positions_[next_]] == '}') {
+            ++next_;
+            ARROW_JSON_HANDLE(EndObject(0));
+            goto AfterValue;
+          }
+          stack_.push_back({true, 0});
+          goto Key;
+        case '[':
+          ARROW_JSON_HANDLE(StartArray());
+          if (next_ < num_positions_ && data_[positions_[next_]] == ']') {
+            ++next_;
+            ARROW_JSON_HANDLE(EndArray(0));
+            goto AfterValue;
+          }
+          stack_.push_back({false, 0});
+          goto Value;
+        case '"': {
+          std::string_view value;
+          RETURN_NOT_OK(ParseString(pos, row, &value));
+          ARROW_JSON_HANDLE(
+              String(value.data(), static_cast<uint32_t>(value.size()), true));
+          goto AfterValue;
+        }
+        case ',':
+        case ':':
+        case '}':
+        case ']':
+          return ParseError("Invalid value.", row);
+        default: {
+          const std::string_view atom = Atom(pos);
+          if (atom == "true") {
+            ARROW_JSON_HANDLE(Bool(true));
+          } else if (atom == "false") {
+            ARROW_JSON_HANDLE(Bool(false));
+          } else if (atom == "null") {
+            ARROW_JSON_HANDLE(Null());
+          } else if (ARROW_PREDICT_TRUE(IsNumber(atom))) {
+            ARROW_JSON_HANDLE(
+                RawNumber(atom.data(), static_cast<uint32_t>(atom.size()), true));
+          } else {
+            return ParseError("Invalid value.", row);
+          }
+          goto AfterValue;
+        }
+      }
+    }
+
+  Key:
+    if (ARROW_PREDICT_FALSE(next_ == num_positions_ ||
+                            data_[positions_[next_]] != '"')) {
+      return ParseError("Missing a name for object member.", row);
+    }
+    {
+      std::string_view key;
+      RETURN_NOT_OK(ParseString(positions_[next_++], row, &key));
+      ARROW_JSON_HANDLE(Key(key.data(), static_cast<uint32_t>(key.size()), true));
+    }
+    if (ARROW_PREDICT_FALSE(next_ == num_positions_ ||
+                            data_[positions_[next_]] != ':')) {
+      return ParseError("Missing a colon after a name of object member.", row);
+    }
+    ++next_;
+    goto Value;
+
+  AfterValue:
+    if (stack_.empty()) {
+      return Status::OK();
+    }
+    {
+      Container& container = stack_.back();
+      ++container.size;
+      const char c = next_ < num_positions_ ? data_[positions_[next_++]] : '\0';
+      if (container.is_object) {
+        if (c == ',') {
+          goto Key;
+        }
+        if (ARROW_PREDICT_FALSE(c != '}')) {
+          return ParseError("Missing a comma or '}' after an object member.", row);
+        }
+        ARROW_JSON_HANDLE(EndObject(container.size));
+      } else {
+        if (c == ',') {
+          goto Value;
+        }
+        if (ARROW_PREDICT_FALSE(c != ']')) {
+          return ParseError("Missing a comma or ']' after an array element.", row);
+        }
+        ARROW_JSON_HANDLE(EndArray(container.size));
+      }
+      stack_.pop_back();
+    }
+    goto AfterValue;
+
+#undef ARROW_JSON_HANDLE
+  }
+
+  // Parse the string starting with the quote at `pos`, unescaping it if necessary
+  Status ParseString(uint32_t pos, int32_t row, std::string_view* out);
+
+  // Return the number or literal starting at `pos`
+  std::string_view Atom(uint32_t pos) const {
+    uint32_t end = pos + 1;
+    while (end < size_ && !IsAtomEnd(data_[end])) {
+      ++end;
+    }
+    return {data_ + pos, end - pos};
+  }
+
+  static bool IsAtomEnd(char c) {
+    switch (c) {
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+      case '"':
+      case ',':
+      case ':':
+      case '[':
+      case ']':
+      case '{':
+      case '}':
+        return true;
+      default:
+        return false;
+    }
+  }
+
+  static bool IsNumber(std::string_view atom);
+
+  static Status ParseError(const char* message, int32_t row) {
+    return Status::Invalid("JSON parse error: ", message, " in row ", row);
+  }
+
+  StructuralIndex index_;
+  const char* data_ = NULLPTR;
+  size_t size_ = 0;
+  const uint32_t* positions_ = NULLPTR;
+  size_t num_positions_ = 0;
+  // The next position to visit
+  size_t next_ = 0;
+  std::vector<Container> stack_;
+  std::string unescaped_;
+};
+
+}  // namespace internal
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,551 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/json/writer.h"
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/extension_type.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/result.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/decimal.h"
+#include "arrow/util/formatting.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
+#include "arrow/visit_type_inline.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::StringFormatter;
+
+namespace json {
+
+// A batch is formatted column by column into one buffer per row: the type of each
+// column is dispatched on once, then its values are appended to the buffers of the
+// successive rows.  Nested values are formatted recursively.  The row buffers are
+// retained across batches to reuse their allocations, and concatenated into the
+// output once all columns were formatted.
+//
+// Like with the CSV writer, consecutive batches are independent from each other, so
+// that several of them can be formatted concurrently (see WriteOptions::use_threads)
+// and then written out in order.
+
+namespace {
+
+// Appends `value` as a JSON string, escaping it as required
+void AppendQuoted(std::string_view value, std::string* out) {
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  out->push_back('"');
+  size_t unescaped_begin = 0;
+  for (size_t i = 0; i < value.size(); ++i) {
+    const auto c = static_cast<uint8_t>(value[i]);
+    if (ARROW_PREDICT_TRUE(c >= 0x20 && c != '"' && c != '\\')) {
+      continue;
+    }
+    out->append(value.data() + unescaped_begin, i - unescaped_begin);
+    unescaped_begin = i + 1;
+    switch (c) {
+      case '"':
+        out->append("\\\"");
+        break;
+      case '\\':
+        out->append("\\\\");
+        break;
+      case '\n':
+        out->append("\\n");
+        break;
+      case '\r':
+        out->append("\\r");
+        break;
+      case '\t':
+        out->append("\\t");
+        break;
+      case '\b':
+        out->append("\\b");
+        break;
+      case '\f':
+        out->append("\\f");
+        break;
+      default:
+        out->append("\\u00");
+        out->push_back(kHexDigits[c >> 4]);
+        out->push_back(kHexDigits[c & 0xf]);
+    }
+  }
+  out->append(value.data() + unescaped_begin, value.size() - unescaped_begin);
+  out->push_back('"');
+}
+
+// The `"name":` prefix of each field, preceded by a comma for all but the first
+std::vector<std::string> MemberPrefixes(const FieldVector& fields) {
+  std::vector<std::string> prefixes(fields.size());
+  for (size_t i = 0; i < fields.size(); ++i) {
+    if (i > 0) prefixes[i].push_back(',');
+    AppendQuoted(fields[i]->name(), &prefixes[i]);
+    prefixes[i].push_back(':');
+  }
+  return prefixes;
+}
+
+// Appends the JSON representation of the values of an array
+class ValueFormatter {
+ public:
+  explicit ValueFormatter(std::shared_ptr<Array> array) : array_(std::move(array)) {}
+
+  virtual ~ValueFormatter() = default;
+
+  void Format(int64_t i, std::string* out) {
+    if (array_->IsNull(i)) {
+      out->append("null");
+    } else {
+      FormatValid(i, out);
+    }
+  }
+
+ protected:
+  virtual void FormatValid(int64_t i, std::string* out) = 0;
+
+  std::shared_ptr<Array> array_;
+};
+
+Result<std::unique_ptr<ValueFormatter>> MakeValueFormatter(std::shared_ptr<Array> array);
+
+class NullFormatter : public ValueFormatter {
+ public:
+  using ValueFormatter::ValueFormatter;
+
+ protected:
+  void FormatValid(int64_t i, std::string* out) override { out->append("null"); }
+};
+
+template <typename ArrayType>
+auto ValueToFormat(const ArrayType& array, int64_t i) {
+  return array.Value(i);
+}
+
+Decimal128 ValueToFormat(const Decimal128Array& array, int64_t i) {
+  return Decimal128(array.GetValue(i));
+}
+
+Decimal256 ValueToFormat(const Decimal256Array& array, int64_t i) {
+  return Decimal256(array.GetValue(i));
+}
+
+// Booleans, integers and durations
+template <typename T>
+class NumberFormatter : public ValueFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  explicit NumberFormatter(std::shared_ptr<Array> array)
+      : ValueFormatter(std::move(array)),
+        values_(checked_cast<const ArrayType&>(*array_)),
+        formatter_(array_->type().get()) {}
+
+ protected:
+  void FormatValid(int64_t i, std::string* out) override {
+    formatter_(ValueToFormat(values_, i), [out](std::string_view v) { out->append(v); });
+  }
+
+  const ArrayType& values_;
+  StringFormatter<T> formatter_;
+};
+
+template <typename CType>
+bool IsFinite(CType value) {
+  return std::isfinite(value);
+}
+
+bool IsFinite(uint16_t half_float_bits) {
+  // All exponent bits are set for infinities and NaNs
+  return (half_float_bits & 0x7c00) != 0x7c00;
+}
+
+// JSON has no representation for NaN and infinities, which are written as null
+template <typename T>
+class FloatFormatter : public NumberFormatter<T> {
+ public:
+  using NumberFormatter<T>::NumberFormatter;
+
+ protected:
+  void FormatValid(int64_t i, std::string* out) override {
+    const auto value = this->values_.Value(i);
+    if (IsFinite(value)) {
+      this->formatter_(value, [out](std::string_view v) { out->append(v); });
+    } else {
+      out->append("null");
+    }
+  }
+};
+
+// Decimals and temporal values, whose formatted representation needs no escaping
+template <typename T>
+class QuotedFormatter : public NumberFormatter<T> {
+ public:
+  using NumberFormatter<T>::NumberFormatter;
+
+ protected:
+  void FormatValid(int64_t i, std::string* out) override {
+    out->push_back('"');
+    this->formatter_(ValueToFormat(this->values_, i),
+                     [out](std::string_view v) { out->append(v); });
+    out->push_back('"');
+  }
+};
+
+template <typename T>
+class StringFormatterImpl : public ValueFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  explicit StringFormatterImpl(std::shared_ptr<Array> array)
+      : ValueFormatter(std::move(array)),
+        values_(checked_cast<const ArrayType&>(*array_)) {}
+
+ protected:
+  void FormatValid(int64_t i, std::string* out) override {
+    AppendQuoted(values_.GetView(i), out);
+  }
+
+  const ArrayType& values_;
+};
+
+template <typename T>
+class ListFormatter : public ValueFormatter {
+ public:
+  using ArrayType = typename TypeTraits<T>::ArrayType;
+
+  ListFormatter(std::shared_ptr<Array> array, std::unique_ptr<ValueFormatter> values)
+      : ValueFormatter(std::move(array)),
+        lists_(checked_cast<const ArrayType&>(*array_)),
+        values_(std::move(values)) {}
+
+ protected:
+  void FormatValid(int64_t i, std::string* out) override {
+    out->push_back('[');
+    const int64_t begin = lists_.value_offset(i);
+    const int64_t end = begin + lists_.value_length(i);
+    for (int64_t j = begin; j < end; ++j) {
+      if (j > begin) out->push_back(',');
+      values_->Format(j, out);
+    }
+    out->push_back(']');
+  }
+
+  const ArrayType& lists_;
+  std::unique_ptr<ValueFormatter> values_;
+};
+
+class StructFormatter : public ValueFormatter {
+ public:
+  StructFormatter(std::shared_ptr<Array> array,
+                  std::vector<std::unique_ptr<ValueFormatter>> fields)
+      : ValueFormatter(std::move(array)),
+        prefixes_(MemberPrefixes(array_->type()->fields())),
+        fields_(std::move(fields)) {}
+
+ protected:
+  void FormatValid(int64_t i, std::string* out) override {
+    out->push_back('{');
+    for (size_t field = 0; field < fields_.size(); ++field) {
+      out->append(prefixes_[field]);
+      fields_[field]->Format(i, out);
+    }
+    out->push_back('}');
+  }
+
+  const std::vector<std::string> prefixes_;
+  std::vector<std::unique_ptr<ValueFormatter>> fields_;
+};
+
+class DictionaryFormatter : public ValueFormatter {
+ public:
+  DictionaryFormatter(std::shared_ptr<Array> array,
+                      std::unique_ptr<ValueFormatter> dictionary)
+      : ValueFormatter(std::move(array)),
+        indices_(checked_cast<const DictionaryArray&>(*array_)),
+        dictionary_(std::move(dictionary)) {}
+
+ protected:
+  void FormatValid(int64_t i, std::string* out) override {
+    dictionary_->Format(indices_.GetValueIndex(i), out);
+  }
+
+  const DictionaryArray& indices_;
+  std::unique_ptr<ValueFormatter> dictionary_;
+};
+
+struct ValueFormatterFactory {
+  template <typename T>
+  enable_if_t<is_boolean_type<T>::value || is_integer_type<T>::value ||
+                  is_duration_type<T>::value,
+              Status>
+  Visit(const T&) {
+    out = std::make_unique<NumberFormatter<T>>(std::move(array));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_floating_point<T, Status> Visit(const T&) {
+    out = std::make_unique<FloatFormatter<T>>(std::move(array));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<is_date_type<T>::value || is_time_type<T>::value ||
+                  is_timestamp_type<T>::value || std::is_same<Decimal128Type, T>::value ||
+                  std::is_same<Decimal256Type, T>::value,
+              Status>
+  Visit(const T&) {
+    out = std::make_unique<QuotedFormatter<T>>(std::move(array));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_has_string_view<T, Status> Visit(const T&) {
+    out = std::make_unique<StringFormatterImpl<T>>(std::move(array));
+    return Status::OK();
+  }
+
+  template <typename T>
+  enable_if_t<is_list_like_type<T>::value || is_list_view_type<T>::value, Status> Visit(
+      const T&) {
+    using ArrayType = typename TypeTraits<T>::ArrayType;
+    ARROW_ASSIGN_OR_RAISE(
+        auto values,
+        MakeValueFormatter(checked_cast<const ArrayType&>(*array).values()));
+    out = std::make_unique<ListFormatter<T>>(std::move(array), std::move(values));
+    return Status::OK();
+  }
+
+  Status Visit(const NullType&) {
+    out = std::make_unique<NullFormatter>(std::move(array));
+    return Status::OK();
+  }
+
+  Status Visit(const StructType& type) {
+    const auto& struct_array = checked_cast<const StructArray&>(*array);
+    std::vector<std::unique_ptr<ValueFormatter>> fields(type.num_fields());
+    for (int i = 0; i < type.num_fields(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(fields[i], MakeValueFormatter(struct_array.field(i)));
+    }
+    out = std::make_unique<StructFormatter>(std::move(array), std::move(fields));
+    return Status::OK();
+  }
+
+  Status Visit(const DictionaryType&) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto dictionary,
+        MakeValueFormatter(checked_cast<const DictionaryArray&>(*array).dictionary()));
+    out = std::make_unique<DictionaryFormatter>(std::move(array), std::move(dictionary));
+    return Status::OK();
+  }
+
+  Status Visit(const ExtensionType&) {
+    ARROW_ASSIGN_OR_RAISE(
+        out, MakeValueFormatter(checked_cast<const ExtensionArray&>(*array).storage()));
+    return Status::OK();
+  }
+
+  Status Visit(const DataType& type) {
+    return Status::NotImplemented("Writing values of type ", type, " as JSON");
+  }
+
+  std::shared_ptr<Array> array;
+  std::unique_ptr<ValueFormatter> out;
+};
+
+Result<std::unique_ptr<ValueFormatter>> MakeValueFormatter(std::shared_ptr<Array> array) {
+  ValueFormatterFactory factory{array};
+  RETURN_NOT_OK(VisitTypeInline(*array->type(), &factory));
+  return std::move(factory.out);
+}
+
+// Formats batches into line-separated JSON, reusing its row buffers across calls
+class BatchFormatter {
+ public:
+  BatchFormatter(const Schema& schema, MemoryPool* pool)
+      : prefixes_(MemberPrefixes(schema.fields())), pool_(pool) {}
+
+  Status Format(const RecordBatch& batch) {
+    const int64_t num_rows = batch.num_rows();
+    if (static_cast<int64_t>(rows_.size()) < num_rows) {
+      rows_.resize(num_rows);
+    }
+    for (int64_t i = 0; i < num_rows; ++i) {
+      rows_[i].assign(1, '{');
+    }
+    for (int col = 0; col < batch.num_columns(); ++col) {
+      ARROW_ASSIGN_OR_RAISE(auto formatter, MakeValueFormatter(batch.column(col)));
+      const std::string& prefix = prefixes_[col];
+      for (int64_t i = 0; i < num_rows; ++i) {
+        rows_[i].append(prefix);
+        formatter->Format(i, &rows_[i]);
+      }
+    }
+
+    // Each row is followed by "}\n"
+    int64_t size = 2 * num_rows;
+    for (int64_t i = 0; i < num_rows; ++i) {
+      size += static_cast<int64_t>(rows_[i].size());
+    }
+    ARROW_ASSIGN_OR_RAISE(data_, AllocateBuffer(size, pool_));
+    char* next = reinterpret_cast<char*>(data_->mutable_data());
+    for (int64_t i = 0; i < num_rows; ++i) {
+      memcpy(next, rows_[i].data(), rows_[i].size());
+      next += rows_[i].size();
+      *next++ = '}';
+      *next++ = '\n';
+    }
+    DCHECK_EQ(reinterpret_cast<uint8_t*>(next), data_->data() + data_->size());
+    return Status::OK();
+  }
+
+  const std::shared_ptr<Buffer>& data_buffer() const { return data_; }
+
+ private:
+  const std::vector<std::string> prefixes_;
+  MemoryPool* pool_;
+  std::vector<std::string> rows_;
+  std::shared_ptr<Buffer> data_;
+};
+
+class JSONWriterImpl : public ipc::RecordBatchWriter {
+ public:
+  static Result<std::shared_ptr<JSONWriterImpl>> Make(
+      io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
+      std::shared_ptr<Schema> schema, const WriteOptions& options) {
+    RETURN_NOT_OK(options.Validate());
+    auto writer = std::make_shared<JSONWriterImpl>(sink, std::move(owned_sink),
+                                                   std::move(schema), options);
+    // One formatter per batch formatted concurrently
+    const int num_formatters =
+        options.use_threads ? std::max(GetCpuThreadPoolCapacity(), 1) : 1;
+    for (int i = 0; i < num_formatters; ++i) {
+      writer->formatters_.push_back(std::make_unique<BatchFormatter>(
+          *writer->schema_, writer->options_.io_context.pool()));
+    }
+    return writer;
+  }
+
+  Status WriteRecordBatch(const RecordBatch& batch) override {
+    for (int64_t offset = 0; offset < batch.num_rows(); offset += options_.batch_size) {
+      RETURN_NOT_OK(AddBatch(batch.Slice(offset, options_.batch_size)));
+    }
+    return FlushBatches();
+  }
+
+  Status WriteTable(const Table& table, int64_t max_chunksize) override {
+    TableBatchReader reader(table);
+    reader.set_chunksize(max_chunksize > 0 ? max_chunksize : options_.batch_size);
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader.ReadNext(&batch));
+    while (batch != nullptr) {
+      RETURN_NOT_OK(AddBatch(std::move(batch)));
+      RETURN_NOT_OK(reader.ReadNext(&batch));
+    }
+    return FlushBatches();
+  }
+
+  Status Close() override { return Status::OK(); }
+
+  ipc::WriteStats stats() const override { return stats_; }
+
+  JSONWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
+                 std::shared_ptr<Schema> schema, const WriteOptions& options)
+      : sink_(sink),
+        owned_sink_(std::move(owned_sink)),
+        schema_(std::move(schema)),
+        options_(options) {}
+
+ private:
+  // Queue a batch for formatting, formatting and writing the queued batches
+  // once there is one for each formatter
+  Status AddBatch(std::shared_ptr<RecordBatch> batch) {
+    pending_batches_.push_back(std::move(batch));
+    if (pending_batches_.size() == formatters_.size()) {
+      return FlushBatches();
+    }
+    return Status::OK();
+  }
+
+  Status FlushBatches() {
+    const int num_batches = static_cast<int>(pending_batches_.size());
+    Status st = ::arrow::internal::OptionalParallelFor(
+        options_.use_threads && num_batches > 1, num_batches,
+        [&](int i) { return formatters_[i]->Format(*pending_batches_[i]); });
+    pending_batches_.clear();
+    RETURN_NOT_OK(st);
+    for (int i = 0; i < num_batches; ++i) {
+      RETURN_NOT_OK(sink_->Write(formatters_[i]->data_buffer()));
+      stats_.num_record_batches++;
+    }
+    return Status::OK();
+  }
+
+  io::OutputStream* sink_;
+  std::shared_ptr<io::OutputStream> owned_sink_;
+  const std::shared_ptr<Schema> schema_;
+  const WriteOptions options_;
+  std::vector<std::unique_ptr<BatchFormatter>> formatters_;
+  std::vector<std::shared_ptr<RecordBatch>> pending_batches_;
+  ipc::WriteStats stats_;
+};
+
+}  // namespace
+
+Status WriteJSON(const Table& table, const WriteOptions& options,
+                 arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(output, table.schema(), options));
+  RETURN_NOT_OK(writer->WriteTable(table));
+  return writer->Close();
+}
+
+Status WriteJSON(const RecordBatch& batch, const WriteOptions& options,
+                 arrow::io::OutputStream* output) {
+  ARROW_ASSIGN_OR_RAISE(auto writer, MakeJSONWriter(output, batch.schema(), options));
+  RETURN_NOT_OK(writer->WriteRecordBatch(batch));
+  return writer->Close();
+}
+
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options) {
+  return JSONWriterImpl::Make(sink.get(), sink, schema, options);
+}
+
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options) {
+  return JSONWriterImpl::Make(sink, nullptr, schema, options);
+}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/ipc/type_fwd.h"
+#include "arrow/json/options.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+
+namespace arrow {
+namespace json {
+
+// Functionality for converting Arrow data to line-separated JSON.
+// Each row is written as a JSON object on its own line, with one member per column.
+// It applies the following formatting rules:
+//  - Nulls, including NaN and infinite floating-point values, are written as null.
+//  - Numbers and booleans are written as JSON numbers and booleans.
+//  - Strings and binaries are written as escaped JSON strings; binary values are
+//  expected to be UTF-8 for the output to be valid JSON.
+//  - Decimals, dates, times and timestamps are written as strings, formatted like
+//  the CSV writer does.
+//  - Structs are written as objects, lists as arrays, maps as arrays of
+//  {"key": ..., "value": ...} objects, dictionaries as their decoded values.
+
+/// \defgroup json-write-functions High-level functions for writing JSON files
+/// @{
+
+/// \brief Convert table to line-separated JSON and write the result to output.
+/// Experimental
+ARROW_EXPORT Status WriteJSON(const Table& table, const WriteOptions& options,
+                              arrow::io::OutputStream* output);
+/// \brief Convert batch to line-separated JSON and write the result to output.
+/// Experimental
+ARROW_EXPORT Status WriteJSON(const RecordBatch& batch, const WriteOptions& options,
+                              arrow::io::OutputStream* output);
+
+/// @}
+
+/// \defgroup json-writer-factories Functions for creating an incremental JSON writer
+/// @{
+
+/// \brief Create a new line-separated JSON writer. User is responsible for closing the
+/// actual OutputStream.
+///
+/// \param[in] sink output stream to write to
+/// \param[in] schema the schema of the record batches to be written
+/// \param[in] options options for serialization
+/// \return Result<std::shared_ptr<RecordBatchWriter>>
+ARROW_EXPORT
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    std::shared_ptr<io::OutputStream> sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options = WriteOptions::Defaults());
+
+/// \brief Create a new line-separated JSON writer.
+///
+/// \param[in] sink output stream to write to (does not take ownership)
+/// \param[in] schema the schema of the record batches to be written
+/// \param[in] options options for serialization
+/// \return Result<std::shared_ptr<RecordBatchWriter>>
+ARROW_EXPORT
+Result<std::shared_ptr<ipc::RecordBatchWriter>> MakeJSONWriter(
+    io::OutputStream* sink, const std::shared_ptr<Schema>& schema,
+    const WriteOptions& options = WriteOptions::Defaults());
+
+/// @}
+
+}  // namespace json
+}  // namespace arrow
@@ -0,0 +1,160 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gmock/gmock-matchers.h>
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/io/memory.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/json/options.h"
+#include "arrow/json/reader.h"
+#include "arrow/json/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace json {
+
+Result<std::string> ToJSON(const RecordBatch& batch,
+                           const WriteOptions& options = WriteOptions::Defaults()) {
+  ARROW_ASSIGN_OR_RAISE(auto out, io::BufferOutputStream::Create());
+  RETURN_NOT_OK(WriteJSON(batch, options, out.get()));
+  ARROW_ASSIGN_OR_RAISE(auto buffer, out->Finish());
+  return buffer->ToString();
+}
+
+TEST(WriteJSON, Scalars) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("i", int32()), field("f", float64()), field("b", boolean()),
+              field("s", utf8()), field("ts", timestamp(TimeUnit::SECOND)),
+              field("d", decimal128(5, 2)), field("n", null())}),
+      R"([
+    [1, 1.5, true, "a", 0, "123.45", null],
+    [null, -2, false, "quote\" backslash\\ newline\n tab\t bell\u0007", 86400, null,
+     null],
+    [-3, null, null, null, null, "-0.01", null]
+  ])");
+  ASSERT_OK_AND_ASSIGN(auto json, ToJSON(*batch));
+  ASSERT_EQ(json,
+            R"({"i":1,"f":1.5,"b":true,"s":"a","ts":"1970-01-01 00:00:00",)"
+            R"("d":"123.45","n":null})"
+            "\n"
+            R"({"i":null,"f":-2,"b":false,)"
+            R"("s":"quote\" backslash\\ newline\n tab\t bell\u0007",)"
+            R"("ts":"1970-01-02 00:00:00","d":null,"n":null})"
+            "\n"
+            R"({"i":-3,"f":null,"b":null,"s":null,"ts":null,"d":"-0.01","n":null})"
+            "\n");
+}
+
+TEST(WriteJSON, NonFiniteFloats) {
+  auto batch = RecordBatchFromJSON(schema({field("f", float32())}),
+                                   R"([[Inf], [-Inf], [NaN], [0.25]])");
+  ASSERT_OK_AND_ASSIGN(auto json, ToJSON(*batch));
+  ASSERT_EQ(json, "{\"f\":null}\n{\"f\":null}\n{\"f\":null}\n{\"f\":0.25}\n");
+}
+
+TEST(WriteJSON, Nested) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("l", list(int16())),
+              field("st", struct_({field("x", utf8()), field("y", list(float64()))})),
+              field("m", map(utf8(), int8()))}),
+      R"([
+    [[1, null, 3], {"x": "a", "y": [1.5]}, [["k", 1]]],
+    [[], {"x": null, "y": null}, []],
+    [null, null, null]
+  ])");
+  ASSERT_OK_AND_ASSIGN(auto json, ToJSON(*batch));
+  ASSERT_EQ(json,
+            R"({"l":[1,null,3],"st":{"x":"a","y":[1.5]},"m":[{"key":"k","value":1}]})"
+            "\n"
+            R"({"l":[],"st":{"x":null,"y":null},"m":[]})"
+            "\n"
+            R"({"l":null,"st":null,"m":null})"
+            "\n");
+
+  // Sliced nested arrays are formatted from their offset
+  ASSERT_OK_AND_ASSIGN(json, ToJSON(*batch->Slice(1, 1)));
+  ASSERT_EQ(json, "{\"l\":[],\"st\":{\"x\":null,\"y\":null},\"m\":[]}\n");
+}
+
+TEST(WriteJSON, Dictionary) {
+  auto type = dictionary(int8(), utf8());
+  auto dict = ArrayFromJSON(utf8(), R"(["a", "b"])");
+  auto indices = ArrayFromJSON(int8(), "[1, null, 0, 1]");
+  ASSERT_OK_AND_ASSIGN(auto array, DictionaryArray::FromArrays(type, indices, dict));
+  auto batch = RecordBatch::Make(schema({field("d", type)}), 4, {array});
+  ASSERT_OK_AND_ASSIGN(auto json, ToJSON(*batch));
+  ASSERT_EQ(json, "{\"d\":\"b\"}\n{\"d\":null}\n{\"d\":\"a\"}\n{\"d\":\"b\"}\n");
+}
+
+TEST(WriteJSON, UnsupportedType) {
+  auto batch = RecordBatchFromJSON(
+      schema({field("u", sparse_union({field("a", int8())}))}), "[[[0, 1]]]");
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented, ::testing::HasSubstr("sparse_union"),
+                                  ToJSON(*batch));
+}
+
+TEST(WriteJSON, InvalidOptions) {
+  auto options = WriteOptions::Defaults();
+  options.batch_size = 0;
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  ASSERT_RAISES(Invalid, MakeJSONWriter(out, schema({field("i", int32())}), options));
+}
+
+class TestJSONWriterRoundTrip : public ::testing::TestWithParam<bool> {};
+
+TEST_P(TestJSONWriterRoundTrip, RecordBatches) {
+  auto schema = ::arrow::schema(
+      {field("i", int64()), field("f", float64()), field("b", boolean()),
+       field("s", utf8()), field("l", list(int64())),
+       field("st", struct_({field("x", int32()), field("y", utf8())}))});
+  auto expected =
+      random::GenerateBatch(schema->fields(), /*size=*/5000, /*seed=*/42)->Slice(7);
+
+  auto options = WriteOptions::Defaults();
+  options.use_threads = GetParam();
+  options.batch_size = 100;
+  ASSERT_OK_AND_ASSIGN(auto out, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeJSONWriter(out, schema, options));
+  ASSERT_OK(writer->WriteRecordBatch(*expected->Slice(0, 1000)));
+  ASSERT_OK(writer->WriteRecordBatch(*expected->Slice(1000)));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, out->Finish());
+
+  auto parse_options = ParseOptions::Defaults();
+  parse_options.explicit_schema = schema;
+  ASSERT_OK_AND_ASSIGN(
+      auto reader, TableReader::Make(default_memory_pool(),
+                                     std::make_shared<io::BufferReader>(buffer),
+                                     ReadOptions::Defaults(), parse_options));
+  ASSERT_OK_AND_ASSIGN(auto actual, reader->Read());
+  ASSERT_OK_AND_ASSIGN(auto expected_table, Table::FromRecordBatches({expected}));
+  AssertTablesEqual(*expected_table, *actual, /*same_chunk_layout=*/false);
+}
+
+INSTANTIATE_TEST_SUITE_P(Threading, TestJSONWriterRoundTrip, ::testing::Bool());
+
+}  // namespace json
+}  // namespace arrow
@@ -26,6 +26,18 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 #if defined(sun) || defined(__sun)
 #include <stdlib.h>
@@ -823,6 +835,656 @@ int64_t ProxyMemoryPool::num_allocations() const { return impl_->num_allocations
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  RecyclingMemoryPoolImpl(MemoryPool* parent, int64_t min_size, int64_t max_cached_bytes)
+      : parent_(parent),
+        min_size_(std::max<int64_t>(min_size, kMinSizeClassBytes)),
+        max_cached_bytes_(max_cached_bytes) {}
+
+  ~RecyclingMemoryPoolImpl() { ReleaseCached(); }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    RETURN_NOT_OK(AllocateUntracked(size, alignment, out));
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    const bool old_recycled = IsRecycled(old_size, alignment);
+    const bool new_recycled = IsRecycled(new_size, alignment);
+    if (!old_recycled && !new_recycled) {
+      RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, alignment, ptr));
+    } else if (!old_recycled || !new_recycled ||
+               SizeClass(old_size) != SizeClass(new_size)) {
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateUntracked(new_size, alignment, &out));
+      memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      FreeUntracked(*ptr, old_size, alignment);
+      *ptr = out;
+    }
+    // else the buffer already has room for new_size bytes
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    FreeUntracked(buffer, size, alignment);
+    stats_.DidFreeBytes(size);
+  }
+
+  void ReleaseUnused() {
+    ReleaseCached();
+    parent_->ReleaseUnused();
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const { return stats_.total_bytes_allocated(); }
+
+  int64_t num_allocations() const { return stats_.num_allocations(); }
+
+  std::string backend_name() const { return parent_->backend_name(); }
+
+  int64_t cached_bytes() const { return cached_bytes_.load(std::memory_order_acquire); }
+
+ private:
+  // Sizes in (2^k, 2^(k+1)] are rounded up to a multiple of 2^(k-2), so that at most
+  // a fifth of each buffer is wasted
+  static constexpr int kSubClassBits = 2;
+  static constexpr int64_t kMinSizeClassBytes = 1 << 12;
+  static constexpr int kNumSizeClasses = 64 << kSubClassBits;
+  static constexpr int kNumShards = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    std::vector<uint8_t*> free_lists[kNumSizeClasses];
+  };
+
+  bool IsRecycled(int64_t size, int64_t alignment) const {
+    return size >= min_size_ && alignment == kDefaultBufferAlignment;
+  }
+
+  static int SizeClass(int64_t size) {
+    const int k = 63 - bit_util::CountLeadingZeros(static_cast<uint64_t>(size - 1));
+    const int64_t steps = (size - 1) >> (k - kSubClassBits);
+    return (k << kSubClassBits) + static_cast<int>(steps - (1 << kSubClassBits));
+  }
+
+  static int64_t SizeClassBytes(int size_class) {
+    const int k = size_class >> kSubClassBits;
+    const int64_t steps = (size_class & ((1 << kSubClassBits) - 1)) + 1;
+    return (int64_t(1) << k) + (steps << (k - kSubClassBits));
+  }
+
+  static int ShardHint() {
+    static thread_local const int hint = static_cast<int>(
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) % kNumShards);
+    return hint;
+  }
+
+  Status AllocateUntracked(int64_t size, int64_t alignment, uint8_t** out) {
+    if (!IsRecycled(size, alignment)) {
+      return parent_->Allocate(size, alignment, out);
+    }
+    const int size_class = SizeClass(size);
+    const int64_t class_bytes = SizeClassBytes(size_class);
+    if (cached_bytes_.load(std::memory_order_acquire) >= class_bytes) {
+      // Look in this thread's shard first, then in the others without waiting
+      const int hint = ShardHint();
+      for (int i = 0; i < kNumShards; ++i) {
+        Shard& shard = shards_[(hint + i) % kNumShards];
+        std::unique_lock<std::mutex> lock(shard.mutex, std::defer_lock);
+        if (i == 0) {
+          lock.lock();
+        } else if (!lock.try_lock()) {
+          continue;
+        }
+        auto& free_list = shard.free_lists[size_class];
+        if (!free_list.empty()) {
+          *out = free_list.back();
+          free_list.pop_back();
+          cached_bytes_.fetch_sub(class_bytes, std::memory_order_acq_rel);
+          return Status::OK();
+        }
+      }
+    }
+    return parent_->Allocate(class_bytes, alignment, out);
+  }
+
+  void FreeUntracked(uint8_t* buffer, int64_t size, int64_t alignment) {
+    if (!IsRecycled(size, alignment)) {
+      return parent_->Free(buffer, size, alignment);
+    }
+    const int size_class = SizeClass(size);
+    const int64_t class_bytes = SizeClassBytes(size_class);
+    if (cached_bytes_.fetch_add(class_bytes, std::memory_order_acq_rel) + class_bytes >
+        max_cached_bytes_) {
+      cached_bytes_.fetch_sub(class_bytes, std::memory_order_acq_rel);
+      return parent_->Free(buffer, class_bytes, alignment);
+    }
+    Shard& shard = shards_[ShardHint()];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.free_lists[size_class].push_back(buffer);
+  }
+
+  void ReleaseCached() {
+    for (Shard& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      for (int size_class = 0; size_class < kNumSizeClasses; ++size_class) {
+        auto& free_list = shard.free_lists[size_class];
+        const int64_t class_bytes = SizeClassBytes(size_class);
+        for (uint8_t* buffer : free_list) {
+          parent_->Free(buffer, class_bytes, kDefaultBufferAlignment);
+        }
+        cached_bytes_.fetch_sub(class_bytes * static_cast<int64_t>(free_list.size()),
+                                std::memory_order_acq_rel);
+        free_list.clear();
+      }
+    }
+  }
+
+  MemoryPool* parent_;
+  const int64_t min_size_;
+  const int64_t max_cached_bytes_;
+  std::atomic<int64_t> cached_bytes_{0};
+  Shard shards_[kNumShards];
+  internal::MemoryPoolStats stats_;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* parent, int64_t min_size,
+                                         int64_t max_cached_bytes)
+    : impl_(new RecyclingMemoryPoolImpl(parent, min_size, max_cached_bytes)) {}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() {}
+
+Status RecyclingMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  return impl_->Free(buffer, size, alignment);
+}
+
+void RecyclingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t RecyclingMemoryPool::total_bytes_allocated() const {
+  return impl_->total_bytes_allocated();
+}
+
+int64_t RecyclingMemoryPool::num_allocations() const {
+  return impl_->num_allocations();
+}
+
+std::string RecyclingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t RecyclingMemoryPool::cached_bytes() const { return impl_->cached_bytes(); }
+
+///////////////////////////////////////////////////////////////////////
+// MappedMemoryPool implementation
+
+namespace {
+
+#ifndef _WIN32
+
+int64_t PageSize() {
+  static const int64_t page_size = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+  return page_size;
+}
+
+int64_t MappingSize(int64_t size) {
+  return bit_util::RoundUp(size, PageSize());
+}
+
+#ifdef __linux__
+// From <linux/mempolicy.h>, which is not available with all libcs
+constexpr int kMpolLocal = 4;
+
+// Bind the pages of a mapping to the NUMA node of the calling thread, best effort
+void BindToLocalNode(void* addr, int64_t size) {
+  ARROW_UNUSED(syscall(SYS_mbind, addr, static_cast<unsigned long>(size),  // NOLINT
+                       kMpolLocal, nullptr, 0UL, 0U));
+}
+#endif
+
+#endif  // !defined(_WIN32)
+
+}  // namespace
+
+class MappedMemoryPool::MappedMemoryPoolImpl {
+ public:
+  MappedMemoryPoolImpl(MemoryPool* parent, MappedMemoryPoolOptions options)
+      : parent_(parent), options_(options) {}
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    RETURN_NOT_OK(AllocateUntracked(size, alignment, out));
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    const bool old_mapped = IsMapped(old_size, alignment);
+    const bool new_mapped = IsMapped(new_size, alignment);
+    if (!old_mapped && !new_mapped) {
+      RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, alignment, ptr));
+    } else if (old_mapped && new_mapped) {
+      RETURN_NOT_OK(Remap(old_size, new_size, ptr));
+    } else {
+      uint8_t* out;
+      RETURN_NOT_OK(AllocateUntracked(new_size, alignment, &out));
+      memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      FreeUntracked(*ptr, old_size, alignment);
+      *ptr = out;
+    }
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    FreeUntracked(buffer, size, alignment);
+    stats_.DidFreeBytes(size);
+  }
+
+  void ReleaseUnused() { parent_->ReleaseUnused(); }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const { return stats_.total_bytes_allocated(); }
+
+  int64_t num_allocations() const { return stats_.num_allocations(); }
+
+  std::string backend_name() const { return parent_->backend_name(); }
+
+ private:
+  bool IsMapped(int64_t size, int64_t alignment) const {
+#ifdef _WIN32
+    return false;
+#else
+    return size >= options_.min_size && size > 0 && alignment <= PageSize();
+#endif
+  }
+
+  Status AllocateUntracked(int64_t size, int64_t alignment, uint8_t** out) {
+    if (!IsMapped(size, alignment)) {
+      return parent_->Allocate(size, alignment, out);
+    }
+#ifndef _WIN32
+    void* addr = mmap(nullptr, static_cast<size_t>(MappingSize(size)),
+                      PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (addr == MAP_FAILED) {
+      return Status::OutOfMemory("mmap of size ", size, " failed");
+    }
+    Advise(addr, size);
+    *out = reinterpret_cast<uint8_t*>(addr);
+#endif
+    return Status::OK();
+  }
+
+  Status Remap(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+#ifdef __linux__
+    void* addr = mremap(*ptr, static_cast<size_t>(MappingSize(old_size)),
+                        static_cast<size_t>(MappingSize(new_size)), MREMAP_MAYMOVE);
+    if (addr == MAP_FAILED) {
+      return Status::OutOfMemory("mremap of size ", new_size, " failed");
+    }
+    if (new_size > old_size) {
+      Advise(addr, new_size);
+    }
+    *ptr = reinterpret_cast<uint8_t*>(addr);
+    return Status::OK();
+#else
+    uint8_t* out;
+    RETURN_NOT_OK(AllocateUntracked(new_size, kDefaultBufferAlignment, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    FreeUntracked(*ptr, old_size, kDefaultBufferAlignment);
+    *ptr = out;
+    return Status::OK();
+#endif
+  }
+
+  void FreeUntracked(uint8_t* buffer, int64_t size, int64_t alignment) {
+    if (!IsMapped(size, alignment)) {
+      return parent_->Free(buffer, size, alignment);
+    }
+#ifndef _WIN32
+    ARROW_UNUSED(munmap(buffer, static_cast<size_t>(MappingSize(size))));
+#endif
+  }
+
+  void Advise(void* addr, int64_t size) {
+#ifdef __linux__
+    if (options_.transparent_huge_pages) {
+      ARROW_UNUSED(madvise(addr, static_cast<size_t>(MappingSize(size)), MADV_HUGEPAGE));
+    }
+    if (options_.numa_local) {
+      BindToLocalNode(addr, MappingSize(size));
+    }
+#else
+    ARROW_UNUSED(addr);
+    ARROW_UNUSED(size);
+#endif
+  }
+
+  MemoryPool* parent_;
+  const MappedMemoryPoolOptions options_;
+  internal::MemoryPoolStats stats_;
+};
+
+MappedMemoryPool::MappedMemoryPool(MemoryPool* parent, MappedMemoryPoolOptions options)
+    : impl_(new MappedMemoryPoolImpl(parent, options)) {}
+
+MappedMemoryPool::~MappedMemoryPool() {}
+
+Status MappedMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status MappedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                    int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void MappedMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  return impl_->Free(buffer, size, alignment);
+}
+
+void MappedMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t MappedMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t MappedMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t MappedMemoryPool::total_bytes_allocated() const {
+  return impl_->total_bytes_allocated();
+}
+
+int64_t MappedMemoryPool::num_allocations() const { return impl_->num_allocations(); }
+
+std::string MappedMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// FileBackedMemoryPool implementation
+
+class FileBackedMemoryPool::FileBackedMemoryPoolImpl {
+ public:
+  FileBackedMemoryPoolImpl(MemoryPool* parent, FileBackedMemoryPoolOptions options)
+      : parent_(parent), options_(std::move(options)) {}
+
+  ~FileBackedMemoryPoolImpl() { DCHECK(mappings_.empty()); }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    RETURN_NOT_OK(AllocateUntracked(size, alignment, /*try_parent=*/true, out));
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    bool try_parent = true;
+    if (!IsFileBacked(*ptr, old_size) &&
+        (!MayBeFileBacked(new_size, alignment) || options_.fallback_only)) {
+      Status st = parent_->Reallocate(old_size, new_size, alignment, ptr);
+      if (st.ok()) {
+        stats_.DidReallocateBytes(old_size, new_size);
+        return st;
+      }
+      if (!st.IsOutOfMemory() || !MayBeFileBacked(new_size, alignment)) {
+        return st;
+      }
+      try_parent = false;
+    }
+    uint8_t* out;
+    RETURN_NOT_OK(AllocateUntracked(new_size, alignment, try_parent, &out));
+    memcpy(out, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+    FreeUntracked(*ptr, old_size, alignment);
+    *ptr = out;
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    FreeUntracked(buffer, size, alignment);
+    stats_.DidFreeBytes(size);
+  }
+
+  void ReleaseUnused() { parent_->ReleaseUnused(); }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const { return stats_.total_bytes_allocated(); }
+
+  int64_t num_allocations() const { return stats_.num_allocations(); }
+
+  std::string backend_name() const { return parent_->backend_name(); }
+
+  int64_t file_backed_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return file_backed_bytes_;
+  }
+
+ private:
+  bool MayBeFileBacked(int64_t size, int64_t alignment) const {
+#ifdef _WIN32
+    return false;
+#else
+    return size >= options_.min_size && size > 0 && alignment <= PageSize();
+#endif
+  }
+
+  bool IsFileBacked(uint8_t* buffer, int64_t size) const {
+    // Only large allocations may be, which saves locking for the others
+    if (size < options_.min_size) return false;
+    std::lock_guard<std::mutex> lock(mutex_);
+    return mappings_.count(buffer) > 0;
+  }
+
+  Status AllocateUntracked(int64_t size, int64_t alignment, bool try_parent,
+                           uint8_t** out) {
+    if (!MayBeFileBacked(size, alignment)) {
+      return parent_->Allocate(size, alignment, out);
+    }
+    if (try_parent && options_.fallback_only) {
+      Status st = parent_->Allocate(size, alignment, out);
+      if (!st.IsOutOfMemory()) return st;
+    }
+    return MapFile(size, out);
+  }
+
+  Status MapFile(int64_t size, uint8_t** out) {
+#ifdef _WIN32
+    return Status::NotImplemented("File-backed allocations on Windows");
+#else
+    std::string path = options_.directory;
+    if (path.empty() || path.back() != '/') path += '/';
+    path += "arrow-memory-XXXXXX";
+    int fd = mkstemp(path.data());
+    if (fd < 0) {
+      return ::arrow::internal::StatusFromErrno(
+          errno, StatusCode::OutOfMemory, "Failed to create a file in '",
+          options_.directory, "' to back an allocation of size ", size);
+    }
+    // Only the mapping refers to the file from now on, its space being reclaimed
+    // once unmapped
+    ARROW_UNUSED(unlink(path.c_str()));
+    const int64_t mapping_size = MappingSize(size);
+#ifdef __linux__
+    int err = posix_fallocate(fd, 0, static_cast<off_t>(mapping_size));
+#else
+    int err = ftruncate(fd, static_cast<off_t>(mapping_size)) == 0 ? 0 : errno;
+#endif
+    if (err != 0) {
+      ARROW_UNUSED(close(fd));
+      return ::arrow::internal::StatusFromErrno(err, StatusCode::OutOfMemory,
+                                                "Failed to reserve ", mapping_size,
+                                                " bytes in '", options_.directory, "'");
+    }
+    void* addr = mmap(nullptr, static_cast<size_t>(mapping_size), PROT_READ | PROT_WRITE,
+                      MAP_SHARED, fd, 0);
+    err = errno;
+    ARROW_UNUSED(close(fd));
+    if (addr == MAP_FAILED) {
+      return ::arrow::internal::StatusFromErrno(err, StatusCode::OutOfMemory,
+                                                "mmap of size ", size, " failed");
+    }
+    *out = reinterpret_cast<uint8_t*>(addr);
+    std::lock_guard<std::mutex> lock(mutex_);
+    mappings_.insert(*out);
+    file_backed_bytes_ += size;
+    return Status::OK();
+#endif
+  }
+
+  void FreeUntracked(uint8_t* buffer, int64_t size, int64_t alignment) {
+    if (!IsFileBacked(buffer, size)) {
+      return parent_->Free(buffer, size, alignment);
+    }
+#ifndef _WIN32
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      mappings_.erase(buffer);
+      file_backed_bytes_ -= size;
+    }
+    ARROW_UNUSED(munmap(buffer, static_cast<size_t>(MappingSize(size))));
+#endif
+  }
+
+  MemoryPool* parent_;
+  const FileBackedMemoryPoolOptions options_;
+  internal::MemoryPoolStats stats_;
+
+  mutable std::mutex mutex_;
+  std::unordered_set<uint8_t*> mappings_;
+  int64_t file_backed_bytes_ = 0;
+};
+
+FileBackedMemoryPool::FileBackedMemoryPool(MemoryPool* parent,
+                                           FileBackedMemoryPoolOptions options)
+    : impl_(new FileBackedMemoryPoolImpl(parent, std::move(options))) {}
+
+FileBackedMemoryPool::~FileBackedMemoryPool() {}
+
+Status FileBackedMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status FileBackedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                        int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void FileBackedMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  return impl_->Free(buffer, size, alignment);
+}
+
+void FileBackedMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t FileBackedMemoryPool::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t FileBackedMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t FileBackedMemoryPool::total_bytes_allocated() const {
+  return impl_->total_bytes_allocated();
+}
+
+int64_t FileBackedMemoryPool::num_allocations() const {
+  return impl_->num_allocations();
+}
+
+std::string FileBackedMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+int64_t FileBackedMemoryPool::file_backed_bytes() const {
+  return impl_->file_backed_bytes();
+}
+
+///////////////////////////////////////////////////////////////////////
+// LimitedMemoryPool implementation
+
+LimitedMemoryPool::LimitedMemoryPool(MemoryPool* parent, int64_t limit,
+                                     SpillCallback spill_callback)
+    : parent_(parent), limit_(limit), spill_callback_(std::move(spill_callback)) {}
+
+LimitedMemoryPool::~LimitedMemoryPool() {}
+
+Status LimitedMemoryPool::Reserve(int64_t size) {
+  if (ARROW_PREDICT_TRUE(stats_.TryAllocateBytes(size, limit_))) {
+    return Status::OK();
+  }
+  if (spill_callback_) {
+    RETURN_NOT_OK(spill_callback_(size));
+    if (stats_.TryAllocateBytes(size, limit_)) {
+      return Status::OK();
+    }
+  }
+  return Status::OutOfMemory("allocation of size ", size, " exceeds memory limit (",
+                             stats_.bytes_allocated(), " of ", limit_,
+                             " bytes allocated)");
+}
+
+Status LimitedMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  RETURN_NOT_OK(Reserve(size));
+  Status st = parent_->Allocate(size, alignment, out);
+  if (ARROW_PREDICT_FALSE(!st.ok())) {
+    stats_.DidFreeBytes(size);
+  }
+  return st;
+}
+
+Status LimitedMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                     int64_t alignment, uint8_t** ptr) {
+  if (new_size <= old_size) {
+    RETURN_NOT_OK(parent_->Reallocate(old_size, new_size, alignment, ptr));
+    stats_.DidFreeBytes(old_size - new_size);
+    return Status::OK();
+  }
+  RETURN_NOT_OK(Reserve(new_size - old_size));
+  Status st = parent_->Reallocate(old_size, new_size, alignment, ptr);
+  if (ARROW_PREDICT_FALSE(!st.ok())) {
+    stats_.DidFreeBytes(new_size - old_size);
+  }
+  return st;
+}
+
+void LimitedMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  parent_->Free(buffer, size, alignment);
+  stats_.DidFreeBytes(size);
+}
+
+void LimitedMemoryPool::ReleaseUnused() { parent_->ReleaseUnused(); }
+
+int64_t LimitedMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t LimitedMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+int64_t LimitedMemoryPool::total_bytes_allocated() const {
+  return stats_.total_bytes_allocated();
+}
+
+int64_t LimitedMemoryPool::num_allocations() const { return stats_.num_allocations(); }
+
+std::string LimitedMemoryPool::backend_name() const { return parent_->backend_name(); }
+
 std::vector<std::string> SupportedMemoryBackendNames() {
   std::vector<std::string> supported;
   for (const auto backend : SupportedBackends()) {
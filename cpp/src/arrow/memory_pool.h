@@ -86,6 +86,30 @@ class alignas(64) MemoryPoolStats {
     }
   }
 
+  /// \brief Account for an allocation unless it would exceed `limit` bytes allocated
+  ///
+  /// \return false, without updating any statistic, if the limit would be exceeded
+  inline bool TryAllocateBytes(int64_t size, int64_t limit) {
+    auto old_bytes_allocated = bytes_allocated_.load(std::memory_order_acquire);
+    do {
+      if (old_bytes_allocated > limit - size) {
+        return false;
+      }
+    } while (!bytes_allocated_.compare_exchange_weak(
+        /*expected=*/old_bytes_allocated, /*desired=*/old_bytes_allocated + size,
+        std::memory_order_acq_rel));
+    total_allocated_bytes_.fetch_add(size, std::memory_order_acq_rel);
+    num_allocs_.fetch_add(1, std::memory_order_acq_rel);
+
+    const auto allocated = old_bytes_allocated + size;
+    auto max_memory = max_memory_.load(std::memory_order_relaxed);
+    while (max_memory < allocated && !max_memory_.compare_exchange_weak(
+                                         /*expected=*/max_memory, /*desired=*/allocated,
+                                         std::memory_order_acq_rel)) {
+    }
+    return true;
+  }
+
   inline void DidReallocateBytes(int64_t old_size, int64_t new_size) {
     if (new_size > old_size) {
       DidAllocateBytes(new_size - old_size);
@@ -235,6 +259,232 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A MemoryPool enforcing a limit on the bytes allocated through it
+///
+/// Actual allocation is delegated to a parent MemoryPool. Since a LimitedMemoryPool
+/// may itself be the parent of other LimitedMemoryPools, they can be composed into a
+/// tree of budgets (for example process, then query, then operator): each allocation
+/// is accounted for in, and must fit within the limit of, every pool on the path to
+/// the root.
+///
+/// When an allocation would exceed the limit, the spill callback (if any) is invoked
+/// with the number of bytes requested. If it returns OK, presumably having released
+/// memory from this pool, the allocation is attempted again. Otherwise, or if the
+/// limit would still be exceeded, the allocation fails with OutOfMemory.
+class ARROW_EXPORT LimitedMemoryPool : public MemoryPool {
+ public:
+  using SpillCallback = std::function<Status(int64_t bytes_requested)>;
+
+  LimitedMemoryPool(MemoryPool* parent, int64_t limit,
+                    SpillCallback spill_callback = NULLPTR);
+  ~LimitedMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+  /// The maximum number of bytes which may be allocated through this pool
+  int64_t limit() const { return limit_; }
+
+  /// The pool to which allocations are delegated
+  MemoryPool* parent() const { return parent_; }
+
+ private:
+  Status Reserve(int64_t size);
+
+  MemoryPool* parent_;
+  const int64_t limit_;
+  SpillCallback spill_callback_;
+  internal::MemoryPoolStats stats_;
+};
+
+/// \brief A MemoryPool recycling large buffers instead of returning them to its parent
+///
+/// Allocations of at least `min_size` bytes (with the default alignment) are rounded
+/// up to a size class; when freed, they are kept in free lists sharded by thread and
+/// reused by later allocations of the same size class. This avoids the allocator
+/// and page fault overhead of workloads which repeatedly allocate and free buffers
+/// of similar sizes, for example one per batch.
+///
+/// At most `max_cached_bytes` are kept in the free lists; ReleaseUnused() returns
+/// all of them to the parent pool. Statistics count the bytes requested by callers,
+/// not those cached.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  static constexpr int64_t kDefaultMinSize = 1 << 16;                  // 64 kB
+  static constexpr int64_t kDefaultMaxCachedBytes = int64_t(1) << 28;  // 256 MB
+
+  explicit RecyclingMemoryPool(MemoryPool* parent, int64_t min_size = kDefaultMinSize,
+                               int64_t max_cached_bytes = kDefaultMaxCachedBytes);
+  ~RecyclingMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  /// Return all cached buffers to the parent pool, then release its unused memory
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes currently kept for reuse
+  int64_t cached_bytes() const;
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// \brief Options for MappedMemoryPool
+struct ARROW_EXPORT MappedMemoryPoolOptions {
+  /// Allocations of at least this many bytes are mapped directly from the OS
+  int64_t min_size = int64_t(1) << 21;  // 2 MB
+
+  /// Whether to advise the OS to back mapped allocations with transparent huge pages
+  bool transparent_huge_pages = true;
+
+  /// Whether to bind mapped allocations to the NUMA node of the allocating thread
+  ///
+  /// Worker threads pinned to a socket then allocate from memory local to it,
+  /// even if the memory is first touched by another thread.
+  bool numa_local = false;
+
+  static MappedMemoryPoolOptions Defaults() { return MappedMemoryPoolOptions(); }
+};
+
+/// \brief A MemoryPool mapping large allocations directly from the OS
+///
+/// Allocations smaller than MappedMemoryPoolOptions::min_size (or requiring an
+/// alignment larger than a page) are delegated to a parent pool. Larger ones get
+/// fresh anonymous mappings, which can be backed by transparent huge pages and
+/// bound to the calling thread's NUMA node; both are best effort and are only
+/// supported on Linux. On platforms without mmap(), all allocations are delegated.
+class ARROW_EXPORT MappedMemoryPool : public MemoryPool {
+ public:
+  explicit MappedMemoryPool(
+      MemoryPool* parent,
+      MappedMemoryPoolOptions options = MappedMemoryPoolOptions::Defaults());
+  ~MappedMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  class MappedMemoryPoolImpl;
+  std::unique_ptr<MappedMemoryPoolImpl> impl_;
+};
+
+/// \brief Options for FileBackedMemoryPool
+struct ARROW_EXPORT FileBackedMemoryPoolOptions {
+  /// The directory in which backing files are created, preferably on fast local storage
+  std::string directory;
+
+  /// Allocations of at least this many bytes may be backed by files
+  int64_t min_size = int64_t(1) << 26;  // 64 MB
+
+  /// If true, large allocations are first attempted from the parent pool and are only
+  /// backed by a file if that fails with OutOfMemory. Otherwise, they are always
+  /// backed by files.
+  bool fallback_only = true;
+
+  static FileBackedMemoryPoolOptions Defaults() { return FileBackedMemoryPoolOptions(); }
+};
+
+/// \brief A MemoryPool backing large allocations by memory-mapped temporary files
+///
+/// Each large allocation maps its own file, created in
+/// FileBackedMemoryPoolOptions::directory and unlinked right away: the OS pages its
+/// contents to the file rather than requiring them to fit in RAM, and its disk space is
+/// reclaimed when the allocation is freed. Such allocations are slower, but let
+/// operations whose working set exceeds RAM complete instead of running out of memory.
+///
+/// Other allocations are delegated to a parent pool, such as a LimitedMemoryPool
+/// enforcing a budget: with FileBackedMemoryPoolOptions::fallback_only, large
+/// allocations only go to files once the budget is exhausted. Disk space is reserved
+/// up front on Linux, so that a full disk fails the allocation with OutOfMemory rather
+/// than a later write. On platforms without mmap(), all allocations are delegated.
+class ARROW_EXPORT FileBackedMemoryPool : public MemoryPool {
+ public:
+  FileBackedMemoryPool(MemoryPool* parent, FileBackedMemoryPoolOptions options);
+  ~FileBackedMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  void ReleaseUnused() override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+  /// The number of bytes currently allocated from files
+  int64_t file_backed_bytes() const;
+
+ private:
+  class FileBackedMemoryPoolImpl;
+  std::unique_ptr<FileBackedMemoryPoolImpl> impl_;
+};
+
 /// \brief Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -17,6 +17,9 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <thread>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -25,6 +28,7 @@
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/config.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -181,6 +185,281 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(RecyclingMemoryPool, Recycling) {
+  auto pool = MemoryPool::CreateDefault();
+
+  RecyclingMemoryPool rp(pool.get(), /*min_size=*/1 << 16);
+
+  uint8_t* small;
+  ASSERT_OK(rp.Allocate(100, &small));
+  uint8_t* data;
+  ASSERT_OK(rp.Allocate(100000, &data));
+  ASSERT_EQ(100100, rp.bytes_allocated());
+  ASSERT_GE(pool->bytes_allocated(), 100100);
+
+  rp.Free(small, 100);
+  rp.Free(data, 100000);
+  ASSERT_EQ(0, rp.bytes_allocated());
+  ASSERT_GE(rp.cached_bytes(), 100000);
+  ASSERT_EQ(rp.cached_bytes(), pool->bytes_allocated());
+
+  // A buffer of the same size class is reused
+  uint8_t* data2;
+  ASSERT_OK(rp.Allocate(99000, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(0, rp.cached_bytes());
+  // Growing within the size class doesn't move the buffer
+  ASSERT_OK(rp.Reallocate(99000, 100000, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_OK(rp.Reallocate(100000, 1000000, &data2));
+  ASSERT_EQ(1000000, rp.bytes_allocated());
+  ASSERT_EQ(1000000, rp.max_memory());
+  ASSERT_EQ(5, rp.num_allocations());
+
+  rp.Free(data2, 1000000);
+  ASSERT_GT(rp.cached_bytes(), 0);
+  rp.ReleaseUnused();
+  ASSERT_EQ(0, rp.cached_bytes());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, MaxCachedBytes) {
+  auto pool = MemoryPool::CreateDefault();
+
+  RecyclingMemoryPool rp(pool.get(), /*min_size=*/1 << 16,
+                         /*max_cached_bytes=*/1 << 20);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(rp.Allocate(1 << 19, &data1));
+  ASSERT_OK(rp.Allocate(1 << 20, &data2));
+  rp.Free(data1, 1 << 19);
+  rp.Free(data2, 1 << 20);
+  ASSERT_EQ(1 << 19, rp.cached_bytes());
+  ASSERT_EQ(1 << 19, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, Threaded) {
+  auto pool = MemoryPool::CreateDefault();
+  {
+    RecyclingMemoryPool rp(pool.get(), /*min_size=*/1 << 12);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+      threads.emplace_back([&rp, t] {
+        for (int i = 0; i < 1000; ++i) {
+          const int64_t size = (1 << 12) + ((i * 7919 + t) % 64) * 1024;
+          uint8_t* data;
+          ASSERT_OK(rp.Allocate(size, &data));
+          std::memset(data, t, static_cast<size_t>(size));
+          rp.Free(data, size);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    ASSERT_EQ(0, rp.bytes_allocated());
+    ASSERT_EQ(rp.cached_bytes(), pool->bytes_allocated());
+  }
+  // Cached buffers are released on destruction
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(MappedMemoryPool, Mapping) {
+  auto pool = MemoryPool::CreateDefault();
+
+  auto options = MappedMemoryPoolOptions::Defaults();
+  options.min_size = 1 << 20;
+  options.numa_local = true;
+  MappedMemoryPool mp(pool.get(), options);
+
+  uint8_t* small;
+  ASSERT_OK(mp.Allocate(1000, &small));
+  uint8_t* large;
+  ASSERT_OK(mp.Allocate(3 << 20, &large));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large) % kDefaultBufferAlignment);
+  std::memset(large, 1, 3 << 20);
+  ASSERT_EQ((3 << 20) + 1000, mp.bytes_allocated());
+  ASSERT_EQ(1000, pool->bytes_allocated());
+
+  // Growing, shrinking and moving across the threshold preserves contents
+  ASSERT_OK(mp.Reallocate(3 << 20, 5 << 20, &large));
+  ASSERT_EQ(1, large[(3 << 20) - 1]);
+  ASSERT_OK(mp.Reallocate(5 << 20, 2 << 20, &large));
+  ASSERT_EQ(1, large[(2 << 20) - 1]);
+  ASSERT_OK(mp.Reallocate(2 << 20, 100, &large));
+  ASSERT_EQ(1, large[99]);
+  ASSERT_EQ(1100, pool->bytes_allocated());
+  ASSERT_OK(mp.Reallocate(100, 2 << 20, &large));
+  ASSERT_EQ(1, large[99]);
+  ASSERT_EQ(1000, pool->bytes_allocated());
+  ASSERT_EQ((5 << 20) + 1000, mp.max_memory());
+
+  mp.Free(small, 1000);
+  mp.Free(large, 2 << 20);
+  ASSERT_EQ(0, mp.bytes_allocated());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+#ifndef _WIN32
+TEST(FileBackedMemoryPool, Fallback) {
+  auto pool = MemoryPool::CreateDefault();
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       ::arrow::internal::TemporaryDir::Make("file-backed-pool-"));
+
+  // Allocations exceeding the budget of the parent pool are backed by files
+  LimitedMemoryPool lp(pool.get(), 1 << 20);
+  auto options = FileBackedMemoryPoolOptions::Defaults();
+  options.directory = temp_dir->path().ToString();
+  options.min_size = 1 << 19;
+  FileBackedMemoryPool fp(&lp, options);
+
+  uint8_t* small;
+  ASSERT_OK(fp.Allocate(1000, &small));
+  uint8_t* medium;
+  ASSERT_OK(fp.Allocate(600 << 10, &medium));
+  ASSERT_EQ(0, fp.file_backed_bytes());
+  uint8_t* large;
+  ASSERT_OK(fp.Allocate(3 << 20, &large));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(large) % kDefaultBufferAlignment);
+  std::memset(large, 1, 3 << 20);
+  ASSERT_EQ(3 << 20, fp.file_backed_bytes());
+  ASSERT_EQ((3 << 20) + (600 << 10) + 1000, fp.bytes_allocated());
+  ASSERT_EQ((600 << 10) + 1000, lp.bytes_allocated());
+  // Small allocations are never backed by files
+  uint8_t* other;
+  ASSERT_RAISES(OutOfMemory, fp.Allocate(500 << 10, &other));
+
+  // Growing beyond the budget moves to a file, preserving contents
+  std::memset(medium, 2, 600 << 10);
+  ASSERT_OK(fp.Reallocate(600 << 10, 1100 << 10, &medium));
+  ASSERT_EQ(2, medium[(600 << 10) - 1]);
+  ASSERT_EQ((3 << 20) + (1100 << 10), fp.file_backed_bytes());
+  ASSERT_EQ(1000, lp.bytes_allocated());
+  ASSERT_OK(fp.Reallocate(3 << 20, 100, &large));
+  ASSERT_EQ(1, large[99]);
+  ASSERT_EQ(1100 << 10, fp.file_backed_bytes());
+  ASSERT_EQ(1100, lp.bytes_allocated());
+
+  fp.Free(small, 1000);
+  fp.Free(medium, 1100 << 10);
+  fp.Free(large, 100);
+  ASSERT_EQ(0, fp.bytes_allocated());
+  ASSERT_EQ(0, fp.file_backed_bytes());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(FileBackedMemoryPool, Always) {
+  auto pool = MemoryPool::CreateDefault();
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       ::arrow::internal::TemporaryDir::Make("file-backed-pool-"));
+
+  auto options = FileBackedMemoryPoolOptions::Defaults();
+  options.directory = temp_dir->path().ToString();
+  options.min_size = 1 << 20;
+  options.fallback_only = false;
+  FileBackedMemoryPool fp(pool.get(), options);
+
+  uint8_t* data;
+  ASSERT_OK(fp.Allocate(2 << 20, &data));
+  data[(2 << 20) - 1] = 3;
+  ASSERT_EQ(2 << 20, fp.file_backed_bytes());
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_OK(fp.Reallocate(2 << 20, 4 << 20, &data));
+  ASSERT_EQ(3, data[(2 << 20) - 1]);
+  ASSERT_EQ(4 << 20, fp.file_backed_bytes());
+  fp.Free(data, 4 << 20);
+  ASSERT_EQ(0, fp.file_backed_bytes());
+
+  // Failing to create files fails allocations
+  options.directory = temp_dir->path().ToString() + "missing";
+  FileBackedMemoryPool bad(pool.get(), options);
+  ASSERT_RAISES(OutOfMemory, bad.Allocate(2 << 20, &data));
+}
+#endif
+
+TEST(LimitedMemoryPool, Limit) {
+  auto pool = MemoryPool::CreateDefault();
+
+  LimitedMemoryPool lp(pool.get(), 1000);
+
+  uint8_t* data;
+  ASSERT_OK(lp.Allocate(600, &data));
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, lp.Allocate(600, &data2));
+  ASSERT_RAISES(OutOfMemory, lp.Reallocate(600, 1200, &data));
+  ASSERT_EQ(600, lp.bytes_allocated());
+  ASSERT_EQ(600, pool->bytes_allocated());
+
+  ASSERT_OK(lp.Reallocate(600, 300, &data));
+  ASSERT_OK(lp.Allocate(600, &data2));
+  ASSERT_EQ(900, lp.bytes_allocated());
+  ASSERT_EQ(900, lp.max_memory());
+  ASSERT_EQ(2, lp.num_allocations());
+
+  lp.Free(data, 300);
+  lp.Free(data2, 600);
+  ASSERT_EQ(0, lp.bytes_allocated());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, Hierarchy) {
+  auto pool = MemoryPool::CreateDefault();
+
+  LimitedMemoryPool query(pool.get(), 1000);
+  LimitedMemoryPool op1(&query, 800);
+  LimitedMemoryPool op2(&query, 800);
+
+  uint8_t* data1;
+  ASSERT_OK(op1.Allocate(600, &data1));
+  uint8_t* data2;
+  // Within op2's limit, but not within the query's
+  ASSERT_RAISES(OutOfMemory, op2.Allocate(600, &data2));
+  ASSERT_EQ(0, op2.bytes_allocated());
+  ASSERT_OK(op2.Allocate(400, &data2));
+
+  ASSERT_EQ(600, op1.bytes_allocated());
+  ASSERT_EQ(400, op2.bytes_allocated());
+  ASSERT_EQ(1000, query.bytes_allocated());
+  ASSERT_EQ(1000, pool->bytes_allocated());
+
+  op1.Free(data1, 600);
+  op2.Free(data2, 400);
+  ASSERT_EQ(0, query.bytes_allocated());
+}
+
+TEST(LimitedMemoryPool, SpillCallback) {
+  auto pool = MemoryPool::CreateDefault();
+
+  uint8_t* spillable = nullptr;
+  int64_t spill_requested = 0;
+  LimitedMemoryPool* lp_ptr;
+  LimitedMemoryPool lp(pool.get(), 1000, [&](int64_t bytes_requested) {
+    spill_requested = bytes_requested;
+    if (spillable == nullptr) {
+      return Status::OutOfMemory("nothing to spill");
+    }
+    lp_ptr->Free(spillable, 800);
+    spillable = nullptr;
+    return Status::OK();
+  });
+  lp_ptr = &lp;
+
+  ASSERT_OK(lp.Allocate(800, &spillable));
+  uint8_t* data;
+  ASSERT_OK(lp.Allocate(500, &data));
+  ASSERT_EQ(500, spill_requested);
+  ASSERT_EQ(nullptr, spillable);
+  ASSERT_EQ(500, lp.bytes_allocated());
+
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, lp.Allocate(600, &data2));
+  ASSERT_EQ(600, spill_requested);
+
+  lp.Free(data, 500);
+  ASSERT_EQ(0, lp.bytes_allocated());
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
@@ -614,4 +614,14 @@ using SparseCSCMatrix = SparseTensorImpl<SparseCSCIndex>;
 /// \brief EXPERIMENTAL: Type alias for CSF sparse matrix
 using SparseCSFTensor = SparseTensorImpl<SparseCSFIndex>;
 
+/// \brief EXPERIMENTAL: Create a CSR sparse matrix from the columns of a table
+///
+/// Element (i, j) of the matrix is row i of column j.  The columns must all have the
+/// same integer or floating-point type, their null and zero values being left out of
+/// the matrix.  Unlike converting a dense tensor, only the non-zero values are copied.
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSRMatrix>> MakeSparseCSRMatrixFromTable(
+    const Table& table, const std::shared_ptr<DataType>& index_value_type = int64(),
+    MemoryPool* pool = default_memory_pool());
+
 }  // namespace arrow
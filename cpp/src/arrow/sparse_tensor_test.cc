@@ -28,7 +28,10 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/array/builder_primitive.h"
+#include "arrow/chunked_array.h"
 #include "arrow/sparse_tensor.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
@@ -869,6 +872,87 @@ TEST_F(TestSparseCSRMatrix, TestToTensor) {
   ASSERT_TRUE(tensor.Equals(*dense_tensor));
 }
 
+TEST_F(TestSparseCSRMatrix, CreationFromLargeTensor) {
+  // Large enough to be converted in parallel
+  const std::vector<int64_t> shape = {1024, 3072};
+  std::vector<int32_t> values(shape[0] * shape[1], 0);
+  for (size_t i = 0; i < values.size(); i += 7) {
+    values[i] = static_cast<int32_t>(i % 1000) + 1;
+  }
+  Tensor tensor(int32(), Buffer::Wrap(values), shape);
+  ASSERT_OK_AND_ASSIGN(int64_t non_zero_length, tensor.CountNonZero());
+
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(tensor, int32()));
+  ASSERT_EQ(non_zero_length, csr->non_zero_length());
+  ASSERT_OK_AND_ASSIGN(auto dense, csr->ToTensor());
+  ASSERT_TRUE(tensor.Equals(*dense));
+
+  ASSERT_OK_AND_ASSIGN(auto csc, SparseCSCMatrix::Make(tensor, int32()));
+  ASSERT_EQ(non_zero_length, csc->non_zero_length());
+  ASSERT_OK_AND_ASSIGN(dense, csc->ToTensor());
+  ASSERT_TRUE(tensor.Equals(*dense));
+
+  ASSERT_OK_AND_ASSIGN(auto coo, SparseCOOTensor::Make(tensor, int32()));
+  ASSERT_EQ(non_zero_length, coo->non_zero_length());
+  ASSERT_OK_AND_ASSIGN(dense, coo->ToTensor());
+  ASSERT_TRUE(tensor.Equals(*dense));
+}
+
+TEST(TestSparseCSRMatrixFromTable, Make) {
+  auto table = TableFromJSON(
+      schema({field("a", float64()), field("b", float64()), field("c", float64())}),
+      {R"([[1, 0, 2], [0, null, 0]])", R"([[3, 4, null]])", R"([[0, 0, 5]])"});
+  ASSERT_OK_AND_ASSIGN(auto actual, MakeSparseCSRMatrixFromTable(*table, int32()));
+
+  std::vector<double> values = {1, 0, 2, 0, 0, 0, 3, 4, 0, 0, 0, 5};
+  Tensor tensor(float64(), Buffer::Wrap(values), {4, 3});
+  ASSERT_OK_AND_ASSIGN(auto expected, SparseCSRMatrix::Make(tensor, int32()));
+  ASSERT_TRUE(actual->Equals(*expected));
+}
+
+TEST(TestSparseCSRMatrixFromTable, MakeLarge) {
+  // Large enough to be converted in parallel
+  constexpr int kNumColumns = 4;
+  constexpr int64_t kNumRows = 1 << 20;
+  std::vector<int64_t> values(kNumRows * kNumColumns, 0);
+  ChunkedArrayVector columns;
+  for (int j = 0; j < kNumColumns; ++j) {
+    ArrayVector chunks;
+    Int64Builder builder;
+    for (int64_t i = 0; i < kNumRows; ++i) {
+      const int64_t value = (i + j) % 5 == 0 ? i : 0;
+      values[i * kNumColumns + j] = value;
+      ASSERT_OK(builder.Append(value));
+      if ((i + 1) % (100000 + j) == 0) {
+        ASSERT_OK_AND_ASSIGN(auto chunk, builder.Finish());
+        chunks.push_back(std::move(chunk));
+      }
+    }
+    ASSERT_OK_AND_ASSIGN(auto chunk, builder.Finish());
+    chunks.push_back(std::move(chunk));
+    columns.push_back(std::make_shared<ChunkedArray>(std::move(chunks)));
+  }
+  auto table = Table::Make(
+      schema({field("a", int64()), field("b", int64()), field("c", int64()),
+              field("d", int64())}),
+      std::move(columns));
+
+  ASSERT_OK_AND_ASSIGN(auto actual, MakeSparseCSRMatrixFromTable(*table));
+  Tensor tensor(int64(), Buffer::Wrap(values), {kNumRows, kNumColumns});
+  ASSERT_OK_AND_ASSIGN(auto expected, SparseCSRMatrix::Make(tensor));
+  ASSERT_TRUE(actual->Equals(*expected));
+}
+
+TEST(TestSparseCSRMatrixFromTable, Invalid) {
+  auto table = TableFromJSON(schema({field("a", int32()), field("b", int64())}),
+                             {R"([[1, 0]])"});
+  ASSERT_RAISES(TypeError, MakeSparseCSRMatrixFromTable(*table));
+  table = TableFromJSON(schema({field("a", utf8())}), {R"([["x"]])"});
+  ASSERT_RAISES(TypeError, MakeSparseCSRMatrixFromTable(*table));
+  ASSERT_OK_AND_ASSIGN(table, Table::MakeEmpty(schema({})));
+  ASSERT_RAISES(Invalid, MakeSparseCSRMatrixFromTable(*table));
+}
+
 template <typename ValueType>
 class TestSparseCSRMatrixEquality : public TestSparseTensorBase<ValueType> {
  public:
@@ -40,6 +40,8 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -555,11 +557,11 @@ bool Table::Equals(const Table& other, bool check_metadata) const {
 Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
   const int ncolumns = num_columns();
   std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
-  for (int i = 0; i < ncolumns; ++i) {
+  auto combine_column = [&](int i) -> Status {
     const auto& col = column(i);
     if (col->num_chunks() <= 1) {
       compacted_columns[i] = col;
-      continue;
+      return Status::OK();
     }
 
     if (is_binary_like(col->type()->id())) {
@@ -586,6 +588,20 @@ Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
       ARROW_ASSIGN_OR_RAISE(auto compacted, Concatenate(col->chunks(), pool));
       compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
     }
+    return Status::OK();
+  };
+
+  // Concatenate() splits large copies between threads unless it runs on the thread
+  // pool itself, so only combine the columns concurrently when there are enough of
+  // them to keep the pool busy.
+  auto* executor = internal::GetCpuThreadPool();
+  if (ncolumns > 1 && ncolumns >= executor->GetCapacity() &&
+      !executor->OwnsThisThread()) {
+    RETURN_NOT_OK(internal::ParallelFor(ncolumns, combine_column, executor));
+  } else {
+    for (int i = 0; i < ncolumns; ++i) {
+      RETURN_NOT_OK(combine_column(i));
+    }
   }
   return Table::Make(schema(), std::move(compacted_columns), num_rows_);
 }
@@ -605,6 +621,16 @@ Result<std::shared_ptr<RecordBatch>> Table::CombineChunksToBatch(MemoryPool* poo
   }
   return RecordBatch::Make(schema_, num_rows_, std::move(arrays));
 }
+
+Result<std::shared_ptr<Table>> Table::CoalesceChunks(int64_t target_length,
+                                                     MemoryPool* pool) const {
+  std::vector<std::shared_ptr<ChunkedArray>> columns(num_columns());
+  for (int i = 0; i < num_columns(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(columns[i], column(i)->CoalesceChunks(target_length, pool));
+  }
+  return Table::Make(schema_, std::move(columns), num_rows_);
+}
+
 // ----------------------------------------------------------------------
 // Convert a table to a sequence of record batches
 
@@ -212,7 +212,8 @@ class ARROW_EXPORT Table {
   /// \brief Make a new table by combining the chunks this table has.
   ///
   /// All the underlying chunks in the ChunkedArray of each column are
-  /// concatenated into zero or one chunk.
+  /// concatenated into zero or one chunk. Large tables are combined in
+  /// parallel on the CPU thread pool.
   ///
   /// \param[in] pool The pool for buffer allocations
   Result<std::shared_ptr<Table>> CombineChunks(
@@ -227,6 +228,16 @@ class ARROW_EXPORT Table {
   Result<std::shared_ptr<RecordBatch>> CombineChunksToBatch(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Make a new table by merging the small chunks this table has.
+  ///
+  /// ChunkedArray::CoalesceChunks is applied to each column.  Columns with the
+  /// same chunk layout still share it afterwards.
+  ///
+  /// \param[in] target_length The length of the merged chunks
+  /// \param[in] pool The pool for buffer allocations
+  Result<std::shared_ptr<Table>> CoalesceChunks(
+      int64_t target_length, MemoryPool* pool = default_memory_pool()) const;
+
  protected:
   Table();
 
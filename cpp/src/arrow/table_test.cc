@@ -292,6 +292,28 @@ TEST_F(TestTable, CombineChunks) {
   }
 }
 
+TEST_F(TestTable, CoalesceChunks) {
+  RecordBatchVector batches;
+  for (int length : {3, 4, 20, 2, 2}) {
+    MakeExample1(length);
+    batches.push_back(RecordBatch::Make(schema_, length, arrays_));
+  }
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches(batches));
+
+  ASSERT_OK_AND_ASSIGN(auto coalesced, table->CoalesceChunks(10));
+  ASSERT_OK(coalesced->ValidateFull());
+  EXPECT_TRUE(coalesced->Equals(*table));
+  for (int i = 0; i < coalesced->num_columns(); ++i) {
+    const auto& column = coalesced->column(i);
+    ASSERT_EQ(3, column->num_chunks());
+    EXPECT_EQ(7, column->chunk(0)->length());
+    EXPECT_EQ(20, column->chunk(1)->length());
+    EXPECT_EQ(4, column->chunk(2)->length());
+  }
+
+  ASSERT_RAISES(Invalid, table->CoalesceChunks(0));
+}
+
 TEST_F(TestTable, LARGE_MEMORY_TEST(CombineChunksStringColumn)) {
   schema_ = schema({field("str", utf8())});
   arrays_ = {nullptr};
@@ -19,6 +19,22 @@
 
 #include "arrow/tensor/converter.h"
 
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+// Dense data is converted in parallel on the CPU thread pool when it has at least two
+// tasks worth of elements
+constexpr int64_t kSparseConversionMinTaskSize = int64_t(1) << 20;
+
+// Returns the number of tasks to convert `size` dense elements with, 1 if the
+// conversion shouldn't be parallelized, e.g. when already running on the CPU thread pool
+int SparseConversionTaskCount(int64_t size);
+
+}  // namespace internal
+}  // namespace arrow
+
 #define DISPATCH(ACTION, index_elsize, value_elsize, ...) \
   switch (index_elsize) {                                 \
     case 1:                                               \
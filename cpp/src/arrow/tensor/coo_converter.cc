@@ -21,13 +21,18 @@
 #include <cstdint>
 #include <memory>
 #include <numeric>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -75,6 +80,77 @@ void ConvertRowMajorTensor(const Tensor& tensor, c_index_type* indices,
   }
 }
 
+// Converts a row-major tensor by splitting its data into ranges: each task counts the
+// non-zero elements of its range, then fills its part of the output, which starts after
+// the non-zero elements of the previous ranges.
+template <typename c_index_type, typename c_value_type>
+Status ConvertRowMajorTensorInParallel(const Tensor& tensor, MemoryPool* pool,
+                                       std::shared_ptr<Buffer>* out_indices,
+                                       std::shared_ptr<Buffer>* out_values,
+                                       int64_t* out_nonzero_count) {
+  const auto ndim = tensor.ndim();
+  const auto& shape = tensor.shape();
+  const int64_t size = tensor.size();
+  const c_value_type* tensor_data =
+      reinterpret_cast<const c_value_type*>(tensor.raw_data());
+
+  const int num_tasks = SparseConversionTaskCount(size);
+  const int64_t task_size = bit_util::CeilDiv(size, num_tasks);
+  auto task_range = [&](int task) {
+    const int64_t begin = std::min(size, task * task_size);
+    return std::make_pair(begin, std::min(size, begin + task_size));
+  };
+
+  constexpr c_value_type zero = 0;
+  std::vector<int64_t> offsets(num_tasks + 1, 0);
+  RETURN_NOT_OK(OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+    int64_t begin, end;
+    std::tie(begin, end) = task_range(task);
+    offsets[task + 1] = std::count_if(tensor_data + begin, tensor_data + end,
+                                      [](c_value_type x) { return x != zero; });
+    return Status::OK();
+  }));
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  const int64_t nonzero_count = offsets[num_tasks];
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto indices_buffer,
+      AllocateBuffer(sizeof(c_index_type) * ndim * nonzero_count, pool));
+  ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                        AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool));
+  auto* indices = reinterpret_cast<c_index_type*>(indices_buffer->mutable_data());
+  auto* values = reinterpret_cast<c_value_type*>(values_buffer->mutable_data());
+
+  RETURN_NOT_OK(OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+    int64_t begin, end;
+    std::tie(begin, end) = task_range(task);
+    if (begin == end) return Status::OK();
+    std::vector<c_index_type> coord(ndim);
+    int64_t remainder = begin;
+    for (int d = ndim - 1; d >= 0; --d) {
+      coord[d] = static_cast<c_index_type>(remainder % shape[d]);
+      remainder /= shape[d];
+    }
+    c_index_type* task_indices = indices + offsets[task] * ndim;
+    c_value_type* task_values = values + offsets[task];
+    for (int64_t n = begin; n < end; ++n) {
+      const c_value_type x = tensor_data[n];
+      if (ARROW_PREDICT_FALSE(x != zero)) {
+        std::copy(coord.begin(), coord.end(), task_indices);
+        *task_values++ = x;
+        task_indices += ndim;
+      }
+      IncrementRowMajorIndex(coord, shape);
+    }
+    return Status::OK();
+  }));
+
+  *out_indices = std::move(indices_buffer);
+  *out_values = std::move(values_buffer);
+  *out_nonzero_count = nonzero_count;
+  return Status::OK();
+}
+
 template <typename c_index_type, typename c_value_type>
 void ConvertColumnMajorTensor(const Tensor& tensor, c_index_type* out_indices,
                               c_value_type* out_values, const int64_t size) {
@@ -145,9 +221,6 @@ void ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
                                reinterpret_cast<value_type*>(values), size)
 
 // Using ARROW_EXPAND is necessary to expand __VA_ARGS__ correctly on VC++.
-#define CONVERT_ROW_MAJOR_TENSOR(index_type, value_type, ...) \
-  ARROW_EXPAND(CONVERT_TENSOR(ConvertRowMajorTensor, index_type, value_type, __VA_ARGS__))
-
 #define CONVERT_COLUMN_MAJOR_TENSOR(index_type, value_type, ...) \
   ARROW_EXPAND(                                                  \
       CONVERT_TENSOR(ConvertColumnMajorTensor, index_type, value_type, __VA_ARGS__))
@@ -155,6 +228,10 @@ void ConvertStridedTensor(const Tensor& tensor, c_index_type* indices,
 #define CONVERT_STRIDED_TENSOR(index_type, value_type, ...) \
   ARROW_EXPAND(CONVERT_TENSOR(ConvertStridedTensor, index_type, value_type, __VA_ARGS__))
 
+#define CONVERT_ROW_MAJOR_TENSOR_IN_PARALLEL(index_type, value_type, out_status, ...) \
+  *out_status = ConvertRowMajorTensorInParallel<index_type, value_type>(           \
+      tensor_, pool_, __VA_ARGS__)
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCOOIndex
 
@@ -176,38 +253,46 @@ class SparseCOOTensorConverter : private SparseTensorConverterMixin {
     const int value_elsize = tensor_.type()->byte_width();
 
     const int64_t ndim = tensor_.ndim();
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
-    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
-                          AllocateBuffer(index_elsize * ndim * nonzero_count, pool_));
-    uint8_t* indices = indices_buffer->mutable_data();
-
-    ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    uint8_t* values = values_buffer->mutable_data();
-
-    const uint8_t* tensor_data = tensor_.raw_data();
-    if (ndim <= 1) {
-      const int64_t count = ndim == 0 ? 1 : tensor_.shape()[0];
-      for (int64_t i = 0; i < count; ++i) {
-        if (std::any_of(tensor_data, tensor_data + value_elsize, IsNonZero)) {
-          AssignIndex(indices, i, index_elsize);
-          std::copy_n(tensor_data, value_elsize, values);
-
-          indices += index_elsize;
-          values += value_elsize;
+    std::shared_ptr<Buffer> indices_buffer;
+    std::shared_ptr<Buffer> values_buffer;
+    int64_t nonzero_count = 0;
+
+    if (ndim > 1 && tensor_.is_row_major()) {
+      // Counts the non-zero elements itself
+      Status status;
+      DISPATCH(CONVERT_ROW_MAJOR_TENSOR_IN_PARALLEL, index_elsize, value_elsize, &status,
+               &indices_buffer, &values_buffer, &nonzero_count);
+      RETURN_NOT_OK(status);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(nonzero_count, tensor_.CountNonZero());
+      ARROW_ASSIGN_OR_RAISE(indices_buffer,
+                            AllocateBuffer(index_elsize * ndim * nonzero_count, pool_));
+      uint8_t* indices = indices_buffer->mutable_data();
+
+      ARROW_ASSIGN_OR_RAISE(values_buffer,
+                            AllocateBuffer(value_elsize * nonzero_count, pool_));
+      uint8_t* values = values_buffer->mutable_data();
+
+      const uint8_t* tensor_data = tensor_.raw_data();
+      if (ndim <= 1) {
+        const int64_t count = ndim == 0 ? 1 : tensor_.shape()[0];
+        for (int64_t i = 0; i < count; ++i) {
+          if (std::any_of(tensor_data, tensor_data + value_elsize, IsNonZero)) {
+            AssignIndex(indices, i, index_elsize);
+            std::copy_n(tensor_data, value_elsize, values);
+
+            indices += index_elsize;
+            values += value_elsize;
+          }
+          tensor_data += value_elsize;
         }
-        tensor_data += value_elsize;
+      } else if (tensor_.is_column_major()) {
+        DISPATCH(CONVERT_COLUMN_MAJOR_TENSOR, index_elsize, value_elsize, indices, values,
+                 nonzero_count);
+      } else {
+        DISPATCH(CONVERT_STRIDED_TENSOR, index_elsize, value_elsize, indices, values,
+                 nonzero_count);
       }
-    } else if (tensor_.is_row_major()) {
-      DISPATCH(CONVERT_ROW_MAJOR_TENSOR, index_elsize, value_elsize, indices, values,
-               nonzero_count);
-    } else if (tensor_.is_column_major()) {
-      DISPATCH(CONVERT_COLUMN_MAJOR_TENSOR, index_elsize, value_elsize, indices, values,
-               nonzero_count);
-    } else {
-      DISPATCH(CONVERT_STRIDED_TENSOR, index_elsize, value_elsize, indices, values,
-               nonzero_count);
     }
 
     // make results
@@ -255,6 +340,15 @@ void SparseTensorConverterMixin::AssignIndex(uint8_t* indices, int64_t val,
   }
 }
 
+int SparseConversionTaskCount(int64_t size) {
+  auto* pool = GetCpuThreadPool();
+  if (size < 2 * kSparseConversionMinTaskSize || pool->OwnsThisThread()) {
+    return 1;
+  }
+  return static_cast<int>(
+      std::min<int64_t>(pool->GetCapacity(), size / kSparseConversionMinTaskSize));
+}
+
 int64_t SparseTensorConverterMixin::GetIndexValue(const uint8_t* value_ptr,
                                                   const int elsize) {
   switch (elsize) {
@@ -15,17 +15,28 @@
 // specific language governing permissions and limitations
 // under the License.
 
-#include "arrow/tensor/converter.h"
+#include "arrow/tensor/converter_internal.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <numeric>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "arrow/buffer.h"
+#include "arrow/chunked_array.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/visit_type_inline.h"
 
 namespace arrow {
@@ -35,13 +46,35 @@ class MemoryPool;
 namespace internal {
 namespace {
 
+// Calls visit(i, j, x) on each non-zero element x in the major slices [begin, end) of a
+// 2-D tensor, with j its index in the slice
+template <typename c_value_type, typename Visit>
+void VisitNonZeros(const Tensor& tensor, int major_axis, int64_t begin, int64_t end,
+                   Visit&& visit) {
+  const int64_t n_minor = tensor.shape()[1 - major_axis];
+  const int64_t major_stride = tensor.strides()[major_axis];
+  const int64_t minor_stride = tensor.strides()[1 - major_axis];
+  const uint8_t* tensor_data = tensor.raw_data();
+
+  constexpr c_value_type zero = 0;
+  for (int64_t i = begin; i < end; ++i) {
+    const uint8_t* slice = tensor_data + i * major_stride;
+    for (int64_t j = 0; j < n_minor; ++j) {
+      const auto x = util::SafeLoadAs<c_value_type>(slice + j * minor_stride);
+      if (ARROW_PREDICT_FALSE(x != zero)) {
+        visit(i, j, x);
+      }
+    }
+  }
+}
+
 // ----------------------------------------------------------------------
 // SparseTensorConverter for SparseCSRIndex
 
-class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
-  using SparseTensorConverterMixin::AssignIndex;
-  using SparseTensorConverterMixin::IsNonZero;
+#define CONVERT_TENSOR(index_type, value_type, out_status) \
+  *out_status = ConvertImpl<index_type, value_type>()
 
+class SparseCSXMatrixConverter {
  public:
   SparseCSXMatrixConverter(SparseMatrixCompressedAxis axis, const Tensor& tensor,
                            const std::shared_ptr<DataType>& index_value_type,
@@ -59,88 +92,203 @@ class SparseCSXMatrixConverter : private SparseTensorConverterMixin {
     if (ndim > 2) {
       return Status::Invalid("Invalid tensor dimension");
     }
+    if (ndim <= 1) {
+      return Status::NotImplemented("TODO for ndim <= 1");
+    }
 
+    Status status;
+    DISPATCH(CONVERT_TENSOR, index_elsize, value_elsize, &status);
+    return status;
+  }
+
+  std::shared_ptr<SparseIndex> sparse_index;
+  std::shared_ptr<Buffer> data;
+
+ private:
+  // The major slices are split into ranges converted in parallel: each task counts the
+  // non-zero elements of its slices, and once indptr is computed from the counts, fills
+  // their indices and values.
+  template <typename c_index_type, typename c_value_type>
+  Status ConvertImpl() {
     const int major_axis = static_cast<int>(axis_);
     const int64_t n_major = tensor_.shape()[major_axis];
-    const int64_t n_minor = tensor_.shape()[1 - major_axis];
-    ARROW_ASSIGN_OR_RAISE(int64_t nonzero_count, tensor_.CountNonZero());
-
-    std::shared_ptr<Buffer> indptr_buffer;
-    std::shared_ptr<Buffer> indices_buffer;
 
+    const int num_tasks = static_cast<int>(std::max<int64_t>(
+        1, std::min<int64_t>(SparseConversionTaskCount(tensor_.size()), n_major)));
+    const int64_t task_size = bit_util::CeilDiv(n_major, num_tasks);
+    auto task_range = [&](int task) {
+      const int64_t begin = std::min(n_major, task * task_size);
+      return std::make_pair(begin, std::min(n_major, begin + task_size));
+    };
+
+    std::vector<int64_t> offsets(n_major + 1, 0);
+    RETURN_NOT_OK(OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+      int64_t begin, end;
+    std::tie(begin, end) = task_range(task);
+      VisitNonZeros<c_value_type>(tensor_, major_axis, begin, end,
+                                  [&](int64_t i, int64_t, c_value_type) {
+                                    ++offsets[i + 1];
+                                  });
+      return Status::OK();
+    }));
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    const int64_t nonzero_count = offsets[n_major];
+
+    ARROW_ASSIGN_OR_RAISE(auto indptr_buffer,
+                          AllocateBuffer(sizeof(c_index_type) * (n_major + 1), pool_));
+    ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                          AllocateBuffer(sizeof(c_index_type) * nonzero_count, pool_));
     ARROW_ASSIGN_OR_RAISE(auto values_buffer,
-                          AllocateBuffer(value_elsize * nonzero_count, pool_));
-    auto* values = values_buffer->mutable_data();
-
-    const auto* tensor_data = tensor_.raw_data();
-
-    if (ndim <= 1) {
-      return Status::NotImplemented("TODO for ndim <= 1");
-    } else {
-      ARROW_ASSIGN_OR_RAISE(indptr_buffer,
-                            AllocateBuffer(index_elsize * (n_major + 1), pool_));
-      auto* indptr = indptr_buffer->mutable_data();
-
-      ARROW_ASSIGN_OR_RAISE(indices_buffer,
-                            AllocateBuffer(index_elsize * nonzero_count, pool_));
-      auto* indices = indices_buffer->mutable_data();
-
-      std::vector<int64_t> coords(2);
-      int64_t k = 0;
-      std::fill_n(indptr, index_elsize, 0);
-      indptr += index_elsize;
-      for (int64_t i = 0; i < n_major; ++i) {
-        for (int64_t j = 0; j < n_minor; ++j) {
-          if (axis_ == SparseMatrixCompressedAxis::ROW) {
-            coords = {i, j};
-          } else {
-            coords = {j, i};
-          }
-          const int64_t offset = tensor_.CalculateValueOffset(coords);
-          if (std::any_of(tensor_data + offset, tensor_data + offset + value_elsize,
-                          IsNonZero)) {
-            std::copy_n(tensor_data + offset, value_elsize, values);
-            values += value_elsize;
-
-            AssignIndex(indices, j, index_elsize);
-            indices += index_elsize;
-
-            k++;
-          }
-        }
-        AssignIndex(indptr, k, index_elsize);
-        indptr += index_elsize;
-      }
-    }
+                          AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool_));
+    auto* indptr = reinterpret_cast<c_index_type*>(indptr_buffer->mutable_data());
+    auto* indices = reinterpret_cast<c_index_type*>(indices_buffer->mutable_data());
+    auto* values = reinterpret_cast<c_value_type*>(values_buffer->mutable_data());
+    std::transform(offsets.begin(), offsets.end(), indptr,
+                   [](int64_t offset) { return static_cast<c_index_type>(offset); });
+
+    RETURN_NOT_OK(OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+      int64_t begin, end;
+    std::tie(begin, end) = task_range(task);
+      int64_t k = offsets[begin];
+      VisitNonZeros<c_value_type>(tensor_, major_axis, begin, end,
+                                  [&](int64_t, int64_t j, c_value_type x) {
+                                    indices[k] = static_cast<c_index_type>(j);
+                                    values[k] = x;
+                                    ++k;
+                                  });
+      return Status::OK();
+    }));
+
+    MakeResult(std::move(indptr_buffer), std::move(indices_buffer), n_major,
+               nonzero_count);
+    data = std::move(values_buffer);
+    return Status::OK();
+  }
 
+  void MakeResult(std::shared_ptr<Buffer> indptr_buffer,
+                  std::shared_ptr<Buffer> indices_buffer, int64_t n_major,
+                  int64_t nonzero_count) {
     std::vector<int64_t> indptr_shape({n_major + 1});
-    std::shared_ptr<Tensor> indptr_tensor =
-        std::make_shared<Tensor>(index_value_type_, indptr_buffer, indptr_shape);
+    std::shared_ptr<Tensor> indptr_tensor = std::make_shared<Tensor>(
+        index_value_type_, std::move(indptr_buffer), indptr_shape);
 
     std::vector<int64_t> indices_shape({nonzero_count});
-    std::shared_ptr<Tensor> indices_tensor =
-        std::make_shared<Tensor>(index_value_type_, indices_buffer, indices_shape);
+    std::shared_ptr<Tensor> indices_tensor = std::make_shared<Tensor>(
+        index_value_type_, std::move(indices_buffer), indices_shape);
 
     if (axis_ == SparseMatrixCompressedAxis::ROW) {
       sparse_index = std::make_shared<SparseCSRIndex>(indptr_tensor, indices_tensor);
     } else {
       sparse_index = std::make_shared<SparseCSCIndex>(indptr_tensor, indices_tensor);
     }
-    data = std::move(values_buffer);
-
-    return Status::OK();
   }
 
-  std::shared_ptr<SparseIndex> sparse_index;
-  std::shared_ptr<Buffer> data;
-
- private:
   SparseMatrixCompressedAxis axis_;
   const Tensor& tensor_;
   const std::shared_ptr<DataType>& index_value_type_;
   MemoryPool* pool_;
 };
 
+#undef CONVERT_TENSOR
+
+// ----------------------------------------------------------------------
+// Conversion from the columns of a table to a CSR matrix
+
+// Calls visit(i, x) on each valid non-zero value x in the rows [begin, end) of a column
+template <typename c_value_type, typename Visit>
+void VisitColumnNonZeros(const ChunkedArray& column, int64_t begin, int64_t end,
+                         Visit&& visit) {
+  constexpr c_value_type zero = 0;
+  int64_t chunk_offset = 0;
+  for (const auto& chunk : column.chunks()) {
+    const int64_t chunk_end = chunk_offset + chunk->length();
+    if (chunk_end > begin) {
+      const ArrayData& data = *chunk->data();
+      const auto* values = data.GetValues<c_value_type>(1);
+      const uint8_t* validity =
+          data.GetNullCount() > 0 ? data.buffers[0]->data() : NULLPTR;
+      const int64_t chunk_begin = std::max(begin, chunk_offset) - chunk_offset;
+      const int64_t chunk_stop = std::min(end, chunk_end) - chunk_offset;
+      for (int64_t k = chunk_begin; k < chunk_stop; ++k) {
+        if (values[k] != zero &&
+            (validity == NULLPTR || bit_util::GetBit(validity, data.offset + k))) {
+          visit(chunk_offset + k, values[k]);
+        }
+      }
+    }
+    chunk_offset = chunk_end;
+    if (chunk_offset >= end) break;
+  }
+}
+
+// Like SparseCSXMatrixConverter::ConvertImpl, but each task visits the columns in
+// order on its range of rows, appending to the rows' indices and values.
+template <typename c_index_type, typename c_value_type>
+Status ConvertTableToCSR(const Table& table, MemoryPool* pool,
+                         std::shared_ptr<Buffer>* out_indptr,
+                         std::shared_ptr<Buffer>* out_indices,
+                         std::shared_ptr<Buffer>* out_values) {
+  const int64_t n_rows = table.num_rows();
+  const int n_columns = table.num_columns();
+
+  const int num_tasks = static_cast<int>(std::max<int64_t>(
+      1, std::min<int64_t>(SparseConversionTaskCount(n_rows * n_columns), n_rows)));
+  const int64_t task_size = bit_util::CeilDiv(n_rows, num_tasks);
+  auto task_range = [&](int task) {
+    const int64_t begin = std::min(n_rows, task * task_size);
+    return std::make_pair(begin, std::min(n_rows, begin + task_size));
+  };
+
+  std::vector<int64_t> offsets(n_rows + 1, 0);
+  RETURN_NOT_OK(OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+    int64_t begin, end;
+    std::tie(begin, end) = task_range(task);
+    for (const auto& column : table.columns()) {
+      VisitColumnNonZeros<c_value_type>(
+          *column, begin, end, [&](int64_t i, c_value_type) { ++offsets[i + 1]; });
+    }
+    return Status::OK();
+  }));
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  const int64_t nonzero_count = offsets[n_rows];
+
+  ARROW_ASSIGN_OR_RAISE(auto indptr_buffer,
+                        AllocateBuffer(sizeof(c_index_type) * (n_rows + 1), pool));
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        AllocateBuffer(sizeof(c_index_type) * nonzero_count, pool));
+  ARROW_ASSIGN_OR_RAISE(auto values_buffer,
+                        AllocateBuffer(sizeof(c_value_type) * nonzero_count, pool));
+  auto* indptr = reinterpret_cast<c_index_type*>(indptr_buffer->mutable_data());
+  auto* indices = reinterpret_cast<c_index_type*>(indices_buffer->mutable_data());
+  auto* values = reinterpret_cast<c_value_type*>(values_buffer->mutable_data());
+  std::transform(offsets.begin(), offsets.end(), indptr,
+                 [](int64_t offset) { return static_cast<c_index_type>(offset); });
+
+  RETURN_NOT_OK(OptionalParallelFor(num_tasks > 1, num_tasks, [&](int task) {
+    int64_t begin, end;
+    std::tie(begin, end) = task_range(task);
+    // The position of the next value of each row
+    std::vector<int64_t> positions(offsets.begin() + begin, offsets.begin() + end);
+    for (int j = 0; j < n_columns; ++j) {
+      VisitColumnNonZeros<c_value_type>(*table.column(j), begin, end,
+                                        [&](int64_t i, c_value_type x) {
+                                          const int64_t k = positions[i - begin]++;
+                                          indices[k] = static_cast<c_index_type>(j);
+                                          values[k] = x;
+                                        });
+    }
+    return Status::OK();
+  }));
+
+  *out_indptr = std::move(indptr_buffer);
+  *out_indices = std::move(indices_buffer);
+  *out_values = std::move(values_buffer);
+  return Status::OK();
+}
+
+#define CONVERT_TABLE(index_type, value_type, out_status, ...) \
+  *out_status = internal::ConvertTableToCSR<index_type, value_type>(__VA_ARGS__)
+
 }  // namespace
 
 Status MakeSparseCSXMatrixFromTensor(SparseMatrixCompressedAxis axis,
@@ -238,4 +386,44 @@ Result<std::shared_ptr<Tensor>> MakeTensorFromSparseCSCMatrix(
 }
 
 }  // namespace internal
+
+Result<std::shared_ptr<SparseCSRMatrix>> MakeSparseCSRMatrixFromTable(
+    const Table& table, const std::shared_ptr<DataType>& index_value_type,
+    MemoryPool* pool) {
+  if (table.num_columns() == 0) {
+    return Status::Invalid("Cannot make a sparse matrix from a table without columns");
+  }
+  const auto& type = table.column(0)->type();
+  if (!is_integer(type->id()) && !is_floating(type->id())) {
+    return Status::TypeError("Cannot make a sparse matrix from columns of type ", *type);
+  }
+  for (const auto& column : table.columns()) {
+    if (!column->type()->Equals(*type)) {
+      return Status::TypeError(
+          "Cannot make a sparse matrix from columns of different types: ", *type,
+          " and ", *column->type());
+    }
+  }
+  const std::vector<int64_t> shape = {table.num_rows(), table.num_columns()};
+  RETURN_NOT_OK(internal::CheckSparseIndexMaximumValue(index_value_type, shape));
+
+  const int index_elsize = index_value_type->byte_width();
+  const int value_elsize = type->byte_width();
+  std::shared_ptr<Buffer> indptr_buffer;
+  std::shared_ptr<Buffer> indices_buffer;
+  std::shared_ptr<Buffer> values_buffer;
+  Status status;
+  DISPATCH(CONVERT_TABLE, index_elsize, value_elsize, &status, table, pool,
+           &indptr_buffer, &indices_buffer, &values_buffer);
+  RETURN_NOT_OK(status);
+
+  auto indptr = std::make_shared<Tensor>(index_value_type, std::move(indptr_buffer),
+                                         std::vector<int64_t>{shape[0] + 1});
+  const int64_t nonzero_count = values_buffer->size() / value_elsize;
+  auto indices = std::make_shared<Tensor>(index_value_type, std::move(indices_buffer),
+                                          std::vector<int64_t>{nonzero_count});
+  return SparseCSRMatrix::Make(std::make_shared<SparseCSRIndex>(indptr, indices), type,
+                               std::move(values_buffer), shape, /*dim_names=*/{});
+}
+
 }  // namespace arrow
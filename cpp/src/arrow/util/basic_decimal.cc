@@ -281,9 +281,44 @@ inline void MultiplyUnsignedArray(const std::array<uint64_t, N>& lh,
   }
 }
 
+// Whether the value of a decimal fits in 64 bits, i.e. its high words only extend
+// the sign of its low word. Most values in practice do, and are then computed on
+// with native 64-bit arithmetic rather than wide multiplication or long division.
+template <class DecimalClass>
+inline bool FitsInInt64(const DecimalClass& value, int64_t* out) {
+  const auto words = value.little_endian_array();
+  const auto low = static_cast<int64_t>(words[0]);
+  const auto sign_extension = static_cast<uint64_t>(low >> 63);
+  for (size_t i = 1; i < words.size(); ++i) {
+    if (words[i] != sign_extension) {
+      return false;
+    }
+  }
+  *out = low;
+  return true;
+}
+
+// The exact product of two 64-bit integers
+inline BasicDecimal128 MultiplyInt64(int64_t x, int64_t y) {
+  const uint64_t abs_x = x < 0 ? ~static_cast<uint64_t>(x) + 1 : static_cast<uint64_t>(x);
+  const uint64_t abs_y = y < 0 ? ~static_cast<uint64_t>(y) + 1 : static_cast<uint64_t>(y);
+  uint128_t r(abs_x);
+  r *= uint128_t(abs_y);
+  BasicDecimal128 result(static_cast<int64_t>(r.hi()), r.lo());
+  if ((x < 0) != (y < 0)) {
+    result.Negate();
+  }
+  return result;
+}
+
 }  // namespace
 
 BasicDecimal128& BasicDecimal128::operator*=(const BasicDecimal128& right) {
+  int64_t x_64, y_64;
+  if (FitsInInt64(*this, &x_64) && FitsInInt64(right, &y_64)) {
+    *this = MultiplyInt64(x_64, y_64);
+    return *this;
+  }
   // Since the max value of BasicDecimal128 is supposed to be 1e38 - 1 and the
   // min the negation taking the absolute values here should always be safe.
   const bool negate = Sign() != right.Sign();
@@ -515,6 +550,16 @@ template <class DecimalClass>
 static inline DecimalStatus DecimalDivide(const DecimalClass& dividend,
                                           const DecimalClass& divisor,
                                           DecimalClass* result, DecimalClass* remainder) {
+  int64_t dividend_64, divisor_64;
+  if (FitsInInt64(dividend, &dividend_64) && FitsInInt64(divisor, &divisor_64) &&
+      divisor_64 != 0 &&
+      !(dividend_64 == std::numeric_limits<int64_t>::min() && divisor_64 == -1)) {
+    // Both truncate towards zero, and give the remainder the sign of the dividend
+    *result = dividend_64 / divisor_64;
+    *remainder = dividend_64 % divisor_64;
+    return DecimalStatus::kSuccess;
+  }
+
   constexpr int64_t kDecimalArrayLength = DecimalClass::kBitWidth / sizeof(uint32_t);
   // Split the dividend and divisor into integer pieces so that we can
   // work on them.
@@ -908,6 +953,11 @@ BasicDecimal256& BasicDecimal256::operator>>=(uint32_t bits) {
 }
 
 BasicDecimal256& BasicDecimal256::operator*=(const BasicDecimal256& right) {
+  int64_t x_64, y_64;
+  if (FitsInInt64(*this, &x_64) && FitsInInt64(right, &y_64)) {
+    *this = BasicDecimal256(MultiplyInt64(x_64, y_64));
+    return *this;
+  }
   // Since the max value of BasicDecimal256 is supposed to be 1e76 - 1 and the
   // min the negation taking the absolute values here should always be safe.
   const bool negate = Sign() != right.Sign();
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstring>
 #include <string_view>
 #include <utility>
 
@@ -92,4 +94,27 @@ bool EqualBinaryView(BinaryViewType::c_type l, BinaryViewType::c_type r,
                 l.size() - BinaryViewType::kPrefixSize) == 0;
 }
 
+/// \brief Three-way comparison of two views, in lexicographic byte order
+///
+/// The inlined prefix decides most comparisons without touching the out-of-line
+/// buffers.
+template <typename BufferPtr>
+int CompareBinaryView(BinaryViewType::c_type l, BinaryViewType::c_type r,
+                      const BufferPtr* l_buffers, const BufferPtr* r_buffers) {
+  const int32_t prefix_size =
+      std::min({l.size(), r.size(), static_cast<int32_t>(BinaryViewType::kPrefixSize)});
+  int cmp = memcmp(l.inline_data(), r.inline_data(), prefix_size);
+  if (cmp != 0) return cmp;
+
+  if (prefix_size < BinaryViewType::kPrefixSize) {
+    // At least one of the strings is entirely contained in the common prefix
+    return (l.size() > r.size()) - (l.size() < r.size());
+  }
+  std::string_view l_view = FromBinaryView(l, l_buffers);
+  std::string_view r_view = FromBinaryView(r, r_buffers);
+  cmp = l_view.substr(BinaryViewType::kPrefixSize)
+            .compare(r_view.substr(BinaryViewType::kPrefixSize));
+  return (cmp > 0) - (cmp < 0);
+}
+
 }  // namespace arrow::util
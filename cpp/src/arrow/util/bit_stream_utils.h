@@ -24,6 +24,7 @@
 #include <cstring>
 
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/bpacking.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
@@ -165,6 +166,11 @@ class BitReader {
   /// are not enough bits left.
   bool Advance(int64_t num_bits);
 
+  /// Copies the next 'num_bits' bits of the stream to 'bitmap', starting at bit
+  /// 'offset', which is how values of a bit width of 1 are laid out in a bitmap.
+  /// Returns false if there are not enough bits left.
+  bool GetBits(int64_t num_bits, uint8_t* bitmap, int64_t offset);
+
   /// Reads a vlq encoded int from the stream.  The encoded int must start at
   /// the beginning of a byte. Return false if there were not enough bytes in
   /// the buffer.
@@ -439,6 +445,15 @@ inline bool BitReader::Advance(int64_t num_bits) {
   return true;
 }
 
+inline bool BitReader::GetBits(int64_t num_bits, uint8_t* bitmap, int64_t offset) {
+  const int64_t position = static_cast<int64_t>(byte_offset_) * 8 + bit_offset_;
+  if (ARROW_PREDICT_FALSE(num_bits > static_cast<int64_t>(max_bytes_) * 8 - position)) {
+    return false;
+  }
+  ::arrow::internal::CopyBitmap(buffer_, position, num_bits, bitmap, offset);
+  return Advance(num_bits);
+}
+
 inline bool BitWriter::PutVlqInt(uint32_t v) {
   bool result = true;
   while ((v & 0xFFFFFF80UL) != 0UL) {
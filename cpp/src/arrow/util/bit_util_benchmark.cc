@@ -497,6 +497,24 @@ static void BitmapEqualsWithoutOffset(benchmark::State& state) { BitmapEquals<0>
 
 static void BitmapEqualsWithOffset(benchmark::State& state) { BitmapEquals<4>(state); }
 
+template <int64_t Offset = 0>
+static void CountSetBits(benchmark::State& state) {
+  const int64_t buffer_size = state.range(0);
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(buffer_size);
+  const int64_t length = buffer_size * 8 - Offset;
+
+  for (auto _ : state) {
+    auto count = internal::CountSetBits(buffer->data(), Offset, length);
+    benchmark::DoNotOptimize(count);
+  }
+
+  state.SetBytesProcessed(state.iterations() * buffer_size);
+}
+
+static void CountSetBitsWithoutOffset(benchmark::State& state) { CountSetBits<0>(state); }
+
+static void CountSetBitsWithOffset(benchmark::State& state) { CountSetBits<3>(state); }
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 static void ReferenceNaiveBitmapReader(benchmark::State& state) {
   BenchmarkBitmapReader<NaiveBitmapReader>(state, state.range(0));
@@ -542,6 +560,9 @@ BENCHMARK(CopyBitmapWithOffsetBoth)->Arg(kBufferSize);
 BENCHMARK(BitmapEqualsWithoutOffset)->Arg(kBufferSize);
 BENCHMARK(BitmapEqualsWithOffset)->Arg(kBufferSize);
 
+BENCHMARK(CountSetBitsWithoutOffset)->Arg(kBufferSize);
+BENCHMARK(CountSetBitsWithOffset)->Arg(kBufferSize);
+
 #define AND_BENCHMARK_RANGES                      \
   {                                               \
     {kBufferSize * 4, kBufferSize * 16}, { 0, 2 } \
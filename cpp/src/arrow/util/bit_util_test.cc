@@ -59,6 +59,7 @@ namespace arrow {
 using internal::BitmapAnd;
 using internal::BitmapAndNot;
 using internal::BitmapOr;
+using internal::BitmapOrNot;
 using internal::BitmapXor;
 using internal::BitsetStack;
 using internal::CopyBitmap;
@@ -1465,6 +1466,46 @@ TEST_F(BitmapOp, RandomXor) {
   }
 }
 
+TEST_F(BitmapOp, RandomLong) {
+  // Long enough for several SIMD blocks, with tails of various lengths
+  const int64_t kBufferSize = 1200;
+  std::vector<uint8_t> left(kBufferSize), right(kBufferSize), out(kBufferSize);
+  random_bytes(kBufferSize, 0, left.data());
+  random_bytes(kBufferSize, 1, right.data());
+
+  using BitmapOpFunc = void (*)(const uint8_t*, int64_t, const uint8_t*, int64_t,
+                                int64_t, int64_t, uint8_t*);
+  using BitFunc = bool (*)(bool, bool);
+  const std::vector<std::pair<BitmapOpFunc, BitFunc>> ops = {
+      {&BitmapAnd, [](bool l, bool r) { return l && r; }},
+      {&BitmapOr, [](bool l, bool r) { return l || r; }},
+      {&BitmapXor, [](bool l, bool r) { return l != r; }},
+      {&BitmapAndNot, [](bool l, bool r) { return l && !r; }},
+      {&BitmapOrNot, [](bool l, bool r) { return l || !r; }},
+  };
+
+  for (const auto& [op, bit_op] : ops) {
+    for (int64_t left_offset : {0, 1, 7, 8, 13, 65}) {
+      for (int64_t right_offset : {0, 3, 8, 511, 1024}) {
+        for (int64_t out_offset : {0, 8, 24, 5}) {
+          for (int64_t length : {255, 256, 1023, 1024, 4097, 8000}) {
+            std::fill(out.begin(), out.end(), 0);
+            op(left.data(), left_offset, right.data(), right_offset, length, out_offset,
+               out.data());
+            for (int64_t i = 0; i < length; ++i) {
+              ASSERT_EQ(bit_util::GetBit(out.data(), out_offset + i),
+                        bit_op(bit_util::GetBit(left.data(), left_offset + i),
+                               bit_util::GetBit(right.data(), right_offset + i)))
+                  << "at bit " << i << " with offsets " << left_offset << ", "
+                  << right_offset << ", " << out_offset << " and length " << length;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
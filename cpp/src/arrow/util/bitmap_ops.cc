@@ -21,19 +21,67 @@
 #include <cstring>
 #include <functional>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/util/align_util.h"
 #include "arrow/util/bit_block_counter.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops_internal.h"
 #include "arrow/util/bitmap_reader.h"
 #include "arrow/util/bitmap_writer.h"
+#include "arrow/util/dispatch.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+int64_t CountSetBitsScalar(const uint64_t* words, int64_t nwords) {
+  constexpr int64_t kCountUnrollFactor = 4;
+  const int64_t words_rounded = bit_util::RoundDown(nwords, kCountUnrollFactor);
+  int64_t count_unroll[kCountUnrollFactor] = {0};
+
+  // Unroll the loop for better performance
+  for (int64_t i = 0; i < words_rounded; i += kCountUnrollFactor) {
+    for (int64_t k = 0; k < kCountUnrollFactor; k++) {
+      count_unroll[k] += bit_util::PopCount(words[i + k]);
+    }
+  }
+  int64_t count = 0;
+  for (int64_t k = 0; k < kCountUnrollFactor; k++) {
+    count += count_unroll[k];
+  }
+
+  // The trailing part
+  for (int64_t i = words_rounded; i < nwords; ++i) {
+    count += bit_util::PopCount(words[i]);
+  }
+  return count;
+}
+
+struct CountSetBitsDynamicFunction {
+  using FunctionType = decltype(&CountSetBitsScalar);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, CountSetBitsScalar}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, CountSetBitsAvx2}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, CountSetBitsAvx512}
+#endif
+    };
+  }
+};
+
+}  // namespace
+
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
   constexpr int64_t pop_len = sizeof(uint64_t) * 8;
   DCHECK_GE(bit_offset, 0);
@@ -50,28 +98,8 @@ int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length) {
     // popcount as much as possible with the widest possible count
     const uint64_t* u64_data = reinterpret_cast<const uint64_t*>(p.aligned_start);
     DCHECK_EQ(reinterpret_cast<size_t>(u64_data) & 7, 0);
-    const uint64_t* end = u64_data + p.aligned_words;
-
-    constexpr int64_t kCountUnrollFactor = 4;
-    const int64_t words_rounded =
-        bit_util::RoundDown(p.aligned_words, kCountUnrollFactor);
-    int64_t count_unroll[kCountUnrollFactor] = {0};
-
-    // Unroll the loop for better performance
-    for (int64_t i = 0; i < words_rounded; i += kCountUnrollFactor) {
-      for (int64_t k = 0; k < kCountUnrollFactor; k++) {
-        count_unroll[k] += bit_util::PopCount(u64_data[k]);
-      }
-      u64_data += kCountUnrollFactor;
-    }
-    for (int64_t k = 0; k < kCountUnrollFactor; k++) {
-      count += count_unroll[k];
-    }
-
-    // The trailing part
-    for (; u64_data < end; ++u64_data) {
-      count += bit_util::PopCount(*u64_data);
-    }
+    static DynamicDispatch<CountSetBitsDynamicFunction> dispatch;
+    count += dispatch.func(u64_data, p.aligned_words);
   }
 
   // Account for left over bits (in theory we could fall back to smaller
@@ -326,8 +354,69 @@ bool OptionalBitmapEquals(const std::shared_ptr<Buffer>& left, int64_t left_offs
                               right ? right->data() : nullptr, right_offset, length);
 }
 
+template <typename T>
+struct AndNotOp {
+  constexpr T operator()(const T& l, const T& r) const { return l & ~r; }
+};
+
+template <typename T>
+struct OrNotOp {
+  constexpr T operator()(const T& l, const T& r) const { return l | ~r; }
+};
+
 namespace {
 
+template <template <typename> class BitOp>
+struct BitmapOpKindOf;
+
+template <>
+struct BitmapOpKindOf<std::bit_and> {
+  static constexpr BitmapOpKind value = BitmapOpKind::kAnd;
+};
+
+template <>
+struct BitmapOpKindOf<std::bit_or> {
+  static constexpr BitmapOpKind value = BitmapOpKind::kOr;
+};
+
+template <>
+struct BitmapOpKindOf<std::bit_xor> {
+  static constexpr BitmapOpKind value = BitmapOpKind::kXor;
+};
+
+template <>
+struct BitmapOpKindOf<AndNotOp> {
+  static constexpr BitmapOpKind value = BitmapOpKind::kAndNot;
+};
+
+template <>
+struct BitmapOpKindOf<OrNotOp> {
+  static constexpr BitmapOpKind value = BitmapOpKind::kOrNot;
+};
+
+// Without SIMD, leave all the bits to UnalignedBitmapOp()
+int64_t BitmapOpScalar(BitmapOpKind, const uint8_t*, int64_t, const uint8_t*, int64_t,
+                       int64_t, uint8_t*) {
+  return 0;
+}
+
+struct BitmapOpDynamicFunction {
+  using FunctionType = decltype(&BitmapOpScalar);
+
+  static std::vector<std::pair<DispatchLevel, FunctionType>> implementations() {
+    return {{DispatchLevel::NONE, BitmapOpScalar}
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+            ,
+            {DispatchLevel::AVX2, BitmapOpAvx2}
+#endif
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+            ,
+            {DispatchLevel::AVX512, BitmapOpAvx512}
+#endif
+    };
+  }
+};
+
 template <template <typename> class BitOp>
 void AlignedBitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                      int64_t right_offset, uint8_t* out, int64_t out_offset,
@@ -379,8 +468,15 @@ void BitmapOp(const uint8_t* left, int64_t left_offset, const uint8_t* right,
                            length);
   } else {
     // Unaligned
-    UnalignedBitmapOp<BitOp>(left, left_offset, right, right_offset, dest, out_offset,
-                             length);
+    int64_t done = 0;
+    if (out_offset % 8 == 0) {
+      // The SIMD kernels shift the inputs into a byte-aligned output
+      static DynamicDispatch<BitmapOpDynamicFunction> dispatch;
+      done = dispatch.func(BitmapOpKindOf<BitOp>::value, left, left_offset, right,
+                           right_offset, length, dest + out_offset / 8);
+    }
+    UnalignedBitmapOp<BitOp>(left, left_offset + done, right, right_offset + done, dest,
+                             out_offset + done, length - done);
   }
 }
 
@@ -437,11 +533,6 @@ void BitmapXor(const uint8_t* left, int64_t left_offset, const uint8_t* right,
   BitmapOp<std::bit_xor>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
-template <typename T>
-struct AndNotOp {
-  constexpr T operator()(const T& l, const T& r) const { return l & ~r; }
-};
-
 Result<std::shared_ptr<Buffer>> BitmapAndNot(MemoryPool* pool, const uint8_t* left,
                                              int64_t left_offset, const uint8_t* right,
                                              int64_t right_offset, int64_t length,
@@ -456,11 +547,6 @@ void BitmapAndNot(const uint8_t* left, int64_t left_offset, const uint8_t* right
   BitmapOp<AndNotOp>(left, left_offset, right, right_offset, length, out_offset, out);
 }
 
-template <typename T>
-struct OrNotOp {
-  constexpr T operator()(const T& l, const T& r) const { return l | ~r; }
-};
-
 Result<std::shared_ptr<Buffer>> BitmapOrNot(MemoryPool* pool, const uint8_t* left,
                                             int64_t left_offset, const uint8_t* right,
                                             int64_t right_offset, int64_t length,
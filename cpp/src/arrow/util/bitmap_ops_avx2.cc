@@ -0,0 +1,140 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <algorithm>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Count the set bits of each byte, with a lookup table of the counts of the
+// nibbles (Mula's method)
+inline __m256i PopCountBytes(__m256i v) {
+  const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                          0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low_mask = _mm256_set1_epi8(0x0f);
+  const __m256i low = _mm256_and_si256(v, low_mask);
+  const __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+  return _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+                         _mm256_shuffle_epi8(lookup, high));
+}
+
+// Load the four words starting at bit `shift` of `p`: their low bits come
+// from the words at `p` and their high bits from the words at `p + 1`.
+// Reads 33 bytes.
+inline __m256i LoadShiftedWords(const uint8_t* p, __m128i shift, __m128i next_shift) {
+  const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  const __m256i next_words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + 1));
+  return _mm256_or_si256(_mm256_srl_epi64(words, shift),
+                         _mm256_sll_epi64(next_words, next_shift));
+}
+
+template <typename Op>
+int64_t BitmapOpImpl(Op&& op, const uint8_t* left, int64_t left_offset,
+                     const uint8_t* right, int64_t right_offset, int64_t length,
+                     uint8_t* out) {
+  constexpr int64_t kBlockBytes = sizeof(__m256i);
+  const int left_shift = static_cast<int>(left_offset % 8);
+  const int right_shift = static_cast<int>(right_offset % 8);
+  left += left_offset / 8;
+  right += right_offset / 8;
+
+  // Each block reads one byte past its own bytes
+  const int64_t left_bytes = bit_util::BytesForBits(left_shift + length);
+  const int64_t right_bytes = bit_util::BytesForBits(right_shift + length);
+  const int64_t num_blocks =
+      std::min({length / (kBlockBytes * 8), (left_bytes - 1) / kBlockBytes,
+                (right_bytes - 1) / kBlockBytes});
+
+  const __m128i left_shifts[2] = {_mm_cvtsi32_si128(left_shift),
+                                  _mm_cvtsi32_si128(8 - left_shift)};
+  const __m128i right_shifts[2] = {_mm_cvtsi32_si128(right_shift),
+                                   _mm_cvtsi32_si128(8 - right_shift)};
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    const int64_t pos = i * kBlockBytes;
+    const __m256i l = LoadShiftedWords(left + pos, left_shifts[0], left_shifts[1]);
+    const __m256i r = LoadShiftedWords(right + pos, right_shifts[0], right_shifts[1]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + pos), op(l, r));
+  }
+  return num_blocks * kBlockBytes * 8;
+}
+
+}  // namespace
+
+int64_t CountSetBitsAvx2(const uint64_t* words, int64_t nwords) {
+  const auto* vectors = reinterpret_cast<const __m256i*>(words);
+  const int64_t num_vectors = nwords / 4;
+  const __m256i zero = _mm256_setzero_si256();
+
+  __m256i totals = zero;
+  int64_t i = 0;
+  while (i < num_vectors) {
+    // Byte counts are at most 8, so that 31 of them can be summed bytewise
+    const int64_t end = std::min<int64_t>(num_vectors, i + 31);
+    __m256i byte_counts = zero;
+    for (; i < end; ++i) {
+      byte_counts =
+          _mm256_add_epi8(byte_counts, PopCountBytes(_mm256_loadu_si256(vectors + i)));
+    }
+    totals = _mm256_add_epi64(totals, _mm256_sad_epu8(byte_counts, zero));
+  }
+  int64_t count = _mm256_extract_epi64(totals, 0) + _mm256_extract_epi64(totals, 1) +
+                  _mm256_extract_epi64(totals, 2) + _mm256_extract_epi64(totals, 3);
+
+  for (int64_t j = num_vectors * 4; j < nwords; ++j) {
+    count += bit_util::PopCount(words[j]);
+  }
+  return count;
+}
+
+int64_t BitmapOpAvx2(BitmapOpKind op, const uint8_t* left, int64_t left_offset,
+                     const uint8_t* right, int64_t right_offset, int64_t length,
+                     uint8_t* out) {
+  switch (op) {
+    case BitmapOpKind::kAnd:
+      return BitmapOpImpl(
+          [](__m256i l, __m256i r) { return _mm256_and_si256(l, r); }, left,
+          left_offset, right, right_offset, length, out);
+    case BitmapOpKind::kOr:
+      return BitmapOpImpl([](__m256i l, __m256i r) { return _mm256_or_si256(l, r); },
+                          left, left_offset, right, right_offset, length, out);
+    case BitmapOpKind::kXor:
+      return BitmapOpImpl(
+          [](__m256i l, __m256i r) { return _mm256_xor_si256(l, r); }, left,
+          left_offset, right, right_offset, length, out);
+    case BitmapOpKind::kAndNot:
+      return BitmapOpImpl(
+          [](__m256i l, __m256i r) { return _mm256_andnot_si256(r, l); }, left,
+          left_offset, right, right_offset, length, out);
+    case BitmapOpKind::kOrNot:
+      return BitmapOpImpl(
+          [](__m256i l, __m256i r) {
+            return _mm256_or_si256(l, _mm256_xor_si256(r, _mm256_set1_epi8(-1)));
+          },
+          left, left_offset, right, right_offset, length, out);
+  }
+  return 0;
+}
+
+}  // namespace internal
+}  // namespace arrow
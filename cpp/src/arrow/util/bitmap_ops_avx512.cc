@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include <algorithm>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Count the set bits of each byte, with a lookup table of the counts of the
+// nibbles (Mula's method)
+inline __m512i PopCountBytes(__m512i v) {
+  const __m512i lookup = _mm512_maskz_broadcast_i32x4(
+      0xffff, _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+  const __m512i low_mask = _mm512_set1_epi8(0x0f);
+  const __m512i low = _mm512_and_si512(v, low_mask);
+  const __m512i high = _mm512_and_si512(_mm512_srli_epi16(v, 4), low_mask);
+  return _mm512_add_epi8(_mm512_shuffle_epi8(lookup, low),
+                         _mm512_shuffle_epi8(lookup, high));
+}
+
+// Load the eight words starting at bit `shift` of `p`: their low bits come
+// from the words at `p` and their high bits from the words at `p + 1`.
+// Reads 65 bytes.
+inline __m512i LoadShiftedWords(const uint8_t* p, __m128i shift, __m128i next_shift) {
+  const __m512i words = _mm512_loadu_si512(p);
+  const __m512i next_words = _mm512_loadu_si512(p + 1);
+  // (the maskz variants avoid spurious -Wmaybe-uninitialized warnings with gcc)
+  return _mm512_or_si512(_mm512_maskz_srl_epi64(0xff, words, shift),
+                         _mm512_maskz_sll_epi64(0xff, next_words, next_shift));
+}
+
+template <typename Op>
+int64_t BitmapOpImpl(Op&& op, const uint8_t* left, int64_t left_offset,
+                     const uint8_t* right, int64_t right_offset, int64_t length,
+                     uint8_t* out) {
+  constexpr int64_t kBlockBytes = sizeof(__m512i);
+  const int left_shift = static_cast<int>(left_offset % 8);
+  const int right_shift = static_cast<int>(right_offset % 8);
+  left += left_offset / 8;
+  right += right_offset / 8;
+
+  // Each block reads one byte past its own bytes
+  const int64_t left_bytes = bit_util::BytesForBits(left_shift + length);
+  const int64_t right_bytes = bit_util::BytesForBits(right_shift + length);
+  const int64_t num_blocks =
+      std::min({length / (kBlockBytes * 8), (left_bytes - 1) / kBlockBytes,
+                (right_bytes - 1) / kBlockBytes});
+
+  const __m128i left_shifts[2] = {_mm_cvtsi32_si128(left_shift),
+                                  _mm_cvtsi32_si128(8 - left_shift)};
+  const __m128i right_shifts[2] = {_mm_cvtsi32_si128(right_shift),
+                                   _mm_cvtsi32_si128(8 - right_shift)};
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    const int64_t pos = i * kBlockBytes;
+    const __m512i l = LoadShiftedWords(left + pos, left_shifts[0], left_shifts[1]);
+    const __m512i r = LoadShiftedWords(right + pos, right_shifts[0], right_shifts[1]);
+    _mm512_storeu_si512(out + pos, op(l, r));
+  }
+  return num_blocks * kBlockBytes * 8;
+}
+
+}  // namespace
+
+int64_t CountSetBitsAvx512(const uint64_t* words, int64_t nwords) {
+  const int64_t num_vectors = nwords / 8;
+  const __m512i zero = _mm512_setzero_si512();
+
+  __m512i totals = zero;
+  int64_t i = 0;
+  while (i < num_vectors) {
+    // Byte counts are at most 8, so that 31 of them can be summed bytewise
+    const int64_t end = std::min<int64_t>(num_vectors, i + 31);
+    __m512i byte_counts = zero;
+    for (; i < end; ++i) {
+      byte_counts =
+          _mm512_add_epi8(byte_counts, PopCountBytes(_mm512_loadu_si512(words + i * 8)));
+    }
+    totals = _mm512_add_epi64(totals, _mm512_sad_epu8(byte_counts, zero));
+  }
+  alignas(64) int64_t lanes[8];
+  _mm512_store_si512(lanes, totals);
+  int64_t count = 0;
+  for (int64_t lane : lanes) {
+    count += lane;
+  }
+
+  for (int64_t j = num_vectors * 8; j < nwords; ++j) {
+    count += bit_util::PopCount(words[j]);
+  }
+  return count;
+}
+
+int64_t BitmapOpAvx512(BitmapOpKind op, const uint8_t* left, int64_t left_offset,
+                       const uint8_t* right, int64_t right_offset, int64_t length,
+                       uint8_t* out) {
+  switch (op) {
+    case BitmapOpKind::kAnd:
+      return BitmapOpImpl(
+          [](__m512i l, __m512i r) { return _mm512_and_si512(l, r); }, left,
+          left_offset, right, right_offset, length, out);
+    case BitmapOpKind::kOr:
+      return BitmapOpImpl([](__m512i l, __m512i r) { return _mm512_or_si512(l, r); },
+                          left, left_offset, right, right_offset, length, out);
+    case BitmapOpKind::kXor:
+      return BitmapOpImpl(
+          [](__m512i l, __m512i r) { return _mm512_xor_si512(l, r); }, left,
+          left_offset, right, right_offset, length, out);
+    case BitmapOpKind::kAndNot:
+      return BitmapOpImpl(
+          [](__m512i l, __m512i r) {
+            // 0x30 is the truth table of l & ~r
+            return _mm512_ternarylogic_epi64(l, r, r, 0x30);
+          },
+          left, left_offset, right, right_offset, length, out);
+    case BitmapOpKind::kOrNot:
+      return BitmapOpImpl(
+          [](__m512i l, __m512i r) {
+            // 0xF3 is the truth table of l | ~r
+            return _mm512_ternarylogic_epi64(l, r, r, 0xF3);
+          },
+          left, left_offset, right, right_offset, length, out);
+  }
+  return 0;
+}
+
+}  // namespace internal
+}  // namespace arrow
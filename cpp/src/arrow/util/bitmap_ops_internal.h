@@ -0,0 +1,55 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// SIMD kernels of bitmap_ops.cc, selected at runtime
+
+#pragma once
+
+#include <cstdint>
+
+namespace arrow {
+namespace internal {
+
+enum class BitmapOpKind : int8_t { kAnd, kOr, kXor, kAndNot, kOrNot };
+
+// CountSetBits*(): return the number of set bits in `nwords` words.
+//
+// BitmapOp*(): combine the bitmaps `left` and `right`, starting at bit offsets
+// `left_offset` and `right_offset`, into the bitmap `out`, starting at its
+// first bit.  Only whole blocks of 256 (AVX2) or 512 (AVX-512) bits are
+// combined, as long as the input bytes they require are within `length`
+// bits of the inputs.  Return the number of combined bits, which the caller
+// must combine itself.
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+int64_t CountSetBitsAvx2(const uint64_t* words, int64_t nwords);
+
+int64_t BitmapOpAvx2(BitmapOpKind op, const uint8_t* left, int64_t left_offset,
+                     const uint8_t* right, int64_t right_offset, int64_t length,
+                     uint8_t* out);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+int64_t CountSetBitsAvx512(const uint64_t* words, int64_t nwords);
+
+int64_t BitmapOpAvx512(BitmapOpKind op, const uint8_t* left, int64_t left_offset,
+                       const uint8_t* right, int64_t right_offset, int64_t length,
+                       uint8_t* out);
+#endif
+
+}  // namespace internal
+}  // namespace arrow
@@ -379,11 +379,199 @@ void ByteStreamSplitEncodeAvx2(const uint8_t* raw_values, int width,
 }
 #endif  // ARROW_HAVE_AVX2
 
+#if defined(ARROW_HAVE_AVX512)
+// Return the 4x4 transposition of the 128-bit lanes of `in`: the lane j of out[i]
+// is the lane i of in[j].
+inline void ByteStreamSplitTransposeLanesAvx512(const __m512i* in, __m512i* out) {
+  const __m512i t0 = _mm512_shuffle_i64x2(in[0], in[1], 0x44);
+  const __m512i t1 = _mm512_shuffle_i64x2(in[0], in[1], 0xEE);
+  const __m512i t2 = _mm512_shuffle_i64x2(in[2], in[3], 0x44);
+  const __m512i t3 = _mm512_shuffle_i64x2(in[2], in[3], 0xEE);
+  out[0] = _mm512_shuffle_i64x2(t0, t2, 0x88);
+  out[1] = _mm512_shuffle_i64x2(t0, t2, 0xDD);
+  out[2] = _mm512_shuffle_i64x2(t1, t3, 0x88);
+  out[3] = _mm512_shuffle_i64x2(t1, t3, 0xDD);
+}
+
+template <int kNumStreams>
+void ByteStreamSplitDecodeAvx512(const uint8_t* data, int width, int64_t num_values,
+                                 int64_t stride, uint8_t* out) {
+  assert(width == kNumStreams);
+  static_assert(kNumStreams == 2 || kNumStreams == 4 || kNumStreams == 8,
+                "Invalid number of streams.");
+  constexpr int kNumStreamsLog2 = (kNumStreams == 8 ? 3 : (kNumStreams == 4 ? 2 : 1));
+  constexpr int64_t kBlockSize = sizeof(__m512i) * kNumStreams;
+
+  const int64_t size = num_values * kNumStreams;
+  if constexpr (kNumStreams != 2) {
+    // Back to AVX2 for small size, the suffix loop handles it otherwise
+    if (size < kBlockSize) {
+      return ByteStreamSplitDecodeAvx2<kNumStreams>(data, width, num_values, stride, out);
+    }
+  }
+  const int64_t num_blocks = size / kBlockSize;
+
+  // First handle suffix.
+  const int64_t num_processed_elements = (num_blocks * kBlockSize) / kNumStreams;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    uint8_t gathered_byte_data[kNumStreams];
+    for (int b = 0; b < kNumStreams; ++b) {
+      const int64_t byte_index = b * stride + i;
+      gathered_byte_data[b] = data[byte_index];
+    }
+    memcpy(out + i * kNumStreams, gathered_byte_data, kNumStreams);
+  }
+
+  // Processed hierarchically using unpack intrinsics as in ByteStreamSplitDecodeAvx2,
+  // after which the lane `l` of stage[kNumStreamsLog2][j] holds the values of the
+  // (l * kNumStreams + j)-th 16 bytes of the output.  The lanes are then put in order
+  // with 128-bit shuffles.
+  __m512i stage[kNumStreamsLog2 + 1][kNumStreams];
+  __m512i final_result[kNumStreams];
+  constexpr int kNumStreamsHalf = kNumStreams / 2;
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm512_loadu_si512(&data[i * sizeof(__m512i) + j * stride]);
+    }
+
+    for (int step = 0; step < kNumStreamsLog2; ++step) {
+      for (int j = 0; j < kNumStreamsHalf; ++j) {
+        stage[step + 1][j * 2] =
+            _mm512_unpacklo_epi8(stage[step][j], stage[step][kNumStreamsHalf + j]);
+        stage[step + 1][j * 2 + 1] =
+            _mm512_unpackhi_epi8(stage[step][j], stage[step][kNumStreamsHalf + j]);
+      }
+    }
+
+    const __m512i* unpacked = stage[kNumStreamsLog2];
+    if constexpr (kNumStreams == 2) {
+      final_result[0] = _mm512_permutex2var_epi64(
+          unpacked[0], _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0), unpacked[1]);
+      final_result[1] = _mm512_permutex2var_epi64(
+          unpacked[0], _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4), unpacked[1]);
+    } else if constexpr (kNumStreams == 4) {
+      ByteStreamSplitTransposeLanesAvx512(unpacked, final_result);
+    } else {
+      __m512i transposed[4];
+      for (int half = 0; half < 2; ++half) {
+        ByteStreamSplitTransposeLanesAvx512(&unpacked[half * 4], transposed);
+        for (int l = 0; l < 4; ++l) {
+          final_result[l * 2 + half] = transposed[l];
+        }
+      }
+    }
+
+    for (int j = 0; j < kNumStreams; ++j) {
+      _mm512_storeu_si512(out + (i * kNumStreams + j) * sizeof(__m512i),
+                          final_result[j]);
+    }
+  }
+}
+
+template <int kNumStreams>
+void ByteStreamSplitEncodeAvx512(const uint8_t* raw_values, int width,
+                                 const int64_t num_values, uint8_t* output_buffer_raw) {
+  assert(width == kNumStreams);
+  static_assert(kNumStreams == 2 || kNumStreams == 4 || kNumStreams == 8,
+                "Invalid number of streams.");
+  constexpr int kNumStreamsLog2 = (kNumStreams == 8 ? 3 : (kNumStreams == 4 ? 2 : 1));
+  constexpr int kBlockSize = sizeof(__m512i) * kNumStreams;
+
+  const int64_t size = num_values * kNumStreams;
+  if constexpr (kNumStreams != 2) {
+    // Back to AVX2 for small size, the suffix loop handles it otherwise
+    if (size < kBlockSize) {
+      return ByteStreamSplitEncodeAvx2<kNumStreams>(raw_values, width, num_values,
+                                                    output_buffer_raw);
+    }
+  }
+  const int64_t num_blocks = size / kBlockSize;
+
+  // First handle suffix.
+  const int64_t num_processed_elements = (num_blocks * kBlockSize) / kNumStreams;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      const uint8_t byte_in_value = raw_values[i * kNumStreams + j];
+      output_buffer_raw[j * num_values + i] = byte_in_value;
+    }
+  }
+
+  // 1. Group the bytes of the values of each 128-bit lane by stream with
+  //    _mm512_shuffle_epi8, giving kNumStreams groups of (16 / kNumStreams) bytes.
+  // 2. Move the lanes with 128-bit shuffles so that the lane `l` of register `j`
+  //    holds the (l * kNumStreams + j)-th 16 bytes of the input.
+  // 3. Transpose the groups of each lane across registers with the unpack
+  //    intrinsics, giving one register per stream.
+  constexpr int kValuesPerLane = 16 / kNumStreams;
+  alignas(64) uint8_t shuffle_indices[64];
+  for (int l = 0; l < 4; ++l) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      for (int v = 0; v < kValuesPerLane; ++v) {
+        shuffle_indices[l * 16 + j * kValuesPerLane + v] =
+            static_cast<uint8_t>(v * kNumStreams + j);
+      }
+    }
+  }
+  const __m512i shuffle_mask = _mm512_load_si512(shuffle_indices);
+  __m512i shuffled[kNumStreams];
+  __m512i stage[kNumStreamsLog2 + 1][kNumStreams];
+  constexpr int kNumStreamsHalf = kNumStreams / 2;
+
+  for (int64_t block_index = 0; block_index < num_blocks; ++block_index) {
+    for (int i = 0; i < kNumStreams; ++i) {
+      const __m512i values = _mm512_loadu_si512(
+          &raw_values[(block_index * kNumStreams + i) * sizeof(__m512i)]);
+      shuffled[i] = _mm512_shuffle_epi8(values, shuffle_mask);
+    }
+
+    if constexpr (kNumStreams == 2) {
+      stage[0][0] = _mm512_shuffle_i64x2(shuffled[0], shuffled[1], 0x88);
+      stage[0][1] = _mm512_shuffle_i64x2(shuffled[0], shuffled[1], 0xDD);
+    } else if constexpr (kNumStreams == 4) {
+      ByteStreamSplitTransposeLanesAvx512(shuffled, stage[0]);
+    } else {
+      __m512i sources[4];
+      for (int half = 0; half < 2; ++half) {
+        for (int l = 0; l < 4; ++l) {
+          sources[l] = shuffled[l * 2 + half];
+        }
+        ByteStreamSplitTransposeLanesAvx512(sources, &stage[0][half * 4]);
+      }
+    }
+
+    for (int step = 0; step < kNumStreamsLog2; ++step) {
+      for (int i = 0; i < kNumStreamsHalf; ++i) {
+        const __m512i a = stage[step][i];
+        const __m512i b = stage[step][kNumStreamsHalf + i];
+        if constexpr (kNumStreams == 2) {
+          stage[step + 1][i * 2] = _mm512_unpacklo_epi64(a, b);
+          stage[step + 1][i * 2 + 1] = _mm512_unpackhi_epi64(a, b);
+        } else if constexpr (kNumStreams == 4) {
+          stage[step + 1][i * 2] = _mm512_unpacklo_epi32(a, b);
+          stage[step + 1][i * 2 + 1] = _mm512_unpackhi_epi32(a, b);
+        } else {
+          stage[step + 1][i * 2] = _mm512_unpacklo_epi16(a, b);
+          stage[step + 1][i * 2 + 1] = _mm512_unpackhi_epi16(a, b);
+        }
+      }
+    }
+
+    for (int i = 0; i < kNumStreams; ++i) {
+      _mm512_storeu_si512(&output_buffer_raw[num_values * i + block_index * 64],
+                          stage[kNumStreamsLog2][i]);
+    }
+  }
+}
+#endif  // ARROW_HAVE_AVX512
+
 #if defined(ARROW_HAVE_SIMD_SPLIT)
 template <int kNumStreams>
 void inline ByteStreamSplitDecodeSimd(const uint8_t* data, int width, int64_t num_values,
                                       int64_t stride, uint8_t* out) {
-#if defined(ARROW_HAVE_AVX2)
+#if defined(ARROW_HAVE_AVX512)
+  return ByteStreamSplitDecodeAvx512<kNumStreams>(data, width, num_values, stride, out);
+#elif defined(ARROW_HAVE_AVX2)
   return ByteStreamSplitDecodeAvx2<kNumStreams>(data, width, num_values, stride, out);
 #elif defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
   return ByteStreamSplitDecodeSimd128<kNumStreams>(data, width, num_values, stride, out);
@@ -396,7 +584,10 @@ template <int kNumStreams>
 void inline ByteStreamSplitEncodeSimd(const uint8_t* raw_values, int width,
                                       const int64_t num_values,
                                       uint8_t* output_buffer_raw) {
-#if defined(ARROW_HAVE_AVX2)
+#if defined(ARROW_HAVE_AVX512)
+  return ByteStreamSplitEncodeAvx512<kNumStreams>(raw_values, width, num_values,
+                                                  output_buffer_raw);
+#elif defined(ARROW_HAVE_AVX2)
   return ByteStreamSplitEncodeAvx2<kNumStreams>(raw_values, width, num_values,
                                                 output_buffer_raw);
 #elif defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
@@ -555,7 +746,11 @@ inline void ByteStreamSplitEncode(const uint8_t* raw_values, int width,
       memcpy(out, raw_values, num_values);
       return;
     case 2:
+#if defined(ARROW_HAVE_AVX512)
+      return ByteStreamSplitEncodeAvx512<2>(raw_values, width, num_values, out);
+#else
       return ByteStreamSplitEncodeScalar<2>(raw_values, width, num_values, out);
+#endif
     case 4:
       return ByteStreamSplitEncodePerhapsSimd<4>(raw_values, width, num_values, out);
     case 8:
@@ -579,7 +774,11 @@ inline void ByteStreamSplitDecode(const uint8_t* data, int width, int64_t num_va
       memcpy(out, data, num_values);
       return;
     case 2:
+#if defined(ARROW_HAVE_AVX512)
+      return ByteStreamSplitDecodeAvx512<2>(data, width, num_values, stride, out);
+#else
       return ByteStreamSplitDecodeScalar<2>(data, width, num_values, stride, out);
+#endif
     case 4:
       return ByteStreamSplitDecodePerhapsSimd<4>(data, width, num_values, stride, out);
     case 8:
@@ -150,6 +150,11 @@ class TestByteStreamSplitSpecialized : public ::testing::Test {
 #endif
     }
 #endif  // defined(ARROW_HAVE_SIMD_SPLIT)
+#if defined(ARROW_HAVE_AVX512)
+    if constexpr (kWidth == 2 || kWidth == 4 || kWidth == 8) {
+      funcs.push_back({"avx512", &ByteStreamSplitDecodeAvx512<kWidth>});
+    }
+#endif
     return funcs;
   }
 
@@ -168,6 +173,11 @@ class TestByteStreamSplitSpecialized : public ::testing::Test {
 #endif
     }
 #endif  // defined(ARROW_HAVE_SIMD_SPLIT)
+#if defined(ARROW_HAVE_AVX512)
+    if constexpr (kWidth == 2 || kWidth == 4 || kWidth == 8) {
+      funcs.push_back({"avx512", &ByteStreamSplitEncodeAvx512<kWidth>});
+    }
+#endif
     return funcs;
   }
 
@@ -0,0 +1,186 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "arrow/util/endian.h"
+#include "arrow/util/simd.h"
+#include "arrow/util/ubsan.h"
+
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+#define ARROW_HAVE_SIMD_BYTE_SWAP
+#endif
+
+namespace arrow::util::internal {
+
+//
+// SIMD implementations
+//
+
+#ifdef ARROW_HAVE_SIMD_BYTE_SWAP
+// Shuffle the bytes of each 16-byte block with `pattern`, such that
+// out[i] = in[pattern[i]].  The pattern may only move bytes within values of
+// `value_width` bytes, which must divide 16: the trailing values which don't fill
+// a block are shuffled with the beginning of the pattern.
+inline void ShuffleBytes(const uint8_t* in, int64_t num_values, int value_width,
+                         const uint8_t (&pattern)[16], uint8_t* out) {
+  const int64_t size = num_values * value_width;
+  int64_t offset = 0;
+#if defined(ARROW_HAVE_AVX2)
+  const __m256i mask256 = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern)));
+  for (; offset + 32 <= size; offset += 32) {
+    const __m256i values =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + offset));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + offset),
+                        _mm256_shuffle_epi8(values, mask256));
+  }
+#endif
+#if defined(ARROW_HAVE_SSE4_2)
+  const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern));
+  for (; offset + 16 <= size; offset += 16) {
+    const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + offset));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + offset),
+                     _mm_shuffle_epi8(values, mask));
+  }
+#elif defined(ARROW_HAVE_NEON)
+  const uint8x16_t mask = vld1q_u8(pattern);
+  for (; offset + 16 <= size; offset += 16) {
+    vst1q_u8(out + offset, vqtbl1q_u8(vld1q_u8(in + offset), mask));
+  }
+#endif
+  // Copy the suffix first, as `in` and `out` may be the same
+  const int64_t suffix_size = size - offset;
+  if (suffix_size > 0) {
+    uint8_t suffix[16];
+    memcpy(suffix, in + offset, static_cast<size_t>(suffix_size));
+    for (int64_t i = 0; i < suffix_size; ++i) {
+      out[offset + i] = suffix[pattern[i]];
+    }
+  }
+}
+
+// Reverse the bytes of each 32-byte value
+inline void ByteSwapValues32Simd(const uint8_t* in, int64_t num_values, uint8_t* out) {
+  constexpr uint8_t kReverse[16] = {15, 14, 13, 12, 11, 10, 9, 8,
+                                    7,  6,  5,  4,  3,  2,  1, 0};
+  int64_t i = 0;
+#if defined(ARROW_HAVE_AVX2)
+  const __m256i mask256 = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(kReverse)));
+  for (; i < num_values; ++i) {
+    const __m256i value =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i * 32));
+    // Reverse each 16-byte lane, then swap the lanes
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(out + i * 32),
+        _mm256_permute4x64_epi64(_mm256_shuffle_epi8(value, mask256), 0x4E));
+  }
+#elif defined(ARROW_HAVE_SSE4_2)
+  const __m128i mask = _mm_loadu_si128(reinterpret_cast<const __m128i*>(kReverse));
+  for (; i < num_values; ++i) {
+    const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 32));
+    const __m128i high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i * 32 + 16));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 32),
+                     _mm_shuffle_epi8(high, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i * 32 + 16),
+                     _mm_shuffle_epi8(low, mask));
+  }
+#elif defined(ARROW_HAVE_NEON)
+  const uint8x16_t mask = vld1q_u8(kReverse);
+  for (; i < num_values; ++i) {
+    const uint8x16_t low = vld1q_u8(in + i * 32);
+    const uint8x16_t high = vld1q_u8(in + i * 32 + 16);
+    vst1q_u8(out + i * 32, vqtbl1q_u8(high, mask));
+    vst1q_u8(out + i * 32 + 16, vqtbl1q_u8(low, mask));
+  }
+#endif
+}
+#endif  // ARROW_HAVE_SIMD_BYTE_SWAP
+
+//
+// Scalar implementations
+//
+
+template <int kWidth>
+void ByteSwapValuesScalar(const uint8_t* in, int64_t num_values, uint8_t* out) {
+  for (int64_t i = 0; i < num_values; ++i) {
+    if constexpr (kWidth == 2 || kWidth == 4 || kWidth == 8) {
+      using UInt = std::conditional_t<
+          kWidth == 2, uint16_t, std::conditional_t<kWidth == 4, uint32_t, uint64_t>>;
+      SafeStore(out + i * kWidth,
+                bit_util::ByteSwap(SafeLoadAs<UInt>(in + i * kWidth)));
+    } else {
+      uint8_t value[kWidth];
+      memcpy(value, in + i * kWidth, kWidth);
+      std::reverse_copy(value, value + kWidth, out + i * kWidth);
+    }
+  }
+}
+
+//
+// Dispatch
+//
+
+/// \brief Reverse the bytes of each value of `kWidth` bytes
+///
+/// `in` and `out` may be the same, to swap the values in place, but may not
+/// overlap otherwise.
+template <int kWidth>
+void ByteSwapValues(const uint8_t* in, int64_t num_values, uint8_t* out) {
+  static_assert(kWidth == 2 || kWidth == 4 || kWidth == 8 || kWidth == 16 ||
+                    kWidth == 32,
+                "Unsupported value width");
+#ifdef ARROW_HAVE_SIMD_BYTE_SWAP
+  if constexpr (kWidth == 32) {
+    return ByteSwapValues32Simd(in, num_values, out);
+  } else {
+    uint8_t pattern[16];
+    for (int i = 0; i < 16; ++i) {
+      pattern[i] = static_cast<uint8_t>(i - i % kWidth + kWidth - 1 - i % kWidth);
+    }
+    return ShuffleBytes(in, num_values, kWidth, pattern, out);
+  }
+#else
+  return ByteSwapValuesScalar<kWidth>(in, num_values, out);
+#endif
+}
+
+/// \brief Swap the bytes of each MonthDayNanos value: its two 32-bit fields
+/// and its 64-bit field
+///
+/// `in` and `out` may be the same, to swap the values in place, but may not
+/// overlap otherwise.
+inline void ByteSwapMonthDayNanos(const uint8_t* in, int64_t num_values, uint8_t* out) {
+#ifdef ARROW_HAVE_SIMD_BYTE_SWAP
+  constexpr uint8_t kPattern[16] = {3, 2, 1, 0, 7, 6, 5, 4, 15, 14, 13, 12, 11, 10, 9, 8};
+  return ShuffleBytes(in, num_values, 16, kPattern, out);
+#else
+  for (int64_t i = 0; i < num_values; ++i) {
+    ByteSwapValuesScalar<4>(in + i * 16, 2, out + i * 16);
+    ByteSwapValuesScalar<8>(in + i * 16 + 8, 1, out + i * 16 + 8);
+  }
+#endif
+}
+
+}  // namespace arrow::util::internal
@@ -200,11 +200,14 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
       codec = internal::MakeLz4HadoopRawCodec();
 #endif
       break;
-    case Compression::ZSTD:
+    case Compression::ZSTD: {
 #ifdef ARROW_WITH_ZSTD
-      codec = internal::MakeZSTDCodec(compression_level);
+      auto opt = dynamic_cast<const ZstdCodecOptions*>(&codec_options);
+      codec = internal::MakeZSTDCodec(compression_level,
+                                      opt ? opt->dictionary : nullptr);
 #endif
       break;
+    }
     case Compression::BZ2:
 #ifdef ARROW_WITH_BZ2
       codec = internal::MakeBZ2Codec(compression_level);
@@ -219,6 +222,24 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
   return std::move(codec);
 }
 
+Result<std::shared_ptr<ZstdDictionary>> ZstdDictionary::Make(
+    std::shared_ptr<Buffer> content) {
+#ifdef ARROW_WITH_ZSTD
+  return internal::MakeZSTDDictionary(std::move(content));
+#else
+  return Status::NotImplemented("Support for codec 'zstd' not built");
+#endif
+}
+
+Result<std::shared_ptr<ZstdDictionary>> ZstdDictionary::Train(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_size) {
+#ifdef ARROW_WITH_ZSTD
+  return internal::TrainZSTDDictionary(samples, max_size);
+#else
+  return Status::NotImplemented("Support for codec 'zstd' not built");
+#endif
+}
+
 // use compression level to create Codec
 Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
                                              int compression_level) {
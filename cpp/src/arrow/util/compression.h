@@ -22,6 +22,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -29,6 +31,9 @@
 #include "arrow/util/visibility.h"
 
 namespace arrow {
+
+class Buffer;
+
 namespace util {
 
 constexpr int kUseDefaultCompressionLevel = std::numeric_limits<int>::min();
@@ -142,6 +147,49 @@ class ARROW_EXPORT BrotliCodecOptions : public CodecOptions {
   std::optional<int> window_bits;
 };
 
+// ----------------------------------------------------------------------
+// ZSTD codec options implementation
+
+/// \brief A ZSTD dictionary, digested once to be shared by many codecs
+///
+/// Small buffers compress poorly as each one starts with no history.  A dictionary
+/// trained from samples of similar buffers provides that history.  The buffers
+/// must be decompressed with the same dictionary; the ID of the dictionary is
+/// recorded in the compressed frames, and decompression fails if it does not
+/// match.
+class ARROW_EXPORT ZstdDictionary {
+ public:
+  virtual ~ZstdDictionary() = default;
+
+  /// \brief Digest a dictionary, either trained or raw content
+  static Result<std::shared_ptr<ZstdDictionary>> Make(std::shared_ptr<Buffer> content);
+
+  /// \brief Train a dictionary of at most `max_size` bytes from sample buffers
+  ///
+  /// A hundred or more samples, totalling about 100 times `max_size`, are
+  /// recommended.
+  static Result<std::shared_ptr<ZstdDictionary>> Train(
+      const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_size);
+
+  const std::shared_ptr<Buffer>& content() const { return content_; }
+
+  /// \brief The ID of the dictionary, or 0 for raw content
+  uint32_t id() const { return id_; }
+
+ protected:
+  ZstdDictionary(std::shared_ptr<Buffer> content, uint32_t id)
+      : content_(std::move(content)), id_(id) {}
+
+  std::shared_ptr<Buffer> content_;
+  uint32_t id_;
+};
+
+class ARROW_EXPORT ZstdCodecOptions : public CodecOptions {
+ public:
+  /// The dictionary to compress and decompress with, if any
+  std::shared_ptr<ZstdDictionary> dictionary;
+};
+
 /// \brief Compression codec
 class ARROW_EXPORT Codec {
  public:
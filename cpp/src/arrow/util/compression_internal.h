@@ -74,7 +74,14 @@ std::unique_ptr<Codec> MakeLz4HadoopRawCodec();
 constexpr int kZSTDDefaultCompressionLevel = 1;
 
 std::unique_ptr<Codec> MakeZSTDCodec(
-    int compression_level = kZSTDDefaultCompressionLevel);
+    int compression_level = kZSTDDefaultCompressionLevel,
+    std::shared_ptr<ZstdDictionary> dictionary = NULLPTR);
+
+Result<std::shared_ptr<ZstdDictionary>> MakeZSTDDictionary(
+    std::shared_ptr<Buffer> content);
+
+Result<std::shared_ptr<ZstdDictionary>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_size);
 
 }  // namespace internal
 }  // namespace util
@@ -26,6 +26,7 @@
 
 #include <gtest/gtest.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
@@ -736,6 +737,71 @@ INSTANTIATE_TEST_SUITE_P(TestBZ2, CodecTest, ::testing::Values(Compression::BZ2)
 
 #ifdef ARROW_WITH_ZSTD
 INSTANTIATE_TEST_SUITE_P(TestZSTD, CodecTest, ::testing::Values(Compression::ZSTD));
+
+std::vector<std::shared_ptr<Buffer>> MakeDictionarySamples(int num_samples) {
+  std::vector<std::shared_ptr<Buffer>> samples;
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int> dist(0, 1000000);
+  for (int i = 0; i < num_samples; ++i) {
+    std::string sample = "{\"id\": " + std::to_string(dist(gen)) +
+                         ", \"name\": \"user" + std::to_string(dist(gen)) +
+                         "\", \"status\": \"active\", \"score\": " +
+                         std::to_string(dist(gen)) + "}";
+    samples.push_back(Buffer::FromString(std::move(sample)));
+  }
+  return samples;
+}
+
+TEST(TestCodecZSTD, Dictionary) {
+  auto samples = MakeDictionarySamples(1000);
+  ASSERT_OK_AND_ASSIGN(auto dictionary, ZstdDictionary::Train(samples, 4096));
+  ASSERT_NE(dictionary->id(), 0U);
+  ASSERT_LE(dictionary->content()->size(), 4096);
+
+  ZstdCodecOptions codec_options;
+  codec_options.dictionary = dictionary;
+  ASSERT_OK_AND_ASSIGN(auto c1, Codec::Create(Compression::ZSTD, codec_options));
+  ASSERT_OK_AND_ASSIGN(auto c2, Codec::Create(Compression::ZSTD, codec_options));
+  ASSERT_OK_AND_ASSIGN(auto plain, Codec::Create(Compression::ZSTD));
+
+  const auto& sample = samples[0];
+  std::vector<uint8_t> data(sample->data(), sample->data() + sample->size());
+  CheckCodecRoundtrip(c1, c2, data);
+  CheckStreamingRoundtrip(c1.get(), data);
+  CheckStreamingRoundtrip(c1.get(), MakeRandomData(10000));
+
+  // The dictionary makes small buffers much smaller
+  std::vector<uint8_t> compressed(c1->MaxCompressedLen(data.size(), data.data()));
+  ASSERT_OK_AND_ASSIGN(auto with_dictionary,
+                       c1->Compress(data.size(), data.data(), compressed.size(),
+                                    compressed.data()));
+  std::vector<uint8_t> compressed_plain(
+      plain->MaxCompressedLen(data.size(), data.data()));
+  ASSERT_OK_AND_ASSIGN(auto without_dictionary,
+                       plain->Compress(data.size(), data.data(), compressed_plain.size(),
+                                       compressed_plain.data()));
+  ASSERT_LT(with_dictionary, without_dictionary);
+
+  // Decompressing without the dictionary fails
+  std::vector<uint8_t> decompressed(data.size());
+  ASSERT_RAISES(IOError, plain->Decompress(with_dictionary, compressed.data(),
+                                           decompressed.size(), decompressed.data()));
+
+  // A raw content dictionary works as well
+  ASSERT_OK_AND_ASSIGN(auto raw_dictionary, ZstdDictionary::Make(sample));
+  ASSERT_EQ(raw_dictionary->id(), 0U);
+  codec_options.dictionary = raw_dictionary;
+  ASSERT_OK_AND_ASSIGN(c1, Codec::Create(Compression::ZSTD, codec_options));
+  ASSERT_OK_AND_ASSIGN(c2, Codec::Create(Compression::ZSTD, codec_options));
+  CheckCodecRoundtrip(c1, c2, data);
+}
+
+TEST(TestCodecZSTD, DictionaryInvalid) {
+  ASSERT_RAISES(Invalid, ZstdDictionary::Make(std::make_shared<Buffer>("")));
+  ASSERT_RAISES(Invalid, ZstdDictionary::Train(MakeDictionarySamples(10), 0));
+  // Not enough samples
+  ASSERT_RAISES(IOError, ZstdDictionary::Train(MakeDictionarySamples(1), 4096));
+}
 #endif
 
 #ifdef ARROW_WITH_LZ4
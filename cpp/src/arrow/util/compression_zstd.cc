@@ -19,10 +19,17 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include <zdict.h>
 #include <zstd.h>
 
+#include "arrow/buffer.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/logging.h"
@@ -40,12 +47,55 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
   return Status::IOError(prefix_msg, ZSTD_getErrorName(ret));
 }
 
+// ----------------------------------------------------------------------
+// ZSTD dictionary implementation
+
+class ZSTDDictionary : public ZstdDictionary {
+ public:
+  ZSTDDictionary(std::shared_ptr<Buffer> content, ZSTD_DDict* ddict)
+      : ZstdDictionary(content,
+                       ZSTD_getDictID_fromDict(content->data(),
+                                               static_cast<size_t>(content->size()))),
+        ddict_(ddict) {}
+
+  ~ZSTDDictionary() override {
+    ZSTD_freeDDict(ddict_);
+    for (const auto& [_, cdict] : cdicts_) {
+      ZSTD_freeCDict(cdict);
+    }
+  }
+
+  const ZSTD_DDict* ddict() const { return ddict_; }
+
+  // The dictionary digested for compression, which depends on the compression level
+  Result<const ZSTD_CDict*> cdict(int compression_level) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = cdicts_.find(compression_level);
+    if (it != cdicts_.end()) {
+      return it->second;
+    }
+    ZSTD_CDict* cdict = ZSTD_createCDict(
+        content_->data(), static_cast<size_t>(content_->size()), compression_level);
+    if (cdict == nullptr) {
+      return Status::IOError("ZSTD failed to digest dictionary for compression");
+    }
+    cdicts_.emplace(compression_level, cdict);
+    return cdict;
+  }
+
+ private:
+  ZSTD_DDict* ddict_;
+  std::mutex mutex_;
+  std::unordered_map<int, ZSTD_CDict*> cdicts_;
+};
+
 // ----------------------------------------------------------------------
 // ZSTD decompressor implementation
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(std::shared_ptr<ZSTDDictionary> dictionary = nullptr)
+      : stream_(ZSTD_createDStream()), dictionary_(std::move(dictionary)) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
@@ -54,9 +104,14 @@ class ZSTDDecompressor : public Decompressor {
     size_t ret = ZSTD_initDStream(stream_);
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
-    } else {
-      return Status::OK();
     }
+    if (dictionary_) {
+      ret = ZSTD_DCtx_refDDict(stream_, dictionary_->ddict());
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD init failed: ");
+      }
+    }
+    return Status::OK();
   }
 
   Result<DecompressResult> Decompress(int64_t input_len, const uint8_t* input,
@@ -88,6 +143,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  std::shared_ptr<ZSTDDictionary> dictionary_;
   bool finished_;
 };
 
@@ -96,8 +152,11 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  explicit ZSTDCompressor(int compression_level,
+                          std::shared_ptr<ZSTDDictionary> dictionary = nullptr)
+      : stream_(ZSTD_createCStream()),
+        dictionary_(std::move(dictionary)),
+        compression_level_(compression_level) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
@@ -105,9 +164,15 @@ class ZSTDCompressor : public Compressor {
     size_t ret = ZSTD_initCStream(stream_, compression_level_);
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
-    } else {
-      return Status::OK();
     }
+    if (dictionary_) {
+      ARROW_ASSIGN_OR_RAISE(auto cdict, dictionary_->cdict(compression_level_));
+      ret = ZSTD_CCtx_refCDict(stream_, cdict);
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD init failed: ");
+      }
+    }
+    return Status::OK();
   }
 
   Result<CompressResult> Compress(int64_t input_len, const uint8_t* input,
@@ -165,6 +230,7 @@ class ZSTDCompressor : public Compressor {
   ZSTD_CStream* stream_;
 
  private:
+  std::shared_ptr<ZSTDDictionary> dictionary_;
   int compression_level_;
 };
 
@@ -173,10 +239,19 @@ class ZSTDCompressor : public Compressor {
 
 class ZSTDCodec : public Codec {
  public:
-  explicit ZSTDCodec(int compression_level)
+  ZSTDCodec(int compression_level, std::shared_ptr<ZSTDDictionary> dictionary)
       : compression_level_(compression_level == kUseDefaultCompressionLevel
                                ? kZSTDDefaultCompressionLevel
-                               : compression_level) {}
+                               : compression_level),
+        dictionary_(std::move(dictionary)) {}
+
+  Status Init() override {
+    if (dictionary_) {
+      // Digest the dictionary for compression once
+      RETURN_NOT_OK(dictionary_->cdict(compression_level_));
+    }
+    return Status::OK();
+  }
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
@@ -188,8 +263,18 @@ class ZSTDCodec : public Codec {
       output_buffer = &empty_buffer;
     }
 
-    size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len));
+    size_t ret;
+    if (dictionary_) {
+      std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> dctx(ZSTD_createDCtx(),
+                                                                ZSTD_freeDCtx);
+      ret = ZSTD_decompress_usingDDict(dctx.get(), output_buffer,
+                                       static_cast<size_t>(output_buffer_len), input,
+                                       static_cast<size_t>(input_len),
+                                       dictionary_->ddict());
+    } else {
+      ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                            static_cast<size_t>(input_len));
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD decompression failed: ");
     }
@@ -207,8 +292,18 @@ class ZSTDCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len), compression_level_);
+    size_t ret;
+    if (dictionary_) {
+      ARROW_ASSIGN_OR_RAISE(auto cdict, dictionary_->cdict(compression_level_));
+      std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx(ZSTD_createCCtx(),
+                                                                ZSTD_freeCCtx);
+      ret = ZSTD_compress_usingCDict(cctx.get(), output_buffer,
+                                     static_cast<size_t>(output_buffer_len), input,
+                                     static_cast<size_t>(input_len), cdict);
+    } else {
+      ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                          static_cast<size_t>(input_len), compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD compression failed: ");
     }
@@ -216,13 +311,13 @@ class ZSTDCodec : public Codec {
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
-    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_, dictionary_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
-    auto ptr = std::make_shared<ZSTDDecompressor>();
+    auto ptr = std::make_shared<ZSTDDecompressor>(dictionary_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -236,12 +331,60 @@ class ZSTDCodec : public Codec {
 
  private:
   const int compression_level_;
+  std::shared_ptr<ZSTDDictionary> dictionary_;
 };
 
 }  // namespace
 
-std::unique_ptr<Codec> MakeZSTDCodec(int compression_level) {
-  return std::make_unique<ZSTDCodec>(compression_level);
+std::unique_ptr<Codec> MakeZSTDCodec(int compression_level,
+                                     std::shared_ptr<ZstdDictionary> dictionary) {
+  // ZstdDictionary instances can only be created by MakeZSTDDictionary()
+  return std::make_unique<ZSTDCodec>(
+      compression_level, std::static_pointer_cast<ZSTDDictionary>(std::move(dictionary)));
+}
+
+Result<std::shared_ptr<ZstdDictionary>> MakeZSTDDictionary(
+    std::shared_ptr<Buffer> content) {
+  if (content == nullptr || content->size() == 0) {
+    return Status::Invalid("ZSTD dictionary must not be empty");
+  }
+  ZSTD_DDict* ddict =
+      ZSTD_createDDict(content->data(), static_cast<size_t>(content->size()));
+  if (ddict == nullptr) {
+    return Status::IOError("ZSTD failed to digest dictionary for decompression");
+  }
+  return std::make_shared<ZSTDDictionary>(std::move(content), ddict);
+}
+
+Result<std::shared_ptr<ZstdDictionary>> TrainZSTDDictionary(
+    const std::vector<std::shared_ptr<Buffer>>& samples, int64_t max_size) {
+  if (max_size <= 0) {
+    return Status::Invalid("ZSTD dictionary size must be strictly positive");
+  }
+  // ZDICT expects the samples to be contiguous
+  std::vector<size_t> sample_sizes;
+  int64_t total_size = 0;
+  for (const auto& sample : samples) {
+    sample_sizes.push_back(static_cast<size_t>(sample->size()));
+    total_size += sample->size();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto samples_buffer, AllocateBuffer(total_size));
+  int64_t offset = 0;
+  for (const auto& sample : samples) {
+    if (sample->size() > 0) {
+      memcpy(samples_buffer->mutable_data() + offset, sample->data(), sample->size());
+      offset += sample->size();
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(auto dictionary, AllocateResizableBuffer(max_size));
+  size_t ret = ZDICT_trainFromBuffer(
+      dictionary->mutable_data(), static_cast<size_t>(max_size), samples_buffer->data(),
+      sample_sizes.data(), static_cast<unsigned>(sample_sizes.size()));
+  if (ZDICT_isError(ret)) {
+    return Status::IOError("ZSTD dictionary training failed: ", ZDICT_getErrorName(ret));
+  }
+  RETURN_NOT_OK(dictionary->Resize(static_cast<int64_t>(ret)));
+  return MakeZSTDDictionary(std::move(dictionary));
 }
 
 }  // namespace internal
@@ -0,0 +1,282 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/counters.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace util {
+
+namespace {
+
+// The slots of a thread, allocated in chunks on demand so that the chunks
+// never move.  Only the owning thread writes to them, but any thread may read
+// them, hence the (relaxed) atomics.
+constexpr int32_t kSlotsPerChunk = 1024;
+constexpr int32_t kMaxChunks = 64;
+constexpr int32_t kMaxSlots = kSlotsPerChunk * kMaxChunks;
+
+// Histogram slots: the count, the sum, then the buckets
+constexpr int32_t kHistogramSlots = 2 + Histogram::kNumBuckets;
+
+using Chunk = std::array<std::atomic<int64_t>, kSlotsPerChunk>;
+
+struct ThreadSlots {
+  ThreadSlots();
+  ~ThreadSlots();
+
+  void Add(int32_t slot, int64_t value) {
+    std::atomic<int64_t>& v = GetSlot(slot);
+    // Single writer, so no need for an atomic read-modify-write
+    v.store(v.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+  }
+
+  std::atomic<int64_t>& GetSlot(int32_t slot) {
+    Chunk* chunk = chunks[slot / kSlotsPerChunk].load(std::memory_order_relaxed);
+    if (ARROW_PREDICT_FALSE(chunk == nullptr)) {
+      chunk = new Chunk{};
+      chunks[slot / kSlotsPerChunk].store(chunk, std::memory_order_release);
+    }
+    return (*chunk)[slot % kSlotsPerChunk];
+  }
+
+  std::array<std::atomic<Chunk*>, kMaxChunks> chunks{};
+};
+
+ThreadSlots& GetThreadSlots() {
+  static thread_local ThreadSlots slots;
+  return slots;
+}
+
+}  // namespace
+
+class CounterRegistry {
+ public:
+  static CounterRegistry* Get() {
+    // Leaked, so that threads can retire their slots at any time
+    static auto* registry = new CounterRegistry();
+    return registry;
+  }
+
+  Counter* GetCounter(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = counters_.find(name);
+    if (it == counters_.end()) {
+      std::unique_ptr<Counter> counter(new Counter(std::string(name), AllocateSlots(1)));
+      it = counters_.emplace(counter->name(), std::move(counter)).first;
+    }
+    return it->second.get();
+  }
+
+  Histogram* GetHistogram(std::string_view name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = histograms_.find(name);
+    if (it == histograms_.end()) {
+      std::unique_ptr<Histogram> histogram(
+          new Histogram(std::string(name), AllocateSlots(kHistogramSlots)));
+      it = histograms_.emplace(histogram->name(), std::move(histogram)).first;
+    }
+    return it->second.get();
+  }
+
+  void AddThread(ThreadSlots* thread) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    threads_.push_back(thread);
+  }
+
+  // Keep the values of an exiting thread
+  void RetireThread(ThreadSlots* thread) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    AddThreadValues(*thread, &retired_);
+    threads_.erase(std::find(threads_.begin(), threads_.end(), thread));
+  }
+
+  PerformanceCounters Snapshot() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::vector<int64_t> values = CurrentValues();
+    auto value = [&](int32_t slot) { return values[slot] - baseline_[slot]; };
+
+    PerformanceCounters snapshot;
+    snapshot.counters.reserve(counters_.size());
+    for (const auto& [name, counter] : counters_) {
+      snapshot.counters.emplace_back(name, value(counter->slot_));
+    }
+    snapshot.histograms.reserve(histograms_.size());
+    for (const auto& [name, histogram] : histograms_) {
+      HistogramSnapshot h;
+      h.name = name;
+      const int32_t first_slot = histogram->first_slot_;
+      h.count = value(first_slot);
+      h.sum = value(first_slot + 1);
+      for (int i = 0; i < Histogram::kNumBuckets; ++i) {
+        h.buckets[i] = value(first_slot + 2 + i);
+      }
+      snapshot.histograms.push_back(std::move(h));
+    }
+    return snapshot;
+  }
+
+  void Reset() {
+    // The slots are written without synchronization, so they can't be zeroed
+    // from here: remember their current values instead
+    std::lock_guard<std::mutex> lock(mutex_);
+    baseline_ = CurrentValues();
+  }
+
+ private:
+  CounterRegistry() = default;
+
+  int32_t AllocateSlots(int32_t num_slots) {
+    ARROW_CHECK_LE(num_slots_ + num_slots, kMaxSlots)
+        << "Too many performance counters";
+    const int32_t first_slot = num_slots_;
+    num_slots_ += num_slots;
+    retired_.resize(num_slots_, 0);
+    baseline_.resize(num_slots_, 0);
+    return first_slot;
+  }
+
+  std::vector<int64_t> CurrentValues() const {
+    std::vector<int64_t> values = retired_;
+    for (const ThreadSlots* thread : threads_) {
+      AddThreadValues(*thread, &values);
+    }
+    return values;
+  }
+
+  static void AddThreadValues(const ThreadSlots& thread, std::vector<int64_t>* values) {
+    const auto num_slots = static_cast<int32_t>(values->size());
+    for (int32_t c = 0; c * kSlotsPerChunk < num_slots; ++c) {
+      const Chunk* chunk = thread.chunks[c].load(std::memory_order_acquire);
+      if (chunk == nullptr) {
+        continue;
+      }
+      const int32_t end = std::min(kSlotsPerChunk, num_slots - c * kSlotsPerChunk);
+      for (int32_t i = 0; i < end; ++i) {
+        (*values)[c * kSlotsPerChunk + i] += (*chunk)[i].load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  // std::less<> allows lookups by string_view
+  std::map<std::string, std::unique_ptr<Counter>, std::less<>> counters_;
+  std::map<std::string, std::unique_ptr<Histogram>, std::less<>> histograms_;
+  int32_t num_slots_ = 0;
+  std::vector<ThreadSlots*> threads_;
+  // The values of the exited threads
+  std::vector<int64_t> retired_;
+  // The values at the last Reset()
+  std::vector<int64_t> baseline_;
+};
+
+namespace {
+
+ThreadSlots::ThreadSlots() { CounterRegistry::Get()->AddThread(this); }
+
+ThreadSlots::~ThreadSlots() {
+  CounterRegistry::Get()->RetireThread(this);
+  for (auto& chunk : chunks) {
+    delete chunk.load(std::memory_order_relaxed);
+  }
+}
+
+}  // namespace
+
+void Counter::Add(int64_t value) { GetThreadSlots().Add(slot_, value); }
+
+void Histogram::Record(int64_t value) {
+  value = std::max<int64_t>(value, 0);
+  const int bucket = std::min(bit_util::NumRequiredBits(static_cast<uint64_t>(value)),
+                              kNumBuckets - 1);
+  ThreadSlots& slots = GetThreadSlots();
+  slots.Add(first_slot_, 1);
+  slots.Add(first_slot_ + 1, value);
+  slots.Add(first_slot_ + 2 + bucket, 1);
+}
+
+Counter* GetCounter(std::string_view name) {
+  return CounterRegistry::Get()->GetCounter(name);
+}
+
+Histogram* GetHistogram(std::string_view name) {
+  return CounterRegistry::Get()->GetHistogram(name);
+}
+
+int64_t HistogramSnapshot::Quantile(double q) const {
+  if (count == 0) {
+    return 0;
+  }
+  const auto rank = std::max<int64_t>(
+      static_cast<int64_t>(std::ceil(q * static_cast<double>(count))), 1);
+  int64_t seen = 0;
+  for (int i = 0; i < Histogram::kNumBuckets - 1; ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      return (int64_t{1} << i) - 1;
+    }
+  }
+  return std::numeric_limits<int64_t>::max();
+}
+
+int64_t PerformanceCounters::counter(std::string_view name) const {
+  auto it = std::lower_bound(
+      counters.begin(), counters.end(), name,
+      [](const std::pair<std::string, int64_t>& c, std::string_view n) {
+        return c.first < n;
+      });
+  return (it != counters.end() && it->first == name) ? it->second : 0;
+}
+
+const HistogramSnapshot* PerformanceCounters::histogram(std::string_view name) const {
+  auto it = std::lower_bound(
+      histograms.begin(), histograms.end(), name,
+      [](const HistogramSnapshot& h, std::string_view n) { return h.name < n; });
+  return (it != histograms.end() && it->name == name) ? &*it : nullptr;
+}
+
+std::string PerformanceCounters::ToString() const {
+  std::stringstream ss;
+  for (const auto& [name, value] : counters) {
+    ss << name << ": " << value << "\n";
+  }
+  for (const auto& h : histograms) {
+    ss << h.name << ": count=" << h.count << " mean=" << h.mean()
+       << " p50<=" << h.Quantile(0.5) << " p99<=" << h.Quantile(0.99) << "\n";
+  }
+  return ss.str();
+}
+
+PerformanceCounters GetPerformanceCounters() {
+  return CounterRegistry::Get()->Snapshot();
+}
+
+void ResetPerformanceCounters() { CounterRegistry::Get()->Reset(); }
+
+}  // namespace util
+}  // namespace arrow
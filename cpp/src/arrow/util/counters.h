@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+/// \defgroup performance-counters Always-on performance counters
+///
+/// A process-wide registry of named counters and histograms, such as
+/// "parquet.decode.bytes" or "s3.get.latency".  Unlike tracing spans, they are
+/// cheap enough to be always enabled: each thread records into its own slots
+/// without any synchronization, and the slots of all threads are only summed
+/// when the values are read with GetPerformanceCounters().
+///
+/// Looking up a counter by name takes a lock, so hot paths should do it once,
+/// typically into a function-local static:
+///
+/// \code
+/// static util::Counter* decoded_bytes = util::GetCounter("parquet.decode.bytes");
+/// decoded_bytes->Add(nbytes);
+/// \endcode
+///
+/// @{
+
+/// \brief A monotonic counter
+class ARROW_EXPORT Counter {
+ public:
+  /// \brief Add `value` to the counter
+  void Add(int64_t value = 1);
+
+  const std::string& name() const { return name_; }
+
+ private:
+  friend class CounterRegistry;
+
+  Counter(std::string name, int32_t slot) : name_(std::move(name)), slot_(slot) {}
+
+  std::string name_;
+  int32_t slot_;
+};
+
+/// \brief A histogram of non-negative values, such as sizes or latencies
+///
+/// Bucket 0 counts the values equal to 0 and bucket i > 0 counts the values in
+/// [2^(i-1), 2^i).  By convention, latencies are recorded in microseconds.
+class ARROW_EXPORT Histogram {
+ public:
+  static constexpr int kNumBuckets = 64;
+
+  /// \brief Record `value`; negative values are recorded as 0
+  void Record(int64_t value);
+
+  /// \brief Record a duration, in microseconds
+  template <typename Rep, typename Period>
+  void RecordDuration(std::chrono::duration<Rep, Period> duration) {
+    Record(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+  }
+
+  const std::string& name() const { return name_; }
+
+ private:
+  friend class CounterRegistry;
+
+  Histogram(std::string name, int32_t first_slot)
+      : name_(std::move(name)), first_slot_(first_slot) {}
+
+  std::string name_;
+  // The slots of the count, the sum and the buckets
+  int32_t first_slot_;
+};
+
+/// \brief Return the counter named `name`, creating it if it doesn't exist
+///
+/// The counter lives until the end of the process.
+ARROW_EXPORT Counter* GetCounter(std::string_view name);
+
+/// \brief Return the histogram named `name`, creating it if it doesn't exist
+///
+/// The histogram lives until the end of the process.  Counters and histograms
+/// have separate namespaces.
+ARROW_EXPORT Histogram* GetHistogram(std::string_view name);
+
+struct ARROW_EXPORT HistogramSnapshot {
+  std::string name;
+  /// The number of recorded values
+  int64_t count = 0;
+  /// The sum of the recorded values
+  int64_t sum = 0;
+  std::array<int64_t, Histogram::kNumBuckets> buckets{};
+
+  double mean() const {
+    return count == 0 ? 0 : static_cast<double>(sum) / static_cast<double>(count);
+  }
+
+  /// \brief The upper bound of the bucket holding quantile `q`, or 0 if no
+  /// value was recorded
+  int64_t Quantile(double q) const;
+};
+
+/// \brief The values of all counters and histograms at some point in time
+struct ARROW_EXPORT PerformanceCounters {
+  /// The name and value of each counter, sorted by name
+  std::vector<std::pair<std::string, int64_t>> counters;
+  /// The histograms, sorted by name
+  std::vector<HistogramSnapshot> histograms;
+
+  /// \brief The value of the counter named `name`, or 0 if it doesn't exist
+  int64_t counter(std::string_view name) const;
+
+  /// \brief The histogram named `name`, or null if it doesn't exist
+  const HistogramSnapshot* histogram(std::string_view name) const;
+
+  std::string ToString() const;
+};
+
+/// \brief Aggregate the current values of all counters and histograms
+///
+/// This is not atomic with respect to concurrent recording: values recorded while
+/// the snapshot is taken may or may not be part of it.
+ARROW_EXPORT PerformanceCounters GetPerformanceCounters();
+
+/// \brief Make all counters and histograms restart from 0
+ARROW_EXPORT void ResetPerformanceCounters();
+
+/// \brief Record the lifetime of this object into a histogram, in microseconds
+class ScopedLatency {
+ public:
+  explicit ScopedLatency(Histogram* histogram)
+      : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+  ~ScopedLatency() {
+    histogram_->RecordDuration(std::chrono::steady_clock::now() - start_);
+  }
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScopedLatency);
+
+  Histogram* histogram_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+/// @}
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/counters.h"
+
+namespace arrow {
+namespace util {
+
+TEST(PerformanceCounters, Counter) {
+  Counter* counter = GetCounter("test.counter");
+  ASSERT_EQ(counter, GetCounter("test.counter"));
+  ASSERT_EQ(counter->name(), "test.counter");
+  ASSERT_NE(counter, GetCounter("test.other_counter"));
+
+  ResetPerformanceCounters();
+  ASSERT_EQ(GetPerformanceCounters().counter("test.counter"), 0);
+  counter->Add();
+  counter->Add(41);
+  auto counters = GetPerformanceCounters();
+  ASSERT_EQ(counters.counter("test.counter"), 42);
+  ASSERT_EQ(counters.counter("test.other_counter"), 0);
+  ASSERT_EQ(counters.counter("test.nonexistent"), 0);
+
+  ResetPerformanceCounters();
+  ASSERT_EQ(GetPerformanceCounters().counter("test.counter"), 0);
+  counter->Add(3);
+  ASSERT_EQ(GetPerformanceCounters().counter("test.counter"), 3);
+}
+
+TEST(PerformanceCounters, Threads) {
+  Counter* counter = GetCounter("test.threads");
+  ResetPerformanceCounters();
+  constexpr int kNumThreads = 8;
+  constexpr int kNumIterations = 10000;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&] {
+      for (int j = 0; j < kNumIterations; ++j) {
+        counter->Add();
+      }
+    });
+  }
+  // Reading concurrently with the updates
+  ASSERT_LE(GetPerformanceCounters().counter("test.threads"),
+            kNumThreads * kNumIterations);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // The values of exited threads are kept
+  ASSERT_EQ(GetPerformanceCounters().counter("test.threads"),
+            kNumThreads * kNumIterations);
+}
+
+TEST(PerformanceCounters, Histogram) {
+  Histogram* histogram = GetHistogram("test.histogram");
+  ASSERT_EQ(histogram, GetHistogram("test.histogram"));
+  ResetPerformanceCounters();
+
+  for (int64_t value : {0, 1, 2, 3, 100, -5}) {
+    histogram->Record(value);
+  }
+  auto counters = GetPerformanceCounters();
+  ASSERT_EQ(counters.histogram("test.nonexistent"), nullptr);
+  const HistogramSnapshot* snapshot = counters.histogram("test.histogram");
+  ASSERT_NE(snapshot, nullptr);
+  ASSERT_EQ(snapshot->count, 6);
+  ASSERT_EQ(snapshot->sum, 106);
+  ASSERT_EQ(snapshot->buckets[0], 2);  // 0 and -5
+  ASSERT_EQ(snapshot->buckets[1], 1);  // 1
+  ASSERT_EQ(snapshot->buckets[2], 2);  // 2 and 3
+  ASSERT_EQ(snapshot->buckets[7], 1);  // 100
+  ASSERT_EQ(snapshot->Quantile(0), 0);
+  ASSERT_EQ(snapshot->Quantile(0.5), 1);
+  ASSERT_EQ(snapshot->Quantile(0.6), 3);
+  ASSERT_EQ(snapshot->Quantile(1), 127);
+
+  histogram->RecordDuration(std::chrono::milliseconds(2));
+  counters = GetPerformanceCounters();
+  snapshot = counters.histogram("test.histogram");
+  ASSERT_EQ(snapshot->count, 7);
+  ASSERT_EQ(snapshot->sum, 2106);
+  ASSERT_EQ(snapshot->buckets[11], 1);
+
+  ResetPerformanceCounters();
+  counters = GetPerformanceCounters();
+  snapshot = counters.histogram("test.histogram");
+  ASSERT_EQ(snapshot->count, 0);
+  ASSERT_EQ(snapshot->Quantile(0.5), 0);
+}
+
+TEST(PerformanceCounters, ToString) {
+  GetCounter("test.to_string")->Add(7);
+  GetHistogram("test.to_string")->Record(1);
+  const std::string s = GetPerformanceCounters().ToString();
+  ASSERT_NE(s.find("test.to_string: "), std::string::npos);
+  ASSERT_NE(s.find("test.to_string: count="), std::string::npos);
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -189,6 +189,41 @@ static void BinaryMathOpDivide128(
   state.SetItemsProcessed(state.iterations() * kValueSize);
 }
 
+// Values fitting in 64 bits, as most decimals in practice
+static void BinaryMathOpMultiply128Small(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v1, v2;
+  for (int x = 0; x < kValueSize; x++) {
+    v1.emplace_back(-123456789 - x);
+    v2.emplace_back(1000 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; ++x) {
+      auto multiply = v1[x] * v2[x];
+      benchmark::DoNotOptimize(multiply);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
+static void BinaryMathOpDivide128Small(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v1, v2;
+  for (int x = 0; x < kValueSize; x++) {
+    v1.emplace_back(-123456789012 - x);
+    v2.emplace_back(1000 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; ++x) {
+      auto divide = v1[x] / v2[x];
+      benchmark::DoNotOptimize(divide);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
 static void BinaryMathOpAdd256(benchmark::State& state) {  // NOLINT non-const reference
   std::vector<BasicDecimal256> v1, v2;
   for (uint64_t x = 0; x < kValueSize; x++) {
@@ -239,6 +274,40 @@ static void BinaryMathOpDivide256(
   state.SetItemsProcessed(state.iterations() * kValueSize);
 }
 
+static void BinaryMathOpMultiply256Small(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal256> v1, v2;
+  for (int x = 0; x < kValueSize; x++) {
+    v1.emplace_back(-123456789 - x);
+    v2.emplace_back(1000 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; ++x) {
+      auto multiply = v1[x] * v2[x];
+      benchmark::DoNotOptimize(multiply);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
+static void BinaryMathOpDivide256Small(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal256> v1, v2;
+  for (int x = 0; x < kValueSize; x++) {
+    v1.emplace_back(-123456789012 - x);
+    v2.emplace_back(1000 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; ++x) {
+      auto divide = v1[x] / v2[x];
+      benchmark::DoNotOptimize(divide);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
 static void UnaryOp(benchmark::State& state) {  // NOLINT non-const reference
   std::vector<BasicDecimal128> v;
   for (int x = 0; x < kValueSize; x++) {
@@ -288,9 +357,13 @@ BENCHMARK(ToString);
 BENCHMARK(BinaryMathOpAdd128);
 BENCHMARK(BinaryMathOpMultiply128);
 BENCHMARK(BinaryMathOpDivide128);
+BENCHMARK(BinaryMathOpMultiply128Small);
+BENCHMARK(BinaryMathOpDivide128Small);
 BENCHMARK(BinaryMathOpAdd256);
 BENCHMARK(BinaryMathOpMultiply256);
 BENCHMARK(BinaryMathOpDivide256);
+BENCHMARK(BinaryMathOpMultiply256Small);
+BENCHMARK(BinaryMathOpDivide256Small);
 BENCHMARK(BinaryMathOpAggregate);
 BENCHMARK(BinaryCompareOp);
 BENCHMARK(BinaryCompareOpConstant);
@@ -1462,6 +1462,28 @@ TEST(Decimal128Test, Divide) {
   }
 }
 
+// Operands fitting in 64 bits are computed natively, check around that boundary
+TEST(Decimal128Test, MultiplyDivideInt64Boundaries) {
+  const std::vector<int128_t> values{INT64_MIN, INT64_MIN + 1, -INT32_MAX, -7, -1, 0,
+                                     1, 7, INT32_MAX, INT64_MAX, int128_t(INT64_MAX) + 1};
+  for (auto x : values) {
+    for (auto y : values) {
+      Decimal128 decimal_x = Decimal128FromInt128(x);
+      Decimal128 decimal_y = Decimal128FromInt128(y);
+      EXPECT_EQ(Decimal128FromInt128(x * y), decimal_x * decimal_y)
+          << " x: " << decimal_x << " y: " << decimal_y;
+      if (y == 0) {
+        continue;
+      }
+      ASSERT_OK_AND_ASSIGN(auto result, decimal_x.Divide(decimal_y));
+      EXPECT_EQ(Decimal128FromInt128(x / y), result.first)
+          << " x: " << decimal_x << " y: " << decimal_y;
+      EXPECT_EQ(Decimal128FromInt128(x % y), result.second)
+          << " x: " << decimal_x << " y: " << decimal_y;
+    }
+  }
+}
+
 TEST(Decimal128Test, Rescale) {
   ASSERT_OK_AND_EQ(Decimal128(11100), Decimal128(111).Rescale(0, 2));
   ASSERT_OK_AND_EQ(Decimal128(111), Decimal128(11100).Rescale(2, 0));
@@ -2132,6 +2154,27 @@ TEST(Decimal256Test, Divide) {
   }
 }
 
+TEST(Decimal256Test, MultiplyDivideInt64Boundaries) {
+  const std::vector<int128_t> values{INT64_MIN, INT64_MIN + 1, -INT32_MAX, -7, -1, 0,
+                                     1, 7, INT32_MAX, INT64_MAX, int128_t(INT64_MAX) + 1};
+  for (auto x : values) {
+    for (auto y : values) {
+      Decimal256 decimal_x = Decimal256FromInt128(x);
+      Decimal256 decimal_y = Decimal256FromInt128(y);
+      EXPECT_EQ(Decimal256FromInt128(x * y), decimal_x * decimal_y)
+          << " x: " << decimal_x << " y: " << decimal_y;
+      if (y == 0) {
+        continue;
+      }
+      ASSERT_OK_AND_ASSIGN(auto result, decimal_x.Divide(decimal_y));
+      EXPECT_EQ(Decimal256FromInt128(x / y), result.first)
+          << " x: " << decimal_x << " y: " << decimal_y;
+      EXPECT_EQ(Decimal256FromInt128(x % y), result.second)
+          << " x: " << decimal_x << " y: " << decimal_y;
+    }
+  }
+}
+
 TEST(Decimal256Test, Rescale) {
   ASSERT_OK_AND_EQ(Decimal256(11100), Decimal256(111).Rescale(0, 2));
   ASSERT_OK_AND_EQ(Decimal256(111), Decimal256(11100).Rescale(2, 0));
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 
@@ -130,30 +132,103 @@ class FnOnce<R(A...)> {
   template <typename Fn,
             typename = typename std::enable_if<std::is_convertible<
                 decltype(std::declval<Fn&&>()(std::declval<A>()...)), R>::value>::type>
-  FnOnce(Fn fn) : impl_(new FnImpl<Fn>(std::move(fn))) {  // NOLINT runtime/explicit
+  FnOnce(Fn fn) {  // NOLINT runtime/explicit
+    // Small callables are stored inline, others are boxed
+    if constexpr (kStoredInline<Fn>) {
+      new (&storage_) Fn(std::move(fn));
+      ops_ = &InlineOps<Fn>::kOps;
+    } else {
+      new (&storage_) Fn*(new Fn(std::move(fn)));
+      ops_ = &BoxedOps<Fn>::kOps;
+    }
+  }
+
+  FnOnce(FnOnce&& other) noexcept { MoveFrom(&other); }
+
+  FnOnce& operator=(FnOnce&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(&other);
+    }
+    return *this;
   }
 
-  explicit operator bool() const { return impl_ != NULLPTR; }
+  ~FnOnce() { Reset(); }
+
+  explicit operator bool() const { return ops_ != NULLPTR; }
 
   R operator()(A... a) && {
-    auto bye = std::move(impl_);
-    return bye->invoke(std::forward<A&&>(a)...);
+    // The callable is moved out before being invoked, so that it is
+    // fine for it to destroy this FnOnce.
+    auto ops = ops_;
+    ops_ = NULLPTR;
+    return ops->invoke(&storage_, std::forward<A&&>(a)...);
   }
 
  private:
-  struct Impl {
-    virtual ~Impl() = default;
-    virtual R invoke(A&&... a) = 0;
+  static constexpr size_t kInlineSize = 6 * sizeof(void*);
+
+  template <typename Fn>
+  static constexpr bool kStoredInline =
+      sizeof(Fn) <= kInlineSize && alignof(Fn) <= alignof(void*) &&
+      std::is_nothrow_move_constructible<Fn>::value;
+
+  struct Ops {
+    R (*invoke)(void* storage, A&&... a);
+    // Move the callable from `from` to the uninitialized `to`, and destroy it
+    // in `from`
+    void (*relocate)(void* from, void* to);
+    void (*destroy)(void* storage);
   };
 
   template <typename Fn>
-  struct FnImpl : Impl {
-    explicit FnImpl(Fn fn) : fn_(std::move(fn)) {}
-    R invoke(A&&... a) override { return std::move(fn_)(std::forward<A&&>(a)...); }
-    Fn fn_;
+  struct InlineOps {
+    static R Invoke(void* storage, A&&... a) {
+      Fn* stored = static_cast<Fn*>(storage);
+      Fn fn(std::move(*stored));
+      stored->~Fn();
+      return std::move(fn)(std::forward<A&&>(a)...);
+    }
+    static void Relocate(void* from, void* to) {
+      new (to) Fn(std::move(*static_cast<Fn*>(from)));
+      static_cast<Fn*>(from)->~Fn();
+    }
+    static void Destroy(void* storage) { static_cast<Fn*>(storage)->~Fn(); }
+
+    static constexpr Ops kOps = {Invoke, Relocate, Destroy};
   };
 
-  std::unique_ptr<Impl> impl_;
+  template <typename Fn>
+  struct BoxedOps {
+    static R Invoke(void* storage, A&&... a) {
+      std::unique_ptr<Fn> fn(*static_cast<Fn**>(storage));
+      return std::move(*fn)(std::forward<A&&>(a)...);
+    }
+    static void Relocate(void* from, void* to) {
+      new (to) Fn*(*static_cast<Fn**>(from));
+    }
+    static void Destroy(void* storage) { delete *static_cast<Fn**>(storage); }
+
+    static constexpr Ops kOps = {Invoke, Relocate, Destroy};
+  };
+
+  void MoveFrom(FnOnce* other) {
+    if (other->ops_ != NULLPTR) {
+      other->ops_->relocate(&other->storage_, &storage_);
+      ops_ = other->ops_;
+      other->ops_ = NULLPTR;
+    }
+  }
+
+  void Reset() {
+    if (ops_ != NULLPTR) {
+      ops_->destroy(&storage_);
+      ops_ = NULLPTR;
+    }
+  }
+
+  const Ops* ops_ = NULLPTR;
+  alignas(void*) unsigned char storage_[kInlineSize];
 };
 
 }  // namespace internal
@@ -49,7 +49,6 @@ class ConcreteFutureImpl : public FutureImpl {
 
   void AddCallback(Callback callback, CallbackOptions opts) {
     CheckOptions(opts);
-    std::unique_lock<std::mutex> lock(mutex_);
 #ifdef ARROW_WITH_OPENTELEMETRY
     callback = [func = std::move(callback),
                 active_span = ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()](
@@ -60,9 +59,14 @@ class ConcreteFutureImpl : public FutureImpl {
 #endif
     CallbackRecord callback_record{std::move(callback), opts};
     if (IsFutureFinished(state_)) {
+      // Fast path: no locking once finished
+      RunOrScheduleCallback(this, std::move(callback_record), /*in_add_callback=*/true);
+      return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (AddListenerUnlocked()) {
       lock.unlock();
-      RunOrScheduleCallback(shared_from_this(), std::move(callback_record),
-                            /*in_add_callback=*/true);
+      RunOrScheduleCallback(this, std::move(callback_record), /*in_add_callback=*/true);
     } else {
       callbacks_.push_back(std::move(callback_record));
     }
@@ -71,15 +75,30 @@ class ConcreteFutureImpl : public FutureImpl {
   bool TryAddCallback(const std::function<Callback()>& callback_factory,
                       CallbackOptions opts) {
     CheckOptions(opts);
-    std::unique_lock<std::mutex> lock(mutex_);
     if (IsFutureFinished(state_)) {
       return false;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (AddListenerUnlocked()) {
+      return false;
     } else {
       callbacks_.push_back({callback_factory(), opts});
       return true;
     }
   }
 
+  // Announce that a callback or a waiter is about to be added, and return
+  // whether the future is finished.  The mutex must be held.
+  //
+  // Together with DoMarkFinishedOrFailed(), this forms a Dekker-style handshake
+  // (both sides use sequentially consistent atomics): either the future is seen
+  // as finished here, or the listener is seen by DoMarkFinishedOrFailed(), which
+  // then takes the mutex to run callbacks and notify waiters.
+  bool AddListenerUnlocked() {
+    has_listeners_.store(true);
+    return IsFutureFinished(state_.load());
+  }
+
   static bool ShouldScheduleCallback(const CallbackRecord& callback_record,
                                      bool in_add_callback) {
     switch (callback_record.options.should_schedule) {
@@ -97,12 +116,12 @@ class ConcreteFutureImpl : public FutureImpl {
     }
   }
 
-  static void RunOrScheduleCallback(const std::shared_ptr<FutureImpl>& self,
-                                    CallbackRecord&& callback_record,
+  static void RunOrScheduleCallback(FutureImpl* self, CallbackRecord&& callback_record,
                                     bool in_add_callback) {
     if (ShouldScheduleCallback(callback_record, in_add_callback)) {
       // Need to keep `this` alive until the callback has a chance to be scheduled.
-      auto task = [self, callback = std::move(callback_record.callback)]() mutable {
+      auto task = [self = self->shared_from_this(),
+                   callback = std::move(callback_record.callback)]() mutable {
         return std::move(callback)(*self);
       };
       DCHECK_OK(callback_record.options.executor->Spawn(std::move(task)));
@@ -112,25 +131,30 @@ class ConcreteFutureImpl : public FutureImpl {
   }
 
   void DoMarkFinishedOrFailed(FutureState state) {
+#ifdef ARROW_WITH_OPENTELEMETRY
+    if (this->span_) {
+      util::tracing::Span& span = *span_;
+      END_SPAN(span);
+    }
+#endif
+    FutureState expected = FutureState::PENDING;
+    if (!state_.compare_exchange_strong(expected, state)) {
+      DCHECK(false) << "Future already marked finished";
+      return;
+    }
+    // Fast path: nobody to call back or notify (see AddListenerUnlocked())
+    if (!has_listeners_.load()) return;
+
     std::vector<CallbackRecord> callbacks;
     std::shared_ptr<FutureImpl> self;
     {
       std::unique_lock<std::mutex> lock(mutex_);
-#ifdef ARROW_WITH_OPENTELEMETRY
-      if (this->span_) {
-        util::tracing::Span& span = *span_;
-        END_SPAN(span);
-      }
-#endif
-
-      DCHECK(!IsFutureFinished(state_)) << "Future already marked finished";
       if (!callbacks_.empty()) {
         callbacks = std::move(callbacks_);
         auto self_inner = shared_from_this();
         self = std::move(self_inner);
       }
 
-      state_ = state;
       // We need to notify while holding the lock.  This notify often triggers
       // waiters to delete the future and it is not safe to delete a cv_ while
       // it is performing a notify_all
@@ -145,14 +169,20 @@ class ConcreteFutureImpl : public FutureImpl {
     // In fact, it is important not to hold the locks because the callback
     // may be slow or do its own locking on other resources
     for (auto& callback_record : callbacks) {
-      RunOrScheduleCallback(self, std::move(callback_record), /*in_add_callback=*/false);
+      RunOrScheduleCallback(self.get(), std::move(callback_record),
+                            /*in_add_callback=*/false);
     }
   }
 
   void DoWait() {
 #ifdef ARROW_ENABLE_THREADING
+    if (IsFutureFinished(state_)) {
+      return;
+    }
     std::unique_lock<std::mutex> lock(mutex_);
-
+    if (AddListenerUnlocked()) {
+      return;
+    }
     cv_.wait(lock, [this] { return IsFutureFinished(state_); });
 #else
     auto last_processed_time = std::chrono::steady_clock::now();
@@ -174,8 +204,13 @@ class ConcreteFutureImpl : public FutureImpl {
 
   bool DoWait(double seconds) {
 #ifdef ARROW_ENABLE_THREADING
+    if (IsFutureFinished(state_)) {
+      return true;
+    }
     std::unique_lock<std::mutex> lock(mutex_);
-
+    if (AddListenerUnlocked()) {
+      return true;
+    }
     cv_.wait_for(lock, std::chrono::duration<double>(seconds),
                  [this] { return IsFutureFinished(state_); });
     return IsFutureFinished(state_);
@@ -195,6 +230,8 @@ class ConcreteFutureImpl : public FutureImpl {
 
   std::mutex mutex_;
   std::condition_variable cv_;
+  // Whether callbacks or waiters may have been added
+  std::atomic<bool> has_listeners_{false};
 };
 
 namespace {
@@ -205,14 +242,117 @@ ConcreteFutureImpl* GetConcreteFuture(FutureImpl* future) {
 
 }  // namespace
 
-std::unique_ptr<FutureImpl> FutureImpl::Make() {
-  return std::make_unique<ConcreteFutureImpl>();
+// A thread-local cache of memory blocks for FutureImpls, since async code
+// creates and destroys futures at a high rate.  A block freed by another
+// thread than the one which allocated it simply moves to the other cache.
+class FutureBlockCache {
+ public:
+  static void* Allocate(size_t size) {
+    if (!destroyed_) {
+      FutureBlockCache& cache = Get();
+      if (cache.head_ != nullptr && size == cache.block_size_) {
+        FreeBlock* block = cache.head_;
+        cache.head_ = block->next;
+        --cache.num_blocks_;
+        return block;
+      }
+    }
+    return ::operator new(size);
+  }
+
+  static void Free(void* p, size_t size) {
+    if (!destroyed_) {
+      FutureBlockCache& cache = Get();
+      if (cache.num_blocks_ == 0) {
+        cache.block_size_ = size;
+      }
+      if (size == cache.block_size_ && cache.num_blocks_ < kMaxBlocks) {
+        cache.head_ = new (p) FreeBlock{cache.head_};
+        ++cache.num_blocks_;
+        return;
+      }
+    }
+    ::operator delete(p);
+  }
+
+  ~FutureBlockCache() {
+    while (head_ != nullptr) {
+      FreeBlock* block = head_;
+      head_ = block->next;
+      ::operator delete(block);
+    }
+    // Futures destroyed later in the thread's teardown bypass the cache
+    destroyed_ = true;
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock* next;
+  };
+
+  static constexpr int kMaxBlocks = 256;
+
+  static FutureBlockCache& Get() {
+    static thread_local FutureBlockCache cache;
+    return cache;
+  }
+
+  // Trivially destructible, so that it can be read after the cache is destroyed
+  static thread_local bool destroyed_;
+
+  FreeBlock* head_ = nullptr;
+  size_t block_size_ = 0;
+  int num_blocks_ = 0;
+};
+
+thread_local bool FutureBlockCache::destroyed_ = false;
+
+template <typename T>
+struct FutureBlockAllocator {
+  using value_type = T;
+
+  FutureBlockAllocator() = default;
+  template <typename U>
+  FutureBlockAllocator(const FutureBlockAllocator<U>&) {}  // NOLINT runtime/explicit
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(FutureBlockCache::Allocate(n * sizeof(T)));
+  }
+  void deallocate(T* p, size_t n) { FutureBlockCache::Free(p, n * sizeof(T)); }
+
+  template <typename U>
+  bool operator==(const FutureBlockAllocator<U>&) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const FutureBlockAllocator<U>&) const {
+    return false;
+  }
+};
+
+std::shared_ptr<FutureImpl> FutureImpl::Make() {
+  // Allocate the impl along with the shared_ptr control block
+  return std::allocate_shared<ConcreteFutureImpl>(
+      FutureBlockAllocator<ConcreteFutureImpl>());
+}
+
+std::shared_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
+  auto impl = Make();
+  impl->state_ = state;
+  return impl;
 }
 
-std::unique_ptr<FutureImpl> FutureImpl::MakeFinished(FutureState state) {
-  std::unique_ptr<ConcreteFutureImpl> ptr(new ConcreteFutureImpl());
-  ptr->state_ = state;
-  return std::move(ptr);
+std::shared_ptr<FutureImpl> FutureImpl::FinishedEmpty() {
+  // Intentionally leaked, so that it outlives any Future
+  static const auto* const kImpl = [] {
+    auto impl = new std::shared_ptr<FutureImpl>(MakeFinished(FutureState::SUCCESS));
+    (*impl)->result_ = {new Result<internal::Empty>(internal::Empty{}), [](void* p) {
+                          delete static_cast<Result<internal::Empty>*>(p);
+                        }};
+    return impl;
+  }();
+  // Aliasing constructor without an owner: copies don't touch any refcount
+  return std::shared_ptr<FutureImpl>(std::shared_ptr<FutureImpl>(), kImpl->get());
 }
 
 FutureImpl::FutureImpl() : state_(FutureState::PENDING) {}
@@ -19,8 +19,10 @@
 
 #include <atomic>
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <new>
 #include <optional>
 #include <type_traits>
 #include <utility>
@@ -262,11 +264,20 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
 
   FutureState state() { return state_.load(); }
 
-  static std::unique_ptr<FutureImpl> Make();
-  static std::unique_ptr<FutureImpl> MakeFinished(FutureState state);
+  static std::shared_ptr<FutureImpl> Make();
+  static std::shared_ptr<FutureImpl> MakeFinished(FutureState state);
+  // The impl of successfully finished Future<>s, shared by all of them.
+  // The returned pointer doesn't own it, so that copying it is free.
+  static std::shared_ptr<FutureImpl> FinishedEmpty();
 
 #ifdef ARROW_WITH_OPENTELEMETRY
-  void SetSpan(util::tracing::Span* span) { span_ = span; }
+  void SetSpan(util::tracing::Span* span) {
+    // The span of a finished future would never be ended (and its impl may be
+    // shared, see FinishedEmpty())
+    if (!IsFutureFinished(state_)) {
+      span_ = span;
+    }
+  }
 #endif
 
   // Future API
@@ -286,11 +297,14 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
 
   std::atomic<FutureState> state_{FutureState::PENDING};
 
-  // Type erased storage for arbitrary results
-  // XXX small objects could be stored inline instead of boxed in a pointer
+  // Type erased storage for arbitrary results.  Small results are constructed
+  // in inline_result_ rather than boxed.
   using Storage = std::unique_ptr<void, void (*)(void*)>;
   Storage result_{NULLPTR, NULLPTR};
 
+  static constexpr size_t kInlineResultSize = 48;
+  alignas(std::max_align_t) unsigned char inline_result_[kInlineResultSize];
+
   struct CallbackRecord {
     Callback callback;
     CallbackOptions options;
@@ -612,6 +626,10 @@ class [[nodiscard]] Future {
 
   /// \brief Implicit constructor to create a finished future from a value
   Future(ValueType val) : Future() {  // NOLINT runtime/explicit
+    if constexpr (is_empty) {
+      impl_ = FutureImpl::FinishedEmpty();
+      return;
+    }
     impl_ = FutureImpl::MakeFinished(FutureState::SUCCESS);
     SetResult(std::move(val));
   }
@@ -619,12 +637,7 @@ class [[nodiscard]] Future {
   /// \brief Implicit constructor to create a future from a Result, enabling use
   ///     of macros like ARROW_ASSIGN_OR_RAISE.
   Future(Result<ValueType> res) : Future() {  // NOLINT runtime/explicit
-    if (ARROW_PREDICT_TRUE(res.ok())) {
-      impl_ = FutureImpl::MakeFinished(FutureState::SUCCESS);
-    } else {
-      impl_ = FutureImpl::MakeFinished(FutureState::FAILURE);
-    }
-    SetResult(std::move(res));
+    InitializeFromResult(std::move(res));
   }
 
   /// \brief Implicit constructor to create a future from a Status, enabling use
@@ -634,6 +647,13 @@ class [[nodiscard]] Future {
 
  protected:
   void InitializeFromResult(Result<ValueType> res) {
+    if constexpr (is_empty) {
+      if (ARROW_PREDICT_TRUE(res.ok())) {
+        // No need to allocate an impl
+        impl_ = FutureImpl::FinishedEmpty();
+        return;
+      }
+    }
     if (ARROW_PREDICT_TRUE(res.ok())) {
       impl_ = FutureImpl::MakeFinished(FutureState::SUCCESS);
     } else {
@@ -647,11 +667,24 @@ class [[nodiscard]] Future {
   Result<ValueType>* GetResult() const { return impl_->CastResult<ValueType>(); }
 
   void SetResult(Result<ValueType> res) {
-    impl_->result_ = {new Result<ValueType>(std::move(res)),
-                      [](void* p) { delete static_cast<Result<ValueType>*>(p); }};
+    impl_->result_.reset();
+    if constexpr (sizeof(Result<ValueType>) <= FutureImpl::kInlineResultSize &&
+                  alignof(Result<ValueType>) <= alignof(std::max_align_t)) {
+      impl_->result_ = {new (impl_->inline_result_) Result<ValueType>(std::move(res)),
+                        [](void* p) { static_cast<Result<ValueType>*>(p)->~Result(); }};
+    } else {
+      impl_->result_ = {new Result<ValueType>(std::move(res)),
+                        [](void* p) { delete static_cast<Result<ValueType>*>(p); }};
+    }
   }
 
   void DoMarkFinished(Result<ValueType> res) {
+    if (ARROW_PREDICT_FALSE(IsFutureFinished(impl_->state()))) {
+      // Don't overwrite the result, which may be shared (see FinishedEmpty()),
+      // but let the impl report the error
+      impl_->MarkFinished();
+      return;
+    }
     SetResult(std::move(res));
 
     if (ARROW_PREDICT_TRUE(GetResult()->ok())) {
@@ -682,6 +715,7 @@ class [[nodiscard]] Future {
   FRIEND_TEST(FutureRefTest, ChainRemoved);
   FRIEND_TEST(FutureRefTest, TailRemoved);
   FRIEND_TEST(FutureRefTest, HeadRemoved);
+  FRIEND_TEST(FutureSyncTest, EmptyFinishedShared);
 };
 
 template <typename T>
@@ -701,12 +735,20 @@ inline Future<>::Future(Status s) : Future(internal::Empty::ToResult(std::move(s
 template <typename T>
 class WeakFuture {
  public:
-  explicit WeakFuture(const Future<T>& future) : impl_(future.impl_) {}
+  explicit WeakFuture(const Future<T>& future) : impl_(future.impl_) {
+    if (future.impl_ != NULLPTR && future.impl_.use_count() == 0) {
+      // Shared impl of finished futures, which is never destroyed
+      unowned_impl_ = future.impl_;
+    }
+  }
 
-  Future<T> get() { return Future<T>{impl_.lock()}; }
+  Future<T> get() {
+    return Future<T>{unowned_impl_ ? unowned_impl_ : impl_.lock()};
+  }
 
  private:
   std::weak_ptr<FutureImpl> impl_;
+  std::shared_ptr<FutureImpl> unowned_impl_;
 };
 
 /// \defgroup future-utilities Functions for working with Futures
@@ -18,6 +18,7 @@
 #include "arrow/util/future.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <condition_variable>
 #include <memory>
@@ -290,6 +291,44 @@ TEST(FutureSyncTest, Empty) {
   }
 }
 
+TEST(FutureSyncTest, EmptyFinishedShared) {
+  // Successfully finished Future<>s don't need their own impl
+  auto fut = Future<>::MakeFinished();
+  auto fut2 = Future<>(Status::OK());
+  ASSERT_EQ(fut.impl_.get(), fut2.impl_.get());
+  AssertSuccessful(fut2);
+
+  bool callback_run = false;
+  fut.AddCallback([&](const Status& st) {
+    ASSERT_OK(st);
+    callback_run = true;
+  });
+  ASSERT_TRUE(callback_run);
+  ASSERT_FALSE(fut.TryAddCallback([] { return [](const Status&) {}; }));
+
+  WeakFuture<internal::Empty> weak_fut(fut);
+  fut = fut2 = Future<>::Make();
+  AssertSuccessful(weak_fut.get());
+
+  auto fut3 = Future<>::MakeFinished(Status::IOError("xxx"));
+  ASSERT_NE(fut3.impl_.get(), Future<>::MakeFinished().impl_.get());
+  AssertFailed(fut3);
+}
+
+TEST(FutureSyncTest, LargeResult) {
+  // Results too large to be stored inline in the impl
+  using Large = std::array<int64_t, 32>;
+  Large value;
+  std::iota(value.begin(), value.end(), 0);
+
+  auto fut = Future<Large>::Make();
+  fut.MarkFinished(value);
+  ASSERT_OK_AND_EQ(value, fut.result());
+
+  fut = Future<Large>::MakeFinished(Status::IOError("xxx"));
+  ASSERT_RAISES(IOError, fut.result());
+}
+
 TEST(FutureSyncTest, GetStatusFuture) {
   {
     auto fut = Future<MoveOnlyDataType>::Make();
@@ -1554,6 +1593,41 @@ TEST(FnOnceTest, MoveOnlyDataType) {
   ASSERT_EQ(i1.moves, 0);
 }
 
+TEST(FnOnceTest, Storage) {
+  // Small callables are stored inline, large ones are boxed
+  auto token = std::make_shared<int>(1);
+  std::array<int64_t, 32> large{};
+  large[31] = 2;
+
+  FnOnce<int()> small_fn = [token] { return *token; };
+  FnOnce<int()> large_fn = [token, large] {
+    return *token + static_cast<int>(large[31]);
+  };
+  ASSERT_EQ(token.use_count(), 3);
+
+  // Moving doesn't copy the captures
+  FnOnce<int()> moved_small = std::move(small_fn);
+  FnOnce<int()> moved_large = std::move(large_fn);
+  ASSERT_FALSE(small_fn);
+  ASSERT_FALSE(large_fn);
+  ASSERT_EQ(token.use_count(), 3);
+
+  // Invoking destroys the callable
+  ASSERT_EQ(std::move(moved_small)(), 1);
+  ASSERT_FALSE(moved_small);
+  ASSERT_EQ(token.use_count(), 2);
+  ASSERT_EQ(std::move(moved_large)(), 3);
+  ASSERT_EQ(token.use_count(), 1);
+
+  // So does destroying without invoking
+  {
+    FnOnce<int()> fn = [token] { return *token; };
+    FnOnce<int()> fn2 = [token, large] { return *token + static_cast<int>(large[0]); };
+    ASSERT_EQ(token.use_count(), 3);
+  }
+  ASSERT_EQ(token.use_count(), 1);
+}
+
 TEST(FutureTest, MatcherExamples) {
 #ifndef ARROW_ENABLE_THREADING
   GTEST_SKIP() << "Test requires threading support";
@@ -1087,6 +1087,32 @@ Result<FileDescriptor> FileOpenReadable(const PlatformFilename& file_name) {
   return std::move(fd);
 }
 
+Result<int64_t> FileEnableDirectIO(int fd) {
+#if defined(O_DIRECT)
+  // Conservative alignment, a multiple of the logical block size of common devices
+  constexpr int64_t kDirectIOAlignment = 4096;
+  int flags = fcntl(fd, F_GETFL);
+  if (flags == -1) {
+    return IOErrorFromErrno(errno, "fcntl(fd, F_GETFL) failed");
+  }
+  if (fcntl(fd, F_SETFL, flags | O_DIRECT) == -1) {
+    if (errno == EINVAL) {
+      return Status::NotImplemented("File system does not support O_DIRECT");
+    }
+    return IOErrorFromErrno(errno, "fcntl(fd, F_SETFL, O_DIRECT) failed");
+  }
+  return kDirectIOAlignment;
+#elif defined(F_NOCACHE)
+  if (fcntl(fd, F_NOCACHE, 1) == -1) {
+    return IOErrorFromErrno(errno, "fcntl(fd, F_NOCACHE, 1) failed");
+  }
+  return 0;
+#else
+  ARROW_UNUSED(fd);
+  return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+}
+
 Result<FileDescriptor> FileOpenWritable(const PlatformFilename& file_name,
                                         bool write_only, bool truncate, bool append) {
   FileDescriptor fd;
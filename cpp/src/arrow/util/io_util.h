@@ -161,6 +161,14 @@ class ARROW_EXPORT FileDescriptor {
 ARROW_EXPORT
 Result<FileDescriptor> FileOpenReadable(const PlatformFilename& file_name);
 
+/// Make reads of a file bypass the OS page cache.
+///
+/// Returns the alignment that the offsets, sizes and destination addresses of
+/// reads must then respect, or 0 if they need not be aligned.  Returns
+/// NotImplemented if the platform or the file system does not support it.
+ARROW_EXPORT
+Result<int64_t> FileEnableDirectIO(int fd);
+
 /// Open a file for writing and return a file descriptor.
 ARROW_EXPORT
 Result<FileDescriptor> FileOpenWritable(const PlatformFilename& file_name,
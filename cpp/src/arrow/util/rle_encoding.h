@@ -119,6 +119,11 @@ class RleDecoder {
   template <typename T>
   int GetBatch(T* values, int batch_size);
 
+  /// Like GetBatch but for a bit width of at most 1, writing each value as a bit
+  /// of 'bitmap' starting at bit 'offset'. Returns the number of decoded elements,
+  /// which stops short of batch_size at a repeated value greater than 1.
+  int GetBatchBitmap(uint8_t* bitmap, int64_t offset, int batch_size);
+
   /// Like GetBatch but add spacing for null entries
   template <typename T>
   int GetBatchSpaced(int batch_size, int null_count, const uint8_t* valid_bits,
@@ -333,6 +338,44 @@ inline int RleDecoder::GetBatch(T* values, int batch_size) {
   return values_read;
 }
 
+inline int RleDecoder::GetBatchBitmap(uint8_t* bitmap, int64_t offset, int batch_size) {
+  DCHECK_GE(bit_width_, 0);
+  DCHECK_LE(bit_width_, 1);
+  int values_read = 0;
+
+  while (values_read < batch_size) {
+    int remaining = batch_size - values_read;
+
+    if (repeat_count_ > 0) {  // Repeated value case.
+      if (ARROW_PREDICT_FALSE(current_value_ > 1)) {
+        return values_read;
+      }
+      int repeat_batch = std::min(remaining, repeat_count_);
+      ::arrow::bit_util::SetBitsTo(bitmap, offset + values_read, repeat_batch,
+                                   current_value_ == 1);
+
+      repeat_count_ -= repeat_batch;
+      values_read += repeat_batch;
+    } else if (literal_count_ > 0) {
+      // Bit-packed values of a bit width of 1 are already laid out as a bitmap
+      int literal_batch = std::min(remaining, literal_count_);
+      if (bit_width_ == 0) {
+        ::arrow::bit_util::SetBitsTo(bitmap, offset + values_read, literal_batch,
+                                     false);
+      } else if (!bit_reader_.GetBits(literal_batch, bitmap, offset + values_read)) {
+        return values_read;
+      }
+
+      literal_count_ -= literal_batch;
+      values_read += literal_batch;
+    } else {
+      if (!NextCounts<uint8_t>()) return values_read;
+    }
+  }
+
+  return values_read;
+}
+
 template <typename T, typename RunType, typename Converter>
 inline int RleDecoder::GetSpaced(Converter converter, int batch_size, int null_count,
                                  const uint8_t* valid_bits, int64_t valid_bits_offset,
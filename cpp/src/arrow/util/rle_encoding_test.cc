@@ -493,6 +493,51 @@ TEST(BitRle, Random) {
   }
 }
 
+TEST(RleDecoder, GetBatchBitmap) {
+  // Runs long enough to be repeated, between runs of alternating values that are
+  // bit-packed
+  std::vector<int> values;
+  for (int run_length : {3, 100, 7, 20, 64, 1, 9, 200, 5}) {
+    for (int i = 0; i < run_length; ++i) {
+      values.push_back(run_length % 2);
+    }
+    for (int i = 0; i < run_length; ++i) {
+      values.push_back(i % 2);
+    }
+  }
+  const int num_values = static_cast<int>(values.size());
+
+  std::vector<uint8_t> buffer(4096);
+  RleEncoder encoder(buffer.data(), static_cast<int>(buffer.size()), /*bit_width=*/1);
+  for (int value : values) {
+    ASSERT_TRUE(encoder.Put(value));
+  }
+  const int encoded_length = encoder.Flush();
+
+  // Decode in batches that do not line up with runs nor bytes of the bitmap
+  constexpr int64_t kOffset = 3;
+  constexpr int kBatchSize = 37;
+  std::vector<uint8_t> bitmap(bit_util::BytesForBits(kOffset + num_values + 1), 0xFF);
+  RleDecoder decoder(buffer.data(), encoded_length, /*bit_width=*/1);
+  int num_decoded = 0;
+  while (num_decoded < num_values) {
+    const int batch_size = std::min(kBatchSize, num_values - num_decoded);
+    ASSERT_EQ(decoder.GetBatchBitmap(bitmap.data(), kOffset + num_decoded, batch_size),
+              batch_size);
+    num_decoded += batch_size;
+  }
+  ASSERT_EQ(decoder.GetBatchBitmap(bitmap.data(), kOffset + num_values, 1), 0);
+
+  for (int i = 0; i < num_values; ++i) {
+    ASSERT_EQ(bit_util::GetBit(bitmap.data(), kOffset + i), values[i] == 1) << i;
+  }
+  // The bits around the decoded ones are left alone
+  for (int64_t i = 0; i < kOffset; ++i) {
+    ASSERT_TRUE(bit_util::GetBit(bitmap.data(), i));
+  }
+  ASSERT_TRUE(bit_util::GetBit(bitmap.data(), kOffset + num_values));
+}
+
 // Test a sequence of 1 0's, 2 1's, 3 0's. etc
 // e.g. 011000111100000
 TEST(BitRle, RepeatedPattern) {
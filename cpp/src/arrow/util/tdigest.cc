@@ -18,7 +18,9 @@
 #include "arrow/util/tdigest.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <queue>
@@ -26,7 +28,9 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/math_constants.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace internal {
@@ -127,6 +131,100 @@ class TDigestMerger : private T {
   std::vector<Centroid>* tdigest_;
 };
 
+// batches are sorted and merged by chunks of this many values
+constexpr int64_t kBatchChunkSize = 64 * 1024;
+// below this many values, std::sort is faster than RadixSort
+constexpr int64_t kMinRadixSortSize = 4096;
+
+// scratch space of batch adds, shared by all tdigests of a thread
+struct BatchScratch {
+  static constexpr int kRadixBits = 11;
+  static constexpr int kNumBuckets = 1 << kRadixBits;
+  static constexpr int kNumPasses = (64 + kRadixBits - 1) / kRadixBits;
+
+  std::vector<double> values;
+  std::vector<uint64_t> keys, keys_tmp;
+  std::vector<std::array<uint32_t, kNumBuckets>> histograms{kNumPasses};
+
+  static BatchScratch* Get() {
+    static thread_local BatchScratch scratch;
+    return &scratch;
+  }
+};
+
+// map a double to an integer of the same order: set the sign bit of positive
+// values and invert all the bits of negative ones
+uint64_t ToSortKey(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (bits >> 63) ? ~bits : bits | (uint64_t{1} << 63);
+}
+
+double FromSortKey(uint64_t key) {
+  const uint64_t bits = (key >> 63) ? key & ~(uint64_t{1} << 63) : ~key;
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// LSD radix sort of NAN-free doubles, in place
+void RadixSort(double* values, int64_t length, BatchScratch* scratch) {
+  constexpr int kRadixBits = BatchScratch::kRadixBits;
+  constexpr uint64_t kMask = BatchScratch::kNumBuckets - 1;
+  // chunks are small enough for 32-bit counts
+  DCHECK_LE(length, std::numeric_limits<uint32_t>::max());
+
+  scratch->keys.resize(length);
+  scratch->keys_tmp.resize(length);
+  uint64_t* keys = scratch->keys.data();
+  uint64_t* keys_tmp = scratch->keys_tmp.data();
+  auto& histograms = scratch->histograms;
+  for (auto& histogram : histograms) {
+    histogram.fill(0);
+  }
+
+  // compute the histograms of all passes at once
+  for (int64_t i = 0; i < length; ++i) {
+    const uint64_t key = ToSortKey(values[i]);
+    keys[i] = key;
+    for (int pass = 0; pass < BatchScratch::kNumPasses; ++pass) {
+      ++histograms[pass][(key >> (pass * kRadixBits)) & kMask];
+    }
+  }
+
+  for (int pass = 0; pass < BatchScratch::kNumPasses; ++pass) {
+    const int shift = pass * kRadixBits;
+    auto& histogram = histograms[pass];
+    // skip the passes where all keys have the same digit, which is common for
+    // the high bits of values with a narrow range
+    if (histogram[(keys[0] >> shift) & kMask] == static_cast<uint32_t>(length)) {
+      continue;
+    }
+    uint32_t offset = 0;
+    for (auto& count : histogram) {
+      const uint32_t bucket_count = count;
+      count = offset;
+      offset += bucket_count;
+    }
+    for (int64_t i = 0; i < length; ++i) {
+      keys_tmp[histogram[(keys[i] >> shift) & kMask]++] = keys[i];
+    }
+    std::swap(keys, keys_tmp);
+  }
+
+  for (int64_t i = 0; i < length; ++i) {
+    values[i] = FromSortKey(keys[i]);
+  }
+}
+
+void SortValues(double* values, int64_t length, BatchScratch* scratch) {
+  if (length >= kMinRadixSortSize) {
+    RadixSort(values, length, scratch);
+  } else {
+    std::sort(values, values + length);
+  }
+}
+
 }  // namespace
 
 class TDigest::TDigestImpl {
@@ -241,17 +339,24 @@ class TDigest::TDigestImpl {
 
   // merge input data with current tdigest
   void MergeInput(std::vector<double>& input) {
-    total_weight_ += input.size();
-
     std::sort(input.begin(), input.end());
-    min_ = std::min(min_, input.front());
-    max_ = std::max(max_, input.back());
+    MergeSortedInput(input.data(), static_cast<int64_t>(input.size()));
+    input.resize(0);
+  }
+
+  // merge sorted, non empty input data with current tdigest
+  void MergeSortedInput(const double* input, int64_t input_size) {
+    total_weight_ += input_size;
+
+    min_ = std::min(min_, input[0]);
+    max_ = std::max(max_, input[input_size - 1]);
 
     // pick next minimal centroid from input and tdigest, feed to merger
     merger_.Reset(total_weight_, &tdigests_[1 - current_]);
     const auto& td = tdigests_[current_];
-    uint32_t tdigest_index = 0, input_index = 0;
-    while (tdigest_index < td.size() && input_index < input.size()) {
+    uint32_t tdigest_index = 0;
+    int64_t input_index = 0;
+    while (tdigest_index < td.size() && input_index < input_size) {
       if (td[tdigest_index].mean < input[input_index]) {
         merger_.Add(td[tdigest_index++]);
       } else {
@@ -261,12 +366,11 @@ class TDigest::TDigestImpl {
     while (tdigest_index < td.size()) {
       merger_.Add(td[tdigest_index++]);
     }
-    while (input_index < input.size()) {
+    while (input_index < input_size) {
       merger_.Add(Centroid{input[input_index++], 1});
     }
     merger_.Reset(0, nullptr);
 
-    input.resize(0);
     current_ = 1 - current_;
   }
 
@@ -396,6 +500,41 @@ void TDigest::Merge(const TDigest& other) {
   impl_->Merge({other.impl_.get()});
 }
 
+Status TDigest::Merge(std::vector<TDigest> others, Executor* executor) {
+  // number of tdigests merged by each task
+  constexpr size_t kFanIn = 8;
+
+  // blocking on tasks of the executor running this thread could deadlock
+  if (executor != nullptr && !executor->OwnsThisThread()) {
+    while (others.size() > kFanIn) {
+      // merge each group of tdigests into its first one
+      const size_t num_groups = bit_util::CeilDiv(others.size(), kFanIn);
+      RETURN_NOT_OK(ParallelFor(
+          static_cast<int>(num_groups),
+          [&](int group) {
+            const size_t begin = group * kFanIn;
+            const size_t end = std::min(begin + kFanIn, others.size());
+            std::vector<const TDigestImpl*> impls;
+            impls.reserve(end - begin - 1);
+            for (size_t i = begin + 1; i < end; ++i) {
+              others[i].MergeInput();
+              impls.push_back(others[i].impl_.get());
+            }
+            others[begin].MergeInput();
+            others[begin].impl_->Merge(impls);
+            return Status::OK();
+          },
+          executor));
+      for (size_t group = 1; group < num_groups; ++group) {
+        others[group] = std::move(others[group * kFanIn]);
+      }
+      others.resize(num_groups);
+    }
+  }
+  Merge(others);
+  return Status::OK();
+}
+
 double TDigest::Quantile(double q) const {
   MergeInput();
   return impl_->Quantile(q);
@@ -416,5 +555,63 @@ void TDigest::MergeInput() const {
   }
 }
 
+template <bool kSkipNan, typename T>
+void TDigest::AddBatch(const T* values, int64_t length) {
+  auto is_nan = [](T value) {
+    if constexpr (kSkipNan && std::is_floating_point<T>::value) {
+      return std::isnan(value);
+    } else {
+      return false;
+    }
+  };
+
+  // small batches go through the input buffer
+  if (length < static_cast<int64_t>(input_.capacity())) {
+    for (int64_t i = 0; i < length; ++i) {
+      if (!is_nan(values[i])) {
+        Add(static_cast<double>(values[i]));
+      }
+    }
+    return;
+  }
+
+  // large batches skip it, and are merged in chunks much larger than it
+  BatchScratch* scratch = BatchScratch::Get();
+  for (int64_t chunk_start = 0; chunk_start < length; chunk_start += kBatchChunkSize) {
+    const int64_t chunk_end = std::min(chunk_start + kBatchChunkSize, length);
+    scratch->values.resize(chunk_end - chunk_start);
+    double* chunk = scratch->values.data();
+    int64_t chunk_size = 0;
+    for (int64_t i = chunk_start; i < chunk_end; ++i) {
+      chunk[chunk_size] = static_cast<double>(values[i]);
+      chunk_size += !is_nan(values[i]);
+    }
+    if (chunk_size > 0) {
+      SortValues(chunk, chunk_size, scratch);
+      impl_->MergeSortedInput(chunk, chunk_size);
+    }
+  }
+}
+
+void TDigest::Add(const double* values, int64_t length) {
+  AddBatch</*kSkipNan=*/false>(values, length);
+}
+
+template <typename T>
+void TDigest::NanAdd(const T* values, int64_t length) {
+  AddBatch</*kSkipNan=*/true>(values, length);
+}
+
+template void TDigest::NanAdd(const float*, int64_t);
+template void TDigest::NanAdd(const double*, int64_t);
+template void TDigest::NanAdd(const int8_t*, int64_t);
+template void TDigest::NanAdd(const int16_t*, int64_t);
+template void TDigest::NanAdd(const int32_t*, int64_t);
+template void TDigest::NanAdd(const int64_t*, int64_t);
+template void TDigest::NanAdd(const uint8_t*, int64_t);
+template void TDigest::NanAdd(const uint16_t*, int64_t);
+template void TDigest::NanAdd(const uint32_t*, int64_t);
+template void TDigest::NanAdd(const uint64_t*, int64_t);
+
 }  // namespace internal
 }  // namespace arrow
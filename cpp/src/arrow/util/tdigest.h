@@ -23,6 +23,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -36,6 +37,8 @@ class Status;
 
 namespace internal {
 
+class Executor;
+
 class ARROW_EXPORT TDigest {
  public:
   explicit TDigest(uint32_t delta = 100, uint32_t buffer_size = 500);
@@ -74,10 +77,24 @@ class ARROW_EXPORT TDigest {
     Add(static_cast<double>(value));
   }
 
+  // add a batch of data points, faster than adding them one by one
+  // batches larger than the input buffer are sorted and merged in big chunks
+  // call it only if you are sure no NAN exists in input data
+  void Add(const double* values, int64_t length);
+
+  // add a batch of data points, skipping NAN
+  // instantiated for all C arithmetic types except bool
+  template <typename T>
+  void NanAdd(const T* values, int64_t length);
+
   // merge with other t-digests, called infrequently
   void Merge(const std::vector<TDigest>& others);
   void Merge(const TDigest& other);
 
+  // merge with many other t-digests, reducing them as a tree on `executor`
+  // falls back to a serial merge if `executor` is null or runs the caller
+  Status Merge(std::vector<TDigest> others, Executor* executor);
+
   // calculate quantile
   double Quantile(double q) const;
 
@@ -92,6 +109,9 @@ class ARROW_EXPORT TDigest {
   // merge input data with current tdigest
   void MergeInput() const;
 
+  template <bool kSkipNan, typename T>
+  void AddBatch(const T* values, int64_t length);
+
   // input buffer, size = buffer_size * sizeof(double)
   mutable std::vector<double> input_;
 
@@ -43,7 +43,22 @@ static void BenchmarkTDigest(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * items);
 }
 
+static void BenchmarkTDigestBatch(benchmark::State& state) {
+  const size_t items = state.range(0);
+  std::vector<double> values;
+  random_real(items, 0x11223344, -12345678.0, 12345678.0, &values);
+
+  for (auto _ : state) {
+    arrow::internal::TDigest td(kDelta, kBufferSize);
+    td.Add(values.data(), static_cast<int64_t>(values.size()));
+    auto quantile = td.Quantile(0);
+    benchmark::DoNotOptimize(quantile);
+  }
+  state.SetItemsProcessed(state.iterations() * items);
+}
+
 BENCHMARK(BenchmarkTDigest)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BenchmarkTDigestBatch)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
 
 }  // namespace util
 }  // namespace arrow
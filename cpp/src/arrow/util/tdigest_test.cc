@@ -34,6 +34,7 @@
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/tdigest.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace internal {
@@ -232,6 +233,102 @@ TEST(TDigestTest, MergeNonUniform) {
 #endif
 }
 
+TEST(TDigestTest, BatchAdd) {
+  const std::vector<double> quantiles = {0, 0.01, 0.1, 0.2, 0.5, 0.8, 0.9, 0.99, 1};
+
+  std::vector<double> values;
+  random_real(300000, 0x11223344, -1e6, 1e6, &values);
+  std::vector<double> values_with_nan = values;
+  for (size_t i = 0; i < values_with_nan.size(); i += 1000) {
+    values_with_nan.insert(values_with_nan.begin() + i, NAN);
+  }
+  const std::vector<double> expected = ExactQuantile(values, quantiles);
+
+  auto check = [&](const TDigest& td) {
+    ASSERT_OK(td.Validate());
+    // min and max are exact
+    EXPECT_EQ(td.Quantile(0), expected.front());
+    EXPECT_EQ(td.Quantile(1), expected.back());
+    // values are centered on 0, use a tolerance relative to their range
+    const double tolerance = (expected.back() - expected.front()) * 0.001;
+    for (size_t i = 0; i < quantiles.size(); ++i) {
+      EXPECT_NEAR(td.Quantile(quantiles[i]), expected[i], tolerance) << quantiles[i];
+    }
+  };
+
+  {
+    TDigest td(200);
+    td.Add(values.data(), static_cast<int64_t>(values.size()));
+    check(td);
+  }
+  {
+    TDigest td(200);
+    td.NanAdd(values_with_nan.data(), static_cast<int64_t>(values_with_nan.size()));
+    check(td);
+  }
+  {
+    // mixed with single adds, in batches of various sizes
+    TDigest td(200);
+    size_t pos = 0;
+    for (size_t batch_size : {size_t{1}, size_t{10}, size_t{499}, size_t{500},
+                              size_t{5000}, size_t{200000}}) {
+      td.NanAdd(values_with_nan.data() + pos, static_cast<int64_t>(batch_size));
+      pos += batch_size;
+      td.NanAdd(values_with_nan[pos++]);
+    }
+    td.NanAdd(values_with_nan.data() + pos,
+              static_cast<int64_t>(values_with_nan.size() - pos));
+    check(td);
+  }
+}
+
+TEST(TDigestTest, BatchAddIntegers) {
+  std::vector<int64_t> values(100000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int64_t>(i * 7919 % values.size()) - 50000;
+  }
+
+  TDigest td;
+  td.NanAdd(values.data(), static_cast<int64_t>(values.size()));
+  ASSERT_OK(td.Validate());
+  EXPECT_EQ(td.Quantile(0), -50000);
+  EXPECT_EQ(td.Quantile(1), 49999);
+  EXPECT_NEAR(td.Quantile(0.5), 0, 500);
+}
+
+TEST(TDigestTest, MergeTree) {
+  const std::vector<double> quantiles = {0, 0.01, 0.1, 0.5, 0.9, 0.99, 1};
+  constexpr int kNumTDigests = 100;
+
+  std::vector<double> values_combined;
+  std::vector<TDigest> tds;
+  for (int i = 0; i < kNumTDigests; ++i) {
+    std::vector<double> values;
+    random_real(1000 + i * 10, i, -1e6 + i * 1e4, 1e6, &values);
+    TDigest td(200);
+    td.Add(values.data(), static_cast<int64_t>(values.size()));
+    tds.push_back(std::move(td));
+    values_combined.insert(values_combined.end(), values.begin(), values.end());
+  }
+  const std::vector<double> expected = ExactQuantile(values_combined, quantiles);
+
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(4));
+  TDigest td(200);
+  ASSERT_OK(td.Merge(std::move(tds), pool.get()));
+  ASSERT_OK(td.Validate());
+  EXPECT_EQ(td.Quantile(0), expected.front());
+  EXPECT_EQ(td.Quantile(1), expected.back());
+  const double tolerance = (expected.back() - expected.front()) * 0.001;
+  for (size_t i = 0; i < quantiles.size(); ++i) {
+    EXPECT_NEAR(td.Quantile(quantiles[i]), expected[i], tolerance) << quantiles[i];
+  }
+
+  // serial fallback
+  TDigest td_serial(200);
+  ASSERT_OK(td_serial.Merge(std::vector<TDigest>{}, nullptr));
+  ASSERT_TRUE(td_serial.is_empty());
+}
+
 TEST(TDigestTest, Misc) {
   const size_t size = 100000;
   const double min = -1000, max = 1000;
@@ -18,19 +18,29 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <cstdlib>
 #include <deque>
+#include <fstream>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #include "arrow/util/atfork_internal.h"
 #include "arrow/util/config.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/mutex.h"
+#include "arrow/util/string.h"
 
 #include "arrow/util/tracing_internal.h"
 
@@ -372,6 +382,236 @@ void SerialExecutor::RunLoop() {
 
 #ifdef ARROW_ENABLE_THREADING
 
+namespace {
+
+// A Chase-Lev work-stealing deque of tasks, as described in "Correct and
+// Efficient Work-Stealing for Weak Memory Models" (Le et al., PPoPP 2013).
+//
+// Only the owning worker may call Push() and Pop(), at the bottom end.
+// Other threads may call Steal(), at the top end.
+class WorkStealingDeque {
+ public:
+  WorkStealingDeque() {
+    arrays_.push_back(std::make_unique<Array>(kInitialCapacity));
+    array_.store(arrays_.back().get(), std::memory_order_relaxed);
+  }
+
+  ~WorkStealingDeque() {
+    while (Pop()) {
+    }
+  }
+
+  void Push(std::unique_ptr<Task> task) {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+    const int64_t top = top_.load(std::memory_order_acquire);
+    Array* array = array_.load(std::memory_order_relaxed);
+    if (bottom - top > array->capacity - 1) {
+      array = Grow(array, top, bottom);
+    }
+    array->Put(bottom, task.release());
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  std::unique_ptr<Task> Pop() {
+    const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+    Array* array = array_.load(std::memory_order_relaxed);
+    bottom_.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = top_.load(std::memory_order_relaxed);
+    Task* task = nullptr;
+    if (top <= bottom) {
+      task = array->Get(bottom);
+      if (top == bottom) {
+        // Last task in the deque: race against the thieves for it
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+          task = nullptr;
+        }
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+      }
+    } else {
+      bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return std::unique_ptr<Task>(task);
+  }
+
+  std::unique_ptr<Task> Steal() {
+    while (true) {
+      int64_t top = top_.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      const int64_t bottom = bottom_.load(std::memory_order_acquire);
+      if (top >= bottom) {
+        return nullptr;
+      }
+      Task* task = array_.load(std::memory_order_acquire)->Get(top);
+      if (top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed)) {
+        return std::unique_ptr<Task>(task);
+      }
+    }
+  }
+
+ private:
+  struct Array {
+    explicit Array(int64_t capacity)
+        : capacity(capacity), slots(new std::atomic<Task*>[capacity]) {}
+
+    Task* Get(int64_t i) const {
+      return slots[i & (capacity - 1)].load(std::memory_order_relaxed);
+    }
+    void Put(int64_t i, Task* task) {
+      slots[i & (capacity - 1)].store(task, std::memory_order_relaxed);
+    }
+
+    const int64_t capacity;
+    std::unique_ptr<std::atomic<Task*>[]> slots;
+  };
+
+  Array* Grow(Array* array, int64_t top, int64_t bottom) {
+    auto grown = std::make_unique<Array>(array->capacity * 2);
+    for (int64_t i = top; i < bottom; ++i) {
+      grown->Put(i, array->Get(i));
+    }
+    // Thieves may still be reading from the previous arrays, so they are only
+    // released along with the deque.
+    arrays_.push_back(std::move(grown));
+    array_.store(arrays_.back().get(), std::memory_order_release);
+    return arrays_.back().get();
+  }
+
+  static constexpr int64_t kInitialCapacity = 256;
+
+  std::atomic<int64_t> top_{0};
+  std::atomic<int64_t> bottom_{0};
+  std::atomic<Array*> array_;
+  std::vector<std::unique_ptr<Array>> arrays_;
+};
+
+// The deque of the current thread, if it is a work-stealing worker
+thread_local WorkStealingDeque* current_deque_ = nullptr;
+
+#ifdef __linux__
+
+constexpr int kMaxNumaNodes = 1024;
+
+std::string ReadSysfsLine(const std::string& path) {
+  std::ifstream file(path, std::ios::in);
+  std::string line;
+  std::getline(file, line);
+  return line;
+}
+
+// Parse a sysfs CPU list such as "0-3,8-11"
+std::vector<int> ParseCpuList(const std::string& list) {
+  std::vector<int> cpus;
+  const std::string trimmed = TrimString(list);
+  for (std::string_view range : SplitString(trimmed, ',')) {
+    if (range.empty()) {
+      continue;
+    }
+    const auto dash = range.find('-');
+    const int first = std::atoi(std::string(range.substr(0, dash)).c_str());
+    const int last = dash == std::string_view::npos
+                         ? first
+                         : std::atoi(std::string(range.substr(dash + 1)).c_str());
+    for (int cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+// Return the physical cores of each NUMA node, as lists of hardware threads,
+// restricted to the CPUs the current thread is allowed to run on
+std::vector<std::vector<std::vector<int>>> GetCpuTopology() {
+  cpu_set_t allowed;
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    return {};
+  }
+  std::vector<bool> seen(CPU_SETSIZE, false);
+  const auto is_available = [&](int cpu) {
+    return cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed) && !seen[cpu];
+  };
+
+  std::vector<std::vector<int>> node_cpus;
+  for (int node = 0; node < kMaxNumaNodes; ++node) {
+    const auto list = ReadSysfsLine("/sys/devices/system/node/node" +
+                                    std::to_string(node) + "/cpulist");
+    if (!list.empty()) {
+      node_cpus.push_back(ParseCpuList(list));
+    }
+  }
+  if (node_cpus.empty()) {
+    // No NUMA information: a single node with all CPUs
+    node_cpus.emplace_back();
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      node_cpus.back().push_back(cpu);
+    }
+  }
+
+  std::vector<std::vector<std::vector<int>>> topology;
+  for (const auto& cpus : node_cpus) {
+    std::vector<std::vector<int>> cores;
+    for (const int cpu : cpus) {
+      if (!is_available(cpu)) {
+        continue;
+      }
+      std::vector<int> threads = {cpu};
+      seen[cpu] = true;
+      for (const int sibling : ParseCpuList(
+               ReadSysfsLine("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                             "/topology/thread_siblings_list"))) {
+        if (is_available(sibling)) {
+          threads.push_back(sibling);
+          seen[sibling] = true;
+        }
+      }
+      cores.push_back(std::move(threads));
+    }
+    if (!cores.empty()) {
+      topology.push_back(std::move(cores));
+    }
+  }
+  return topology;
+}
+
+// Return the CPUs to pin successive workers to
+std::vector<int> OrderCpus(CpuAffinity::Policy policy) {
+  const auto topology = GetCpuTopology();
+  std::vector<int> cpus;
+  if (policy == CpuAffinity::kCompact) {
+    for (const auto& cores : topology) {
+      for (const auto& threads : cores) {
+        cpus.insert(cpus.end(), threads.begin(), threads.end());
+      }
+    }
+    return cpus;
+  }
+  DCHECK_EQ(policy, CpuAffinity::kScatter);
+  size_t max_cores = 0, max_threads = 0;
+  for (const auto& cores : topology) {
+    max_cores = std::max(max_cores, cores.size());
+    for (const auto& threads : cores) {
+      max_threads = std::max(max_threads, threads.size());
+    }
+  }
+  for (size_t thread = 0; thread < max_threads; ++thread) {
+    for (size_t core = 0; core < max_cores; ++core) {
+      for (const auto& cores : topology) {
+        if (core < cores.size() && thread < cores[core].size()) {
+          cpus.push_back(cores[core][thread]);
+        }
+      }
+    }
+  }
+  return cpus;
+}
+
+#endif  // __linux__
+
+}  // namespace
+
 struct ThreadPool::State {
   State() = default;
 
@@ -392,11 +632,26 @@ struct ThreadPool::State {
   int desired_capacity_ = 0;
 
   // Total number of tasks that are either queued or running
-  int tasks_queued_or_running_ = 0;
+  // (atomic because work-stealing workers update it without the mutex)
+  std::atomic<int> tasks_queued_or_running_{0};
 
   // Are we shutting down?
-  bool please_shutdown_ = false;
-  bool quick_shutdown_ = false;
+  std::atomic<bool> please_shutdown_{false};
+  std::atomic<bool> quick_shutdown_{false};
+
+  // Work-stealing scheduler: pending_tasks_ is then only the injection queue
+  // for tasks spawned from outside the pool.
+  bool work_stealing_ = false;
+  // The deques of the running workers.  Thieves only access them with the
+  // mutex held, so that a worker can safely unregister its deque.
+  std::vector<WorkStealingDeque*> deques_;
+  size_t next_victim_ = 0;
+  // Number of workers about to wait on cv_
+  std::atomic<int> num_sleepers_{0};
+
+  CpuAffinity cpu_affinity_;
+  // For kCompact and kScatter, the CPUs to pin successive workers to
+  std::vector<int> affinity_cpus_;
 
   std::vector<std::shared_ptr<Resource>> kept_alive_resources_;
 
@@ -410,15 +665,71 @@ struct ThreadPool::State {
     int desired_capacity = desired_capacity_;
     bool please_shutdown = please_shutdown_;
     bool quick_shutdown = quick_shutdown_;
+    bool work_stealing = work_stealing_;
+    CpuAffinity cpu_affinity = std::move(cpu_affinity_);
+    std::vector<int> affinity_cpus = std::move(affinity_cpus_);
     new (this) State;  // force-reinitialize, including synchronization primitives
     desired_capacity_ = desired_capacity;
     please_shutdown_ = please_shutdown;
     quick_shutdown_ = quick_shutdown;
+    work_stealing_ = work_stealing;
+    cpu_affinity_ = std::move(cpu_affinity);
+    affinity_cpus_ = std::move(affinity_cpus);
   }
 
   std::shared_ptr<AtForkHandler> atfork_handler_;
 };
 
+#ifdef __linux__
+// Pin the worker of the given index according to the pool's CPU affinity.
+// The mutex must be held.
+static Status PinWorkerUnlocked(const ThreadPool::State& state, std::thread* worker,
+                                size_t index) {
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  switch (state.cpu_affinity_.policy) {
+    case CpuAffinity::kNone:
+      // The kernel restricts this to the CPUs the process may run on
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        CPU_SET(cpu, &cpus);
+      }
+      break;
+    case CpuAffinity::kExplicit:
+      for (const int cpu : state.cpu_affinity_.cpus) {
+        CPU_SET(cpu, &cpus);
+      }
+      break;
+    default:
+      CPU_SET(state.affinity_cpus_[index % state.affinity_cpus_.size()], &cpus);
+      break;
+  }
+  const int errnum = pthread_setaffinity_np(worker->native_handle(), sizeof(cpus), &cpus);
+  if (errnum != 0) {
+    return IOErrorFromErrno(errnum, "Failed to set the CPU affinity of a worker");
+  }
+  return Status::OK();
+}
+#endif
+
+// Called by a worker thread about to exit, with the mutex held
+static void RetireWorkerUnlocked(ThreadPool::State* state,
+                                 std::list<std::thread>::iterator it) {
+  // We're done.  Move our thread object to the trashcan of finished
+  // workers.  This has two motivations:
+  // 1) the thread object doesn't get destroyed before this function finishes
+  //    (but we could call thread::detach() instead)
+  // 2) we can explicitly join() the trashcan threads to make sure all OS threads
+  //    are exited before the ThreadPool is destroyed.  Otherwise subtle
+  //    timing conditions can lead to false positives with Valgrind.
+  DCHECK_EQ(std::this_thread::get_id(), it->get_id());
+  state->finished_workers_.push_back(std::move(*it));
+  state->workers_.erase(it);
+  if (state->please_shutdown_) {
+    // Notify the function waiting in Shutdown().
+    state->cv_shutdown_.notify_one();
+  }
+}
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
@@ -476,20 +787,118 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   }
   DCHECK_GE(state->tasks_queued_or_running_, 0);
 
-  // We're done.  Move our thread object to the trashcan of finished
-  // workers.  This has two motivations:
-  // 1) the thread object doesn't get destroyed before this function finishes
-  //    (but we could call thread::detach() instead)
-  // 2) we can explicitly join() the trashcan threads to make sure all OS threads
-  //    are exited before the ThreadPool is destroyed.  Otherwise subtle
-  //    timing conditions can lead to false positives with Valgrind.
+  RetireWorkerUnlocked(state.get(), it);
+}
+
+// Run a task spawned on a work-stealing pool, without holding the mutex
+static void RunWorkStealingTask(ThreadPool::State* state, std::unique_ptr<Task> task) {
+  StopToken* stop_token = &task->stop_token;
+  if (!stop_token->IsStopRequested()) {
+    std::move(task->callable)();
+  } else {
+    if (task->stop_callback) {
+      std::move(task->stop_callback)(stop_token->Poll());
+    }
+  }
+  task.reset();  // release resources before notifying
+  if (ARROW_PREDICT_FALSE(--state->tasks_queued_or_running_ == 0)) {
+    std::lock_guard<std::mutex> lock(state->mutex_);
+    state->cv_idle_.notify_all();
+  }
+}
+
+// Steal a task from the other workers' deques.  The mutex must be held.
+static std::unique_ptr<Task> StealTaskUnlocked(ThreadPool::State* state,
+                                               WorkStealingDeque* thief) {
+  const size_t num_deques = state->deques_.size();
+  // Vary the first victim so as to spread the stealing
+  const size_t first = state->next_victim_++;
+  for (size_t i = 0; i < num_deques; ++i) {
+    WorkStealingDeque* victim = state->deques_[(first + i) % num_deques];
+    if (victim != thief) {
+      auto task = victim->Steal();
+      if (task) {
+        return task;
+      }
+    }
+  }
+  return nullptr;
+}
+
+// The worker loop of the work-stealing scheduler.  Tasks spawned by a worker
+// are pushed to its own deque, which it pops without locking.  Once it is empty,
+// the worker takes tasks from the injection queue, then from the other workers.
+static void WorkStealingWorkerLoop(std::shared_ptr<ThreadPool::State> state,
+                                   std::list<std::thread>::iterator it) {
+  WorkStealingDeque deque;
+  current_deque_ = &deque;
+
+  std::unique_lock<std::mutex> lock(state->mutex_);
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
-  state->finished_workers_.push_back(std::move(*it));
-  state->workers_.erase(it);
-  if (state->please_shutdown_) {
-    // Notify the function waiting in Shutdown().
-    state->cv_shutdown_.notify_one();
+  state->deques_.push_back(&deque);
+
+  const auto should_secede = [&]() -> bool {
+    return state->workers_.size() > static_cast<size_t>(state->desired_capacity_);
+  };
+
+  while (true) {
+    lock.unlock();
+    while (!state->quick_shutdown_) {
+      auto task = deque.Pop();
+      if (!task) {
+        break;
+      }
+      RunWorkStealingTask(state.get(), std::move(task));
+    }
+    lock.lock();
+    if (state->quick_shutdown_ || should_secede()) {
+      break;
+    }
+
+    std::unique_ptr<Task> task;
+    if (!state->pending_tasks_.empty()) {
+      task = std::make_unique<Task>(std::move(state->pending_tasks_.front()));
+      state->pending_tasks_.pop_front();
+    } else {
+      task = StealTaskUnlocked(state.get(), &deque);
+    }
+    if (!task) {
+      if (state->please_shutdown_) {
+        break;
+      }
+      // Announce that we are going to sleep before looking at the deques a last
+      // time: a concurrent Spawn() from another worker then either pushes a task
+      // that we can see, or sees us and wakes us up.
+      state->num_sleepers_.fetch_add(1);
+      task = StealTaskUnlocked(state.get(), &deque);
+      if (!task) {
+        state->cv_.wait(lock);
+      }
+      state->num_sleepers_.fetch_sub(1);
+      if (!task) {
+        continue;
+      }
+    }
+    lock.unlock();
+    RunWorkStealingTask(state.get(), std::move(task));
+    lock.lock();
+  }
+
+  // Hand over the tasks left in our deque, if any, to the remaining workers
+  bool handed_over = false;
+  while (auto task = deque.Pop()) {
+    if (!state->quick_shutdown_) {
+      state->pending_tasks_.push_back(std::move(*task));
+      handed_over = true;
+    }
+  }
+  if (handed_over) {
+    state->cv_.notify_all();
   }
+  state->deques_.erase(std::find(state->deques_.begin(), state->deques_.end(), &deque));
+  current_deque_ = nullptr;
+
+  RetireWorkerUnlocked(state.get(), it);
 }
 
 void ThreadPool::WaitForIdle() {
@@ -549,8 +958,13 @@ Status ThreadPool::SetCapacity(int threads) {
 
   state_->desired_capacity_ = threads;
   // See if we need to increase or decrease the number of running threads
-  const int required = std::min(static_cast<int>(state_->pending_tasks_.size()),
-                                threads - static_cast<int>(state_->workers_.size()));
+  // Work-stealing workers are launched eagerly, since tasks spawned by the workers
+  // themselves don't go through the pending queue.
+  const int required =
+      state_->work_stealing_
+          ? threads - static_cast<int>(state_->workers_.size())
+          : std::min(static_cast<int>(state_->pending_tasks_.size()),
+                     threads - static_cast<int>(state_->workers_.size()));
   if (required > 0) {
     // Some tasks are pending, spawn the number of needed threads immediately
     LaunchWorkersUnlocked(required);
@@ -561,6 +975,47 @@ Status ThreadPool::SetCapacity(int threads) {
   return Status::OK();
 }
 
+Status ThreadPool::SetCpuAffinity(const CpuAffinity& affinity) {
+#ifdef __linux__
+  std::vector<int> affinity_cpus;
+  switch (affinity.policy) {
+    case CpuAffinity::kNone:
+      break;
+    case CpuAffinity::kCompact:
+    case CpuAffinity::kScatter:
+      affinity_cpus = OrderCpus(affinity.policy);
+      if (affinity_cpus.empty()) {
+        return Status::IOError("Failed to determine the available CPUs");
+      }
+      break;
+    case CpuAffinity::kExplicit:
+      if (affinity.cpus.empty()) {
+        return Status::Invalid("Explicit CPU affinity requires at least one CPU");
+      }
+      for (const int cpu : affinity.cpus) {
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+          return Status::Invalid("Invalid CPU id: ", cpu);
+        }
+      }
+      break;
+  }
+
+  std::unique_lock<std::mutex> lock(state_->mutex_);
+  state_->cpu_affinity_ = affinity;
+  state_->affinity_cpus_ = std::move(affinity_cpus);
+  size_t index = 0;
+  for (auto& worker : state_->workers_) {
+    RETURN_NOT_OK(PinWorkerUnlocked(*state_, &worker, index++));
+  }
+  return Status::OK();
+#else
+  if (affinity.policy != CpuAffinity::kNone) {
+    return Status::NotImplemented("CPU affinity is only supported on Linux");
+  }
+  return Status::OK();
+#endif
+}
+
 int ThreadPool::GetCapacity() {
   std::unique_lock<std::mutex> lock(state_->mutex_);
   return state_->desired_capacity_;
@@ -615,8 +1070,20 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
     auto it = --(state_->workers_.end());
     *it = std::thread([this, state, it] {
       current_thread_pool_ = this;
-      WorkerLoop(state, it);
+      if (state->work_stealing_) {
+        WorkStealingWorkerLoop(state, it);
+      } else {
+        WorkerLoop(state, it);
+      }
     });
+#ifdef __linux__
+    if (state_->cpu_affinity_.policy != CpuAffinity::kNone) {
+      const auto status = PinWorkerUnlocked(*state_, &*it, state_->workers_.size() - 1);
+      if (!status.ok()) {
+        ARROW_LOG(WARNING) << status.ToString();
+      }
+    }
+#endif
   }
 }
 
@@ -639,6 +1106,9 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
               ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
     task = std::move(wrapper);
 #endif
+    if (state_->work_stealing_ && current_deque_ != nullptr && OwnsThisThread()) {
+      return SpawnLocal(std::move(task), std::move(stop_token), std::move(stop_callback));
+    }
     std::lock_guard<std::mutex> lock(state_->mutex_);
     if (state_->please_shutdown_) {
       return Status::Invalid("operation forbidden during or after shutdown");
@@ -657,6 +1127,25 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
   return Status::OK();
 }
 
+Status ThreadPool::SpawnLocal(FnOnce<void()> task, StopToken stop_token,
+                              StopCallback&& stop_callback) {
+  // Spawned from one of our work-stealing workers: push the task to the worker's
+  // own deque without locking
+  if (state_->please_shutdown_) {
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  state_->tasks_queued_or_running_++;
+  current_deque_->Push(std::make_unique<Task>(
+      Task{std::move(task), std::move(stop_token), std::move(stop_callback)}));
+  // Pairs with the registration of a sleeping worker in WorkStealingWorkerLoop
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (state_->num_sleepers_.load(std::memory_order_relaxed) > 0) {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    state_->cv_.notify_one();
+  }
+  return Status::OK();
+}
+
 void ThreadPool::KeepAlive(std::shared_ptr<Executor::Resource> resource) {
   // Seems unlikely but we might as well guard against concurrent calls to KeepAlive
   std::lock_guard<std::mutex> lk(state_->mutex_);
@@ -664,7 +1153,13 @@ void ThreadPool::KeepAlive(std::shared_ptr<Executor::Resource> resource) {
 }
 
 Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
+  return Make(threads, ThreadPoolScheduler::kFifo);
+}
+
+Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads,
+                                                     ThreadPoolScheduler scheduler) {
   auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  pool->state_->work_stealing_ = scheduler == ThreadPoolScheduler::kWorkStealing;
   RETURN_NOT_OK(pool->SetCapacity(threads));
   return pool;
 }
@@ -763,6 +1258,11 @@ Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads) {
   return pool;
 }
 
+Result<std::shared_ptr<ThreadPool>> ThreadPool::Make(int threads,
+                                                     ThreadPoolScheduler scheduler) {
+  return Make(threads);
+}
+
 Result<std::shared_ptr<ThreadPool>> ThreadPool::MakeEternal(int threads) {
   ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
   // On Windows, the ThreadPool destructor may be called after non-main threads
@@ -802,4 +1302,8 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+Status SetCpuThreadPoolAffinity(const CpuAffinity& affinity) {
+  return internal::GetCpuThreadPool()->SetCpuAffinity(affinity);
+}
+
 }  // namespace arrow
@@ -23,6 +23,7 @@
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -58,6 +59,45 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 /// The current number is returned by GetCpuThreadPoolCapacity().
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+/// \brief A policy pinning the worker threads of a thread pool to CPUs
+///
+/// Pinning workers prevents the OS scheduler from migrating them across cores
+/// and sockets, which destroys cache locality.  Together with NUMA-local
+/// allocations (see MappedMemoryPoolOptions::numa_local), this allows
+/// partitioning a large server into socket-local execution domains.
+///
+/// CPU affinity is only supported on Linux.
+struct ARROW_EXPORT CpuAffinity {
+  enum Policy : int8_t {
+    /// Let the OS scheduler place the workers
+    kNone,
+    /// Pin each worker to its own CPU, filling the hardware threads of a core,
+    /// then the cores of a NUMA node, before moving to the next
+    kCompact,
+    /// Pin each worker to its own CPU, spreading the workers across the NUMA
+    /// nodes, then across the physical cores of each node
+    kScatter,
+    /// Restrict all the workers to an explicit set of CPUs
+    kExplicit,
+  };
+
+  Policy policy = kNone;
+  /// The CPU ids, for kExplicit
+  std::vector<int> cpus;
+
+  static CpuAffinity None() { return {}; }
+  static CpuAffinity Compact() { return {kCompact, {}}; }
+  static CpuAffinity Scatter() { return {kScatter, {}}; }
+  static CpuAffinity Explicit(std::vector<int> cpus) {
+    return {kExplicit, std::move(cpus)};
+  }
+};
+
+/// \brief Set the CPU affinity of the global thread pool
+///
+/// The policy applies to the running workers and to those launched later.
+ARROW_EXPORT Status SetCpuThreadPoolAffinity(const CpuAffinity& affinity);
+
 namespace internal {
 
 // Hints about a task that may be used by an Executor.
@@ -435,11 +475,24 @@ class ARROW_EXPORT SerialExecutor : public Executor {
 #endif  // ARROW_ENABLE_THREADING
 };
 
+/// \brief How a ThreadPool distributes tasks among its workers
+enum class ThreadPoolScheduler : int8_t {
+  /// All tasks go through a single FIFO queue shared by the workers
+  kFifo,
+  /// Tasks spawned from a worker are pushed to that worker's own deque and run
+  /// in LIFO order; idle workers take tasks from a global injection queue (for
+  /// tasks spawned from outside the pool) or steal them from the other workers.
+  kWorkStealing,
+};
+
 #ifdef ARROW_ENABLE_THREADING
 
 /// An Executor implementation spawning tasks in FIFO manner on a fixed-size
 /// pool of worker threads.
 ///
+/// Alternatively, a work-stealing scheduler can be selected at construction
+/// (see ThreadPoolScheduler).  Its workers are then launched eagerly.
+///
 /// Note: Any sort of nested parallelism will deadlock this executor.  Blocking waits are
 /// fine but if one task needs to wait for another task it must be expressed as an
 /// asynchronous continuation.
@@ -447,6 +500,8 @@ class ARROW_EXPORT ThreadPool : public Executor {
  public:
   // Construct a thread pool with the given number of worker threads
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
+  static Result<std::shared_ptr<ThreadPool>> Make(int threads,
+                                                  ThreadPoolScheduler scheduler);
 
   // Like Make(), but takes care that the returned ThreadPool is compatible
   // with destruction late at process exit.
@@ -468,11 +523,17 @@ class ARROW_EXPORT ThreadPool : public Executor {
   //
   // This function always returns immediately.
   // If fewer threads are running than this number, new threads are spawned
-  // on-demand when needed for task execution.
+  // on-demand when needed for task execution (or immediately with the
+  // work-stealing scheduler).
   // If more threads are running than this number, excess threads are reaped
   // as soon as possible.
   Status SetCapacity(int threads);
 
+  // Pin the worker threads to CPUs according to the given policy.
+  //
+  // The policy applies to the running workers and to those launched later.
+  Status SetCpuAffinity(const CpuAffinity& affinity);
+
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
@@ -495,6 +556,7 @@ class ARROW_EXPORT ThreadPool : public Executor {
 
  protected:
   FRIEND_TEST(TestThreadPool, SetCapacity);
+  FRIEND_TEST(TestWorkStealingThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
   ARROW_FRIEND_EXPORT friend ThreadPool* GetCpuThreadPool();
 
@@ -502,6 +564,8 @@ class ARROW_EXPORT ThreadPool : public Executor {
 
   Status SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken,
                    StopCallback&&) override;
+  // Spawn a task from a work-stealing worker onto its own deque
+  Status SpawnLocal(FnOnce<void()> task, StopToken, StopCallback&&);
 
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
@@ -525,6 +589,9 @@ class ARROW_EXPORT ThreadPool : public SerialExecutor {
   ARROW_FRIEND_EXPORT friend ThreadPool* GetCpuThreadPool();
 
   static Result<std::shared_ptr<ThreadPool>> Make(int threads);
+  // The scheduler is ignored when threading is disabled
+  static Result<std::shared_ptr<ThreadPool>> Make(int threads,
+                                                  ThreadPoolScheduler scheduler);
 
   // Like Make(), but takes care that the returned ThreadPool is compatible
   // with destruction late at process exit.
@@ -548,6 +615,9 @@ class ARROW_EXPORT ThreadPool : public SerialExecutor {
   // (inside each other)
   Status SetCapacity(int threads);
 
+  // Without threading, there are no workers to pin
+  Status SetCpuAffinity(const CpuAffinity& affinity) { return Status::OK(); }
+
   static int DefaultCapacity() { return 8; }
 
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
@@ -77,6 +77,7 @@ struct Task {
 static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const reference
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
+  const auto scheduler = static_cast<ThreadPoolScheduler>(state.range(2));
 
   Workload workload(workload_size);
 
@@ -86,7 +87,7 @@ static void ThreadPoolSpawn(benchmark::State& state) {  // NOLINT non-const refe
   for (auto _ : state) {
     state.PauseTiming();
     std::shared_ptr<ThreadPool> pool;
-    pool = *ThreadPool::Make(nthreads);
+    pool = *ThreadPool::Make(nthreads, scheduler);
     state.ResumeTiming();
 
     for (int32_t i = 0; i < nspawns; ++i) {
@@ -123,6 +124,7 @@ static void RunInSerialExecutor(benchmark::State& state) {  // NOLINT non-const
 static void ThreadPoolSubmit(benchmark::State& state) {  // NOLINT non-const reference
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
+  const auto scheduler = static_cast<ThreadPoolScheduler>(state.range(2));
 
   Workload workload(workload_size);
 
@@ -130,7 +132,7 @@ static void ThreadPoolSubmit(benchmark::State& state) {  // NOLINT non-const ref
 
   for (auto _ : state) {
     state.PauseTiming();
-    auto pool = *ThreadPool::Make(nthreads);
+    auto pool = *ThreadPool::Make(nthreads, scheduler);
     std::atomic<int32_t> n_finished{0};
     state.ResumeTiming();
 
@@ -174,9 +176,10 @@ static void SerialTaskGroup(benchmark::State& state) {  // NOLINT non-const refe
 static void ThreadedTaskGroup(benchmark::State& state) {  // NOLINT non-const reference
   const auto nthreads = static_cast<int>(state.range(0));
   const auto workload_size = static_cast<int32_t>(state.range(1));
+  const auto scheduler = static_cast<ThreadPoolScheduler>(state.range(2));
 
   std::shared_ptr<ThreadPool> pool;
-  pool = *ThreadPool::Make(nthreads);
+  pool = *ThreadPool::Make(nthreads, scheduler);
 
   Task task(workload_size);
 
@@ -211,10 +214,13 @@ static void WorkloadCost_Customize(benchmark::internal::Benchmark* b) {
 static void ThreadPoolSpawn_Customize(benchmark::internal::Benchmark* b) {
   for (const int32_t w : kWorkloadSizes) {
     for (const int nthreads : {1, 2, 4, 8}) {
-      b->Args({nthreads, w});
+      for (const auto scheduler :
+           {ThreadPoolScheduler::kFifo, ThreadPoolScheduler::kWorkStealing}) {
+        b->Args({nthreads, w, static_cast<int64_t>(scheduler)});
+      }
     }
   }
-  b->ArgNames({"threads", "task_cost"});
+  b->ArgNames({"threads", "task_cost", "work_stealing"});
   b->UseRealTime();
 }
 
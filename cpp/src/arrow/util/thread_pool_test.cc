@@ -19,6 +19,9 @@
 #include <sys/types.h>
 #include <unistd.h>
 #endif
+#ifdef __linux__
+#include <sched.h>
+#endif
 
 #include <algorithm>
 #include <cstdio>
@@ -746,6 +749,169 @@ TEST_F(TestThreadPool, SetCapacity) {
   ASSERT_EQ(pool->GetCapacity(), 7);
 }
 #endif
+
+#ifdef ARROW_ENABLE_THREADING
+class TestWorkStealingThreadPool : public TestThreadPool {
+ public:
+  std::shared_ptr<ThreadPool> MakeThreadPool(int threads) {
+    return *ThreadPool::Make(threads, ThreadPoolScheduler::kWorkStealing);
+  }
+
+  // Recursively split [begin, end) into tasks spawned from the workers
+  void SpawnRange(ThreadPool* pool, int begin, int end, std::vector<int>* outs) {
+    if (end - begin == 1) {
+      (*outs)[begin] = begin * 2;
+      return;
+    }
+    const int mid = begin + (end - begin) / 2;
+    ASSERT_OK(pool->Spawn([=] { SpawnRange(pool, begin, mid, outs); }));
+    ASSERT_OK(pool->Spawn([=] { SpawnRange(pool, mid, end, outs); }));
+  }
+};
+
+TEST_F(TestWorkStealingThreadPool, Spawn) {
+  auto pool = this->MakeThreadPool(3);
+  SpawnAdds(pool.get(), 7, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawnThreaded) {
+  auto pool = this->MakeThreadPool(30);
+  SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawnSlow) {
+  auto pool = this->MakeThreadPool(30);
+  SpawnAdds(pool.get(), 1000, task_slow_add<int>{/*seconds=*/0.002});
+}
+
+TEST_F(TestWorkStealingThreadPool, SpawnWithStopTokenCancelled) {
+  StopSource stop_source;
+  auto pool = this->MakeThreadPool(3);
+  SpawnAddsAndCancel(pool.get(), 100, task_slow_add<int>{/*seconds=*/0.02}, &stop_source);
+}
+
+TEST_F(TestWorkStealingThreadPool, NestedSpawn) {
+  // Tasks spawned from the workers go to their deques and get stolen
+  for (int threads : {1, 2, 8}) {
+    auto pool = this->MakeThreadPool(threads);
+    const int num_values = 10000;
+    std::vector<int> outs(num_values, -1);
+    ASSERT_OK(pool->Spawn([&] { SpawnRange(pool.get(), 0, num_values, &outs); }));
+    pool->WaitForIdle();
+    ASSERT_EQ(pool->GetNumTasks(), 0);
+    for (int i = 0; i < num_values; ++i) {
+      ASSERT_EQ(outs[i], i * 2);
+    }
+    ASSERT_OK(pool->Shutdown());
+  }
+}
+
+TEST_F(TestWorkStealingThreadPool, OwnsCurrentThread) {
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<int> num_owned{0};
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      ASSERT_OK(pool->Spawn([&] { num_owned += pool->OwnsThisThread(); }));
+      num_owned += pool->OwnsThisThread();
+    }));
+  }
+  pool->WaitForIdle();
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(num_owned.load(), 200);
+}
+
+TEST_F(TestWorkStealingThreadPool, QuickShutdown) {
+  AddTester add_tester(100);
+  {
+    auto pool = this->MakeThreadPool(3);
+    add_tester.SpawnTasks(pool.get(), task_slow_add<int>{/*seconds=*/0.02});
+    ASSERT_OK(pool->Shutdown(false /* wait */));
+    add_tester.CheckNotAllComputed();
+  }
+  add_tester.CheckNotAllComputed();
+}
+
+TEST_F(TestWorkStealingThreadPool, SetCapacity) {
+  auto pool = this->MakeThreadPool(5);
+
+  // Thread spawning is eager
+  ASSERT_EQ(pool->GetCapacity(), 5);
+  ASSERT_EQ(pool->GetActualCapacity(), 5);
+
+  // Downsize while tasks are queued in the workers' deques
+  auto gating_task = GatingTask::Make();
+  ASSERT_OK(pool->Spawn([&] {
+    for (int i = 0; i < 10; ++i) {
+      ASSERT_OK(pool->Spawn(gating_task->Task()));
+    }
+  }));
+  ASSERT_OK(gating_task->WaitForRunning(5));
+  ASSERT_OK(pool->SetCapacity(2));
+  ASSERT_EQ(pool->GetCapacity(), 2);
+  ASSERT_OK(gating_task->Unlock());
+  BusyWait(0.5, [&] { return pool->GetActualCapacity() == 2; });
+  ASSERT_EQ(pool->GetActualCapacity(), 2);
+  pool->WaitForIdle();
+
+  ASSERT_OK(pool->SetCapacity(4));
+  ASSERT_EQ(pool->GetActualCapacity(), 4);
+
+  // Ensure nothing got stuck
+  ASSERT_OK(pool->Shutdown());
+}
+#endif  // ARROW_ENABLE_THREADING
+
+#if defined(ARROW_ENABLE_THREADING) && defined(__linux__)
+// Return the CPUs the current thread may run on
+static std::vector<int> GetThreadCpus() {
+  cpu_set_t cpus;
+  ARROW_CHECK_EQ(sched_getaffinity(0, sizeof(cpus), &cpus), 0);
+  std::vector<int> out;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &cpus)) {
+      out.push_back(cpu);
+    }
+  }
+  return out;
+}
+
+TEST_F(TestThreadPool, CpuAffinity) {
+  auto pool = this->MakeThreadPool(4);
+  ASSERT_RAISES(Invalid, pool->SetCpuAffinity(CpuAffinity::Explicit({})));
+  ASSERT_RAISES(Invalid, pool->SetCpuAffinity(CpuAffinity::Explicit({-1})));
+
+  const auto process_cpus = GetThreadCpus();
+  ASSERT_FALSE(process_cpus.empty());
+  auto check_workers = [&](std::function<void(const std::vector<int>&)> check) {
+    for (int i = 0; i < 16; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(GetThreadCpus));
+      ASSERT_OK_AND_ASSIGN(auto cpus, fut.result());
+      check(cpus);
+    }
+  };
+
+  ASSERT_OK(pool->SetCpuAffinity(CpuAffinity::Explicit({process_cpus.back()})));
+  check_workers([&](const std::vector<int>& cpus) {
+    ASSERT_EQ(cpus, std::vector<int>{process_cpus.back()});
+  });
+
+  for (const auto& affinity : {CpuAffinity::Compact(), CpuAffinity::Scatter()}) {
+    ASSERT_OK(pool->SetCpuAffinity(affinity));
+    check_workers([&](const std::vector<int>& cpus) {
+      ASSERT_EQ(cpus.size(), 1u);
+      ASSERT_NE(std::find(process_cpus.begin(), process_cpus.end(), cpus[0]),
+                process_cpus.end());
+    });
+  }
+
+  ASSERT_OK(pool->SetCpuAffinity(CpuAffinity::None()));
+  check_workers(
+      [&](const std::vector<int>& cpus) { ASSERT_EQ(cpus, process_cpus); });
+
+  ASSERT_OK(pool->Shutdown());
+}
+#endif
+
 // Test Submit() functionality
 
 TEST_F(TestThreadPool, Submit) {
@@ -29,6 +29,8 @@ class FutureWaiter;
 
 class TimestampParser;
 
+struct CpuAffinity;
+
 namespace internal {
 
 class Executor;
@@ -273,6 +273,52 @@ static inline bool ValidateAscii(std::string_view str) {
   return ValidateAscii(data, length);
 }
 
+/// \brief Return the length of the longest prefix of `data` made of ASCII bytes
+static inline int64_t AsciiPrefixLength(const uint8_t* data, int64_t len) {
+  const uint8_t* const start = data;
+#if defined(ARROW_HAVE_NEON) || defined(ARROW_HAVE_SSE4_2)
+  using simd_batch = xsimd::make_sized_batch_t<int8_t, 16>;
+  const simd_batch zero(static_cast<int8_t>(0));
+  while (len >= 16 &&
+         !xsimd::any(simd_batch::load_unaligned(reinterpret_cast<const int8_t*>(data)) <
+                     zero)) {
+    data += 16;
+    len -= 16;
+  }
+#endif
+  while (len >= 8 && (SafeLoadAs<uint64_t>(data) & 0x8080808080808080ULL) == 0) {
+    data += 8;
+    len -= 8;
+  }
+  while (len > 0 && *data < 0x80U) {
+    ++data;
+    --len;
+  }
+  return data - start;
+}
+
+/// \brief Convert the ASCII lowercase letters of `data` to uppercase into `out`,
+/// copying the other bytes unchanged
+///
+/// The loop is branch-free so that compilers vectorize it.  `out` may be `data`.
+static inline void AsciiToUpper(const uint8_t* data, int64_t len, uint8_t* out) {
+  for (int64_t i = 0; i < len; ++i) {
+    const uint8_t c = data[i];
+    out[i] = c - (static_cast<uint8_t>(c - 'a') < 26 ? 0x20 : 0);
+  }
+}
+
+/// \brief Convert the ASCII uppercase letters of `data` to lowercase into `out`,
+/// copying the other bytes unchanged
+///
+/// \see AsciiToUpper
+static inline void AsciiToLower(const uint8_t* data, int64_t len, uint8_t* out) {
+  for (int64_t i = 0; i < len; ++i) {
+    const uint8_t c = data[i];
+    out[i] = c + (static_cast<uint8_t>(c - 'A') < 26 ? 0x20 : 0);
+  }
+}
+
 // size of a valid UTF8 can be determined by looking at leading 4 bits of BYTE1
 // utf8_byte_size_table[0..7] --> pure ascii chars --> 1B length
 // utf8_byte_size_table[8..11] --> internal bytes --> 1B length
@@ -179,6 +179,40 @@ TEST_F(ASCIIValidationTest, AsciiInvalid) {
   }
 }
 
+TEST(AsciiPrefixLength, Basics) {
+  auto prefix_length = [](const std::string& s) {
+    return AsciiPrefixLength(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+  };
+  ASSERT_EQ(prefix_length(""), 0);
+  ASSERT_EQ(prefix_length("abc"), 3);
+  ASSERT_EQ(prefix_length("\xc3\xa9" "abc"), 0);
+  // Exercise the SIMD and word-at-a-time loops
+  for (int length = 0; length < 70; ++length) {
+    std::string s(length, 'x');
+    ASSERT_EQ(prefix_length(s), length);
+    ASSERT_EQ(prefix_length(s + "\x80" + s), length);
+    ASSERT_EQ(prefix_length(s + "\xe2\x82\xac"), length);
+  }
+}
+
+TEST(AsciiToUpperLower, Basics) {
+  std::string s;
+  for (int c = 0; c < 256; ++c) {
+    s.push_back(static_cast<char>(c));
+  }
+  std::string upper(s.size(), '\0'), lower(s.size(), '\0');
+  AsciiToUpper(reinterpret_cast<const uint8_t*>(s.data()), s.size(),
+               reinterpret_cast<uint8_t*>(upper.data()));
+  AsciiToLower(reinterpret_cast<const uint8_t*>(s.data()), s.size(),
+               reinterpret_cast<uint8_t*>(lower.data()));
+  for (int c = 0; c < 256; ++c) {
+    const bool is_lower = c >= 'a' && c <= 'z';
+    const bool is_upper = c >= 'A' && c <= 'Z';
+    ASSERT_EQ(static_cast<uint8_t>(upper[c]), is_lower ? c - 32 : c) << c;
+    ASSERT_EQ(static_cast<uint8_t>(lower[c]), is_upper ? c + 32 : c) << c;
+  }
+}
+
 TEST_F(UTF8ValidationTest, EmptyString) { AssertValidUTF8(""); }
 
 TEST_F(UTF8ValidationTest, OneCharacterValid) {
@@ -19,10 +19,12 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -30,8 +32,10 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/time.h"
 #include "arrow/util/visibility.h"
@@ -184,6 +188,56 @@ struct StringConverter<HalfFloatType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// Parse 8 decimal digits at once using SWAR (SIMD within a register) arithmetic,
+// returning false if any of them is not a digit
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t chunk;
+  std::memcpy(&chunk, s, sizeof(chunk));
+  // The first digit is then in the least significant byte
+  chunk = bit_util::FromLittleEndian(chunk);
+  // A byte is a digit iff neither subtracting '0' nor adding 0x46 ('9' + 0x46 ==
+  // 0x7F) sets its high bit
+  if (ARROW_PREDICT_FALSE((((chunk + 0x4646464646464646ULL) |
+                            (chunk - 0x3030303030303030ULL)) &
+                           0x8080808080808080ULL) != 0)) {
+    return false;
+  }
+  chunk -= 0x3030303030303030ULL;
+  // Combine pairs of digits, then pairs of pairs, then pairs of quadruples
+  chunk = (chunk * 10) + (chunk >> 8);
+  chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+           (((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >>
+          32;
+  *out = static_cast<uint32_t>(chunk);
+  return true;
+}
+
+// Parse a string of 8 or more digits which is short enough not to overflow T,
+// 8 digits at a time
+template <typename T>
+inline bool ParseUnsignedInBlocks(const char* s, size_t length, T* out) {
+  T result = 0;
+  while (length >= 8) {
+    uint32_t block;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &block))) {
+      return false;
+    }
+    result = static_cast<T>(result * 100000000U + block);
+    s += 8;
+    length -= 8;
+  }
+  while (length > 0) {
+    uint8_t digit = ParseDecimalDigit(*s++);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = static_cast<T>(result * 10U + digit);
+    --length;
+  }
+  *out = result;
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -248,6 +302,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  // Up to 9 digits can't overflow
+  if (length >= 8 && length <= 9) {
+    return ParseUnsignedInBlocks(s, length, out);
+  }
   uint32_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -268,6 +326,10 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 }
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  // Up to 19 digits can't overflow
+  if (length >= 8 && length <= 19) {
+    return ParseUnsignedInBlocks(s, length, out);
+  }
   uint64_t result = 0;
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -941,5 +1003,48 @@ enable_if_parameter_free<T, bool> ParseValue(
   return StringConverter<T>{}.Convert(type, s, length, out);
 }
 
+/// \brief Parse all non-null strings of a binary or string array in one call.
+///
+/// `offsets` and `data` describe `length` strings, with `offsets` already adjusted for
+/// the array offset. If not null, `validity` is their validity bitmap, starting at bit
+/// `validity_offset`; the outputs of null strings are set to zero.
+///
+/// \return the index of the first string which could not be parsed, or -1
+template <typename T, typename OffsetType>
+int64_t ParseValues(const T& type, const OffsetType* offsets, const uint8_t* data,
+                    const uint8_t* validity, int64_t validity_offset, int64_t length,
+                    typename StringConverter<T>::value_type* out) {
+  using value_type = typename StringConverter<T>::value_type;
+  StringConverter<T> converter;
+  auto parse_run = [&](int64_t position, int64_t run_length) -> int64_t {
+    for (int64_t i = position; i < position + run_length; ++i) {
+      if (ARROW_PREDICT_FALSE(!converter.Convert(
+              type, reinterpret_cast<const char*>(data + offsets[i]),
+              static_cast<size_t>(offsets[i + 1] - offsets[i]), out + i))) {
+        return i;
+      }
+    }
+    return -1;
+  };
+
+  if (validity == NULLPTR) {
+    return parse_run(0, length);
+  }
+  SetBitRunReader reader(validity, validity_offset, length);
+  int64_t position = 0;
+  while (true) {
+    const auto run = reader.NextRun();
+    const int64_t nulls_end = run.length == 0 ? length : run.position;
+    std::fill(out + position, out + nulls_end, value_type{});
+    if (run.length == 0) break;
+    const int64_t failed_index = parse_run(run.position, run.length);
+    if (ARROW_PREDICT_FALSE(failed_index >= 0)) {
+      return failed_index;
+    }
+    position = run.position + run.length;
+  }
+  return -1;
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cmath>
+#include <cstdint>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -438,6 +439,58 @@ TEST(StringConversion, ToUInt64) {
   AssertConversionFails<UInt64Type>("0x23512ak");
 }
 
+TEST(StringConversion, ToIntegerEightDigitsAtATime) {
+  // Strings of 8 digits and more are parsed a block of digits at a time
+  AssertConversion<UInt32Type>("12345678", 12345678);
+  AssertConversion<UInt32Type>("123456789", 123456789);
+  AssertConversion<UInt32Type>("4294967295", 4294967295U);
+  AssertConversion<Int32Type>("-99999999", -99999999);
+  AssertConversion<UInt64Type>("1234567890123456789", 1234567890123456789ULL);
+  AssertConversion<UInt64Type>("9999999999999999999", 9999999999999999999ULL);
+  AssertConversion<UInt64Type>("00000000000000000000012345678", 12345678);
+  AssertConversion<Int64Type>("-9223372036854775808", INT64_MIN);
+  AssertConversionFails<UInt32Type>("4294967296");
+  AssertConversionFails<Int64Type>("9223372036854775808");
+
+  // A non-digit anywhere in a block
+  for (size_t i = 0; i < 19; ++i) {
+    for (char c : {'/', ':', ' ', '.', 'a', '\x80', '\xb9'}) {
+      std::string s = "1234567890123456789";
+      s[i] = c;
+      AssertConversionFails<UInt64Type>(s);
+      if (i < 9) {
+        AssertConversionFails<UInt32Type>(s.substr(0, 9));
+      }
+    }
+  }
+}
+
+TEST(StringConversion, ParseValues) {
+  const std::vector<std::string> strings = {"1", "-22", "x", "333333333", "", "-4"};
+  std::vector<int32_t> offsets = {0};
+  std::string data;
+  for (const auto& s : strings) {
+    data += s;
+    offsets.push_back(static_cast<int32_t>(data.size()));
+  }
+  const auto* data_ptr = reinterpret_cast<const uint8_t*>(data.data());
+  // Strings 2 and 4 are null
+  const uint8_t validity = 0b101011 << 1;
+
+  std::vector<int32_t> out(strings.size(), 42);
+  ASSERT_EQ(-1, ParseValues(Int32Type(), offsets.data(), data_ptr, &validity,
+                            /*validity_offset=*/1, strings.size(), out.data()));
+  ASSERT_EQ(out, std::vector<int32_t>({1, -22, 0, 333333333, 0, -4}));
+
+  // Without a validity bitmap
+  ASSERT_EQ(-1, ParseValues(Int32Type(), offsets.data(), data_ptr, nullptr, 0, 2,
+                            out.data()));
+  ASSERT_EQ(2, ParseValues(Int32Type(), offsets.data(), data_ptr, nullptr, 0,
+                           strings.size(), out.data()));
+  ASSERT_EQ(1, ParseValues(Int32Type(), offsets.data() + 3, data_ptr, nullptr, 0, 3,
+                           out.data()));
+}
+
 TEST(StringConversion, ToDate32) {
   AssertConversion<Date32Type>("1970-01-01", 0);
   AssertConversion<Date32Type>("1970-01-02", 1);
@@ -0,0 +1,442 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/acero_expression_compiler.h"
+
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/expression.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+#include "gandiva/filter.h"
+#include "gandiva/function_registry.h"
+#include "gandiva/function_signature.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+namespace {
+
+namespace cp = arrow::compute;
+
+using arrow::Datum;
+using arrow::Result;
+using arrow::Type;
+using arrow::internal::checked_cast;
+using cp::Expression;
+
+// Arrow compute functions with a Gandiva function of the same semantics.  Arithmetic
+// which checks for overflow or errors on division by zero differs between the two, so
+// only the wrapping arithmetic functions are here.
+const std::unordered_map<std::string, std::string>& GandivaFunctionNames() {
+  static const std::unordered_map<std::string, std::string> names = {
+      {"add", "add"},
+      {"subtract", "subtract"},
+      {"multiply", "multiply"},
+      {"negate", "negative"},
+      {"abs", "abs"},
+      {"equal", "equal"},
+      {"not_equal", "not_equal"},
+      {"less", "less_than"},
+      {"less_equal", "less_than_or_equal_to"},
+      {"greater", "greater_than"},
+      {"greater_equal", "greater_than_or_equal_to"},
+      {"is_null", "isnull"},
+      {"is_valid", "isnotnull"},
+      {"invert", "not"},
+  };
+  return names;
+}
+
+bool IsSupportedLiteralType(const arrow::DataType& type) {
+  switch (type.id()) {
+    case Type::BOOL:
+    case Type::INT8:
+    case Type::INT16:
+    case Type::INT32:
+    case Type::INT64:
+    case Type::UINT8:
+    case Type::UINT16:
+    case Type::UINT32:
+    case Type::UINT64:
+    case Type::FLOAT:
+    case Type::DOUBLE:
+    case Type::STRING:
+    case Type::BINARY:
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename ArrowType>
+NodePtr MakeLiteral(const arrow::Scalar& scalar) {
+  using ScalarType = typename arrow::TypeTraits<ArrowType>::ScalarType;
+  return TreeExprBuilder::MakeLiteral(checked_cast<const ScalarType&>(scalar).value);
+}
+
+NodePtr TranslateLiteral(const arrow::Scalar& scalar) {
+  if (!IsSupportedLiteralType(*scalar.type)) return nullptr;
+  if (!scalar.is_valid) return TreeExprBuilder::MakeNull(scalar.type);
+  switch (scalar.type->id()) {
+    case Type::BOOL:
+      return MakeLiteral<arrow::BooleanType>(scalar);
+    case Type::INT8:
+      return MakeLiteral<arrow::Int8Type>(scalar);
+    case Type::INT16:
+      return MakeLiteral<arrow::Int16Type>(scalar);
+    case Type::INT32:
+      return MakeLiteral<arrow::Int32Type>(scalar);
+    case Type::INT64:
+      return MakeLiteral<arrow::Int64Type>(scalar);
+    case Type::UINT8:
+      return MakeLiteral<arrow::UInt8Type>(scalar);
+    case Type::UINT16:
+      return MakeLiteral<arrow::UInt16Type>(scalar);
+    case Type::UINT32:
+      return MakeLiteral<arrow::UInt32Type>(scalar);
+    case Type::UINT64:
+      return MakeLiteral<arrow::UInt64Type>(scalar);
+    case Type::FLOAT:
+      return MakeLiteral<arrow::FloatType>(scalar);
+    case Type::DOUBLE:
+      return MakeLiteral<arrow::DoubleType>(scalar);
+    case Type::STRING:
+      return TreeExprBuilder::MakeStringLiteral(
+          checked_cast<const arrow::StringScalar&>(scalar).ToString());
+    case Type::BINARY:
+      return TreeExprBuilder::MakeBinaryLiteral(
+          checked_cast<const arrow::BinaryScalar&>(scalar).ToString());
+    default:
+      return nullptr;
+  }
+}
+
+// The Gandiva function of a cast, if it is an exact widening of numbers
+std::string GandivaCastName(const arrow::DataType& from, const arrow::DataType& to) {
+  if (to.id() == Type::INT64 && arrow::is_integer(from.id()) &&
+      arrow::bit_width(from.id()) < 64) {
+    return "castBIGINT";
+  }
+  if (to.id() == Type::DOUBLE &&
+      ((arrow::is_integer(from.id()) && arrow::bit_width(from.id()) <= 32) ||
+       from.id() == Type::FLOAT)) {
+    return "castFLOAT8";
+  }
+  return "";
+}
+
+/// Translates bound expressions to Gandiva, replacing the largest subexpressions that
+/// Gandiva supports by references to the columns which a projector computes for them.
+class ExpressionSplitter {
+ public:
+  ExpressionSplitter(const arrow::Schema& schema, const FunctionRegistry& registry)
+      : schema_(schema), registry_(registry) {}
+
+  Result<Expression> Split(const Expression& expr) {
+    if (const Expression::Parameter* parameter = expr.parameter()) {
+      // Refer to fields by position, as the names of the columns may be ambiguous
+      return cp::field_ref(arrow::FieldPath(
+          std::vector<int>(parameter->indices.begin(), parameter->indices.end())));
+    }
+    const Expression::Call* call = expr.call();
+    if (call == nullptr) return expr;
+
+    auto compiled = compiled_.find(expr);
+    if (compiled != compiled_.end()) return ColumnRef(compiled->second);
+
+    std::vector<int> fields;
+    if (NodePtr node = Translate(expr, &fields)) {
+      int index = schema_.num_fields() + static_cast<int>(outputs_.size());
+      outputs_.push_back(TreeExprBuilder::MakeExpression(
+          std::move(node),
+          arrow::field("out" + std::to_string(outputs_.size()),
+                       expr.type()->GetSharedPtr())));
+      field_indices_.insert(field_indices_.end(), fields.begin(), fields.end());
+      compiled_.emplace(expr, index);
+      return ColumnRef(index);
+    }
+
+    std::vector<Expression> arguments(call->arguments.size());
+    for (size_t i = 0; i < arguments.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(arguments[i], Split(call->arguments[i]));
+    }
+    return cp::call(call->function_name, std::move(arguments), call->options);
+  }
+
+  /// The expressions computed by the projector
+  const ExpressionVector& outputs() const { return outputs_; }
+
+  /// The input fields read by the projector, which may repeat
+  const std::vector<int>& field_indices() const { return field_indices_; }
+
+ private:
+  static Expression ColumnRef(int index) { return cp::field_ref(arrow::FieldRef(index)); }
+
+  bool HasFunction(const std::string& name, const std::vector<Expression>& arguments,
+                   const arrow::DataType& out_type) const {
+    DataTypeVector param_types;
+    for (const Expression& argument : arguments) {
+      param_types.push_back(argument.type()->GetSharedPtr());
+    }
+    return registry_.LookupSignature(FunctionSignature(name, std::move(param_types),
+                                                       out_type.GetSharedPtr())) !=
+           nullptr;
+  }
+
+  // Return null if the expression, or one of its subexpressions, has no equivalent in
+  // Gandiva.  The indices of the fields it reads are appended to `fields`.
+  NodePtr Translate(const Expression& expr, std::vector<int>* fields) const {
+    if (const Datum* literal = expr.literal()) {
+      return literal->is_scalar() ? TranslateLiteral(*literal->scalar()) : nullptr;
+    }
+
+    if (const Expression::Parameter* parameter = expr.parameter()) {
+      if (parameter->indices.size() != 1) return nullptr;
+      int index = parameter->indices[0];
+      fields->push_back(index);
+      const auto& field = schema_.field(index);
+      return TreeExprBuilder::MakeField(arrow::field(
+          "in" + std::to_string(index), field->type(), field->nullable()));
+    }
+
+    const Expression::Call* call = expr.call();
+    NodeVector children;
+    for (const Expression& argument : call->arguments) {
+      NodePtr child = Translate(argument, fields);
+      if (!child) return nullptr;
+      children.push_back(std::move(child));
+    }
+
+    const std::string& name = call->function_name;
+    if (name == "and_kleene") return TreeExprBuilder::MakeAnd(children);
+    if (name == "or_kleene") return TreeExprBuilder::MakeOr(children);
+
+    std::string gandiva_name;
+    if (name == "cast") {
+      gandiva_name = GandivaCastName(*call->arguments[0].type(), *expr.type());
+    } else if (name == "is_null" &&
+               checked_cast<const cp::NullOptions&>(*call->options).nan_is_null) {
+      return nullptr;
+    } else {
+      auto it = GandivaFunctionNames().find(name);
+      if (it != GandivaFunctionNames().end()) gandiva_name = it->second;
+    }
+    if (gandiva_name.empty() ||
+        !HasFunction(gandiva_name, call->arguments, *expr.type())) {
+      return nullptr;
+    }
+    return TreeExprBuilder::MakeFunction(gandiva_name, children,
+                                         expr.type()->GetSharedPtr());
+  }
+
+  const arrow::Schema& schema_;
+  const FunctionRegistry& registry_;
+  std::unordered_map<Expression, int, Expression::Hash> compiled_;
+  ExpressionVector outputs_;
+  std::vector<int> field_indices_;
+};
+
+// The fields read by Gandiva expressions, each once and renamed so names are unique,
+// and the indices of these fields in the input schema
+std::pair<std::vector<int>, SchemaPtr> GandivaInputFields(
+    const arrow::Schema& schema, const std::vector<int>& read_field_indices) {
+  std::vector<int> field_indices;
+  FieldVector fields;
+  std::vector<bool> seen(schema.num_fields(), false);
+  for (int index : read_field_indices) {
+    if (seen[index]) continue;
+    seen[index] = true;
+    const auto& field = schema.field(index);
+    field_indices.push_back(index);
+    fields.push_back(
+        arrow::field("in" + std::to_string(index), field->type(), field->nullable()));
+  }
+  return {std::move(field_indices), arrow::schema(std::move(fields))};
+}
+
+// The record batch which Gandiva evaluates for an input batch
+Result<std::shared_ptr<arrow::RecordBatch>> MakeGandivaInput(
+    const cp::ExecBatch& batch, const std::vector<int>& field_indices,
+    const SchemaPtr& schema, arrow::MemoryPool* pool) {
+  arrow::ArrayVector columns(field_indices.size());
+  for (size_t i = 0; i < field_indices.size(); ++i) {
+    const Datum& value = batch[field_indices[i]];
+    if (value.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(columns[i], arrow::MakeArrayFromScalar(*value.scalar(),
+                                                                   batch.length, pool));
+    } else {
+      columns[i] = value.make_array();
+    }
+  }
+  return arrow::RecordBatch::Make(schema, batch.length, std::move(columns));
+}
+
+class GandivaCompiledExpressions : public arrow::acero::CompiledExpressions {
+ public:
+  GandivaCompiledExpressions(std::shared_ptr<Projector> projector,
+                             SchemaPtr projector_schema, std::vector<int> field_indices,
+                             std::vector<Expression> residuals)
+      : projector_(std::move(projector)),
+        projector_schema_(std::move(projector_schema)),
+        field_indices_(std::move(field_indices)),
+        residuals_(std::move(residuals)) {}
+
+  Result<std::vector<Datum>> Execute(const cp::ExecBatch& batch,
+                                     cp::ExecContext* exec_context) override {
+    arrow::MemoryPool* pool = exec_context->memory_pool();
+    ARROW_ASSIGN_OR_RAISE(
+        auto record_batch,
+        MakeGandivaInput(batch, field_indices_, projector_schema_, pool));
+
+    arrow::ArrayVector outputs;
+    ARROW_RETURN_NOT_OK(projector_->Evaluate(*record_batch, pool, &outputs));
+
+    // The residual expressions read the outputs as columns appended to the batch
+    cp::ExecBatch augmented = batch;
+    for (auto& output : outputs) {
+      augmented.values.emplace_back(std::move(output));
+    }
+    return cp::ExecuteScalarExpressions(residuals_, augmented, exec_context);
+  }
+
+ private:
+  std::shared_ptr<Projector> projector_;
+  SchemaPtr projector_schema_;
+  std::vector<int> field_indices_;
+  std::vector<Expression> residuals_;
+};
+
+class GandivaCompiledFilter : public arrow::acero::CompiledFilter {
+ public:
+  GandivaCompiledFilter(std::shared_ptr<Filter> filter, SchemaPtr filter_schema,
+                        std::vector<int> field_indices)
+      : filter_(std::move(filter)),
+        filter_schema_(std::move(filter_schema)),
+        field_indices_(std::move(field_indices)) {}
+
+  Result<std::shared_ptr<arrow::Array>> Select(const cp::ExecBatch& batch,
+                                               cp::ExecContext* exec_context) override {
+    arrow::MemoryPool* pool = exec_context->memory_pool();
+    // The narrowest indices that can address the rows of the batch
+    std::shared_ptr<SelectionVector> selection;
+    if (batch.length <= std::numeric_limits<uint16_t>::max() + 1) {
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt16(batch.length, pool, &selection));
+    } else if (batch.length <= std::numeric_limits<uint32_t>::max()) {
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt32(batch.length, pool, &selection));
+    } else {
+      ARROW_RETURN_NOT_OK(SelectionVector::MakeInt64(batch.length, pool, &selection));
+    }
+    if (batch.length == 0) {
+      return selection->ToArray();
+    }
+    ARROW_ASSIGN_OR_RAISE(auto record_batch,
+                          MakeGandivaInput(batch, field_indices_, filter_schema_, pool));
+    ARROW_RETURN_NOT_OK(filter_->Evaluate(*record_batch, selection));
+    return selection->ToArray();
+  }
+
+ private:
+  std::shared_ptr<Filter> filter_;
+  SchemaPtr filter_schema_;
+  std::vector<int> field_indices_;
+};
+
+class GandivaExpressionCompiler : public arrow::acero::ExpressionCompiler {
+ public:
+  explicit GandivaExpressionCompiler(std::shared_ptr<Configuration> configuration)
+      : configuration_(std::move(configuration)) {}
+
+  Result<std::unique_ptr<arrow::acero::CompiledExpressions>> Compile(
+      const std::vector<Expression>& exprs,
+      const std::shared_ptr<arrow::Schema>& schema) override {
+    ExpressionSplitter splitter(*schema, *configuration_->function_registry());
+    std::vector<Expression> residuals(exprs.size());
+    for (size_t i = 0; i < exprs.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(residuals[i], splitter.Split(exprs[i]));
+    }
+    if (splitter.outputs().empty()) return nullptr;
+
+    auto [field_indices, projector_schema] =
+        GandivaInputFields(*schema, splitter.field_indices());
+
+    std::shared_ptr<Projector> projector;
+    ARROW_RETURN_NOT_OK(Projector::Make(projector_schema, splitter.outputs(),
+                                        configuration_, &projector));
+
+    FieldVector augmented_fields = schema->fields();
+    for (const auto& output : splitter.outputs()) {
+      augmented_fields.push_back(output->result());
+    }
+    arrow::Schema augmented_schema(std::move(augmented_fields));
+    for (Expression& residual : residuals) {
+      ARROW_ASSIGN_OR_RAISE(residual, residual.Bind(augmented_schema));
+    }
+
+    return std::make_unique<GandivaCompiledExpressions>(
+        std::move(projector), std::move(projector_schema), std::move(field_indices),
+        std::move(residuals));
+  }
+
+  Result<std::unique_ptr<arrow::acero::CompiledFilter>> CompileFilter(
+      const Expression& predicate,
+      const std::shared_ptr<arrow::Schema>& schema) override {
+    // A predicate translated entirely is split into a reference to the single output
+    ExpressionSplitter splitter(*schema, *configuration_->function_registry());
+    ARROW_ASSIGN_OR_RAISE(Expression residual, splitter.Split(predicate));
+    const arrow::FieldRef* ref = residual.field_ref();
+    if (splitter.outputs().size() != 1 || ref == nullptr ||
+        *ref != arrow::FieldRef(schema->num_fields())) {
+      return nullptr;
+    }
+
+    auto [field_indices, filter_schema] =
+        GandivaInputFields(*schema, splitter.field_indices());
+    std::shared_ptr<Filter> filter;
+    ARROW_RETURN_NOT_OK(
+        Filter::Make(filter_schema,
+                     TreeExprBuilder::MakeCondition(splitter.outputs()[0]->root()),
+                     configuration_, &filter));
+    return std::make_unique<GandivaCompiledFilter>(
+        std::move(filter), std::move(filter_schema), std::move(field_indices));
+  }
+
+ private:
+  std::shared_ptr<Configuration> configuration_;
+};
+
+}  // namespace
+
+std::shared_ptr<arrow::acero::ExpressionCompiler> MakeAceroExpressionCompiler(
+    std::shared_ptr<Configuration> configuration) {
+  return std::make_shared<GandivaExpressionCompiler>(std::move(configuration));
+}
+
+}  // namespace gandiva
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/acero/expression_compiler.h"
+#include "arrow/acero/options.h"
+
+#include "gandiva/configuration.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Make a compiler of the expressions of Acero filter and project nodes.
+///
+/// Set the compiler as arrow::acero::QueryOptions::expression_compiler to evaluate the
+/// parts of the expressions that have an equivalent in Gandiva with LLVM generated code:
+/// arithmetic, comparisons, boolean logic, null checks and widening casts of numeric,
+/// boolean and string values.  The rest of the expressions is still interpreted, with
+/// the compiled parts as inputs.  Compiled modules are shared through the cache of
+/// Gandiva, so plans of the same expressions and schema are only compiled once.
+/// Filter predicates that are compiled entirely select the rows with a Gandiva Filter
+/// rather than computing a boolean mask.
+///
+/// \param[in] configuration the configuration to build the projectors with.
+GANDIVA_EXPORT std::shared_ptr<arrow::acero::ExpressionCompiler>
+MakeAceroExpressionCompiler(std::shared_ptr<Configuration> configuration =
+                                ConfigurationBuilder::DefaultConfiguration());
+
+/// \brief Options of an Acero project node which evaluates its expressions with Gandiva.
+///
+/// The expressions are compiled once per plan, by MakeAceroExpressionCompiler, and the
+/// compiled module is shared by the threads which process the batches.
+class GandivaProjectNodeOptions : public arrow::acero::ProjectNodeOptions {
+ public:
+  explicit GandivaProjectNodeOptions(std::vector<arrow::compute::Expression> expressions,
+                                     std::vector<std::string> names = {},
+                                     std::shared_ptr<Configuration> configuration =
+                                         ConfigurationBuilder::DefaultConfiguration())
+      : ProjectNodeOptions(std::move(expressions), std::move(names)) {
+    expression_compiler = MakeAceroExpressionCompiler(std::move(configuration));
+  }
+};
+
+/// \brief Options of an Acero filter node which evaluates its predicate with Gandiva.
+///
+/// \see GandivaProjectNodeOptions
+class GandivaFilterNodeOptions : public arrow::acero::FilterNodeOptions {
+ public:
+  explicit GandivaFilterNodeOptions(arrow::compute::Expression filter_expression,
+                                    std::shared_ptr<Configuration> configuration =
+                                        ConfigurationBuilder::DefaultConfiguration())
+      : FilterNodeOptions(std::move(filter_expression)) {
+    expression_compiler = MakeAceroExpressionCompiler(std::move(configuration));
+  }
+};
+
+}  // namespace gandiva
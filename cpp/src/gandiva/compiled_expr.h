@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include "gandiva/llvm_includes.h"
 #include "gandiva/selection_vector.h"
@@ -47,11 +48,11 @@ class CompiledExpr {
   }
 
   void SetJITFunction(SelectionVector::Mode mode, EvalFunc jit_function) {
-    jit_functions_[static_cast<int>(mode)] = jit_function;
+    jit_functions_[static_cast<int>(mode)].store(jit_function, std::memory_order_release);
   }
 
   EvalFunc GetJITFunction(SelectionVector::Mode mode) const {
-    return jit_functions_[static_cast<int>(mode)];
+    return jit_functions_[static_cast<int>(mode)].load(std::memory_order_acquire);
   }
 
  private:
@@ -64,8 +65,9 @@ class CompiledExpr {
   // Function names for various modes in the generated code
   std::array<std::string, SelectionVector::kNumModes> ir_functions_;
 
-  // JIT functions in the generated code (set after the module is optimised and finalized)
-  std::array<EvalFunc, SelectionVector::kNumModes> jit_functions_;
+  // JIT functions in the generated code (set after the module is optimised and finalized,
+  // and replaced by the optimized ones with tiered compilation)
+  std::array<std::atomic<EvalFunc>, SelectionVector::kNumModes> jit_functions_;
 };
 
 }  // namespace gandiva
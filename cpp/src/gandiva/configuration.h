@@ -53,12 +53,16 @@ class GANDIVA_EXPORT Configuration {
   bool optimize() const { return optimize_; }
   bool target_host_cpu() const { return target_host_cpu_; }
   bool dump_ir() const { return dump_ir_; }
+  bool tiered_compilation() const { return tiered_compilation_; }
   std::shared_ptr<FunctionRegistry> function_registry() const {
     return function_registry_;
   }
 
   void set_optimize(bool optimize) { optimize_ = optimize; }
   void set_dump_ir(bool dump_ir) { dump_ir_ = dump_ir; }
+  void set_tiered_compilation(bool tiered_compilation) {
+    tiered_compilation_ = tiered_compilation;
+  }
   void target_host_cpu(bool target_host_cpu) { target_host_cpu_ = target_host_cpu; }
   void set_function_registry(std::shared_ptr<FunctionRegistry> function_registry) {
     function_registry_ = std::move(function_registry);
@@ -72,6 +76,10 @@ class GANDIVA_EXPORT Configuration {
   // flag indicating if IR dumping is needed, defaults to false, and turning it on will
   // negatively affect performance
   bool dump_ir_ = false;
+  // flag indicating if optimized code should be compiled in the background, evaluating
+  // with unoptimized code until it is ready. This lowers the latency of the first
+  // evaluations, e.g. for ad-hoc queries over small data. Defaults to false
+  bool tiered_compilation_ = false;
 };
 
 /// \brief configuration builder for gandiva
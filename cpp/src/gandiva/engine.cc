@@ -33,6 +33,7 @@
 
 #include <arrow/util/io_util.h>
 #include <arrow/util/logging.h>
+#include <arrow/util/thread_pool.h>
 
 #if defined(_MSC_VER)
 #pragma warning(push)
@@ -46,6 +47,7 @@
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/Orc/LLJIT.h>
 #include <llvm/IR/DataLayout.h>
@@ -131,7 +133,7 @@ arrow::Result<T> AsArrowResult(llvm::Expected<T>& expected,
 }
 
 Result<llvm::orc::JITTargetMachineBuilder> MakeTargetMachineBuilder(
-    const Configuration& conf) {
+    const Configuration& conf, bool optimize) {
   llvm::orc::JITTargetMachineBuilder jtmb(
       (llvm::Triple(llvm::sys::getDefaultTargetTriple())));
   if (conf.target_host_cpu()) {
@@ -143,8 +145,7 @@ Result<llvm::orc::JITTargetMachineBuilder> MakeTargetMachineBuilder(
 #else
   using CodeGenOptLevel = llvm::CodeGenOpt::Level;
 #endif
-  auto const opt_level =
-      conf.optimize() ? CodeGenOptLevel::Aggressive : CodeGenOptLevel::None;
+  auto const opt_level = optimize ? CodeGenOptLevel::Aggressive : CodeGenOptLevel::None;
   jtmb.setCodeGenOptLevel(opt_level);
   return jtmb;
 }
@@ -280,13 +281,15 @@ void Engine::InitOnce() {
 
 Engine::Engine(const std::shared_ptr<Configuration>& conf,
                std::unique_ptr<llvm::orc::LLJIT> lljit,
-               std::unique_ptr<llvm::TargetMachine> target_machine, bool cached)
+               std::unique_ptr<llvm::TargetMachine> target_machine, bool cached,
+               bool tiered)
     : context_(std::make_unique<llvm::LLVMContext>()),
       lljit_(std::move(lljit)),
       ir_builder_(std::make_unique<llvm::IRBuilder<>>(*context_)),
       types_(*context_),
       optimize_(conf->optimize()),
       cached_(cached),
+      tiered_(tiered),
       function_registry_(conf->function_registry()),
       target_machine_(std::move(target_machine)),
       conf_(conf) {
@@ -321,14 +324,26 @@ Result<std::unique_ptr<Engine>> Engine::Make(
     std::optional<std::reference_wrapper<GandivaObjectCache>> object_cache) {
   std::call_once(llvm_init_once_flag, InitOnce);
 
-  ARROW_ASSIGN_OR_RAISE(auto jtmb, MakeTargetMachineBuilder(*conf));
-  ARROW_ASSIGN_OR_RAISE(auto jit, BuildJIT(jtmb, object_cache));
+  // The IR dump is of the optimized module, so it requires optimizing up front
+  const bool tiered =
+      conf->tiered_compilation() && conf->optimize() && !cached && !conf->dump_ir();
+  ARROW_ASSIGN_OR_RAISE(auto jtmb,
+                        MakeTargetMachineBuilder(*conf, conf->optimize() && !tiered));
+  // With tiered compilation, only the optimized code is cached
+  std::optional<std::reference_wrapper<GandivaObjectCache>> jit_object_cache;
+  if (!tiered) {
+    jit_object_cache = object_cache;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto jit, BuildJIT(jtmb, jit_object_cache));
   auto maybe_tm = jtmb.createTargetMachine();
   ARROW_ASSIGN_OR_RAISE(auto target_machine,
                         AsArrowResult(maybe_tm, "Could not create target machine: "));
 
   std::unique_ptr<Engine> engine{
-      new Engine(conf, std::move(jit), std::move(target_machine), cached)};
+      new Engine(conf, std::move(jit), std::move(target_machine), cached, tiered)};
+  if (tiered && object_cache.has_value()) {
+    engine->object_cache_ = object_cache->get();
+  }
 
   ARROW_RETURN_NOT_OK(engine->Init());
   return engine;
@@ -495,19 +510,111 @@ static void OptimizeModuleWithLegacyPassManager(llvm::Module& module,
 }
 #endif
 
+static void OptimizeModule(llvm::Module& module, llvm::TargetIRAnalysis target_analysis) {
+// misc passes to allow for inlining, vectorization, ..
+#if LLVM_VERSION_MAJOR >= 14
+  OptimizeModuleWithNewPassManager(module, std::move(target_analysis));
+#else
+  OptimizeModuleWithLegacyPassManager(module, std::move(target_analysis));
+#endif
+}
+
+static Result<void*> LookUpFunction(llvm::orc::LLJIT& lljit,
+                                    const std::string& function) {
+  auto sym = lljit.lookup(function);
+  if (!sym) {
+    return Status::CodeGenError("Failed to look up function: " + function +
+                                " error: " + llvm::toString(sym.takeError()));
+  }
+  // Since LLVM 15, `LLJIT::lookup` returns ExecutorAddrs rather than
+  // JITEvaluatedSymbols
+#if LLVM_VERSION_MAJOR >= 15
+  auto fn_addr = sym->getValue();
+#else
+  auto fn_addr = sym->getAddress();
+#endif
+  auto fn_ptr = reinterpret_cast<void*>(fn_addr);
+  if (fn_ptr == nullptr) {
+    return Status::CodeGenError("Failed to get address for function: " + function);
+  }
+  return fn_ptr;
+}
+
+struct Engine::OptimizedCode {
+  // Outlives the LLJIT, which refers to it
+  std::optional<GandivaObjectCache> object_cache;
+  std::unique_ptr<llvm::orc::LLJIT> lljit;
+};
+
+Result<std::shared_ptr<Engine::OptimizedCode>> Engine::CompileOptimized(
+    const std::string& bitcode, const Configuration& conf,
+    const std::vector<std::string>& functions,
+    const std::vector<std::pair<std::string, void*>>& global_mappings,
+    std::optional<GandivaObjectCache> object_cache) {
+  auto code = std::make_shared<OptimizedCode>();
+  code->object_cache = std::move(object_cache);
+
+  // LLVM contexts can't be shared between threads, so optimize a copy of the module
+  auto context = std::make_unique<llvm::LLVMContext>();
+  auto module_or_error = llvm::parseBitcodeFile(
+      llvm::MemoryBufferRef(bitcode, "gandiva_optimized_module"), *context);
+  ARROW_ASSIGN_OR_RAISE(auto module,
+                        AsArrowResult(module_or_error, "Could not parse the module: "));
+
+  ARROW_ASSIGN_OR_RAISE(auto jtmb, MakeTargetMachineBuilder(conf, /*optimize=*/true));
+  auto maybe_tm = jtmb.createTargetMachine();
+  ARROW_ASSIGN_OR_RAISE(auto target_machine,
+                        AsArrowResult(maybe_tm, "Could not create target machine: "));
+  OptimizeModule(*module, target_machine->getTargetIRAnalysis());
+  ARROW_RETURN_IF(llvm::verifyModule(*module, &llvm::errs()),
+                  Status::CodeGenError("Module verification failed after optimizer"));
+
+  std::optional<std::reference_wrapper<GandivaObjectCache>> jit_object_cache;
+  if (code->object_cache.has_value()) {
+    jit_object_cache = *code->object_cache;
+  }
+  ARROW_ASSIGN_OR_RAISE(code->lljit, BuildJIT(std::move(jtmb), jit_object_cache));
+  for (const auto& mapping : global_mappings) {
+    AddAbsoluteSymbol(*code->lljit, mapping.first, mapping.second);
+  }
+  llvm::orc::ThreadSafeModule tsm(std::move(module), std::move(context));
+  auto error = code->lljit->addIRModule(std::move(tsm));
+  if (error) {
+    return Status::CodeGenError("Failed to add IR module to LLJIT: ",
+                                llvm::toString(std::move(error)));
+  }
+  // Compile here rather than on the first lookup by the evaluating thread
+  for (const auto& function : functions) {
+    ARROW_RETURN_NOT_OK(LookUpFunction(*code->lljit, function));
+  }
+  return code;
+}
+
+void Engine::StartOptimization() {
+  std::string bitcode;
+  {
+    llvm::raw_string_ostream stream(bitcode);
+    llvm::WriteBitcodeToFile(*module_, stream);
+  }
+  auto task = [bitcode = std::move(bitcode), conf = conf_,
+               functions = functions_to_compile_, global_mappings = global_mappings_,
+               object_cache = object_cache_]() {
+    return CompileOptimized(bitcode, *conf, functions, global_mappings, object_cache);
+  };
+  optimized_code_ =
+      arrow::DeferNotOk(arrow::internal::GetCpuThreadPool()->Submit(std::move(task)));
+}
+
 // Optimise and compile the module.
 Status Engine::FinalizeModule() {
   if (!cached_) {
     ARROW_RETURN_NOT_OK(RemoveUnusedFunctions());
 
-    if (optimize_) {
-      auto target_analysis = target_machine_->getTargetIRAnalysis();
-// misc passes to allow for inlining, vectorization, ..
-#if LLVM_VERSION_MAJOR >= 14
-      OptimizeModuleWithNewPassManager(*module_, std::move(target_analysis));
-#else
-      OptimizeModuleWithLegacyPassManager(*module_, std::move(target_analysis));
-#endif
+    if (tiered_) {
+      // The module is compiled without optimizations in the meantime
+      StartOptimization();
+    } else if (optimize_) {
+      OptimizeModule(*module_, target_machine_->getTargetIRAnalysis());
     }
 
     ARROW_RETURN_IF(llvm::verifyModule(*module_, &llvm::errs()),
@@ -535,23 +642,13 @@ Status Engine::FinalizeModule() {
 Result<void*> Engine::CompiledFunction(const std::string& function) {
   DCHECK(module_finalized_)
       << "module must be finalized before getting compiled function";
-  auto sym = lljit_->lookup(function);
-  if (!sym) {
-    return Status::CodeGenError("Failed to look up function: " + function +
-                                " error: " + llvm::toString(sym.takeError()));
-  }
-  // Since LLVM 15, `LLJIT::lookup` returns ExecutorAddrs rather than
-  // JITEvaluatedSymbols
-#if LLVM_VERSION_MAJOR >= 15
-  auto fn_addr = sym->getValue();
-#else
-  auto fn_addr = sym->getAddress();
-#endif
-  auto fn_ptr = reinterpret_cast<void*>(fn_addr);
-  if (fn_ptr == nullptr) {
-    return Status::CodeGenError("Failed to get address for function: " + function);
-  }
-  return fn_ptr;
+  return LookUpFunction(*lljit_, function);
+}
+
+Result<void*> Engine::OptimizedFunction(const std::string& function) {
+  DCHECK(optimizing()) << "no optimized code is being compiled";
+  ARROW_ASSIGN_OR_RAISE(auto code, optimized_code_.result());
+  return LookUpFunction(*code->lljit, function);
 }
 
 void Engine::AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_type,
@@ -559,6 +656,7 @@ void Engine::AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_ty
   auto const prototype = llvm::FunctionType::get(ret_type, args, /*is_var_arg*/ false);
   llvm::Function::Create(prototype, llvm::GlobalValue::ExternalLinkage, name, module());
   AddAbsoluteSymbol(*lljit_, name, func);
+  global_mappings_.emplace_back(name, func);
 }
 
 arrow::Status Engine::AddGlobalMappings() {
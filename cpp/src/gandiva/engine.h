@@ -23,10 +23,12 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <llvm/Analysis/TargetTransformInfo.h>
 
+#include "arrow/util/future.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "gandiva/configuration.h"
@@ -72,6 +74,9 @@ class GANDIVA_EXPORT Engine {
   }
 
   /// Optimise and compile the module.
+  ///
+  /// With tiered compilation, the module is compiled without optimizations and a copy
+  /// of it is optimized and compiled in the background.
   Status FinalizeModule();
 
   /// Set LLVM ObjectCache.
@@ -80,6 +85,18 @@ class GANDIVA_EXPORT Engine {
   /// Get the compiled function corresponding to the irfunction.
   Result<void*> CompiledFunction(const std::string& function);
 
+  /// Whether optimized code is being compiled in the background (tiered compilation),
+  /// to replace the functions returned by CompiledFunction().
+  bool optimizing() const { return optimized_code_.is_valid(); }
+
+  /// Whether the optimized code compiled in the background is ready, or failed to
+  /// compile.
+  bool IsOptimizedCodeReady() const { return optimized_code_.is_finished(); }
+
+  /// Get the optimized version of the compiled function corresponding to the
+  /// irfunction, waiting for the background compilation to finish.
+  Result<void*> OptimizedFunction(const std::string& function);
+
   // Create and add a mapping for the cpp function to make it accessible from LLVM.
   void AddGlobalMappingForFunc(const std::string& name, llvm::Type* ret_type,
                                const std::vector<llvm::Type*>& args, void* func);
@@ -91,9 +108,11 @@ class GANDIVA_EXPORT Engine {
   Status LoadFunctionIRs();
 
  private:
+  struct OptimizedCode;
+
   Engine(const std::shared_ptr<Configuration>& conf,
          std::unique_ptr<llvm::orc::LLJIT> lljit,
-         std::unique_ptr<llvm::TargetMachine> target_machine, bool cached);
+         std::unique_ptr<llvm::TargetMachine> target_machine, bool cached, bool tiered);
 
   // Post construction init. This _must_ be called after the constructor.
   Status Init();
@@ -113,6 +132,15 @@ class GANDIVA_EXPORT Engine {
   // Remove unused functions to reduce compile time.
   Status RemoveUnusedFunctions();
 
+  // Start optimizing and compiling a copy of the module in the background.
+  void StartOptimization();
+
+  static Result<std::shared_ptr<OptimizedCode>> CompileOptimized(
+      const std::string& bitcode, const Configuration& conf,
+      const std::vector<std::string>& functions,
+      const std::vector<std::pair<std::string, void*>>& global_mappings,
+      std::optional<GandivaObjectCache> object_cache);
+
   std::unique_ptr<llvm::LLVMContext> context_;
   std::unique_ptr<llvm::orc::LLJIT> lljit_;
   std::unique_ptr<llvm::IRBuilder<>> ir_builder_;
@@ -124,11 +152,18 @@ class GANDIVA_EXPORT Engine {
   bool optimize_ = true;
   bool module_finalized_ = false;
   bool cached_;
+  bool tiered_;
   bool functions_loaded_ = false;
   std::shared_ptr<FunctionRegistry> function_registry_;
   std::string module_ir_;
   std::unique_ptr<llvm::TargetMachine> target_machine_;
   const std::shared_ptr<Configuration> conf_;
+
+  // For tiered compilation: the functions mapped into the module, the object cache
+  // for the optimized code and its background compilation
+  std::vector<std::pair<std::string, void*>> global_mappings_;
+  std::optional<GandivaObjectCache> object_cache_;
+  arrow::Future<std::shared_ptr<OptimizedCode>> optimized_code_;
 };
 
 }  // namespace gandiva
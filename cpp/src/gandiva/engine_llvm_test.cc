@@ -133,4 +133,25 @@ TEST_F(TestEngine, TestAddOptimised) {
   EXPECT_EQ(add_func(my_array, 5), 17);
 }
 
+TEST_F(TestEngine, TestAddTiered) {
+  auto tiered_configuration = std::make_shared<Configuration>(/*optimize=*/true);
+  tiered_configuration->set_tiered_compilation(true);
+  ASSERT_OK_AND_ASSIGN(engine, Engine::Make(tiered_configuration, false));
+
+  std::string fn_name = BuildVecAdd(engine.get());
+  ASSERT_OK(engine->FinalizeModule());
+  ASSERT_TRUE(engine->optimizing());
+  ASSERT_OK_AND_ASSIGN(auto fn_ptr, engine->CompiledFunction(fn_name));
+  auto add_func = reinterpret_cast<add_vector_func_t>(fn_ptr);
+
+  int64_t my_array[] = {1, 3, -5, 8, 10};
+  EXPECT_EQ(add_func(my_array, 5), 17);
+
+  ASSERT_OK_AND_ASSIGN(auto optimized_fn_ptr, engine->OptimizedFunction(fn_name));
+  ASSERT_TRUE(engine->IsOptimizedCodeReady());
+  ASSERT_NE(optimized_fn_ptr, fn_ptr);
+  auto optimized_add_func = reinterpret_cast<add_vector_func_t>(optimized_fn_ptr);
+  EXPECT_EQ(optimized_add_func(my_array, 5), 17);
+}
+
 }  // namespace gandiva
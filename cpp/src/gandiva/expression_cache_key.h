@@ -19,6 +19,7 @@
 
 #include <stddef.h>
 
+#include <string>
 #include <thread>
 
 #include "arrow/util/hash_util.h"
@@ -34,7 +35,11 @@ class ExpressionCacheKey {
  public:
   ExpressionCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
                      ExpressionVector expression_vector, SelectionVector::Mode mode)
-      : schema_(schema), mode_(mode), uniquifier_(0), configuration_(configuration) {
+      : schema_(schema),
+        mode_(mode),
+        uniquifier_(0),
+        configuration_(configuration),
+        kind_("projector") {
     static const int kSeedValue = 4;
     size_t result = kSeedValue;
     for (auto& expr : expression_vector) {
@@ -55,7 +60,8 @@ class ExpressionCacheKey {
       : schema_(schema),
         mode_(SelectionVector::MODE_NONE),
         uniquifier_(0),
-        configuration_(configuration) {
+        configuration_(configuration),
+        kind_("filter") {
     static const int kSeedValue = 4;
     size_t result = kSeedValue;
     expressions_as_strings_.push_back(expression.ToString());
@@ -79,6 +85,24 @@ class ExpressionCacheKey {
 
   size_t Hash() const { return hash_code_; }
 
+  /// \brief A key identifying the object code across processes, or an empty
+  /// string if it can't be shared between processes.
+  std::string PersistentKey() const {
+    // The object code of external functions may change between processes
+    if (configuration_->function_registry() != default_function_registry()) {
+      return "";
+    }
+    std::string key = kind_;
+    key += " mode=" + std::to_string(static_cast<int>(mode_));
+    key += " optimize=" + std::to_string(configuration_->optimize());
+    key += " target_host_cpu=" + std::to_string(configuration_->target_host_cpu());
+    key += "\n" + schema_->ToString(/*show_metadata=*/true);
+    for (const auto& expr : expressions_as_strings_) {
+      key += "\n" + expr;
+    }
+    return key;
+  }
+
   bool operator==(const ExpressionCacheKey& other) const {
     if (hash_code_ != other.hash_code_) {
       return false;
@@ -116,6 +140,7 @@ class ExpressionCacheKey {
   SelectionVector::Mode mode_;
   uint32_t uniquifier_;
   std::shared_ptr<Configuration> configuration_;
+  const char* kind_;
 };
 
 }  // namespace gandiva
@@ -52,18 +52,11 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
 
   ExpressionCacheKey cache_key(schema, configuration, conditionToKey);
 
-  bool is_cached = false;
-
-  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
-
-  // Verify if previous filter obj code was cached
-  if (prev_cached_obj != nullptr) {
-    is_cached = true;
-  }
-
   GandivaObjectCache obj_cache(cache, cache_key);
 
+  // Verify if previous filter obj code was cached, by this or another process
+  bool is_cached = obj_cache.GetCachedObject() != nullptr;
+
   // Build LLVM generator, and generate code for the specified expression
   ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
                         LLVMGenerator::Make(configuration, is_cached, obj_cache));
@@ -24,9 +24,12 @@ namespace gandiva {
 GandivaObjectCache::GandivaObjectCache(
     std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
         cache,
-    ExpressionCacheKey key)
-    : cache_key_(std::move(key)) {
+    ExpressionCacheKey key, std::shared_ptr<PersistentObjectCache> persistent_cache)
+    : cache_key_(std::move(key)), persistent_cache_(std::move(persistent_cache)) {
   cache_ = cache;
+  if (persistent_cache_ != nullptr) {
+    persistent_key_ = cache_key_.PersistentKey();
+  }
 }
 
 void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
@@ -36,10 +39,24 @@ void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
   std::shared_ptr<llvm::MemoryBuffer> obj_code = std::move(obj_buffer);
 
   cache_->PutObjectCode(cache_key_, obj_code);
+  if (!persistent_key_.empty()) {
+    persistent_cache_->Put(persistent_key_, Obj.getBuffer());
+  }
 }
 
-std::unique_ptr<llvm::MemoryBuffer> GandivaObjectCache::getObject(const llvm::Module* M) {
+std::shared_ptr<llvm::MemoryBuffer> GandivaObjectCache::GetCachedObject() {
   std::shared_ptr<llvm::MemoryBuffer> cached_obj = cache_->GetObjectCode(cache_key_);
+  if (cached_obj == nullptr && !persistent_key_.empty()) {
+    cached_obj = persistent_cache_->Get(persistent_key_);
+    if (cached_obj != nullptr) {
+      cache_->PutObjectCode(cache_key_, cached_obj);
+    }
+  }
+  return cached_obj;
+}
+
+std::unique_ptr<llvm::MemoryBuffer> GandivaObjectCache::getObject(const llvm::Module* M) {
+  std::shared_ptr<llvm::MemoryBuffer> cached_obj = GetCachedObject();
   if (cached_obj != nullptr) {
     std::unique_ptr<llvm::MemoryBuffer> cached_buffer = cached_obj->getMemBufferCopy(
         cached_obj->getBuffer(), cached_obj->getBufferIdentifier());
@@ -31,15 +31,21 @@
 
 #include "gandiva/cache.h"
 #include "gandiva/expression_cache_key.h"
+#include "gandiva/persistent_object_cache.h"
 
 namespace gandiva {
 /// Class that enables the LLVM to use a custom rule to deal with the object code.
+///
+/// The object code is kept in the in-memory cache and, if given, in the
+/// persistent cache shared between processes.
 class GandivaObjectCache : public llvm::ObjectCache {
  public:
   explicit GandivaObjectCache(
       std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
           cache,
-      ExpressionCacheKey key);
+      ExpressionCacheKey key,
+      std::shared_ptr<PersistentObjectCache> persistent_cache =
+          PersistentObjectCache::GetDefault());
 
   ~GandivaObjectCache() {}
 
@@ -47,8 +53,15 @@ class GandivaObjectCache : public llvm::ObjectCache {
 
   std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M);
 
+  /// Get the cached object code, loading it from the persistent cache into the
+  /// in-memory cache if needed, or null if it isn't cached.
+  std::shared_ptr<llvm::MemoryBuffer> GetCachedObject();
+
  private:
   ExpressionCacheKey cache_key_;
   std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>> cache_;
+  std::shared_ptr<PersistentObjectCache> persistent_cache_;
+  // Empty if the object code isn't persisted
+  std::string persistent_key_;
 };
 }  // namespace gandiva
@@ -553,6 +553,11 @@ TEST(TestGdvFnStubs, TestUpper) {
   EXPECT_EQ(std::string(out_str, out_len), "CITROËN");
   EXPECT_FALSE(ctx.has_error());
 
+  // A long ASCII prefix is converted in bulk
+  out_str = gdv_fn_upper_utf8(ctx_ptr, "a long ascii prefix, then münchen", 34, &out_len);
+  EXPECT_EQ(std::string(out_str, out_len), "A LONG ASCII PREFIX, THEN MÜNCHEN");
+  EXPECT_FALSE(ctx.has_error());
+
   out_str = gdv_fn_upper_utf8(ctx_ptr, "âBćDëFGH", 11, &out_len);
   EXPECT_EQ(std::string(out_str, out_len), "ÂBĆDËFGH");
   EXPECT_FALSE(ctx.has_error());
@@ -613,6 +618,11 @@ TEST(TestGdvFnStubs, TestLower) {
   EXPECT_EQ(std::string(out_str, out_len), "münchen");
   EXPECT_FALSE(ctx.has_error());
 
+  // A long ASCII prefix is converted in bulk
+  out_str = gdv_fn_lower_utf8(ctx_ptr, "A LONG ASCII PREFIX, THEN MÜNCHEN", 34, &out_len);
+  EXPECT_EQ(std::string(out_str, out_len), "a long ascii prefix, then münchen");
+  EXPECT_FALSE(ctx.has_error());
+
   out_str = gdv_fn_lower_utf8(ctx_ptr, "citroën", 8, &out_len);
   EXPECT_EQ(std::string(out_str, out_len), "citroën");
   EXPECT_FALSE(ctx.has_error());
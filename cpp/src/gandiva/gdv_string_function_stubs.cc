@@ -199,20 +199,27 @@ const char* gdv_fn_lower_utf8(int64_t context, const char* data, int32_t data_le
     return "";
   }
 
+  // The ASCII prefix of the input, often all of it, is converted in bulk
+  const int32_t ascii_len = static_cast<int32_t>(
+      arrow::util::AsciiPrefixLength(reinterpret_cast<const uint8_t*>(data), data_len));
+
   // If it is a single-byte character (ASCII), corresponding lowercase is always 1-byte
   // long; if it is >= 2 bytes long, lowercase can be at most 4 bytes long, so length of
   // the output can be at most twice the length of the input
-  char* out = reinterpret_cast<char*>(gdv_fn_context_arena_malloc(context, 2 * data_len));
+  const int32_t max_out_len = ascii_len == data_len ? data_len : 2 * data_len;
+  char* out = reinterpret_cast<char*>(gdv_fn_context_arena_malloc(context, max_out_len));
   if (out == nullptr) {
     gdv_fn_context_set_error_msg(context, "Could not allocate memory for output string");
     *out_len = 0;
     return "";
   }
+  arrow::util::AsciiToLower(reinterpret_cast<const uint8_t*>(data), ascii_len,
+                            reinterpret_cast<uint8_t*>(out));
 
-  int32_t char_len, out_char_len, out_idx = 0;
+  int32_t char_len, out_char_len, out_idx = ascii_len;
   uint32_t char_codepoint;
 
-  for (int32_t i = 0; i < data_len; i += char_len) {
+  for (int32_t i = ascii_len; i < data_len; i += char_len) {
     char_len = gdv_fn_utf8_char_length(data[i]);
     // For single byte characters:
     // If it is an uppercase ASCII character, set the output to its corresponding
@@ -271,20 +278,27 @@ const char* gdv_fn_upper_utf8(int64_t context, const char* data, int32_t data_le
     return "";
   }
 
+  // The ASCII prefix of the input, often all of it, is converted in bulk
+  const int32_t ascii_len = static_cast<int32_t>(
+      arrow::util::AsciiPrefixLength(reinterpret_cast<const uint8_t*>(data), data_len));
+
   // If it is a single-byte character (ASCII), corresponding uppercase is always 1-byte
   // long; if it is >= 2 bytes long, uppercase can be at most 4 bytes long, so length of
   // the output can be at most twice the length of the input
-  char* out = reinterpret_cast<char*>(gdv_fn_context_arena_malloc(context, 2 * data_len));
+  const int32_t max_out_len = ascii_len == data_len ? data_len : 2 * data_len;
+  char* out = reinterpret_cast<char*>(gdv_fn_context_arena_malloc(context, max_out_len));
   if (out == nullptr) {
     gdv_fn_context_set_error_msg(context, "Could not allocate memory for output string");
     *out_len = 0;
     return "";
   }
+  arrow::util::AsciiToUpper(reinterpret_cast<const uint8_t*>(data), ascii_len,
+                            reinterpret_cast<uint8_t*>(out));
 
-  int32_t char_len, out_char_len, out_idx = 0;
+  int32_t char_len, out_char_len, out_idx = ascii_len;
   uint32_t char_codepoint;
 
-  for (int32_t i = 0; i < data_len; i += char_len) {
+  for (int32_t i = ascii_len; i < data_len; i += char_len) {
     char_len = gdv_fn_utf8_char_length(data[i]);
     // For single byte characters:
     // If it is a lowercase ASCII character, set the output to its corresponding uppercase
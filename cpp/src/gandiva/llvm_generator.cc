@@ -107,10 +107,38 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs, SelectionVector::Mode
     auto jit_fn = reinterpret_cast<EvalFunc>(fn_ptr);
     compiled_expr->SetJITFunction(selection_vector_mode_, jit_fn);
   }
+  optimizing_.store(engine_->optimizing());
 
   return Status::OK();
 }
 
+void LLVMGenerator::UseOptimizedFunctionsIfReady() const {
+  if (!optimizing_.load(std::memory_order_acquire) || !engine_->IsOptimizedCodeReady()) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(optimizing_mutex_);
+  if (!optimizing_.load(std::memory_order_relaxed)) {
+    return;
+  }
+  optimizing_.store(false, std::memory_order_release);
+
+  std::vector<EvalFunc> jit_fns;
+  for (auto& compiled_expr : compiled_exprs_) {
+    auto fn_name = compiled_expr->GetFunctionName(selection_vector_mode_);
+    auto maybe_fn_ptr = engine_->OptimizedFunction(fn_name);
+    if (!maybe_fn_ptr.ok()) {
+      // keep evaluating with the unoptimized functions
+      ARROW_LOG(WARNING) << "Failed to compile optimized code: "
+                         << maybe_fn_ptr.status().ToString();
+      return;
+    }
+    jit_fns.push_back(reinterpret_cast<EvalFunc>(*maybe_fn_ptr));
+  }
+  for (size_t i = 0; i < compiled_exprs_.size(); ++i) {
+    compiled_exprs_[i]->SetJITFunction(selection_vector_mode_, jit_fns[i]);
+  }
+}
+
 /// \brief Build the code for the expression trees for default mode. Each
 /// element in the vector represents an expression tree
 Status LLVMGenerator::Build(const ExpressionVector& exprs) {
@@ -129,6 +157,7 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const SelectionVector* selection_vector,
                               const ArrayDataVector& output_vector) const {
   DCHECK_GT(record_batch.num_rows(), 0);
+  UseOptimizedFunctionsIfReady();
 
   auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
   DCHECK_GT(eval_batch->GetNumBuffers(), 0);
@@ -19,7 +19,9 @@
 
 #include <cstdint>
 #include <functional>
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <vector>
@@ -97,6 +99,9 @@ class GANDIVA_EXPORT LLVMGenerator {
   llvm::LLVMContext* context() { return engine_->context(); }
   llvm::IRBuilder<>* ir_builder() { return engine_->ir_builder(); }
 
+  /// With tiered compilation, switch to the optimized functions once they are compiled.
+  void UseOptimizedFunctionsIfReady() const;
+
   /// Visitor to generate the code for a decomposed expression.
   class Visitor : public DexVisitor {
    public:
@@ -260,6 +265,10 @@ class GANDIVA_EXPORT LLVMGenerator {
   Annotator annotator_;
   SelectionVector::Mode selection_vector_mode_;
 
+  // whether the functions are to be replaced by the optimized ones being compiled
+  mutable std::atomic<bool> optimizing_{false};
+  mutable std::mutex optimizing_mutex_;
+
   // used for debug
   bool enable_ir_traces_;
   std::vector<std::string> trace_strings_;
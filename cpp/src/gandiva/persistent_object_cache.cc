@@ -0,0 +1,332 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/persistent_object_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4141)
+#pragma warning(disable : 4146)
+#pragma warning(disable : 4244)
+#pragma warning(disable : 4267)
+#pragma warning(disable : 4624)
+#endif
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Config/llvm-config.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/raw_ostream.h>
+#if LLVM_VERSION_MAJOR >= 18
+#include <llvm/TargetParser/Host.h>
+#else
+#include <llvm/Support/Host.h>
+#endif
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+#include "arrow/util/config.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace gandiva {
+
+namespace {
+
+constexpr int64_t kDefaultCapacity = 512 << 20;
+constexpr char kFileSuffix[] = ".gdvobj";
+constexpr char kTempFileSuffix[] = ".tmp";
+// Temporary files left over by a crashed process are deleted after an hour
+constexpr std::chrono::hours kTempFileLifetime{1};
+
+// A file starts with this header followed by the full key, then by the object
+// code at the next multiple of kObjectAlignment.
+struct FileHeader {
+  char magic[8];
+  uint64_t key_size;
+  uint64_t object_size;
+};
+
+constexpr char kMagic[8] = {'G', 'D', 'V', 'O', 'B', 'J', '0', '1'};
+constexpr size_t kObjectAlignment = 16;
+
+size_t ObjectOffset(size_t key_size) {
+  const size_t size = sizeof(FileHeader) + key_size;
+  return (size + kObjectAlignment - 1) / kObjectAlignment * kObjectAlignment;
+}
+
+std::string MakeFileHeader(const std::string& full_key, size_t object_size) {
+  FileHeader header;
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.key_size = full_key.size();
+  header.object_size = object_size;
+  std::string out(reinterpret_cast<const char*>(&header), sizeof(header));
+  out += full_key;
+  out.resize(ObjectOffset(full_key.size()), '\0');
+  return out;
+}
+
+// The offset of the object code in the file contents, or nullopt if they aren't
+// a valid file for this key, e.g. on hash collisions.
+std::optional<size_t> FindObjectCode(llvm::StringRef contents,
+                                     const std::string& full_key) {
+  FileHeader header;
+  if (contents.size() < sizeof(header)) {
+    return std::nullopt;
+  }
+  std::memcpy(&header, contents.data(), sizeof(header));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.key_size != full_key.size()) {
+    return std::nullopt;
+  }
+  const size_t offset = ObjectOffset(full_key.size());
+  if (contents.size() != offset + header.object_size ||
+      contents.substr(sizeof(header), full_key.size()) != full_key) {
+    return std::nullopt;
+  }
+  return offset;
+}
+
+// A slice of a memory-mapped file, which it keeps mapped
+class ObjectCodeBuffer : public llvm::MemoryBuffer {
+ public:
+  ObjectCodeBuffer(std::unique_ptr<llvm::MemoryBuffer> file, size_t offset)
+      : file_(std::move(file)) {
+    init(file_->getBufferStart() + offset, file_->getBufferEnd(),
+         /*RequiresNullTerminator=*/false);
+  }
+
+  BufferKind getBufferKind() const override { return file_->getBufferKind(); }
+
+ private:
+  std::unique_ptr<llvm::MemoryBuffer> file_;
+};
+
+// Describe what the object code depends on besides the expressions
+std::string MakeEnvironment() {
+  std::string environment = "gandiva " ARROW_VERSION_STRING " llvm " LLVM_VERSION_STRING;
+  environment += " " + llvm::sys::getDefaultTargetTriple();
+  environment += " " + llvm::sys::getHostCPUName().str();
+  llvm::StringMap<bool> host_features;
+  std::vector<std::string> features;
+  if (llvm::sys::getHostCPUFeatures(host_features)) {
+    for (auto& f : host_features) {
+      features.push_back((f.second ? "+" : "-") + f.first().str());
+    }
+  }
+  std::sort(features.begin(), features.end());
+  for (const auto& feature : features) {
+    environment += " " + feature;
+  }
+  return environment;
+}
+
+}  // namespace
+
+int64_t GetPersistentCacheCapacity() {
+  int64_t capacity = kDefaultCapacity;
+  auto maybe_env_capacity = ::arrow::internal::GetEnvVar("GANDIVA_CACHE_DIR_CAPACITY");
+  if (maybe_env_capacity.ok()) {
+    const auto env_capacity = *std::move(maybe_env_capacity);
+    if (!env_capacity.empty()) {
+      capacity = std::atoll(env_capacity.c_str());
+      if (capacity <= 0) {
+        ARROW_LOG(WARNING) << "Invalid capacity provided in GANDIVA_CACHE_DIR_CAPACITY. "
+                           << "Using default capacity: " << kDefaultCapacity;
+        capacity = kDefaultCapacity;
+      }
+    }
+  }
+  return capacity;
+}
+
+PersistentObjectCache::PersistentObjectCache(std::string directory, int64_t capacity)
+    : directory_(std::move(directory)),
+      capacity_(capacity),
+      environment_(MakeEnvironment()) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_ = Evict();
+}
+
+std::shared_ptr<PersistentObjectCache> PersistentObjectCache::GetDefault() {
+  static std::shared_ptr<PersistentObjectCache> cache =
+      []() -> std::shared_ptr<PersistentObjectCache> {
+    auto maybe_directory = ::arrow::internal::GetEnvVar("GANDIVA_CACHE_DIR");
+    if (!maybe_directory.ok() || maybe_directory->empty()) {
+      return nullptr;
+    }
+    const auto directory = *std::move(maybe_directory);
+    if (auto error = llvm::sys::fs::create_directories(directory)) {
+      ARROW_LOG(WARNING) << "Could not create the Gandiva cache directory " << directory
+                         << ": " << error.message();
+      return nullptr;
+    }
+    const int64_t capacity = GetPersistentCacheCapacity();
+    ARROW_LOG(INFO) << "Using gandiva cache directory " << directory
+                    << " with capacity of " << capacity << " bytes";
+    return std::make_shared<PersistentObjectCache>(directory, capacity);
+  }();
+  return cache;
+}
+
+std::string PersistentObjectCache::FullKey(const std::string& key) const {
+  return environment_ + "\n" + key;
+}
+
+std::string PersistentObjectCache::PathOf(const std::string& full_key) const {
+  const uint64_t hash =
+      ::arrow::internal::ComputeStringHash<0>(full_key.data(), full_key.size());
+  llvm::SmallString<128> path(directory_);
+  llvm::sys::path::append(path, llvm::utohexstr(hash) + kFileSuffix);
+  return std::string(path.str());
+}
+
+std::unique_ptr<llvm::MemoryBuffer> PersistentObjectCache::Get(const std::string& key) {
+  const std::string full_key = FullKey(key);
+  const std::string path = PathOf(full_key);
+  int fd;
+  if (llvm::sys::fs::openFileForRead(path, fd)) {
+    return nullptr;
+  }
+  // The modification time is the time of last use, for eviction
+  llvm::sys::fs::setLastAccessAndModificationTime(fd, std::chrono::system_clock::now());
+  auto maybe_file = llvm::MemoryBuffer::getOpenFile(
+      llvm::sys::fs::convertFDToNativeFile(fd), path, /*FileSize=*/-1,
+      /*RequiresNullTerminator=*/false);
+  llvm::sys::Process::SafelyCloseFileDescriptor(fd);
+  if (!maybe_file) {
+    ARROW_LOG(WARNING) << "Could not read the Gandiva cache file " << path << ": "
+                       << maybe_file.getError().message();
+    return nullptr;
+  }
+  std::unique_ptr<llvm::MemoryBuffer> file = std::move(*maybe_file);
+  const auto offset = FindObjectCode(file->getBuffer(), full_key);
+  if (!offset.has_value()) {
+    return nullptr;
+  }
+  return std::make_unique<ObjectCodeBuffer>(std::move(file), *offset);
+}
+
+void PersistentObjectCache::Put(const std::string& key, llvm::StringRef object_code) {
+  const std::string full_key = FullKey(key);
+  const std::string path = PathOf(full_key);
+  const std::string header = MakeFileHeader(full_key, object_code.size());
+
+  // Write a temporary file then rename it, so that other processes never read
+  // partially written files
+  int fd;
+  llvm::SmallString<128> temp_path;
+  if (auto error = llvm::sys::fs::createUniqueFile(
+          path + ".%%%%%%%%" + kTempFileSuffix, fd, temp_path)) {
+    ARROW_LOG(WARNING) << "Could not create a file in the Gandiva cache directory "
+                       << directory_ << ": " << error.message();
+    return;
+  }
+  std::error_code error;
+  {
+    llvm::raw_fd_ostream out(fd, /*shouldClose=*/true);
+    out << header << object_code;
+    out.close();
+    error = out.error();
+    out.clear_error();
+  }
+  if (!error) {
+    error = llvm::sys::fs::rename(temp_path, path);
+  }
+  if (error) {
+    ARROW_LOG(WARNING) << "Could not write the Gandiva cache file " << path << ": "
+                       << error.message();
+    llvm::sys::fs::remove(temp_path);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_ += static_cast<int64_t>(header.size() + object_code.size());
+  if (size_ > capacity_) {
+    size_ = Evict();
+  }
+}
+
+int64_t PersistentObjectCache::Evict() {
+  struct Entry {
+    llvm::sys::TimePoint<> last_used;
+    int64_t size;
+    std::string path;
+  };
+  std::vector<Entry> entries;
+  int64_t total_size = 0;
+  const auto now = std::chrono::system_clock::now();
+
+  std::error_code error;
+  for (llvm::sys::fs::directory_iterator it(directory_, error), end; it != end && !error;
+       it.increment(error)) {
+    const std::string& path = it->path();
+    llvm::sys::fs::file_status status;
+    if (llvm::sys::fs::status(path, status)) {
+      // Deleted by another process
+      continue;
+    }
+    const auto last_used = status.getLastModificationTime();
+    const auto extension = llvm::sys::path::extension(path);
+    if (extension == kTempFileSuffix) {
+      if (now - last_used > kTempFileLifetime) {
+        llvm::sys::fs::remove(path);
+      }
+    } else if (extension == kFileSuffix) {
+      const auto size = static_cast<int64_t>(status.getSize());
+      entries.push_back({last_used, size, path});
+      total_size += size;
+    }
+  }
+  if (error) {
+    ARROW_LOG(WARNING) << "Could not list the Gandiva cache directory " << directory_
+                       << ": " << error.message();
+  }
+  if (total_size <= capacity_) {
+    return total_size;
+  }
+
+  // Leave some headroom so that the directory isn't listed again on the next put
+  const int64_t target_size = capacity_ - capacity_ / 10;
+  std::sort(entries.begin(), entries.end(), [](const Entry& left, const Entry& right) {
+    return left.last_used < right.last_used;
+  });
+  for (const auto& entry : entries) {
+    if (total_size <= target_size) {
+      break;
+    }
+    llvm::sys::fs::remove(entry.path);
+    total_size -= entry.size;
+  }
+  return total_size;
+}
+
+}  // namespace gandiva
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "gandiva/visibility.h"
+
+namespace llvm {
+class MemoryBuffer;
+class StringRef;
+}  // namespace llvm
+
+namespace gandiva {
+
+GANDIVA_EXPORT
+int64_t GetPersistentCacheCapacity();
+
+/// \brief A directory of compiled object code, shared between processes.
+///
+/// The object code of each expression is stored in its own file, named after the
+/// hash of its key, and loaded by memory-mapping that file. Keys are prefixed
+/// with the Gandiva and LLVM versions and the host CPU, so that processes with
+/// a different environment don't share object code.
+///
+/// The total size of the files is bounded by the capacity, the least recently
+/// used files being evicted first. Errors are logged and otherwise ignored: the
+/// object code is compiled again on a miss.
+class GANDIVA_EXPORT PersistentObjectCache {
+ public:
+  PersistentObjectCache(std::string directory, int64_t capacity);
+
+  /// \brief The cache in the GANDIVA_CACHE_DIR directory, with a capacity of
+  /// GANDIVA_CACHE_DIR_CAPACITY bytes, or null if GANDIVA_CACHE_DIR isn't set.
+  static std::shared_ptr<PersistentObjectCache> GetDefault();
+
+  /// \brief Get the object code stored for the key, or null if there is none.
+  std::unique_ptr<llvm::MemoryBuffer> Get(const std::string& key);
+
+  /// \brief Store the object code for the key, replacing any previous one.
+  void Put(const std::string& key, llvm::StringRef object_code);
+
+  const std::string& directory() const { return directory_; }
+  int64_t capacity() const { return capacity_; }
+
+ private:
+  std::string FullKey(const std::string& key) const;
+  std::string PathOf(const std::string& full_key) const;
+  // Delete the least recently used files until the total size is within the
+  // capacity, and return the total size.
+  int64_t Evict();
+
+  const std::string directory_;
+  const int64_t capacity_;
+  const std::string environment_;
+
+  std::mutex mutex_;
+  // Approximate total size of the files, other processes also writing to the
+  // directory. The directory is only scanned when it exceeds the capacity.
+  int64_t size_;
+};
+
+}  // namespace gandiva
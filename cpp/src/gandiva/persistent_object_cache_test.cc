@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/persistent_object_cache.h"
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace gandiva {
+
+class TestPersistentObjectCache : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(temp_dir_,
+                         ::arrow::internal::TemporaryDir::Make("gandiva-cache-test-"));
+    directory_ = temp_dir_->path().ToString();
+  }
+
+  std::vector<std::string> ListFiles() {
+    std::vector<std::string> files;
+    auto entries = ::arrow::internal::ListDir(temp_dir_->path()).ValueOrDie();
+    for (const auto& entry : entries) {
+      files.push_back(temp_dir_->path().Join(entry.ToString()).ValueOrDie().ToString());
+    }
+    return files;
+  }
+
+  int64_t TotalSize() {
+    int64_t total_size = 0;
+    for (const auto& file : ListFiles()) {
+      std::ifstream stream(file, std::ios::binary | std::ios::ate);
+      total_size += static_cast<int64_t>(stream.tellg());
+    }
+    return total_size;
+  }
+
+  std::string Get(PersistentObjectCache* cache, const std::string& key) {
+    auto buffer = cache->Get(key);
+    return buffer == nullptr ? "<null>" : buffer->getBuffer().str();
+  }
+
+  std::unique_ptr<::arrow::internal::TemporaryDir> temp_dir_;
+  std::string directory_;
+};
+
+TEST_F(TestPersistentObjectCache, TestGetPut) {
+  PersistentObjectCache cache(directory_, 1 << 20);
+  ASSERT_EQ(Get(&cache, "key1"), "<null>");
+  cache.Put("key1", "object code 1");
+  cache.Put("key2", "object code 2");
+  ASSERT_EQ(Get(&cache, "key1"), "object code 1");
+  ASSERT_EQ(Get(&cache, "key2"), "object code 2");
+  ASSERT_EQ(Get(&cache, "key3"), "<null>");
+
+  cache.Put("key1", "other object code 1");
+  ASSERT_EQ(Get(&cache, "key1"), "other object code 1");
+  ASSERT_EQ(ListFiles().size(), 2U);
+
+  // As if in another process
+  PersistentObjectCache other_cache(directory_, 1 << 20);
+  ASSERT_EQ(Get(&other_cache, "key1"), "other object code 1");
+  ASSERT_EQ(Get(&other_cache, "key2"), "object code 2");
+}
+
+TEST_F(TestPersistentObjectCache, TestInvalidFile) {
+  PersistentObjectCache cache(directory_, 1 << 20);
+  cache.Put("key", "object code");
+  auto files = ListFiles();
+  ASSERT_EQ(files.size(), 1U);
+  {
+    std::ofstream file(files[0], std::ios::binary | std::ios::trunc);
+    file << "GDVOBJ01 truncated";
+  }
+  ASSERT_EQ(Get(&cache, "key"), "<null>");
+}
+
+TEST_F(TestPersistentObjectCache, TestEvict) {
+  const std::string object_code(1000, 'x');
+  {
+    PersistentObjectCache cache(directory_, 1 << 20);
+    cache.Put("key10", object_code);
+  }
+  const int64_t file_size = TotalSize();
+  ASSERT_GT(file_size, static_cast<int64_t>(object_code.size()));
+
+  const int64_t capacity = 5 * file_size;
+  PersistentObjectCache cache(directory_, capacity);
+  for (int i = 11; i < 30; ++i) {
+    cache.Put("key" + std::to_string(i), object_code);
+  }
+  ASSERT_LE(TotalSize(), capacity);
+  ASSERT_EQ(Get(&cache, "key29"), object_code);
+  ASSERT_EQ(Get(&cache, "key10"), "<null>");
+
+  // The capacity is also enforced when opening the directory
+  PersistentObjectCache smaller_cache(directory_, file_size * 3 / 2);
+  ASSERT_EQ(ListFiles().size(), 1U);
+  ASSERT_EQ(Get(&smaller_cache, "key29"), object_code);
+}
+
+}  // namespace gandiva
@@ -150,6 +150,24 @@ gdv_int32 utf8_char_length(char c) {
   return 0;
 }
 
+// The number of ASCII bytes at the start of the data, which are each a glyph. They
+// are found a word at a time, since most strings are entirely ASCII.
+FORCE_INLINE
+gdv_int32 ascii_prefix_length(const char* data, gdv_int32 data_len) {
+  gdv_int32 i = 0;
+  for (; i + 8 <= data_len; i += 8) {
+    uint64_t word;
+    memcpy(&word, data + i, sizeof(word));
+    if ((word & 0x8080808080808080ULL) != 0) {
+      break;
+    }
+  }
+  while (i < data_len && (signed char)data[i] >= 0) {
+    ++i;
+  }
+  return i;
+}
+
 FORCE_INLINE
 void set_error_for_invalid_utf(int64_t execution_context, char val) {
   char const* fmt = "unexpected byte \\%02hhx encountered while decoding utf8 string";
@@ -176,8 +194,8 @@ bool validate_utf8_following_bytes(const char* data, int32_t data_len,
 FORCE_INLINE
 gdv_int32 utf8_length(gdv_int64 context, const char* data, gdv_int32 data_len) {
   int char_len = 0;
-  int count = 0;
-  for (int i = 0; i < data_len; i += char_len) {
+  int count = ascii_prefix_length(data, data_len);
+  for (int i = count; i < data_len; i += char_len) {
     char_len = utf8_char_length(data[i]);
     if (char_len == 0 || i + char_len > data_len) {  // invalid byte or incomplete glyph
       set_error_for_invalid_utf(context, data[i]);
@@ -198,8 +216,8 @@ gdv_int32 utf8_length(gdv_int64 context, const char* data, gdv_int32 data_len) {
 FORCE_INLINE
 gdv_int32 utf8_length_ignore_invalid(const char* data, gdv_int32 data_len) {
   int char_len = 0;
-  int count = 0;
-  for (int i = 0; i < data_len; i += char_len) {
+  int count = ascii_prefix_length(data, data_len);
+  for (int i = count; i < data_len; i += char_len) {
     char_len = utf8_char_length(data[i]);
     if (char_len == 0 || i + char_len > data_len) {  // invalid byte or incomplete glyph
       // if invalid byte or incomplete glyph, ignore it
@@ -221,8 +239,8 @@ FORCE_INLINE
 gdv_int32 utf8_byte_pos(gdv_int64 context, const char* str, gdv_int32 str_len,
                         gdv_int32 char_pos) {
   int char_len = 0;
-  int byte_index = 0;
-  for (gdv_int32 char_index = 0; char_index < char_pos && byte_index < str_len;
+  int byte_index = ascii_prefix_length(str, char_pos < str_len ? char_pos : str_len);
+  for (gdv_int32 char_index = byte_index; char_index < char_pos && byte_index < str_len;
        char_index++) {
     char_len = utf8_char_length(str[byte_index]);
     if (char_len == 0 ||
@@ -792,17 +810,23 @@ const char* substr_utf8_int64_int64(gdv_int64 context, const char* input,
   gdv_int64 start_pos = 0;
   gdv_int64 end_pos = in_data_len64;
 
-  gdv_int64 current_glyph = 0;
-  gdv_int64 pos = 0;
-  while (pos < in_data_len64) {
-    if (current_glyph == from_glyph) {
-      start_pos = pos;
-    }
-    pos += static_cast<gdv_int64>(utf8_char_length(input[pos]));
-    if (current_glyph - from_glyph + 1 == out_glyphs_count) {
-      end_pos = pos;
+  if (in_glyphs_count == in_data_len64) {
+    // ASCII input, where glyphs are bytes
+    start_pos = from_glyph;
+    end_pos = from_glyph + out_glyphs_count;
+  } else {
+    gdv_int64 current_glyph = 0;
+    gdv_int64 pos = 0;
+    while (pos < in_data_len64) {
+      if (current_glyph == from_glyph) {
+        start_pos = pos;
+      }
+      pos += static_cast<gdv_int64>(utf8_char_length(input[pos]));
+      if (current_glyph - from_glyph + 1 == out_glyphs_count) {
+        end_pos = pos;
+      }
+      current_glyph++;
     }
-    current_glyph++;
   }
 
   if (end_pos > in_data_len64 || end_pos > INT_MAX) {
@@ -17,11 +17,17 @@
 
 #include "gandiva/projector.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/concatenate.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 #include "gandiva/cache.h"
 #include "gandiva/expr_validator.h"
@@ -29,6 +35,28 @@
 
 namespace gandiva {
 
+namespace {
+
+// The ranges evaluated in parallel start at multiples of this many rows, so that they
+// write disjoint 64-bit words of the output bitmaps
+constexpr int64_t kParallelRangeAlignment = 64;
+// Ranges are at least this long, so that each task amortizes its overhead
+constexpr int64_t kMinParallelRangeSize = 16 * 1024;
+
+// A view of the rows [offset, offset + length) of a fixed-width output, with a zero
+// offset since the generated code ignores the offsets of outputs
+ArrayDataPtr SliceFixedWidthOutput(const ArrayDataPtr& data, int64_t offset,
+                                   int64_t length) {
+  const auto& type = arrow::internal::checked_cast<const arrow::FixedWidthType&>(
+      *data->type);
+  std::vector<std::shared_ptr<arrow::Buffer>> buffers = {
+      arrow::SliceMutableBuffer(data->buffers[0], offset / 8),
+      arrow::SliceMutableBuffer(data->buffers[1], offset * type.bit_width() / 8)};
+  return arrow::ArrayData::Make(data->type, length, std::move(buffers));
+}
+
+}  // namespace
+
 Projector::Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
                      const FieldVector& output_fields,
                      std::shared_ptr<Configuration> configuration)
@@ -67,18 +95,11 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   ExpressionCacheKey cache_key(schema, configuration, exprs, selection_vector_mode);
 
-  bool is_cached = false;
-
-  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
-
-  // Verify if previous projector obj code was cached
-  if (prev_cached_obj != nullptr) {
-    is_cached = true;
-  }
-
   GandivaObjectCache obj_cache(cache, cache_key);
 
+  // Verify if previous projector obj code was cached, by this or another process
+  bool is_cached = obj_cache.GetCachedObject() != nullptr;
+
   // Build LLVM generator, and generate code for the specified expressions
   ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
                         LLVMGenerator::Make(configuration, is_cached, obj_cache));
@@ -184,6 +205,74 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   return Status::OK();
 }
 
+Status Projector::EvaluateParallel(const arrow::RecordBatch& batch,
+                                   arrow::MemoryPool* pool, arrow::ArrayVector* output,
+                                   arrow::internal::Executor* executor) const {
+  ARROW_RETURN_NOT_OK(ValidateEvaluateArgsCommon(batch));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+  if (executor == nullptr) {
+    executor = arrow::internal::GetCpuThreadPool();
+  }
+
+  const int64_t num_rows = batch.num_rows();
+  int64_t num_ranges = std::min<int64_t>(executor->GetCapacity(),
+                                         num_rows / kMinParallelRangeSize);
+  if (num_ranges <= 1) {
+    return Evaluate(batch, nullptr, pool, output);
+  }
+  const int64_t range_size = arrow::bit_util::RoundUp(
+      arrow::bit_util::CeilDiv(num_rows, num_ranges), kParallelRangeAlignment);
+  num_ranges = arrow::bit_util::CeilDiv(num_rows, range_size);
+  auto range_length = [&](int64_t range) {
+    return std::min(range_size, num_rows - range * range_size);
+  };
+
+  // Fixed-width outputs are allocated for the whole batch, and sliced for each range
+  ArrayDataVector output_data_vecs(output_fields_.size());
+  std::vector<ArrayDataVector> range_data_vecs(num_ranges,
+                                               ArrayDataVector(output_fields_.size()));
+  for (size_t i = 0; i < output_fields_.size(); ++i) {
+    const auto& type = output_fields_[i]->type();
+    if (arrow::is_binary_like(type->id())) {
+      for (int64_t range = 0; range < num_ranges; ++range) {
+        ARROW_RETURN_NOT_OK(
+            AllocArrayData(type, range_length(range), pool, &range_data_vecs[range][i]));
+      }
+      continue;
+    }
+    ARROW_RETURN_NOT_OK(AllocArrayData(type, num_rows, pool, &output_data_vecs[i]));
+    for (int64_t range = 0; range < num_ranges; ++range) {
+      range_data_vecs[range][i] = SliceFixedWidthOutput(
+          output_data_vecs[i], range * range_size, range_length(range));
+    }
+  }
+
+  ARROW_RETURN_NOT_OK(arrow::internal::ParallelFor(
+      static_cast<int>(num_ranges),
+      [&](int range) {
+        auto range_batch = batch.Slice(range * range_size, range_length(range));
+        return llvm_generator_->Execute(*range_batch, nullptr, range_data_vecs[range]);
+      },
+      executor));
+
+  // Stitch the variable-width outputs of the ranges together
+  output->clear();
+  for (size_t i = 0; i < output_fields_.size(); ++i) {
+    if (output_data_vecs[i] != nullptr) {
+      output->push_back(arrow::MakeArray(output_data_vecs[i]));
+      continue;
+    }
+    arrow::ArrayVector range_arrays;
+    for (const auto& range_data_vec : range_data_vecs) {
+      range_arrays.push_back(arrow::MakeArray(range_data_vec[i]));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto array, arrow::Concatenate(range_arrays, pool));
+    output->push_back(std::move(array));
+  }
+  return Status::OK();
+}
+
 // TODO : handle complex vectors (list/map/..)
 Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
                                  arrow::MemoryPool* pool,
@@ -23,6 +23,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/type_fwd.h"
 
 #include "gandiva/arrow.h"
 #include "gandiva/configuration.h"
@@ -118,6 +119,23 @@ class GANDIVA_EXPORT Projector {
                   const SelectionVector* selection_vector,
                   const ArrayDataVector& output) const;
 
+  /// Evaluate the specified record batch like Evaluate, splitting its rows in ranges
+  /// which are evaluated in parallel. Fixed-width outputs are allocated once and each
+  /// range populates its own slice of them, while variable-width outputs are allocated
+  /// for each range and concatenated at the end. Batches too small to be worth
+  /// splitting are evaluated on the calling thread.
+  ///
+  /// This waits for the ranges to be evaluated, so it must not be called from a thread
+  /// of the executor.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays.
+  /// \param[out] output the vector of allocated/populated arrays.
+  /// \param[in] executor executor to evaluate the ranges on, the CPU thread pool if null.
+  Status EvaluateParallel(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                          arrow::ArrayVector* output,
+                          arrow::internal::Executor* executor = NULLPTR) const;
+
   const std::string& DumpIR();
 
   void SetBuiltFromCache(bool flag);
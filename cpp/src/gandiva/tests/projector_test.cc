@@ -26,6 +26,7 @@
 #include <cmath>
 
 #include "arrow/memory_pool.h"
+#include "arrow/util/thread_pool.h"
 #include "gandiva/function_registry.h"
 #include "gandiva/literal_holder.h"
 #include "gandiva/node.h"
@@ -295,6 +296,102 @@ TEST_F(TestProjector, TestIntSumSub) {
   EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
 }
 
+TEST_F(TestProjector, TestIntSumSubTiered) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f2", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_sub = field("subtract", int32());
+
+  // Build expression
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto sub_expr =
+      TreeExprBuilder::MakeExpression("subtract", {field0, field1}, field_sub);
+
+  auto configuration = std::make_shared<Configuration>(*TestConfiguration());
+  configuration->set_tiered_compilation(true);
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr, sub_expr}, configuration, &projector));
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 15, 17}, {true, true, false, true});
+  // expected output
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 0, 0}, {true, true, false, false});
+  auto exp_sub = MakeArrowArrayInt32({-10, -11, 0, 0}, {true, true, false, false});
+
+  // prepare input record batch
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  // The results are the same with the unoptimized and optimized code
+  for (int i = 0; i < 3; ++i) {
+    arrow::ArrayVector outputs;
+    ASSERT_OK(projector->Evaluate(*in_batch, pool_, &outputs));
+    EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+    EXPECT_ARROW_ARRAY_EQUALS(exp_sub, outputs.at(1));
+  }
+}
+
+TEST_F(TestProjector, TestEvaluateParallel) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto field2 = field("f2", utf8());
+  auto schema = arrow::schema({field0, field1, field2});
+
+  // Fixed-width, boolean and variable-width outputs
+  auto sum_expr =
+      TreeExprBuilder::MakeExpression("add", {field0, field1}, field("add", int32()));
+  auto isnull_expr =
+      TreeExprBuilder::MakeExpression("isnull", {field0}, field("isnull", boolean()));
+  auto concat_expr = TreeExprBuilder::MakeExpression("concatOperator", {field2, field2},
+                                                     field("concat", utf8()));
+  std::shared_ptr<Projector> projector;
+  ASSERT_OK(Projector::Make(schema, {sum_expr, isnull_expr, concat_expr},
+                            TestConfiguration(), &projector));
+
+  // Large enough to be split in several ranges
+  const int num_records = 100003;
+  std::vector<int32_t> values0(num_records), values1(num_records);
+  std::vector<std::string> values2(num_records);
+  std::vector<bool> validity0(num_records), validity1(num_records);
+  for (int i = 0; i < num_records; ++i) {
+    values0[i] = i;
+    values1[i] = 3 * i;
+    values2[i] = std::string(i % 5, static_cast<char>('a' + i % 26));
+    validity0[i] = i % 7 != 3;
+    validity1[i] = i % 11 != 5;
+  }
+  auto in_batch = arrow::RecordBatch::Make(
+      schema, num_records,
+      {MakeArrowArrayInt32(values0, validity0), MakeArrowArrayInt32(values1, validity1),
+       MakeArrowArrayUtf8(values2, validity1)});
+
+  ASSERT_OK_AND_ASSIGN(auto executor, arrow::internal::ThreadPool::Make(4));
+  // The ranges are the same whatever the offset of the batch
+  for (int64_t offset : {0, 3, 100}) {
+    auto batch = in_batch->Slice(offset);
+    arrow::ArrayVector expected, outputs;
+    ASSERT_OK(projector->Evaluate(*batch, pool_, &expected));
+    ASSERT_OK(projector->EvaluateParallel(*batch, pool_, &outputs, executor.get()));
+    ASSERT_EQ(outputs.size(), expected.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+      ASSERT_OK(outputs[i]->ValidateFull());
+      EXPECT_ARROW_ARRAY_EQUALS(expected[i], outputs[i]);
+    }
+  }
+
+  // Small batches are evaluated on the calling thread
+  auto small_batch = in_batch->Slice(0, 10);
+  arrow::ArrayVector expected, outputs;
+  ASSERT_OK(projector->Evaluate(*small_batch, pool_, &expected));
+  ASSERT_OK(projector->EvaluateParallel(*small_batch, pool_, &outputs, executor.get()));
+  EXPECT_ARROW_ARRAY_EQUALS(expected[2], outputs[2]);
+}
+
 template <typename TYPE, typename C_TYPE>
 static void TestArithmeticOpsForType(arrow::MemoryPool* pool) {
   auto atype = arrow::TypeTraits<TYPE>::type_singleton();
@@ -50,6 +50,7 @@
 #include "arrow/util/config.h"  // for ARROW_CSV definition
 #include "arrow/util/decimal.h"
 #include "arrow/util/future.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
@@ -2618,6 +2619,41 @@ TEST(TestArrowReadWrite, ReadCoalescedColumnSubset) {
   }
 }
 
+TEST(TestArrowReadWrite, ReadCoalescedWithMemoryLimit) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, num_rows / 4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  for (bool lazy : {false, true}) {
+    ARROW_SCOPED_TRACE("lazy = ", lazy);
+    auto cache_options = lazy ? ::arrow::io::CacheOptions::LazyDefaults()
+                              : ::arrow::io::CacheOptions::Defaults();
+    // Smaller than a column chunk, so that column chunks are cached and read one
+    // at a time
+    cache_options.hole_size_limit = 1;
+    cache_options.range_size_limit = 2;
+    cache_options.memory_limit = 1;
+
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ArrowReaderProperties arrow_properties = default_arrow_reader_properties();
+    arrow_properties.set_pre_buffer(true);
+    arrow_properties.set_cache_options(cache_options);
+    ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+    ASSERT_OK(builder.properties(arrow_properties)->Build(&reader));
+    reader->set_use_threads(true);
+
+    std::shared_ptr<Table> result;
+    ASSERT_OK(reader->ReadTable(&result));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result, false));
+  }
+}
+
 TEST(TestArrowReadWrite, ListLargeRecords) {
   // PARQUET-1308: This test passed on Linux when num_rows was smaller
   const int num_rows = 2000;
@@ -5265,6 +5301,132 @@ TEST(TestArrowReadWrite, WriteRecordBatchNotProduceEmptyRowGroup) {
   }
 }
 
+TEST(TestArrowReadWrite, MaxRowGroupBytes) {
+  // Plain encoded non-nullable int64 values take 8 bytes per row, so a row group
+  // is closed every 16 KiB / 8 = 2048 rows.
+  constexpr int64_t kNumRows = 10000;
+  auto writer_properties = WriterProperties::Builder()
+                               .max_row_group_bytes(16 * 1024)
+                               ->write_batch_size(256)
+                               ->disable_dictionary()
+                               ->encoding(Encoding::PLAIN)
+                               ->build();
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::int64(), false)});
+  auto gen = ::arrow::random::RandomArrayGenerator(/*seed=*/42);
+  auto record_batch = gen.BatchOf({schema->field(0)}, kNumRows);
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({record_batch}));
+
+  for (bool use_threads : {false, true}) {
+    for (bool write_table : {false, true}) {
+      ARROW_SCOPED_TRACE("use_threads = ", use_threads, ", write_table = ", write_table);
+      auto arrow_writer_properties =
+          ArrowWriterProperties::Builder().set_use_threads(use_threads)->build();
+      auto sink = CreateOutputStream();
+      ASSERT_OK_AND_ASSIGN(auto writer,
+                           FileWriter::Open(*schema, ::arrow::default_memory_pool(), sink,
+                                            writer_properties, arrow_writer_properties));
+      if (write_table) {
+        ASSERT_OK_NO_THROW(writer->WriteTable(*table, kNumRows));
+      } else {
+        ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*record_batch->Slice(0, 3000)));
+        ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*record_batch->Slice(3000)));
+      }
+      ASSERT_OK_NO_THROW(writer->Close());
+
+      auto file_metadata = writer->metadata();
+      ASSERT_EQ(5, file_metadata->num_row_groups());
+      for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(2048, file_metadata->RowGroup(i)->num_rows());
+      }
+      EXPECT_EQ(kNumRows - 4 * 2048, file_metadata->RowGroup(4)->num_rows());
+
+      ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+      std::unique_ptr<FileReader> reader;
+      ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer),
+                                  ::arrow::default_memory_pool(), &reader));
+      std::shared_ptr<Table> result;
+      ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+      AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+    }
+  }
+}
+
+TEST(TestArrowReadWrite, ZeroCopyPlainValues) {
+  ASSERT_OK_AND_ASSIGN(auto temp_dir,
+                       ::arrow::internal::TemporaryDir::Make("parquet-zero-copy-"));
+  int file_number = 0;
+  auto write_and_map = [&](const Table& table,
+                           const std::shared_ptr<WriterProperties>& properties)
+      -> ::arrow::Result<std::shared_ptr<::arrow::io::MemoryMappedFile>> {
+    ARROW_ASSIGN_OR_RAISE(auto path, temp_dir->path().Join(
+                                         std::to_string(file_number++) + ".parquet"));
+    ARROW_ASSIGN_OR_RAISE(auto sink,
+                          ::arrow::io::FileOutputStream::Open(path.ToString()));
+    RETURN_NOT_OK(WriteTable(table, default_memory_pool(), sink, table.num_rows(),
+                             properties));
+    RETURN_NOT_OK(sink->Close());
+    return ::arrow::io::MemoryMappedFile::Open(path.ToString(),
+                                               ::arrow::io::FileMode::READ);
+  };
+  auto writer_properties = WriterProperties::Builder().disable_dictionary()->build();
+
+  // The values of an uncompressed PLAIN page are sliced from the mapped file when
+  // they are suitably aligned. The padding column moves them across alignments.
+  auto schema = ::arrow::schema({::arrow::field("pad", ::arrow::utf8(), false),
+                                 ::arrow::field("a", ::arrow::int64(), false)});
+  int num_zero_copy = 0;
+  for (int padding = 0; padding < 16; ++padding) {
+    ARROW_SCOPED_TRACE("padding = ", padding);
+    const std::string pad(padding, 'x');
+    auto table = ::arrow::TableFromJSON(
+        schema, {R"([[")" + pad + R"(", 1], ["", 2], ["", 3]])"});
+    ASSERT_OK_AND_ASSIGN(auto source, write_and_map(*table, writer_properties));
+    ASSERT_OK_AND_ASSIGN(auto file_start, source->ReadAt(0, 0));
+    std::unique_ptr<FileReader> reader;
+    ASSERT_OK_NO_THROW(OpenFile(source, default_memory_pool(), &reader));
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+    ::arrow::AssertTablesEqual(*table, *result);
+
+    // A single data page whose values end the column chunk
+    auto column_chunk = reader->parquet_reader()->metadata()->RowGroup(0)->ColumnChunk(1);
+    const int64_t values_offset = column_chunk->data_page_offset() +
+                                  column_chunk->total_compressed_size() -
+                                  table->num_rows() * sizeof(int64_t);
+    const bool zero_copy = result->column(1)->chunk(0)->data()->buffers[1]->data() ==
+                           file_start->data() + values_offset;
+    EXPECT_EQ(values_offset % alignof(int64_t) == 0, zero_copy);
+    num_zero_copy += zero_copy;
+  }
+  ASSERT_GT(num_zero_copy, 0);
+
+  // Batches whose values span several pages or hold nulls are copied
+  auto table = ::arrow::TableFromJSON(
+      ::arrow::schema({::arrow::field("a", ::arrow::int64(), false),
+                       ::arrow::field("b", ::arrow::float64()),
+                       ::arrow::field("c", ::arrow::int32())}),
+      {R"([[1, 1.5, 1], [2, 2.5, null], [3, 3.5, 3], [4, 4.5, 4], [5, 5.5, 5]])"});
+  ASSERT_OK_AND_ASSIGN(auto source, write_and_map(*table, WriterProperties::Builder()
+                                                              .disable_dictionary()
+                                                              ->write_batch_size(2)
+                                                              ->data_pagesize(1)
+                                                              ->build()));
+  for (int64_t batch_size : {1, 2, 3, 5}) {
+    ARROW_SCOPED_TRACE("batch_size = ", batch_size);
+    auto arrow_reader_properties = default_arrow_reader_properties();
+    arrow_reader_properties.set_batch_size(batch_size);
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    ASSERT_OK_NO_THROW(builder.Open(source));
+    ASSERT_OK(builder.properties(arrow_reader_properties)->Build(&reader));
+    std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+    ASSERT_OK_NO_THROW(reader->GetRecordBatchReader(&batch_reader));
+    ASSERT_OK_AND_ASSIGN(auto result, batch_reader->ToTable());
+    ASSERT_OK(result->ValidateFull());
+    ::arrow::AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+  }
+}
+
 TEST(TestArrowReadWrite, MultithreadedWrite) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -5296,6 +5458,99 @@ TEST(TestArrowReadWrite, MultithreadedWrite) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedWriteTable) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Write the columns of each row group of the table in parallel.
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder().write_batch_size(100)->build();
+  auto pool = ::arrow::default_memory_pool();
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  PARQUET_ASSIGN_OR_THROW(
+      auto writer, FileWriter::Open(*table->schema(), pool, sink, std::move(write_props),
+                                    std::move(arrow_properties)));
+  ASSERT_OK_NO_THROW(writer->WriteTable(*table, /*chunk_size=*/300));
+  // A following record batch starts a new row group
+  PARQUET_ASSIGN_OR_THROW(auto batch, table->Slice(0, 100)->CombineChunksToBatch(pool));
+  ASSERT_OK_NO_THROW(writer->WriteRecordBatch(*batch));
+  ASSERT_OK_NO_THROW(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto file_metadata = writer->metadata();
+  ASSERT_EQ(5, file_metadata->num_row_groups());
+  std::vector<int64_t> expected_num_rows = {300, 300, 300, 100, 100};
+  for (int i = 0; i < file_metadata->num_row_groups(); ++i) {
+    EXPECT_EQ(expected_num_rows[i], file_metadata->RowGroup(i)->num_rows());
+  }
+
+  // Read to verify the data.
+  std::shared_ptr<Table> result;
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK_NO_THROW(OpenFile(std::make_shared<BufferReader>(buffer), pool, &reader));
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       ::arrow::ConcatenateTables({table, table->Slice(0, 100)}));
+  ASSERT_NO_FATAL_FAILURE(
+      ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false));
+}
+
+TEST(TestArrowReadWrite, ReadBinaryAsView) {
+  const char* json = R"([
+      ["short", "a binary value of some length"],
+      [null, "x"],
+      ["a string value longer than inline", "a binary value of some length"],
+      ["", "another binary value of some length"],
+      ["a string value longer than inline", null],
+      ["tiny", "y"]
+    ])";
+  auto table = ::arrow::TableFromJSON(
+      ::arrow::schema({::arrow::field("s", ::arrow::utf8()),
+                       ::arrow::field("b", ::arrow::binary())}),
+      {json, json});
+  auto expected = ::arrow::TableFromJSON(
+      ::arrow::schema({::arrow::field("s", ::arrow::utf8_view()),
+                       ::arrow::field("b", ::arrow::binary_view())}),
+      {json, json});
+
+  ArrowReaderProperties reader_properties;
+  reader_properties.set_binary_type(::arrow::Type::BINARY_VIEW);
+  // Views reference dictionary and PLAIN pages, other encodings are copied.
+  std::vector<std::shared_ptr<WriterProperties>> writer_properties = {
+      WriterProperties::Builder().write_batch_size(2)->data_pagesize(1)->build(),
+      WriterProperties::Builder()
+          .write_batch_size(2)
+          ->data_pagesize(1)
+          ->disable_dictionary()
+          ->build(),
+      WriterProperties::Builder()
+          .write_batch_size(2)
+          ->disable_dictionary()
+          ->encoding(Encoding::DELTA_LENGTH_BYTE_ARRAY)
+          ->build()};
+  for (const auto& properties : writer_properties) {
+    std::shared_ptr<Table> result;
+    ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, /*row_group_size=*/4, &result,
+                                        properties, default_arrow_writer_properties(),
+                                        reader_properties));
+    ASSERT_OK(result->ValidateFull());
+    ::arrow::AssertSchemaEqual(*expected->schema(), *result->schema(),
+                               /*check_metadata=*/false);
+    ::arrow::AssertTablesEqual(*expected, *result, /*same_chunk_layout=*/false);
+  }
+
+  reader_properties.set_binary_type(::arrow::Type::LARGE_BINARY);
+  std::shared_ptr<Table> result;
+  ASSERT_NO_FATAL_FAILURE(DoRoundtrip(table, /*row_group_size=*/4, &result,
+                                      default_writer_properties(),
+                                      default_arrow_writer_properties(),
+                                      reader_properties));
+  ASSERT_TRUE(result->schema()->field(0)->type()->Equals(::arrow::large_utf8()));
+  ASSERT_TRUE(result->schema()->field(1)->type()->Equals(::arrow::large_binary()));
+}
+
 TEST(TestArrowReadWrite, FuzzReader) {
   constexpr size_t kMaxFileSize = 1024 * 1024 * 1;
   {
@@ -5650,6 +5905,75 @@ TEST_F(ParquetPageIndexRoundTripTest, MultiplePages) {
                             /*null_counts=*/{0, 0, 1, 2}}));
 }
 
+TEST_F(ParquetPageIndexRoundTripTest, ReadRowRanges) {
+  auto schema = ::arrow::schema({::arrow::field("c0", ::arrow::int64()),
+                                 ::arrow::field("c1", ::arrow::utf8()),
+                                 ::arrow::field("c2", ::arrow::list(::arrow::int32()))});
+  auto table = ::arrow::TableFromJSON(
+      schema, {R"([[0, "a", [1]], [1, "b", null], [2, null, []]])",
+               R"([[3, "d", [2, 3]], [null, "e", [4]], [5, "f", [5, 6, 7]]])",
+               R"([[6, "g", null], [7, "h", [8]], [8, "i", [9, 10]]])",
+               R"([[9, "j", []], [10, null, [11]], [11, "l", [12]]])"});
+  // Two row groups of six rows
+  const std::vector<RowRanges> row_ranges = {RowRanges({{1, 2}, {5, 1}}),
+                                             RowRanges({{2, 3}})};
+  ASSERT_OK_AND_ASSIGN(auto expected,
+                       ::arrow::ConcatenateTables(
+                           {table->Slice(1, 2), table->Slice(5, 1), table->Slice(8, 3)}));
+
+  for (bool write_page_index : {false, true}) {
+    ARROW_SCOPED_TRACE("write_page_index = ", write_page_index);
+    WriterProperties::Builder builder;
+    builder.data_pagesize(1)->max_row_group_length(6);
+    if (write_page_index) {
+      builder.enable_write_page_index();
+    }
+    WriteFile(builder.build(), table);
+
+    std::unique_ptr<FileReader> unique_reader;
+    ASSERT_OK(FileReader::Make(
+        ::arrow::default_memory_pool(),
+        ParquetFileReader::Open(std::make_shared<BufferReader>(buffer_)),
+        &unique_reader));
+    std::shared_ptr<FileReader> reader = std::move(unique_reader);
+    reader->set_batch_size(2);
+
+    std::unique_ptr<::arrow::RecordBatchReader> batch_reader;
+    ASSERT_OK(reader->GetRecordBatchReader({0, 1}, {0, 1, 2}, row_ranges, &batch_reader));
+    ASSERT_OK_AND_ASSIGN(auto actual, batch_reader->ToTable());
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    ASSERT_OK_AND_ASSIGN(auto generator, reader->GetRecordBatchGenerator(
+                                             reader, {0, 1}, {0, 1, 2}, row_ranges));
+    ::arrow::RecordBatchVector batches;
+    while (true) {
+      ASSERT_OK_AND_ASSIGN(auto batch, generator().result());
+      if (batch == nullptr) break;
+      batches.push_back(std::move(batch));
+    }
+    ASSERT_OK_AND_ASSIGN(actual, ::arrow::Table::FromRecordBatches(schema, batches));
+    AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+
+    // Reading only the second row group
+    ASSERT_OK(reader->GetRecordBatchReader({1}, {0}, {row_ranges[1]}, &batch_reader));
+    ASSERT_OK_AND_ASSIGN(actual, batch_reader->ToTable());
+    ASSERT_OK_AND_ASSIGN(auto expected_column, expected->SelectColumns({0}));
+    AssertTablesEqual(*expected_column->Slice(3), *actual, /*same_chunk_layout=*/false);
+
+    std::unique_ptr<ColumnReader> column_reader;
+    ASSERT_OK(reader->GetColumn(2, {0, 1}, row_ranges, &column_reader));
+    std::shared_ptr<ChunkedArray> column;
+    ASSERT_OK(column_reader->NextBatch(table->num_rows(), &column));
+    AssertChunkedEqual(*expected->column(2), *column);
+
+    // Invalid selections
+    ASSERT_RAISES(Invalid, reader->GetRecordBatchReader({0, 1}, {0}, {RowRanges()},
+                                                        &batch_reader));
+    ASSERT_RAISES(Invalid, reader->GetRecordBatchReader(
+                               {0}, {0}, {RowRanges({{4, 3}})}, &batch_reader));
+  }
+}
+
 TEST_F(ParquetPageIndexRoundTripTest, DoubleWithNaNs) {
   auto writer_properties = WriterProperties::Builder()
                                .enable_write_page_index()
@@ -130,9 +130,21 @@ std::shared_ptr<std::unordered_set<int>> VectorToSharedSet(
   return result;
 }
 
+void AddLeafColumnIndices(const SchemaField& field, std::vector<int>* out) {
+  if (field.is_leaf()) {
+    out->push_back(field.column_index);
+  }
+  for (const auto& child : field.children) {
+    AddLeafColumnIndices(child, out);
+  }
+}
+
 // Forward declaration
 Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>& context,
                  std::unique_ptr<ColumnReaderImpl>* out);
+Status GetTopLevelReader(const SchemaField& field,
+                         const std::shared_ptr<ReaderContext>& context,
+                         std::unique_ptr<ColumnReaderImpl>* out);
 
 // ----------------------------------------------------------------------
 // FileReaderImpl forward declaration
@@ -151,9 +163,11 @@ class FileReaderImpl : public FileReader {
                                 reader_properties_, &manifest_);
   }
 
-  FileColumnIteratorFactory SomeRowGroupsFactory(std::vector<int> row_groups) {
-    return [row_groups](int i, ParquetFileReader* reader) {
-      return new FileColumnIterator(i, reader, row_groups);
+  FileColumnIteratorFactory SomeRowGroupsFactory(
+      std::vector<int> row_groups,
+      std::shared_ptr<const RowRangeSelection> selection = nullptr) {
+    return [row_groups, selection](int i, ParquetFileReader* reader) {
+      return new FileColumnIterator(i, reader, row_groups, selection);
     };
   }
 
@@ -202,6 +216,7 @@ class FileReaderImpl : public FileReader {
   Status GetFieldReader(int i,
                         const std::shared_ptr<std::unordered_set<int>>& included_leaves,
                         const std::vector<int>& row_groups,
+                        const std::shared_ptr<const RowRangeSelection>& selection,
                         std::unique_ptr<ColumnReaderImpl>* out) {
     // Should be covered by GetRecordBatchReader checks but
     // manifest_.schema_fields is a separate variable so be extra careful.
@@ -215,14 +230,15 @@ class FileReaderImpl : public FileReader {
     auto ctx = std::make_shared<ReaderContext>();
     ctx->reader = reader_.get();
     ctx->pool = pool_;
-    ctx->iterator_factory = SomeRowGroupsFactory(row_groups);
+    ctx->iterator_factory = SomeRowGroupsFactory(row_groups, selection);
     ctx->filter_leaves = true;
     ctx->included_leaves = included_leaves;
-    return GetReader(manifest_.schema_fields[i], ctx, out);
+    return GetTopLevelReader(manifest_.schema_fields[i], ctx, out);
   }
 
   Status GetFieldReaders(const std::vector<int>& column_indices,
                          const std::vector<int>& row_groups,
+                         const std::shared_ptr<const RowRangeSelection>& selection,
                          std::vector<std::shared_ptr<ColumnReaderImpl>>* out,
                          std::shared_ptr<::arrow::Schema>* out_schema) {
     // We only need to read schema fields which have columns indicated
@@ -236,8 +252,8 @@ class FileReaderImpl : public FileReader {
     ::arrow::FieldVector out_fields(field_indices.size());
     for (size_t i = 0; i < out->size(); ++i) {
       std::unique_ptr<ColumnReaderImpl> reader;
-      RETURN_NOT_OK(
-          GetFieldReader(field_indices[i], included_leaves, row_groups, &reader));
+      RETURN_NOT_OK(GetFieldReader(field_indices[i], included_leaves, row_groups,
+                                   selection, &reader));
 
       out_fields[i] = reader->field();
       out->at(i) = std::move(reader);
@@ -254,6 +270,10 @@ class FileReaderImpl : public FileReader {
     return GetColumn(i, AllRowGroupsFactory(), out);
   }
 
+  Status GetColumn(int i, const std::vector<int>& row_groups,
+                   const std::vector<RowRanges>& row_ranges,
+                   std::unique_ptr<ColumnReader>* out) override;
+
   Status GetSchema(std::shared_ptr<::arrow::Schema>* out) override {
     return FromParquetSchema(reader_->metadata()->schema(), reader_properties_,
                              reader_->metadata()->key_value_metadata(), out);
@@ -309,7 +329,9 @@ class FileReaderImpl : public FileReader {
   // alive in async contexts.
   Future<std::shared_ptr<Table>> DecodeRowGroups(
       std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-      const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor);
+      const std::vector<int>& column_indices,
+      std::shared_ptr<const RowRangeSelection> selection,
+      ::arrow::internal::Executor* cpu_executor);
 
   Status ReadRowGroups(const std::vector<int>& row_groups,
                        std::shared_ptr<Table>* table) override {
@@ -327,8 +349,21 @@ class FileReaderImpl : public FileReader {
 
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               const std::vector<int>& column_indices,
+                              std::unique_ptr<RecordBatchReader>* out) override {
+    return GetRecordBatchReader(row_group_indices, column_indices,
+                                /*selection=*/nullptr, out);
+  }
+
+  Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                              const std::vector<int>& column_indices,
+                              const std::vector<RowRanges>& row_ranges,
                               std::unique_ptr<RecordBatchReader>* out) override;
 
+  Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
+                              const std::vector<int>& column_indices,
+                              std::shared_ptr<const RowRangeSelection> selection,
+                              std::unique_ptr<RecordBatchReader>* out);
+
   Status GetRecordBatchReader(const std::vector<int>& row_group_indices,
                               std::unique_ptr<RecordBatchReader>* out) override {
     return GetRecordBatchReader(row_group_indices,
@@ -345,8 +380,28 @@ class FileReaderImpl : public FileReader {
                           const std::vector<int> row_group_indices,
                           const std::vector<int> column_indices,
                           ::arrow::internal::Executor* cpu_executor,
+                          int64_t rows_to_readahead) override {
+    return GetRecordBatchGenerator(std::move(reader), row_group_indices, column_indices,
+                                   /*selection=*/nullptr, cpu_executor,
+                                   rows_to_readahead);
+  }
+
+  ::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          const std::vector<RowRanges>& row_ranges,
+                          ::arrow::internal::Executor* cpu_executor,
                           int64_t rows_to_readahead) override;
 
+  ::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          std::shared_ptr<const RowRangeSelection> selection,
+                          ::arrow::internal::Executor* cpu_executor,
+                          int64_t rows_to_readahead);
+
   int num_columns() const { return reader_->metadata()->num_columns(); }
 
   ParquetFileReader* parquet_reader() const override { return reader_.get(); }
@@ -450,8 +505,17 @@ class LeafReader : public ColumnReaderImpl {
         field_(std::move(field)),
         input_(std::move(input)),
         descr_(input_->descr()) {
+    const ::arrow::Type::type type_id = field_->type()->id();
     record_reader_ = RecordReader::Make(
-        descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+        descr_, leaf_info, ctx_->pool, type_id == ::arrow::Type::DICTIONARY,
+        /*read_dense_for_nullable=*/false,
+        type_id == ::arrow::Type::BINARY_VIEW || type_id == ::arrow::Type::STRING_VIEW);
+    // These types are transferred with TransferZeroCopy(), so their values may be
+    // left in the pages they were read from
+    record_reader_->set_zero_copy_values(
+        type_id == ::arrow::Type::INT32 || type_id == ::arrow::Type::INT64 ||
+        type_id == ::arrow::Type::FLOAT || type_id == ::arrow::Type::DOUBLE ||
+        type_id == ::arrow::Type::TIMESTAMP);
     NextRowGroup();
   }
 
@@ -469,6 +533,9 @@ class LeafReader : public ColumnReaderImpl {
 
   bool IsOrHasRepeatedChild() const final { return false; }
 
+  // Only for a leaf without parent reader, which would need its definition levels
+  void DecodeLevelsToBitmap() { record_reader_->set_decode_levels_to_bitmap(true); }
+
   Status LoadBatch(int64_t records_to_read) final {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     out_ = nullptr;
@@ -479,7 +546,9 @@ class LeafReader : public ColumnReaderImpl {
       if (!record_reader_->HasMoreData()) {
         break;
       }
-      int64_t records_read = record_reader_->ReadRecords(records_to_read);
+      int64_t records_read = input_->has_selection()
+                                 ? ReadSelectedRecords(records_to_read)
+                                 : record_reader_->ReadRecords(records_to_read);
       records_to_read -= records_read;
       if (records_read == 0) {
         NextRowGroup();
@@ -501,6 +570,37 @@ class LeafReader : public ColumnReaderImpl {
 
  private:
   std::shared_ptr<ChunkedArray> out_;
+
+  // Read up to records_to_read records of the selected runs of the current
+  // column chunk, skipping the records between runs. Returns 0 once the runs
+  // of the column chunk are exhausted.
+  int64_t ReadSelectedRecords(int64_t records_to_read) {
+    std::deque<SelectedRun>* runs = input_->selected_runs();
+    while (!runs->empty()) {
+      SelectedRun& run = runs->front();
+      if (run.skip > 0) {
+        int64_t records_skipped = record_reader_->SkipRecords(run.skip);
+        if (records_skipped == 0) {
+          break;
+        }
+        run.skip -= records_skipped;
+        continue;
+      }
+      int64_t records_read =
+          record_reader_->ReadRecords(std::min(run.read, records_to_read));
+      run.read -= records_read;
+      if (run.read == 0) {
+        runs->pop_front();
+      } else if (records_read == 0) {
+        break;
+      }
+      if (records_read > 0) {
+        return records_read;
+      }
+    }
+    return 0;
+  }
+
   void NextRowGroup() {
     std::unique_ptr<PageReader> page_reader = input_->NextChunk();
     record_reader_->SetPageReader(std::move(page_reader));
@@ -969,12 +1069,35 @@ Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>&
   return GetReader(field, field.field, ctx, out);
 }
 
+Status GetTopLevelReader(const SchemaField& field,
+                         const std::shared_ptr<ReaderContext>& ctx,
+                         std::unique_ptr<ColumnReaderImpl>* out) {
+  RETURN_NOT_OK(GetReader(field, ctx, out));
+  // The definition levels of a top-level leaf are only needed for its validity
+  if (auto* leaf_reader = dynamic_cast<LeafReader*>(out->get())) {
+    leaf_reader->DecodeLevelsToBitmap();
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
                                             const std::vector<int>& column_indices,
+                                            const std::vector<RowRanges>& row_ranges,
                                             std::unique_ptr<RecordBatchReader>* out) {
   RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
+  ARROW_ASSIGN_OR_RAISE(
+      auto selection,
+      RowRangeSelection::Make(reader_.get(), row_groups, row_ranges, column_indices));
+  return GetRecordBatchReader(row_groups, column_indices, std::move(selection), out);
+}
+
+Status FileReaderImpl::GetRecordBatchReader(
+    const std::vector<int>& row_groups, const std::vector<int>& column_indices,
+    std::shared_ptr<const RowRangeSelection> selection,
+    std::unique_ptr<RecordBatchReader>* out) {
+  RETURN_NOT_OK(BoundsCheck(row_groups, column_indices));
 
   if (reader_properties_.pre_buffer()) {
     // PARQUET-1698/PARQUET-1820: pre-buffer row groups/column chunks if enabled
@@ -986,7 +1109,8 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
 
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> batch_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &batch_schema));
+  RETURN_NOT_OK(
+      GetFieldReaders(column_indices, row_groups, selection, &readers, &batch_schema));
 
   if (readers.empty()) {
     // Just generate all batches right now; they're cheap since they have no columns.
@@ -996,8 +1120,10 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
 
     ::arrow::RecordBatchVector batches;
 
-    for (int row_group : row_groups) {
-      int64_t num_rows = parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    for (size_t i = 0; i < row_groups.size(); ++i) {
+      int64_t num_rows =
+          selection ? selection->row_ranges(i).row_count()
+                    : parquet_reader()->metadata()->RowGroup(row_groups[i])->num_rows();
 
       batches.insert(batches.end(), static_cast<size_t>(num_rows / batch_size),
                      max_sized_batch);
@@ -1014,8 +1140,12 @@ Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_groups,
   }
 
   int64_t num_rows = 0;
-  for (int row_group : row_groups) {
-    num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+  if (selection) {
+    num_rows = selection->num_rows();
+  } else {
+    for (int row_group : row_groups) {
+      num_rows += parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    }
   }
 
   using ::arrow::RecordBatchIterator;
@@ -1072,11 +1202,13 @@ class RowGroupGenerator {
   explicit RowGroupGenerator(std::shared_ptr<FileReaderImpl> arrow_reader,
                              ::arrow::internal::Executor* cpu_executor,
                              std::vector<int> row_groups, std::vector<int> column_indices,
+                             std::shared_ptr<const RowRangeSelection> selection,
                              int64_t min_rows_in_flight)
       : arrow_reader_(std::move(arrow_reader)),
         cpu_executor_(cpu_executor),
         row_groups_(std::move(row_groups)),
         column_indices_(std::move(column_indices)),
+        selection_(std::move(selection)),
         min_rows_in_flight_(min_rows_in_flight),
         rows_in_flight_(0),
         index_(0),
@@ -1113,20 +1245,28 @@ class RowGroupGenerator {
     int row_group = row_groups_[row_group_index];
     std::vector<int> column_indices = column_indices_;
     auto reader = arrow_reader_;
-    int64_t num_rows =
-        reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    std::shared_ptr<const RowRangeSelection> selection;
+    int64_t num_rows;
+    if (selection_) {
+      selection = selection_->ForRowGroup(row_group_index);
+      num_rows = selection->num_rows();
+    } else {
+      num_rows = reader->parquet_reader()->metadata()->RowGroup(row_group)->num_rows();
+    }
     rows_in_flight_ += num_rows;
     ::arrow::Future<RecordBatchGenerator> row_group_read;
     if (!reader->properties().pre_buffer()) {
-      row_group_read = SubmitRead(cpu_executor_, reader, row_group, column_indices);
+      row_group_read =
+          SubmitRead(cpu_executor_, reader, row_group, column_indices, selection);
     } else {
       auto ready = reader->parquet_reader()->WhenBuffered({row_group}, column_indices);
       if (cpu_executor_) ready = cpu_executor_->TransferAlways(ready);
-      row_group_read =
-          ready.Then([cpu_executor = cpu_executor_, reader, row_group,
-                      column_indices = std::move(
-                          column_indices)]() -> ::arrow::Future<RecordBatchGenerator> {
-            return ReadOneRowGroup(cpu_executor, reader, row_group, column_indices);
+      row_group_read = ready.Then(
+          [cpu_executor = cpu_executor_, reader, row_group,
+           column_indices = std::move(column_indices),
+           selection = std::move(selection)]() -> ::arrow::Future<RecordBatchGenerator> {
+            return ReadOneRowGroup(cpu_executor, reader, row_group, column_indices,
+                                   selection);
           });
     }
     in_flight_reads_.push({std::move(row_group_read), num_rows});
@@ -1139,21 +1279,25 @@ class RowGroupGenerator {
   // async I/O without forcing readahead.
   static ::arrow::Future<RecordBatchGenerator> SubmitRead(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      const std::shared_ptr<const RowRangeSelection>& selection) {
     if (!cpu_executor) {
-      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices);
+      return ReadOneRowGroup(cpu_executor, self, row_group, column_indices, selection);
     }
     // If we have an executor, then force transfer (even if I/O was complete)
     return ::arrow::DeferNotOk(cpu_executor->Submit(ReadOneRowGroup, cpu_executor, self,
-                                                    row_group, column_indices));
+                                                    row_group, column_indices,
+                                                    selection));
   }
 
   static ::arrow::Future<RecordBatchGenerator> ReadOneRowGroup(
       ::arrow::internal::Executor* cpu_executor, std::shared_ptr<FileReaderImpl> self,
-      const int row_group, const std::vector<int>& column_indices) {
+      const int row_group, const std::vector<int>& column_indices,
+      const std::shared_ptr<const RowRangeSelection>& selection) {
     // Skips bound checks/pre-buffering, since we've done that already
     const int64_t batch_size = self->properties().batch_size();
-    return self->DecodeRowGroups(self, {row_group}, column_indices, cpu_executor)
+    return self->DecodeRowGroups(self, {row_group}, column_indices, selection,
+                                 cpu_executor)
         .Then([batch_size](const std::shared_ptr<Table>& table)
                   -> ::arrow::Result<RecordBatchGenerator> {
           ::arrow::TableBatchReader table_reader(*table);
@@ -1167,6 +1311,7 @@ class RowGroupGenerator {
   ::arrow::internal::Executor* cpu_executor_;
   std::vector<int> row_groups_;
   std::vector<int> column_indices_;
+  std::shared_ptr<const RowRangeSelection> selection_;
   int64_t min_rows_in_flight_;
   std::queue<ReadRequest> in_flight_reads_;
   int64_t rows_in_flight_;
@@ -1178,9 +1323,24 @@ class RowGroupGenerator {
 FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
                                         const std::vector<int> row_group_indices,
                                         const std::vector<int> column_indices,
+                                        const std::vector<RowRanges>& row_ranges,
                                         ::arrow::internal::Executor* cpu_executor,
                                         int64_t rows_to_readahead) {
   RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
+  ARROW_ASSIGN_OR_RAISE(auto selection,
+                        RowRangeSelection::Make(reader_.get(), row_group_indices,
+                                                row_ranges, column_indices));
+  return GetRecordBatchGenerator(std::move(reader), row_group_indices, column_indices,
+                                 std::move(selection), cpu_executor, rows_to_readahead);
+}
+
+::arrow::Result<::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>>>
+FileReaderImpl::GetRecordBatchGenerator(
+    std::shared_ptr<FileReader> reader, const std::vector<int> row_group_indices,
+    const std::vector<int> column_indices,
+    std::shared_ptr<const RowRangeSelection> selection,
+    ::arrow::internal::Executor* cpu_executor, int64_t rows_to_readahead) {
+  RETURN_NOT_OK(BoundsCheck(row_group_indices, column_indices));
   if (rows_to_readahead < 0) {
     return Status::Invalid("rows_to_readahead must be >= 0");
   }
@@ -1193,7 +1353,7 @@ FileReaderImpl::GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
   ::arrow::AsyncGenerator<RowGroupGenerator::RecordBatchGenerator> row_group_generator =
       RowGroupGenerator(::arrow::internal::checked_pointer_cast<FileReaderImpl>(reader),
                         cpu_executor, row_group_indices, column_indices,
-                        rows_to_readahead);
+                        std::move(selection), rows_to_readahead);
   ::arrow::AsyncGenerator<std::shared_ptr<::arrow::RecordBatch>> concatenated =
       ::arrow::MakeConcatenatedGenerator(std::move(row_group_generator));
   WRAP_ASYNC_GENERATOR(std::move(concatenated));
@@ -1209,11 +1369,24 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   ctx->iterator_factory = iterator_factory;
   ctx->filter_leaves = false;
   std::unique_ptr<ColumnReaderImpl> result;
-  RETURN_NOT_OK(GetReader(manifest_.schema_fields[i], ctx, &result));
+  RETURN_NOT_OK(GetTopLevelReader(manifest_.schema_fields[i], ctx, &result));
   *out = std::move(result);
   return Status::OK();
 }
 
+Status FileReaderImpl::GetColumn(int i, const std::vector<int>& row_groups,
+                                 const std::vector<RowRanges>& row_ranges,
+                                 std::unique_ptr<ColumnReader>* out) {
+  RETURN_NOT_OK(BoundsCheckColumn(i));
+  RETURN_NOT_OK(BoundsCheck(row_groups, {}));
+  std::vector<int> column_indices;
+  AddLeafColumnIndices(manifest_.schema_fields[i], &column_indices);
+  ARROW_ASSIGN_OR_RAISE(
+      auto selection,
+      RowRangeSelection::Make(reader_.get(), row_groups, row_ranges, column_indices));
+  return GetColumn(i, SomeRowGroupsFactory(row_groups, std::move(selection)), out);
+}
+
 Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
                                      const std::vector<int>& column_indices,
                                      std::shared_ptr<Table>* out) {
@@ -1229,19 +1402,22 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   }
 
   auto fut = DecodeRowGroups(/*self=*/nullptr, row_groups, column_indices,
-                             /*cpu_executor=*/nullptr);
+                             /*selection=*/nullptr, /*cpu_executor=*/nullptr);
   ARROW_ASSIGN_OR_RAISE(*out, fut.MoveResult());
   return Status::OK();
 }
 
 Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
-    const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
+    const std::vector<int>& column_indices,
+    std::shared_ptr<const RowRangeSelection> selection,
+    ::arrow::internal::Executor* cpu_executor) {
   // `self` is used solely to keep `this` alive in an async context - but we use this
   // in a sync context too so use `this` over `self`
   std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
   std::shared_ptr<::arrow::Schema> result_schema;
-  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
+  RETURN_NOT_OK(
+      GetFieldReaders(column_indices, row_groups, selection, &readers, &result_schema));
   // OptionalParallelForAsync requires an executor
   if (!cpu_executor) cpu_executor = ::arrow::internal::GetCpuThreadPool();
 
@@ -1252,12 +1428,14 @@ Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     RETURN_NOT_OK(ReadColumn(static_cast<int>(i), row_groups, reader.get(), &column));
     return column;
   };
-  auto make_table = [result_schema, row_groups, self,
+  auto make_table = [result_schema, row_groups, selection, self,
                      this](const ::arrow::ChunkedArrayVector& columns)
       -> ::arrow::Result<std::shared_ptr<Table>> {
     int64_t num_rows = 0;
     if (!columns.empty()) {
       num_rows = columns[0]->length();
+    } else if (selection) {
+      num_rows = selection->num_rows();
     } else {
       for (int i : row_groups) {
         num_rows += parquet_reader()->metadata()->RowGroup(i)->num_rows();
@@ -26,6 +26,7 @@
 #include "parquet/file_reader.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
+#include "parquet/row_ranges.h"
 
 namespace arrow {
 
@@ -136,6 +137,17 @@ class PARQUET_EXPORT FileReader {
   // The indicated column index is relative to the schema
   virtual ::arrow::Status GetColumn(int i, std::unique_ptr<ColumnReader>* out) = 0;
 
+  /// \brief Get a ColumnReader over the selected rows of some row groups.
+  ///
+  /// `row_ranges[k]` selects the rows to read from `row_groups[k]`. Data pages
+  /// holding no selected row are skipped using the offset index, if the file
+  /// has one.
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Status GetColumn(int i, const std::vector<int>& row_groups,
+                                    const std::vector<RowRanges>& row_ranges,
+                                    std::unique_ptr<ColumnReader>* out) = 0;
+
   /// \brief Return arrow schema for all the columns.
   virtual ::arrow::Status GetSchema(std::shared_ptr<::arrow::Schema>* out) = 0;
 
@@ -180,6 +192,23 @@ class PARQUET_EXPORT FileReader {
       const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
       std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
 
+  /// \brief Return a RecordBatchReader of the selected rows of row groups
+  /// selected from row_group_indices, whose columns are selected by
+  /// column_indices.
+  ///
+  /// `row_ranges[k]` selects the rows to read from `row_group_indices[k]`.
+  /// Data pages holding no selected row are neither decompressed nor decoded
+  /// when the file has an offset index.
+  ///
+  /// \returns error Status if either row_group_indices or column_indices
+  ///     contains an invalid index, or if row_ranges does not match
+  ///     row_group_indices
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Status GetRecordBatchReader(
+      const std::vector<int>& row_group_indices, const std::vector<int>& column_indices,
+      const std::vector<RowRanges>& row_ranges,
+      std::unique_ptr<::arrow::RecordBatchReader>* out) = 0;
+
   /// \brief Return a RecordBatchReader of row groups selected from
   /// row_group_indices, whose columns are selected by column_indices.
   ///
@@ -214,6 +243,20 @@ class PARQUET_EXPORT FileReader {
                           ::arrow::internal::Executor* cpu_executor = NULLPTR,
                           int64_t rows_to_readahead = 0) = 0;
 
+  /// \brief Return a generator of record batches of the selected rows.
+  ///
+  /// `row_ranges[k]` selects the rows to read from `row_group_indices[k]`.
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Result<
+      std::function<::arrow::Future<std::shared_ptr<::arrow::RecordBatch>>()>>
+  GetRecordBatchGenerator(std::shared_ptr<FileReader> reader,
+                          const std::vector<int> row_group_indices,
+                          const std::vector<int> column_indices,
+                          const std::vector<RowRanges>& row_ranges,
+                          ::arrow::internal::Executor* cpu_executor = NULLPTR,
+                          int64_t rows_to_readahead = 0) = 0;
+
   /// Read all columns into a Table
   virtual ::arrow::Status ReadTable(std::shared_ptr<::arrow::Table>* out) = 0;
 
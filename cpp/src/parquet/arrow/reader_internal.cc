@@ -51,6 +51,8 @@
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/schema_internal.h"
 #include "parquet/column_reader.h"
+#include "parquet/exception.h"
+#include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
@@ -347,11 +349,12 @@ std::shared_ptr<Array> TransferZeroCopy(RecordReader* reader,
   std::shared_ptr<::arrow::ArrayData> data;
   if (field->nullable()) {
     std::vector<std::shared_ptr<Buffer>> buffers = {reader->ReleaseIsValid(),
-                                                    reader->ReleaseValues()};
+                                                    reader->ReleaseZeroCopyValues()};
     data = std::make_shared<::arrow::ArrayData>(field->type(), reader->values_written(),
                                                 std::move(buffers), reader->null_count());
   } else {
-    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr, reader->ReleaseValues()};
+    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr,
+                                                    reader->ReleaseZeroCopyValues()};
     data = std::make_shared<::arrow::ArrayData>(field->type(), reader->values_written(),
                                                 std::move(buffers), /*null_count=*/0);
   }
@@ -487,7 +490,13 @@ Status TransferBinary(RecordReader* reader, MemoryPool* pool,
   DCHECK(binary_reader);
   auto chunks = binary_reader->GetBuilderChunks();
   for (auto& chunk : chunks) {
-    if (!chunk->type()->Equals(*logical_type_field->type())) {
+    if (chunk->type()->Equals(*logical_type_field->type())) {
+      continue;
+    }
+    if (chunk->type_id() == ::arrow::Type::BINARY_VIEW) {
+      // Binary and string views share the same layout
+      ARROW_ASSIGN_OR_RAISE(chunk, chunk->View(logical_type_field->type()));
+    } else {
       // XXX: if a LargeBinary chunk is larger than 2GB, the MSBs of offsets
       // will be lost because they are first created as int32 and then cast to int64.
       ARROW_ASSIGN_OR_RAISE(
@@ -781,7 +790,9 @@ Status TransferColumnData(RecordReader* reader, const std::shared_ptr<Field>& va
     case ::arrow::Type::BINARY:
     case ::arrow::Type::STRING:
     case ::arrow::Type::LARGE_BINARY:
-    case ::arrow::Type::LARGE_STRING: {
+    case ::arrow::Type::LARGE_STRING:
+    case ::arrow::Type::BINARY_VIEW:
+    case ::arrow::Type::STRING_VIEW: {
       RETURN_NOT_OK(TransferBinary(reader, pool, value_field, &chunked_result));
       result = chunked_result;
     } break;
@@ -880,4 +891,140 @@ Status TransferColumnData(RecordReader* reader, const std::shared_ptr<Field>& va
   return Status::OK();
 }
 
+::arrow::Result<std::shared_ptr<RowRangeSelection>> RowRangeSelection::Make(
+    ParquetFileReader* reader, const std::vector<int>& row_groups,
+    std::vector<RowRanges> row_ranges, const std::vector<int>& column_indices) {
+  if (row_ranges.size() != row_groups.size()) {
+    return Status::Invalid("Got ", row_ranges.size(), " row ranges for ",
+                           row_groups.size(), " row groups");
+  }
+  auto metadata = reader->metadata();
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    const int64_t num_rows = metadata->RowGroup(row_groups[i])->num_rows();
+    if (row_ranges[i].end() > num_rows) {
+      return Status::Invalid("Row ranges ", row_ranges[i].ToString(), " of row group ",
+                             row_groups[i], " exceed its ", num_rows, " rows");
+    }
+  }
+
+  auto selection = std::make_shared<RowRangeSelection>();
+  selection->row_ranges_ = std::move(row_ranges);
+  selection->page_first_rows_.resize(row_groups.size());
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  std::shared_ptr<PageIndexReader> page_index_reader = reader->GetPageIndexReader();
+  if (page_index_reader == nullptr) {
+    return selection;
+  }
+  page_index_reader->WillNeed(row_groups, column_indices,
+                              {/*column_index=*/false, /*offset_index=*/true});
+  for (size_t i = 0; i < row_groups.size(); ++i) {
+    auto row_group_index_reader = page_index_reader->RowGroup(row_groups[i]);
+    if (row_group_index_reader == nullptr) {
+      continue;
+    }
+    const int64_t num_rows = metadata->RowGroup(row_groups[i])->num_rows();
+    for (int column_index : column_indices) {
+      auto offset_index = row_group_index_reader->GetOffsetIndex(column_index);
+      if (offset_index == nullptr || offset_index->page_locations().empty()) {
+        continue;
+      }
+      std::vector<int64_t> first_rows;
+      first_rows.reserve(offset_index->page_locations().size() + 1);
+      for (const auto& location : offset_index->page_locations()) {
+        first_rows.push_back(location.first_row_index);
+      }
+      first_rows.push_back(num_rows);
+      // Page pruning relies on the offset index being consistent; otherwise
+      // the column chunk is read in full and the selected rows picked out.
+      bool valid = first_rows.front() == 0;
+      for (size_t page = 1; valid && page < first_rows.size(); ++page) {
+        valid = first_rows[page - 1] < first_rows[page];
+      }
+      if (valid) {
+        selection->page_first_rows_[i].emplace(column_index, std::move(first_rows));
+      }
+    }
+  }
+  END_PARQUET_CATCH_EXCEPTIONS
+  return selection;
+}
+
+int64_t RowRangeSelection::num_rows() const {
+  int64_t num_rows = 0;
+  for (const auto& ranges : row_ranges_) {
+    num_rows += ranges.row_count();
+  }
+  return num_rows;
+}
+
+std::shared_ptr<RowRangeSelection> RowRangeSelection::ForRowGroup(size_t i) const {
+  auto selection = std::make_shared<RowRangeSelection>();
+  selection->row_ranges_ = {row_ranges_[i]};
+  selection->page_first_rows_ = {page_first_rows_[i]};
+  return selection;
+}
+
+std::deque<SelectedRun> RowRangeSelection::PrepareColumnChunk(
+    size_t i, int column_index, PageReader* page_reader) const {
+  const std::vector<RowRanges::Range>& ranges = row_ranges_[i].ranges();
+  std::deque<SelectedRun> runs;
+  // Append the rows [start, start + length) in the coordinates of the records
+  // seen by the column reader, given its current position.
+  int64_t position = 0;
+  auto add_run = [&](int64_t start, int64_t length) {
+    if (start == position && !runs.empty()) {
+      runs.back().read += length;
+    } else {
+      runs.push_back({start - position, length});
+    }
+    position = start + length;
+  };
+
+  auto it = page_first_rows_[i].find(column_index);
+  if (it == page_first_rows_[i].end()) {
+    for (const auto& range : ranges) {
+      add_run(range.offset, range.length);
+    }
+    return runs;
+  }
+
+  const std::vector<int64_t>& first_rows = it->second;
+  const size_t num_pages = first_rows.size() - 1;
+  std::vector<bool> skip_page(num_pages, false);
+  bool skips_pages = false;
+  // Number of rows in the pages kept so far
+  int64_t kept_rows = 0;
+  size_t range_index = 0;
+  for (size_t page = 0; page < num_pages; ++page) {
+    const int64_t page_start = first_rows[page];
+    const int64_t page_end = first_rows[page + 1];
+    while (range_index < ranges.size() && ranges[range_index].end() <= page_start) {
+      ++range_index;
+    }
+    if (range_index == ranges.size() || ranges[range_index].offset >= page_end) {
+      skip_page[page] = true;
+      skips_pages = true;
+      continue;
+    }
+    for (size_t j = range_index; j < ranges.size() && ranges[j].offset < page_end; ++j) {
+      const int64_t start = std::max(ranges[j].offset, page_start);
+      const int64_t end = std::min(ranges[j].end(), page_end);
+      add_run(kept_rows + (start - page_start), end - start);
+    }
+    kept_rows += page_end - page_start;
+  }
+
+  if (skips_pages) {
+    page_reader->set_data_page_filter([skip_page = std::move(skip_page),
+                                       page = size_t{0}](const DataPageStats&) mutable {
+      // Pages missing from the offset index are never skipped
+      const bool skip = page < skip_page.size() && skip_page[page];
+      ++page;
+      return skip;
+    });
+  }
+  return runs;
+}
+
 }  // namespace parquet::arrow
@@ -22,6 +22,7 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
 #include "parquet/platform.h"
+#include "parquet/row_ranges.h"
 #include "parquet/schema.h"
 
 namespace arrow {
@@ -54,6 +56,48 @@ namespace arrow {
 
 class ColumnReaderImpl;
 
+// ----------------------------------------------------------------------
+// Row range selection
+
+// A number of records to skip followed by a number of records to read
+struct SelectedRun {
+  int64_t skip;
+  int64_t read;
+};
+
+// The rows selected in each row group of a read. When a column chunk has an
+// offset index, data pages holding no selected row are dropped by the page
+// reader before they are decompressed or decoded.
+class RowRangeSelection {
+ public:
+  // Validate `row_ranges` (one per entry of `row_groups`) and load the offset
+  // index of the given leaf columns. This must happen before any column is read
+  // since the page index reader is not thread-safe.
+  static ::arrow::Result<std::shared_ptr<RowRangeSelection>> Make(
+      ParquetFileReader* reader, const std::vector<int>& row_groups,
+      std::vector<RowRanges> row_ranges, const std::vector<int>& column_indices);
+
+  // The selected rows of the i-th row group of the read
+  const RowRanges& row_ranges(size_t i) const { return row_ranges_[i]; }
+
+  // The total number of selected rows
+  int64_t num_rows() const;
+
+  // The selection restricted to the i-th row group of the read
+  std::shared_ptr<RowRangeSelection> ForRowGroup(size_t i) const;
+
+  // Install a data page filter on the page reader of the given column chunk and
+  // return the runs of records to skip and read in the pages it lets through.
+  std::deque<SelectedRun> PrepareColumnChunk(size_t i, int column_index,
+                                             PageReader* page_reader) const;
+
+ private:
+  std::vector<RowRanges> row_ranges_;
+  // For each row group of the read, the first row of every data page of the
+  // column chunks with a usable offset index, followed by the row group size.
+  std::vector<std::unordered_map<int, std::vector<int64_t>>> page_first_rows_;
+};
+
 // ----------------------------------------------------------------------
 // Iteration utilities
 
@@ -61,12 +105,14 @@ class ColumnReaderImpl;
 // so we can read only a single row group if we want
 class FileColumnIterator {
  public:
-  explicit FileColumnIterator(int column_index, ParquetFileReader* reader,
-                              std::vector<int> row_groups)
+  explicit FileColumnIterator(
+      int column_index, ParquetFileReader* reader, std::vector<int> row_groups,
+      std::shared_ptr<const RowRangeSelection> selection = NULLPTR)
       : column_index_(column_index),
         reader_(reader),
         schema_(reader->metadata()->schema()),
-        row_groups_(row_groups.begin(), row_groups.end()) {}
+        row_groups_(row_groups.begin(), row_groups.end()),
+        selection_(std::move(selection)) {}
 
   virtual ~FileColumnIterator() {}
 
@@ -77,9 +123,21 @@ class FileColumnIterator {
 
     auto row_group_reader = reader_->RowGroup(row_groups_.front());
     row_groups_.pop_front();
-    return row_group_reader->GetColumnPageReader(column_index_);
+    auto page_reader = row_group_reader->GetColumnPageReader(column_index_);
+    if (selection_) {
+      selected_runs_ =
+          selection_->PrepareColumnChunk(chunk_index_, column_index_, page_reader.get());
+    }
+    ++chunk_index_;
+    return page_reader;
   }
 
+  // Whether only selected rows of each row group are read. If so, the runs of
+  // the current column chunk are given by selected_runs().
+  bool has_selection() const { return selection_ != NULLPTR; }
+
+  std::deque<SelectedRun>* selected_runs() { return &selected_runs_; }
+
   const SchemaDescriptor* schema() const { return schema_; }
 
   const ColumnDescriptor* descr() const { return schema_->Column(column_index_); }
@@ -93,6 +151,9 @@ class FileColumnIterator {
   ParquetFileReader* reader_;
   const SchemaDescriptor* schema_;
   std::deque<int> row_groups_;
+  std::shared_ptr<const RowRangeSelection> selection_;
+  std::deque<SelectedRun> selected_runs_;
+  size_t chunk_index_ = 0;
 };
 
 using FileColumnIteratorFactory =
@@ -483,6 +483,22 @@ bool IsDictionaryReadSupported(const ArrowType& type) {
       IsDictionaryReadSupported(*storage_type)) {
     return ::arrow::dictionary(::arrow::int32(), storage_type);
   }
+  if (storage_type->id() == ::arrow::Type::BINARY ||
+      storage_type->id() == ::arrow::Type::STRING) {
+    const bool is_string = storage_type->id() == ::arrow::Type::STRING;
+    switch (ctx->properties.binary_type()) {
+      case ::arrow::Type::BINARY:
+        break;
+      case ::arrow::Type::LARGE_BINARY:
+        return is_string ? ::arrow::large_utf8() : ::arrow::large_binary();
+      case ::arrow::Type::BINARY_VIEW:
+        return is_string ? ::arrow::utf8_view() : ::arrow::binary_view();
+      default:
+        return Status::Invalid(
+            "Unsupported binary type for reading BYTE_ARRAY: ",
+            ::arrow::internal::ToString(ctx->properties.binary_type()));
+    }
+  }
   return storage_type;
 }
 
@@ -0,0 +1,350 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Benchmarks of reading and writing whole tables whose schemas and data
+// distributions resemble actual workloads, as opposed to the single primitive
+// columns of reader_writer_benchmark.cc.
+
+#include "benchmark/benchmark.h"
+
+#include <array>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "parquet/arrow/reader.h"
+#include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/platform.h"
+#include "parquet/properties.h"
+
+#include "arrow/io/memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/table.h"
+#include "arrow/testing/random.h"
+#include "arrow/type.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/key_value_metadata.h"
+#include "arrow/util/logging.h"
+
+#define EXIT_NOT_OK(s)                                        \
+  do {                                                        \
+    ::arrow::Status _s = (s);                                 \
+    if (ARROW_PREDICT_FALSE(!_s.ok())) {                      \
+      std::cout << "Exiting: " << _s.ToString() << std::endl; \
+      exit(EXIT_FAILURE);                                     \
+    }                                                         \
+  } while (0)
+
+namespace parquet {
+
+using arrow::FileReader;
+using arrow::FileReaderBuilder;
+using arrow::WriteTable;
+using ::arrow::field;
+using ::arrow::FieldVector;
+
+namespace benchmark {
+
+enum Workload : int {
+  // The lineitem table of TPC-H: flat, non-null, mostly low-cardinality columns
+  kLineitem,
+  // Deeply nested structs of lists, as found in event data
+  kNestedEvents,
+  // A wide table of columns that are almost all null
+  kSparse,
+  // String-heavy application logs
+  kLogs,
+  kNumWorkloads
+};
+
+constexpr std::array<const char*, kNumWorkloads> kWorkloadNames = {
+    "lineitem", "nested_events", "sparse", "logs"};
+
+constexpr std::array<::arrow::Compression::type, 4> kCodecs = {
+    ::arrow::Compression::UNCOMPRESSED, ::arrow::Compression::SNAPPY,
+    ::arrow::Compression::ZSTD, ::arrow::Compression::LZ4};
+
+// Generation options of arrow::random::GenerateBatch
+std::shared_ptr<const ::arrow::KeyValueMetadata> Options(
+    std::vector<std::string> keys, std::vector<std::string> values) {
+  return ::arrow::key_value_metadata(std::move(keys), std::move(values));
+}
+
+std::shared_ptr<const ::arrow::KeyValueMetadata> StringOptions(int32_t min_length,
+                                                               int32_t max_length,
+                                                               int32_t unique = -1) {
+  return Options({"min_length", "max_length", "unique"},
+                 {std::to_string(min_length), std::to_string(max_length),
+                  std::to_string(unique)});
+}
+
+std::shared_ptr<const ::arrow::KeyValueMetadata> RangeOptions(int64_t min,
+                                                              int64_t max) {
+  return Options({"min", "max"}, {std::to_string(min), std::to_string(max)});
+}
+
+FieldVector LineitemFields() {
+  // 1992-01-01 to 1998-12-31
+  const auto dates = RangeOptions(8035, 10592);
+  const auto money = ::arrow::decimal128(15, 2);
+  return {
+      field("l_orderkey", ::arrow::int64(), false, RangeOptions(1, 6000000)),
+      field("l_partkey", ::arrow::int64(), false, RangeOptions(1, 200000)),
+      field("l_suppkey", ::arrow::int64(), false, RangeOptions(1, 10000)),
+      field("l_linenumber", ::arrow::int32(), false, RangeOptions(1, 7)),
+      field("l_quantity", money, false),
+      field("l_extendedprice", money, false),
+      field("l_discount", money, false),
+      field("l_tax", money, false),
+      field("l_returnflag", ::arrow::utf8(), false, StringOptions(1, 1, 3)),
+      field("l_linestatus", ::arrow::utf8(), false, StringOptions(1, 1, 2)),
+      field("l_shipdate", ::arrow::date32(), false, dates),
+      field("l_commitdate", ::arrow::date32(), false, dates),
+      field("l_receiptdate", ::arrow::date32(), false, dates),
+      field("l_shipinstruct", ::arrow::utf8(), false, StringOptions(7, 17, 4)),
+      field("l_shipmode", ::arrow::utf8(), false, StringOptions(3, 7, 7)),
+      field("l_comment", ::arrow::utf8(), false, StringOptions(10, 43)),
+  };
+}
+
+FieldVector NestedEventsFields() {
+  const auto attribute = ::arrow::struct_({
+      field("key", ::arrow::utf8(), false, StringOptions(3, 12, 64)),
+      field("value", ::arrow::utf8(), true, StringOptions(0, 32)),
+  });
+  const auto metrics = ::arrow::struct_({
+      field("latency", ::arrow::float64()),
+      field("bytes", ::arrow::int64(), true, RangeOptions(0, 1 << 20)),
+  });
+  const auto event = ::arrow::struct_({
+      field("ts", ::arrow::timestamp(::arrow::TimeUnit::MICRO), false),
+      field("kind", ::arrow::utf8(), false, StringOptions(4, 16, 16)),
+      field("attributes", ::arrow::list(field("item", attribute, false)), true,
+            Options({"max_length"}, {"4"})),
+      field("metrics", metrics),
+  });
+  const auto address = ::arrow::struct_({
+      field("city", ::arrow::utf8(), true, StringOptions(4, 20, 1000)),
+      field("zip", ::arrow::utf8(), true, StringOptions(5, 5)),
+  });
+  const auto location = ::arrow::struct_({
+      field("lat", ::arrow::float64()),
+      field("lon", ::arrow::float64()),
+      field("address", address),
+  });
+  return {
+      field("id", ::arrow::int64(), false),
+      field("events", ::arrow::list(field("item", event, false)), true,
+            Options({"max_length"}, {"8"})),
+      field("tags",
+            ::arrow::list(
+                field("item", ::arrow::utf8(), false, StringOptions(2, 10, 100))),
+            true, Options({"max_length"}, {"5"})),
+      field("location", location, true, Options({"null_probability"}, {"0.2"})),
+  };
+}
+
+FieldVector SparseFields() {
+  constexpr int kNumColumns = 64;
+  const std::array<std::shared_ptr<::arrow::DataType>, 4> types = {
+      ::arrow::int32(), ::arrow::int64(), ::arrow::float64(), ::arrow::utf8()};
+  FieldVector fields;
+  for (int i = 0; i < kNumColumns; ++i) {
+    // One column in eight is only mostly null
+    const char* null_probability = i % 8 == 0 ? "0.9" : "0.999";
+    fields.push_back(field("c" + std::to_string(i), types[i % types.size()], true,
+                           Options({"null_probability", "max_length"},
+                                   {null_probability, "32"})));
+  }
+  return fields;
+}
+
+FieldVector LogsFields() {
+  return {
+      field("timestamp", ::arrow::timestamp(::arrow::TimeUnit::MILLI), false),
+      field("level", ::arrow::utf8(), false, StringOptions(4, 5, 5)),
+      field("host", ::arrow::utf8(), false, StringOptions(8, 16, 200)),
+      field("service", ::arrow::utf8(), false, StringOptions(4, 24, 30)),
+      field("request_id", ::arrow::fixed_size_binary(16), false),
+      field("path", ::arrow::utf8(), false, StringOptions(10, 80, 5000)),
+      field("status", ::arrow::int32(), false, RangeOptions(200, 504)),
+      field("latency_ms", ::arrow::float64(), false),
+      field("user_agent", ::arrow::utf8(), true, StringOptions(40, 120, 50)),
+      field("message", ::arrow::utf8(), true, StringOptions(20, 400)),
+  };
+}
+
+// Generate the table of a workload once, the first time it is benchmarked
+const ::arrow::Table& GetWorkloadTable(Workload workload) {
+  static std::array<std::shared_ptr<::arrow::Table>, kNumWorkloads> tables;
+  if (tables[workload] == nullptr) {
+    FieldVector fields;
+    int64_t num_rows = 0;
+    switch (workload) {
+      case kLineitem:
+        fields = LineitemFields();
+        num_rows = 256 * 1024;
+        break;
+      case kNestedEvents:
+        fields = NestedEventsFields();
+        num_rows = 32 * 1024;
+        break;
+      case kSparse:
+        fields = SparseFields();
+        num_rows = 128 * 1024;
+        break;
+      default:
+        fields = LogsFields();
+        num_rows = 64 * 1024;
+        break;
+    }
+    auto batch = ::arrow::random::GenerateBatch(fields, num_rows, /*seed=*/42);
+    PARQUET_ASSIGN_OR_THROW(tables[workload], ::arrow::Table::FromRecordBatches({batch}));
+  }
+  return *tables[workload];
+}
+
+std::shared_ptr<WriterProperties> MakeWriterProperties(::arrow::Compression::type codec,
+                                                       bool dictionary,
+                                                       ::arrow::MemoryPool* pool) {
+  WriterProperties::Builder builder;
+  builder.memory_pool(pool)->compression(codec);
+  if (!dictionary) {
+    builder.disable_dictionary();
+  }
+  return builder.build();
+}
+
+// Set the label and the counters common to all the workload benchmarks
+void SetWorkloadCounters(::benchmark::State& state, Workload workload,
+                         ::arrow::Compression::type codec, const ::arrow::Table& table,
+                         int64_t file_size, const ::arrow::MemoryPool& pool) {
+  state.SetLabel(std::string(kWorkloadNames[workload]) + "/" +
+                 ::arrow::util::Codec::GetCodecAsString(codec));
+  state.SetItemsProcessed(table.num_rows() * state.iterations());
+  state.SetBytesProcessed(::arrow::util::TotalBufferSize(table) * state.iterations());
+  state.counters["file_size"] = static_cast<double>(file_size);
+  state.counters["peak_memory"] = static_cast<double>(pool.max_memory());
+}
+
+bool SkipUnavailableCodec(::benchmark::State& state, ::arrow::Compression::type codec) {
+  if (!::arrow::util::Codec::IsAvailable(codec)) {
+    state.SkipWithError("Codec not available");
+    return true;
+  }
+  return false;
+}
+
+//
+// Benchmark writing a workload table
+//
+
+static void BM_WriteWorkload(::benchmark::State& state) {
+  const auto workload = static_cast<Workload>(state.range(0));
+  const auto codec = kCodecs[state.range(1)];
+  if (SkipUnavailableCodec(state, codec)) {
+    return;
+  }
+  const ::arrow::Table& table = GetWorkloadTable(workload);
+  ::arrow::ProxyMemoryPool pool(::arrow::default_memory_pool());
+  const auto properties = MakeWriterProperties(codec, state.range(2) != 0, &pool);
+
+  int64_t file_size = 0;
+  for (auto _ : state) {
+    auto output = CreateOutputStream(&pool);
+    EXIT_NOT_OK(WriteTable(table, &pool, output, DEFAULT_MAX_ROW_GROUP_LENGTH,
+                           properties));
+    PARQUET_ASSIGN_OR_THROW(auto buffer, output->Finish());
+    file_size = buffer->size();
+  }
+  SetWorkloadCounters(state, workload, codec, table, file_size, pool);
+}
+
+static void WriteWorkloadArguments(::benchmark::internal::Benchmark* b) {
+  b->ArgNames({"workload", "codec", "dictionary"});
+  for (int workload = 0; workload < kNumWorkloads; ++workload) {
+    for (int codec = 0; codec < static_cast<int>(kCodecs.size()); ++codec) {
+      for (int dictionary : {0, 1}) {
+        b->Args({workload, codec, dictionary});
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_WriteWorkload)->Apply(WriteWorkloadArguments)->UseRealTime();
+
+//
+// Benchmark reading a workload table
+//
+
+static void BM_ReadWorkload(::benchmark::State& state) {
+  const auto workload = static_cast<Workload>(state.range(0));
+  const auto codec = kCodecs[state.range(1)];
+  if (SkipUnavailableCodec(state, codec)) {
+    return;
+  }
+  const ::arrow::Table& table = GetWorkloadTable(workload);
+  std::shared_ptr<Buffer> buffer;
+  {
+    const auto properties =
+        MakeWriterProperties(codec, state.range(2) != 0, ::arrow::default_memory_pool());
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(WriteTable(table, ::arrow::default_memory_pool(), output,
+                           DEFAULT_MAX_ROW_GROUP_LENGTH, properties));
+    PARQUET_ASSIGN_OR_THROW(buffer, output->Finish());
+  }
+
+  ::arrow::ProxyMemoryPool pool(::arrow::default_memory_pool());
+  ArrowReaderProperties arrow_properties = default_arrow_reader_properties();
+  arrow_properties.set_pre_buffer(state.range(3) != 0);
+  arrow_properties.set_use_threads(state.range(4) != 0);
+
+  for (auto _ : state) {
+    std::unique_ptr<FileReader> reader;
+    FileReaderBuilder builder;
+    EXIT_NOT_OK(builder.Open(std::make_shared<::arrow::io::BufferReader>(buffer),
+                             ReaderProperties(&pool)));
+    EXIT_NOT_OK(builder.memory_pool(&pool)->properties(arrow_properties)->Build(&reader));
+    std::shared_ptr<::arrow::Table> result;
+    EXIT_NOT_OK(reader->ReadTable(&result));
+  }
+  SetWorkloadCounters(state, workload, codec, table, buffer->size(), pool);
+}
+
+static void ReadWorkloadArguments(::benchmark::internal::Benchmark* b) {
+  b->ArgNames({"workload", "codec", "dictionary", "pre_buffer", "threads"});
+  for (int workload = 0; workload < kNumWorkloads; ++workload) {
+    for (int codec = 0; codec < static_cast<int>(kCodecs.size()); ++codec) {
+      for (int dictionary : {0, 1}) {
+        for (int pre_buffer : {0, 1}) {
+          for (int threads : {0, 1}) {
+            b->Args({workload, codec, dictionary, pre_buffer, threads});
+          }
+        }
+      }
+    }
+  }
+}
+
+BENCHMARK(BM_ReadWorkload)->Apply(ReadWorkloadArguments)->UseRealTime();
+
+}  // namespace benchmark
+
+}  // namespace parquet
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -379,6 +380,24 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (this->properties().max_row_group_bytes() > 0) {
+        // The row group size in bytes is only known while encoding, so write
+        // into buffered row groups that are closed when the target is reached.
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        RETURN_NOT_OK(WriteBufferedRows(table.columns(), offset, size));
+        table_row_group_ = true;
+        return Status::OK();
+      }
+      if (arrow_properties_->use_threads()) {
+        // Encode the column chunks in parallel into a buffered row group, which
+        // is written out in column order when it is closed.
+        RETURN_NOT_OK(NewBufferedRowGroup());
+        RETURN_NOT_OK(WriteBufferedColumns(table.columns(), offset, size));
+        // Keep the row group layout of the unbuffered mode: following calls to
+        // WriteRecordBatch() do not append to this row group.
+        table_row_group_ = true;
+        return Status::OK();
+      }
       RETURN_NOT_OK(NewRowGroup(size));
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -407,6 +426,7 @@ class FileWriterImpl : public FileWriter {
       PARQUET_CATCH_NOT_OK(row_group_writer_->Close());
     }
     PARQUET_CATCH_NOT_OK(row_group_writer_ = writer_->AppendBufferedRowGroup());
+    table_row_group_ = false;
     return Status::OK();
   }
 
@@ -416,60 +436,19 @@ class FileWriterImpl : public FileWriter {
       return Status::OK();
     }
 
-    // Max number of rows allowed in a row group.
-    const int64_t max_row_group_length = this->properties().max_row_group_length();
-
     // Initialize a new buffered row group writer if necessary.
     if (row_group_writer_ == nullptr || !row_group_writer_->buffered() ||
-        row_group_writer_->num_rows() >= max_row_group_length) {
+        table_row_group_ || RowGroupFull()) {
       RETURN_NOT_OK(NewBufferedRowGroup());
     }
 
-    auto WriteBatch = [&](int64_t offset, int64_t size) {
-      std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
-      int column_index_start = 0;
-
-      for (int i = 0; i < batch.num_columns(); i++) {
-        ChunkedArray chunked_array{batch.column(i)};
-        ARROW_ASSIGN_OR_RAISE(
-            std::unique_ptr<ArrowColumnWriterV2> writer,
-            ArrowColumnWriterV2::Make(chunked_array, offset, size, schema_manifest_,
-                                      row_group_writer_, column_index_start));
-        column_index_start += writer->leaf_count();
-        if (arrow_properties_->use_threads()) {
-          writers.emplace_back(std::move(writer));
-        } else {
-          RETURN_NOT_OK(writer->Write(&column_write_context_));
-        }
-      }
-
-      if (arrow_properties_->use_threads()) {
-        DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
-        RETURN_NOT_OK(::arrow::internal::ParallelFor(
-            static_cast<int>(writers.size()),
-            [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
-            arrow_properties_->executor()));
-      }
-
-      return Status::OK();
-    };
-
-    int64_t offset = 0;
-    while (offset < batch.num_rows()) {
-      const int64_t batch_size =
-          std::min(max_row_group_length - row_group_writer_->num_rows(),
-                   batch.num_rows() - offset);
-      RETURN_NOT_OK(WriteBatch(offset, batch_size));
-      offset += batch_size;
-
-      // Flush current row group writer and create a new writer if it is full.
-      if (row_group_writer_->num_rows() >= max_row_group_length &&
-          offset < batch.num_rows()) {
-        RETURN_NOT_OK(NewBufferedRowGroup());
-      }
+    ::arrow::ChunkedArrayVector columns;
+    columns.reserve(batch.num_columns());
+    for (int i = 0; i < batch.num_columns(); i++) {
+      columns.push_back(std::make_shared<ChunkedArray>(batch.column(i)));
     }
 
-    return Status::OK();
+    return WriteBufferedRows(columns, 0, batch.num_rows());
   }
 
   const WriterProperties& properties() const { return *writer_->properties(); }
@@ -485,6 +464,91 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  /// Write a slice of the columns into the current buffered row group. If
+  /// arrow_properties_.use_threads() is true, the column chunks are encoded and
+  /// compressed in parallel on arrow_properties_.executor().
+  // Whether the current buffered row group reached either the max number of rows
+  // or the target size in bytes.
+  bool RowGroupFull() const {
+    if (row_group_writer_->num_rows() >= this->properties().max_row_group_length()) {
+      return true;
+    }
+    const int64_t max_row_group_bytes = this->properties().max_row_group_bytes();
+    return max_row_group_bytes > 0 &&
+           row_group_writer_->estimated_total_bytes() >= max_row_group_bytes;
+  }
+
+  // Number of rows that can be appended to the current buffered row group before
+  // reaching the target size in bytes, extrapolated from the average row size so
+  // far. The first write_batch_size() rows of a row group are used as a probe.
+  int64_t RowsUntilByteLimit() const {
+    const int64_t max_row_group_bytes = this->properties().max_row_group_bytes();
+    if (max_row_group_bytes <= 0) {
+      return std::numeric_limits<int64_t>::max();
+    }
+    const int64_t num_rows = row_group_writer_->num_rows();
+    const int64_t estimated_bytes = row_group_writer_->estimated_total_bytes();
+    if (num_rows == 0 || estimated_bytes == 0) {
+      return std::max<int64_t>(this->properties().write_batch_size(), 1);
+    }
+    const double remaining_bytes =
+        static_cast<double>(max_row_group_bytes - estimated_bytes);
+    const double row_bytes = static_cast<double>(estimated_bytes) / num_rows;
+    return std::max<int64_t>(static_cast<int64_t>(remaining_bytes / row_bytes), 1);
+  }
+
+  // Write rows into the current buffered row group, which is flushed and replaced
+  // by a new one whenever it gets full.
+  Status WriteBufferedRows(const ::arrow::ChunkedArrayVector& columns, int64_t offset,
+                           int64_t size) {
+    const int64_t max_row_group_length = this->properties().max_row_group_length();
+    const int64_t end = offset + size;
+    if (size == 0) {
+      // Append a row group with 0 rows
+      return WriteBufferedColumns(columns, offset, 0);
+    }
+    while (offset < end) {
+      if (RowGroupFull()) {
+        RETURN_NOT_OK(NewBufferedRowGroup());
+      }
+      const int64_t batch_size =
+          std::min({max_row_group_length - row_group_writer_->num_rows(),
+                    RowsUntilByteLimit(), end - offset});
+      RETURN_NOT_OK(WriteBufferedColumns(columns, offset, batch_size));
+      offset += batch_size;
+    }
+    return Status::OK();
+  }
+
+  Status WriteBufferedColumns(const ::arrow::ChunkedArrayVector& columns,
+                              int64_t offset, int64_t size) {
+    std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
+    int column_index_start = 0;
+
+    for (const auto& column : columns) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<ArrowColumnWriterV2> writer,
+          ArrowColumnWriterV2::Make(*column, offset, size, schema_manifest_,
+                                    row_group_writer_, column_index_start));
+      column_index_start += writer->leaf_count();
+      if (arrow_properties_->use_threads()) {
+        writers.emplace_back(std::move(writer));
+      } else {
+        RETURN_NOT_OK(writer->Write(&column_write_context_));
+      }
+    }
+
+    if (arrow_properties_->use_threads()) {
+      DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
+      RETURN_NOT_OK(::arrow::internal::ParallelFor(
+          static_cast<int>(writers.size()),
+          [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
+          arrow_properties_->executor()));
+    }
+
+    return Status::OK();
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
@@ -499,6 +563,10 @@ class FileWriterImpl : public FileWriter {
   /// schema_->num_fields() to make it thread-safe. Otherwise, the vector is
   /// empty and column_write_context_ above is shared by all columns.
   std::vector<ArrowWriteContext> parallel_column_write_contexts_;
+
+  /// Whether the current row group is a buffered row group written by
+  /// WriteTable(), which must not be appended to by WriteRecordBatch().
+  bool table_row_group_ = false;
 };
 
 FileWriter::~FileWriter() {}
@@ -91,6 +91,9 @@ class PARQUET_EXPORT FileWriter {
 
   /// \brief Write a Table to Parquet.
   ///
+  /// If ArrowWriterProperties::use_threads() is true, the columns of each row
+  /// group are encoded in parallel.
+  ///
   /// \param table Arrow table to write.
   /// \param chunk_size maximum number of rows to write per row group.
   virtual ::arrow::Status WriteTable(
@@ -0,0 +1,219 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/bloom_filter_builder.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/properties.h"
+#include "parquet/schema.h"
+#include "parquet/xxhasher.h"
+
+namespace parquet {
+
+namespace {
+
+// A HyperLogLog sketch of 64-bit hashes, with 2^kPrecision one-byte registers
+// giving a standard error of about 1.6%.
+class HyperLogLog {
+ public:
+  void Update(uint64_t hash) {
+    const uint64_t index = hash >> (64 - kPrecision);
+    const uint64_t rest = hash << kPrecision;
+    const uint8_t rank =
+        rest == 0 ? static_cast<uint8_t>(64 - kPrecision + 1)
+                  : static_cast<uint8_t>(::arrow::bit_util::CountLeadingZeros(rest) + 1);
+    registers_[index] = std::max(registers_[index], rank);
+  }
+
+  int64_t Estimate() const {
+    constexpr double m = kNumRegisters;
+    constexpr double alpha = 0.7213 / (1.0 + 1.079 / m);
+    double sum = 0;
+    int num_zeros = 0;
+    for (uint8_t rank : registers_) {
+      sum += std::ldexp(1.0, -rank);
+      num_zeros += rank == 0;
+    }
+    double estimate = alpha * m * m / sum;
+    if (estimate <= 2.5 * m && num_zeros > 0) {
+      // Small range correction: linear counting of the empty registers
+      estimate = m * std::log(m / num_zeros);
+    }
+    return static_cast<int64_t>(std::llround(estimate));
+  }
+
+ private:
+  static constexpr int kPrecision = 12;
+  static constexpr int kNumRegisters = 1 << kPrecision;
+
+  std::array<uint8_t, kNumRegisters> registers_{};
+};
+
+class ColumnBloomFilterBuilderImpl final : public ColumnBloomFilterBuilder {
+ public:
+  ColumnBloomFilterBuilderImpl(const BloomFilterOptions& options,
+                               ::arrow::MemoryPool* pool)
+      : options_(options), pool_(pool) {
+    if (!(options.fpp > 0 && options.fpp < 1)) {
+      throw ParquetException("Bloom filter false positive probability must be in (0, 1)");
+    }
+  }
+
+  const Hasher& hasher() const override { return hasher_; }
+
+  void InsertHashes(const uint64_t* hashes, int64_t num_hashes) override {
+    if (finished_) {
+      throw ParquetException(
+          "Cannot insert hashes to finished ColumnBloomFilterBuilder.");
+    }
+    for (int64_t i = 0; i < num_hashes; ++i) {
+      sketch_.Update(hashes[i]);
+    }
+    hashes_.insert(hashes_.end(), hashes, hashes + num_hashes);
+    if (hashes_.size() >= compaction_threshold_) {
+      // Hashes are buffered until the filter is sized, drop the duplicates so that
+      // memory use is bounded by the number of distinct values
+      std::sort(hashes_.begin(), hashes_.end());
+      hashes_.erase(std::unique(hashes_.begin(), hashes_.end()), hashes_.end());
+      compaction_threshold_ = std::max(kMinCompactionThreshold, 2 * hashes_.size());
+    }
+  }
+
+  int64_t EstimateDistinctCount() const override { return sketch_.Estimate(); }
+
+  void Finish(bool dictionary_encoded) override {
+    if (finished_) {
+      return;
+    }
+    finished_ = true;
+    if (dictionary_encoded && !options_.ndv.has_value()) {
+      hashes_ = {};
+      return;
+    }
+    const int64_t ndv = std::clamp<int64_t>(options_.ndv.value_or(sketch_.Estimate()), 1,
+                                            std::numeric_limits<uint32_t>::max());
+    auto bloom_filter = std::make_unique<BlockSplitBloomFilter>(pool_);
+    bloom_filter->Init(BlockSplitBloomFilter::OptimalNumOfBytes(
+        static_cast<uint32_t>(ndv), options_.fpp));
+    for (uint64_t hash : hashes_) {
+      bloom_filter->InsertHash(hash);
+    }
+    bloom_filter_ = std::move(bloom_filter);
+    hashes_ = {};
+  }
+
+  const BloomFilter* bloom_filter() const override { return bloom_filter_.get(); }
+
+ private:
+  static constexpr size_t kMinCompactionThreshold = 64 * 1024;
+
+  const BloomFilterOptions options_;
+  ::arrow::MemoryPool* pool_;
+  XxHasher hasher_;
+  HyperLogLog sketch_;
+  std::vector<uint64_t> hashes_;
+  size_t compaction_threshold_ = kMinCompactionThreshold;
+  std::unique_ptr<BloomFilter> bloom_filter_;
+  bool finished_ = false;
+};
+
+class BloomFilterBuilderImpl final : public BloomFilterBuilder {
+ public:
+  BloomFilterBuilderImpl(const SchemaDescriptor* schema,
+                         const WriterProperties* properties)
+      : schema_(schema), properties_(properties) {}
+
+  void AppendRowGroup() override {
+    builders_.emplace_back(static_cast<size_t>(schema_->num_columns()));
+  }
+
+  ColumnBloomFilterBuilder* GetColumnBloomFilterBuilder(int32_t i) override {
+    if (i < 0 || i >= schema_->num_columns()) {
+      throw ParquetException("Invalid column ordinal: ", i);
+    }
+    if (builders_.empty()) {
+      throw ParquetException("No row group appended to BloomFilterBuilder.");
+    }
+    const ColumnDescriptor* descr = schema_->Column(i);
+    const auto& options = properties_->bloom_filter_options(descr->path());
+    if (!options.has_value() || descr->physical_type() == Type::BOOLEAN) {
+      return nullptr;
+    }
+    std::unique_ptr<ColumnBloomFilterBuilder>& builder = builders_.back()[i];
+    if (builder == nullptr) {
+      builder = ColumnBloomFilterBuilder::Make(*options, properties_->memory_pool());
+    }
+    return builder.get();
+  }
+
+  void WriteTo(::arrow::io::OutputStream* sink,
+               BloomFilterLocation* location) const override {
+    location->bloom_filter_location.clear();
+    const auto num_columns = static_cast<size_t>(schema_->num_columns());
+    for (size_t row_group = 0; row_group < builders_.size(); ++row_group) {
+      bool has_bloom_filter = false;
+      std::vector<std::optional<IndexLocation>> locations(num_columns, std::nullopt);
+      for (size_t column = 0; column < num_columns; ++column) {
+        const auto& builder = builders_[row_group][column];
+        if (builder == nullptr || builder->bloom_filter() == nullptr) {
+          continue;
+        }
+        PARQUET_ASSIGN_OR_THROW(int64_t pos_before_write, sink->Tell());
+        builder->bloom_filter()->WriteTo(sink);
+        PARQUET_ASSIGN_OR_THROW(int64_t pos_after_write, sink->Tell());
+        locations[column] = {pos_before_write,
+                             static_cast<int32_t>(pos_after_write - pos_before_write)};
+        has_bloom_filter = true;
+      }
+      if (has_bloom_filter) {
+        location->bloom_filter_location.emplace(row_group, std::move(locations));
+      }
+    }
+  }
+
+ private:
+  const SchemaDescriptor* schema_;
+  const WriterProperties* properties_;
+  // Builders indexed by row group ordinal, then by column ordinal
+  std::vector<std::vector<std::unique_ptr<ColumnBloomFilterBuilder>>> builders_;
+};
+
+}  // namespace
+
+std::unique_ptr<ColumnBloomFilterBuilder> ColumnBloomFilterBuilder::Make(
+    const BloomFilterOptions& options, ::arrow::MemoryPool* pool) {
+  return std::make_unique<ColumnBloomFilterBuilderImpl>(options, pool);
+}
+
+std::unique_ptr<BloomFilterBuilder> BloomFilterBuilder::Make(
+    const SchemaDescriptor* schema, const WriterProperties* properties) {
+  return std::make_unique<BloomFilterBuilderImpl>(schema, properties);
+}
+
+}  // namespace parquet
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "arrow/io/type_fwd.h"
+#include "parquet/platform.h"
+#include "parquet/type_fwd.h"
+
+namespace parquet {
+
+class BloomFilter;
+class Hasher;
+struct BloomFilterLocation;
+struct BloomFilterOptions;
+
+/// \brief Interface for collecting the values of a column chunk into its bloom filter.
+///
+/// The values are hashed while the column chunk is written, and the bloom filter is
+/// built when the column chunk is closed. Unless BloomFilterOptions::ndv is set, the
+/// filter is sized from the number of distinct values estimated by a HyperLogLog
+/// sketch of the hashes.
+class PARQUET_EXPORT ColumnBloomFilterBuilder {
+ public:
+  /// \brief API convenience to create a ColumnBloomFilterBuilder.
+  static std::unique_ptr<ColumnBloomFilterBuilder> Make(
+      const BloomFilterOptions& options,
+      ::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
+
+  virtual ~ColumnBloomFilterBuilder() = default;
+
+  /// \brief The hasher to apply to the values before inserting them.
+  virtual const Hasher& hasher() const = 0;
+
+  /// \brief Insert the hashes of non-null values of the column chunk.
+  virtual void InsertHashes(const uint64_t* hashes, int64_t num_hashes) = 0;
+
+  /// \brief Estimate the number of distinct values inserted so far.
+  virtual int64_t EstimateDistinctCount() const = 0;
+
+  /// \brief Build the bloom filter of the column chunk and no more insert is allowed.
+  ///
+  /// \param dictionary_encoded Whether all data pages of the column chunk are
+  /// dictionary-encoded. If so and BloomFilterOptions::ndv is unset, no bloom filter
+  /// is built as the dictionary page already lists the values of the column chunk.
+  virtual void Finish(bool dictionary_encoded) = 0;
+
+  /// \brief The bloom filter built by Finish(), or nullptr if there is none.
+  virtual const BloomFilter* bloom_filter() const = 0;
+};
+
+/// \brief Interface for collecting the bloom filters of a parquet file.
+class PARQUET_EXPORT BloomFilterBuilder {
+ public:
+  /// \brief API convenience to create a BloomFilterBuilder.
+  static std::unique_ptr<BloomFilterBuilder> Make(const SchemaDescriptor* schema,
+                                                  const WriterProperties* properties);
+
+  virtual ~BloomFilterBuilder() = default;
+
+  /// \brief Start a new row group.
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief Get the ColumnBloomFilterBuilder from column ordinal.
+  ///
+  /// \param i Column ordinal.
+  /// \return ColumnBloomFilterBuilder for the column and its memory ownership belongs
+  /// to the BloomFilterBuilder, or nullptr if no bloom filter is written for the
+  /// column.
+  virtual ColumnBloomFilterBuilder* GetColumnBloomFilterBuilder(int32_t i) = 0;
+
+  /// \brief Serialize the bloom filters of all row groups.
+  ///
+  /// \param[out] sink The output stream to write the bloom filters.
+  /// \param[out] location The location of all bloom filters to the start of sink.
+  virtual void WriteTo(::arrow::io::OutputStream* sink,
+                       BloomFilterLocation* location) const = 0;
+};
+
+}  // namespace parquet
@@ -16,6 +16,10 @@
 // under the License.
 
 #include "parquet/bloom_filter_reader.h"
+
+#include <unordered_map>
+
+#include "arrow/io/memory.h"
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
@@ -24,12 +28,17 @@ namespace parquet {
 
 class RowGroupBloomFilterReaderImpl final : public RowGroupBloomFilterReader {
  public:
-  RowGroupBloomFilterReaderImpl(std::shared_ptr<::arrow::io::RandomAccessFile> input,
-                                std::shared_ptr<RowGroupMetaData> row_group_metadata,
-                                const ReaderProperties& properties)
+  RowGroupBloomFilterReaderImpl(
+      std::shared_ptr<::arrow::io::RandomAccessFile> input,
+      std::shared_ptr<RowGroupMetaData> row_group_metadata,
+      const ReaderProperties& properties,
+      std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache,
+      std::unordered_map<int32_t, ::arrow::io::ReadRange> cached_ranges)
       : input_(std::move(input)),
         row_group_metadata_(std::move(row_group_metadata)),
-        properties_(properties) {}
+        properties_(properties),
+        cache_(std::move(cache)),
+        cached_ranges_(std::move(cached_ranges)) {}
 
   std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override;
 
@@ -42,6 +51,12 @@ class RowGroupBloomFilterReaderImpl final : public RowGroupBloomFilterReader {
 
   /// Reader properties used to deserialize thrift object.
   const ReaderProperties& properties_;
+
+  /// The cache holding the bloom filters prefetched by WillNeed(), if any.
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache_;
+
+  /// Read ranges of the prefetched bloom filters. Key is the column ordinal.
+  std::unordered_map<int32_t, ::arrow::io::ReadRange> cached_ranges_;
 };
 
 std::unique_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter(int i) {
@@ -73,6 +88,14 @@ std::unique_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter
           "bloom filter length + bloom filter offset greater than file size");
     }
   }
+  auto cached_range = cached_ranges_.find(i);
+  if (cached_range != cached_ranges_.end()) {
+    PARQUET_ASSIGN_OR_THROW(auto buffer, cache_->Read(cached_range->second));
+    ::arrow::io::BufferReader stream(std::move(buffer));
+    auto bloom_filter =
+        BlockSplitBloomFilter::Deserialize(properties_, &stream, bloom_filter_length);
+    return std::make_unique<BlockSplitBloomFilter>(std::move(bloom_filter));
+  }
   auto stream = ::arrow::io::RandomAccessFile::GetStream(
       input_, *bloom_filter_offset, file_size - *bloom_filter_offset);
   auto bloom_filter =
@@ -100,8 +123,60 @@ class BloomFilterReaderImpl final : public BloomFilterReader {
     }
 
     auto row_group_metadata = file_metadata_->RowGroup(i);
+    std::unordered_map<int32_t, ::arrow::io::ReadRange> cached_ranges;
+    auto iter = cached_ranges_.find(i);
+    if (iter != cached_ranges_.cend()) {
+      cached_ranges = iter->second;
+    }
     return std::make_shared<RowGroupBloomFilterReaderImpl>(
-        input_, std::move(row_group_metadata), properties_);
+        input_, std::move(row_group_metadata), properties_, cache_,
+        std::move(cached_ranges));
+  }
+
+  void WillNeed(const std::vector<int32_t>& row_group_indices,
+                const std::vector<int32_t>& column_indices,
+                const ::arrow::io::IOContext& ctx,
+                const ::arrow::io::CacheOptions& options) override {
+    cache_ =
+        std::make_shared<::arrow::io::internal::ReadRangeCache>(input_, ctx, options);
+    cached_ranges_.clear();
+    std::vector<::arrow::io::ReadRange> read_ranges;
+    for (int32_t row_group_ordinal : row_group_indices) {
+      if (row_group_ordinal < 0 ||
+          row_group_ordinal >= file_metadata_->num_row_groups()) {
+        throw ParquetException("Invalid row group ordinal: ", row_group_ordinal);
+      }
+      auto row_group_metadata = file_metadata_->RowGroup(row_group_ordinal);
+      auto add_column = [&](int32_t column_ordinal) {
+        if (column_ordinal < 0 || column_ordinal >= row_group_metadata->num_columns()) {
+          throw ParquetException("Invalid column index at column ordinal ",
+                                 column_ordinal);
+        }
+        auto col_chunk = row_group_metadata->ColumnChunk(column_ordinal);
+        auto bloom_filter_offset = col_chunk->bloom_filter_offset();
+        auto bloom_filter_length = col_chunk->bloom_filter_length();
+        // Without a recorded length the read range is unknown, and encrypted
+        // bloom filters cannot be read anyway.
+        if (!bloom_filter_offset.has_value() || !bloom_filter_length.has_value() ||
+            *bloom_filter_offset < 0 || *bloom_filter_length <= 0 ||
+            col_chunk->crypto_metadata() != nullptr) {
+          return;
+        }
+        ::arrow::io::ReadRange read_range{*bloom_filter_offset, *bloom_filter_length};
+        cached_ranges_[row_group_ordinal][column_ordinal] = read_range;
+        read_ranges.push_back(read_range);
+      };
+      if (column_indices.empty()) {
+        for (int32_t i = 0; i < row_group_metadata->num_columns(); ++i) {
+          add_column(i);
+        }
+      } else {
+        for (int32_t column_ordinal : column_indices) {
+          add_column(column_ordinal);
+        }
+      }
+    }
+    PARQUET_THROW_NOT_OK(cache_->Cache(std::move(read_ranges)));
   }
 
  private:
@@ -113,6 +188,14 @@ class BloomFilterReaderImpl final : public BloomFilterReader {
 
   /// Reader properties used to deserialize thrift object.
   const ReaderProperties& properties_;
+
+  /// The cache holding the bloom filters prefetched by WillNeed().
+  std::shared_ptr<::arrow::io::internal::ReadRangeCache> cache_;
+
+  /// Read ranges of the bloom filters prefetched by WillNeed(). Keys are the row
+  /// group ordinal and then the column ordinal.
+  std::unordered_map<int32_t, std::unordered_map<int32_t, ::arrow::io::ReadRange>>
+      cached_ranges_;
 };
 
 std::unique_ptr<BloomFilterReader> BloomFilterReader::Make(
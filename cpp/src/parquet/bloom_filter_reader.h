@@ -17,6 +17,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "arrow/io/caching.h"
 #include "arrow/io/interfaces.h"
 #include "parquet/properties.h"
 #include "parquet/type_fwd.h"
@@ -63,6 +68,25 @@ class PARQUET_EXPORT BloomFilterReader {
   ///          to the RowGroupBloomFilterReader.
   /// \throws ParquetException if the index is out of bound.
   virtual std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) = 0;
+
+  /// \brief Advise the reader which bloom filters will be read later.
+  ///
+  /// The bloom filters of the given columns in the given row groups whose length
+  /// is recorded in the column chunk metadata are prefetched with coalesced reads,
+  /// so that reading them later does not issue one IO per column chunk. Bloom
+  /// filters that were not requested can still be read, but without prefetching.
+  /// Later calls to WillNeed() override previous calls.
+  ///
+  /// \param[in] row_group_indices list of row group ordinal to read bloom filters of
+  ///            later.
+  /// \param[in] column_indices list of column ordinal to read bloom filters of later.
+  ///            If it is empty, it means all columns in the row groups will be read.
+  /// \param[in] ctx the IO context on which the reads are issued.
+  /// \param[in] options the options used to coalesce the reads.
+  virtual void WillNeed(const std::vector<int32_t>& row_group_indices,
+                        const std::vector<int32_t>& column_indices,
+                        const ::arrow::io::IOContext& ctx,
+                        const ::arrow::io::CacheOptions& options) = 0;
 };
 
 }  // namespace parquet
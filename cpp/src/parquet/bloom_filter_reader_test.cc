@@ -18,9 +18,13 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
 #include "parquet/bloom_filter.h"
 #include "parquet/bloom_filter_reader.h"
+#include "parquet/column_writer.h"
 #include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
 #include "parquet/test_util.h"
 
 namespace parquet::test {
@@ -80,4 +84,101 @@ TEST(BloomFilterReader, FileNotHaveBloomFilter) {
   ASSERT_EQ(nullptr, bloom_filter);
 }
 
+TEST(BloomFilterReader, WillNeed) {
+  // The bloom filter length is only recorded in the second file, so that the
+  // bloom filter of the first one is read without prefetching.
+  std::vector<std::string> files = {"data_index_bloom_encoding_stats.parquet",
+                                    "data_index_bloom_encoding_with_length.parquet"};
+  for (const auto& test_file : files) {
+    std::string dir_string(parquet::test::get_data_dir());
+    std::string path = dir_string + "/" + test_file;
+    auto reader = ParquetFileReader::OpenFile(path, /*memory_map=*/false);
+    auto& bloom_filter_reader = reader->GetBloomFilterReader();
+    EXPECT_THROW(bloom_filter_reader.WillNeed({1}, {}, ::arrow::io::default_io_context(),
+                                              ::arrow::io::CacheOptions::Defaults()),
+                 ParquetException);
+    bloom_filter_reader.WillNeed({0}, {0}, ::arrow::io::default_io_context(),
+                                 ::arrow::io::CacheOptions::Defaults());
+    auto bloom_filter = bloom_filter_reader.RowGroup(0)->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, bloom_filter);
+
+    std::string_view exists = "Hello";
+    ByteArray exists_ba{exists};
+    EXPECT_TRUE(bloom_filter->FindHash(bloom_filter->Hash(&exists_ba)));
+    std::string_view not_exists = "NOT_EXISTS";
+    ByteArray not_exists_ba{not_exists};
+    EXPECT_FALSE(bloom_filter->FindHash(bloom_filter->Hash(&not_exists_ba)));
+  }
+}
+
+TEST(BloomFilterReader, ReadWrittenBloomFilter) {
+  constexpr int kNumRows = 10000;
+  auto schema = std::static_pointer_cast<schema::GroupNode>(schema::GroupNode::Make(
+      "schema", Repetition::REQUIRED,
+      {schema::PrimitiveNode::Make("id", Repetition::OPTIONAL, Type::INT64),
+       schema::PrimitiveNode::Make("category", Repetition::REQUIRED, Type::BYTE_ARRAY),
+       schema::PrimitiveNode::Make("flag", Repetition::REQUIRED, Type::BOOLEAN)}));
+  auto properties = WriterProperties::Builder()
+                        .enable_bloom_filter()
+                        ->disable_dictionary("id")
+                        ->build();
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    auto row_group_writer = file_writer->AppendRowGroup();
+    // Unique ids, every tenth one being null
+    std::vector<int64_t> ids;
+    std::vector<int16_t> id_def_levels;
+    for (int i = 0; i < kNumRows; ++i) {
+      id_def_levels.push_back(i % 10 == 0 ? 0 : 1);
+      if (i % 10 != 0) ids.push_back(row_group * kNumRows + i);
+    }
+    static_cast<Int64Writer*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, id_def_levels.data(), nullptr, ids.data());
+    // A few categories fitting in the dictionary
+    std::vector<std::string> names = {"a", "b", "c"};
+    std::vector<ByteArray> categories;
+    for (int i = 0; i < kNumRows; ++i) {
+      categories.emplace_back(names[i % names.size()]);
+    }
+    static_cast<ByteArrayWriter*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, nullptr, nullptr, categories.data());
+    auto flags = std::make_unique<bool[]>(kNumRows);
+    std::fill_n(flags.get(), kNumRows, true);
+    static_cast<BoolWriter*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, nullptr, nullptr, flags.get());
+  }
+  file_writer->Close();
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto& bloom_filter_reader = reader->GetBloomFilterReader();
+  for (int row_group = 0; row_group < 2; ++row_group) {
+    auto row_group_reader = bloom_filter_reader.RowGroup(row_group);
+    auto id_filter = row_group_reader->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, id_filter);
+    // Sized from the estimated number of distinct values
+    ASSERT_GE(id_filter->GetBitsetSize(),
+              BlockSplitBloomFilter::OptimalNumOfBytes(kNumRows * 9 / 20, 0.05));
+    ASSERT_LE(id_filter->GetBitsetSize(),
+              BlockSplitBloomFilter::OptimalNumOfBytes(kNumRows * 9 * 2 / 10, 0.05));
+    int num_false_positives = 0;
+    for (int i = 0; i < kNumRows; ++i) {
+      const int64_t id = row_group * kNumRows + i;
+      if (i % 10 != 0) {
+        ASSERT_TRUE(id_filter->FindHash(id_filter->Hash(id)));
+      } else {
+        num_false_positives += id_filter->FindHash(id_filter->Hash(id));
+      }
+    }
+    ASSERT_LT(num_false_positives, kNumRows / 10 / 5);
+    // The dictionary of low-cardinality columns is enough
+    ASSERT_EQ(nullptr, row_group_reader->GetColumnBloomFilter(1));
+    // Booleans have no bloom filter
+    ASSERT_EQ(nullptr, row_group_reader->GetColumnBloomFilter(2));
+  }
+}
+
 }  // namespace parquet::test
@@ -32,8 +32,10 @@
 #include "arrow/testing/random.h"
 
 #include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_builder.h"
 #include "parquet/exception.h"
 #include "parquet/platform.h"
+#include "parquet/properties.h"
 #include "parquet/test_util.h"
 #include "parquet/types.h"
 #include "parquet/xxhasher.h"
@@ -434,5 +436,50 @@ TYPED_TEST(TestBatchBloomFilter, Basic) {
   AssertBufferEqual(*buffer, *batch_insert_buffer);
 }
 
+TEST(ColumnBloomFilterBuilder, EstimatedSize) {
+  constexpr int64_t kNumDistinct = 100000;
+  auto builder = ColumnBloomFilterBuilder::Make(BloomFilterOptions{});
+  // Every value is inserted twice
+  std::vector<uint64_t> hashes(kNumDistinct);
+  for (int64_t i = 0; i < kNumDistinct; ++i) {
+    hashes[i] = builder->hasher().Hash(i);
+  }
+  builder->InsertHashes(hashes.data(), kNumDistinct);
+  builder->InsertHashes(hashes.data(), kNumDistinct);
+
+  const int64_t estimate = builder->EstimateDistinctCount();
+  ASSERT_GT(estimate, kNumDistinct * 95 / 100);
+  ASSERT_LT(estimate, kNumDistinct * 105 / 100);
+
+  builder->Finish(/*dictionary_encoded=*/false);
+  const BloomFilter* filter = builder->bloom_filter();
+  ASSERT_NE(nullptr, filter);
+  ASSERT_EQ(BlockSplitBloomFilter::OptimalNumOfBytes(static_cast<uint32_t>(estimate),
+                                                     /*fpp=*/0.05),
+            filter->GetBitsetSize());
+  for (uint64_t hash : hashes) {
+    ASSERT_TRUE(filter->FindHash(hash));
+  }
+}
+
+TEST(ColumnBloomFilterBuilder, DictionaryEncoded) {
+  std::vector<uint64_t> hashes = {1, 2, 3};
+  // The dictionary page is enough unless the number of distinct values is given
+  auto builder = ColumnBloomFilterBuilder::Make(BloomFilterOptions{});
+  builder->InsertHashes(hashes.data(), static_cast<int64_t>(hashes.size()));
+  builder->Finish(/*dictionary_encoded=*/true);
+  ASSERT_EQ(nullptr, builder->bloom_filter());
+
+  BloomFilterOptions options;
+  options.ndv = 1000;
+  options.fpp = 0.01;
+  builder = ColumnBloomFilterBuilder::Make(options);
+  builder->InsertHashes(hashes.data(), static_cast<int64_t>(hashes.size()));
+  builder->Finish(/*dictionary_encoded=*/true);
+  ASSERT_NE(nullptr, builder->bloom_filter());
+  ASSERT_EQ(BlockSplitBloomFilter::OptimalNumOfBytes(1000, 0.01),
+            builder->bloom_filter()->GetBitsetSize());
+}
+
 }  // namespace test
 }  // namespace parquet
@@ -18,10 +18,14 @@
 #include "parquet/column_reader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <exception>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -36,14 +40,19 @@
 #include "arrow/array/builder_primitive.h"
 #include "arrow/chunked_array.h"
 #include "arrow/type.h"
+#include "arrow/util/binary_view_util.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/counters.h"
 #include "arrow/util/crc32.h"
+#include "arrow/util/future.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/unreachable.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
@@ -199,6 +208,32 @@ int LevelDecoder::Decode(int batch_size, int16_t* levels) {
   return num_decoded;
 }
 
+int LevelDecoder::DecodeBitmap(int batch_size, uint8_t* bitmap, int64_t bitmap_offset) {
+  ARROW_DCHECK_EQ(max_level_, 1);
+  int num_decoded = 0;
+
+  int num_values = std::min(num_values_remaining_, batch_size);
+  if (encoding_ == Encoding::RLE) {
+    num_decoded = rle_decoder_->GetBatchBitmap(bitmap, bitmap_offset, num_values);
+    if (ARROW_PREDICT_FALSE(num_decoded < num_values &&
+                            num_values_remaining_ > num_decoded)) {
+      // Either the data is truncated, or a run repeats a level above 1, which the
+      // generic decoder reports
+      int16_t level = 0;
+      if (rle_decoder_->Get(&level) && level > max_level_) {
+        std::stringstream ss;
+        ss << "Malformed levels. max: " << level
+           << " out of range.  Max Level: " << max_level_;
+        throw ParquetException(ss.str());
+      }
+    }
+  } else if (bit_packed_decoder_->GetBits(num_values, bitmap, bitmap_offset)) {
+    num_decoded = num_values;
+  }
+  num_values_remaining_ -= num_decoded;
+  return num_decoded;
+}
+
 ReaderProperties default_reader_properties() {
   static ReaderProperties default_reader_properties;
   return default_reader_properties;
@@ -206,6 +241,12 @@ ReaderProperties default_reader_properties() {
 
 namespace {
 
+std::unique_ptr<::arrow::util::Codec> GetPageCodec(Compression::type codec,
+                                                   const ReaderProperties& properties) {
+  const auto& codec_options = properties.codec_options();
+  return codec_options ? GetCodec(codec, *codec_options) : GetCodec(codec);
+}
+
 // Extracts encoded statistics from V1 and V2 data page headers
 template <typename H>
 EncodedStatistics ExtractStatsFromHeader(const H& header) {
@@ -248,6 +289,89 @@ void CheckNumValuesInHeader(int num_values) {
   }
 }
 
+// Decompresses page_buffer into decompression_buffer, copying the first
+// levels_byte_len bytes (the uncompressed levels of a V2 page) as-is.
+// Returns page_buffer unchanged when there is no decompressor.
+std::shared_ptr<Buffer> DecompressIfNeeded(
+    ::arrow::util::Codec* decompressor,
+    const std::shared_ptr<ResizableBuffer>& decompression_buffer,
+    std::shared_ptr<Buffer> page_buffer, int compressed_len, int uncompressed_len,
+    int levels_byte_len = 0) {
+  if (decompressor == nullptr) {
+    return page_buffer;
+  }
+  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
+    throw ParquetException("Invalid page header");
+  }
+
+  // Grow the uncompressed buffer if we need to.
+  PARQUET_THROW_NOT_OK(
+      decompression_buffer->Resize(uncompressed_len, /*shrink_to_fit=*/false));
+
+  if (levels_byte_len > 0) {
+    // First copy the levels as-is
+    uint8_t* decompressed = decompression_buffer->mutable_data();
+    memcpy(decompressed, page_buffer->data(), levels_byte_len);
+  }
+
+  // Decompress the values
+  PARQUET_ASSIGN_OR_THROW(
+      auto decompressed_len,
+      decompressor->Decompress(compressed_len - levels_byte_len,
+                               page_buffer->data() + levels_byte_len,
+                               uncompressed_len - levels_byte_len,
+                               decompression_buffer->mutable_data() + levels_byte_len));
+  if (decompressed_len != uncompressed_len - levels_byte_len) {
+    throw ParquetException("Page didn't decompress to expected size, expected: " +
+                           std::to_string(uncompressed_len - levels_byte_len) +
+                           ", but got:" + std::to_string(decompressed_len));
+  }
+
+  return decompression_buffer;
+}
+
+// A page whose payload has been read but not yet decompressed. The page is
+// built by whichever of the executor and the reader gets to it first, so the
+// reader never blocks on a task that is still queued behind its own thread.
+class PendingPage {
+ public:
+  using Task = std::function<std::shared_ptr<Page>()>;
+
+  explicit PendingPage(Task task)
+      : task_(std::move(task)), done_(::arrow::Future<>::Make()) {}
+
+  // Builds the page unless another thread already claimed it.
+  void TryRun() {
+    if (claimed_.exchange(true)) return;
+    result_ = [&]() -> ::arrow::Result<std::shared_ptr<Page>> {
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      return task_();
+      END_PARQUET_CATCH_EXCEPTIONS
+    }();
+    task_ = nullptr;
+    done_.MarkFinished();
+  }
+
+  // Marks the page as no longer needed, if it was not started yet.
+  void Cancel() {
+    if (claimed_.exchange(true)) return;
+    task_ = nullptr;
+    done_.MarkFinished();
+  }
+
+  ::arrow::Result<std::shared_ptr<Page>> Get() {
+    TryRun();
+    done_.Wait();
+    return result_;
+  }
+
+ private:
+  Task task_;
+  std::atomic<bool> claimed_{false};
+  ::arrow::Future<> done_;
+  ::arrow::Result<std::shared_ptr<Page>> result_;
+};
+
 // ----------------------------------------------------------------------
 // SerializedPageReader deserializes Thrift metadata and pages that have been
 // assembled in a serialized stream for storing in a Parquet files
@@ -272,8 +396,19 @@ class SerializedPageReader : public PageReader {
       InitDecryption();
     }
     max_page_header_size_ = kDefaultMaxPageHeaderSize;
-    decompressor_ = GetCodec(codec);
+    codec_ = codec;
+    decompressor_ = GetPageCodec(codec, properties_);
     always_compressed_ = always_compressed;
+    // Decrypted pages share decryption_buffer_, so they are not read ahead.
+    if (decompressor_ != nullptr && crypto_ctx == nullptr) {
+      page_readahead_ = std::max(properties_.page_readahead(), 0);
+    }
+  }
+
+  ~SerializedPageReader() override {
+    for (const auto& pending : pending_pages_) {
+      pending->Cancel();
+    }
   }
 
   // Implement the PageReader interface
@@ -281,7 +416,8 @@ class SerializedPageReader : public PageReader {
   // The returned Page contains references that aren't guaranteed to live
   // beyond the next call to NextPage(). SerializedPageReader reuses the
   // decryption and decompression buffers internally, so if NextPage() is
-  // called then the content of previous page might be invalidated.
+  // called then the content of previous page might be invalidated
+  // (unless pages are read ahead, see ReaderProperties::page_readahead()).
   std::shared_ptr<Page> NextPage() override;
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
@@ -292,9 +428,16 @@ class SerializedPageReader : public PageReader {
 
   void InitDecryption();
 
-  std::shared_ptr<Buffer> DecompressIfNeeded(std::shared_ptr<Buffer> page_buffer,
-                                             int compressed_len, int uncompressed_len,
-                                             int levels_byte_len = 0);
+  // Reads the next page header and the (decrypted) page payload. Returns a
+  // task building the page, which decompresses the payload with decompressor
+  // into decompression_buffer, or an empty task at the end of the stream.
+  PendingPage::Task ReadPage(
+      std::shared_ptr<::arrow::util::Codec> decompressor,
+      std::shared_ptr<ResizableBuffer> decompression_buffer);
+
+  // Keeps up to page_readahead_ pages decompressing on the executor and
+  // returns the oldest one.
+  std::shared_ptr<Page> NextPrefetchedPage();
 
   // Returns true for non-data pages, and if we should skip based on
   // data_page_filter_. Performs basic checks on values in the page header.
@@ -308,9 +451,16 @@ class SerializedPageReader : public PageReader {
   std::shared_ptr<Page> current_page_;
 
   // Compression codec to use.
-  std::unique_ptr<::arrow::util::Codec> decompressor_;
+  Compression::type codec_;
+  std::shared_ptr<::arrow::util::Codec> decompressor_;
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
 
+  // Pages read ahead, in stream order. Each of them owns its decompressor
+  // and decompression buffer.
+  int32_t page_readahead_ = 0;
+  bool readahead_exhausted_ = false;
+  std::deque<std::shared_ptr<PendingPage>> pending_pages_;
+
   bool always_compressed_;
 
   // The fields below are used for calculation of AAD (additional authenticated data)
@@ -422,6 +572,47 @@ bool SerializedPageReader::ShouldSkipPage(EncodedStatistics* data_page_statistic
 }
 
 std::shared_ptr<Page> SerializedPageReader::NextPage() {
+  if (page_readahead_ > 0) {
+    return NextPrefetchedPage();
+  }
+  if (decompression_buffer_.use_count() > 1) {
+    // The previous page is still referenced (e.g. by binary views), so it must
+    // not be overwritten.
+    decompression_buffer_ = AllocateBuffer(properties_.memory_pool(), 0);
+  }
+  PendingPage::Task task = ReadPage(decompressor_, decompression_buffer_);
+  return task ? task() : nullptr;
+}
+
+std::shared_ptr<Page> SerializedPageReader::NextPrefetchedPage() {
+  ::arrow::internal::Executor* executor = properties_.page_decompression_executor();
+  if (executor == nullptr) {
+    executor = ::arrow::internal::GetCpuThreadPool();
+  }
+  while (!readahead_exhausted_ &&
+         static_cast<int32_t>(pending_pages_.size()) < page_readahead_) {
+    PendingPage::Task task = ReadPage(GetPageCodec(codec_, properties_),
+                                      AllocateBuffer(properties_.memory_pool(), 0));
+    if (!task) {
+      readahead_exhausted_ = true;
+      break;
+    }
+    auto pending = std::make_shared<PendingPage>(std::move(task));
+    PARQUET_THROW_NOT_OK(executor->Spawn([pending] { pending->TryRun(); }));
+    pending_pages_.push_back(std::move(pending));
+  }
+  if (pending_pages_.empty()) {
+    return nullptr;
+  }
+  std::shared_ptr<PendingPage> pending = std::move(pending_pages_.front());
+  pending_pages_.pop_front();
+  PARQUET_ASSIGN_OR_THROW(auto page, pending->Get());
+  return page;
+}
+
+PendingPage::Task SerializedPageReader::ReadPage(
+    std::shared_ptr<::arrow::util::Codec> decompressor,
+    std::shared_ptr<ResizableBuffer> decompression_buffer) {
   ThriftDeserializer deserializer(properties_);
 
   // Loop here because there may be unhandled page types that we skip until
@@ -435,7 +626,7 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
     // until a maximum allowed header limit
     while (true) {
       PARQUET_ASSIGN_OR_THROW(auto view, stream_->Peek(allowed_page_size));
-      if (view.size() == 0) return nullptr;
+      if (view.size() == 0) return {};
 
       // This gets used, then set by DeserializeThriftMsg
       header_size = static_cast<uint32_t>(view.size());
@@ -489,6 +680,12 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
          << compressed_len << ")";
       ParquetException::EofException(ss.str());
     }
+    static ::arrow::util::Counter* const pages_read =
+        ::arrow::util::GetCounter("parquet.read.pages");
+    static ::arrow::util::Counter* const bytes_decoded =
+        ::arrow::util::GetCounter("parquet.decode.bytes");
+    pages_read->Add();
+    bytes_decoded->Add(uncompressed_len);
 
     const PageType::type page_type = LoadEnumSafe(&current_page_header_.type);
 
@@ -507,6 +704,10 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     // Decrypt it if we need to
     if (crypto_ctx_.data_decryptor != nullptr) {
+      if (decryption_buffer_.use_count() > 1) {
+        // An uncompressed previous page is still referenced
+        decryption_buffer_ = AllocateBuffer(properties_.memory_pool(), 0);
+      }
       PARQUET_THROW_NOT_OK(decryption_buffer_->Resize(
           compressed_len - crypto_ctx_.data_decryptor->CiphertextSizeDelta(),
           /*shrink_to_fit=*/false));
@@ -521,24 +722,41 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       const format::DictionaryPageHeader& dict_header =
           current_page_header_.dictionary_page_header;
       bool is_sorted = dict_header.__isset.is_sorted ? dict_header.is_sorted : false;
-
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DictionaryPage>(page_buffer, dict_header.num_values,
-                                              LoadEnumSafe(&dict_header.encoding),
-                                              is_sorted);
+      int32_t num_values = dict_header.num_values;
+      Encoding::type encoding = LoadEnumSafe(&dict_header.encoding);
+
+      return [decompressor = std::move(decompressor),
+              decompression_buffer = std::move(decompression_buffer),
+              page_buffer = std::move(page_buffer), compressed_len, uncompressed_len,
+              num_values, encoding, is_sorted]() -> std::shared_ptr<Page> {
+        auto decompressed = DecompressIfNeeded(decompressor.get(), decompression_buffer,
+                                               page_buffer, compressed_len,
+                                               uncompressed_len);
+        return std::make_shared<DictionaryPage>(std::move(decompressed), num_values,
+                                                encoding, is_sorted);
+      };
     } else if (page_type == PageType::DATA_PAGE) {
       ++page_ordinal_;
       const format::DataPageHeader& header = current_page_header_.data_page_header;
-      page_buffer =
-          DecompressIfNeeded(std::move(page_buffer), compressed_len, uncompressed_len);
-
-      return std::make_shared<DataPageV1>(page_buffer, header.num_values,
-                                          LoadEnumSafe(&header.encoding),
-                                          LoadEnumSafe(&header.definition_level_encoding),
-                                          LoadEnumSafe(&header.repetition_level_encoding),
-                                          uncompressed_len, data_page_statistics);
+      int32_t num_values = header.num_values;
+      Encoding::type encoding = LoadEnumSafe(&header.encoding);
+      Encoding::type definition_level_encoding =
+          LoadEnumSafe(&header.definition_level_encoding);
+      Encoding::type repetition_level_encoding =
+          LoadEnumSafe(&header.repetition_level_encoding);
+
+      return [decompressor = std::move(decompressor),
+              decompression_buffer = std::move(decompression_buffer),
+              page_buffer = std::move(page_buffer), compressed_len, uncompressed_len,
+              num_values, encoding, definition_level_encoding, repetition_level_encoding,
+              data_page_statistics]() -> std::shared_ptr<Page> {
+        auto decompressed = DecompressIfNeeded(decompressor.get(), decompression_buffer,
+                                               page_buffer, compressed_len,
+                                               uncompressed_len);
+        return std::make_shared<DataPageV1>(
+            std::move(decompressed), num_values, encoding, definition_level_encoding,
+            repetition_level_encoding, uncompressed_len, data_page_statistics);
+      };
     } else if (page_type == PageType::DATA_PAGE_V2) {
       ++page_ordinal_;
       const format::DataPageHeaderV2& header = current_page_header_.data_page_header_v2;
@@ -556,58 +774,36 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
       }
       // DecompressIfNeeded doesn't take `is_compressed` into account as
       // it's page type-agnostic.
-      if (is_compressed) {
-        page_buffer = DecompressIfNeeded(std::move(page_buffer), compressed_len,
-                                         uncompressed_len, levels_byte_len);
+      if (!is_compressed) {
+        decompressor.reset();
       }
-
-      return std::make_shared<DataPageV2>(
-          page_buffer, header.num_values, header.num_nulls, header.num_rows,
-          LoadEnumSafe(&header.encoding), header.definition_levels_byte_length,
-          header.repetition_levels_byte_length, uncompressed_len, is_compressed,
-          data_page_statistics);
+      int32_t num_values = header.num_values;
+      int32_t num_nulls = header.num_nulls;
+      int32_t num_rows = header.num_rows;
+      Encoding::type encoding = LoadEnumSafe(&header.encoding);
+      int32_t definition_levels_byte_length = header.definition_levels_byte_length;
+      int32_t repetition_levels_byte_length = header.repetition_levels_byte_length;
+
+      return [decompressor = std::move(decompressor),
+              decompression_buffer = std::move(decompression_buffer),
+              page_buffer = std::move(page_buffer), compressed_len, uncompressed_len,
+              levels_byte_len, num_values, num_nulls, num_rows, encoding,
+              definition_levels_byte_length, repetition_levels_byte_length,
+              is_compressed, data_page_statistics]() -> std::shared_ptr<Page> {
+        auto decompressed = DecompressIfNeeded(decompressor.get(), decompression_buffer,
+                                               page_buffer, compressed_len,
+                                               uncompressed_len, levels_byte_len);
+        return std::make_shared<DataPageV2>(
+            std::move(decompressed), num_values, num_nulls, num_rows, encoding,
+            definition_levels_byte_length, repetition_levels_byte_length,
+            uncompressed_len, is_compressed, data_page_statistics);
+      };
     } else {
       throw ParquetException(
           "Internal error, we have already skipped non-data pages in ShouldSkipPage()");
     }
   }
-  return std::shared_ptr<Page>(nullptr);
-}
-
-std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
-    std::shared_ptr<Buffer> page_buffer, int compressed_len, int uncompressed_len,
-    int levels_byte_len) {
-  if (decompressor_ == nullptr) {
-    return page_buffer;
-  }
-  if (compressed_len < levels_byte_len || uncompressed_len < levels_byte_len) {
-    throw ParquetException("Invalid page header");
-  }
-
-  // Grow the uncompressed buffer if we need to.
-  PARQUET_THROW_NOT_OK(
-      decompression_buffer_->Resize(uncompressed_len, /*shrink_to_fit=*/false));
-
-  if (levels_byte_len > 0) {
-    // First copy the levels as-is
-    uint8_t* decompressed = decompression_buffer_->mutable_data();
-    memcpy(decompressed, page_buffer->data(), levels_byte_len);
-  }
-
-  // Decompress the values
-  PARQUET_ASSIGN_OR_THROW(
-      auto decompressed_len,
-      decompressor_->Decompress(compressed_len - levels_byte_len,
-                                page_buffer->data() + levels_byte_len,
-                                uncompressed_len - levels_byte_len,
-                                decompression_buffer_->mutable_data() + levels_byte_len));
-  if (decompressed_len != uncompressed_len - levels_byte_len) {
-    throw ParquetException("Page didn't decompress to expected size, expected: " +
-                           std::to_string(uncompressed_len - levels_byte_len) +
-                           ", but got:" + std::to_string(decompressed_len));
-  }
-
-  return decompression_buffer_;
+  return {};
 }
 
 }  // namespace
@@ -717,6 +913,9 @@ class ColumnReaderImplBase {
   bool ReadNewPage() {
     // Loop until we find the next data page.
     while (true) {
+      // Release the previous page first, so that the page reader may reuse its
+      // buffers unless they are referenced elsewhere.
+      current_page_.reset();
       current_page_ = pager_->NextPage();
       if (!current_page_) {
         // EOS
@@ -905,6 +1104,8 @@ class ColumnReaderImplBase {
     current_encoding_ = encoding;
     current_decoder_->SetData(static_cast<int>(num_buffered_values_), buffer,
                               static_cast<int>(data_size));
+    current_values_data_ = buffer;
+    current_values_size_ = data_size;
   }
 
   int64_t available_values_current_page() const {
@@ -942,6 +1143,11 @@ class ColumnReaderImplBase {
   DecoderType* current_decoder_;
   Encoding::type current_encoding_;
 
+  // The encoded values of the current data page. The data decoder was given
+  // num_buffered_values_ values at the start of them.
+  const uint8_t* current_values_data_ = nullptr;
+  int64_t current_values_size_ = 0;
+
   /// Flag to signal when a new dictionary has been set, for the benefit of
   /// DictionaryRecordReader
   bool new_dictionary_;
@@ -1360,6 +1566,11 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
 
   int64_t ReadRecords(int64_t num_records) override {
     if (num_records == 0) return 0;
+    if (decode_levels_to_bitmap_ && this->max_rep_level_ == 0 &&
+        this->max_def_level_ == 1 && !read_dense_for_nullable_ &&
+        !has_values_to_process()) {
+      return ReadOptionalRecordsToBitmap(num_records);
+    }
     // Delimit records, then read values at the end
     int64_t records_read = 0;
 
@@ -1645,6 +1856,7 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
 
   std::shared_ptr<ResizableBuffer> ReleaseValues() override {
     if (uses_values_) {
+      MaterializePageValues();
       auto result = values_;
       PARQUET_THROW_NOT_OK(
           result->Resize(bytes_for_values(values_written_), /*shrink_to_fit=*/true));
@@ -1656,6 +1868,15 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
     }
   }
 
+  std::shared_ptr<Buffer> ReleaseZeroCopyValues() override {
+    if (page_values_ == nullptr) {
+      return ReleaseValues();
+    }
+    auto result = std::move(page_values_);
+    page_values_.reset();
+    return result;
+  }
+
   std::shared_ptr<ResizableBuffer> ReleaseIsValid() override {
     if (nullable_values()) {
       auto result = valid_bits_;
@@ -1810,6 +2031,10 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
   void ResetDecoders() { this->decoders_.clear(); }
 
   virtual void ReadValuesSpaced(int64_t values_with_nulls, int64_t null_count) {
+    if (null_count == 0 && ReadPageValues(values_with_nulls)) {
+      return;
+    }
+    MaterializePageValues();
     uint8_t* valid_bits = valid_bits_->mutable_data();
     const int64_t valid_bits_offset = values_written_;
 
@@ -1820,11 +2045,81 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
   }
 
   virtual void ReadValuesDense(int64_t values_to_read) {
+    if (ReadPageValues(values_to_read)) {
+      return;
+    }
+    MaterializePageValues();
     int64_t num_decoded =
         this->current_decoder_->Decode(ValuesHead<T>(), static_cast<int>(values_to_read));
     CheckNumberDecoded(num_decoded, values_to_read);
   }
 
+  // Leave the next values in the current data page, extending page_values_ over
+  // them, if zero-copy values are enabled and all the values written so far lie
+  // in the same page just before them. Returns false if the values must be
+  // decoded instead.
+  bool ReadPageValues(int64_t values_to_read) {
+    constexpr bool kFixedWidth =
+        std::is_same_v<DType, Int32Type> || std::is_same_v<DType, Int64Type> ||
+        std::is_same_v<DType, FloatType> || std::is_same_v<DType, DoubleType>;
+    if constexpr (!kFixedWidth) {
+      return false;
+    } else {
+      if (!zero_copy_values_ || values_to_read == 0 ||
+          this->current_encoding_ != Encoding::PLAIN ||
+          (values_written_ > 0 && page_values_ == nullptr)) {
+        return false;
+      }
+      // Only view memory that the page reader will not overwrite, which excludes
+      // its decompression and decryption buffers and the column chunks it read
+      // into memory it allocated.
+      const std::shared_ptr<Buffer>& page_buffer = this->current_page_->buffer();
+      std::shared_ptr<Buffer> root = page_buffer;
+      while (root->parent() != nullptr) {
+        root = root->parent();
+      }
+      if (root->is_mutable() || !page_buffer->is_cpu()) {
+        return false;
+      }
+      const int64_t values_offset =
+          (this->num_buffered_values_ - this->current_decoder_->values_left()) *
+          static_cast<int64_t>(sizeof(T));
+      const int64_t values_size = values_to_read * static_cast<int64_t>(sizeof(T));
+      const uint8_t* data = this->current_values_data_ + values_offset;
+      if (values_offset + values_size > this->current_values_size_ ||
+          reinterpret_cast<uintptr_t>(data) % alignof(T) != 0) {
+        return false;
+      }
+      const int64_t page_offset = data - page_buffer->data();
+      if (page_values_ == nullptr) {
+        page_values_ = SliceBuffer(page_buffer, page_offset, values_size);
+      } else if (page_values_->parent() == page_buffer &&
+                 page_values_->data() + page_values_->size() == data) {
+        page_values_ =
+            SliceBuffer(page_buffer, page_values_->data() - page_buffer->data(),
+                        page_values_->size() + values_size);
+      } else {
+        return false;
+      }
+      // Move the decoder past the values
+      const int64_t remaining_size =
+          this->current_values_size_ - values_offset - values_size;
+      this->current_decoder_->SetData(
+          this->current_decoder_->values_left() - static_cast<int>(values_to_read),
+          data + values_size, static_cast<int>(remaining_size));
+      return true;
+    }
+  }
+
+  // Copy the values left in a data page to the values buffer.
+  void MaterializePageValues() {
+    if (page_values_ != nullptr) {
+      memcpy(values_->mutable_data(), page_values_->data(),
+             static_cast<size_t>(page_values_->size()));
+      page_values_.reset();
+    }
+  }
+
   // Reads repeated records and returns number of records read. Fills in
   // values_to_read and null_count.
   int64_t ReadRepeatedRecords(int64_t num_records, int64_t* values_to_read,
@@ -1872,6 +2167,37 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
     return records_read;
   }
 
+  // Reads optional, non-repeated records of a max definition level of 1,
+  // decoding their levels directly into the validity bitmap. Returns the number
+  // of records read and updates values_written_ and null_count_.
+  int64_t ReadOptionalRecordsToBitmap(int64_t num_records) {
+    int64_t records_read = 0;
+    while (records_read < num_records && this->HasNextInternal()) {
+      const int64_t batch_size =
+          std::min(num_records - records_read, this->available_values_current_page());
+      if (batch_size == 0) {
+        break;
+      }
+      ReserveValues(batch_size);
+      uint8_t* valid_bits = valid_bits_->mutable_data();
+      const int64_t levels_read = this->definition_level_decoder_.DecodeBitmap(
+          static_cast<int>(batch_size), valid_bits, values_written_);
+      // Exhausted column chunk
+      if (levels_read == 0) {
+        break;
+      }
+      const int64_t null_count =
+          levels_read -
+          ::arrow::internal::CountSetBits(valid_bits, values_written_, levels_read);
+      ReadValuesSpaced(levels_read, null_count);
+      values_written_ += levels_read;
+      null_count_ += null_count;
+      this->ConsumeBufferedValues(levels_read);
+      records_read += levels_read;
+    }
+    return records_read;
+  }
+
   // Reads required records and returns number of records read. Fills in
   // values_to_read.
   int64_t ReadRequiredRecords(int64_t num_records, int64_t* values_to_read) {
@@ -1998,6 +2324,7 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
   }
 
   void ResetValues() {
+    page_values_.reset();
     if (values_written_ > 0) {
       // Resize to 0, but do not shrink to fit
       if (uses_values_) {
@@ -2016,6 +2343,9 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
     return values_->mutable_data_as<T>() + values_written_;
   }
   LevelInfo leaf_info_;
+  // The values written since the last reset, when they were left in the data
+  // page they were read from. See RecordReader::set_zero_copy_values().
+  std::shared_ptr<Buffer> page_values_;
 };
 
 class FLBARecordReader final : public TypedRecordReader<FLBAType>,
@@ -2144,6 +2474,138 @@ class ByteArrayChunkedRecordReader final : public TypedRecordReader<ByteArrayTyp
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
+// Reads BYTE_ARRAY values into a BinaryViewArray. Values of PLAIN-encoded pages
+// and of dictionary-encoded pages are referenced in place, in the page buffer
+// and in the decoded dictionary respectively; only values produced by other
+// encodings are copied.
+class ByteArrayViewRecordReader final : public TypedRecordReader<ByteArrayType>,
+                                        virtual public BinaryRecordReader {
+ public:
+  using c_type = ::arrow::BinaryViewType::c_type;
+
+  ByteArrayViewRecordReader(const ColumnDescriptor* descr, LevelInfo leaf_info,
+                            ::arrow::MemoryPool* pool, bool read_dense_for_nullable)
+      : TypedRecordReader<ByteArrayType>(descr, leaf_info, pool, read_dense_for_nullable),
+        null_bitmap_builder_(pool),
+        views_builder_(pool),
+        heap_builder_(pool) {
+    ARROW_DCHECK_EQ(descr_->physical_type(), Type::BYTE_ARRAY);
+  }
+
+  ::arrow::ArrayVector GetBuilderChunks() override {
+    FinishHeap();
+    const int64_t null_count = null_bitmap_builder_.false_count();
+    const int64_t length = null_bitmap_builder_.length();
+    ARROW_DCHECK_EQ(length, views_builder_.length());
+    PARQUET_ASSIGN_OR_THROW(auto views, views_builder_.Finish());
+    PARQUET_ASSIGN_OR_THROW(auto null_bitmap, null_bitmap_builder_.Finish());
+    auto chunk = std::make_shared<::arrow::BinaryViewArray>(
+        ::arrow::binary_view(), length, std::move(views), std::move(data_buffers_),
+        std::move(null_bitmap), null_count);
+    data_buffers_.clear();
+    referenced_buffer_ = nullptr;
+    return ::arrow::ArrayVector({std::move(chunk)});
+  }
+
+  void ReadValuesDense(int64_t values_to_read) override {
+    scratch_.resize(values_to_read);
+    int64_t num_decoded = this->current_decoder_->Decode(
+        scratch_.data(), static_cast<int>(values_to_read));
+    CheckNumberDecoded(num_decoded, values_to_read);
+
+    PARQUET_THROW_NOT_OK(null_bitmap_builder_.Reserve(num_decoded));
+    PARQUET_THROW_NOT_OK(views_builder_.Reserve(num_decoded));
+    null_bitmap_builder_.UnsafeAppend(num_decoded, /*value=*/true);
+    const std::shared_ptr<Buffer> values_buffer = ValuesBuffer();
+    for (int64_t i = 0; i < num_decoded; i++) {
+      views_builder_.UnsafeAppend(MakeView(scratch_[i], values_buffer));
+    }
+    ResetValues();
+  }
+
+  void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
+    const uint8_t* valid_bits = valid_bits_->data();
+    const int64_t valid_bits_offset = values_written_;
+    scratch_.resize(values_to_read);
+    int64_t num_decoded = this->current_decoder_->DecodeSpaced(
+        scratch_.data(), static_cast<int>(values_to_read), static_cast<int>(null_count),
+        valid_bits_->mutable_data(), valid_bits_offset);
+    ARROW_DCHECK_EQ(num_decoded, values_to_read);
+
+    PARQUET_THROW_NOT_OK(null_bitmap_builder_.Reserve(num_decoded));
+    PARQUET_THROW_NOT_OK(views_builder_.Reserve(num_decoded));
+    null_bitmap_builder_.UnsafeAppend(valid_bits, valid_bits_offset, num_decoded);
+    const std::shared_ptr<Buffer> values_buffer = ValuesBuffer();
+    for (int64_t i = 0; i < num_decoded; i++) {
+      if (null_count == 0 ||
+          ::arrow::bit_util::GetBit(valid_bits, valid_bits_offset + i)) {
+        views_builder_.UnsafeAppend(MakeView(scratch_[i], values_buffer));
+      } else {
+        views_builder_.UnsafeAppend(c_type{});
+      }
+    }
+    ResetValues();
+  }
+
+ private:
+  // The buffer which values decoded from the current page point into, or
+  // nullptr if they point into memory owned by the decoder.
+  std::shared_ptr<Buffer> ValuesBuffer() const {
+    if (current_encoding_ == Encoding::PLAIN) {
+      return current_page_->buffer();
+    } else if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+      auto decoder = dynamic_cast<DictDecoder<ByteArrayType>*>(this->current_decoder_);
+      return decoder->dictionary_data();
+    }
+    return nullptr;
+  }
+
+  c_type MakeView(const ByteArray& value, const std::shared_ptr<Buffer>& values_buffer) {
+    const auto length = static_cast<int32_t>(value.len);
+    if (length <= ::arrow::BinaryViewType::kInlineSize) {
+      return ::arrow::util::ToInlineBinaryView(value.ptr, length);
+    }
+    if (values_buffer != nullptr) {
+      if (values_buffer.get() != referenced_buffer_) {
+        referenced_buffer_ = values_buffer.get();
+        referenced_buffer_index_ = static_cast<int32_t>(data_buffers_.size());
+        data_buffers_.push_back(values_buffer);
+      }
+      return ::arrow::util::ToBinaryView(
+          value.ptr, length, referenced_buffer_index_,
+          static_cast<int32_t>(value.ptr - values_buffer->data()));
+    }
+    // Copy values which do not outlive the decoder into a buffer of our own
+    if (heap_index_ < 0 ||
+        heap_builder_.length() > std::numeric_limits<int32_t>::max() - length) {
+      FinishHeap();
+      heap_index_ = static_cast<int32_t>(data_buffers_.size());
+      data_buffers_.push_back(nullptr);
+    }
+    const auto offset = static_cast<int32_t>(heap_builder_.length());
+    PARQUET_THROW_NOT_OK(heap_builder_.Append(value.ptr, length));
+    return ::arrow::util::ToBinaryView(value.ptr, length, heap_index_, offset);
+  }
+
+  void FinishHeap() {
+    if (heap_index_ >= 0) {
+      PARQUET_THROW_NOT_OK(heap_builder_.Finish(&data_buffers_[heap_index_]));
+      heap_index_ = -1;
+    }
+  }
+
+  std::vector<ByteArray> scratch_;
+  ::arrow::TypedBufferBuilder<bool> null_bitmap_builder_;
+  ::arrow::TypedBufferBuilder<c_type> views_builder_;
+  ::arrow::BufferVector data_buffers_;
+  // The last page or dictionary buffer appended to data_buffers_
+  const Buffer* referenced_buffer_ = nullptr;
+  int32_t referenced_buffer_index_ = -1;
+  // Copied values, appended to data_buffers_ at heap_index_
+  ::arrow::BufferBuilder heap_builder_;
+  int32_t heap_index_ = -1;
+};
+
 class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArrayType>,
                                               virtual public DictionaryRecordReader {
  public:
@@ -2240,10 +2702,14 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
                                                         LevelInfo leaf_info,
                                                         ::arrow::MemoryPool* pool,
                                                         bool read_dictionary,
-                                                        bool read_dense_for_nullable) {
+                                                        bool read_dense_for_nullable,
+                                                        bool read_binary_view) {
   if (read_dictionary) {
     return std::make_shared<ByteArrayDictionaryRecordReader>(descr, leaf_info, pool,
                                                              read_dense_for_nullable);
+  } else if (read_binary_view) {
+    return std::make_shared<ByteArrayViewRecordReader>(descr, leaf_info, pool,
+                                                       read_dense_for_nullable);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, leaf_info, pool,
                                                           read_dense_for_nullable);
@@ -2255,7 +2721,8 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  LevelInfo leaf_info, MemoryPool* pool,
                                                  bool read_dictionary,
-                                                 bool read_dense_for_nullable) {
+                                                 bool read_dense_for_nullable,
+                                                 bool read_binary_view) {
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, leaf_info, pool,
@@ -2277,7 +2744,7 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                              read_dense_for_nullable);
     case Type::BYTE_ARRAY: {
       return MakeByteArrayRecordReader(descr, leaf_info, pool, read_dictionary,
-                                       read_dense_for_nullable);
+                                       read_dense_for_nullable, read_binary_view);
     }
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<FLBARecordReader>(descr, leaf_info, pool,
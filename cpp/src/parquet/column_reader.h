@@ -92,6 +92,10 @@ class PARQUET_EXPORT LevelDecoder {
   // Decodes a batch of levels into an array and returns the number of levels decoded
   int Decode(int batch_size, int16_t* levels);
 
+  // Decodes a batch of levels of a max level of 1 into a bitmap, setting the bits
+  // of the levels equal to 1, and returns the number of levels decoded
+  int DecodeBitmap(int batch_size, uint8_t* bitmap, int64_t bitmap_offset);
+
  private:
   int bit_width_;
   int num_values_remaining_;
@@ -318,10 +322,13 @@ class PARQUET_EXPORT RecordReader {
   /// @param read_dictionary True if reading directly as Arrow dictionary-encoded
   /// @param read_dense_for_nullable True if reading dense and not leaving space for null
   /// values
+  /// @param read_binary_view True if reading BYTE_ARRAY values as Arrow binary views
+  /// referencing the page and dictionary buffers
   static std::shared_ptr<RecordReader> Make(
       const ColumnDescriptor* descr, LevelInfo leaf_info,
       ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
-      bool read_dictionary = false, bool read_dense_for_nullable = false);
+      bool read_dictionary = false, bool read_dense_for_nullable = false,
+      bool read_binary_view = false);
 
   virtual ~RecordReader() = default;
 
@@ -350,6 +357,11 @@ class PARQUET_EXPORT RecordReader {
   /// allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseValues() = 0;
 
+  /// \brief Transfer the values to the caller, like ReleaseValues(). If all the
+  /// values read since the last Reset() were left in the data page they were
+  /// read from, see set_zero_copy_values(), the returned buffer slices that page.
+  virtual std::shared_ptr<Buffer> ReleaseZeroCopyValues() { return ReleaseValues(); }
+
   /// \brief Transfer filled validity bitmap buffer to caller. A new one will
   /// be allocated in subsequent ReadRecords calls
   virtual std::shared_ptr<ResizableBuffer> ReleaseIsValid() = 0;
@@ -424,6 +436,23 @@ class PARQUET_EXPORT RecordReader {
   /// \brief True if reading dense for nullable columns.
   bool read_dense_for_nullable() const { return read_dense_for_nullable_; }
 
+  /// \brief Let the values of INT32, INT64, FLOAT and DOUBLE columns stay in the
+  /// data pages they were read from instead of copying them, when those pages are
+  /// PLAIN encoded and view immutable memory, such as the uncompressed pages of a
+  /// read-only memory-mapped file. The values must then be transferred with
+  /// ReleaseZeroCopyValues() rather than accessed with values() or ReleaseValues().
+  void set_zero_copy_values(bool zero_copy_values) {
+    zero_copy_values_ = zero_copy_values;
+  }
+
+  /// \brief Decode the definition levels of an optional, non-repeated leaf with
+  /// a max definition level of 1 directly into the validity bitmap, without
+  /// keeping them. def_levels() and levels_position() then do not cover the
+  /// records read, so this is only for leaves whose levels no parent needs.
+  void set_decode_levels_to_bitmap(bool decode_levels_to_bitmap) {
+    decode_levels_to_bitmap_ = decode_levels_to_bitmap;
+  }
+
  protected:
   /// \brief Indicates if we can have nullable values. Note that repeated fields
   /// may or may not be nullable.
@@ -473,6 +502,8 @@ class PARQUET_EXPORT RecordReader {
   // If true, we will not leave any space for the null values in the values_
   // vector.
   bool read_dense_for_nullable_ = false;
+  bool zero_copy_values_ = false;
+  bool decode_levels_to_bitmap_ = false;
 };
 
 class BinaryRecordReader : virtual public RecordReader {
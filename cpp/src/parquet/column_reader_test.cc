@@ -1660,6 +1660,54 @@ INSTANTIATE_TEST_SUITE_P(ByteArrayRecordReaderTests, ByteArrayRecordReaderTest,
 
 INSTANTIATE_TEST_SUITE_P(FLBARecordReaderTests, FLBARecordReaderTest, testing::Bool());
 
+// Decoding the definition levels of an optional leaf directly into the validity
+// bitmap reads the same records as decoding the levels first.
+TEST(RecordReaderTest, DecodeLevelsToBitmap) {
+  LevelInfo level_info;
+  level_info.def_level = 1;
+  NodePtr type = schema::Int32("b", Repetition::OPTIONAL);
+  const ColumnDescriptor descr(type, level_info.def_level, level_info.rep_level);
+
+  std::vector<int32_t> values;
+  std::vector<int16_t> def_levels;
+  std::vector<int16_t> rep_levels;
+  std::vector<uint8_t> data_buffer;
+  std::vector<std::shared_ptr<Page>> pages;
+  MakePages<Int32Type>(&descr, /*num_pages=*/5, /*levels_per_page=*/300, def_levels,
+                       rep_levels, values, data_buffer, pages, Encoding::PLAIN,
+                       /*seed=*/42);
+
+  // For each read, the number of records, the null count and each slot as a pair
+  // of validity and value
+  auto read = [&](bool decode_levels_to_bitmap) {
+    auto record_reader = internal::RecordReader::Make(&descr, level_info);
+    record_reader->set_decode_levels_to_bitmap(decode_levels_to_bitmap);
+    record_reader->SetPageReader(std::make_unique<test::MockPageReader>(pages));
+    std::vector<std::vector<int64_t>> reads;
+    // Negative numbers of records are skipped
+    for (int64_t num_records : {7, -50, 400, -1, 333, 2000}) {
+      record_reader->Reset();
+      if (num_records < 0) {
+        reads.push_back({record_reader->SkipRecords(-num_records)});
+        continue;
+      }
+      std::vector<int64_t> batch = {record_reader->ReadRecords(num_records),
+                                    record_reader->null_count()};
+      const auto* read_values = reinterpret_cast<const int32_t*>(record_reader->values());
+      const auto valid_bits = record_reader->ReleaseIsValid();
+      for (int64_t i = 0; i < record_reader->values_written(); ++i) {
+        const bool valid = ::arrow::bit_util::GetBit(valid_bits->data(), i);
+        batch.push_back(valid);
+        batch.push_back(valid ? read_values[i] : 0);
+      }
+      reads.push_back(std::move(batch));
+    }
+    return reads;
+  };
+  ASSERT_EQ(read(/*decode_levels_to_bitmap=*/true),
+            read(/*decode_levels_to_bitmap=*/false));
+}
+
 // Test random combination of ReadRecords and SkipRecords.
 class RecordReaderStressTest : public ::testing::TestWithParam<Repetition::type> {};
 
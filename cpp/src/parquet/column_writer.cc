@@ -18,8 +18,10 @@
 #include "parquet/column_writer.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <utility>
@@ -43,11 +45,15 @@
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
 #include "arrow/util/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/visit_array_inline.h"
+#include "arrow/visit_data_inline.h"
+#include "parquet/bloom_filter_builder.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
 #include "parquet/encryption/internal_file_encryptor.h"
+#include "parquet/hasher.h"
 #include "parquet/level_conversion.h"
 #include "parquet/metadata.h"
 #include "parquet/page_index.h"
@@ -154,6 +160,77 @@ inline const T* AddIfNotNull(const T* base, int64_t offset) {
   return nullptr;
 }
 
+// Decides where the data pages of a column chunk end when content-defined
+// chunking is enabled, using a gear rolling hash (as in FastCDC) over the bytes
+// of the written values. The hash only depends on the last 64 bytes seen, so
+// boundaries are found again at the same place after an insertion or deletion.
+class ContentDefinedChunker {
+ public:
+  explicit ContentDefinedChunker(const ContentDefinedChunkingOptions& options)
+      : min_chunk_size_(options.min_chunk_size),
+        max_chunk_size_(options.max_chunk_size) {
+    // Pages are expected to end halfway between the two bounds
+    const int64_t target = std::max<int64_t>((max_chunk_size_ - min_chunk_size_) / 2, 1);
+    const int mask_bits = bit_util::NumRequiredBits(static_cast<uint64_t>(target)) - 1;
+    // The high bits of the gear hash are the best mixed ones
+    mask_ = mask_bits == 0 ? 0 : ~uint64_t{0} << (64 - mask_bits);
+  }
+
+  void Roll(const uint8_t* data, int64_t length) {
+    static const std::array<uint64_t, 256> kGearTable = MakeGearTable();
+    for (int64_t i = 0; i < length; ++i) {
+      hash_ = (hash_ << 1) + kGearTable[data[i]];
+      if (++chunk_size_ >= min_chunk_size_ && (hash_ & mask_) == 0) {
+        boundary_found_ = true;
+      }
+    }
+  }
+
+  template <typename T>
+  void Roll(const T& value, int /*type_length*/) {
+    Roll(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
+  }
+
+  void Roll(const ByteArray& value, int /*type_length*/) { Roll(value.ptr, value.len); }
+
+  void Roll(const FixedLenByteArray& value, int type_length) {
+    Roll(value.ptr, type_length);
+  }
+
+  // Whether a page should end before the next record, in which case the
+  // chunker starts a new chunk.
+  bool NextChunk() {
+    if (boundary_found_ || chunk_size_ >= max_chunk_size_) {
+      boundary_found_ = false;
+      chunk_size_ = 0;
+      return true;
+    }
+    return false;
+  }
+
+ private:
+  static std::array<uint64_t, 256> MakeGearTable() {
+    // Fixed pseudo-random values (splitmix64), so that boundaries are stable
+    // across processes and library versions.
+    std::array<uint64_t, 256> table;
+    uint64_t state = 0;
+    for (auto& entry : table) {
+      uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+      z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+      entry = z ^ (z >> 31);
+    }
+    return table;
+  }
+
+  const int64_t min_chunk_size_;
+  const int64_t max_chunk_size_;
+  uint64_t mask_;
+  uint64_t hash_ = 0;
+  int64_t chunk_size_ = 0;
+  bool boundary_found_ = false;
+};
+
 }  // namespace
 
 LevelEncoder::LevelEncoder() {}
@@ -1209,6 +1286,60 @@ static inline bool IsDictionaryEncoding(Encoding::type encoding) {
   return encoding == Encoding::PLAIN_DICTIONARY;
 }
 
+// Non-dictionary encodings trial-encoded by the adaptive encoding selection, in
+// addition to the configured one.
+static std::vector<Encoding::type> AdaptiveEncodingCandidates(
+    Type::type physical_type, ParquetVersion::type version) {
+  if (physical_type == Type::BOOLEAN) {
+    return {};
+  }
+  std::vector<Encoding::type> candidates = {Encoding::PLAIN};
+  if (version == ParquetVersion::PARQUET_1_0) {
+    return candidates;
+  }
+  switch (physical_type) {
+    case Type::INT32:
+    case Type::INT64:
+      candidates.push_back(Encoding::DELTA_BINARY_PACKED);
+      candidates.push_back(Encoding::BYTE_STREAM_SPLIT);
+      break;
+    case Type::FLOAT:
+    case Type::DOUBLE:
+      candidates.push_back(Encoding::BYTE_STREAM_SPLIT);
+      break;
+    case Type::BYTE_ARRAY:
+      candidates.push_back(Encoding::DELTA_LENGTH_BYTE_ARRAY);
+      candidates.push_back(Encoding::DELTA_BYTE_ARRAY);
+      break;
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      candidates.push_back(Encoding::BYTE_STREAM_SPLIT);
+      candidates.push_back(Encoding::DELTA_BYTE_ARRAY);
+      break;
+    default:
+      break;
+  }
+  return candidates;
+}
+
+// Rough decoding cost of an encoding relative to PLAIN, used to weight encoded
+// sizes with AdaptiveEncoding::kSizeAndDecodeCost.
+static double AdaptiveEncodingDecodeCost(Encoding::type encoding) {
+  switch (encoding) {
+    case Encoding::PLAIN_DICTIONARY:
+    case Encoding::RLE_DICTIONARY:
+      return 1.3;
+    case Encoding::BYTE_STREAM_SPLIT:
+      return 1.1;
+    case Encoding::DELTA_BINARY_PACKED:
+    case Encoding::DELTA_LENGTH_BYTE_ARRAY:
+      return 1.5;
+    case Encoding::DELTA_BYTE_ARRAY:
+      return 2.0;
+    default:
+      return 1.0;
+  }
+}
+
 template <typename DType>
 class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<DType> {
  public:
@@ -1216,9 +1347,11 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
 
   TypedColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                         std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                        Encoding::type encoding, const WriterProperties* properties)
+                        Encoding::type encoding, const WriterProperties* properties,
+                        ColumnBloomFilterBuilder* bloom_filter_builder)
       : ColumnWriterImpl(metadata, std::move(pager), use_dictionary, encoding,
-                         properties) {
+                         properties),
+        bloom_filter_builder_(bloom_filter_builder) {
     current_encoder_ = MakeEncoder(DType::type_num, encoding, use_dictionary, descr_,
                                    properties->memory_pool());
     // We have to dynamic_cast as some compilers don't want to static_cast
@@ -1235,12 +1368,61 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     pages_change_on_record_boundaries_ =
         properties->data_page_version() == ParquetDataPageVersion::V2 ||
         properties->page_index_enabled(descr_->path());
+    adaptive_encoding_ = properties->adaptive_encoding(descr_->path());
+    if (properties->content_defined_chunking_enabled()) {
+      content_defined_chunker_ = std::make_unique<ContentDefinedChunker>(
+          properties->content_defined_chunking_options());
+    }
   }
 
-  int64_t Close() override { return ColumnWriterImpl::Close(); }
+  int64_t Close() override {
+    if (bloom_filter_builder_ != nullptr && !closed_) {
+      bloom_filter_builder_->Finish(/*dictionary_encoded=*/has_dictionary_ && !fallback_);
+    }
+    return ColumnWriterImpl::Close();
+  }
 
   int64_t WriteBatch(int64_t num_values, const int16_t* def_levels,
                      const int16_t* rep_levels, const T* values) override {
+    if (content_defined_chunker_ == nullptr) {
+      return WriteBatchInternal(num_values, def_levels, rep_levels, values);
+    }
+    auto RollValue = [&](int64_t i) {
+      content_defined_chunker_->Roll(values[i], descr_->type_length());
+    };
+    int64_t values_written = 0;
+    WriteContentDefinedChunks(
+        num_values, def_levels, rep_levels, /*spaced=*/false, RollValue,
+        [&](int64_t level_offset, int64_t num_levels, int64_t value_offset) {
+          values_written += WriteBatchInternal(
+              num_levels, AddIfNotNull(def_levels, level_offset),
+              AddIfNotNull(rep_levels, level_offset), AddIfNotNull(values, value_offset));
+        });
+    return values_written;
+  }
+
+  void WriteBatchSpaced(int64_t num_values, const int16_t* def_levels,
+                        const int16_t* rep_levels, const uint8_t* valid_bits,
+                        int64_t valid_bits_offset, const T* values) override {
+    if (content_defined_chunker_ == nullptr) {
+      return WriteBatchSpacedInternal(num_values, def_levels, rep_levels, valid_bits,
+                                      valid_bits_offset, values);
+    }
+    auto RollValue = [&](int64_t i) {
+      content_defined_chunker_->Roll(values[i], descr_->type_length());
+    };
+    WriteContentDefinedChunks(
+        num_values, def_levels, rep_levels, /*spaced=*/true, RollValue,
+        [&](int64_t level_offset, int64_t num_levels, int64_t value_offset) {
+          WriteBatchSpacedInternal(num_levels, AddIfNotNull(def_levels, level_offset),
+                                   AddIfNotNull(rep_levels, level_offset), valid_bits,
+                                   valid_bits_offset + value_offset,
+                                   AddIfNotNull(values, value_offset));
+        });
+  }
+
+  int64_t WriteBatchInternal(int64_t num_values, const int16_t* def_levels,
+                             const int16_t* rep_levels, const T* values) {
     // We check for DataPage limits only after we have inserted the values. If a user
     // writes a large number of values, the DataPage size can be much above the limit.
     // The purpose of this chunking is to bound this. Even if a user writes large number
@@ -1270,9 +1452,9 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     return value_offset;
   }
 
-  void WriteBatchSpaced(int64_t num_values, const int16_t* def_levels,
-                        const int16_t* rep_levels, const uint8_t* valid_bits,
-                        int64_t valid_bits_offset, const T* values) override {
+  void WriteBatchSpacedInternal(int64_t num_values, const int16_t* def_levels,
+                                const int16_t* rep_levels, const uint8_t* valid_bits,
+                                int64_t valid_bits_offset, const T* values) {
     // Like WriteBatch, but for spaced values
     int64_t value_offset = 0;
     auto WriteChunk = [&](int64_t offset, int64_t batch_size, bool check_page) {
@@ -1418,6 +1600,13 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   std::shared_ptr<TypedStats> page_statistics_;
   std::shared_ptr<TypedStats> chunk_statistics_;
   bool pages_change_on_record_boundaries_;
+  // Reset to kDisabled once the encoding of the column chunk has been selected
+  AdaptiveEncoding adaptive_encoding_;
+  // Only set if content-defined chunking is enabled
+  std::unique_ptr<ContentDefinedChunker> content_defined_chunker_;
+  // Only set if a bloom filter is written for the column
+  ColumnBloomFilterBuilder* bloom_filter_builder_;
+  std::vector<uint64_t> bloom_filter_hashes_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
@@ -1552,13 +1741,52 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  // Splits the levels at the content-defined page boundaries, only placed before
+  // a record. `roll_value(i)` feeds the i-th value to the chunker and
+  // `write_segment(level_offset, num_levels, value_offset)` writes the levels and
+  // values between two boundaries. With `spaced`, values have slots for the nulls
+  // that are not caused by an empty or null ancestor list.
+  template <typename RollValue, typename WriteSegment>
+  void WriteContentDefinedChunks(int64_t num_levels, const int16_t* def_levels,
+                                 const int16_t* rep_levels, bool spaced,
+                                 RollValue&& roll_value, WriteSegment&& write_segment) {
+    const int16_t max_def_level = descr_->max_definition_level();
+    int64_t segment_level_offset = 0;
+    int64_t segment_value_offset = 0;
+    int64_t value_offset = 0;
+    for (int64_t i = 0; i < num_levels; ++i) {
+      const bool record_start = rep_levels == nullptr || rep_levels[i] == 0;
+      if (record_start && content_defined_chunker_->NextChunk()) {
+        if (i > segment_level_offset) {
+          write_segment(segment_level_offset, i - segment_level_offset,
+                        segment_value_offset);
+        }
+        if (num_buffered_values_ > 0) {
+          AddDataPage();
+        }
+        segment_level_offset = i;
+        segment_value_offset = value_offset;
+      }
+      if (def_levels == nullptr || def_levels[i] == max_def_level) {
+        roll_value(value_offset++);
+      } else if (spaced && def_levels[i] >= level_info_.repeated_ancestor_def_level) {
+        ++value_offset;
+      }
+    }
+    if (num_levels > segment_level_offset) {
+      write_segment(segment_level_offset, num_levels - segment_level_offset,
+                    segment_value_offset);
+    }
+  }
+
   void CommitWriteAndCheckPageLimit(int64_t num_levels, int64_t num_values,
                                     int64_t num_nulls, bool check_page_size) {
     num_buffered_values_ += num_levels;
     num_buffered_encoded_values_ += num_values;
     num_buffered_nulls_ += num_nulls;
 
-    if (check_page_size &&
+    // Pages are cut at content-defined boundaries instead
+    if (check_page_size && content_defined_chunker_ == nullptr &&
         current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize()) {
       AddDataPage();
     }
@@ -1598,11 +1826,76 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
     }
   }
 
+  // Trial-encodes the first values of the column chunk, passed to `put_sample`,
+  // with each candidate encoding and switches to the cheapest one.
+  template <typename PutSample>
+  void MaybeSelectAdaptiveEncoding(PutSample&& put_sample) {
+    if (adaptive_encoding_ == AdaptiveEncoding::kDisabled) {
+      return;
+    }
+    const bool weighted = adaptive_encoding_ == AdaptiveEncoding::kSizeAndDecodeCost;
+    adaptive_encoding_ = AdaptiveEncoding::kDisabled;
+    if (num_buffered_encoded_values_ > 0 || rows_written_ != num_buffered_rows_ ||
+        fallback_) {
+      // Values have already been encoded or a data page has been added
+      return;
+    }
+
+    std::vector<Encoding::type> candidates = {encoding_};
+    for (Encoding::type encoding :
+         AdaptiveEncodingCandidates(descr_->physical_type(), properties_->version())) {
+      if (encoding != encoding_) {
+        candidates.push_back(encoding);
+      }
+    }
+
+    Encoding::type best_encoding = encoding_;
+    double best_cost = std::numeric_limits<double>::infinity();
+    for (Encoding::type encoding : candidates) {
+      // Only the configured encoding can be the dictionary one
+      const bool use_dictionary = has_dictionary_ && encoding == encoding_;
+      std::unique_ptr<Encoder> encoder = MakeEncoder(
+          DType::type_num, encoding, use_dictionary, descr_, properties_->memory_pool());
+      put_sample(encoder.get());
+      // Flush rather than estimate, as some encoders only account for complete
+      // blocks in their estimate.
+      double cost = static_cast<double>(encoder->FlushValues()->size());
+      if (use_dictionary) {
+        cost += dynamic_cast<DictEncoder<DType>*>(encoder.get())->dict_encoded_size();
+      }
+      if (weighted) {
+        cost *= AdaptiveEncodingDecodeCost(encoding);
+      }
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_encoding = encoding;
+      }
+    }
+
+    if (best_encoding != encoding_) {
+      has_dictionary_ = false;
+      encoding_ = best_encoding;
+      current_encoder_ = MakeEncoder(DType::type_num, best_encoding, false, descr_,
+                                     properties_->memory_pool());
+      current_value_encoder_ = dynamic_cast<ValueEncoderType*>(current_encoder_.get());
+      current_dict_encoder_ = nullptr;
+    }
+  }
+
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
+    if (num_values > 0) {
+      MaybeSelectAdaptiveEncoding([&](Encoder* encoder) {
+        dynamic_cast<ValueEncoderType*>(encoder)->Put(values,
+                                                      static_cast<int>(num_values));
+      });
+    }
     current_value_encoder_->Put(values, static_cast<int>(num_values));
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
+    if (bloom_filter_builder_ != nullptr) {
+      UpdateBloomFilter(values, num_values);
+    }
   }
 
   /// \brief Write values with spaces and update page statistics accordingly.
@@ -1621,6 +1914,17 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
   void WriteValuesSpaced(const T* values, int64_t num_values, int64_t num_spaced_values,
                          const uint8_t* valid_bits, int64_t valid_bits_offset,
                          int64_t num_levels, int64_t num_nulls) {
+    if (num_values > 0) {
+      MaybeSelectAdaptiveEncoding([&](Encoder* encoder) {
+        auto value_encoder = dynamic_cast<ValueEncoderType*>(encoder);
+        if (num_values != num_spaced_values) {
+          value_encoder->PutSpaced(values, static_cast<int>(num_spaced_values),
+                                   valid_bits, valid_bits_offset);
+        } else {
+          value_encoder->Put(values, static_cast<int>(num_values));
+        }
+      });
+    }
     if (num_values != num_spaced_values) {
       current_value_encoder_->PutSpaced(values, static_cast<int>(num_spaced_values),
                                         valid_bits, valid_bits_offset);
@@ -1631,6 +1935,48 @@ class TypedColumnWriterImpl : public ColumnWriterImpl, public TypedColumnWriter<
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset,
                                      num_spaced_values, num_values, num_nulls);
     }
+    if (bloom_filter_builder_ != nullptr) {
+      if (num_values != num_spaced_values) {
+        ::arrow::internal::VisitSetBitRunsVoid(
+            valid_bits, valid_bits_offset, num_spaced_values,
+            [&](int64_t position, int64_t length) {
+              UpdateBloomFilter(values + position, length);
+            });
+      } else {
+        UpdateBloomFilter(values, num_values);
+      }
+    }
+  }
+
+  // Insert non-null values into the bloom filter of the column chunk
+  void UpdateBloomFilter(const T* values, int64_t num_values) {
+    if constexpr (!std::is_same_v<DType, BooleanType>) {
+      bloom_filter_hashes_.resize(num_values);
+      const Hasher& hasher = bloom_filter_builder_->hasher();
+      if constexpr (std::is_same_v<DType, FLBAType>) {
+        hasher.Hashes(values, static_cast<uint32_t>(descr_->type_length()),
+                      static_cast<int>(num_values), bloom_filter_hashes_.data());
+      } else {
+        hasher.Hashes(values, static_cast<int>(num_values), bloom_filter_hashes_.data());
+      }
+      bloom_filter_builder_->InsertHashes(bloom_filter_hashes_.data(), num_values);
+    }
+  }
+
+  // Insert the non-null values of a binary-like array into the bloom filter
+  template <typename ArrowType>
+  void UpdateBloomFilter(const ::arrow::ArrayData& data) {
+    const Hasher& hasher = bloom_filter_builder_->hasher();
+    bloom_filter_hashes_.clear();
+    ::arrow::VisitArraySpanInline<ArrowType>(
+        ::arrow::ArraySpan(data),
+        [&](std::string_view value) {
+          ByteArray byte_array(value);
+          bloom_filter_hashes_.push_back(hasher.Hash(&byte_array));
+        },
+        [] {});
+    bloom_filter_builder_->InsertHashes(
+        bloom_filter_hashes_.data(), static_cast<int64_t>(bloom_filter_hashes_.size()));
   }
 };
 
@@ -1662,7 +2008,8 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
   };
 
   if (!IsDictionaryEncoding(current_encoder_->encoding()) ||
-      !DictionaryDirectWriteSupported(array)) {
+      !DictionaryDirectWriteSupported(array) || content_defined_chunker_ != nullptr ||
+      bloom_filter_builder_ != nullptr) {
     // No longer dictionary-encoding for whatever reason, maybe we never were
     // or we decided to stop. Note that WriteArrow can be invoked multiple
     // times with both dense and dictionary-encoded versions of the same data
@@ -1749,6 +2096,8 @@ Status TypedColumnWriterImpl<DType>::WriteArrowDictionary(
     }
 
     preserved_dictionary_ = dictionary;
+    // The dictionary of the Arrow array is written as is
+    adaptive_encoding_ = AdaptiveEncoding::kDisabled;
   } else if (!dictionary->Equals(*preserved_dictionary_)) {
     // Dictionary has changed
     PARQUET_CATCH_NOT_OK(FallbackToPlainEncoding());
@@ -2188,38 +2537,73 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     ARROW_UNSUPPORTED();
   }
 
+  const int16_t* segment_def_levels = def_levels;
+  const int16_t* segment_rep_levels = rep_levels;
   int64_t value_offset = 0;
   auto WriteChunk = [&](int64_t offset, int64_t batch_size, bool check_page) {
     int64_t batch_num_values = 0;
     int64_t batch_num_spaced_values = 0;
     int64_t null_count = 0;
 
-    MaybeCalculateValidityBits(AddIfNotNull(def_levels, offset), batch_size,
+    MaybeCalculateValidityBits(AddIfNotNull(segment_def_levels, offset), batch_size,
                                &batch_num_values, &batch_num_spaced_values, &null_count);
-    WriteLevelsSpaced(batch_size, AddIfNotNull(def_levels, offset),
-                      AddIfNotNull(rep_levels, offset));
+    WriteLevelsSpaced(batch_size, AddIfNotNull(segment_def_levels, offset),
+                      AddIfNotNull(segment_rep_levels, offset));
     std::shared_ptr<Array> data_slice =
         array.Slice(value_offset, batch_num_spaced_values);
     PARQUET_ASSIGN_OR_THROW(
         data_slice, MaybeReplaceValidity(data_slice, null_count, ctx->memory_pool));
 
-    current_encoder_->Put(*data_slice);
     // Null values in ancestors count as nulls.
     const int64_t non_null = data_slice->length() - data_slice->null_count();
+    if (non_null > 0) {
+      MaybeSelectAdaptiveEncoding(
+          [&](Encoder* encoder) { encoder->Put(*data_slice); });
+    }
+    current_encoder_->Put(*data_slice);
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(*data_slice, /*update_counts=*/false);
       page_statistics_->IncrementNullCount(batch_size - non_null);
       page_statistics_->IncrementNumValues(non_null);
     }
+    if (bloom_filter_builder_ != nullptr) {
+      if (::arrow::is_large_binary_like(data_slice->type_id())) {
+        UpdateBloomFilter<::arrow::LargeBinaryType>(*data_slice->data());
+      } else {
+        UpdateBloomFilter<::arrow::BinaryType>(*data_slice->data());
+      }
+    }
     CommitWriteAndCheckPageLimit(batch_size, batch_num_values, batch_size - non_null,
                                  check_page);
     CheckDictionarySizeLimit();
     value_offset += batch_num_spaced_values;
   };
 
-  PARQUET_CATCH_NOT_OK(DoInBatches(def_levels, rep_levels, num_levels,
-                                   properties_->write_batch_size(), WriteChunk,
-                                   pages_change_on_record_boundaries()));
+  auto WriteSegment = [&](int64_t level_offset, int64_t segment_num_levels,
+                          int64_t segment_value_offset) {
+    segment_def_levels = AddIfNotNull(def_levels, level_offset);
+    segment_rep_levels = AddIfNotNull(rep_levels, level_offset);
+    value_offset = segment_value_offset;
+    DoInBatches(segment_def_levels, segment_rep_levels, segment_num_levels,
+                properties_->write_batch_size(), WriteChunk,
+                pages_change_on_record_boundaries());
+  };
+
+  if (content_defined_chunker_ == nullptr) {
+    PARQUET_CATCH_NOT_OK(WriteSegment(0, num_levels, 0));
+    return Status::OK();
+  }
+  auto RollValue = [&](int64_t i) {
+    std::string_view value =
+        ::arrow::is_large_binary_like(array.type_id())
+            ? checked_cast<const ::arrow::LargeBinaryArray&>(array).GetView(i)
+            : checked_cast<const ::arrow::BinaryArray&>(array).GetView(i);
+    content_defined_chunker_->Roll(reinterpret_cast<const uint8_t*>(value.data()),
+                                   static_cast<int64_t>(value.size()));
+  };
+  PARQUET_CATCH_NOT_OK(WriteContentDefinedChunks(num_levels, def_levels, rep_levels,
+                                                 /*spaced=*/true, RollValue,
+                                                 WriteSegment));
   return Status::OK();
 }
 
@@ -2366,9 +2750,9 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(
 // ----------------------------------------------------------------------
 // Dynamic column writer constructor
 
-std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
-                                                 std::unique_ptr<PageWriter> pager,
-                                                 const WriterProperties* properties) {
+std::shared_ptr<ColumnWriter> ColumnWriter::Make(
+    ColumnChunkMetaDataBuilder* metadata, std::unique_ptr<PageWriter> pager,
+    const WriterProperties* properties, ColumnBloomFilterBuilder* bloom_filter_builder) {
   const ColumnDescriptor* descr = metadata->descr();
   const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
                               descr->physical_type() != Type::BOOLEAN;
@@ -2386,28 +2770,36 @@ std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* met
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedColumnWriterImpl<BooleanType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder);
     case Type::INT32:
       return std::make_shared<TypedColumnWriterImpl<Int32Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder);
     case Type::INT64:
       return std::make_shared<TypedColumnWriterImpl<Int64Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder);
     case Type::INT96:
       return std::make_shared<TypedColumnWriterImpl<Int96Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder);
     case Type::FLOAT:
       return std::make_shared<TypedColumnWriterImpl<FloatType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder);
     case Type::DOUBLE:
       return std::make_shared<TypedColumnWriterImpl<DoubleType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder);
     case Type::BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<ByteArrayType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<FLBAType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder);
     default:
       ParquetException::NYI("type reader not implemented");
   }
@@ -44,6 +44,7 @@ class CodecOptions;
 namespace parquet {
 
 struct ArrowWriteContext;
+class ColumnBloomFilterBuilder;
 class ColumnChunkMetaDataBuilder;
 class ColumnDescriptor;
 class ColumnIndexBuilder;
@@ -141,9 +142,12 @@ class PARQUET_EXPORT ColumnWriter {
  public:
   virtual ~ColumnWriter() = default;
 
-  static std::shared_ptr<ColumnWriter> Make(ColumnChunkMetaDataBuilder*,
-                                            std::unique_ptr<PageWriter>,
-                                            const WriterProperties* properties);
+  /// \param bloom_filter_builder If not null, the non-null values written are
+  /// inserted into the bloom filter of the column chunk.
+  static std::shared_ptr<ColumnWriter> Make(
+      ColumnChunkMetaDataBuilder*, std::unique_ptr<PageWriter>,
+      const WriterProperties* properties,
+      ColumnBloomFilterBuilder* bloom_filter_builder = NULLPTR);
 
   /// \brief Closes the ColumnWriter, commits any buffered values to pages.
   /// \return Total size of the column in bytes
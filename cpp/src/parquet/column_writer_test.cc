@@ -15,7 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <memory>
+#include <random>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -1302,6 +1305,118 @@ TEST(TestColumnWriter, WriteDataPageV2Header) {
   }
 }
 
+TEST(TestColumnWriter, AdaptiveEncoding) {
+  auto sink = CreateOutputStream();
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED,
+                      {schema::Int64("sequence", Repetition::REQUIRED),
+                       schema::Int64("low_cardinality", Repetition::REQUIRED),
+                       schema::Int64("sequence_disabled", Repetition::REQUIRED)}));
+  WriterProperties::Builder builder;
+  builder.adaptive_encoding(AdaptiveEncoding::kSize)
+      ->adaptive_encoding("sequence_disabled", AdaptiveEncoding::kDisabled);
+  auto properties = builder.build();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  auto rg_writer = file_writer->AppendRowGroup();
+
+  constexpr int num_rows = 1000;
+  std::vector<int64_t> sequence(num_rows);
+  std::vector<int64_t> low_cardinality(num_rows);
+  for (int i = 0; i < num_rows; i++) {
+    sequence[i] = i * 1000;
+    low_cardinality[i] = i % 4;
+  }
+  for (const auto* values : {&sequence, &low_cardinality, &sequence}) {
+    auto writer = static_cast<Int64Writer*>(rg_writer->NextColumn());
+    writer->WriteBatch(num_rows, nullptr, nullptr, values->data());
+  }
+  ASSERT_NO_THROW(file_writer->Close());
+
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto file_reader = ParquetFileReader::Open(
+      std::make_shared<::arrow::io::BufferReader>(buffer), default_reader_properties());
+  auto row_group_metadata = file_reader->metadata()->RowGroup(0);
+
+  // Delta encoding wins on a sequence
+  auto column_metadata = row_group_metadata->ColumnChunk(0);
+  EXPECT_FALSE(column_metadata->has_dictionary_page());
+  EXPECT_THAT(column_metadata->encodings(),
+              ::testing::Contains(Encoding::DELTA_BINARY_PACKED));
+  // Dictionary encoding wins on few distinct values
+  column_metadata = row_group_metadata->ColumnChunk(1);
+  EXPECT_TRUE(column_metadata->has_dictionary_page());
+  EXPECT_THAT(column_metadata->encodings(),
+              ::testing::Contains(Encoding::RLE_DICTIONARY));
+  // The configured encoding is kept when adaptive encoding is disabled
+  column_metadata = row_group_metadata->ColumnChunk(2);
+  EXPECT_TRUE(column_metadata->has_dictionary_page());
+  EXPECT_THAT(column_metadata->encodings(),
+              ::testing::Not(::testing::Contains(Encoding::DELTA_BINARY_PACKED)));
+
+  auto row_group_reader = file_reader->RowGroup(0);
+  for (int i = 0; i < 3; i++) {
+    const auto& expected = i == 1 ? low_cardinality : sequence;
+    auto reader = std::static_pointer_cast<Int64Reader>(row_group_reader->Column(i));
+    std::vector<int64_t> values(num_rows);
+    int64_t values_read = 0;
+    reader->ReadBatch(num_rows, nullptr, nullptr, values.data(), &values_read);
+    ASSERT_EQ(num_rows, values_read);
+    ASSERT_EQ(expected, values);
+  }
+}
+
+TEST(TestColumnWriter, ContentDefinedChunking) {
+  constexpr int64_t kMinChunkSize = 1024;
+  constexpr int64_t kMaxChunkSize = 4096;
+  auto schema = std::static_pointer_cast<GroupNode>(GroupNode::Make(
+      "schema", Repetition::REQUIRED, {schema::Int64("values", Repetition::REQUIRED)}));
+  auto properties = WriterProperties::Builder()
+                        .disable_dictionary()
+                        ->enable_content_defined_chunking({kMinChunkSize, kMaxChunkSize})
+                        ->build();
+
+  // Returns the data of each page of the file
+  auto WriteAndReadPages = [&](const std::vector<int64_t>& values) {
+    auto sink = CreateOutputStream();
+    auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+    auto writer = static_cast<Int64Writer*>(file_writer->AppendRowGroup()->NextColumn());
+    writer->WriteBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                       values.data());
+    file_writer->Close();
+    EXPECT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+    auto file_reader = ParquetFileReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(buffer), default_reader_properties());
+    auto page_reader = file_reader->RowGroup(0)->GetColumnPageReader(0);
+    std::vector<std::string> pages;
+    while (auto page = page_reader->NextPage()) {
+      auto data_page = std::static_pointer_cast<DataPage>(page);
+      // Pages end at the first record at or past a boundary
+      EXPECT_LE(data_page->num_values(), kMaxChunkSize / sizeof(int64_t));
+      pages.push_back(data_page->buffer()->ToString());
+    }
+    return pages;
+  };
+
+  std::vector<int64_t> values(20000);
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<int64_t> dist;
+  std::generate(values.begin(), values.end(), [&] { return dist(gen); });
+  auto pages = WriteAndReadPages(values);
+  ASSERT_GT(pages.size(), values.size() * sizeof(int64_t) / kMaxChunkSize);
+
+  // Inserting a value changes the page it is inserted into and, if the boundary
+  // after it was forced by the max size, the following pages until the next
+  // content-defined boundary.
+  values.insert(values.begin() + 5000, 1234);
+  auto edited_pages = WriteAndReadPages(values);
+  int num_changed_pages = 0;
+  for (const auto& page : edited_pages) {
+    num_changed_pages += std::find(pages.begin(), pages.end(), page) == pages.end();
+  }
+  ASSERT_GE(num_changed_pages, 1);
+  ASSERT_LE(num_changed_pages, 5);
+}
+
 // The test below checks that data page v2 changes on record boundaries for
 // all repetition types (i.e. required, optional, and repeated)
 TEST(TestColumnWriter, WriteDataPagesChangeOnRecordBoundaries) {
@@ -24,6 +24,7 @@
 #include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -43,6 +44,7 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/rle_encoding.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visit_data_inline.h"
 #include "parquet/exception.h"
@@ -1725,6 +1727,13 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     *dictionary = dictionary_->mutable_data_as<T>();
   }
 
+  std::shared_ptr<Buffer> dictionary_data() const override {
+    if (std::is_same_v<Type, ByteArrayType> || std::is_same_v<Type, FLBAType>) {
+      return byte_array_data_;
+    }
+    return nullptr;
+  }
+
  protected:
   Status IndexInBounds(int32_t index) const {
     if (ARROW_PREDICT_TRUE(0 <= index && index < dictionary_length_)) {
@@ -2011,6 +2020,15 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
   }
 
  private:
+  // The size of `num_values` values, assuming that they are the average size of
+  // the dictionary values
+  int64_t EstimateDataLength(int64_t num_values) const {
+    if (dictionary_length_ == 0) {
+      return 0;
+    }
+    return num_values * byte_array_data_->size() / dictionary_length_;
+  }
+
   Status DecodeArrowDense(int num_values, int null_count, const uint8_t* valid_bits,
                           int64_t valid_bits_offset,
                           typename EncodingTraits<ByteArrayType>::Accumulator* out,
@@ -2021,8 +2039,8 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
     ArrowBinaryHelper<ByteArrayType> helper(out, num_values);
     // The `len_` in the ByteArrayDictDecoder is the total length of the
     // RLE/Bit-pack encoded data size, so, we cannot use `len_` to reserve
-    // space for binary data.
-    RETURN_NOT_OK(helper.Prepare());
+    // space for binary data. Estimate it from the dictionary instead.
+    RETURN_NOT_OK(helper.Prepare(EstimateDataLength(num_values - null_count)));
 
     const auto* dict_values = dictionary_->data_as<ByteArray>();
     int values_decoded = 0;
@@ -2092,8 +2110,8 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
     ArrowBinaryHelper<ByteArrayType> helper(out, num_values);
     // The `len_` in the ByteArrayDictDecoder is the total length of the
     // RLE/Bit-pack encoded data size, so, we cannot use `len_` to reserve
-    // space for binary data.
-    RETURN_NOT_OK(helper.Prepare());
+    // space for binary data. Estimate it from the dictionary instead.
+    RETURN_NOT_OK(helper.Prepare(EstimateDataLength(num_values)));
 
     const auto* dict_values = dictionary_->data_as<ByteArray>();
 
@@ -2488,6 +2506,97 @@ void DeltaBitPackEncoder<DType>::PutSpaced(const T* src, int num_values,
 // ----------------------------------------------------------------------
 // DeltaBitPackDecoder
 
+// Turns unpacked deltas into values, in place:
+//   values[i] = last_value + sum(min_delta + values[j] for j <= i)
+// The arithmetic wraps around. Returns the last decoded value.
+template <typename UT>
+UT DeltaPrefixSumScalar(UT* values, int num_values, UT min_delta, UT last_value) {
+  for (int i = 0; i < num_values; ++i) {
+    last_value += min_delta + values[i];
+    values[i] = last_value;
+  }
+  return last_value;
+}
+
+#if defined(ARROW_HAVE_SSE4_2)
+// Prefix sums of 128-bit batches are computed in log2(lanes) shifted adds,
+// then offset by the last value of the previous batch.
+uint32_t DeltaPrefixSum(uint32_t* values, int num_values, uint32_t min_delta,
+                        uint32_t last_value) {
+  const __m128i min_deltas = _mm_set1_epi32(static_cast<int32_t>(min_delta));
+  __m128i carry = _mm_set1_epi32(static_cast<int32_t>(last_value));
+  int i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    auto* ptr = reinterpret_cast<__m128i*>(values + i);
+    __m128i x = _mm_add_epi32(_mm_loadu_si128(ptr), min_deltas);
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+    x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+    x = _mm_add_epi32(x, carry);
+    _mm_storeu_si128(ptr, x);
+    carry = _mm_shuffle_epi32(x, 0xFF);
+  }
+  if (i > 0) last_value = values[i - 1];
+  return DeltaPrefixSumScalar(values + i, num_values - i, min_delta, last_value);
+}
+
+uint64_t DeltaPrefixSum(uint64_t* values, int num_values, uint64_t min_delta,
+                        uint64_t last_value) {
+  const __m128i min_deltas = _mm_set1_epi64x(static_cast<int64_t>(min_delta));
+  __m128i carry = _mm_set1_epi64x(static_cast<int64_t>(last_value));
+  int i = 0;
+  for (; i + 2 <= num_values; i += 2) {
+    auto* ptr = reinterpret_cast<__m128i*>(values + i);
+    __m128i x = _mm_add_epi64(_mm_loadu_si128(ptr), min_deltas);
+    x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+    x = _mm_add_epi64(x, carry);
+    _mm_storeu_si128(ptr, x);
+    carry = _mm_unpackhi_epi64(x, x);
+  }
+  if (i > 0) last_value = values[i - 1];
+  return DeltaPrefixSumScalar(values + i, num_values - i, min_delta, last_value);
+}
+#elif defined(ARROW_HAVE_NEON)
+uint32_t DeltaPrefixSum(uint32_t* values, int num_values, uint32_t min_delta,
+                        uint32_t last_value) {
+  const uint32x4_t min_deltas = vdupq_n_u32(min_delta);
+  const uint32x4_t zero = vdupq_n_u32(0);
+  uint32x4_t carry = vdupq_n_u32(last_value);
+  int i = 0;
+  for (; i + 4 <= num_values; i += 4) {
+    uint32x4_t x = vaddq_u32(vld1q_u32(values + i), min_deltas);
+    x = vaddq_u32(x, vextq_u32(zero, x, 3));
+    x = vaddq_u32(x, vextq_u32(zero, x, 2));
+    x = vaddq_u32(x, carry);
+    vst1q_u32(values + i, x);
+    carry = vdupq_laneq_u32(x, 3);
+  }
+  if (i > 0) last_value = values[i - 1];
+  return DeltaPrefixSumScalar(values + i, num_values - i, min_delta, last_value);
+}
+
+uint64_t DeltaPrefixSum(uint64_t* values, int num_values, uint64_t min_delta,
+                        uint64_t last_value) {
+  const uint64x2_t min_deltas = vdupq_n_u64(min_delta);
+  const uint64x2_t zero = vdupq_n_u64(0);
+  uint64x2_t carry = vdupq_n_u64(last_value);
+  int i = 0;
+  for (; i + 2 <= num_values; i += 2) {
+    uint64x2_t x = vaddq_u64(vld1q_u64(values + i), min_deltas);
+    x = vaddq_u64(x, vextq_u64(zero, x, 1));
+    x = vaddq_u64(x, carry);
+    vst1q_u64(values + i, x);
+    carry = vdupq_laneq_u64(x, 1);
+  }
+  if (i > 0) last_value = values[i - 1];
+  return DeltaPrefixSumScalar(values + i, num_values - i, min_delta, last_value);
+}
+#else
+template <typename UT>
+UT DeltaPrefixSum(UT* values, int num_values, UT min_delta, UT last_value) {
+  return DeltaPrefixSumScalar(values, num_values, min_delta, last_value);
+}
+#endif
+
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DType> {
  public:
@@ -2679,13 +2788,12 @@ class DeltaBitPackDecoder : public DecoderImpl, virtual public TypedDecoder<DTyp
           values_decode) {
         ParquetException::EofException();
       }
-      for (int j = 0; j < values_decode; ++j) {
-        // Addition between min_delta, packed int and last_value should be treated as
-        // unsigned addition. Overflow is as expected.
-        buffer[i + j] = static_cast<UT>(min_delta_) + static_cast<UT>(buffer[i + j]) +
-                        static_cast<UT>(last_value_);
-        last_value_ = buffer[i + j];
-      }
+      // Addition between min_delta, packed int and last_value should be treated as
+      // unsigned addition. Overflow is as expected.
+      last_value_ = static_cast<T>(DeltaPrefixSum(reinterpret_cast<UT*>(buffer + i),
+                                                  values_decode,
+                                                  static_cast<UT>(min_delta_),
+                                                  static_cast<UT>(last_value_)));
       values_remaining_current_mini_block_ -= values_decode;
       i += values_decode;
     }
@@ -2885,27 +2993,30 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
       return 0;
     }
 
-    int32_t data_size = 0;
     const int32_t* length_ptr = buffered_length_->data_as<int32_t>() + length_idx_;
     int bytes_offset = len_ - decoder_->bytes_left();
+    // Validate and sum the lengths in a branch-free (vectorizable) loop
+    int64_t data_size = 0;
+    int32_t lengths_or = 0;
     for (int i = 0; i < max_values; ++i) {
-      int32_t len = length_ptr[i];
-      if (ARROW_PREDICT_FALSE(len < 0)) {
-        throw ParquetException("negative string delta length");
-      }
-      buffer[i].len = len;
-      if (AddWithOverflow(data_size, len, &data_size)) {
-        throw ParquetException("excess expansion in DELTA_(LENGTH_)BYTE_ARRAY");
-      }
+      data_size += length_ptr[i];
+      lengths_or |= length_ptr[i];
+    }
+    if (ARROW_PREDICT_FALSE(lengths_or < 0)) {
+      throw ParquetException("negative string delta length");
+    }
+    if (ARROW_PREDICT_FALSE(data_size > std::numeric_limits<int32_t>::max())) {
+      throw ParquetException("excess expansion in DELTA_(LENGTH_)BYTE_ARRAY");
     }
     length_idx_ += max_values;
-    if (ARROW_PREDICT_FALSE(!decoder_->Advance(8 * static_cast<int64_t>(data_size)))) {
+    if (ARROW_PREDICT_FALSE(!decoder_->Advance(8 * data_size))) {
       ParquetException::EofException();
     }
     const uint8_t* data_ptr = data_ + bytes_offset;
     for (int i = 0; i < max_values; ++i) {
+      buffer[i].len = static_cast<uint32_t>(length_ptr[i]);
       buffer[i].ptr = data_ptr;
-      data_ptr += buffer[i].len;
+      data_ptr += length_ptr[i];
     }
     this->num_values_ -= max_values;
     num_valid_values_ -= max_values;
@@ -2951,9 +3062,6 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                           int64_t valid_bits_offset,
                           typename EncodingTraits<ByteArrayType>::Accumulator* out,
                           int* out_num_values) {
-    ArrowBinaryHelper<ByteArrayType> helper(out, num_values);
-    RETURN_NOT_OK(helper.Prepare());
-
     std::vector<ByteArray> values(num_values - null_count);
     const int num_valid_values = Decode(values.data(), num_values - null_count);
     if (ARROW_PREDICT_FALSE(num_values - null_count != num_valid_values)) {
@@ -2961,6 +3069,16 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
                              " values, but decoded ", num_valid_values, " values.");
     }
 
+    // The decoded values are contiguous, so their total length is known upfront
+    // and the data can be reserved at once.
+    int64_t remaining_data_length = 0;
+    if (num_valid_values > 0) {
+      const ByteArray& last = values[num_valid_values - 1];
+      remaining_data_length = last.ptr + last.len - values[0].ptr;
+    }
+    ArrowBinaryHelper<ByteArrayType> helper(out, num_values);
+    RETURN_NOT_OK(helper.Prepare(remaining_data_length));
+
     auto values_ptr = values.data();
     int value_idx = 0;
 
@@ -2968,13 +3086,14 @@ class DeltaLengthByteArrayDecoder : public DecoderImpl,
         valid_bits, valid_bits_offset, num_values, null_count,
         [&]() {
           const auto& val = values_ptr[value_idx];
-          RETURN_NOT_OK(helper.PrepareNextInput(val.len));
-          RETURN_NOT_OK(helper.Append(val.ptr, static_cast<int32_t>(val.len)));
+          RETURN_NOT_OK(helper.PrepareNextInput(val.len, remaining_data_length));
+          helper.UnsafeAppend(val.ptr, static_cast<int32_t>(val.len));
+          remaining_data_length -= val.len;
           ++value_idx;
           return Status::OK();
         },
         [&]() {
-          RETURN_NOT_OK(helper.AppendNull());
+          helper.UnsafeAppendNull();
           --null_count;
           return Status::OK();
         }));
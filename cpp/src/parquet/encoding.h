@@ -388,6 +388,15 @@ class DictDecoder : virtual public TypedDecoder<DType> {
   ///
   /// \note API EXPERIMENTAL
   virtual void GetDictionary(const T** dictionary, int32_t* dictionary_length) = 0;
+
+  /// \brief Get the buffer holding the dictionary's variable-length values.
+  ///
+  /// The values returned by Decode() point into this buffer, which is not
+  /// modified after the dictionary is set and may be retained by the caller.
+  /// Returns nullptr for fixed-width physical types.
+  ///
+  /// \note API EXPERIMENTAL
+  virtual std::shared_ptr<Buffer> dictionary_data() const { return NULLPTR; }
 };
 
 // ----------------------------------------------------------------------
@@ -18,6 +18,7 @@
 #include "parquet/encryption/encryption_internal.h"
 
 #include <openssl/aes.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 
@@ -50,6 +51,42 @@ constexpr int kBufferSizeLength = 4;
     throw ParquetException("Couldn't init ALG decryption");           \
   }
 
+namespace {
+
+// The key whose schedule is currently expanded in a cipher context. Modules
+// (pages, page headers, indexes) encrypted with the same key as the previous one
+// then only set a new nonce, instead of expanding the key schedule (and the
+// GHASH tables with GCM) again for every module.
+class ContextKey {
+ public:
+  ~ContextKey() { WipeOut(); }
+
+  /// Returns the key to pass to EVP_{En,De}cryptInit_ex: `key` if it must be
+  /// set, nullptr if it is the key already set in the context.
+  const uint8_t* ToInit(const uint8_t* key, int key_len) const {
+    if (static_cast<int>(key_.size()) == key_len &&
+        CRYPTO_memcmp(key_.data(), key, key_len) == 0) {
+      return nullptr;
+    }
+    return key;
+  }
+
+  /// Records the key set in the context, once the init call succeeded.
+  void Set(const uint8_t* key, int key_len) { key_.assign(key, key + key_len); }
+
+  void WipeOut() {
+    if (!key_.empty()) {
+      OPENSSL_cleanse(key_.data(), key_.size());
+      key_.clear();
+    }
+  }
+
+ private:
+  std::vector<uint8_t> key_;
+};
+
+}  // namespace
+
 class AesEncryptor::AesEncryptorImpl {
  public:
   explicit AesEncryptorImpl(ParquetCipher::type alg_id, int key_len, bool metadata,
@@ -68,12 +105,14 @@ class AesEncryptor::AesEncryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = nullptr;
     }
+    ctx_key_.WipeOut();
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
   EVP_CIPHER_CTX* ctx_;
+  ContextKey ctx_key_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
@@ -188,9 +227,13 @@ int AesEncryptor::AesEncryptorImpl::GcmEncrypt(const uint8_t* plaintext,
   memset(tag, 0, kGcmTagLength);
 
   // Setting key and IV (nonce)
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
+  const uint8_t* init_key = ctx_key_.ToInit(key, key_len);
+  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, init_key, nonce)) {
     throw ParquetException("Couldn't set key and nonce");
   }
+  if (init_key != nullptr) {
+    ctx_key_.Set(key, key_len);
+  }
 
   // Setting additional authenticated data
   if ((nullptr != aad) && (1 != EVP_EncryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
@@ -250,9 +293,13 @@ int AesEncryptor::AesEncryptorImpl::CtrEncrypt(const uint8_t* plaintext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
+  const uint8_t* init_key = ctx_key_.ToInit(key, key_len);
+  if (1 != EVP_EncryptInit_ex(ctx_, nullptr, nullptr, init_key, iv)) {
     throw ParquetException("Couldn't set key and IV");
   }
+  if (init_key != nullptr) {
+    ctx_key_.Set(key, key_len);
+  }
 
   // Encryption
   if (1 != EVP_EncryptUpdate(ctx_, ciphertext + length_buffer_length_ + kNonceLength,
@@ -323,12 +370,14 @@ class AesDecryptor::AesDecryptorImpl {
       EVP_CIPHER_CTX_free(ctx_);
       ctx_ = nullptr;
     }
+    ctx_key_.WipeOut();
   }
 
   int ciphertext_size_delta() { return ciphertext_size_delta_; }
 
  private:
   EVP_CIPHER_CTX* ctx_;
+  ContextKey ctx_key_;
   int aes_mode_;
   int key_length_;
   int ciphertext_size_delta_;
@@ -476,9 +525,13 @@ int AesDecryptor::AesDecryptorImpl::GcmDecrypt(const uint8_t* ciphertext,
             tag);
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, nonce)) {
+  const uint8_t* init_key = ctx_key_.ToInit(key, key_len);
+  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, init_key, nonce)) {
     throw ParquetException("Couldn't set key and IV");
   }
+  if (init_key != nullptr) {
+    ctx_key_.Set(key, key_len);
+  }
 
   // Setting additional authenticated data
   if ((nullptr != aad) && (1 != EVP_DecryptUpdate(ctx_, nullptr, &len, aad, aad_len))) {
@@ -544,9 +597,13 @@ int AesDecryptor::AesDecryptorImpl::CtrDecrypt(const uint8_t* ciphertext,
   iv[kCtrIvLength - 1] = 1;
 
   // Setting key and IV
-  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, key, iv)) {
+  const uint8_t* init_key = ctx_key_.ToInit(key, key_len);
+  if (1 != EVP_DecryptInit_ex(ctx_, nullptr, nullptr, init_key, iv)) {
     throw ParquetException("Couldn't set key and IV");
   }
+  if (init_key != nullptr) {
+    ctx_key_.Set(key, key_len);
+  }
 
   // Decryption
   if (!EVP_DecryptUpdate(ctx_, plaintext, &len,
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "parquet/encryption/encryption.h"
+#include "parquet/encryption/encryption_internal.h"
+#include "parquet/encryption/test_encryption_util.h"
+#include "parquet/exception.h"
+
+namespace parquet::encryption::test {
+
+class TestAesEncryption : public ::testing::TestWithParam<bool> {
+ protected:
+  // Encrypts and decrypts several modules with the same cipher contexts while
+  // switching keys, as done for the pages and page headers of column chunks.
+  void EncryptDecryptModules(ParquetCipher::type alg_id, bool metadata) {
+    const std::vector<std::string> keys = {kFooterEncryptionKey, kFooterEncryptionKey,
+                                           kColumnEncryptionKey1, kFooterEncryptionKey};
+    const std::string aad = "module aad";
+    const int key_len = static_cast<int>(keys[0].size());
+    AesEncryptor encryptor(alg_id, key_len, metadata);
+    AesDecryptor decryptor(alg_id, key_len, metadata);
+
+    std::vector<std::string> plaintexts;
+    std::vector<std::vector<uint8_t>> ciphertexts;
+    for (size_t i = 0; i < keys.size(); ++i) {
+      plaintexts.push_back("module " + std::to_string(i) + std::string(i * 100, 'x'));
+      const auto& plaintext = plaintexts.back();
+      std::vector<uint8_t> ciphertext(plaintext.size() +
+                                      encryptor.CiphertextSizeDelta());
+      const int ciphertext_len = encryptor.Encrypt(
+          str2bytes(plaintext), static_cast<int>(plaintext.size()), str2bytes(keys[i]),
+          key_len, str2bytes(aad), static_cast<int>(aad.size()), ciphertext.data());
+      ASSERT_EQ(static_cast<int>(ciphertext.size()), ciphertext_len);
+      ciphertexts.push_back(std::move(ciphertext));
+    }
+
+    // Decrypt in reverse order to use the keys in another sequence
+    for (size_t j = keys.size(); j-- > 0;) {
+      std::vector<uint8_t> plaintext(plaintexts[j].size());
+      const int plaintext_len = decryptor.Decrypt(
+          ciphertexts[j].data(), static_cast<int>(ciphertexts[j].size()),
+          str2bytes(keys[j]), key_len, str2bytes(aad), static_cast<int>(aad.size()),
+          plaintext.data());
+      ASSERT_EQ(static_cast<int>(plaintext.size()), plaintext_len);
+      ASSERT_EQ(plaintexts[j], std::string(plaintext.begin(), plaintext.end()));
+    }
+
+    if (metadata || alg_id == ParquetCipher::AES_GCM_V1) {
+      // A module encrypted with another key than the one in the context fails
+      // authentication.
+      std::vector<uint8_t> plaintext(plaintexts[2].size());
+      ASSERT_THROW(decryptor.Decrypt(ciphertexts[2].data(),
+                                     static_cast<int>(ciphertexts[2].size()),
+                                     str2bytes(keys[0]), key_len, str2bytes(aad),
+                                     static_cast<int>(aad.size()), plaintext.data()),
+                   ParquetException);
+    }
+  }
+};
+
+TEST_P(TestAesEncryption, AesGcm) {
+  EncryptDecryptModules(ParquetCipher::AES_GCM_V1, /*metadata=*/GetParam());
+}
+
+TEST_P(TestAesEncryption, AesGcmCtr) {
+  EncryptDecryptModules(ParquetCipher::AES_GCM_CTR_V1, /*metadata=*/GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(Metadata, TestAesEncryption, ::testing::Bool());
+
+}  // namespace parquet::encryption::test
@@ -197,7 +197,9 @@ class TestPageSerde : public ::testing::Test {
                         bool verification_checksum, bool has_dictionary = false,
                         bool write_data_page_v2 = false);
 
-  void TestPageCompressionRoundTrip(const std::vector<int>& page_sizes);
+  void TestPageCompressionRoundTrip(
+      const std::vector<int>& page_sizes,
+      const ReaderProperties& properties = ReaderProperties());
 
  protected:
   std::shared_ptr<::arrow::io::BufferOutputStream> out_stream_;
@@ -707,7 +709,8 @@ TEST_F(TestPageSerde, TestFailLargePageHeaders) {
   ASSERT_THROW(page_reader_->NextPage(), ParquetException);
 }
 
-void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_sizes) {
+void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_sizes,
+                                                 const ReaderProperties& properties) {
   auto codec_types = GetSupportedCodecTypes();
 
   const int32_t num_rows = 32;  // dummy value
@@ -739,7 +742,7 @@ void TestPageSerde::TestPageCompressionRoundTrip(const std::vector<int>& page_si
       ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
     }
 
-    InitSerializedPageReader(num_rows * num_pages, codec_type);
+    InitSerializedPageReader(num_rows * num_pages, codec_type, properties);
 
     std::shared_ptr<Page> page;
     const DataPageV1* data_page;
@@ -777,6 +780,61 @@ TEST_F(TestPageSerde, PageSizeResetWhenRead) {
   this->TestPageCompressionRoundTrip(page_sizes);
 }
 
+TEST_F(TestPageSerde, CompressionWithPageReadahead) {
+  std::vector<int> page_sizes;
+  page_sizes.reserve(10);
+  for (int i = 0; i < 10; ++i) {
+    page_sizes.push_back((i + 1) * 64);
+  }
+  for (int32_t readahead : {1, 3, 16}) {
+    ARROW_SCOPED_TRACE("page_readahead = ", readahead);
+    ReaderProperties properties;
+    properties.set_page_readahead(readahead);
+    this->TestPageCompressionRoundTrip(page_sizes, properties);
+  }
+}
+
+TEST_F(TestPageSerde, PageReadaheadKeepsPagesAlive) {
+  auto codec_types = GetSupportedCodecTypes();
+  if (codec_types.empty()) {
+    GTEST_SKIP() << "No compression codec available";
+  }
+  auto codec = GetCodec(codec_types[0]);
+
+  const int32_t num_rows = 32;  // dummy value
+  const int num_pages = 8;
+  data_page_header_.num_values = num_rows;
+  std::vector<std::vector<uint8_t>> faux_data(num_pages);
+  for (int i = 0; i < num_pages; ++i) {
+    test::random_bytes(256, i, &faux_data[i]);
+    int data_size = static_cast<int>(faux_data[i].size());
+    std::vector<uint8_t> buffer(codec->MaxCompressedLen(data_size, faux_data[i].data()));
+    ASSERT_OK_AND_ASSIGN(int64_t actual_size,
+                         codec->Compress(data_size, faux_data[i].data(),
+                                         static_cast<int64_t>(buffer.size()),
+                                         buffer.data()));
+    ASSERT_NO_FATAL_FAILURE(
+        WriteDataPageHeader(1024, data_size, static_cast<int32_t>(actual_size)));
+    ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
+  }
+
+  ReaderProperties properties;
+  properties.set_page_readahead(4);
+  InitSerializedPageReader(num_rows * num_pages, codec_types[0], properties);
+
+  // Pages read ahead own their buffers, so earlier pages stay valid
+  std::vector<std::shared_ptr<Page>> pages;
+  while (auto page = page_reader_->NextPage()) {
+    pages.push_back(std::move(page));
+  }
+  ASSERT_EQ(num_pages, static_cast<int>(pages.size()));
+  for (int i = 0; i < num_pages; ++i) {
+    const auto* data_page = static_cast<const DataPageV1*>(pages[i].get());
+    ASSERT_EQ(static_cast<int64_t>(faux_data[i].size()), data_page->size());
+    ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), faux_data[i].size()));
+  }
+}
+
 TEST_F(TestPageSerde, LZONotSupported) {
   // Must await PARQUET-530
   int data_size = 1024;
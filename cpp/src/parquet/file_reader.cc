@@ -21,11 +21,13 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <string>
 #include <unordered_map>
 #include <utility>
 
+#include "arrow/filesystem/localfs.h"
 #include "arrow/io/caching.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
@@ -44,6 +46,7 @@
 #include "parquet/exception.h"
 #include "parquet/file_writer.h"
 #include "parquet/metadata.h"
+#include "parquet/metadata_cache.h"
 #include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/properties.h"
@@ -216,7 +219,8 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                      int64_t source_size, FileMetaData* file_metadata,
                      int row_group_number, ReaderProperties props,
                      std::shared_ptr<Buffer> prebuffered_column_chunks_bitmap,
-                     std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr)
+                     std::shared_ptr<InternalFileDecryptor> file_decryptor = nullptr,
+                     bool release_prebuffered = false)
       : source_(std::move(source)),
         cached_source_(std::move(cached_source)),
         source_size_(source_size),
@@ -224,7 +228,8 @@ class SerializedRowGroup : public RowGroupReader::Contents {
         properties_(std::move(props)),
         row_group_ordinal_(row_group_number),
         prebuffered_column_chunks_bitmap_(std::move(prebuffered_column_chunks_bitmap)),
-        file_decryptor_(std::move(file_decryptor)) {
+        file_decryptor_(std::move(file_decryptor)),
+        release_prebuffered_(release_prebuffered) {
     row_group_metadata_ = file_metadata->RowGroup(row_group_number);
   }
 
@@ -244,6 +249,10 @@ class SerializedRowGroup : public RowGroupReader::Contents {
       // PARQUET-1698: if read coalescing is enabled, read from pre-buffered
       // segments.
       PARQUET_ASSIGN_OR_THROW(auto buffer, cached_source_->Read(col_range));
+      if (release_prebuffered_) {
+        // The page reader keeps the buffer alive, the cache can move on
+        PARQUET_THROW_NOT_OK(cached_source_->Release({col_range}));
+      }
       stream = std::make_shared<::arrow::io::BufferReader>(buffer);
     } else {
       stream = properties_.GetStream(source_, col_range.offset, col_range.length);
@@ -292,6 +301,7 @@ class SerializedRowGroup : public RowGroupReader::Contents {
   int row_group_ordinal_;
   const std::shared_ptr<const Buffer> prebuffered_column_chunks_bitmap_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  const bool release_prebuffered_;
 };
 
 // ----------------------------------------------------------------------
@@ -330,7 +340,8 @@ class SerializedFile : public ParquetFileReader::Contents {
 
     std::unique_ptr<SerializedRowGroup> contents = std::make_unique<SerializedRowGroup>(
         source_, cached_source_, source_size_, file_metadata_.get(), i, properties_,
-        std::move(prebuffered_column_chunks_bitmap), file_decryptor_);
+        std::move(prebuffered_column_chunks_bitmap), file_decryptor_,
+        release_prebuffered_);
     return std::make_shared<RowGroupReader>(std::move(contents));
   }
 
@@ -381,6 +392,7 @@ class SerializedFile : public ParquetFileReader::Contents {
                  const ::arrow::io::CacheOptions& options) {
     cached_source_ =
         std::make_shared<::arrow::io::internal::ReadRangeCache>(source_, ctx, options);
+    release_prebuffered_ = options.memory_limit > 0;
     std::vector<::arrow::io::ReadRange> ranges;
     prebuffered_column_chunks_.clear();
     int num_cols = file_metadata_->num_columns();
@@ -608,6 +620,9 @@ class SerializedFile : public ParquetFileReader::Contents {
   // Maps row group ordinal and prebuffer status of its column chunks in the form of a
   // bitmap buffer.
   std::unordered_map<int, std::shared_ptr<Buffer>> prebuffered_column_chunks_;
+  // Whether column chunks are released from the cache once read, so that a cache
+  // with a memory limit can read the following ones.
+  bool release_prebuffered_ = false;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
 
   // \return The true length of the metadata in bytes
@@ -830,7 +845,26 @@ std::unique_ptr<ParquetFileReader> ParquetFileReader::OpenFile(
                             ::arrow::io::ReadableFile::Open(path, props.memory_pool()));
   }
 
-  return Open(std::move(source), props, std::move(metadata));
+  const auto& cache = props.file_metadata_cache();
+  std::optional<FileMetaDataCache::Key> cache_key;
+  if (metadata == nullptr && cache != nullptr &&
+      props.file_decryption_properties() == nullptr) {
+    ::arrow::fs::LocalFileSystem local_fs;
+    auto maybe_info = local_fs.GetFileInfo(path);
+    if (maybe_info.ok()) {
+      cache_key = FileMetaDataCache::KeyFor(local_fs.type_name(), *maybe_info);
+    }
+    if (cache_key.has_value()) {
+      metadata = cache->Get(*cache_key);
+    }
+  }
+
+  const bool cache_miss = cache_key.has_value() && metadata == nullptr;
+  auto reader = Open(std::move(source), props, std::move(metadata));
+  if (cache_miss) {
+    cache->Put(*cache_key, reader->metadata());
+  }
+  return reader;
 }
 
 ::arrow::Future<std::unique_ptr<ParquetFileReader>> ParquetFileReader::OpenAsync(
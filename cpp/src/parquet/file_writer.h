@@ -58,6 +58,10 @@ class PARQUET_EXPORT RowGroupWriter {
     virtual int64_t total_compressed_bytes() const = 0;
     /// \brief total compressed bytes written by the page writer
     virtual int64_t total_compressed_bytes_written() const = 0;
+    /// \brief estimated size of the row group once all of its columns are closed
+    virtual int64_t estimated_total_bytes() const {
+      return total_compressed_bytes() + total_compressed_bytes_written();
+    }
 
     virtual bool buffered() const = 0;
   };
@@ -99,6 +103,12 @@ class PARQUET_EXPORT RowGroupWriter {
   int64_t total_compressed_bytes() const;
   /// \brief total compressed bytes written by the page writer
   int64_t total_compressed_bytes_written() const;
+  /// \brief estimated size of the row group once all of its columns are closed.
+  ///
+  /// This is the compressed size of the pages written so far plus the encoded
+  /// size of the values still buffered in the column writers, which have not
+  /// been compressed yet.
+  int64_t estimated_total_bytes() const;
 
   /// Returns whether the current RowGroupWriter is in the buffered mode and is created
   /// by calling ParquetFileWriter::AppendBufferedRowGroup.
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cinttypes>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <string_view>
@@ -489,9 +490,15 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
   }
 
   bool Equals(const RowGroupMetaDataImpl& other) const {
+    DecodeAllColumnChunks();
+    other.DecodeAllColumnChunks();
     return *row_group_ == *other.row_group_;
   }
 
+  void set_column_chunk_decoder(std::function<void(int)> decoder) {
+    decode_column_chunk_ = std::move(decoder);
+  }
+
   inline int num_columns() const { return static_cast<int>(row_group_->columns.size()); }
 
   inline int64_t num_rows() const { return row_group_->num_rows; }
@@ -508,6 +515,9 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
 
   std::unique_ptr<ColumnChunkMetaData> ColumnChunk(int i) {
     if (i >= 0 && i < num_columns()) {
+      if (decode_column_chunk_) {
+        decode_column_chunk_(i);
+      }
       return ColumnChunkMetaData::Make(&row_group_->columns[i], schema_->Column(i),
                                        properties_, writer_version_, row_group_->ordinal,
                                        i, file_decryptor_);
@@ -529,11 +539,20 @@ class RowGroupMetaData::RowGroupMetaDataImpl {
   }
 
  private:
+  void DecodeAllColumnChunks() const {
+    if (decode_column_chunk_) {
+      for (int i = 0; i < num_columns(); ++i) {
+        decode_column_chunk_(i);
+      }
+    }
+  }
+
   const format::RowGroup* row_group_;
   const SchemaDescriptor* schema_;
   const ReaderProperties properties_;
   const ApplicationVersion* writer_version_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  std::function<void(int)> decode_column_chunk_;
 };
 
 std::unique_ptr<RowGroupMetaData> RowGroupMetaData::Make(
@@ -563,6 +582,10 @@ RowGroupMetaData::RowGroupMetaData(const void* metadata, const SchemaDescriptor*
 
 RowGroupMetaData::~RowGroupMetaData() = default;
 
+void RowGroupMetaData::set_column_chunk_decoder(std::function<void(int)> decoder) {
+  impl_->set_column_chunk_decoder(std::move(decoder));
+}
+
 bool RowGroupMetaData::Equals(const RowGroupMetaData& other) const {
   return impl_->Equals(*other.impl_);
 }
@@ -599,6 +622,145 @@ std::vector<SortingColumn> RowGroupMetaData::sorting_columns() const {
   return impl_->sorting_columns();
 }
 
+namespace {
+
+// Thrift field ids of FileMetaData.row_groups and RowGroup.columns
+constexpr int16_t kRowGroupsFieldId = 4;
+constexpr int16_t kColumnsFieldId = 1;
+
+}  // namespace
+
+// Decodes the row groups and column chunks of an unencrypted footer on first
+// access.
+//
+// Upfront, the footer is scanned without materializing anything to find the
+// byte range of every row group, and decoded with the row group list replaced
+// by an empty one. The row group bytes are kept so that each row group can
+// later be decoded the same way, leaving its column chunks to be decoded one
+// by one.
+class LazyFooterDecoder {
+ public:
+  LazyFooterDecoder(const uint8_t* data, uint32_t* len,
+                    const ReaderProperties& properties, format::FileMetaData* metadata)
+      : deserializer_(properties), metadata_(metadata) {
+    ThriftByteRange list_range;
+    std::vector<ThriftByteRange> row_group_ranges;
+    if (!deserializer_.LocateListField(data, *len, kRowGroupsFieldId, &list_range,
+                                       &row_group_ranges)) {
+      deserializer_.DeserializeMessage(data, len, metadata_);
+      return;
+    }
+    *len = DecodeWithoutList(data, *len, list_range, metadata_);
+
+    // Keep the row group bytes, with ranges relative to them
+    PARQUET_ASSIGN_OR_THROW(
+        buffer_, ::arrow::AllocateBuffer(list_range.length, properties.memory_pool()));
+    std::memcpy(buffer_->mutable_data(), data + list_range.offset, list_range.length);
+    row_groups_.resize(row_group_ranges.size());
+    for (size_t i = 0; i < row_group_ranges.size(); ++i) {
+      row_groups_[i].range = {row_group_ranges[i].offset - list_range.offset,
+                              row_group_ranges[i].length};
+    }
+    metadata_->row_groups.resize(row_groups_.size());
+  }
+
+  // Decode the fields of row group i, but not its column chunks.
+  void DecodeRowGroup(int i) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecodeRowGroupUnlocked(i);
+  }
+
+  void DecodeColumnChunk(int i, int j) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    DecodeColumnChunkUnlocked(i, j);
+  }
+
+  void DecodeAll() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < static_cast<int>(row_groups_.size()); ++i) {
+      DecodeRowGroupUnlocked(i);
+      for (int j = 0; j < static_cast<int>(row_groups_[i].columns.size()); ++j) {
+        DecodeColumnChunkUnlocked(i, j);
+      }
+    }
+  }
+
+ private:
+  struct LazyColumnChunk {
+    ThriftByteRange range;
+    bool decoded = false;
+  };
+
+  struct LazyRowGroup {
+    ThriftByteRange range;
+    bool decoded = false;
+    std::vector<LazyColumnChunk> columns;
+  };
+
+  // Decode the struct in [data, data + len) as if its list field at
+  // `list_range` were empty, returning the number of bytes the struct spans.
+  template <typename T>
+  uint32_t DecodeWithoutList(const uint8_t* data, uint32_t len,
+                             const ThriftByteRange& list_range, T* out) {
+    // A compact protocol list header carries the element type in its low
+    // nibble and a size of zero fits in the high nibble.
+    const uint32_t list_end = list_range.offset + list_range.length;
+    std::vector<uint8_t> spliced;
+    spliced.reserve(len - list_range.length + 1);
+    spliced.insert(spliced.end(), data, data + list_range.offset);
+    spliced.push_back(data[list_range.offset] & 0x0F);
+    spliced.insert(spliced.end(), data + list_end, data + len);
+    auto spliced_len = static_cast<uint32_t>(spliced.size());
+    deserializer_.DeserializeMessage(spliced.data(), &spliced_len, out);
+    return spliced_len + list_range.length - 1;
+  }
+
+  void DecodeRowGroupUnlocked(int i) {
+    if (i < 0 || i >= static_cast<int>(row_groups_.size())) return;
+    LazyRowGroup& row_group = row_groups_[i];
+    if (row_group.decoded) return;
+
+    const uint8_t* data = buffer_->data() + row_group.range.offset;
+    uint32_t len = row_group.range.length;
+    format::RowGroup* out = &metadata_->row_groups[i];
+    ThriftByteRange list_range;
+    std::vector<ThriftByteRange> column_ranges;
+    if (deserializer_.LocateListField(data, len, kColumnsFieldId, &list_range,
+                                      &column_ranges)) {
+      DecodeWithoutList(data, len, list_range, out);
+      out->columns.resize(column_ranges.size());
+      row_group.columns.resize(column_ranges.size());
+      for (size_t j = 0; j < column_ranges.size(); ++j) {
+        row_group.columns[j].range = {row_group.range.offset + column_ranges[j].offset,
+                                      column_ranges[j].length};
+      }
+    } else {
+      deserializer_.DeserializeMessage(data, &len, out);
+    }
+    row_group.decoded = true;
+  }
+
+  void DecodeColumnChunkUnlocked(int i, int j) {
+    DecodeRowGroupUnlocked(i);
+    if (i < 0 || i >= static_cast<int>(row_groups_.size())) return;
+    LazyRowGroup& row_group = row_groups_[i];
+    if (j < 0 || j >= static_cast<int>(row_group.columns.size())) return;
+    LazyColumnChunk& column = row_group.columns[j];
+    if (column.decoded) return;
+
+    uint32_t len = column.range.length;
+    deserializer_.DeserializeMessage(buffer_->data() + column.range.offset, &len,
+                                     &metadata_->row_groups[i].columns[j]);
+    column.decoded = true;
+  }
+
+  std::mutex mutex_;
+  ThriftDeserializer deserializer_;
+  format::FileMetaData* metadata_;
+  std::shared_ptr<Buffer> buffer_;
+  std::vector<LazyRowGroup> row_groups_;
+};
+
 // file metadata
 class FileMetaData::FileMetaDataImpl {
  public:
@@ -613,10 +775,16 @@ class FileMetaData::FileMetaDataImpl {
     auto footer_decryptor =
         file_decryptor_ != nullptr ? file_decryptor_->GetFooterDecryptor() : nullptr;
 
-    ThriftDeserializer deserializer(properties_);
-    deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
-                                    metadata_len, metadata_.get(),
-                                    footer_decryptor.get());
+    if (properties_.is_lazy_metadata_decoding_enabled() && footer_decryptor == nullptr) {
+      lazy_decoder_ = std::make_unique<LazyFooterDecoder>(
+          reinterpret_cast<const uint8_t*>(metadata), metadata_len, properties_,
+          metadata_.get());
+    } else {
+      ThriftDeserializer deserializer(properties_);
+      deserializer.DeserializeMessage(reinterpret_cast<const uint8_t*>(metadata),
+                                      metadata_len, metadata_.get(),
+                                      footer_decryptor.get());
+    }
     metadata_len_ = *metadata_len;
 
     if (metadata_->__isset.created_by) {
@@ -635,6 +803,7 @@ class FileMetaData::FileMetaDataImpl {
     if (file_decryptor_ == nullptr) {
       throw ParquetException("Decryption not set properly. cannot verify signature");
     }
+    DecodeAll();
     // serialize the footer
     uint8_t* serialized_data;
     uint32_t serialized_len = metadata_len_;
@@ -694,6 +863,7 @@ class FileMetaData::FileMetaDataImpl {
 
   void WriteTo(::arrow::io::OutputStream* dst,
                const std::shared_ptr<Encryptor>& encryptor) const {
+    DecodeAll();
     ThriftSerializer serializer;
     // Only in encrypted files with plaintext footers the
     // encryption_algorithm is set in footer
@@ -729,11 +899,22 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
-    return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, properties_,
-                                  &writer_version_, file_decryptor_);
+    if (lazy_decoder_ == nullptr) {
+      return RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_, properties_,
+                                    &writer_version_, file_decryptor_);
+    }
+    lazy_decoder_->DecodeRowGroup(i);
+    auto row_group = RowGroupMetaData::Make(&metadata_->row_groups[i], &schema_,
+                                            properties_, &writer_version_,
+                                            file_decryptor_);
+    row_group->set_column_chunk_decoder(
+        [decoder = lazy_decoder_.get(), i](int j) { decoder->DecodeColumnChunk(i, j); });
+    return row_group;
   }
 
   bool Equals(const FileMetaDataImpl& other) const {
+    DecodeAll();
+    other.DecodeAll();
     return *metadata_ == *other.metadata_;
   }
 
@@ -744,6 +925,7 @@ class FileMetaData::FileMetaDataImpl {
   }
 
   void set_file_path(const std::string& path) {
+    DecodeAll();
     for (format::RowGroup& row_group : metadata_->row_groups) {
       for (format::ColumnChunk& chunk : row_group.columns) {
         chunk.__set_file_path(path);
@@ -758,6 +940,13 @@ class FileMetaData::FileMetaDataImpl {
          << " row groups, requested metadata for row group: " << i;
       throw ParquetException(ss.str());
     }
+    if (lazy_decoder_ != nullptr) {
+      lazy_decoder_->DecodeRowGroup(i);
+      for (int j = 0; j < static_cast<int>(metadata_->row_groups[i].columns.size());
+           ++j) {
+        lazy_decoder_->DecodeColumnChunk(i, j);
+      }
+    }
     return metadata_->row_groups[i];
   }
 
@@ -774,6 +963,8 @@ class FileMetaData::FileMetaDataImpl {
     // and incur O(n²) behavior on repeated calls to AppendRowGroups().
     // (see https://en.cppreference.com/w/cpp/container/vector/reserve
     //  about inappropriate uses of reserve()).
+    // Appended row groups are not known to the lazy decoder
+    DecodeAll();
     const auto start = metadata_->row_groups.size();
     metadata_->row_groups.resize(start + n);
     for (int i = 0; i < n; i++) {
@@ -835,6 +1026,14 @@ class FileMetaData::FileMetaDataImpl {
   std::shared_ptr<const KeyValueMetadata> key_value_metadata_;
   const ReaderProperties properties_;
   std::shared_ptr<InternalFileDecryptor> file_decryptor_;
+  // Set when the footer is decoded lazily
+  std::unique_ptr<LazyFooterDecoder> lazy_decoder_;
+
+  void DecodeAll() const {
+    if (lazy_decoder_ != nullptr) {
+      lazy_decoder_->DecodeAll();
+    }
+  }
 
   void InitSchema() {
     if (metadata_->schema.empty()) {
@@ -1838,6 +2037,24 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     }
   }
 
+  void SetBloomFilterLocation(const BloomFilterLocation& location) {
+    for (const auto& [row_group_ordinal, row_group_location] :
+         location.bloom_filter_location) {
+      auto& row_group_metadata = row_groups_.at(row_group_ordinal);
+      for (size_t i = 0; i < row_group_location.size(); ++i) {
+        if (i >= row_group_metadata.columns.size()) {
+          throw ParquetException("Cannot find metadata for column ordinal ", i);
+        }
+        const auto& bloom_filter_location = row_group_location[i];
+        if (bloom_filter_location.has_value()) {
+          auto& column_metadata = row_group_metadata.columns[i].meta_data;
+          column_metadata.__set_bloom_filter_offset(bloom_filter_location->offset);
+          column_metadata.__set_bloom_filter_length(bloom_filter_location->length);
+        }
+      }
+    }
+  }
+
   std::unique_ptr<FileMetaData> Finish(
       const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) {
     int64_t total_rows = 0;
@@ -1980,6 +2197,10 @@ void FileMetaDataBuilder::SetPageIndexLocation(const PageIndexLocation& location
   impl_->SetPageIndexLocation(location);
 }
 
+void FileMetaDataBuilder::SetBloomFilterLocation(const BloomFilterLocation& location) {
+  impl_->SetBloomFilterLocation(location);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish(
     const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) {
   return impl_->Finish(key_value_metadata);
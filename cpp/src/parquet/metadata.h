@@ -18,6 +18,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
@@ -257,6 +258,10 @@ class PARQUET_EXPORT RowGroupMetaData {
       const ReaderProperties& properties,
       const ApplicationVersion* writer_version = NULLPTR,
       std::shared_ptr<InternalFileDecryptor> file_decryptor = NULLPTR);
+  friend class FileMetaData;
+  // Set the callback decoding column chunks on first access, for lazily
+  // decoded footers.
+  void set_column_chunk_decoder(std::function<void(int)> decoder);
   // PIMPL Idiom
   class RowGroupMetaDataImpl;
   std::unique_ptr<RowGroupMetaDataImpl> impl_;
@@ -526,6 +531,14 @@ struct PageIndexLocation {
   FileIndexLocation offset_index_location;
 };
 
+/// \brief Public struct for location to all bloom filters in a parquet file.
+struct BloomFilterLocation {
+  /// Row group bloom filter locations which uses row group ordinal as the key.
+  /// The locations of a row group are indexed by column ordinal, std::nullopt
+  /// standing for columns without bloom filter.
+  PageIndexLocation::FileIndexLocation bloom_filter_location;
+};
+
 class PARQUET_EXPORT FileMetaDataBuilder {
  public:
   ARROW_DEPRECATED("Deprecated in 12.0.0. Use overload without KeyValueMetadata instead.")
@@ -545,6 +558,9 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // Update location to all page indexes in the parquet file
   void SetPageIndexLocation(const PageIndexLocation& location);
 
+  // Update location to all bloom filters in the parquet file
+  void SetBloomFilterLocation(const BloomFilterLocation& location);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish(
       const std::shared_ptr<const KeyValueMetadata>& key_value_metadata = NULLPTR);
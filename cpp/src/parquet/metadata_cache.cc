@@ -0,0 +1,241 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/metadata_cache.h"
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/util/cache_internal.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/string.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+
+namespace parquet {
+
+namespace {
+
+// The components are NUL-separated so that no two distinct keys can collide.
+std::string EncodeKey(const FileMetaDataCache::Key& key) {
+  std::string encoded;
+  encoded.reserve(key.path.size() + key.version.size() + 24);
+  encoded += key.path;
+  encoded += '\0';
+  encoded += std::to_string(key.size);
+  encoded += '\0';
+  encoded += key.version;
+  return encoded;
+}
+
+// Stores each footer in its own file named after a hash of the key. The file
+// starts with the length-prefixed encoded key, which is checked on read so that
+// hash collisions are treated as misses, followed by the serialized footer.
+class FileSystemStore : public FileMetaDataCache::Store {
+ public:
+  FileSystemStore(std::shared_ptr<::arrow::fs::FileSystem> filesystem,
+                  std::string base_dir)
+      : filesystem_(std::move(filesystem)), base_dir_(std::move(base_dir)) {}
+
+  ::arrow::Result<std::shared_ptr<::arrow::Buffer>> Get(
+      const FileMetaDataCache::Key& key) override {
+    const std::string encoded = EncodeKey(key);
+    const std::string path = PathFor(encoded);
+    auto maybe_input = filesystem_->OpenInputFile(path);
+    if (!maybe_input.ok()) {
+      ARROW_ASSIGN_OR_RAISE(auto info, filesystem_->GetFileInfo(path));
+      if (info.type() == ::arrow::fs::FileType::NotFound) return nullptr;
+      return maybe_input.status();
+    }
+    auto input = maybe_input.MoveValueUnsafe();
+    ARROW_ASSIGN_OR_RAISE(int64_t size, input->GetSize());
+    ARROW_ASSIGN_OR_RAISE(auto entry, input->ReadAt(0, size));
+    RETURN_NOT_OK(input->Close());
+
+    const int64_t header_size = sizeof(uint32_t) + static_cast<int64_t>(encoded.size());
+    if (entry->size() < header_size) return nullptr;
+    uint32_t key_length;
+    std::memcpy(&key_length, entry->data(), sizeof(key_length));
+    key_length = ::arrow::bit_util::FromLittleEndian(key_length);
+    if (key_length != encoded.size() ||
+        std::memcmp(entry->data() + sizeof(uint32_t), encoded.data(), key_length) != 0) {
+      return nullptr;
+    }
+    return ::arrow::SliceBuffer(std::move(entry), header_size);
+  }
+
+  ::arrow::Status Put(const FileMetaDataCache::Key& key,
+                      std::shared_ptr<::arrow::Buffer> serialized) override {
+    if (!dir_created_.load()) {
+      RETURN_NOT_OK(filesystem_->CreateDir(base_dir_, /*recursive=*/true));
+      dir_created_.store(true);
+    }
+    const std::string encoded = EncodeKey(key);
+    const uint32_t key_length =
+        ::arrow::bit_util::ToLittleEndian(static_cast<uint32_t>(encoded.size()));
+    ARROW_ASSIGN_OR_RAISE(auto output, filesystem_->OpenOutputStream(PathFor(encoded)));
+    RETURN_NOT_OK(output->Write(&key_length, sizeof(key_length)));
+    RETURN_NOT_OK(output->Write(encoded.data(), static_cast<int64_t>(encoded.size())));
+    RETURN_NOT_OK(output->Write(serialized));
+    return output->Close();
+  }
+
+ private:
+  std::string PathFor(const std::string& encoded) const {
+    const uint64_t hash = ::arrow::internal::ComputeStringHash<0>(
+        encoded.data(), static_cast<int64_t>(encoded.size()));
+    return ::arrow::fs::internal::ConcatAbstractPath(
+        base_dir_, ::arrow::HexEncode(reinterpret_cast<const uint8_t*>(&hash),
+                                      sizeof(hash)) +
+                       ".footer");
+  }
+
+  const std::shared_ptr<::arrow::fs::FileSystem> filesystem_;
+  const std::string base_dir_;
+  std::atomic<bool> dir_created_{false};
+};
+
+}  // namespace
+
+class FileMetaDataCache::Impl {
+ public:
+  explicit Impl(int32_t capacity) : cache_(capacity) {}
+
+  std::shared_ptr<FileMetaData> Find(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto* value = cache_.Find(key);
+    return value == nullptr ? nullptr : *value;
+  }
+
+  void Replace(std::string key, std::shared_ptr<FileMetaData> metadata) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.Replace(std::move(key), std::move(metadata));
+  }
+
+  void Count(int64_t Stats::*counter) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++(stats_.*counter);
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cache_.Clear();
+  }
+
+  int32_t size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.size();
+  }
+
+  Stats stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+ private:
+  std::mutex mutex_;
+  ::arrow::internal::LruCache<std::string, std::shared_ptr<FileMetaData>> cache_;
+  Stats stats_;
+};
+
+FileMetaDataCache::FileMetaDataCache(int32_t capacity, std::shared_ptr<Store> store)
+    : capacity_(capacity), store_(std::move(store)), impl_(new Impl(capacity)) {
+  if (capacity <= 0) {
+    throw ParquetException("FileMetaDataCache capacity must be positive");
+  }
+}
+
+FileMetaDataCache::~FileMetaDataCache() = default;
+
+std::optional<FileMetaDataCache::Key> FileMetaDataCache::KeyFor(
+    const std::string& filesystem_type, const ::arrow::fs::FileInfo& info) {
+  if (!info.IsFile() || info.size() == ::arrow::fs::kNoSize ||
+      info.mtime() == ::arrow::fs::kNoTime) {
+    return std::nullopt;
+  }
+  return Key{filesystem_type + "://" + info.path(), info.size(),
+             std::to_string(info.mtime().time_since_epoch().count())};
+}
+
+const std::shared_ptr<FileMetaDataCache>& FileMetaDataCache::Global() {
+  static const auto cache = std::make_shared<FileMetaDataCache>();
+  return cache;
+}
+
+std::shared_ptr<FileMetaDataCache::Store> FileMetaDataCache::MakeFileSystemStore(
+    std::shared_ptr<::arrow::fs::FileSystem> filesystem, std::string base_dir) {
+  return std::make_shared<FileSystemStore>(std::move(filesystem), std::move(base_dir));
+}
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::Get(const Key& key) {
+  std::string encoded = EncodeKey(key);
+  auto metadata = impl_->Find(encoded);
+  if (metadata == nullptr && store_ != nullptr) {
+    metadata = GetFromStore(key);
+    if (metadata != nullptr) {
+      impl_->Count(&Stats::store_hits);
+      impl_->Replace(std::move(encoded), metadata);
+    }
+  }
+  impl_->Count(metadata == nullptr ? &Stats::misses : &Stats::hits);
+  return metadata;
+}
+
+std::shared_ptr<FileMetaData> FileMetaDataCache::GetFromStore(const Key& key) {
+  auto maybe_serialized = store_->Get(key);
+  if (!maybe_serialized.ok()) {
+    impl_->Count(&Stats::store_errors);
+    return nullptr;
+  }
+  auto serialized = maybe_serialized.MoveValueUnsafe();
+  if (serialized == nullptr) return nullptr;
+  try {
+    auto length = static_cast<uint32_t>(serialized->size());
+    return FileMetaData::Make(serialized->data(), &length);
+  } catch (const ParquetException&) {
+    // A truncated or otherwise corrupt entry is a miss; Put will overwrite it.
+    impl_->Count(&Stats::store_errors);
+    return nullptr;
+  }
+}
+
+void FileMetaDataCache::Put(const Key& key, std::shared_ptr<FileMetaData> metadata) {
+  if (metadata == nullptr) return;
+  impl_->Count(&Stats::insertions);
+  impl_->Replace(EncodeKey(key), metadata);
+  if (store_ != nullptr) {
+    auto serialized = ::arrow::Buffer::FromString(metadata->SerializeToString());
+    if (!store_->Put(key, std::move(serialized)).ok()) {
+      impl_->Count(&Stats::store_errors);
+    }
+  }
+}
+
+void FileMetaDataCache::Clear() { impl_->Clear(); }
+
+int32_t FileMetaDataCache::size() const { return impl_->size(); }
+
+FileMetaDataCache::Stats FileMetaDataCache::stats() const { return impl_->stats(); }
+
+}  // namespace parquet
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "arrow/filesystem/type_fwd.h"
+#include "arrow/type_fwd.h"
+#include "parquet/platform.h"
+#include "parquet/type_fwd.h"
+
+namespace parquet {
+
+/// \brief A thread-safe LRU cache of parsed file footers.
+///
+/// Entries are keyed by the file's location together with its size and
+/// version, so a file that is rewritten in place is not served stale
+/// metadata. The cached FileMetaData also carries the page index and bloom
+/// filter offsets of every column chunk, so a hit avoids the footer read
+/// entirely.
+///
+/// An optional Store adds a persistent second tier, for example a directory on
+/// local disk or object storage shared by short-lived processes. Footers missing
+/// from memory are looked up in the store, and footers put in the cache are
+/// written through to it, so the row group statistics of a file are derived
+/// from its footer only once across processes.
+///
+/// \note API EXPERIMENTAL
+class PARQUET_EXPORT FileMetaDataCache {
+ public:
+  static constexpr int32_t kDefaultCapacity = 1024;
+
+  struct Key {
+    /// The file path, qualified enough to be unique within the process
+    /// (e.g. prefixed with the filesystem type).
+    std::string path;
+    /// The file size in bytes.
+    int64_t size;
+    /// An opaque version token such as a modification time or an ETag.
+    std::string version;
+  };
+
+  struct Stats {
+    int64_t hits = 0;
+    int64_t misses = 0;
+    int64_t insertions = 0;
+    /// Lookups missing from memory that were served by the store. They are
+    /// also counted as hits.
+    int64_t store_hits = 0;
+    /// Store reads or writes that failed. The cache treats them as misses.
+    int64_t store_errors = 0;
+  };
+
+  /// \brief A persistent tier holding serialized footers.
+  ///
+  /// Implementations must be thread-safe. A footer stored under a key never
+  /// changes, since the key includes the file size and version.
+  class PARQUET_EXPORT Store {
+   public:
+    virtual ~Store() = default;
+
+    /// \brief Return the serialized footer stored under `key`, or nullptr if
+    /// there is none.
+    virtual ::arrow::Result<std::shared_ptr<::arrow::Buffer>> Get(const Key& key) = 0;
+
+    /// \brief Store the serialized footer of `key`.
+    virtual ::arrow::Status Put(const Key& key,
+                                std::shared_ptr<::arrow::Buffer> serialized) = 0;
+  };
+
+  /// \brief Make a Store keeping one file per footer under `base_dir` of
+  /// `filesystem`.
+  static std::shared_ptr<Store> MakeFileSystemStore(
+      std::shared_ptr<::arrow::fs::FileSystem> filesystem, std::string base_dir);
+
+  /// \brief Create a cache holding at most `capacity` footers in memory, backed
+  /// by `store` if given.
+  explicit FileMetaDataCache(int32_t capacity = kDefaultCapacity,
+                             std::shared_ptr<Store> store = NULLPTR);
+  ~FileMetaDataCache();
+
+  /// \brief Build the key of a file from its filesystem listing.
+  ///
+  /// Returns nullopt if the size or modification time of the file is unknown,
+  /// in which case the file cannot be safely cached.
+  static std::optional<Key> KeyFor(const std::string& filesystem_type,
+                                   const ::arrow::fs::FileInfo& info);
+
+  /// \brief The process-wide cache instance.
+  static const std::shared_ptr<FileMetaDataCache>& Global();
+
+  /// \brief Look up a footer in memory, then in the store, or return nullptr
+  /// and count a miss.
+  std::shared_ptr<FileMetaData> Get(const Key& key);
+
+  /// \brief Insert or replace a footer, evicting the least recently used one
+  /// if the cache is full, and write it to the store.
+  void Put(const Key& key, std::shared_ptr<FileMetaData> metadata);
+
+  /// \brief Drop all in-memory entries. Statistics and the store are kept.
+  void Clear();
+
+  int32_t capacity() const { return capacity_; }
+  const std::shared_ptr<Store>& store() const { return store_; }
+  int32_t size() const;
+  Stats stats() const;
+
+ private:
+  class Impl;
+
+  std::shared_ptr<FileMetaData> GetFromStore(const Key& key);
+
+  const int32_t capacity_;
+  const std::shared_ptr<Store> store_;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace parquet
@@ -0,0 +1,157 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/metadata_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/testing/gtest_util.h"
+#include "parquet/exception.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
+#include "parquet/properties.h"
+#include "parquet/test_util.h"
+
+namespace parquet {
+
+namespace {
+
+std::shared_ptr<FileMetaData> ReadTestMetaData() {
+  std::string path = std::string(test::get_data_dir()) + "/alltypes_tiny_pages.parquet";
+  return ParquetFileReader::OpenFile(path, false)->metadata();
+}
+
+}  // namespace
+
+TEST(FileMetaDataCache, LruEviction) {
+  auto metadata = ReadTestMetaData();
+  FileMetaDataCache cache(/*capacity=*/2);
+  FileMetaDataCache::Key a{"a", 10, "1"}, b{"b", 10, "1"}, c{"c", 10, "1"};
+
+  ASSERT_EQ(cache.Get(a), nullptr);
+  cache.Put(a, metadata);
+  cache.Put(b, metadata);
+  ASSERT_EQ(cache.Get(a), metadata);
+  // b is now the least recently used entry
+  cache.Put(c, metadata);
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_EQ(cache.Get(b), nullptr);
+  ASSERT_EQ(cache.Get(a), metadata);
+  ASSERT_EQ(cache.Get(c), metadata);
+
+  // Size and version are part of the key
+  ASSERT_EQ(cache.Get(FileMetaDataCache::Key{"a", 11, "1"}), nullptr);
+  ASSERT_EQ(cache.Get(FileMetaDataCache::Key{"a", 10, "2"}), nullptr);
+
+  auto stats = cache.stats();
+  ASSERT_EQ(stats.hits, 3);
+  ASSERT_EQ(stats.misses, 4);
+  ASSERT_EQ(stats.insertions, 3);
+
+  cache.Clear();
+  ASSERT_EQ(cache.size(), 0);
+  ASSERT_EQ(cache.Get(a), nullptr);
+
+  ASSERT_THROW(FileMetaDataCache(0), ParquetException);
+}
+
+TEST(FileMetaDataCache, KeyFor) {
+  ::arrow::fs::FileInfo info("dir/file.parquet", ::arrow::fs::FileType::File);
+  ASSERT_FALSE(FileMetaDataCache::KeyFor("local", info).has_value());
+  info.set_size(100);
+  ASSERT_FALSE(FileMetaDataCache::KeyFor("local", info).has_value());
+  info.set_mtime(::arrow::fs::TimePoint(::arrow::fs::TimePoint::duration(42)));
+  auto key = FileMetaDataCache::KeyFor("s3", info);
+  ASSERT_TRUE(key.has_value());
+  ASSERT_EQ(key->path, "s3://dir/file.parquet");
+  ASSERT_EQ(key->size, 100);
+  ASSERT_EQ(key->version, "42");
+
+  info.set_type(::arrow::fs::FileType::Directory);
+  ASSERT_FALSE(FileMetaDataCache::KeyFor("s3", info).has_value());
+}
+
+TEST(FileMetaDataCache, OpenFile) {
+  std::string path = std::string(test::get_data_dir()) + "/alltypes_tiny_pages.parquet";
+  auto cache = std::make_shared<FileMetaDataCache>();
+  ReaderProperties props;
+  props.set_file_metadata_cache(cache);
+
+  auto first = ParquetFileReader::OpenFile(path, false, props);
+  ASSERT_EQ(cache->size(), 1);
+  ASSERT_EQ(cache->stats().misses, 1);
+
+  auto second = ParquetFileReader::OpenFile(path, false, props);
+  ASSERT_EQ(cache->stats().hits, 1);
+  ASSERT_EQ(second->metadata(), first->metadata());
+  // Page index locations come with the cached footer
+  ASSERT_TRUE(second->metadata()->RowGroup(0)->ColumnChunk(0)->GetColumnIndexLocation());
+  ASSERT_EQ(second->RowGroup(0)->metadata()->num_rows(),
+            first->RowGroup(0)->metadata()->num_rows());
+
+  // Without a cache, the footer is parsed again
+  auto uncached = ParquetFileReader::OpenFile(path, false);
+  ASSERT_NE(uncached->metadata(), first->metadata());
+  ASSERT_EQ(cache->stats().hits, 1);
+}
+
+TEST(FileMetaDataCache, FileSystemStore) {
+  auto metadata = ReadTestMetaData();
+  auto filesystem =
+      std::make_shared<::arrow::fs::internal::MockFileSystem>(::arrow::fs::kNoTime);
+  auto store = FileMetaDataCache::MakeFileSystemStore(filesystem, "cache/footers");
+  FileMetaDataCache::Key key{"s3://bucket/file.parquet", 1000, "etag"};
+
+  FileMetaDataCache writer(/*capacity=*/4, store);
+  ASSERT_EQ(writer.Get(key), nullptr);
+  writer.Put(key, metadata);
+  ASSERT_EQ(writer.stats().store_errors, 0);
+
+  // A fresh cache, as in another process, reads the footer back from the store
+  FileMetaDataCache reader(/*capacity=*/4, store);
+  auto cached = reader.Get(key);
+  ASSERT_NE(cached, nullptr);
+  ASSERT_TRUE(cached->Equals(*metadata));
+  ASSERT_TRUE(cached->RowGroup(0)->ColumnChunk(0)->GetColumnIndexLocation());
+  ASSERT_EQ(reader.size(), 1);
+  ASSERT_EQ(reader.Get(key), cached);
+  auto stats = reader.stats();
+  ASSERT_EQ(stats.hits, 2);
+  ASSERT_EQ(stats.store_hits, 1);
+  ASSERT_EQ(stats.misses, 0);
+
+  // A rewritten file has another key
+  ASSERT_EQ(reader.Get(FileMetaDataCache::Key{key.path, key.size, "etag2"}), nullptr);
+  ASSERT_EQ(reader.stats().misses, 1);
+
+  // Corrupt entries are misses
+  ::arrow::fs::FileSelector selector;
+  selector.base_dir = "cache/footers";
+  ASSERT_OK_AND_ASSIGN(auto infos, filesystem->GetFileInfo(selector));
+  ASSERT_EQ(infos.size(), 1);
+  ASSERT_OK_AND_ASSIGN(auto output, filesystem->OpenOutputStream(infos[0].path()));
+  ASSERT_OK(output->Write("garbage"));
+  ASSERT_OK(output->Close());
+  FileMetaDataCache other(/*capacity=*/4, store);
+  ASSERT_EQ(other.Get(key), nullptr);
+  ASSERT_EQ(other.stats().misses, 1);
+}
+
+}  // namespace parquet
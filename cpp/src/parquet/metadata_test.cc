@@ -267,6 +267,63 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_TRUE(f_accessor_1->Equals(*f_accessor->Subset({2, 0})));
 }
 
+TEST(Metadata, TestLazyDecoding) {
+  parquet::schema::NodeVector fields;
+  fields.push_back(parquet::schema::Int32("int_col", Repetition::REQUIRED));
+  fields.push_back(parquet::schema::Float("float_col", Repetition::REQUIRED));
+  parquet::SchemaDescriptor schema;
+  schema.Init(parquet::schema::GroupNode::Make("schema", Repetition::REPEATED, fields));
+  auto props = WriterProperties::Builder().build();
+
+  int32_t int_min = 100, int_max = 200;
+  EncodedStatistics stats_int;
+  stats_int.set_null_count(0)
+      .set_min(std::string(reinterpret_cast<const char*>(&int_min), 4))
+      .set_max(std::string(reinterpret_cast<const char*>(&int_max), 4));
+  EncodedStatistics stats_float;
+  float float_min = 1.5f, float_max = 2.5f;
+  stats_float.set_null_count(0)
+      .set_min(std::string(reinterpret_cast<const char*>(&float_min), 4))
+      .set_max(std::string(reinterpret_cast<const char*>(&float_max), 4));
+  auto expected = GenerateTableMetaData(schema, props, 1000, stats_int, stats_float);
+  // Trailing bytes must not be consumed
+  std::string serialized = expected->SerializeToString() + "trailing";
+
+  ReaderProperties reader_props;
+  reader_props.enable_lazy_metadata_decoding();
+  uint32_t len = static_cast<uint32_t>(serialized.size());
+  auto lazy = FileMetaData::Make(serialized.data(), &len, reader_props);
+  ASSERT_EQ(serialized.size() - 8, len);
+  ASSERT_EQ(expected->num_rows(), lazy->num_rows());
+  ASSERT_EQ(expected->num_row_groups(), lazy->num_row_groups());
+  ASSERT_EQ(expected->created_by(), lazy->created_by());
+  ASSERT_TRUE(lazy->schema()->Equals(*expected->schema()));
+
+  // Column chunks are decoded on access, in any order
+  for (int i = expected->num_row_groups() - 1; i >= 0; --i) {
+    auto expected_rg = expected->RowGroup(i);
+    auto lazy_rg = lazy->RowGroup(i);
+    ASSERT_EQ(expected_rg->num_columns(), lazy_rg->num_columns());
+    ASSERT_EQ(expected_rg->num_rows(), lazy_rg->num_rows());
+    ASSERT_EQ(expected_rg->total_byte_size(), lazy_rg->total_byte_size());
+    for (int j = expected_rg->num_columns() - 1; j >= 0; --j) {
+      ASSERT_TRUE(lazy_rg->ColumnChunk(j)->Equals(*expected_rg->ColumnChunk(j)));
+    }
+  }
+
+  // Operations over the whole footer decode what is left
+  auto lazy_2 = FileMetaData::Make(serialized.data(), &len, reader_props);
+  ASSERT_EQ(lazy_2->RowGroup(1)->ColumnChunk(0)->file_offset(),
+            expected->RowGroup(1)->ColumnChunk(0)->file_offset());
+  ASSERT_TRUE(lazy_2->Equals(*expected));
+  ASSERT_EQ(lazy_2->SerializeToString(), expected->SerializeToString());
+  auto lazy_3 = FileMetaData::Make(serialized.data(), &len, reader_props);
+  ASSERT_TRUE(lazy_3->Subset({1})->Equals(*expected->Subset({1})));
+  lazy_3->AppendRowGroups(*expected);
+  ASSERT_EQ(4, lazy_3->num_row_groups());
+  ASSERT_TRUE(lazy_3->RowGroup(3)->Equals(*expected->RowGroup(1)));
+}
+
 TEST(Metadata, TestV1Version) {
   // PARQUET-839
   parquet::schema::NodeVector fields;
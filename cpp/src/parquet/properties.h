@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -47,6 +48,19 @@ namespace parquet {
 /// DataPageV2 at all.
 enum class ParquetDataPageVersion { V1, V2 };
 
+/// Controls whether the writer chooses the encoding of each column chunk itself,
+/// by trial-encoding the first values written to the chunk with every encoding
+/// applicable to its physical type.
+enum class AdaptiveEncoding {
+  /// Use the configured encoding and dictionary settings
+  kDisabled,
+  /// Use the encoding producing the smallest output
+  kSize,
+  /// Use the encoding producing the smallest output, weighted by the relative
+  /// cost of decoding it
+  kSizeAndDecodeCost
+};
+
 /// Align the default buffer size to a small multiple of a page size.
 constexpr int64_t kDefaultBufferSize = 4096 * 4;
 
@@ -83,6 +97,16 @@ class PARQUET_EXPORT ReaderProperties {
   void enable_read_dense_for_nullable() { read_dense_for_nullable_ = true; }
   void disable_read_dense_for_nullable() { read_dense_for_nullable_ = false; }
 
+  /// \brief Whether the file footer is decoded lazily.
+  ///
+  /// When enabled, only the file-level fields of an unencrypted footer are
+  /// decoded when the file is opened. Each row group, and each column chunk
+  /// within it, is decoded on first access, which makes opening very wide
+  /// files much cheaper when only a few columns are read. Default is false.
+  bool is_lazy_metadata_decoding_enabled() const { return lazy_metadata_decoding_; }
+  void enable_lazy_metadata_decoding() { lazy_metadata_decoding_ = true; }
+  void disable_lazy_metadata_decoding() { lazy_metadata_decoding_ = false; }
+
   /// Return the size of the buffered stream buffer.
   int64_t buffer_size() const { return buffer_size_; }
   /// Set the size of the buffered stream buffer in bytes.
@@ -120,6 +144,52 @@ class PARQUET_EXPORT ReaderProperties {
     page_checksum_verification_ = check_crc;
   }
 
+  /// \brief Return the number of pages decompressed ahead of the column reader.
+  ///
+  /// When positive, the pages of a compressed, unencrypted column chunk are
+  /// read ahead and up to this many of them are decompressed in parallel on
+  /// `page_decompression_executor()`, each into its own buffer. Pages
+  /// returned by the page reader then stay valid after the next page is
+  /// requested. Default is 0 (pages are decompressed on demand).
+  int32_t page_readahead() const { return page_readahead_; }
+  /// Set the number of pages decompressed ahead of the column reader.
+  void set_page_readahead(int32_t num_pages) { page_readahead_ = num_pages; }
+
+  /// \brief Return the executor used to decompress pages ahead.
+  ///
+  /// Default is nullptr and the default cpu executor will be used.
+  ::arrow::internal::Executor* page_decompression_executor() const {
+    return page_decompression_executor_;
+  }
+  /// Set the executor used to decompress pages ahead.
+  void set_page_decompression_executor(::arrow::internal::Executor* executor) {
+    page_decompression_executor_ = executor;
+  }
+
+  /// \brief Return the cache consulted for file footers.
+  ///
+  /// When set, ParquetFileReader::OpenFile and dataset scans look up the
+  /// footer of a file by path, size and modification time before reading it,
+  /// and insert it after parsing. Footers of encrypted files are never
+  /// cached. Default is nullptr (no caching); FileMetaDataCache::Global()
+  /// provides a process-wide instance.
+  const std::shared_ptr<FileMetaDataCache>& file_metadata_cache() const {
+    return file_metadata_cache_;
+  }
+  /// Set the cache consulted for file footers.
+  void set_file_metadata_cache(std::shared_ptr<FileMetaDataCache> cache) {
+    file_metadata_cache_ = std::move(cache);
+  }
+
+  /// Options for the codecs decompressing pages, such as
+  /// ::arrow::util::ZstdCodecOptions to decompress pages written with a ZSTD
+  /// dictionary. Default is nullptr (default options).
+  const std::shared_ptr<CodecOptions>& codec_options() const { return codec_options_; }
+  /// Set the options for the codecs decompressing pages.
+  void set_codec_options(std::shared_ptr<CodecOptions> codec_options) {
+    codec_options_ = std::move(codec_options);
+  }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
@@ -127,9 +197,14 @@ class PARQUET_EXPORT ReaderProperties {
   int32_t thrift_container_size_limit_ = kDefaultThriftContainerSizeLimit;
   bool buffered_stream_enabled_ = false;
   bool page_checksum_verification_ = false;
+  int32_t page_readahead_ = 0;
+  ::arrow::internal::Executor* page_decompression_executor_ = NULLPTR;
   // Used with a RecordReader.
   bool read_dense_for_nullable_ = false;
+  bool lazy_metadata_decoding_ = false;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
+  std::shared_ptr<FileMetaDataCache> file_metadata_cache_;
+  std::shared_ptr<CodecOptions> codec_options_;
 };
 
 ReaderProperties PARQUET_EXPORT default_reader_properties();
@@ -139,6 +214,7 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_BYTES = 0;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::UNKNOWN;
@@ -146,6 +222,26 @@ static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = false;
 
+/// Bounds of the data pages cut by content-defined chunking. Sizes are counted
+/// in bytes of the plain (uncompressed, unencoded) values.
+struct PARQUET_EXPORT ContentDefinedChunkingOptions {
+  /// Minimum size of a page, no boundary is looked for before it is reached
+  int64_t min_chunk_size = 256 * 1024;
+  /// Maximum size of a page, a boundary is forced once it is reached
+  int64_t max_chunk_size = 1024 * 1024;
+};
+
+/// Sizing of the bloom filters written for a column.
+struct PARQUET_EXPORT BloomFilterOptions {
+  /// Expected number of distinct values of a column chunk. If unset, the
+  /// number of distinct values of each column chunk is estimated while it is
+  /// written, and no bloom filter is written for chunks that remain fully
+  /// dictionary-encoded, the dictionary page already listing their values.
+  std::optional<int64_t> ndv;
+  /// False positive probability of the bloom filters
+  double fpp = 0.05;
+};
+
 class PARQUET_EXPORT ColumnProperties {
  public:
   ColumnProperties(Encoding::type encoding = DEFAULT_ENCODING,
@@ -192,6 +288,14 @@ class PARQUET_EXPORT ColumnProperties {
     page_index_enabled_ = page_index_enabled;
   }
 
+  void set_adaptive_encoding(AdaptiveEncoding adaptive_encoding) {
+    adaptive_encoding_ = adaptive_encoding;
+  }
+
+  void set_bloom_filter_options(std::optional<BloomFilterOptions> options) {
+    bloom_filter_options_ = options;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -213,6 +317,12 @@ class PARQUET_EXPORT ColumnProperties {
 
   bool page_index_enabled() const { return page_index_enabled_; }
 
+  AdaptiveEncoding adaptive_encoding() const { return adaptive_encoding_; }
+
+  const std::optional<BloomFilterOptions>& bloom_filter_options() const {
+    return bloom_filter_options_;
+  }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -221,6 +331,8 @@ class PARQUET_EXPORT ColumnProperties {
   size_t max_stats_size_;
   std::shared_ptr<CodecOptions> codec_options_;
   bool page_index_enabled_;
+  AdaptiveEncoding adaptive_encoding_ = AdaptiveEncoding::kDisabled;
+  std::optional<BloomFilterOptions> bloom_filter_options_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -232,24 +344,31 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_bytes_(DEFAULT_MAX_ROW_GROUP_BYTES),
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_2_6),
           data_page_version_(ParquetDataPageVersion::V1),
           created_by_(DEFAULT_CREATED_BY),
           store_decimal_as_integer_(false),
-          page_checksum_enabled_(false) {}
+          page_checksum_enabled_(false),
+          content_defined_chunking_enabled_(false) {}
 
     explicit Builder(const WriterProperties& properties)
         : pool_(properties.memory_pool()),
           dictionary_pagesize_limit_(properties.dictionary_pagesize_limit()),
           write_batch_size_(properties.write_batch_size()),
           max_row_group_length_(properties.max_row_group_length()),
+          max_row_group_bytes_(properties.max_row_group_bytes()),
           pagesize_(properties.data_pagesize()),
           version_(properties.version()),
           data_page_version_(properties.data_page_version()),
           created_by_(properties.created_by()),
           store_decimal_as_integer_(properties.store_decimal_as_integer()),
           page_checksum_enabled_(properties.page_checksum_enabled()),
+          content_defined_chunking_enabled_(
+              properties.content_defined_chunking_enabled()),
+          content_defined_chunking_options_(
+              properties.content_defined_chunking_options()),
           sorting_columns_(properties.sorting_columns()),
           default_column_properties_(properties.default_column_properties()) {}
 
@@ -321,6 +440,19 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Specify the target size in bytes of a single row group.
+    ///
+    /// The size is estimated from the pages already encoded and compressed
+    /// plus the values still buffered in the column encoders, so row groups
+    /// end up close to (but may slightly exceed) this target. A row group is
+    /// closed as soon as either this target or max_row_group_length is
+    /// reached. Only honored by the Arrow FileWriter.
+    /// Default 0 (no limit).
+    Builder* max_row_group_bytes(int64_t max_row_group_bytes) {
+      max_row_group_bytes_ = max_row_group_bytes;
+      return this;
+    }
+
     /// Specify the data page size.
     /// Default 1MB.
     Builder* data_pagesize(int64_t pg_size) {
@@ -357,6 +489,33 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief Cut data pages at content-defined boundaries. Default disabled.
+    ///
+    /// Instead of closing a data page once data_pagesize() is reached, page
+    /// boundaries are placed where a rolling hash of the written values matches
+    /// a pattern, within the bounds given by `options`. Inserting or removing
+    /// values then only changes the pages around the edit, so unchanged data
+    /// produces identical pages across versions of a file, which lets
+    /// content-addressed storage deduplicate them. Boundaries are only placed
+    /// between records.
+    Builder* enable_content_defined_chunking(
+        const ContentDefinedChunkingOptions& options = {}) {
+      if (options.min_chunk_size <= 0 ||
+          options.max_chunk_size < options.min_chunk_size) {
+        throw ParquetException(
+            "Content-defined chunking requires 0 < min_chunk_size <= max_chunk_size");
+      }
+      content_defined_chunking_enabled_ = true;
+      content_defined_chunking_options_ = options;
+      return this;
+    }
+
+    /// \brief Cut data pages by size. Default.
+    Builder* disable_content_defined_chunking() {
+      content_defined_chunking_enabled_ = false;
+      return this;
+    }
+
     /// \brief Define the encoding that is used when we don't utilise dictionary encoding.
     //
     /// This either apply if dictionary encoding is disabled or if we fallback
@@ -394,6 +553,34 @@ class PARQUET_EXPORT WriterProperties {
       return this->encoding(path->ToDotString(), encoding_type);
     }
 
+    /// \brief Let the writer choose the encoding of each column chunk.
+    ///
+    /// The first write_batch_size() values of a column chunk are trial-encoded
+    /// with the configured encoding, PLAIN and, unless the format version is 1.0,
+    /// the DELTA_* and BYTE_STREAM_SPLIT encodings supported by the physical type.
+    /// Dictionary encoding is only a candidate if it is enabled for the column.
+    /// The cheapest candidate is then used for the whole column chunk.
+    /// Default AdaptiveEncoding::kDisabled.
+    Builder* adaptive_encoding(AdaptiveEncoding adaptive_encoding) {
+      default_column_properties_.set_adaptive_encoding(adaptive_encoding);
+      return this;
+    }
+
+    /// \brief Let the writer choose the encoding of each chunk of the column
+    /// specified by `path`. Default AdaptiveEncoding::kDisabled.
+    Builder* adaptive_encoding(const std::string& path,
+                               AdaptiveEncoding adaptive_encoding) {
+      adaptive_encodings_[path] = adaptive_encoding;
+      return this;
+    }
+
+    /// \brief Let the writer choose the encoding of each chunk of the column
+    /// specified by `path`. Default AdaptiveEncoding::kDisabled.
+    Builder* adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path,
+                               AdaptiveEncoding adaptive_encoding) {
+      return this->adaptive_encoding(path->ToDotString(), adaptive_encoding);
+    }
+
     /// Specify compression codec in general for all columns.
     /// Default UNCOMPRESSED.
     Builder* compression(Compression::type codec) {
@@ -639,6 +826,51 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_write_page_index(path->ToDotString());
     }
 
+    /// \brief Enable writing bloom filters for all columns but BOOLEAN ones.
+    /// Default disabled.
+    ///
+    /// Bloom filters let readers skip the column chunks which cannot contain a
+    /// given value. Unless `options.ndv` is set, each filter is sized from the
+    /// number of distinct values measured while writing its column chunk.
+    Builder* enable_bloom_filter(const BloomFilterOptions& options = {}) {
+      default_column_properties_.set_bloom_filter_options(options);
+      return this;
+    }
+
+    /// Disable writing bloom filters for all columns. Default disabled.
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_options(std::nullopt);
+      return this;
+    }
+
+    /// Enable writing bloom filters for the column specified by `path`.
+    /// Default disabled.
+    Builder* enable_bloom_filter(const std::string& path,
+                                 const BloomFilterOptions& options = {}) {
+      bloom_filter_options_[path] = options;
+      return this;
+    }
+
+    /// Enable writing bloom filters for the column specified by `path`.
+    /// Default disabled.
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path,
+                                 const BloomFilterOptions& options = {}) {
+      return this->enable_bloom_filter(path->ToDotString(), options);
+    }
+
+    /// Disable writing bloom filters for the column specified by `path`.
+    /// Default disabled.
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_options_[path] = std::nullopt;
+      return this;
+    }
+
+    /// Disable writing bloom filters for the column specified by `path`.
+    /// Default disabled.
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
     /// \brief Build the WriterProperties with the builder parameters.
     /// \return The WriterProperties defined by the builder.
     std::shared_ptr<WriterProperties> build() {
@@ -661,10 +893,15 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_statistics_enabled(item.second);
       for (const auto& item : page_index_enabled_)
         get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : adaptive_encodings_)
+        get(item.first).set_adaptive_encoding(item.second);
+      for (const auto& item : bloom_filter_options_)
+        get(item.first).set_bloom_filter_options(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, page_checksum_enabled_,
+          max_row_group_bytes_, pagesize_, version_, created_by_, page_checksum_enabled_,
+          content_defined_chunking_enabled_, content_defined_chunking_options_,
           std::move(file_encryption_properties_), default_column_properties_,
           column_properties, data_page_version_, store_decimal_as_integer_,
           std::move(sorting_columns_)));
@@ -675,12 +912,15 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_bytes_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
     std::string created_by_;
     bool store_decimal_as_integer_;
     bool page_checksum_enabled_;
+    bool content_defined_chunking_enabled_;
+    ContentDefinedChunkingOptions content_defined_chunking_options_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -695,6 +935,9 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
     std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, AdaptiveEncoding> adaptive_encodings_;
+    std::unordered_map<std::string, std::optional<BloomFilterOptions>>
+        bloom_filter_options_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -705,6 +948,8 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_bytes() const { return max_row_group_bytes_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetDataPageVersion data_page_version() const {
@@ -719,6 +964,14 @@ class PARQUET_EXPORT WriterProperties {
 
   inline bool page_checksum_enabled() const { return page_checksum_enabled_; }
 
+  inline bool content_defined_chunking_enabled() const {
+    return content_defined_chunking_enabled_;
+  }
+
+  inline const ContentDefinedChunkingOptions& content_defined_chunking_options() const {
+    return content_defined_chunking_options_;
+  }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -777,6 +1030,28 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).page_index_enabled();
   }
 
+  AdaptiveEncoding adaptive_encoding(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_encoding();
+  }
+
+  const std::optional<BloomFilterOptions>& bloom_filter_options(
+      const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_options();
+  }
+
+  bool bloom_filter_enabled() const {
+    if (default_column_properties_.bloom_filter_options()) {
+      return true;
+    }
+    for (const auto& item : column_properties_) {
+      if (item.second.bloom_filter_options()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   bool page_index_enabled() const {
     if (default_column_properties_.page_index_enabled()) {
       return true;
@@ -810,8 +1085,10 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
-      const std::string& created_by, bool page_write_checksum_enabled,
+      int64_t max_row_group_length, int64_t max_row_group_bytes, int64_t pagesize,
+      ParquetVersion::type version, const std::string& created_by,
+      bool page_write_checksum_enabled, bool content_defined_chunking_enabled,
+      const ContentDefinedChunkingOptions& content_defined_chunking_options,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
@@ -821,12 +1098,15 @@ class PARQUET_EXPORT WriterProperties {
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_bytes_(max_row_group_bytes),
         pagesize_(pagesize),
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
         parquet_created_by_(created_by),
         store_decimal_as_integer_(store_short_decimal_as_integer),
         page_checksum_enabled_(page_write_checksum_enabled),
+        content_defined_chunking_enabled_(content_defined_chunking_enabled),
+        content_defined_chunking_options_(content_defined_chunking_options),
         file_encryption_properties_(file_encryption_properties),
         sorting_columns_(std::move(sorting_columns)),
         default_column_properties_(default_column_properties),
@@ -836,12 +1116,15 @@ class PARQUET_EXPORT WriterProperties {
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_bytes_;
   int64_t pagesize_;
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
   std::string parquet_created_by_;
   bool store_decimal_as_integer_;
   bool page_checksum_enabled_;
+  bool content_defined_chunking_enabled_;
+  ContentDefinedChunkingOptions content_defined_chunking_options_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -870,7 +1153,8 @@ class PARQUET_EXPORT ArrowReaderProperties {
         batch_size_(kArrowDefaultBatchSize),
         pre_buffer_(true),
         cache_options_(::arrow::io::CacheOptions::LazyDefaults()),
-        coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO) {}
+        coerce_int96_timestamp_unit_(::arrow::TimeUnit::NANO),
+        binary_type_(::arrow::Type::BINARY) {}
 
   /// \brief Set whether to use the IO thread pool to parse columns in parallel.
   ///
@@ -941,6 +1225,19 @@ class PARQUET_EXPORT ArrowReaderProperties {
     return coerce_int96_timestamp_unit_;
   }
 
+  /// \brief Set the Arrow binary type to read BYTE_ARRAY columns as.
+  ///
+  /// Allowed values are Type::BINARY (the default), Type::LARGE_BINARY and
+  /// Type::BINARY_VIEW. String columns are read as the corresponding string
+  /// type. With Type::BINARY_VIEW, values of PLAIN and dictionary-encoded pages
+  /// are not copied: the views reference the decompressed page buffers and the
+  /// dictionary, which are kept alive by the resulting arrays.
+  ///
+  /// Columns read as dictionary (see set_read_dictionary()) are not affected.
+  void set_binary_type(::arrow::Type::type binary_type) { binary_type_ = binary_type; }
+  /// Return the Arrow binary type to read BYTE_ARRAY columns as.
+  ::arrow::Type::type binary_type() const { return binary_type_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
@@ -949,6 +1246,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
   ::arrow::io::IOContext io_context_;
   ::arrow::io::CacheOptions cache_options_;
   ::arrow::TimeUnit::type coerce_int96_timestamp_unit_;
+  ::arrow::Type::type binary_type_;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -1048,6 +1346,11 @@ class PARQUET_EXPORT ArrowWriterProperties {
     /// \brief Set whether to use multiple threads to write columns
     /// in parallel in the buffered row group mode.
     ///
+    /// FileWriter::WriteTable() then also writes each of its row groups as a
+    /// buffered row group: the column chunks are encoded and compressed in
+    /// parallel into memory, and written out in column order once complete.
+    /// This requires holding each encoded row group in memory.
+    ///
     /// WARNING: If writing multiple files in parallel in the same
     /// executor, deadlock may occur if use_threads is true. Please
     /// disable it in this case.
@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/row_ranges.h"
+
+#include <algorithm>
+#include <sstream>
+#include <utility>
+
+#include "parquet/exception.h"
+
+namespace parquet {
+
+RowRanges::RowRanges(std::vector<Range> ranges) {
+  for (const auto& range : ranges) {
+    if (range.offset < 0 || range.length < 0) {
+      throw ParquetException("Invalid row range: offset ", range.offset, ", length ",
+                             range.length);
+    }
+  }
+  ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                              [](const Range& range) { return range.length == 0; }),
+               ranges.end());
+  std::sort(ranges.begin(), ranges.end(), [](const Range& left, const Range& right) {
+    return left.offset < right.offset;
+  });
+  for (const auto& range : ranges) {
+    if (!ranges_.empty() && range.offset <= ranges_.back().end()) {
+      Range& last = ranges_.back();
+      last.length = std::max(last.end(), range.end()) - last.offset;
+    } else {
+      ranges_.push_back(range);
+    }
+  }
+}
+
+RowRanges RowRanges::All(int64_t num_rows) { return RowRanges({{0, num_rows}}); }
+
+RowRanges RowRanges::Intersect(const RowRanges& other) const {
+  RowRanges result;
+  auto left = ranges_.begin();
+  auto right = other.ranges_.begin();
+  while (left != ranges_.end() && right != other.ranges_.end()) {
+    const int64_t start = std::max(left->offset, right->offset);
+    const int64_t end = std::min(left->end(), right->end());
+    if (start < end) {
+      result.ranges_.push_back({start, end - start});
+    }
+    if (left->end() < right->end()) {
+      ++left;
+    } else {
+      ++right;
+    }
+  }
+  return result;
+}
+
+RowRanges RowRanges::Union(const RowRanges& other) const {
+  std::vector<Range> ranges = ranges_;
+  ranges.insert(ranges.end(), other.ranges_.begin(), other.ranges_.end());
+  return RowRanges(std::move(ranges));
+}
+
+bool RowRanges::Overlaps(int64_t offset, int64_t length) const {
+  if (length <= 0) {
+    return false;
+  }
+  // Find the first range ending after `offset`
+  auto it = std::upper_bound(
+      ranges_.begin(), ranges_.end(), offset,
+      [](int64_t value, const Range& range) { return value < range.end(); });
+  return it != ranges_.end() && it->offset < offset + length;
+}
+
+int64_t RowRanges::row_count() const {
+  int64_t count = 0;
+  for (const auto& range : ranges_) {
+    count += range.length;
+  }
+  return count;
+}
+
+std::string RowRanges::ToString() const {
+  std::stringstream ss;
+  ss << "[";
+  for (size_t i = 0; i < ranges_.size(); ++i) {
+    if (i > 0) {
+      ss << ", ";
+    }
+    ss << "[" << ranges_[i].offset << ", " << ranges_[i].end() << ")";
+  }
+  ss << "]";
+  return ss.str();
+}
+
+}  // namespace parquet
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+/// \brief A set of rows selected within a single row group.
+///
+/// Rows are numbered from zero at the start of the row group. The ranges are
+/// kept sorted and disjoint; adjacent ranges are coalesced.
+///
+/// \note API EXPERIMENTAL
+class PARQUET_EXPORT RowRanges {
+ public:
+  /// \brief The half-open range of rows [offset, offset + length).
+  struct Range {
+    int64_t offset;
+    int64_t length;
+
+    int64_t end() const { return offset + length; }
+
+    bool operator==(const Range& other) const {
+      return offset == other.offset && length == other.length;
+    }
+    bool operator!=(const Range& other) const { return !(*this == other); }
+  };
+
+  /// \brief Create an empty selection.
+  RowRanges() = default;
+
+  /// \brief Create a selection from ranges given in any order.
+  ///
+  /// Overlapping and adjacent ranges are merged and empty ranges are dropped.
+  ///
+  /// \throws ParquetException if a range has a negative offset or length.
+  explicit RowRanges(std::vector<Range> ranges);
+
+  /// \brief Select all rows in [0, num_rows).
+  static RowRanges All(int64_t num_rows);
+
+  /// \brief Return the rows selected by both this and other.
+  RowRanges Intersect(const RowRanges& other) const;
+
+  /// \brief Return the rows selected by either this or other.
+  RowRanges Union(const RowRanges& other) const;
+
+  /// \brief Return whether any row in [offset, offset + length) is selected.
+  bool Overlaps(int64_t offset, int64_t length) const;
+
+  /// \brief The total number of selected rows.
+  int64_t row_count() const;
+
+  /// \brief The row following the last selected row, or 0 if none is selected.
+  int64_t end() const { return ranges_.empty() ? 0 : ranges_.back().end(); }
+
+  bool empty() const { return ranges_.empty(); }
+
+  const std::vector<Range>& ranges() const { return ranges_; }
+
+  bool Equals(const RowRanges& other) const { return ranges_ == other.ranges_; }
+  bool operator==(const RowRanges& other) const { return Equals(other); }
+  bool operator!=(const RowRanges& other) const { return !Equals(other); }
+
+  std::string ToString() const;
+
+ private:
+  std::vector<Range> ranges_;
+};
+
+}  // namespace parquet
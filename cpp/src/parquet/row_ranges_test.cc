@@ -0,0 +1,70 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/row_ranges.h"
+
+#include <gtest/gtest.h>
+
+#include "parquet/exception.h"
+
+namespace parquet {
+
+using Range = RowRanges::Range;
+
+TEST(RowRanges, Normalize) {
+  RowRanges ranges({{10, 5}, {0, 3}, {3, 2}, {12, 10}, {30, 0}, {40, 1}});
+  std::vector<Range> expected = {{0, 5}, {10, 12}, {40, 1}};
+  ASSERT_EQ(ranges.ranges(), expected);
+  ASSERT_EQ(ranges.row_count(), 18);
+  ASSERT_EQ(ranges.end(), 41);
+  ASSERT_EQ(ranges.ToString(), "[[0, 5), [10, 22), [40, 41)]");
+
+  ASSERT_TRUE(RowRanges().empty());
+  ASSERT_TRUE(RowRanges({{5, 0}}).empty());
+  ASSERT_EQ(RowRanges().end(), 0);
+  ASSERT_EQ(RowRanges::All(7), RowRanges({{0, 7}}));
+  ASSERT_TRUE(RowRanges::All(0).empty());
+
+  ASSERT_THROW(RowRanges({{-1, 2}}), ParquetException);
+  ASSERT_THROW(RowRanges({{1, -2}}), ParquetException);
+}
+
+TEST(RowRanges, SetOperations) {
+  RowRanges left({{0, 10}, {20, 10}, {50, 5}});
+  RowRanges right({{5, 20}, {28, 30}});
+
+  ASSERT_EQ(left.Intersect(right), RowRanges({{5, 5}, {20, 5}, {28, 2}, {50, 5}}));
+  ASSERT_EQ(right.Intersect(left), left.Intersect(right));
+  ASSERT_EQ(left.Union(right), RowRanges({{0, 58}}));
+  ASSERT_TRUE(left.Intersect(RowRanges()).empty());
+  ASSERT_EQ(left.Union(RowRanges()), left);
+}
+
+TEST(RowRanges, Overlaps) {
+  RowRanges ranges({{10, 10}, {30, 5}});
+  ASSERT_FALSE(ranges.Overlaps(0, 10));
+  ASSERT_TRUE(ranges.Overlaps(0, 11));
+  ASSERT_TRUE(ranges.Overlaps(19, 5));
+  ASSERT_FALSE(ranges.Overlaps(20, 10));
+  ASSERT_TRUE(ranges.Overlaps(20, 11));
+  ASSERT_TRUE(ranges.Overlaps(12, 1));
+  ASSERT_FALSE(ranges.Overlaps(12, 0));
+  ASSERT_FALSE(ranges.Overlaps(35, 100));
+  ASSERT_FALSE(RowRanges().Overlaps(0, 100));
+}
+
+}  // namespace parquet
@@ -23,7 +23,7 @@
 
 namespace parquet {
 
-constexpr int64_t StreamReader::kBatchSizeOne;
+constexpr int64_t StreamReader::kReadBatchSize;
 
 // The converted type expected by the stream reader does not always
 // exactly match with the schema in the Parquet file.  The following
@@ -324,66 +324,42 @@ void StreamReader::ReadFixedLength(char* ptr, int len) {
 
 void StreamReader::Read(ByteArray* v) {
   const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  const ByteArray* value = NextValue<ByteArrayReader>();
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read != 1) {
+  if (value == nullptr) {
     ThrowReadFailedException(node);
   }
+  *v = *value;
 }
 
 bool StreamReader::ReadOptional(ByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader = static_cast<ByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
-
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+  const ByteArray* value = NextValue<ByteArrayReader>();
 
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  if (value == nullptr) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = *value;
+  return true;
 }
 
 void StreamReader::Read(FixedLenByteArray* v) {
   const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  const FixedLenByteArray* value = NextValue<FixedLenByteArrayReader>();
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read != 1) {
+  if (value == nullptr) {
     ThrowReadFailedException(node);
   }
+  *v = *value;
 }
 
 bool StreamReader::ReadOptional(FixedLenByteArray* v) {
-  const auto& node = nodes_[column_index_];
-  auto reader =
-      static_cast<FixedLenByteArrayReader*>(column_readers_[column_index_++].get());
-  int16_t def_level;
-  int16_t rep_level;
-  int64_t values_read;
+  const FixedLenByteArray* value = NextValue<FixedLenByteArrayReader>();
 
-  reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
-
-  if (values_read == 1) {
-    return true;
-  } else if ((values_read == 0) && (def_level == 0)) {
+  if (value == nullptr) {
     return false;
   }
-  ThrowReadFailedException(node);
+  *v = *value;
+  return true;
 }
 
 void StreamReader::EndRow() {
@@ -397,7 +373,8 @@ void StreamReader::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (!column_readers_[0]->HasNext()) {
+  const auto& buffer = column_buffers_[0];
+  if (buffer.level_index == buffer.num_levels && !column_readers_[0]->HasNext()) {
     NextRowGroup();
   }
 }
@@ -409,9 +386,12 @@ void StreamReader::NextRowGroup() {
     ++row_group_index_;
 
     column_readers_.resize(file_metadata_->num_columns());
+    column_buffers_.resize(file_metadata_->num_columns());
 
     for (int i = 0; i < file_metadata_->num_columns(); ++i) {
       column_readers_[i] = row_group_reader_->Column(i);
+      column_buffers_[i].num_levels = 0;
+      column_buffers_[i].level_index = 0;
     }
     if (column_readers_[0]->HasNext()) {
       row_group_row_offset_ = current_row_;
@@ -429,6 +409,7 @@ void StreamReader::SetEof() {
   file_reader_.reset();
   row_group_reader_.reset();
   column_readers_.clear();
+  column_buffers_.clear();
   nodes_.clear();
 }
 
@@ -444,8 +425,8 @@ int64_t StreamReader::SkipRows(int64_t num_rows_to_skip) {
         num_rows_in_row_group - (current_row_ - row_group_row_offset_);
 
     if (num_rows_remaining_in_row_group > num_rows_remaining_to_skip) {
-      for (auto reader : column_readers_) {
-        SkipRowsInColumn(reader.get(), num_rows_remaining_to_skip);
+      for (int i = 0; i < static_cast<int>(column_readers_.size()); ++i) {
+        SkipRowsInColumn(i, num_rows_remaining_to_skip);
       }
       current_row_ += num_rows_remaining_to_skip;
       num_rows_remaining_to_skip = 0;
@@ -465,15 +446,31 @@ int64_t StreamReader::SkipColumns(int64_t num_columns_to_skip) {
     for (; (num_columns_to_skip > num_columns_skipped) &&
            static_cast<std::size_t>(column_index_) < nodes_.size();
          ++column_index_) {
-      SkipRowsInColumn(column_readers_[column_index_].get(), 1);
+      SkipRowsInColumn(column_index_, 1);
       ++num_columns_skipped;
     }
   }
   return num_columns_skipped;
 }
 
-void StreamReader::SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip) {
+void StreamReader::SkipRowsInColumn(int column, int64_t num_rows_to_skip) {
+  ColumnReader* reader = column_readers_[column].get();
+  auto& buffer = column_buffers_[column];
+  const int16_t max_def_level = reader->descr()->max_definition_level();
+
+  // Consume the values read ahead first
   int64_t num_skipped = 0;
+  for (; num_skipped < num_rows_to_skip && buffer.level_index < buffer.num_levels;
+       ++num_skipped) {
+    if (!IsNull(buffer, max_def_level)) {
+      ++buffer.value_index;
+    }
+  }
+  if (num_skipped == num_rows_to_skip) {
+    return;
+  }
+  num_rows_to_skip -= num_skipped;
+  num_skipped = 0;
 
   switch (reader->type()) {
     case Type::BOOLEAN:
@@ -24,6 +24,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "parquet/column_reader.h"
@@ -53,6 +54,12 @@ namespace parquet {
 /// However, if the value is not present then a ParquetException will
 /// be raised.
 ///
+/// Values are read ahead from each column in batches of kReadBatchSize
+/// values.  Rows read through the tuple input operator or ReadRow()
+/// map columns to the fields of a C++ struct, for example:
+///
+///   is >> std::tie(row.id, row.name, row.price) >> EndRow;
+///
 /// Currently there is no support for repeated fields.
 ///
 class PARQUET_EXPORT StreamReader {
@@ -69,6 +76,9 @@ class PARQUET_EXPORT StreamReader {
 
   ~StreamReader() = default;
 
+  /// \brief Number of values read ahead from a column at a time.
+  static constexpr int64_t kReadBatchSize = 1024;
+
   bool eof() const { return eof_; }
 
   int current_column() const { return column_index_; }
@@ -183,6 +193,23 @@ class PARQUET_EXPORT StreamReader {
     return *this;
   }
 
+  /// \brief Input operator for a row or part of a row, each element
+  /// of the tuple being read from the next column.
+  template <typename... Ts>
+  StreamReader& operator>>(std::tuple<Ts&...> values) {
+    std::apply([this](auto&... v) { (void)(*this >> ... >> v); }, values);
+    return *this;
+  }
+
+  /// \brief Read the columns of a row into the given values and advance
+  /// to the next one.
+  template <typename... Ts>
+  StreamReader& ReadRow(Ts&... values) {
+    (void)(*this >> ... >> values);
+    EndRow();
+    return *this;
+  }
+
   /// \brief Terminate current row and advance to next one.
   /// \throws ParquetException if all columns in the row were not
   /// read or skipped.
@@ -209,56 +236,67 @@ class PARQUET_EXPORT StreamReader {
   [[noreturn]] void ThrowReadFailedException(
       const std::shared_ptr<schema::PrimitiveNode>& node);
 
-  template <typename ReaderType, typename T>
-  void Read(T* v) {
+  /// \brief Advance to the next column, returning its value for the
+  /// current row or nullptr if it is null.
+  /// Values are read ahead, a byte array value remaining valid until
+  /// the next value of the column is read.
+  template <typename ReaderType>
+  const typename ReaderType::T* NextValue() {
+    using ValueType = typename ReaderType::T;
     const auto& node = nodes_[column_index_];
+    auto& buffer = column_buffers_[column_index_];
     auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    int64_t values_read;
 
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, v, &values_read);
+    if (buffer.level_index == buffer.num_levels) {
+      buffer.def_levels.resize(kReadBatchSize);
+      buffer.values.resize(kReadBatchSize * sizeof(ValueType));
+      int64_t values_read;
+      buffer.num_levels = reader->ReadBatch(
+          kReadBatchSize, buffer.def_levels.data(), nullptr,
+          reinterpret_cast<ValueType*>(buffer.values.data()), &values_read);
+      buffer.level_index = 0;
+      buffer.value_index = 0;
+      if (buffer.num_levels == 0) {
+        ThrowReadFailedException(node);
+      }
+    }
+    if (IsNull(buffer, reader->descr()->max_definition_level())) {
+      return NULLPTR;
+    }
+    return reinterpret_cast<const ValueType*>(buffer.values.data()) +
+           buffer.value_index++;
+  }
+
+  template <typename ReaderType, typename T>
+  void Read(T* v) {
+    const auto& node = nodes_[column_index_];
+    const auto* value = NextValue<ReaderType>();
 
-    if (values_read != 1) {
+    if (value == NULLPTR) {
       ThrowReadFailedException(node);
     }
+    *v = *value;
   }
 
   template <typename ReaderType, typename ReadType, typename T>
   void Read(T* v) {
     const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
+    const ReadType* value = NextValue<ReaderType>();
 
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
-
-    if (values_read == 1) {
-      *v = tmp;
-    } else {
+    if (value == NULLPTR) {
       ThrowReadFailedException(node);
     }
+    *v = *value;
   }
 
   template <typename ReaderType, typename ReadType = typename ReaderType::T, typename T>
   void ReadOptional(optional<T>* v) {
-    const auto& node = nodes_[column_index_];
-    auto reader = static_cast<ReaderType*>(column_readers_[column_index_++].get());
-    int16_t def_level;
-    int16_t rep_level;
-    ReadType tmp;
-    int64_t values_read;
+    const ReadType* value = NextValue<ReaderType>();
 
-    reader->ReadBatch(kBatchSizeOne, &def_level, &rep_level, &tmp, &values_read);
-
-    if (values_read == 1) {
-      *v = T(tmp);
-    } else if ((values_read == 0) && (def_level == 0)) {
-      v->reset();
+    if (value != NULLPTR) {
+      *v = T(*value);
     } else {
-      ThrowReadFailedException(node);
+      v->reset();
     }
   }
 
@@ -277,15 +315,34 @@ class PARQUET_EXPORT StreamReader {
   void CheckColumn(Type::type physical_type, ConvertedType::type converted_type,
                    int length = 0);
 
-  void SkipRowsInColumn(ColumnReader* reader, int64_t num_rows_to_skip);
+  void SkipRowsInColumn(int column, int64_t num_rows_to_skip);
 
   void SetEof();
 
  private:
+  // The levels and values read ahead from a column
+  struct ColumnBuffer {
+    std::vector<int16_t> def_levels;
+    // The non-null values, in the physical type of the column
+    std::vector<uint8_t> values;
+    int64_t num_levels{0};
+    int64_t level_index{0};
+    int64_t value_index{0};
+  };
+
+  /// \brief Consume the next level of the column buffer, returning
+  /// whether it is null.
+  static bool IsNull(ColumnBuffer& buffer, int16_t max_def_level) {
+    const int64_t level_index = buffer.level_index++;
+    // Levels are only decoded for optional columns
+    return max_def_level > 0 && buffer.def_levels[level_index] < max_def_level;
+  }
+
   std::unique_ptr<ParquetFileReader> file_reader_;
   std::shared_ptr<FileMetaData> file_metadata_;
   std::shared_ptr<RowGroupReader> row_group_reader_;
   std::vector<std::shared_ptr<ColumnReader>> column_readers_;
+  std::vector<ColumnBuffer> column_buffers_;
   std::vector<std::shared_ptr<schema::PrimitiveNode>> nodes_;
 
   bool eof_{true};
@@ -293,8 +350,6 @@ class PARQUET_EXPORT StreamReader {
   int column_index_{0};
   int64_t current_row_{0};
   int64_t row_group_row_offset_{0};
-
-  static constexpr int64_t kBatchSizeOne = 1;
 };  // namespace parquet
 
 PARQUET_EXPORT
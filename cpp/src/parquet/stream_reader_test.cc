@@ -24,6 +24,7 @@
 #include <memory>
 
 #include "arrow/io/file.h"
+#include "arrow/io/memory.h"
 #include "arrow/util/decimal.h"
 #include "parquet/exception.h"
 #include "parquet/test_util.h"
@@ -1035,5 +1036,82 @@ TEST_F(TestMultiRowGroupStreamReader, SkipRows) {
   EXPECT_TRUE(reader_.eof());
 }
 
+TEST(TestStreamRows, RoundTrip) {
+  // More rows than fit in a write or read-ahead batch
+  constexpr int64_t kNumRows = 3 * StreamWriter::kWriteBatchSize + 7;
+
+  struct Row {
+    int64_t id;
+    optional<std::string> name;
+    optional<double> price;
+  };
+  auto make_row = [](int64_t i) {
+    Row row{i, std::nullopt, std::nullopt};
+    if (i % 3 != 0) row.name = "name" + std::to_string(i);
+    if (i % 5 != 0) row.price = i * 0.5;
+    return row;
+  };
+
+  schema::NodeVector fields;
+  fields.push_back(schema::PrimitiveNode::Make("id", Repetition::REQUIRED, Type::INT64,
+                                               ConvertedType::INT_64));
+  fields.push_back(schema::PrimitiveNode::Make("name", Repetition::OPTIONAL,
+                                               Type::BYTE_ARRAY, ConvertedType::UTF8));
+  fields.push_back(schema::PrimitiveNode::Make("price", Repetition::OPTIONAL,
+                                               Type::DOUBLE, ConvertedType::NONE));
+  auto schema = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  PARQUET_ASSIGN_OR_THROW(auto sink, ::arrow::io::BufferOutputStream::Create());
+  {
+    StreamWriter os{ParquetFileWriter::Open(sink, schema)};
+    for (int64_t i = 0; i < kNumRows; ++i) {
+      const Row row = make_row(i);
+      if (i % 2 == 0) {
+        os << std::tie(row.id, row.name, row.price) << EndRow;
+      } else {
+        os.WriteRow(row.id, row.name, row.price);
+      }
+    }
+    // The buffered rows are written out when the writer is destroyed
+  }
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+  StreamReader is{ParquetFileReader::Open(
+      std::make_shared<::arrow::io::BufferReader>(std::move(buffer)))};
+  ASSERT_EQ(kNumRows, is.num_rows());
+
+  auto expect_row = [&](int64_t i) {
+    Row row;
+    if (i % 2 == 0) {
+      is >> std::tie(row.id, row.name, row.price) >> EndRow;
+    } else {
+      is.ReadRow(row.id, row.name, row.price);
+    }
+    const Row expected = make_row(i);
+    EXPECT_EQ(expected.id, row.id);
+    EXPECT_EQ(expected.name, row.name) << "index: " << i;
+    EXPECT_EQ(expected.price, row.price) << "index: " << i;
+  };
+
+  for (int64_t i = 0; i < 10; ++i) {
+    expect_row(i);
+  }
+  // Skipping within and beyond the values read ahead
+  ASSERT_EQ(5, is.SkipRows(5));
+  expect_row(15);
+  ASSERT_EQ(1500, is.SkipRows(1500));
+  expect_row(1516);
+  int64_t id;
+  is >> id;
+  EXPECT_EQ(1517, id);
+  ASSERT_EQ(2, is.SkipColumns(2));
+  is >> EndRow;
+  for (int64_t i = 1518; i < kNumRows; ++i) {
+    expect_row(i);
+  }
+  EXPECT_TRUE(is.eof());
+}
+
 }  // namespace test
 }  // namespace parquet
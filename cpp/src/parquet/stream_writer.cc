@@ -25,8 +25,18 @@ int64_t StreamWriter::default_row_group_size_{512 * 1024 * 1024};  // 512MB
 
 constexpr int16_t StreamWriter::kDefLevelZero;
 constexpr int16_t StreamWriter::kDefLevelOne;
-constexpr int16_t StreamWriter::kRepLevelZero;
-constexpr int64_t StreamWriter::kBatchSizeOne;
+constexpr int64_t StreamWriter::kWriteBatchSize;
+
+namespace {
+
+template <typename WriterType>
+void WriteBufferedValues(ColumnWriter* writer, const std::vector<int16_t>& def_levels,
+                         const typename WriterType::T* values) {
+  static_cast<WriterType*>(writer)->WriteBatch(static_cast<int64_t>(def_levels.size()),
+                                               def_levels.data(), nullptr, values);
+}
+
+}  // namespace
 
 StreamWriter::FixedStringView::FixedStringView(const char* data_ptr)
     : data{data_ptr}, size{std::strlen(data_ptr)} {}
@@ -41,12 +51,43 @@ StreamWriter::StreamWriter(std::unique_ptr<ParquetFileWriter> writer)
   auto group_node = schema->group_node();
 
   nodes_.resize(schema->num_columns());
+  column_buffers_.resize(schema->num_columns());
 
   for (auto i = 0; i < schema->num_columns(); ++i) {
     nodes_[i] = std::static_pointer_cast<schema::PrimitiveNode>(group_node->field(i));
   }
 }
 
+StreamWriter::~StreamWriter() {
+  // The file writer is closed when destroyed, so the buffered rows
+  // must be written out beforehand.
+  if (file_writer_) {
+    try {
+      FlushColumns();
+    } catch (...) {
+    }
+  }
+}
+
+StreamWriter& StreamWriter::operator=(StreamWriter&& other) {
+  if (this != &other) {
+    if (file_writer_) {
+      FlushColumns();
+    }
+    column_index_ = other.column_index_;
+    current_row_ = other.current_row_;
+    row_group_size_ = other.row_group_size_;
+    max_row_group_size_ = other.max_row_group_size_;
+    buffered_rows_ = other.buffered_rows_;
+    buffered_bytes_ = other.buffered_bytes_;
+    row_group_writer_ = std::move(other.row_group_writer_);
+    file_writer_ = std::move(other.file_writer_);
+    nodes_ = std::move(other.nodes_);
+    column_buffers_ = std::move(other.column_buffers_);
+  }
+  return *this;
+}
+
 void StreamWriter::SetDefaultMaxRowGroupSize(int64_t max_size) {
   default_row_group_size_ = max_size;
 }
@@ -144,20 +185,15 @@ StreamWriter& StreamWriter::WriteVariableLength(const char* data_ptr,
                                                 std::size_t data_len) {
   CheckColumn(Type::BYTE_ARRAY, ConvertedType::UTF8);
 
-  auto writer = static_cast<ByteArrayWriter*>(row_group_writer_->column(column_index_++));
+  auto& buffer = column_buffers_[column_index_++];
 
   if (data_ptr != nullptr) {
-    ByteArray ba_value;
-
-    ba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-    ba_value.len = static_cast<uint32_t>(data_len);
-
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &ba_value);
+    buffer.def_levels.push_back(kDefLevelOne);
+    buffer.lengths.push_back(static_cast<uint32_t>(data_len));
+    buffer.data.append(data_ptr, data_len);
+    buffered_bytes_ += static_cast<int64_t>(data_len);
   } else {
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-  }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->estimated_buffered_value_bytes();
+    buffer.def_levels.push_back(kDefLevelZero);
   }
   return *this;
 }
@@ -166,19 +202,14 @@ StreamWriter& StreamWriter::WriteFixedLength(const char* data_ptr, std::size_t d
   CheckColumn(Type::FIXED_LEN_BYTE_ARRAY, ConvertedType::NONE,
               static_cast<int>(data_len));
 
-  auto writer =
-      static_cast<FixedLenByteArrayWriter*>(row_group_writer_->column(column_index_++));
+  auto& buffer = column_buffers_[column_index_++];
 
   if (data_ptr != nullptr) {
-    FixedLenByteArray flba_value;
-
-    flba_value.ptr = reinterpret_cast<const uint8_t*>(data_ptr);
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &flba_value);
+    buffer.def_levels.push_back(kDefLevelOne);
+    buffer.data.append(data_ptr, data_len);
+    buffered_bytes_ += static_cast<int64_t>(data_len);
   } else {
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-  }
-  if (max_row_group_size_ > 0) {
-    row_group_size_ += writer->estimated_buffered_value_bytes();
+    buffer.def_levels.push_back(kDefLevelZero);
   }
   return *this;
 }
@@ -226,47 +257,90 @@ int64_t StreamWriter::SkipColumns(int num_columns_to_skip) {
       throw ParquetException("Cannot skip column '" + node->name() +
                              "' as it is required.");
     }
-    auto writer = row_group_writer_->column(column_index_++);
-
-    WriteNullValue(writer);
+    column_buffers_[column_index_++].def_levels.push_back(kDefLevelZero);
   }
   return num_columns_skipped;
 }
 
-void StreamWriter::WriteNullValue(ColumnWriter* writer) {
-  switch (writer->type()) {
-    case Type::BOOLEAN:
-      static_cast<BoolWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                   &kRepLevelZero, nullptr);
-      break;
-    case Type::INT32:
-      static_cast<Int32Writer*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::INT64:
-      static_cast<Int64Writer*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::BYTE_ARRAY:
-      static_cast<ByteArrayWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                        &kRepLevelZero, nullptr);
-      break;
-    case Type::FIXED_LEN_BYTE_ARRAY:
-      static_cast<FixedLenByteArrayWriter*>(writer)->WriteBatch(
-          kBatchSizeOne, &kDefLevelZero, &kRepLevelZero, nullptr);
-      break;
-    case Type::FLOAT:
-      static_cast<FloatWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                    &kRepLevelZero, nullptr);
-      break;
-    case Type::DOUBLE:
-      static_cast<DoubleWriter*>(writer)->WriteBatch(kBatchSizeOne, &kDefLevelZero,
-                                                     &kRepLevelZero, nullptr);
-      break;
-    case Type::INT96:
-    case Type::UNDEFINED:
-      throw ParquetException("Unexpected type: " + TypeToString(writer->type()));
-      break;
+void StreamWriter::FlushColumns() {
+  if (buffered_rows_ == 0) {
+    return;
+  }
+  std::vector<ByteArray> byte_arrays;
+  std::vector<FixedLenByteArray> fixed_len_byte_arrays;
+
+  for (int i = 0; i < num_columns(); ++i) {
+    auto& buffer = column_buffers_[i];
+    auto writer = row_group_writer_->column(i);
+
+    switch (writer->type()) {
+      case Type::BOOLEAN:
+        WriteBufferedValues<BoolWriter>(
+            writer, buffer.def_levels,
+            reinterpret_cast<const bool*>(buffer.values.data()));
+        break;
+      case Type::INT32:
+        WriteBufferedValues<Int32Writer>(
+            writer, buffer.def_levels,
+            reinterpret_cast<const int32_t*>(buffer.values.data()));
+        break;
+      case Type::INT64:
+        WriteBufferedValues<Int64Writer>(
+            writer, buffer.def_levels,
+            reinterpret_cast<const int64_t*>(buffer.values.data()));
+        break;
+      case Type::FLOAT:
+        WriteBufferedValues<FloatWriter>(
+            writer, buffer.def_levels,
+            reinterpret_cast<const float*>(buffer.values.data()));
+        break;
+      case Type::DOUBLE:
+        WriteBufferedValues<DoubleWriter>(
+            writer, buffer.def_levels,
+            reinterpret_cast<const double*>(buffer.values.data()));
+        break;
+      case Type::BYTE_ARRAY: {
+        byte_arrays.resize(buffer.lengths.size());
+        const auto* data = reinterpret_cast<const uint8_t*>(buffer.data.data());
+        for (size_t j = 0; j < buffer.lengths.size(); ++j) {
+          byte_arrays[j] = ByteArray(buffer.lengths[j], data);
+          data += buffer.lengths[j];
+        }
+        WriteBufferedValues<ByteArrayWriter>(writer, buffer.def_levels,
+                                             byte_arrays.data());
+        break;
+      }
+      case Type::FIXED_LEN_BYTE_ARRAY: {
+        const int type_length = nodes_[i]->type_length();
+        fixed_len_byte_arrays.resize(buffer.data.size() / type_length);
+        const auto* data = reinterpret_cast<const uint8_t*>(buffer.data.data());
+        for (auto& value : fixed_len_byte_arrays) {
+          value.ptr = data;
+          data += type_length;
+        }
+        WriteBufferedValues<FixedLenByteArrayWriter>(writer, buffer.def_levels,
+                                                     fixed_len_byte_arrays.data());
+        break;
+      }
+      case Type::INT96:
+      case Type::UNDEFINED:
+        throw ParquetException("Unexpected type: " + TypeToString(writer->type()));
+        break;
+    }
+    buffer.def_levels.clear();
+    buffer.values.clear();
+    buffer.lengths.clear();
+    buffer.data.clear();
+  }
+  buffered_rows_ = 0;
+  buffered_bytes_ = 0;
+
+  // Size already written (compressed + uncompressed), and buffered by
+  // the column writers.
+  row_group_size_ = row_group_writer_->total_bytes_written() +
+                    row_group_writer_->total_compressed_bytes();
+  for (int i = 0; i < num_columns(); ++i) {
+    row_group_size_ += row_group_writer_->column(i)->estimated_buffered_value_bytes();
   }
 }
 
@@ -288,14 +362,12 @@ void StreamWriter::EndRow() {
   column_index_ = 0;
   ++current_row_;
 
-  if (max_row_group_size_ > 0) {
-    if (row_group_size_ > max_row_group_size_) {
-      EndRowGroup();
-    }
-    // Initialize for each row with size already written
-    // (compressed + uncompressed).
-    row_group_size_ = row_group_writer_->total_bytes_written() +
-                      row_group_writer_->total_compressed_bytes();
+  if (++buffered_rows_ >= kWriteBatchSize) {
+    FlushColumns();
+  }
+  if (max_row_group_size_ > 0 &&
+      row_group_size_ + buffered_bytes_ > max_row_group_size_) {
+    EndRowGroup();
   }
 }
 
@@ -303,10 +375,12 @@ void StreamWriter::EndRowGroup() {
   if (!file_writer_) {
     throw ParquetException("StreamWriter not initialized");
   }
+  FlushColumns();
   // Avoid creating empty row groups.
   if (row_group_writer_->num_rows() > 0) {
     row_group_writer_->Close();
     row_group_writer_.reset(file_writer_->AppendBufferedRowGroup());
+    row_group_size_ = 0;
   }
 }
 
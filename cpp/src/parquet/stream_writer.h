@@ -24,6 +24,9 @@
 #include <optional>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "parquet/column_writer.h"
@@ -57,6 +60,13 @@ namespace parquet {
 /// have a value (i.e. it is nullopt) then a ParquetException will be
 /// raised.
 ///
+/// Values are buffered per column and written out in batches of
+/// kWriteBatchSize rows, or when the row group ends.  Rows written
+/// through the tuple output operator or WriteRow() map the fields of
+/// a C++ struct to columns, for example:
+///
+///   os << std::tie(row.id, row.name, row.price) << EndRow;
+///
 /// Currently there is no support for repeated fields.
 ///
 class PARQUET_EXPORT StreamWriter {
@@ -71,7 +81,12 @@ class PARQUET_EXPORT StreamWriter {
 
   explicit StreamWriter(std::unique_ptr<ParquetFileWriter> writer);
 
-  ~StreamWriter() = default;
+  /// \brief Write out the buffered rows.
+  ~StreamWriter();
+
+  /// \brief Number of rows buffered before the values of each column
+  /// are written out in a single batch.
+  static constexpr int64_t kWriteBatchSize = 1024;
 
   static void SetDefaultMaxRowGroupSize(int64_t max_size);
 
@@ -85,7 +100,7 @@ class PARQUET_EXPORT StreamWriter {
 
   // Moving is possible.
   StreamWriter(StreamWriter&&) = default;
-  StreamWriter& operator=(StreamWriter&&) = default;
+  StreamWriter& operator=(StreamWriter&&);
 
   // Copying is not allowed.
   StreamWriter(const StreamWriter&) = delete;
@@ -161,6 +176,22 @@ class PARQUET_EXPORT StreamWriter {
     return *this;
   }
 
+  /// \brief Output operator for a row or part of a row, each element
+  /// of the tuple being written to the next column.
+  template <typename... Ts>
+  StreamWriter& operator<<(const std::tuple<Ts...>& values) {
+    std::apply([this](const auto&... v) { (void)(*this << ... << v); }, values);
+    return *this;
+  }
+
+  /// \brief Write the given values to the columns of a row and end it.
+  template <typename... Ts>
+  StreamWriter& WriteRow(const Ts&... values) {
+    (void)(*this << ... << values);
+    EndRow();
+    return *this;
+  }
+
   /// \brief Skip the next N columns of optional data.  If there are
   /// less than N columns remaining then the excess columns are
   /// ignored.
@@ -180,13 +211,14 @@ class PARQUET_EXPORT StreamWriter {
  protected:
   template <typename WriterType, typename T>
   StreamWriter& Write(const T v) {
-    auto writer = static_cast<WriterType*>(row_group_writer_->column(column_index_++));
-
-    writer->WriteBatch(kBatchSizeOne, &kDefLevelOne, &kRepLevelZero, &v);
-
-    if (max_row_group_size_ > 0) {
-      row_group_size_ += writer->estimated_buffered_value_bytes();
-    }
+    static_assert(std::is_same<typename WriterType::T, T>::value,
+                  "Values must be of the physical type of the column");
+    auto& buffer = column_buffers_[column_index_++];
+
+    buffer.def_levels.push_back(kDefLevelOne);
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&v);
+    buffer.values.insert(buffer.values.end(), bytes, bytes + sizeof(T));
+    buffered_bytes_ += sizeof(T);
     return *this;
   }
 
@@ -202,11 +234,23 @@ class PARQUET_EXPORT StreamWriter {
   /// not optional.
   void SkipOptionalColumn();
 
-  void WriteNullValue(ColumnWriter* writer);
+  /// \brief Write the buffered values of each column to the row group.
+  void FlushColumns();
 
  private:
   using node_ptr_type = std::shared_ptr<schema::PrimitiveNode>;
 
+  // The values of a column which are not written to the row group yet
+  struct ColumnBuffer {
+    std::vector<int16_t> def_levels;
+    // The non-null values of fixed width physical types
+    std::vector<uint8_t> values;
+    // The lengths of the non-null byte array values, whose contents are
+    // concatenated in `data` along with those of fixed length byte arrays
+    std::vector<uint32_t> lengths;
+    std::string data;
+  };
+
   struct null_deleter {
     void operator()(void*) {}
   };
@@ -215,15 +259,16 @@ class PARQUET_EXPORT StreamWriter {
   int64_t current_row_{0};
   int64_t row_group_size_{0};
   int64_t max_row_group_size_{default_row_group_size_};
+  int64_t buffered_rows_{0};
+  int64_t buffered_bytes_{0};
 
   std::unique_ptr<ParquetFileWriter> file_writer_;
   std::unique_ptr<RowGroupWriter, null_deleter> row_group_writer_;
   std::vector<node_ptr_type> nodes_;
+  std::vector<ColumnBuffer> column_buffers_;
 
   static constexpr int16_t kDefLevelZero = 0;
   static constexpr int16_t kDefLevelOne = 1;
-  static constexpr int16_t kRepLevelZero = 0;
-  static constexpr int64_t kBatchSizeOne = 1;
 
   static int64_t default_row_group_size_;
 };
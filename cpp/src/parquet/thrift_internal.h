@@ -388,6 +388,12 @@ static inline format::EncryptionAlgorithm ToThrift(EncryptionAlgorithm encryptio
 
 using ThriftBuffer = apache::thrift::transport::TMemoryBuffer;
 
+// A byte range within a serialized thrift message
+struct ThriftByteRange {
+  uint32_t offset;
+  uint32_t length;
+};
+
 class ThriftDeserializer {
  public:
   explicit ThriftDeserializer(const ReaderProperties& properties)
@@ -427,6 +433,59 @@ class ThriftDeserializer {
     }
   }
 
+  // Locate the list-typed field `field_id` of the unencrypted thrift struct
+  // serialized in buf/len, skipping over all fields without materializing them.
+  // Returns false if the struct has no such field.  Otherwise `list_range` is
+  // set to the bytes of the list (header included) and `element_ranges` to the
+  // bytes of each list element.
+  bool LocateListField(const uint8_t* buf, uint32_t len, int16_t field_id,
+                       ThriftByteRange* list_range,
+                       std::vector<ThriftByteRange>* element_ranges) {
+    using apache::thrift::protocol::TType;
+    auto tmem_transport = CreateReadOnlyMemoryBuffer(const_cast<uint8_t*>(buf), len);
+    apache::thrift::protocol::TCompactProtocolFactoryT<ThriftBuffer> tproto_factory;
+    tproto_factory.setStringSizeLimit(string_size_limit_);
+    tproto_factory.setContainerSizeLimit(container_size_limit_);
+    auto tproto = tproto_factory.getProtocol(tmem_transport);
+    auto position = [&]() { return len - tmem_transport->available_read(); };
+
+    bool found = false;
+    try {
+      std::string name;
+      TType field_type;
+      int16_t id;
+      tproto->readStructBegin(name);
+      while (true) {
+        tproto->readFieldBegin(name, field_type, id);
+        if (field_type == apache::thrift::protocol::T_STOP) break;
+        if (id == field_id && field_type == apache::thrift::protocol::T_LIST) {
+          list_range->offset = position();
+          TType element_type;
+          uint32_t size;
+          tproto->readListBegin(element_type, size);
+          element_ranges->resize(size);
+          for (uint32_t i = 0; i < size; ++i) {
+            const uint32_t start = position();
+            tproto->skip(element_type);
+            (*element_ranges)[i] = {start, position() - start};
+          }
+          tproto->readListEnd();
+          list_range->length = position() - list_range->offset;
+          found = true;
+        } else {
+          tproto->skip(field_type);
+        }
+        tproto->readFieldEnd();
+      }
+      tproto->readStructEnd();
+    } catch (std::exception& e) {
+      std::stringstream ss;
+      ss << "Couldn't deserialize thrift: " << e.what() << "\n";
+      throw ParquetException(ss.str());
+    }
+    return found;
+  }
+
  private:
   // On Thrift 0.14.0+, we want to use TConfiguration to raise the max message size
   // limit (ARROW-13655).  If we wanted to protect against huge messages, we could
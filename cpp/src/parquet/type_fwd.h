@@ -69,6 +69,7 @@ struct ParquetVersion {
 };
 
 class FileMetaData;
+class FileMetaDataCache;
 class RowGroupMetaData;
 
 class ColumnDescriptor;